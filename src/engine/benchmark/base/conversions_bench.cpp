@@ -0,0 +1,69 @@
+#include <base/utils/stringUtils.hpp>
+
+#include <charconv>
+#include <cstdlib>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+// Proctitle of an audit event, hexa encoded
+const std::string proctitleHex {"2F7573722F62696E2F707974686F6E33002F7573722F7362696E2F66697265776"
+                                "16C6C64002D2D6E6F666F726B002D2D6E6F706964"};
+} // namespace
+
+static void decodeHex_strtol(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::string decoded;
+        decoded.resize(proctitleHex.size() / 2);
+        for (std::size_t i = 0; i < proctitleHex.size(); i += 2)
+        {
+            const auto byte = proctitleHex.substr(i, 2);
+            decoded[i / 2] = static_cast<char>(std::strtol(byte.c_str(), nullptr, 16));
+        }
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * proctitleHex.size());
+}
+
+BENCHMARK(decodeHex_strtol);
+
+static void decodeHex_table(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::string decoded(proctitleHex.size() / 2, '\0');
+        benchmark::DoNotOptimize(base::utils::string::decodeHex(proctitleHex, decoded.data()));
+        benchmark::DoNotOptimize(decoded);
+    }
+    state.SetBytesProcessed(state.iterations() * proctitleHex.size());
+}
+
+BENCHMARK(decodeHex_table);
+
+static void intToString_toString(benchmark::State& state)
+{
+    int64_t value = 1234567890;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::to_string(value++));
+    }
+}
+
+BENCHMARK(intToString_toString);
+
+static void intToString_toChars(benchmark::State& state)
+{
+    int64_t value = 1234567890;
+    char buffer[64];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(std::to_chars(buffer, buffer + sizeof(buffer), value++));
+        benchmark::ClobberMemory();
+    }
+}
+
+BENCHMARK(intToString_toChars);
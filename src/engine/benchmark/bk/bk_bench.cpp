@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <bk/bc/controller.hpp>
+#include <bk/rx/controller.hpp>
+#include <bk/taskf/controller.hpp>
+
+namespace
+{
+const std::string FIELD_PATH {"/field"};
+
+// Condition term, succeeds only for the decoder of the event
+base::Expression checkTerm(const std::string& name, int64_t value)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [value](base::Event event)
+                                              {
+                                                  if (event->getIntAsInt64(FIELD_PATH) == value)
+                                                  {
+                                                      return base::result::makeSuccess(std::move(event), "success");
+                                                  }
+                                                  return base::result::makeFailure(std::move(event), "failure");
+                                              });
+}
+
+// Map term, always succeeds
+base::Expression mapTerm(const std::string& name)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [](base::Event event)
+                                              {
+                                                  event->setBool(true, "/mapped");
+                                                  return base::result::makeSuccess(std::move(event), "success");
+                                              });
+}
+
+/**
+ * @brief Build an expression shaped as a decoder tree: an Or of `decoders` implications, each with a two term
+ * condition and a two maps consequence.
+ */
+base::Expression decoderTree(int64_t decoders)
+{
+    std::vector<base::Expression> implications;
+    for (int64_t i = 0; i < decoders; ++i)
+    {
+        auto name = "decoder/" + std::to_string(i);
+        auto condition =
+            base::And::create(name + "/check", {checkTerm(name + "/check/0", i), checkTerm(name + "/check/1", i)});
+        auto consequence = base::Chain::create(name + "/map", {mapTerm(name + "/map/0"), mapTerm(name + "/map/1")});
+        implications.emplace_back(base::Implication::create(name, condition, consequence));
+    }
+
+    return base::Or::create("decoders", implications);
+}
+
+// The event matches the last decoder, so every condition is evaluated
+template<typename Controller>
+void BM_DecoderTree(benchmark::State& state)
+{
+    const auto decoders = state.range(0);
+    Controller controller {decoderTree(decoders), {}};
+
+    for (auto _ : state)
+    {
+        auto event = std::make_shared<json::Json>();
+        event->setInt64(decoders - 1, FIELD_PATH);
+        event = controller.ingestGet(std::move(event));
+        benchmark::DoNotOptimize(event);
+    }
+}
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_DecoderTree, bk::rx::Controller)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DecoderTree, bk::taskf::Controller)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_DecoderTree, bk::bc::Controller)->Arg(10)->Arg(100)->Arg(1000);
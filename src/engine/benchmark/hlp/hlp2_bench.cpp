@@ -599,3 +599,90 @@ static void BM_pocLitIpLitFailureLastLit(benchmark::State& state)
     }
 }
 BENCHMARK(BM_pocLitIpLitFailureLastLit);
+
+// Long log lines, the end tokens and delimiters are far from the start of the input
+
+static void BM_textLongLine(benchmark::State& state)
+{
+    std::string input = randomString(state.range(0)) + " end";
+    std::string_view inputView(input);
+    auto textP = hlp::parsers::getTextParser({.name = "text", .targetField = "", .stop = {" end"}, .options = {}});
+
+    for (auto _ : state)
+    {
+        auto result = textP(inputView);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_textLongLine)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BM_betweenLongLine(benchmark::State& state)
+{
+    std::string input = "[" + randomString(state.range(0)) + "]";
+    std::string_view inputView(input);
+    auto betweenP =
+        hlp::parsers::getBetweenParser({.name = "between", .targetField = "", .stop = {}, .options = {"[", "]"}});
+
+    for (auto _ : state)
+    {
+        auto result = betweenP(inputView);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_betweenLongLine)->RangeMultiplier(4)->Range(64, 16384);
+
+static void BM_csvLongFields(benchmark::State& state)
+{
+    std::string input =
+        randomString(state.range(0)) + "," + randomString(state.range(0)) + "," + randomString(state.range(0));
+    std::string_view inputView(input);
+    auto csvP =
+        hlp::parsers::getCSVParser({.name = "csv", .targetField = "", .stop = {""}, .options = {"a", "b", "c"}});
+
+    for (auto _ : state)
+    {
+        auto result = csvP(inputView);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_csvLongFields)->RangeMultiplier(4)->Range(16, 4096);
+
+// Base64 blobs, as the encoded commands of PowerShell logs, ended by a padding and a space
+static void BM_binaryBlob(benchmark::State& state)
+{
+    std::string input = randomString(state.range(0) - 4) + "ab== end";
+    std::string_view inputView(input);
+    auto binaryP = hlp::parsers::getBinaryParser({.name = "binary", .targetField = "", .stop = {}, .options = {}});
+
+    for (auto _ : state)
+    {
+        auto result = binaryP(inputView);
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+
+        if (result.failure())
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_binaryBlob)->RangeMultiplier(16)->Range(64, 1 << 20);
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <parsec/parsec.hpp>
+#include <parsec/staticParser.hpp>
+
+// The same key=value list grammar written with the std::function parsers and with the static ones
+namespace
+{
+std::string kvInput(int pairs)
+{
+    std::string input;
+    for (int i = 0; i < pairs; ++i)
+    {
+        input += (i == 0 ? "" : " ") + std::string {"key"} + std::to_string(i) + "=value" + std::to_string(i);
+    }
+
+    return input;
+}
+
+bool isWordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+}
+
+parsec::Parser<char> parsecChar(char c)
+{
+    return [c](std::string_view text, size_t index)
+    {
+        if (index < text.size() && text[index] == c)
+        {
+            return parsec::makeSuccess<char>(char {c}, index + 1);
+        }
+        return parsec::makeError<char>("unexpected character", index);
+    };
+}
+
+parsec::Parser<std::string_view> parsecWord()
+{
+    return [](std::string_view text, size_t index)
+    {
+        auto end = index;
+        while (end < text.size() && isWordChar(text[end]))
+        {
+            ++end;
+        }
+        if (end == index)
+        {
+            return parsec::makeError<std::string_view>("expected word", index);
+        }
+        return parsec::makeSuccess<std::string_view>(text.substr(index, end - index), end);
+    };
+}
+
+auto spChar(char c)
+{
+    return parsec::sp::make(
+        [c](std::string_view text, size_t index)
+        {
+            if (index < text.size() && text[index] == c)
+            {
+                return parsec::sp::makeSuccess<char>(char {c}, index + 1);
+            }
+            return parsec::sp::makeError<char>("unexpected character", index);
+        });
+}
+
+auto spWord()
+{
+    return parsec::sp::make(
+        [](std::string_view text, size_t index)
+        {
+            auto end = index;
+            while (end < text.size() && isWordChar(text[end]))
+            {
+                ++end;
+            }
+            if (end == index)
+            {
+                return parsec::sp::makeError<std::string_view>("expected word", index);
+            }
+            return parsec::sp::makeSuccess<std::string_view>(text.substr(index, end - index), end);
+        });
+}
+
+auto spGrammar()
+{
+    using namespace parsec::sp;
+    return many((spWord() & (spChar('=') >> spWord())) << opt(spChar(' ')));
+}
+} // namespace
+
+static void BM_parsecKeyValueList(benchmark::State& state)
+{
+    using namespace parsec;
+    const auto input = kvInput(state.range(0));
+    Parser<std::tuple<std::string_view, std::string_view>> pair = parsecWord() & (parsecChar('=') >> parsecWord());
+    auto grammar = many(pair << opt(parsecChar(' ')));
+
+    for (auto _ : state)
+    {
+        auto result = grammar(input, 0);
+        benchmark::DoNotOptimize(result);
+
+        if (result.failure() || result.value().size() != static_cast<size_t>(state.range(0)))
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_parsecKeyValueList)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_staticKeyValueList(benchmark::State& state)
+{
+    const auto input = kvInput(state.range(0));
+    const auto grammar = spGrammar();
+
+    for (auto _ : state)
+    {
+        auto result = grammar(input, 0);
+        benchmark::DoNotOptimize(result);
+
+        if (result.failure() || result.value().size() != static_cast<size_t>(state.range(0)))
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_staticKeyValueList)->RangeMultiplier(4)->Range(1, 256);
+
+// Static grammar behind a single std::function, as seen from the code using parsec::Parser
+static void BM_staticErasedKeyValueList(benchmark::State& state)
+{
+    const auto input = kvInput(state.range(0));
+    const auto grammar = parsec::sp::erase(spGrammar());
+
+    for (auto _ : state)
+    {
+        auto result = grammar(input, 0);
+        benchmark::DoNotOptimize(result);
+
+        if (result.failure() || result.value().size() != static_cast<size_t>(state.range(0)))
+        {
+            state.SkipWithError("Parsing failed");
+        }
+    }
+}
+BENCHMARK(BM_staticErasedKeyValueList)->RangeMultiplier(4)->Range(1, 256);
@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include <curl/curl.h>
+
+#include "uri.hpp"
+
+namespace
+{
+// URLs of web access and proxy logs
+constexpr std::array<std::string_view, 6> URLS {
+    "https://demo.wazuh.com:8080/user.php?name=pepe&pass=123#login",
+    "http://192.168.0.1/index.html",
+    "https://john.doe@localhost:123/forum/questions/?tag=networking&order=newest#top",
+    "http://cdn.example.com/static/js/app.min.js?v=20240101",
+    "https://api.example.com/v1/users/42/orders?page=2&per_page=50&sort=-created_at",
+    "http://www.example.org/wp-login.php"};
+
+void urlCleanup(CURLU* url)
+{
+    curl_url_cleanup(url);
+}
+} // namespace
+
+static void BM_uriScan(benchmark::State& state)
+{
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        auto parts = hlp::uri::scan(URLS[i++ % URLS.size()]);
+        benchmark::DoNotOptimize(parts);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_uriScan);
+
+// What the parser did for every URL before the scanner: parse with libcurl and copy each part
+static void BM_uriCurl(benchmark::State& state)
+{
+    constexpr std::array<CURLUPart, 9> PARTS {CURLUPART_URL,
+                                              CURLUPART_SCHEME,
+                                              CURLUPART_USER,
+                                              CURLUPART_PASSWORD,
+                                              CURLUPART_HOST,
+                                              CURLUPART_PORT,
+                                              CURLUPART_PATH,
+                                              CURLUPART_QUERY,
+                                              CURLUPART_FRAGMENT};
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        const auto urlstr = std::string(URLS[i++ % URLS.size()]);
+        std::unique_ptr<CURLU, decltype(&urlCleanup)> url {curl_url(), urlCleanup};
+        curl_url_set(url.get(), CURLUPART_URL, urlstr.c_str(), 0);
+        for (const auto part : PARTS)
+        {
+            char* str = nullptr;
+            if (curl_url_get(url.get(), part, &str, 0) == CURLUE_OK)
+            {
+                std::string value {str};
+                benchmark::DoNotOptimize(value);
+                curl_free(str);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_uriCurl);
@@ -71,8 +71,58 @@ static void BM_DijkstraEvaluator(benchmark::State& state)
     }
 }
 
+// Route and check filters with many ORed terms of different cost, only the last one usually matches
+static void BM_OrChainEvaluator(benchmark::State& state, bool adaptive)
+{
+    auto fakeTermBuilder = [](std::string s) -> std::function<bool(int)>
+    {
+        auto divisor = std::stoi(s.substr(1));
+        return [divisor](int i)
+        {
+            return i % divisor == 0;
+        };
+    };
+
+    parsec::Parser<std::string> termP = [](std::string_view text, size_t pos) -> parsec::Result<std::string>
+    {
+        auto end = text.find_first_of(" ()", pos);
+        if (end == std::string_view::npos)
+        {
+            end = text.size();
+        }
+        if (std::isupper(text[pos]) || text[pos] == '(' || text[pos] == ')')
+        {
+            return parsec::makeError<std::string>("Unexpected token", pos);
+        }
+        return parsec::makeSuccess<std::string>(std::string {text.substr(pos, end - pos)}, end);
+    };
+
+    auto expression = "d97 OR d89 OR d83 OR d79 OR d73 OR d71 OR d67 OR d61 OR d2";
+    std::function<bool(int)> evaluator =
+        adaptive ? logicexpr::buildAdaptiveEvaluator<int, std::string>(expression, fakeTermBuilder, termP)
+                 : logicexpr::buildDijstraEvaluator<int, std::string>(expression, fakeTermBuilder, termP);
+
+    // Benchamark
+    for (auto _ : state)
+    {
+        bool result = true;
+        for (auto i = 0; i < state.range(0); ++i)
+        {
+            benchmark::DoNotOptimize(result = evaluator(i));
+        }
+    }
+}
+
 // Benchmarks
 
 BENCHMARK(BM_DijkstraEvaluator)
     ->RangeMultiplier(10)->Range(1, 10000000)
     ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_OrChainEvaluator, source_order, false)
+    ->RangeMultiplier(10)->Range(1, 10000000)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_CAPTURE(BM_OrChainEvaluator, adaptive, true)
+    ->RangeMultiplier(10)->Range(1, 10000000)
+    ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,423 @@
+/**
+ * @brief End-to-end replay of an event corpus through the policy of a store snapshot.
+ *
+ * Each worker owns a router::Router with the policy, as the production workers do, and replays its share of the
+ * corpus. The latency of an event covers its parsing and its routing through the policy.
+ *
+ * Usage:
+ *   policy_replay --store_path /var/ossec/engine/store --kvdb_path /tmp/kvdb --events corpus.txt --workers 4
+ *
+ * The corpus has one event per line in the Wazuh protocol format, `<queue>:<location>:<message>`.
+ *
+ * With ENGINE_ALLOC_PROFILING, the allocations per event of the policy, each stage and each asset are reported too.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <CLI/CLI.hpp>
+#include <fmt/format.h>
+
+#include <base/allocProfiler.hpp>
+#include <base/logging.hpp>
+#include <base/parseEvent.hpp>
+#include <bk/rx/controller.hpp>
+#include <builder/builder.hpp>
+#include <defs/defs.hpp>
+#include <geo/downloader.hpp>
+#include <geo/manager.hpp>
+#include <hlp/hlp.hpp>
+#include <kvdb/kvdbManager.hpp>
+#include <logpar/logpar.hpp>
+#include <logpar/registerParsers.hpp>
+#include <metrics/metricsManager.hpp>
+#include <schemf/schema.hpp>
+#include <sockiface/unixSocketFactory.hpp>
+#include <store/drivers/fileDriver.hpp>
+#include <store/store.hpp>
+#include <wdb/wdbManager.hpp>
+
+#include "router.hpp"
+
+namespace
+{
+#ifndef ENGINE_ALLOC_PROFILING
+thread_local uint64_t g_allocations {0}; ///< Allocations of the calling thread
+#endif
+
+/**
+ * @brief Allocations made by the calling thread.
+ */
+uint64_t threadAllocations()
+{
+#ifdef ENGINE_ALLOC_PROFILING
+    return base::allocprof::threadAllocations();
+#else
+    return g_allocations;
+#endif
+}
+
+struct Options
+{
+    std::string storePath;
+    std::string kvdbPath;
+    std::string tzdbPath {"/var/ossec/queue/tzdb"};
+    std::string policy {"policy/wazuh/0"};
+    std::string filter {"filter/allow-all/0"};
+    std::string events;
+    int workers {1};
+    int loops {1};
+    int warmup {1000};
+    bool json {false};
+};
+
+/**
+ * @brief Results of a worker.
+ */
+struct WorkerResult
+{
+    std::vector<uint32_t> latencies; ///< Latency of each replayed event in nanoseconds
+    uint64_t allocations {0};        ///< Allocations while replaying
+};
+
+/**
+ * @brief Reads a size field of /proc/self/status, in KiB.
+ */
+uint64_t procStatusKb(const std::string& field)
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind(field + ":", 0) == 0)
+        {
+            return std::strtoull(line.c_str() + field.size() + 1, nullptr, 10);
+        }
+    }
+    return 0;
+}
+
+std::vector<std::string> readCorpus(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+    {
+        throw std::runtime_error(fmt::format("Could not open the events file '{}'", path));
+    }
+
+    std::vector<std::string> events;
+    std::string line;
+    while (std::getline(file, line))
+    {
+        if (!line.empty())
+        {
+            events.emplace_back(std::move(line));
+        }
+    }
+    if (events.empty())
+    {
+        throw std::runtime_error(fmt::format("The events file '{}' is empty", path));
+    }
+    return events;
+}
+
+std::shared_ptr<router::Router> createRouter(const std::shared_ptr<builder::Builder>& builder, const Options& opts)
+{
+    auto router = std::make_shared<router::Router>(builder, std::make_shared<bk::rx::ControllerMaker>());
+    auto err = router->addEntry(router::prod::EntryPost("replay", base::Name(opts.policy), base::Name(opts.filter), 1));
+    if (!err)
+    {
+        err = router->enableEntry("replay");
+    }
+    if (err)
+    {
+        throw std::runtime_error(fmt::format("Could not load the policy '{}': {}", opts.policy, err.value().message));
+    }
+    return router;
+}
+
+void ingest(router::Router& router, const std::string& event)
+{
+    try
+    {
+        router.ingest(base::parseEvent::parseWazuhEvent(event));
+    }
+    catch (const std::exception&)
+    {
+        // Malformed events are discarded, as the server does
+    }
+}
+
+/**
+ * @brief Replays the events of the worker, one in every `workers` events of the corpus, `loops` times.
+ */
+WorkerResult
+replay(router::Router& router, const std::vector<std::string>& events, std::size_t worker, const Options& opts)
+{
+    WorkerResult result;
+    result.latencies.reserve(events.size() / opts.workers * opts.loops + 1);
+
+    const auto startAllocations = threadAllocations();
+    for (auto loop = 0; loop < opts.loops; ++loop)
+    {
+        for (auto i = worker; i < events.size(); i += opts.workers)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            ingest(router, events[i]);
+            const auto end = std::chrono::steady_clock::now();
+            result.latencies.push_back(
+                static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+        }
+    }
+    result.allocations = threadAllocations() - startAllocations;
+
+    return result;
+}
+
+double percentile(const std::vector<uint32_t>& sorted, double p)
+{
+    if (sorted.empty())
+    {
+        return 0;
+    }
+    const auto index = static_cast<std::size_t>(p * static_cast<double>(sorted.size() - 1));
+    return static_cast<double>(sorted[index]) / 1000.0;
+}
+
+/**
+ * @brief Allocation contexts entered while replaying, by descending allocations per event.
+ */
+std::vector<base::allocprof::Entry> allocationContexts()
+{
+    auto entries = base::allocprof::entries();
+    entries.erase(std::remove_if(entries.begin(), entries.end(), [](const auto& entry) { return entry.events == 0; }),
+                  entries.end());
+
+    auto perEvent = [](const auto& entry)
+    {
+        return static_cast<double>(entry.allocations) / static_cast<double>(entry.events);
+    };
+    std::sort(entries.begin(),
+              entries.end(),
+              [&perEvent](const auto& lhs, const auto& rhs) { return perEvent(lhs) > perEvent(rhs); });
+    return entries;
+}
+
+std::shared_ptr<builder::Builder> createBuilder(const std::shared_ptr<store::Store>& store, const Options& opts)
+{
+    auto metrics = std::make_shared<metricsManager::MetricsManager>();
+
+    kvdbManager::KVDBManagerOptions kvdbOptions {opts.kvdbPath, "kvdb"};
+    auto kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
+    kvdbManager->initialize();
+
+    auto schema = std::make_shared<schemf::Schema>();
+    auto schemaDoc = store->readInternalDoc("schema/engine-schema/0");
+    if (!base::isError(schemaDoc))
+    {
+        schema->load(base::getResponse<json::Json>(schemaDoc));
+    }
+
+    hlp::initTZDB(opts.tzdbPath, false);
+    auto hlpParsers = store->readInternalDoc("schema/wazuh-logpar-types/0");
+    if (base::isError(hlpParsers))
+    {
+        throw std::runtime_error(
+            fmt::format("Could not read the HLP configuration: {}", base::getError(hlpParsers).message));
+    }
+    auto logpar = std::make_shared<hlp::logpar::Logpar>(base::getResponse<json::Json>(hlpParsers), schema);
+    hlp::registerParsers(logpar);
+
+    builder::BuilderDeps builderDeps;
+    builderDeps.logpar = logpar;
+    builderDeps.kvdbScopeName = "builder";
+    builderDeps.kvdbManager = kvdbManager;
+    builderDeps.sockFactory = std::make_shared<sockiface::UnixSocketFactory>();
+    builderDeps.wdbManager =
+        std::make_shared<wazuhdb::WDBManager>(std::string(wazuhdb::WDB_SOCK_PATH), builderDeps.sockFactory);
+    builderDeps.geoManager = std::make_shared<geo::Manager>(store, std::make_shared<geo::Downloader>());
+    builderDeps.metricsManager = metrics;
+
+    return std::make_shared<builder::Builder>(store, schema, std::make_shared<defs::DefinitionsBuilder>(), builderDeps);
+}
+} // namespace
+
+#ifndef ENGINE_ALLOC_PROFILING
+// Every allocation of the process is counted by the thread that makes it, the profiling build has its own hook
+void* operator new(std::size_t size)
+{
+    ++g_allocations;
+    if (auto ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    std::free(ptr);
+}
+#endif // ENGINE_ALLOC_PROFILING
+
+int main(int argc, char** argv)
+{
+    Options opts;
+
+    CLI::App app {"Replays an event corpus through a policy and reports its throughput, latency and memory."};
+    app.add_option("--store_path", opts.storePath, "Path of the file store snapshot.")->required();
+    app.add_option("--kvdb_path", opts.kvdbPath, "Path of the KVDB databases of the policy.")->required();
+    app.add_option("--tzdb_path", opts.tzdbPath, "Path of the timezone database.")->capture_default_str();
+    app.add_option("--policy", opts.policy, "Policy to replay the events through.")->capture_default_str();
+    app.add_option("--filter", opts.filter, "Filter of the route of the policy.")->capture_default_str();
+    app.add_option("--events", opts.events, "Corpus, one event per line in the Wazuh protocol format.")->required();
+    app.add_option("--workers", opts.workers, "Workers replaying the corpus.")
+        ->check(CLI::Range(1, 128))
+        ->capture_default_str();
+    app.add_option("--loops", opts.loops, "Times the corpus is replayed.")
+        ->check(CLI::PositiveNumber)
+        ->capture_default_str();
+    app.add_option("--warmup", opts.warmup, "Events ingested by each worker before measuring.")
+        ->check(CLI::NonNegativeNumber)
+        ->capture_default_str();
+    app.add_flag("--json", opts.json, "Print the report as a json object.");
+    CLI11_PARSE(app, argc, argv);
+
+    logging::LoggingConfig logConfig;
+    logConfig.level = logging::Level::Err;
+    logging::start(logConfig);
+
+    try
+    {
+        const auto events = readCorpus(opts.events);
+
+        auto store = std::make_shared<store::Store>(std::make_shared<store::drivers::FileDriver>(opts.storePath));
+        auto builder = createBuilder(store, opts);
+
+        std::vector<std::shared_ptr<router::Router>> routers;
+        for (auto i = 0; i < opts.workers; ++i)
+        {
+            routers.emplace_back(createRouter(builder, opts));
+        }
+
+        // Warm up the caches of the helpers and the allocator
+        for (auto& router : routers)
+        {
+            for (auto i = 0; i < opts.warmup; ++i)
+            {
+                ingest(*router, events[i % events.size()]);
+            }
+        }
+        const auto rssBefore = procStatusKb("VmRSS");
+        base::allocprof::reset();
+
+        std::vector<WorkerResult> results(opts.workers);
+        std::vector<std::thread> threads;
+        const auto start = std::chrono::steady_clock::now();
+        for (auto i = 0; i < opts.workers; ++i)
+        {
+            threads.emplace_back([&, i]() { results[i] = replay(*routers[i], events, i, opts); });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<uint32_t> latencies;
+        uint64_t allocations = 0;
+        for (auto& result : results)
+        {
+            latencies.insert(latencies.end(), result.latencies.begin(), result.latencies.end());
+            allocations += result.allocations;
+        }
+        std::sort(latencies.begin(), latencies.end());
+
+        const auto total = static_cast<double>(latencies.size());
+        const auto eps = total / elapsed;
+        const auto p50 = percentile(latencies, 0.50);
+        const auto p99 = percentile(latencies, 0.99);
+        const auto allocsPerEvent = static_cast<double>(allocations) / total;
+        const auto rss = procStatusKb("VmRSS");
+        const auto peakRss = procStatusKb("VmHWM");
+
+        // Only the profiling build attributes the allocations to their contexts
+        std::vector<std::string> contexts;
+        for (const auto& entry : allocationContexts())
+        {
+            const auto events = static_cast<double>(entry.events);
+            contexts.emplace_back(
+                opts.json ? fmt::format(R"({{"policy":"{}","name":"{}","events":{},"allocs_per_event":{:.2f},)"
+                                        R"("bytes_per_event":{:.1f}}})",
+                                        entry.policy,
+                                        entry.name,
+                                        entry.events,
+                                        static_cast<double>(entry.allocations) / events,
+                                        static_cast<double>(entry.bytes) / events)
+                          : fmt::format("  {:<60} {:>10.2f} allocs {:>12.1f} bytes",
+                                        entry.name,
+                                        static_cast<double>(entry.allocations) / events,
+                                        static_cast<double>(entry.bytes) / events));
+        }
+
+        if (opts.json)
+        {
+            std::cout << fmt::format(R"({{"events":{},"workers":{},"seconds":{:.3f},"eps":{:.1f},"p50_us":{:.2f},)"
+                                     R"("p99_us":{:.2f},"allocs_per_event":{:.2f},"rss_kb":{},"rss_growth_kb":{},)"
+                                     R"("peak_rss_kb":{},"contexts":[{}]}})",
+                                     latencies.size(),
+                                     opts.workers,
+                                     elapsed,
+                                     eps,
+                                     p50,
+                                     p99,
+                                     allocsPerEvent,
+                                     rss,
+                                     static_cast<int64_t>(rss) - static_cast<int64_t>(rssBefore),
+                                     peakRss,
+                                     fmt::join(contexts, ","))
+                      << std::endl;
+        }
+        else
+        {
+            std::cout << fmt::format("Events:           {}\n", latencies.size())
+                      << fmt::format("Workers:          {}\n", opts.workers)
+                      << fmt::format("Time:             {:.3f} s\n", elapsed)
+                      << fmt::format("EPS:              {:.1f}\n", eps)
+                      << fmt::format("Latency p50:      {:.2f} us\n", p50)
+                      << fmt::format("Latency p99:      {:.2f} us\n", p99)
+                      << fmt::format("Allocs per event: {:.2f}\n", allocsPerEvent)
+                      << fmt::format("RSS:              {} KiB ({:+} KiB while replaying)\n",
+                                     rss,
+                                     static_cast<int64_t>(rss) - static_cast<int64_t>(rssBefore))
+                      << fmt::format("Peak RSS:         {} KiB\n", peakRss);
+            if (!contexts.empty())
+            {
+                std::cout << "Allocations per event of each policy, stage and asset:\n"
+                          << fmt::format("{}\n", fmt::join(contexts, "\n"));
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        logging::stop();
+        return 1;
+    }
+
+    logging::stop();
+    return 0;
+}
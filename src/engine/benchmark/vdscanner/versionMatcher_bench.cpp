@@ -0,0 +1,184 @@
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "versionMatcher.hpp"
+
+namespace
+{
+// Installed versions as reported by the package managers and the feeds.
+const std::vector<std::string> CORPUS {
+    // dpkg
+    "1:2.38.1-5+deb12u1",
+    "2.36-9+deb12u4",
+    "1.2.13.dfsg-1ubuntu4",
+    "3.0.2-0ubuntu1.15",
+    "252.22-1~deb12u1",
+    // rpm
+    "2.34-60.el9",
+    "1:3.0.7-25.el9_3",
+    "8.5.0-20.el9",
+    "0.9.6-2.fc39",
+    // pypi
+    "1.26.4",
+    "2.0.0rc1",
+    "3.2.post1",
+    "1!2.0.dev4",
+    "4.66.1-2",
+    "0.41.2.dev0",
+    // npm
+    "18.19.0",
+    "5.0.0-beta.3",
+    "1.0.0+build.5",
+    "4.17.21",
+    // calver and major.minor
+    "2023.10.31",
+    "22.04",
+    "2024.1.0.123",
+    "1.2",
+    "10-4"};
+
+// Reference expressions the parsers replaced.
+const std::regex PEP440_REGEX(
+    R"(^v?(?:(?:([0-9]+)!)?([0-9]+(?:\.[0-9]+)*)(?:[-_\.]?(a|b|c|rc|alpha|beta|pre|preview)[-_\.]?([0-9]+)?)?(?:(?:-([0-9]+))|(?:[-_\.]?(post|rev|r)[-_\.]?([0-9]+)?))?(?:[-_\.]?(dev)[-_\.]?([0-9]+)?)?)?$)",
+    std::regex_constants::icase);
+const std::regex SEMVER_REGEX(
+    R"(^(0|[1-9]\d*)\.(0|[1-9]\d*)\.(0|[1-9]\d*)(?:-((?:0|[1-9]\d*|\d*[a-zA-Z-][0-9a-zA-Z-]*)(?:\.(?:0|[1-9]\d*|\d*[a-zA-Z-][0-9a-zA-Z-]*))*))?(?:\+([0-9a-zA-Z-]+(?:\.[0-9a-zA-Z-]+)*))?$)");
+const std::regex CALVER_REGEX(R"((\d{2}|\d{4})(\.\d{1,2})?(\.\d{1,2})?(\.\d+)?)");
+const std::regex MAJORMINOR_REGEX(R"(^(\d+)[.\-](\d+)$)");
+} // namespace
+
+static void pep440_match_bench(benchmark::State& state)
+{
+    PEP440 data {};
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(VersionObjectPEP440::match(version, data));
+        }
+    }
+}
+
+BENCHMARK(pep440_match_bench);
+
+static void pep440_regex_bench(benchmark::State& state)
+{
+    std::smatch matches;
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(std::regex_match(version, matches, PEP440_REGEX));
+        }
+    }
+}
+
+BENCHMARK(pep440_regex_bench);
+
+static void semver_match_bench(benchmark::State& state)
+{
+    SemVer data {};
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(VersionObjectSemVer::match(version, data));
+        }
+    }
+}
+
+BENCHMARK(semver_match_bench);
+
+static void semver_regex_bench(benchmark::State& state)
+{
+    std::smatch matches;
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(std::regex_match(version, matches, SEMVER_REGEX));
+        }
+    }
+}
+
+BENCHMARK(semver_regex_bench);
+
+static void calver_match_bench(benchmark::State& state)
+{
+    CalVer data {};
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(VersionObjectCalVer::match(version, data));
+        }
+    }
+}
+
+BENCHMARK(calver_match_bench);
+
+static void calver_regex_bench(benchmark::State& state)
+{
+    std::smatch matches;
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(std::regex_match(version, matches, CALVER_REGEX));
+        }
+    }
+}
+
+BENCHMARK(calver_regex_bench);
+
+static void majorminor_match_bench(benchmark::State& state)
+{
+    MajorMinor data {};
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(VersionObjectMajorMinor::match(version, data));
+        }
+    }
+}
+
+BENCHMARK(majorminor_match_bench);
+
+static void majorminor_regex_bench(benchmark::State& state)
+{
+    std::smatch matches;
+    for (auto _ : state)
+    {
+        for (const auto& version : CORPUS)
+        {
+            benchmark::DoNotOptimize(std::regex_match(version, matches, MAJORMINOR_REGEX));
+        }
+    }
+}
+
+BENCHMARK(majorminor_regex_bench);
+
+static void unspecified_compare_bench(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (size_t i = 1; i < CORPUS.size(); ++i)
+        {
+            try
+            {
+                benchmark::DoNotOptimize(
+                    VersionMatcher::compare(CORPUS[i - 1], CORPUS[i], VersionMatcherStrategy::Unspecified));
+            }
+            catch (const std::exception&)
+            {
+                // Versions of different schemes can't be compared.
+            }
+        }
+    }
+}
+
+BENCHMARK(unspecified_compare_bench);
@@ -14,6 +14,8 @@ namespace api::adapter
 
 /**
  * @brief Return a WazuhResponse with de eMessage serialized or a WazuhResponse with the error if it fails
+ *
+ * The serialized JSON is written to the wire as is, it is not parsed into a json::Json document.
  * @tparam T
  * @param eMessage
  * @return base::utils::wazuhProtocol::WazuhResponse
@@ -24,14 +26,12 @@ base::utils::wazuhProtocol::WazuhResponse toWazuhResponse(const T& eMessage)
     // Check that T is derived from google::protobuf::Message
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
 
-    const auto res = eMessage::eMessageToJson<T>(eMessage);
-
-    if (std::holds_alternative<base::Error>(res))
+    std::string serialized;
+    if (auto error = eMessage::eMessageToJson<T>(eMessage, serialized))
     {
-        const auto& error = std::get<base::Error>(res);
-        return base::utils::wazuhProtocol::WazuhResponse::internalError(error.message);
+        return base::utils::wazuhProtocol::WazuhResponse::internalError(error->message);
     }
-    return base::utils::wazuhProtocol::WazuhResponse {json::Json {std::get<std::string>(res).c_str()}};
+    return base::utils::wazuhProtocol::WazuhResponse::fromSerialized(std::move(serialized));
 }
 
 /**
@@ -69,6 +69,39 @@ fromWazuhRequest(const base::utils::wazuhProtocol::WazuhRequest& wRequest)
     return std::move(std::get<T>(res));
 }
 
+/**
+ * @brief Return a variant with the eMessage parsed on an arena or a WazuhResponse with the error
+ *
+ * For the requests with large responses, the request, the response and their submessages are allocated on the arena
+ * of the call instead of on the heap one by one.
+ *
+ * @tparam T Request type
+ * @tparam U Response type
+ * @param wRequest
+ * @param arena Arena that owns the parsed request, it must outlive it
+ * @return std::variant<base::utils::wazuhProtocol::WazuhResponse, T*>
+ */
+template<typename T, typename U>
+std::variant<base::utils::wazuhProtocol::WazuhResponse, T*>
+fromWazuhRequest(const base::utils::wazuhProtocol::WazuhRequest& wRequest, google::protobuf::Arena& arena)
+{
+    static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
+    static_assert(std::is_base_of<google::protobuf::Message, U>::value, "U must be a derived class of proto::Message");
+
+    const auto json = wRequest.getParameters().value_or(json::Json {"{}"}).str();
+
+    auto res = eMessage::eMessageFromJson<T>(json, arena);
+    if (std::holds_alternative<base::Error>(res))
+    {
+        auto* eResponse = google::protobuf::Arena::CreateMessage<U>(&arena);
+        eResponse->set_status(::com::wazuh::api::engine::ReturnStatus::ERROR);
+        eResponse->set_error(std::get<base::Error>(res).message);
+        return toWazuhResponse<U>(*eResponse);
+    }
+
+    return std::get<T*>(res);
+}
+
 /**
  * @brief Return a WazuhResponse with the genericError in WazuhResponse
  *
@@ -3,6 +3,7 @@
 
 #include "registry.hpp"
 
+#include <base/arenaAllocator.hpp>
 #include <base/json.hpp>
 #include <rbac/irbac.hpp>
 
@@ -76,7 +77,8 @@ public:
      */
     void processRequest(const std::string& message, std::function<void(const std::string&)> callbackFn)
     {
-
+        // The requests allocate from the arena of the API, the builds they trigger from the one of the builder
+        base::arena::ScopedSubsystem arena {base::arena::Subsystem::API};
         json::Json jrequest {};
         try
         {
@@ -112,6 +114,7 @@ public:
      */
     void processWazuhRequest(const wpRequest& wrequest, std::function<void(const wpResponse&)> callbackFn)
     {
+        base::arena::ScopedSubsystem arena {base::arena::Subsystem::API};
         wpResponse wresponse {};
 
         try
@@ -3,6 +3,8 @@
 
 #include <api/api.hpp>
 #include <metrics/iMetricsManagerAPI.hpp>
+#include <metrics/assetStats.hpp>
+#include <metrics/profiler.hpp>
 
 namespace api::metrics::handlers
 {
@@ -41,6 +43,62 @@ api::HandlerSync metricsList(const std::shared_ptr<metricsManager::IMetricsManag
 */
 api::HandlerSync metricsTestCmd(const std::shared_ptr<metricsManager::IMetricsManagerAPI>& metricsAPI);
 
+/**
+ * @brief Start recording the executions of the asset operations for a window.
+ *
+ * @return Returns "OK" if success, otherwise error message.
+ */
+api::HandlerSync profilerStartCmd(const std::shared_ptr<metricsManager::Profiler>& profiler);
+
+/**
+ * @brief Stop recording the executions of the asset operations.
+ *
+ * @return Returns "OK".
+ */
+api::HandlerSync profilerStopCmd(const std::shared_ptr<metricsManager::Profiler>& profiler);
+
+/**
+ * @brief Get the profile of the last window, as entries and collapsed stacks.
+ *
+ * @return Profile of the operations.
+ */
+api::HandlerSync profilerGetCmd(const std::shared_ptr<metricsManager::Profiler>& profiler);
+
+/**
+ * @brief Get the hit-rate statistics of an asset, or of all the assets.
+ *
+ * @return Evaluations, successes and cost of each asset.
+ */
+api::HandlerSync assetStatsGetCmd(const std::shared_ptr<metricsManager::AssetStats>& stats);
+
+/**
+ * @brief Reset the evaluations and successes of the assets.
+ *
+ * @return Returns "OK".
+ */
+api::HandlerSync assetStatsResetCmd(const std::shared_ptr<metricsManager::AssetStats>& stats);
+
+/**
+ * @brief Get the heap allocations of the policies, stages and assets.
+ *
+ * @return Allocations of each context, or an error if the engine was built without ENGINE_ALLOC_PROFILING.
+ */
+api::HandlerSync allocationsGetCmd();
+
+/**
+ * @brief Reset the heap allocation counters.
+ *
+ * @return Returns "OK".
+ */
+api::HandlerSync allocationsResetCmd();
+
+/**
+ * @brief Get the usage of the allocator arena of each subsystem.
+ *
+ * @return Usage of each arena, and whether the global operator new allocates from them.
+ */
+api::HandlerSync arenasGetCmd();
+
 /**
  * @brief Register all available Metrics commands in the API registry.
  *
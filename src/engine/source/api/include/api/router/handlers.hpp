@@ -17,16 +17,22 @@ api::HandlerSync routeGet(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy);
 api::HandlerSync routeReload(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync routePatchPriority(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync routePatchEpsLimit(const std::weak_ptr<::router::IRouterAPI>& router);
 
 api::HandlerSync tableGet(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy);
 api::HandlerSync queuePost(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync queuePostBulk(const std::weak_ptr<::router::IRouterAPI>& router);
 
 api::HandlerSync changeEpsSettings(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync getEpsSettings(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync activateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>& router);
 
+api::HandlerSync postIngressRule(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync deleteIngressRule(const std::weak_ptr<::router::IRouterAPI>& router);
+api::HandlerSync getIngressRules(const std::weak_ptr<::router::IRouterAPI>& router);
+
 /**
  * @brief Register all router commands
  *
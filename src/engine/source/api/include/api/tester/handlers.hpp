@@ -20,6 +20,8 @@ api::HandlerSync tableGet(const std::weak_ptr<::router::ITesterAPI>& tester,
 // Use of session
 api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester,
                      const std::weak_ptr<store::IStoreReader>& store);
+api::HandlerAsync batchPost(const std::weak_ptr<::router::ITesterAPI>& tester,
+                            const std::weak_ptr<store::IStoreReader>& store);
 
 /**
  * @brief Register all router commands
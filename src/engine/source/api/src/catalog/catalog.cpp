@@ -40,15 +40,8 @@ Catalog::Catalog(const Config& config)
         std::variant<json::Json, base::Error> result;
         try
         {
+            // The parser already rejects the duplicated keys
             result = json::Json {str.c_str()};
-            if (std::holds_alternative<json::Json>(result))
-            {
-                auto error = std::get<json::Json>(result).checkDuplicateKeys();
-                if (base::isError(error))
-                {
-                    result = base::getError(error);
-                }
-            }
         }
         catch (const std::exception& e)
         {
@@ -86,15 +79,8 @@ Catalog::Catalog(const Config& config)
         std::variant<json::Json, base::Error> result;
         try
         {
-            result = json::Json {yml::Converter::loadYMLfromString(content)};
-            if (std::holds_alternative<json::Json>(result))
-            {
-                auto error = std::get<json::Json>(result).checkDuplicateKeys();
-                if (base::isError(error))
-                {
-                    result = base::getError(error);
-                }
-            }
+            // Duplicated keys are rejected while parsing, no need to walk the document again
+            result = json::Json {yml::Converter::loadYMLfromString(content, false)};
         }
         catch (const std::exception& e)
         {
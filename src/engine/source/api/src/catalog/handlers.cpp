@@ -127,7 +127,10 @@ api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rba
     {
         using RequestType = eCatalog::ResourceGet_Request;
         using ResponseType = eCatalog::ResourceGet_Response;
-        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // A whole namespace may be returned, the messages are allocated on the arena of the call
+        google::protobuf::Arena arena {eMessage::arenaOptions()};
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest, arena);
 
         // If the request is not valid, return the error
         if (std::holds_alternative<api::wpResponse>(res))
@@ -135,7 +138,7 @@ api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rba
             return std::move(std::get<api::wpResponse>(res));
         }
 
-        const auto& eRequest = std::get<RequestType>(res);
+        const auto& eRequest = *std::get<RequestType*>(res);
 
         // Validate the params request
         const auto error = !eRequest.has_name()          ? std::make_optional("Missing /name parameter")
@@ -185,9 +188,9 @@ api::HandlerSync resourceGet(std::shared_ptr<Catalog> catalog, std::weak_ptr<rba
         {
             return ::api::adapter::genericError<ResponseType>(base::getError(queryRes).message);
         }
-        const auto& content = base::getResponse<std::string>(queryRes);
-        ResponseType eResponse;
-        eResponse.set_content(content);
+        auto& content = base::getResponse<std::string>(queryRes);
+        auto& eResponse = *google::protobuf::Arena::CreateMessage<ResponseType>(&arena);
+        eResponse.set_content(std::move(content));
         eResponse.set_status(eEngine::ReturnStatus::OK);
 
         return ::api::adapter::toWazuhResponse(eResponse);
@@ -21,6 +21,21 @@ constexpr auto MESSAGE_NAME_EMPTY = "Field /name is empty";
 constexpr auto MESSAGE_MISSING_KEY = "Missing /key";
 constexpr auto MESSAGE_KEY_EMPTY = "Field /key is empty";
 
+namespace
+{
+// Wraps the entries of a page retrieved by number, which has no cursor
+base::RespOrError<kvdbManager::KVDBPage>
+pageFromList(base::RespOrError<std::list<std::pair<std::string, std::string>>>&& entries)
+{
+    if (base::isError(entries))
+    {
+        return base::getError(std::move(entries));
+    }
+
+    return kvdbManager::KVDBPage {base::getResponse(std::move(entries)), std::nullopt};
+}
+} // namespace
+
 /* Manager Endpoint */
 
 api::HandlerSync managerGet(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager)
@@ -86,14 +101,16 @@ api::HandlerSync managerPost(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
         }
 
         base::OptError resultCreate;
+        const kvdbManager::KVDBOptions options {eRequest.has_memory_resident() && eRequest.memory_resident(),
+                                                eRequest.has_ttl() ? eRequest.ttl() : 0};
 
         if (eRequest.has_path())
         {
-            resultCreate = kvdbManager->createDB(eRequest.name(), eRequest.path());
+            resultCreate = kvdbManager->createDB(eRequest.name(), eRequest.path(), options);
         }
         else
         {
-            resultCreate = kvdbManager->createDB(eRequest.name());
+            resultCreate = kvdbManager->createDB(eRequest.name(), options);
         }
 
         if (resultCreate)
@@ -153,7 +170,10 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
     {
         using RequestType = eKVDB::managerDump_Request;
         using ResponseType = eKVDB::managerDump_Response;
-        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // The entries of the dump and their values are allocated on the arena, released at once with the response
+        google::protobuf::Arena arena {eMessage::arenaOptions()};
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest, arena);
 
         // If the request is not valid, return the error
         if (std::holds_alternative<api::wpResponse>(res))
@@ -161,7 +181,7 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
             return std::move(std::get<api::wpResponse>(res));
         }
 
-        const auto& eRequest = std::get<RequestType>(res);
+        const auto& eRequest = *std::get<RequestType*>(res);
         unsigned int page = eRequest.has_page() ? eRequest.page() : DEFAULT_HANDLER_PAGE;
         unsigned int records = eRequest.has_records() ? eRequest.records() : DEFAULT_HANDLER_RECORDS;
 
@@ -193,32 +213,34 @@ api::HandlerSync managerDump(std::shared_ptr<kvdbManager::IKVDBManager> kvdbMana
         }
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
-        auto dumpRes = handler->dump(page, records);
+        auto dumpRes = eRequest.has_cursor() ? handler->scan("", eRequest.cursor(), records)
+                                             : pageFromList(handler->dump(page, records));
 
-        if (std::holds_alternative<base::Error>(dumpRes))
+        if (base::isError(dumpRes))
         {
-            return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(dumpRes).message);
+            return ::api::adapter::genericError<ResponseType>(base::getError(dumpRes).message);
         }
-        const auto& dump = std::get<std::list<std::pair<std::string, std::string>>>(dumpRes);
-        ResponseType eResponse;
+        const auto& dump = base::getResponse(dumpRes).entries;
+        auto& eResponse = *google::protobuf::Arena::CreateMessage<ResponseType>(&arena);
         eResponse.set_status(eEngine::ReturnStatus::OK);
+        if (base::getResponse(dumpRes).nextCursor)
+        {
+            eResponse.set_next_cursor(base::getResponse(dumpRes).nextCursor.value());
+        }
 
+        // Each value is parsed in place, in the entry of the response
         auto entries = eResponse.mutable_entries();
+        entries->Reserve(static_cast<int>(dump.size()));
         for (const auto& [key, value] : dump)
         {
-            auto entry = eKVDB::Entry();
-            entry.mutable_key()->assign(key);
+            auto* entry = entries->Add();
+            entry->mutable_key()->assign(key);
 
-            const auto res = eMessage::eMessageFromJson<google::protobuf::Value>(value);
-            if (std::holds_alternative<base::Error>(res)) // Should not happen but just in case
+            if (auto error = eMessage::eMessageFromJson(value, *entry->mutable_value())) // Should not happen
             {
-                const auto msg =
-                    fmt::format("{}. For key '{}' and value {}", std::get<base::Error>(res).message, key, value);
+                const auto msg = fmt::format("{}. For key '{}' and value {}", error->message, key, value);
                 return ::api::adapter::genericError<ResponseType>(msg);
             }
-            const auto json_value = std::get<google::protobuf::Value>(res);
-            entry.mutable_value()->CopyFrom(json_value);
-            entries->Add(std::move(entry));
         }
 
         // Adapt the response to wazuh api
@@ -457,15 +479,21 @@ api::HandlerSync dbSearch(std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager
 
         auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
 
-        const auto searchRes = handler->search(eRequest.prefix(), page, records);
+        const auto searchRes = eRequest.has_cursor()
+                                   ? handler->scan(eRequest.prefix(), eRequest.cursor(), records)
+                                   : pageFromList(handler->search(eRequest.prefix(), page, records));
 
-        if (std::holds_alternative<base::Error>(searchRes))
+        if (base::isError(searchRes))
         {
-            return ::api::adapter::genericError<ResponseType>(std::get<base::Error>(searchRes).message);
+            return ::api::adapter::genericError<ResponseType>(base::getError(searchRes).message);
         }
-        const auto& resultSearch = std::get<std::list<std::pair<std::string, std::string>>>(searchRes);
+        const auto& resultSearch = base::getResponse(searchRes).entries;
         ResponseType eResponse;
         eResponse.set_status(eEngine::ReturnStatus::OK);
+        if (base::getResponse(searchRes).nextCursor)
+        {
+            eResponse.set_next_cursor(base::getResponse(searchRes).nextCursor.value());
+        }
 
         auto entries = eResponse.mutable_entries();
         for (const auto& [key, value] : resultSearch)
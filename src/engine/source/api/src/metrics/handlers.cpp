@@ -1,5 +1,7 @@
 #include "api/metrics/handlers.hpp"
 
+#include <base/allocProfiler.hpp>
+#include <base/arenaAllocator.hpp>
 #include <base/json.hpp>
 #include <eMessages/eMessage.h>
 #include <eMessages/metrics.pb.h>
@@ -12,6 +14,8 @@ namespace api::metrics::handlers
 namespace eMetrics = ::com::wazuh::api::engine::metrics;
 namespace eEngine = ::com::wazuh::api::engine;
 
+constexpr uint32_t DEFAULT_PROFILER_WINDOW = 10; ///< Seconds recorded when the window is not set
+
 /* Manager Endpoint */
 
 api::HandlerSync metricsDumpCmd(const std::shared_ptr<metricsManager::IMetricsManagerAPI>& metricsAPI)
@@ -189,6 +193,255 @@ api::HandlerSync metricsList(const std::shared_ptr<metricsManager::IMetricsManag
     };
 }
 
+/* Profiler Endpoint */
+
+api::HandlerSync profilerStartCmd(const std::shared_ptr<metricsManager::Profiler>& profiler)
+{
+    return [profiler](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::ProfilerStart_Request;
+        using ResponseType = eMetrics::ProfilerStart_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        const auto& eRequest = std::get<RequestType>(res);
+        const auto seconds = eRequest.has_seconds() ? eRequest.seconds() : DEFAULT_PROFILER_WINDOW;
+
+        try
+        {
+            profiler->start(std::chrono::seconds(seconds));
+        }
+        catch (const std::exception& e)
+        {
+            return ::api::adapter::genericError<ResponseType>(e.what());
+        }
+
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync profilerStopCmd(const std::shared_ptr<metricsManager::Profiler>& profiler)
+{
+    return [profiler](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::ProfilerStop_Request;
+        using ResponseType = eMetrics::ProfilerStop_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        profiler->stop();
+
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync profilerGetCmd(const std::shared_ptr<metricsManager::Profiler>& profiler)
+{
+    return [profiler](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::ProfilerGet_Request;
+        using ResponseType = eMetrics::ProfilerGet_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        // The same entries are returned and collapsed
+        const auto entries = profiler->entries();
+
+        ResponseType eResponse;
+        eResponse.set_active(profiler->active());
+        eResponse.set_collapsed(::metricsManager::Profiler::collapse(entries));
+        for (const auto& entry : entries)
+        {
+            auto eEntry = eResponse.add_entries();
+            eEntry->set_asset(entry.asset);
+            eEntry->set_stage(entry.stage);
+            eEntry->set_operation(entry.operation);
+            eEntry->set_count(entry.count);
+            eEntry->set_timeus(entry.timeUs);
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
+/* Asset Statistics Endpoint */
+
+api::HandlerSync assetStatsGetCmd(const std::shared_ptr<metricsManager::AssetStats>& stats)
+{
+    return [stats](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::AssetStatsGet_Request;
+        using ResponseType = eMetrics::AssetStatsGet_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+        auto& eRequest = std::get<RequestType>(res);
+
+        std::vector<::metricsManager::AssetStats::Entry> entries;
+        if (eRequest.has_asset())
+        {
+            auto entry = stats->entry(eRequest.asset());
+            if (!entry)
+            {
+                return ::api::adapter::genericError<ResponseType>(
+                    fmt::format("Asset '{}' has no statistics", eRequest.asset()));
+            }
+            entries.emplace_back(std::move(entry.value()));
+        }
+        else
+        {
+            entries = stats->entries();
+        }
+
+        ResponseType eResponse;
+        for (const auto& entry : entries)
+        {
+            auto eEntry = eResponse.add_entries();
+            eEntry->set_asset(entry.asset);
+            eEntry->set_evaluations(entry.evaluations);
+            eEntry->set_successes(entry.successes);
+            eEntry->set_cost(entry.cost);
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
+api::HandlerSync assetStatsResetCmd(const std::shared_ptr<metricsManager::AssetStats>& stats)
+{
+    return [stats](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::AssetStatsReset_Request;
+        using ResponseType = eMetrics::AssetStatsReset_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        stats->reset();
+
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
+/* Allocations Endpoint */
+
+api::HandlerSync allocationsGetCmd()
+{
+    return [](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::AllocationsGet_Request;
+        using ResponseType = eMetrics::AllocationsGet_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        if (!base::allocprof::ENABLED)
+        {
+            return ::api::adapter::genericError<ResponseType>(
+                "The engine was built without the allocation profiling (ENGINE_ALLOC_PROFILING)");
+        }
+
+        ResponseType eResponse;
+        for (const auto& entry : base::allocprof::entries())
+        {
+            auto eEntry = eResponse.add_entries();
+            eEntry->set_policy(entry.policy);
+            eEntry->set_name(entry.name);
+            eEntry->set_events(entry.events);
+            eEntry->set_allocations(entry.allocations);
+            eEntry->set_bytes(entry.bytes);
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
+api::HandlerSync allocationsResetCmd()
+{
+    return [](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::AllocationsReset_Request;
+        using ResponseType = eMetrics::AllocationsReset_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        base::allocprof::reset();
+
+        return ::api::adapter::genericSuccess<ResponseType>();
+    };
+}
+
+/* Arenas Endpoint */
+
+api::HandlerSync arenasGetCmd()
+{
+    return [](api::wpRequest wRequest) -> api::wpResponse
+    {
+        using RequestType = eMetrics::ArenasGet_Request;
+        using ResponseType = eMetrics::ArenasGet_Response;
+        auto res = ::api::adapter::fromWazuhRequest<RequestType, ResponseType>(wRequest);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        ResponseType eResponse;
+        for (const auto& entry : base::arena::stats())
+        {
+            auto eEntry = eResponse.add_arenas();
+            eEntry->set_subsystem(std::string(base::arena::subsystemName(entry.subsystem)));
+            eEntry->set_allocations(entry.allocations);
+            eEntry->set_deallocations(entry.deallocations);
+            eEntry->set_remote_frees(entry.remoteFrees);
+            eEntry->set_large_allocations(entry.largeAllocations);
+            eEntry->set_bytes_in_use(entry.bytesInUse);
+            eEntry->set_bytes_reserved(entry.bytesReserved);
+            eEntry->set_caches(entry.caches);
+        }
+        eResponse.set_arena_allocator(base::arena::ENABLED);
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse(eResponse);
+    };
+}
+
 void registerHandlers(const std::shared_ptr<metricsManager::IMetricsManagerAPI>& metricsAPI, std::shared_ptr<api::Api> api)
 {
     try
@@ -198,6 +451,20 @@ void registerHandlers(const std::shared_ptr<metricsManager::IMetricsManagerAPI>&
         api->registerHandler("metrics.manager/enable", Api::convertToHandlerAsync(metricsEnableCmd(metricsAPI)));
         api->registerHandler("metrics.manager/test", Api::convertToHandlerAsync(metricsTestCmd(metricsAPI)));
         api->registerHandler("metrics.manager/list", Api::convertToHandlerAsync(metricsList(metricsAPI)));
+
+        const auto& profiler = ::metricsManager::Profiler::global();
+        api->registerHandler("metrics.profiler/start", Api::convertToHandlerAsync(profilerStartCmd(profiler)));
+        api->registerHandler("metrics.profiler/stop", Api::convertToHandlerAsync(profilerStopCmd(profiler)));
+        api->registerHandler("metrics.profiler/get", Api::convertToHandlerAsync(profilerGetCmd(profiler)));
+
+        const auto& stats = ::metricsManager::AssetStats::global();
+        api->registerHandler("metrics.assets/get", Api::convertToHandlerAsync(assetStatsGetCmd(stats)));
+        api->registerHandler("metrics.assets/reset", Api::convertToHandlerAsync(assetStatsResetCmd(stats)));
+
+        api->registerHandler("metrics.allocations/get", Api::convertToHandlerAsync(allocationsGetCmd()));
+        api->registerHandler("metrics.allocations/reset", Api::convertToHandlerAsync(allocationsResetCmd()));
+
+        api->registerHandler("metrics.arenas/get", Api::convertToHandlerAsync(arenasGetCmd()));
     }
     catch (const std::exception& e)
     {
@@ -113,6 +113,8 @@ eRouter::Entry eRouteEntryFromEntry(const ::router::prod::Entry& entry,
     eEntry.set_filter(entry.filter().fullName());
     eEntry.set_policy(entry.policy().fullName());
     eEntry.set_priority(static_cast<uint32_t>(entry.priority()));
+    eEntry.set_eps_limit(static_cast<uint32_t>(entry.epsLimit()));
+    eEntry.set_throttled(entry.throttled());
     if (entry.description().has_value())
     {
         eEntry.mutable_description()->assign(entry.description().value());
@@ -129,6 +131,70 @@ eRouter::Entry eRouteEntryFromEntry(const ::router::prod::Entry& entry,
     eEntry.set_uptime(static_cast<uint32_t>(currentTime() - entry.lastUpdate()));
     return eEntry;
 }
+
+/**
+ * @brief Convert an api ingress rule to a router ingress rule or an error response if it is invalid
+ *
+ * @tparam ResponseType
+ * @param eRule to convert
+ * @return std::variant<api::wpResponse, ::router::prod::IngressRule>
+ */
+template<typename ResponseType>
+std::variant<api::wpResponse, ::router::prod::IngressRule> getIngressRule(const eRouter::IngressRule& eRule)
+{
+    if (eRule.action() != eRouter::IngressAction::DROP && eRule.action() != eRouter::IngressAction::DIVERT)
+    {
+        return genericError<ResponseType>("Invalid /rule/action, it must be DROP or DIVERT");
+    }
+
+    ::router::prod::IngressRule rule {eRule.name(),
+                                      eRule.action() == eRouter::IngressAction::DROP
+                                          ? ::router::prod::IngressAction::DROP
+                                          : ::router::prod::IngressAction::DIVERT};
+    if (eRule.has_queue())
+    {
+        if (eRule.queue().size() != 1)
+        {
+            return genericError<ResponseType>("Invalid /rule/queue, it must be a single character");
+        }
+        rule.queue(eRule.queue().front());
+    }
+    if (eRule.has_location_prefix())
+    {
+        rule.locationPrefix(eRule.location_prefix());
+    }
+    rule.contains({eRule.contains().begin(), eRule.contains().end()});
+
+    return rule;
+}
+
+/**
+ * @brief Convert a router ingress rule to a api ingress rule
+ *
+ * @param rule to convert
+ * @return eRouter::IngressRule
+ */
+eRouter::IngressRule eIngressRuleFromRule(const ::router::prod::IngressRule& rule)
+{
+    eRouter::IngressRule eRule;
+    eRule.set_name(rule.name());
+    eRule.set_action(rule.action() == ::router::prod::IngressAction::DROP ? eRouter::IngressAction::DROP
+                                                                          : eRouter::IngressAction::DIVERT);
+    if (rule.queue().has_value())
+    {
+        eRule.set_queue(std::string(1, rule.queue().value()));
+    }
+    if (!rule.locationPrefix().empty())
+    {
+        eRule.set_location_prefix(rule.locationPrefix());
+    }
+    for (const auto& substring : rule.contains())
+    {
+        eRule.add_contains(substring);
+    }
+    eRule.set_hits(rule.hits());
+    return eRule;
+}
 } // namespace
 
 api::HandlerSync routePost(const std::weak_ptr<::router::IRouterAPI>& router)
@@ -172,6 +238,10 @@ api::HandlerSync routePost(const std::weak_ptr<::router::IRouterAPI>& router)
         {
             entryPost.description(eRequest.route().description());
         }
+        if (eRequest.route().has_eps_limit())
+        {
+            entryPost.epsLimit(eRequest.route().eps_limit());
+        }
         auto error = router->postEntry(entryPost);
 
         // Build the response
@@ -310,6 +380,38 @@ api::HandlerSync routePatchPriority(const std::weak_ptr<::router::IRouterAPI>& r
     };
 }
 
+api::HandlerSync routePatchEpsLimit(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::RoutePatchEpsLimit_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+
+        // Execute the command
+        const auto& getResult = router->changeEntryEpsLimit(eRequest.name(), eRequest.eps_limit());
+
+        if (base::isError(getResult))
+        {
+            return genericError<ResponseType>(base::getError(getResult).message);
+        }
+
+        // Build the response
+        ResponseType eResponse;
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
 api::HandlerSync tableGet(const std::weak_ptr<::router::IRouterAPI>& router,
                           const std::weak_ptr<api::policy::IPolicy>& policy)
 {
@@ -367,6 +469,45 @@ api::HandlerSync queuePost(const std::weak_ptr<::router::IRouterAPI>& router)
     };
 }
 
+api::HandlerSync queuePostBulk(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::QueuePostBulk_Request;
+        using ResponseType = eRouter::QueuePostBulk_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        if (eRequest.wazuh_events().empty())
+        {
+            return genericError<ResponseType>("Missing /wazuh_events");
+        }
+
+        // The events are parsed in place from the request and pushed to the queue at once
+        std::vector<std::string_view> events;
+        events.reserve(eRequest.wazuh_events_size());
+        for (const auto& event : eRequest.wazuh_events())
+        {
+            events.emplace_back(event);
+        }
+        const auto accepted = router->postStrEvents(events);
+
+        ResponseType eResponse;
+        eResponse.set_accepted(static_cast<uint32_t>(accepted));
+        eResponse.set_discarded(static_cast<uint32_t>(events.size() - accepted));
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        // Adapt the response to wazuh api
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
 api::HandlerSync changeEpsSettings(const std::weak_ptr<::router::IRouterAPI>& router)
 {
     return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
@@ -476,6 +617,93 @@ api::HandlerSync deactivateEpsLimiter(const std::weak_ptr<::router::IRouterAPI>&
     };
 }
 
+api::HandlerSync postIngressRule(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::IngressPost_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        if (!eRequest.has_rule())
+        {
+            return genericError<ResponseType>("Missing /rule");
+        }
+
+        auto rule = getIngressRule<ResponseType>(eRequest.rule());
+        if (std::holds_alternative<api::wpResponse>(rule))
+        {
+            return std::move(std::get<api::wpResponse>(rule));
+        }
+
+        const auto postRes = router->postIngressRule(std::get<::router::prod::IngressRule>(rule));
+        if (postRes.has_value())
+        {
+            return genericError<ResponseType>(postRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync deleteIngressRule(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::IngressDelete_Request;
+        using ResponseType = eEngine::GenericStatus_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+        const auto deleteRes = router->deleteIngressRule(eRequest.name());
+        if (deleteRes.has_value())
+        {
+            return genericError<ResponseType>(deleteRes.value().message);
+        }
+        return genericSuccess<ResponseType>();
+    };
+}
+
+api::HandlerSync getIngressRules(const std::weak_ptr<::router::IRouterAPI>& router)
+{
+    return [wRouter = router](const api::wpRequest& wRequest) -> api::wpResponse
+    {
+        using RequestType = eRouter::IngressGet_Request;
+        using ResponseType = eRouter::IngressGet_Response;
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wRouter);
+
+        // If the request is not valid, return the error
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            return std::move(std::get<api::wpResponse>(res));
+        }
+
+        auto& [router, eRequest] = std::get<RouterAndRequest<RequestType>>(res);
+
+        // Build the response, the rules in the order they are checked
+        ResponseType eResponse;
+        for (const auto& rule : router->getIngressRules())
+        {
+            eResponse.mutable_rules()->Add(eIngressRuleFromRule(rule));
+        }
+        eResponse.set_status(eEngine::ReturnStatus::OK);
+
+        return ::api::adapter::toWazuhResponse<ResponseType>(eResponse);
+    };
+}
+
 void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
                       std::shared_ptr<api::Api> api)
@@ -487,15 +715,21 @@ void registerHandlers(const std::weak_ptr<::router::IRouterAPI>& router,
         && api->registerHandler("router.route/get", Api::convertToHandlerAsync(routeGet(router, policy)))
         && api->registerHandler("router.route/reload", Api::convertToHandlerAsync(routeReload(router)))
         && api->registerHandler("router.route/patchPriority", Api::convertToHandlerAsync(routePatchPriority(router)))
+        && api->registerHandler("router.route/patchEpsLimit", Api::convertToHandlerAsync(routePatchEpsLimit(router)))
         // Commands to manage the routes table
         && api->registerHandler("router.table/get", Api::convertToHandlerAsync(tableGet(router, policy)))
         // Commands to manage the queue of events
         && api->registerHandler("router.queue/post", Api::convertToHandlerAsync(queuePost(router)))
+        && api->registerHandler("router.queue/postBulk", Api::convertToHandlerAsync(queuePostBulk(router)))
         // Commands to manage the EPS limiter
         && api->registerHandler("router.eps/update", Api::convertToHandlerAsync(changeEpsSettings(router)))
         && api->registerHandler("router.eps/get", Api::convertToHandlerAsync(getEpsSettings(router)))
         && api->registerHandler("router.eps/activate", Api::convertToHandlerAsync(activateEpsLimiter(router)))
-        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)));
+        && api->registerHandler("router.eps/deactivate", Api::convertToHandlerAsync(deactivateEpsLimiter(router)))
+        // Commands to manage the ingress filter of the raw events
+        && api->registerHandler("router.ingress/post", Api::convertToHandlerAsync(postIngressRule(router)))
+        && api->registerHandler("router.ingress/delete", Api::convertToHandlerAsync(deleteIngressRule(router)))
+        && api->registerHandler("router.ingress/get", Api::convertToHandlerAsync(getIngressRules(router)));
 
     if (!ok)
     {
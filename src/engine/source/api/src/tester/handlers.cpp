@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <mutex>
 #include <sstream>
 
 #include <eMessages/tester.pb.h>
@@ -14,6 +16,8 @@ namespace eEngine = ::com::wazuh::api::engine;
 using api::adapter::genericError;
 using api::adapter::genericSuccess;
 
+constexpr std::size_t BATCH_WINDOW = 64; ///< Events of a batch queued at the same time
+
 template<typename RequestType>
 using TesterAndRequest = std::pair<std::shared_ptr<::router::ITesterAPI>, RequestType>; ///< Tester and request
 
@@ -157,41 +161,223 @@ auto getNsFilterAssets(const RequestType& eRequest,
     return assets;
 }
 
+/**
+ * @brief Get the options of a test, with the assets to trace filtered by namespaces, or the error response
+ *
+ * @tparam RequestType Type of the request
+ * @tparam ResponseType Type of the response
+ * @param eRequest Request with the session name and the trace configuration
+ * @param wStore Store to use to get the namespaces of the assets
+ * @param tester Tester to use to get the assets of the policy
+ * @return std::variant<api::wpResponse, ::router::test::Options>
+ */
+template<typename RequestType, typename ResponseType>
+auto getTestOptions(const RequestType& eRequest,
+                    const std::weak_ptr<store::IStoreReader>& wStore,
+                    const std::shared_ptr<::router::ITesterAPI>& tester)
+    -> std::variant<api::wpResponse, ::router::test::Options>
+{
+    using OTraceLavel = ::router::test::Options::TraceLevel;
+    OTraceLavel traceLevel = eRequest.trace_level() == eTester::TraceLevel::NONE         ? OTraceLavel::NONE
+                             : eRequest.trace_level() == eTester::TraceLevel::ASSET_ONLY ? OTraceLavel::ASSET_ONLY
+                                                                                         : OTraceLavel::ALL;
+
+    // Find the list of assets to trace
+    std::unordered_set<std::string> assetToTrace {};
+    if (traceLevel != OTraceLavel::NONE)
+    {
+        // Get the assets of the policy filtered by namespaces
+        auto resFilteredAssets = getNsFilterAssets<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resFilteredAssets))
+        {
+            return std::move(std::get<api::wpResponse>(resFilteredAssets));
+        }
+        auto& filteredAssets = std::get<std::unordered_set<std::string>>(resFilteredAssets);
+
+        if (eRequest.asset_trace_size() == 0)
+        {
+            assetToTrace = std::move(filteredAssets);
+        }
+        else // If eRequest.assets() has assets, then only those assets should be traced
+        {
+            std::unordered_set<std::string> requestAssets {};
+            for (const auto& asset : eRequest.asset_trace())
+            {
+                if (filteredAssets.find(asset) == filteredAssets.end())
+                {
+                    return genericError<ResponseType>(fmt::format("Asset {} not found in store", asset));
+                }
+                requestAssets.insert(asset);
+            }
+            assetToTrace = std::move(requestAssets);
+        }
+    }
+
+    return ::router::test::Options(traceLevel, assetToTrace, eRequest.name());
+}
+
+/**
+ * @brief Create an event in the Wazuh protocol, queue:location:message
+ *
+ * @param queue Queue of the event
+ * @param location Location of the event, the ':' characters are escaped
+ * @param message Message of the event
+ * @return std::string
+ */
+std::string toWazuhEvent(const std::string& queue, const std::string& location, const std::string& message)
+{
+    std::stringstream streamLocation;
+    // Escape the ':' character in the location (Wazuh protocol)
+    for (const auto& c : location)
+    {
+        if (c == ':')
+        {
+            streamLocation << "|:";
+        }
+        else
+        {
+            streamLocation << c;
+        }
+    }
+
+    return queue + ":" + streamLocation.str() + ":" + message;
+}
+
 /**
  * @brief Transform a router::test::Output to a eTester::Result
  *
+ * The result is filled in place, so the event and the traces are allocated on the arena of the response if it has one.
  * @param output Output to transform
- * @return eTester::Result
+ * @param result Result to fill
  */
-eTester::Result fromOutput(const ::router::test::Output& output)
+void fromOutput(const ::router::test::Output& output, eTester::Result& result)
 {
-    eTester::Result result {};
-
     // Set event
-    auto resProtoEvent = eMessage::eMessageFromJson<google::protobuf::Value>(output.event()->str());
-    if (std::holds_alternative<base::Error>(resProtoEvent))
+    if (auto error = eMessage::eMessageFromJson(output.event()->str(), *result.mutable_output()))
     {
-        throw std::runtime_error {std::get<base::Error>(resProtoEvent).message}; // Should never happen
+        throw std::runtime_error {error->message}; // Should never happen
     }
-    auto& protoEvent = std::get<google::protobuf::Value>(resProtoEvent);
-    result.mutable_output()->CopyFrom(protoEvent);
 
     // Set traces
     for (const auto& [assetName, assetTrace] : output.traceList())
     {
-        eTester::Result_AssetTrace eTrace {};
-        eTrace.set_asset(assetName);
-        eTrace.set_success(assetTrace.success);
+        auto* eTrace = result.add_asset_traces();
+        eTrace->set_asset(assetName);
+        eTrace->set_success(assetTrace.success);
         for (const auto& trace : assetTrace.traces)
         {
-            eTrace.add_traces(trace);
+            eTrace->add_traces(trace);
         }
+    }
+}
 
-        result.mutable_asset_traces()->Add(std::move(eTrace));
+/**
+ * @brief Batch of tests answered with a single response.
+ *
+ * A window of events is queued and every completed test queues the next one, so the test workers run the batch in
+ * parallel without filling up the test queue shared with the other requests. The events that cannot be queued get an
+ * error result.
+ */
+class BatchRun : public std::enable_shared_from_this<BatchRun>
+{
+public:
+    using ResponseType = eTester::BatchPost_Response;
+
+    BatchRun(std::shared_ptr<::router::ITesterAPI> tester,
+             std::vector<std::string>&& events,
+             ::router::test::Options&& opt,
+             std::function<void(const api::wpResponse&)> callbackFn)
+        : m_tester(std::move(tester))
+        , m_events(std::move(events))
+        , m_opt(std::move(opt))
+        , m_callbackFn(std::move(callbackFn))
+        , m_arena(eMessage::arenaOptions())
+        , m_pending(m_events.size())
+        , m_eResponse(google::protobuf::Arena::CreateMessage<ResponseType>(&m_arena))
+    {
     }
 
-    return result;
-}
+    /**
+     * @brief Queues the first events of the batch.
+     *
+     * @param window Events queued at the same time
+     */
+    void start(std::size_t window)
+    {
+        for (std::size_t i = 0; i < std::min(window, m_events.size()); ++i)
+        {
+            queueNext();
+        }
+    }
+
+private:
+    std::shared_ptr<::router::ITesterAPI> m_tester;           ///< Tester running the events
+    std::vector<std::string> m_events;                        ///< Events to test, in the Wazuh protocol
+    ::router::test::Options m_opt;                            ///< Options shared by all the tests
+    std::function<void(const api::wpResponse&)> m_callbackFn; ///< Response callback
+    google::protobuf::Arena m_arena;                          ///< Arena of the response and its results
+
+    std::mutex m_mutex;        ///< Protects the fields below
+    std::size_t m_next {0};    ///< Next event to queue
+    std::size_t m_pending;     ///< Events without result
+    ResponseType* m_eResponse; ///< Results, in the order they completed, owned by m_arena
+
+    void queueNext()
+    {
+        while (true)
+        {
+            std::size_t index = 0;
+            {
+                std::lock_guard lock {m_mutex};
+                if (m_next == m_events.size())
+                {
+                    return;
+                }
+                index = m_next++;
+            }
+
+            auto onOutput = [self = shared_from_this(), index](base::RespOrError<::router::test::Output>&& output)
+            {
+                self->complete(index, std::move(output));
+                self->queueNext();
+            };
+            auto error = m_tester->ingestTest(m_events[index], m_opt, onOutput);
+            if (!error)
+            {
+                return;
+            }
+            complete(index, std::move(error.value()));
+        }
+    }
+
+    void complete(std::size_t index, base::RespOrError<::router::test::Output>&& output)
+    {
+        // The allocations on the arena are thread-safe, the item is filled out of the lock and added without a copy
+        auto* item = google::protobuf::Arena::CreateMessage<ResponseType::Item>(&m_arena);
+        item->set_index(static_cast<uint32_t>(index));
+        if (base::isError(output))
+        {
+            item->set_error("Error running test: " + base::getError(output).message);
+        }
+        else
+        {
+            fromOutput(base::getResponse(output), *item->mutable_result());
+        }
+
+        bool done = false;
+        {
+            std::lock_guard lock {m_mutex};
+            m_eResponse->mutable_results()->AddAllocated(item);
+            done = --m_pending == 0;
+        }
+
+        if (done)
+        {
+            m_eResponse->set_status(eEngine::ReturnStatus::OK);
+            m_callbackFn(::api::adapter::toWazuhResponse<ResponseType>(*m_eResponse));
+        }
+    }
+};
 
 } // namespace
 
@@ -368,70 +554,24 @@ api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester, con
         auto& [tester, eRequest] = std::get<TesterAndRequest<RequestType>>(res);
 
         // Checks params
-        using OTraceLavel = ::router::test::Options::TraceLevel;
-        OTraceLavel traceLevel = eRequest.trace_level() == eTester::TraceLevel::NONE         ? OTraceLavel::NONE
-                                 : eRequest.trace_level() == eTester::TraceLevel::ASSET_ONLY ? OTraceLavel::ASSET_ONLY
-                                                                                             : OTraceLavel::ALL;
-
-        // Find the list of assets to trace
-        std::unordered_set<std::string> assetToTrace {};
-        if (traceLevel != OTraceLavel::NONE)
-        {
-            // Get the assets of the policy filtered by namespaces
-            auto resFilteredAssets = getNsFilterAssets<RequestType, ResponseType>(eRequest, wStore, tester);
-            if (std::holds_alternative<api::wpResponse>(resFilteredAssets))
-            {
-                callbackFn(std::get<api::wpResponse>(resFilteredAssets));
-                return;
-            }
-            auto& filteredAssets = std::get<std::unordered_set<std::string>>(resFilteredAssets);
-
-            if (eRequest.asset_trace_size() == 0)
-            {
-                assetToTrace = std::move(filteredAssets);
-            }
-            else // If eRequest.assets() has assets, then only those assets should be traced
-            {
-                std::unordered_set<std::string> requestAssets {};
-                for (const auto& asset : eRequest.asset_trace())
-                {
-                    if (filteredAssets.find(asset) == filteredAssets.end())
-                    {
-                        callbackFn(genericError<ResponseType>(fmt::format("Asset {} not found in store", asset)));
-                        return;
-                    }
-                    requestAssets.insert(asset);
-                }
-                assetToTrace = std::move(requestAssets);
-            }
+        auto resOpt = getTestOptions<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resOpt))
+        {
+            callbackFn(std::get<api::wpResponse>(resOpt));
+            return;
         }
+        auto& opt = std::get<::router::test::Options>(resOpt);
 
         // Create The event to test
-        std::string eventStr {};
-        {
-            std::stringstream streamLocation;
-            // Escape the ':' character in the location (Wazuh protocol)
-            for (const auto& c : eRequest.location())
-            {
-                if (c == ':')
-                {
-                    streamLocation << "|:";
-                }
-                else
-                {
-                    streamLocation << c;
-                }
-            }
-
-            eventStr = eRequest.queue() + ":" + streamLocation.str() + ":" + eRequest.message();
-        }
+        auto eventStr = toWazuhEvent(eRequest.queue(), eRequest.location(), eRequest.message());
 
         // Run the test
-        auto opt = ::router::test::Options(traceLevel, assetToTrace, eRequest.name());
 
         auto responseCallback = [callbackFn](base::RespOrError<::router::test::Output>&& output)
         {
-            ResponseType eResponse {};
+            // The traces of the result are allocated on the arena, released at once with the response
+            google::protobuf::Arena arena {eMessage::arenaOptions()};
+            auto& eResponse = *google::protobuf::Arena::CreateMessage<ResponseType>(&arena);
             if (base::isError(output))
             {
                 eResponse.set_status(eEngine::ReturnStatus::ERROR);
@@ -439,7 +579,7 @@ api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester, con
                 callbackFn(::api::adapter::toWazuhResponse<ResponseType>(eResponse));
                 return;
             }
-            eResponse.mutable_result()->CopyFrom(fromOutput(base::getResponse(output)));
+            fromOutput(base::getResponse(output), *eResponse.mutable_result());
             eResponse.set_status(eEngine::ReturnStatus::OK);
             callbackFn(::api::adapter::toWazuhResponse<ResponseType>(eResponse));
         };
@@ -452,6 +592,51 @@ api::HandlerAsync runPost(const std::weak_ptr<::router::ITesterAPI>& tester, con
     };
 }
 
+api::HandlerAsync batchPost(const std::weak_ptr<::router::ITesterAPI>& tester,
+                            const std::weak_ptr<store::IStoreReader>& store)
+{
+    return [wTester = tester, wStore = store](const api::wpRequest& wRequest,
+                                              std::function<void(const api::wpResponse&)> callbackFn)
+    {
+        using RequestType = eTester::BatchPost_Request;
+        using ResponseType = eTester::BatchPost_Response;
+
+        // Validate request
+        auto res = getRequest<RequestType, ResponseType>(wRequest, wTester);
+        if (std::holds_alternative<api::wpResponse>(res))
+        {
+            callbackFn(std::get<api::wpResponse>(res));
+            return;
+        }
+        auto& [tester, eRequest] = std::get<TesterAndRequest<RequestType>>(res);
+
+        if (eRequest.events_size() == 0)
+        {
+            callbackFn(genericError<ResponseType>("Events parameter is required"));
+            return;
+        }
+
+        // The options are resolved once, so the workers keep the trace subscriptions between the events
+        auto resOpt = getTestOptions<RequestType, ResponseType>(eRequest, wStore, tester);
+        if (std::holds_alternative<api::wpResponse>(resOpt))
+        {
+            callbackFn(std::get<api::wpResponse>(resOpt));
+            return;
+        }
+
+        std::vector<std::string> events {};
+        events.reserve(eRequest.events_size());
+        for (const auto& event : eRequest.events())
+        {
+            events.emplace_back(toWazuhEvent(event.queue(), event.location(), event.message()));
+        }
+
+        auto run = std::make_shared<BatchRun>(
+            tester, std::move(events), std::move(std::get<::router::test::Options>(resOpt)), callbackFn);
+        run->start(BATCH_WINDOW);
+    };
+}
+
 void registerHandlers(const std::weak_ptr<::router::ITesterAPI>& tester,
                       const std::weak_ptr<store::IStoreReader>& store,
                       const std::weak_ptr<api::policy::IPolicy>& policy,
@@ -463,7 +648,8 @@ void registerHandlers(const std::weak_ptr<::router::ITesterAPI>& tester,
           && api->registerHandler("tester.session/reload", Api::convertToHandlerAsync(sessionReload(tester)))
           && api->registerHandler("tester.table/get", Api::convertToHandlerAsync(tableGet(tester, policy)))
           // && api->registerHandler("tester.table/delete", tableDelete(tester))
-          && api->registerHandler("tester.run/post", runPost(tester, store))))
+          && api->registerHandler("tester.run/post", runPost(tester, store))
+          && api->registerHandler("tester.batch/post", batchPost(tester, store))))
     {
         throw std::runtime_error("Tester API handlers registration failed");
     }
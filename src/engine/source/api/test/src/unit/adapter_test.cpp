@@ -117,3 +117,32 @@ TEST(Adapter_genericSuccess, response_ok)
     ASSERT_EQ(wResponse.data(), json::Json(R"({"status":"OK"})"));
 
 }
+
+TEST(Adapter_fromWazuhRequest, success_arena)
+{
+    const auto params = json::Json {R"({"valueString":"test value", "defaultInt":1})"};
+    const auto wRequest = WazuhRequest::create("testCmd", "test origin", params);
+    google::protobuf::Arena arena {eMessage::arenaOptions()};
+
+    const auto res = fromWazuhRequest<RequestType, ResponseType>(wRequest, arena);
+
+    ASSERT_TRUE(std::holds_alternative<RequestType*>(res));
+    const auto* eRequest = std::get<RequestType*>(res);
+    ASSERT_EQ(eRequest->GetArena(), &arena);
+    ASSERT_EQ(eRequest->valuestring(), "test value");
+    ASSERT_EQ(eRequest->defaultint(), 1);
+}
+
+TEST(Adapter_fromWazuhRequest, fail_eMessageFormat_arena)
+{
+    const auto params = json::Json {R"({"defaultInt":{}})"};
+    const auto wRequest = WazuhRequest::create("testCmd", "test origin", params);
+    google::protobuf::Arena arena {eMessage::arenaOptions()};
+
+    const auto res = fromWazuhRequest<RequestType, ResponseType>(wRequest, arena);
+
+    ASSERT_TRUE(std::holds_alternative<WazuhResponse>(res));
+    const auto& wResponse = std::get<WazuhResponse>(res);
+    ASSERT_FALSE(wResponse.error());
+    ASSERT_EQ(wResponse.data().getString("/status"), "ERROR");
+}
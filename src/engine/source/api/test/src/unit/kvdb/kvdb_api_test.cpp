@@ -85,6 +85,26 @@ protected:
         return api::wpRequest::create(rCommand, rOrigin, data);
     }
 
+    api::wpRequest memoryResidentWRequest(const std::string& kvdbName)
+    {
+        // create request
+        json::Json data {};
+        data.setObject();
+        data.setString(kvdbName, "/name");
+        data.setBool(true, "/memoryResident");
+        return api::wpRequest::create(rCommand, rOrigin, data);
+    }
+
+    api::wpRequest ttlWRequest(const std::string& kvdbName, const uint32_t ttl)
+    {
+        // create request
+        json::Json data {};
+        data.setObject();
+        data.setString(kvdbName, "/name");
+        data.setInt64(ttl, "/ttl");
+        return api::wpRequest::create(rCommand, rOrigin, data);
+    }
+
     api::wpRequest commonWRequest()
     {
         // create request
@@ -201,7 +221,8 @@ TEST_F(KVDBApiTest, managerPost)
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
     EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1)).WillOnce(testing::Return(kvdbOk()));
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, testing::An<const kvdbManager::KVDBOptions&>()))
+        .WillOnce(testing::Return(kvdbOk()));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1));
     const auto expectedData = json::Json {R"({"status":"OK"})"};
@@ -212,12 +233,50 @@ TEST_F(KVDBApiTest, managerPost)
     ASSERT_EQ(response.data(), expectedData);
 }
 
+TEST_F(KVDBApiTest, managerPostMemoryResident)
+{
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    api::HandlerSync cmd;
+    EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
+    const testing::Matcher<const kvdbManager::KVDBOptions&> memoryResident =
+        testing::Field(&kvdbManager::KVDBOptions::memoryResident, true);
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, memoryResident)).WillOnce(testing::Return(kvdbOk()));
+    ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
+    const auto response = cmd(memoryResidentWRequest(KVDB_TEST_1));
+    const auto expectedData = json::Json {R"({"status":"OK"})"};
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.error(), 0);
+    ASSERT_FALSE(response.message().has_value());
+    ASSERT_EQ(response.data(), expectedData);
+}
+
+TEST_F(KVDBApiTest, managerPostTTL)
+{
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    api::HandlerSync cmd;
+    EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
+    const testing::Matcher<const kvdbManager::KVDBOptions&> ttl =
+        testing::AllOf(testing::Field(&kvdbManager::KVDBOptions::memoryResident, false),
+                       testing::Field(&kvdbManager::KVDBOptions::ttl, 3600));
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, ttl)).WillOnce(testing::Return(kvdbOk()));
+    ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
+    const auto response = cmd(ttlWRequest(KVDB_TEST_1, 3600));
+    const auto expectedData = json::Json {R"({"status":"OK"})"};
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.error(), 0);
+    ASSERT_FALSE(response.message().has_value());
+    ASSERT_EQ(response.data(), expectedData);
+}
+
 TEST_F(KVDBApiTest, managerPostWithJsonWithValueOK)
 {
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
     EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, JSON_FILE_WITH_VALUE_OK)).WillOnce(testing::Return(kvdbOk()));
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, JSON_FILE_WITH_VALUE_OK, testing::_))
+        .WillOnce(testing::Return(kvdbOk()));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1, JSON_FILE_WITH_VALUE_OK));
     const auto expectedData = json::Json {R"({"status":"OK"})"};
@@ -233,7 +292,8 @@ TEST_F(KVDBApiTest, managerPostWithJsonWithoutValueOK)
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
     EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, JSON_FILE_WITHOUT_VALUE_OK)).WillOnce(testing::Return(kvdbOk()));
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, JSON_FILE_WITHOUT_VALUE_OK, testing::_))
+        .WillOnce(testing::Return(kvdbOk()));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1, JSON_FILE_WITHOUT_VALUE_OK));
     const auto expectedData = json::Json {R"({"status":"OK"})"};
@@ -248,7 +308,8 @@ TEST_F(KVDBApiTest, managerPostWithPathEmpty)
 {
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "")).WillOnce(testing::Return(kvdbError("The path is empty.")));
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "", testing::_))
+        .WillOnce(testing::Return(kvdbError("The path is empty.")));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1, {""}));
     const auto expectedData =
@@ -265,7 +326,7 @@ TEST_F(KVDBApiTest, managerPostWithJsonPathNotExists)
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
     EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "/tmp/kvdb_not_exists.json"))
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "/tmp/kvdb_not_exists.json", testing::_))
         .WillOnce(testing::Return(kvdbError("An error occurred while opening the file '/tmp/kvdb_not_exists.json'")));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1, JSON_FILE_NOT_EXISTS));
@@ -283,7 +344,7 @@ TEST_F(KVDBApiTest, managerPostWithJsonNOK)
     auto kvdbManager = std::make_shared<MockKVDBManager>();
     api::HandlerSync cmd;
     EXPECT_CALL(*kvdbManager, existsDB(KVDB_TEST_1)).WillOnce(testing::Return(false));
-    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "/tmp/kvdb_nok.json"))
+    EXPECT_CALL(*kvdbManager, createDB(KVDB_TEST_1, "/tmp/kvdb_nok.json", testing::_))
         .WillOnce(testing::Return(kvdbError("An error occurred while parsing the JSON file '/tmp/kvdb_nok.json'")));
     ASSERT_NO_THROW(cmd = managerPost(kvdbManager));
     const auto response = cmd(commonWRequest(KVDB_TEST_1, JSON_FILE_NOK));
@@ -1103,6 +1164,29 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(R"({"name": "test", "page": 1, "records": 10})", R"({"status":"OK","entries":[]})"),
         std::make_tuple(R"({"name": "test", "page": 3, "records": 5})", R"({"status":"OK","entries":[]})")));
 
+TEST(DumpWithCursor, Functionality)
+{
+    auto kvdbManager = std::make_shared<MockKVDBManager>();
+    auto kvdbHandler = std::make_shared<MockKVDBHandler>();
+    api::HandlerSync cmd;
+
+    EXPECT_CALL(*kvdbManager, existsDB("test")).WillOnce(testing::Return(true));
+    EXPECT_CALL(*kvdbManager, getKVDBHandler("test", "test")).WillOnce(testing::Return(kvdbHandler));
+    EXPECT_CALL(*kvdbHandler, scan("", "key1", 2))
+        .WillOnce(testing::Return(kvdbManager::KVDBPage {{{"key2", R"("value2")"}, {"key3", R"("value3")"}}, "key3"}));
+
+    ASSERT_NO_THROW(cmd = managerDump(kvdbManager, "test"));
+    json::Json jsonParams(R"({"name": "test", "records": 2, "cursor": "key1"})");
+    const auto response = cmd(api::wpRequest::create(rCommand, rOrigin, jsonParams));
+    const auto expectedData = json::Json(
+        R"({"status":"OK","entries":[{"key":"key2","value":"value2"},{"key":"key3","value":"value3"}],"nextCursor":"key3"})");
+
+    ASSERT_TRUE(response.isValid());
+    ASSERT_EQ(response.error(), 0);
+    ASSERT_FALSE(response.message().has_value());
+    ASSERT_EQ(response.data(), expectedData);
+}
+
 template<typename T>
 class SearchTest : public ::testing::TestWithParam<T>
 {
@@ -1318,5 +1402,27 @@ INSTANTIATE_TEST_SUITE_P(
                                 return list;
                             }));
                     return R"({"status":"OK","entries":[{"key":"key2","value":"value2"},{"key":"key3","value":"value3"}]})";
-                }))));
+                })),
+        SearchT(R"({"name": "test", "prefix":"key", "cursor": "key1", "records": 2})",
+                success<std::string>(
+                    [](auto manager, auto handler)
+                    {
+                        EXPECT_CALL(*manager, existsDB("test")).WillOnce(testing::Return(true));
+                        EXPECT_CALL(*manager, getKVDBHandler("test", "test")).WillOnce(testing::Return(handler));
+                        EXPECT_CALL(*handler, scan("key", "key1", 2))
+                            .WillOnce(testing::Return(
+                                kvdbManager::KVDBPage {{{"key11", R"("value1")"}, {"key2", R"("value2")"}}, "key2"}));
+                        return R"({"status":"OK","entries":[{"key":"key11","value":"value1"},{"key":"key2","value":"value2"}],"nextCursor":"key2"})";
+                    })),
+        SearchT(R"({"name": "test", "prefix":"key", "cursor": "key2"})",
+                success<std::string>(
+                    [](auto manager, auto handler)
+                    {
+                        EXPECT_CALL(*manager, existsDB("test")).WillOnce(testing::Return(true));
+                        EXPECT_CALL(*manager, getKVDBHandler("test", "test")).WillOnce(testing::Return(handler));
+                        EXPECT_CALL(*handler, scan("key", "key2", DEFAULT_HANDLER_RECORDS))
+                            .WillOnce(testing::Return(
+                                kvdbManager::KVDBPage {{{"key3", R"("value3")"}}, std::nullopt}));
+                        return R"({"status":"OK","entries":[{"key":"key3","value":"value3"}]})";
+                    }))));
 } // namespace
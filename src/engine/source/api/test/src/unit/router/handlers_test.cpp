@@ -442,6 +442,27 @@ INSTANTIATE_TEST_SUITE_P(
                             EXPECT_CALL(*router, changeEntryPriority(testing::_, testing::_))
                                 .WillOnce(::testing::Return(std::nullopt));
                         })),
+        // [routePatchEpsLimit]: Fail
+        TestRouterT(routePatchEpsLimit,
+                    routerProduction::JParams(ENVIRONMENT_NAME, false),
+                    failureWPayload(
+                        [](auto router) -> json::Json
+                        {
+                            base::OptError error = base::Error {"The route not exist"};
+                            EXPECT_CALL(*router, changeEntryEpsLimit(testing::_, testing::_))
+                                .WillOnce(::testing::Return(error));
+                            auto expected = json::Json();
+                            expected.setString(base::getError(error).message, "/error");
+                            return expected;
+                        })),
+        // [routePatchEpsLimit]: Sucess
+        TestRouterT(routePatchEpsLimit,
+                    routerProduction::JParams(ENVIRONMENT_NAME, false),
+                    success(
+                        [](auto router) {
+                            EXPECT_CALL(*router, changeEntryEpsLimit(testing::_, testing::_))
+                                .WillOnce(::testing::Return(std::nullopt));
+                        })),
         // [queuePost]: Fail
         TestRouterT(queuePost,
                     routerProduction::JParams("", "", "", 0, false).event(""),
@@ -599,3 +620,169 @@ INSTANTIATE_TEST_SUITE_P(
                     res.setString(syncToString(entry.policySync()), "/policy_sync");
                     return res;
                 }))));
+
+TEST(RouterQueuePostBulkTest, PushesTheEventsAtOnce)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    json::Json params {R"({"wazuh_events": ["1:any:first", "1:any:second", "invalid"]})"};
+
+    std::vector<std::string_view> pushed;
+    EXPECT_CALL(*router, postStrEvents(testing::_))
+        .WillOnce(testing::Invoke(
+            [&pushed](const std::vector<std::string_view>& events)
+            {
+                pushed = events;
+                return 2;
+            }));
+
+    auto request = api::wpRequest::create("router.queue/postBulk", "test", params);
+    auto response = queuePostBulk(router)(request);
+
+    ASSERT_EQ(pushed.size(), 3);
+    EXPECT_EQ(pushed[0], "1:any:first");
+    EXPECT_EQ(pushed[2], "invalid");
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+    EXPECT_EQ(response.data().getInt("/accepted"), 2);
+    EXPECT_EQ(response.data().getInt("/discarded"), 1);
+}
+
+TEST(RouterQueuePostBulkTest, EmptyBatch)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    json::Json params {R"({"wazuh_events": []})"};
+
+    EXPECT_CALL(*router, postStrEvents(testing::_)).Times(0);
+
+    auto request = api::wpRequest::create("router.queue/postBulk", "test", params);
+    auto response = queuePostBulk(router)(request);
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_ERROR);
+    EXPECT_EQ(response.data().getString(ERROR_PATH), "Missing /wazuh_events");
+}
+
+TEST(RouterIngressTest, PostConvertsTheRule)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    json::Json params {
+        R"({"rule": {"name": "health", "action": "DROP", "queue": "1", "location_prefix": "[099]",
+        "contains": ["health", "check"]}})"};
+
+    router::prod::IngressRule posted {"", router::prod::IngressAction::DIVERT};
+    EXPECT_CALL(*router, postIngressRule(testing::_))
+        .WillOnce(testing::Invoke(
+            [&posted](const router::prod::IngressRule& rule)
+            {
+                posted = rule;
+                return base::OptError {};
+            }));
+
+    auto request = api::wpRequest::create("router.ingress/post", "test", params);
+    auto response = postIngressRule(router)(request);
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+    EXPECT_EQ(posted.name(), "health");
+    EXPECT_EQ(posted.action(), router::prod::IngressAction::DROP);
+    EXPECT_EQ(posted.queue(), '1');
+    EXPECT_EQ(posted.locationPrefix(), "[099]");
+    EXPECT_EQ(posted.contains(), std::vector<std::string>({"health", "check"}));
+}
+
+TEST(RouterIngressTest, PostInvalidRule)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    EXPECT_CALL(*router, postIngressRule(testing::_)).Times(0);
+
+    auto response = postIngressRule(router)(api::wpRequest::create("router.ingress/post", "test", json::Json {"{}"}));
+    EXPECT_EQ(response.data().getString(ERROR_PATH), "Missing /rule");
+
+    json::Json params {R"({"rule": {"name": "rule", "action": "DROP", "queue": "12"}})"};
+    response = postIngressRule(router)(api::wpRequest::create("router.ingress/post", "test", params));
+    EXPECT_EQ(response.data().getString(ERROR_PATH), "Invalid /rule/queue, it must be a single character");
+
+    params = json::Json {R"({"rule": {"name": "rule", "queue": "1"}})"};
+    response = postIngressRule(router)(api::wpRequest::create("router.ingress/post", "test", params));
+    EXPECT_EQ(response.data().getString(ERROR_PATH), "Invalid /rule/action, it must be DROP or DIVERT");
+}
+
+TEST(RouterIngressTest, GetReturnsTheRulesWithTheirHits)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    router::prod::IngressRule rule {"noisy", router::prod::IngressAction::DIVERT};
+    rule.locationPrefix("noisy");
+    rule.hits(42);
+    EXPECT_CALL(*router, getIngressRules()).WillOnce(testing::Return(std::list<router::prod::IngressRule> {rule}));
+
+    auto response = getIngressRules(router)(api::wpRequest::create("router.ingress/get", "test", json::Json {"{}"}));
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+    EXPECT_EQ(response.data().getString("/rules/0/name"), "noisy");
+    EXPECT_EQ(response.data().getString("/rules/0/action"), "DIVERT");
+    EXPECT_EQ(response.data().getString("/rules/0/location_prefix"), "noisy");
+    EXPECT_FALSE(response.data().exists("/rules/0/queue"));
+    EXPECT_EQ(response.data().getString("/rules/0/hits"), "42");
+}
+
+TEST(RouterIngressTest, DeleteForwardsTheError)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    EXPECT_CALL(*router, deleteIngressRule("missing"))
+        .WillOnce(testing::Return(base::Error {"The ingress rule 'missing' does not exist"}));
+
+    json::Json params {R"({"name": "missing"})"};
+    auto response = deleteIngressRule(router)(api::wpRequest::create("router.ingress/delete", "test", params));
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_ERROR);
+    EXPECT_EQ(response.data().getString(ERROR_PATH), "The ingress rule 'missing' does not exist");
+}
+
+TEST(RouterEpsLimitTest, PostForwardsTheLimit)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    json::Json params {
+        R"({"route": {"name": "noisy", "policy": "policy/wazuh/0", "filter": "filter/allow-all/0", "priority": 1,
+        "eps_limit": 100}})"};
+
+    std::size_t epsLimit {0};
+    EXPECT_CALL(*router, postEntry(testing::_))
+        .WillOnce(testing::Invoke(
+            [&epsLimit](const router::prod::EntryPost& entry)
+            {
+                epsLimit = entry.epsLimit();
+                return base::OptError {};
+            }));
+
+    auto response = routePost(router)(api::wpRequest::create("router.route/post", "test", params));
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+    EXPECT_EQ(epsLimit, 100);
+}
+
+TEST(RouterEpsLimitTest, PatchForwardsTheLimit)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    EXPECT_CALL(*router, changeEntryEpsLimit("noisy", 0)).WillOnce(testing::Return(std::nullopt));
+
+    json::Json params {R"({"name": "noisy", "eps_limit": 0})"};
+    auto response = routePatchEpsLimit(router)(api::wpRequest::create("router.route/patchEpsLimit", "test", params));
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+}
+
+TEST(RouterEpsLimitTest, TableReturnsTheThrottledEvents)
+{
+    auto router = std::make_shared<MockRouterAPI>();
+    auto policy = std::make_shared<MockPolicy>();
+    router::prod::EntryPost entryPost {"noisy", "policy/wazuh/0", "filter/allow-all/0", 1};
+    entryPost.epsLimit(100);
+    router::prod::Entry entry {entryPost};
+    entry.throttled(42);
+    EXPECT_CALL(*router, getEntries()).WillOnce(testing::Return(std::list<router::prod::Entry> {entry}));
+    EXPECT_CALL(*policy, getHash(testing::_)).WillOnce(testing::Return("hash"));
+
+    auto response =
+        tableGet(router, policy)(api::wpRequest::create("router.table/get", "test", json::Json {"{}"}));
+
+    EXPECT_EQ(response.data().getString(STATUS_PATH), STATUS_OK);
+    EXPECT_EQ(response.data().getInt("/table/0/eps_limit"), 100);
+    EXPECT_EQ(response.data().getString("/table/0/throttled"), "42");
+}
@@ -834,3 +834,67 @@ INSTANTIATE_TEST_SUITE_P(
 
                     return expected;
                 }))));
+
+TEST(TesterBatchHandlerTest, RunsEveryEventWithOneResponse)
+{
+    auto tester = std::make_shared<MockTesterAPI>();
+    auto store = std::make_shared<MockStoreRead>();
+
+    json::Json params {R"({"name": "test", "trace_level": "NONE", "events": [
+        {"message": "first", "queue": "1", "location": "a:b"},
+        {"message": "second", "queue": "1", "location": "here"},
+        {"message": "third", "queue": "2", "location": "here"}
+    ]})"};
+
+    // The second event cannot be queued, the others complete in reverse order
+    std::vector<std::function<void(base::RespOrError<router::test::Output>&&)>> callbacks;
+    EXPECT_CALL(*tester, ingestTest(std::string_view {"1:a|:b:first"}, testing::_, testing::_))
+        .WillOnce(testing::DoAll(testing::Invoke([&callbacks](auto, const auto&, auto cb) { callbacks.push_back(cb); }),
+                                 testing::Return(std::nullopt)));
+    EXPECT_CALL(*tester, ingestTest(std::string_view {"1:here:second"}, testing::_, testing::_))
+        .WillOnce(testing::Return(base::Error {"Test queue is full"}));
+    EXPECT_CALL(*tester, ingestTest(std::string_view {"2:here:third"}, testing::_, testing::_))
+        .WillOnce(testing::DoAll(testing::Invoke([&callbacks](auto, const auto&, auto cb) { callbacks.push_back(cb); }),
+                                 testing::Return(std::nullopt)));
+
+    std::size_t responses = 0;
+    std::string strResponse;
+    auto callbackFn = [&](const api::wpResponse& res)
+    {
+        ++responses;
+        strResponse = res.toString();
+    };
+    batchPost(tester, store)(api::wpRequest::create("tester.batch/post", "test", params), callbackFn);
+
+    ASSERT_EQ(callbacks.size(), 2);
+    router::test::Output output;
+    output.event() = std::make_shared<json::Json>(R"({"key": "value"})");
+    callbacks[1](router::test::Output {output});
+    EXPECT_EQ(responses, 0);
+    callbacks[0](base::Error {"failed"});
+    ASSERT_EQ(responses, 1);
+
+    auto response = json::Json {strResponse.c_str()};
+    EXPECT_EQ(response.getString("/data/status").value_or(""), "OK");
+    auto results = response.getArray("/data/results").value();
+    ASSERT_EQ(results.size(), 3);
+    EXPECT_EQ(results[0].getInt("/index").value_or(-1), 1);
+    EXPECT_EQ(results[0].getString("/error").value_or(""), "Error running test: Test queue is full");
+    EXPECT_EQ(results[1].getInt("/index").value_or(-1), 2);
+    EXPECT_EQ(results[1].getString("/result/output/key").value_or(""), "value");
+    EXPECT_EQ(results[2].getInt("/index").value_or(-1), 0);
+    EXPECT_EQ(results[2].getString("/error").value_or(""), "Error running test: failed");
+}
+
+TEST(TesterBatchHandlerTest, RequiresEvents)
+{
+    auto tester = std::make_shared<MockTesterAPI>();
+    auto store = std::make_shared<MockStoreRead>();
+
+    std::string strResponse;
+    batchPost(tester, store)(api::wpRequest::create("tester.batch/post", "test", json::Json {R"({"name": "test"})"}),
+                             [&strResponse](const api::wpResponse& res) { strResponse = res.toString(); });
+
+    auto response = json::Json {strResponse.c_str()};
+    EXPECT_EQ(response.getString("/data/error").value_or(""), "Events parameter is required");
+}
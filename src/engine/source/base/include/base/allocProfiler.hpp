@@ -0,0 +1,86 @@
+#ifndef _BASE_ALLOC_PROFILER_HPP
+#define _BASE_ALLOC_PROFILER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Heap allocation profiler, built only with the ENGINE_ALLOC_PROFILING option.
+ *
+ * The profiling build replaces the global operator new with a counting hook. Each allocation is attributed to the
+ * context of the calling thread, set by the bk controllers while an event goes through a policy, a stage or an asset.
+ * Without the option nothing is replaced and the contexts are never set.
+ */
+namespace base::allocprof
+{
+
+#ifdef ENGINE_ALLOC_PROFILING
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+/**
+ * @brief Counters of a context, the allocations of its nested contexts are not included.
+ */
+struct Counters
+{
+    std::string policy;                    ///< Policy of the context
+    std::string name;                      ///< Policy, stage or asset name
+    std::atomic<uint64_t> events {0};      ///< Events that entered the context
+    std::atomic<uint64_t> allocations {0}; ///< Allocations made in the context
+    std::atomic<uint64_t> bytes {0};       ///< Bytes allocated in the context
+};
+
+/**
+ * @brief Allocations of a context.
+ */
+struct Entry
+{
+    std::string policy;   ///< Policy of the context
+    std::string name;     ///< Policy, stage or asset name
+    uint64_t events;      ///< Events that entered the context
+    uint64_t allocations; ///< Allocations made in the context
+    uint64_t bytes;       ///< Bytes allocated in the context
+};
+
+/**
+ * @brief Gets the counters of a context, shared by all the controllers of the policy.
+ *
+ * @param policy Policy of the context.
+ * @param name Policy, stage or asset name.
+ * @return std::shared_ptr<Counters>
+ */
+std::shared_ptr<Counters> counters(const std::string& policy, const std::string& name);
+
+/**
+ * @brief Sets the context of the calling thread.
+ *
+ * @param counters Counters of the new context, nullptr for none.
+ * @return Counters* The previous context, to be restored when the new one is left.
+ */
+Counters* exchangeCurrent(Counters* counters) noexcept;
+
+/**
+ * @brief Allocations made by the calling thread, 0 if the profiling is not built.
+ */
+uint64_t threadAllocations() noexcept;
+
+/**
+ * @brief Gets the allocations of all the contexts, sorted by policy and name.
+ *
+ * @return std::vector<Entry>
+ */
+std::vector<Entry> entries();
+
+/**
+ * @brief Sets the counters of all the contexts to zero.
+ */
+void reset();
+
+} // namespace base::allocprof
+
+#endif // _BASE_ALLOC_PROFILER_HPP
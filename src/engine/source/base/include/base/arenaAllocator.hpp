@@ -0,0 +1,179 @@
+#ifndef _BASE_ARENA_ALLOCATOR_HPP
+#define _BASE_ARENA_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Slab allocator with an arena per engine subsystem.
+ *
+ * Each thread allocates from its own cache of the arena of its current subsystem, so the router workers, the API and
+ * the builder do not share the free lists nor the spans they carve blocks from. The blocks of up to MAX_BLOCK_SIZE
+ * bytes come from size classes of 64 KiB spans, the larger ones from the system allocator.
+ *
+ * A block freed by the thread that owns its cache goes back to the cache without synchronization. A block freed by
+ * another thread is pushed to a lock-free list of the owner cache, which takes it back the next time it runs out of
+ * blocks. The caches of the threads that exit are adopted by the next thread of the same subsystem.
+ *
+ * The allocator is always built, the containers can use it through Allocator. The ENGINE_ARENA_ALLOCATOR option also
+ * replaces the global operator new with it, so every allocation of a thread goes to the arena of its subsystem.
+ */
+namespace base::arena
+{
+
+#ifdef ENGINE_ARENA_ALLOCATOR
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+constexpr std::size_t MAX_BLOCK_SIZE {8192}; ///< Largest block of the size classes, header included
+constexpr std::size_t ALIGNMENT {16};        ///< Alignment of the allocations
+
+/**
+ * @brief Subsystems with an arena of their own.
+ */
+enum class Subsystem : uint8_t
+{
+    DEFAULT = 0, ///< Threads that did not select a subsystem
+    ROUTER,      ///< Event parsing and the router workers
+    API,         ///< API requests
+    BUILDER,     ///< Policy and asset builds
+    COUNT
+};
+
+constexpr std::size_t SUBSYSTEMS {static_cast<std::size_t>(Subsystem::COUNT)};
+
+/**
+ * @brief Get the name of a subsystem.
+ *
+ * @param subsystem Subsystem.
+ * @return std::string_view Lowercase name, "unknown" if it is not a subsystem.
+ */
+std::string_view subsystemName(Subsystem subsystem) noexcept;
+
+/**
+ * @brief Sets the subsystem of the calling thread, the arena its next allocations come from.
+ *
+ * @param subsystem Subsystem of the thread.
+ * @return Subsystem The previous subsystem, to be restored when the new one is left.
+ */
+Subsystem exchangeCurrent(Subsystem subsystem) noexcept;
+
+/**
+ * @brief Gets the subsystem of the calling thread.
+ *
+ * @return Subsystem
+ */
+Subsystem current() noexcept;
+
+/**
+ * @brief Selects the subsystem of the calling thread while in scope.
+ */
+class ScopedSubsystem
+{
+private:
+    Subsystem m_previous; ///< Subsystem restored when the scope is left
+
+public:
+    explicit ScopedSubsystem(Subsystem subsystem) noexcept
+        : m_previous {exchangeCurrent(subsystem)}
+    {
+    }
+
+    ~ScopedSubsystem() { exchangeCurrent(m_previous); }
+
+    ScopedSubsystem(const ScopedSubsystem&) = delete;
+    ScopedSubsystem& operator=(const ScopedSubsystem&) = delete;
+};
+
+/**
+ * @brief Allocates from the arena of the subsystem of the calling thread.
+ *
+ * @param size Bytes to allocate, 0 allocates a unique block.
+ * @return void* Block aligned to ALIGNMENT.
+ * @throw std::bad_alloc if the memory is exhausted.
+ */
+void* allocate(std::size_t size);
+
+/**
+ * @brief Releases a block of allocate, from any thread.
+ *
+ * @param ptr Block to release, nullptr does nothing.
+ */
+void deallocate(void* ptr) noexcept;
+
+/**
+ * @brief Usage of the arena of a subsystem.
+ */
+struct Stats
+{
+    Subsystem subsystem;        ///< Subsystem of the arena
+    uint64_t allocations;       ///< Blocks allocated
+    uint64_t deallocations;     ///< Blocks released, the remote ones once they are taken back by their cache
+    uint64_t remoteFrees;       ///< Blocks released by a thread other than the one that owns their cache
+    uint64_t largeAllocations;  ///< Allocations larger than MAX_BLOCK_SIZE, made by the system allocator
+    uint64_t bytesInUse;        ///< Bytes of the blocks in use, headers and rounding to the class included
+    uint64_t bytesReserved;     ///< Bytes of the spans and of the large allocations in use
+    uint64_t caches;            ///< Thread caches created, including the ones of the exited threads
+};
+
+/**
+ * @brief Gets the usage of the arena of each subsystem.
+ *
+ * @note The counters are read without stopping the threads, they are not an atomic snapshot.
+ * @return std::vector<Stats> One entry per subsystem, in the order of Subsystem.
+ */
+std::vector<Stats> stats();
+
+/**
+ * @brief Standard allocator on the arenas, for the containers of the hot paths.
+ *
+ * The blocks come from the arena of the subsystem of the allocating thread, any allocator releases them.
+ */
+template<typename T>
+class Allocator
+{
+    static_assert(alignof(T) <= ALIGNMENT, "The arenas do not allocate over-aligned types");
+
+public:
+    using value_type = T;
+
+    Allocator() noexcept = default;
+
+    template<typename U>
+    Allocator(const Allocator<U>&) noexcept
+    {
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_array_new_length();
+        }
+        return static_cast<T*>(base::arena::allocate(n * sizeof(T)));
+    }
+
+    void deallocate(T* ptr, std::size_t) noexcept { base::arena::deallocate(ptr); }
+
+    template<typename U>
+    bool operator==(const Allocator<U>&) const noexcept
+    {
+        return true;
+    }
+
+    template<typename U>
+    bool operator!=(const Allocator<U>&) const noexcept
+    {
+        return false;
+    }
+};
+
+} // namespace base::arena
+
+#endif // _BASE_ARENA_ALLOCATOR_HPP
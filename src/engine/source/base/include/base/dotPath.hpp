@@ -9,6 +9,7 @@
 #include <fmt/core.h>
 #include <fmt/format.h>
 
+#include <base/internTable.hpp>
 #include <base/utils/stringUtils.hpp>
 
 /**
@@ -18,39 +19,48 @@
 class DotPath
 {
 private:
-    std::string m_str;                ///< The string representation of the path
-    std::vector<std::string> m_parts; ///< The parts of the path
+    using Parts = std::vector<std::string>;
+
+    base::InternTable::Entry m_entry; ///< Interned string and parts, null for the empty path
+
+    static base::InternTable& table()
+    {
+        static base::InternTable table;
+        return table;
+    }
+
+    static const base::InternedParts& empty()
+    {
+        static const base::InternedParts empty {};
+        return empty;
+    }
+
+    const base::InternedParts& entry() const { return m_entry ? *m_entry : empty(); }
 
     /**
      * @brief Parse the string representation of the path into its parts.
      *
      * @throws std::runtime_error if the path is empty or has empty parts
      */
-    void parse()
+    static Parts parse(const std::string& str)
     {
-        m_parts.clear();
-        m_parts = base::utils::string::splitEscaped(m_str, '.', '\\');
+        auto parts = base::utils::string::splitEscaped(str, '.', '\\');
 
-        for (auto part : m_parts)
+        for (const auto& part : parts)
         {
-            if (part.empty() && m_str != ".")
+            if (part.empty() && str != ".")
             {
                 throw std::runtime_error("DotPath cannot have empty parts");
             }
         }
-    }
 
-    void copy(const DotPath& rhs)
-    {
-        m_str = rhs.m_str;
-        m_parts = rhs.m_parts;
+        return parts;
     }
 
-    void move(DotPath&& rhs) noexcept
-    {
-        m_str = std::move(rhs.m_str);
-        m_parts = std::move(rhs.m_parts);
-    }
+    /**
+     * @brief Intern the path, the string is only parsed if no path of the same string is alive.
+     */
+    static base::InternTable::Entry intern(const std::string& str) { return table().intern(str, parse); }
 
 public:
     DotPath() = default;
@@ -63,9 +73,8 @@ public:
      * @throws std::runtime_error if the path is empty or has empty parts
      */
     DotPath(const std::string& str)
-        : m_str(str)
+        : m_entry(intern(str))
     {
-        parse();
     }
 
     /**
@@ -75,9 +84,8 @@ public:
      * @throws std::runtime_error if the path is empty or has empty parts
      */
     DotPath(const char str[])
-        : m_str(str)
+        : m_entry(intern(str))
     {
-        parse();
     }
 
     /**
@@ -87,18 +95,18 @@ public:
      * @param end
      * @throws std::runtime_error if the path is empty or has empty parts
      */
-    DotPath(decltype(m_parts.cbegin()) begin, const decltype(m_parts.cend())& end)
+    DotPath(Parts::const_iterator begin, const Parts::const_iterator& end)
     {
-        m_str = "";
+        std::string str;
         for (auto it = begin; it != end; ++it)
         {
-            m_str += *it;
+            str += *it;
             if (it != end - 1)
             {
-                m_str += ".";
+                str += ".";
             }
         }
-        parse();
+        m_entry = intern(str);
     }
 
     /**
@@ -106,14 +114,14 @@ public:
      *
      * @param rhs
      */
-    DotPath(const DotPath& rhs) { copy(rhs); }
+    DotPath(const DotPath& rhs) = default;
 
     /**
      * @brief Construct a new Dot Path object
      *
      * @param rhs
      */
-    DotPath(DotPath&& rhs) noexcept { move(std::move(rhs)); }
+    DotPath(DotPath&& rhs) noexcept = default;
 
     /**
      * @brief Copy assignment operator
@@ -121,11 +129,7 @@ public:
      * @param rhs
      * @return DotPath&
      */
-    DotPath& operator=(const DotPath& rhs)
-    {
-        copy(rhs);
-        return *this;
-    }
+    DotPath& operator=(const DotPath& rhs) = default;
 
     /**
      * @brief Move assignment operator
@@ -133,32 +137,32 @@ public:
      * @param rhs
      * @return DotPath&
      */
-    DotPath& operator=(DotPath&& rhs) noexcept
-    {
-        move(std::move(rhs));
-        return *this;
-    }
+    DotPath& operator=(DotPath&& rhs) noexcept = default;
 
     /**
      * @brief Constant iterator to the beginning of the path parts
      *
      * @return auto
      */
-    auto cbegin() const { return m_parts.cbegin(); }
+    auto cbegin() const { return entry().parts.cbegin(); }
 
     /**
      * @brief Constant iterator to the end of the path parts
      *
      * @return auto
      */
-    auto cend() const { return m_parts.cend(); }
+    auto cend() const { return entry().parts.cend(); }
 
-    friend bool operator==(const DotPath& lhs, const DotPath& rhs) { return lhs.m_str == rhs.m_str; }
+    friend bool operator==(const DotPath& lhs, const DotPath& rhs)
+    {
+        // The paths of the same string share their entry
+        return lhs.m_entry == rhs.m_entry || (lhs.hash() == rhs.hash() && lhs.str() == rhs.str());
+    }
     friend bool operator!=(const DotPath& lhs, const DotPath& rhs) { return !(lhs == rhs); }
 
     friend std::ostream& operator<<(std::ostream& os, const DotPath& dp)
     {
-        os << dp.m_str;
+        os << dp.str();
         return os;
     }
 
@@ -167,21 +171,35 @@ public:
      *
      * @return std::string
      */
-    explicit operator std::string() const { return m_str; }
+    explicit operator std::string() const { return str(); }
 
     /**
      * @brief Get the string representation of the path
      *
      * @return const std::string&
      */
-    const std::string& str() const { return m_str; }
+    const std::string& str() const { return entry().str; }
 
     /**
      * @brief Get the parts of the path
      *
      * @return const std::vector<std::string>&
      */
-    const std::vector<std::string>& parts() const { return m_parts; }
+    const std::vector<std::string>& parts() const { return entry().parts; }
+
+    /**
+     * @brief Get the hash of the path string, computed once per interned string
+     *
+     * @return size_t
+     */
+    size_t hash() const { return entry().hash; }
+
+    /**
+     * @brief Get the id of the interned string, paths with the same id are equal
+     *
+     * @return size_t 0 for the empty path
+     */
+    size_t id() const { return entry().id; }
 
     /**
      * @brief Transform pointer path string to dot path string
@@ -234,6 +252,16 @@ public:
     }
 };
 
+/* std::hash specialization for DotPath */
+namespace std
+{
+template<>
+struct hash<DotPath>
+{
+    size_t operator()(const DotPath& path) const { return path.hash(); }
+};
+} // namespace std
+
 // Make DotPath formatable by fmt
 template<>
 struct fmt::formatter<DotPath> : formatter<std::string>
@@ -0,0 +1,172 @@
+#ifndef _BASE_INTERN_TABLE_HPP
+#define _BASE_INTERN_TABLE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace base
+{
+
+/**
+ * @brief Immutable string and its parts, shared by all the names or paths built from the same string.
+ */
+struct InternedParts
+{
+    std::string str;                ///< Full string
+    std::vector<std::string> parts; ///< Parts of the string
+    std::size_t hash;               ///< Hash of the full string
+    std::size_t id;                 ///< Id of the entry, unique while the process runs
+};
+
+/**
+ * @brief Thread-safe table of the interned strings of a kind of name or path.
+ *
+ * Each distinct string is split once into an InternedParts entry, shared by every object built from the same string
+ * while any of them is alive. Objects holding the same entry are equal, so they compare and hash in O(1), and copying
+ * them does not allocate.
+ *
+ * The table only keeps weak references, the entries are released with their last object and the expired slots are
+ * purged as the table grows, so strings built at runtime do not accumulate. The entries are spread over shards by the
+ * hash of their string, each one with its own lock.
+ */
+class InternTable final
+{
+public:
+    using Entry = std::shared_ptr<const InternedParts>;
+
+    static constexpr std::size_t SHARDS {16};     ///< Number of shards
+    static constexpr std::size_t MIN_PURGE {256}; ///< Slots of a shard before its expired ones are purged
+
+    InternTable() = default;
+    InternTable(const InternTable&) = delete;
+    InternTable& operator=(const InternTable&) = delete;
+
+    /**
+     * @brief Get the entry of a string, splitting it only if it is not interned.
+     *
+     * @tparam SplitFn Callable std::vector<std::string>(const std::string&)
+     * @param str String to intern
+     * @param split Splits the string in its parts, it may throw to reject the string, which is then not interned
+     * @return Entry Entry of the string
+     */
+    template<typename SplitFn>
+    Entry intern(const std::string& str, SplitFn&& split)
+    {
+        const auto hash = std::hash<std::string> {}(str);
+        auto& shard = m_shards[hash % SHARDS];
+        if (auto entry = shard.find(str))
+        {
+            return entry;
+        }
+
+        // Split outside the lock, another thread may intern the same string meanwhile
+        return shard.insert(makeEntry(str, split(str), hash));
+    }
+
+    /**
+     * @brief Get the entry of a string already split, without splitting it again.
+     *
+     * @param str String to intern
+     * @param parts Parts of the string
+     * @return Entry Entry of the string
+     */
+    Entry intern(std::string&& str, std::vector<std::string>&& parts)
+    {
+        const auto hash = std::hash<std::string> {}(str);
+        auto& shard = m_shards[hash % SHARDS];
+        if (auto entry = shard.find(str))
+        {
+            return entry;
+        }
+
+        return shard.insert(makeEntry(std::move(str), std::move(parts), hash));
+    }
+
+    /**
+     * @brief Make an entry that is not added to the table, for parts that cannot be rebuilt from their string.
+     *
+     * @param str String of the parts
+     * @param parts Parts
+     * @return Entry Entry only equal to the ones with the same parts
+     */
+    static Entry makeEntry(std::string str, std::vector<std::string> parts)
+    {
+        const auto hash = std::hash<std::string> {}(str);
+        return makeEntry(std::move(str), std::move(parts), hash);
+    }
+
+    /**
+     * @brief Get the number of slots of the table, including the expired ones not purged yet.
+     */
+    std::size_t size() const
+    {
+        std::size_t size {0};
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock {shard.mutex};
+            size += shard.entries.size();
+        }
+        return size;
+    }
+
+private:
+    static Entry makeEntry(std::string str, std::vector<std::string> parts, std::size_t hash)
+    {
+        static std::atomic<std::size_t> nextId {1};
+        return std::make_shared<const InternedParts>(
+            InternedParts {std::move(str), std::move(parts), hash, nextId.fetch_add(1, std::memory_order_relaxed)});
+    }
+
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string, std::weak_ptr<const InternedParts>> entries;
+        std::size_t purgeAt {MIN_PURGE}; ///< Slots at which the expired ones are purged
+
+        Entry find(const std::string& str) const
+        {
+            std::shared_lock lock {mutex};
+            const auto it = entries.find(str);
+            return it != entries.end() ? it->second.lock() : nullptr;
+        }
+
+        Entry insert(Entry entry)
+        {
+            std::unique_lock lock {mutex};
+            auto& slot = entries[entry->str];
+            if (auto current = slot.lock())
+            {
+                return current;
+            }
+            slot = entry;
+
+            if (entries.size() >= purgeAt)
+            {
+                for (auto it = entries.begin(); it != entries.end();)
+                {
+                    it = it->second.expired() ? entries.erase(it) : std::next(it);
+                }
+                purgeAt = std::max(MIN_PURGE, entries.size() * 2);
+            }
+
+            return entry;
+        }
+    };
+
+    std::array<Shard, SHARDS> m_shards;
+};
+
+} // namespace base
+
+#endif // _BASE_INTERN_TABLE_HPP
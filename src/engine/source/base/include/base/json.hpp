@@ -2,13 +2,18 @@
 #define _JSON_H
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <rapidjson/document.h>
@@ -23,9 +28,93 @@
 namespace json
 {
 
+class Arena;
+class JsonConstView;
+class ArrayView;
+class ObjectView;
+
 constexpr bool RECURSIVE {true};
 constexpr bool NOT_RECURSIVE {false};
 
+/**
+ * @brief Precompiled json pointer path.
+ *
+ * Holds the tokenized rapidjson::Pointer of a path so accessing the same field many times (i.e. from a helper at
+ * runtime) does not parse the pointer string on every access. Build it once when the asset is built, using
+ * Json::compileJsonPath or directly from a pointer path.
+ */
+class Path
+{
+private:
+    using Slots = std::unique_ptr<std::atomic<rapidjson::SizeType>[]>;
+
+    std::string m_str;            ///< Pointer path string
+    rapidjson::Pointer m_pointer; ///< Tokenized pointer
+    Slots m_slots;                ///< Position of the member of each token in the last object it was found in
+
+    Slots copySlots() const;
+
+    template<typename ValueType>
+    ValueType* find(ValueType& root) const;
+
+public:
+    /**
+     * @brief Construct a path pointing to the root element.
+     */
+    Path() = default;
+    ~Path() = default;
+
+    Path(const Path& other);
+    Path& operator=(const Path& other);
+    Path(Path&& other) = default;
+    Path& operator=(Path&& other) = default;
+
+    /**
+     * @brief Construct a new Path from a pointer path string.
+     *
+     * @param pointerPath The pointer path, i.e. "/a/b/c".
+     *
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    explicit Path(std::string_view pointerPath);
+
+    /**
+     * @brief Get the pointer path string.
+     *
+     * @return const std::string&
+     */
+    const std::string& str() const { return m_str; }
+
+    /**
+     * @brief Get the tokenized pointer.
+     *
+     * @return const rapidjson::Pointer&
+     */
+    const rapidjson::Pointer& pointer() const { return m_pointer; }
+
+    /**
+     * @brief Check if the path points to the root element.
+     */
+    bool isRoot() const { return m_pointer.GetTokenCount() == 0; }
+
+    /**
+     * @brief Get the value the path points to, as rapidjson::Pointer::Get does.
+     *
+     * The objects are searched by the position of the member in the last object where it was found first, so the
+     * events of the same layout access their fields without scanning the members of each level. The positions are
+     * only hints, always checked against the member name, so the path can be shared by several threads.
+     *
+     * @param root Value where the path is resolved.
+     * @return Pointer to the value, or nullptr if it does not exist.
+     */
+    const rapidjson::Value* get(const rapidjson::Value& root) const;
+
+    /**
+     * @copydoc get
+     */
+    rapidjson::Value* get(rapidjson::Value& root) const;
+};
+
 class Json
 {
 public:
@@ -102,6 +191,14 @@ public:
     }
 
 private:
+    friend class JsonConstView;
+
+    /**
+     * @brief Get the value of a field for writing, creating it if it does not exist.
+     */
+    rapidjson::Value& slot(const Path& path);
+
+    std::shared_ptr<Arena> m_arena; ///< Arena of the document allocations, if any. Must outlive m_document
     rapidjson::Document m_document;
 
     /**
@@ -160,6 +257,14 @@ public:
      */
     explicit Json(rapidjson::Document&& document);
 
+    /**
+     * @brief Construct a new Json empty json object whose allocations are served by an arena.
+     * The arena is kept alive while the document exists.
+     *
+     * @param arena The arena to allocate from, if nullptr the document uses its own allocator.
+     */
+    explicit Json(std::shared_ptr<Arena> arena);
+
     /**
      * @brief Construct a new Json object from a json string
      *
@@ -200,6 +305,17 @@ public:
      */
     static std::string formatJsonPath(std::string_view dotPath, bool skipDot = false);
 
+    /**
+     * @brief Transform dot path string to a precompiled pointer path.
+     *
+     * @param dotPath The dot path string.
+     * @param skipDot If true, dots are not treated as separators.
+     * @return Path The precompiled pointer path.
+     *
+     * @throws std::runtime_error If the resulting pointer path is invalid.
+     */
+    static Path compileJsonPath(std::string_view dotPath, bool skipDot = false);
+
     /************************************************************************************/
     // Runtime functionality, used only by our operations.
     // TODO: Move runtime functionality to separate class.
@@ -413,6 +529,39 @@ public:
      */
     std::optional<std::vector<std::tuple<std::string, Json>>> getObject(std::string_view path = "") const;
 
+    /**
+     * @brief Get a borrowed view of a field, without copying it.
+     *
+     * The view is valid while the Json is alive and not modified.
+     *
+     * @param path The pointer path of the field, default value is root object ("").
+     * @return std::optional<JsonConstView> The view, or nothing if the field does not exist.
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<JsonConstView> getView(std::string_view path = "") const;
+
+    /**
+     * @brief Get a borrowed view of the elements of an array field, without copying them.
+     *
+     * The view is valid while the Json is alive and not modified.
+     *
+     * @param path The pointer path of the array, default value is root object ("").
+     * @return std::optional<ArrayView> The view, or nothing if the field does not exist or is not an array.
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<ArrayView> getArrayView(std::string_view path = "") const;
+
+    /**
+     * @brief Get a borrowed view of the members of an object field, without copying them.
+     *
+     * The view is valid while the Json is alive and not modified.
+     *
+     * @param path The pointer path of the object, default value is root object ("").
+     * @return std::optional<ObjectView> The view, or nothing if the field does not exist or is not an object.
+     * @throws std::runtime_error If the pointer path is invalid.
+     */
+    std::optional<ObjectView> getObjectView(std::string_view path = "") const;
+
     /**
      * @brief Get Json prettyfied string.
      *
@@ -427,6 +576,15 @@ public:
      */
     std::string str() const;
 
+    /**
+     * @brief Append the Json string to a buffer.
+     *
+     * The Json is serialized straight into the buffer, reusing its memory, instead of into a new string.
+     *
+     * @param buffer Buffer to append the Json string to.
+     */
+    void writeTo(std::string& buffer) const;
+
     /**
      * @brief Get Json string from an object.
      *
@@ -831,8 +989,578 @@ public:
     bool eraseIfKey(const std::function<bool(const std::string&)>&, bool recursive = false, const std::string& = "");
 
     static Json makeObjectJson(const std::string& key, const json::Json& value);
+
+    /************************************************************************************/
+    // Precompiled path accessors
+    // Same semantics as the string_view overloads, the path is already validated so
+    // invalid pointer errors cannot happen.
+    /************************************************************************************/
+
+    /**
+     * @copydoc exists(std::string_view) const
+     */
+    bool exists(const Path& path) const;
+
+    /**
+     * @copydoc equals(std::string_view, const Json&) const
+     */
+    bool equals(const Path& path, const Json& value) const;
+
+    /**
+     * @copydoc equals(std::string_view, std::string_view) const
+     */
+    bool equals(const Path& basePath, const Path& referencePath) const;
+
+    /**
+     * @copydoc getString
+     */
+    std::optional<std::string> getString(const Path& path) const;
+
+    /**
+     * @brief Get a view of the string pointed by the path, without copying it.
+     *
+     * The view is valid while the value is not modified or erased.
+     *
+     * @param path The precompiled path to the string.
+     * @return std::optional<std::string_view> The view of the string, empty if the path does not exist or is not a
+     * string.
+     */
+    std::optional<std::string_view> getStringView(const Path& path) const;
+
+    /**
+     * @copydoc getInt
+     */
+    std::optional<int> getInt(const Path& path) const;
+
+    /**
+     * @copydoc getInt64
+     */
+    std::optional<int64_t> getInt64(const Path& path) const;
+
+    /**
+     * @copydoc getIntAsInt64
+     */
+    std::optional<int64_t> getIntAsInt64(const Path& path) const;
+
+    /**
+     * @copydoc getDouble
+     */
+    std::optional<double_t> getDouble(const Path& path) const;
+
+    /**
+     * @copydoc getNumberAsDouble
+     */
+    std::optional<double> getNumberAsDouble(const Path& path) const;
+
+    /**
+     * @copydoc getBool
+     */
+    std::optional<bool> getBool(const Path& path) const;
+
+    /**
+     * @copydoc getArray
+     */
+    std::optional<std::vector<Json>> getArray(const Path& path) const;
+
+    /**
+     * @copydoc getView
+     */
+    std::optional<JsonConstView> getView(const Path& path) const;
+
+    /**
+     * @copydoc getArrayView
+     */
+    std::optional<ArrayView> getArrayView(const Path& path) const;
+
+    /**
+     * @copydoc getObjectView
+     */
+    std::optional<ObjectView> getObjectView(const Path& path) const;
+
+    /**
+     * @copydoc getJson
+     */
+    std::optional<Json> getJson(const Path& path) const;
+
+    /**
+     * @copydoc str(std::string_view) const
+     */
+    std::optional<std::string> str(const Path& path) const;
+
+    /**
+     * @copydoc size
+     */
+    size_t size(const Path& path) const;
+
+    /**
+     * @copydoc isNull
+     */
+    bool isNull(const Path& path) const;
+
+    /**
+     * @copydoc isBool
+     */
+    bool isBool(const Path& path) const;
+
+    /**
+     * @copydoc isNumber
+     */
+    bool isNumber(const Path& path) const;
+
+    /**
+     * @copydoc isInt
+     */
+    bool isInt(const Path& path) const;
+
+    /**
+     * @copydoc isInt64
+     */
+    bool isInt64(const Path& path) const;
+
+    /**
+     * @copydoc isDouble
+     */
+    bool isDouble(const Path& path) const;
+
+    /**
+     * @copydoc isString
+     */
+    bool isString(const Path& path) const;
+
+    /**
+     * @copydoc isArray
+     */
+    bool isArray(const Path& path) const;
+
+    /**
+     * @copydoc isObject
+     */
+    bool isObject(const Path& path) const;
+
+    /**
+     * @copydoc isEmpty
+     */
+    bool isEmpty(const Path& path) const;
+
+    /**
+     * @copydoc type
+     */
+    Type type(const Path& path) const;
+
+    /**
+     * @copydoc set(std::string_view, const Json&)
+     */
+    void set(const Path& path, const Json& value);
+
+    /**
+     * @copydoc set(std::string_view, std::string_view)
+     */
+    void set(const Path& basePath, const Path& referencePath);
+
+    /**
+     * @copydoc setNull
+     */
+    void setNull(const Path& path);
+
+    /**
+     * @copydoc setBool
+     */
+    void setBool(bool value, const Path& path);
+
+    /**
+     * @copydoc setInt
+     */
+    void setInt(int value, const Path& path);
+
+    /**
+     * @copydoc setInt64
+     */
+    void setInt64(int64_t value, const Path& path);
+
+    /**
+     * @copydoc setDouble
+     */
+    void setDouble(double_t value, const Path& path);
+
+    /**
+     * @copydoc setString
+     */
+    void setString(std::string_view value, const Path& path);
+
+    /**
+     * @copydoc setArray
+     */
+    void setArray(const Path& path);
+
+    /**
+     * @copydoc setObject
+     */
+    void setObject(const Path& path);
+
+    /**
+     * @copydoc appendString
+     */
+    void appendString(std::string_view value, const Path& path);
+
+    /**
+     * @copydoc appendJson
+     */
+    void appendJson(const Json& value, const Path& path);
+
+    /**
+     * @copydoc erase
+     */
+    bool erase(const Path& path);
 };
 
+/**
+ * @brief Borrowed read only view of a value of a Json.
+ *
+ * It points to the value inside the document, so it is only valid while the Json that holds it is alive and not
+ * modified. Used by the helpers to read the arrays and objects of the events without copying their elements.
+ */
+class JsonConstView
+{
+private:
+    const rapidjson::Value* m_value; ///< Viewed value, never null
+
+public:
+    /**
+     * @brief Construct a view of a rapidjson value.
+     *
+     * @param value The viewed value, it must outlive the view.
+     */
+    explicit JsonConstView(const rapidjson::Value& value)
+        : m_value(&value)
+    {
+    }
+
+    /**
+     * @brief Construct a view of the root of a Json.
+     *
+     * @param json The viewed Json, it must outlive the view.
+     */
+    explicit JsonConstView(const Json& json)
+        : m_value(&json.m_document)
+    {
+    }
+
+    const rapidjson::Value& value() const { return *m_value; } ///< Get the viewed value
+
+    Json::Type type() const { return Json::rapidTypeToJsonType(m_value->GetType()); } ///< Get the type of the value
+    bool isNull() const { return m_value->IsNull(); }                               ///< Check if the value is null
+    bool isBool() const { return m_value->IsBool(); }                               ///< Check if the value is a bool
+    bool isNumber() const { return m_value->IsNumber(); }       ///< Check if the value is a number
+    bool isInt64() const { return m_value->IsInt64(); }         ///< Check if the value is an int64
+    bool isDouble() const { return m_value->IsDouble(); }       ///< Check if the value is a double
+    bool isString() const { return m_value->IsString(); }       ///< Check if the value is a string
+    bool isArray() const { return m_value->IsArray(); }         ///< Check if the value is an array
+    bool isObject() const { return m_value->IsObject(); }       ///< Check if the value is an object
+
+    /**
+     * @brief Get the string value, without copying it.
+     *
+     * @return std::optional<std::string_view> The string, or nothing if the value is not a string.
+     */
+    std::optional<std::string_view> getStringView() const
+    {
+        if (!m_value->IsString())
+        {
+            return std::nullopt;
+        }
+        return std::string_view {m_value->GetString(), m_value->GetStringLength()};
+    }
+
+    /**
+     * @brief Get a copy of the string value.
+     *
+     * @return std::optional<std::string> The string, or nothing if the value is not a string.
+     */
+    std::optional<std::string> getString() const
+    {
+        auto str = getStringView();
+        return str ? std::optional<std::string> {std::string {str.value()}} : std::nullopt;
+    }
+
+    /**
+     * @brief Get the integer value as int64.
+     *
+     * @return std::optional<int64_t> The integer, or nothing if the value is not an integer.
+     */
+    std::optional<int64_t> getIntAsInt64() const
+    {
+        if (m_value->IsInt64())
+        {
+            return m_value->GetInt64();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get the number value as double.
+     *
+     * @return std::optional<double> The number, or nothing if the value is not a number.
+     */
+    std::optional<double> getNumberAsDouble() const
+    {
+        if (m_value->IsNumber())
+        {
+            return m_value->GetDouble();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get the bool value.
+     *
+     * @return std::optional<bool> The bool, or nothing if the value is not a bool.
+     */
+    std::optional<bool> getBool() const
+    {
+        if (m_value->IsBool())
+        {
+            return m_value->GetBool();
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Get a view of the elements, if the value is an array.
+     */
+    std::optional<ArrayView> getArray() const;
+
+    /**
+     * @brief Get a view of the members, if the value is an object.
+     */
+    std::optional<ObjectView> getObject() const;
+
+    /**
+     * @brief Get the Json string of the value.
+     */
+    std::string str() const;
+
+    /**
+     * @brief Get an owning copy of the value.
+     */
+    Json copy() const;
+
+    friend bool operator==(const JsonConstView& lhs, const JsonConstView& rhs) { return *lhs.m_value == *rhs.m_value; }
+    friend bool operator!=(const JsonConstView& lhs, const JsonConstView& rhs) { return !(lhs == rhs); }
+    friend bool operator==(const JsonConstView& lhs, const Json& rhs) { return lhs == JsonConstView {rhs}; }
+    friend bool operator!=(const JsonConstView& lhs, const Json& rhs) { return !(lhs == rhs); }
+    friend bool operator==(const Json& lhs, const JsonConstView& rhs) { return rhs == lhs; }
+    friend bool operator!=(const Json& lhs, const JsonConstView& rhs) { return !(rhs == lhs); }
+};
+
+/**
+ * @brief Borrowed view of the elements of a Json array, iterated in place as JsonConstView.
+ *
+ * It has the same lifetime rules as JsonConstView.
+ */
+class ArrayView
+{
+private:
+    rapidjson::Value::ConstArray m_array; ///< Viewed array
+
+public:
+    /**
+     * @brief Iterator over the elements of the array
+     */
+    class Iterator
+    {
+    private:
+        rapidjson::Value::ConstValueIterator m_it; ///< Current element
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = JsonConstView;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = JsonConstView;
+
+        explicit Iterator(rapidjson::Value::ConstValueIterator it)
+            : m_it(it)
+        {
+        }
+
+        JsonConstView operator*() const { return JsonConstView {*m_it}; }
+        Iterator& operator++()
+        {
+            ++m_it;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            auto prev = *this;
+            ++m_it;
+            return prev;
+        }
+        bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+    };
+
+    /**
+     * @brief Construct a view of a rapidjson array.
+     *
+     * @param array The viewed array, it must outlive the view.
+     */
+    explicit ArrayView(rapidjson::Value::ConstArray array)
+        : m_array(array)
+    {
+    }
+
+    Iterator begin() const { return Iterator {m_array.Begin()}; } ///< First element
+    Iterator end() const { return Iterator {m_array.End()}; }     ///< Past the last element
+    std::size_t size() const { return m_array.Size(); }            ///< Number of elements
+    bool empty() const { return m_array.Empty(); }                 ///< Check if the array has no elements
+
+    /**
+     * @brief Get a view of an element, the index must be lower than size().
+     */
+    JsonConstView operator[](std::size_t index) const
+    {
+        return JsonConstView {m_array[static_cast<rapidjson::SizeType>(index)]};
+    }
+
+    /**
+     * @brief Check if an element is equal to the value.
+     */
+    template<typename T>
+    bool contains(const T& value) const
+    {
+        return std::find(begin(), end(), value) != end();
+    }
+};
+
+/**
+ * @brief Borrowed view of the members of a Json object, iterated in place as key and JsonConstView pairs.
+ *
+ * It has the same lifetime rules as JsonConstView.
+ */
+class ObjectView
+{
+private:
+    rapidjson::Value::ConstObject m_object; ///< Viewed object
+
+public:
+    /**
+     * @brief Iterator over the members of the object
+     */
+    class Iterator
+    {
+    private:
+        rapidjson::Value::ConstMemberIterator m_it; ///< Current member
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, JsonConstView>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        explicit Iterator(rapidjson::Value::ConstMemberIterator it)
+            : m_it(it)
+        {
+        }
+
+        value_type operator*() const
+        {
+            return {std::string_view {m_it->name.GetString(), m_it->name.GetStringLength()},
+                    JsonConstView {m_it->value}};
+        }
+        Iterator& operator++()
+        {
+            ++m_it;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            auto prev = *this;
+            ++m_it;
+            return prev;
+        }
+        bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+        bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+    };
+
+    /**
+     * @brief Construct a view of a rapidjson object.
+     *
+     * @param object The viewed object, it must outlive the view.
+     */
+    explicit ObjectView(rapidjson::Value::ConstObject object)
+        : m_object(object)
+    {
+    }
+
+    Iterator begin() const { return Iterator {m_object.MemberBegin()}; } ///< First member
+    Iterator end() const { return Iterator {m_object.MemberEnd()}; }     ///< Past the last member
+    std::size_t size() const { return m_object.MemberCount(); }          ///< Number of members
+    bool empty() const { return m_object.ObjectEmpty(); }                ///< Check if the object has no members
+};
+
+/**
+ * @brief Set of borrowed values, to append the elements of an array only once without comparing each new value
+ * against all the elements.
+ *
+ * The values are compared one by one while the set is small, and indexed by a hash consistent with the equality of
+ * rapidjson once it grows. It has the same lifetime rules as JsonConstView, the inserted values must outlive the set.
+ */
+class ValueSet
+{
+private:
+    static constexpr std::size_t LINEAR_LIMIT = 16; ///< Size up to which the values are not hashed
+
+    std::vector<const rapidjson::Value*> m_values;                          ///< Values of the set
+    std::unordered_multimap<std::size_t, const rapidjson::Value*> m_index; ///< Values by hash, once past the limit
+
+    bool containsLinear(const rapidjson::Value& value) const;
+    bool containsIndexed(const rapidjson::Value& value, std::size_t hash) const;
+
+public:
+    /**
+     * @brief Hash of a value, equal for the values that rapidjson compares equal.
+     *
+     * @param value The value to hash.
+     * @return std::size_t The hash.
+     */
+    static std::size_t hash(const rapidjson::Value& value);
+
+    /**
+     * @brief Check if the set has a value equal to the given one.
+     */
+    bool contains(const JsonConstView& value) const;
+
+    /**
+     * @brief Insert a value if the set does not have an equal one.
+     *
+     * @param value The value to insert, it must outlive the set.
+     * @return true if the value was inserted, false if there was an equal one.
+     */
+    bool insert(const JsonConstView& value);
+
+    std::size_t size() const { return m_values.size(); } ///< Number of values
+    bool empty() const { return m_values.empty(); }      ///< Check if the set has no values
+};
+
+inline std::optional<ArrayView> JsonConstView::getArray() const
+{
+    if (!m_value->IsArray())
+    {
+        return std::nullopt;
+    }
+    return ArrayView {m_value->GetArray()};
+}
+
+inline std::optional<ObjectView> JsonConstView::getObject() const
+{
+    if (!m_value->IsObject())
+    {
+        return std::nullopt;
+    }
+    return ObjectView {m_value->GetObject()};
+}
+
 } // namespace json
 
 #endif // _JSON_H
@@ -0,0 +1,141 @@
+#ifndef _JSON_ARENA_H
+#define _JSON_ARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <rapidjson/allocators.h>
+
+namespace json
+{
+
+/**
+ * @brief Reusable memory arena for the allocations of a Json document.
+ *
+ * Wraps a rapidjson::MemoryPoolAllocator whose first chunk is a buffer owned by the arena, so a document that fits
+ * in the buffer does not allocate at all. The Json documents built on an arena keep it alive, the arena can only be
+ * reset once no document references it (see ArenaPool).
+ */
+class Arena
+{
+public:
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE {16 * 1024}; ///< Default size of the preallocated chunk
+
+private:
+    std::unique_ptr<char[]> m_buffer; ///< First chunk of the allocator, reused between documents
+    rapidjson::MemoryPoolAllocator<> m_allocator;
+
+public:
+    /**
+     * @brief Construct a new Arena object
+     *
+     * @param bufferSize Size of the preallocated chunk, the allocator grows with regular chunks beyond it.
+     */
+    explicit Arena(std::size_t bufferSize = DEFAULT_BUFFER_SIZE)
+        : m_buffer {std::make_unique<char[]>(bufferSize)}
+        , m_allocator {m_buffer.get(), bufferSize}
+    {
+    }
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Get the allocator of the arena.
+     *
+     * @return rapidjson::MemoryPoolAllocator<>&
+     */
+    rapidjson::MemoryPoolAllocator<>& allocator() { return m_allocator; }
+
+    /**
+     * @brief Release the extra chunks and rewind the preallocated one.
+     *
+     * The caller must ensure no document is using the arena.
+     */
+    void reset() { m_allocator.Clear(); }
+};
+
+/**
+ * @brief Bounded pool of reusable arenas, owned by a single thread.
+ *
+ * Arenas are handed out in round robin order. An arena is recycled once every document built on it has been
+ * destroyed: events are released roughly in the order they were created, so the next arena of the ring is the one
+ * most likely to be free. When it is still in use and the pool is full, no arena is returned and the document falls
+ * back to its own allocator.
+ *
+ * Documents may be destroyed on any thread, but acquire must always be called from the same thread.
+ */
+class ArenaPool
+{
+public:
+    static constexpr std::size_t DEFAULT_MAX_ARENAS {256}; ///< Default maximum number of arenas of the pool
+
+private:
+    std::vector<std::shared_ptr<Arena>> m_arenas; ///< Ring of arenas, m_next is the oldest one handed out
+    std::size_t m_next;
+    std::size_t m_maxArenas;
+    std::size_t m_bufferSize;
+
+public:
+    /**
+     * @brief Construct a new Arena Pool object
+     *
+     * @param maxArenas Maximum number of arenas of the pool.
+     * @param bufferSize Size of the preallocated chunk of each arena.
+     * @throw std::runtime_error if maxArenas or bufferSize is 0.
+     */
+    explicit ArenaPool(std::size_t maxArenas = DEFAULT_MAX_ARENAS, std::size_t bufferSize = Arena::DEFAULT_BUFFER_SIZE)
+        : m_next {0}
+        , m_maxArenas {maxArenas}
+        , m_bufferSize {bufferSize}
+    {
+        if (m_maxArenas == 0 || m_bufferSize == 0)
+        {
+            throw std::runtime_error("The arena pool size and the arena buffer size must be greater than 0");
+        }
+        m_arenas.reserve(m_maxArenas);
+    }
+
+    /**
+     * @brief Get a free arena of the pool, reset and ready to be used.
+     *
+     * @return std::shared_ptr<Arena> The arena, or nullptr if all arenas are in use and the pool is full.
+     */
+    std::shared_ptr<Arena> acquire()
+    {
+        if (!m_arenas.empty() && m_arenas[m_next].use_count() == 1)
+        {
+            // Synchronizes with the release of the last document, which may have happened on another thread
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto arena = m_arenas[m_next];
+            arena->reset();
+            m_next = (m_next + 1) % m_arenas.size();
+            return arena;
+        }
+
+        if (m_arenas.size() < m_maxArenas)
+        {
+            // The new arena is placed as the newest one of the ring
+            auto arena = std::make_shared<Arena>(m_bufferSize);
+            m_arenas.insert(m_arenas.begin() + m_next, arena);
+            m_next = (m_next + 1) % m_arenas.size();
+            return arena;
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief Get the number of arenas created by the pool.
+     *
+     * @return std::size_t
+     */
+    std::size_t size() const { return m_arenas.size(); }
+};
+
+} // namespace json
+
+#endif // _JSON_ARENA_H
@@ -1,6 +1,9 @@
 #ifndef _H_LOGGING
 #define _H_LOGGING
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <iostream>
 #include <map>
 
@@ -62,6 +65,11 @@ constexpr auto DEFAULT_LOG_THREADS_QUEUE_SIZE {8192};
  */
 constexpr auto DEFAULT_LOG_FLUSH_INTERVAL {1};
 
+/**
+ * @brief Default number of messages per second of each rate limited log call.
+ */
+constexpr auto DEFAULT_LOG_RATE_LIMIT {10};
+
 /**
  * @brief Enum class defining logging levels.
  *
@@ -163,10 +171,57 @@ struct LoggingConfig
 {
     std::string filePath {STD_OUT_PATH};                       ///< Path to the log file.
     Level level {Level::Info};                                 ///< Log level.
-    const uint32_t flushInterval {DEFAULT_LOG_FLUSH_INTERVAL}; ///< Flush interval in milliseconds.
-    const uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};     ///< Number of dedicated threads.
-    const uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE}; ///< Size of the log queue for dedicated threads.
+    uint32_t flushInterval {DEFAULT_LOG_FLUSH_INTERVAL};       ///< Flush interval in milliseconds.
+    uint32_t dedicatedThreads {DEFAULT_LOG_THREADS};           ///< Number of dedicated threads.
+    uint32_t queueSize {DEFAULT_LOG_THREADS_QUEUE_SIZE};       ///< Size of the log queue for dedicated threads.
     bool truncate {false}; ///< If true, the log file will be deleted for each start of the engine.
+    bool dropOnFullQueue {true}; ///< With dedicated threads, overwrite the oldest queued message instead of blocking
+};
+
+/**
+ * @brief Rate limit of a log call, used by the LOG_*_LIMITED macros.
+ *
+ * Allows a number of messages per second and counts the ones dropped, so a flood of a hot path message (i.e. one per
+ * event) does not throttle the thread that logs it.
+ */
+class RateLimit
+{
+private:
+    std::atomic<int64_t> m_window {0};      ///< Second of the current window
+    std::atomic<uint32_t> m_count {0};      ///< Messages allowed in the current window
+    std::atomic<uint64_t> m_suppressed {0}; ///< Messages dropped since the last allowed one
+
+public:
+    /**
+     * @brief Check if a message can be logged.
+     *
+     * @param perSecond Messages allowed per second
+     * @return true if the message can be logged, false if it is dropped
+     */
+    bool allow(uint32_t perSecond)
+    {
+        const auto now =
+            std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        auto window = m_window.load(std::memory_order_relaxed);
+        if (now != window && m_window.compare_exchange_strong(window, now, std::memory_order_relaxed))
+        {
+            m_count.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_count.fetch_add(1, std::memory_order_relaxed) < perSecond)
+        {
+            return true;
+        }
+
+        m_suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Get and reset the number of messages dropped since the last call.
+     */
+    uint64_t takeSuppressed() { return m_suppressed.exchange(0, std::memory_order_relaxed); }
 };
 
 /**
@@ -199,23 +254,42 @@ void testInit();
 
 } // namespace logging
 
-#define LOG_TRACE(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::trace, msg, ##__VA_ARGS__)
-#define LOG_DEBUG(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::debug, msg, ##__VA_ARGS__)
-#define LOG_INFO(msg, ...)                                                                                             \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::info, msg, ##__VA_ARGS__)
-#define LOG_WARNING(msg, ...)                                                                                          \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::warn, msg, ##__VA_ARGS__)
-#define LOG_ERROR(msg, ...)                                                                                            \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::err, msg, ##__VA_ARGS__)
-#define LOG_CRITICAL(msg, ...)                                                                                         \
-    logging::getDefaultLogger()->log(                                                                                  \
-        spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, spdlog::level::critical, msg, ##__VA_ARGS__)
+// The arguments are only evaluated if the level is enabled
+#define LOG_AT(level, msg, ...)                                                                                        \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if (auto logger_ = logging::getDefaultLogger(); logger_->should_log(level))                                    \
+        {                                                                                                              \
+            logger_->log(spdlog::source_loc {__FILE__, __LINE__, SPDLOG_FUNCTION}, level, msg, ##__VA_ARGS__);         \
+        }                                                                                                              \
+    } while (false)
+
+// Rate limited per call site to DEFAULT_LOG_RATE_LIMIT messages per second, for the messages of the hot paths. The
+// number of dropped messages is logged with the next allowed one.
+#define LOG_AT_LIMITED(level, msg, ...)                                                                                \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        static logging::RateLimit rateLimit_;                                                                          \
+        if (auto logger_ = logging::getDefaultLogger();                                                                \
+            logger_->should_log(level) && rateLimit_.allow(logging::DEFAULT_LOG_RATE_LIMIT))                           \
+        {                                                                                                              \
+            const spdlog::source_loc location_ {__FILE__, __LINE__, SPDLOG_FUNCTION};                                  \
+            if (const auto suppressed_ = rateLimit_.takeSuppressed(); suppressed_ > 0)                                 \
+            {                                                                                                          \
+                logger_->log(location_, level, "{} similar messages suppressed", suppressed_);                        \
+            }                                                                                                          \
+            logger_->log(location_, level, msg, ##__VA_ARGS__);                                                        \
+        }                                                                                                              \
+    } while (false)
+
+#define LOG_TRACE(msg, ...)    LOG_AT(spdlog::level::trace, msg, ##__VA_ARGS__)
+#define LOG_DEBUG(msg, ...)    LOG_AT(spdlog::level::debug, msg, ##__VA_ARGS__)
+#define LOG_INFO(msg, ...)     LOG_AT(spdlog::level::info, msg, ##__VA_ARGS__)
+#define LOG_WARNING(msg, ...)  LOG_AT(spdlog::level::warn, msg, ##__VA_ARGS__)
+#define LOG_ERROR(msg, ...)    LOG_AT(spdlog::level::err, msg, ##__VA_ARGS__)
+#define LOG_CRITICAL(msg, ...) LOG_AT(spdlog::level::critical, msg, ##__VA_ARGS__)
+
+#define LOG_WARNING_LIMITED(msg, ...) LOG_AT_LIMITED(spdlog::level::warn, msg, ##__VA_ARGS__)
+#define LOG_ERROR_LIMITED(msg, ...)   LOG_AT_LIMITED(spdlog::level::err, msg, ##__VA_ARGS__)
 
 #endif // _H_LOGGING
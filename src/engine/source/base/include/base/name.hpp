@@ -1,6 +1,7 @@
 #ifndef _BASE_NAME_HPP
 #define _BASE_NAME_HPP
 
+#include <algorithm>
 #include <initializer_list>
 #include <iostream>
 #include <numeric>
@@ -10,6 +11,7 @@
 #include <fmt/core.h>
 #include <fmt/format.h>
 
+#include "internTable.hpp"
 #include "utils/stringUtils.hpp"
 
 namespace base
@@ -35,10 +37,23 @@ public:
     constexpr static auto MAX_PARTS = 10;
 
 private:
-    std::vector<std::string> m_parts;
+    InternTable::Entry m_entry; ///< Interned string and parts, null for the empty name
 
-    void assertSize(size_t size) const
+    static InternTable& table()
     {
+        static InternTable table;
+        return table;
+    }
+
+    static const std::vector<std::string>& emptyParts()
+    {
+        static const std::vector<std::string> empty;
+        return empty;
+    }
+
+    static void assertParts(const std::vector<std::string>& parts)
+    {
+        const auto size = parts.size();
         if (0 == size)
         {
             throw std::runtime_error(fmt::format("Name cannot be empty"));
@@ -48,7 +63,7 @@ private:
             throw std::runtime_error(fmt::format(
                 "Name size must have {} parts at most at most, but the one inserted has {}", MAX_PARTS, size));
         }
-        for (const auto& part : m_parts)
+        for (const auto& part : parts)
         {
             if (part.empty())
             {
@@ -57,8 +72,24 @@ private:
         }
     }
 
-    void copy(const Name& other) { m_parts = other.m_parts; }
-    void copyMove(Name&& other) noexcept { m_parts = std::move(other.m_parts); }
+    /**
+     * @brief Intern the parts, only the ones that can be split back from their string share the table.
+     */
+    static InternTable::Entry internParts(std::vector<std::string>&& parts)
+    {
+        assertParts(parts);
+        auto fullName = base::utils::string::join(parts, SEPARATOR_S);
+        const auto splittable = std::none_of(parts.cbegin(),
+                                             parts.cend(),
+                                             [](const std::string& part)
+                                             { return part.find(SEPARATOR_C) != std::string::npos; });
+        if (!splittable)
+        {
+            return InternTable::makeEntry(std::move(fullName), std::move(parts));
+        }
+
+        return table().intern(std::move(fullName), std::move(parts));
+    }
 
 public:
     Name() = default;
@@ -71,9 +102,8 @@ public:
      * @param parts Parts of the name
      */
     Name(const std::vector<std::string>& parts)
+        : m_entry(internParts(std::vector<std::string>(parts)))
     {
-        assertSize(parts.size());
-        m_parts = parts;
     }
 
     /**
@@ -83,21 +113,27 @@ public:
      * @param parts Parts of the name
      */
     Name(std::vector<std::string>&& parts)
+        : m_entry(internParts(std::move(parts)))
     {
-        m_parts = std::move(parts);
-        assertSize(m_parts.size());
     }
 
     /**
      * @brief Construct a new Name object
      *
+     * The string is only split the first time a name is built from it, while any name of the same string is alive.
+     *
      * @param fullName Name string in the form <part>SEPARATOR<part>...
      * @throw std::runtime_error if the string does not have the correct format
      */
     Name(const std::string& fullName)
+        : m_entry(table().intern(fullName,
+                                 [](const std::string& str)
+                                 {
+                                     auto parts = base::utils::string::split(str, SEPARATOR_C);
+                                     assertParts(parts);
+                                     return parts;
+                                 }))
     {
-        m_parts = base::utils::string::split(fullName, SEPARATOR_C);
-        assertSize(m_parts.size());
     }
 
     /**
@@ -117,14 +153,14 @@ public:
      *
      * @param other Name to copy
      */
-    Name(const Name& other) { copy(other); }
+    Name(const Name& other) = default;
 
     /**
      * @brief Construct a new Name object
      *
      * @param other Name to move
      */
-    Name(Name&& other) noexcept { copyMove(std::move(other)); }
+    Name(Name&& other) noexcept = default;
 
     /**
      * @brief Copy assignment operator
@@ -132,15 +168,7 @@ public:
      * @param other Name to copy
      * @return Name& self
      */
-    Name& operator=(const Name& other)
-    {
-        if (this != &other)
-        {
-            copy(other);
-        }
-
-        return *this;
-    }
+    Name& operator=(const Name& other) = default;
 
     /**
      * @brief Move assignment operator
@@ -148,21 +176,29 @@ public:
      * @param other Name to move
      * @return Name& self
      */
-    Name& operator=(Name&& other) noexcept
-    {
-        copyMove(std::move(other));
-
-        return *this;
-    }
+    Name& operator=(Name&& other) noexcept = default;
 
     /**
      * @brief Equality comparison operator
      *
+     * The names of the same string share their parts, so they are compared by identity first.
+     *
      * @param other Name to compare
      * @return true
      * @return false
      */
-    friend bool operator==(const Name& rh, const Name& lh) { return rh.m_parts == lh.m_parts; }
+    friend bool operator==(const Name& rh, const Name& lh)
+    {
+        if (rh.m_entry == lh.m_entry)
+        {
+            return true;
+        }
+        if (!rh.m_entry || !lh.m_entry || rh.m_entry->hash != lh.m_entry->hash)
+        {
+            return false;
+        }
+        return rh.m_entry->parts == lh.m_entry->parts;
+    }
 
     /**
      * @brief Inequality comparison operator
@@ -178,13 +214,17 @@ public:
      *
      * @return std::string
      */
-    std::string toStr() const
+    std::string toStr() const { return str(); }
+
+    /**
+     * @brief Get the full name string, without copying it
+     *
+     * @return const std::string&
+     */
+    const std::string& str() const
     {
-        return std::accumulate(m_parts.cbegin() + 1,
-                               m_parts.cend(),
-                               m_parts.front(),
-                               [](const std::string& a, const std::string& b) -> std::string
-                               { return a + SEPARATOR_S + b; });
+        static const std::string empty;
+        return m_entry ? m_entry->str : empty;
     }
 
     /**
@@ -219,7 +259,7 @@ public:
         auto parts = lhs.parts();
         parts.insert(parts.end(), rhs.parts().begin(), rhs.parts().end());
 
-        return Name(parts);
+        return Name(std::move(parts));
     }
 
     /**
@@ -235,7 +275,13 @@ public:
      */
     bool operator<(const Name& other) const
     {
-        return std::lexicographical_compare(m_parts.begin(), m_parts.end(), other.m_parts.begin(), other.m_parts.end());
+        if (m_entry == other.m_entry)
+        {
+            return false;
+        }
+        const auto& lhs = parts();
+        const auto& rhs = other.parts();
+        return std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
     }
 
     /**
@@ -251,7 +297,23 @@ public:
      *
      * @return const std::vector<std::string>&
      */
-    const std::vector<std::string>& parts() const { return m_parts; }
+    const std::vector<std::string>& parts() const { return m_entry ? m_entry->parts : emptyParts(); }
+
+    /**
+     * @brief Get the hash of the name, computed once per interned string
+     *
+     * @return size_t
+     */
+    size_t hash() const { return m_entry ? m_entry->hash : 0; }
+
+    /**
+     * @brief Get the id of the interned string, 0 for the empty name
+     *
+     * Names with the same id are equal. Equal names built from parts with separators may have different ids.
+     *
+     * @return size_t
+     */
+    size_t id() const { return m_entry ? m_entry->id : 0; }
 };
 
 } // namespace base
@@ -262,16 +324,7 @@ namespace std
 template<>
 struct hash<base::Name>
 {
-    size_t operator()(const base::Name& name) const
-    {
-        std::hash<std::string> hasher;
-        size_t hashValue = 0;
-        for (const auto& part : name.parts())
-        {
-            hashValue ^= hasher(part);
-        }
-        return hashValue;
-    }
+    size_t operator()(const base::Name& name) const { return name.hash(); }
 };
 } // namespace std
 
@@ -283,7 +336,7 @@ struct fmt::formatter<base::Name> : formatter<std::string>
     template<typename FormatContext>
     auto format(const base::Name& name, FormatContext& ctx)
     {
-        return formatter<std::string>::format(name.toStr(), ctx);
+        return formatter<std::string>::format(name.str(), ctx);
     }
 };
 
@@ -2,7 +2,9 @@
 #ifndef _PARSE_EVENT_H
 #define _PARSE_EVENT_H
 
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 #include <base/baseTypes.hpp>
 
@@ -15,10 +17,39 @@ constexpr char EVENT_MESSAGE_ID[] {"/event/original"};
 /**
  * @brief Parse an Wazuh message and extract the queue, location and message
  *
- * @param event Wazuh message
+ * The location and the message are copied directly from the raw message into the event document, without
+ * intermediate strings (except when the location has escaped colons).
+ *
+ * @param event Wazuh message, it does not need to be null terminated
  * @return Event Event object
+ * @throw std::runtime_error if the message format is invalid
+ */
+Event parseWazuhEvent(std::string_view event);
+
+/**
+ * @brief Get the source of a location: the agent ID of the agent locations ("[001] (name) any->/path"), the whole
+ * location of the others
+ *
+ * @param location Location of an event
+ * @return std::string_view Source of the location, a view of it
+ */
+std::string_view locationSource(std::string_view location);
+
+/**
+ * @brief Hash of the source of an event, the same for all the events of an agent or of a local location
+ *
+ * @param event Event parsed by parseWazuhEvent
+ * @return std::size_t Hash of the source, 0 if the event has no location
+ */
+std::size_t sourceHash(const Event& event);
+
+/**
+ * @brief Wazuh queue id of an event, the character before the location
+ *
+ * @param event Event parsed by parseWazuhEvent
+ * @return char The queue id, 0 if the event has none
  */
-Event parseWazuhEvent(const std::string& event);
+char queueId(const Event& event);
 
 } // namespace base::parseEvent
 
@@ -1,7 +1,9 @@
 #ifndef _RESULT_H
 #define _RESULT_H
 
+#include <atomic>
 #include <string>
+#include <utility>
 
 namespace base::result
 {
@@ -29,68 +31,18 @@ public:
      * @param success Status of the event.
      */
     Result(Event payload, std::string trace, bool success)
-        : m_payload {payload}
-        , m_trace {trace}
+        : m_payload {std::move(payload)}
+        , m_trace {std::move(trace)}
         , m_success {success}
     {
     }
 
-    /**
-     * @brief Copy constructs a new Result object.
-     *
-     * @param other The Result to copy.
-     */
-    Result(const Result& other)
-        : m_payload {other.m_payload}
-        , m_trace {other.m_trace}
-        , m_success {other.m_success}
-    {
-    }
-
-    /**
-     * @brief Move copy constructor.
-     *
-     * @param other The Result to copy.
-     */
-    Result(Result&& other)
-        : m_payload {std::move(other.m_payload)}
-        , m_trace {other.m_trace}
-        , m_success {other.m_success}
-    {
-    }
-
-    /**
-     * @brief Destroy the Result object
-     */
+    // The moves do not copy the trace, nor the reference count of the payload
+    Result(const Result& other) = default;
+    Result(Result&& other) = default;
     ~Result() = default;
-
-    /**
-     * @brief Copy assignment operator.
-     *
-     * @param other The Result to copy.
-     * @return Result& The new Result object.
-     */
-    Result& operator=(const Result& other)
-    {
-        m_payload = other.m_payload;
-        m_trace = other.m_trace;
-        m_success = other.m_success;
-        return *this;
-    }
-
-    /**
-     * @brief Move copy assignment operator.
-     *
-     * @param other The Result to move.
-     * @return Result& The new Result object.
-     */
-    Result& operator=(Result&& other)
-    {
-        m_payload = std::move(other.m_payload);
-        m_trace = other.m_trace;
-        m_success = other.m_success;
-        return *this;
-    }
+    Result& operator=(const Result& other) = default;
+    Result& operator=(Result&& other) = default;
 
     /**
      * @brief Check if the result is a success.
@@ -126,16 +78,16 @@ public:
     /**
      * @brief Returns the event trace.
      *
-     * @return std::string the event trace.
+     * @return const std::string& the event trace.
      */
-    std::string trace() const { return m_trace; }
+    const std::string& trace() const { return m_trace; }
 
     /**
-     * @brief Returns the event trace.
+     * @brief Moves the event trace out of the result.
      *
      * @return std::string the event trace.
      */
-    std::string popTrace() const { return std::move(m_trace); }
+    std::string popTrace() { return std::move(m_trace); }
 
     /**
      * @brief Get the payload object.
@@ -156,7 +108,7 @@ public:
      *
      * @param trace the trace object.
      */
-    void setTrace(std::string trace) { m_trace = trace; }
+    void setTrace(std::string trace) { m_trace = std::move(trace); }
 
     /**
      * @brief Set the payload object.
@@ -177,9 +129,9 @@ public:
  * @return Result<Event> Result of the event with all the complete information.
  */
 template<typename Event>
-Result<Event> makeSuccess(Event payload, std::string trace = "")
+Result<Event> makeSuccess(Event payload, std::string trace = {})
 {
-    return Result<Event> {payload, trace, true};
+    return Result<Event> {std::move(payload), std::move(trace), true};
 }
 
 /**
@@ -193,9 +145,33 @@ Result<Event> makeSuccess(Event payload, std::string trace = "")
  * @return Result<Event> Result of the event with all the complete information.
  */
 template<typename Event>
-Result<Event> makeFailure(Event payload, std::string trace = "")
+Result<Event> makeFailure(Event payload, std::string trace = {})
+{
+    return Result<Event> {std::move(payload), std::move(trace), false};
+}
+
+/**
+ * @brief Count of the trace subscriptions of the running environments.
+ *
+ * The helpers only write their traces while there is a subscription, so the production environments return their
+ * results without copying a trace. The subscriptions are counted by the tracers of the backends.
+ *
+ * @return std::atomic<std::size_t>& The process wide count.
+ */
+inline std::atomic<std::size_t>& traceSubscriptions()
+{
+    static std::atomic<std::size_t> count {0};
+    return count;
+}
+
+/**
+ * @brief Check if any trace subscription exists, see traceSubscriptions.
+ *
+ * @return true if the traces are read by a subscriber.
+ */
+inline bool tracing()
 {
-    return Result<Event> {payload, trace, false};
+    return traceSubscriptions().load(std::memory_order_relaxed) > 0;
 }
 
 } // namespace base::result
@@ -0,0 +1,342 @@
+#ifndef _BASE_SHARDED_CACHE_HPP
+#define _BASE_SHARDED_CACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace base
+{
+
+/**
+ * @brief Thread-safe cache with approximate LRU eviction.
+ *
+ * The entries are spread over shards by the hash of their key, each one with its own lock, so accesses to different
+ * shards don't contend. Lookups only take a shared lock: instead of reordering a recency list, they flag the entry as
+ * referenced, and the eviction follows the CLOCK algorithm, which skips and unflags the referenced entries. The cache
+ * is bounded by a number of entries and, optionally, by the bytes of its entries.
+ *
+ * @tparam KeyType The type of the keys used for caching.
+ * @tparam ValueType The type of the values associated with the keys.
+ * @tparam Hash Hash function of the keys.
+ */
+template<typename KeyType, typename ValueType, typename Hash = std::hash<KeyType>>
+class ShardedCache final
+{
+public:
+    /**
+     * @brief Size, in bytes, of an entry.
+     */
+    using SizeFunction = std::function<size_t(const KeyType&, const ValueType&)>;
+
+    // Maximum number of shards, and minimum number of entries a shard is sized for.
+    static constexpr size_t MAX_SHARDS {16};
+    static constexpr size_t MIN_SHARD_CAPACITY {64};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param capacity Maximum number of entries.
+     * @param maxBytes Maximum bytes of the entries, as given by sizeOf. Zero means no limit.
+     * @param sizeOf Size of an entry. By default, the size of its key and value types.
+     * @param shards Number of shards. By default, one per MIN_SHARD_CAPACITY entries, up to MAX_SHARDS.
+     */
+    explicit ShardedCache(const size_t capacity,
+                          const size_t maxBytes = 0,
+                          SizeFunction sizeOf = {},
+                          const size_t shards = 0)
+        : m_capacity {capacity}
+        , m_maxBytes {maxBytes}
+        , m_sizeOf {sizeOf ? std::move(sizeOf)
+                           : [](const KeyType&, const ValueType&) { return sizeof(KeyType) + sizeof(ValueType); }}
+    {
+        if (capacity == 0)
+        {
+            throw std::invalid_argument("Cache capacity must be greater than 0");
+        }
+
+        const auto shardCount {
+            std::clamp<size_t>(shards ? shards : capacity / MIN_SHARD_CAPACITY, 1, std::min(capacity, MAX_SHARDS))};
+
+        // The capacity and the bytes are split evenly, so the shards add up to the cache limits.
+        m_shards.reserve(shardCount);
+        for (size_t i = 0; i < shardCount; ++i)
+        {
+            auto shard {std::make_unique<Shard>()};
+            shard->capacity = capacity / shardCount + (i < capacity % shardCount ? 1 : 0);
+            shard->maxBytes = maxBytes / shardCount + (i < maxBytes % shardCount ? 1 : 0);
+            m_shards.push_back(std::move(shard));
+        }
+    }
+
+    /**
+     * @brief Inserts a key-value pair into the cache, or replaces the value of the key.
+     *
+     * If the shard of the key is full, the entries not referenced since the last pass are evicted until the new one
+     * fits. An entry larger than the bytes of a shard is not cached.
+     *
+     * @param key The key to be inserted.
+     * @param value The value associated with the key.
+     */
+    void insertKey(const KeyType& key, const ValueType& value)
+    {
+        const auto bytes {m_sizeOf(key, value)};
+        auto& shard {shardOf(key)};
+        std::unique_lock lock(shard.mutex);
+
+        if (m_maxBytes != 0 && bytes > shard.maxBytes)
+        {
+            shard.erase(key);
+            return;
+        }
+
+        if (const auto it = shard.index.find(key); it != shard.index.end())
+        {
+            auto& entry {*shard.slots[it->second]};
+            shard.bytes = shard.bytes - entry.bytes + bytes;
+            entry.value = value;
+            entry.bytes = bytes;
+            entry.referenced.store(true, std::memory_order_relaxed);
+        }
+        else
+        {
+            // New entries start unreferenced, so they are the first evicted if they are never read.
+            shard.add(key, value, bytes);
+        }
+
+        while (shard.index.size() > shard.capacity || (m_maxBytes != 0 && shard.bytes > shard.maxBytes))
+        {
+            shard.evict(key);
+        }
+    }
+
+    /**
+     * @brief Retrieves the value associated with a key, and flags the entry as referenced.
+     *
+     * @param key The key for which to retrieve the value.
+     * @return The value associated with the key, if found.
+     */
+    std::optional<ValueType> getValue(const KeyType& key) const
+    {
+        const auto& shard {shardOf(key)};
+        std::shared_lock lock(shard.mutex);
+        if (const auto it = shard.index.find(key); it != shard.index.end())
+        {
+            const auto& entry {*shard.slots[it->second]};
+            entry.referenced.store(true, std::memory_order_relaxed);
+            return entry.value;
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Checks if the cache holds as many entries as its capacity.
+     *
+     * @return true if the cache is full, false otherwise.
+     */
+    bool isFull() const { return size() >= m_capacity; }
+
+    /**
+     * @brief Checks if a key exists in the cache, without flagging it as referenced.
+     *
+     * @param key The key to be checked.
+     * @return true if the key exists in the cache, false otherwise.
+     */
+    bool isHit(const KeyType& key) const
+    {
+        const auto& shard {shardOf(key)};
+        std::shared_lock lock(shard.mutex);
+        return shard.index.find(key) != shard.index.end();
+    }
+
+    /**
+     * @brief Number of entries in the cache.
+     *
+     * @return size_t Number of entries.
+     */
+    size_t size() const
+    {
+        size_t entries {0};
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock(shard->mutex);
+            entries += shard->index.size();
+        }
+        return entries;
+    }
+
+    /**
+     * @brief Bytes of the entries in the cache, as given by the size function.
+     *
+     * @return size_t Bytes.
+     */
+    size_t bytes() const
+    {
+        size_t total {0};
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock(shard->mutex);
+            total += shard->bytes;
+        }
+        return total;
+    }
+
+    /**
+     * @brief Iterates over the cache data and applies a function to each key-value pair, in no particular order.
+     *
+     * The iteration stops if the handler function returns false. The handler must not access the cache.
+     *
+     * @tparam Handler The type of the handler function. It should be callable with (const KeyType&, const ValueType&).
+     * @param handler The function to be applied to each key-value pair.
+     */
+    template<typename Handler>
+    void forEach(Handler&& handler) const
+    {
+        for (const auto& shard : m_shards)
+        {
+            std::shared_lock lock(shard->mutex);
+            for (const auto& entry : shard->slots)
+            {
+                if (entry && !handler(entry->key, entry->value))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Clears the cache by removing all key-value pairs.
+     */
+    void clear() noexcept
+    {
+        for (auto& shard : m_shards)
+        {
+            std::unique_lock lock(shard->mutex);
+            shard->index.clear();
+            shard->slots.clear();
+            shard->freeSlots.clear();
+            shard->hand = 0;
+            shard->bytes = 0;
+        }
+    }
+
+private:
+    /**
+     * @brief Cached entry.
+     */
+    struct Entry final
+    {
+        KeyType key;                                  ///< Entry key.
+        ValueType value;                              ///< Entry value.
+        size_t bytes;                                 ///< Entry size.
+        mutable std::atomic<bool> referenced {false}; ///< Read since the last eviction pass.
+
+        Entry(const KeyType& entryKey, const ValueType& entryValue, const size_t entryBytes)
+            : key {entryKey}
+            , value {entryValue}
+            , bytes {entryBytes}
+        {
+        }
+    };
+
+    /**
+     * @brief Independent part of the cache.
+     */
+    struct Shard final
+    {
+        mutable std::shared_mutex mutex;                 ///< Shared for lookups, exclusive for writes.
+        std::unordered_map<KeyType, size_t, Hash> index; ///< Slot of each key.
+        std::vector<std::unique_ptr<Entry>> slots;       ///< Entries, in the order swept by the clock hand.
+        std::vector<size_t> freeSlots;                   ///< Slots of the evicted entries, reused first.
+        size_t hand {0};                                 ///< Next slot considered for eviction.
+        size_t capacity {0};                             ///< Maximum number of entries.
+        size_t maxBytes {0};                             ///< Maximum bytes of the entries.
+        size_t bytes {0};                                ///< Bytes of the entries.
+
+        void add(const KeyType& key, const ValueType& value, const size_t entryBytes)
+        {
+            auto entry {std::make_unique<Entry>(key, value, entryBytes)};
+            size_t slot;
+            if (freeSlots.empty())
+            {
+                slot = slots.size();
+                slots.push_back(std::move(entry));
+            }
+            else
+            {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+                slots[slot] = std::move(entry);
+            }
+            index.emplace(key, slot);
+            bytes += entryBytes;
+        }
+
+        void erase(const KeyType& key)
+        {
+            if (const auto it = index.find(key); it != index.end())
+            {
+                release(it->second);
+            }
+        }
+
+        void release(const size_t slot)
+        {
+            bytes -= slots[slot]->bytes;
+            index.erase(slots[slot]->key);
+            slots[slot].reset();
+            freeSlots.push_back(slot);
+        }
+
+        /**
+         * @brief Evicts the first unreferenced entry from the clock hand, unflagging the referenced ones on the way.
+         *
+         * @param keep Entry just inserted, evicted only if it is the last one.
+         */
+        void evict(const KeyType& keep)
+        {
+            // Two passes at most: the first one may only unflag the entries.
+            for (size_t step = 0; step < 2 * slots.size(); ++step)
+            {
+                const auto slot {hand};
+                hand = (hand + 1) % slots.size();
+
+                auto& entry {slots[slot]};
+                if (!entry || (entry->key == keep && index.size() > 1))
+                {
+                    continue;
+                }
+                if (entry->referenced.exchange(false, std::memory_order_relaxed))
+                {
+                    continue;
+                }
+
+                release(slot);
+                return;
+            }
+
+            // Every other entry is kept, the one just inserted doesn't fit.
+            erase(keep);
+        }
+    };
+
+    Shard& shardOf(const KeyType& key) const { return *m_shards[Hash {}(key) % m_shards.size()]; }
+
+    size_t m_capacity;                            ///< Maximum number of entries.
+    size_t m_maxBytes;                            ///< Maximum bytes of the entries, zero means no limit.
+    SizeFunction m_sizeOf;                        ///< Size of an entry.
+    std::vector<std::unique_ptr<Shard>> m_shards; ///< Shards, selected by the hash of the keys.
+};
+
+} // namespace base
+
+#endif // _BASE_SHARDED_CACHE_HPP
@@ -0,0 +1,80 @@
+#ifndef _BASE_UTILS_COARSE_CLOCK_HPP
+#define _BASE_UTILS_COARSE_CLOCK_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+
+namespace base::utils::time
+{
+
+constexpr std::size_t ISO8601_SECONDS_SIZE = 19; ///< Size of "YYYY-MM-DDTHH:MM:SS"
+constexpr std::size_t ISO8601_SIZE = 24;         ///< Size of "YYYY-MM-DDTHH:MM:SS.mmmZ"
+
+/**
+ * @brief Writes the UTC date of an epoch as "YYYY-MM-DDTHH:MM:SS", without the zone designator.
+ *
+ * @param seconds Seconds since epoch.
+ * @param out Buffer of at least ISO8601_SECONDS_SIZE characters, not null terminated.
+ * @return true if written, false if the year does not fit in four digits.
+ */
+bool formatISO8601Seconds(int64_t seconds, char* out);
+
+/**
+ * @brief Process-wide wall clock with millisecond resolution.
+ *
+ * A background thread stores the current epoch in an atomic every millisecond, so the helpers read the time of the
+ * events without a syscall. The ISO 8601 string is cached per thread and only the milliseconds are rewritten until
+ * the second changes. The precise time is still available for the callers that need it.
+ *
+ * @note thread-safe.
+ */
+class CoarseClock final
+{
+public:
+    static constexpr std::chrono::milliseconds RESOLUTION {1}; ///< Update period of the clock
+
+    /**
+     * @brief Gets the clock, started on first use.
+     */
+    static CoarseClock& instance();
+
+    CoarseClock(const CoarseClock&) = delete;
+    CoarseClock& operator=(const CoarseClock&) = delete;
+    ~CoarseClock();
+
+    /**
+     * @brief Milliseconds since epoch, as of the last update.
+     */
+    int64_t epochMs() const { return m_epochMs.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Seconds since epoch, as of the last update.
+     */
+    int64_t epochSeconds() const;
+
+    /**
+     * @brief UTC date of the last update as "YYYY-MM-DDTHH:MM:SS.mmmZ".
+     *
+     * @return std::string_view Thread local buffer, valid until the next call from the same thread.
+     */
+    std::string_view iso8601() const;
+
+    /**
+     * @brief Milliseconds since epoch read from the system clock, for the callers that need the precise time.
+     */
+    static int64_t preciseEpochMs();
+
+private:
+    CoarseClock();
+
+    std::atomic<int64_t> m_epochMs;  ///< Milliseconds since epoch of the last update
+    std::atomic<bool> m_running;     ///< Cleared to stop the updater
+    std::thread m_updater;           ///< Thread that updates the clock
+};
+
+} // namespace base::utils::time
+
+#endif // _BASE_UTILS_COARSE_CLOCK_HPP
@@ -0,0 +1,76 @@
+#ifndef _CPU_AFFINITY_H
+#define _CPU_AFFINITY_H
+
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <sched.h>
+
+#include <base/error.hpp>
+
+/**
+ * @brief Pins threads to CPUs and NUMA nodes.
+ *
+ * The NUMA topology is read from sysfs, without libnuma. Memory follows the threads: with the default local policy, the
+ * kernel places the pages on the node of the CPU that first touches them, so the memory built by a pinned thread stays
+ * on its node.
+ */
+namespace utils::affinity
+{
+
+using CpuSet = std::vector<int>; ///< Sorted CPUs, without duplicates
+
+/**
+ * @brief Parse a CPU set, a comma separated list of CPUs ("3"), ranges ("0-7") and NUMA nodes ("node1", all of its
+ * CPUs)
+ *
+ * @param spec CPU set to parse, empty for no CPUs
+ * @return CpuSet CPUs of the set
+ * @throws std::invalid_argument if the set is not valid or a node does not exist
+ */
+CpuSet parseCpuSet(std::string_view spec);
+
+/**
+ * @brief Get the CPUs of a NUMA node
+ *
+ * @param node NUMA node
+ * @return CpuSet CPUs of the node
+ * @throws std::invalid_argument if the node does not exist
+ */
+CpuSet nodeCpus(int node);
+
+/**
+ * @brief Pin the calling thread to the CPUs, the threads it creates afterwards inherit them
+ *
+ * @param cpus CPUs to run on, empty to leave the thread as it is
+ * @return base::OptError if the thread cannot be pinned
+ */
+base::OptError pinThread(const CpuSet& cpus);
+
+/**
+ * @brief Pin the calling thread while in scope, restoring its previous CPUs on destruction
+ *
+ * Used to build memory on the node of the threads that will use it.
+ */
+class ScopedPin
+{
+private:
+    std::optional<cpu_set_t> m_previous; ///< CPUs of the thread before pinning it, if it was pinned
+
+public:
+    /**
+     * @brief Pin the calling thread, failures are ignored and leave it as it is
+     *
+     * @param cpus CPUs to run on, empty to leave the thread as it is
+     */
+    explicit ScopedPin(const CpuSet& cpus);
+    ~ScopedPin();
+
+    ScopedPin(const ScopedPin&) = delete;
+    ScopedPin& operator=(const ScopedPin&) = delete;
+};
+
+} // namespace utils::affinity
+
+#endif // _CPU_AFFINITY_H
@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <cstdint>
+#include <string_view>
 
 namespace utils::ip
 {
@@ -33,6 +34,26 @@ uint32_t IPv4MaskUInt(const std::string& mask);
  */
 // uint128_t IPv6ToUInt(const std::string ip);
 
+/**
+ * @brief Parse an IPv4 address in dotted decimal notation, as inet_pton(AF_INET) does, but straight from the view
+ *
+ * @param ip String to be parsed (format x.x.x.x)
+ * @param address Where the 4 bytes of the address are written, in network byte order. Unchanged if not valid
+ * @return true if the string is a valid IPv4 address
+ * @return false if the string is not a valid IPv4 address
+ */
+bool parseIPv4(std::string_view ip, uint8_t* address);
+
+/**
+ * @brief Parse an IPv6 address, as inet_pton(AF_INET6) does, but straight from the view
+ *
+ * @param ip String to be parsed, may end with an IPv4 address
+ * @param address Where the 16 bytes of the address are written, in network byte order. Unchanged if not valid
+ * @return true if the string is a valid IPv6 address
+ * @return false if the string is not a valid IPv6 address
+ */
+bool parseIPv6(std::string_view ip, uint8_t* address);
+
 /**
  * @brief Check if a string is a valid IPv4 address
  *
@@ -40,7 +61,7 @@ uint32_t IPv4MaskUInt(const std::string& mask);
  * @return true if the string is a valid IPv4 address
  * @return false if the string is not a valid IPv4 address
  */
-bool checkStrIsIPv4(const std::string& ip);
+bool checkStrIsIPv4(std::string_view ip);
 
 /**
  * @brief Check if a string is a valid IPv6 address
@@ -49,7 +70,7 @@ bool checkStrIsIPv4(const std::string& ip);
  * @return true if the string is a valid IPv6 address
  * @return false if the string is not a valid IPv6 address
  */
-bool checkStrIsIPv6(const std::string& ip);
+bool checkStrIsIPv6(std::string_view ip);
 
 /**
  * @brief Check if a IPv4 is a special address
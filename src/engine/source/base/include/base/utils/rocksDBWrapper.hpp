@@ -23,6 +23,7 @@
 #include <rocksdb/table.h>
 #include <rocksdb/utilities/transaction.h>
 #include <rocksdb/utilities/transaction_db.h>
+#include <rocksdb/utilities/write_batch_with_index.h>
 #include <stdexcept>
 #include <string>
 #include <utility>
@@ -31,6 +32,7 @@
 namespace utils::rocksdb
 {
 class RocksDBTransaction;
+class RocksDBWriteBatch;
 class IRocksDBWrapper
 {
 public:
@@ -65,16 +67,25 @@ public:
      *
      * @param dbPath Path to the RocksDB database.
      * @param enableWal Whether to enable WAL or not.
+     * @param tuning Block cache, compression and cache priority of the columns.
+     *
+     * @note The block cache and the write buffer budget are the process-wide ones, see RocksDBResources.
      */
-    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+    explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true, const RocksDBTuning& tuning = {})
         : m_enableWal {enableWal}
         , m_path {std::move(dbPath)}
+        , m_compression {tuning.compression}
+        , m_priority {tuning.priority}
     {
-        m_readCache = ::rocksdb::NewLRUCache(16 * 1024 * 1024);
-        m_writeManager = std::make_shared<::rocksdb::WriteBufferManager>(128 * 1024 * 1024);
+        auto& resources = RocksDBResources::instance();
+        m_readCache =
+            tuning.blockCacheSize > 0 ? ::rocksdb::NewLRUCache(tuning.blockCacheSize) : resources.blockCache();
+        m_writeManager = resources.writeBufferManager();
 
-        ::rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-        ::rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+        ::rocksdb::Options options =
+            RocksDBOptions::buildDBOptions(m_writeManager, m_readCache, m_compression, m_priority);
+        ::rocksdb::ColumnFamilyOptions columnFamilyOptions =
+            RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_compression, m_priority);
 
         T* dbRawPtr;
         std::vector<::rocksdb::ColumnFamilyDescriptor> columnsDescriptors;
@@ -139,6 +150,8 @@ public:
         {
             m_columnsInstances.emplace_back(m_db, handle);
         }
+
+        m_consumer = resources.registerConsumer(tuning.consumer.empty() ? m_path : tuning.consumer, m_db.get());
     }
 
     /**
@@ -248,6 +261,55 @@ public:
 
     bool get(const std::string& key, ::rocksdb::PinnableSlice& value) override { return get(key, value, ""); }
 
+    /**
+     * @brief Get several values from the database in a single lookup.
+     *
+     * @param keys Keys to get.
+     * @param values Values of the keys, in the same order (::rocksdb::PinnableSlice).
+     * @param columnName Column name from where to get. If empty, the default column will be used.
+     *
+     * @return std::vector<bool> Whether each key was found, in the same order.
+     */
+    std::vector<bool> multiGet(const std::vector<std::string>& keys,
+                               std::vector<::rocksdb::PinnableSlice>& values,
+                               const std::string& columnName = "")
+    {
+        std::vector<::rocksdb::Slice> slices;
+        slices.reserve(keys.size());
+        for (const auto& key : keys)
+        {
+            if (key.empty())
+            {
+                throw std::invalid_argument("Key is empty");
+            }
+            slices.emplace_back(key);
+        }
+
+        values.clear();
+        values.resize(keys.size());
+        std::vector<::rocksdb::Status> statuses(keys.size());
+        m_db->MultiGet(::rocksdb::ReadOptions(),
+                       getColumnFamilyBasedOnName(columnName).handle(),
+                       keys.size(),
+                       slices.data(),
+                       values.data(),
+                       statuses.data());
+
+        std::vector<bool> found(keys.size(), false);
+        for (size_t i = 0; i < statuses.size(); ++i)
+        {
+            if (statuses[i].ok())
+            {
+                found[i] = true;
+            }
+            else if (!statuses[i].IsNotFound())
+            {
+                throw std::runtime_error("Error getting data: " + statuses[i].ToString());
+            }
+        }
+        return found;
+    }
+
     /**
      * @brief Delete a key-value pair from the database.
      *
@@ -409,7 +471,9 @@ public:
         ::rocksdb::ColumnFamilyHandle* pColumnFamily;
 
         if (const auto status {m_db->CreateColumnFamily(
-                RocksDBOptions::buildColumnFamilyOptions(m_readCache), columnName, &pColumnFamily)};
+                RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_compression, m_priority),
+                    columnName,
+                    &pColumnFamily)};
             !status.ok())
         {
             throw std::runtime_error {"Couldn't create column family: " + std::string {status.getState()}};
@@ -634,8 +698,11 @@ private:
     std::vector<ColumnFamilyRAII> m_columnsInstances;              ///< List of column family.
     const bool m_enableWal;                                        ///< Whether to enable WAL or not.
     const std::string m_path;                                      ///< Location of the DB.
+    const CompressionProfile m_compression;                        ///< Compression of the columns.
+    const CachePriority m_priority;                                ///< Cache priority of the indexes and filters.
     std::shared_ptr<::rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
     std::shared_ptr<::rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
+    RocksDBResources::Consumer m_consumer;                         ///< Registration in the usage report.
 
     /**
      * @brief Returns the column family handle identified by its name.
@@ -682,6 +749,7 @@ private:
     }
 
     friend class RocksDBTransaction;
+    friend class RocksDBWriteBatch;
 };
 
 /**
@@ -881,6 +949,212 @@ private:
         m_txn;                ///< RocksDB transaction.
     bool m_committed {false}; ///< Whether the transaction has been committed or not.
 };
+/**
+ * @brief Wrapper class for RocksDB write batches.
+ *
+ * The writes are staged in memory and applied at once, atomically, on commit. Reads and seeks see the staged writes
+ * on top of the database, while other readers of the database keep seeing the previous data until the commit.
+ */
+class RocksDBWriteBatch final : public IRocksDBWrapper
+{
+public:
+    /**
+     * @brief Constructor.
+     *
+     * @param dbWrapper RocksDB instance.
+     */
+    explicit RocksDBWriteBatch(TRocksDBWrapper<>* dbWrapper)
+        : m_dbWrapper {dbWrapper}
+        , m_batch {::rocksdb::BytewiseComparator(), 0, true}
+    {
+        if (!m_dbWrapper)
+        {
+            throw std::runtime_error {"RocksDB instance is null"};
+        }
+    }
+
+    /**
+     * @brief Put a key-value pair in the batch.
+     * @param key Key to put.
+     * @param value Value to put.
+     * @param columnName Column name where the put will be performed. If empty, the default column will be used.
+     *
+     * @note If the key already exists, the value will be overwritten.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value, const std::string& columnName) override
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        const auto status {m_batch.Put(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key, value)};
+        if (!status.ok())
+        {
+            throw std::runtime_error {"Failed to put key: " + std::string {status.getState()}};
+        }
+    }
+
+    /**
+     * @brief Put a key-value pair in the batch.
+     * @param key Key to put.
+     * @param value Value to put.
+     *
+     * @note If the key already exists, the value will be overwritten.
+     */
+    void put(const std::string& key, const ::rocksdb::Slice& value) override { put(key, value, ""); }
+
+    /**
+     * @brief Delete a key-value pair in the batch.
+     *
+     * @param key Key to delete.
+     * @param columnName Column name from where to delete. If empty, the default column will be used.
+     */
+    void delete_(const std::string& key, const std::string& columnName) override // NOLINT
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        const auto status {m_batch.Delete(m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(), key)};
+        if (!status.ok())
+        {
+            throw std::runtime_error {"Failed to delete key: " + std::string {status.getState()}};
+        }
+    }
+
+    /**
+     * @brief Delete a key-value pair in the batch.
+     *
+     * @param key Key to delete.
+     */
+    void delete_(const std::string& key) override { delete_(key, ""); } // NOLINT
+
+    /**
+     * @brief Get a value from the batch, or from the database if the batch doesn't write it.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     * @param columnName Column name from where to get. If empty, the default column will be used.
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value, const std::string& columnName) override
+    {
+        if (key.empty())
+        {
+            throw std::invalid_argument("Key is empty");
+        }
+
+        if (const auto status = m_batch.GetFromBatchAndDB(m_dbWrapper->m_db.get(),
+                                                          ::rocksdb::ReadOptions(),
+                                                          m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle(),
+                                                          key,
+                                                          &value);
+            status.IsNotFound())
+        {
+            return false;
+        }
+        else if (!status.ok())
+        {
+            throw std::runtime_error("Error getting data: " + status.ToString());
+        }
+        return true;
+    }
+
+    /**
+     * @brief Get a value from the batch, or from the database if the batch doesn't write it.
+     *
+     * @param key Key to get.
+     * @param value Value to get (::rocksdb::PinnableSlice).
+     *
+     * @return bool True if the operation was successful.
+     * @return bool False if the key was not found.
+     */
+    bool get(const std::string& key, ::rocksdb::PinnableSlice& value) override { return get(key, value, ""); }
+
+    /**
+     * @brief Applies the staged writes to the database and clears the batch.
+     */
+    void commit() override
+    {
+        ::rocksdb::WriteOptions writeOptions;
+        writeOptions.disableWAL = !m_dbWrapper->m_enableWal;
+
+        if (const auto status {m_dbWrapper->m_db->Write(writeOptions, m_batch.GetWriteBatch())}; !status.ok())
+        {
+            throw std::runtime_error {"Failed to write batch: " + std::string {status.getState()}};
+        }
+
+        m_batch.Clear();
+    }
+
+    /**
+     * @brief Amount of writes staged in the batch.
+     *
+     * @return size_t Staged writes.
+     */
+    size_t size() { return m_batch.GetWriteBatch()->Count(); }
+
+    /**
+     * @brief Delete all key-value pairs from the database.
+     */
+    void deleteAll() override { m_dbWrapper->deleteAll(); }
+
+    /**
+     * @brief Creates a new column family in the database.
+     *
+     * @note The column handle created is also added to the handles list to be then accessible by other methods.
+     *
+     * @param columnName Name of the new column.
+     */
+    void createColumn(const std::string& columnName) override { m_dbWrapper->createColumn(columnName); }
+
+    /**
+     * @brief Checks whether a column exists in the database or not.
+     *
+     * @param columnName Name of the column.
+     * @return true If the column exists.
+     * @return false If the column doesn't exists.
+     */
+    bool columnExists(const std::string& columnName) const override { return m_dbWrapper->columnExists(columnName); }
+
+    /**
+     * @brief Retrieves all the column families from the DB.
+     *
+     * @return std::vector<std::string> Vector of strings with all the column names.
+     */
+    std::vector<std::string> getAllColumns() override { return m_dbWrapper->getAllColumns(); }
+
+    /**
+     * @brief Seek to specific key, iterating over the batch on top of the database.
+     *
+     * @param key Key to seek.
+     * @param columnName Column family name.
+     * @return RocksDBIterator Iterator to the batch and the database.
+     */
+    RocksDBIterator seek(std::string_view key, const std::string& columnName = "") override // NOLINT
+    {
+        auto* handle = m_dbWrapper->getColumnFamilyBasedOnName(columnName).handle();
+        auto* baseIterator = m_dbWrapper->m_db->NewIterator(::rocksdb::ReadOptions(), handle);
+        return {std::shared_ptr<::rocksdb::Iterator>(m_batch.NewIteratorWithBase(handle, baseIterator)), key};
+    }
+
+    /**
+     * @brief Flushes the batch.
+     */
+    [[noreturn]] void flush() override
+    {
+        // The batch is only written on commit.
+        throw std::runtime_error("Not implemented");
+    }
+
+private:
+    TRocksDBWrapper<>* m_dbWrapper;         ///< RocksDB instance.
+    ::rocksdb::WriteBatchWithIndex m_batch; ///< Staged writes, indexed to be read back before the commit.
+};
 using RocksDBWrapper = TRocksDBWrapper<>;
 } // namespace utils::rocksdb
 
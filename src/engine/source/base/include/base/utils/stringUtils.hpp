@@ -2,6 +2,8 @@
 #define _STRING_UTILS_H
 
 #include <algorithm>
+#include <cstddef>
+#include <iterator>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -18,6 +20,123 @@ namespace base::utils::string
  */
 std::vector<std::string> split(std::string_view str, const char delimiter);
 
+/**
+ * @brief Lazy range over the parts of a string split by a delimiter, each part is a view of the string.
+ *
+ * The parts are the same as the ones of split(): a leading delimiter is skipped and the empty part after a trailing
+ * one is not returned. The delimiter is searched with std::string_view::find, which uses the vectorized memchr of the
+ * C library. Nothing is allocated, the string must outlive the range.
+ */
+class SplitView
+{
+public:
+    class Iterator
+    {
+    private:
+        std::string_view m_rest; ///< Part of the string after the current part
+        std::string_view m_part; ///< Current part
+        char m_delimiter {'\0'};
+        bool m_last {true}; ///< The current part is the last one
+        bool m_end {true};  ///< Iterator past the last part
+
+        void next()
+        {
+            if (m_last)
+            {
+                m_end = true;
+                return;
+            }
+
+            const auto pos = m_rest.find(m_delimiter);
+            if (pos == std::string_view::npos)
+            {
+                m_part = m_rest;
+                m_last = true;
+                m_end = m_rest.empty();
+                return;
+            }
+            m_part = m_rest.substr(0, pos);
+            m_rest.remove_prefix(pos + 1);
+        }
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        Iterator() = default;
+
+        Iterator(std::string_view str, char delimiter)
+            : m_rest(str)
+            , m_delimiter(delimiter)
+            , m_last(false)
+            , m_end(false)
+        {
+            if (!m_rest.empty() && m_rest.front() == m_delimiter)
+            {
+                m_rest.remove_prefix(1);
+            }
+            next();
+        }
+
+        reference operator*() const { return m_part; }
+        pointer operator->() const { return &m_part; }
+
+        Iterator& operator++()
+        {
+            next();
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            auto copy = *this;
+            next();
+            return copy;
+        }
+
+        // Only the end of the range is compared
+        bool operator==(const Iterator& other) const { return m_end && other.m_end; }
+        bool operator!=(const Iterator& other) const { return !(*this == other); }
+    };
+
+    SplitView(std::string_view str, char delimiter)
+        : m_str(str)
+        , m_delimiter(delimiter)
+    {
+    }
+
+    Iterator begin() const { return {m_str, m_delimiter}; }
+    Iterator end() const { return {}; }
+
+    /**
+     * @brief Get the first part, empty if there is none.
+     */
+    std::string_view front() const
+    {
+        const auto it = begin();
+        return it != end() ? *it : std::string_view {};
+    }
+
+private:
+    std::string_view m_str;
+    char m_delimiter;
+};
+
+/**
+ * @brief Split a string into views of its parts, lazily and without allocating.
+ *
+ * @param str String to be split, it must outlive the range
+ * @param delimiter Delimiter to split the string
+ * @return SplitView Range of the parts, the same as the ones of split()
+ */
+inline SplitView splitView(std::string_view str, const char delimiter)
+{
+    return {str, delimiter};
+}
+
 /**
  * @brief Concatenates all the strings of a vector, separated by `separator`.
  *
@@ -132,6 +251,20 @@ std::string toUpperCase(std::string_view str);
 
 std::string toLowerCase(std::string_view str);
 
+/**
+ * @brief Convert a string to uppercase in place, without allocating a copy.
+ *
+ * @param str String to convert
+ */
+void toUpperCaseInPlace(std::string& str);
+
+/**
+ * @brief Convert a string to lowercase in place, without allocating a copy.
+ *
+ * @param str String to convert
+ */
+void toLowerCaseInPlace(std::string& str);
+
 bool replaceFirst(std::string& data, const std::string& toSearch, const std::string& toReplace);
 
 std::string leftTrim(const std::string& str, const std::string& args = " ");
@@ -144,8 +277,30 @@ std::string toSentenceCase(const std::string& str);
 
 bool isNumber(const std::string& str);
 
+/**
+ * @brief Replace all the occurrences of a string, in place.
+ *
+ * The occurrences are searched from left to right and the replacements are never searched again. When both strings
+ * have the same size they are overwritten in place, otherwise the result is built in a single pass.
+ *
+ * @param data String to modify
+ * @param toSearch String to search
+ * @param toReplace Replacement
+ * @return true if there was at least one occurrence
+ */
 bool replaceAll(std::string& data, std::string_view toSearch, std::string_view toReplace);
 
+/**
+ * @brief Decode a string of hexa digits, two per byte, into a buffer
+ *
+ * The digits are decoded through a lookup table, without an intermediate string per byte.
+ *
+ * @param hex Hexa digits, an even quantity of them
+ * @param out Buffer of at least hex.size() / 2 bytes
+ * @return std::size_t Position of the first invalid digit, or hex.size() if all of them are valid
+ */
+std::size_t decodeHex(std::string_view hex, char* out);
+
 } // namespace base::utils::string
 
 #endif // _STRING_UTILS_H
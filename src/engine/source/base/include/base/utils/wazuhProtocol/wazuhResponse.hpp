@@ -29,9 +29,22 @@ class WazuhResponse
 private:
     // Mandatory fields for all responses
     int m_error;                          ///< Error code
-    json::Json m_data;                    ///< Data
+    mutable json::Json m_data;            ///< Data, parsed from m_serialized on demand if it is set
     std::optional<std::string> m_message; ///< Optional message
 
+    // Data serialized by the module (e.g. a protobuf message), it is sent as is and only parsed if data() is called
+    std::optional<std::string> m_serialized; ///< Serialized data
+    mutable bool m_parsed {false};           ///< m_data holds the parsed m_serialized
+
+    void parseSerialized() const
+    {
+        if (m_serialized.has_value() && !m_parsed)
+        {
+            m_data = json::Json {m_serialized->c_str()};
+            m_parsed = true;
+        }
+    }
+
 public:
     // TODO Delete explicit when json constructor does not throw exceptions
     /**
@@ -103,7 +116,11 @@ public:
      *
      * @return data object
      */
-    const json::Json& data() const { return m_data; }
+    const json::Json& data() const
+    {
+        parseSerialized();
+        return m_data;
+    }
 
     /**
      * @brief Return error code of the response
@@ -124,7 +141,11 @@ public:
      *
      * @param data object
      */
-    void data(const json::Json& data) { m_data = json::Json { data }; }
+    void data(const json::Json& data)
+    {
+        m_data = json::Json {data};
+        m_serialized.reset();
+    }
 
     /**
      * @brief Set error code of the response, overwriting the previous one
@@ -147,13 +168,16 @@ public:
      */
     std::string toString() const
     {
+        // The serialized data is formatted in place, without a copy
+        const auto dataStr = m_serialized.has_value() ? std::string {} : m_data.str();
+        const std::string_view data = m_serialized.has_value() ? m_serialized.value() : dataStr;
         if (m_message.has_value())
         {
             json::Json jsonMesage;
             jsonMesage.setString(m_message.value(), "");
-            return fmt::format("{{\"data\":{},\"error\":{},\"message\":{}}}", m_data.str(), m_error, jsonMesage.str());
+            return fmt::format("{{\"data\":{},\"error\":{},\"message\":{}}}", data, m_error, jsonMesage.str());
         }
-        return fmt::format("{{\"data\":{},\"error\":{}}}", m_data.str(), m_error);
+        return fmt::format("{{\"data\":{},\"error\":{}}}", data, m_error);
     }
 
     /**
@@ -163,7 +187,7 @@ public:
      * @return true
      * @return false
      */
-    bool isValid() const { return !(!m_data.isObject() && !m_data.isArray()); }
+    bool isValid() const { return !(!data().isObject() && !data().isArray()); }
 
     /**
      * @brief Create a WazuhResponse object from a string
@@ -216,6 +240,24 @@ public:
         return ret;
     }
 
+    /**
+     * @brief Create a response from data already serialized as JSON, it is written to the wire as is.
+     *
+     * The data is only parsed if data() is called, so a large response is not copied into a json::Json document and
+     * serialized again.
+     *
+     * @param serialized Data as a JSON object or array, it is not validated
+     * @param error Error code (0 if no error)
+     * @return WazuhResponse object.
+     */
+    static WazuhResponse fromSerialized(std::string&& serialized, int error = 0)
+    {
+        WazuhResponse response {};
+        response.m_serialized = std::move(serialized);
+        response.m_error = error;
+        return response;
+    }
+
     /************************************************************************
      *                     Predefined responses
      ***********************************************************************/
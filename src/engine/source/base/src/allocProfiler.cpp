@@ -0,0 +1,117 @@
+#include "allocProfiler.hpp"
+#include "arenaAllocator.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+
+namespace base::allocprof
+{
+
+namespace
+{
+// Trivial thread locals, so reading them from operator new never allocates
+thread_local Counters* t_current {nullptr};
+thread_local uint64_t t_allocations {0};
+
+std::mutex g_mutex;
+std::map<std::pair<std::string, std::string>, std::shared_ptr<Counters>> g_counters;
+} // namespace
+
+std::shared_ptr<Counters> counters(const std::string& policy, const std::string& name)
+{
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    auto& retValue = g_counters[{policy, name}];
+    if (!retValue)
+    {
+        retValue = std::make_shared<Counters>();
+        retValue->policy = policy;
+        retValue->name = name;
+    }
+    return retValue;
+}
+
+Counters* exchangeCurrent(Counters* counters) noexcept
+{
+    return std::exchange(t_current, counters);
+}
+
+uint64_t threadAllocations() noexcept
+{
+    return t_allocations;
+}
+
+std::vector<Entry> entries()
+{
+    std::vector<Entry> retValue;
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    retValue.reserve(g_counters.size());
+    for (const auto& [key, counters] : g_counters)
+    {
+        retValue.push_back(Entry {counters->policy,
+                                  counters->name,
+                                  counters->events.load(std::memory_order_relaxed),
+                                  counters->allocations.load(std::memory_order_relaxed),
+                                  counters->bytes.load(std::memory_order_relaxed)});
+    }
+    return retValue;
+}
+
+void reset()
+{
+    const std::lock_guard<std::mutex> lock(g_mutex);
+    for (const auto& [key, counters] : g_counters)
+    {
+        counters->events.store(0, std::memory_order_relaxed);
+        counters->allocations.store(0, std::memory_order_relaxed);
+        counters->bytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace base::allocprof
+
+#ifdef ENGINE_ALLOC_PROFILING
+
+// The hooks live with the context functions, so linking the contexts of the controllers pulls them in
+void* operator new(std::size_t size)
+{
+    ++base::allocprof::t_allocations;
+    if (auto* counters = base::allocprof::t_current)
+    {
+        counters->allocations.fetch_add(1, std::memory_order_relaxed);
+        counters->bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+#ifdef ENGINE_ARENA_ALLOCATOR
+    return base::arena::allocate(size);
+#else
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+#endif
+}
+
+void operator delete(void* ptr) noexcept
+{
+#ifdef ENGINE_ARENA_ALLOCATOR
+    base::arena::deallocate(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+#ifdef ENGINE_ARENA_ALLOCATOR
+    base::arena::deallocate(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+#endif // ENGINE_ALLOC_PROFILING
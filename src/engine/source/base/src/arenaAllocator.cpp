@@ -0,0 +1,504 @@
+#include "arenaAllocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
+namespace base::arena
+{
+
+namespace
+{
+constexpr std::size_t HEADER_SIZE {ALIGNMENT}; ///< Header before each block, keeps the blocks aligned
+constexpr std::size_t MIN_BLOCK_SHIFT {5};     ///< The smallest class has blocks of 32 bytes
+constexpr std::size_t CLASSES {9};             ///< Classes of 32, 64, ..., MAX_BLOCK_SIZE bytes
+constexpr std::size_t SPAN_SIZE {64 * 1024};   ///< Memory taken from the system at once to carve blocks
+constexpr std::size_t TRANSFER_BYTES {32 * 1024}; ///< Bytes moved at once between a cache and its arena
+constexpr uintptr_t LARGE_TAG {1};                ///< Marks the owner of a large block, which holds its subsystem
+
+static_assert(MAX_BLOCK_SIZE == std::size_t {1} << (MIN_BLOCK_SHIFT + CLASSES - 1), "Inconsistent size classes");
+
+/**
+ * @brief Header of a block, the owner cache of the small blocks and the subsystem of the large ones.
+ */
+struct Header
+{
+    uintptr_t owner;  ///< Cache of a small block, or (subsystem << 1) | LARGE_TAG
+    std::size_t size; ///< Bytes of the block, header included
+};
+static_assert(sizeof(Header) == HEADER_SIZE);
+
+/**
+ * @brief Free block, linked through its payload.
+ */
+struct FreeBlock
+{
+    Header header;
+    FreeBlock* next;
+};
+
+constexpr std::size_t blockSize(std::size_t sizeClass)
+{
+    return std::size_t {1} << (MIN_BLOCK_SHIFT + sizeClass);
+}
+
+inline std::size_t classOf(std::size_t bytes)
+{
+    if (bytes <= blockSize(0))
+    {
+        return 0;
+    }
+    const auto bits = static_cast<std::size_t>(std::numeric_limits<unsigned long long>::digits)
+                      - static_cast<std::size_t>(__builtin_clzll(bytes - 1));
+    return bits - MIN_BLOCK_SHIFT;
+}
+
+constexpr std::size_t transferCount(std::size_t sizeClass)
+{
+    return std::clamp(TRANSFER_BYTES / blockSize(sizeClass), std::size_t {4}, std::size_t {64});
+}
+
+/**
+ * @brief Counter only written by the owner thread, read by stats from any thread.
+ */
+inline void add(std::atomic<uint64_t>& counter, uint64_t value)
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Cache of a thread in the arena of a subsystem. It is never freed, exited threads leave it to the arena.
+ */
+struct Cache
+{
+    Subsystem subsystem {Subsystem::DEFAULT};
+    std::array<FreeBlock*, CLASSES> lists {};
+    std::array<std::size_t, CLASSES> counts {};
+    char* cursor {nullptr}; ///< Free part of the span the blocks are carved from
+    char* end {nullptr};
+
+    std::atomic<FreeBlock*> remote {nullptr}; ///< Blocks released by other threads
+
+    std::atomic<uint64_t> allocations {0};
+    std::atomic<uint64_t> deallocations {0};
+    std::atomic<uint64_t> remoteFrees {0};
+    std::atomic<uint64_t> bytesInUse {0};
+
+    Cache* nextRegistered {nullptr}; ///< Caches of the arena, set before the cache is published
+    Cache* nextOrphan {nullptr};     ///< Caches of the exited threads, guarded by the arena mutex
+};
+
+/**
+ * @brief Arena of a subsystem: the blocks its caches released in excess and the caches of the exited threads.
+ *
+ * Constant initialized, so the arenas are ready before any dynamic initialization allocates. Nothing here allocates
+ * with operator new, which may be this allocator.
+ */
+struct Arena
+{
+    std::mutex mutex;
+    std::array<FreeBlock*, CLASSES> lists {};
+    std::array<std::size_t, CLASSES> counts {};
+    Cache* orphans {nullptr};
+
+    std::atomic<Cache*> caches {nullptr}; ///< Every cache of the arena, never removed
+    std::atomic<uint64_t> spanBytes {0};
+    std::atomic<uint64_t> largeAllocations {0};
+    std::atomic<uint64_t> largeDeallocations {0};
+    std::atomic<uint64_t> largeBytes {0};
+};
+
+Arena g_arenas[SUBSYSTEMS];
+static_assert(std::is_trivially_destructible_v<Arena>, "The arenas are used until the last thread exits");
+
+// Trivial thread locals, so reading them from operator new never allocates
+thread_local Subsystem t_subsystem {Subsystem::DEFAULT};
+thread_local Cache* t_caches[SUBSYSTEMS] {};
+thread_local bool t_exited {false};
+
+void flush(Cache& cache, std::size_t sizeClass, std::size_t count)
+{
+    auto& arena = g_arenas[static_cast<std::size_t>(cache.subsystem)];
+    FreeBlock* first = cache.lists[sizeClass];
+    FreeBlock* last = first;
+    for (std::size_t i = 1; i < count; ++i)
+    {
+        last = last->next;
+    }
+    cache.lists[sizeClass] = last->next;
+    cache.counts[sizeClass] -= count;
+
+    const std::lock_guard<std::mutex> lock(arena.mutex);
+    last->next = arena.lists[sizeClass];
+    arena.lists[sizeClass] = first;
+    arena.counts[sizeClass] += count;
+}
+
+/**
+ * @brief Takes back the blocks released by other threads.
+ */
+void drainRemote(Cache& cache)
+{
+    auto* block = cache.remote.exchange(nullptr, std::memory_order_acquire);
+    uint64_t blocks {0};
+    uint64_t bytes {0};
+    while (block != nullptr)
+    {
+        auto* next = block->next;
+        const auto sizeClass = classOf(block->header.size);
+        block->next = cache.lists[sizeClass];
+        cache.lists[sizeClass] = block;
+        ++cache.counts[sizeClass];
+        ++blocks;
+        bytes += block->header.size;
+        block = next;
+    }
+
+    if (blocks == 0)
+    {
+        return;
+    }
+    add(cache.deallocations, blocks);
+    add(cache.remoteFrees, blocks);
+    cache.bytesInUse.store(cache.bytesInUse.load(std::memory_order_relaxed) - bytes, std::memory_order_relaxed);
+
+    for (std::size_t sizeClass = 0; sizeClass < CLASSES; ++sizeClass)
+    {
+        if (cache.counts[sizeClass] > 2 * transferCount(sizeClass))
+        {
+            flush(cache, sizeClass, cache.counts[sizeClass] - transferCount(sizeClass));
+        }
+    }
+}
+
+/**
+ * @brief Refills the list of a class: remote blocks first, then the arena, then a new span.
+ */
+void refill(Cache& cache, std::size_t sizeClass)
+{
+    drainRemote(cache);
+    if (cache.lists[sizeClass] != nullptr)
+    {
+        return;
+    }
+
+    auto& arena = g_arenas[static_cast<std::size_t>(cache.subsystem)];
+    {
+        const std::lock_guard<std::mutex> lock(arena.mutex);
+        const auto count = std::min(arena.counts[sizeClass], transferCount(sizeClass));
+        if (count > 0)
+        {
+            FreeBlock* first = arena.lists[sizeClass];
+            FreeBlock* last = first;
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                last = last->next;
+            }
+            arena.lists[sizeClass] = last->next;
+            arena.counts[sizeClass] -= count;
+
+            last->next = nullptr;
+            cache.lists[sizeClass] = first;
+            cache.counts[sizeClass] = count;
+            return;
+        }
+    }
+
+    const auto size = blockSize(sizeClass);
+    for (std::size_t i = 0; i < transferCount(sizeClass); ++i)
+    {
+        if (static_cast<std::size_t>(cache.end - cache.cursor) < size)
+        {
+            // The tail of the previous span is smaller than the block, it is left unused
+            auto* span = static_cast<char*>(std::malloc(SPAN_SIZE));
+            if (span == nullptr)
+            {
+                if (cache.lists[sizeClass] != nullptr)
+                {
+                    return;
+                }
+                throw std::bad_alloc();
+            }
+            arena.spanBytes.fetch_add(SPAN_SIZE, std::memory_order_relaxed);
+            cache.cursor = span;
+            cache.end = span + SPAN_SIZE;
+        }
+
+        auto* block = reinterpret_cast<FreeBlock*>(cache.cursor);
+        cache.cursor += size;
+        block->header.size = size;
+        block->next = cache.lists[sizeClass];
+        cache.lists[sizeClass] = block;
+        ++cache.counts[sizeClass];
+    }
+}
+
+/**
+ * @brief Leaves the caches of an exiting thread to their arenas, with their free blocks.
+ */
+struct CacheRelease
+{
+    void touch() noexcept {}
+
+    ~CacheRelease()
+    {
+        t_exited = true;
+        for (std::size_t subsystem = 0; subsystem < SUBSYSTEMS; ++subsystem)
+        {
+            auto* cache = std::exchange(t_caches[subsystem], nullptr);
+            if (cache == nullptr)
+            {
+                continue;
+            }
+
+            drainRemote(*cache);
+            for (std::size_t sizeClass = 0; sizeClass < CLASSES; ++sizeClass)
+            {
+                if (cache->counts[sizeClass] > 0)
+                {
+                    flush(*cache, sizeClass, cache->counts[sizeClass]);
+                }
+            }
+
+            auto& arena = g_arenas[subsystem];
+            const std::lock_guard<std::mutex> lock(arena.mutex);
+            cache->nextOrphan = arena.orphans;
+            arena.orphans = cache;
+        }
+    }
+};
+
+thread_local CacheRelease t_release;
+
+/**
+ * @brief Gets the cache of the calling thread in the arena of a subsystem.
+ *
+ * @return Cache* The cache, nullptr if the thread is exiting and its caches were released.
+ */
+Cache* threadCache(Subsystem subsystem)
+{
+    const auto index = static_cast<std::size_t>(subsystem);
+    if (auto* cache = t_caches[index])
+    {
+        return cache;
+    }
+    if (t_exited)
+    {
+        return nullptr;
+    }
+
+    auto& arena = g_arenas[index];
+    Cache* cache {nullptr};
+    {
+        const std::lock_guard<std::mutex> lock(arena.mutex);
+        if (arena.orphans != nullptr)
+        {
+            cache = arena.orphans;
+            arena.orphans = cache->nextOrphan;
+            cache->nextOrphan = nullptr;
+        }
+    }
+
+    if (cache == nullptr)
+    {
+        auto* memory = std::malloc(sizeof(Cache));
+        if (memory == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        cache = new (memory) Cache {};
+        cache->subsystem = subsystem;
+
+        auto* head = arena.caches.load(std::memory_order_relaxed);
+        do
+        {
+            cache->nextRegistered = head;
+        } while (!arena.caches.compare_exchange_weak(
+            head, cache, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Registers the release of the caches at the exit of the thread
+    t_release.touch();
+    t_caches[index] = cache;
+    return cache;
+}
+
+void* allocateLarge(Subsystem subsystem, std::size_t bytes)
+{
+    auto* header = static_cast<Header*>(std::malloc(bytes));
+    if (header == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    header->owner = (static_cast<uintptr_t>(subsystem) << 1) | LARGE_TAG;
+    header->size = bytes;
+
+    auto& arena = g_arenas[static_cast<std::size_t>(subsystem)];
+    arena.largeAllocations.fetch_add(1, std::memory_order_relaxed);
+    arena.largeBytes.fetch_add(bytes, std::memory_order_relaxed);
+    return reinterpret_cast<char*>(header) + HEADER_SIZE;
+}
+} // namespace
+
+std::string_view subsystemName(Subsystem subsystem) noexcept
+{
+    switch (subsystem)
+    {
+        case Subsystem::DEFAULT: return "default";
+        case Subsystem::ROUTER: return "router";
+        case Subsystem::API: return "api";
+        case Subsystem::BUILDER: return "builder";
+        default: return "unknown";
+    }
+}
+
+Subsystem exchangeCurrent(Subsystem subsystem) noexcept
+{
+    if (static_cast<std::size_t>(subsystem) >= SUBSYSTEMS)
+    {
+        subsystem = Subsystem::DEFAULT;
+    }
+    return std::exchange(t_subsystem, subsystem);
+}
+
+Subsystem current() noexcept
+{
+    return t_subsystem;
+}
+
+void* allocate(std::size_t size)
+{
+    const auto subsystem = t_subsystem;
+    if (size > std::numeric_limits<std::size_t>::max() - HEADER_SIZE)
+    {
+        throw std::bad_alloc();
+    }
+    const auto bytes = size + HEADER_SIZE;
+    if (bytes > MAX_BLOCK_SIZE)
+    {
+        return allocateLarge(subsystem, bytes);
+    }
+
+    auto* cache = threadCache(subsystem);
+    if (cache == nullptr)
+    {
+        return allocateLarge(subsystem, bytes);
+    }
+
+    const auto sizeClass = classOf(bytes);
+    if (cache->lists[sizeClass] == nullptr)
+    {
+        refill(*cache, sizeClass);
+    }
+
+    auto* block = cache->lists[sizeClass];
+    cache->lists[sizeClass] = block->next;
+    --cache->counts[sizeClass];
+
+    block->header.owner = reinterpret_cast<uintptr_t>(cache);
+    add(cache->allocations, 1);
+    add(cache->bytesInUse, block->header.size);
+    return reinterpret_cast<char*>(block) + HEADER_SIZE;
+}
+
+void deallocate(void* ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    auto* header = reinterpret_cast<Header*>(static_cast<char*>(ptr) - HEADER_SIZE);
+    if ((header->owner & LARGE_TAG) != 0)
+    {
+        auto& arena = g_arenas[header->owner >> 1];
+        arena.largeDeallocations.fetch_add(1, std::memory_order_relaxed);
+        arena.largeBytes.fetch_sub(header->size, std::memory_order_relaxed);
+        std::free(header);
+        return;
+    }
+
+    auto* owner = reinterpret_cast<Cache*>(header->owner);
+    auto* block = reinterpret_cast<FreeBlock*>(header);
+    if (owner == t_caches[static_cast<std::size_t>(owner->subsystem)])
+    {
+        const auto sizeClass = classOf(header->size);
+        block->next = owner->lists[sizeClass];
+        owner->lists[sizeClass] = block;
+        ++owner->counts[sizeClass];
+        add(owner->deallocations, 1);
+        owner->bytesInUse.store(owner->bytesInUse.load(std::memory_order_relaxed) - header->size,
+                                std::memory_order_relaxed);
+
+        if (owner->counts[sizeClass] > 2 * transferCount(sizeClass))
+        {
+            flush(*owner, sizeClass, transferCount(sizeClass));
+        }
+        return;
+    }
+
+    // Released by another thread, the owner takes it back when it runs out of blocks
+    auto* head = owner->remote.load(std::memory_order_relaxed);
+    do
+    {
+        block->next = head;
+    } while (!owner->remote.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+}
+
+std::vector<Stats> stats()
+{
+    std::vector<Stats> retValue;
+    retValue.reserve(SUBSYSTEMS);
+    for (std::size_t subsystem = 0; subsystem < SUBSYSTEMS; ++subsystem)
+    {
+        const auto& arena = g_arenas[subsystem];
+        Stats entry {};
+        entry.subsystem = static_cast<Subsystem>(subsystem);
+
+        for (auto* cache = arena.caches.load(std::memory_order_acquire); cache != nullptr;
+             cache = cache->nextRegistered)
+        {
+            entry.allocations += cache->allocations.load(std::memory_order_relaxed);
+            entry.deallocations += cache->deallocations.load(std::memory_order_relaxed);
+            entry.remoteFrees += cache->remoteFrees.load(std::memory_order_relaxed);
+            entry.bytesInUse += cache->bytesInUse.load(std::memory_order_relaxed);
+            ++entry.caches;
+        }
+
+        const auto largeAllocations = arena.largeAllocations.load(std::memory_order_relaxed);
+        const auto largeBytes = arena.largeBytes.load(std::memory_order_relaxed);
+        entry.allocations += largeAllocations;
+        entry.deallocations += arena.largeDeallocations.load(std::memory_order_relaxed);
+        entry.largeAllocations = largeAllocations;
+        entry.bytesInUse += largeBytes;
+        entry.bytesReserved = arena.spanBytes.load(std::memory_order_relaxed) + largeBytes;
+        retValue.push_back(entry);
+    }
+    return retValue;
+}
+
+} // namespace base::arena
+
+#if defined(ENGINE_ARENA_ALLOCATOR) && !defined(ENGINE_ALLOC_PROFILING)
+
+// The profiling build has its own hooks, they allocate from the arenas too (see allocProfiler.cpp)
+void* operator new(std::size_t size)
+{
+    return base::arena::allocate(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    base::arena::deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    base::arena::deallocate(ptr);
+}
+
+#endif // ENGINE_ARENA_ALLOCATOR && !ENGINE_ALLOC_PROFILING
@@ -1,6 +1,9 @@
 #include <base/json.hpp>
+#include <base/jsonArena.hpp>
 
 #include <exception>
+#include <string_view>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "rapidjson/schema.h"
@@ -12,11 +15,283 @@ namespace
 {
 constexpr auto INVALID_POINTER_TYPE_MSG = "Invalid pointer path '{}'";
 constexpr auto PATH_NOT_FOUND_MSG = "Path '{}' not found";
+
+/**
+ * @brief rapidjson output stream appending to a caller buffer.
+ */
+struct StringSink
+{
+    using Ch = char;
+
+    std::string& buffer; ///< Caller buffer
+
+    void Put(Ch c) { buffer.push_back(c); }
+    void Flush() {}
+};
+
+constexpr rapidjson::SizeType WIDE_OBJECT_MEMBERS {32}; ///< Members from which an object is searched by a hash index
+constexpr std::size_t MAX_INDEXED_OBJECTS {64};          ///< Wide objects indexed by each thread
+
+/**
+ * @brief Hash index of the members of a wide object, by member name.
+ *
+ * It is only used while the member array, the member count and the last member of the object are the ones it was
+ * built from. rapidjson only appends members and EraseMember keeps the order of the remaining ones, so any set or
+ * erase that changes the members of the object changes one of them, and the index is built again.
+ */
+struct MemberIndex
+{
+    const void* members {nullptr};                                         ///< Member array indexed
+    rapidjson::SizeType count {0};                                         ///< Member count indexed
+    const char* lastName {nullptr};                                        ///< Name of the last member indexed
+    std::unordered_map<std::string_view, rapidjson::SizeType> positions {}; ///< Position of each member name
+};
+
+/**
+ * @brief Find a member of an object, as rapidjson FindMember does.
+ *
+ * The objects with more than WIDE_OBJECT_MEMBERS members are searched through a hash index, kept per thread for the
+ * last objects searched so the values shared between threads need no locks. The narrow ones are scanned.
+ */
+template<typename ValueType>
+auto findMember(ValueType& object, std::string_view name) -> decltype(object.MemberBegin())
+{
+    auto isName = [name](const rapidjson::Value& member)
+    {
+        return member.GetStringLength() == name.size()
+               && std::char_traits<char>::compare(member.GetString(), name.data(), name.size()) == 0;
+    };
+    auto scan = [&]()
+    {
+        auto member = object.MemberBegin();
+        for (; member != object.MemberEnd() && !isName(member->name); ++member)
+        {
+        }
+        return member;
+    };
+
+    const auto count = object.MemberCount();
+    if (count < WIDE_OBJECT_MEMBERS)
+    {
+        return scan();
+    }
+
+    thread_local std::unordered_map<const void*, MemberIndex> indexes;
+    const auto begin = object.MemberBegin();
+    const void* members = &*begin;
+    const auto* lastName = (begin + (count - 1))->name.GetString();
+
+    auto found = indexes.find(&object);
+    if (found == indexes.end())
+    {
+        if (indexes.size() >= MAX_INDEXED_OBJECTS)
+        {
+            indexes.clear();
+        }
+        found = indexes.emplace(&object, MemberIndex {}).first;
+    }
+
+    auto& index = found->second;
+    if (index.members != members || index.count != count || index.lastName != lastName)
+    {
+        index.positions.clear();
+        index.positions.reserve(count);
+        for (rapidjson::SizeType i = 0; i < count; ++i)
+        {
+            // The first member of a repeated name is kept, as the one found by FindMember
+            const auto& memberName = (begin + i)->name;
+            index.positions.emplace(std::string_view {memberName.GetString(), memberName.GetStringLength()}, i);
+        }
+        index.members = members;
+        index.count = count;
+        index.lastName = lastName;
+    }
+
+    const auto position = index.positions.find(name);
+    if (position == index.positions.end())
+    {
+        return object.MemberEnd();
+    }
+
+    const auto member = begin + position->second;
+    return isName(member->name) ? member : scan();
+}
+
+/**
+ * @brief Get the value a pointer points to, as rapidjson::Pointer::Get does, searching the objects with findMember.
+ */
+template<typename ValueType>
+ValueType* resolve(const rapidjson::Pointer& pointer, ValueType& root)
+{
+    const auto* tokens = pointer.GetTokens();
+    auto* value = &root;
+    for (std::size_t i = 0; i < pointer.GetTokenCount(); ++i)
+    {
+        const auto& token = tokens[i];
+        if (value->IsObject())
+        {
+            const auto member = findMember(*value, std::string_view {token.name, token.length});
+            if (member == value->MemberEnd())
+            {
+                return nullptr;
+            }
+            value = &member->value;
+        }
+        else if (value->IsArray())
+        {
+            if (token.index == rapidjson::kPointerInvalidIndex || token.index >= value->Size())
+            {
+                return nullptr;
+            }
+            value = &(*value)[token.index];
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    return value;
+}
+
+const rapidjson::Value* getValue(const rapidjson::Pointer& pointer, const rapidjson::Value& root)
+{
+    return resolve(pointer, root);
+}
+
+rapidjson::Value* getValue(const rapidjson::Pointer& pointer, rapidjson::Value& root)
+{
+    return resolve(pointer, root);
+}
 } // namespace
 
+namespace rapidjson
+{
+// Reserve the escaped strings and numbers at once, as the writer does for its own buffers
+template<>
+inline void PutReserve(StringSink& stream, size_t count)
+{
+    stream.buffer.reserve(stream.buffer.size() + count);
+}
+} // namespace rapidjson
+
 namespace json
 {
 
+Path::Path(std::string_view pointerPath)
+    : m_str {pointerPath}
+    , m_pointer {m_str.c_str(), m_str.size()}
+{
+    if (!m_pointer.IsValid())
+    {
+        throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, pointerPath));
+    }
+    m_slots = copySlots();
+}
+
+Path::Path(const Path& other)
+    : m_str {other.m_str}
+    , m_pointer {other.m_pointer}
+    , m_slots {other.copySlots()}
+{
+}
+
+Path& Path::operator=(const Path& other)
+{
+    if (this != &other)
+    {
+        m_str = other.m_str;
+        m_pointer = other.m_pointer;
+        m_slots = other.copySlots();
+    }
+    return *this;
+}
+
+Path::Slots Path::copySlots() const
+{
+    const auto count = m_pointer.GetTokenCount();
+    if (count == 0)
+    {
+        return nullptr;
+    }
+
+    Slots slots {new std::atomic<rapidjson::SizeType>[count]};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        slots[i].store(m_slots ? m_slots[i].load(std::memory_order_relaxed) : 0, std::memory_order_relaxed);
+    }
+    return slots;
+}
+
+template<typename ValueType>
+ValueType* Path::find(ValueType& root) const
+{
+    if (!m_slots)
+    {
+        // Root or moved from path
+        return getValue(m_pointer, root);
+    }
+
+    const auto* tokens = m_pointer.GetTokens();
+    const auto count = m_pointer.GetTokenCount();
+    auto* value = &root;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const auto& token = tokens[i];
+        if (value->IsObject())
+        {
+            const auto members = value->MemberCount();
+            auto& slot = m_slots[i];
+            const auto hint = slot.load(std::memory_order_relaxed);
+            auto isToken = [&token](const rapidjson::Value& name)
+            {
+                return name.GetStringLength() == token.length
+                       && std::char_traits<char>::compare(name.GetString(), token.name, token.length) == 0;
+            };
+
+            auto member = value->MemberBegin();
+            if (hint < members && isToken((member + hint)->name))
+            {
+                member += hint;
+            }
+            else
+            {
+                member = findMember(*value, std::string_view {token.name, token.length});
+                if (member == value->MemberEnd())
+                {
+                    return nullptr;
+                }
+                slot.store(static_cast<rapidjson::SizeType>(member - value->MemberBegin()), std::memory_order_relaxed);
+            }
+            value = &member->value;
+        }
+        else if (value->IsArray())
+        {
+            if (token.index == rapidjson::kPointerInvalidIndex || token.index >= value->Size())
+            {
+                return nullptr;
+            }
+            value = &(*value)[token.index];
+        }
+        else
+        {
+            return nullptr;
+        }
+    }
+
+    return value;
+}
+
+const rapidjson::Value* Path::get(const rapidjson::Value& root) const
+{
+    return find(root);
+}
+
+rapidjson::Value* Path::get(rapidjson::Value& root) const
+{
+    return find(root);
+}
+
 Json::Json(const rapidjson::Value& value)
     : m_document {rapidjson::Document()}
 {
@@ -42,6 +317,12 @@ Json::Json(rapidjson::Document&& document)
     m_document = std::move(document);
 }
 
+Json::Json(std::shared_ptr<Arena> arena)
+    : m_arena {std::move(arena)}
+    , m_document {m_arena ? &m_arena->allocator() : nullptr}
+{
+}
+
 Json::Json(const char* json)
     : m_document {rapidjson::Document()}
 {
@@ -122,14 +403,22 @@ std::string Json::formatJsonPath(std::string_view dotPath, bool skipDot)
     return ptrPath;
 }
 
+Path Json::compileJsonPath(std::string_view dotPath, bool skipDot)
+{
+    return Path(formatJsonPath(dotPath, skipDot));
+}
+
 Json::Json(Json&& other) noexcept
-    : m_document {std::move(other.m_document)}
+    : m_arena {std::move(other.m_arena)}
+    , m_document {std::move(other.m_document)}
 {
 }
 
 Json& Json::operator=(Json&& other) noexcept
 {
+    // The previous document is destroyed before its arena is released
     m_document = std::move(other.m_document);
+    m_arena = std::move(other.m_arena);
     return *this;
 }
 
@@ -138,7 +427,7 @@ bool Json::exists(std::string_view ptrPath) const
     const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
     if (fieldPtr.IsValid())
     {
-        return fieldPtr.Get(m_document) != nullptr;
+        return getValue(fieldPtr, m_document) != nullptr;
     }
 
     throw std::runtime_error(fmt::format("..", __func__, ptrPath));
@@ -149,7 +438,7 @@ bool Json::equals(std::string_view ptrPath, const Json& value) const
     const auto fieldPtr = rapidjson::Pointer(ptrPath.data());
     if (fieldPtr.IsValid())
     {
-        const auto got {fieldPtr.Get(m_document)};
+        const auto got {getValue(fieldPtr, m_document)};
         return (got && *got == value.m_document);
     }
 
@@ -170,8 +459,8 @@ bool Json::equals(std::string_view basePtrPath, std::string_view referencePtrPat
         throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referencePtrPath));
     }
 
-    const auto fieldValue {fieldPtr.Get(m_document)};
-    const auto referenceValue {referencePtr.Get(m_document)};
+    const auto fieldValue {getValue(fieldPtr, m_document)};
+    const auto referenceValue {getValue(referencePtr, m_document)};
 
     return (fieldValue && referenceValue && *fieldValue == *referenceValue);
 }
@@ -204,7 +493,7 @@ void Json::set(std::string_view basePtrPath, std::string_view referencePtrPath)
         throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, referencePtrPath));
     }
 
-    const auto* reference = referencePtr.Get(m_document);
+    const auto* reference = getValue(referencePtr, m_document);
     if (reference)
     {
         fieldPtr.Set(m_document, *reference);
@@ -222,7 +511,7 @@ std::optional<std::string> Json::getString(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsString())
         {
             retval = std::string {value->GetString()};
@@ -240,7 +529,7 @@ std::optional<int> Json::getInt(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsInt())
         {
             retval = value->GetInt();
@@ -257,7 +546,7 @@ std::optional<int64_t> Json::getInt64(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsInt64())
         {
             return value->GetInt64();
@@ -279,7 +568,7 @@ std::optional<int64_t> Json::getIntAsInt64(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsInt64())
         {
             return value->GetInt64();
@@ -305,7 +594,7 @@ std::optional<float_t> Json::getFloat(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsFloat())
         {
             return value->GetFloat();
@@ -328,7 +617,7 @@ std::optional<double_t> Json::getDouble(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsDouble())
         {
             retval = value->GetDouble();
@@ -346,7 +635,7 @@ std::optional<double> Json::getNumberAsDouble(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsNumber())
         {
             if (value->IsInt())
@@ -379,7 +668,7 @@ std::optional<bool> Json::getBool(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsBool())
         {
             retval = value->GetBool();
@@ -397,7 +686,7 @@ std::optional<std::vector<Json>> Json::getArray(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsArray())
         {
             std::vector<Json> result;
@@ -420,7 +709,7 @@ std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::s
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value && value->IsObject())
         {
             std::vector<std::tuple<std::string, Json>> result;
@@ -436,6 +725,35 @@ std::optional<std::vector<std::tuple<std::string, Json>>> Json::getObject(std::s
     throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
 }
 
+std::optional<JsonConstView> Json::getView(std::string_view path) const
+{
+    const auto pp = rapidjson::Pointer(path.data());
+
+    if (pp.IsValid())
+    {
+        const auto* value = getValue(pp, m_document);
+        if (value)
+        {
+            return JsonConstView {*value};
+        }
+        return std::nullopt;
+    }
+
+    throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
+}
+
+std::optional<ArrayView> Json::getArrayView(std::string_view path) const
+{
+    auto view = getView(path);
+    return view ? view->getArray() : std::nullopt;
+}
+
+std::optional<ObjectView> Json::getObjectView(std::string_view path) const
+{
+    auto view = getView(path);
+    return view ? view->getObject() : std::nullopt;
+}
+
 std::string Json::prettyStr() const
 {
     rapidjson::StringBuffer buffer;
@@ -453,6 +771,13 @@ std::string Json::str() const
     return buffer.GetString();
 }
 
+void Json::writeTo(std::string& buffer) const
+{
+    StringSink sink {buffer};
+    rapidjson::Writer<StringSink, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(sink);
+    this->m_document.Accept(writer);
+}
+
 std::optional<std::string> Json::str(std::string_view path) const
 {
     std::optional<std::string> retval {std::nullopt};
@@ -460,7 +785,7 @@ std::optional<std::string> Json::str(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto& value = pp.Get(m_document);
+        const auto& value = getValue(pp, m_document);
         if (value)
         {
             rapidjson::StringBuffer buffer;
@@ -487,7 +812,7 @@ size_t Json::size(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             if (value->IsArray())
@@ -518,7 +843,7 @@ bool Json::isNull(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsNull();
@@ -536,7 +861,7 @@ bool Json::isBool(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsBool();
@@ -554,7 +879,7 @@ bool Json::isNumber(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsNumber();
@@ -572,7 +897,7 @@ bool Json::isInt(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsInt();
@@ -590,7 +915,7 @@ bool Json::isInt64(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsInt64();
@@ -608,7 +933,7 @@ bool Json::isFloat(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsFloat();
@@ -626,7 +951,7 @@ bool Json::isDouble(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsDouble();
@@ -644,7 +969,7 @@ bool Json::isString(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsString();
@@ -662,7 +987,7 @@ bool Json::isArray(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsArray();
@@ -680,7 +1005,7 @@ bool Json::isObject(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return value->IsObject();
@@ -698,7 +1023,7 @@ bool Json::isEmpty(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             if (value->IsArray())
@@ -739,7 +1064,7 @@ std::string Json::typeName(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             switch (value->GetType())
@@ -767,7 +1092,7 @@ Json::Type Json::type(std::string_view path) const
 
     if (pp.IsValid())
     {
-        const auto* value = pp.Get(m_document);
+        const auto* value = getValue(pp, m_document);
         if (value)
         {
             return rapidTypeToJsonType(value->GetType());
@@ -865,7 +1190,9 @@ void Json::setString(std::string_view value, std::string_view path)
 
     if (pp.IsValid())
     {
-        pp.Set(m_document, std::string(value).c_str());
+        // Copied once into the allocator of the document, with its length so it can hold null characters
+        rapidjson::Value v(value.data(), static_cast<rapidjson::SizeType>(value.size()), m_document.GetAllocator());
+        pp.Set(m_document, v);
         return;
     }
 
@@ -913,7 +1240,7 @@ void Json::appendString(std::string_view value, std::string_view path)
         }
         rapidjson::Value v(value.data(), s2, m_document.GetAllocator());
 
-        auto* val = pp.Get(m_document);
+        auto* val = getValue(pp, m_document);
         if (val)
         {
             if (!val->IsArray())
@@ -943,7 +1270,7 @@ void Json::appendJson(const Json& value, std::string_view path)
     if (pp.IsValid())
     {
         rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator()};
-        auto* val = pp.Get(m_document);
+        auto* val = getValue(pp, m_document);
         if (val)
         {
             if (!val->IsArray())
@@ -992,7 +1319,7 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
 
     if (pp.IsValid())
     {
-        auto* dstValue = pp.Get(m_document);
+        auto* dstValue = getValue(pp, m_document);
         if (dstValue)
         {
             if (dstValue->GetType() == source.GetType())
@@ -1024,26 +1351,28 @@ void Json::merge(const bool isRecursive, const rapidjson::Value& source, std::st
                 }
                 else if (dstValue->IsArray())
                 {
-                    for (auto srcIt = source.Begin(); srcIt != source.End(); ++srcIt)
+                    // The elements are appended once, whether they were in the destination or repeated in the source.
+                    // The set points to the source ones, which are not moved when the destination grows.
+                    ValueSet seen;
+                    for (const auto& dstElement : dstValue->GetArray())
                     {
-                        // Find if value is already in dstValue
-                        // TODO: this is inefficient, but rapidjson does not provide a way
-                        // to do it.
-                        auto found = false;
-                        for (auto dstIt = dstValue->Begin(); dstIt != dstValue->End(); ++dstIt)
-                        {
-                            if (*dstIt == *srcIt)
-                            {
-                                found = true;
-                                break;
-                            }
-                        }
-                        if (!found)
+                        seen.insert(JsonConstView {dstElement});
+                    }
+
+                    std::vector<const rapidjson::Value*> toAppend;
+                    for (const auto& srcElement : source.GetArray())
+                    {
+                        if (seen.insert(JsonConstView {srcElement}))
                         {
-                            rapidjson::Value cpyValue {*srcIt, m_document.GetAllocator()};
-                            dstValue->PushBack(cpyValue, m_document.GetAllocator());
+                            toAppend.push_back(&srcElement);
                         }
                     }
+
+                    for (const auto* srcElement : toAppend)
+                    {
+                        rapidjson::Value cpyValue {*srcElement, m_document.GetAllocator()};
+                        dstValue->PushBack(cpyValue, m_document.GetAllocator());
+                    }
                 }
                 else
                 {
@@ -1073,7 +1402,7 @@ void Json::merge(const bool isRecursive, std::string_view source, std::string_vi
 
     if (pp.IsValid())
     {
-        auto* srcValue = pp.Get(m_document);
+        auto* srcValue = getValue(pp, m_document);
         if (srcValue)
         {
             merge(isRecursive, *srcValue, path);
@@ -1094,7 +1423,7 @@ std::optional<Json> Json::getJson(std::string_view path) const
 
     if (pp.IsValid())
     {
-        auto* val = pp.Get(m_document);
+        auto* val = getValue(pp, m_document);
         if (val)
         {
             retval = Json(*val);
@@ -1186,7 +1515,7 @@ bool Json::eraseIfKey(const std::function<bool(const std::string&)>& func, bool
         throw std::runtime_error(fmt::format(INVALID_POINTER_TYPE_MSG, path));
     }
 
-    auto* value = const_cast<rapidjson::Value*>(pp.Get(m_document));
+    auto* value = const_cast<rapidjson::Value*>(getValue(pp, m_document));
     if (!value || !value->IsObject())
     {
         return modified;
@@ -1224,4 +1553,534 @@ Json Json::makeObjectJson(const std::string& key, const json::Json& value)
     return Json(std::move(doc));
 }
 
+/************************************************************************************/
+// Precompiled path accessors
+/************************************************************************************/
+
+bool Json::exists(const Path& path) const
+{
+    return path.get(m_document) != nullptr;
+}
+
+bool Json::equals(const Path& path, const Json& value) const
+{
+    const auto* got = path.get(m_document);
+    return (got && *got == value.m_document);
+}
+
+bool Json::equals(const Path& basePath, const Path& referencePath) const
+{
+    const auto* fieldValue = basePath.get(m_document);
+    const auto* referenceValue = referencePath.get(m_document);
+
+    return (fieldValue && referenceValue && *fieldValue == *referenceValue);
+}
+
+std::optional<std::string> Json::getString(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string_view> Json::getStringView(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsString())
+    {
+        return std::string_view {value->GetString(), value->GetStringLength()};
+    }
+    return std::nullopt;
+}
+
+std::optional<int> Json::getInt(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsInt())
+    {
+        return value->GetInt();
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getInt64(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsInt64())
+    {
+        return value->GetInt64();
+    }
+    return std::nullopt;
+}
+
+std::optional<int64_t> Json::getIntAsInt64(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsInt64())
+    {
+        return value->GetInt64();
+    }
+    else if (value && value->IsInt())
+    {
+        return static_cast<int64_t>(value->GetInt());
+    }
+    return std::nullopt;
+}
+
+std::optional<double_t> Json::getDouble(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsDouble())
+    {
+        return value->GetDouble();
+    }
+    return std::nullopt;
+}
+
+std::optional<double> Json::getNumberAsDouble(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsNumber())
+    {
+        if (value->IsInt())
+        {
+            return static_cast<double>(value->GetInt());
+        }
+        else if (value->IsInt64())
+        {
+            return static_cast<double>(value->GetInt64());
+        }
+        else if (value->IsDouble())
+        {
+            return value->GetDouble();
+        }
+        else if (value->IsFloat())
+        {
+            return value->GetFloat();
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<bool> Json::getBool(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsBool())
+    {
+        return value->GetBool();
+    }
+    return std::nullopt;
+}
+
+std::optional<std::vector<Json>> Json::getArray(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value && value->IsArray())
+    {
+        std::vector<Json> result;
+        result.reserve(value->Size());
+        for (const auto& item : value->GetArray())
+        {
+            result.push_back(Json(item));
+        }
+        return result;
+    }
+    return std::nullopt;
+}
+
+std::optional<JsonConstView> Json::getView(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        return JsonConstView {*value};
+    }
+    return std::nullopt;
+}
+
+std::optional<ArrayView> Json::getArrayView(const Path& path) const
+{
+    auto view = getView(path);
+    return view ? view->getArray() : std::nullopt;
+}
+
+std::optional<ObjectView> Json::getObjectView(const Path& path) const
+{
+    auto view = getView(path);
+    return view ? view->getObject() : std::nullopt;
+}
+
+std::optional<Json> Json::getJson(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        return Json(*value);
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> Json::str(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(
+            buffer);
+        value->Accept(writer);
+        return std::string {buffer.GetString(), buffer.GetSize()};
+    }
+    return std::nullopt;
+}
+
+size_t Json::size(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        if (value->IsArray())
+        {
+            return value->Size();
+        }
+        else if (value->IsObject())
+        {
+            return value->MemberCount();
+        }
+        else if (value->IsString())
+        {
+            return value->GetStringLength();
+        }
+        throw std::runtime_error(fmt::format("Size of field '{}' is not measurable.", path.str()));
+    }
+
+    throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path.str()));
+}
+
+bool Json::isNull(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsNull();
+}
+
+bool Json::isBool(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsBool();
+}
+
+bool Json::isNumber(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsNumber();
+}
+
+bool Json::isInt(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsInt();
+}
+
+bool Json::isInt64(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsInt64();
+}
+
+bool Json::isDouble(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsDouble();
+}
+
+bool Json::isString(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsString();
+}
+
+bool Json::isArray(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsArray();
+}
+
+bool Json::isObject(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    return value && value->IsObject();
+}
+
+bool Json::isEmpty(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        if (value->IsArray())
+        {
+            return value->Empty();
+        }
+        else if (value->IsObject())
+        {
+            return value->ObjectEmpty();
+        }
+        else if (value->IsString())
+        {
+            return value->GetStringLength() == 0;
+        }
+        else if (value->IsNumber())
+        {
+            return value->GetDouble() == 0;
+        }
+        else if (value->IsBool())
+        {
+            return !value->GetBool();
+        }
+        else if (value->IsNull())
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+Json::Type Json::type(const Path& path) const
+{
+    const auto* value = path.get(m_document);
+    if (value)
+    {
+        return rapidTypeToJsonType(value->GetType());
+    }
+
+    throw std::runtime_error(fmt::format(PATH_NOT_FOUND_MSG, path.str()));
+}
+
+rapidjson::Value& Json::slot(const Path& path)
+{
+    auto* value = path.get(m_document);
+    return value ? *value : path.pointer().Create(m_document);
+}
+
+void Json::set(const Path& path, const Json& value)
+{
+    slot(path).CopyFrom(value.m_document, m_document.GetAllocator());
+}
+
+void Json::set(const Path& basePath, const Path& referencePath)
+{
+    const auto* reference = referencePath.get(m_document);
+    if (reference)
+    {
+        basePath.pointer().Set(m_document, *reference);
+    }
+    else
+    {
+        slot(basePath).SetNull();
+    }
+}
+
+void Json::setNull(const Path& path)
+{
+    slot(path).SetNull();
+}
+
+void Json::setBool(bool value, const Path& path)
+{
+    slot(path).SetBool(value);
+}
+
+void Json::setInt(int value, const Path& path)
+{
+    slot(path).SetInt(value);
+}
+
+void Json::setInt64(int64_t value, const Path& path)
+{
+    slot(path).SetInt64(value);
+}
+
+void Json::setDouble(double_t value, const Path& path)
+{
+    slot(path).SetDouble(value);
+}
+
+void Json::setString(std::string_view value, const Path& path)
+{
+    rapidjson::Value v(value.data(), static_cast<rapidjson::SizeType>(value.size()), m_document.GetAllocator());
+    slot(path) = v;
+}
+
+void Json::setArray(const Path& path)
+{
+    slot(path).SetArray();
+}
+
+void Json::setObject(const Path& path)
+{
+    slot(path).SetObject();
+}
+
+void Json::appendString(std::string_view value, const Path& path)
+{
+    rapidjson::Value v(value.data(), static_cast<rapidjson::SizeType>(value.size()), m_document.GetAllocator());
+
+    auto* val = path.get(m_document);
+    if (val)
+    {
+        if (!val->IsArray())
+        {
+            val->SetArray();
+        }
+        val->PushBack(v, m_document.GetAllocator());
+    }
+    else
+    {
+        rapidjson::Value vArray;
+        vArray.SetArray();
+        vArray.PushBack(v, m_document.GetAllocator());
+        path.pointer().Set(m_document, vArray);
+    }
+}
+
+void Json::appendJson(const Json& value, const Path& path)
+{
+    rapidjson::Value rapidValue {value.m_document, m_document.GetAllocator()};
+    auto* val = path.get(m_document);
+    if (val)
+    {
+        if (!val->IsArray())
+        {
+            val->SetArray();
+        }
+        val->PushBack(rapidValue, m_document.GetAllocator());
+    }
+    else
+    {
+        rapidjson::Value vArray;
+        vArray.SetArray();
+        vArray.PushBack(rapidValue, m_document.GetAllocator());
+        path.pointer().Set(m_document, vArray);
+    }
+}
+
+bool Json::erase(const Path& path)
+{
+    if (path.isRoot())
+    {
+        m_document.SetNull();
+        return true;
+    }
+
+    return path.pointer().Erase(m_document);
+}
+
+std::string JsonConstView::str() const
+{
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer, rapidjson::Document::EncodingType, rapidjson::ASCII<>> writer(buffer);
+    m_value->Accept(writer);
+    return buffer.GetString();
+}
+
+Json JsonConstView::copy() const
+{
+    return Json(*m_value);
+}
+
+std::size_t ValueSet::hash(const rapidjson::Value& value)
+{
+    auto combine = [](std::size_t seed, std::size_t hash)
+    {
+        return seed ^ (hash + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+    };
+
+    switch (value.GetType())
+    {
+        case rapidjson::kNullType: return 0;
+        case rapidjson::kFalseType: return 1;
+        case rapidjson::kTrueType: return 2;
+        // rapidjson compares the integers with the doubles by their double value
+        case rapidjson::kNumberType: return std::hash<double> {}(value.GetDouble());
+        case rapidjson::kStringType:
+            return std::hash<std::string_view> {}(std::string_view {value.GetString(), value.GetStringLength()});
+        case rapidjson::kArrayType:
+        {
+            std::size_t seed = value.Size();
+            for (const auto& element : value.GetArray())
+            {
+                seed = combine(seed, hash(element));
+            }
+            return seed;
+        }
+        case rapidjson::kObjectType:
+        {
+            // The members are compared regardless of their order, so their hashes are summed
+            std::size_t seed = value.MemberCount();
+            for (const auto& member : value.GetObject())
+            {
+                seed += combine(hash(member.name), hash(member.value));
+            }
+            return seed;
+        }
+        default: return 0;
+    }
+}
+
+bool ValueSet::containsLinear(const rapidjson::Value& value) const
+{
+    return std::any_of(m_values.begin(), m_values.end(), [&value](const auto* element) { return *element == value; });
+}
+
+bool ValueSet::containsIndexed(const rapidjson::Value& value, std::size_t hash) const
+{
+    auto [first, last] = m_index.equal_range(hash);
+    return std::any_of(first, last, [&value](const auto& element) { return *element.second == value; });
+}
+
+bool ValueSet::contains(const JsonConstView& value) const
+{
+    if (m_index.empty())
+    {
+        return containsLinear(value.value());
+    }
+    return containsIndexed(value.value(), hash(value.value()));
+}
+
+bool ValueSet::insert(const JsonConstView& value)
+{
+    const auto& rValue = value.value();
+    if (m_values.size() < LINEAR_LIMIT)
+    {
+        if (containsLinear(rValue))
+        {
+            return false;
+        }
+        m_values.push_back(&rValue);
+        return true;
+    }
+
+    // Past the limit, the values compared so far are indexed once
+    if (m_index.empty())
+    {
+        m_index.reserve(m_values.size() * 2);
+        for (const auto* element : m_values)
+        {
+            m_index.emplace(hash(*element), element);
+        }
+    }
+
+    const auto valueHash = hash(rValue);
+    if (containsIndexed(rValue, valueHash))
+    {
+        return false;
+    }
+    m_values.push_back(&rValue);
+    m_index.emplace(valueHash, &rValue);
+    return true;
+}
+
 } // namespace json
@@ -13,9 +13,31 @@
 namespace logging
 {
 
+namespace
+{
+// Default logger, read on each log call without the lookup in the spdlog registry
+std::shared_ptr<spdlog::logger> g_defaultLogger;
+
+template<typename Factory>
+std::shared_ptr<spdlog::logger> makeLogger(const LoggingConfig& cfg)
+{
+    if (cfg.filePath == STD_ERR_PATH)
+    {
+        return spdlog::stderr_color_mt<Factory>("default");
+    }
+
+    if (cfg.filePath == STD_OUT_PATH)
+    {
+        return spdlog::stdout_color_mt<Factory>("default");
+    }
+
+    return spdlog::basic_logger_mt<Factory>("default", cfg.filePath, cfg.truncate);
+}
+} // namespace
+
 std::shared_ptr<spdlog::logger> getDefaultLogger()
 {
-    auto logger = spdlog::get("default");
+    auto logger = std::atomic_load(&g_defaultLogger);
     if (!logger)
     {
         throw std::runtime_error("The 'default' logger is not initialized.");
@@ -44,35 +66,34 @@ void start(const LoggingConfig& cfg)
 
     if (0 < cfg.dedicatedThreads)
     {
+        // The messages are formatted and written by the dedicated threads, the logging threads only queue them
         spdlog::init_thread_pool(cfg.queueSize, cfg.dedicatedThreads);
-    }
+        logger = cfg.dropOnFullQueue ? makeLogger<spdlog::async_factory_nonblock>(cfg)
+                                     : makeLogger<spdlog::async_factory>(cfg);
 
-    if (cfg.filePath == STD_ERR_PATH)
-    {
-        logger = spdlog::stderr_color_mt("default");
-    }
-    else if (cfg.filePath == STD_OUT_PATH)
-    {
-        logger = spdlog::stdout_color_mt("default");
+        // Flushing each message would serialize the writers again
+        logger->flush_on(spdlog::level::err);
+        spdlog::flush_every(std::chrono::milliseconds(cfg.flushInterval));
     }
     else
     {
-        logger = spdlog::basic_logger_mt("default", cfg.filePath, cfg.truncate);
+        logger = makeLogger<spdlog::synchronous_factory>(cfg);
+        logger->flush_on(spdlog::level::trace);
     }
 
+    std::atomic_store(&g_defaultLogger, logger);
     setLevel(cfg.level);
-
-    logger->flush_on(spdlog::level::trace);
 }
 
 void stop()
 {
+    std::atomic_store(&g_defaultLogger, std::shared_ptr<spdlog::logger> {});
     spdlog::shutdown();
 }
 
 void testInit()
 {
-    auto logger = spdlog::get("default");
+    auto logger = std::atomic_load(&g_defaultLogger);
 
     if (!logger)
     {
@@ -1,6 +1,7 @@
 #include "parseEvent.hpp"
 
 #include <fmt/format.h>
+#include <base/jsonArena.hpp>
 #include <base/logging.hpp>
 
 namespace base::parseEvent
@@ -12,15 +13,57 @@ namespace
 constexpr int LOCATION_OFFSET = 2; // Given the "q:" prefix.
 constexpr int MINIMUM_EVENT_ALLOWED_LENGTH = 4;
 constexpr char FIRST_FULL_LOCATION_CHAR {'['};
-} // namespace
 
-Event parseWazuhEvent(const std::string& event)
+// Arenas of the events parsed by the current thread, recycled once the event is released after being routed
+json::ArenaPool& arenaPool()
 {
-    int msgStartIndex {0};
+    thread_local json::ArenaPool pool {};
+    return pool;
+}
 
-    auto parseEvent = std::make_shared<json::Json>();
-    parseEvent->setObject();
+// Paths of the event envelope, compiled once
+const json::Path& queuePath()
+{
+    static const json::Path path {EVENT_QUEUE_ID};
+    return path;
+}
+
+const json::Path& locationPath()
+{
+    static const json::Path path {EVENT_LOCATION_ID};
+    return path;
+}
+
+const json::Path& messagePath()
+{
+    static const json::Path path {EVENT_MESSAGE_ID};
+    return path;
+}
 
+/**
+ * @brief Remove the escaping '|' of the colons in the location ("|:" -> ":") in a single pass.
+ *
+ * @param location The escaped location
+ * @return std::string The unescaped location
+ */
+std::string unescapeLocation(std::string_view location)
+{
+    std::string unescaped;
+    unescaped.reserve(location.size());
+    for (std::size_t i = 0; i < location.size(); ++i)
+    {
+        if (location[i] == '|' && i + 1 < location.size() && location[i + 1] == ':')
+        {
+            continue;
+        }
+        unescaped.push_back(location[i]);
+    }
+    return unescaped;
+}
+} // namespace
+
+Event parseWazuhEvent(std::string_view event)
+{
     if (event.length() <= MINIMUM_EVENT_ALLOWED_LENGTH)
     {
         throw std::runtime_error(fmt::format("Invalid event format, event is too short ({})", event.length()));
@@ -31,35 +74,72 @@ Event parseWazuhEvent(const std::string& event)
         throw std::runtime_error("Invalid event format, a colon was expected to be right after the first character");
     }
 
-    const int queue {event[0]};
-    parseEvent->setInt(queue, EVENT_QUEUE_ID);
-    auto locationIdx = std::string::npos;
+    auto locationIdx = std::string_view::npos;
+    bool escapedLocation {false};
     // If we have an IPv6, double dots are preceded by a |
     for (auto i = LOCATION_OFFSET; i < event.size(); ++i)
     {
-        if (event[i] == ':' && event[i - 1] != '|')
+        if (event[i] == ':')
         {
-            locationIdx = i;
-            break;
+            if (event[i - 1] != '|')
+            {
+                locationIdx = i;
+                break;
+            }
+            escapedLocation = true;
         }
     }
 
-    if (locationIdx == std::string::npos)
+    if (locationIdx == std::string_view::npos)
     {
         throw std::runtime_error("Invalid event format, a colon was expected to be right after the location");
     }
 
-    std::string location = event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET);
+    auto parseEvent = std::make_shared<json::Json>(arenaPool().acquire());
+    parseEvent->setObject();
+
+    const int queue {event[0]};
+    parseEvent->setInt(queue, queuePath());
+
+    // The location and message are copied only once, straight from the raw event into the document
+    const auto location = event.substr(LOCATION_OFFSET, locationIdx - LOCATION_OFFSET);
+    if (escapedLocation)
+    {
+        parseEvent->setString(unescapeLocation(location), locationPath());
+    }
+    else
     {
-        size_t pos;
-        while ((pos = location.find("|:")) != std::string::npos)
+        parseEvent->setString(location, locationPath());
+    }
+    parseEvent->setString(event.substr(locationIdx + 1), messagePath());
+
+    return parseEvent;
+}
+
+std::string_view locationSource(std::string_view location)
+{
+    if (!location.empty() && location.front() == FIRST_FULL_LOCATION_CHAR)
+    {
+        const auto end = location.find(']');
+        if (end != std::string_view::npos)
         {
-            location.erase(pos, 1);
+            return location.substr(1, end - 1);
         }
     }
-    parseEvent->setString(location, EVENT_LOCATION_ID);
-    parseEvent->setString(event.substr(locationIdx + 1), EVENT_MESSAGE_ID);
 
-    return parseEvent;
+    return location;
+}
+
+std::size_t sourceHash(const Event& event)
+{
+    const auto location = event->getStringView(locationPath());
+    return location ? std::hash<std::string_view> {}(locationSource(*location)) : 0;
 }
+
+char queueId(const Event& event)
+{
+    const auto queue = event->getInt(queuePath());
+    return queue ? static_cast<char>(queue.value()) : '\0';
+}
+
 } // namespace base::parseEvent
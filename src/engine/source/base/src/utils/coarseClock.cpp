@@ -0,0 +1,114 @@
+#include "utils/coarseClock.hpp"
+
+#include <ctime>
+#include <limits>
+
+namespace base::utils::time
+{
+
+namespace
+{
+void writeDigits(char* out, int value, int width)
+{
+    for (auto i = width - 1; i >= 0; --i)
+    {
+        out[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+int64_t floorDiv(int64_t value, int64_t divisor)
+{
+    const auto quotient = value / divisor;
+    return (value % divisor != 0 && value < 0) ? quotient - 1 : quotient;
+}
+} // namespace
+
+bool formatISO8601Seconds(int64_t seconds, char* out)
+{
+    const auto time = static_cast<std::time_t>(seconds);
+    std::tm tm {};
+    if (gmtime_r(&time, &tm) == nullptr)
+    {
+        return false;
+    }
+
+    const auto year = static_cast<int64_t>(tm.tm_year) + 1900;
+    if (year < 0 || year > 9999)
+    {
+        return false;
+    }
+
+    writeDigits(out, static_cast<int>(year), 4);
+    out[4] = '-';
+    writeDigits(out + 5, tm.tm_mon + 1, 2);
+    out[7] = '-';
+    writeDigits(out + 8, tm.tm_mday, 2);
+    out[10] = 'T';
+    writeDigits(out + 11, tm.tm_hour, 2);
+    out[13] = ':';
+    writeDigits(out + 14, tm.tm_min, 2);
+    out[16] = ':';
+    writeDigits(out + 17, tm.tm_sec, 2);
+    return true;
+}
+
+CoarseClock& CoarseClock::instance()
+{
+    static CoarseClock clock;
+    return clock;
+}
+
+CoarseClock::CoarseClock()
+    : m_epochMs {preciseEpochMs()}
+    , m_running {true}
+{
+    m_updater = std::thread(
+        [this]()
+        {
+            while (m_running.load(std::memory_order_relaxed))
+            {
+                std::this_thread::sleep_for(RESOLUTION);
+                m_epochMs.store(preciseEpochMs(), std::memory_order_relaxed);
+            }
+        });
+}
+
+CoarseClock::~CoarseClock()
+{
+    m_running.store(false, std::memory_order_relaxed);
+    if (m_updater.joinable())
+    {
+        m_updater.join();
+    }
+}
+
+int64_t CoarseClock::epochSeconds() const
+{
+    return floorDiv(epochMs(), 1000);
+}
+
+std::string_view CoarseClock::iso8601() const
+{
+    thread_local int64_t cachedSecond = std::numeric_limits<int64_t>::min();
+    thread_local char buffer[ISO8601_SIZE] = {'0', '0', '0', '0', '-', '0', '0', '-', '0', '0', 'T', '0',
+                                              '0', ':', '0', '0', ':', '0', '0', '.', '0', '0', '0', 'Z'};
+
+    const auto ms = epochMs();
+    const auto second = floorDiv(ms, 1000);
+    if (second != cachedSecond && formatISO8601Seconds(second, buffer))
+    {
+        cachedSecond = second;
+    }
+    writeDigits(buffer + ISO8601_SECONDS_SIZE + 1, static_cast<int>(ms - second * 1000), 3);
+
+    return {buffer, ISO8601_SIZE};
+}
+
+int64_t CoarseClock::preciseEpochMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace base::utils::time
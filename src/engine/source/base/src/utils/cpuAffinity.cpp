@@ -0,0 +1,159 @@
+#include "utils/cpuAffinity.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <pthread.h>
+
+#include <fmt/format.h>
+
+namespace utils::affinity
+{
+namespace
+{
+constexpr std::string_view NODE_PREFIX {"node"};
+
+int parseNumber(std::string_view number, std::string_view spec)
+{
+    int value = -1;
+    const auto [end, error] = std::from_chars(number.data(), number.data() + number.size(), value);
+    if (error != std::errc {} || end != number.data() + number.size() || value < 0 || value >= CPU_SETSIZE)
+    {
+        throw std::invalid_argument(fmt::format("Invalid CPU set '{}': '{}' is not a valid number", spec, number));
+    }
+
+    return value;
+}
+
+/**
+ * @brief Add the CPUs of a set to the result, the nodes are only resolved if allowed (not in the lists of sysfs)
+ */
+void addCpus(std::string_view spec, bool allowNodes, CpuSet& cpus)
+{
+    std::size_t start = 0;
+    while (start <= spec.size())
+    {
+        auto end = spec.find(',', start);
+        if (end == std::string_view::npos)
+        {
+            end = spec.size();
+        }
+        const auto item = spec.substr(start, end - start);
+        start = end + 1;
+
+        if (item.empty())
+        {
+            throw std::invalid_argument(fmt::format("Invalid CPU set '{}': empty item", spec));
+        }
+
+        if (allowNodes && item.substr(0, NODE_PREFIX.size()) == NODE_PREFIX)
+        {
+            const auto nodeSet = nodeCpus(parseNumber(item.substr(NODE_PREFIX.size()), spec));
+            cpus.insert(cpus.end(), nodeSet.begin(), nodeSet.end());
+            continue;
+        }
+
+        const auto dash = item.find('-');
+        const auto first = parseNumber(item.substr(0, dash), spec);
+        const auto last = dash == std::string_view::npos ? first : parseNumber(item.substr(dash + 1), spec);
+        if (last < first)
+        {
+            throw std::invalid_argument(fmt::format("Invalid CPU set '{}': range '{}' is reversed", spec, item));
+        }
+        for (auto cpu = first; cpu <= last; ++cpu)
+        {
+            cpus.push_back(cpu);
+        }
+    }
+}
+
+void normalize(CpuSet& cpus)
+{
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+}
+} // namespace
+
+CpuSet parseCpuSet(std::string_view spec)
+{
+    CpuSet cpus;
+    if (!spec.empty())
+    {
+        addCpus(spec, true, cpus);
+        normalize(cpus);
+    }
+
+    return cpus;
+}
+
+CpuSet nodeCpus(int node)
+{
+    const auto path = fmt::format("/sys/devices/system/node/node{}/cpulist", node);
+    std::ifstream file(path);
+    std::string list;
+    if (!file || !std::getline(file, list))
+    {
+        throw std::invalid_argument(fmt::format("NUMA node {} not found", node));
+    }
+
+    CpuSet cpus;
+    if (!list.empty())
+    {
+        addCpus(list, false, cpus);
+        normalize(cpus);
+    }
+
+    return cpus;
+}
+
+base::OptError pinThread(const CpuSet& cpus)
+{
+    if (cpus.empty())
+    {
+        return std::nullopt;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto cpu : cpus)
+    {
+        CPU_SET(cpu, &set);
+    }
+
+    if (const auto error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set); error != 0)
+    {
+        return base::Error {fmt::format("Cannot pin the thread to the CPUs {}: {}",
+                                        fmt::join(cpus, ","),
+                                        std::system_category().message(error))};
+    }
+
+    return std::nullopt;
+}
+
+ScopedPin::ScopedPin(const CpuSet& cpus)
+{
+    cpu_set_t previous;
+    if (cpus.empty() || pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) != 0)
+    {
+        return;
+    }
+
+    if (!pinThread(cpus))
+    {
+        m_previous = previous;
+    }
+}
+
+ScopedPin::~ScopedPin()
+{
+    if (m_previous)
+    {
+        pthread_setaffinity_np(pthread_self(), sizeof(*m_previous), &*m_previous);
+    }
+}
+
+} // namespace utils::affinity
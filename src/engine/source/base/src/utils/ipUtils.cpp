@@ -1,5 +1,8 @@
 #include "utils/ipUtils.hpp"
 
+#include <cstring>
+#include <optional>
+
 #include <arpa/inet.h>
 
 #include <fmt/format.h>
@@ -62,16 +65,191 @@ uint32_t IPv4MaskUInt(const std::string& maskStr)
     return maskUInt;
 }
 
-bool checkStrIsIPv4(const std::string& ip)
+bool parseIPv4(std::string_view ip, uint8_t* address)
+{
+    constexpr size_t IPV4_BYTES = 4;
+    uint8_t parsed[IPV4_BYTES] {};
+    size_t octets = 0;
+    bool sawDigit = false;
+
+    for (const auto ch : ip)
+    {
+        if (ch >= '0' && ch <= '9')
+        {
+            // No leading zeros, as inet_pton
+            if (sawDigit && parsed[octets - 1] == 0)
+            {
+                return false;
+            }
+
+            if (!sawDigit)
+            {
+                if (++octets > IPV4_BYTES)
+                {
+                    return false;
+                }
+                sawDigit = true;
+            }
+
+            const unsigned value = parsed[octets - 1] * 10U + static_cast<unsigned>(ch - '0');
+            if (value > 255)
+            {
+                return false;
+            }
+            parsed[octets - 1] = static_cast<uint8_t>(value);
+        }
+        else if (ch == '.' && sawDigit && octets < IPV4_BYTES)
+        {
+            sawDigit = false;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (octets < IPV4_BYTES || !sawDigit)
+    {
+        return false;
+    }
+
+    std::memcpy(address, parsed, IPV4_BYTES);
+    return true;
+}
+
+bool parseIPv6(std::string_view ip, uint8_t* address)
+{
+    constexpr size_t IPV6_BYTES = 16;
+    uint8_t parsed[IPV6_BYTES] {};
+    size_t size = 0;           // Bytes written to parsed
+    std::optional<size_t> gap; // Position of the "::" in parsed
+    size_t pos = 0;            // Position in ip
+    size_t token = 0;          // Start of the current group in ip
+    size_t hexDigits = 0;
+    unsigned value = 0;
+
+    if (ip.empty())
+    {
+        return false;
+    }
+
+    // A leading colon must be part of a "::"
+    if (ip[0] == ':')
+    {
+        if (ip.size() < 2 || ip[1] != ':')
+        {
+            return false;
+        }
+        pos = 1;
+    }
+
+    while (pos < ip.size())
+    {
+        const auto ch = ip[pos++];
+
+        int digit = -1;
+        if (ch >= '0' && ch <= '9')
+        {
+            digit = ch - '0';
+        }
+        else if (ch >= 'a' && ch <= 'f')
+        {
+            digit = ch - 'a' + 10;
+        }
+        else if (ch >= 'A' && ch <= 'F')
+        {
+            digit = ch - 'A' + 10;
+        }
+
+        if (digit >= 0)
+        {
+            if (hexDigits == 4)
+            {
+                return false;
+            }
+            value = (value << 4) | static_cast<unsigned>(digit);
+            ++hexDigits;
+            continue;
+        }
+
+        if (ch == ':')
+        {
+            token = pos;
+            if (hexDigits == 0)
+            {
+                // Only one "::" is allowed
+                if (gap)
+                {
+                    return false;
+                }
+                gap = size;
+                continue;
+            }
+            // A group can not end the address with a single colon
+            if (pos == ip.size() || size + 2 > IPV6_BYTES)
+            {
+                return false;
+            }
+            parsed[size++] = static_cast<uint8_t>(value >> 8);
+            parsed[size++] = static_cast<uint8_t>(value);
+            hexDigits = 0;
+            value = 0;
+            continue;
+        }
+
+        // The address ends with an IPv4 address
+        if (ch == '.' && size + 4 <= IPV6_BYTES && parseIPv4(ip.substr(token), parsed + size))
+        {
+            size += 4;
+            hexDigits = 0;
+            break;
+        }
+
+        return false;
+    }
+
+    if (hexDigits > 0)
+    {
+        if (size + 2 > IPV6_BYTES)
+        {
+            return false;
+        }
+        parsed[size++] = static_cast<uint8_t>(value >> 8);
+        parsed[size++] = static_cast<uint8_t>(value);
+    }
+
+    if (gap)
+    {
+        // The "::" must stand for one group at least
+        if (size == IPV6_BYTES)
+        {
+            return false;
+        }
+        const auto tail = size - gap.value();
+        std::memmove(parsed + IPV6_BYTES - tail, parsed + gap.value(), tail);
+        std::memset(parsed + gap.value(), 0, IPV6_BYTES - tail - gap.value());
+        size = IPV6_BYTES;
+    }
+
+    if (size != IPV6_BYTES)
+    {
+        return false;
+    }
+
+    std::memcpy(address, parsed, IPV6_BYTES);
+    return true;
+}
+
+bool checkStrIsIPv4(std::string_view ip)
 {
-    struct in_addr buf;
-    return inet_pton(AF_INET, ip.c_str(), &buf) == 1;
+    uint8_t buf[sizeof(in_addr)];
+    return parseIPv4(ip, buf);
 }
 
-bool checkStrIsIPv6(const std::string& ip)
+bool checkStrIsIPv6(std::string_view ip)
 {
-    struct in6_addr buf;
-    return inet_pton(AF_INET6, ip.c_str(), &buf) == 1;
+    uint8_t buf[sizeof(in6_addr)];
+    return parseIPv6(ip, buf);
 }
 
 bool isSpecialIPv4Address(const std::string& ip)
@@ -1,30 +1,17 @@
 #include "utils/stringUtils.hpp"
 
+#include <array>
+#include <cstdint>
+
 namespace base::utils::string
 {
 
 std::vector<std::string> split(std::string_view str, const char delimiter)
 {
     std::vector<std::string> ret;
-    if (!str.empty() && str[0] == delimiter)
-    {
-        str = str.substr(1);
-    }
-
-    while (true)
-    {
-        auto pos = str.find(delimiter);
-        if (pos == str.npos)
-        {
-            break;
-        }
-        ret.emplace_back(str.substr(0, pos));
-        str = str.substr(pos + 1);
-    }
-
-    if (!str.empty())
+    for (const auto part : splitView(str, delimiter))
     {
-        ret.emplace_back(str);
+        ret.emplace_back(part);
     }
 
     return ret;
@@ -131,6 +118,22 @@ std::string toLowerCase(std::string_view str)
     return temp;
 }
 
+void toUpperCaseInPlace(std::string& str)
+{
+    std::transform(std::begin(str),
+                   std::end(str),
+                   std::begin(str),
+                   [](std::string::value_type character) { return std::toupper(character); });
+}
+
+void toLowerCaseInPlace(std::string& str)
+{
+    std::transform(std::begin(str),
+                   std::end(str),
+                   std::begin(str),
+                   [](std::string::value_type character) { return std::tolower(character); });
+}
+
 bool replaceFirst(std::string& data, const std::string& toSearch, const std::string& toReplace)
 {
     auto pos {data.find(toSearch)};
@@ -207,13 +210,81 @@ bool replaceAll(std::string& data, const std::string_view toSearch, const std::s
     auto pos {data.find(toSearch)};
     const auto ret {std::string::npos != pos};
 
-    while (std::string::npos != pos)
+    // The replacements of the same size are overwritten in place. An empty search string matches at every position,
+    // it keeps the plain loop.
+    if (toSearch.empty() || toSearch.size() == toReplace.size())
     {
-        data.replace(pos, toSearch.size(), toReplace);
-        pos = data.find(toSearch, pos + toReplace.size());
+        while (std::string::npos != pos)
+        {
+            data.replace(pos, toSearch.size(), toReplace);
+            pos = data.find(toSearch, pos + toReplace.size());
+        }
+        return ret;
+    }
+
+    // Replacing in place would move the tail after each match, the result is built once instead
+    if (ret)
+    {
+        std::string result;
+        result.reserve(data.size());
+        std::size_t last {0};
+        while (std::string::npos != pos)
+        {
+            result.append(data, last, pos - last);
+            result.append(toReplace);
+            last = pos + toSearch.size();
+            pos = data.find(toSearch, last);
+        }
+        result.append(data, last, std::string::npos);
+        data.swap(result);
     }
 
     return ret;
 }
 
+namespace
+{
+constexpr uint8_t INVALID_NIBBLE = 0x10;
+
+constexpr std::array<uint8_t, 256> makeNibbleTable()
+{
+    std::array<uint8_t, 256> table {};
+    for (auto& nibble : table)
+    {
+        nibble = INVALID_NIBBLE;
+    }
+    for (auto c = '0'; c <= '9'; ++c)
+    {
+        table[static_cast<uint8_t>(c)] = c - '0';
+    }
+    for (auto c = 'a'; c <= 'f'; ++c)
+    {
+        table[static_cast<uint8_t>(c)] = c - 'a' + 10;
+        table[static_cast<uint8_t>(c - 'a' + 'A')] = c - 'a' + 10;
+    }
+    return table;
+}
+
+constexpr auto NIBBLE_TABLE = makeNibbleTable();
+} // namespace
+
+std::size_t decodeHex(std::string_view hex, char* out)
+{
+    const auto* in = reinterpret_cast<const uint8_t*>(hex.data());
+    const auto size = hex.size() & ~static_cast<std::size_t>(1);
+
+    for (std::size_t i = 0; i < size; i += 2)
+    {
+        const auto high = NIBBLE_TABLE[in[i]];
+        const auto low = NIBBLE_TABLE[in[i + 1]];
+        if ((high | low) & INVALID_NIBBLE)
+        {
+            return (high & INVALID_NIBBLE) ? i : i + 1;
+        }
+        *out++ = static_cast<char>((high << 4) | low);
+    }
+
+    return hex.size();
+}
+
 } // namespace base::utils::string
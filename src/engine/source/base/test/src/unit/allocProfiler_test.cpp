@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include <base/allocProfiler.hpp>
+
+using namespace base::allocprof;
+
+TEST(AllocProfilerTest, SameCounters)
+{
+    auto counters = base::allocprof::counters("policy/test/0", "decoder/a/0");
+    EXPECT_EQ(counters, base::allocprof::counters("policy/test/0", "decoder/a/0"));
+    EXPECT_NE(counters, base::allocprof::counters("policy/other/0", "decoder/a/0"));
+    EXPECT_EQ(counters->policy, "policy/test/0");
+    EXPECT_EQ(counters->name, "decoder/a/0");
+}
+
+TEST(AllocProfilerTest, EntriesAndReset)
+{
+    auto counters = base::allocprof::counters("policy/entries/0", "stage/decoder");
+    counters->events.store(2);
+    counters->allocations.store(10);
+    counters->bytes.store(100);
+
+    auto entries = base::allocprof::entries();
+    auto it = std::find_if(entries.begin(), entries.end(), [](const auto& e) { return e.policy == "policy/entries/0"; });
+    ASSERT_NE(it, entries.end());
+    EXPECT_EQ(it->name, "stage/decoder");
+    EXPECT_EQ(it->events, 2);
+    EXPECT_EQ(it->allocations, 10);
+    EXPECT_EQ(it->bytes, 100);
+
+    reset();
+    EXPECT_EQ(counters->events.load(), 0);
+    EXPECT_EQ(counters->allocations.load(), 0);
+    EXPECT_EQ(counters->bytes.load(), 0);
+}
+
+TEST(AllocProfilerTest, ExchangeCurrent)
+{
+    auto outer = base::allocprof::counters("policy/current/0", "outer");
+    auto inner = base::allocprof::counters("policy/current/0", "inner");
+
+    auto previous = exchangeCurrent(outer.get());
+    EXPECT_EQ(exchangeCurrent(inner.get()), outer.get());
+    auto value = std::make_unique<int64_t>(1);
+    EXPECT_EQ(exchangeCurrent(outer.get()), inner.get());
+    EXPECT_EQ(exchangeCurrent(previous), outer.get());
+
+    if constexpr (ENABLED)
+    {
+        EXPECT_EQ(inner->allocations.load(), 1);
+        EXPECT_EQ(inner->bytes.load(), sizeof(int64_t));
+        EXPECT_EQ(outer->allocations.load(), 0);
+        EXPECT_GT(threadAllocations(), 0);
+    }
+    else
+    {
+        EXPECT_EQ(inner->allocations.load(), 0);
+        EXPECT_EQ(threadAllocations(), 0);
+    }
+}
@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include <base/arenaAllocator.hpp>
+
+using namespace base::arena;
+
+namespace
+{
+Stats statsOf(Subsystem subsystem)
+{
+    auto entries = stats();
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const auto& e) { return e.subsystem == subsystem; });
+    return it == entries.end() ? Stats {} : *it;
+}
+
+// With ENGINE_ARENA_ALLOCATOR the test framework allocates from the arenas too, the counters are only lower bounds
+void expectCount(uint64_t expected, uint64_t actual)
+{
+    if (ENABLED)
+    {
+        EXPECT_GE(actual, expected);
+    }
+    else
+    {
+        EXPECT_EQ(actual, expected);
+    }
+}
+} // namespace
+
+TEST(ArenaAllocatorTest, ScopedSubsystem)
+{
+    EXPECT_EQ(current(), Subsystem::DEFAULT);
+    {
+        ScopedSubsystem router {Subsystem::ROUTER};
+        EXPECT_EQ(current(), Subsystem::ROUTER);
+        {
+            ScopedSubsystem api {Subsystem::API};
+            EXPECT_EQ(current(), Subsystem::API);
+        }
+        EXPECT_EQ(current(), Subsystem::ROUTER);
+    }
+    EXPECT_EQ(current(), Subsystem::DEFAULT);
+
+    // An invalid subsystem selects the default arena
+    auto previous = exchangeCurrent(Subsystem::COUNT);
+    EXPECT_EQ(current(), Subsystem::DEFAULT);
+    exchangeCurrent(previous);
+
+    EXPECT_EQ(subsystemName(Subsystem::ROUTER), "router");
+    EXPECT_EQ(subsystemName(Subsystem::BUILDER), "builder");
+    EXPECT_EQ(stats().size(), SUBSYSTEMS);
+}
+
+TEST(ArenaAllocatorTest, AllocateEverySize)
+{
+    ScopedSubsystem scoped {Subsystem::BUILDER};
+    const auto before = statsOf(Subsystem::BUILDER);
+
+    std::vector<std::pair<char*, std::size_t>> blocks;
+    for (std::size_t size : {0, 1, 15, 16, 17, 100, 1000, 4080, 8176, 8177, 20000, 1 << 20})
+    {
+        auto* ptr = static_cast<char*>(allocate(size));
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % ALIGNMENT, 0);
+        std::memset(ptr, static_cast<int>(size & 0xff), size);
+        blocks.emplace_back(ptr, size);
+    }
+
+    // The blocks do not overlap
+    for (const auto& [ptr, size] : blocks)
+    {
+        const auto fill = static_cast<char>(size & 0xff);
+        EXPECT_TRUE(std::all_of(ptr, ptr + size, [fill](char c) { return c == fill; }));
+    }
+
+    const auto during = statsOf(Subsystem::BUILDER);
+    expectCount(blocks.size(), during.allocations - before.allocations);
+    EXPECT_EQ(during.largeAllocations - before.largeAllocations, 3);
+    EXPECT_GT(during.bytesInUse, before.bytesInUse);
+    EXPECT_GE(during.bytesReserved, during.bytesInUse);
+
+    for (const auto& [ptr, size] : blocks)
+    {
+        deallocate(ptr);
+    }
+    deallocate(nullptr);
+
+    const auto after = statsOf(Subsystem::BUILDER);
+    expectCount(blocks.size(), after.deallocations - before.deallocations);
+    if (!ENABLED)
+    {
+        EXPECT_EQ(after.bytesInUse, before.bytesInUse);
+    }
+}
+
+TEST(ArenaAllocatorTest, BlocksAreReused)
+{
+    ScopedSubsystem scoped {Subsystem::API};
+    auto* first = allocate(64);
+    deallocate(first);
+    auto* second = allocate(64);
+    EXPECT_EQ(first, second);
+    deallocate(second);
+}
+
+TEST(ArenaAllocatorTest, SubsystemsDoNotShareBlocks)
+{
+    void* router {nullptr};
+    {
+        ScopedSubsystem scoped {Subsystem::ROUTER};
+        router = allocate(128);
+        deallocate(router);
+    }
+
+    ScopedSubsystem scoped {Subsystem::API};
+    auto* api = allocate(128);
+    EXPECT_NE(api, router);
+    deallocate(api);
+}
+
+TEST(ArenaAllocatorTest, RemoteFrees)
+{
+    constexpr std::size_t blocks {10000};
+    ScopedSubsystem scoped {Subsystem::ROUTER};
+    const auto before = statsOf(Subsystem::ROUTER);
+
+    std::vector<void*> allocated;
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+        allocated.push_back(allocate(24 + i % 500));
+    }
+
+    // Released by another thread, the owner takes them back on its next refills
+    std::thread releaser {[&]()
+                          {
+                              for (auto* ptr : allocated)
+                              {
+                                  deallocate(ptr);
+                              }
+                          }};
+    releaser.join();
+
+    std::vector<void*> again;
+    for (std::size_t i = 0; i < blocks; ++i)
+    {
+        again.push_back(allocate(24 + i % 500));
+    }
+    const auto during = statsOf(Subsystem::ROUTER);
+    expectCount(blocks, during.remoteFrees - before.remoteFrees);
+    expectCount(blocks, during.deallocations - before.deallocations);
+
+    for (auto* ptr : again)
+    {
+        deallocate(ptr);
+    }
+    if (!ENABLED)
+    {
+        EXPECT_EQ(statsOf(Subsystem::ROUTER).bytesInUse, before.bytesInUse);
+    }
+}
+
+TEST(ArenaAllocatorTest, ProducersAndConsumers)
+{
+    constexpr std::size_t threads {4};
+    constexpr std::size_t rounds {20000};
+
+    // Each thread allocates blocks freed by the next one, the caches of the exited threads are adopted
+    for (std::size_t iteration = 0; iteration < 2; ++iteration)
+    {
+        std::vector<std::vector<void*>> handoff(threads);
+        std::vector<std::thread> pool;
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            handoff[t].reserve(rounds);
+            pool.emplace_back(
+                [&, t]()
+                {
+                    ScopedSubsystem scoped {Subsystem::ROUTER};
+                    for (std::size_t i = 0; i < rounds; ++i)
+                    {
+                        auto* ptr = static_cast<char*>(allocate((i * 37 + t) % 3000));
+                        ptr[0] = static_cast<char>(t);
+                        handoff[t].push_back(ptr);
+                    }
+                });
+        }
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+        pool.clear();
+
+        for (std::size_t t = 0; t < threads; ++t)
+        {
+            pool.emplace_back(
+                [&, t]()
+                {
+                    const auto& blocks = handoff[(t + 1) % threads];
+                    for (auto* ptr : blocks)
+                    {
+                        EXPECT_EQ(static_cast<char*>(ptr)[0], static_cast<char>((t + 1) % threads));
+                        deallocate(ptr);
+                    }
+                });
+        }
+        for (auto& thread : pool)
+        {
+            thread.join();
+        }
+    }
+
+    EXPECT_GE(statsOf(Subsystem::ROUTER).caches, threads);
+}
+
+TEST(ArenaAllocatorTest, StandardContainers)
+{
+    ScopedSubsystem scoped {Subsystem::ROUTER};
+    const auto before = statsOf(Subsystem::ROUTER);
+    {
+        std::vector<int, Allocator<int>> numbers;
+        for (int i = 0; i < 1000; ++i)
+        {
+            numbers.push_back(i);
+        }
+        EXPECT_EQ(numbers[999], 999);
+
+        std::map<int, int, std::less<int>, Allocator<std::pair<const int, int>>> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i * 2);
+        }
+        EXPECT_EQ(map.at(50), 100);
+        EXPECT_GT(statsOf(Subsystem::ROUTER).allocations, before.allocations);
+    }
+    if (!ENABLED)
+    {
+        EXPECT_EQ(statsOf(Subsystem::ROUTER).bytesInUse, before.bytesInUse);
+    }
+
+    Allocator<int> ints;
+    EXPECT_THROW(ints.allocate(std::numeric_limits<std::size_t>::max()), std::bad_array_new_length);
+    EXPECT_TRUE(ints == Allocator<char> {});
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+
+#include <regex>
+#include <string>
+
+#include <base/utils/coarseClock.hpp>
+
+using namespace base::utils::time;
+
+TEST(CoarseClockTest, FormatSeconds)
+{
+    char buffer[ISO8601_SECONDS_SIZE];
+    ASSERT_TRUE(formatISO8601Seconds(0, buffer));
+    ASSERT_EQ(std::string(buffer, ISO8601_SECONDS_SIZE), "1970-01-01T00:00:00");
+    ASSERT_TRUE(formatISO8601Seconds(1700000000, buffer));
+    ASSERT_EQ(std::string(buffer, ISO8601_SECONDS_SIZE), "2023-11-14T22:13:20");
+    ASSERT_TRUE(formatISO8601Seconds(-1, buffer));
+    ASSERT_EQ(std::string(buffer, ISO8601_SECONDS_SIZE), "1969-12-31T23:59:59");
+    ASSERT_FALSE(formatISO8601Seconds(253402300800, buffer)); // Year 10000
+}
+
+TEST(CoarseClockTest, FollowsTheSystemClock)
+{
+    auto& clock = CoarseClock::instance();
+    const auto before = CoarseClock::preciseEpochMs();
+    std::this_thread::sleep_for(CoarseClock::RESOLUTION * 20);
+    const auto coarse = clock.epochMs();
+    const auto after = CoarseClock::preciseEpochMs();
+
+    ASSERT_GE(coarse, before);
+    ASSERT_LE(coarse, after);
+    ASSERT_EQ(clock.epochSeconds(), clock.epochMs() / 1000);
+}
+
+TEST(CoarseClockTest, ISO8601)
+{
+    auto& clock = CoarseClock::instance();
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto ms = clock.epochMs();
+        const std::string iso {clock.iso8601()};
+        ASSERT_TRUE(std::regex_match(iso, std::regex {R"(\d{4}-\d{2}-\d{2}T\d{2}:\d{2}:\d{2}\.\d{3}Z)"})) << iso;
+
+        char buffer[ISO8601_SECONDS_SIZE];
+        ASSERT_TRUE(formatISO8601Seconds(ms / 1000, buffer));
+        // The clock may have ticked to the next second between both reads
+        const auto next = CoarseClock::instance().epochMs();
+        if (ms / 1000 == next / 1000)
+        {
+            ASSERT_EQ(iso.substr(0, ISO8601_SECONDS_SIZE), std::string(buffer, ISO8601_SECONDS_SIZE));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(3));
+    }
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <thread>
+
+#include <pthread.h>
+
+#include <base/utils/cpuAffinity.hpp>
+
+using namespace utils::affinity;
+
+namespace
+{
+CpuSet currentCpus()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+
+    CpuSet cpus;
+    for (auto cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+    {
+        if (CPU_ISSET(cpu, &set))
+        {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+} // namespace
+
+TEST(CpuAffinity, ParseCpuSet)
+{
+    EXPECT_EQ(parseCpuSet(""), CpuSet {});
+    EXPECT_EQ(parseCpuSet("3"), CpuSet {3});
+    EXPECT_EQ(parseCpuSet("0-3"), (CpuSet {0, 1, 2, 3}));
+    EXPECT_EQ(parseCpuSet("8,0-2,1"), (CpuSet {0, 1, 2, 8}));
+    EXPECT_EQ(parseCpuSet("5-5"), CpuSet {5});
+}
+
+TEST(CpuAffinity, ParseCpuSetInvalid)
+{
+    EXPECT_THROW(parseCpuSet(","), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("1,"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("a"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("3-1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("1-"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet(" 1"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("100000"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("node"), std::invalid_argument);
+    EXPECT_THROW(parseCpuSet("node100000"), std::invalid_argument);
+}
+
+TEST(CpuAffinity, NodeCpus)
+{
+    if (!std::filesystem::exists("/sys/devices/system/node/node0/cpulist"))
+    {
+        GTEST_SKIP() << "No NUMA information in sysfs";
+    }
+
+    const auto cpus = nodeCpus(0);
+    EXPECT_FALSE(cpus.empty());
+    EXPECT_EQ(parseCpuSet("node0"), cpus);
+    EXPECT_THROW(nodeCpus(100000), std::invalid_argument);
+}
+
+TEST(CpuAffinity, PinThread)
+{
+    std::thread thread(
+        []()
+        {
+            const auto cpu = currentCpus().front();
+            EXPECT_FALSE(pinThread({}));
+            EXPECT_FALSE(pinThread({cpu}));
+            EXPECT_EQ(currentCpus(), CpuSet {cpu});
+
+            // The CPU does not exist
+            EXPECT_TRUE(pinThread({CPU_SETSIZE - 1}));
+        });
+    thread.join();
+}
+
+TEST(CpuAffinity, ScopedPin)
+{
+    std::thread thread(
+        []()
+        {
+            const auto previous = currentCpus();
+            {
+                ScopedPin pin({previous.back()});
+                EXPECT_EQ(currentCpus(), CpuSet {previous.back()});
+            }
+            EXPECT_EQ(currentCpus(), previous);
+        });
+    thread.join();
+}
@@ -128,3 +128,39 @@ INSTANTIATE_TEST_SUITE_P(DotPathTest,
                                            BuildsStrTuple("a\\.b", {"a.b"}, true),
                                            BuildsStrTuple("a\\.b.c", {"a.b", "c"}, true),
                                            BuildsStrTuple("a.b\\.c", {"a", "b.c"}, true)));
+
+TEST(DotPathTest, Interned)
+{
+    DotPath path {"a.b.c"};
+    DotPath same {std::string {"a.b.c"}};
+    DotPath fromParts {path.cbegin(), path.cend()};
+
+    // Paths of the same string share their parts
+    ASSERT_EQ(path.id(), same.id());
+    ASSERT_EQ(path.id(), fromParts.id());
+    ASSERT_EQ(&path.parts(), &same.parts());
+    ASSERT_NE(path.id(), DotPath("a.b").id());
+    ASSERT_EQ(std::hash<DotPath>()(path), std::hash<DotPath>()(same));
+    ASSERT_EQ(DotPath().id(), 0);
+
+    // Rejected paths are not interned
+    ASSERT_THROW(DotPath("a..b"), std::runtime_error);
+    ASSERT_THROW(DotPath("a..b"), std::runtime_error);
+}
+
+TEST(DotPathTest, InternTableReleasesEntries)
+{
+    base::InternTable table;
+    auto split = [](const std::string& str) { return std::vector<std::string> {str}; };
+
+    for (std::size_t i = 0; i < base::InternTable::MIN_PURGE * base::InternTable::SHARDS * 2; ++i)
+    {
+        table.intern(std::to_string(i), split);
+    }
+
+    // The expired entries are purged as the shards grow
+    ASSERT_LT(table.size(), base::InternTable::MIN_PURGE * base::InternTable::SHARDS * 2);
+
+    auto entry = table.intern("kept", split);
+    ASSERT_EQ(table.intern("kept", split), entry);
+}
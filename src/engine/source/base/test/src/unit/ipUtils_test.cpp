@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+
 #include <base/utils/ipUtils.hpp>
 
 TEST(IPv4ToUInt, Invalid_format)
@@ -69,6 +72,50 @@ TEST(IPv4MaskUInt, Valid_range)
     EXPECT_EQ(utils::ip::IPv4MaskUInt("0"), 0x0);
 }
 
+TEST(parseIPv4, Address)
+{
+    uint8_t address[4] {};
+    ASSERT_TRUE(utils::ip::parseIPv4("192.168.0.255", address));
+    EXPECT_EQ(address[0], 192);
+    EXPECT_EQ(address[1], 168);
+    EXPECT_EQ(address[2], 0);
+    EXPECT_EQ(address[3], 255);
+
+    // Parsed straight from the view, the text after it is not read
+    std::string_view text {"10.0.0.1 rest"};
+    ASSERT_TRUE(utils::ip::parseIPv4(text.substr(0, 8), address));
+    EXPECT_EQ(address[0], 10);
+    EXPECT_EQ(address[3], 1);
+
+    EXPECT_FALSE(utils::ip::parseIPv4("01.2.3.4", address));
+    EXPECT_FALSE(utils::ip::parseIPv4("1.2.3.4.", address));
+    EXPECT_FALSE(utils::ip::parseIPv4("1..3.4", address));
+    EXPECT_EQ(address[0], 10);
+}
+
+TEST(parseIPv6, Address)
+{
+    uint8_t address[16] {};
+    ASSERT_TRUE(utils::ip::parseIPv6("2001:db8::ff00:1", address));
+    const uint8_t expected[16] {0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0x00, 0, 1};
+    EXPECT_TRUE(std::equal(std::begin(address), std::end(address), std::begin(expected)));
+
+    ASSERT_TRUE(utils::ip::parseIPv6("::ffff:1.2.3.4", address));
+    EXPECT_EQ(address[10], 0xff);
+    EXPECT_EQ(address[11], 0xff);
+    EXPECT_EQ(address[12], 1);
+    EXPECT_EQ(address[15], 4);
+
+    std::string_view text {"::1]:80"};
+    ASSERT_TRUE(utils::ip::parseIPv6(text.substr(0, 3), address));
+    EXPECT_EQ(address[15], 1);
+
+    EXPECT_FALSE(utils::ip::parseIPv6("1:2:3:4:5:6:7:8::", address));
+    EXPECT_FALSE(utils::ip::parseIPv6(":1::", address));
+    EXPECT_FALSE(utils::ip::parseIPv6("1:", address));
+    EXPECT_FALSE(utils::ip::parseIPv6("12345::", address));
+}
+
 TEST(checkStrIsIPv4, Invalid_format)
 {
     EXPECT_FALSE(utils::ip::checkStrIsIPv4(""));
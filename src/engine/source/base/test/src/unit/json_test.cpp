@@ -5,6 +5,7 @@
 #include <string>
 
 #include <base/json.hpp>
+#include <base/jsonArena.hpp>
 #include <base/logging.hpp>
 
 #define GTEST_COUT std::cerr << "[          ] [ INFO ] "
@@ -632,6 +633,33 @@ TEST_F(JsonRuntime, Str)
     ASSERT_EQ(expected, doc.str());
 }
 
+TEST_F(JsonRuntime, WriteTo)
+{
+    std::string expected = "{\"nested\":{\"object\":{\"key\":\"value\"},\"array\":["
+                           "\"value\"],\"int\":123,\"real\":123.456,\"boolT\":true,"
+                           "\"boolF\":false,\"null\":null,\"string\":\"value\"}}";
+
+    Json doc {expected.c_str()};
+
+    // Appended to the previous content of the buffer
+    std::string buffer {"prefix "};
+    doc.writeTo(buffer);
+    ASSERT_EQ("prefix " + expected, buffer);
+
+    buffer.clear();
+    doc.writeTo(buffer);
+    ASSERT_EQ(doc.str(), buffer);
+}
+
+TEST_F(JsonRuntime, WriteToEscaped)
+{
+    Json doc {R"({"key":"quote \" backslash \\ newline \n tab \t ñ"})"};
+
+    std::string buffer;
+    doc.writeTo(buffer);
+    ASSERT_EQ(doc.str(), buffer);
+}
+
 // Checking basic functionality of str from path method
 TEST_F(JsonRuntime, strFromPath)
 {
@@ -1540,6 +1568,20 @@ TEST_F(JsonSettersTest, SetString)
     ASSERT_THROW(jObjString.setString("newValue", "object/key"), std::runtime_error);
 }
 
+TEST_F(JsonSettersTest, SetStringView)
+{
+    // Only the viewed characters are copied
+    const std::string source {"newValue and more"};
+    Json json {};
+    ASSERT_NO_THROW(json.setString(std::string_view(source).substr(0, 8), "/nested"));
+    ASSERT_EQ("newValue", json.getString("/nested").value());
+
+    // Null characters are kept
+    const std::string withNull {"a\0b", 3};
+    ASSERT_NO_THROW(json.setString(withNull, "/nested"));
+    ASSERT_EQ(withNull, json.getString("/nested").value());
+}
+
 TEST_F(JsonSettersTest, SetInt)
 {
     Json jObjInt {R"({
@@ -2605,3 +2647,288 @@ INSTANTIATE_TEST_SUITE_P(CheckDuplicateKey,
         "check": "$event == 2",
         "check": "$event.id == 2"
         })")));
+
+TEST_F(JsonStatic, CompileJsonPath)
+{
+    auto path = Json::compileJsonPath("a.b.c");
+    ASSERT_EQ(path.str(), "/a/b/c");
+    ASSERT_FALSE(path.isRoot());
+
+    auto root = Json::compileJsonPath(".");
+    ASSERT_TRUE(root.isRoot());
+
+    ASSERT_TRUE(Path().isRoot());
+    ASSERT_THROW(Path("invalid"), std::runtime_error);
+}
+
+TEST_F(JsonRuntime, PathAccessors)
+{
+    Json json {R"({"a": {"str": "value", "int": 1, "dbl": 1.5, "bool": true, "arr": [1, 2]}})"};
+    const Path strPath {"/a/str"};
+    const Path intPath {"/a/int"};
+    const Path dblPath {"/a/dbl"};
+    const Path boolPath {"/a/bool"};
+    const Path arrPath {"/a/arr"};
+    const Path missingPath {"/a/missing"};
+
+    ASSERT_TRUE(json.exists(strPath));
+    ASSERT_FALSE(json.exists(missingPath));
+
+    ASSERT_EQ(json.getString(strPath), "value");
+    ASSERT_FALSE(json.getString(intPath).has_value());
+    ASSERT_EQ(json.getStringView(strPath), "value");
+    ASSERT_FALSE(json.getStringView(intPath).has_value());
+    ASSERT_FALSE(json.getStringView(missingPath).has_value());
+    ASSERT_EQ(json.getInt(intPath), 1);
+    ASSERT_EQ(json.getIntAsInt64(intPath), 1);
+    ASSERT_EQ(json.getDouble(dblPath), 1.5);
+    ASSERT_EQ(json.getNumberAsDouble(intPath), 1.0);
+    ASSERT_EQ(json.getBool(boolPath), true);
+    ASSERT_EQ(json.getArray(arrPath).value().size(), 2);
+    ASSERT_EQ(json.size(arrPath), 2);
+    ASSERT_FALSE(json.getJson(missingPath).has_value());
+
+    ASSERT_TRUE(json.isString(strPath));
+    ASSERT_TRUE(json.isArray(arrPath));
+    ASSERT_FALSE(json.isObject(missingPath));
+    ASSERT_EQ(json.type(boolPath), Json::Type::Boolean);
+    ASSERT_THROW(json.type(missingPath), std::runtime_error);
+
+    json.setString("other", missingPath);
+    ASSERT_EQ(json.getString("/a/missing"), "other");
+    json.setInt64(10, intPath);
+    ASSERT_EQ(json.getInt64("/a/int"), 10);
+    json.appendString("3", arrPath);
+    ASSERT_EQ(json.size(arrPath), 3);
+
+    json.set(Path {"/b"}, strPath);
+    ASSERT_TRUE(json.equals(Path {"/b"}, strPath));
+    ASSERT_TRUE(json.erase(Path {"/b"}));
+    ASSERT_FALSE(json.exists(Path {"/b"}));
+}
+
+TEST_F(JsonRuntime, PathMemberSlots)
+{
+    const Path path {"/a/c/0"};
+    const Path missing {"/a/missing"};
+
+    // The member positions learned from an event are only hints for the next ones
+    Json first {R"({"a": {"b": 1, "c": [10]}})"};
+    Json reordered {R"({"z": 0, "a": {"c": [20], "b": 1}})"};
+    Json renamed {R"({"a": {"b": 1, "cc": [30]}})"};
+    for (auto i = 0; i < 2; ++i)
+    {
+        ASSERT_EQ(first.getIntAsInt64(path), 10);
+        ASSERT_EQ(reordered.getIntAsInt64(path), 20);
+        ASSERT_FALSE(renamed.exists(path));
+        ASSERT_FALSE(first.exists(missing));
+    }
+
+    // Copies keep working on their own hints
+    const auto copy = path;
+    ASSERT_EQ(first.getIntAsInt64(copy), 10);
+    ASSERT_EQ(reordered.getIntAsInt64(copy), 20);
+
+    // Writes go to the existing value or create it
+    reordered.setInt64(21, path);
+    ASSERT_EQ(reordered.getIntAsInt64(path), 21);
+    renamed.setString("new", Path {"/a/c"});
+    ASSERT_EQ(renamed.getString(Path {"/a/c"}), "new");
+    ASSERT_EQ(renamed.getIntAsInt64(Path {"/a/b"}), 1);
+}
+
+TEST_F(JsonRuntime, WideObjectMembers)
+{
+    // Wide enough to be searched through the member index
+    Json json;
+    for (auto i = 0; i < 40; ++i)
+    {
+        json.setInt(i, fmt::format("/wide/field{}", i));
+    }
+
+    const Path last {"/wide/field39"};
+    for (auto i = 0; i < 40; ++i)
+    {
+        ASSERT_EQ(json.getInt(fmt::format("/wide/field{}", i)), i);
+    }
+    ASSERT_EQ(json.getInt(last), 39);
+    ASSERT_FALSE(json.exists("/wide/missing"));
+
+    // The index follows the erased and added members
+    ASSERT_TRUE(json.erase("/wide/field3"));
+    json.setInt(100, "/wide/added");
+    ASSERT_FALSE(json.exists("/wide/field3"));
+    ASSERT_EQ(json.getInt("/wide/added"), 100);
+    ASSERT_EQ(json.getInt("/wide/field4"), 4);
+    ASSERT_EQ(json.getInt(last), 39);
+
+    json.setInt(39, "/wide/field3");
+    json.setInt(3, last);
+    ASSERT_EQ(json.getInt("/wide/field3"), 39);
+    ASSERT_EQ(json.getInt(last), 3);
+    ASSERT_EQ(json.getInt(Path {"/wide/field38"}), 38);
+}
+
+TEST(JsonArenaTest, DocumentOnArena)
+{
+    auto arena = std::make_shared<Arena>();
+    Json json {arena};
+    json.setObject();
+    json.setString("value", "/a/b");
+    ASSERT_EQ(arena.use_count(), 2);
+
+    // The arena follows the document when moved
+    Json moved {std::move(json)};
+    ASSERT_EQ(moved.getString("/a/b"), "value");
+    ASSERT_EQ(arena.use_count(), 2);
+
+    // Copies do not use the arena
+    Json copy {moved};
+    ASSERT_EQ(arena.use_count(), 2);
+    ASSERT_TRUE(copy == moved);
+}
+
+TEST(JsonArenaTest, PoolRecyclesReleasedArenas)
+{
+    ArenaPool pool {2};
+
+    auto first = std::make_shared<Json>(pool.acquire());
+    first->setString("first", "/field");
+    auto second = std::make_shared<Json>(pool.acquire());
+    ASSERT_EQ(pool.size(), 2);
+
+    // Pool is full and every arena is in use
+    ASSERT_FALSE(pool.acquire());
+
+    first.reset();
+    auto recycled = pool.acquire();
+    ASSERT_TRUE(recycled);
+    ASSERT_EQ(pool.size(), 2);
+
+    Json third {recycled};
+    third.setString("third", "/field");
+    ASSERT_EQ(third.getString("/field"), "third");
+    ASSERT_EQ(second->str(), "null");
+}
+
+TEST(JsonArenaTest, PoolInvalidSize)
+{
+    ASSERT_THROW(ArenaPool(0), std::runtime_error);
+    ASSERT_THROW(ArenaPool(1, 0), std::runtime_error);
+}
+
+TEST(JsonViewTest, ArrayView)
+{
+    Json json {R"({"array": [1, "two", {"three": 3}], "string": "value"})"};
+
+    auto array = json.getArrayView("/array");
+    ASSERT_TRUE(array);
+    ASSERT_EQ(array->size(), 3);
+    ASSERT_EQ((*array)[0].getIntAsInt64(), 1);
+    ASSERT_EQ((*array)[1].getStringView(), "two");
+    ASSERT_EQ((*array)[2].str(), R"({"three":3})");
+    ASSERT_EQ((*array)[2].copy(), Json {R"({"three":3})"});
+    ASSERT_TRUE(array->contains(Json {"\"two\""}));
+    ASSERT_FALSE(array->contains(Json {"2"}));
+
+    std::vector<Json> copies;
+    for (auto item : json.getArrayView(Path("/array")).value())
+    {
+        copies.emplace_back(item.copy());
+    }
+    ASSERT_EQ(copies, json.getArray("/array").value());
+
+    ASSERT_FALSE(json.getArrayView("/string"));
+    ASSERT_FALSE(json.getArrayView("/missing"));
+    ASSERT_THROW(json.getArrayView("invalid"), std::runtime_error);
+}
+
+TEST(JsonViewTest, ObjectView)
+{
+    Json json {R"({"object": {"a": 1, "b": [true]}, "string": "value"})"};
+
+    auto object = json.getObjectView("/object");
+    ASSERT_TRUE(object);
+    ASSERT_EQ(object->size(), 2);
+
+    std::vector<std::string> keys;
+    for (auto [key, value] : object.value())
+    {
+        keys.emplace_back(key);
+        if (key == "b")
+        {
+            auto array = value.getArray();
+            ASSERT_TRUE(array);
+            ASSERT_EQ((*array)[0].getBool(), true);
+        }
+    }
+    ASSERT_EQ(keys, (std::vector<std::string> {"a", "b"}));
+
+    auto view = json.getView(Path("/string"));
+    ASSERT_TRUE(view);
+    ASSERT_EQ(view->type(), Json::Type::String);
+    ASSERT_EQ(view->getString(), "value");
+    ASSERT_FALSE(view->getObject());
+    ASSERT_FALSE(json.getObjectView("/string"));
+    ASSERT_FALSE(json.getView("/missing"));
+}
+
+TEST(JsonViewTest, ValueSet)
+{
+    Json json {R"({"values": [1, 1.0, "1", {"a": 1, "b": [2]}, {"b": [2], "a": 1}, [1, 2], [2, 1], null, false]})"};
+    auto values = json.getArrayView("/values").value();
+
+    ValueSet set;
+    std::vector<bool> inserted;
+    for (auto value : values)
+    {
+        inserted.push_back(set.insert(value));
+    }
+    ASSERT_EQ(inserted, (std::vector<bool> {true, false, true, true, false, true, true, true, true}));
+    ASSERT_EQ(set.size(), 7);
+    ASSERT_EQ(ValueSet::hash(values[0].value()), ValueSet::hash(values[1].value()));
+    ASSERT_EQ(ValueSet::hash(values[3].value()), ValueSet::hash(values[4].value()));
+
+    // Past the linear limit the values are found by hash
+    Json wide {R"([])"};
+    for (auto i = 0; i < 64; ++i)
+    {
+        wide.appendString(fmt::format("value{}", i));
+    }
+    ValueSet wideSet;
+    for (auto value : wide.getArrayView().value())
+    {
+        ASSERT_TRUE(wideSet.insert(value));
+    }
+    for (auto value : wide.getArrayView().value())
+    {
+        ASSERT_TRUE(wideSet.contains(value));
+        ASSERT_FALSE(wideSet.insert(value));
+    }
+    ASSERT_FALSE(wideSet.contains(JsonConstView {Json {R"("value64")"}}));
+    ASSERT_EQ(wideSet.size(), 64);
+}
+
+TEST_F(JsonSettersTest, MergeArrayWideDedupes)
+{
+    Json jArrayDst {R"([])"};
+    Json jArraySrc {R"([])"};
+    Json jArrayExpected {R"([])"};
+    for (auto i = 0; i < 40; ++i)
+    {
+        jArrayDst.appendString(fmt::format("value{}", i));
+        jArrayExpected.appendString(fmt::format("value{}", i));
+    }
+    for (auto i = 20; i < 60; ++i)
+    {
+        jArraySrc.appendString(fmt::format("value{}", i));
+        jArraySrc.appendString(fmt::format("value{}", i));
+    }
+    for (auto i = 40; i < 60; ++i)
+    {
+        jArrayExpected.appendString(fmt::format("value{}", i));
+    }
+
+    ASSERT_NO_THROW(jArrayDst.merge(json::NOT_RECURSIVE, jArraySrc));
+    ASSERT_EQ(jArrayDst, jArrayExpected);
+}
@@ -64,6 +64,70 @@ TEST_F(LoggerTest, LogGetSomeInstance)
     ASSERT_EQ(logger, someLogger);
 }
 
+TEST_F(LoggerTest, LogDedicatedThreads)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {
+        .filePath = m_tmpPath, .level = logging::Level::Info, .dedicatedThreads = 1, .queueSize = 128}));
+    for (auto i = 0; i < 100; ++i)
+    {
+        LOG_INFO("Async message {}", i);
+    }
+
+    // Stopping flushes the queued messages
+    logging::stop();
+    auto fileContent = readFileContents(m_tmpPath);
+    EXPECT_NE(fileContent.find("Async message 0"), std::string::npos);
+    EXPECT_NE(fileContent.find("Async message 99"), std::string::npos);
+}
+
+TEST_F(LoggerTest, LogFilteredArgumentsNotEvaluated)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Err}));
+    auto evaluated = 0;
+    auto arg = [&evaluated]()
+    {
+        ++evaluated;
+        return "arg";
+    };
+
+    LOG_DEBUG("Filtered {}", arg());
+    LOG_ERROR("Logged {}", arg());
+    EXPECT_EQ(evaluated, 1);
+}
+
+TEST_F(LoggerTest, LogRateLimited)
+{
+    ASSERT_NO_THROW(logging::start(logging::LoggingConfig {.filePath = m_tmpPath, .level = logging::Level::Warn}));
+    for (auto i = 0; i < 1000; ++i)
+    {
+        LOG_WARNING_LIMITED("Flooded message {}", i);
+    }
+
+    auto fileContent = readFileContents(m_tmpPath);
+    EXPECT_NE(fileContent.find("Flooded message 0"), std::string::npos);
+
+    // The loop may cross into a second window
+    std::regex flooded {"Flooded message"};
+    auto logged = std::distance(std::sregex_iterator(fileContent.begin(), fileContent.end(), flooded),
+                                std::sregex_iterator());
+    EXPECT_LE(logged, 2 * logging::DEFAULT_LOG_RATE_LIMIT);
+}
+
+TEST(RateLimitTest, AllowAndSuppressed)
+{
+    logging::RateLimit rateLimit;
+    auto allowed = 0;
+    for (auto i = 0; i < 10; ++i)
+    {
+        allowed += rateLimit.allow(3) ? 1 : 0;
+    }
+
+    // The window may change in the middle of the loop
+    EXPECT_GE(allowed, 3);
+    EXPECT_EQ(rateLimit.takeSuppressed(), 10 - allowed);
+    EXPECT_EQ(rateLimit.takeSuppressed(), 0);
+}
+
 class LoggerTestLevels : public ::testing::TestWithParam<logging::Level>
 {
 public:
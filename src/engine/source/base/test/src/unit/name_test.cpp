@@ -127,3 +127,29 @@ TEST_F(NameTest, FullName)
                           base::Name::SEPARATOR_S,
                           base::Name::SEPARATOR_S));
 }
+
+TEST_F(NameTest, Interned)
+{
+    base::Name name ("type/name/version");
+    base::Name sameString ("type/name/version");
+    base::Name sameParts ({"type", "name", "version"});
+    base::Name other ("type/name/other");
+
+    // Names of the same string share their parts
+    ASSERT_EQ(name.id(), sameString.id());
+    ASSERT_EQ(name.id(), sameParts.id());
+    ASSERT_EQ(&name.parts(), &sameString.parts());
+    ASSERT_NE(name.id(), other.id());
+    ASSERT_EQ(std::hash<base::Name>()(name), std::hash<base::Name>()(sameParts));
+
+    auto copy = name;
+    ASSERT_EQ(copy.id(), name.id());
+    ASSERT_EQ(copy.str(), "type/name/version");
+
+    // Parts with separators can not be split back from their string
+    base::Name withSeparator (std::vector<std::string> {"type/name", "version"});
+    ASSERT_NE(withSeparator.id(), base::Name("type/name/version").id());
+    ASSERT_NE(withSeparator, name);
+    ASSERT_EQ(withSeparator, base::Name(std::vector<std::string> {"type/name", "version"}));
+    ASSERT_EQ(withSeparator.parts().size(), 2);
+}
@@ -1,4 +1,5 @@
 #include <string>
+#include <string_view>
 
 #include <gtest/gtest.h>
 
@@ -63,6 +64,17 @@ TEST(parseWazuhEvent, InvalidShortEvent)
     ASSERT_THROW(base::parseEvent::parseWazuhEvent(event), std::runtime_error);
 }
 
+TEST(parseWazuhEvent, NonNullTerminatedView)
+{
+    const std::string buffer {std::string {} + TEST_QUEUE_ID + ":" + TEST_IPV4 + ":" + TEST_ORIGINAL_LOG + "trailing"};
+    const std::string_view event {buffer.data(), buffer.size() - std::string_view {"trailing"}.size()};
+
+    auto e = base::parseEvent::parseWazuhEvent(event);
+
+    EXPECT_EQ(e->getString(base::parseEvent::EVENT_LOCATION_ID).value(), TEST_IPV4);
+    EXPECT_EQ(e->getString(base::parseEvent::EVENT_MESSAGE_ID).value(), TEST_ORIGINAL_LOG);
+}
+
 TEST(parseWazuhEvent, Forms)
 {
     std::vector<UseCase> useCases = {
@@ -106,3 +118,33 @@ TEST(parseWazuhEvent, Forms)
         execute(useCase);
     }
 }
+
+TEST(parseWazuhEvent, LocationSource)
+{
+    const std::string agentLocation {std::string {} + "[" + TEST_AGENT_ID + "] (" + TEST_AGENT_NAME + ") "
+                                     + TEST_AGENT_REGISTEREDIP_TXT + "->" + TEST_ORIGINAL_ROUTE};
+    EXPECT_EQ(base::parseEvent::locationSource(agentLocation), TEST_AGENT_ID);
+    EXPECT_EQ(base::parseEvent::locationSource(TEST_ORIGINAL_ROUTE), TEST_ORIGINAL_ROUTE);
+    EXPECT_EQ(base::parseEvent::locationSource("[unterminated"), "[unterminated");
+    EXPECT_EQ(base::parseEvent::locationSource(""), "");
+}
+
+TEST(parseWazuhEvent, SourceHash)
+{
+    const std::string agent {std::string {} + "[" + TEST_AGENT_ID + "] (" + TEST_AGENT_NAME + ") "};
+    auto first = base::parseEvent::parseWazuhEvent(std::string {} + TEST_QUEUE_ID + ":" + agent
+                                                   + TEST_AGENT_REGISTEREDIP_TXT + "->" + TEST_ORIGINAL_ROUTE + ":log");
+    auto second = base::parseEvent::parseWazuhEvent(std::string {} + TEST_QUEUE_ID + ":" + agent + TEST_IPV4
+                                                    + "->/other/route:log");
+    auto local = base::parseEvent::parseWazuhEvent(std::string {} + TEST_QUEUE_ID + ":" + TEST_ORIGINAL_ROUTE + ":log");
+
+    EXPECT_EQ(base::parseEvent::sourceHash(first), base::parseEvent::sourceHash(second));
+    EXPECT_EQ(base::parseEvent::sourceHash(local), std::hash<std::string_view> {}(TEST_ORIGINAL_ROUTE));
+}
+
+TEST(parseWazuhEvent, QueueId)
+{
+    auto event = base::parseEvent::parseWazuhEvent(std::string {} + TEST_QUEUE_ID + ":" + TEST_ORIGINAL_ROUTE + ":log");
+    EXPECT_EQ(base::parseEvent::queueId(event), TEST_QUEUE_ID);
+    EXPECT_EQ(base::parseEvent::queueId(std::make_shared<json::Json>(R"({})")), '\0');
+}
@@ -147,3 +147,22 @@ TEST(Result, MakeFailure)
     ASSERT_TRUE(result.failure());
     ASSERT_FALSE(result.success());
 }
+
+TEST(Result, PopTrace)
+{
+    Result<int> result {0, "test", true};
+    ASSERT_EQ(result.popTrace(), "test");
+}
+
+TEST(Result, Tracing)
+{
+    auto& subscriptions = traceSubscriptions();
+    const auto before = subscriptions.load();
+
+    subscriptions.store(0);
+    ASSERT_FALSE(tracing());
+    subscriptions.fetch_add(1);
+    ASSERT_TRUE(tracing());
+
+    subscriptions.store(before);
+}
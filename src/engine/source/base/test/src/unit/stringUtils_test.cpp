@@ -61,6 +61,31 @@ TEST(split, ok_delimiter)
     ASSERT_EQ(result, expected);
 }
 
+TEST(splitView, SameAsSplit)
+{
+    for (const std::string test : {"", "/", "test", "/value1/value2/", "//value1//value2//", "a/b/c"})
+    {
+        const auto parts = base::utils::string::splitView(test, '/');
+        std::vector<std::string> result(parts.begin(), parts.end());
+        ASSERT_EQ(result, base::utils::string::split(test, '/')) << "Input: " << test;
+    }
+}
+
+TEST(splitView, ViewsOfTheInput)
+{
+    std::string test = "value1,value2";
+    auto it = base::utils::string::splitView(test, ',').begin();
+    ASSERT_EQ(it->data(), test.data());
+    ASSERT_EQ(*++it, "value2");
+    ASSERT_EQ(it->data(), test.data() + 7);
+}
+
+TEST(splitView, Front)
+{
+    ASSERT_EQ(base::utils::string::splitView("hash scan", ' ').front(), "hash");
+    ASSERT_EQ(base::utils::string::splitView("", ' ').front(), "");
+}
+
 TEST(splitMulti, ThreeDelimiters)
 {
     std::string input = "this is-a test to split by - and ,,where-are included in the result";
@@ -250,3 +275,55 @@ TEST(splitEscaped, EcapeEscapedChar)
     std::vector<std::string> result = base::utils::string::splitEscaped(input, '!', '#');
     ASSERT_EQ(result, expected);
 }
+
+TEST(replaceAll, DifferentSizes)
+{
+    std::string data = "a.b.c";
+    ASSERT_TRUE(base::utils::string::replaceAll(data, ".", "::"));
+    ASSERT_EQ(data, "a::b::c");
+    ASSERT_TRUE(base::utils::string::replaceAll(data, "::", ""));
+    ASSERT_EQ(data, "abc");
+
+    // The replacements are not searched again
+    data = "aaa";
+    ASSERT_TRUE(base::utils::string::replaceAll(data, "a", "aa"));
+    ASSERT_EQ(data, "aaaaaa");
+    ASSERT_FALSE(base::utils::string::replaceAll(data, "b", "c"));
+    ASSERT_EQ(data, "aaaaaa");
+}
+
+TEST(replaceAll, SameSize)
+{
+    std::string data = "a-b-c";
+    ASSERT_TRUE(base::utils::string::replaceAll(data, "-", "+"));
+    ASSERT_EQ(data, "a+b+c");
+}
+
+TEST(caseInPlace, Success)
+{
+    std::string data = "Hello World 1";
+    base::utils::string::toLowerCaseInPlace(data);
+    ASSERT_EQ(data, "hello world 1");
+    base::utils::string::toUpperCaseInPlace(data);
+    ASSERT_EQ(data, "HELLO WORLD 1");
+}
+
+TEST(decodeHex, Success)
+{
+    std::string result(12, '\0');
+    ASSERT_EQ(base::utils::string::decodeHex("48656C6C6F20776f726c6421", result.data()), 24);
+    ASSERT_EQ(result, "Hello world!");
+}
+
+TEST(decodeHex, Empty)
+{
+    ASSERT_EQ(base::utils::string::decodeHex("", nullptr), 0);
+}
+
+TEST(decodeHex, InvalidDigit)
+{
+    std::string result(3, '\0');
+    ASSERT_EQ(base::utils::string::decodeHex("48P56C", result.data()), 2);
+    ASSERT_EQ(base::utils::string::decodeHex("4865CX", result.data()), 5);
+    ASSERT_EQ(base::utils::string::decodeHex("0x48", result.data()), 1);
+}
@@ -164,3 +164,18 @@ TEST(WazuhResponse, validateErrorInvalidDataNull)
     const base::utils::wazuhProtocol::WazuhResponse wresponse {jdata, error, message};
     EXPECT_FALSE(wresponse.isValid());
 }
+
+TEST(WazuhResponse, fromSerialized)
+{
+    auto wresponse = base::utils::wazuhProtocol::WazuhResponse::fromSerialized(R"({"test":"data"})");
+    EXPECT_EQ(wresponse.toString(), R"({"data":{"test":"data"},"error":0})");
+    EXPECT_EQ(wresponse.data(), json::Json {R"({"test": "data"})"});
+    EXPECT_TRUE(wresponse.isValid());
+
+    wresponse.message("test message");
+    EXPECT_EQ(wresponse.toString(), R"({"data":{"test":"data"},"error":0,"message":"test message"})");
+
+    // Setting the data replaces the serialized one
+    wresponse.data(json::Json {R"([1])"});
+    EXPECT_EQ(wresponse.toString(), R"({"data":[1],"error":0,"message":"test message"})");
+}
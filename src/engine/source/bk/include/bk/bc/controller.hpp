@@ -0,0 +1,166 @@
+#ifndef _BK_BC_CONTROLLER_HPP
+#define _BK_BC_CONTROLLER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <bk/icontroller.hpp>
+#include <base/expression.hpp>
+
+#include <base/baseTypes.hpp>
+
+namespace bk::bc
+{
+namespace detail
+{
+class Tracer;
+} // namespace detail
+
+/**
+ * @brief Operation codes of the program.
+ *
+ * The program has a single status register, holding the result of the last evaluated expression.
+ */
+enum class OpCode : std::uint8_t
+{
+    TERM,          ///< Run the term over the event and store its result in the status
+    JUMP_IF_FALSE, ///< Jump to the target if the status is false
+    JUMP_IF_TRUE,  ///< Jump to the target if the status is true
+    SET_TRUE       ///< Set the status to true
+};
+
+/**
+ * @brief Instruction of the program.
+ */
+struct Instruction
+{
+    OpCode code;                                     ///< Operation code
+    std::size_t target;                              ///< Next instruction if the jump is taken (jumps only)
+    base::EngineOp op;                               ///< Operation to run (terms only)
+    std::shared_ptr<const detail::Tracer> publisher; ///< Publisher of the trace, may be empty (terms only)
+    std::string name;                                ///< Name of the expression, used to print the program
+};
+
+/**
+ * @brief Backend that lowers the expression tree into a flat program and runs it in a loop.
+ *
+ * And, Or, Implication, Chain and Broadcast operations are compiled into forward jumps, so ingesting an event does
+ * not walk the expression tree nor any intermediate graph. Broadcast operands are run sequentially, as a chain.
+ */
+class Controller final : public IController
+{
+private:
+    class TracerImpl; ///< Implementation of the trace
+
+    std::unordered_map<std::string, std::shared_ptr<TracerImpl>> m_traces; ///< Traces
+    std::unordered_set<std::string> m_traceables;                          ///< Traceables
+    base::Expression m_expression;                                         ///< Expression
+
+    std::vector<Instruction> m_program;  ///< Compiled expression
+    std::function<void()> m_endCallback; ///< Callback to call when the program is finished
+
+    /**
+     * @brief Run the program over the event.
+     *
+     * @param event event to process, it is moved into each term and taken back from its result
+     */
+    void run(base::Event& event) const;
+
+public:
+    Controller() = delete;
+    Controller(const Controller&) = delete;
+
+    ~Controller() = default;
+
+    /**
+     * @brief Construct a new Controller from an expression and a set of traceables
+     *
+     * @param expression expression to build
+     * @param traceables traceables expressions
+     * @param endCallback callback to call when the expression is finished
+     * @throw std::runtime_error if the expression is not supported
+     */
+    Controller(const base::Expression& expression,
+               const std::unordered_set<std::string>& traceables,
+               const std::function<void()>& endCallback = nullptr);
+
+    /**
+     * @copydoc bk::IController::ingest
+     */
+    void ingest(base::Event&& event) override { run(event); }
+
+    /**
+     * @copydoc bk::IController::ingestGet
+     */
+    base::Event ingestGet(base::Event&& event) override
+    {
+        run(event);
+        return std::move(event);
+    };
+
+    /**
+     * @copydoc bk::IController::start
+     */
+    void start() override {}
+
+    /**
+     * @copydoc bk::IController::stop
+     */
+    void stop() override {}
+
+    /**
+     * @copydoc bk::IController::isAviable
+     */
+    inline bool isAviable() const override { return true; }
+
+    /**
+     * @copydoc bk::IController::printGraph
+     *
+     * @note The program listing is printed instead of a graph.
+     */
+    std::string printGraph() const override;
+
+    /**
+     * @copydoc bk::IController::getTraceables
+     */
+    const std::unordered_set<std::string>& getTraceables() const override { return m_traceables; }
+
+    /**
+     * @copydoc bk::IController::getTraces
+     */
+    base::RespOrError<Subscription> subscribe(const std::string& traceable, const Subscriber& subscriber) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribe
+     */
+    void unsubscribe(const std::string& traceable, Subscription subscription) override;
+
+    /**
+     * @copydoc bk::IController::unsubscribeAll
+     */
+    void unsubscribeAll() override;
+};
+
+class ControllerMaker : public IControllerMaker
+{
+public:
+    /**
+     * @copydoc bk::IControllerMaker::create
+     */
+    std::shared_ptr<IController> create(const base::Expression& expression,
+                                        const std::unordered_set<std::string>& traceables,
+                                        const std::function<void()>& endCallback) override
+    {
+        return std::make_shared<Controller>(expression, traceables, endCallback);
+    }
+};
+
+} // namespace bk::bc
+
+#endif // _BK_BC_CONTROLLER_HPP
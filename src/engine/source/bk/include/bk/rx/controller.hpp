@@ -7,7 +7,9 @@
 
 #include <rxcpp/rx.hpp>
 
+#include <bk/deadline.hpp>
 #include <bk/icontroller.hpp>
+#include <bk/latency.hpp>
 #include <base/expression.hpp>
 
 #include <base/baseTypes.hpp>
@@ -38,6 +40,32 @@ private:
     rxcpp::subscriber<RxEvent> m_policyInput;
     rxcpp::observable<RxEvent> m_policyOutput;
 
+    bk::detail::LatencySampler m_sampler; ///< Decides which events are timed
+    std::shared_ptr<bool> m_sampled;      ///< Set while a timed event is processed
+
+    std::shared_ptr<bk::detail::Deadline> m_deadline; ///< Deadline of the event being processed, nullptr if disabled
+    DeadlineHandler m_onExceeded;                     ///< Handler of the events that exceed their budget
+
+    /**
+     * @brief Process an event, within its budget if the deadline is enabled
+     */
+    void process(const RxEvent& rxEvent)
+    {
+        *m_sampled = m_sampler.next();
+        if (m_deadline == nullptr)
+        {
+            m_policyInput.on_next(rxEvent);
+            return;
+        }
+
+        m_deadline->arm();
+        m_policyInput.on_next(rxEvent);
+        if (m_deadline->exceeded() && m_onExceeded != nullptr)
+        {
+            m_onExceeded(m_expression->getName(), m_deadline->expression(), m_deadline->helper(), rxEvent->payload());
+        }
+    }
+
 public:
     Controller() = delete;
     Controller(const Controller&) = delete;
@@ -50,10 +78,14 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param latency options of the sampled latency instrumentation, disabled by default
+     * @param deadline options of the per event deadline, disabled by default
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()>& endCallback = nullptr);
+               const std::function<void()>& endCallback = nullptr,
+               const LatencyOptions& latency = {},
+               const DeadlineOptions& deadline = {});
 
     /**
      * @copydoc bk::IController::ingest
@@ -64,7 +96,7 @@ public:
         {
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
-            m_policyInput.on_next(rxEvent);
+            process(rxEvent);
         }
     }
 
@@ -77,7 +109,7 @@ public:
         {
             RxEvent rxEvent =
                 std::make_shared<base::result::Result<base::Event>>(base::result::makeSuccess(std::move(event)));
-            m_policyInput.on_next(rxEvent);
+            process(rxEvent);
             return rxEvent->popPayload();
         }
 
@@ -133,7 +165,23 @@ public:
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    LatencyOptions m_latency;   ///< Latency instrumentation of the created controllers
+    DeadlineOptions m_deadline; ///< Deadline of the events of the created controllers
+
 public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param latency options of the sampled latency instrumentation of the created controllers
+     * @param deadline options of the per event deadline of the created controllers
+     */
+    explicit ControllerMaker(LatencyOptions latency = {}, DeadlineOptions deadline = {})
+        : m_latency(std::move(latency))
+        , m_deadline(std::move(deadline))
+    {
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -141,7 +189,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_latency, m_deadline);
     }
 };
 
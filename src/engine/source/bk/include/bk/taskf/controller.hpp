@@ -8,11 +8,21 @@
 #include <taskflow/taskflow.hpp>
 
 #include <bk/icontroller.hpp>
+#include <bk/latency.hpp>
 #include <base/expression.hpp>
 
 namespace bk::taskf
 {
 
+/**
+ * @brief Execution mode of the taskflow controllers.
+ */
+enum class ExecutionMode
+{
+    SERIAL, ///< Each controller runs its graph on its own single thread executor
+    SHARED  ///< Controllers share a multi thread executor, so the broadcast operands run in parallel
+};
+
 class Controller final : public IController
 {
 private:
@@ -22,11 +32,14 @@ private:
     std::unordered_set<std::string> m_traceables;                          ///< Traceables
     base::Expression m_expression;                                         ///< Expression
 
-    tf::Taskflow m_tf;       ///< Taskflow
-    tf::Executor m_executor; ///< Executor
+    tf::Taskflow m_tf;                        ///< Taskflow
+    std::shared_ptr<tf::Executor> m_executor; ///< Executor, may be shared with other controllers
 
     base::Event m_event; ///< Shared event between the tasks
 
+    bk::detail::LatencySampler m_sampler; ///< Decides which events are timed
+    bool m_sampled;                       ///< Set while a timed event is processed, shared between the tasks
+
 public:
     Controller() = delete;
     Controller(const Controller&) = delete;
@@ -39,10 +52,18 @@ public:
      * @param expression expression to build
      * @param traceables traceables expressions
      * @param endCallback callback to call when the expression is finished
+     * @param executor executor to run the expression graph, if nullptr the controller uses its own single thread
+     * executor (the graph runs serially)
+     * @param latency options of the sampled latency instrumentation, disabled by default
+     *
+     * @note With a multi thread executor the operands of a broadcast run in parallel over the same event, so they
+     * must not modify it (i.e. outputs).
      */
     Controller(const base::Expression& expression,
                const std::unordered_set<std::string>& traceables,
-               const std::function<void()> endCallback = nullptr);
+               const std::function<void()> endCallback = nullptr,
+               std::shared_ptr<tf::Executor> executor = nullptr,
+               const LatencyOptions& latency = {});
 
     /**
      * @copydoc bk::IController::ingest
@@ -50,7 +71,8 @@ public:
     void ingest(base::Event&& event) override
     {
         m_event = std::move(event);
-        m_executor.run(m_tf).wait();
+        m_sampled = m_sampler.next();
+        m_executor->run(m_tf).wait();
     }
 
     /**
@@ -105,7 +127,31 @@ public:
 
 class ControllerMaker : public IControllerMaker
 {
+private:
+    std::shared_ptr<tf::Executor> m_executor; ///< Executor shared by the controllers (SHARED mode only)
+    LatencyOptions m_latency;                 ///< Latency instrumentation of the created controllers
+
 public:
+    /**
+     * @brief Construct a new Controller Maker
+     *
+     * @param mode execution mode of the created controllers
+     * @param workers number of threads of the shared executor, 0 to use the hardware concurrency. Ignored in
+     * SERIAL mode
+     * @param latency options of the sampled latency instrumentation of the created controllers
+     */
+    explicit ControllerMaker(ExecutionMode mode = ExecutionMode::SERIAL,
+                             std::size_t workers = 0,
+                             LatencyOptions latency = {})
+        : m_executor {nullptr}
+        , m_latency {std::move(latency)}
+    {
+        if (mode == ExecutionMode::SHARED)
+        {
+            m_executor = workers == 0 ? std::make_shared<tf::Executor>() : std::make_shared<tf::Executor>(workers);
+        }
+    }
+
     /**
      * @copydoc bk::IControllerMaker::create
      */
@@ -113,7 +159,7 @@ public:
                                         const std::unordered_set<std::string>& traceables,
                                         const std::function<void()>& endCallback) override
     {
-        return std::make_shared<Controller>(expression, traceables, endCallback);
+        return std::make_shared<Controller>(expression, traceables, endCallback, m_executor, m_latency);
     }
 };
 
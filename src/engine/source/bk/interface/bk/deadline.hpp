@@ -0,0 +1,166 @@
+#ifndef _BK_DEADLINE_HPP
+#define _BK_DEADLINE_HPP
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_set>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+namespace bk
+{
+
+/**
+ * @brief Where the deadline of an event is checked, each level includes the previous ones.
+ */
+enum class DeadlineGranularity
+{
+    STAGE,  ///< After each operand of the root expression (the decoder, rule and output stages)
+    ASSET,  ///< After each traceable (the assets), to find the asset that exceeded the budget
+    HELPER, ///< After each term (the helpers), to find the helper that exceeded the budget
+};
+
+/**
+ * @brief Called with an event that exceeded its budget, instead of the rest of the expression.
+ *
+ * The arguments are the root expression (the policy), the innermost checked expression that was running when the
+ * budget ran out (a stage or an asset), the helper if the granularity is HELPER and the event as processed so far.
+ */
+using DeadlineHandler = std::function<void(
+    const std::string& root, const std::string& expression, const std::string& helper, const base::Event& event)>;
+
+/**
+ * @brief Options of the per event processing deadline of the controllers.
+ *
+ * The budget is enforced cooperatively: the clock is read at the checked expressions and, once the budget is exceeded,
+ * the remaining stages and assets are skipped and the event is handed to the handler. A helper that runs for seconds
+ * is not interrupted, but it does not hold the event in the rest of the policy.
+ */
+struct DeadlineOptions
+{
+    std::chrono::microseconds budget {0};                         ///< Budget of each event, 0 disables the deadline
+    DeadlineGranularity granularity {DeadlineGranularity::ASSET}; ///< Where the clock is read
+    DeadlineHandler onExceeded;                                   ///< Handler of the events that exceed the budget
+
+    bool enabled() const { return budget.count() > 0; }
+};
+
+namespace detail
+{
+
+/**
+ * @brief Deadline of the event being processed by a controller.
+ *
+ * @note this is not thread-safe, each controller owns one.
+ */
+class Deadline
+{
+private:
+    std::chrono::microseconds m_budget;               ///< Budget of each event
+    std::chrono::steady_clock::time_point m_deadline; ///< Deadline of the current event
+    bool m_exceeded;                                  ///< The current event exceeded its budget
+    bool m_located;                                   ///< The expression that exceeded the budget is known
+    std::string m_expression;                         ///< Expression that exceeded the budget
+    std::string m_helper;                             ///< Helper that exceeded the budget
+
+public:
+    explicit Deadline(std::chrono::microseconds budget)
+        : m_budget(budget)
+        , m_deadline()
+        , m_exceeded(false)
+        , m_located(false)
+    {
+    }
+
+    /**
+     * @brief Start the budget of a new event.
+     */
+    void arm()
+    {
+        m_deadline = std::chrono::steady_clock::now() + m_budget;
+        m_exceeded = false;
+        m_located = false;
+    }
+
+    bool exceeded() const { return m_exceeded; }
+
+    /**
+     * @brief Check the deadline once a checked expression is done, the first one to find it exceeded is recorded.
+     *
+     * The innermost expressions are done first, so the recorded one is the innermost that was running.
+     */
+    void leave(const std::string& expression)
+    {
+        if (!m_exceeded)
+        {
+            if (std::chrono::steady_clock::now() < m_deadline)
+            {
+                return;
+            }
+            m_exceeded = true;
+            m_helper.clear();
+        }
+
+        if (!m_located)
+        {
+            m_located = true;
+            m_expression = expression;
+        }
+    }
+
+    /**
+     * @brief Check the deadline once a helper is done, the one that finds it exceeded is recorded.
+     */
+    void leaveHelper(const std::string& helper)
+    {
+        if (!m_exceeded && std::chrono::steady_clock::now() >= m_deadline)
+        {
+            m_exceeded = true;
+            m_helper = helper;
+        }
+    }
+
+    const std::string& expression() const
+    {
+        static const std::string none;
+        return m_located ? m_expression : none;
+    }
+    const std::string& helper() const { return m_helper; }
+};
+
+/**
+ * @brief Get the names of the expressions where the deadline is checked: the operands of the root and, from the ASSET
+ * granularity, the traceables.
+ *
+ * @param root Root expression of the controller
+ * @param traceables Traceables of the controller
+ * @param granularity Where the deadline is checked
+ * @return std::unordered_set<std::string>
+ */
+inline std::unordered_set<std::string> checkedExpressions(const base::Expression& root,
+                                                          const std::unordered_set<std::string>& traceables,
+                                                          DeadlineGranularity granularity)
+{
+    std::unordered_set<std::string> checked;
+    if (granularity != DeadlineGranularity::STAGE)
+    {
+        checked = traceables;
+    }
+
+    if (root != nullptr && root->isOperation())
+    {
+        for (const auto& operand : root->getPtr<base::Operation>()->getOperands())
+        {
+            checked.emplace(operand->getName());
+        }
+    }
+
+    return checked;
+}
+
+} // namespace detail
+} // namespace bk
+
+#endif // _BK_DEADLINE_HPP
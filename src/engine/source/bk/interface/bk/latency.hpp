@@ -0,0 +1,133 @@
+#ifndef _BK_LATENCY_HPP
+#define _BK_LATENCY_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <base/expression.hpp>
+
+namespace bk
+{
+
+using LatencyRecorder = std::function<void(uint64_t)>; ///< Records a sampled latency, in nanoseconds
+
+/**
+ * @brief Options of the sampled latency instrumentation of the controllers.
+ *
+ * One in sampleRate ingested events is timed. The timed expressions are the root expression (the policy), its operands
+ * (the stages) and the traceables (the assets). The events that are not sampled only pay a flag check per timed
+ * expression, and nothing is timed if the instrumentation is disabled.
+ */
+struct LatencyOptions
+{
+    std::size_t sampleRate {0}; ///< Sample one in sampleRate events, 0 disables the instrumentation
+
+    /**
+     * @brief Get the recorder of a timed expression given the root and the expression names.
+     *
+     * Called once per timed expression when the controller is built, it may return nullptr to not time the expression.
+     */
+    std::function<LatencyRecorder(const std::string& root, const std::string& name)> recorderFor;
+
+    bool enabled() const { return sampleRate > 0 && recorderFor != nullptr; }
+};
+
+namespace detail
+{
+
+/**
+ * @brief Decide which ingested events are timed, one in a sample rate.
+ *
+ * @note this is not thread-safe, each controller owns one.
+ */
+class LatencySampler
+{
+private:
+    std::size_t m_rate;  ///< Sample rate, 0 to never sample
+    std::size_t m_count; ///< Events seen since the last sampled event
+
+public:
+    explicit LatencySampler(std::size_t rate = 0)
+        : m_rate(rate)
+        , m_count(0)
+    {
+    }
+
+    /**
+     * @brief Check if the next event is sampled.
+     */
+    bool next()
+    {
+        if (m_rate == 0 || ++m_count < m_rate)
+        {
+            return false;
+        }
+
+        m_count = 0;
+        return true;
+    }
+};
+
+/**
+ * @brief Stopwatch of a timed expression, records the elapsed time from start to stop.
+ *
+ * @note this is not thread-safe, each controller owns a timer per timed expression.
+ */
+class LatencyTimer
+{
+private:
+    LatencyRecorder m_recorder;                    ///< Where the elapsed times are recorded
+    std::chrono::steady_clock::time_point m_start; ///< Start of the current measure
+
+public:
+    explicit LatencyTimer(LatencyRecorder recorder)
+        : m_recorder(std::move(recorder))
+        , m_start()
+    {
+    }
+
+    void start() { m_start = std::chrono::steady_clock::now(); }
+
+    void stop()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - m_start;
+        m_recorder(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+};
+
+/**
+ * @brief Get the names of the expressions that are timed: the root, its operands and the traceables.
+ *
+ * @param root Root expression of the controller
+ * @param traceables Traceables of the controller
+ * @return std::unordered_set<std::string>
+ */
+inline std::unordered_set<std::string> timedExpressions(const base::Expression& root,
+                                                        const std::unordered_set<std::string>& traceables)
+{
+    std::unordered_set<std::string> timed {traceables};
+    if (root == nullptr)
+    {
+        return timed;
+    }
+
+    timed.emplace(root->getName());
+    if (root->isOperation())
+    {
+        for (const auto& operand : root->getPtr<base::Operation>()->getOperands())
+        {
+            timed.emplace(operand->getName());
+        }
+    }
+
+    return timed;
+}
+
+} // namespace detail
+} // namespace bk
+
+#endif // _BK_LATENCY_HPP
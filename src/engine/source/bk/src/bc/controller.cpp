@@ -0,0 +1,132 @@
+#include "controller.hpp"
+
+#include <fmt/format.h>
+
+#include "exprBuilder.hpp"
+#include "tracer.hpp"
+
+namespace bk::bc
+{
+namespace
+{
+const char* opCodeName(OpCode code)
+{
+    switch (code)
+    {
+        case OpCode::TERM: return "TERM";
+        case OpCode::JUMP_IF_FALSE: return "JUMP_IF_FALSE";
+        case OpCode::JUMP_IF_TRUE: return "JUMP_IF_TRUE";
+        case OpCode::SET_TRUE: return "SET_TRUE";
+        default: return "UNKNOWN";
+    }
+}
+} // namespace
+
+class Controller::TracerImpl final : public detail::Tracer
+{
+};
+
+Controller::Controller(const base::Expression& expression,
+                       const std::unordered_set<std::string>& traceables,
+                       const std::function<void()>& endCallback)
+    : m_traceables {traceables}
+    , m_expression {expression}
+    , m_endCallback {endCallback}
+{
+    detail::ExprBuilder builder;
+    std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
+    m_program = builder.build(m_expression, traces, m_traceables);
+    for (auto& [name, trace] : traces)
+    {
+        m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
+    }
+}
+
+void Controller::run(base::Event& event) const
+{
+    bool status {false};
+    const auto size = m_program.size();
+    for (std::size_t pc = 0; pc < size;)
+    {
+        const auto& instruction = m_program[pc];
+        switch (instruction.code)
+        {
+            case OpCode::TERM:
+            {
+                auto result = instruction.op(std::move(event));
+                status = result.success();
+                if (instruction.publisher && instruction.publisher->active())
+                {
+                    instruction.publisher->publish(result.trace(), status);
+                }
+                event = result.popPayload();
+                ++pc;
+                break;
+            }
+            case OpCode::JUMP_IF_FALSE: pc = status ? pc + 1 : instruction.target; break;
+            case OpCode::JUMP_IF_TRUE: pc = status ? instruction.target : pc + 1; break;
+            case OpCode::SET_TRUE:
+                status = true;
+                ++pc;
+                break;
+            default: throw std::runtime_error("Unknown operation code");
+        }
+    }
+
+    if (m_endCallback)
+    {
+        m_endCallback();
+    }
+}
+
+std::string Controller::printGraph() const
+{
+    std::string listing;
+    for (std::size_t pc = 0; pc < m_program.size(); ++pc)
+    {
+        const auto& instruction = m_program[pc];
+        if (instruction.code == OpCode::JUMP_IF_FALSE || instruction.code == OpCode::JUMP_IF_TRUE)
+        {
+            listing += fmt::format(
+                "{:04} {} {:04} ({})\n", pc, opCodeName(instruction.code), instruction.target, instruction.name);
+        }
+        else
+        {
+            listing += fmt::format("{:04} {} ({})\n", pc, opCodeName(instruction.code), instruction.name);
+        }
+    }
+
+    return listing;
+}
+
+base::RespOrError<Subscription> Controller::subscribe(const std::string& traceable, const Subscriber& subscriber)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return base::Error {"Traceable not found"};
+    }
+
+    return it->second->subscribe(subscriber);
+}
+
+void Controller::unsubscribe(const std::string& traceable, Subscription subscription)
+{
+    auto it = m_traces.find(traceable);
+    if (it == m_traces.end())
+    {
+        return;
+    }
+
+    it->second->unsubscribe(subscription);
+}
+
+void Controller::unsubscribeAll()
+{
+    for (auto& [name, trace] : m_traces)
+    {
+        trace->unsubscribeAll();
+    }
+}
+
+} // namespace bk::bc
@@ -0,0 +1,166 @@
+#ifndef _BK_BC_EXPRBUILDER_HPP
+#define _BK_BC_EXPRBUILDER_HPP
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+
+#include "controller.hpp"
+#include "tracer.hpp"
+
+namespace bk::bc::detail
+{
+
+/**
+ * @brief Compiles an expression into a flat program.
+ *
+ * Every operation leaves its result in the status register:
+ * - And: operands in order, jumping to the end on the first failure.
+ * - Or: operands in order, jumping to the end on the first success.
+ * - Implication: condition, jumping to the end on failure, then the consequence and the status is set to true.
+ * - Chain and Broadcast: all operands in order, then the status is set to true.
+ */
+class ExprBuilder
+{
+private:
+    struct BuildParams
+    {
+        Publisher publisher;
+        std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
+        const std::unordered_set<std::string>& traceables;
+        std::vector<Instruction>& program;
+    };
+
+    std::size_t emit(OpCode code, const std::string& name, BuildParams& params)
+    {
+        params.program.emplace_back(
+            Instruction {.code = code, .target = 0, .op = nullptr, .publisher = nullptr, .name = name});
+        return params.program.size() - 1;
+    }
+
+    // Point the forward jumps to the next instruction to be emitted
+    void patchJumps(const std::vector<std::size_t>& jumps, BuildParams& params)
+    {
+        for (auto jump : jumps)
+        {
+            params.program[jump].target = params.program.size();
+        }
+    }
+
+    void buildTerm(const base::Term<base::EngineOp>& term, BuildParams& params)
+    {
+        auto index = emit(OpCode::TERM, term.getName(), params);
+        params.program[index].op = term.getFn();
+        params.program[index].publisher = params.publisher;
+    }
+
+    void buildShortCircuit(const base::Operation& operation, OpCode jumpCode, BuildParams& params)
+    {
+        std::vector<std::size_t> jumps;
+        const auto& operands = operation.getOperands();
+        for (auto it = operands.begin(); it != operands.end(); ++it)
+        {
+            recBuild(*it, params);
+            if (std::next(it) != operands.end())
+            {
+                jumps.emplace_back(emit(jumpCode, operation.getName(), params));
+            }
+        }
+        patchJumps(jumps, params);
+    }
+
+    void buildSequence(const base::Operation& operation, BuildParams& params)
+    {
+        for (const auto& operand : operation.getOperands())
+        {
+            recBuild(operand, params);
+        }
+        emit(OpCode::SET_TRUE, operation.getName(), params);
+    }
+
+    void buildImplication(const base::Implication& implication, BuildParams& params)
+    {
+        recBuild(implication.getOperands()[0], params);
+        auto jump = emit(OpCode::JUMP_IF_FALSE, implication.getName(), params);
+        recBuild(implication.getOperands()[1], params);
+        emit(OpCode::SET_TRUE, implication.getName(), params);
+        patchJumps({jump}, params);
+    }
+
+    void recBuild(const base::Expression& expression, BuildParams& params)
+    {
+        // Error if empty expression
+        if (expression == nullptr)
+        {
+            throw std::runtime_error {"Expression is null"};
+        }
+
+        // Create traceable if found and get the publisher function
+        auto traceIt = params.traceables.find(expression->getName());
+        if (traceIt != params.traceables.end())
+        {
+            if (params.traces.find(expression->getName()) == params.traces.end())
+            {
+                params.traces.emplace(expression->getName(), std::make_shared<Tracer>());
+            }
+
+            params.publisher = params.traces[expression->getName()]->publisher();
+        }
+
+        if (expression->isTerm())
+        {
+            buildTerm(*expression->getPtr<base::Term<base::EngineOp>>(), params);
+        }
+        else if (expression->isOperation())
+        {
+            if (expression->isAnd())
+            {
+                buildShortCircuit(*expression->getPtr<base::Operation>(), OpCode::JUMP_IF_FALSE, params);
+            }
+            else if (expression->isOr())
+            {
+                buildShortCircuit(*expression->getPtr<base::Operation>(), OpCode::JUMP_IF_TRUE, params);
+            }
+            else if (expression->isChain() || expression->isBroadcast())
+            {
+                buildSequence(*expression->getPtr<base::Operation>(), params);
+            }
+            else if (expression->isImplication())
+            {
+                buildImplication(*expression->getPtr<base::Implication>(), params);
+            }
+            else
+            {
+                throw std::runtime_error("Unsupported operation type");
+            }
+        }
+        else
+        {
+            throw std::runtime_error("Unsupported expression type");
+        }
+    }
+
+public:
+    virtual ~ExprBuilder() = default;
+    ExprBuilder() = default;
+
+    std::vector<Instruction> build(const base::Expression& expression,
+                                  std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
+                                  const std::unordered_set<std::string>& traceables)
+    {
+        std::vector<Instruction> program;
+        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables, .program = program};
+        recBuild(expression, params);
+
+        return program;
+    }
+};
+
+} // namespace bk::bc::detail
+
+#endif // _BK_BC_EXPRBUILDER_HPP
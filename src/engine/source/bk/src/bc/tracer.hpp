@@ -0,0 +1,155 @@
+#ifndef _BK_BC_TRACER_HPP
+#define _BK_BC_TRACER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <bk/icontroller.hpp>
+#include <base/error.hpp>
+#include <base/result.hpp>
+
+namespace bk::bc::detail
+{
+class Tracer;
+
+/**
+ * @brief Publisher of the traces of a traceable, nullptr if the expression is not traceable.
+ *
+ * The caller checks Tracer::active before building a trace message, so nothing is built while nobody listens.
+ */
+using Publisher = std::shared_ptr<const Tracer>;
+
+class Tracer : public std::enable_shared_from_this<Tracer>
+{
+private:
+    using Subscribers = std::vector<std::pair<Subscription, Subscriber>>;
+
+    std::string m_name; ///< Name of the trace
+    /// Copy-on-write snapshot of the subscribers, replaced as a whole on each change
+    std::shared_ptr<const Subscribers> m_subscribers {std::make_shared<Subscribers>()};
+    std::atomic<bool> m_active {false}; ///< The snapshot has subscribers, checked before building each trace
+
+    Subscription m_nextSubId {0};                      ///< Next subscription id
+    Subscription nextSubId() { return m_nextSubId++; } ///< Get the next subscription id
+
+    std::mutex m_writeMutex; ///< Serializes the copies of the subscribers, the publishers never take it
+
+    /**
+     * @brief Publish a new snapshot of the subscribers, with the write mutex held.
+     *
+     * @param subscribers The new subscribers.
+     */
+    void store(Subscribers subscribers)
+    {
+        const auto active = !subscribers.empty();
+        std::shared_ptr<const Subscribers> snapshot = std::make_shared<Subscribers>(std::move(subscribers));
+        std::atomic_store_explicit(&m_subscribers, std::move(snapshot), std::memory_order_release);
+        m_active.store(active, std::memory_order_release);
+    }
+
+public:
+    // The subscriptions open the traces of the helpers, see base::result::tracing
+    virtual ~Tracer() { base::result::traceSubscriptions().fetch_sub(m_subscribers->size()); }
+
+    /**
+     * @brief Get the name of the trace.
+     *
+     * @return const std::string& The name of the trace.
+     */
+    inline const std::string& name() const { return m_name; }
+
+    /**
+     * @brief Check if the trace has subscribers, without taking any lock.
+     *
+     * @return true if a published trace reaches a subscriber.
+     */
+    inline bool active() const { return m_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Subscribe `subscriber` to the trace.
+     *
+     * @param subscriber The subscriber to subscribe.
+     * @return base::RespOrError<Subscription> The subscription identifier or error if the subscription failed.
+     */
+    inline base::RespOrError<Subscription> subscribe(const Subscriber& subscriber)
+    {
+        std::lock_guard lock {m_writeMutex};
+        auto subscribers = *m_subscribers;
+        auto id = nextSubId();
+        for (const auto& [subscription, _] : subscribers)
+        {
+            if (subscription == id)
+            {
+                return base::Error {"Subscription already exists"};
+            }
+        }
+
+        subscribers.emplace_back(id, subscriber);
+        store(std::move(subscribers));
+        base::result::traceSubscriptions().fetch_add(1);
+        return id;
+    }
+
+    /**
+     * @brief Unsubscribe a subscriber from the trace.
+     *
+     * @param subscription The subscription identifier to unsubscribe.
+     */
+    inline void unsubscribe(Subscription subscription)
+    {
+        std::lock_guard lock {m_writeMutex};
+        auto subscribers = *m_subscribers;
+        const auto size = subscribers.size();
+        subscribers.erase(std::remove_if(subscribers.begin(),
+                                         subscribers.end(),
+                                         [subscription](const auto& entry) { return entry.first == subscription; }),
+                          subscribers.end());
+        if (subscribers.size() != size)
+        {
+            base::result::traceSubscriptions().fetch_sub(size - subscribers.size());
+            store(std::move(subscribers));
+        }
+    }
+
+    /**
+     * @brief Publish a trace to the subscribers of the snapshot taken when called.
+     *
+     * A subscriber can subscribe or unsubscribe from its callback, the change applies to the next trace.
+     *
+     * @param message The trace message.
+     * @param success The result of the traced expression.
+     */
+    void publish(const std::string& message, bool success) const
+    {
+        const auto subscribers = std::atomic_load_explicit(&m_subscribers, std::memory_order_acquire);
+        for (const auto& [_, subscriber] : *subscribers)
+        {
+            subscriber(message, success);
+        }
+    }
+
+    /**
+     * @copydoc bk::ITrace::publisher
+     */
+    Publisher publisher() { return shared_from_this(); }
+
+    /**
+     * @brief Clean all the subscribers from the trace.
+     *
+     */
+    void unsubscribeAll()
+    {
+        std::lock_guard lock {m_writeMutex};
+        base::result::traceSubscriptions().fetch_sub(m_subscribers->size());
+        store({});
+    }
+};
+
+} // namespace bk::bc::detail
+
+#endif // _BK_BC_TRACER_HPP
@@ -11,14 +11,27 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()>& endCallback)
+                       const std::function<void()>& endCallback,
+                       const LatencyOptions& latency,
+                       const DeadlineOptions& deadline)
     : m_traceables {traceables}
     , m_expression {expression}
     , m_policyInput {m_policySubject.get_subscriber()}
+    , m_sampler {latency.enabled() ? latency.sampleRate : 0}
+    , m_sampled {std::make_shared<bool>(false)}
+    , m_deadline {deadline.enabled() ? std::make_shared<bk::detail::Deadline>(deadline.budget) : nullptr}
+    , m_onExceeded {deadline.onExceeded}
 {
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    m_policyOutput = builder.build(expression, traces, m_traceables, m_policySubject.get_observable());
+    m_policyOutput = builder.build(expression,
+                                   traces,
+                                   m_traceables,
+                                   m_policySubject.get_observable(),
+                                   latency,
+                                   m_sampled,
+                                   m_deadline,
+                                   deadline.granularity);
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
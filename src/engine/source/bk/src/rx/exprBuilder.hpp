@@ -4,9 +4,13 @@
 #include <functional>
 #include <memory>
 
+#include <base/allocProfiler.hpp>
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
 
+#include <bk/deadline.hpp>
+#include <bk/latency.hpp>
+
 #include "tracer.hpp"
 
 namespace bk::rx::detail
@@ -23,6 +27,14 @@ private:
         Publisher publisher;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        const LatencyOptions& latency;
+        std::unordered_set<std::string> timed;          ///< Timed expressions, empty if the instrumentation is disabled
+        std::string root;                               ///< Name of the root expression
+        std::shared_ptr<bool> sampled;                  ///< Set for the events that are timed
+        std::unordered_set<std::string> profiled;       ///< Allocation contexts, empty if the profiling is not built
+        std::shared_ptr<bk::detail::Deadline> deadline; ///< Deadline of the events, nullptr if disabled
+        std::unordered_set<std::string> checked;        ///< Expressions where the deadline is checked
+        bool checkHelpers;                              ///< The deadline is checked after each term too
     };
 
     Observable recBuild(const Observable& input, const base::Expression& expression, BuildParams& params)
@@ -45,6 +57,116 @@ private:
             params.publisher = params.traces[expression->getName()]->publisher();
         }
 
+        if (params.deadline != nullptr && params.checked.find(expression->getName()) != params.checked.end())
+        {
+            return buildChecked(input, expression, params);
+        }
+
+        return buildInstrumented(input, expression, params);
+    }
+
+    /**
+     * @brief Build an expression where the deadline is checked, it is skipped by the events that already exceeded
+     * their budget and checks the budget of the others once done.
+     */
+    Observable buildChecked(const Observable& input, const base::Expression& expression, BuildParams& params)
+    {
+        auto checkedInput =
+            input.filter([deadline = params.deadline](const RxEvent&) { return !deadline->exceeded(); });
+
+        return buildInstrumented(checkedInput, expression, params)
+            .map(
+                [deadline = params.deadline, name = expression->getName()](RxEvent result)
+                {
+                    deadline->leave(name);
+                    return result;
+                });
+    }
+
+    /**
+     * @brief Build an expression with the latency and allocation instrumentation that applies to it.
+     */
+    Observable buildInstrumented(const Observable& input, const base::Expression& expression, BuildParams& params)
+    {
+        if constexpr (base::allocprof::ENABLED)
+        {
+            if (params.profiled.find(expression->getName()) != params.profiled.end())
+            {
+                return buildProfiled(input, expression, params);
+            }
+        }
+
+        return buildTimed(input, expression, params);
+    }
+
+    /**
+     * @brief Build an expression as an allocation context, entered by each event before its operands run and left
+     * once all of them are done.
+     */
+    Observable buildProfiled(const Observable& input, const base::Expression& expression, BuildParams& params)
+    {
+        auto counters = base::allocprof::counters(params.root, expression->getName());
+        auto previous = std::make_shared<base::allocprof::Counters*>(nullptr);
+
+        auto profiledInput = input.map(
+            [counters, previous](RxEvent result)
+            {
+                counters->events.fetch_add(1, std::memory_order_relaxed);
+                *previous = base::allocprof::exchangeCurrent(counters.get());
+                return result;
+            });
+
+        return buildTimed(profiledInput, expression, params)
+            .map(
+                [previous](RxEvent result)
+                {
+                    base::allocprof::exchangeCurrent(*previous);
+                    return result;
+                });
+    }
+
+    /**
+     * @brief Build an expression, timed if it is one of the timed expressions.
+     */
+    Observable buildTimed(const Observable& input, const base::Expression& expression, BuildParams& params)
+    {
+        LatencyRecorder recorder = nullptr;
+        if (params.timed.find(expression->getName()) != params.timed.end())
+        {
+            recorder = params.latency.recorderFor(params.root, expression->getName());
+        }
+
+        if (recorder == nullptr)
+        {
+            return buildExpression(input, expression, params);
+        }
+
+        // The subgraph emits once all its operands are done, so the timer is stopped after the whole expression
+        auto timer = std::make_shared<bk::detail::LatencyTimer>(std::move(recorder));
+        auto timedInput = input.map(
+            [timer, sampled = params.sampled](RxEvent result)
+            {
+                if (*sampled)
+                {
+                    timer->start();
+                }
+                return result;
+            });
+
+        return buildExpression(timedInput, expression, params)
+            .map(
+                [timer, sampled = params.sampled](RxEvent result)
+                {
+                    if (*sampled)
+                    {
+                        timer->stop();
+                    }
+                    return result;
+                });
+    }
+
+    Observable buildExpression(const Observable& input, const base::Expression& expression, BuildParams& params)
+    {
         // Handle pipelines
         if (expression->isOperation())
         {
@@ -123,14 +245,31 @@ private:
         else if (expression->isTerm())
         {
             auto term = expression->getPtr<base::Term<base::EngineOp>>();
+            if (params.checkHelpers)
+            {
+                return input.map(
+                    [op = term->getFn(),
+                     tracer = params.publisher,
+                     deadline = params.deadline,
+                     name = term->getName()](RxEvent result)
+                    {
+                        *result = op(result->payload());
+                        deadline->leaveHelper(name);
+                        if (tracer != nullptr && tracer->active())
+                        {
+                            tracer->publish(result->trace(), result->success());
+                        }
+                        return result;
+                    });
+            }
             return input.map(
                 [op = term->getFn(), tracer = params.publisher](RxEvent result)
                 {
                     *result = op(result->payload());
                     // TODO: should we allow to not include tracer?
-                    if (tracer != nullptr)
+                    if (tracer != nullptr && tracer->active())
                     {
-                        tracer(std::string {result->trace()}, result->success());
+                        tracer->publish(result->trace(), result->success());
                     }
                     return result;
                 });
@@ -145,12 +284,53 @@ public:
     virtual ~ExprBuilder() = default;
     ExprBuilder() = default;
 
+    /**
+     * @brief Build the observable of an expression
+     *
+     * @param expression expression to build
+     * @param traces where the tracers of the traceables are created
+     * @param traceables traceables expressions
+     * @param input observable of the ingested events
+     * @param latency options of the latency instrumentation
+     * @param sampled flag set by the controller for the events that are timed
+     * @param deadline deadline armed by the controller for each event, nullptr to not check it
+     * @param granularity where the deadline is checked
+     * @return Observable
+     */
     Observable build(const base::Expression& expression,
                      std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                      const std::unordered_set<std::string>& traceables,
-                     const Observable& input)
+                     const Observable& input,
+                     const LatencyOptions& latency = {},
+                     std::shared_ptr<bool> sampled = nullptr,
+                     std::shared_ptr<bk::detail::Deadline> deadline = nullptr,
+                     DeadlineGranularity granularity = DeadlineGranularity::ASSET)
     {
-        BuildParams params {.publisher = nullptr, .traces = traces, .traceables = traceables};
+        BuildParams params {.publisher = nullptr,
+                            .traces = traces,
+                            .traceables = traceables,
+                            .latency = latency,
+                            .timed = {},
+                            .root = expression != nullptr ? expression->getName() : "",
+                            .sampled = std::move(sampled),
+                            .profiled = {},
+                            .deadline = std::move(deadline),
+                            .checked = {},
+                            .checkHelpers = false};
+        if (latency.enabled() && params.sampled != nullptr)
+        {
+            params.timed = bk::detail::timedExpressions(expression, traceables);
+        }
+        if constexpr (base::allocprof::ENABLED)
+        {
+            // The same expressions are timed and profiled: the policy, its stages and the assets
+            params.profiled = bk::detail::timedExpressions(expression, traceables);
+        }
+        if (params.deadline != nullptr)
+        {
+            params.checked = bk::detail::checkedExpressions(expression, traceables, granularity);
+            params.checkHelpers = granularity == DeadlineGranularity::HELPER;
+        }
         auto output = recBuild(input, expression, params);
 
         return output;
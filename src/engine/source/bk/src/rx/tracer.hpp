@@ -1,31 +1,60 @@
 #ifndef _BK_RX_TRACER_HPP
 #define _BK_RX_TRACER_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
-#include <shared_mutex>
+#include <mutex>
 #include <string>
-#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <bk/icontroller.hpp>
 #include <base/error.hpp>
+#include <base/result.hpp>
 
 namespace bk::rx::detail
 {
-using Publisher = Subscriber;
+class Tracer;
+
+/**
+ * @brief Publisher of the traces of a traceable, nullptr if the expression is not traceable.
+ *
+ * The caller checks Tracer::active before building a trace message, so nothing is built while nobody listens.
+ */
+using Publisher = std::shared_ptr<const Tracer>;
 
 class Tracer : public std::enable_shared_from_this<Tracer>
 {
 private:
-    std::string m_name;                                         ///< Name of the trace
-    std::unordered_map<Subscription, Subscriber> m_subscribers; ///< subscription id -> subscriber map
+    using Subscribers = std::vector<std::pair<Subscription, Subscriber>>;
+
+    std::string m_name; ///< Name of the trace
+    /// Copy-on-write snapshot of the subscribers, replaced as a whole on each change
+    std::shared_ptr<const Subscribers> m_subscribers {std::make_shared<Subscribers>()};
+    std::atomic<bool> m_active {false}; ///< The snapshot has subscribers, checked before building each trace
 
     Subscription m_nextSubId {0};                      ///< Next subscription id
     Subscription nextSubId() { return m_nextSubId++; } ///< Get the next subscription id
 
-    std::shared_mutex m_subscribersMutex; ///< Mutex for the subscribers
+    std::mutex m_writeMutex; ///< Serializes the copies of the subscribers, the publishers never take it
+
+    /**
+     * @brief Publish a new snapshot of the subscribers, with the write mutex held.
+     *
+     * @param subscribers The new subscribers.
+     */
+    void store(Subscribers subscribers)
+    {
+        const auto active = !subscribers.empty();
+        std::shared_ptr<const Subscribers> snapshot = std::make_shared<Subscribers>(std::move(subscribers));
+        std::atomic_store_explicit(&m_subscribers, std::move(snapshot), std::memory_order_release);
+        m_active.store(active, std::memory_order_release);
+    }
 
 public:
-    virtual ~Tracer() = default;
+    // The subscriptions open the traces of the helpers, see base::result::tracing
+    virtual ~Tracer() { base::result::traceSubscriptions().fetch_sub(m_subscribers->size()); }
 
     /**
      * @brief Get the name of the trace.
@@ -34,6 +63,13 @@ public:
      */
     inline const std::string& name() const { return m_name; }
 
+    /**
+     * @brief Check if the trace has subscribers, without taking any lock.
+     *
+     * @return true if a published trace reaches a subscriber.
+     */
+    inline bool active() const { return m_active.load(std::memory_order_relaxed); }
+
     /**
      * @brief Subscribe `subscriber` to the trace.
      *
@@ -42,14 +78,20 @@ public:
      */
     inline base::RespOrError<Subscription> subscribe(const Subscriber& subscriber)
     {
-        std::unique_lock lock {m_subscribersMutex};
+        std::lock_guard lock {m_writeMutex};
+        auto subscribers = *m_subscribers;
         auto id = nextSubId();
-        if (m_subscribers.find(id) != m_subscribers.end())
+        for (const auto& [subscription, _] : subscribers)
         {
-            return base::Error {"Subscription already exists"};
+            if (subscription == id)
+            {
+                return base::Error {"Subscription already exists"};
+            }
         }
 
-        m_subscribers.emplace(id, subscriber);
+        subscribers.emplace_back(id, subscriber);
+        store(std::move(subscribers));
+        base::result::traceSubscriptions().fetch_add(1);
         return id;
     }
 
@@ -60,34 +102,51 @@ public:
      */
     inline void unsubscribe(Subscription subscription)
     {
-        std::unique_lock lock {m_subscribersMutex};
-        m_subscribers.erase(subscription);
+        std::lock_guard lock {m_writeMutex};
+        auto subscribers = *m_subscribers;
+        const auto size = subscribers.size();
+        subscribers.erase(std::remove_if(subscribers.begin(),
+                                         subscribers.end(),
+                                         [subscription](const auto& entry) { return entry.first == subscription; }),
+                          subscribers.end());
+        if (subscribers.size() != size)
+        {
+            base::result::traceSubscriptions().fetch_sub(size - subscribers.size());
+            store(std::move(subscribers));
+        }
     }
 
     /**
-     * @copydoc bk::ITrace::publisher
+     * @brief Publish a trace to the subscribers of the snapshot taken when called.
+     *
+     * A subscriber can subscribe or unsubscribe from its callback, the change applies to the next trace.
+     *
+     * @param message The trace message.
+     * @param success The result of the traced expression.
      */
-    Publisher publisher()
+    void publish(const std::string& message, bool success) const
     {
-        return [thisPtr = this->weak_from_this()](const std::string& message, bool success)
+        const auto subscribers = std::atomic_load_explicit(&m_subscribers, std::memory_order_acquire);
+        for (const auto& [_, subscriber] : *subscribers)
         {
-            auto thisShared = thisPtr.lock();
-            std::shared_lock lock {thisShared->m_subscribersMutex};
-            for (const auto& [_, subscriber] : thisShared->m_subscribers)
-            {
-                subscriber(message, success);
-            }
-        };
+            subscriber(message, success);
+        }
     }
 
+    /**
+     * @copydoc bk::ITrace::publisher
+     */
+    Publisher publisher() { return shared_from_this(); }
+
     /**
      * @brief Clean all the subscribers from the trace.
      *
      */
     void unsubscribeAll()
     {
-        std::unique_lock lock {m_subscribersMutex};
-        m_subscribers.clear();
+        std::lock_guard lock {m_writeMutex};
+        base::result::traceSubscriptions().fetch_sub(m_subscribers->size());
+        store({});
     }
 };
 
@@ -11,16 +11,20 @@ class Controller::TracerImpl final : public detail::Tracer
 
 Controller::Controller(const base::Expression& expression,
                        const std::unordered_set<std::string>& traceables,
-                       const std::function<void()> endCallback)
+                       const std::function<void()> endCallback,
+                       std::shared_ptr<tf::Executor> executor,
+                       const LatencyOptions& latency)
     : m_tf()
-    , m_executor(1)
+    , m_executor(executor ? std::move(executor) : std::make_shared<tf::Executor>(1))
     , m_event()
+    , m_sampler(latency.enabled() ? latency.sampleRate : 0)
+    , m_sampled(false)
     , m_traceables(traceables)
     , m_expression(expression)
 {
     detail::ExprBuilder builder;
     std::unordered_map<std::string, std::shared_ptr<detail::Tracer>> traces;
-    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback);
+    builder.build(m_expression, m_tf, &m_event, traces, m_traceables, endCallback, latency, &m_sampled);
     for (auto& [name, trace] : traces)
     {
         m_traces.emplace(name, std::static_pointer_cast<TracerImpl>(trace));
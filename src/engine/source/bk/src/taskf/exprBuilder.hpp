@@ -9,6 +9,8 @@
 #include <base/baseTypes.hpp>
 #include <base/expression.hpp>
 
+#include <bk/latency.hpp>
+
 #include "tracer.hpp"
 
 namespace bk::taskf::detail
@@ -74,9 +76,9 @@ public:
             {
                 auto& event = *static_cast<base::Event*>(data);
                 auto res = fn(event);
-                if (publisher)
+                if (publisher && publisher->active())
                 {
-                    publisher(res.trace(), res.success());
+                    publisher->publish(res.trace(), res.success());
                 }
 
                 return res.success() ? 0 : 1;
@@ -266,6 +268,54 @@ public:
     }
 };
 
+class TaskTimed : public ITask
+{
+private:
+    ComplexTask m_step;
+    tf::Task m_input;
+    tf::Task m_outputSuccess;
+    tf::Task m_outputFailure;
+
+public:
+    TaskTimed(ComplexTask step, LatencyRecorder recorder, const bool* sampled, tf::Taskflow& tf)
+        : ITask()
+        , m_step(std::move(step))
+    {
+        auto timer = std::make_shared<bk::detail::LatencyTimer>(std::move(recorder));
+        m_input = tf.emplace(
+                        [timer, sampled]()
+                        {
+                            if (*sampled)
+                            {
+                                timer->start();
+                            }
+                            return 0;
+                        })
+                      .name("timer_in");
+        auto stop = [timer, sampled]()
+        {
+            if (*sampled)
+            {
+                timer->stop();
+            }
+            return 0;
+        };
+        m_outputSuccess = tf.emplace(stop).name("timer_out_success");
+        m_outputFailure = tf.emplace(stop).name("timer_out_failure");
+        m_input.precede(m_step->input());
+    }
+
+    tf::Task& input() override { return m_input; }
+
+    void on(tf::Task& success, tf::Task& failure) override
+    {
+        assertConnect();
+        m_step->on(m_outputSuccess, m_outputFailure);
+        m_outputSuccess.precede(success);
+        m_outputFailure.precede(failure);
+    }
+};
+
 class ExprBuilder
 {
 private:
@@ -276,6 +326,10 @@ private:
         void* data;
         std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces;
         const std::unordered_set<std::string>& traceables;
+        const LatencyOptions& latency;
+        std::unordered_set<std::string> timed; ///< Timed expressions, empty if the instrumentation is disabled
+        std::string root;                      ///< Name of the root expression
+        const bool* sampled;                   ///< Set for the events that are timed
     };
 
     ComplexTask buildTerm(const base::Term<base::EngineOp>& term, BuildParams& params)
@@ -370,6 +424,22 @@ private:
             params.publisher = params.traces[expression->getName()]->publisher();
         }
 
+        LatencyRecorder recorder = nullptr;
+        if (params.timed.find(expression->getName()) != params.timed.end())
+        {
+            recorder = params.latency.recorderFor(params.root, expression->getName());
+        }
+
+        if (recorder == nullptr)
+        {
+            return buildExpression(expression, params);
+        }
+
+        return std::make_shared<TaskTimed>(buildExpression(expression, params), recorder, params.sampled, params.tf);
+    }
+
+    ComplexTask buildExpression(const base::Expression& expression, BuildParams& params)
+    {
         if (expression->isTerm())
         {
             return buildTerm(*expression->getPtr<base::Term<base::EngineOp>>(), params);
@@ -416,9 +486,23 @@ public:
                void* data,
                std::unordered_map<std::string, std::shared_ptr<Tracer>>& traces,
                const std::unordered_set<std::string>& traceables,
-               std::function<void()> endCallback = nullptr)
+               std::function<void()> endCallback = nullptr,
+               const LatencyOptions& latency = {},
+               const bool* sampled = nullptr)
     {
-        BuildParams params {.tf = tf, .publisher = nullptr, .data = data, .traces = traces, .traceables = traceables};
+        BuildParams params {.tf = tf,
+                            .publisher = nullptr,
+                            .data = data,
+                            .traces = traces,
+                            .traceables = traceables,
+                            .latency = latency,
+                            .timed = {},
+                            .root = expression != nullptr ? expression->getName() : "",
+                            .sampled = sampled};
+        if (latency.enabled() && sampled != nullptr)
+        {
+            params.timed = bk::detail::timedExpressions(expression, traceables);
+        }
         // As complex task are not finished until output is connected we need to force the connection
         auto finalTask = recBuild(expression, params);
         auto output = tf.placeholder().name("output");
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+
+#include <bk/bc/controller.hpp>
 #include <bk/rx/controller.hpp>
 #include <bk/taskf/controller.hpp>
 #include <bk/mockController.hpp> // Force mock compilation
@@ -85,6 +91,13 @@ TEST_P(PipelineTest, RxProcessTraces)
     GTEST_SKIP(); // TODO
 }
 
+TEST_P(PipelineTest, BcProcessEvent)
+{
+    auto [name, expression, expectedPath] = GetParam();
+    auto testExpression = getTestExpression(expression);
+    buildIngestTest<bk::bc::Controller>(testExpression, expectedPath);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     BK,
     PipelineTest,
@@ -867,6 +880,7 @@ TEST(BKTraceTest, Subscribe)
 {
     subscribeTest<bk::taskf::Controller>();
     subscribeTest<bk::rx::Controller>();
+    subscribeTest<bk::bc::Controller>();
 }
 
 template<typename Controller>
@@ -883,6 +897,7 @@ TEST(BKTraceTest, SubscribeTraceableNotFound)
 {
     subscribeTraceableNotFoundTest<bk::taskf::Controller>();
     subscribeTraceableNotFoundTest<bk::rx::Controller>();
+    subscribeTraceableNotFoundTest<bk::bc::Controller>();
 }
 
 template<typename Controller>
@@ -901,6 +916,7 @@ TEST(BKTraceTest, MultipleSubscribers)
 {
     multipleSubscribersTest<bk::taskf::Controller>();
     multipleSubscribersTest<bk::rx::Controller>();
+    multipleSubscribersTest<bk::bc::Controller>();
 }
 
 template<typename Controller>
@@ -918,6 +934,7 @@ TEST(BKTraceTest, Unsubscribe)
 {
     unsubscribeTest<bk::taskf::Controller>();
     unsubscribeTest<bk::rx::Controller>();
+    unsubscribeTest<bk::bc::Controller>();
 }
 
 template<typename Controller>
@@ -937,4 +954,232 @@ TEST(BKTraceTest, UnsubscribeNotExists)
 {
     unsubscribeNotExistsTest<bk::taskf::Controller>();
     unsubscribeNotExistsTest<bk::rx::Controller>();
+    unsubscribeNotExistsTest<bk::bc::Controller>();
+}
+
+template<typename Controller>
+void unsubscribeFromSubscriberTest()
+{
+    Controller c(EasyExp::term("term", true), {"term"});
+    Subscriber<Controller> s;
+    bk::Subscription subscription {};
+    auto subRes = c.subscribe("term",
+                              [&](const std::string& trace, bool)
+                              {
+                                  s.traces.emplace_back(trace);
+                                  c.unsubscribe("term", subscription);
+                              });
+    ASSERT_FALSE(base::isError(subRes)) << "Error subscribing: " << base::getError(subRes).message;
+    subscription = base::getResponse<bk::Subscription>(subRes);
+    s.checkTraceActivation(c, {SUCCES_TRACE});
+    s.checkTraceActivation(c, {SUCCES_TRACE});
+}
+
+TEST(BKTraceTest, UnsubscribeFromSubscriber)
+{
+    unsubscribeFromSubscriberTest<bk::taskf::Controller>();
+    unsubscribeFromSubscriberTest<bk::rx::Controller>();
+    unsubscribeFromSubscriberTest<bk::bc::Controller>();
+}
+
+TEST(BKTaskfExecutorTest, SharedExecutorBroadcast)
+{
+    std::atomic<int> calls {0};
+    auto readOnlyTerm = [&calls](const std::string& name) -> base::Expression
+    {
+        return base::Term<base::EngineOp>::create(name,
+                                                  [&calls](const auto& e)
+                                                  {
+                                                      ++calls;
+                                                      return base::result::makeSuccess(e, SUCCES_TRACE);
+                                                  });
+    };
+    auto expression = base::Broadcast::create("broadcast", {readOnlyTerm("a"), readOnlyTerm("b"), readOnlyTerm("c")});
+
+    auto counter = 0;
+    auto maker = bk::taskf::ControllerMaker(bk::taskf::ExecutionMode::SHARED, 2);
+    auto first = maker.create(expression, {}, [&]() { ++counter; });
+    auto second = maker.create(expression, {}, [&]() { ++counter; });
+
+    ASSERT_NO_THROW(first->ingest(std::make_shared<json::Json>()));
+    ASSERT_NO_THROW(second->ingest(std::make_shared<json::Json>()));
+
+    ASSERT_EQ(calls, 6);
+    ASSERT_EQ(counter, 2);
+}
+
+template<typename Maker>
+void latencyTest(const std::function<Maker(bk::LatencyOptions)>& makerFn)
+{
+    std::map<std::string, std::size_t> records;
+    bk::LatencyOptions latency {.sampleRate = 2,
+                                .recorderFor = [&records](const std::string& root, const std::string& name)
+                                {
+                                    EXPECT_EQ(root, "policy");
+                                    return [&records, name](uint64_t) { ++records[name]; };
+                                }};
+
+    // Only the root, its operands and the traceables are timed
+    auto asset = base::And::create("asset", {EasyExp::term("term", true)});
+    auto stage = base::Broadcast::create("stage", {asset, EasyExp::term("other", true)});
+    auto expression = base::Chain::create("policy", {stage});
+
+    auto maker = makerFn(latency);
+    auto controller = maker.create(expression, {"asset"}, nullptr);
+    for (auto i = 0; i < 4; ++i)
+    {
+        ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+    }
+
+    auto expected = std::map<std::string, std::size_t> {{"asset", 2}, {"policy", 2}, {"stage", 2}};
+    ASSERT_EQ(records, expected);
+}
+
+TEST(BKLatencyTest, SampledExpressions)
+{
+    latencyTest<bk::taskf::ControllerMaker>(
+        [](bk::LatencyOptions latency)
+        { return bk::taskf::ControllerMaker(bk::taskf::ExecutionMode::SERIAL, 0, std::move(latency)); });
+    latencyTest<bk::rx::ControllerMaker>([](bk::LatencyOptions latency)
+                                         { return bk::rx::ControllerMaker(std::move(latency)); });
+}
+
+TEST(BKLatencyTest, Disabled)
+{
+    auto calls = 0;
+    bk::LatencyOptions latency {.sampleRate = 0,
+                                .recorderFor = [&calls](const std::string&, const std::string&) -> bk::LatencyRecorder
+                                {
+                                    ++calls;
+                                    return nullptr;
+                                }};
+    auto expression = base::Chain::create("policy", {EasyExp::term("term", true)});
+
+    bk::rx::ControllerMaker rxMaker(latency);
+    auto rxController = rxMaker.create(expression, {"term"}, nullptr);
+    ASSERT_NO_THROW(rxController->ingest(std::make_shared<json::Json>()));
+
+    bk::taskf::ControllerMaker tfMaker(bk::taskf::ExecutionMode::SERIAL, 0, latency);
+    auto tfController = tfMaker.create(expression, {"term"}, nullptr);
+    ASSERT_NO_THROW(tfController->ingest(std::make_shared<json::Json>()));
+
+    ASSERT_EQ(calls, 0);
+}
+
+namespace
+{
+struct DeadlineReport
+{
+    std::string root;
+    std::string expression;
+    std::string helper;
+};
+
+/**
+ * @brief Policy with a decoder stage that is slow when asked and an output stage that counts the events
+ */
+base::Expression deadlinePolicy(const bool& slow, int& outputs)
+{
+    auto sleep = base::Term<base::EngineOp>::create("sleep",
+                                                    [&slow](const auto& e)
+                                                    {
+                                                        if (slow)
+                                                        {
+                                                            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                                                        }
+                                                        return base::result::makeSuccess(e, SUCCES_TRACE);
+                                                    });
+    auto output = base::Term<base::EngineOp>::create("write",
+                                                     [&outputs](const auto& e)
+                                                     {
+                                                         ++outputs;
+                                                         return base::result::makeSuccess(e, SUCCES_TRACE);
+                                                     });
+
+    auto decoders = base::Or::create("decoders", {base::And::create("decoder", {EasyExp::term("check", true), sleep})});
+    auto outputStage = base::Broadcast::create("outputs", {base::And::create("output", {output})});
+    return base::Chain::create("policy", {decoders, outputStage});
+}
+} // namespace
+
+TEST(BKDeadlineTest, DivertsSlowEvents)
+{
+    auto slow = false;
+    auto outputs = 0;
+    std::vector<DeadlineReport> reports;
+    bk::DeadlineOptions deadline {.budget = std::chrono::milliseconds(1),
+                                  .granularity = bk::DeadlineGranularity::ASSET,
+                                  .onExceeded = [&reports](const std::string& root,
+                                                           const std::string& expression,
+                                                           const std::string& helper,
+                                                           const base::Event&)
+                                  { reports.push_back({root, expression, helper}); }};
+
+    bk::rx::ControllerMaker maker({}, deadline);
+    auto controller = maker.create(deadlinePolicy(slow, outputs), {"decoder", "output"}, nullptr);
+
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+    ASSERT_EQ(outputs, 1);
+    ASSERT_TRUE(reports.empty());
+
+    // The output stage is skipped and the asset that ran out of budget is reported
+    slow = true;
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+    ASSERT_EQ(outputs, 1);
+    ASSERT_EQ(reports.size(), 1);
+    EXPECT_EQ(reports[0].root, "policy");
+    EXPECT_EQ(reports[0].expression, "decoder");
+    EXPECT_EQ(reports[0].helper, "");
+
+    // Each event has its own budget
+    slow = false;
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+    ASSERT_EQ(outputs, 2);
+    ASSERT_EQ(reports.size(), 1);
+}
+
+TEST(BKDeadlineTest, Granularity)
+{
+    auto slow = true;
+    auto outputs = 0;
+    std::vector<DeadlineReport> reports;
+    auto options = [&reports](bk::DeadlineGranularity granularity)
+    {
+        return bk::DeadlineOptions {.budget = std::chrono::milliseconds(1),
+                                    .granularity = granularity,
+                                    .onExceeded = [&reports](const std::string& root,
+                                                             const std::string& expression,
+                                                             const std::string& helper,
+                                                             const base::Event&)
+                                    { reports.push_back({root, expression, helper}); }};
+    };
+
+    bk::rx::ControllerMaker stageMaker({}, options(bk::DeadlineGranularity::STAGE));
+    auto controller = stageMaker.create(deadlinePolicy(slow, outputs), {"decoder", "output"}, nullptr);
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+
+    bk::rx::ControllerMaker helperMaker({}, options(bk::DeadlineGranularity::HELPER));
+    controller = helperMaker.create(deadlinePolicy(slow, outputs), {"decoder", "output"}, nullptr);
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+
+    ASSERT_EQ(outputs, 0);
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[0].expression, "decoders");
+    EXPECT_EQ(reports[0].helper, "");
+    EXPECT_EQ(reports[1].expression, "decoder");
+    EXPECT_EQ(reports[1].helper, "sleep");
+}
+
+TEST(BKDeadlineTest, Disabled)
+{
+    auto slow = true;
+    auto outputs = 0;
+    auto calls = 0;
+    bk::rx::ControllerMaker maker(
+        {}, {.budget = std::chrono::microseconds(0), .onExceeded = [&calls](auto&&...) { ++calls; }});
+    auto controller = maker.create(deadlinePolicy(slow, outputs), {"decoder", "output"}, nullptr);
+
+    ASSERT_NO_THROW(controller->ingest(std::make_shared<json::Json>()));
+    ASSERT_EQ(outputs, 1);
+    ASSERT_EQ(calls, 0);
 }
@@ -5,12 +5,16 @@
 
 #include <defs/idefinitions.hpp>
 #include <geo/imanager.hpp>
+#include <indexerconnector/iindexerconnector.hpp>
 #include <kvdb/ikvdbmanager.hpp>
 #include <logpar/logpar.hpp>
+#include <metrics/assetStats.hpp>
+#include <metrics/iMetricsManager.hpp>
 #include <schemf/ischema.hpp>
 #include <schemf/ivalidator.hpp>
 #include <sockiface/isockFactory.hpp>
 #include <store/istore.hpp>
+#include <wdb/iagentCache.hpp>
 #include <wdb/iwdbManager.hpp>
 
 #include <builder/ibuilder.hpp>
@@ -19,6 +23,12 @@
 namespace builder
 {
 
+namespace policy
+{
+class AssetCache;
+class IAssetBuilder;
+} // namespace policy
+
 struct BuilderDeps
 {
     size_t logparDebugLvl = 0;
@@ -28,7 +38,23 @@ struct BuilderDeps
     std::shared_ptr<kvdbManager::IKVDBManager> kvdbManager;
     std::shared_ptr<sockiface::ISockFactory> sockFactory;
     std::shared_ptr<wazuhdb::IWDBManager> wdbManager;
+    bool wdbUpdateAsync = false;         ///< wdb_update queues the queries instead of waiting for their results
+    std::size_t scaCacheTtl = 0;         ///< Time (s) the SCA decoder caches the wazuh-db lookups, 0 to not cache
+    std::size_t scaBatchSize = 0;        ///< Check updates of an agent coalesced by the SCA decoder, 0 to not coalesce
+    std::size_t scaBatchInterval = 1000; ///< Maximum time (ms) a coalesced SCA check update waits
     std::shared_ptr<geo::IManager> geoManager;
+
+    std::shared_ptr<wazuhdb::IAgentCache> agentCache; ///< Metadata of the agents of agent_info, or null if disabled
+
+    std::size_t buildThreads = 1; ///< Threads building the assets of a policy
+
+    std::size_t outputFlushInterval = 100; ///< Maximum time (ms) an event waits to be written to the file outputs
+    std::size_t outputFsyncInterval = 0;   ///< Minimum time (ms) between syncs of the file outputs, 0 to never sync
+
+    std::shared_ptr<indexerconnector::IIndexerConnector> indexerConnector; ///< Connector of the indexer outputs
+    std::shared_ptr<metricsManager::IMetricsManager> metricsManager;       ///< Metrics of the socket senders, or null
+
+    bool reorderDecoders = false; ///< Orders the sibling decoders by their hit rate, see metricsManager::AssetStats
 };
 
 class Builder final
@@ -43,6 +69,20 @@ private:
     std::shared_ptr<defs::IDefinitionsBuilder> m_definitionsBuilder; ///< Definitions builder
 
     std::shared_ptr<Registry> m_registry; ///< builders registry
+    std::size_t m_buildThreads {1};       ///< Threads building the assets of a policy
+
+    std::shared_ptr<const metricsManager::AssetStats> m_decoderStats; ///< Orders the sibling decoders, or null
+
+    // Assets of the last build of the policies, only the changed ones are built again
+    std::shared_ptr<policy::AssetCache> m_assetCache; ///< Asset cache shared by the policies
+
+    /**
+     * @brief Get the asset builder for validation, it reuses the cached assets without adding the ones it builds.
+     *
+     * @param policyName Name of the policy the assets are validated for, empty if none
+     * @return std::shared_ptr<policy::IAssetBuilder>
+     */
+    std::shared_ptr<policy::IAssetBuilder> validationBuilder(const std::string& policyName = {}) const;
 
 public:
     Builder() = default;
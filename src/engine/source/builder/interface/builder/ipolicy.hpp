@@ -42,6 +42,13 @@ public:
      */
     virtual const base::Expression& expression() const = 0;
 
+    /**
+     * @brief Get the number of operations of the policy that validate their result against the schema at runtime.
+     *
+     * @return std::size_t
+     */
+    virtual std::size_t runtimeValidations() const = 0;
+
     /**
      * @brief Get the Graphivz Str object
      *
@@ -1,11 +1,15 @@
 #include "builder.hpp"
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
+#include <base/arenaAllocator.hpp>
 #include <store/utils.hpp>
 
 #include "builders/ibuildCtx.hpp"
 #include "policy/assetBuilder.hpp"
+#include "policy/assetCache.hpp"
 #include "policy/factory.hpp"
 #include "policy/policy.hpp"
 #include "register.hpp"
@@ -18,6 +22,33 @@ class Builder::Registry final : public builders::RegistryType
 {
 };
 
+namespace
+{
+/**
+ * @brief Build the report of a validation, the message of the only invalid asset or one line per invalid asset.
+ */
+base::OptError validationReport(const std::vector<policy::factory::AssetError>& errors)
+{
+    if (errors.empty())
+    {
+        return base::noError();
+    }
+
+    if (errors.size() == 1)
+    {
+        return base::Error {errors.front().message};
+    }
+
+    auto report = fmt::format("{} assets are invalid:", errors.size());
+    for (const auto& error : errors)
+    {
+        report += fmt::format("\n'{}': {}", error.name, error.message);
+    }
+
+    return base::Error {std::move(report)};
+}
+} // namespace
+
 Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
                  const std::shared_ptr<schemf::IValidator>& schema,
                  const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
@@ -25,6 +56,9 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
     : m_storeRead {storeRead}
     , m_schema {schema}
     , m_definitionsBuilder {definitionsBuilder}
+    , m_buildThreads {builderDeps.buildThreads}
+    , m_decoderStats {builderDeps.reorderDecoders ? metricsManager::AssetStats::global() : nullptr}
+    , m_assetCache {std::make_shared<policy::AssetCache>()}
 {
     if (!m_storeRead)
     {
@@ -41,6 +75,11 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
         throw std::runtime_error {"Definitions builder is null"};
     }
 
+    if (m_buildThreads == 0)
+    {
+        throw std::runtime_error {"Build threads cannot be 0"};
+    }
+
     // Registry
     m_registry = std::static_pointer_cast<Registry>(Registry::create<builder::Registry>());
 
@@ -50,20 +89,29 @@ Builder::Builder(const std::shared_ptr<store::IStore>& storeRead,
 
 std::shared_ptr<IPolicy> Builder::buildPolicy(const base::Name& name) const
 {
+    // The builds allocate from their own arena, away from the events of the router
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::BUILDER};
     auto policyDoc = m_storeRead->readInternalDoc(name);
     if (base::isError(policyDoc))
     {
         throw std::runtime_error(base::getError(policyDoc).message);
     }
 
-    auto policy = std::make_shared<policy::Policy>(
-        base::getResponse<store::Doc>(policyDoc), m_storeRead, m_definitionsBuilder, m_registry, m_schema);
+    auto policy = std::make_shared<policy::Policy>(base::getResponse<store::Doc>(policyDoc),
+                                                   m_storeRead,
+                                                   m_definitionsBuilder,
+                                                   m_registry,
+                                                   m_schema,
+                                                   m_buildThreads,
+                                                   m_assetCache,
+                                                   m_decoderStats);
 
     return policy;
 }
 
 base::Expression Builder::buildAsset(const base::Name& name) const
 {
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::BUILDER};
     auto assetDoc = store::utils::get(m_storeRead, name);
     if (base::isError(assetDoc))
     {
@@ -83,6 +131,7 @@ base::Expression Builder::buildAsset(const base::Name& name) const
 
 base::OptError Builder::validateIntegration(const json::Json& json, const std::string& namespaceId) const
 {
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::BUILDER};
     // TODO: Make factory so this can be implemented without duplicating code
     policy::factory::PolicyData policyData;
     try
@@ -130,34 +179,25 @@ base::OptError Builder::validateIntegration(const json::Json& json, const std::s
         return base::Error {e.what()};
     }
 
-    auto buildCtx = std::make_shared<builders::BuildCtx>();
-    buildCtx->setRegistry(m_registry);
-    buildCtx->setValidator(m_schema);
-    buildCtx->runState().trace = true;
-
-    auto assetBuilder = std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
-
+    // The independent assets are validated in parallel, every invalid asset is reported
     try
     {
-        policy::factory::buildAssets(policyData, m_storeRead, assetBuilder);
+        const auto validated =
+            policy::factory::validateAssets(policyData, m_storeRead, validationBuilder(), m_buildThreads);
+        return validationReport(validated.errors);
     }
     catch (const std::exception& e)
     {
         return base::Error {e.what()};
     }
-
-    return base::noError();
 }
 
 base::OptError Builder::validateAsset(const json::Json& json) const
 {
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::BUILDER};
     try
     {
-        auto buildCtx = std::make_shared<builders::BuildCtx>();
-        buildCtx->setRegistry(m_registry);
-        buildCtx->setValidator(m_schema);
-        auto assetBuilder = std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
-        auto asset = (*assetBuilder)(json);
+        auto asset = (*validationBuilder())(json);
     }
     catch (const std::exception& e)
     {
@@ -169,10 +209,21 @@ base::OptError Builder::validateAsset(const json::Json& json) const
 
 base::OptError Builder::validatePolicy(const json::Json& json) const
 {
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::BUILDER};
+    // Same steps as building the policy, but the assets are validated in parallel, reporting every invalid asset, and
+    // the cache is only read
     try
     {
-        auto policy = std::make_shared<policy::Policy>(
-            json, m_storeRead, m_definitionsBuilder, m_registry, m_schema);
+        const auto policyData = policy::factory::readData(json, m_storeRead);
+        const auto validated = policy::factory::validateAssets(
+            policyData, m_storeRead, validationBuilder(policyData.name()), m_buildThreads);
+        if (!validated.errors.empty())
+        {
+            return validationReport(validated.errors);
+        }
+
+        const auto policyGraph = policy::factory::buildGraph(validated.assets, policyData);
+        policy::factory::buildExpression(policyGraph, policyData);
     }
     catch (const std::exception& e)
     {
@@ -181,4 +232,17 @@ base::OptError Builder::validatePolicy(const json::Json& json) const
 
     return base::noError();
 }
+
+std::shared_ptr<policy::IAssetBuilder> Builder::validationBuilder(const std::string& policyName) const
+{
+    auto buildCtx = std::make_shared<builders::BuildCtx>();
+    buildCtx->setRegistry(m_registry);
+    buildCtx->setValidator(m_schema);
+    buildCtx->context().policyName = policyName;
+    buildCtx->runState().trace = true;
+
+    // The content validated may never be stored, only the assets already cached are reused
+    auto assetBuilder = std::make_shared<policy::AssetBuilder>(buildCtx, m_definitionsBuilder);
+    return std::make_shared<policy::CachedAssetBuilder>(assetBuilder, m_assetCache, false);
+}
 } // namespace builder
@@ -31,6 +31,7 @@ class Reference : public Argument
 private:
     std::string m_dotPath;
     std::string m_jsonPath;
+    json::Path m_jsonPointer; ///< Precompiled m_jsonPath, to access the field at runtime
 
 public:
     Reference() = default;
@@ -39,12 +40,14 @@ public:
     {
         m_dotPath = dotPath;
         m_jsonPath = json::Json::formatJsonPath(dotPath);
+        m_jsonPointer = json::Path(m_jsonPath);
     }
 
     explicit Reference(const std::string& dotPath) { set(dotPath); }
 
     const std::string& dotPath() const { return m_dotPath; }
     const std::string& jsonPath() const { return m_jsonPath; }
+    const json::Path& jsonPointer() const { return m_jsonPointer; }
 
     bool isReference() const override { return true; }
     std::string str() const override { return std::string {syntax::field::REF_ANCHOR} + m_dotPath; }
@@ -2,6 +2,7 @@
 
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
+#include <metrics/profiler.hpp>
 
 #include "builders/types.hpp"
 #include "helperParser.hpp"
@@ -25,7 +26,7 @@ auto setObjectTerm(const std::string& field) -> base::Expression
         {
             e->setObject(field);
         }
-        return base::result::makeSuccess(std::move(e), successTrace);
+        return base::result::makeSuccess(std::move(e), base::result::tracing() ? successTrace : "");
     };
     return base::Term<base::EngineOp>::create("setObjectOp", fn);
 }
@@ -47,10 +48,38 @@ auto deleteEmptyObjectTerm(const std::string& field) -> base::Expression
         {
             e->erase(field);
         }
-        return base::result::makeSuccess(std::move(e), successTrace);
+        return base::result::makeSuccess(std::move(e), base::result::tracing() ? successTrace : "");
     };
     return base::Term<base::EngineOp>::create("deleteEmptyObject", fn);
 }
+
+/**
+ * @brief Wraps an operation to record its executions while the profiler is active
+ *
+ * @param op Operation
+ * @param context Context of the operation
+ * @return builder::builders::TransformOp
+ */
+auto profiled(builder::builders::TransformOp op, const builder::builders::Context& context)
+    -> builder::builders::TransformOp
+{
+    auto site = metricsManager::Profiler::global()->site(context.assetName, context.stageName, context.opName);
+
+    return [op = std::move(op), site](base::Event event) -> builder::builders::TransformResult
+    {
+        const auto& profiler = metricsManager::Profiler::global();
+        if (!profiler->active())
+        {
+            return op(std::move(event));
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto result = op(std::move(event));
+        profiler->record(*site, start, std::chrono::steady_clock::now());
+
+        return result;
+    };
+}
 } // namespace
 namespace builder::builders
 {
@@ -92,6 +121,7 @@ runType(const OpBuilder& builder, const Reference& targetField, const schemf::Va
             runValidator](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
     {
         auto mapOp = builder(opArgs, buildCtx);
+        buildCtx->countRuntimeValidation();
 
         // Wrapper MapOp
         const auto& invalidTrace = fmt::format("{} -> schema validation failed: ", buildCtx->context().opName);
@@ -130,7 +160,7 @@ TransformBuilder filterToTransform(const FilterBuilder& builder)
             auto filterRes = filterOp(event);
             if (filterRes.failure())
             {
-                return base::result::makeFailure<base::Event>(event, filterRes.popTrace());
+                return base::result::makeFailure<base::Event>(std::move(event), filterRes.popTrace());
             }
 
             return base::result::makeSuccess(std::move(event), filterRes.popTrace());
@@ -152,12 +182,12 @@ TransformBuilder mapToTransform(const MapBuilder& builder, const Reference& targ
             auto mapRes = mapOp(event);
             if (mapRes.failure())
             {
-                return base::result::makeFailure<base::Event>(event, mapRes.popTrace());
+                return base::result::makeFailure<base::Event>(std::move(event), mapRes.popTrace());
             }
 
             event->set(targetField.jsonPath(), mapRes.popPayload());
 
-            return base::result::makeSuccess(event, mapRes.popTrace());
+            return base::result::makeSuccess(std::move(event), mapRes.popTrace());
         };
     };
 }
@@ -262,7 +292,7 @@ base::Expression baseHelperBuilder(const std::string& helperName,
         auto finalBuilder =
             toTransform(buildType(builder, targetField, validationToken, newBuildCtx->validator()), targetField);
 
-        op = toExpression(finalBuilder(targetField, opArgs, newBuildCtx), name);
+        op = toExpression(profiled(finalBuilder(targetField, opArgs, newBuildCtx), newBuildCtx->context()), name);
     }
     catch (const std::exception& e)
     {
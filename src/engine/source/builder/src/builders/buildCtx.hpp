@@ -1,6 +1,7 @@
 #ifndef _BUILDER_BUILDERS_BUILDCTX_HPP
 #define _BUILDER_BUILDERS_BUILDCTX_HPP
 
+#include <atomic>
 #include <string>
 
 #include "ibuildCtx.hpp"
@@ -22,6 +23,8 @@ private:
 
     std::shared_ptr<const schemf::ISchema> m_schema; // Schema
 
+    std::shared_ptr<std::atomic<std::size_t>> m_runtimeValidations; // Operations built with runtime validation
+
 public:
     BuildCtx()
     {
@@ -30,6 +33,7 @@ public:
         m_registry = nullptr;
         m_definitions = nullptr;
         m_schemaValidator = nullptr;
+        m_runtimeValidations = std::make_shared<std::atomic<std::size_t>>(0);
     }
 
     ~BuildCtx() = default;
@@ -44,6 +48,7 @@ public:
         , m_registry(registry)
         , m_definitions(definitions)
         , m_schemaValidator(schemaValidator)
+        , m_runtimeValidations(std::make_shared<std::atomic<std::size_t>>(0))
     {
     }
 
@@ -72,6 +77,14 @@ public:
 
     inline std::shared_ptr<const RunState> runState() const override { return m_runState; }
     inline RunState& runState() { return *m_runState; }
+
+    inline void countRuntimeValidation() const override { ++(*m_runtimeValidations); }
+    inline std::size_t runtimeValidations() const override { return m_runtimeValidations->load(); }
+
+    /**
+     * @brief Start a new count of runtime validations, not shared with the contexts this one was copied from.
+     */
+    inline void resetRuntimeValidations() { m_runtimeValidations = std::make_shared<std::atomic<std::size_t>>(0); }
 };
 
 } // namespace builder::builders
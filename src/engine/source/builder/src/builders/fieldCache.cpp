@@ -0,0 +1,94 @@
+#include "fieldCache.hpp"
+
+namespace builder::builders
+{
+namespace
+{
+/**
+ * @brief Resolved fields of the block running in this thread.
+ */
+struct Resolved
+{
+    struct Entry
+    {
+        uint64_t run {0};                         ///< Run where the field was resolved
+        std::optional<json::JsonConstView> value; ///< Resolved field
+    };
+
+    uint64_t run {1};           ///< Current run, the entries of other runs are not resolved
+    std::vector<Entry> entries; ///< Entries by slot
+};
+
+thread_local Resolved g_resolved;
+thread_local FieldCache* g_building {nullptr};
+} // namespace
+
+std::optional<json::JsonConstView> FieldCache::Field::get(const json::Json& event) const
+{
+    if (!m_slot || !m_slot->cached || m_slot->index >= g_resolved.entries.size())
+    {
+        return event.getView(m_path);
+    }
+
+    auto& entry = g_resolved.entries[m_slot->index];
+    if (entry.run != g_resolved.run)
+    {
+        entry.value = event.getView(m_path);
+        entry.run = g_resolved.run;
+    }
+
+    return entry.value;
+}
+
+FieldCache::BuildScope::BuildScope(FieldCache& cache)
+    : m_previous(g_building)
+{
+    g_building = &cache;
+}
+
+FieldCache::BuildScope::~BuildScope()
+{
+    g_building = m_previous;
+}
+
+FieldCache::Field FieldCache::field(const std::string& jsonPointer)
+{
+    json::Path path {jsonPointer};
+    if (g_building == nullptr)
+    {
+        return Field {std::move(path)};
+    }
+
+    auto& slot = g_building->m_slots[jsonPointer];
+    if (!slot)
+    {
+        slot = std::make_shared<Slot>();
+    }
+    ++slot->uses;
+
+    return Field {std::move(path), slot};
+}
+
+void FieldCache::seal()
+{
+    m_size = 0;
+    for (auto& [pointer, slot] : m_slots)
+    {
+        slot->cached = slot->uses > 1;
+        if (slot->cached)
+        {
+            slot->index = m_size++;
+        }
+    }
+}
+
+void FieldCache::open() const
+{
+    ++g_resolved.run;
+    if (g_resolved.entries.size() < m_size)
+    {
+        g_resolved.entries.resize(m_size);
+    }
+}
+
+} // namespace builder::builders
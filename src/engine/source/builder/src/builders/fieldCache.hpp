@@ -0,0 +1,133 @@
+#ifndef _BUILDER_BUILDERS_FIELDCACHE_HPP
+#define _BUILDER_BUILDERS_FIELDCACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <base/json.hpp>
+
+namespace builder::builders
+{
+
+/**
+ * @brief Fields referenced by the operations of a check block, resolved once per event.
+ *
+ * While a block is built, the operations get their fields from the cache of the block, and the fields referenced by
+ * more than one operation get a slot. Each run of the block opens the cache first, and the first operation that reads
+ * a shared field resolves it into its slot, the rest read the slot. The slots are thread local and are only valid
+ * until the next open, so they can only be used by read only operations, the check blocks never modify the event.
+ *
+ * @note The fields referenced by a single operation are resolved as usual, so a block without shared fields does not
+ * need to be opened.
+ */
+class FieldCache
+{
+private:
+    struct Slot
+    {
+        std::size_t uses {0};  ///< Operations that reference the field
+        bool cached {false};   ///< The field is read from its slot
+        std::size_t index {0}; ///< Position of the slot
+    };
+
+    std::unordered_map<std::string, std::shared_ptr<Slot>> m_slots; ///< Slots by field pointer path
+    std::size_t m_size {0};                                          ///< Number of cached fields, set on seal
+
+public:
+    /**
+     * @brief Field read by an operation, from its slot if it is shared in the block.
+     */
+    class Field
+    {
+    private:
+        json::Path m_path;                  ///< Path of the field
+        std::shared_ptr<const Slot> m_slot; ///< Slot of the field, null if it is not built in a block
+
+    public:
+        /**
+         * @brief Construct a field that is always resolved from the event.
+         *
+         * @param path Path of the field.
+         */
+        explicit Field(json::Path path)
+            : m_path(std::move(path))
+        {
+        }
+
+        /**
+         * @brief Construct a field read from its slot once the block is sealed, if it is shared.
+         *
+         * @param path Path of the field.
+         * @param slot Slot of the field in the block.
+         */
+        Field(json::Path path, std::shared_ptr<const Slot> slot)
+            : m_path(std::move(path))
+            , m_slot(std::move(slot))
+        {
+        }
+
+        /**
+         * @brief Get the path of the field.
+         */
+        const json::Path& path() const { return m_path; }
+
+        /**
+         * @brief Get a view of the field in the event.
+         *
+         * @param event Event being checked.
+         * @return std::optional<json::JsonConstView> The view, or nothing if the field does not exist.
+         */
+        std::optional<json::JsonConstView> get(const json::Json& event) const;
+    };
+
+    /**
+     * @brief Sets the cache where the fields are registered while a block is built in this thread.
+     *
+     * The previous cache is restored when the scope is destroyed, so the fields built outside any block are never
+     * cached.
+     */
+    class BuildScope
+    {
+    private:
+        FieldCache* m_previous;
+
+    public:
+        explicit BuildScope(FieldCache& cache);
+        ~BuildScope();
+
+        BuildScope(const BuildScope&) = delete;
+        BuildScope& operator=(const BuildScope&) = delete;
+    };
+
+    /**
+     * @brief Get the field of a pointer path, registered in the block being built in this thread if any.
+     *
+     * @param jsonPointer Pointer path of the field.
+     * @return Field
+     * @throw std::runtime_error if the path is invalid.
+     */
+    static Field field(const std::string& jsonPointer);
+
+    /**
+     * @brief Assigns the slots of the fields referenced by more than one operation, once the block is built.
+     */
+    void seal();
+
+    /**
+     * @brief Check if any field of the block is cached, so the block must be opened on each run.
+     */
+    bool empty() const { return m_size == 0; }
+
+    /**
+     * @brief Starts a run of the block in this thread, invalidating the slots of the previous run.
+     */
+    void open() const;
+};
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_FIELDCACHE_HPP
@@ -56,6 +56,10 @@ public:
     virtual Context& context() = 0;
 
     virtual std::shared_ptr<const RunState> runState() const = 0;
+
+    // Count of the operations built with a runtime schema validation, shared by the clones of the context
+    virtual void countRuntimeValidation() const = 0;
+    virtual std::size_t runtimeValidations() const = 0;
 };
 
 } // namespace builder::builders
@@ -0,0 +1,162 @@
+#include "cidrSet.hpp"
+
+#include <arpa/inet.h>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#include <base/utils/ipUtils.hpp>
+
+namespace builder::builders::opfilter
+{
+
+namespace
+{
+constexpr std::size_t IPV4_BITS {32};
+constexpr std::size_t IPV6_BITS {128};
+
+/**
+ * @brief Get the bit of an address, from the most significant one.
+ */
+inline std::size_t bitAt(const uint8_t* address, std::size_t bit)
+{
+    return (address[bit / 8] >> (7 - bit % 8)) & 1;
+}
+
+/**
+ * @brief Parse the prefix length of a network.
+ *
+ * @param prefix Prefix length or, for IPv4, dotted mask
+ * @param bits Number of bits of the addresses of the family
+ * @return std::size_t
+ * @throw std::runtime_error if the prefix is not valid.
+ */
+std::size_t parsePrefix(const std::string& prefix, std::size_t bits)
+{
+    if (bits == IPV4_BITS && prefix.find('.') != std::string::npos)
+    {
+        uint32_t mask {};
+        try
+        {
+            mask = ::utils::ip::IPv4MaskUInt(prefix);
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error(fmt::format("Invalid IPv4 mask '{}': {}", prefix, e.what()));
+        }
+
+        // The mask must be contiguous to be a prefix
+        auto length = static_cast<std::size_t>(__builtin_popcount(mask));
+        if (length != 0 && mask != 0xFFFFFFFF << (IPV4_BITS - length))
+        {
+            throw std::runtime_error(fmt::format("IPv4 mask '{}' is not contiguous", prefix));
+        }
+        return length;
+    }
+
+    if (prefix.empty() || prefix.find_first_not_of("0123456789") != std::string::npos || prefix.size() > 3)
+    {
+        throw std::runtime_error(fmt::format("Invalid prefix length '{}'", prefix));
+    }
+    auto length = std::stoul(prefix);
+    if (length > bits)
+    {
+        throw std::runtime_error(fmt::format("Prefix length '{}' exceeds the {} bits of the address", prefix, bits));
+    }
+    return length;
+}
+} // namespace
+
+CidrSet::CidrSet()
+    : m_ipv4(1)
+    , m_ipv6(1)
+{
+}
+
+void CidrSet::insert(std::vector<Node>& trie, const uint8_t* address, std::size_t prefixLength)
+{
+    std::size_t node = 0;
+    for (std::size_t bit = 0; bit < prefixLength; ++bit)
+    {
+        // Already covered by a shorter network
+        if (trie[node].terminal)
+        {
+            return;
+        }
+
+        auto next = bitAt(address, bit);
+        if (trie[node].children[next] == -1)
+        {
+            trie[node].children[next] = static_cast<int32_t>(trie.size());
+            trie.emplace_back();
+        }
+        node = trie[node].children[next];
+    }
+
+    // The longer networks under this one are not needed anymore
+    trie[node].terminal = true;
+    trie[node].children = {-1, -1};
+}
+
+bool CidrSet::lookup(const std::vector<Node>& trie, const uint8_t* address, std::size_t bits)
+{
+    std::size_t node = 0;
+    for (std::size_t bit = 0; bit < bits; ++bit)
+    {
+        if (trie[node].terminal)
+        {
+            return true;
+        }
+
+        auto next = trie[node].children[bitAt(address, bit)];
+        if (next == -1)
+        {
+            return false;
+        }
+        node = next;
+    }
+
+    return trie[node].terminal;
+}
+
+void CidrSet::add(std::string_view cidr)
+{
+    auto slash = cidr.find('/');
+    auto address = cidr.substr(0, slash);
+
+    uint8_t buffer[sizeof(in6_addr)] {};
+    if (::utils::ip::parseIPv4(address, buffer))
+    {
+        auto length = slash == std::string_view::npos ? IPV4_BITS
+                                                      : parsePrefix(std::string {cidr.substr(slash + 1)}, IPV4_BITS);
+        insert(m_ipv4, buffer, length);
+    }
+    else if (::utils::ip::parseIPv6(address, buffer))
+    {
+        auto length = slash == std::string_view::npos ? IPV6_BITS
+                                                      : parsePrefix(std::string {cidr.substr(slash + 1)}, IPV6_BITS);
+        insert(m_ipv6, buffer, length);
+    }
+    else
+    {
+        throw std::runtime_error(fmt::format("Invalid network address '{}'", address));
+    }
+}
+
+std::optional<bool> CidrSet::contains(std::string_view ip) const
+{
+    uint8_t buffer[sizeof(in6_addr)];
+    if (::utils::ip::parseIPv4(ip, buffer))
+    {
+        return lookup(m_ipv4, buffer, IPV4_BITS);
+    }
+    if (::utils::ip::parseIPv6(ip, buffer))
+    {
+        return lookup(m_ipv6, buffer, IPV6_BITS);
+    }
+
+    return std::nullopt;
+}
+
+} // namespace builder::builders::opfilter
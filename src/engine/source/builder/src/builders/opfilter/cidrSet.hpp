@@ -0,0 +1,76 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
+#define _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Set of IPv4 and IPv6 networks, compiled into a binary prefix trie per family.
+ *
+ * Checking an address walks at most one node per bit of the address, independently of the number of networks. A
+ * network covered by a shorter one is not stored.
+ */
+class CidrSet
+{
+private:
+    /**
+     * @brief Node of the trie, a prefix of one or more networks.
+     */
+    struct Node
+    {
+        std::array<int32_t, 2> children {-1, -1}; ///< Index of the nodes of the next bit, -1 if none
+        bool terminal {false};                    ///< A network ends at this prefix
+    };
+
+    std::vector<Node> m_ipv4; ///< Trie of the IPv4 networks, the first node is the root
+    std::vector<Node> m_ipv6; ///< Trie of the IPv6 networks, the first node is the root
+
+    /**
+     * @brief Add a network to a trie.
+     *
+     * @param trie Trie of the family of the network
+     * @param address Address of the network, in network byte order
+     * @param prefixLength Number of bits of the network prefix
+     */
+    static void insert(std::vector<Node>& trie, const uint8_t* address, std::size_t prefixLength);
+
+    /**
+     * @brief Check if an address is in any network of a trie.
+     *
+     * @param trie Trie of the family of the address
+     * @param address Address, in network byte order
+     * @param bits Number of bits of the address
+     * @return true if a network of the trie contains the address
+     */
+    static bool lookup(const std::vector<Node>& trie, const uint8_t* address, std::size_t bits);
+
+public:
+    CidrSet();
+
+    /**
+     * @brief Add a network to the set.
+     *
+     * @param cidr Network in CIDR notation, i.e. "10.0.0.0/8" or "fd00::/8". The IPv4 networks also accept a dotted
+     * mask, i.e. "10.0.0.0/255.0.0.0", and an address without prefix is a single host.
+     * @throw std::runtime_error if the network is not valid.
+     */
+    void add(std::string_view cidr);
+
+    /**
+     * @brief Check if an address is in any network of the set.
+     *
+     * @param ip IPv4 or IPv6 address
+     * @return std::optional<bool> true if a network contains the address, empty if it is not a valid address.
+     */
+    std::optional<bool> contains(std::string_view ip) const;
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_CIDRSET_HPP
@@ -1,5 +1,7 @@
 #include "exists.hpp"
 
+#include "builders/fieldCache.hpp"
+
 namespace
 {
 using namespace builder::builders;
@@ -13,10 +15,13 @@ FilterOp exists(const Reference& targetField,
 
     const auto successTrace = fmt::format("{} -> Success", buildCtx->context().opName);
     const auto failureTrace = fmt::format("{} -> Failure", buildCtx->context().opName);
-    return [targetField = targetField.jsonPath(), runState = buildCtx->runState(), successTrace, failureTrace, negate](
-               base::ConstEvent event) -> FilterResult
+    return [targetField = FieldCache::field(targetField.jsonPath()),
+            runState = buildCtx->runState(),
+            successTrace,
+            failureTrace,
+            negate](base::ConstEvent event) -> FilterResult
     {
-        if (event->exists(targetField) == negate)
+        if (targetField.get(*event).has_value() == negate)
         {
             RETURN_FAILURE(runState, false, failureTrace);
         }
@@ -1,7 +1,12 @@
 #include "opBuilderHelperFilter.hpp"
 
 #include <algorithm>
+#include <deque>
+#include <functional>
 #include <optional>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <variant>
 
 #include <re2/re2.h>
@@ -10,6 +15,9 @@
 #include "syntax.hpp"
 #include <base/utils/ipUtils.hpp>
 
+#include "builders/fieldCache.hpp"
+#include "regexSet.hpp"
+
 namespace builder::builders::opfilter
 {
 
@@ -44,290 +52,293 @@ enum class Type
 };
 
 /**
- * @brief Get the Int Cmp Function object
+ * @brief Trace messages of the comparison helpers.
  *
- * @param targetField Reference of the field to compare, obtained from the YAML key
- * @param op Operator to use
- * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @return std::function<FilterResult(base::Event)>
+ */
+struct CmpTraces
+{
+    std::string success;        ///< Comparison is true
+    std::string targetNotFound; ///< Target field not found or not of the expected type
+    std::string refNotFound;    ///< Reference not found or not of the expected type
+    std::string cmpFalse;       ///< Comparison is false
+
+    CmpTraces(const std::string& name, const std::string& targetField)
+        : success {fmt::format("[{}] -> Success", name)}
+        , targetNotFound {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)}
+        , refNotFound {fmt::format("[{}] -> Failure: Reference not found", name)}
+        , cmpFalse {fmt::format("[{}] -> Failure: Comparison is false", name)}
+    {
+    }
+};
+
+/**
+ * @brief Comparison of the string operator start with.
  *
- * @throws std::runtime_error
- *   - if the right parameter is a value and not a valid integer
- *   - if helper::base::Parameter::Type is not supported
  */
-FilterOp getIntCmpFunction(const std::string& targetField,
-                           Operator op,
-                           const OpArg& rightParameter,
-                           const std::shared_ptr<const IBuildCtx>& buildCtx)
+struct StartsWith
 {
-    // Depending on rValue type we store the reference or the integer value
-    std::variant<std::string, int64_t> rValue {};
+    bool operator()(std::string_view l, std::string_view r) const { return l.substr(0, r.length()) == r; }
+};
 
-    if (rightParameter->isValue())
+/**
+ * @brief Comparison of the string operator contains, an empty string is never contained.
+ *
+ */
+struct Contains
+{
+    bool operator()(std::string_view l, std::string_view r) const
     {
-        try
-        {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getInt64().value();
-        }
-        catch (const std::exception& e)
-        {
-            throw std::runtime_error(fmt::format(R"(Expected an integer but got '{}'.)",
-                                                 std::static_pointer_cast<Value>(rightParameter)->value().str()));
-        }
+        return !r.empty() && l.find(r) != std::string_view::npos;
     }
-    else
+};
+
+/**
+ * @brief Getter of the integer operands, as 64 bits integers.
+ *
+ */
+struct IntGetter
+{
+    std::optional<int64_t> operator()(const json::Json& event, const FieldCache::Field& field) const
     {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath())
-            && buildCtx->validator().getType(ref->dotPath()) != schemf::Type::INTEGER)
-        {
-            throw std::runtime_error(
-                fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                            schemf::typeToStr(schemf::Type::INTEGER),
-                            ref->dotPath(),
-                            schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
-        }
-        rValue = std::static_pointer_cast<Reference>(rightParameter)->jsonPath();
+        const auto value = field.get(event);
+        return value ? value->getIntAsInt64() : std::nullopt;
     }
+};
 
-    // Depending on the operator we return the correct function
-    std::function<bool(int64_t l, int64_t r)> cmpFunction;
-    switch (op)
+/**
+ * @brief Getter of the string operands, as views of the strings of the event.
+ *
+ */
+struct StringGetter
+{
+    std::optional<std::string_view> operator()(const json::Json& event, const FieldCache::Field& field) const
     {
-        case Operator::EQ:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l == r;
-            };
-            break;
-        case Operator::NE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l != r;
-            };
-            break;
-        case Operator::GT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l > r;
-            };
-            break;
-        case Operator::GE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l >= r;
-            };
-            break;
-        case Operator::LT:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l < r;
-            };
-            break;
-        case Operator::LE:
-            cmpFunction = [](int64_t l, int64_t r)
-            {
-                return l <= r;
-            };
-            break;
-        default: break;
+        const auto value = field.get(event);
+        return value ? value->getStringView() : std::nullopt;
     }
+};
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
-
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
+/**
+ * @brief Get the function of a comparison, specialized on the comparison and the kind of the right operand.
+ *
+ * The comparison is resolved at build time, so the operation only reads the operands from the event and compares
+ * them.
+ *
+ * @tparam Cmp Comparison functor
+ * @tparam Getter Getter of the operands from the event
+ * @tparam RValue FieldCache::Field if the right operand is a reference, otherwise the type of the constant
+ * @param targetPath Field to compare
+ * @param rValue Right operand, a field or a constant
+ * @param traces Trace messages
+ * @param runState Runtime state
+ * @return FilterOp
+ */
+template<typename Cmp, typename Getter, typename RValue>
+FilterOp
+getCmpOp(FieldCache::Field targetPath, RValue rValue, CmpTraces traces, std::shared_ptr<const RunState> runState)
+{
+    return [targetPath = std::move(targetPath),
+            rValue = std::move(rValue),
+            traces = std::move(traces),
+            runState = std::move(runState)](base::ConstEvent event) -> FilterResult
     {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
-
-        auto lValue = event->getIntAsInt64(targetField);
+        const auto lValue = Getter {}(*event, targetPath);
         if (!lValue.has_value())
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
+            RETURN_FAILURE(runState, false, traces.targetNotFound);
         }
 
-        int64_t resolvedValue {0};
-        if (std::holds_alternative<std::string>(rValue))
+        bool result;
+        if constexpr (std::is_same_v<RValue, FieldCache::Field>)
         {
-            auto resolvedRValue = event->getIntAsInt64(std::get<std::string>(rValue));
+            const auto resolvedRValue = Getter {}(*event, rValue);
             if (!resolvedRValue.has_value())
             {
-                RETURN_FAILURE(runState, false, failureTrace2);
+                RETURN_FAILURE(runState, false, traces.refNotFound);
             }
-            resolvedValue = resolvedRValue.value();
+            result = Cmp {}(lValue.value(), resolvedRValue.value());
         }
         else
         {
-            resolvedValue = std::get<int64_t>(rValue);
+            result = Cmp {}(lValue.value(), rValue);
         }
 
-        if (cmpFunction(lValue.value(), resolvedValue))
+        if (result)
         {
-            RETURN_SUCCESS(runState, true, successTrace);
-        }
-        else
-        {
-            RETURN_FAILURE(runState, false, failureTrace3);
+            RETURN_SUCCESS(runState, true, traces.success);
         }
+        RETURN_FAILURE(runState, false, traces.cmpFalse);
     };
 }
 
 /**
- * @brief Get the String Cmp Function object
+ * @brief Get the function of a comparison, dispatching the operator to the specialized function.
  *
- * @param targetField Reference of the field to compare, obtained from the YAML key
+ * @tparam Getter Getter of the operands from the event
+ * @tparam RValue FieldCache::Field if the right operand is a reference, otherwise the type of the constant
  * @param op Operator to use
- * @param rightParameter Right parameter to compare, obtained from the YAML value
- * @param name Formatted name of the helper
- * @return std::function<FilterResult(base::Event)>
+ * @param targetPath Field to compare
+ * @param rValue Right operand, a field or a constant
+ * @param traces Trace messages
+ * @param runState Runtime state
+ * @return FilterOp
  *
- * @throws std::runtime_error if helper::base::Parameter::Type is not supported
+ * @throws std::runtime_error if the operator is not supported by the type
  */
-FilterOp getStringCmpFunction(const std::string& targetField,
-                              Operator op,
-                              const OpArg& rightParameter,
-                              const std::shared_ptr<const IBuildCtx>& buildCtx)
+template<typename Getter, typename RValue>
+FilterOp getCmpFunction(Operator op,
+                        FieldCache::Field targetPath,
+                        RValue rValue,
+                        CmpTraces traces,
+                        std::shared_ptr<const RunState> runState)
 {
-    // Depending on the operator we return the correct function
-    std::function<bool(const std::string& l, const std::string& r)> cmpFunction;
+    // The string operators only apply to strings
+    constexpr auto isString = std::is_same_v<Getter, StringGetter>;
+
     switch (op)
     {
         case Operator::EQ:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l == r;
-            };
-            break;
+            return getCmpOp<std::equal_to<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::NE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l != r;
-            };
-            break;
+            return getCmpOp<std::not_equal_to<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::GT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l > r;
-            };
-            break;
+            return getCmpOp<std::greater<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::GE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l >= r;
-            };
-            break;
+            return getCmpOp<std::greater_equal<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::LT:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l < r;
-            };
-            break;
+            return getCmpOp<std::less<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::LE:
-            cmpFunction = [](const std::string& l, const std::string& r)
-            {
-                return l <= r;
-            };
-            break;
+            return getCmpOp<std::less_equal<>, Getter>(
+                std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
         case Operator::ST:
-            cmpFunction = [](const std::string& l, const std::string& r)
+            if constexpr (isString)
             {
-                return l.substr(0, r.length()) == r;
-            };
+                return getCmpOp<StartsWith, Getter>(
+                    std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
+            }
             break;
         case Operator::CN:
-            cmpFunction = [](const std::string& l, const std::string& r)
+            if constexpr (isString)
             {
-                if (!r.empty())
-                {
-                    return l.find(r) != std::string::npos;
-                }
-                return false;
-            };
+                return getCmpOp<Contains, Getter>(
+                    std::move(targetPath), std::move(rValue), std::move(traces), std::move(runState));
+            }
             break;
-
         default: break;
     }
 
+    throw std::runtime_error(fmt::format("Comparison helper: Operator '{}' not supported", static_cast<int>(op)));
+}
+
+/**
+ * @brief Get the Int Cmp Function object
+ *
+ * @param targetField Reference of the field to compare, obtained from the YAML key
+ * @param op Operator to use
+ * @param rightParameter Right parameter to compare, obtained from the YAML value
+ * @return std::function<FilterResult(base::Event)>
+ *
+ * @throws std::runtime_error
+ *   - if the right parameter is a value and not a valid integer
+ *   - if helper::base::Parameter::Type is not supported
+ */
+FilterOp getIntCmpFunction(const std::string& targetField,
+                           Operator op,
+                           const OpArg& rightParameter,
+                           const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    CmpTraces traces {buildCtx->context().opName, targetField};
+
+    // Precompiled paths, shared by the operations of the block
+    auto targetPath = FieldCache::field(targetField);
+
+    // Depending on rValue type we compare with the reference or the integer value
     if (rightParameter->isValue())
     {
-        if (!std::static_pointer_cast<Value>(rightParameter)->value().isString())
+        int64_t rValue;
+        try
         {
-            throw std::runtime_error(fmt::format(R"(Expected a string but got '{}'.)",
-                                                 std::static_pointer_cast<Value>(rightParameter)->value().str()));
+            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getInt64().value();
         }
-    }
-    else
-    {
-        auto ref = std::static_pointer_cast<Reference>(rightParameter);
-        if (buildCtx->validator().hasField(ref->dotPath()))
+        catch (const std::exception& e)
         {
-            auto jType = buildCtx->validator().getJsonType(ref->dotPath());
-            if (jType != json::Json::Type::String)
-            {
-                throw std::runtime_error(
-                    fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
-                                json::Json::typeToStr(json::Json::Type::String),
-                                ref->dotPath(),
-                                json::Json::typeToStr(jType)));
-            }
+            throw std::runtime_error(fmt::format(R"(Expected an integer but got '{}'.)",
+                                                 std::static_pointer_cast<Value>(rightParameter)->value().str()));
         }
+
+        return getCmpFunction<IntGetter>(
+            op, std::move(targetPath), rValue, std::move(traces), buildCtx->runState());
     }
 
-    // Tracing messages
-    const auto name = buildCtx->context().opName;
-    const auto successTrace {fmt::format("[{}] -> Success", name)};
+    auto ref = std::static_pointer_cast<Reference>(rightParameter);
+    if (buildCtx->validator().hasField(ref->dotPath())
+        && buildCtx->validator().getType(ref->dotPath()) != schemf::Type::INTEGER)
+    {
+        throw std::runtime_error(
+            fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                        schemf::typeToStr(schemf::Type::INTEGER),
+                        ref->dotPath(),
+                        schemf::typeToStr(buildCtx->validator().getType(ref->dotPath()))));
+    }
 
-    const std::string failureTrace1 {fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField)};
-    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Reference not found", name)};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Comparison is false", name)};
+    return getCmpFunction<IntGetter>(
+        op, std::move(targetPath), FieldCache::field(ref->jsonPointer()), std::move(traces), buildCtx->runState());
+}
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> FilterResult
-    {
-        // We assert that references exists, checking if the optional from Json getter is
-        // empty ot not. Then if is a reference we get the value from the event, otherwise
-        // we get the value from the parameter
+/**
+ * @brief Get the String Cmp Function object
+ *
+ * @param targetField Reference of the field to compare, obtained from the YAML key
+ * @param op Operator to use
+ * @param rightParameter Right parameter to compare, obtained from the YAML value
+ * @param name Formatted name of the helper
+ * @return std::function<FilterResult(base::Event)>
+ *
+ * @throws std::runtime_error if helper::base::Parameter::Type is not supported
+ */
+FilterOp getStringCmpFunction(const std::string& targetField,
+                              Operator op,
+                              const OpArg& rightParameter,
+                              const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    CmpTraces traces {buildCtx->context().opName, targetField};
 
-        const auto lValue {event->getString(targetField)};
-        if (!lValue.has_value())
-        {
-            RETURN_FAILURE(runState, false, failureTrace1);
-        }
+    // Precompiled paths, shared by the operations of the block
+    auto targetPath = FieldCache::field(targetField);
 
-        std::string rValue {};
-        if (rightParameter->isValue())
+    if (rightParameter->isValue())
+    {
+        const auto& value = std::static_pointer_cast<Value>(rightParameter)->value();
+        if (!value.isString())
         {
-            rValue = std::static_pointer_cast<Value>(rightParameter)->value().getString().value();
+            throw std::runtime_error(fmt::format(R"(Expected a string but got '{}'.)", value.str()));
         }
-        else
-        {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, false, failureTrace2);
-            }
 
-            rValue = resolvedRValue.value();
-        }
+        return getCmpFunction<StringGetter>(
+            op, std::move(targetPath), value.getString().value(), std::move(traces), buildCtx->runState());
+    }
 
-        if (cmpFunction(lValue.value(), rValue))
-        {
-            RETURN_SUCCESS(runState, true, successTrace);
-        }
-        else
+    auto ref = std::static_pointer_cast<Reference>(rightParameter);
+    if (buildCtx->validator().hasField(ref->dotPath()))
+    {
+        auto jType = buildCtx->validator().getJsonType(ref->dotPath());
+        if (jType != json::Json::Type::String)
         {
-            RETURN_FAILURE(runState, false, failureTrace3);
+            throw std::runtime_error(
+                fmt::format("Expected a reference of type '{}' but got reference '{}' of type '{}'",
+                            json::Json::typeToStr(json::Json::Type::String),
+                            ref->dotPath(),
+                            json::Json::typeToStr(jType)));
         }
-    };
+    }
+
+    return getCmpFunction<StringGetter>(
+        op, std::move(targetPath), FieldCache::field(ref->jsonPointer()), std::move(traces), buildCtx->runState());
 }
 
 /**
@@ -499,6 +510,67 @@ FilterOp opBuilderHelperStringContains(const Reference& targetField,
     return op;
 }
 
+FilterOp buildSubstringSetFilter(const Reference& targetField,
+                                 std::shared_ptr<const SubstringSet> substringSet,
+                                 const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto name = buildCtx->context().opName;
+
+    // Tracing
+    const std::string successTrace {fmt::format("[{}] -> Success", name)};
+
+    const std::string failureTrace1 {
+        fmt::format("[{}] -> Failure: Target field '{}' not found or not a string", name, targetField.dotPath())};
+    const std::string failureTrace2 {fmt::format("[{}] -> Failure: Target field '{}' does not contain any value",
+                                                 name,
+                                                 targetField.dotPath())};
+
+    // Return Op
+    return [=, runState = buildCtx->runState(), targetPath = FieldCache::field(targetField.jsonPointer())](
+               base::ConstEvent event) -> FilterResult
+    {
+        const auto resolvedView {targetPath.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getStringView() : std::nullopt};
+        if (!resolvedField.has_value())
+        {
+            RETURN_FAILURE(runState, false, failureTrace1);
+        }
+
+        if (substringSet->containsAny(resolvedField.value()))
+        {
+            RETURN_SUCCESS(runState, true, successTrace);
+        }
+        RETURN_FAILURE(runState, false, failureTrace2);
+    };
+}
+
+// field: +contains_any/value1/value2/...valueN
+FilterOp opBuilderHelperStringContainsAny(const Reference& targetField,
+                                          const std::vector<OpArg>& opArgs,
+                                          const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    // Assert expected number of parameters
+    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
+    // Parameter type check
+    utils::assertValue(opArgs);
+
+    std::vector<std::string> substrings;
+    substrings.reserve(opArgs.size());
+    for (const auto& arg : opArgs)
+    {
+        const auto& value = std::static_pointer_cast<Value>(arg)->value();
+        if (!value.isString())
+        {
+            throw std::runtime_error(fmt::format("\"{}\" function: Expected a string but got '{}'",
+                                                 buildCtx->context().opName,
+                                                 value.str()));
+        }
+        substrings.emplace_back(value.getString().value());
+    }
+
+    return buildSubstringSetFilter(targetField, std::make_shared<SubstringSet>(substrings), buildCtx);
+}
+
 // field: binary_and($ref, value)
 FilterOp opBuilderHelperBinaryAnd(const Reference& targetField,
                                   const std::vector<OpArg>& opArgs,
@@ -565,7 +637,7 @@ FilterOp opBuilderHelperBinaryAnd(const Reference& targetField,
     auto getValue = [targetField, referenceNotFoundTrace, referenceNotValidHexTrace](
                         base::ConstEvent event) -> base::RespOrError<uint64_t>
     {
-        const auto value = event->getString(targetField.jsonPath());
+        const auto value = event->getString(targetField.jsonPointer());
         if (!value.has_value())
         {
             return base::Error {referenceNotFoundTrace};
@@ -590,19 +662,20 @@ FilterOp opBuilderHelperBinaryAnd(const Reference& targetField,
     };
 
     // The filter
-    return [getValue, mask, successTrace, failAndTrace](base::ConstEvent event) -> FilterResult
+    return [getValue, mask, successTrace, failAndTrace, runState = buildCtx->runState()](
+               base::ConstEvent event) -> FilterResult
     {
         auto valueResult = getValue(event);
         if (base::isError(valueResult))
         {
-            return base::result::makeFailure(false, base::getError(valueResult).message);
+            RETURN_FAILURE(runState, false, base::getError(valueResult).message);
         }
 
         if (base::getResponse(valueResult) & mask)
         {
-            return base::result::makeSuccess(true, successTrace);
+            RETURN_SUCCESS(runState, true, successTrace);
         }
-        return base::result::makeFailure(false, failAndTrace);
+        RETURN_FAILURE(runState, false, failAndTrace);
     };
 }
 
@@ -622,11 +695,8 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
 
     auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
-    {
-        throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", value));
-    }
+    // The patterns checked against the same field are matched at once
+    auto regex = RegexSet::join(targetField.jsonPointer(), value);
 
     // Tracing
     const auto name = buildCtx->context().opName;
@@ -637,16 +707,17 @@ FilterOp opBuilderHelperRegexMatch(const Reference& targetField,
     const std::string failureTrace2 {fmt::format("[{}] -> Failure: Regex did not match", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = FieldCache::field(targetField.jsonPointer())](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedView {targetField.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getStringView() : std::nullopt};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (regex->match(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -672,8 +743,12 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const auto name = buildCtx->context().opName;
     const auto value = std::static_pointer_cast<Value>(opArgs[0])->value().getString().value();
 
-    auto regex_ptr {std::make_shared<RE2>(value, RE2::Quiet)};
-    if (!regex_ptr->ok())
+    std::shared_ptr<const RegexSet::Member> regex;
+    try
+    {
+        regex = RegexSet::join(targetField.jsonPointer(), value);
+    }
+    catch (const std::runtime_error&)
     {
         throw std::runtime_error(fmt::format("\"{}\" function: "
                                              "Invalid regex: \"{}\".",
@@ -689,16 +764,17 @@ FilterOp opBuilderHelperRegexNotMatch(const Reference& targetField,
     const std::string failureTrace2 {fmt::format("[{}] -> Failure: Regex did match", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = FieldCache::field(targetField.jsonPointer())](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedView {targetField.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getStringView() : std::nullopt};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        if (!RE2::PartialMatch(resolvedField.value(), *regex_ptr))
+        if (!regex->match(resolvedField.value()))
         {
             RETURN_SUCCESS(runState, true, successTrace);
         }
@@ -766,10 +842,11 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: IP address is not in CIDR", name)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = FieldCache::field(targetField.jsonPointer())](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedView {targetField.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getString() : std::nullopt};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
@@ -798,6 +875,81 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
     };
 }
 
+FilterOp buildCidrSetFilter(const Reference& targetField,
+                            std::shared_ptr<const CidrSet> cidrSet,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    const auto name = buildCtx->context().opName;
+
+    // Tracing
+    const std::string successTrace {fmt::format("[{}] -> Success", name)};
+
+    const std::string failureTrace1 {
+        fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField.dotPath())};
+    const std::string failureTrace2 {
+        fmt::format("[{}] -> Failure: Target field '{}' is not a valid IP address", name, targetField.dotPath())};
+    const std::string failureTrace3 {fmt::format("[{}] -> Failure: IP address is not in any CIDR", name)};
+
+    // Return Op
+    return [=, runState = buildCtx->runState(), targetPath = FieldCache::field(targetField.jsonPointer())](
+               base::ConstEvent event) -> FilterResult
+    {
+        const auto resolvedView {targetPath.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getStringView() : std::nullopt};
+        if (!resolvedField.has_value())
+        {
+            RETURN_FAILURE(runState, false, failureTrace1);
+        }
+
+        const auto contained {cidrSet->contains(resolvedField.value())};
+        if (!contained.has_value())
+        {
+            RETURN_FAILURE(runState, false, failureTrace2);
+        }
+
+        if (contained.value())
+        {
+            RETURN_SUCCESS(runState, true, successTrace);
+        }
+        RETURN_FAILURE(runState, false, failureTrace3);
+    };
+}
+
+// field: +ip_cidr_match_any/10.0.0.0/8/172.16.0.0/12/fd00::/8
+FilterOp opBuilderHelperIPCIDRAny(const Reference& targetField,
+                                  const std::vector<OpArg>& opArgs,
+                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    // Assert expected number of parameters
+    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
+    // Parameter type check
+    utils::assertValue(opArgs);
+    // Format name for the tracer
+    const auto name = buildCtx->context().opName;
+
+    auto cidrSet = std::make_shared<CidrSet>();
+    for (const auto& arg : opArgs)
+    {
+        const auto& value = std::static_pointer_cast<Value>(arg)->value();
+        if (!value.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("\"{}\" function: Expected a network in CIDR notation but got '{}'", name, value.str()));
+        }
+
+        try
+        {
+            cidrSet->add(value.getString().value());
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error(fmt::format("\"{}\" function: {}", name, e.what()));
+        }
+    }
+
+    return buildCidrSetFilter(targetField, cidrSet, buildCtx);
+}
+
 FilterOp opBuilderHelperPublicIP(const Reference& targetField,
                                  const std::vector<OpArg>& opArgs,
                                  const std::shared_ptr<const IBuildCtx>& buildCtx)
@@ -830,10 +982,11 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
     };
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = FieldCache::field(targetField.jsonPointer())](
                base::ConstEvent event) -> FilterResult
     {
-        const auto resolvedField {event->getString(targetField)};
+        const auto resolvedView {targetField.get(*event)};
+        const auto resolvedField {resolvedView ? resolvedView->getString() : std::nullopt};
         if (!resolvedField.has_value())
         {
             RETURN_FAILURE(runState, false, failureTrace1);
@@ -856,91 +1009,109 @@ FilterOp opBuilderHelperPublicIP(const Reference& targetField,
 //*************************************************
 //*               Array filters                   *
 //*************************************************
-FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
-                                      const std::vector<OpArg>& opArgs,
-                                      bool atleastOne,
-                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
-{
-    // Assert expected number of parameters
-    utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
 
-    auto name = buildCtx->context().opName;
-
-    // Tracing
-    const std::string successTrace {fmt::format("[{}] -> Success", name)};
-
-    const std::string failureTrace1 {
-        fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField.dotPath())};
-    const std::string failureTrace2 {
-        fmt::format("[{}] -> Failure: Target field '{}' is not an array", name, targetField.dotPath())};
-    const std::string failureTrace3 {fmt::format("[{}] -> Failure: Target array '{}' {} of the parameters",
-                                                 name,
-                                                 targetField.dotPath(),
-                                                 "does not contain at least one")};
-
-    // Return Op
-    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
-               base::ConstEvent event) -> FilterResult
+/**
+ * @brief Literal parameters of the array helpers, compiled at build time.
+ *
+ * The strings are hashed, so checking an array costs one lookup per element instead of one comparison per element
+ * and literal. The other literals are still compared one by one, keeping the numeric equality of the Json values.
+ */
+class ArrayLiterals
+{
+private:
+    std::deque<std::string> m_storage;                          ///< Owns the hashed strings
+    std::unordered_map<std::string_view, std::size_t> m_strings; ///< Literal strings, to their index
+    std::vector<json::Json> m_others;                            ///< Literals that are not strings
+
+public:
+    /**
+     * @brief Add a literal, the repeated strings are only added once.
+     *
+     * @param value Literal
+     */
+    void add(const json::Json& value)
     {
-        if (!event->exists(targetField))
+        if (!value.isString())
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
+            m_others.push_back(value);
+            return;
         }
 
-        const auto resolvedArray {event->getArray(targetField)};
-        if (!resolvedArray.has_value())
+        auto str = value.getString().value();
+        if (m_strings.find(str) == m_strings.end())
         {
-            RETURN_FAILURE(runState, false, failureTrace2);
+            const auto index = m_strings.size();
+            m_storage.emplace_back(std::move(str));
+            m_strings.emplace(m_storage.back(), index);
         }
+    }
 
-        json::Json cmpValue {};
-        auto successCount {0};
-        for (const auto& parameter : parameters)
+    /**
+     * @brief Get the number of literals.
+     */
+    std::size_t size() const { return m_strings.size() + m_others.size(); }
+
+    /**
+     * @brief Count the literals contained in an array.
+     *
+     * @param array Array to check
+     * @param stopAtFirst Stop at the first literal found
+     * @return std::size_t Number of literals found in the array
+     */
+    std::size_t count(const json::ArrayView& array, bool stopAtFirst) const
+    {
+        std::vector<bool> found(size(), false);
+        std::size_t count {0};
+        for (const auto element : array)
         {
-            if (parameter->isReference())
+            const auto str = element.getStringView();
+            if (str.has_value())
             {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
+                const auto it = m_strings.find(str.value());
+                if (it != m_strings.end() && !found[it->second])
                 {
-                    continue;
+                    found[it->second] = true;
+                    ++count;
                 }
             }
             else
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
-            }
-
-            // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                != resolvedArray.value().end())
-            {
-                if (atleastOne)
+                for (std::size_t i = 0; i < m_others.size(); ++i)
                 {
-                    RETURN_SUCCESS(runState, true, successTrace);
+                    const auto index = m_strings.size() + i;
+                    if (!found[index] && element == m_others[i])
+                    {
+                        found[index] = true;
+                        ++count;
+                    }
                 }
+            }
 
-                successCount++;
-                if (successCount == parameters.size())
-                {
-                    RETURN_SUCCESS(runState, true, successTrace);
-                }
+            if (count == size() || (stopAtFirst && count > 0))
+            {
+                break;
             }
         }
 
-        RETURN_FAILURE(runState, false, failureTrace3);
-    };
-}
+        return count;
+    }
+};
 
-FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
-                                      const std::vector<OpArg>& opArgs,
-                                      bool atleastOne,
-                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
+/**
+ * @brief Build the array helpers, checking the presence or absence of the parameters in the target array.
+ *
+ * @param targetField target field of the helper
+ * @param opArgs Values and references to look for
+ * @param atleastOne Succeed if any parameter passes the check, otherwise all of them must pass
+ * @param present Check the presence of the parameters, otherwise their absence
+ * @param buildCtx Shared pointer to the build context
+ * @return FilterOp
+ */
+FilterOp buildArrayPresence(const Reference& targetField,
+                            const std::vector<OpArg>& opArgs,
+                            bool atleastOne,
+                            bool present,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     // Assert expected number of parameters
     utils::assertSize(opArgs, 1, utils::MAX_OP_ARGS);
@@ -957,67 +1128,94 @@ FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: Target array '{}' {} of the parameters",
                                                  name,
                                                  targetField.dotPath(),
-                                                 "contain at least one")};
+                                                 present ? "does not contain at least one" : "contain at least one")};
 
-    // Return Op
-    return [=, parameters = opArgs, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
-               base::ConstEvent event) -> FilterResult
+    // The literals are compiled once, the references are resolved on each event
+    auto literals = std::make_shared<ArrayLiterals>();
+    std::vector<json::Path> references;
+    for (const auto& parameter : opArgs)
     {
-        if (!event->exists(targetField))
+        if (parameter->isReference())
         {
-            RETURN_FAILURE(runState, false, failureTrace1);
+            references.emplace_back(std::static_pointer_cast<Reference>(parameter)->jsonPointer());
         }
+        else
+        {
+            literals->add(std::static_pointer_cast<Value>(parameter)->value());
+        }
+    }
 
-        const auto resolvedArray {event->getArray(targetField)};
+    // Return Op
+    return [=, runState = buildCtx->runState(), targetField = json::Path(targetField.jsonPointer())](
+               base::ConstEvent event) -> FilterResult
+    {
+        // The array is viewed in the event, its elements are not copied
+        const auto resolvedArray {event->getArrayView(targetField)};
         if (!resolvedArray.has_value())
         {
+            if (!event->exists(targetField))
+            {
+                RETURN_FAILURE(runState, false, failureTrace1);
+            }
             RETURN_FAILURE(runState, false, failureTrace2);
         }
 
-        json::Json cmpValue {};
-        auto successCount {0};
-        for (const auto& parameter : parameters)
+        // Any literal found fails all the absence checks, so stop at the first one
+        const auto found = literals->count(resolvedArray.value(), atleastOne == present);
+        const auto passed = present ? found : literals->size() - found;
+        if (atleastOne && passed > 0)
         {
-            if (parameter->isReference())
-            {
-                auto resolvedParameter {event->getJson(std::static_pointer_cast<Reference>(parameter)->jsonPath())};
-                if (resolvedParameter.has_value())
-                {
-                    cmpValue = std::move(resolvedParameter.value());
-                }
-                else
-                {
-                    continue;
-                }
-            }
-            else
+            RETURN_SUCCESS(runState, true, successTrace);
+        }
+        if (!atleastOne && passed < literals->size())
+        {
+            RETURN_FAILURE(runState, false, failureTrace3);
+        }
+
+        auto successCount {passed};
+        for (const auto& reference : references)
+        {
+            const auto cmpValue {event->getView(reference)};
+            if (!cmpValue.has_value())
             {
-                cmpValue = std::move(std::static_pointer_cast<Value>(parameter)->value().getJson().value());
+                continue;
             }
 
-            // Check if the array contains the value, if so finish
-            if (std::find_if(resolvedArray.value().begin(),
-                             resolvedArray.value().end(),
-                             [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                == resolvedArray.value().end())
+            const auto contains = resolvedArray->contains(cmpValue.value());
+            if (contains == present)
             {
                 if (atleastOne)
                 {
                     RETURN_SUCCESS(runState, true, successTrace);
                 }
-
                 successCount++;
-                if (successCount == parameters.size())
-                {
-                    RETURN_SUCCESS(runState, true, successTrace);
-                }
             }
         }
 
+        if (!atleastOne && successCount == literals->size() + references.size())
+        {
+            RETURN_SUCCESS(runState, true, successTrace);
+        }
         RETURN_FAILURE(runState, false, failureTrace3);
     };
 }
 
+FilterOp opBuilderHelperArrayPresence(const Reference& targetField,
+                                      const std::vector<OpArg>& opArgs,
+                                      bool atleastOne,
+                                      const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return buildArrayPresence(targetField, opArgs, atleastOne, true, buildCtx);
+}
+
+FilterOp opBuilderHelperArrayNotPresence(const Reference& targetField,
+                                         const std::vector<OpArg>& opArgs,
+                                         bool atleastOne,
+                                         const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return buildArrayPresence(targetField, opArgs, atleastOne, false, buildCtx);
+}
+
 // field: +array_contains/value1/value2/...valueN
 FilterOp opBuilderHelperContains(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
@@ -1081,7 +1279,7 @@ FilterOp typeMatcher(const Reference& targetField,
         fmt::format("[{}] -> Failure: Target field '{}' not found", name, targetField.dotPath());
 
     // Return Op
-    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](
+    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPointer()](
                base::ConstEvent event) -> FilterResult
     {
         FilterResult result;
@@ -1251,35 +1449,21 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
             RETURN_FAILURE(runState, false, failureTrace1);
         }
 
-        // Get value
-        json::Json cmpValue {};
+        // Get value, viewed in the event
+        const auto cmpValue {event->getView(targetField)};
+        if (!cmpValue.has_value())
         {
-            auto resolvedField {event->getJson(targetField)};
-            if (resolvedField.has_value())
-            {
-                cmpValue = std::move(resolvedField.value());
-            }
-            else
-            {
-                RETURN_FAILURE(runState, false, failureTrace2);
-            }
+            RETURN_FAILURE(runState, false, failureTrace2);
         }
 
         bool isSuccess {false};
-        // TODO Should be a function in json::Json for search in array
-        auto searchCmpValue = [&cmpValue](const std::vector<json::Json>& def) -> bool
-        {
-            return std::find_if(
-                       def.begin(), def.end(), [&cmpValue](const json::Json& value) { return value == cmpValue; })
-                   != def.end();
-        };
 
         // Get array
         if (parameter->isReference())
         {
             // TODO Should be 1 trace, if exist and is array, in all helers, no shearch for existance twice
             // Parameter is a reference
-            auto refPath = std::static_pointer_cast<Reference>(parameter)->jsonPath();
+            const auto& refPath = std::static_pointer_cast<Reference>(parameter)->jsonPointer();
             if (!event->exists(refPath))
             {
                 RETURN_FAILURE(runState, false, failureTrace3);
@@ -1290,13 +1474,12 @@ FilterOp opBuilderHelperMatchValue(const Reference& targetField,
                 RETURN_FAILURE(runState, false, failureTrace4);
             }
 
-            isSuccess = searchCmpValue(event->getArray(refPath).value());
+            isSuccess = event->getArrayView(refPath)->contains(cmpValue.value());
         }
         else
         {
             // Parameter is a value
-            auto value = std::static_pointer_cast<Value>(parameter)->value().getArray().value();
-            isSuccess = searchCmpValue(value);
+            isSuccess = std::static_pointer_cast<Value>(parameter)->value().getArrayView()->contains(cmpValue.value());
         }
 
         // Check if the array contains the value
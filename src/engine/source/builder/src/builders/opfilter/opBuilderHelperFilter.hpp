@@ -1,6 +1,8 @@
 #ifndef _OP_BUILDER_HELPER_FILTER_H
 #define _OP_BUILDER_HELPER_FILTER_H
 
+#include "builders/opfilter/cidrSet.hpp"
+#include "builders/opfilter/substringSet.hpp"
 #include "builders/types.hpp"
 
 /*
@@ -148,6 +150,34 @@ FilterOp opBuilderHelperStringContains(const Reference& targetField,
                                        const std::vector<OpArg>& opArgs,
                                        const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Build the filter that checks if the string field contains any substring of a set.
+ *
+ * @param targetField target field of the helper
+ * @param substringSet Compiled substrings
+ * @param buildCtx Shared pointer to the build context
+ * @return FilterOp The filter of the field
+ */
+FilterOp buildSubstringSetFilter(const Reference& targetField,
+                                 std::shared_ptr<const SubstringSet> substringSet,
+                                 const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+/**
+ * @brief Create the `contains_any` helper function that allows to check if a field string
+ * contains any of the given ones.
+ *
+ * The values are compiled into an Aho-Corasick automaton at build time, so the field is scanned once whatever the
+ * number of values. As in `contains`, an empty value is never contained.
+ * @param targetField target field of the helper
+ * @param opArgs Vector of operation arguments containing the values to look for.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return Expression The lifter with the `contains_any` filter.
+ * @throw std::runtime_error if any parameter is not a string.
+ */
+FilterOp opBuilderHelperStringContainsAny(const Reference& targetField,
+                                          const std::vector<OpArg>& opArgs,
+                                          const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 //*************************************************
 //*              Int filters                      *
 //*************************************************
@@ -302,6 +332,34 @@ FilterOp opBuilderHelperIPCIDR(const Reference& targetField,
                                const std::vector<OpArg>& opArgs,
                                const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Build the filter that checks if the field is an IP address in any network of a set.
+ *
+ * @param targetField target field of the helper
+ * @param cidrSet Compiled networks
+ * @param buildCtx Shared pointer to the build context
+ * @return FilterOp The filter of the field
+ */
+FilterOp buildCidrSetFilter(const Reference& targetField,
+                            std::shared_ptr<const CidrSet> cidrSet,
+                            const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+/**
+ * @brief Create `ip_cidr_match_any` helper function that filters events if the field
+ * is in any of the specified CIDR ranges.
+ *
+ * The networks, IPv4 or IPv6, are compiled into a prefix trie at build time, so the cost of the check does not
+ * depend on the number of networks.
+ * @param targetField target field of the helper
+ * @param opArgs Vector of operation arguments containing the networks in CIDR notation.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return Expression The lifter with the `ip_cidr_match_any` filter.
+ * @throw std::runtime_error if any network is not valid.
+ */
+FilterOp opBuilderHelperIPCIDRAny(const Reference& targetField,
+                                  const std::vector<OpArg>& opArgs,
+                                  const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 /**
  * @brief Create `is_public_ip` helper function that filters events if the field
  * is a public IP address.
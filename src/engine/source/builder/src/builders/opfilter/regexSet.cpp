@@ -0,0 +1,194 @@
+#include "regexSet.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace builder::builders::opfilter
+{
+
+namespace
+{
+std::atomic<uint64_t> g_compiledIds {1}; ///< Ids of the compiled sets, 0 is never used
+
+/**
+ * @brief Result of a set over the last value matched, the values of a field are scanned once by each thread.
+ */
+struct Memo
+{
+    uint64_t id {0};          ///< Id of the compiled set
+    std::string value;        ///< Matched value
+    std::vector<int> matches; ///< Sorted indexes of the patterns that matched
+};
+
+constexpr std::size_t MEMO_SIZE = 4; ///< Memos per thread, for the rules alternating a few fields
+
+RE2::Options regexOptions()
+{
+    RE2::Options options;
+    options.set_log_errors(false); // as RE2::Quiet
+    return options;
+}
+} // namespace
+
+RegexSet::Member::Member(std::shared_ptr<RegexSet> set, const std::string& pattern)
+    : m_set(std::move(set))
+    , m_pattern(pattern)
+    , m_regex(pattern, RE2::Quiet)
+{
+    if (!m_regex.ok())
+    {
+        throw std::runtime_error(fmt::format("Invalid regex: \"{}\".", pattern));
+    }
+    m_set->add(m_pattern);
+}
+
+RegexSet::Member::~Member()
+{
+    m_set->remove(m_pattern);
+}
+
+bool RegexSet::Member::match(std::string_view value) const
+{
+    const auto compiled = m_set->compiled();
+    if (!compiled->set || compiled->failed.load(std::memory_order_relaxed))
+    {
+        return RE2::PartialMatch(value, m_regex);
+    }
+
+    const auto index = compiled->indexes.find(m_pattern);
+    if (index == compiled->indexes.end())
+    {
+        return RE2::PartialMatch(value, m_regex);
+    }
+
+    thread_local std::array<Memo, MEMO_SIZE> memos;
+    thread_local std::size_t nextMemo {0};
+
+    auto memo = std::find_if(memos.begin(),
+                             memos.end(),
+                             [&](const Memo& entry) { return entry.id == compiled->id && entry.value == value; });
+    if (memo == memos.end())
+    {
+        memo = memos.begin() + (nextMemo++ % MEMO_SIZE);
+        memo->id = 0;
+        memo->matches.clear();
+
+        RE2::Set::ErrorInfo error {RE2::Set::kNoError};
+        if (!compiled->set->Match(value, &memo->matches, &error) && error.kind != RE2::Set::kNoError)
+        {
+            compiled->failed.store(true, std::memory_order_relaxed);
+            return RE2::PartialMatch(value, m_regex);
+        }
+
+        std::sort(memo->matches.begin(), memo->matches.end());
+        memo->value.assign(value);
+        memo->id = compiled->id;
+    }
+
+    return std::binary_search(memo->matches.begin(), memo->matches.end(), index->second);
+}
+
+RegexSet::RegexSet()
+    : m_mutex()
+    , m_patterns()
+    , m_dirty(true)
+    , m_compiled(std::make_shared<const Compiled>())
+{
+}
+
+std::shared_ptr<const RegexSet::Member> RegexSet::join(const std::string& field, const std::string& pattern)
+{
+    static std::mutex s_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<RegexSet>> s_sets;
+
+    std::shared_ptr<RegexSet> set;
+    {
+        std::lock_guard lock {s_mutex};
+        set = s_sets[field].lock();
+        if (!set)
+        {
+            // Drop the sets whose members are gone
+            for (auto it = s_sets.begin(); it != s_sets.end();)
+            {
+                it = it->second.expired() ? s_sets.erase(it) : std::next(it);
+            }
+
+            set = std::make_shared<RegexSet>();
+            s_sets[field] = set;
+        }
+    }
+
+    return std::make_shared<const Member>(std::move(set), pattern);
+}
+
+void RegexSet::add(const std::string& pattern)
+{
+    std::lock_guard lock {m_mutex};
+    if (m_patterns[pattern]++ == 0)
+    {
+        m_dirty.store(true, std::memory_order_release);
+    }
+}
+
+void RegexSet::remove(const std::string& pattern)
+{
+    std::lock_guard lock {m_mutex};
+    auto it = m_patterns.find(pattern);
+    if (it != m_patterns.end() && --it->second == 0)
+    {
+        m_patterns.erase(it);
+        m_dirty.store(true, std::memory_order_release);
+    }
+}
+
+std::shared_ptr<const RegexSet::Compiled> RegexSet::compiled()
+{
+    if (m_dirty.load(std::memory_order_acquire))
+    {
+        std::lock_guard lock {m_mutex};
+        if (m_dirty.load(std::memory_order_relaxed))
+        {
+            auto compiled = std::make_shared<Compiled>();
+            compiled->id = g_compiledIds.fetch_add(1, std::memory_order_relaxed);
+
+            // A single pattern is matched alone, a set would only add overhead
+            if (m_patterns.size() > 1)
+            {
+                auto set = std::make_unique<RE2::Set>(regexOptions(), RE2::UNANCHORED);
+                auto valid = true;
+                for (const auto& [pattern, members] : m_patterns)
+                {
+                    auto index = set->Add(pattern, nullptr);
+                    if (index < 0)
+                    {
+                        valid = false;
+                        break;
+                    }
+                    compiled->indexes.emplace(pattern, index);
+                }
+
+                if (valid && set->Compile())
+                {
+                    compiled->set = std::move(set);
+                }
+                else
+                {
+                    compiled->indexes.clear();
+                }
+            }
+
+            std::atomic_store_explicit(&m_compiled,
+                                       std::shared_ptr<const Compiled>(std::move(compiled)),
+                                       std::memory_order_release);
+            m_dirty.store(false, std::memory_order_release);
+        }
+    }
+
+    return std::atomic_load_explicit(&m_compiled, std::memory_order_acquire);
+}
+
+} // namespace builder::builders::opfilter
@@ -0,0 +1,99 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
+#define _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include <re2/re2.h>
+#include <re2/set.h>
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Patterns the regex filters apply to the same field, matched at once.
+ *
+ * The rules checking a field against many patterns scan each value of the field once: the first filter evaluated runs
+ * a RE2::Set with every pattern registered for the field, and the rest take their result from the memo of the last
+ * values matched by the thread. The filters join the set when they are built and leave it when they are destroyed,
+ * the set is compiled again on the next match after a change.
+ *
+ * With a single pattern, or if the set cannot be compiled or matched, each filter runs its own regex.
+ */
+class RegexSet
+{
+public:
+    /**
+     * @brief Pattern of a filter in the set of its field, it leaves the set when destroyed.
+     */
+    class Member
+    {
+    private:
+        std::shared_ptr<RegexSet> m_set; ///< Set of the field
+        std::string m_pattern;           ///< Pattern of the filter
+        RE2 m_regex;                     ///< Regex of the pattern, used when the set is not
+
+    public:
+        /**
+         * @brief Join a set
+         *
+         * @param set Set of the field
+         * @param pattern Pattern of the filter
+         * @throw std::runtime_error if the pattern is not a valid regex.
+         */
+        Member(std::shared_ptr<RegexSet> set, const std::string& pattern);
+        ~Member();
+
+        Member(const Member&) = delete;
+        Member& operator=(const Member&) = delete;
+
+        /**
+         * @brief Check if the pattern matches a value of the field, as RE2::PartialMatch does.
+         *
+         * @param value Value of the field
+         * @return true if the pattern matches
+         */
+        bool match(std::string_view value) const;
+    };
+
+    /**
+     * @brief Join the set of the patterns of a field.
+     *
+     * @param field Json pointer of the field
+     * @param pattern Pattern of the filter
+     * @return std::shared_ptr<const Member>
+     * @throw std::runtime_error if the pattern is not a valid regex.
+     */
+    static std::shared_ptr<const Member> join(const std::string& field, const std::string& pattern);
+
+private:
+    struct Compiled
+    {
+        uint64_t id {0};                              ///< Unique id of the compiled set, for the match memos
+        std::unique_ptr<RE2::Set> set;                ///< Set of the patterns, nullptr if the members match alone
+        std::unordered_map<std::string, int> indexes; ///< Index of each pattern in the set
+        mutable std::atomic_bool failed {false};      ///< The set ran out of memory, the members match alone
+    };
+
+    std::mutex m_mutex;                            ///< Protects the patterns and the compilation
+    std::map<std::string, std::size_t> m_patterns; ///< Patterns of the members, with the number of members
+    std::atomic_bool m_dirty;                      ///< The patterns changed since the last compilation
+    std::shared_ptr<const Compiled> m_compiled;    ///< Last compiled set, accessed atomically
+
+    void add(const std::string& pattern);
+    void remove(const std::string& pattern);
+    std::shared_ptr<const Compiled> compiled(); ///< Get the compiled set, compiling it if the patterns changed
+
+public:
+    RegexSet();
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_REGEXSET_HPP
@@ -0,0 +1,109 @@
+#include "substringSet.hpp"
+
+#include <queue>
+
+namespace builder::builders::opfilter
+{
+
+SubstringSet::SubstringSet(const std::vector<std::string>& substrings)
+    : m_classes {}
+    , m_alphabet {1}
+{
+    // Classes of the bytes of the substrings
+    for (const auto& substring : substrings)
+    {
+        for (const auto c : substring)
+        {
+            auto& byteClass = m_classes[static_cast<uint8_t>(c)];
+            if (byteClass == 0)
+            {
+                byteClass = static_cast<uint16_t>(m_alphabet++);
+            }
+        }
+    }
+
+    // Trie of the substrings, -1 for the missing transitions
+    m_next.assign(m_alphabet, -1);
+    m_match.assign(1, false);
+    for (const auto& substring : substrings)
+    {
+        if (substring.empty())
+        {
+            continue;
+        }
+
+        std::size_t state = 0;
+        for (const auto c : substring)
+        {
+            auto& next = m_next[state * m_alphabet + m_classes[static_cast<uint8_t>(c)]];
+            if (next == -1)
+            {
+                next = static_cast<int32_t>(m_match.size());
+                m_match.push_back(false);
+                m_next.resize(m_next.size() + m_alphabet, -1);
+            }
+            state = m_next[state * m_alphabet + m_classes[static_cast<uint8_t>(c)]];
+        }
+        m_match[state] = true;
+    }
+
+    // Complete the transitions with the failure links, breadth first so the failure state is always completed before
+    std::vector<int32_t> failure(m_match.size(), 0);
+    std::queue<int32_t> pending;
+    for (std::size_t byteClass = 0; byteClass < m_alphabet; ++byteClass)
+    {
+        auto& next = m_next[byteClass];
+        if (next == -1)
+        {
+            next = 0;
+        }
+        else
+        {
+            pending.push(next);
+        }
+    }
+
+    while (!pending.empty())
+    {
+        const auto state = pending.front();
+        pending.pop();
+
+        const auto fail = failure[state];
+        if (m_match[fail])
+        {
+            m_match[state] = true;
+        }
+
+        for (std::size_t byteClass = 0; byteClass < m_alphabet; ++byteClass)
+        {
+            auto& next = m_next[state * m_alphabet + byteClass];
+            const auto fallback = m_next[fail * m_alphabet + byteClass];
+            if (next == -1)
+            {
+                next = fallback;
+            }
+            else
+            {
+                failure[next] = fallback;
+                pending.push(next);
+            }
+        }
+    }
+}
+
+bool SubstringSet::containsAny(std::string_view str) const
+{
+    std::size_t state = 0;
+    for (const auto c : str)
+    {
+        state = m_next[state * m_alphabet + m_classes[static_cast<uint8_t>(c)]];
+        if (m_match[state])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace builder::builders::opfilter
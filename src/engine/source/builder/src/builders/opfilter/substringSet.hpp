@@ -0,0 +1,49 @@
+#ifndef _BUILDER_BUILDERS_OPFILTER_SUBSTRINGSET_HPP
+#define _BUILDER_BUILDERS_OPFILTER_SUBSTRINGSET_HPP
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace builder::builders::opfilter
+{
+
+/**
+ * @brief Set of substrings, compiled into an Aho-Corasick automaton.
+ *
+ * Checking a string scans it once, taking one transition per byte, independently of the number of substrings. The
+ * bytes are mapped to the classes of the bytes present in the substrings, so the transition table only has one column
+ * per distinct byte of the substrings.
+ */
+class SubstringSet
+{
+private:
+    std::array<uint16_t, 256> m_classes; ///< Class of each byte, 0 if it is not in any substring
+    std::size_t m_alphabet;              ///< Number of classes, including the class 0
+    std::vector<int32_t> m_next;         ///< Transition table, a row of m_alphabet states per state
+    std::vector<bool> m_match;           ///< A substring ends at the state, directly or through a failure link
+
+public:
+    /**
+     * @brief Compile a set of substrings.
+     *
+     * An empty substring is never contained, as in the `contains` helper, so the empty substrings are ignored.
+     *
+     * @param substrings Substrings of the set
+     */
+    explicit SubstringSet(const std::vector<std::string>& substrings);
+
+    /**
+     * @brief Check if a string contains any substring of the set, case sensitive.
+     *
+     * @param str String to scan
+     * @return true if any substring is contained in the string
+     */
+    bool containsAny(std::string_view str) const;
+};
+
+} // namespace builder::builders::opfilter
+
+#endif // _BUILDER_BUILDERS_OPFILTER_SUBSTRINGSET_HPP
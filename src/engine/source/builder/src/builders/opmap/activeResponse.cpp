@@ -5,7 +5,6 @@
 
 namespace builder::builders
 {
-using SendRetval = sockiface::ISockHandler::SendRetval;
 using Protocol = sockiface::ISockHandler::Protocol;
 
 namespace ar
@@ -117,12 +116,12 @@ MapOp CreateARBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<co
         }
         getExtraArgsFn = [extraSrc = opArgs[3], name](base::ConstEvent event) -> std::vector<std::string>
         {
-            std::optional<std::vector<json::Json>> extraArgs = std::nullopt;
+            std::optional<json::ArrayView> extraArgs = std::nullopt;
             std::vector<std::string> result {};
 
             if (extraSrc->isReference())
             {
-                extraArgs = event->getArray(std::static_pointer_cast<Reference>(extraSrc)->jsonPath());
+                extraArgs = event->getArrayView(std::static_pointer_cast<Reference>(extraSrc)->jsonPointer());
                 if (!extraArgs)
                 {
                     throw std::runtime_error(fmt::format(ar::TRACE_REFERENCE_ARR_NOT_FOUND,
@@ -132,10 +131,11 @@ MapOp CreateARBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<co
             }
             else
             {
-                extraArgs = std::static_pointer_cast<Value>(extraSrc)->value().getArray();
+                extraArgs = std::static_pointer_cast<Value>(extraSrc)->value().getArrayView();
             }
 
-            for (const auto& arg : extraArgs.value())
+            result.reserve(extraArgs->size());
+            for (const auto arg : extraArgs.value())
             {
                 if (!arg.isString())
                 {
@@ -256,14 +256,14 @@ MapOp CreateARBuilder(const std::vector<OpArg>& opArgs, const std::shared_ptr<co
 }
 
 // result: active_response_send('query'|$query)
-MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
+MapOp SendAR(const std::shared_ptr<opmap::SharedSender>& sender,
              const std::vector<OpArg>& opArgs,
              const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
     // Validate parameters
-    if (!sockFactory)
+    if (!sender)
     {
-        throw std::runtime_error("sockFactory is nullptr");
+        throw std::runtime_error("sender is nullptr");
     }
 
     utils::assertSize(opArgs, 1);
@@ -274,7 +274,8 @@ MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
     }
     const auto& rightParameter = opArgs[0];
 
-    auto socketAR = sockFactory->getHandler(Protocol::DATAGRAM, ar::AR_QUEUE_PATH);
+    // Shared by all the ops, the messages are sent in batches by its own thread
+    auto senderAR = sender->get();
 
     const auto& name = buildCtx->context().opName;
 
@@ -284,20 +285,17 @@ MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
             ar::TRACE_REFERENCE_STR_NOT_FOUND, name, std::static_pointer_cast<Reference>(rightParameter)->dotPath())
                                       : std::string();
     const auto failureTrace2 = fmt::format("[{}] -> Failure: The query is empty", name);
-    const auto failureTrace3 = fmt::format("[{}] -> Failure: AR message could not be send", name);
-    const auto failureTrace4 = fmt::format("[{}] -> Failure: Error trying to send AR message: ", name);
+    const auto failureTrace3 = fmt::format("[{}] -> Failure: AR message could not be queued, the queue is full", name);
 
     return [runState = buildCtx->runState(),
-            socketAR,
+            senderAR,
             rightParameter,
             success,
             failureTrace1,
             failureTrace2,
-            failureTrace3,
-            failureTrace4](base::ConstEvent event) -> MapResult
+            failureTrace3](base::ConstEvent event) -> MapResult
     {
         std::string query {};
-        bool messageSent {false};
 
         if (rightParameter->isReference())
         {
@@ -318,35 +316,31 @@ MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        try
+        // The send results are not waited for, the failed sends are logged by the sender
+        if (!senderAR->push(std::move(query)))
         {
-            if (SendRetval::SUCCESS == socketAR->sendMsg(query))
-            {
-                json::Json result("true");
-                RETURN_SUCCESS(runState, result, success);
-            }
-            else
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace3);
-            }
-        }
-        catch (const std::exception& e)
-        {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace4 + e.what());
+            RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
+
+        json::Json result("true");
+        RETURN_SUCCESS(runState, result, success);
     };
 }
 
-MapBuilder getOpBuilderSendAr(std::shared_ptr<sockiface::ISockFactory> sockFactory)
+MapBuilder getOpBuilderSendAr(std::shared_ptr<sockiface::ISockFactory> sockFactory,
+                              std::shared_ptr<metricsManager::IMetricsScope> metricsScope)
 {
     if (!sockFactory)
     {
         throw std::runtime_error("sockFactory is nullptr");
     }
 
-    return [sockFactory](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
+    auto sender = std::make_shared<opmap::SharedSender>(
+        std::move(sockFactory), Protocol::DATAGRAM, ar::AR_QUEUE_PATH, std::move(metricsScope));
+
+    return [sender](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
     {
-        return SendAR(sockFactory, opArgs, buildCtx);
+        return SendAR(sender, opArgs, buildCtx);
     };
 }
 
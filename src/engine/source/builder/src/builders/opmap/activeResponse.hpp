@@ -1,9 +1,10 @@
 #ifndef _OP_BUILDER_ACTIVE_RESPONSE_HPP
 #define _OP_BUILDER_ACTIVE_RESPONSE_HPP
 
+#include <metrics/iMetricsScope.hpp>
 #include <sockiface/isockFactory.hpp>
 
-
+#include "builders/opmap/sharedSender.hpp"
 #include "builders/types.hpp"
 
 namespace builder::builders
@@ -12,16 +13,26 @@ namespace builder::builders
 /**
  * @brief Helper Function that allows to send a message through the AR queue.
  *
- * @param sockFactory
+ * The message is only queued, it is sent in a batch by the sender thread.
+ *
+ * @param sender sender of the AR queue shared by all the ops
  * @param opArgs
  * @param buildCtx
  * @return TransformOp
  */
-MapOp SendAR(std::shared_ptr<sockiface::ISockFactory> sockFactory,
+MapOp SendAR(const std::shared_ptr<opmap::SharedSender>& sender,
              const std::vector<OpArg>& opArgs,
              const std::shared_ptr<const IBuildCtx>& buildCtx);
 
-MapBuilder getOpBuilderSendAr(std::shared_ptr<sockiface::ISockFactory> sockFactory);
+/**
+ * @brief Get the builder of active_response_send, all the ops built share the same AR queue sender.
+ *
+ * @param sockFactory factory of the AR queue socket
+ * @param metricsScope scope of the sender metrics, may be null
+ * @return MapBuilder
+ */
+MapBuilder getOpBuilderSendAr(std::shared_ptr<sockiface::ISockFactory> sockFactory,
+                              std::shared_ptr<metricsManager::IMetricsScope> metricsScope = nullptr);
 
 // TODO: this helper is not used in the codebase
 /**
@@ -1,5 +1,8 @@
 #include "builders/opmap/kvdb.hpp"
 
+#include <array>
+#include <atomic>
+#include <charconv>
 #include <string>
 #include <variant>
 
@@ -9,6 +12,7 @@
 #include <kvdb/ikvdbhandler.hpp>
 #include <base/utils/stringUtils.hpp>
 
+#include "builders/opfilter/opBuilderHelperFilter.hpp"
 #include "syntax.hpp"
 
 namespace builder::builders
@@ -81,6 +85,10 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
 
         auto res = buildCtx->validator().validate(targetField.dotPath(), schemf::runtimeValidation());
         validator = base::getResponse<schemf::ValidationResult>(res).getValidator();
+        if (validator)
+        {
+            buildCtx->countRuntimeValidation();
+        }
     }
 
     // Format name for the tracer
@@ -147,17 +155,17 @@ TransformOp KVDBGet(std::shared_ptr<IKVDBManager> kvdbManager,
             resolvedKey = std::static_pointer_cast<const Value>(key)->value().getString().value();
         }
 
-        // Get value from KVDB
-        auto resultValue = kvdbHandler->get(resolvedKey);
-
-        if (base::isError(resultValue))
-        {
-            RETURN_FAILURE(runState, event, failureTrace4)
-        }
-
         try
         {
-            json::Json value {base::getResponse<std::string>(resultValue).c_str()};
+            // Get value from KVDB, parsed
+            auto resultValue = kvdbHandler->getJson(resolvedKey);
+
+            if (base::isError(resultValue))
+            {
+                RETURN_FAILURE(runState, event, failureTrace4)
+            }
+
+            const auto& value = *base::getResponse(resultValue);
             if (validator != nullptr)
             {
                 auto res = validator(value);
@@ -319,6 +327,130 @@ FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager
     };
 }
 
+/**
+ * @brief Read a list of strings from a KVDB key when the helper is built.
+ *
+ * @param kvdbManager KVDB manager
+ * @param kvdbScopeName KVDB scope
+ * @param opArgs Arguments of the helper, the db name and the key
+ * @return std::vector<std::string> Strings of the key, a string or an array of strings
+ * @throw std::runtime_error if the arguments are not valid or the key cannot be read.
+ */
+std::vector<std::string> getKVDBStringList(std::shared_ptr<IKVDBManager> kvdbManager,
+                                           const std::string& kvdbScopeName,
+                                           const std::vector<OpArg>& opArgs)
+{
+    if (!kvdbManager)
+    {
+        throw std::runtime_error("Got null KVDB manager");
+    }
+
+    // Assert expected number of parameters
+    utils::assertSize(opArgs, 2);
+    utils::assertValue(opArgs);
+
+    // First argument is kvdb name, second the key of the list
+    for (const auto& arg : opArgs)
+    {
+        if (!std::static_pointer_cast<Value>(arg)->value().isString())
+        {
+            throw std::runtime_error(fmt::format("Expected db name and key 'string' as arguments but got '{}'",
+                                                 std::static_pointer_cast<Value>(arg)->value().str()));
+        }
+    }
+
+    auto dbName = std::static_pointer_cast<const Value>(opArgs[0])->value().getString().value();
+    auto key = std::static_pointer_cast<const Value>(opArgs[1])->value().getString().value();
+    auto resultHandler = kvdbManager->getKVDBHandler(dbName, kvdbScopeName);
+    if (base::isError(resultHandler))
+    {
+        throw std::runtime_error(fmt::format("Error getting KVDB handler: {}", base::getError(resultHandler).message));
+    }
+
+    auto kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+    auto resultValue = kvdbHandler->getJson(key);
+    if (base::isError(resultValue))
+    {
+        throw std::runtime_error(fmt::format("Error getting the values of key '{}' from DB '{}': {}",
+                                             key,
+                                             dbName,
+                                             base::getError(resultValue).message));
+    }
+
+    const auto& value = *base::getResponse<std::shared_ptr<const json::Json>>(resultValue);
+    std::vector<json::Json> items;
+    if (value.isArray())
+    {
+        items = value.getArray().value();
+    }
+    else
+    {
+        items.emplace_back(value);
+    }
+
+    std::vector<std::string> list;
+    list.reserve(items.size());
+    for (const auto& item : items)
+    {
+        if (!item.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("Expected values 'string' in key '{}' of DB '{}' but got '{}'", key, dbName, item.str()));
+        }
+        list.emplace_back(item.getString().value());
+    }
+
+    return list;
+}
+
+FilterOp KVDBIPCIDRMatch(std::shared_ptr<IKVDBManager> kvdbManager,
+                         const std::string& kvdbScopeName,
+                         const Reference& targetField,
+                         const std::vector<OpArg>& opArgs,
+                         const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    // The networks are compiled once, at build time
+    auto cidrSet = std::make_shared<opfilter::CidrSet>();
+    for (const auto& cidr : getKVDBStringList(kvdbManager, kvdbScopeName, opArgs))
+    {
+        try
+        {
+            cidrSet->add(cidr);
+        }
+        catch (const std::exception& e)
+        {
+            throw std::runtime_error(fmt::format("Invalid network in DB: {}", e.what()));
+        }
+    }
+
+    return opfilter::buildCidrSetFilter(targetField, cidrSet, buildCtx);
+}
+
+// <field>: +kvdb_ip_cidr_match/<DB>/<key>
+FilterBuilder getOpBuilderKVDBIPCIDRMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        return KVDBIPCIDRMatch(kvdbManager, kvdbScopeName, targetField, opArgs, buildCtx);
+    };
+}
+
+// <field>: +kvdb_contains_any/<DB>/<key>
+FilterBuilder getOpBuilderKVDBContainsAny(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName)
+{
+    return [kvdbManager, kvdbScopeName](const Reference& targetField,
+                                        const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+    {
+        // The values are compiled once, at build time
+        auto substringSet =
+            std::make_shared<opfilter::SubstringSet>(getKVDBStringList(kvdbManager, kvdbScopeName, opArgs));
+        return opfilter::buildSubstringSetFilter(targetField, substringSet, buildCtx);
+    };
+}
+
 TransformOp KVDBSet(std::shared_ptr<IKVDBManager> kvdbManager,
                     const std::string& kvdbScopeName,
                     const Reference& targetField,
@@ -706,6 +838,10 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                                                  std::get<base::Error>(valRes).message));
         }
         auto validator = base::getResponse<schemf::ValidationResult>(valRes).getValidator();
+        if (validator)
+        {
+            buildCtx->countRuntimeValidation();
+        }
 
         // Trace messages
         const auto name = buildCtx->context().opName;
@@ -741,6 +877,14 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
         const auto failureTrace6 =
             fmt::format("{} -> Final array failed validation for '{}': ", name, targetField.dotPath());
 
+        // Values of a literal key array, read once and reused while the version of the DB does not change
+        struct Snapshot
+        {
+            uint64_t version;               ///< Version of the DB the values were read at
+            std::vector<json::Json> values; ///< Values of the keys
+        };
+        auto snapshot = std::make_shared<std::shared_ptr<const Snapshot>>();
+
         // Return Op
         return [=,
                 runState = buildCtx->runState(),
@@ -748,71 +892,92 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                 kvdbHandler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler)](
                    base::Event event) -> TransformResult
         {
-            // Resolve array of keys
-            std::vector<json::Json> keys;
+            // Read before the values, a change in between makes the next event read them again
+            const auto version = keyArray->isReference() ? std::nullopt : kvdbHandler->version();
+            std::shared_ptr<const Snapshot> current;
+            if (version)
+            {
+                current = std::atomic_load(snapshot.get());
+                if (current && current->version != version.value())
+                {
+                    current.reset();
+                }
+            }
+
+            // Resolve array of keys, viewed in place until the event is modified
+            std::optional<json::ArrayView> keys;
             if (keyArray->isReference())
             {
                 const auto& keyArrayRef = *std::static_pointer_cast<Reference>(keyArray);
-                if (!event->exists(keyArrayRef.jsonPath()))
+                if (!event->exists(keyArrayRef.jsonPointer()))
                 {
                     RETURN_FAILURE(runState, event, failureTrace1);
                 }
 
-                const auto value = event->getArray(keyArrayRef.jsonPath());
-                if (!value)
+                keys = event->getArrayView(keyArrayRef.jsonPointer());
+                if (!keys)
                 {
                     RETURN_FAILURE(runState, event, failureTrace2);
                 }
 
-                for (const auto& key : value.value())
+                for (const auto key : keys.value())
                 {
                     if (!key.isString())
                     {
                         RETURN_FAILURE(runState, event, failureTrace2);
                     }
-
-                    keys.emplace_back(key);
                 }
             }
-            else
+            else if (!current)
             {
-                keys = std::static_pointer_cast<const Value>(keyArray)->value().getArray().value();
+                keys = std::static_pointer_cast<const Value>(keyArray)->value().getArrayView();
             }
 
-            // Get values from KVDB
+            // Get values from KVDB, unless they are in the snapshot
             bool first = true;
             json::Json::Type type;
-            std::vector<json::Json> values;
-            for (const auto& jKey : keys)
+            std::vector<json::Json> readValues;
+            if (keys)
             {
-                auto resultValue = kvdbHandler->get(jKey.getString().value());
-                if (base::isError(resultValue))
+                readValues.reserve(keys->size());
+                for (const auto jKey : keys.value())
                 {
-                    RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
-                }
+                    base::RespOrError<std::shared_ptr<const json::Json>> resultValue;
+                    try
+                    {
+                        resultValue = kvdbHandler->getJson(std::string {jKey.getStringView().value()});
+                    }
+                    catch (const std::runtime_error& e)
+                    {
+                        RETURN_FAILURE(runState, event, failureTrace4 + e.what());
+                    }
 
-                json::Json jValue;
-                try
-                {
-                    jValue = json::Json {std::get<std::string>(resultValue).c_str()};
-                }
-                catch (const std::runtime_error& e)
-                {
-                    RETURN_FAILURE(runState, event, failureTrace4 + e.what());
-                }
+                    if (base::isError(resultValue))
+                    {
+                        RETURN_FAILURE(runState, event, failureTrace3 + std::get<base::Error>(resultValue).message);
+                    }
 
-                if (first)
-                {
-                    type = jValue.type();
-                    first = false;
-                }
-                else if (jValue.type() != type)
-                {
-                    RETURN_FAILURE(runState, event, failureTrace5);
+                    const auto& jValue = *base::getResponse(resultValue);
+                    if (first)
+                    {
+                        type = jValue.type();
+                        first = false;
+                    }
+                    else if (jValue.type() != type)
+                    {
+                        RETURN_FAILURE(runState, event, failureTrace5);
+                    }
+
+                    readValues.emplace_back(jValue);
                 }
+            }
 
-                values.emplace_back(std::move(jValue));
+            if (version && !current)
+            {
+                current = std::make_shared<const Snapshot>(Snapshot {version.value(), std::move(readValues)});
+                std::atomic_store(snapshot.get(), current);
             }
+            const auto& values = current ? current->values : readValues;
 
             // Get target array
             auto targetArray = event->getJson(targetField)
@@ -825,7 +990,7 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
                                        }());
 
             // Append values to target field
-            for (auto& value : values)
+            for (const auto& value : values)
             {
                 targetArray.appendJson(value);
             }
@@ -849,12 +1014,14 @@ TransformBuilder getOpBuilderKVDBGetArray(std::shared_ptr<IKVDBManager> kvdbMana
 
 namespace
 {
-// TODO Change this to use an vector instead of a map
-std::function<std::optional<json::Json>(uint64_t pos)> getFnSearchMap(const json::Json& jMap)
+/**
+ * @brief Values of the bits of a mask, empty for the bits without a value in the map.
+ */
+using BitValues = std::array<std::optional<json::Json>, std::numeric_limits<uint64_t>::digits>;
+
+BitValues getBitValues(const json::Json& jMap)
 {
-    std::vector<std::optional<json::Json>> buildedMap(std::numeric_limits<uint64_t>::digits);
-    // Fill the map with empty values
-    std::fill(buildedMap.begin(), buildedMap.end(), std::nullopt);
+    BitValues buildedMap {};
     {
         if (!jMap.isObject())
         {
@@ -913,15 +1080,7 @@ std::function<std::optional<json::Json>(uint64_t pos)> getFnSearchMap(const json
         }
     }
 
-    // Function that get the value from the builded map, returns nullopt if not found
-    return [buildedMap](const uint64_t pos) -> std::optional<json::Json>
-    {
-        if (pos < buildedMap.size())
-        {
-            return buildedMap[pos];
-        }
-        return std::nullopt;
-    };
+    return buildedMap;
 }
 } // namespace
 
@@ -1003,8 +1162,8 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
         }
     }
 
-    // Get the function to search in the map
-    auto getValueFn = getFnSearchMap(jMap);
+    // Table of the values of each bit, the map is not read again for each event
+    const auto bitValues = std::make_shared<const BitValues>(getBitValues(jMap));
 
     // Tracing
     const auto name = buildCtx->context().opName;
@@ -1017,7 +1176,7 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
         fmt::format("{} -> Reference '{}' values is out of range 0-0xFFFFFFFFFFFFFFFF", name, maskRef.dotPath());
 
     // Get the function to get the value from the event
-    auto getMaskFn = [maskRef = maskRef.jsonPath(), failureTrace1, failureTrace2, failureTrace3, failureTrace4](
+    auto getMaskFn = [maskRef = maskRef.jsonPointer(), failureTrace1, failureTrace2, failureTrace3, failureTrace4](
                          const base::Event& event) -> base::RespOrError<uint64_t>
     {
         // Check if the mask exists
@@ -1027,15 +1186,23 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
         }
 
         // If is a string, get the mask as hexa in range 0-0xFFFFFFFFFFFFFFFF
-        const auto maskStr = event->getString(maskRef);
-        if (!maskStr.has_value())
+        const auto maskView = event->getStringView(maskRef);
+        if (!maskView.has_value())
         {
             return base::Error {failureTrace2};
         }
 
+        // Plain hexadecimal digits are parsed in place, any other format as before
+        uint64_t mask {};
+        const auto* const end = maskView->data() + maskView->size();
+        if (const auto [ptr, ec] = std::from_chars(maskView->data(), end, mask, 16); ec == std::errc {} && ptr == end)
+        {
+            return mask;
+        }
+
         try
         {
-            auto rMask = std::stoul(maskStr.value(), nullptr, 16);
+            auto rMask = std::stoul(std::string {maskView.value()}, nullptr, 16);
             if (rMask <= std::numeric_limits<uint64_t>::max())
             {
                 return static_cast<uint64_t>(rMask);
@@ -1063,20 +1230,15 @@ TransformOp OpBuilderHelperKVDBDecodeBitmask(const Reference& targetField,
             mask = base::getResponse(resultMask);
         }
 
-        // iterate over the bits of the mask
+        // iterate over the set bits of the mask, lowest first
         bool isResultEmpty {true};
-        for (uint64_t bitPos = 0; bitPos < std::numeric_limits<uint64_t>::digits; bitPos++)
+        for (; mask != 0; mask &= mask - 1)
         {
-            auto flag = 0x1 << bitPos;
-            if (flag & mask)
+            const auto& value = (*bitValues)[__builtin_ctzll(mask)];
+            if (value.has_value())
             {
-                auto value = getValueFn(bitPos);
-
-                if (value.has_value())
-                {
-                    isResultEmpty = false;
-                    event->appendJson(*value, targetField);
-                }
+                isResultEmpty = false;
+                event->appendJson(*value, targetField);
             }
         }
         if (isResultEmpty)
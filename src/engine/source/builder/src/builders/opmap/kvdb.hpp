@@ -93,6 +93,26 @@ FilterBuilder getOpBuilderKVDBMatch(std::shared_ptr<IKVDBManager> kvdbManager, c
  */
 FilterBuilder getOpBuilderKVDBNotMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
 
+/**
+ * @brief Get the KVDB IP CIDR match function helper builder
+ *
+ * The networks stored in the key, a CIDR string or an array of them, are compiled when the helper is built.
+ *
+ * @param kvdbScope KVDB Scope
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBIPCIDRMatch(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
+/**
+ * @brief Get the KVDB contains any function helper builder
+ *
+ * The values stored in the key, a string or an array of them, are compiled when the helper is built.
+ *
+ * @param kvdbScope KVDB Scope
+ * @return Builder
+ */
+FilterBuilder getOpBuilderKVDBContainsAny(std::shared_ptr<IKVDBManager> kvdbManager, const std::string& kvdbScopeName);
+
 /**
  * @brief Get the KVDB Set function helper builder
  *
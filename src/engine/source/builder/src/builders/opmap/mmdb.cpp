@@ -14,100 +14,94 @@ MapOp dumpFailTransform(const std::string& trace, const std::shared_ptr<const Ru
     };
 }
 
-// Only for the MMDB City / Country db
-json::Json mapGeoToECS(const std::string& ip, const std::shared_ptr<geo::ILocator>& locator)
+/**
+ * @brief Field of the MMDB entry mapped to the output document.
+ */
+struct MappedField
 {
-    json::Json cityData;
-    cityData.setObject();
-
-    // Geo data
-    auto city = locator->getString(ip, "city.names.en");
-    if (!base::isError(city))
-    {
-        cityData.setString(getResponse(city), "/city_name");
-    }
-
-    auto continentCode = locator->getString(ip, "continent.code");
-    if (!base::isError(continentCode))
-    {
-        cityData.setString(getResponse(continentCode), "/continent_code");
-    }
-
-    auto continentName = locator->getString(ip, "continent.names.en");
-    if (!base::isError(continentName))
-    {
-        cityData.setString(getResponse(continentName), "/continent_name");
-    }
-
-    auto countryIsoCode = locator->getString(ip, "country.iso_code");
-    if (!base::isError(countryIsoCode))
-    {
-        cityData.setString(getResponse(countryIsoCode), "/country_iso_code");
-    }
-
-    auto countryName = locator->getString(ip, "country.names.en");
-    if (!base::isError(countryName))
-    {
-        cityData.setString(getResponse(countryName), "/country_name");
-    }
-
-    auto lat = locator->getDouble(ip, "location.latitude");
-    if (!base::isError(lat))
-    {
-        cityData.setDouble(getResponse(lat), "/location/lat");
-    }
-
-    auto lon = locator->getDouble(ip, "location.longitude");
-    if (!base::isError(lon))
-    {
-        cityData.setDouble(getResponse(lon), "/location/lon");
-    }
-
-    auto postalCode = locator->getString(ip, "postal.code");
-    if (!base::isError(postalCode))
+    enum class Kind
     {
-        cityData.setString(getResponse(postalCode), "/postal_code");
-    }
+        STRING,
+        DOUBLE,
+        UINT32
+    };
 
-    auto timeZone = locator->getString(ip, "location.time_zone");
-    if (!base::isError(timeZone))
-    {
-        cityData.setString(getResponse(timeZone), "/timezone");
-    }
+    DotPath path;       ///< Path of the field in the MMDB entry
+    std::string target; ///< Json pointer of the field in the output document
+    Kind kind;          ///< Type of the field
+};
 
-    auto regionIsoCode = locator->getString(ip, "subdivisions.0.iso_code");
-    if (!base::isError(regionIsoCode))
-    {
-        cityData.setString(getResponse(regionIsoCode), "/region_iso_code");
-    }
+/**
+ * @brief Get the values of the mapped fields of the IP entry.
+ *
+ * Only the mapped fields are read from the entry, the paths are parsed once when the operation is built.
+ */
+json::Json mapToECS(const std::string& ip,
+                    const std::shared_ptr<geo::ILocator>& locator,
+                    const std::vector<MappedField>& fields)
+{
+    json::Json data;
+    data.setObject();
 
-    auto regionName = locator->getString(ip, "subdivisions.0.names.en");
-    if (!base::isError(regionName))
+    for (const auto& field : fields)
     {
-        cityData.setString(getResponse(regionName), "/region_name");
+        switch (field.kind)
+        {
+            case MappedField::Kind::STRING:
+            {
+                auto value = locator->getString(ip, field.path);
+                if (!base::isError(value))
+                {
+                    data.setString(getResponse(value), field.target);
+                }
+                break;
+            }
+            case MappedField::Kind::DOUBLE:
+            {
+                auto value = locator->getDouble(ip, field.path);
+                if (!base::isError(value))
+                {
+                    data.setDouble(getResponse(value), field.target);
+                }
+                break;
+            }
+            case MappedField::Kind::UINT32:
+            {
+                auto value = locator->getUint32(ip, field.path);
+                if (!base::isError(value))
+                {
+                    data.setInt64(getResponse(value), field.target);
+                }
+                break;
+            }
+        }
     }
 
-    return cityData;
+    return data;
 }
 
-json::Json mapAStoECS(const std::string& ip, const std::shared_ptr<geo::ILocator>& locator)
+// Only for the MMDB City / Country db
+std::vector<MappedField> geoFields()
 {
-    json::Json asData;
-    asData.setObject();
-
-    auto asn = locator->getUint32(ip, "autonomous_system_number");
-    if (!base::isError(asn))
-    {
-        asData.setInt64(getResponse(asn), "/number");
-    }
-
-    auto asnOrg = locator->getString(ip, "autonomous_system_organization");
-    if (!base::isError(asnOrg))
-    {
-        asData.setString(getResponse(asnOrg), "/organization/name");
-    }
+    using Kind = MappedField::Kind;
+    return {{"city.names.en", "/city_name", Kind::STRING},
+            {"continent.code", "/continent_code", Kind::STRING},
+            {"continent.names.en", "/continent_name", Kind::STRING},
+            {"country.iso_code", "/country_iso_code", Kind::STRING},
+            {"country.names.en", "/country_name", Kind::STRING},
+            {"location.latitude", "/location/lat", Kind::DOUBLE},
+            {"location.longitude", "/location/lon", Kind::DOUBLE},
+            {"postal.code", "/postal_code", Kind::STRING},
+            {"location.time_zone", "/timezone", Kind::STRING},
+            {"subdivisions.0.iso_code", "/region_iso_code", Kind::STRING},
+            {"subdivisions.0.names.en", "/region_name", Kind::STRING}};
+}
 
-    return asData;
+std::vector<MappedField> asFields()
+{
+    using Kind = MappedField::Kind;
+    return {{"autonomous_system_number", "/number", Kind::UINT32},
+            {"autonomous_system_organization", "/organization/name", Kind::STRING}};
 }
 
 } // namespace
@@ -145,7 +139,8 @@ MapBuilder getMMDBGeoBuilder(const std::shared_ptr<geo::IManager>& geoManager)
         const std::string notFoundDBTrace {fmt::format("{} -> Failure: IP Not found in DB", name)};
         const std::string emptyDataTrace {fmt::format("{} -> Failure: Empty wcs data", name)};
 
-        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
+        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath(), fields = geoFields()](
+                   base::ConstEvent event) -> MapResult
         {
             // Get the ip
             auto ipStr = event->getString(srcRef);
@@ -154,7 +149,7 @@ MapBuilder getMMDBGeoBuilder(const std::shared_ptr<geo::IManager>& geoManager)
                 RETURN_FAILURE(runstate, json::Json {}, notFoundTrace);
             }
 
-            auto geo = mapGeoToECS(ipStr.value(), locator);
+            auto geo = mapToECS(ipStr.value(), locator, fields);
 
             if (geo.size() == 0)
             {
@@ -199,7 +194,8 @@ MapBuilder getMMDBASNBuilder(const std::shared_ptr<geo::IManager>& geoManager)
             return dumpFailTransform("Error getting geo asn locator: " + base::getError(resDB).message, runstate);
         }
 
-        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
+        return [=, locator = base::getResponse(resDB), srcRef = ipRef.jsonPath(), fields = asFields()](
+                   base::ConstEvent event) -> MapResult
         {
             // Get the ip
             auto ipStr = event->getString(srcRef);
@@ -208,7 +204,7 @@ MapBuilder getMMDBASNBuilder(const std::shared_ptr<geo::IManager>& geoManager)
                 RETURN_FAILURE(runstate, json::Json {}, notFoundTrace);
             }
 
-            auto as = mapAStoECS(ipStr.value(), locator);
+            auto as = mapToECS(ipStr.value(), locator, fields);
 
             if (as.size() == 0)
             {
@@ -1,6 +1,7 @@
 #include "opBuilderHelperMap.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <chrono>
 #include <numeric>
 #include <optional>
@@ -13,7 +14,9 @@
 #include <openssl/evp.h>
 #include <openssl/sha.h>
 #include <re2/re2.h>
+#include <re2/stringpiece.h>
 
+#include <base/utils/coarseClock.hpp>
 #include <base/utils/ipUtils.hpp>
 #include <base/utils/stringUtils.hpp>
 
@@ -31,6 +34,8 @@ constexpr auto TRACE_TARGET_TYPE_NOT_STRING = "[{}] -> Failure: Target field '{}
 constexpr auto TRACE_REFERENCE_NOT_FOUND = "[{}] -> Failure: Parameter '{}' reference not found";
 constexpr auto TRACE_REFERENCE_TYPE_IS_NOT = "[{}] -> Failure: Parameter '{}' type is not ";
 
+constexpr auto FORMAT_BUFFER_SIZE = 64; ///< Size of the stack buffer of the number conversions
+
 /**
  * @brief Operators supported by the string helpers.
  *
@@ -120,23 +125,24 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const auto& rightParameter = opArgs[0];
 
-    // Depending on the operator we return the correct function
-    std::function<std::string(const std::string& value)> transformFunction;
+    // Depending on the operator we return the correct function, the result is written once in a string of the size
+    // of the value
+    std::function<std::string(std::string_view value)> transformFunction;
     switch (op)
     {
         case StringOperator::UP:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string_view value)
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::toupper);
+                std::string result(value.size(), '\0');
+                std::transform(value.begin(), value.end(), result.begin(), ::toupper);
                 return result;
             };
             break;
         case StringOperator::LO:
-            transformFunction = [](const std::string& value)
+            transformFunction = [](std::string_view value)
             {
-                std::string result;
-                std::transform(value.begin(), value.end(), std::back_inserter(result), ::tolower);
+                std::string result(value.size(), '\0');
+                std::transform(value.begin(), value.end(), result.begin(), ::tolower);
                 return result;
             };
             break;
@@ -148,42 +154,35 @@ MapOp opBuilderHelperStringTransformation(const std::vector<OpArg>& opArgs,
 
     const std::string failureTrace1 {fmt::format("[{}] -> Failure: Reference not found", name)};
 
-    // Function that implements the helper
-    return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+    // A value is transformed only once, at build time
+    if (rightParameter->isValue())
     {
-        // We assert that references exists, checking if the optional from Json getter
-        // is empty ot not. Then if is a reference we get the value from the event,
-        // otherwise we get the value from the parameter
-
-        // REF
+        json::Json result;
+        result.setString(
+            transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value()));
 
-        if (rightParameter->isReference())
+        return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
-            const auto resolvedRValue {
-                event->getString(std::static_pointer_cast<Reference>(rightParameter)->jsonPath())};
+            RETURN_SUCCESS(runState, result, successTrace);
+        };
+    }
 
-            if (!resolvedRValue.has_value())
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
-            }
-            else
-            {
-                // TODO: should we check the result?
-                auto res {transformFunction(resolvedRValue.value())};
-                json::Json result;
-                result.setString(res);
-                RETURN_SUCCESS(runState, result, successTrace);
-            }
-        }
-        else
+    // Function that implements the helper
+    return [=,
+            runState = buildCtx->runState(),
+            refPath = json::Path(std::static_pointer_cast<Reference>(rightParameter)->jsonPointer())](
+               base::ConstEvent event) -> MapResult
+    {
+        // The reference is read in place, without copying it
+        const auto resolvedRValue {event->getStringView(refPath)};
+        if (!resolvedRValue.has_value())
         {
-            // TODO: should we check the result?
-            const auto res {
-                transformFunction(std::static_pointer_cast<Value>(rightParameter)->value().getString().value())};
-            json::Json result;
-            result.setString(res);
-            RETURN_SUCCESS(runState, result, successTrace);
+            RETURN_FAILURE(runState, json::Json {}, failureTrace1);
         }
+
+        json::Json result;
+        result.setString(transformFunction(resolvedRValue.value()));
+        RETURN_SUCCESS(runState, result, successTrace);
     };
 }
 
@@ -255,7 +254,7 @@ MapOp opBuilderHelperIntTransformation(IntOperator op,
             getOperandFn.emplace_back(
                 [ref, failureTrace2](base::ConstEvent event) -> int64_t
                 {
-                    auto resolvedRValue {event->getIntAsInt64(ref->jsonPath())};
+                    auto resolvedRValue {event->getIntAsInt64(ref->jsonPointer())};
                     if (!resolvedRValue.has_value())
                     {
                         throw std::runtime_error(failureTrace2 + ref->dotPath());
@@ -341,14 +340,12 @@ MapOp opBuilderHelperIntTransformation(IntOperator op,
         int64_t res {};
         try
         {
-            std::vector<int64_t> auxVector {};
-            auto leftOp = getOperandFn[0](event);
-            // Skip the first element
+            // Folded as the operands are read, without collecting them first
+            res = getOperandFn[0](event);
             for (size_t i = 1; i < getOperandFn.size(); i++)
             {
-                auxVector.emplace_back(getOperandFn[i](event));
+                res = transformFunction(res, getOperandFn[i](event));
             }
-            res = std::accumulate(auxVector.begin(), auxVector.end(), leftOp, transformFunction);
         }
         catch (const std::runtime_error& e)
         {
@@ -404,6 +401,49 @@ std::optional<std::string> hashStringSHA1(std::string& input)
     return {output};
 }
 
+/**
+ * @brief Checks the arguments of the regex extract helpers and compiles the regex.
+ *
+ * @return The regex and the reference to match.
+ * @throw std::runtime_error if the arguments are invalid or the regex does not compile.
+ */
+std::pair<std::shared_ptr<RE2>, Reference> buildExtractRegex(const std::vector<OpArg>& opArgs,
+                                                             const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    // Assert expected number of parameters
+    builder::builders::utils::assertSize(opArgs, 2);
+    // Parameter type check
+    builder::builders::utils::assertRef(opArgs, 0);
+    builder::builders::utils::assertValue(opArgs, 1);
+
+    // Get regex
+    if (!std::static_pointer_cast<Value>(opArgs[1])->value().isString())
+    {
+        throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
+                                             std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
+    }
+    auto regex_ptr = std::make_shared<RE2>(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
+    if (!regex_ptr->ok())
+    {
+        throw std::runtime_error(fmt::format("Invalid regex: {}", regex_ptr->error()));
+    }
+
+    // Get field reference
+    const auto refField = *std::static_pointer_cast<Reference>(opArgs[0]);
+    if (buildCtx->validator().hasField(refField.dotPath()))
+    {
+        auto jType = buildCtx->validator().getJsonType(refField.dotPath());
+        if (jType != json::Json::Type::String)
+        {
+            throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
+                                                 refField.dotPath(),
+                                                 json::Json::typeToStr(jType)));
+        }
+    }
+
+    return {regex_ptr, refField};
+}
+
 } // namespace
 
 namespace builder::builders
@@ -479,46 +519,56 @@ TransformOp opBuilderHelperStringTrim(const Reference& targetField,
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: Invalid trim type '{}'", name, trimType)};
 
     // Return Op
-    return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+    return [=, runState = buildCtx->runState(), targetField = json::Path(targetField.jsonPointer())](
+               base::Event event) -> TransformResult
     {
-        // Get field value
-        if (!event->exists(targetField))
-        {
-            RETURN_FAILURE(runState, event, failureTrace1);
-        }
-
-        auto resolvedField {event->getString(targetField)};
+        // Get field value, in place
+        const auto resolvedField {event->getStringView(targetField)};
 
         // Check if field is a string
         if (!resolvedField.has_value())
         {
+            if (!event->exists(targetField))
+            {
+                RETURN_FAILURE(runState, event, failureTrace1);
+            }
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        // Get string
-        std::string strToTrim {resolvedField.value()};
-
-        // Trim
+        // Trim, narrowing the view
+        auto strToTrim {resolvedField.value()};
+        const auto trimBegin = [&]()
+        {
+            strToTrim.remove_prefix(std::min(strToTrim.find_first_not_of(trimChar), strToTrim.size()));
+        };
+        const auto trimEnd = [&]()
+        {
+            const auto last = strToTrim.find_last_not_of(trimChar);
+            strToTrim = strToTrim.substr(0, last == std::string_view::npos ? 0 : last + 1);
+        };
         switch (trimType)
         {
             case 's':
                 // Trim begin
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
+                trimBegin();
                 break;
             case 'e':
                 // Trim end
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
+                trimEnd();
                 break;
             case 'b':
                 // Trim both
-                strToTrim.erase(0, strToTrim.find_first_not_of(trimChar));
-                strToTrim.erase(strToTrim.find_last_not_of(trimChar) + 1);
+                trimBegin();
+                trimEnd();
                 break;
             default: RETURN_FAILURE(runState, event, failureTrace3); break;
         }
 
-        event->setString(strToTrim, targetField);
+        // The string is only copied if it has changed, once from the view into the event
+        if (strToTrim.size() != resolvedField.value().size())
+        {
+            event->setString(strToTrim, targetField);
+        }
 
         RETURN_SUCCESS(runState, event, successTrace);
     };
@@ -571,65 +621,73 @@ MapBuilder opBuilderHelperStringConcat(bool atleastOne)
         const std::string failureTrace1 {fmt::format("{} -> Failure: ", name)};
         const std::string failureTrace2 {fmt::format("{} -> Failure: ", name)};
 
+        // The values are formatted once, at build time, and the references are precompiled
+        std::vector<std::variant<std::string, json::Path>> parts;
+        parts.reserve(opArgs.size());
+        std::size_t valuesSize {0};
+        for (const auto& arg : opArgs)
+        {
+            if (arg->isReference())
+            {
+                parts.emplace_back(json::Path(std::static_pointer_cast<Reference>(arg)->jsonPointer()));
+            }
+            else
+            {
+                const auto& value = std::static_pointer_cast<Value>(arg)->value();
+                parts.emplace_back(value.isString() ? value.getString().value() : value.str());
+                valuesSize += std::get<std::string>(parts.back()).size();
+            }
+        }
+
         // Return Op
         return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
             std::string result {};
+            result.reserve(valuesSize);
 
-            for (const auto& arg : opArgs)
+            for (const auto& part : parts)
             {
-                if (arg->isReference())
+                if (std::holds_alternative<std::string>(part))
                 {
-                    // Check path exists
-                    std::string resolvedField {};
-                    const auto& ref = std::static_pointer_cast<Reference>(arg)->jsonPath();
-
-                    auto isExist = event->exists(ref);
-
-                    if (!isExist)
-                    {
-                        if (!atleastOne)
-                        {
-                            RETURN_FAILURE(
-                                runState, json::Json {}, failureTrace1 + fmt::format("Reference '{}' not found", ref));
-                        }
-
-                        result.append(resolvedField);
-                        continue;
-                    }
+                    result.append(std::get<std::string>(part));
+                    continue;
+                }
 
-                    // Get field value
-                    if (event->isString(ref))
-                    {
-                        resolvedField = event->getString(ref).value();
-                    }
-                    else if (event->isDouble(ref))
-                    {
-                        resolvedField = std::to_string(event->getDouble(ref).value());
-                    }
-                    else if (event->isInt(ref) ||event->isInt64(ref))
-                    {
-                        resolvedField = std::to_string(event->getIntAsInt64(ref).value());
-                    }
-                    else if (event->isObject(ref))
-                    {
-                        resolvedField = event->str(ref).value();
-                    }
-                    else
+                // Check path exists
+                const auto& ref = std::get<json::Path>(part);
+                if (!event->exists(ref))
+                {
+                    if (!atleastOne)
                     {
                         RETURN_FAILURE(runState,
                                        json::Json {},
-                                       failureTrace2 + fmt::format("Parameter '{}' type cannot be handled", ref));
+                                       failureTrace1 + fmt::format("Reference '{}' not found", ref.str()));
                     }
+                    continue;
+                }
 
-                    result.append(resolvedField);
+                // Get field value, the strings are appended in place
+                if (const auto str = event->getStringView(ref); str.has_value())
+                {
+                    result.append(str.value());
+                }
+                else if (event->isDouble(ref))
+                {
+                    result.append(std::to_string(event->getDouble(ref).value()));
+                }
+                else if (event->isInt(ref) || event->isInt64(ref))
+                {
+                    result.append(std::to_string(event->getIntAsInt64(ref).value()));
+                }
+                else if (event->isObject(ref))
+                {
+                    result.append(event->str(ref).value());
                 }
                 else
                 {
-                    const std::string value = std::static_pointer_cast<Value>(arg)->value().isString()
-                                                  ? std::static_pointer_cast<Value>(arg)->value().getString().value()
-                                                  : std::static_pointer_cast<Value>(arg)->value().str();
-                    result.append(value);
+                    RETURN_FAILURE(runState,
+                                   json::Json {},
+                                   failureTrace2 + fmt::format("Parameter '{}' type cannot be handled", ref.str()));
                 }
             }
             json::Json resultJson;
@@ -685,7 +743,7 @@ MapOp opBuilderHelperStringFromArray(const std::vector<OpArg>& opArgs, const std
     const std::string failureTrace3 {fmt::format(TRACE_REFERENCE_TYPE_IS_NOT, "array", traceName, arrayRef.dotPath())};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), arrayName = arrayRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), arrayName = arrayRef.jsonPointer()](base::ConstEvent event) -> MapResult
     {
         // Check if reference exists
         if (!event->exists(arrayName))
@@ -694,29 +752,31 @@ MapOp opBuilderHelperStringFromArray(const std::vector<OpArg>& opArgs, const std
         }
 
         // Getting array field, must be a reference
-        const auto stringJsonArray = event->getArray(arrayName);
+        const auto stringJsonArray = event->getArrayView(arrayName);
         if (!stringJsonArray.has_value())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
-        std::vector<std::string> stringArray;
-        for (const auto& s_param : stringJsonArray.value())
+        // accumulated concation without trailing indexes, the strings are read in place
+        std::string composedValueString;
+        auto first = true;
+        for (const auto s_param : stringJsonArray.value())
         {
-            if (s_param.isString())
+            const auto strVal = s_param.getStringView();
+            if (!strVal.has_value())
             {
-                const auto strVal = s_param.getString().value();
-                stringArray.emplace_back(std::move(strVal));
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
             }
-            else
+
+            if (!first)
             {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+                composedValueString.append(separator);
             }
+            composedValueString.append(strVal.value());
+            first = false;
         }
 
-        // accumulated concation without trailing indexes
-        const std::string composedValueString {base::utils::string::join(stringArray, separator)};
-
         json::Json result;
         result.setString(composedValueString);
 
@@ -757,54 +817,40 @@ MapOp opBuilderHelperStringFromHexa(const std::vector<OpArg>& opArgs, const std:
     const auto failureTrace5 = fmt::format("{} -> Found non ascii character", traceName);
 
     // Return Op
-    return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), sourceField = json::Path(hexRef.jsonPointer())](
+               base::ConstEvent event) -> MapResult
     {
-        std::string strHex {};
-
-        // Getting string field from a reference
-        if (!event->exists(sourceField))
-        {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace1);
-        }
-
-        const auto refStrHEX = event->getString(sourceField);
+        // Getting string field from a reference, read in place
+        const auto refStrHEX = event->getStringView(sourceField);
         if (!refStrHEX.has_value())
         {
+            if (!event->exists(sourceField))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        strHex = refStrHEX.value();
-
-        const auto lenHex = strHex.length();
-
-        if (lenHex % 2)
+        const auto strHex = refStrHEX.value();
+        if (strHex.length() % 2)
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
-        std::string strASCII {};
-        strASCII.resize((lenHex / 2) + 1);
-
-        for (int iHex = 0, iASCII = 0; iHex < lenHex; iHex += 2, iASCII++)
+        // Decoded at once into the result string
+        std::string strASCII(strHex.length() / 2, '\0');
+        const auto invalidPos = base::utils::string::decodeHex(strHex, strASCII.data());
+        if (invalidPos != strHex.length())
         {
-            char* err = nullptr;
-
-            std::string byte = strHex.substr(iHex, 2);
-            char chr = (char)strtol(byte.c_str(), &err, 16); // BASE: 16 (Hexa)
-
-            if (err != nullptr && *err != 0)
-            {
-                RETURN_FAILURE(runState,
-                               json::Json {},
-                               failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", err));
-            }
-
-            if (chr < 0 || chr > 127)
-            {
-                RETURN_FAILURE(runState, json::Json {}, failureTrace5);
-            }
+            RETURN_FAILURE(
+                runState,
+                json::Json {},
+                failureTrace4 + fmt::format("Character '{}' is not a valid hexa digit", strHex[invalidPos]));
+        }
 
-            strASCII[iASCII] = chr;
+        if (std::any_of(strASCII.begin(), strASCII.end(), [](char chr) { return chr < 0; }))
+        {
+            RETURN_FAILURE(runState, json::Json {}, failureTrace5);
         }
 
         json::Json result;
@@ -844,24 +890,30 @@ MapOp opBuilderHelperHexToNumber(const std::vector<OpArg>& opArgs, const std::sh
     const std::string failureTrace3 {fmt::format("[{}] -> Failure: ", traceName)};
 
     // Return Op
-    return [=, runState = buildCtx->runState(), sourceField = hexRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), sourceField = json::Path(hexRef.jsonPointer())](
+               base::ConstEvent event) -> MapResult
     {
-        // Getting string field from a reference
-        if (!event->exists(sourceField))
+        // Getting string field from a reference, read in place
+        const auto refStrHEX = event->getStringView(sourceField);
+        if (!refStrHEX.has_value())
         {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            if (!event->exists(sourceField))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
+            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        const auto refStrHEX = event->getString(sourceField);
-        if (!refStrHEX.has_value())
+        // Parsed in place, with the optional 0x prefix
+        auto strHex = refStrHEX.value();
+        if (strHex.size() > 2 && strHex[0] == '0' && (strHex[1] == 'x' || strHex[1] == 'X'))
         {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
+            strHex.remove_prefix(2);
         }
-        std::stringstream ss;
-        ss << refStrHEX.value();
+
         int result;
-        ss >> std::hex >> result;
-        if (ss.fail() || !ss.eof())
+        const auto [end, ec] = std::from_chars(strHex.data(), strHex.data() + strHex.size(), result, 16);
+        if (ec != std::errc {} || end != strHex.data() + strHex.size())
         {
             RETURN_FAILURE(runState,
                            json::Json {},
@@ -913,31 +965,41 @@ TransformOp opBuilderHelperStringReplace(const Reference& targetField,
     const std::string failureTrace2 {fmt::format(TRACE_TARGET_TYPE_NOT_STRING, name, targetField.dotPath())};
 
     // Return Op
-    return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+    return [=, runState = buildCtx->runState(), targetField = json::Path(targetField.jsonPointer())](
+               base::Event event) -> TransformResult
     {
-        if (!event->exists(targetField))
-        {
-            RETURN_FAILURE(runState, event, failureTrace1);
-        }
-
-        // Get field value
-        auto resolvedField = event->getString(targetField);
+        // Get field value, in place
+        const auto resolvedField = event->getStringView(targetField);
 
         // Check if field is a string
         if (!resolvedField.has_value())
         {
+            if (!event->exists(targetField))
+            {
+                RETURN_FAILURE(runState, event, failureTrace1);
+            }
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        auto newString = resolvedField.value();
+        // Nothing to replace, the field is not copied
+        const auto str = resolvedField.value();
+        auto pos = str.find(oldSubstr);
+        if (pos == std::string_view::npos)
+        {
+            RETURN_SUCCESS(runState, event, successTrace);
+        }
 
-        size_t start_pos = 0;
-        while ((start_pos = newString.find(oldSubstr, start_pos)) != std::string::npos)
+        // Copy the pieces between the occurrences into a single string
+        std::string newString;
+        newString.reserve(str.size() + (newSubstr.size() > oldSubstr.size() ? newSubstr.size() - oldSubstr.size() : 0));
+        std::size_t start = 0;
+        for (; pos != std::string_view::npos; pos = str.find(oldSubstr, start))
         {
-            newString.replace(start_pos, oldSubstr.length(), newSubstr);
-            start_pos += newSubstr.length();
+            newString.append(str.substr(start, pos - start));
+            newString.append(newSubstr);
+            start = pos + oldSubstr.size();
         }
+        newString.append(str.substr(start));
 
         event->setString(newString, targetField);
 
@@ -973,18 +1035,26 @@ MapOp opBuilderHelperNumberToString(const std::vector<OpArg>& opArgs, const std:
             reference = reference->jsonPath(),
             runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        std::string valueConverted;
+        // Formatted into a buffer on the stack, as std::to_string does but without the intermediate string
+        char buffer[FORMAT_BUFFER_SIZE];
+        std::string_view valueConverted;
         if (event->isInt64(reference) || event->isInt(reference))
         {
-            valueConverted = std::to_string(event->getIntAsInt64(reference).value());
+            const auto res = std::to_chars(buffer, buffer + sizeof(buffer), event->getIntAsInt64(reference).value());
+            valueConverted = std::string_view(buffer, res.ptr - buffer);
         }
-        else if (event->isDouble(reference))
+        else if (event->isDouble(reference) || event->isFloat(reference))
         {
-            valueConverted = std::to_string(event->getDouble(reference).value());
-        }
-        else if (event->isFloat(reference))
-        {
-            valueConverted = std::to_string(event->getFloat(reference).value());
+            const auto value = event->isDouble(reference) ? event->getDouble(reference).value()
+                                                          : static_cast<double>(event->getFloat(reference).value());
+            const auto res = fmt::format_to_n(buffer, sizeof(buffer), "{:.6f}", value);
+            if (res.size > sizeof(buffer))
+            {
+                json::Json result;
+                result.setString(fmt::format("{:.6f}", value));
+                RETURN_SUCCESS(runState, result, successTrace);
+            }
+            valueConverted = std::string_view(buffer, res.size);
         }
         else
         {
@@ -1026,35 +1096,60 @@ MapOp opBuilderHelperIntCalc(const std::vector<OpArg>& opArgs, const std::shared
 // field: +regex_extract/_field/regexp/
 MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
-    // Assert expected number of parameters
-    builder::builders::utils::assertSize(opArgs, 2);
-    // Parameter type check
-    builder::builders::utils::assertRef(opArgs, 0);
-    builder::builders::utils::assertValue(opArgs, 1);
+    auto [regex_ptr, refField] = buildExtractRegex(opArgs, buildCtx);
 
-    // Get regex
-    if (!std::static_pointer_cast<Value>(opArgs[1])->value().isString())
-    {
-        throw std::runtime_error(fmt::format("Expected 'string' parameter but got type '{}'",
-                                             std::static_pointer_cast<Value>(opArgs[1])->value().typeName()));
-    }
-    auto regex_ptr = std::make_shared<RE2>(std::static_pointer_cast<Value>(opArgs[1])->value().getString().value());
-    if (!regex_ptr->ok())
-    {
-        throw std::runtime_error(fmt::format("Invalid regex: {}", regex_ptr->error()));
-    }
+    // Tracing
+    const auto name = buildCtx->context().opName;
+    const auto successTrace = fmt::format("{} -> Success", name);
+    const auto failureTrace1 = fmt::format("{} -> Reference '{}' not found", name, refField.dotPath());
+    const auto failureTrace2 = fmt::format("{} -> Reference '{}' is not a string", name, refField.dotPath());
+    const auto failureTrace3 = fmt::format("[{}] -> Regex did not match", name);
 
-    // Get field reference
-    const auto refField = *std::static_pointer_cast<Reference>(opArgs[0]);
-    if (buildCtx->validator().hasField(refField.dotPath()))
+    // Return Op
+    return [=, runState = buildCtx->runState(), refField = json::Path(refField.jsonPointer())](
+               base::ConstEvent event) -> MapResult
     {
-        auto jType = buildCtx->validator().getJsonType(refField.dotPath());
-        if (jType != json::Json::Type::String)
+        // The field is matched in place and the capture points into it, the match is only copied into the result
+        const auto resolvedField = event->getStringView(refField);
+        if (!resolvedField.has_value())
         {
-            throw std::runtime_error(fmt::format("Expected 'string' reference but got reference '{}' of type '{}'",
-                                                 refField.dotPath(),
-                                                 json::Json::typeToStr(jType)));
+            if (!event->exists(refField))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
+            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
+
+        const re2::StringPiece input {resolvedField.value().data(), resolvedField.value().size()};
+        re2::StringPiece match;
+        if (RE2::PartialMatch(input, *regex_ptr, &match))
+        {
+            json::Json result;
+            result.setString(std::string_view {match.data(), match.size()});
+
+            RETURN_SUCCESS(runState, result, successTrace);
+        }
+
+        RETURN_FAILURE(runState, json::Json {}, failureTrace3);
+    };
+}
+
+// field: +regex_extract_groups/_field/regexp/
+MapOp opBuilderHelperRegexExtractGroups(const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    auto [regex_ptr, refField] = buildExtractRegex(opArgs, buildCtx);
+
+    // The named groups are captured in a single match, each one into the member of its name
+    const auto groupCount = static_cast<std::size_t>(regex_ptr->NumberOfCapturingGroups());
+    std::vector<std::pair<std::size_t, std::string>> groups;
+    for (const auto& [groupName, index] : regex_ptr->NamedCapturingGroups())
+    {
+        groups.emplace_back(static_cast<std::size_t>(index - 1), json::Json::formatJsonPath(groupName));
+    }
+    if (groups.empty())
+    {
+        throw std::runtime_error("The regex must have at least one named capturing group");
     }
 
     // Tracing
@@ -1065,30 +1160,47 @@ MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::s
     const auto failureTrace3 = fmt::format("[{}] -> Regex did not match", name);
 
     // Return Op
-    return [=, runState = buildCtx->runState(), refField = refField.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), refField = json::Path(refField.jsonPointer())](
+               base::ConstEvent event) -> MapResult
     {
-        if (!event->exists(refField))
+        const auto resolvedField = event->getStringView(refField);
+        if (!resolvedField.has_value())
         {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            if (!event->exists(refField))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
+            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        const auto resolvedField = event->getString(refField);
-
-        if (!resolvedField.has_value())
+        // Every group is captured, as the arguments of the match are positional
+        std::vector<re2::StringPiece> captures(groupCount);
+        std::vector<RE2::Arg> args(groupCount);
+        std::vector<const RE2::Arg*> argPtrs(groupCount);
+        for (std::size_t i = 0; i < groupCount; ++i)
         {
-            RETURN_FAILURE(runState, json::Json {}, failureTrace2);
+            args[i] = &captures[i];
+            argPtrs[i] = &args[i];
         }
 
-        std::string match {};
-        if (RE2::PartialMatch(resolvedField.value(), *regex_ptr, &match))
+        const re2::StringPiece input {resolvedField.value().data(), resolvedField.value().size()};
+        if (!RE2::PartialMatchN(input, *regex_ptr, argPtrs.data(), static_cast<int>(groupCount)))
         {
-            json::Json result;
-            result.setString(match);
+            RETURN_FAILURE(runState, json::Json {}, failureTrace3);
+        }
 
-            RETURN_SUCCESS(runState, result, successTrace);
+        json::Json result;
+        result.setObject();
+        for (const auto& [index, path] : groups)
+        {
+            // A group that did not take part in the match has no data
+            if (captures[index].data() != nullptr)
+            {
+                result.setString(std::string_view {captures[index].data(), captures[index].size()}, path);
+            }
         }
 
-        RETURN_FAILURE(runState, json::Json {}, failureTrace3);
+        RETURN_SUCCESS(runState, result, successTrace);
     };
 }
 
@@ -1219,8 +1331,8 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
     // Return Op
     return [=,
             runState = buildCtx->runState(),
-            targetField = targetField.jsonPath(),
-            fieldReference = ref.jsonPath(),
+            targetField = json::Path(targetField.jsonPointer()),
+            fieldReference = json::Path(ref.jsonPointer()),
             separator = separator[0]](base::Event event) -> TransformResult
     {
         // Check if reference exists
@@ -1228,17 +1340,28 @@ TransformOp opBuilderHelperAppendSplitString(const Reference& targetField,
         {
             RETURN_FAILURE(runState, event, failureTrace1);
         }
+
+        // Copied once, the target may be the reference itself and be replaced by the array
         const auto resolvedReference = event->getString(fieldReference);
         if (!resolvedReference.has_value())
         {
             RETURN_FAILURE(runState, event, failureTrace2);
         }
 
-        const auto splitted = base::utils::string::split(resolvedReference.value(), separator);
-
-        for (const auto& value : splitted)
+        // Split as base::utils::string::split, appending the views of the pieces
+        std::string_view str {resolvedReference.value()};
+        if (!str.empty() && str[0] == separator)
+        {
+            str.remove_prefix(1);
+        }
+        for (auto pos = str.find(separator); pos != std::string_view::npos; pos = str.find(separator))
+        {
+            event->appendString(str.substr(0, pos), targetField);
+            str.remove_prefix(pos + 1);
+        }
+        if (!str.empty())
         {
-            event->appendString(value, targetField);
+            event->appendString(str, targetField);
         }
 
         RETURN_SUCCESS(runState, event, successTrace);
@@ -1323,8 +1446,8 @@ TransformOp opBuilderHelperDeleteField(const Reference& targetField,
         fmt::format("[{}] -> Failure: Target field '{}' could not be erased", name, targetField.dotPath())};
 
     // Return Op
-    return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath()](base::Event event) -> TransformResult
+    return [=, runState = buildCtx->runState(), targetField = targetField.jsonPointer()](
+               base::Event event) -> TransformResult
     {
         bool result {false};
         try
@@ -1373,6 +1496,10 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
 
         auto validationRes = base::getResponse<schemf::ValidationResult>(res);
         runValidator = validationRes.getValidator();
+        if (runValidator)
+        {
+            buildCtx->countRuntimeValidation();
+        }
     }
 
     // Tracing messages
@@ -1382,9 +1509,10 @@ TransformOp opBuilderHelperRenameField(const Reference& targetField,
     const auto failureTrace3 = fmt::format("{} -> Source field '{}' could not be erased", name, targetField.dotPath());
     const auto failureTrace4 = fmt::format("{} -> Source field '{}' is not valid: ", name, srcField.dotPath());
 
-    return
-        [=, runState = buildCtx->runState(), targetField = targetField.jsonPath(), sourceField = srcField.jsonPath()](
-            base::Event event) -> TransformResult
+    return [=,
+            runState = buildCtx->runState(),
+            targetField = targetField.jsonPointer(),
+            sourceField = srcField.jsonPointer()](base::Event event) -> TransformResult
     {
         if (event->exists(targetField))
         {
@@ -1451,7 +1579,7 @@ MapOp opBuilderHelperIPVersionFromIPStr(const std::vector<OpArg>& opArgs,
         fmt::format("{} -> Reference '{}' value is not a valid IP address", name, ipRef.dotPath());
 
     // Return Op
-    return [=, runState = buildCtx->runState(), ipStrPath = ipRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), ipStrPath = ipRef.jsonPointer()](base::ConstEvent event) -> MapResult
     {
         // Check if reference exists
         if (!event->exists(ipStrPath))
@@ -1503,8 +1631,8 @@ MapOp opBuilderHelperEpochTimeFromSystem(const std::vector<OpArg>& opArgs,
     // Return Op
     return [=, runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
     {
-        auto sec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch())
-                       .count();
+        // Read from the process-wide clock, without a syscall per event
+        auto sec = base::utils::time::CoarseClock::instance().epochSeconds();
         // TODO: Delete this and dd SetInt64 or SetIntAny to JSON class, get
         // Number of any type (fix concat helper)
         if (sec > std::numeric_limits<int64_t>::max())
@@ -1549,7 +1677,7 @@ MapOp opBuilderHelperDateFromEpochTime(const std::vector<OpArg>& opArgs,
         fmt::format("{} -> Reference '{}' does not hold a valid integer epoch number", name, epochRef.dotPath());
 
     // Return Op
-    return [=, runState = buildCtx->runState(), refPath = epochRef.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), refPath = epochRef.jsonPointer()](base::ConstEvent event) -> MapResult
     {
         // Check if reference exists
         if (!event->exists(refPath))
@@ -1563,15 +1691,32 @@ MapOp opBuilderHelperDateFromEpochTime(const std::vector<OpArg>& opArgs,
             RETURN_FAILURE(runState, json::Json {}, failureTrace2);
         }
 
-        date::sys_time<std::chrono::seconds> tp {std::chrono::seconds {epoch.value()}};
-        auto result = date::format("%Y-%m-%dT%H:%M:%SZ", tp);
-        if (result.empty())
+        // The events of a batch usually share the second, so the last date formatted by the thread is reused
+        thread_local int64_t cachedEpoch = 0;
+        thread_local std::string cachedResult;
+        if (cachedResult.empty() || cachedEpoch != epoch.value())
+        {
+            char buffer[base::utils::time::ISO8601_SECONDS_SIZE + 1];
+            if (base::utils::time::formatISO8601Seconds(epoch.value(), buffer))
+            {
+                buffer[base::utils::time::ISO8601_SECONDS_SIZE] = 'Z';
+                cachedResult.assign(buffer, sizeof(buffer));
+            }
+            else
+            {
+                date::sys_time<std::chrono::seconds> tp {std::chrono::seconds {epoch.value()}};
+                cachedResult = date::format("%Y-%m-%dT%H:%M:%SZ", tp);
+            }
+            cachedEpoch = epoch.value();
+        }
+
+        if (cachedResult.empty())
         {
             RETURN_FAILURE(runState, json::Json {}, failureTrace3);
         }
 
         json::Json resultJson;
-        resultJson.setString(result);
+        resultJson.setString(cachedResult);
         RETURN_SUCCESS(runState, resultJson, successTrace);
     };
 }
@@ -1608,7 +1753,7 @@ MapOp opBuilderHelperHashSHA1(const std::vector<OpArg>& opArgs, const std::share
     const auto failureTrace3 = fmt::format("{} -> Could not hash string", name);
 
     // Return Op
-    return [=, runState = buildCtx->runState(), refPath = ref.jsonPath()](base::ConstEvent event) -> MapResult
+    return [=, runState = buildCtx->runState(), refPath = ref.jsonPointer()](base::ConstEvent event) -> MapResult
     {
         // Check if reference exists
         if (!event->exists(refPath))
@@ -1706,6 +1851,10 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
     }
 
     auto runValidator = base::getResponse<schemf::ValidationResult>(validationRes).getValidator();
+    if (runValidator)
+    {
+        buildCtx->countRuntimeValidation();
+    }
 
     // Tracing
     const auto name = buildCtx->context().opName;
@@ -1724,7 +1873,7 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
             runState = buildCtx->runState(),
             targetField = targetField.jsonPath(),
             parameter = opArgs[0],
-            key = keyRef.jsonPath()](base::Event event) -> TransformResult
+            key = keyRef.jsonPointer()](base::Event event) -> TransformResult
     {
         // Get key
         if (!event->exists(key))
@@ -1748,11 +1897,11 @@ TransformOp opBuilderHelperGetValueGeneric(const Reference& targetField,
             const auto& ref = *std::static_pointer_cast<Reference>(parameter);
 
             // Get reference object
-            if (!event->exists(ref.jsonPath()))
+            if (!event->exists(ref.jsonPointer()))
             {
                 RETURN_FAILURE(runState, event, failureTrace3);
             }
-            resolvedObject = event->getJson(ref.jsonPath());
+            resolvedObject = event->getJson(ref.jsonPointer());
             if (!resolvedObject.value().isObject())
             {
                 RETURN_FAILURE(runState, event, failureTrace4);
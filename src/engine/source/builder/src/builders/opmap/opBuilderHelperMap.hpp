@@ -244,6 +244,18 @@ TransformOp opBuilderHelperEraseCustomFields(const Reference& targetField,
  */
 MapOp opBuilderHelperRegexExtract(const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Builds regex extract groups operation.
+ * Maps into an object the named capturing groups of the regexp that match the field value, by group name
+ *
+ * @param opArgs Vector of operation arguments containing the reference and the regexp.
+ * @param buildCtx Shared pointer to the build context used for the conversion operation.
+ * @return base::Expression The lifter with the `regex extract groups` transformation.
+ * @throw std::runtime_error if the regex is invalid or has no named capturing groups.
+ */
+MapOp opBuilderHelperRegexExtractGroups(const std::vector<OpArg>& opArgs,
+                                        const std::shared_ptr<const IBuildCtx>& buildCtx);
+
 //*************************************************
 //*           Array tranform                      *
 //*************************************************
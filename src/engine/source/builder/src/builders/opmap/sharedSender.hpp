@@ -0,0 +1,67 @@
+#ifndef _OP_BUILDER_SHARED_SENDER_HPP
+#define _OP_BUILDER_SHARED_SENDER_HPP
+
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <metrics/iMetricsScope.hpp>
+#include <sockiface/batchSender.hpp>
+#include <sockiface/isockFactory.hpp>
+
+namespace builder::builders::opmap
+{
+
+/**
+ * @brief Batch sender of a socket shared by all the ops built by the same builder.
+ *
+ * The socket is opened by the first op that needs it, so no socket is opened while registering the builders.
+ */
+class SharedSender
+{
+private:
+    std::shared_ptr<sockiface::ISockFactory> m_sockFactory; ///< Factory of the socket handler
+    sockiface::ISockHandler::Protocol m_protocol;           ///< Protocol of the socket
+    std::string m_path;                                     ///< Path of the socket
+    std::shared_ptr<metricsManager::IMetricsScope> m_scope; ///< Metrics of the sender, may be null
+    std::mutex m_mutex;                                     ///< Protects the sender
+    std::shared_ptr<sockiface::BatchSender> m_sender;       ///< Sender, created on the first use
+
+public:
+    static constexpr std::size_t BATCH_SIZE {64};              ///< Messages that trigger a send
+    static constexpr std::chrono::milliseconds MAX_DELAY {10}; ///< Maximum time a message waits to be sent
+    static constexpr std::size_t QUEUE_SIZE {4096};            ///< Messages queued before dropping the new ones
+
+    SharedSender(std::shared_ptr<sockiface::ISockFactory> sockFactory,
+                 sockiface::ISockHandler::Protocol protocol,
+                 std::string path,
+                 std::shared_ptr<metricsManager::IMetricsScope> scope = nullptr)
+        : m_sockFactory(std::move(sockFactory))
+        , m_protocol(protocol)
+        , m_path(std::move(path))
+        , m_scope(std::move(scope))
+    {
+    }
+
+    /**
+     * @brief Get the sender, creating it on the first call.
+     *
+     * @return std::shared_ptr<sockiface::BatchSender>
+     * @throw std::runtime_error if the socket handler cannot be created.
+     */
+    std::shared_ptr<sockiface::BatchSender> get()
+    {
+        std::lock_guard lock {m_mutex};
+        if (!m_sender)
+        {
+            m_sender = std::make_shared<sockiface::BatchSender>(
+                m_sockFactory->getHandler(m_protocol, m_path), BATCH_SIZE, MAX_DELAY, QUEUE_SIZE, m_scope);
+        }
+        return m_sender;
+    }
+};
+
+} // namespace builder::builders::opmap
+
+#endif // _OP_BUILDER_SHARED_SENDER_HPP
@@ -7,9 +7,13 @@ namespace builder::builders::opmap
 {
 
 // field: +send_upgrade_confirmation/ar_message
-MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockFactory>& sockFactory)
+MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+                                         const std::shared_ptr<metricsManager::IMetricsScope>& metricsScope)
 {
-    return [sockFactory](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
+    auto sender = std::make_shared<SharedSender>(
+        sockFactory, sockiface::ISockHandler::Protocol::STREAM, WM_UPGRADE_SOCK, metricsScope);
+
+    return [sender](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx>& buildCtx) -> MapOp
     {
         utils::assertSize(opArgs, 1);
         utils::assertRef(opArgs);
@@ -18,23 +22,22 @@ MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockF
 
         const auto& refParam = *std::static_pointer_cast<const Reference>(opArgs[0]);
 
-        // Socket instance
-        auto socketUC = sockFactory->getHandler(sockiface::ISockHandler::Protocol::STREAM, WM_UPGRADE_SOCK);
+        // Sender shared by all the ops, the messages are sent in batches by its own thread
+        auto senderUC = sender->get();
 
         // Tracing
         const auto successTrace = fmt::format("{} -> Success", name);
 
         const auto failureTrace1 = fmt::format("{} -> Message reference '{}' not found", name, refParam.dotPath());
         const auto failureTrace2 = fmt::format("{} -> The message is empty", name);
-        const auto failureTrace3 = fmt::format("{} -> Upgrade confirmation message could not be sent", name);
-        const auto failureTrace4 = fmt::format("{} -> Error trying to send upgrade confirmation message: ", name);
+        const auto failureTrace3 =
+            fmt::format("{} -> Upgrade confirmation message could not be queued, the queue is full", name);
         const auto failureTrace5 = fmt::format("{} -> Message should be a JSON object: ", name);
 
         // Return Op
         return [=, ref = refParam.jsonPath(), runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
         {
             std::string query {};
-            bool messageSent {false};
             json::Json result;
             result.setBool(false);
 
@@ -51,25 +54,15 @@ MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockF
             {
                 RETURN_FAILURE(runState, result, failureTrace2);
             }
-            else
+
+            // The send results are not waited for, the failed sends are logged by the sender
+            if (!senderUC->push(std::move(query)))
             {
-                try
-                {
-                    if (sockiface::ISockHandler::SendRetval::SUCCESS == socketUC->sendMsg(query))
-                    {
-                        result.setBool(true);
-                        RETURN_SUCCESS(runState, result, successTrace);
-                    }
-                    else
-                    {
-                        RETURN_FAILURE(runState, result, failureTrace3);
-                    }
-                }
-                catch (const std::exception& e)
-                {
-                    RETURN_FAILURE(runState, result, failureTrace4 + e.what());
-                }
+                RETURN_FAILURE(runState, result, failureTrace3);
             }
+
+            result.setBool(true);
+            RETURN_SUCCESS(runState, result, successTrace);
         };
     };
 }
@@ -1,8 +1,10 @@
 #ifndef _OP_BUILDER_HELPER_UPGRADE_CONFIRMATION_H
 #define _OP_BUILDER_HELPER_UPGRADE_CONFIRMATION_H
 
+#include <metrics/iMetricsScope.hpp>
 #include <sockiface/isockFactory.hpp>
 
+#include "builders/opmap/sharedSender.hpp"
 #include "builders/types.hpp"
 
 namespace builder::builders::opmap
@@ -13,13 +15,17 @@ constexpr const char* WM_UPGRADE_SOCK {"/var/ossec/queue/tasks/upgrade"};
 /**
  * @brief Sends upgrade confirmation throug UPGRADE_MQ socket
  *
+ * The confirmations are only queued, all the ops share a sender that writes them in batches.
+ *
  * @param targetField target field of the helper
  * @param rawName name of the helper as present in the raw definition
  * @param rawParameters vector of parameters as present in the raw definition
  * @param definitions handler with definitions
+ * @param metricsScope scope of the sender metrics, may be null
  * @return base::Expression The ifter with the transformation.
  */
-MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockFactory>& sockFactory);
+MapBuilder getUpgradeConfirmationBUilder(const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+                                         const std::shared_ptr<metricsManager::IMetricsScope>& metricsScope = nullptr);
 
 } // namespace builder::builders::opmap
 
@@ -13,7 +13,8 @@ namespace builder::builders::opmap
 static inline MapOp opBuilderWdbGenericQuery(const std::vector<OpArg>& opArgs,
                                              const std::shared_ptr<const IBuildCtx> buildCtx,
                                              bool doReturnPayload,
-                                             const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager)
+                                             const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager,
+                                             bool async = false)
 {
     utils::assertSize(opArgs, 1);
 
@@ -47,12 +48,13 @@ static inline MapOp opBuilderWdbGenericQuery(const std::vector<OpArg>& opArgs,
         }
     }
 
-    // instantiate WDB
-    auto wdb = wdbManager->connection();
+    // Shared by all the ops and router threads, each query takes its own connection
+    auto wdb = wdbManager->pooledConnection();
 
     // Tracing
     const auto name = buildCtx->context().opName;
     const auto successTrace = fmt::format("{} -> Success", name);
+    const auto successAsyncTrace = fmt::format("{} -> Success: Query queued", name);
 
     const auto failureTrace = fmt::format("{} -> Failed to perform query: ", name);
     const auto failureTrace1 = [&]()
@@ -109,6 +111,15 @@ static inline MapOp opBuilderWdbGenericQuery(const std::vector<OpArg>& opArgs,
             completeQuery = std::static_pointer_cast<Value>(param)->value().getString().value();
         }
 
+        // Queue the query without waiting for the result
+        if (async)
+        {
+            wdb->tryQueryAsync(completeQuery);
+            json::Json result;
+            result.setBool(true);
+            RETURN_SUCCESS(runState, result, successAsyncTrace);
+        }
+
         // Execute complete query in DB
         auto returnTuple = wdb->tryQueryAndParseResult(completeQuery);
 
@@ -163,6 +174,15 @@ MapBuilder getWdbUpdateBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbM
     };
 }
 
+// <wdb_result>: +wdb_update/<quey>|$<quey>
+MapBuilder getWdbUpdateAsyncBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager)
+{
+    return [wdbManager](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx> buildCtx) -> MapOp
+    {
+        return opBuilderWdbGenericQuery(opArgs, buildCtx, false, wdbManager, true);
+    };
+}
+
 // <wdb_result>: +wdb_query/<quey>|$<quey>
 MapBuilder getWdbQueryBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager)
 {
@@ -172,4 +192,63 @@ MapBuilder getWdbQueryBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbMa
     };
 }
 
+// <agent_metadata>: +agent_info/$<agent_id>
+MapBuilder getAgentInfoBuilder(const std::shared_ptr<wazuhdb::IAgentCache>& agentCache)
+{
+    return [agentCache](const std::vector<OpArg>& opArgs, const std::shared_ptr<const IBuildCtx> buildCtx) -> MapOp
+    {
+        if (!agentCache)
+        {
+            throw std::runtime_error("The agent cache is disabled, it requires the agent events socket");
+        }
+
+        utils::assertSize(opArgs, 1);
+        utils::assertRef(opArgs, 0);
+
+        const auto& ref = *std::static_pointer_cast<Reference>(opArgs[0]);
+        if (buildCtx->validator().hasField(ref.dotPath()))
+        {
+            auto jType = buildCtx->validator().getJsonType(ref.dotPath());
+            if (jType != json::Json::Type::String)
+            {
+                throw std::runtime_error(
+                    fmt::format("Expected reference to 'string' parameter with the agent id but got reference '{}' "
+                                "of type '{}'",
+                                ref.dotPath(),
+                                json::Json::typeToStr(jType)));
+            }
+        }
+
+        // Tracing
+        const auto name = buildCtx->context().opName;
+        const auto successTrace = fmt::format("{} -> Success", name);
+        const auto failureTrace1 = fmt::format("{} -> Field reference '{}' not found", name, ref.dotPath());
+        const auto failureTrace2 = fmt::format("{} -> Field reference '{}' is not a string", name, ref.dotPath());
+        const auto failureTrace3 = fmt::format("{} -> Agent not found in the agent cache", name);
+
+        return [=, refPath = ref.jsonPath(), runState = buildCtx->runState()](base::ConstEvent event) -> MapResult
+        {
+            if (!event->exists(refPath))
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace1);
+            }
+
+            auto agentId = event->getString(refPath);
+            if (!agentId.has_value())
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace2);
+            }
+
+            auto agent = agentCache->get(agentId.value());
+            if (!agent)
+            {
+                RETURN_FAILURE(runState, json::Json {}, failureTrace3);
+            }
+
+            json::Json result {*agent};
+            RETURN_SUCCESS(runState, result, successTrace);
+        };
+    };
+}
+
 } // namespace builder::builders::opmap
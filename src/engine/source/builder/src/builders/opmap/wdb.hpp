@@ -1,6 +1,7 @@
 #ifndef _OP_BUILDER_WDB_SYNC_H
 #define _OP_BUILDER_WDB_SYNC_H
 
+#include <wdb/iagentCache.hpp>
 #include <wdb/iwdbManager.hpp>
 
 #include "builders/types.hpp"
@@ -18,6 +19,15 @@ namespace builder::builders::opmap
  */
 MapBuilder getWdbUpdateBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager);
 
+/**
+ * @brief Queues the query on WDB without waiting for it, returning true.
+ *
+ * The query is performed in background, its failures are only logged.
+ * @param wdbManager WDB manager
+ * @return MapBuilder builder of the helper
+ */
+MapBuilder getWdbUpdateAsyncBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager);
+
 /**
  * @brief Executes query on WDB returning the payload.
  * @param targetField target field of the helper
@@ -28,6 +38,16 @@ MapBuilder getWdbUpdateBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbM
  */
 MapBuilder getWdbQueryBuilder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager);
 
+/**
+ * @brief Maps the metadata of the agent from the agent cache, without querying wazuh-db.
+ *
+ * The parameter is a reference to the id of the agent, usually agent.id. The result is the row of the agent in the
+ * global database, it fails if the agent is not in the cache.
+ * @param agentCache Cache of the agents, null if it is disabled
+ * @return MapBuilder builder of the helper
+ */
+MapBuilder getAgentInfoBuilder(const std::shared_ptr<wazuhdb::IAgentCache>& agentCache);
+
 } // namespace builder::builders::opmap
 
 #endif // _OP_BUILDER_WDB_SYNC_H
@@ -2,6 +2,55 @@
 
 namespace builder::builders::optransform
 {
+namespace
+{
+/**
+ * @brief Elements of the target array, viewed in the event, and the elements appended by the helper.
+ */
+struct AppendTarget
+{
+    std::optional<json::ArrayView> current; ///< Elements already in the event, if the target exists
+    std::vector<json::Json> added;          ///< Elements to append
+    json::ValueSet seen;                    ///< Elements already in the event and the sources of the appended ones
+
+    std::size_t size() const { return (current ? current->size() : 0) + added.size(); }
+
+    /**
+     * @brief Check that the value is not in the array yet and remember it as appended.
+     *
+     * @param value The value to append, viewed in the event or in the helper, it must outlive the target.
+     * @return true if the value has to be appended, false if it is already in the array.
+     */
+    bool insertUnique(const json::JsonConstView& value)
+    {
+        if (seen.empty() && current)
+        {
+            for (const auto& item : current.value())
+            {
+                seen.insert(item);
+            }
+        }
+        return seen.insert(value);
+    }
+
+    /**
+     * @brief Type of the first element, if any.
+     */
+    std::optional<json::Json::Type> firstType() const
+    {
+        if (current && !current->empty())
+        {
+            return (*current)[0].type();
+        }
+        if (!added.empty())
+        {
+            return added.front().type();
+        }
+        return std::nullopt;
+    }
+};
+} // namespace
+
 TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
 {
     return [unique, atleastOne](const Reference& targetField,
@@ -26,9 +75,13 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
         }
 
         auto arrayValidator = base::getResponse<schemf::ValidationResult>(result).getValidator();
+        if (arrayValidator)
+        {
+            buildCtx->countRuntimeValidation();
+        }
 
         // Transform the vector of arguments into a vector of map ops
-        using AppendOp = std::function<base::OptError(std::vector<json::Json>&, json::Json::Type&, const base::Event&)>;
+        using AppendOp = std::function<base::OptError(AppendTarget&, json::Json::Type&, const base::Event&)>;
         std::vector<AppendOp> appendOps;
         appendOps.reserve(opArgs.size());
         for (auto i = 0; i < opArgs.size(); ++i)
@@ -52,7 +105,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                      targetFieldtype,
                      unique,
                      isInSchema,
-                     value = asValue->value()](std::vector<json::Json>& targetArray,
+                     value = asValue->value()](AppendTarget& targetArray,
                                                json::Json::Type& valueType,
                                                const base::Event& event) -> base::OptError
                     {
@@ -62,14 +115,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
-                                {
-                                    valueType = value.type();
-                                }
-                                else
-                                {
-                                    valueType = event->getArray(targetField).value()[0].type();
-                                }
+                                valueType = targetArray.firstType().value_or(value.type());
                             }
                             else
                             {
@@ -84,15 +130,12 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                                                             json::Json::typeToStr(value.type()))};
                         }
 
-                        if (unique)
+                        if (unique && !targetArray.insertUnique(json::JsonConstView {value}))
                         {
-                            if (std::find(targetArray.begin(), targetArray.end(), value) != targetArray.end())
-                            {
-                                return base::noError();
-                            }
+                            return base::noError();
                         }
 
-                        targetArray.emplace_back(value);
+                        targetArray.added.emplace_back(value);
                         return base::noError();
                     });
             }
@@ -110,11 +153,12 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                      unique,
                      atleastOne,
                      referencePath = std::static_pointer_cast<const Reference>(opArgs[i])->jsonPath()](
-                        std::vector<json::Json>& targetArray,
+                        AppendTarget& targetArray,
                         json::Json::Type& valueType,
                         const base::Event& event) -> base::OptError
                     {
-                        auto value = event->getJson(referencePath);
+                        // Viewed in place, copied only when appended
+                        auto value = event->getView(referencePath);
                         if (!value)
                         {
                             if (atleastOne)
@@ -130,14 +174,7 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                             {
                                 // If the target field is empty, take as type the type of the first element to be added,
                                 // otherwise take the type of the first element of the target field.
-                                if (!event->getArray(targetField).has_value())
-                                {
-                                    valueType = value.value().type();
-                                }
-                                else
-                                {
-                                    valueType = event->getArray(targetField).value()[0].type();
-                                }
+                                valueType = targetArray.firstType().value_or(value->type());
                             }
                             else
                             {
@@ -152,15 +189,12 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                                                             json::Json::typeToStr(value->type()))};
                         }
 
-                        if (unique)
+                        if (unique && !targetArray.insertUnique(value.value()))
                         {
-                            if (std::find(targetArray.begin(), targetArray.end(), value.value()) != targetArray.end())
-                            {
-                                return base::noError();
-                            }
+                            return base::noError();
                         }
 
-                        targetArray.emplace_back(value.value());
+                        targetArray.added.emplace_back(value->copy());
                         return base::noError();
                     });
             }
@@ -191,15 +225,10 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 RETURN_FAILURE(runState, event, failureNotArray);
             }
 
-            auto resp = event->getArray(targetField);
-            std::vector<json::Json> targetArray = resp.value_or(std::vector<json::Json>());
-            if (resp)
-            {
-                targetArray = std::vector<json::Json>(resp.value());
-            }
+            // The elements already in the event are viewed, only the appended ones are copied
+            AppendTarget targetArray {event->getArrayView(targetField), {}};
 
             auto valueType = json::Json::Type::Unknow;
-            auto initialSize = targetArray.size();
             for (auto i = 0; i < appendOps.size(); i++)
             {
                 auto res = appendOps[i](targetArray, valueType, event);
@@ -209,30 +238,44 @@ TransformBuilder getArrayAppendBuilder(bool unique, bool atleastOne)
                 }
             }
 
-            if (targetArray.size() == initialSize)
+            if (targetArray.added.empty())
             {
                 RETURN_FAILURE(runState, event, referencesNotFound);
             }
 
-            auto jArray = json::Json();
-            jArray.setArray();
-
-            for (const auto& item : targetArray)
-            {
-                jArray.appendJson(item);
-            }
-
-            // Validate the array
+            // Validate the array, the event is only modified if the resulting array is valid
             if (arrayValidator != nullptr)
             {
+                auto jArray = json::Json();
+                jArray.setArray();
+                if (targetArray.current)
+                {
+                    for (const auto& item : targetArray.current.value())
+                    {
+                        jArray.appendJson(item.copy());
+                    }
+                }
+                for (const auto& item : targetArray.added)
+                {
+                    jArray.appendJson(item);
+                }
+
                 auto res = arrayValidator(jArray);
                 if (base::isError(res))
                 {
                     RETURN_FAILURE(runState, event, failureTrace + base::getError(res).message);
                 }
+
+                event->set(targetField, jArray);
+                RETURN_SUCCESS(runState, event, successTrace);
             }
 
-            event->set(targetField, jArray);
+            // Invalidates the view of the current elements
+            targetArray.current.reset();
+            for (const auto& item : targetArray.added)
+            {
+                event->appendJson(item, targetField);
+            }
 
             RETURN_SUCCESS(runState, event, successTrace);
         };
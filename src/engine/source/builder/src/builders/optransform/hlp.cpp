@@ -149,7 +149,7 @@ TransformOp specificHLPBuilder(const Reference& targetField,
         auto error = hlp::parser::run(parser, sourceValue.value(), *event);
         if (error)
         {
-            RETURN_FAILURE(runState, event, failureTrace + error.value().message);
+            RETURN_FAILURE(runState, event, failureTrace + error.value().message());
         }
 
         RETURN_SUCCESS(runState, event, successTrace);
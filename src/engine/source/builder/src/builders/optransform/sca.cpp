@@ -1,6 +1,7 @@
 #include "builders/optransform/sca.hpp"
 
 #include <algorithm>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <string>
@@ -140,10 +141,8 @@ inline void csvStr2ArrayIfExist(const DecodeCxt& ctx, Name field)
     if (csv)
     {
         const auto scaArrayPath = ctx.destinationPath.at(field);
-        const auto cvaArray = base::utils::string::split(csv.value(), ',');
-
         ctx.event->setArray(scaArrayPath);
-        for (const auto& csvItem : cvaArray)
+        for (const auto csvItem : base::utils::string::splitView(csv.value(), ','))
         {
             ctx.event->appendString(csvItem, scaArrayPath);
         }
@@ -284,6 +283,224 @@ searchAndParse(const std::string& query, std::shared_ptr<wazuhdb::IWDBHandler> w
     return {retCode, retStr};
 };
 
+/****************************************************************************************
+                                 SCA State
+*****************************************************************************************/
+
+State::State(const StateOptions& options, std::shared_ptr<wazuhdb::IWDBManager> wdbManager)
+    : m_options(options)
+    , m_wdbManager(std::move(wdbManager))
+    , m_nextSweep(Clock::now() + options.batchInterval)
+{
+}
+
+State::~State()
+{
+    std::vector<std::string> pending;
+    for (auto& [agentID, agent] : m_agents)
+    {
+        std::move(agent.pending.begin(), agent.pending.end(), std::back_inserter(pending));
+    }
+
+    if (pending.empty() || !m_wdbManager)
+    {
+        return;
+    }
+
+    try
+    {
+        auto wdb = m_wdbManager->connection();
+        for (const auto& query : pending)
+        {
+            const auto [res, payload] = wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
+            if (wazuhdb::QueryResultCodes::OK != res)
+            {
+                LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring: '{}'.", query);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING(
+            "Engine SCA decoder builder: {} check updates could not be saved: {}.", pending.size(), e.what());
+    }
+}
+
+std::optional<std::tuple<SearchResult, std::string>> State::lookup(const std::string& agentID,
+                                                                    const std::string& query)
+{
+    if (m_options.cacheTtl.count() == 0)
+    {
+        return std::nullopt;
+    }
+
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentID);
+    if (agent == m_agents.end())
+    {
+        return std::nullopt;
+    }
+
+    auto cached = agent->second.lookups.find(query);
+    if (cached == agent->second.lookups.end())
+    {
+        return std::nullopt;
+    }
+
+    if (cached->second.expires <= Clock::now())
+    {
+        agent->second.lookups.erase(cached);
+        return std::nullopt;
+    }
+
+    return std::make_tuple(cached->second.result, cached->second.payload);
+}
+
+void State::store(const std::string& agentID, const std::string& query, SearchResult result, const std::string& payload)
+{
+    if (m_options.cacheTtl.count() == 0 || SearchResult::ERROR == result)
+    {
+        return;
+    }
+
+    std::lock_guard lock {m_mutex};
+    m_agents[agentID].lookups[query] = Lookup {result, payload, Clock::now() + m_options.cacheTtl};
+}
+
+void State::invalidate(const std::string& agentID)
+{
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentID);
+    if (agent != m_agents.end())
+    {
+        agent->second.lookups.clear();
+    }
+}
+
+bool State::queueUpdate(const std::string& agentID, int checkID, std::string&& query)
+{
+    std::lock_guard lock {m_mutex};
+    auto& agent = m_agents[agentID];
+    auto [index, inserted] = agent.pendingOf.try_emplace(checkID, agent.pending.size());
+    if (inserted)
+    {
+        if (agent.pending.empty())
+        {
+            agent.oldest = Clock::now();
+        }
+        agent.pending.emplace_back(std::move(query));
+    }
+    else
+    {
+        agent.pending[index->second] = std::move(query);
+    }
+
+    return agent.pending.size() >= m_options.batchSize;
+}
+
+std::vector<std::string> State::takePending(const std::string& agentID)
+{
+    std::vector<std::string> pending;
+
+    std::lock_guard lock {m_mutex};
+    auto agent = m_agents.find(agentID);
+    if (agent != m_agents.end())
+    {
+        pending.swap(agent->second.pending);
+        agent->second.pendingOf.clear();
+    }
+
+    return pending;
+}
+
+std::vector<std::string> State::takeDue()
+{
+    std::vector<std::string> due;
+    const auto now = Clock::now();
+
+    std::lock_guard lock {m_mutex};
+    if (now < m_nextSweep)
+    {
+        return due;
+    }
+    m_nextSweep = now + m_options.batchInterval;
+
+    for (auto agent = m_agents.begin(); agent != m_agents.end();)
+    {
+        auto& state = agent->second;
+        if (!state.pending.empty() && now - state.oldest >= m_options.batchInterval)
+        {
+            std::move(state.pending.begin(), state.pending.end(), std::back_inserter(due));
+            state.pending.clear();
+            state.pendingOf.clear();
+        }
+
+        for (auto cached = state.lookups.begin(); cached != state.lookups.end();)
+        {
+            cached = cached->second.expires <= now ? state.lookups.erase(cached) : std::next(cached);
+        }
+
+        agent = state.pending.empty() && state.lookups.empty() ? m_agents.erase(agent) : std::next(agent);
+    }
+
+    return due;
+}
+
+/**
+ * @brief Save the check updates taken from the state.
+ *
+ * @param ctx The decoder context, its connection performs the queries.
+ * @param queries The updates, of any agent.
+ */
+void saveUpdates(const DecodeCxt& ctx, const std::vector<std::string>& queries)
+{
+    for (const auto& query : queries)
+    {
+        const auto [res, payload] = ctx.wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
+        if (wazuhdb::QueryResultCodes::OK != res)
+        {
+            LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring: '{}'.", query);
+        }
+    }
+}
+
+/**
+ * @brief Save the coalesced check updates of the agent, before a query that reads or deletes its checks.
+ *
+ * @param ctx The decoder context, decode info status.
+ */
+void savePendingUpdates(const DecodeCxt& ctx)
+{
+    if (ctx.state && ctx.state->coalesces())
+    {
+        saveUpdates(ctx, ctx.state->takePending(ctx.agentID));
+    }
+}
+
+/**
+ * @brief Perform a lookup on the database, answered from the state if it is cached.
+ *
+ * @copydetails searchAndParse
+ */
+std::tuple<SearchResult, std::string> cachedSearch(const DecodeCxt& ctx, const std::string& query, bool parse = true)
+{
+    if (ctx.state)
+    {
+        if (auto cached = ctx.state->lookup(ctx.agentID, query))
+        {
+            return std::move(cached.value());
+        }
+    }
+
+    auto result = searchAndParse(query, ctx.wdb, parse);
+    if (ctx.state)
+    {
+        ctx.state->store(ctx.agentID, query, std::get<0>(result), std::get<1>(result));
+    }
+
+    return result;
+}
+
 /****************************************************************************************
                                  Check Event info (type 'check')
 *****************************************************************************************/
@@ -452,7 +669,7 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
 
     // Prepare and execute the policy monitoring
     const auto scaQuery = fmt::format("agent {} sca query {}", ctx.agentID, checkID);
-    const auto [resPreviosResult, previousResult] = searchAndParse(scaQuery, ctx.wdb);
+    const auto [resPreviosResult, previousResult] = cachedSearch(ctx, scaQuery);
 
     // Generate the new query to save or update the policy monitoring
     std::string saveQuery {};
@@ -483,11 +700,29 @@ std::optional<std::string> handleCheckEvent(const DecodeCxt& ctx)
                         ctx.agentID);
             return std::string("Error querying policy monitoring database for agent ") + ctx.agentID;
     }
-    // Save or update the policy monitoring
-    const auto [resSavePolicy, empty] = ctx.wdb->tryQueryAndParseResult(saveQuery, WDB_ATTEMPTS);
-    if (wazuhdb::QueryResultCodes::OK != resSavePolicy)
+    // Save or update the policy monitoring, the updates of the known checks may be coalesced
+    auto saved = true;
+    if (SearchResult::FOUND == resPreviosResult && ctx.state && ctx.state->coalesces())
     {
-        LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID);
+        if (ctx.state->queueUpdate(ctx.agentID, checkID, std::move(saveQuery)))
+        {
+            savePendingUpdates(ctx);
+        }
+    }
+    else
+    {
+        const auto [resSavePolicy, empty] = ctx.wdb->tryQueryAndParseResult(saveQuery, WDB_ATTEMPTS);
+        if (wazuhdb::QueryResultCodes::OK != resSavePolicy)
+        {
+            LOG_WARNING("Engine SCA decoder builder: Error saving policy monitoring for agent '{}'.", ctx.agentID);
+            saved = false;
+        }
+    }
+
+    // The next lookup of the check gets the result just saved
+    if (saved && ctx.state)
+    {
+        ctx.state->store(ctx.agentID, scaQuery, SearchResult::FOUND, result);
     }
 
     // If policies are new, then save the rules and compliance
@@ -664,6 +899,12 @@ void insertPolicyInfo(const DecodeCxt& ctx)
     {
         LOG_WARNING("Engine SCA decoder builder: Error saving policy info for agent '{}'.", ctx.agentID);
     }
+    else if (ctx.state)
+    {
+        const auto policyQuery = fmt::format(
+            "agent {} sca query_policy {}", ctx.agentID, ctx.getSrcStr(field::Name::POLICY_ID).value_or("NULL"));
+        ctx.state->store(ctx.agentID, policyQuery, SearchResult::FOUND, "");
+    }
     return;
 }
 
@@ -759,6 +1000,11 @@ bool deletePolicyAndCheck(const DecodeCxt& ctx, const std::string& policyId)
         return false;
     }
 
+    if (ctx.state)
+    {
+        ctx.state->invalidate(ctx.agentID);
+    }
+
     // "Deleting check for policy '%s', agent id '%s'"
     query = fmt::format("agent {} sca delete_check {}", ctx.agentID, policyId);
 
@@ -814,6 +1060,9 @@ std::optional<std::string> handleScanInfo(const DecodeCxt& ctx)
     const auto eventHash = ctx.getSrcStr(field::Name::HASH).value();
     const bool isFirstScan = ctx.existsSrc(field::Name::FIRST_SCAN);
 
+    // The hash of the scan is checked against the saved checks
+    savePendingUpdates(ctx);
+
     // Check de policy in the DB
     bool normalize = false;
     bool scanInfoUpdate = false;
@@ -826,7 +1075,7 @@ std::optional<std::string> handleScanInfo(const DecodeCxt& ctx)
         {
             scanInfoUpdate = true;
             // If query fails or hash is not found, storedHash is empty
-            const auto storedHash = base::utils::string::split(scanInfo, ' ').at(0);
+            const auto storedHash = base::utils::string::splitView(scanInfo, ' ').front();
             const bool diferentHash = (storedHash != eventHash);
             const bool newHash = (diferentHash && !isFirstScan);
 
@@ -866,7 +1115,7 @@ std::optional<std::string> handleScanInfo(const DecodeCxt& ctx)
     // "Find policies IDs for policy '%s', agent id '%s'"
     const auto policyQuery = fmt::format("agent {} sca query_policy {}", ctx.agentID, policyId);
 
-    const auto [resPolQuery, dummyPayload] = searchAndParse(policyQuery, ctx.wdb, false);
+    const auto [resPolQuery, dummyPayload] = cachedSearch(ctx, policyQuery, false);
 
     switch (resPolQuery)
     {
@@ -913,6 +1162,9 @@ std::optional<std::string> handlePoliciesInfo(const DecodeCxt& ctx)
     }
     else
     {
+        // The policies that are not scanned anymore are deleted with their checks
+        savePendingUpdates(ctx);
+
         // "Retrieving policies from database."
         const auto policiesIdQuery = fmt::format("agent {} sca query_policies ", ctx.agentID);
         const auto [resPoliciesIds, policiesDB] = searchAndParse(policiesIdQuery, ctx.wdb);
@@ -925,9 +1177,7 @@ std::optional<std::string> handlePoliciesInfo(const DecodeCxt& ctx)
         else
         {
             /* For each policy id, look if we have scanned it */
-            const auto& policiesList = base::utils::string::split(policiesDB, ',');
-
-            for (auto& pId : policiesList)
+            for (const auto pId : base::utils::string::splitView(policiesDB, ','))
             {
                 /* This policy is not being scanned anymore, delete it */
                 if (std::find_if(policiesEvent.begin(),
@@ -940,7 +1190,7 @@ std::optional<std::string> handlePoliciesInfo(const DecodeCxt& ctx)
                     == policiesEvent.end())
                 {
                     LOG_DEBUG("Engine SCA decoder builder: Policy id '{}' doesn't exist. Deleting it.", pId);
-                    deletePolicyAndCheck(ctx, pId);
+                    deletePolicyAndCheck(ctx, std::string(pId));
                 }
             }
         }
@@ -981,6 +1231,10 @@ void deletePolicyCheckDistinct(const DecodeCxt& ctx, const std::string& policyId
     const auto query = fmt::format("agent {} sca delete_check_distinct {}|{}", ctx.agentID, policyId, scanId);
 
     const auto [resultCode, payload] = ctx.wdb->tryQueryAndParseResult(query, WDB_ATTEMPTS);
+    if (ctx.state)
+    {
+        ctx.state->invalidate(ctx.agentID);
+    }
     if (wazuhdb::QueryResultCodes::OK != resultCode)
     {
         LOG_WARNING("Engine SCA decoder builder: Error deleting check distinct policy id '{}' of agent '{}'.",
@@ -1004,6 +1258,9 @@ std::optional<std::string> handleDumpEvent(const DecodeCxt& ctx)
         return checkError;
     }
 
+    // The checks of the other scans are deleted and the hash of the saved ones is checked
+    savePendingUpdates(ctx);
+
     // "Deleting check distinct policy id , agent id "
     // Continue always, if rare error log error
     deletePolicyCheckDistinct(ctx, policyId, scanId);
@@ -1051,9 +1308,13 @@ std::optional<std::string> handleDumpEvent(const DecodeCxt& ctx)
 // - Helper - //
 
 TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager,
-                                      const std::shared_ptr<sockiface::ISockFactory>& sockFactory)
+                                      const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+                                      const sca::StateOptions& stateOptions)
 {
-    return [wdbManager, sockFactory](const Reference& targetField,
+    // Shared by all the decoders built, of every policy and worker
+    auto state = stateOptions.enabled() ? std::make_shared<sca::State>(stateOptions, wdbManager) : nullptr;
+
+    return [wdbManager, sockFactory, state](const Reference& targetField,
                                      const std::vector<OpArg>& opArgs,
                                      const std::shared_ptr<const IBuildCtx>& buildCtx) -> TransformOp
     {
@@ -1103,7 +1364,13 @@ TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager
             if (event->exists(sourceSCApath) && event->exists(agentIdPath) && event->isString(agentIdPath))
             {
                 const auto agentId = event->getString(agentIdPath).value();
-                const auto cxt = sca::DecodeCxt {event, agentId, wdb, cfgarSock, fieldSrc, fieldDst};
+                const auto cxt = sca::DecodeCxt {event, agentId, wdb, cfgarSock, fieldSrc, fieldDst, state.get()};
+
+                // The coalesced updates that waited too long are saved by the next event, of any agent
+                if (state && state->coalesces())
+                {
+                    sca::saveUpdates(cxt, state->takeDue());
+                }
 
                 // TODO: Field type is mandatory and should be checked in the decoder
                 auto type = event->getString(sourceSCApath + "/type");
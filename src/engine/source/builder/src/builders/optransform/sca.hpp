@@ -1,6 +1,13 @@
 #ifndef _OP_BUILDER_SCA_DECODER_H
 #define _OP_BUILDER_SCA_DECODER_H
 
+#include <chrono>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 #include <sockiface/isockFactory.hpp>
 #include <wdb/iwdbManager.hpp>
 
@@ -90,6 +97,113 @@ enum class SearchResult
     FOUND       ///< Found.
 };
 
+/**
+ * @brief Options of the SCA state shared by the decoders, see State.
+ */
+struct StateOptions
+{
+    std::chrono::seconds cacheTtl {0};              ///< Time the lookups are cached, 0 to query wazuh-db each time
+    std::size_t batchSize {0};                      ///< Check updates of an agent coalesced, 0 to write them at once
+    std::chrono::milliseconds batchInterval {1000}; ///< Maximum time a coalesced check update waits
+
+    bool enabled() const { return cacheTtl.count() > 0 || batchSize > 0; }
+};
+
+/**
+ * @brief SCA state of the agents shared by the decoders, so a burst of SCA events does not wait for a wazuh-db round
+ * trip per lookup and per check update.
+ *
+ * The results of the check and policy lookups are cached per agent for a short time, and the decoder updates them as
+ * it writes. A dump requested after an integrity failure resends the checks of the scan just seen, so they are
+ * answered from the cache.
+ *
+ * The updates of the known checks are coalesced per agent, the last one of each check wins, and written once there
+ * are batchSize of them, once the oldest waited batchInterval, or before any other query of the agent that reads or
+ * deletes the checks (summary, policies and dump events). The writes are performed with the connection of the decoder
+ * that takes them.
+ *
+ * @note thread-safe, the decoders of all the workers share it.
+ */
+class State
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Lookup
+    {
+        SearchResult result;       ///< Result of the lookup
+        std::string payload;       ///< Payload of a found result
+        Clock::time_point expires; ///< End of the validity of the result
+    };
+
+    struct Agent
+    {
+        std::unordered_map<std::string, Lookup> lookups; ///< Cached lookups by query
+        std::vector<std::string> pending;                ///< Coalesced check updates, in order
+        std::unordered_map<int, std::size_t> pendingOf;  ///< Index in pending of the update of each check
+        Clock::time_point oldest;                        ///< Time the oldest pending update was queued
+    };
+
+    StateOptions m_options;
+    std::shared_ptr<wazuhdb::IWDBManager> m_wdbManager; ///< Opens the connection of the writes left at destruction
+    std::mutex m_mutex;                                 ///< Protects the agents
+    std::unordered_map<std::string, Agent> m_agents;    ///< State of each agent
+    Clock::time_point m_nextSweep;                      ///< Next search of due updates and expired lookups
+
+public:
+    /**
+     * @brief Construct a new State
+     *
+     * @param options Cache and coalescing options
+     * @param wdbManager Opens a connection to write the pending updates when the state is destroyed
+     */
+    State(const StateOptions& options, std::shared_ptr<wazuhdb::IWDBManager> wdbManager);
+
+    /**
+     * @brief Write the pending updates.
+     */
+    ~State();
+
+    /**
+     * @brief Get the cached result of a lookup of an agent.
+     *
+     * @return The result and payload, empty if it is not cached or expired.
+     */
+    std::optional<std::tuple<SearchResult, std::string>> lookup(const std::string& agentID, const std::string& query);
+
+    /**
+     * @brief Cache the result of a lookup of an agent, errors are not cached.
+     */
+    void store(const std::string& agentID, const std::string& query, SearchResult result, const std::string& payload);
+
+    /**
+     * @brief Drop the cached lookups of an agent, after its checks or policies are deleted.
+     */
+    void invalidate(const std::string& agentID);
+
+    /**
+     * @brief Coalesce the update of a check, replacing a pending update of the same check.
+     *
+     * @return true if the agent has batchSize pending updates and they must be written.
+     */
+    bool queueUpdate(const std::string& agentID, int checkID, std::string&& query);
+
+    /**
+     * @brief Take the pending updates of an agent.
+     */
+    std::vector<std::string> takePending(const std::string& agentID);
+
+    /**
+     * @brief Take the pending updates of the agents whose oldest one waited batchInterval.
+     *
+     * The agents are searched at most once per batchInterval, expired lookups are dropped meanwhile.
+     */
+    std::vector<std::string> takeDue();
+
+    bool coalesces() const { return m_options.batchSize > 0; }
+};
+
 /**
  * @brief Store all decoder information and context for processing the SCA Event.
  */
@@ -104,6 +218,8 @@ struct DecodeCxt
     const std::unordered_map<sca::field::Name, std::string>& sourcePath;
     /** @brief Mapping the field Name to path of the field in the /sca Event. */
     const std::unordered_map<sca::field::Name, std::string>& destinationPath;
+    /** @brief Cached lookups and coalesced updates shared by the decoders, nullptr to query wazuh-db each time. */
+    State* state {nullptr};
 
     /**
      * @brief Get int value of a field.
@@ -355,10 +471,12 @@ std::optional<std::string> handleDumpEvent(const DecodeCxt& ctx);
  * @param targetField target field of the helper
  * @param rawName name of the helper as present in the raw definition
  * @param rawParameters vector of parameters as present in the raw definition
+ * @param stateOptions Cache and coalescing of the wazuh-db queries, shared by all the decoders built
  * @return base::Expression true when executes without any problem, false otherwise.
  */
 TransformBuilder getBuilderSCAdecoder(const std::shared_ptr<wazuhdb::IWDBManager>& wdbManager,
-                                      const std::shared_ptr<sockiface::ISockFactory>& sockFactory);
+                                      const std::shared_ptr<sockiface::ISockFactory>& sockFactory,
+                                      const sca::StateOptions& stateOptions = {});
 
 } // namespace builder::builders::optransform
 
@@ -1,6 +1,12 @@
 #include "builders/optransform/windows.hpp"
 
-#include <regex>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 using namespace builder::builders;
 
@@ -13,19 +19,33 @@ namespace
  * '%{sid1} %{sid2} %{sid3} ... ' // TODO: Check the format
  *
  * Ths function will return a vector with the sids in the same order as the input
- * or return an empty vector if the input is not valid
+ * or return an empty vector if the input is not valid. The sids are views of the input.
  * @param listSrt String with the list of sids
- * @return std::vector<std::string>
+ * @return std::vector<std::string_view>
  */
-std::vector<std::string> parserListSID(const std::string& listStr)
+std::vector<std::string_view> parserListSID(std::string_view listStr)
 {
     const char DELIMITER = ' ';
-    const std::string HEADER = "%{";
-    const std::string TAIL = "}";
+    const std::string_view HEADER = "%{";
+    const std::string_view TAIL = "}";
     const size_t HEADER_SIZE = HEADER.size();
     const size_t TAIL_SIZE = TAIL.size();
 
-    std::vector<std::string> result = base::utils::string::split(listStr, DELIMITER); // TODO Check format
+    // Split as base::utils::string::split does, without copying the items
+    std::vector<std::string_view> result;
+    if (!listStr.empty() && listStr[0] == DELIMITER)
+    {
+        listStr.remove_prefix(1);
+    }
+    for (auto pos = listStr.find(DELIMITER); pos != std::string_view::npos; pos = listStr.find(DELIMITER))
+    {
+        result.emplace_back(listStr.substr(0, pos));
+        listStr.remove_prefix(pos + 1);
+    }
+    if (!listStr.empty())
+    {
+        result.emplace_back(listStr);
+    }
 
     for (auto& sid : result)
     {
@@ -39,6 +59,59 @@ std::vector<std::string> parserListSID(const std::string& listStr)
     return result;
 }
 
+/**
+ * @brief Descriptions of SIDs, loaded once when the helper is built and looked up by hash without copying the SIDs.
+ */
+class SidTable
+{
+private:
+    std::deque<std::string> m_storage;                                ///< Keys and descriptions, never moved
+    std::unordered_map<std::string_view, std::string_view> m_entries; ///< Description of each SID
+
+public:
+    void emplace(std::string sid, std::string description)
+    {
+        const std::string_view key = m_storage.emplace_back(std::move(sid));
+        m_entries.emplace(key, m_storage.emplace_back(std::move(description)));
+    }
+
+    bool empty() const { return m_entries.empty(); }
+
+    std::optional<std::string_view> find(std::string_view sid) const
+    {
+        auto it = m_entries.find(sid);
+        if (it == m_entries.end())
+        {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+};
+
+/**
+ * @brief Get the relative identifier of a domain SID, the last 5 digits or less at the end of the SID
+ *
+ * @param sid SID to get the relative identifier from
+ * @return std::string_view The digits, empty if the SID does not end with a digit
+ */
+std::string_view getRelativeId(std::string_view sid)
+{
+    constexpr size_t MAX_DIGITS = 5;
+
+    size_t digits = 0;
+    while (digits < MAX_DIGITS && digits < sid.size())
+    {
+        const auto c = sid[sid.size() - digits - 1];
+        if (c < '0' || c > '9')
+        {
+            break;
+        }
+        ++digits;
+    }
+
+    return sid.substr(sid.size() - digits);
+}
+
 } // namespace
 
 namespace builder::builders
@@ -88,7 +161,7 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
 
         // Get the lists
         auto parseDbJsonToMap = [&](const std::string& key,
-                                    const std::string& errorMsg) -> std::map<std::string, std::string>
+                                    const std::string& errorMsg) -> std::shared_ptr<const SidTable>
         {
             auto response = kvdbHandler->get(key);
             if (base::isError(response))
@@ -103,7 +176,7 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
                 throw std::runtime_error(fmt::format("Error parsing {} from DB: Expected object", errorMsg));
             }
 
-            std::map<std::string, std::string> resultMap;
+            auto resultMap = std::make_shared<SidTable>();
             for (auto& [key, value] : jsonObject.value())
             {
                 auto optValue = value.getString();
@@ -112,10 +185,10 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
                     throw std::runtime_error(
                         fmt::format("Error parsing {} from DB: Expected string for key '{}'", errorMsg, key));
                 }
-                resultMap.emplace(key, optValue.value());
+                resultMap->emplace(key, optValue.value());
             }
 
-            if (resultMap.empty())
+            if (resultMap->empty())
             {
                 throw std::runtime_error(fmt::format("Error parsing {} from DB: Empty object", errorMsg));
             }
@@ -136,7 +209,6 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
             fmt::format("{} -> Error parsing reference '{}' as sidList", name, sidListRef.dotPath());
         // const std::string failureItemNotString {
         //     fmt::format("[{}] -> Failure: Item in array {} is not a string", name, sidListRef)};
-        std::regex endRegex("\\d{1,5}$");
 
         // Return Op
         return [=,
@@ -160,28 +232,25 @@ TransformBuilder getWindowsSidListDescHelperBuilder(const std::shared_ptr<kvdbMa
             // Parse de sid list
             for (const auto& sid : sidList)
             {
-
-                auto asdIt = asdMap.find(sid);
+                auto asdDesc = asdMap->find(sid);
                 bool hasDesc = false;
                 // Check if is a account sid
-                if (asdIt != asdMap.end())
+                if (asdDesc)
                 {
-                    event->appendString(asdIt->second, targetField);
+                    event->appendString(asdDesc.value(), targetField);
                     hasDesc = true;
                 }
                 else if (base::utils::string::startsWith(sid, "S-1-5-21")) // If not found and check if is a domain
                 {
-                    // Che if sid end with a number between 1 and 5 digits
-                    std::smatch matches;
+                    // Check if sid end with a number between 1 and 5 digits
+                    auto relativeId = getRelativeId(sid);
 
-                    if (std::regex_search(sid, matches, endRegex)) // If the regex matches
+                    if (!relativeId.empty())
                     {
-                        // Extraxt string from the regex match
-                        auto match = matches[0].str();
-                        auto dssIt = dssMap.find(match);
-                        if (dssIt != dssMap.end())
+                        auto dssDesc = dssMap->find(relativeId);
+                        if (dssDesc)
                         {
-                            event->appendString(dssIt->second, targetField);
+                            event->appendString(dssDesc.value(), targetField);
                             hasDesc = true;
                         }
                     }
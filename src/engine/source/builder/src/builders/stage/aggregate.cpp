@@ -0,0 +1,297 @@
+#include "aggregate.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include <base/dotPath.hpp>
+
+#include "builders/argument.hpp"
+#include "builders/utils.hpp"
+#include "syntax.hpp"
+
+namespace builder::builders
+{
+
+namespace detail
+{
+namespace
+{
+constexpr int64_t RETENTION_WINDOWS {2}; ///< Windows a key is kept, the current one and its summary
+} // namespace
+
+std::shared_ptr<AggregateTable> AggregateTable::get(const std::string& id, int64_t window, std::size_t maxKeys)
+{
+    static std::mutex s_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<AggregateTable>> s_tables;
+
+    std::lock_guard lock {s_mutex};
+    auto table = s_tables[id].lock();
+    if (!table)
+    {
+        // Drop the tables whose stages are gone
+        for (auto it = s_tables.begin(); it != s_tables.end();)
+        {
+            it = it->second.expired() && it->first != id ? s_tables.erase(it) : std::next(it);
+        }
+
+        table = std::make_shared<AggregateTable>(window, maxKeys);
+        s_tables[id] = table;
+    }
+
+    return table;
+}
+
+AggregateTable::AggregateTable(int64_t window, std::size_t maxKeys)
+    : m_window(window)
+    , m_retention(window * RETENTION_WINDOWS)
+    , m_slotWidth(std::max<int64_t>(1, (m_retention + TARGET_SLOTS - 1) / TARGET_SLOTS))
+    , m_shardCapacity(std::max<std::size_t>(1, (maxKeys + SHARDS - 1) / SHARDS))
+{
+    if (0 >= window)
+    {
+        throw std::runtime_error("The aggregation window must be positive");
+    }
+    if (0 == maxKeys)
+    {
+        throw std::runtime_error("The maximum number of aggregation keys must be positive");
+    }
+
+    // The ticks between the last expired one and the expiration of a new window never share a slot
+    const auto slots = static_cast<std::size_t>((m_retention + m_slotWidth - 1) / m_slotWidth + 2);
+    for (auto& shard : m_shards)
+    {
+        shard.wheel.resize(slots);
+    }
+}
+
+void AggregateTable::expire(Shard& shard, int64_t now) const
+{
+    // Only the ticks that fully elapsed are expired
+    const auto lastTick = now / m_slotWidth - 1;
+    if (0 > shard.sweptTick)
+    {
+        shard.sweptTick = lastTick;
+        return;
+    }
+
+    const auto slots = static_cast<int64_t>(shard.wheel.size());
+    const auto firstTick = std::max(shard.sweptTick + 1, lastTick - slots + 1);
+    for (auto tick = firstTick; tick <= lastTick; ++tick)
+    {
+        auto& slot = shard.wheel[static_cast<std::size_t>(tick % slots)];
+        for (const auto keyHash : slot)
+        {
+            // The key may have been renewed, then it is also in a later slot
+            const auto it = shard.entries.find(keyHash);
+            if (shard.entries.end() != it && it->second.windowStart + m_retention <= now)
+            {
+                shard.entries.erase(it);
+            }
+        }
+        slot.clear();
+    }
+    shard.sweptTick = std::max(shard.sweptTick, lastTick);
+}
+
+std::optional<uint64_t> AggregateTable::hit(uint64_t keyHash, int64_t now)
+{
+    // The low bits pick the bucket of the shard map, the shard uses the high ones
+    auto& shard = m_shards[(keyHash >> 60) % SHARDS];
+    std::lock_guard lock {shard.mutex};
+    expire(shard, now);
+
+    auto it = shard.entries.find(keyHash);
+    if (shard.entries.end() != it && now < it->second.windowStart + m_window)
+    {
+        ++it->second.suppressed;
+        return std::nullopt;
+    }
+
+    uint64_t suppressed {0};
+    if (shard.entries.end() == it)
+    {
+        // The events of the keys that do not fit pass, they are never suppressed
+        if (shard.entries.size() >= m_shardCapacity)
+        {
+            return suppressed;
+        }
+        shard.entries.emplace(keyHash, Entry {now, 0});
+    }
+    else
+    {
+        suppressed = it->second.suppressed;
+        it->second = {now, 0};
+    }
+
+    const auto expirationTick = static_cast<std::size_t>((now + m_retention) / m_slotWidth);
+    shard.wheel[expirationTick % shard.wheel.size()].push_back(keyHash);
+    return suppressed;
+}
+
+std::size_t AggregateTable::size()
+{
+    std::size_t size {0};
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard lock {shard.mutex};
+        size += shard.entries.size();
+    }
+    return size;
+}
+} // namespace detail
+
+namespace
+{
+constexpr std::size_t DEFAULT_MAX_KEYS {10000}; ///< Keys of a table if the stage does not set them
+constexpr char KEY_SEPARATOR {'\x1f'};          ///< Separates the values of the fields in a key
+
+Reference getReference(const json::Json& value, std::string_view option, bool anchored)
+{
+    auto path = value.getString();
+    if (!path || path->empty() || (anchored && path->front() != syntax::field::REF_ANCHOR))
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects '{}' to be {} but got '{}'",
+                                             syntax::asset::AGGREGATE_KEY,
+                                             option,
+                                             anchored ? "field references" : "a field",
+                                             value.str()));
+    }
+    if (anchored)
+    {
+        path->erase(0, 1);
+    }
+
+    try
+    {
+        DotPath {path.value()};
+    }
+    catch (const std::exception& e)
+    {
+        throw std::runtime_error(
+            fmt::format("Stage '{}' got an invalid field '{}': {}", syntax::asset::AGGREGATE_KEY, *path, e.what()));
+    }
+    return Reference {path.value()};
+}
+
+std::size_t getPositive(const json::Json& value, std::string_view option)
+{
+    const auto number = value.getIntAsInt64();
+    if (!number || 0 >= number.value())
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects '{}' to be a positive integer but got '{}'",
+                                             syntax::asset::AGGREGATE_KEY,
+                                             option,
+                                             value.str()));
+    }
+    return static_cast<std::size_t>(number.value());
+}
+} // namespace
+
+base::Expression aggregateBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    if (!definition.isObject())
+    {
+        throw std::runtime_error(fmt::format(
+            "Stage '{}' expects an object but got '{}'", syntax::asset::AGGREGATE_KEY, definition.typeName()));
+    }
+
+    std::vector<Reference> fields;
+    std::optional<std::size_t> window;
+    std::size_t maxKeys {DEFAULT_MAX_KEYS};
+    std::optional<Reference> suppressedField;
+    for (const auto& [key, value] : definition.getObject().value())
+    {
+        if (key == syntax::asset::AGGREGATE_FIELDS_KEY)
+        {
+            const auto jFields = value.getArray();
+            if (!jFields || jFields->empty())
+            {
+                throw std::runtime_error(fmt::format("Stage '{}' expects '{}' to be a non-empty array",
+                                                     syntax::asset::AGGREGATE_KEY,
+                                                     syntax::asset::AGGREGATE_FIELDS_KEY));
+            }
+            for (const auto& jField : jFields.value())
+            {
+                fields.emplace_back(getReference(jField, key, true));
+            }
+        }
+        else if (key == syntax::asset::AGGREGATE_WINDOW_KEY)
+        {
+            window = getPositive(value, key);
+        }
+        else if (key == syntax::asset::AGGREGATE_MAX_KEYS_KEY)
+        {
+            maxKeys = getPositive(value, key);
+        }
+        else if (key == syntax::asset::AGGREGATE_SUPPRESSED_FIELD_KEY)
+        {
+            suppressedField = getReference(value, key, false);
+        }
+        else
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' got an unknown option '{}'", syntax::asset::AGGREGATE_KEY, key));
+        }
+    }
+
+    if (fields.empty() || !window)
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects the options '{}' and '{}'",
+                                             syntax::asset::AGGREGATE_KEY,
+                                             syntax::asset::AGGREGATE_FIELDS_KEY,
+                                             syntax::asset::AGGREGATE_WINDOW_KEY));
+    }
+
+    // The workers building the same asset share the windows, a new definition starts with empty ones
+    auto table = detail::AggregateTable::get(fmt::format("{}/{}", buildCtx->context().assetName, definition.str()),
+                                             static_cast<int64_t>(window.value()),
+                                             maxKeys);
+
+    std::string fieldNames;
+    for (const auto& field : fields)
+    {
+        fieldNames += (fieldNames.empty() ? "" : ", ") + field.str();
+    }
+    auto name = fmt::format("aggregate({})", fieldNames);
+    const auto successTrace = fmt::format("[{}] -> Success", name);
+    const auto failureTrace = fmt::format("[{}] -> Failure: Event suppressed in the window", name);
+
+    return base::Term<base::EngineOp>::create(
+        name,
+        [table, fields, suppressedField, successTrace, failureTrace, runState = buildCtx->runState()](
+            base::Event event) -> base::result::Result<base::Event>
+        {
+            // The key is built in a buffer of the thread, reused for all its events
+            thread_local std::string key;
+            key.clear();
+            for (const auto& field : fields)
+            {
+                if (auto value = event->str(field.jsonPointer()); value)
+                {
+                    key += value.value();
+                }
+                key += KEY_SEPARATOR;
+            }
+
+            const auto now = std::chrono::duration_cast<std::chrono::seconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count();
+            const auto suppressed = table->hit(std::hash<std::string_view> {}(key), now);
+            if (!suppressed)
+            {
+                RETURN_FAILURE(runState, event, failureTrace);
+            }
+
+            if (suppressedField)
+            {
+                event->setInt64(static_cast<int64_t>(suppressed.value()), suppressedField->jsonPointer());
+            }
+            RETURN_SUCCESS(runState, event, successTrace);
+        });
+}
+
+} // namespace builder::builders
@@ -0,0 +1,117 @@
+#ifndef _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
+#define _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "builders/types.hpp"
+
+namespace builder::builders
+{
+
+namespace detail
+{
+/**
+ * @brief Table of the aggregation windows of a stage, shared by all the workers building the same asset.
+ *
+ * The first event of a key opens a window and passes, the events of the key within the window are suppressed. The
+ * event that opens the next window gets the number of events suppressed in the previous one.
+ *
+ * Only the 64-bit hashes of the keys are stored, in shards with their own lock, and the number of keys is capped. The
+ * windows are expired by a time wheel per shard once they are two windows old, so the summary of a window is still
+ * available during the following one. The events whose key does not fit in the table pass.
+ */
+class AggregateTable
+{
+public:
+    static constexpr std::size_t SHARDS {16};   ///< Shards of the table, the key hash picks one
+    static constexpr int64_t TARGET_SLOTS {64}; ///< Slots of the time wheel the retention is split into
+
+private:
+    struct Entry
+    {
+        int64_t windowStart; ///< Second the window of the key was opened
+        uint64_t suppressed; ///< Events of the key suppressed in the window
+    };
+
+    struct Shard
+    {
+        std::mutex mutex;                            ///< Protects the shard
+        std::unordered_map<uint64_t, Entry> entries; ///< Windows by key hash
+        std::vector<std::vector<uint64_t>> wheel;    ///< Keys by the tick their window expires at
+        int64_t sweptTick {-1};                      ///< Last tick whose slot was expired
+    };
+
+    const int64_t m_window;             ///< Length of the windows, in seconds
+    const int64_t m_retention;          ///< Seconds a window is kept since it was opened
+    const int64_t m_slotWidth;          ///< Seconds per slot of the time wheel
+    const std::size_t m_shardCapacity;  ///< Maximum number of keys of each shard
+    std::array<Shard, SHARDS> m_shards; ///< Shards of the table
+
+    /**
+     * @brief Expire the windows of the slots whose ticks elapsed, the shard lock must be held.
+     */
+    void expire(Shard& shard, int64_t now) const;
+
+public:
+    /**
+     * @brief Get the table of a stage, creating it if there is none.
+     *
+     * @param id Identifier of the stage, its asset and definition.
+     * @param window Length of the windows, in seconds.
+     * @param maxKeys Maximum number of keys of the table.
+     * @return std::shared_ptr<AggregateTable> Table of the stage.
+     */
+    static std::shared_ptr<AggregateTable> get(const std::string& id, int64_t window, std::size_t maxKeys);
+
+    /**
+     * @brief Construct a new Aggregate Table, use get to share the table of the stage.
+     *
+     * @param window Length of the windows, in seconds.
+     * @param maxKeys Maximum number of keys of the table.
+     * @throw std::runtime_error if the window or the number of keys are not positive.
+     */
+    AggregateTable(int64_t window, std::size_t maxKeys);
+
+    AggregateTable(const AggregateTable&) = delete;
+    AggregateTable& operator=(const AggregateTable&) = delete;
+
+    /**
+     * @brief Account an event of a key.
+     *
+     * @param keyHash Hash of the key of the event.
+     * @param now Current time, in seconds.
+     * @return std::optional<uint64_t> Empty if the event is suppressed, otherwise the number of events suppressed in
+     * the previous window of the key.
+     */
+    std::optional<uint64_t> hit(uint64_t keyHash, int64_t now);
+
+    /**
+     * @brief Get the number of keys in the table.
+     */
+    std::size_t size();
+};
+} // namespace detail
+
+/**
+ * @brief Builds the aggregate stage, which suppresses the repeated events of a key within a time window.
+ *
+ * The definition is an object with the references of the fields that make the key, the window in seconds, and
+ * optionally the maximum number of keys and a field to set with the number of events suppressed:
+ * {"fields": ["$source.ip", "$rule.id"], "window": 60, "max_keys": 10000, "suppressed_field": "aggregate.suppressed"}
+ *
+ * @param definition Definition of the stage
+ * @param buildCtx Build context
+ * @return base::Expression
+ */
+base::Expression aggregateBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_STAGE_AGGREGATE_HPP
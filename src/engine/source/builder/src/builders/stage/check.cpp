@@ -8,6 +8,7 @@
 #include <logicexpr/logicexpr.hpp>
 
 #include "builders/baseHelper.hpp"
+#include "builders/fieldCache.hpp"
 #include "builders/helperParser.hpp"
 #include "syntax.hpp"
 
@@ -24,15 +25,32 @@ base::Expression checkListBuilder(const std::vector<json::Json>& list, const std
         throw std::runtime_error("Stage check cannot be empty");
     }
 
+    // The fields shared by the conditions are resolved once per event
+    auto fieldCache = std::make_shared<FieldCache>();
     std::vector<base::Expression> conditionExpressions;
-    std::transform(list.begin(),
-                   list.end(),
-                   std::back_inserter(conditionExpressions),
-                   [buildCtx](const auto& condition)
-                   {
-                       auto opExpr = baseHelperBuilder(condition, buildCtx, builders::HelperType::FILTER);
-                       return opExpr;
-                   });
+    {
+        FieldCache::BuildScope scope {*fieldCache};
+        std::transform(list.begin(),
+                       list.end(),
+                       std::back_inserter(conditionExpressions),
+                       [buildCtx](const auto& condition)
+                       {
+                           auto opExpr = baseHelperBuilder(condition, buildCtx, builders::HelperType::FILTER);
+                           return opExpr;
+                       });
+    }
+    fieldCache->seal();
+
+    if (!fieldCache->empty())
+    {
+        auto openTerm = base::Term<base::EngineOp>::create("stage.check.fields",
+                                                           [fieldCache](base::Event event)
+                                                           {
+                                                               fieldCache->open();
+                                                               return base::result::makeSuccess(std::move(event));
+                                                           });
+        conditionExpressions.insert(conditionExpressions.begin(), std::move(openTerm));
+    }
 
     auto expression = base::And::create("stage.check", conditionExpressions); // TODO name?
 
@@ -86,9 +104,12 @@ getTermBuilder(const std::shared_ptr<const IBuildCtx>& buildCtx)
 
 base::Expression checkExpressionBuilder(const std::string& logicExpr, const std::shared_ptr<const IBuildCtx>& buildCtx)
 {
+    // The fields shared by the terms are resolved once per event
+    auto fieldCache = std::make_shared<FieldCache>();
     std::function<bool(base::Event)> evaluator;
     try
     {
+        FieldCache::BuildScope scope {*fieldCache};
         // Apply definitions
         auto replacedExpr = buildCtx->definitions().replace(logicExpr);
         // TODO: make a factory and inject this dependency
@@ -99,6 +120,7 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
     {
         throw std::runtime_error(fmt::format("Stage 'check' failed to build expression '{}': {}", logicExpr, e.what()));
     }
+    fieldCache->seal();
 
     // Trace
     auto name = fmt::format("check: {}", logicExpr);
@@ -107,15 +129,20 @@ base::Expression checkExpressionBuilder(const std::string& logicExpr, const std:
 
     // Return expression
     return base::Term<base::EngineOp>::create("stage.check",
-                                              [=](base::Event event)
+                                              [=, runState = buildCtx->runState()](base::Event event)
                                               {
+                                                  if (!fieldCache->empty())
+                                                  {
+                                                      fieldCache->open();
+                                                  }
+
                                                   if (evaluator(event))
                                                   {
-                                                      return base::result::makeSuccess(event, successTrace);
+                                                      RETURN_SUCCESS(runState, event, successTrace);
                                                   }
                                                   else
                                                   {
-                                                      return base::result::makeFailure(event, failureTrace);
+                                                      RETURN_FAILURE(runState, event, failureTrace);
                                                   }
                                               });
 }
@@ -1,67 +1,261 @@
 #include "fileOutput.hpp"
 
+#include <cerrno>
+#include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
 
 #include "builders/utils.hpp"
 
 namespace builder::builders
 {
 
-base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+namespace detail
 {
-    if (!definition.isObject())
+namespace
+{
+constexpr std::size_t FLUSH_SIZE = 1 << 20;       ///< Buffered bytes that trigger a write
+constexpr std::size_t MAX_BUFFER_SIZE = 64 << 20; ///< Buffered bytes that make the producers wait
+} // namespace
+
+std::shared_ptr<FileWriter> FileWriter::get(const std::string& path, const FileOutputConfig& config)
+{
+    static std::mutex s_mutex;
+    static std::unordered_map<std::string, std::weak_ptr<FileWriter>> s_writers;
+
+    std::lock_guard lock {s_mutex};
+    auto writer = s_writers[path].lock();
+    if (!writer)
     {
-        throw std::runtime_error(fmt::format(
-            "Stage '{}' expects an object but got '{}'", syntax::asset::FILE_OUTPUT_KEY, definition.typeName()));
+        // Drop the writers whose outputs are gone
+        for (auto it = s_writers.begin(); it != s_writers.end();)
+        {
+            it = it->second.expired() && it->first != path ? s_writers.erase(it) : std::next(it);
+        }
+
+        writer = std::make_shared<FileWriter>(path, config);
+        s_writers[path] = writer;
     }
 
-    if (definition.size() != 1)
+    return writer;
+}
+
+FileWriter::FileWriter(const std::string& path, const FileOutputConfig& config)
+    : m_path(path)
+    , m_config(config)
+    , m_fd(-1)
+    , m_buffer()
+    , m_stop(false)
+    , m_writing()
+    , m_lastSync(std::chrono::steady_clock::now())
+{
+    open();
+    m_flusher = std::thread(&FileWriter::flusherLoop, this);
+}
+
+FileWriter::~FileWriter()
+{
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with one key but got '{}'",
-                                             syntax::asset::FILE_OUTPUT_KEY,
-                                             definition.size()));
+        std::lock_guard lock {m_mutex};
+        m_stop = true;
     }
+    m_cv.notify_one();
+    m_flusher.join();
 
-    auto outputObj = definition.getObject().value();
+    if (0 <= m_fd)
+    {
+        ::close(m_fd);
+    }
+}
 
-    const auto& [key, value] = *outputObj.begin();
-    if (key != syntax::asset::FILE_OUTPUT_PATH_KEY)
+void FileWriter::open()
+{
+    const auto fd = ::open(m_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0666);
+    if (0 > fd)
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' but got '{}'",
-                                             syntax::asset::FILE_OUTPUT_KEY,
-                                             syntax::asset::FILE_OUTPUT_PATH_KEY,
-                                             key));
+        throw std::invalid_argument(fmt::format("Could not open file {}", m_path));
     }
 
-    if (!value.isString())
+    if (0 <= m_fd)
     {
-        throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
-                                             syntax::asset::FILE_OUTPUT_KEY,
-                                             syntax::asset::FILE_OUTPUT_PATH_KEY,
-                                             value.typeName()));
+        ::close(m_fd);
     }
+    m_fd = fd;
+}
+
+void FileWriter::reopenIfRotated()
+{
+    struct stat current {};
+    struct stat opened {};
+    if (0 == ::stat(m_path.c_str(), &current) && 0 == ::fstat(m_fd, &opened) && current.st_ino == opened.st_ino
+        && current.st_dev == opened.st_dev)
+    {
+        return;
+    }
+
+    try
+    {
+        open();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Cannot reopen the output file '{}', writing to the previous one: {}", m_path, e.what());
+    }
+}
+
+void FileWriter::write(std::string_view line)
+{
+    std::unique_lock lock {m_mutex};
+    if (m_buffer.size() >= MAX_BUFFER_SIZE)
+    {
+        m_cv.notify_one();
+        m_drained.wait(lock, [this]() { return m_buffer.size() < MAX_BUFFER_SIZE; });
+    }
+
+    m_buffer.append(line);
+    m_buffer.push_back('\n');
+
+    if (m_buffer.size() >= FLUSH_SIZE)
+    {
+        m_cv.notify_one();
+    }
+}
+
+void FileWriter::flush()
+{
+    // The file lock is taken first, so the buffers are written in the order they are taken
+    std::lock_guard fileLock {m_fileMutex};
+    {
+        std::lock_guard lock {m_mutex};
+        if (m_buffer.empty())
+        {
+            return;
+        }
+        m_writing.swap(m_buffer);
+    }
+    m_drained.notify_all();
+
+    reopenIfRotated();
+
+    const char* data = m_writing.data();
+    auto pending = m_writing.size();
+    while (0 < pending)
+    {
+        const auto written = ::write(m_fd, data, pending);
+        if (0 > written)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            LOG_WARNING("Cannot write {} bytes to the output file '{}': {}", pending, m_path, std::strerror(errno));
+            break;
+        }
+        data += written;
+        pending -= static_cast<std::size_t>(written);
+    }
+    m_writing.clear();
+
+    if (0 < m_config.fsyncInterval.count())
+    {
+        const auto now = std::chrono::steady_clock::now();
+        if (now - m_lastSync >= m_config.fsyncInterval)
+        {
+            ::fdatasync(m_fd);
+            m_lastSync = now;
+        }
+    }
+}
+
+void FileWriter::flusherLoop()
+{
+    std::unique_lock lock {m_mutex};
+    while (!m_stop)
+    {
+        m_cv.wait_for(lock, m_config.flushInterval, [this]() { return m_stop || m_buffer.size() >= FLUSH_SIZE; });
+
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+
+    // Write the events queued until the last output was destroyed
+    lock.unlock();
+    flush();
+}
+} // namespace detail
+
+base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx)
+{
+    return getFileOutputBuilder(FileOutputConfig {})(definition, buildCtx);
+}
+
+StageBuilder getFileOutputBuilder(const FileOutputConfig& config)
+{
+    return [config](const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx) -> base::Expression
+    {
+        if (!definition.isObject())
+        {
+            throw std::runtime_error(fmt::format(
+                "Stage '{}' expects an object but got '{}'", syntax::asset::FILE_OUTPUT_KEY, definition.typeName()));
+        }
+
+        if (definition.size() != 1)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with one key but got '{}'",
+                                                 syntax::asset::FILE_OUTPUT_KEY,
+                                                 definition.size()));
+        }
+
+        auto outputObj = definition.getObject().value();
+
+        const auto& [key, value] = *outputObj.begin();
+        if (key != syntax::asset::FILE_OUTPUT_PATH_KEY)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' but got '{}'",
+                                                 syntax::asset::FILE_OUTPUT_KEY,
+                                                 syntax::asset::FILE_OUTPUT_PATH_KEY,
+                                                 key));
+        }
+
+        if (!value.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
+                            syntax::asset::FILE_OUTPUT_KEY,
+                            syntax::asset::FILE_OUTPUT_PATH_KEY,
+                            value.typeName()));
+        }
+
+        auto path = value.getString().value();
+        auto filePtr = std::make_shared<detail::FileOutput>(path, config);
+        auto name = fmt::format("write.output({})", path);
+        const auto successTrace = fmt::format("{} -> Success", name);
+        const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
 
-    auto path = value.getString().value();
-    auto filePtr = std::make_shared<detail::FileOutput>(path);
-    auto name = fmt::format("write.output({})", path);
-    const auto successTrace = fmt::format("{} -> Success", name);
-    const auto failureTrace = fmt::format("{} -> Could not write event to output", name);
-
-    return base::Term<base::EngineOp>::create(name,
-                                              [filePtr, successTrace, failureTrace, runState = buildCtx->runState()](
-                                                  base::Event event) -> base::result::Result<base::Event>
-                                              {
-                                                  try
-                                                  {
-                                                      filePtr->write(event);
-                                                      RETURN_SUCCESS(runState, event, successTrace);
-                                                  }
-                                                  catch (const std::exception& e)
-                                                  {
-                                                      RETURN_FAILURE(runState, event, failureTrace);
-                                                  }
-                                              });
+        return base::Term<base::EngineOp>::create(
+            name,
+            [filePtr, successTrace, failureTrace, runState = buildCtx->runState()](
+                base::Event event) -> base::result::Result<base::Event>
+            {
+                try
+                {
+                    filePtr->write(event);
+                    RETURN_SUCCESS(runState, event, successTrace);
+                }
+                catch (const std::exception& e)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace);
+                }
+            });
+    };
 }
 
 } // namespace builder::builders
@@ -1,10 +1,14 @@
 #ifndef _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 #define _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
 
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
-#include <fstream>
-#include <iostream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <thread>
 
 #include <fmt/format.h>
 
@@ -13,57 +17,163 @@
 namespace builder::builders
 {
 
+/**
+ * @brief Settings of the writers of the file outputs.
+ */
+struct FileOutputConfig
+{
+    std::chrono::milliseconds flushInterval {100}; ///< Maximum time an event waits to be written
+    std::chrono::milliseconds fsyncInterval {0};   ///< Minimum time between syncs of the file, 0 to never sync
+};
+
 namespace detail
 {
 /**
- * @brief implements a subscriber which will save all received events
- * of type E into a file. Needed to implement Destructor to close file.
+ * @brief Writer of a file, shared by all the outputs to the same path in the process.
+ *
+ * The events are appended to a buffer and written by a background thread with a single write per flush, once the
+ * buffer reaches the flush size or the flush interval expires. The producers wait if the buffer grows beyond the
+ * limit, when the disk cannot keep up.
  *
+ * The file is reopened if it is moved or removed, so it can be rotated by other processes.
+ */
+class FileWriter
+{
+private:
+    const std::string m_path;        ///< Path of the file
+    const FileOutputConfig m_config; ///< Flush and sync settings
+    int m_fd;                        ///< File descriptor of the file
+
+    std::mutex m_mutex;                ///< Protects the buffer
+    std::condition_variable m_cv;      ///< Wakes up the flusher thread
+    std::condition_variable m_drained; ///< Wakes up the producers waiting for space in the buffer
+    std::string m_buffer;              ///< Events waiting to be written
+    bool m_stop;                       ///< Request the flusher thread to stop
+
+    std::mutex m_fileMutex;                           ///< Serializes the writes, keeping the order of the events
+    std::string m_writing;                            ///< Events being written
+    std::chrono::steady_clock::time_point m_lastSync; ///< Last sync of the file
+    std::thread m_flusher;                            ///< Writes the buffer periodically
+
+    /**
+     * @brief Open the file, creating it if needed.
+     *
+     * @throw std::invalid_argument if the file cannot be opened.
+     */
+    void open();
+
+    /**
+     * @brief Reopen the file if it is not the one at the path anymore. The file lock must be held.
+     */
+    void reopenIfRotated();
+
+    /**
+     * @brief Write the buffer until the writer is destroyed.
+     */
+    void flusherLoop();
+
+public:
+    /**
+     * @brief Get the writer of a path, creating it if there is none.
+     *
+     * @param path Path of the file.
+     * @param config Settings of the writer, only used if it is created.
+     * @return std::shared_ptr<FileWriter> Writer of the path.
+     * @throw std::invalid_argument if the file cannot be opened.
+     */
+    static std::shared_ptr<FileWriter> get(const std::string& path, const FileOutputConfig& config);
+
+    /**
+     * @brief Construct a new File Writer, use get to share the writer of the path.
+     *
+     * @param path Path of the file.
+     * @param config Settings of the writer.
+     * @throw std::invalid_argument if the file cannot be opened.
+     */
+    FileWriter(const std::string& path, const FileOutputConfig& config);
+
+    /**
+     * @brief Write the pending events and close the file.
+     */
+    ~FileWriter();
+
+    FileWriter(const FileWriter&) = delete;
+    FileWriter& operator=(const FileWriter&) = delete;
+
+    /**
+     * @brief Queue a line to be written, the new line is appended.
+     *
+     * @param line Line to write.
+     */
+    void write(std::string_view line);
+
+    /**
+     * @brief Write the queued lines now, in the calling thread.
+     */
+    void flush();
+};
+
+/**
+ * @brief implements a subscriber which will save all received events
+ * of type E into a file, through the writer shared by all the outputs to the file.
  *
  */
 class FileOutput
 {
 protected:
-    std::ofstream m_os;
+    std::shared_ptr<FileWriter> m_writer;
 
 public:
     /**
      * @brief Construct a new File Output object
      *
      * @param path file to store the events received
+     * @param config settings of the writer, if the file has none yet
      */
-    explicit FileOutput(const std::string& path)
-        : m_os {path, std::ios::out | std::ios::app | std::ios::binary}
+    explicit FileOutput(const std::string& path, const FileOutputConfig& config = {})
+        : m_writer {FileWriter::get(path, config)}
     {
-        if (!this->m_os)
-        {
-            throw std::invalid_argument(fmt::format("Could not open file {}", path));
-        }
     }
 
     /**
-     * @brief Closes file if open
+     * @brief Queue the event string to be written to the file
      *
+     * @param e
      */
-    ~FileOutput()
+    void write(base::ConstEvent e)
     {
-        if (this->m_os.is_open())
-        {
-            this->m_os.close();
-        }
+        // Serialized into a buffer of the thread, reused for all its events
+        thread_local std::string line;
+        line.clear();
+        e->writeTo(line);
+        m_writer->write(line);
     }
 
     /**
-     * @brief Write event string to file
+     * @brief Write the queued events to the file now
      *
-     * @param e
      */
-    void write(base::ConstEvent e) { this->m_os << e->str() << std::endl; }
+    void flush() { m_writer->flush(); }
 };
 } // namespace detail
 
+/**
+ * @brief Builds the file output stage, with the default settings of the writers.
+ *
+ * @param definition Definition of the stage
+ * @param buildCtx Build context
+ * @return base::Expression
+ */
 base::Expression fileOutputBuilder(const json::Json& definition, const std::shared_ptr<const IBuildCtx>& buildCtx);
 
+/**
+ * @brief Get the builder of the file output stage.
+ *
+ * @param config Settings of the writers of the files
+ * @return StageBuilder
+ */
+StageBuilder getFileOutputBuilder(const FileOutputConfig& config);
+
 } // namespace builder::builders
 
 #endif // _BUILDER_BUILDERS_STAGE_FILEOUTPUT_HPP
@@ -0,0 +1,126 @@
+#include "indexerOutput.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "builders/utils.hpp"
+#include "syntax.hpp"
+
+namespace builder::builders
+{
+
+namespace
+{
+/**
+ * @brief Check the name of an index follows the rules of the wazuh-indexer.
+ *
+ * @param index Name of the index
+ * @throw std::runtime_error if the name is not valid
+ */
+void validateIndexName(std::string_view index)
+{
+    constexpr std::string_view INVALID_CHARS = "\\/*?\"<>| ,#:";
+    constexpr std::size_t MAX_INDEX_SIZE = 255;
+
+    if (index.empty() || index.size() > MAX_INDEX_SIZE)
+    {
+        throw std::runtime_error(fmt::format("Stage '{}' expects an index name of 1 to {} characters but got '{}'",
+                                             syntax::asset::INDEXER_OUTPUT_KEY,
+                                             MAX_INDEX_SIZE,
+                                             index));
+    }
+
+    if (index.front() == '-' || index.front() == '_' || index.front() == '+' || index == "." || index == "..")
+    {
+        throw std::runtime_error(fmt::format(
+            "Stage '{}' got an index name with an invalid start '{}'", syntax::asset::INDEXER_OUTPUT_KEY, index));
+    }
+
+    for (auto c : index)
+    {
+        if ((c >= 'A' && c <= 'Z') || INVALID_CHARS.find(c) != std::string_view::npos)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' got an index name with an invalid character '{}': '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 c,
+                                                 index));
+        }
+    }
+}
+} // namespace
+
+StageBuilder getIndexerOutputBuilder(const std::shared_ptr<indexerconnector::IIndexerConnector>& connector)
+{
+    return [connector](const json::Json& definition,
+                       const std::shared_ptr<const IBuildCtx>& buildCtx) -> base::Expression
+    {
+        if (!connector)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' is not available, the engine has no indexer connector",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY));
+        }
+
+        if (!definition.isObject())
+        {
+            throw std::runtime_error(fmt::format(
+                "Stage '{}' expects an object but got '{}'", syntax::asset::INDEXER_OUTPUT_KEY, definition.typeName()));
+        }
+
+        if (definition.size() != 1)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with one key but got '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 definition.size()));
+        }
+
+        auto outputObj = definition.getObject().value();
+
+        const auto& [key, value] = *outputObj.begin();
+        if (key != syntax::asset::INDEXER_OUTPUT_INDEX_KEY)
+        {
+            throw std::runtime_error(fmt::format("Stage '{}' expects an object with key '{}' but got '{}'",
+                                                 syntax::asset::INDEXER_OUTPUT_KEY,
+                                                 syntax::asset::INDEXER_OUTPUT_INDEX_KEY,
+                                                 key));
+        }
+
+        if (!value.isString())
+        {
+            throw std::runtime_error(
+                fmt::format("Stage '{}' expects an object with key '{}' to be a string but got '{}'",
+                            syntax::asset::INDEXER_OUTPUT_KEY,
+                            syntax::asset::INDEXER_OUTPUT_INDEX_KEY,
+                            value.typeName()));
+        }
+
+        auto index = value.getString().value();
+        validateIndexName(index);
+
+        auto name = fmt::format("write.indexer({})", index);
+        const auto successTrace = fmt::format("{} -> Success", name);
+        const auto failureTrace = fmt::format("{} -> Could not queue event to the indexer", name);
+
+        return base::Term<base::EngineOp>::create(
+            name,
+            [connector, index, successTrace, failureTrace, runState = buildCtx->runState()](
+                base::Event event) -> base::result::Result<base::Event>
+            {
+                try
+                {
+                    // Serialized into a buffer of the thread, reused for all its events
+                    thread_local std::string document;
+                    document.clear();
+                    event->writeTo(document);
+                    connector->index(index, document);
+                    RETURN_SUCCESS(runState, event, successTrace);
+                }
+                catch (const std::exception& e)
+                {
+                    RETURN_FAILURE(runState, event, failureTrace);
+                }
+            });
+    };
+}
+
+} // namespace builder::builders
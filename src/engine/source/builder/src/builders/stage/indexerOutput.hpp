@@ -0,0 +1,26 @@
+#ifndef _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
+#define _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
+
+#include <memory>
+
+#include <indexerconnector/iindexerconnector.hpp>
+
+#include "builders/types.hpp"
+
+namespace builder::builders
+{
+
+/**
+ * @brief Get the builder of the wazuh-indexer output stage.
+ *
+ * The stage queues every event in the connector, which sends them to the index in bulk requests. The builder fails if
+ * the engine has no connector.
+ *
+ * @param connector Connector to the wazuh-indexer, may be null
+ * @return StageBuilder
+ */
+StageBuilder getIndexerOutputBuilder(const std::shared_ptr<indexerconnector::IIndexerConnector>& connector);
+
+} // namespace builder::builders
+
+#endif // _BUILDER_BUILDERS_STAGE_INDEXEROUTPUT_HPP
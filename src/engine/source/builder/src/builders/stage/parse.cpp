@@ -72,7 +72,7 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             const std::string failureTrace1 =
                 fmt::format(R"([{}] -> Failure: Parameter "{}" reference not found)", name, field);
             // Parsing failed
-            const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed: ", name);
+            const std::string failureTrace2 = fmt::format("[{}] -> Failure: Parse operation failed", name);
             // Parsing ok, mapping failed
             const std::string failureTrace3 = fmt::format("[{}] -> Failure: field [{}] is not a string", name, field);
 
@@ -81,25 +81,33 @@ StageBuilder getParseBuilder(std::shared_ptr<hlp::logpar::Logpar> logpar, size_t
             {
                 parseExpression = base::Term<base::EngineOp>::create(
                     logparExpr,
-                    [=, parser = std::move(parser)](base::Event event)
+                    [=, runState = buildCtx->runState(), parser = std::move(parser)](base::Event event)
                     {
+                        // The traces are only copied while they are read
+                        const auto traced = runState->trace && base::result::tracing();
                         if (!event->exists(field))
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace1);
+                            return base::result::makeFailure(std::move(event), traced ? failureTrace1 : "");
                         }
                         if (!event->isString(field))
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace3);
+                            return base::result::makeFailure(std::move(event), traced ? failureTrace3 : "");
                         }
 
                         auto ev = event->getString(field).value();
                         auto error = hlp::parser::run(parser, ev, *event);
                         if (error)
                         {
-                            return base::result::makeFailure(std::move(event), failureTrace2 + error.value().message);
+                            // The failure message is only formatted when it is traced
+                            if (traced)
+                            {
+                                return base::result::makeFailure(std::move(event),
+                                                                 failureTrace2 + ": " + error.value().message());
+                            }
+                            return base::result::makeFailure(std::move(event));
                         }
 
-                        return base::result::makeSuccess(std::move(event), successTrace);
+                        return base::result::makeSuccess(std::move(event), traced ? successTrace : "");
                     });
             }
             catch (const std::exception& e)
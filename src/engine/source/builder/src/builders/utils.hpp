@@ -3,8 +3,9 @@
 
 #include "types.hpp"
 
+// The trace message is only formatted for the traced builds, while a subscriber reads it
 #define RETURN_FAILURE(runState, ret, traceMsg)                                                                        \
-    if ((runState)->trace)                                                                                             \
+    if ((runState)->trace && base::result::tracing())                                                                  \
     {                                                                                                                  \
         return base::result::makeFailure<decltype(ret)>(ret, traceMsg);                                                \
     }                                                                                                                  \
@@ -14,7 +15,7 @@
     }
 
 #define RETURN_SUCCESS(runState, ret, traceMsg)                                                                        \
-    if ((runState)->trace)                                                                                             \
+    if ((runState)->trace && base::result::tracing())                                                                  \
     {                                                                                                                  \
         return base::result::makeSuccess<decltype(ret)>(ret, traceMsg);                                                \
     }                                                                                                                  \
@@ -18,9 +18,13 @@ private:
     base::Name m_name;                 ///< Asset name
     base::Expression m_expression;     ///< Asset expression
     std::vector<base::Name> m_parents; ///< Asset parents
+    std::size_t m_runtimeValidations;  ///< Operations of the asset built with runtime schema validation
 
 public:
-    Asset() = default;
+    Asset()
+        : m_runtimeValidations(0)
+    {
+    }
 
     /**
      * @brief Construct a new Asset object
@@ -33,6 +37,7 @@ public:
         : m_name(std::move(name))
         , m_expression(std::move(expression))
         , m_parents(std::move(parents))
+        , m_runtimeValidations(0)
     {
     }
 
@@ -58,6 +63,14 @@ public:
     inline const std::vector<base::Name>& parents() const { return m_parents; }
     std::vector<base::Name>& parents() { return m_parents; }
 
+    /**
+     * @brief Get the number of operations of the asset that validate their result against the schema at runtime
+     *
+     * @return std::size_t
+     */
+    inline std::size_t runtimeValidations() const { return m_runtimeValidations; }
+    inline void setRuntimeValidations(std::size_t runtimeValidations) { m_runtimeValidations = runtimeValidations; }
+
     friend bool operator==(const Asset& lhs, const Asset& rhs)
     {
         return lhs.m_name == rhs.m_name && lhs.m_expression == rhs.m_expression && lhs.m_parents == rhs.m_parents;
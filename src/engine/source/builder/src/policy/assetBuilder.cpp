@@ -2,11 +2,36 @@
 
 #include <base/utils/stringUtils.hpp>
 #include <fmt/format.h>
+#include <metrics/assetStats.hpp>
 
 #include "syntax.hpp"
 
 namespace builder::policy
 {
+namespace
+{
+/**
+ * @brief Counts the operations of an expression, the cost of evaluating it when all of them run.
+ */
+uint64_t countTerms(const base::Expression& expression)
+{
+    if (expression->isTerm())
+    {
+        return 1;
+    }
+
+    uint64_t count = 0;
+    if (expression->isOperation())
+    {
+        for (const auto& operand : expression->getPtr<base::Operation>()->getOperands())
+        {
+            count += countTerms(operand);
+        }
+    }
+    return count;
+}
+} // namespace
+
 base::Name AssetBuilder::getName(const json::Json& value) const
 {
     auto resp = value.getString();
@@ -73,9 +98,13 @@ std::vector<base::Name> AssetBuilder::getParents(const json::Json& value) const
 }
 
 base::Expression AssetBuilder::buildExpression(const base::Name& name,
-                                               std::vector<std::tuple<std::string, json::Json>>& objDoc) const
+                                               std::vector<std::tuple<std::string, json::Json>>& objDoc,
+                                               std::size_t* runtimeValidations) const
 {
     auto newContext = std::make_shared<builders::BuildCtx>(*m_buildCtx);
+    // The assets may be built concurrently, each one counts its own runtime validations
+    newContext->resetRuntimeValidations();
+    newContext->context().assetName = name.fullName();
 
     // Get definitions (optional, may appear anywhere in the asset)
     auto definitionsPos = std::find_if(
@@ -111,6 +140,7 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
                     throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
                 }
                 auto builder = base::getResponse<builders::StageBuilder>(resp);
+                newContext->context().stageName = key;
                 auto check = builder(value, newContext);
                 conditionExpressions.emplace_back(std::move(check));
                 objDoc.erase(objDoc.begin());
@@ -166,6 +196,7 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
                     throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
                 }
                 auto builder = base::getResponse<builders::StageBuilder>(resp);
+                newContext->context().stageName = key;
                 auto parse = builder(stageParseValue, newContext);
                 conditionExpressions.emplace_back(std::move(parse));
                 objDoc.erase(objDoc.begin());
@@ -173,9 +204,31 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
         }
     }
 
+    // Hit-rate statistics of the condition, the evaluations are counted before any stage and the successes after all
+    auto stats = metricsManager::AssetStats::global()->counters(name.fullName());
+    uint64_t cost = 0;
+    for (const auto& expression : conditionExpressions)
+    {
+        cost += countTerms(expression);
+    }
+    stats->cost.store(cost, std::memory_order_relaxed);
+
+    conditionExpressions.insert(conditionExpressions.begin(),
+                                base::Term<base::EngineOp>::create("AssetEvaluated",
+                                                                   [stats](auto e)
+                                                                   {
+                                                                       stats->evaluations.add(1);
+                                                                       return base::result::makeSuccess(e, "");
+                                                                   }));
+
     // FIXME: The SUCCESS trace message is needed so test can parse if an asset succeeded or not
-    conditionExpressions.emplace_back(base::Term<base::EngineOp>::create(
-        "AcceptAll", [](auto e) { return base::result::makeSuccess(e, "SUCCESS"); }));
+    conditionExpressions.emplace_back(base::Term<base::EngineOp>::create("AcceptAll",
+                                                                         [stats](auto e)
+                                                                         {
+                                                                             stats->successes.add(1);
+                                                                             return base::result::makeSuccess(
+                                                                                 e, "SUCCESS");
+                                                                         }));
 
     condition = base::And::create(syntax::asset::CONDITION_NAME, std::move(conditionExpressions));
 
@@ -191,10 +244,16 @@ base::Expression AssetBuilder::buildExpression(const base::Name& name,
             throw std::runtime_error(fmt::format("Could not find builder for stage '{}'", key));
         }
         auto builder = base::getResponse<builders::StageBuilder>(resp);
+        newContext->context().stageName = key;
         auto consequence = builder(value, newContext);
         consequenceExpressions.emplace_back(std::move(consequence));
     }
 
+    if (runtimeValidations != nullptr)
+    {
+        *runtimeValidations = newContext->runtimeValidations();
+    }
+
     if (consequenceExpressions.empty())
     {
         return base::And::create(name, {std::move(condition)});
@@ -274,9 +333,12 @@ Asset AssetBuilder::operator()(const store::Doc& document) const
     }
 
     // Build the expression (rest of keys if any)
-    auto expression = buildExpression(name, objDoc);
+    std::size_t runtimeValidations = 0;
+    auto expression = buildExpression(name, objDoc, &runtimeValidations);
 
-    return Asset {std::move(name), std::move(expression), std::move(parents)};
+    Asset asset {std::move(name), std::move(expression), std::move(parents)};
+    asset.setRuntimeValidations(runtimeValidations);
+    return asset;
 }
 
 } // namespace builder::policy
@@ -63,13 +63,15 @@ public:
      *
      * @param name Name of the asset to be used in the expression.
      * @param objDoc Object containing the asset stages.
+     * @param runtimeValidations If not null, set to the number of operations built with runtime schema validation.
      *
      * @return base::Expression
      *
      * @throw std::runtime_error If any error occurs while building the stages.
      */
     base::Expression buildExpression(const base::Name& name,
-                                     std::vector<std::tuple<std::string, json::Json>>& objDoc) const;
+                                     std::vector<std::tuple<std::string, json::Json>>& objDoc,
+                                     std::size_t* runtimeValidations = nullptr) const;
 
     /**
      * @copydoc IAssetBuilder::operator()
@@ -0,0 +1,167 @@
+#ifndef _BUILDER_POLICY_ASSETCACHE_HPP
+#define _BUILDER_POLICY_ASSETCACHE_HPP
+
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "iassetBuilder.hpp"
+#include "syntax.hpp"
+
+namespace builder::policy
+{
+
+/**
+ * @brief Built assets of the policies by the content of their documents.
+ *
+ * The assets are built in isolation, the relations between them are only resolved when the policy graph is composed.
+ * An asset whose document did not change since it was built is reused, so a rebuild only compiles the changed assets
+ * and composes the graph again. The cache is shared by all the policies, an asset used by several policies (i.e. the
+ * routes and the tester sessions of the same integrations) is built once.
+ *
+ * @note This is thread-safe, the assets of a policy may be built in parallel.
+ */
+class AssetCache
+{
+private:
+    struct CachedAsset
+    {
+        std::size_t docHash;                     ///< Hash of the document the asset was built from
+        Asset asset;                             ///< Built asset, without the default parents
+        std::unordered_set<base::Name> policies; ///< Policies whose last build uses the asset
+    };
+
+    mutable std::mutex m_mutex;                           ///< Protects the cache
+    std::unordered_map<base::Name, CachedAsset> m_assets; ///< Built assets by name
+
+public:
+    /**
+     * @brief Get the asset built from a document, if it was not built from the same content it is built and cached.
+     *
+     * @param document Store document of the asset
+     * @param build Builder of the asset, called without holding the cache
+     * @param keep If false, an asset that is not cached is built but not added to the cache, i.e. when validating
+     * content that may not be stored
+     *
+     * @return Asset
+     *
+     * @throw std::runtime_error If the asset cannot be built, the cached asset is kept.
+     */
+    Asset get(const store::Doc& document, const IAssetBuilder& build, bool keep = true)
+    {
+        auto name = document.getString(json::Json::formatJsonPath(syntax::asset::NAME_KEY));
+        if (!name)
+        {
+            return build(document);
+        }
+
+        const auto docHash = std::hash<std::string> {}(document.str());
+        base::Name assetName;
+        try
+        {
+            assetName = base::Name(name.value());
+        }
+        catch (const std::exception&)
+        {
+            // The builder reports the invalid name
+            return build(document);
+        }
+
+        {
+            std::lock_guard lock {m_mutex};
+            auto it = m_assets.find(assetName);
+            if (it != m_assets.end() && it->second.docHash == docHash)
+            {
+                return it->second.asset;
+            }
+        }
+
+        auto asset = build(document);
+        if (!keep)
+        {
+            return asset;
+        }
+
+        std::lock_guard lock {m_mutex};
+        m_assets.insert_or_assign(assetName, CachedAsset {docHash, asset, {}});
+        return asset;
+    }
+
+    /**
+     * @brief Record the assets of the last build of a policy, the assets no longer used by any policy are dropped.
+     *
+     * @param policy Name of the policy
+     * @param assets Assets of the policy
+     */
+    void retain(const base::Name& policy, const std::unordered_set<base::Name>& assets)
+    {
+        std::lock_guard lock {m_mutex};
+        for (auto it = m_assets.begin(); it != m_assets.end();)
+        {
+            auto& policies = it->second.policies;
+            if (assets.find(it->first) != assets.end())
+            {
+                policies.insert(policy);
+            }
+            else
+            {
+                policies.erase(policy);
+            }
+            it = policies.empty() ? m_assets.erase(it) : std::next(it);
+        }
+    }
+
+    std::size_t size() const
+    {
+        std::lock_guard lock {m_mutex};
+        return m_assets.size();
+    }
+};
+
+/**
+ * @brief Asset builder that reuses the assets of a cache.
+ *
+ */
+class CachedAssetBuilder : public IAssetBuilder
+{
+private:
+    std::shared_ptr<IAssetBuilder> m_builder; ///< Builder of the assets not cached
+    std::shared_ptr<AssetCache> m_cache;      ///< Cache of the policy
+    bool m_keep;                              ///< Add the assets built to the cache
+
+public:
+    /**
+     * @brief Construct a new Cached Asset Builder object
+     *
+     * @param builder Builder of the assets not cached
+     * @param cache Cache of the assets
+     * @param keep If false, the cache is only read, the assets not cached are built but not added to it
+     */
+    CachedAssetBuilder(std::shared_ptr<IAssetBuilder> builder, std::shared_ptr<AssetCache> cache, bool keep = true)
+        : m_builder(std::move(builder))
+        , m_cache(std::move(cache))
+        , m_keep(keep)
+    {
+        if (!m_builder || !m_cache)
+        {
+            throw std::runtime_error("Cached asset builder needs a builder and a cache");
+        }
+    }
+
+    /**
+     * @copydoc IAssetBuilder::operator()
+     */
+    Asset operator()(const store::Doc& document) const override
+    {
+        return m_cache->get(document, *m_builder, m_keep);
+    }
+};
+
+} // namespace builder::policy
+
+#endif // _BUILDER_POLICY_ASSETCACHE_HPP
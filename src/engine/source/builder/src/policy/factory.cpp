@@ -1,10 +1,19 @@
 #include "policy/factory.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
 #include <numeric> // std::accumulate
+#include <optional>
 #include <stdexcept>
+#include <thread>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include <base/arenaAllocator.hpp>
 #include <store/utils.hpp>
 
 #include "asset.hpp"
@@ -316,50 +325,177 @@ PolicyData readData(const store::Doc& doc, const std::shared_ptr<store::IStoreRe
     return data;
 }
 
-BuiltAssets buildAssets(const PolicyData& data,
-                        const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder)
+namespace
 {
-    BuiltAssets builtAssets;
+/**
+ * @brief Asset of the policy to build, the assets are built independently, so they can be built in any order.
+ */
+struct BuildJob
+{
+    PolicyData::AssetType type;
+    const base::Name* name;
+    const base::Name* defaultParent; // nullptr if the namespace has no default parent
+    Asset asset;
+};
 
-    // Build assets for each type
+std::vector<BuildJob> buildJobs(const PolicyData& data)
+{
+    std::vector<BuildJob> jobs;
     for (const auto& [assetType, subgraphData] : data.subgraphs())
     {
         for (const auto& [assetNs, assetNames] : subgraphData.assets)
         {
+            auto defParentIt = subgraphData.defaultParents.find(assetNs);
+            const auto* defParent = defParentIt != subgraphData.defaultParents.end() ? &defParentIt->second : nullptr;
             for (const auto& assetName : assetNames)
             {
-                // Get document
-                auto resp = store::utils::get(store, assetName);
-                if (base::isError(resp))
+                jobs.push_back(BuildJob {assetType, &assetName, defParent, Asset {}});
+            }
+        }
+    }
+
+    return jobs;
+}
+
+void runJob(BuildJob& job, const std::shared_ptr<store::IStoreReader>& store, const IAssetBuilder& assetBuilder)
+{
+    // Get document
+    auto resp = store::utils::get(store, *job.name);
+    if (base::isError(resp))
+    {
+        throw std::runtime_error(fmt::format("Asset '{}' not found", *job.name));
+    }
+
+    Asset asset = assetBuilder(base::getResponse<store::Doc>(resp));
+
+    // Add parents
+    if (asset.parents().empty() && job.defaultParent != nullptr)
+    {
+        asset.parents().emplace_back(*job.defaultParent);
+    }
+
+    job.asset = std::move(asset);
+}
+
+/**
+ * @brief Run a job for each index, the calling thread runs them along with the pool, the first error stops the run
+ * and is rethrown.
+ */
+void runJobs(std::size_t count, std::size_t threads, const std::function<void(std::size_t)>& run)
+{
+    const auto workers = std::min(threads, count);
+    if (workers <= 1)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            run(i);
+        }
+        return;
+    }
+
+    std::atomic_size_t next {0};
+    std::atomic_bool failed {false};
+    std::mutex errorMutex;
+    std::exception_ptr error;
+
+    // The pool allocates from the arena of the calling thread
+    const auto subsystem = base::arena::current();
+    auto worker = [&]()
+    {
+        base::arena::ScopedSubsystem arena {subsystem};
+        for (auto i = next++; i < count && !failed; i = next++)
+        {
+            try
+            {
+                run(i);
+            }
+            catch (...)
+            {
+                std::lock_guard lock {errorMutex};
+                if (!error)
                 {
-                    throw std::runtime_error(fmt::format("Asset '{}' not found", assetName));
+                    error = std::current_exception();
                 }
+                failed = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (std::size_t i = 1; i < workers; ++i)
+    {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : pool)
+    {
+        thread.join();
+    }
 
-                Asset asset = (*assetBuilder)(base::getResponse<store::Doc>(resp));
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+} // namespace
 
-                // Add parents
-                if (asset.parents().empty())
+BuiltAssets buildAssets(const PolicyData& data,
+                        const std::shared_ptr<store::IStoreReader> store,
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        std::size_t threads)
+{
+    auto jobs = buildJobs(data);
+    runJobs(jobs.size(), threads, [&](std::size_t i) { runJob(jobs[i], store, *assetBuilder); });
+
+    // Add built assets to the subgraphs
+    BuiltAssets builtAssets;
+    for (auto& job : jobs)
+    {
+        builtAssets[job.type].emplace(*job.name, std::move(job.asset));
+    }
+
+    return builtAssets;
+}
+
+ValidatedAssets validateAssets(const PolicyData& data,
+                               const std::shared_ptr<store::IStoreReader> store,
+                               const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                               std::size_t threads)
+{
+    auto jobs = buildJobs(data);
+    std::vector<std::optional<std::string>> errors(jobs.size());
+    runJobs(jobs.size(),
+            threads,
+            [&](std::size_t i)
+            {
+                try
                 {
-                    auto defParentIt = subgraphData.defaultParents.find(assetNs);
-                    if (defParentIt != subgraphData.defaultParents.end())
-                    {
-                        asset.parents().emplace_back(defParentIt->second);
-                    }
+                    runJob(jobs[i], store, *assetBuilder);
                 }
-
-                // Add built asset to the subgraph
-                if (builtAssets.find(assetType) == builtAssets.end())
+                catch (const std::exception& e)
                 {
-                    builtAssets.emplace(assetType, std::unordered_map<base::Name, Asset> {});
+                    errors[i] = e.what();
                 }
+            });
 
-                builtAssets[assetType].emplace(assetName, asset);
-            }
+    ValidatedAssets validated;
+    for (std::size_t i = 0; i < jobs.size(); ++i)
+    {
+        if (errors[i])
+        {
+            validated.errors.push_back(AssetError {*jobs[i].name, std::move(errors[i].value())});
+        }
+        else
+        {
+            validated.assets[jobs[i].type].emplace(*jobs[i].name, std::move(jobs[i].asset));
         }
     }
 
-    return builtAssets;
+    std::sort(validated.errors.begin(),
+              validated.errors.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.name < rhs.name; });
+    return validated;
 }
 
 Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
@@ -467,7 +603,40 @@ PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data)
     return graph;
 }
 
-base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data)
+std::vector<base::Name> orderByHitRate(const std::vector<base::Name>& siblings,
+                                       const metricsManager::AssetStats& stats)
+{
+    std::vector<std::pair<base::Name, std::optional<double>>> ranked;
+    ranked.reserve(siblings.size());
+    for (const auto& sibling : siblings)
+    {
+        auto entry = stats.entry(sibling.fullName());
+        ranked.emplace_back(sibling, entry ? metricsManager::AssetStats::rank(entry.value()) : std::nullopt);
+    }
+
+    std::stable_sort(ranked.begin(),
+                     ranked.end(),
+                     [](const auto& lhs, const auto& rhs)
+                     {
+                         if (!lhs.second || !rhs.second)
+                         {
+                             return !lhs.second && rhs.second;
+                         }
+                         return lhs.second.value() > rhs.second.value();
+                     });
+
+    std::vector<base::Name> retValue;
+    retValue.reserve(ranked.size());
+    for (auto& [sibling, rank] : ranked)
+    {
+        retValue.emplace_back(std::move(sibling));
+    }
+    return retValue;
+}
+
+base::Expression buildExpression(const PolicyGraph& graph,
+                                 const PolicyData& data,
+                                 const std::shared_ptr<const metricsManager::AssetStats>& decoderStats)
 {
     // Expression of the policy, expression to be returned.
     // All subgraphs are added to this expression.
@@ -482,7 +651,9 @@ base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& dat
         // Child operator depends on the asset type
         switch (assetType)
         {
-            case PolicyData::AssetType::DECODER: subgraphExpr = buildSubgraphExpression<base::Or>(subgraph); break;
+            case PolicyData::AssetType::DECODER:
+                subgraphExpr = buildSubgraphExpression<base::Or>(subgraph, decoderStats.get());
+                break;
             case PolicyData::AssetType::RULE:
             case PolicyData::AssetType::OUTPUT:
                 subgraphExpr = buildSubgraphExpression<base::Broadcast>(subgraph);
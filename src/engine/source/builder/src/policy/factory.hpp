@@ -3,13 +3,16 @@
 
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include <base/expression.hpp>
 #include <base/graph.hpp>
+#include <metrics/assetStats.hpp>
 #include <store/istore.hpp>
 
 #include "iregistry.hpp"
@@ -241,9 +244,13 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
 /**
  * @brief Build the assets of the policy.
  *
+ * The assets are independent of each other, with more than one thread they are built in parallel and the first error
+ * stops the build. The store and the asset builder must be thread safe in that case.
+ *
  * @param data Policy data.
  * @param store The store interface to query assets and namespaces.
  * @param assetBuilder The asset builder instance to build each asset.
+ * @param threads Number of threads building the assets, including the calling one.
  *
  * @return BuiltAssets
  *
@@ -251,7 +258,49 @@ using BuiltAssets = std::unordered_map<PolicyData::AssetType, std::unordered_map
  */
 BuiltAssets buildAssets(const PolicyData& data,
                         const std::shared_ptr<store::IStoreReader> store,
-                        const std::shared_ptr<IAssetBuilder>& assetBuilder);
+                        const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                        std::size_t threads = 1);
+
+/**
+ * @brief Error building an asset of the policy.
+ */
+struct AssetError
+{
+    base::Name name;     ///< Name of the asset
+    std::string message; ///< Build error
+
+    friend bool operator==(const AssetError& lhs, const AssetError& rhs)
+    {
+        return lhs.name == rhs.name && lhs.message == rhs.message;
+    }
+};
+
+/**
+ * @brief Assets of the policy built for validation, along with the ones that failed.
+ */
+struct ValidatedAssets
+{
+    BuiltAssets assets;             ///< Assets built successfully
+    std::vector<AssetError> errors; ///< Assets that failed to build, sorted by name
+};
+
+/**
+ * @brief Build the assets of the policy to validate them, reporting every asset that fails.
+ *
+ * Unlike buildAssets, an error does not stop the build, so a single pass reports all the invalid assets. With more
+ * than one thread they are built in parallel, the store and the asset builder must be thread safe in that case.
+ *
+ * @param data Policy data.
+ * @param store The store interface to query assets and namespaces.
+ * @param assetBuilder The asset builder instance to build each asset.
+ * @param threads Number of threads building the assets, including the calling one.
+ *
+ * @return ValidatedAssets
+ */
+ValidatedAssets validateAssets(const PolicyData& data,
+                               const std::shared_ptr<store::IStoreReader> store,
+                               const std::shared_ptr<IAssetBuilder>& assetBuilder,
+                               std::size_t threads = 1);
 
 /**
  * @brief This struct contains the policy graphs by type.
@@ -303,18 +352,34 @@ Graph<base::Name, Asset> buildSubgraph(const std::string& subgraphName,
  */
 PolicyGraph buildGraph(const BuiltAssets& assets, const PolicyData& data);
 
+/**
+ * @brief Orders sibling assets by descending hit-rate rank (see metricsManager::AssetStats::rank).
+ *
+ * The assets without enough evaluations keep their order ahead of the ranked ones, so they are evaluated and ranked
+ * in the following builds. Ties keep their order.
+ *
+ * @param siblings Assets to order.
+ * @param stats Hit-rate statistics of the assets.
+ *
+ * @return std::vector<base::Name> The ordered assets.
+ */
+std::vector<base::Name> orderByHitRate(const std::vector<base::Name>& siblings,
+                                       const metricsManager::AssetStats& stats);
+
 /**
  * @brief Generates the expression of a subgraph.
  *
  * @tparam ChildOperator Expression type of the children nodes and the root node.
  * @param subgraph Subgraph to generate the expression from.
+ * @param stats Hit-rate statistics to order the siblings by, nullptr to keep the order of the graph.
  *
  * @return base::Expression
  *
  * @throw std::runtime_error If any error occurs.
  */
 template<typename ChildOperator>
-base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgraph)
+base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgraph,
+                                         const metricsManager::AssetStats* stats = nullptr)
 {
     // Assert T is a valid operation
     static_assert(std::is_base_of_v<base::Operation, ChildOperator>, "ChildOperator must be a valid operation");
@@ -348,7 +413,8 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
                 assetNode = base::Implication::create(asset.name() + "Node", asset.expression(), assetChildren);
 
                 // Visit children and add them to the children node
-                for (auto& child : subgraph.children(current))
+                const auto& children = subgraph.children(current);
+                for (auto& child : stats == nullptr ? children : orderByHitRate(children, *stats))
                 {
                     assetChildren->getOperands().push_back(visitRef(child, current, visitRef));
                 }
@@ -370,7 +436,8 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
     };
 
     // Visit root childs and add them to the root expression
-    for (auto& child : subgraph.children(subgraph.rootId()))
+    const auto& rootChildren = subgraph.children(subgraph.rootId());
+    for (auto& child : stats == nullptr ? rootChildren : orderByHitRate(rootChildren, *stats))
     {
         root->getOperands().push_back(visit(child, subgraph.rootId(), visit));
     }
@@ -381,14 +448,20 @@ base::Expression buildSubgraphExpression(const Graph<base::Name, Asset>& subgrap
 /**
  * @brief Generates the expression of the policy from the policy graph and the policy data.
  *
+ * The sibling decoders are alternatives, the first one that matches wins. Ordering them by hit rate evaluates less
+ * conditions per event, but changes which sibling wins when several of them match the same event.
+ *
  * @param graph Policy graph.
  * @param data Policy data.
+ * @param decoderStats Hit-rate statistics to order the sibling decoders by, nullptr to keep the order of the graph.
  *
  * @return base::Expression
  *
  * @throw std::runtime_error If any error occurs.
  */
-base::Expression buildExpression(const PolicyGraph& graph, const PolicyData& data);
+base::Expression buildExpression(const PolicyGraph& graph,
+                                 const PolicyData& data,
+                                 const std::shared_ptr<const metricsManager::AssetStats>& decoderStats = nullptr);
 
 } // namespace builder::policy::factory
 
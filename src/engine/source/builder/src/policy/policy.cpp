@@ -13,7 +13,10 @@ Policy::Policy(const store::Doc& doc,
                const std::shared_ptr<store::IStoreReader>& store,
                const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
                const std::shared_ptr<builders::RegistryType>& registry,
-               const std::shared_ptr<schemf::IValidator>& schema)
+               const std::shared_ptr<schemf::IValidator>& schema,
+               std::size_t buildThreads,
+               const std::shared_ptr<AssetCache>& cache,
+               const std::shared_ptr<const metricsManager::AssetStats>& decoderStats)
 {
     // Read the policy data
     auto policyData = factory::readData(doc, store);
@@ -32,8 +35,12 @@ Policy::Policy(const store::Doc& doc,
     buildCtx->context().policyName = m_name;
     buildCtx->runState().trace = true;
 
-    auto assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
-    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder);
+    std::shared_ptr<IAssetBuilder> assetBuilder = std::make_shared<AssetBuilder>(buildCtx, definitionsBuilder);
+    if (cache)
+    {
+        assetBuilder = std::make_shared<CachedAssetBuilder>(assetBuilder, cache);
+    }
+    auto builtAssets = factory::buildAssets(policyData, store, assetBuilder, buildThreads);
 
     // Assign the assets
     for (const auto& [type, assets] : builtAssets)
@@ -41,6 +48,7 @@ Policy::Policy(const store::Doc& doc,
         for (const auto& [name, asset] : assets)
         {
             m_assets.insert(name);
+            m_runtimeValidations += asset.runtimeValidations();
         }
     }
 
@@ -50,7 +58,13 @@ Policy::Policy(const store::Doc& doc,
     // TODO: Assign graphiv string
 
     // Build the expression
-    m_expression = factory::buildExpression(policyGraph, policyData);
+    m_expression = factory::buildExpression(policyGraph, policyData, decoderStats);
+
+    // Only the assets of this build are kept for the next one, unless other policies use them
+    if (cache)
+    {
+        cache->retain(m_name, m_assets);
+    }
 }
 
 } // namespace builder::policy
@@ -4,8 +4,10 @@
 #include <builder/ipolicy.hpp>
 
 #include <defs/idefinitions.hpp>
+#include <metrics/assetStats.hpp>
 #include <store/istore.hpp>
 
+#include "assetCache.hpp"
 #include "builders/ibuildCtx.hpp"
 
 namespace builder::policy
@@ -21,6 +23,7 @@ private:
     std::string m_hash;                      ///< Hash of the policy
     std::unordered_set<base::Name> m_assets; ///< Assets in the policy
     base::Expression m_expression;           ///< Expression of the policy
+    std::size_t m_runtimeValidations {0};    ///< Operations built with runtime schema validation
 
 public:
     Policy() = default;
@@ -34,12 +37,18 @@ public:
      * @param definitionsBuilder Definitions builder
      * @param registry Registry instance
      * @param schema Schema validator instance
+     * @param buildThreads Number of threads building the assets
+     * @param cache Assets of the previous build of the policy to reuse, nullptr to build all of them
+     * @param decoderStats Hit-rate statistics to order the sibling decoders by, nullptr to keep their order
      */
     Policy(const store::Doc& doc,
            const std::shared_ptr<store::IStoreReader>& store,
            const std::shared_ptr<defs::IDefinitionsBuilder>& definitionsBuilder,
            const std::shared_ptr<builders::RegistryType>& registry,
-           const std::shared_ptr<schemf::IValidator>& schema);
+           const std::shared_ptr<schemf::IValidator>& schema,
+           std::size_t buildThreads = 1,
+           const std::shared_ptr<AssetCache>& cache = nullptr,
+           const std::shared_ptr<const metricsManager::AssetStats>& decoderStats = nullptr);
 
     /**
      * @copydoc IPolicy::name
@@ -63,6 +72,11 @@ public:
      */
     inline const base::Expression& expression() const override { return m_expression; }
 
+    /**
+     * @copydoc IPolicy::runtimeValidations
+     */
+    inline std::size_t runtimeValidations() const override { return m_runtimeValidations; }
+
     /**
      * @copydoc IPolicy::getGraphivzStr
      */
@@ -28,8 +28,10 @@
 #include "builders/optransform/windows.hpp"
 
 // Stage builders
+#include "builders/stage/aggregate.hpp"
 #include "builders/stage/check.hpp"
 #include "builders/stage/fileOutput.hpp"
+#include "builders/stage/indexerOutput.hpp"
 #include "builders/stage/map.hpp"
 #include "builders/stage/normalize.hpp"
 #include "builders/stage/outputs.hpp"
@@ -87,6 +89,9 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         {schemf::JTypeToken::create(json::Json::Type::Number), builders::opfilter::opBuilderHelperIntNotEqual});
     registry->template add<builders::OpBuilderEntry>(
         "ip_cidr_match", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperIPCIDR});
+    registry->template add<builders::OpBuilderEntry>(
+        "ip_cidr_match_any",
+        {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperIPCIDRAny});
     registry->template add<builders::OpBuilderEntry>(
         "is_public_ip", {schemf::STypeToken::create(schemf::Type::IP), builders::opfilter::opBuilderHelperPublicIP});
     registry->template add<builders::OpBuilderEntry>(
@@ -146,6 +151,9 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "contains",
         {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::opBuilderHelperStringContains});
+    registry->template add<builders::OpBuilderEntry>(
+        "contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String), builders::opfilter::opBuilderHelperStringContainsAny});
     registry->template add<builders::OpBuilderEntry>(
         "match_value", {schemf::runtimeValidation(), builders::opfilter::opBuilderHelperMatchValue});
     registry->template add<builders::OpBuilderEntry>(
@@ -161,6 +169,9 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
         "int_calculate", {schemf::JTypeToken::create(json::Json::Type::Number), builders::opBuilderHelperIntCalc});
     registry->template add<builders::OpBuilderEntry>(
         "regex_extract", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperRegexExtract});
+    registry->template add<builders::OpBuilderEntry>(
+        "regex_extract_groups",
+        {schemf::JTypeToken::create(json::Json::Type::Object), builders::opBuilderHelperRegexExtractGroups});
     // Map helpers: Hash functions
     registry->template add<builders::OpBuilderEntry>(
         "sha1", {schemf::JTypeToken::create(json::Json::Type::String), builders::opBuilderHelperHashSHA1});
@@ -293,6 +304,14 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_not_match",
         {schemf::runtimeValidation(), builders::getOpBuilderKVDBNotMatch(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_ip_cidr_match",
+        {schemf::STypeToken::create(schemf::Type::IP),
+         builders::getOpBuilderKVDBIPCIDRMatch(deps.kvdbManager, deps.kvdbScopeName)});
+    registry->template add<builders::OpBuilderEntry>(
+        "kvdb_contains_any",
+        {schemf::JTypeToken::create(json::Json::Type::String),
+         builders::getOpBuilderKVDBContainsAny(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
         "kvdb_set", {schemf::runtimeValidation(), builders::getOpBuilderKVDBSet(deps.kvdbManager, deps.kvdbScopeName)});
     registry->template add<builders::OpBuilderEntry>(
@@ -304,8 +323,14 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
          builders::getOpBuilderHelperKVDBDecodeBitmask(deps.kvdbManager, deps.kvdbScopeName)});
 
     // Active Response builders
+    auto senderScope = [&deps](const std::string& name) -> std::shared_ptr<metricsManager::IMetricsScope>
+    {
+        return deps.metricsManager ? deps.metricsManager->getMetricsScope(name) : nullptr;
+    };
     registry->template add<builders::OpBuilderEntry>(
-        "active_response_send", {schemf::runtimeValidation(), builders::getOpBuilderSendAr(deps.sockFactory)});
+        "active_response_send",
+        {schemf::runtimeValidation(),
+         builders::getOpBuilderSendAr(deps.sockFactory, senderScope("ActiveResponseSender"))});
     // TODO: this builder is not used in the ruleset
     // registry->template add<builders::OpBuilderEntry>("active_response_create",
     //                                                  {schemf::runtimeValidation(), builders::CreateARBuilder});
@@ -314,18 +339,29 @@ void registerOpBuilders(const std::shared_ptr<Registry>& registry, const Builder
     registry->template add<builders::OpBuilderEntry>(
         "send_upgrade_confirmation",
         {schemf::JTypeToken::create(json::Json::Type::Boolean),
-         builders::opmap::getUpgradeConfirmationBUilder(deps.sockFactory)});
+         builders::opmap::getUpgradeConfirmationBUilder(deps.sockFactory, senderScope("UpgradeConfirmationSender"))});
 
     // WDB builders
     registry->template add<builders::OpBuilderEntry>(
-        "wdb_update", {schemf::runtimeValidation(), builders::opmap::getWdbUpdateBuilder(deps.wdbManager)});
+        "wdb_update",
+        {schemf::runtimeValidation(),
+         deps.wdbUpdateAsync ? builders::opmap::getWdbUpdateAsyncBuilder(deps.wdbManager)
+                             : builders::opmap::getWdbUpdateBuilder(deps.wdbManager)});
     registry->template add<builders::OpBuilderEntry>(
         "wdb_query", {schemf::runtimeValidation(), builders::opmap::getWdbQueryBuilder(deps.wdbManager)});
+    registry->template add<builders::OpBuilderEntry>(
+        "agent_info",
+        {schemf::STypeToken::create(schemf::Type::OBJECT), builders::opmap::getAgentInfoBuilder(deps.agentCache)});
 
     // SCA builders
+    builders::optransform::sca::StateOptions scaState;
+    scaState.cacheTtl = std::chrono::seconds(deps.scaCacheTtl);
+    scaState.batchSize = deps.scaBatchSize;
+    scaState.batchInterval = std::chrono::milliseconds(deps.scaBatchInterval);
     registry->template add<builders::OpBuilderEntry>(
         "sca_decoder",
-        {schemf::runtimeValidation(), builders::optransform::getBuilderSCAdecoder(deps.wdbManager, deps.sockFactory)});
+        {schemf::runtimeValidation(),
+         builders::optransform::getBuilderSCAdecoder(deps.wdbManager, deps.sockFactory, scaState)});
 
     // Windows builders
     // registry->template add<builders::OpBuilderEntry>(
@@ -345,12 +381,18 @@ template<typename Registry>
 void registerStageBuilders(const std::shared_ptr<Registry>& registry, const BuilderDeps& deps)
 {
     registry->template add<builders::StageBuilder>(syntax::asset::CHECK_KEY, builders::checkBuilder);
+    registry->template add<builders::StageBuilder>(syntax::asset::AGGREGATE_KEY, builders::aggregateBuilder);
     registry->template add<builders::StageBuilder>(syntax::asset::MAP_KEY, builders::mapBuilder);
     registry->template add<builders::StageBuilder>(syntax::asset::NORMALIZE_KEY, builders::normalizeBuilder);
     registry->template add<builders::StageBuilder>(syntax::asset::PARSE_KEY,
                                                    builders::getParseBuilder(deps.logpar, deps.logparDebugLvl));
     registry->template add<builders::StageBuilder>(syntax::asset::OUTPUTS_KEY, builders::outputsBuilder);
-    registry->template add<builders::StageBuilder>(syntax::asset::FILE_OUTPUT_KEY, builders::fileOutputBuilder);
+    registry->template add<builders::StageBuilder>(
+        syntax::asset::FILE_OUTPUT_KEY,
+        builders::getFileOutputBuilder({std::chrono::milliseconds(deps.outputFlushInterval),
+                                        std::chrono::milliseconds(deps.outputFsyncInterval)}));
+    registry->template add<builders::StageBuilder>(syntax::asset::INDEXER_OUTPUT_KEY,
+                                                   builders::getIndexerOutputBuilder(deps.indexerConnector));
 }
 
 } // namespace builder::detail
@@ -16,17 +16,25 @@ namespace builder::syntax
 // Asset syntax
 namespace asset
 {
-constexpr auto NAME_KEY = "name";               ///< Key for the name field in an asset.
-constexpr auto METADATA_KEY = "metadata";       ///< Key for the metadata field in an asset.
-constexpr auto PARENTS_KEY = "parents";         ///< Key for the parents field in an asset.
-constexpr auto CHECK_KEY = "check";             ///< Key for the check stage in an asset.
-constexpr auto PARSE_KEY = "parse";             ///< Key for the parse stage in an asset.
-constexpr auto NORMALIZE_KEY = "normalize";     ///< Key for the normalize stage in an asset.
-constexpr auto MAP_KEY = "map";                 ///< Key for the map stage in an asset.
-constexpr auto DEFINITIONS_KEY = "definitions"; ///< Key for the definitions stage in an asset.
-constexpr auto OUTPUTS_KEY = "outputs";         ///< Key for the outputs stage in an asset.
-constexpr auto FILE_OUTPUT_KEY = "file";        ///< Key for the file output stage in an asset.
-constexpr auto FILE_OUTPUT_PATH_KEY = "path";   ///< Key for the file output path in an asset.
+constexpr auto NAME_KEY = "name";                    ///< Key for the name field in an asset.
+constexpr auto METADATA_KEY = "metadata";            ///< Key for the metadata field in an asset.
+constexpr auto PARENTS_KEY = "parents";              ///< Key for the parents field in an asset.
+constexpr auto CHECK_KEY = "check";                  ///< Key for the check stage in an asset.
+constexpr auto PARSE_KEY = "parse";                  ///< Key for the parse stage in an asset.
+constexpr auto NORMALIZE_KEY = "normalize";          ///< Key for the normalize stage in an asset.
+constexpr auto MAP_KEY = "map";                      ///< Key for the map stage in an asset.
+constexpr auto DEFINITIONS_KEY = "definitions";      ///< Key for the definitions stage in an asset.
+constexpr auto OUTPUTS_KEY = "outputs";              ///< Key for the outputs stage in an asset.
+constexpr auto FILE_OUTPUT_KEY = "file";             ///< Key for the file output stage in an asset.
+constexpr auto FILE_OUTPUT_PATH_KEY = "path";        ///< Key for the file output path in an asset.
+constexpr auto INDEXER_OUTPUT_KEY = "wazuh-indexer"; ///< Key for the wazuh-indexer output stage in an asset.
+constexpr auto INDEXER_OUTPUT_INDEX_KEY = "index";   ///< Key for the wazuh-indexer output index in an asset.
+constexpr auto AGGREGATE_KEY = "aggregate";          ///< Key for the aggregate stage in an asset.
+constexpr auto AGGREGATE_FIELDS_KEY = "fields";      ///< Key for the fields of the aggregation key in an asset.
+constexpr auto AGGREGATE_WINDOW_KEY = "window";      ///< Key for the aggregation window, in seconds, in an asset.
+constexpr auto AGGREGATE_MAX_KEYS_KEY = "max_keys";  ///< Key for the maximum number of aggregation keys in an asset.
+constexpr auto AGGREGATE_SUPPRESSED_FIELD_KEY =
+    "suppressed_field"; ///< Key for the field set with the number of suppressed events in an asset.
 
 constexpr auto CONDITION_NAME =
     "condition"; ///< Name of the condition expression in the asset to be displayed in traces.
@@ -8,6 +8,11 @@ using namespace builder::test;
 
 namespace
 {
+/**
+ * @brief First term of the conditions, counts the evaluations of the asset
+ */
+const auto evalTerm = base::Term<base::EngineOp>::create("AssetEvaluated", {});
+
 /**
  * @brief User for build the params of the handler in a easy way
  *
@@ -116,15 +121,17 @@ TEST_P(BuildPolicy, Doc)
                     "decoder/parent-test/0/Node",
                     base::And::create("decoder/parent-test/0",
                                       {base::And::create("condition",
-                                                         {base::And::create("stage.check",
+                                                         {evalTerm,
+                                                          base::And::create("stage.check",
                                                                             {base::Term<base::EngineOp>::create(
                                                                                 "event.code: filter(2)", {})}),
                                                           base::Term<base::EngineOp>::create("AcceptAll", {})})}),
                     base::Or::create("decoder/parent-test/0/Children",
                                      {base::And::create("decoder/test/0",
                                                         {base::And::create("condition",
-                                                                           {base::Term<base::EngineOp>::create(
-                                                                               "AcceptAll", {})})})}))})});
+                                                                           {evalTerm,
+                                                                            base::Term<base::EngineOp>::create(
+                                                                                "AcceptAll", {})})})}))})});
         assertEqualExpr(expectedExpression, policyExpected->expression());
     }
     else
@@ -446,7 +453,7 @@ INSTANTIATE_TEST_SUITE_P(
                    })),
         BuildA(base::And::create("decoder/test/0",
                                  {base::And::create("condition",
-                                                    {base::Term<base::EngineOp>::create("AcceptAll", {})})}),
+                                                    {evalTerm, base::Term<base::EngineOp>::create("AcceptAll", {})})}),
                SUCCESS(
                    [](const std::shared_ptr<MockStore>& store,
                       const std::shared_ptr<MockDefinitionsBuilder>& defBuild,
@@ -459,7 +466,8 @@ INSTANTIATE_TEST_SUITE_P(
                    })),
         BuildA(base::And::create("filter/test/0",
                                  {base::And::create("condition",
-                                                    {base::And::create("stage.check",
+                                                    {evalTerm,
+                                                     base::And::create("stage.check",
                                                                        {base::Term<base::EngineOp>::create(
                                                                            "wazuh.queue: filter(49)", {})}),
                                                      base::Term<base::EngineOp>::create("AcceptAll", {})})}),
@@ -479,7 +487,8 @@ INSTANTIATE_TEST_SUITE_P(
                    "rule/test/0",
                    base::And::create(
                        "condition",
-                       {base::And::create("stage.check",
+                       {evalTerm,
+                        base::And::create("stage.check",
                                           {base::Term<base::EngineOp>::create("process.name: filter(\"test\")", {})}),
                         base::Term<base::EngineOp>::create("AcceptAll", {})}),
                    base::And::create(
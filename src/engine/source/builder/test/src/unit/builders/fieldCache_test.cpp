@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include "builders/fieldCache.hpp"
+
+using namespace builder::builders;
+
+TEST(FieldCacheTest, FieldOutsideBlockIsNotCached)
+{
+    auto field = FieldCache::field("/a");
+
+    json::Json first {R"({"a": "first"})"};
+    json::Json second {R"({"a": "second"})"};
+
+    ASSERT_TRUE(field.get(first).has_value());
+    EXPECT_EQ(field.get(first)->getStringView(), "first");
+    EXPECT_EQ(field.get(second)->getStringView(), "second");
+}
+
+TEST(FieldCacheTest, SharedFieldIsResolvedOncePerRun)
+{
+    FieldCache cache;
+    std::optional<FieldCache::Field> field;
+    std::optional<FieldCache::Field> other;
+    {
+        FieldCache::BuildScope scope {cache};
+        field = FieldCache::field("/a");
+        other = FieldCache::field("/a");
+    }
+    cache.seal();
+    ASSERT_FALSE(cache.empty());
+
+    json::Json first {R"({"a": "first"})"};
+    json::Json second {R"({"a": "second"})"};
+
+    cache.open();
+    EXPECT_EQ(field->get(first)->getStringView(), "first");
+    // The slot is read until the next run
+    EXPECT_EQ(other->get(second)->getStringView(), "first");
+
+    cache.open();
+    EXPECT_EQ(other->get(second)->getStringView(), "second");
+    EXPECT_EQ(field->get(second)->getStringView(), "second");
+}
+
+TEST(FieldCacheTest, MissingFieldIsCached)
+{
+    FieldCache cache;
+    std::optional<FieldCache::Field> field;
+    {
+        FieldCache::BuildScope scope {cache};
+        field = FieldCache::field("/a");
+        FieldCache::field("/a");
+    }
+    cache.seal();
+
+    json::Json event {R"({"b": 1})"};
+
+    cache.open();
+    EXPECT_FALSE(field->get(event).has_value());
+    EXPECT_FALSE(field->get(event).has_value());
+}
+
+TEST(FieldCacheTest, SingleUseFieldIsNotCached)
+{
+    FieldCache cache;
+    std::optional<FieldCache::Field> field;
+    {
+        FieldCache::BuildScope scope {cache};
+        field = FieldCache::field("/a");
+        FieldCache::field("/b");
+    }
+    cache.seal();
+    EXPECT_TRUE(cache.empty());
+
+    json::Json first {R"({"a": "first"})"};
+    json::Json second {R"({"a": "second"})"};
+
+    EXPECT_EQ(field->get(first)->getStringView(), "first");
+    EXPECT_EQ(field->get(second)->getStringView(), "second");
+}
+
+TEST(FieldCacheTest, ScopesAreRestored)
+{
+    FieldCache outer;
+    FieldCache inner;
+    {
+        FieldCache::BuildScope outerScope {outer};
+        FieldCache::field("/a");
+        {
+            FieldCache::BuildScope innerScope {inner};
+            FieldCache::field("/a");
+        }
+        FieldCache::field("/a");
+    }
+    outer.seal();
+    inner.seal();
+
+    EXPECT_FALSE(outer.empty());
+    EXPECT_TRUE(inner.empty());
+}
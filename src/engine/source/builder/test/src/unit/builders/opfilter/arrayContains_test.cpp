@@ -120,6 +120,35 @@ INSTANTIATE_TEST_SUITE_P(
                 "target",
                 {makeRef("ref"), makeRef("notRef"), makeValue(R"("value")"), makeValue(R"("value4")")},
                 SUCCESS()),
+        FilterT(R"({"target": ["value", "value"]})",
+                opfilter::opBuilderHelperContains,
+                "target",
+                {makeValue(R"("value")"), makeValue(R"("value")")},
+                SUCCESS()),
+        FilterT(R"({"target": [1, "2", 3.5]})",
+                opfilter::opBuilderHelperContains,
+                "target",
+                {makeValue(R"(1)"), makeValue(R"("2")"), makeValue(R"(3.5)")},
+                SUCCESS()),
+        FilterT(R"({"target": [1, "2", 3.5]})",
+                opfilter::opBuilderHelperContains,
+                "target",
+                {makeValue(R"("1")"), makeValue(R"("2")")},
+                FAILURE()),
+        FilterT(R"({"target": ["sshd", "cron", "nginx"]})",
+                opfilter::opBuilderHelperContainsAny,
+                "target",
+                {makeValue(R"("bash")"),
+                 makeValue(R"("sh")"),
+                 makeValue(R"("zsh")"),
+                 makeValue(R"("nc")"),
+                 makeValue(R"("nginx")")},
+                SUCCESS()),
+        FilterT(R"({"target": ["sshd", "cron", "nginx"]})",
+                opfilter::opBuilderHelperContainsAny,
+                "target",
+                {makeValue(R"("bash")"), makeValue(R"("sh")"), makeValue(R"("zsh")"), makeValue(R"("nc")")},
+                FAILURE()),
         /*** Array Not Contains ***/
         FilterT(R"({"target": ["value"]})",
                 opfilter::opBuilderHelperNotContains,
@@ -175,6 +204,21 @@ INSTANTIATE_TEST_SUITE_P(
                 opfilter::opBuilderHelperNotContains,
                 "target",
                 {makeRef("ref"), makeRef("notRef"), makeValue(R"("value")"), makeValue(R"("value4")")},
-                FAILURE())),
+                FAILURE()),
+        FilterT(R"({"target": ["value", "value2"]})",
+                opfilter::opBuilderHelperNotContainsAny,
+                "target",
+                {makeValue(R"("value")"), makeValue(R"("value2")"), makeValue(R"("value3")")},
+                SUCCESS()),
+        FilterT(R"({"target": ["value", "value2"]})",
+                opfilter::opBuilderHelperNotContainsAny,
+                "target",
+                {makeValue(R"("value")"), makeValue(R"("value2")")},
+                FAILURE()),
+        FilterT(R"({"target": [1, 2]})",
+                opfilter::opBuilderHelperNotContains,
+                "target",
+                {makeValue(R"("1")"), makeValue(R"(3)")},
+                SUCCESS())),
     testNameFormatter<FilterOperationTest>("ArrayContains"));
 } // namespace filteroperatestest
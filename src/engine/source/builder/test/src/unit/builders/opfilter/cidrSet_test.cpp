@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "builders/opfilter/cidrSet.hpp"
+
+using namespace builder::builders::opfilter;
+
+TEST(CidrSetTest, IPv4Networks)
+{
+    CidrSet set;
+    set.add("10.0.0.0/8");
+    set.add("192.168.1.0/24");
+
+    EXPECT_TRUE(set.contains("10.0.0.0").value());
+    EXPECT_TRUE(set.contains("10.255.255.255").value());
+    EXPECT_TRUE(set.contains("192.168.1.200").value());
+    EXPECT_FALSE(set.contains("192.168.2.1").value());
+    EXPECT_FALSE(set.contains("11.0.0.1").value());
+}
+
+TEST(CidrSetTest, IPv4DottedMask)
+{
+    CidrSet set;
+    set.add("172.16.0.0/255.240.0.0");
+
+    EXPECT_TRUE(set.contains("172.31.255.255").value());
+    EXPECT_FALSE(set.contains("172.32.0.0").value());
+}
+
+TEST(CidrSetTest, IPv6Networks)
+{
+    CidrSet set;
+    set.add("fd00::/8");
+    set.add("2001:db8::1");
+
+    EXPECT_TRUE(set.contains("fd12:3456::1").value());
+    EXPECT_TRUE(set.contains("2001:db8::1").value());
+    EXPECT_FALSE(set.contains("2001:db8::2").value());
+    EXPECT_FALSE(set.contains("fe80::1").value());
+}
+
+TEST(CidrSetTest, FamiliesAreIndependent)
+{
+    CidrSet set;
+    set.add("0.0.0.0/0");
+
+    EXPECT_TRUE(set.contains("8.8.8.8").value());
+    EXPECT_FALSE(set.contains("::1").value());
+}
+
+TEST(CidrSetTest, CoveredNetworks)
+{
+    CidrSet set;
+    set.add("10.1.2.0/24");
+    set.add("10.0.0.0/8");
+    set.add("10.1.0.0/16");
+
+    EXPECT_TRUE(set.contains("10.1.2.3").value());
+    EXPECT_TRUE(set.contains("10.200.0.1").value());
+    EXPECT_FALSE(set.contains("9.255.255.255").value());
+}
+
+TEST(CidrSetTest, HostBits)
+{
+    CidrSet set;
+    set.add("192.168.1.77/24");
+
+    EXPECT_TRUE(set.contains("192.168.1.1").value());
+}
+
+TEST(CidrSetTest, InvalidAddress)
+{
+    CidrSet set;
+    set.add("10.0.0.0/8");
+
+    EXPECT_FALSE(set.contains("not an ip").has_value());
+    EXPECT_FALSE(set.contains("10.0.0").has_value());
+    EXPECT_FALSE(set.contains("").has_value());
+    EXPECT_FALSE(set.contains(std::string(100, '1')).has_value());
+}
+
+TEST(CidrSetTest, InvalidNetwork)
+{
+    CidrSet set;
+
+    EXPECT_THROW(set.add("10.0.0.0/33"), std::runtime_error);
+    EXPECT_THROW(set.add("fd00::/129"), std::runtime_error);
+    EXPECT_THROW(set.add("10.0.0.0/"), std::runtime_error);
+    EXPECT_THROW(set.add("10.0.0.0/-1"), std::runtime_error);
+    EXPECT_THROW(set.add("10.0.0.0/255.0.255.0"), std::runtime_error);
+    EXPECT_THROW(set.add("fd00::/255.0.0.0"), std::runtime_error);
+    EXPECT_THROW(set.add("10.0.0/8"), std::runtime_error);
+    EXPECT_THROW(set.add(""), std::runtime_error);
+}
@@ -20,6 +20,22 @@ INSTANTIATE_TEST_SUITE_P(
                 SUCCESS())),
     testNameFormatter<FilterBuilderTest>("IPCIDR"));
 
+INSTANTIATE_TEST_SUITE_P(
+    BuilderIPCIDRAny,
+    FilterBuilderTest,
+    testing::Values(
+        FilterT({}, opfilter::opBuilderHelperIPCIDRAny, FAILURE()),
+        FilterT({makeValue(R"("10.0.0.0/8")")}, opfilter::opBuilderHelperIPCIDRAny, SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/8")"), makeValue(R"("fd00::/8")")},
+                opfilter::opBuilderHelperIPCIDRAny,
+                SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/255.0.0.0")")}, opfilter::opBuilderHelperIPCIDRAny, SUCCESS()),
+        FilterT({makeValue(R"("10.0.0.0/33")")}, opfilter::opBuilderHelperIPCIDRAny, FAILURE()),
+        FilterT({makeValue(R"("invalid")")}, opfilter::opBuilderHelperIPCIDRAny, FAILURE()),
+        FilterT({makeValue(R"(8)")}, opfilter::opBuilderHelperIPCIDRAny, FAILURE()),
+        FilterT({makeValue(R"("10.0.0.0/8")"), makeRef("ref")}, opfilter::opBuilderHelperIPCIDRAny, FAILURE())),
+    testNameFormatter<FilterBuilderTest>("IPCIDRAny"));
+
 INSTANTIATE_TEST_SUITE_P(
     BuilderPublicIP,
     FilterBuilderTest,
@@ -55,6 +71,46 @@ INSTANTIATE_TEST_SUITE_P(BuilderIPCIDR,
                                                  FAILURE())),
                          testNameFormatter<FilterOperationTest>("IPCIDR"));
 
+INSTANTIATE_TEST_SUITE_P(
+    BuilderIPCIDRAny,
+    FilterOperationTest,
+    testing::Values(FilterT(R"({"target": "172.20.1.1"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")"), makeValue(R"("172.16.0.0/12")")},
+                            SUCCESS()),
+                    FilterT(R"({"target": "192.168.1.1"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")"), makeValue(R"("172.16.0.0/12")")},
+                            FAILURE()),
+                    FilterT(R"({"target": "fd00::1"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")"), makeValue(R"("fd00::/8")")},
+                            SUCCESS()),
+                    FilterT(R"({"target": "fe80::1"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")"), makeValue(R"("fd00::/8")")},
+                            FAILURE()),
+                    FilterT(R"({"target": "10.0.0"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")")},
+                            FAILURE()),
+                    FilterT(R"({"target": 10})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "target",
+                            {makeValue(R"("10.0.0.0/8")")},
+                            FAILURE()),
+                    FilterT(R"({"target": "10.0.0.1"})",
+                            opfilter::opBuilderHelperIPCIDRAny,
+                            "notTarget",
+                            {makeValue(R"("10.0.0.0/8")")},
+                            FAILURE())),
+    testNameFormatter<FilterOperationTest>("IPCIDRAny"));
+
 INSTANTIATE_TEST_SUITE_P(
     BuilderPublicIP,
     FilterOperationTest,
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "builders/opfilter/regexSet.hpp"
+
+using namespace builder::builders::opfilter;
+
+TEST(RegexSetTest, MembersOfTheSameField)
+{
+    auto get = RegexSet::join("/regexset/same", "^GET ");
+    auto admin = RegexSet::join("/regexset/same", "admin");
+
+    EXPECT_TRUE(get->match("GET /admin"));
+    EXPECT_TRUE(admin->match("GET /admin"));
+    EXPECT_TRUE(get->match("GET /index"));
+    EXPECT_FALSE(admin->match("GET /index"));
+    EXPECT_FALSE(get->match("POST /index"));
+    EXPECT_FALSE(admin->match("POST /index"));
+}
+
+TEST(RegexSetTest, SinglePattern)
+{
+    auto regex = RegexSet::join("/regexset/single", "^a+b$");
+
+    EXPECT_TRUE(regex->match("aab"));
+    EXPECT_FALSE(regex->match("aabc"));
+}
+
+TEST(RegexSetTest, FieldsAreIndependent)
+{
+    auto first = RegexSet::join("/regexset/first", "value");
+    auto second = RegexSet::join("/regexset/second", "other");
+
+    EXPECT_TRUE(first->match("value"));
+    EXPECT_FALSE(second->match("value"));
+    EXPECT_TRUE(second->match("other"));
+    EXPECT_FALSE(first->match("other"));
+}
+
+TEST(RegexSetTest, JoinAndLeave)
+{
+    auto get = RegexSet::join("/regexset/change", "^GET ");
+    EXPECT_FALSE(get->match("POST /x"));
+    {
+        auto ending = RegexSet::join("/regexset/change", "x$");
+        EXPECT_TRUE(ending->match("POST /x"));
+        EXPECT_FALSE(get->match("POST /x"));
+    }
+    EXPECT_TRUE(get->match("GET /x"));
+    EXPECT_FALSE(get->match("POST /x"));
+}
+
+TEST(RegexSetTest, InvalidPattern)
+{
+    EXPECT_THROW(RegexSet::join("/regexset/invalid", "("), std::runtime_error);
+}
+
+TEST(RegexSetTest, ConcurrentMatches)
+{
+    auto get = RegexSet::join("/regexset/concurrent", "^GET ");
+    auto admin = RegexSet::join("/regexset/concurrent", "admin");
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                for (auto j = 0; j < 1000; ++j)
+                {
+                    const auto* value = j % 2 ? "GET /index" : "PUT /admin";
+                    EXPECT_EQ(get->match(value), j % 2 == 1);
+                    EXPECT_EQ(admin->match(value), j % 2 == 0);
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
@@ -214,6 +214,20 @@ INSTANTIATE_TEST_SUITE_P(
                 opfilter::opBuilderHelperStringContains,
                 FAILURE(typeRefExpected(schemf::Type::DOUBLE, json::Json::Type::Number, false)))),
     testNameFormatter<FilterBuilderTest>("StringCmp"));
+
+INSTANTIATE_TEST_SUITE_P(
+    BuildersAny,
+    FilterBuilderTest,
+    testing::Values(
+        FilterT({}, opfilter::opBuilderHelperStringContainsAny, FAILURE()),
+        FilterT({makeValue(R"("str")")}, opfilter::opBuilderHelperStringContainsAny, SUCCESS()),
+        FilterT({makeValue(R"("str")"), makeValue(R"("other")")},
+                opfilter::opBuilderHelperStringContainsAny,
+                SUCCESS()),
+        FilterT({makeValue(R"("str")"), makeValue(R"(1)")}, opfilter::opBuilderHelperStringContainsAny, FAILURE()),
+        FilterT({makeValue(R"(null)")}, opfilter::opBuilderHelperStringContainsAny, FAILURE()),
+        FilterT({makeValue(R"("str")"), makeRef("ref")}, opfilter::opBuilderHelperStringContainsAny, FAILURE())),
+    testNameFormatter<FilterBuilderTest>("StringContainsAny"));
 } // namespace filterbuildtest
 
 namespace filteroperatestest
@@ -836,4 +850,39 @@ INSTANTIATE_TEST_SUITE_P(
                 {makeRef("ref")},
                 FAILURE(customRefExpected()))),
     testNameFormatter<FilterOperationTest>("StringCmp"));
+
+INSTANTIATE_TEST_SUITE_P(
+    BuildersAny,
+    FilterOperationTest,
+    testing::Values(FilterT(R"({"target": "cmd /c whoami"})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "target",
+                            {makeValue(R"("whoami")"), makeValue(R"("net user")")},
+                            SUCCESS()),
+                    FilterT(R"({"target": "net user admin"})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "target",
+                            {makeValue(R"("whoami")"), makeValue(R"("net user")")},
+                            SUCCESS()),
+                    FilterT(R"({"target": "net use"})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "target",
+                            {makeValue(R"("whoami")"), makeValue(R"("net user")")},
+                            FAILURE()),
+                    FilterT(R"({"target": "str"})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "target",
+                            {makeValue(R"("")")},
+                            FAILURE()),
+                    FilterT(R"({"target": 1})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "target",
+                            {makeValue(R"("1")")},
+                            FAILURE()),
+                    FilterT(R"({"target": "str"})",
+                            opfilter::opBuilderHelperStringContainsAny,
+                            "notTarget",
+                            {makeValue(R"("str")")},
+                            FAILURE())),
+    testNameFormatter<FilterOperationTest>("StringContainsAny"));
 } // namespace filteroperatestest
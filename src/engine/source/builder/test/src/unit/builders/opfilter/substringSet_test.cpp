@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "builders/opfilter/substringSet.hpp"
+
+using namespace builder::builders::opfilter;
+
+TEST(SubstringSetTest, SingleSubstring)
+{
+    SubstringSet set({"mimikatz"});
+
+    EXPECT_TRUE(set.containsAny("mimikatz.exe"));
+    EXPECT_TRUE(set.containsAny("C:\\tools\\mimikatz"));
+    EXPECT_FALSE(set.containsAny("mimikat"));
+    EXPECT_FALSE(set.containsAny("MIMIKATZ"));
+    EXPECT_FALSE(set.containsAny(""));
+}
+
+TEST(SubstringSetTest, ManySubstrings)
+{
+    SubstringSet set({"-enc", "downloadstring", "iex(", "bypass"});
+
+    EXPECT_TRUE(set.containsAny("powershell -nop -enc SQBFAFgA"));
+    EXPECT_TRUE(set.containsAny("(new-object net.webclient).downloadstring('http://x')"));
+    EXPECT_TRUE(set.containsAny("-executionpolicy bypass"));
+    EXPECT_FALSE(set.containsAny("powershell -file script.ps1"));
+}
+
+TEST(SubstringSetTest, OverlappingSubstrings)
+{
+    SubstringSet set({"he", "she", "his", "hers"});
+
+    EXPECT_TRUE(set.containsAny("ushers"));
+    EXPECT_TRUE(set.containsAny("xhis"));
+    EXPECT_TRUE(set.containsAny("ahe"));
+    EXPECT_FALSE(set.containsAny("hi"));
+    EXPECT_FALSE(set.containsAny("sh"));
+}
+
+TEST(SubstringSetTest, SubstringFoundThroughFailureLink)
+{
+    SubstringSet set({"abcd", "bc"});
+
+    EXPECT_TRUE(set.containsAny("abce"));
+    EXPECT_FALSE(set.containsAny("abd"));
+}
+
+TEST(SubstringSetTest, RepeatedPrefix)
+{
+    SubstringSet set({"aab"});
+
+    EXPECT_TRUE(set.containsAny("aaab"));
+    EXPECT_FALSE(set.containsAny("abab"));
+}
+
+TEST(SubstringSetTest, EmptySubstringsAreIgnored)
+{
+    SubstringSet set({"", "x"});
+
+    EXPECT_FALSE(set.containsAny("abc"));
+    EXPECT_TRUE(set.containsAny("axc"));
+
+    SubstringSet empty({});
+    EXPECT_FALSE(empty.containsAny("abc"));
+}
+
+TEST(SubstringSetTest, BinaryBytes)
+{
+    SubstringSet set({std::string("\xff\x00", 2)});
+
+    EXPECT_TRUE(set.containsAny(std::string("a\xff\x00z", 4)));
+    EXPECT_FALSE(set.containsAny("a\xff"));
+}
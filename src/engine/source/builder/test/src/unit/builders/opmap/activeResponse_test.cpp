@@ -158,31 +158,44 @@ INSTANTIATE_TEST_SUITE_P(
         MapDepsT(R"({})",
                  getBuilderExpectSockHandler(
                      [](const std::shared_ptr<MockSockHandler>& handler)
-                     { EXPECT_CALL(*handler, sendMsg("query")).WillOnce(testing::Return(successSendMsgRes())); }),
+                     {
+                         EXPECT_CALL(*handler, sendMsgs(std::vector<std::string> {"query"}))
+                             .WillOnce(testing::Return(std::vector {successSendMsgRes()}));
+                     }),
                  {makeValue(R"("query")")},
                  SUCCESS(json::Json {R"(true)"})),
         MapDepsT(R"({"ref": "query"})",
                  getBuilderExpectSockHandler(
                      [](const std::shared_ptr<MockSockHandler>& handler)
-                     { EXPECT_CALL(*handler, sendMsg("query")).WillOnce(testing::Return(successSendMsgRes())); }),
+                     {
+                         EXPECT_CALL(*handler, sendMsgs(std::vector<std::string> {"query"}))
+                             .WillOnce(testing::Return(std::vector {successSendMsgRes()}));
+                     }),
                  {makeRef("ref")},
                  SUCCESS(json::Json {R"(true)"})),
         MapDepsT(R"({})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
         MapDepsT(R"({"ref": 1})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
         MapDepsT(R"({"ref": ""})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
         MapDepsT(R"({})", getBuilderExpectSockHandler(), {makeValue(R"("")")}, FAILURE()),
+        // The message is queued, the send errors are only logged by the sender
         MapDepsT(R"({})",
                  getBuilderExpectSockHandler(
-                     [](const std::shared_ptr<MockSockHandler>& handler) {
-                         EXPECT_CALL(*handler, sendMsg("query")).WillOnce(testing::Throw(std::runtime_error("error")));
+                     [](const std::shared_ptr<MockSockHandler>& handler)
+                     {
+                         EXPECT_CALL(*handler, sendMsgs(std::vector<std::string> {"query"}))
+                             .WillOnce(testing::Throw(std::runtime_error("error")));
+                         EXPECT_CALL(*handler, socketDisconnect());
                      }),
                  {makeValue(R"("query")")},
-                 FAILURE()),
+                 SUCCESS(json::Json {R"(true)"})),
         MapDepsT(R"({})",
                  getBuilderExpectSockHandler(
                      [](const std::shared_ptr<MockSockHandler>& handler)
-                     { EXPECT_CALL(*handler, sendMsg("query")).WillOnce(testing::Return(socketErrorSendMsgRes())); }),
+                     {
+                         EXPECT_CALL(*handler, sendMsgs(std::vector<std::string> {"query"}))
+                             .WillOnce(testing::Return(std::vector {socketErrorSendMsgRes()}));
+                     }),
                  {makeValue(R"("query")")},
-                 FAILURE())),
+                 SUCCESS(json::Json {R"(true)"}))),
     testNameFormatter<MapOperationWithDepsTest>("ActiveResponse"));
 } // namespace mapoperatestest
@@ -243,6 +243,41 @@ auto expectKvdbDeleteError(const std::string& key)
     };
 }
 
+template<typename FBuilder>
+filterbuildtest::BuilderGetter getFilterBuilder(FBuilder&& builder)
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        return builder(kvdbMock, SCOPE);
+    };
+}
+
+template<typename FBuilder, typename Behaviour>
+filterbuildtest::BuilderGetter
+getFilterBuilderExpectHandler(FBuilder&& builder, const std::string& name, Behaviour&& behaviour)
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        auto kvdbHandlerMock = std::make_shared<MockKVDBHandler>();
+        EXPECT_CALL(*kvdbMock, getKVDBHandler(name, SCOPE)).WillOnce(testing::Return(kvdbHandlerMock));
+        behaviour(kvdbHandlerMock);
+        return builder(kvdbMock, SCOPE);
+    };
+}
+
+template<typename FBuilder>
+filterbuildtest::BuilderGetter getFilterBuilderExpectHandlerError(FBuilder&& builder, const std::string& name)
+{
+    return [=]()
+    {
+        auto kvdbMock = std::make_shared<MockKVDBManager>();
+        EXPECT_CALL(*kvdbMock, getKVDBHandler(name, SCOPE)).WillOnce(testing::Return(base::Error {"error"}));
+        return builder(kvdbMock, SCOPE);
+    };
+}
+
 } // namespace
 
 namespace filterbuildtest
@@ -275,6 +310,58 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                              FilterDepsT({makeValue(R"({})")}, getNotMatch(), FAILURE()),
                              FilterDepsT({makeValue(R"("name")")}, getNotMatchExpectHandlerError("name"), FAILURE())),
                          testNameFormatter<FilterBuilderWithDepsTest>("KVDB"));
+
+INSTANTIATE_TEST_SUITE_P(
+    ListBuilders,
+    FilterBuilderWithDepsTest,
+    testing::Values(
+        /*** IP CIDR MATCH ***/
+        FilterDepsT({}, getFilterBuilder(getOpBuilderKVDBIPCIDRMatch), FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")")}, getFilterBuilder(getOpBuilderKVDBIPCIDRMatch), FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                    getFilterBuilder(getOpBuilderKVDBIPCIDRMatch),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBIPCIDRMatch,
+                                                  "dbname",
+                                                  expectKvdbGetValue("key", R"(["10.0.0.0/8", "fd00::/8"])")),
+                    SUCCESS()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBIPCIDRMatch, "dbname", expectKvdbGetValue("key", R"("10.0.0.0/8")")),
+                    SUCCESS()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBIPCIDRMatch, "dbname", expectKvdbGetValue("key", R"(["10.0.0.0/33"])")),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBIPCIDRMatch, "dbname", expectKvdbGetValue("key", R"(["10.0.0.0/8", 1])")),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBIPCIDRMatch, "dbname", expectKvdbGetError("key")),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandlerError(getOpBuilderKVDBIPCIDRMatch, "dbname"),
+                    FAILURE()),
+        /*** CONTAINS ANY ***/
+        FilterDepsT({}, getFilterBuilder(getOpBuilderKVDBContainsAny), FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")")}, getFilterBuilder(getOpBuilderKVDBContainsAny), FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeRef("ref")},
+                    getFilterBuilder(getOpBuilderKVDBContainsAny),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetValue("key", R"(["-enc", "bypass"])")),
+                    SUCCESS()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetValue("key", R"({"a": "b"})")),
+                    FAILURE()),
+        FilterDepsT({makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetError("key")),
+                    FAILURE())),
+    testNameFormatter<FilterBuilderWithDepsTest>("KVDBList"));
 } // namespace filterbuildtest
 
 namespace filteroperatestest
@@ -330,6 +417,59 @@ INSTANTIATE_TEST_SUITE_P(
                     {makeValue(R"("dbname")")},
                     FAILURE())),
     testNameFormatter<FilterOperationWithDepsTest>("KVDB"));
+
+INSTANTIATE_TEST_SUITE_P(
+    ListBuilders,
+    FilterOperationWithDepsTest,
+    testing::Values(
+        /*** IP CIDR MATCH ***/
+        FilterDepsT(R"({"target": "10.1.2.3"})",
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBIPCIDRMatch,
+                                                  "dbname",
+                                                  expectKvdbGetValue("key", R"(["10.0.0.0/8", "fd00::/8"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "fd00::1"})",
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBIPCIDRMatch,
+                                                  "dbname",
+                                                  expectKvdbGetValue("key", R"(["10.0.0.0/8", "fd00::/8"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "192.168.0.1"})",
+                    getFilterBuilderExpectHandler(getOpBuilderKVDBIPCIDRMatch,
+                                                  "dbname",
+                                                  expectKvdbGetValue("key", R"(["10.0.0.0/8", "fd00::/8"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": "10.1.2.3"})",
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBIPCIDRMatch, "dbname", expectKvdbGetValue("key", R"(["10.0.0.0/8"])")),
+                    "notTarget",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    FAILURE()),
+        /*** CONTAINS ANY ***/
+        FilterDepsT(R"({"target": "powershell -enc SQBFAFgA"})",
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetValue("key", R"(["-enc", "bypass"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    SUCCESS()),
+        FilterDepsT(R"({"target": "powershell -file script.ps1"})",
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetValue("key", R"(["-enc", "bypass"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    FAILURE()),
+        FilterDepsT(R"({"target": 1})",
+                    getFilterBuilderExpectHandler(
+                        getOpBuilderKVDBContainsAny, "dbname", expectKvdbGetValue("key", R"(["-enc", "bypass"])")),
+                    "target",
+                    {makeValue(R"("dbname")"), makeValue(R"("key")")},
+                    FAILURE())),
+    testNameFormatter<FilterOperationWithDepsTest>("KVDBList"));
 } // namespace filteroperatestest
 
 namespace transformbuildtest
@@ -1038,6 +1178,20 @@ INSTANTIATE_TEST_SUITE_P(
                            {
                                customRefExpected("target", "ref")(mocks);
                                return makeEvent(R"({"ref": "0x3", "target": ["val1"]})");
+                           })),
+        TransformDepsT(R"({"ref": "8000010000000001"})",
+                       getTrBuilderExpectHandler(
+                           getOpBuilderHelperKVDBDecodeBitmask,
+                           "dbname",
+                           expectKvdbGetValue("key", R"({"0": "val0", "40": "val40", "63": "val63"})")),
+                       "target",
+                       {makeValue(R"("dbname")"), makeValue(R"("key")"), makeRef("ref")},
+                       SUCCESS(
+                           [](const BuildersMocks& mocks)
+                           {
+                               customRefExpected("target", "ref")(mocks);
+                               return makeEvent(
+                                   R"({"ref": "8000010000000001", "target": ["val0", "val40", "val63"]})");
                            }))),
     testNameFormatter<TransformOperationWithDepsTest>("KVDB"));
 } // namespace transformoperatestest
@@ -77,6 +77,25 @@ INSTANTIATE_TEST_SUITE_P(
              opBuilderHelperRegexExtract,
              FAILURE(jTypeRefExpected(json::Json::Type::Null)))),
     testNameFormatter<MapBuilderTest>("Regex"));
+
+INSTANTIATE_TEST_SUITE_P(
+    BuildersGroups,
+    MapBuilderTest,
+    testing::Values(
+        MapT({}, opBuilderHelperRegexExtractGroups, FAILURE()),
+        MapT({makeRef("ref")}, opBuilderHelperRegexExtractGroups, FAILURE()),
+        MapT({makeRef("ref"), makeValue(R"("(?P<key>value)")")},
+             opBuilderHelperRegexExtractGroups,
+             SUCCESS(customRefExpected())),
+        MapT({makeRef("ref"), makeValue(R"("(value)")")},
+             opBuilderHelperRegexExtractGroups,
+             FAILURE(customRefExpected())),
+        MapT({makeRef("ref"), makeValue(R"("(?P<key>value")")}, opBuilderHelperRegexExtractGroups, FAILURE()),
+        MapT({makeRef("ref"), makeRef("ref")}, opBuilderHelperRegexExtractGroups, FAILURE()),
+        MapT({makeRef("ref"), makeValue(R"("(?P<key>value)")")},
+             opBuilderHelperRegexExtractGroups,
+             FAILURE(jTypeRefExpected(json::Json::Type::Number)))),
+    testNameFormatter<MapBuilderTest>("RegexGroups"));
 } // namespace mapbuildtest
 
 namespace mapoperatestest
@@ -128,4 +147,37 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                                               {makeRef("ref"), makeValue(R"z("(.*)")z")},
                                               FAILURE(customRefExpected()))),
                          testNameFormatter<MapOperationTest>("Regex"));
+
+INSTANTIATE_TEST_SUITE_P(
+    BuildersGroups,
+    MapOperationTest,
+    testing::Values(MapT(R"({ "ref": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("^(?P<first>va)l(?P<second>ue)$")z")},
+                         SUCCESS(customRefExpected(json::Json(R"({"first": "va", "second": "ue"})")))),
+                    MapT(R"({ "ref": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("^(v)(?P<first>a)l(ue)$")z")},
+                         SUCCESS(customRefExpected(json::Json(R"({"first": "a"})")))),
+                    MapT(R"({ "ref": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("^(?P<first>va)(?P<missing>x)?lue$")z")},
+                         SUCCESS(customRefExpected(json::Json(R"({"first": "va"})")))),
+                    MapT(R"({ "ref": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("^(?P<empty>)value$")z")},
+                         SUCCESS(customRefExpected(json::Json(R"({"empty": ""})")))),
+                    MapT(R"({ "ref": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("(?P<first>fail)")z")},
+                         FAILURE(customRefExpected())),
+                    MapT(R"({ "notRef": "value" })",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("(?P<first>.*)")z")},
+                         FAILURE(customRefExpected())),
+                    MapT(R"({ "ref": 1})",
+                         opBuilderHelperRegexExtractGroups,
+                         {makeRef("ref"), makeValue(R"z("(?P<first>.*)")z")},
+                         FAILURE(customRefExpected()))),
+    testNameFormatter<MapOperationTest>("RegexGroups"));
 } // namespace mapoperatestest
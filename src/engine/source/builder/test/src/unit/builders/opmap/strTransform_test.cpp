@@ -353,12 +353,19 @@ INSTANTIATE_TEST_SUITE_P(
              FAILURE(customRefExpected())),
         MapT(R"({"ref": null})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": "FF"})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "48G5"})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "486"})", opBuilderHelperStringFromHexa, {makeRef("ref")}, FAILURE(customRefExpected())),
         /*** Hex to Number*/
         MapT(R"({"ref": "48656C"})",
              opBuilderHelperHexToNumber,
              {makeRef("ref")},
              SUCCESS(customRefExpected(json::Json("4744556")))),
         MapT(R"({"ref": "48656P"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
+        MapT(R"({"ref": "0x2A"})",
+             opBuilderHelperHexToNumber,
+             {makeRef("ref")},
+             SUCCESS(customRefExpected(json::Json("42")))),
+        MapT(R"({"ref": "100000000"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"notRef": "48656C"})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": 1})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
         MapT(R"({"ref": 1.1})", opBuilderHelperHexToNumber, {makeRef("ref")}, FAILURE(customRefExpected())),
@@ -68,30 +68,35 @@ INSTANTIATE_TEST_SUITE_P(
     testing::Values(MapDepsT(R"({"ref": {"some":"data"}})",
                              getBuilderExpectSockHandler(
                                  [](std::shared_ptr<MockSockHandler> sockHandlerMock) {
-                                     EXPECT_CALL(*sockHandlerMock, sendMsg(R"({"some":"data"})"))
-                                         .WillOnce(testing::Return(successSendMsgRes()));
+                                     EXPECT_CALL(*sockHandlerMock,
+                                                 sendMsgs(std::vector<std::string> {R"({"some":"data"})"}))
+                                         .WillOnce(testing::Return(std::vector {successSendMsgRes()}));
                                  }),
                              {makeRef("ref")},
                              SUCCESS(json::Json("true"))),
                     MapDepsT(R"({})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
                     MapDepsT(R"({"ref": "notObject"})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
                     MapDepsT(R"({"ref":{}})", getBuilderExpectSockHandler(), {makeRef("ref")}, FAILURE()),
+                    // The message is queued, the send errors are only logged by the sender
                     MapDepsT(R"({"ref": {"some":"data"}})",
                              getBuilderExpectSockHandler(
                                  [](std::shared_ptr<MockSockHandler> sockHandlerMock) {
-                                     EXPECT_CALL(*sockHandlerMock, sendMsg(R"({"some":"data"})"))
-                                         .WillOnce(testing::Return(socketErrorSendMsgRes()));
+                                     EXPECT_CALL(*sockHandlerMock,
+                                                 sendMsgs(std::vector<std::string> {R"({"some":"data"})"}))
+                                         .WillOnce(testing::Return(std::vector {socketErrorSendMsgRes()}));
                                  }),
                              {makeRef("ref")},
-                             FAILURE()),
+                             SUCCESS(json::Json("true"))),
                     MapDepsT(R"({"ref": {"some":"data"}})",
                              getBuilderExpectSockHandler(
                                  [](std::shared_ptr<MockSockHandler> sockHandlerMock)
                                  {
-                                     EXPECT_CALL(*sockHandlerMock, sendMsg(R"({"some":"data"})"))
+                                     EXPECT_CALL(*sockHandlerMock,
+                                                 sendMsgs(std::vector<std::string> {R"({"some":"data"})"}))
                                          .WillOnce(testing::Throw(std::runtime_error("error")));
+                                     EXPECT_CALL(*sockHandlerMock, socketDisconnect());
                                  }),
                              {makeRef("ref")},
-                             FAILURE())),
+                             SUCCESS(json::Json("true")))),
     testNameFormatter<MapOperationWithDepsTest>("UpgradeConfirmation"));
 } // namespace mapoperatestest
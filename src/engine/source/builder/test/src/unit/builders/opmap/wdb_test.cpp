@@ -1,6 +1,7 @@
 #include "builders/baseBuilders_test.hpp"
 #include "builders/opmap/wdb.hpp"
 
+#include <wdb/mockAgentCache.hpp>
 #include <wdb/mockWdbHandler.hpp>
 #include <wdb/mockWdbManager.hpp>
 
@@ -27,7 +28,7 @@ auto getBuilderExpectHandler(Builder&& builder)
         auto mockWdbManager = std::make_shared<MockWdbManager>();
         auto mockWdbHandler = std::make_shared<MockWdbHandler>();
 
-        EXPECT_CALL(*mockWdbManager, connection()).WillOnce(testing::Return(mockWdbHandler));
+        EXPECT_CALL(*mockWdbManager, pooledConnection()).WillOnce(testing::Return(mockWdbHandler));
         return builder(mockWdbManager);
     };
 }
@@ -40,7 +41,7 @@ auto getBuilderExpectHandler(Builder&& builder, Behaviour&& behaviour)
         auto mockWdbManager = std::make_shared<MockWdbManager>();
         auto mockWdbHandler = std::make_shared<MockWdbHandler>();
 
-        EXPECT_CALL(*mockWdbManager, connection()).WillOnce(testing::Return(mockWdbHandler));
+        EXPECT_CALL(*mockWdbManager, pooledConnection()).WillOnce(testing::Return(mockWdbHandler));
         behaviour(mockWdbHandler);
         return builder(mockWdbManager);
     };
@@ -104,6 +105,33 @@ auto expectNotOkQuery(const std::string& query)
     };
 }
 
+auto expectAsyncQuery(const std::string& query)
+{
+    return [=](const std::shared_ptr<MockWdbHandler>& mockWdbHandler)
+    {
+        EXPECT_CALL(*mockWdbHandler, tryQueryAsync(query));
+    };
+}
+
+auto getAgentBuilder(bool enabled = true)
+{
+    return [=]()
+    {
+        return getAgentInfoBuilder(enabled ? std::make_shared<MockAgentCache>() : nullptr);
+    };
+}
+
+auto getAgentBuilderExpectGet(const std::string& agentId, const std::string& agent = "")
+{
+    return [=]()
+    {
+        auto mockAgentCache = std::make_shared<MockAgentCache>();
+        EXPECT_CALL(*mockAgentCache, get(testing::Eq(agentId)))
+            .WillOnce(testing::Return(agent.empty() ? nullptr : std::make_shared<const json::Json>(agent.c_str())));
+        return getAgentInfoBuilder(mockAgentCache);
+    };
+}
+
 } // namespace
 
 namespace mapbuildtest
@@ -139,7 +167,15 @@ INSTANTIATE_TEST_SUITE_P(
                  SUCCESS(expectJTypeRef("ref", json::Json::Type::String))),
         MapDepsT({makeRef("ref")},
                  getBuilder(getWdbUpdateBuilder),
-                 FAILURE(expectJTypeRef("ref", json::Json::Type::Number)))),
+                 FAILURE(expectJTypeRef("ref", json::Json::Type::Number))),
+        /*** Agent info ***/
+        MapDepsT({makeRef("ref")}, getAgentBuilder(false), FAILURE()),
+        MapDepsT({}, getAgentBuilder(), FAILURE()),
+        MapDepsT({makeValue(R"("001")")}, getAgentBuilder(), FAILURE()),
+        MapDepsT({makeRef("ref"), makeRef("other")}, getAgentBuilder(), FAILURE()),
+        MapDepsT({makeRef("ref")}, getAgentBuilder(), SUCCESS(expectCustomRef("ref"))),
+        MapDepsT({makeRef("ref")}, getAgentBuilder(), SUCCESS(expectJTypeRef("ref", json::Json::Type::String))),
+        MapDepsT({makeRef("ref")}, getAgentBuilder(), FAILURE(expectJTypeRef("ref", json::Json::Type::Number)))),
     testNameFormatter<MapBuilderWithDepsTest>("WDB"));
 } // namespace mapbuildtest
 
@@ -213,6 +249,33 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                              MapDepsT(R"({})",
                                       getBuilderExpectHandler(getWdbUpdateBuilder, expectNotOkQuery("query")),
                                       {makeValue(R"("query")")},
-                                      FAILURE())),
+                                      FAILURE()),
+                             /*** Update async ***/
+                             MapDepsT(R"({})",
+                                      getBuilderExpectHandler(getWdbUpdateAsyncBuilder, expectAsyncQuery("query")),
+                                      {makeValue(R"("query")")},
+                                      SUCCESS(json::Json {R"(true)"})),
+                             MapDepsT(R"({"ref": "query"})",
+                                      getBuilderExpectHandler(getWdbUpdateAsyncBuilder, expectAsyncQuery("query")),
+                                      {makeRef("ref")},
+                                      SUCCESS(expectCustomRef("ref", json::Json {R"(true)"}))),
+                             MapDepsT(R"({})",
+                                      getBuilderExpectHandler(getWdbUpdateAsyncBuilder),
+                                      {makeRef("ref")},
+                                      FAILURE(expectCustomRef("ref"))),
+                             /*** Agent info ***/
+                             MapDepsT(R"({"ref": "001"})",
+                                      getAgentBuilderExpectGet("001", R"({"id":1,"name":"agent-1"})"),
+                                      {makeRef("ref")},
+                                      SUCCESS(expectCustomRef("ref", json::Json {R"({"id":1,"name":"agent-1"})"}))),
+                             MapDepsT(R"({"ref": "002"})",
+                                      getAgentBuilderExpectGet("002"),
+                                      {makeRef("ref")},
+                                      FAILURE(expectCustomRef("ref"))),
+                             MapDepsT(R"({})", getAgentBuilder(), {makeRef("ref")}, FAILURE(expectCustomRef("ref"))),
+                             MapDepsT(R"({"ref": 1})",
+                                      getAgentBuilder(),
+                                      {makeRef("ref")},
+                                      FAILURE(expectCustomRef("ref")))),
                          testNameFormatter<MapOperationWithDepsTest>("WDB"));
 }
@@ -9,7 +9,7 @@ namespace
 {
 auto dummyParserSuccess(const std::string_view& text)
 {
-    return hlp::abs::makeSuccess(hlp::parsers::SemToken {text, hlp::parsers::noSemParser()}, text.substr(text.size()));
+    return hlp::abs::makeSuccess(hlp::parsers::SemToken {text}, text.substr(text.size()));
 }
 
 auto dummyParserFailure(const std::string_view& text)
@@ -19,7 +19,7 @@ auto dummyParserFailure(const std::string_view& text)
 
 auto dummyParserEofError(const std::string_view& text)
 {
-    return hlp::abs::makeSuccess(hlp::parsers::SemToken {text, hlp::parsers::noSemParser()}, text);
+    return hlp::abs::makeSuccess(hlp::parsers::SemToken {text}, text);
 }
 
 auto getBuilder(bool parserSuccess = true)
@@ -5000,3 +5000,103 @@ TEST_F(dumpEndTypeDecoderSCA, DeletePolicyCheckDistinctOkStrcmpIsNotZero)
     ASSERT_TRUE(result.payload()->isBool(targetField.jsonPath()));
     ASSERT_TRUE(result.payload()->getBool(targetField.jsonPath()).value());
 }
+
+TEST(SCAState, LookupCachedUntilExpired)
+{
+    sca::StateOptions options;
+    options.cacheTtl = std::chrono::seconds(60);
+    sca::State state(options, nullptr);
+
+    ASSERT_FALSE(state.lookup("007", "agent 007 sca query 911"));
+
+    state.store("007", "agent 007 sca query 911", sca::SearchResult::FOUND, "passed");
+    state.store("007", "agent 007 sca query 912", sca::SearchResult::ERROR, "");
+
+    const auto cached = state.lookup("007", "agent 007 sca query 911");
+    ASSERT_TRUE(cached);
+    ASSERT_EQ(std::get<0>(cached.value()), sca::SearchResult::FOUND);
+    ASSERT_EQ(std::get<1>(cached.value()), "passed");
+    ASSERT_FALSE(state.lookup("007", "agent 007 sca query 912"));
+    ASSERT_FALSE(state.lookup("008", "agent 007 sca query 911"));
+
+    state.invalidate("007");
+    ASSERT_FALSE(state.lookup("007", "agent 007 sca query 911"));
+
+    // Without TTL nothing is cached
+    sca::State uncached({}, nullptr);
+    uncached.store("007", "agent 007 sca query 911", sca::SearchResult::FOUND, "passed");
+    ASSERT_FALSE(uncached.lookup("007", "agent 007 sca query 911"));
+}
+
+TEST(SCAState, QueueUpdateCoalescesChecks)
+{
+    sca::StateOptions options;
+    options.batchSize = 2;
+    sca::State state(options, nullptr);
+
+    ASSERT_FALSE(state.queueUpdate("007", 911, "agent 007 sca update 911|failed||404"));
+    // The last update of a check wins
+    ASSERT_FALSE(state.queueUpdate("007", 911, "agent 007 sca update 911|passed||404"));
+    ASSERT_FALSE(state.queueUpdate("008", 912, "agent 008 sca update 912|passed||404"));
+    ASSERT_TRUE(state.queueUpdate("007", 913, "agent 007 sca update 913|passed||404"));
+
+    const std::vector<std::string> expected {"agent 007 sca update 911|passed||404",
+                                             "agent 007 sca update 913|passed||404"};
+    ASSERT_EQ(state.takePending("007"), expected);
+    ASSERT_TRUE(state.takePending("007").empty());
+
+    // Not due yet
+    ASSERT_TRUE(state.takeDue().empty());
+    ASSERT_EQ(state.takePending("008"), std::vector<std::string> {"agent 008 sca update 912|passed||404"});
+}
+
+TEST(SCAState, PendingUpdatesSavedOnDestruction)
+{
+    auto wdbManager = std::make_shared<MockWdbManager>();
+    auto wdb = std::make_shared<MockWdbHandler>();
+
+    sca::StateOptions options;
+    options.batchSize = 10;
+    {
+        sca::State state(options, wdbManager);
+        state.queueUpdate("007", 911, "agent 007 sca update 911|passed||404");
+
+        EXPECT_CALL(*wdbManager, connection()).WillOnce(testing::Return(wdb));
+        EXPECT_CALL(*wdb,
+                    tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911|passed||404"), testing::_))
+            .WillOnce(testing::Return(okQueryRes()));
+    }
+}
+
+TEST_F(checkTypeDecoderSCA, CachedCheckIsNotQueriedAgain)
+{
+    sca::StateOptions options;
+    options.cacheTtl = std::chrono::seconds(60);
+    options.batchSize = 2;
+
+    const auto tuple {std::make_tuple(targetField, commonArguments, ctx)};
+
+    // The decoder connection and the one of the updates left when the decoder is destroyed
+    EXPECT_CALL(*wdbManager, connection()).Times(2);
+    EXPECT_CALL(*sockFactory, getHandler(testing::_, testing::_));
+
+    const auto op {std::apply(getBuilderSCAdecoder(wdbManager, sockFactory, options), tuple)};
+
+    // The first event looks the check up, the second one is answered from the cache
+    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca query 911"), testing::_))
+        .WillOnce(testing::Return(okQueryRes("found check")));
+    // Both updates are coalesced, the last one is written
+    EXPECT_CALL(*wdb, tryQueryAndParseResult(testing::StrEq("agent 007 sca update 911|Some Result||404"), testing::_))
+        .WillOnce(testing::Return(okQueryRes()));
+
+    const auto event {std::make_shared<json::Json>(checkTypeEvtWithMandatoryFields)};
+    result::Result<Event> result {op(event)};
+    ASSERT_TRUE(result);
+    ASSERT_STREQ(event->getString("/sca/check/previous_result").value().c_str(), "check");
+
+    // Same result as the cached one, the event is not normalized
+    const auto second {std::make_shared<json::Json>(checkTypeEvtWithMandatoryFields)};
+    result::Result<Event> secondResult {op(second)};
+    ASSERT_TRUE(secondResult);
+    ASSERT_FALSE(second->exists("/sca/type"));
+}
@@ -109,6 +109,16 @@ INSTANTIATE_TEST_SUITE_P(Builders,
                                         "target",
                                         {makeValue(R"("begin")"), makeValue(R"("/")")},
                                         SUCCESS(makeEvent(R"({"target": "--value--"})"))),
+                             TransformT(R"({"target": "----"})",
+                                        opBuilderHelperStringTrim,
+                                        "target",
+                                        {makeValue(R"("end")"), makeValue(R"("-")")},
+                                        SUCCESS(makeEvent(R"({"target": ""})"))),
+                             TransformT(R"({"target": "----"})",
+                                        opBuilderHelperStringTrim,
+                                        "target",
+                                        {makeValue(R"("both")"), makeValue(R"("-")")},
+                                        SUCCESS(makeEvent(R"({"target": ""})"))),
                              /*** Replace ***/
                              TransformT(R"({"target": "--value--"})",
                                         opBuilderHelperStringReplace,
@@ -0,0 +1,117 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include "builders/stage/aggregate.hpp"
+
+using namespace builder::builders;
+
+namespace stagebuildtest
+{
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    StageBuilderTest,
+    testing::Values(StageT(R"([])", aggregateBuilder, FAILURE()),
+                    StageT(R"("notObject")", aggregateBuilder, FAILURE()),
+                    StageT(R"({})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip"]})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"window": 60})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": [], "window": 60})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["source.ip"], "window": 60})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": [1], "window": 60})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip"], "window": 0})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip"], "window": "60"})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip"], "window": 60, "max_keys": -1})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip"], "window": 60, "other": 1})", aggregateBuilder, FAILURE()),
+                    StageT(R"({"fields": ["$source.ip", "$rule.id"], "window": 60})",
+                           aggregateBuilder,
+                           SUCCESS(base::Term<base::EngineOp>::create("aggregate($source.ip, $rule.id)", {}))),
+                    StageT(R"({"fields": ["$source.ip"], "window": 60, "max_keys": 10,
+                              "suppressed_field": "aggregate.suppressed"})",
+                           aggregateBuilder,
+                           SUCCESS(base::Term<base::EngineOp>::create("aggregate($source.ip)", {})))),
+    testNameFormatter<StageBuilderTest>("Aggregate"));
+} // namespace stagebuildtest
+
+namespace aggregatetest
+{
+using builder::builders::detail::AggregateTable;
+
+TEST(AggregateTableTest, InvalidSettings)
+{
+    ASSERT_THROW(AggregateTable(0, 10), std::runtime_error);
+    ASSERT_THROW(AggregateTable(10, 0), std::runtime_error);
+}
+
+TEST(AggregateTableTest, SuppressesWithinTheWindow)
+{
+    AggregateTable table(10, 100);
+
+    ASSERT_EQ(table.hit(1, 1000), 0);
+    ASSERT_FALSE(table.hit(1, 1005));
+    ASSERT_FALSE(table.hit(1, 1009));
+    ASSERT_EQ(table.hit(2, 1009), 0);
+
+    // The event opening the next window gets the count of the previous one
+    ASSERT_EQ(table.hit(1, 1010), 2);
+    ASSERT_FALSE(table.hit(1, 1011));
+    ASSERT_EQ(table.hit(1, 1025), 1);
+}
+
+TEST(AggregateTableTest, ExpiresTheOldWindows)
+{
+    AggregateTable table(10, 100);
+    ASSERT_EQ(table.hit(1, 1000), 0);
+    ASSERT_FALSE(table.hit(1, 1001));
+    ASSERT_EQ(table.hit(2, 1015), 0);
+    ASSERT_EQ(table.size(), 2);
+
+    // Two windows after it was opened the key is gone, with its count
+    ASSERT_EQ(table.hit(3, 1021), 0);
+    ASSERT_EQ(table.size(), 2);
+    ASSERT_EQ(table.hit(1, 1022), 0);
+
+    // A long pause expires all of them
+    ASSERT_EQ(table.hit(4, 5000), 0);
+    ASSERT_EQ(table.size(), 1);
+}
+
+TEST(AggregateTableTest, KeysBeyondTheLimitPass)
+{
+    // One key per shard, the shard is picked by the high bits of the hash
+    AggregateTable table(10, AggregateTable::SHARDS);
+    ASSERT_EQ(table.hit(1, 1000), 0);
+    ASSERT_EQ(table.hit(2, 1000), 0);
+    ASSERT_EQ(table.hit(2, 1001), 0);
+    ASSERT_FALSE(table.hit(1, 1001));
+    ASSERT_EQ(table.size(), 1);
+}
+
+TEST(AggregateTableTest, SharedByStage)
+{
+    auto table = AggregateTable::get("asset/definition", 10, 100);
+    ASSERT_EQ(AggregateTable::get("asset/definition", 10, 100), table);
+    ASSERT_NE(AggregateTable::get("asset/other", 10, 100), table);
+}
+
+class AggregateStageTest : public BaseBuilderTest
+{
+};
+
+TEST_F(AggregateStageTest, SuppressesTheDuplicates)
+{
+    mocks->context.assetName = "output/aggregate/suppresses";
+    json::Json definition {R"({"fields": ["$source.ip"], "window": 3600, "suppressed_field": "suppressed"})"};
+    auto expression = aggregateBuilder(definition, mocks->ctx);
+    auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    auto first = std::make_shared<json::Json>(R"({"source": {"ip": "10.0.0.1"}})");
+    ASSERT_TRUE(op(first));
+    ASSERT_EQ(first->getInt64("/suppressed"), 0);
+
+    ASSERT_FALSE(op(std::make_shared<json::Json>(R"({"source": {"ip": "10.0.0.1"}})")));
+    ASSERT_TRUE(op(std::make_shared<json::Json>(R"({"source": {"ip": "10.0.0.2"}})")));
+
+    // A missing field is a value of the key too
+    ASSERT_TRUE(op(std::make_shared<json::Json>(R"({})")));
+    ASSERT_FALSE(op(std::make_shared<json::Json>(R"({"other": 1})")));
+}
+} // namespace aggregatetest
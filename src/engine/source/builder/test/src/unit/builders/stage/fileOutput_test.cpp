@@ -1,4 +1,9 @@
 #include "builders/baseBuilders_test.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <thread>
+
 #include "builders/stage/fileOutput.hpp"
 
 using namespace builder::builders;
@@ -103,6 +108,7 @@ TEST_F(FileOutputTest, Write)
     auto msg = std::make_shared<json::Json>(messageStr);
     auto output = FileOutput(FILE_PATH);
     ASSERT_NO_THROW(output.write(msg));
+    ASSERT_NO_THROW(output.flush());
 
     std::ifstream ifs(FILE_PATH);
     std::stringstream buffer;
@@ -110,4 +116,67 @@ TEST_F(FileOutputTest, Write)
 
     ASSERT_EQ(buffer.str(), compact_message);
 }
+std::string readFile(const std::string& path)
+{
+    std::ifstream ifs(path);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+    return buffer.str();
+}
+
+TEST_F(FileOutputTest, WriteOnFlushInterval)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    auto output = FileOutput(FILE_PATH, {std::chrono::milliseconds(1), std::chrono::milliseconds(0)});
+    ASSERT_NO_THROW(output.write(msg));
+
+    for (auto i = 0; i < 500 && readFile(FILE_PATH).empty(); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    ASSERT_EQ(readFile(FILE_PATH), compact_message);
+}
+
+TEST_F(FileOutputTest, WriteOnDestroy)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    {
+        auto output = FileOutput(FILE_PATH);
+        ASSERT_NO_THROW(output.write(msg));
+    }
+
+    ASSERT_EQ(readFile(FILE_PATH), compact_message);
+}
+
+TEST_F(FileOutputTest, SharedWriter)
+{
+    auto msg = std::make_shared<json::Json>(messageStr);
+    auto output1 = FileOutput(FILE_PATH);
+    auto output2 = FileOutput(FILE_PATH);
+    ASSERT_NO_THROW(output1.write(msg));
+    ASSERT_NO_THROW(output2.write(msg));
+
+    // Both outputs queue the events in the same writer
+    ASSERT_NO_THROW(output1.flush());
+
+    ASSERT_EQ(readFile(FILE_PATH), std::string(compact_message) + compact_message);
+}
+
+TEST_F(FileOutputTest, ReopenRotatedFile)
+{
+    const auto rotatedPath = std::string(FILE_PATH) + ".1";
+    auto msg = std::make_shared<json::Json>(messageStr);
+    auto output = FileOutput(FILE_PATH);
+    ASSERT_NO_THROW(output.write(msg));
+    ASSERT_NO_THROW(output.flush());
+
+    std::filesystem::rename(FILE_PATH, rotatedPath);
+    ASSERT_NO_THROW(output.write(msg));
+    ASSERT_NO_THROW(output.flush());
+
+    ASSERT_EQ(readFile(rotatedPath), compact_message);
+    ASSERT_EQ(readFile(FILE_PATH), compact_message);
+    std::filesystem::remove(rotatedPath);
+}
 } // namespace fileoutputtest
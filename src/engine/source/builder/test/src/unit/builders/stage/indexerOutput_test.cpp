@@ -0,0 +1,69 @@
+#include "builders/baseBuilders_test.hpp"
+
+#include <indexerconnector/mockIndexerConnector.hpp>
+
+#include "builders/stage/indexerOutput.hpp"
+
+using namespace builder::builders;
+using namespace indexerconnector::mocks;
+
+namespace stagebuildtest
+{
+auto indexerOutputBuilder = getIndexerOutputBuilder(std::make_shared<MockIndexerConnector>());
+
+INSTANTIATE_TEST_SUITE_P(
+    Builders,
+    StageBuilderTest,
+    testing::Values(StageT(R"([])", indexerOutputBuilder, FAILURE()),
+                    StageT(R"("notObject")", indexerOutputBuilder, FAILURE()),
+                    StageT(R"(1)", indexerOutputBuilder, FAILURE()),
+                    StageT(R"(null)", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": "wazuh-alerts", "other": "val"})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"other": "wazuh-alerts"})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": 1})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": ""})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": "Wazuh-alerts"})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": "wazuh alerts"})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": "_wazuh-alerts"})", indexerOutputBuilder, FAILURE()),
+                    StageT(R"({"index": "wazuh-alerts"})", getIndexerOutputBuilder(nullptr), FAILURE()),
+                    StageT(R"({"index": "wazuh-alerts-5.x"})",
+                           indexerOutputBuilder,
+                           SUCCESS(base::Term<base::EngineOp>::create("write.indexer(wazuh-alerts-5.x)", {})))),
+    testNameFormatter<StageBuilderTest>("IndexerOutput"));
+} // namespace stagebuildtest
+
+namespace indexeroutputtest
+{
+class IndexerOutputTest : public BaseBuilderTest
+{
+protected:
+    std::shared_ptr<MockIndexerConnector> connector;
+
+    void SetUp() override
+    {
+        BaseBuilderTest::SetUp();
+        connector = std::make_shared<MockIndexerConnector>();
+    }
+};
+
+TEST_F(IndexerOutputTest, Index)
+{
+    auto expression = getIndexerOutputBuilder(connector)(json::Json(R"({"index": "wazuh-alerts"})"), mocks->ctx);
+    auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    auto event = std::make_shared<json::Json>(R"({"a": {"b": 1}})");
+    EXPECT_CALL(*connector, index(std::string_view("wazuh-alerts"), std::string_view(R"({"a":{"b":1}})")));
+    ASSERT_TRUE(op(event).success());
+}
+
+TEST_F(IndexerOutputTest, IndexFailure)
+{
+    auto expression = getIndexerOutputBuilder(connector)(json::Json(R"({"index": "wazuh-alerts"})"), mocks->ctx);
+    auto op = expression->getPtr<base::Term<base::EngineOp>>()->getFn();
+
+    auto event = std::make_shared<json::Json>(R"({"a": 1})");
+    EXPECT_CALL(*connector, index(testing::_, testing::_)).WillOnce(testing::Throw(std::runtime_error("Queue full")));
+    ASSERT_FALSE(op(event).success());
+}
+} // namespace indexeroutputtest
@@ -14,11 +14,14 @@ using namespace builder::builders;
 using namespace builder::builders::mocks;
 using namespace builder::mocks;
 
+auto evalExpr =
+    base::Term<base::EngineOp>::create("AssetEvaluated", [](auto e) { return base::result::makeSuccess(e, ""); });
 auto traceExpr =
     base::Term<base::EngineOp>::create("AcceptAll", [](auto e) { return base::result::makeSuccess(e, "SUCCESS"); });
 auto delVarExpr =
     base::Term<base::EngineOp>::create("DeleteVariables", [](auto e) { return base::result::makeSuccess(e, ""); });
-auto assetExpr = base::And::create(base::Name("name"), {base::And::create(base::Name("condition"), {traceExpr})});
+auto assetExpr =
+    base::And::create(base::Name("name"), {base::And::create(base::Name("condition"), {evalExpr, traceExpr})});
 
 struct Mocks
 {
@@ -203,8 +206,9 @@ INSTANTIATE_TEST_SUITE_P(
                        {
                            EXPECT_CALL(*mocks.m_mockDefBuilder, build(testing::_))
                                .WillOnce(testing::Return(mocks.m_mockDefs));
-                           return base::And::create(base::Name("name"),
-                                                    {base::And::create(base::Name("condition"), {traceExpr})});
+                           return base::And::create(
+                               base::Name("name"),
+                               {base::And::create(base::Name("condition"), {evalExpr, traceExpr})});
                        })),
         BuildExprT(AV {},
                    SUCCESS(
@@ -212,8 +216,9 @@ INSTANTIATE_TEST_SUITE_P(
                        {
                            EXPECT_CALL(*mocks.m_mockDefBuilder, build(testing::_))
                                .WillOnce(testing::Return(mocks.m_mockDefs));
-                           return base::And::create(base::Name("name"),
-                                                    {base::And::create(base::Name("condition"), {traceExpr})});
+                           return base::And::create(
+                               base::Name("name"),
+                               {base::And::create(base::Name("condition"), {evalExpr, traceExpr})});
                        })),
         BuildExprT(AV {"stageWithoutBuilder"},
                    FAILURE(
@@ -239,7 +244,7 @@ INSTANTIATE_TEST_SUITE_P(
                             testing::Return([stageExpr](const json::Json& value,
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return stageExpr; }));
-                    auto condition = base::And::create(base::Name("condition"), {traceExpr});
+                    auto condition = base::And::create(base::Name("condition"), {evalExpr, traceExpr});
                     auto consequence = base::And::create(base::Name("stages"), {stageExpr, delVarExpr});
                     return base::Implication::create(base::Name("name"), condition, consequence);
                 })),
@@ -269,7 +274,7 @@ INSTANTIATE_TEST_SUITE_P(
                             testing::Return([checkExpr](const json::Json& value,
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return checkExpr; }));
-                    auto condition = base::And::create(base::Name("condition"), {checkExpr, traceExpr});
+                    auto condition = base::And::create(base::Name("condition"), {evalExpr, checkExpr, traceExpr});
                     auto consequence = base::And::create(base::Name("stages"), {delVarExpr});
                     return base::And::create(base::Name("name"), {condition});
                 })),
@@ -300,7 +305,7 @@ INSTANTIATE_TEST_SUITE_P(
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return parseExpr; }));
 
-                    auto condition = base::And::create(base::Name("condition"), {parseExpr, traceExpr});
+                    auto condition = base::And::create(base::Name("condition"), {evalExpr, parseExpr, traceExpr});
                     return base::And::create(base::Name("name"), {condition});
                 })),
         BuildExprT(
@@ -354,7 +359,8 @@ INSTANTIATE_TEST_SUITE_P(
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return parseExpr; }));
 
-                    auto condition = base::And::create(base::Name("condition"), {checkExpr, parseExpr, traceExpr});
+                    auto condition =
+                        base::And::create(base::Name("condition"), {evalExpr, checkExpr, parseExpr, traceExpr});
                     return base::And::create(base::Name("name"), {condition});
                 })),
         BuildExprT(
@@ -421,7 +427,8 @@ INSTANTIATE_TEST_SUITE_P(
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return stageExpr; }));
 
-                    auto condition = base::And::create(base::Name("condition"), {checkExpr, parseExpr, traceExpr});
+                    auto condition =
+                        base::And::create(base::Name("condition"), {evalExpr, checkExpr, parseExpr, traceExpr});
                     auto consequence = base::And::create(base::Name("stages"), {stageExpr, delVarExpr});
                     return base::Implication::create(base::Name("name"), condition, consequence);
                 })),
@@ -512,6 +519,7 @@ TEST_P(BuildAsset, Build)
         EXPECT_EQ(assetObj.name(), expectedAsset.name());
         builder::test::assertEqualExpr(assetObj.expression(), expectedAsset.expression());
         EXPECT_EQ(assetObj.parents(), expectedAsset.parents());
+        EXPECT_EQ(assetObj.runtimeValidations(), expectedAsset.runtimeValidations());
     }
     else
     {
@@ -547,7 +555,7 @@ INSTANTIATE_TEST_SUITE_P(
                                                         const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
                                             { return checkExpr; }));
 
-                    auto condition = base::And::create(base::Name("condition"), {checkExpr, traceExpr});
+                    auto condition = base::And::create(base::Name("condition"), {evalExpr, checkExpr, traceExpr});
                     return Asset(base::Name("name"), base::And::create(base::Name("name"), {condition}), {});
                 })),
         BuildT(R"({"name": "name", "check": {}})",
@@ -559,4 +567,35 @@ INSTANTIATE_TEST_SUITE_P(
                        return None {};
                    }))));
 
+TEST(AssetBuilderTest, CountRuntimeValidations)
+{
+    auto buildCtx = std::make_shared<BuildCtx>();
+    auto mockDefBuilder = std::make_shared<defs::mocks::MockDefinitionsBuilder>();
+    auto mockDefs = std::make_shared<defs::mocks::MockDefinitions>();
+    auto mockRegistry = MockMetaRegistry<OpBuilderEntry, StageBuilder>::createMock();
+    buildCtx->setRegistry(mockRegistry);
+    AssetBuilder assetBuilder(buildCtx, mockDefBuilder);
+
+    EXPECT_CALL(*mockDefBuilder, build(testing::_)).WillRepeatedly(testing::Return(mockDefs));
+    EXPECT_CALL(mockRegistry->getRegistry<StageBuilder>(), get("normalize"))
+        .WillRepeatedly(testing::Return(
+            [](const json::Json& value, const std::shared_ptr<const IBuildCtx>& ctx) -> base::Expression
+            {
+                // One runtime validation per operation
+                for (std::size_t i = 0; i < value.size(); ++i)
+                {
+                    ctx->countRuntimeValidation();
+                }
+                return base::And::create("normalize", {});
+            }));
+
+    auto first = assetBuilder(json::Json(R"({"name": "decoder/a/0", "normalize": [1, 2]})"));
+    auto second = assetBuilder(json::Json(R"({"name": "decoder/b/0", "normalize": [1, 2, 3]})"));
+
+    // Each asset has its own count
+    EXPECT_EQ(first.runtimeValidations(), 2);
+    EXPECT_EQ(second.runtimeValidations(), 3);
+    EXPECT_EQ(buildCtx->runtimeValidations(), 0);
+}
+
 } // namespace assetbuildtest
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <fmt/format.h>
+
+#include "policy/assetCache.hpp"
+#include "policy/mockAssetBuilder.hpp"
+
+using namespace builder::policy;
+using namespace builder::policy::mocks;
+
+namespace
+{
+store::Doc assetDoc(const std::string& name, const std::string& check)
+{
+    return store::Doc {fmt::format(R"({{"name": "{}", "check": "{}"}})", name, check).c_str()};
+}
+
+Asset builtAsset(const std::string& name)
+{
+    return Asset {base::Name(name), base::And::create(name, {}), {}};
+}
+} // namespace
+
+TEST(AssetCacheTest, ReuseUnchangedAssets)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto doc = assetDoc("decoder/a/0", "$a");
+    EXPECT_CALL(builder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+
+    auto first = cache.get(doc, builder);
+    auto second = cache.get(doc, builder);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(AssetCacheTest, RebuildChangedAssets)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto doc = assetDoc("decoder/a/0", "$a");
+    auto changed = assetDoc("decoder/a/0", "$b");
+    EXPECT_CALL(builder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(builder, CallableOp(changed)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+
+    auto first = cache.get(doc, builder);
+    auto second = cache.get(changed, builder);
+    EXPECT_NE(first.expression(), second.expression());
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(AssetCacheTest, FailedBuildKeepsTheCachedAsset)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto doc = assetDoc("decoder/a/0", "$a");
+    auto changed = assetDoc("decoder/a/0", "$b");
+    EXPECT_CALL(builder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(builder, CallableOp(changed)).WillOnce(testing::Throw(std::runtime_error("error")));
+
+    auto first = cache.get(doc, builder);
+    EXPECT_THROW(cache.get(changed, builder), std::runtime_error);
+    EXPECT_EQ(cache.get(doc, builder), first);
+}
+
+TEST(AssetCacheTest, Retain)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto docA = assetDoc("decoder/a/0", "$a");
+    auto docB = assetDoc("decoder/b/0", "$b");
+    EXPECT_CALL(builder, CallableOp(docA)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(builder, CallableOp(docB)).Times(2).WillRepeatedly(testing::Return(builtAsset("decoder/b/0")));
+
+    cache.get(docA, builder);
+    cache.get(docB, builder);
+    EXPECT_EQ(cache.size(), 2);
+
+    cache.retain(base::Name("policy/a/0"), {base::Name("decoder/a/0")});
+    EXPECT_EQ(cache.size(), 1);
+
+    // Only the retained asset is reused
+    cache.get(docA, builder);
+    cache.get(docB, builder);
+}
+
+TEST(AssetCacheTest, RetainSharedAcrossPolicies)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto docA = assetDoc("decoder/a/0", "$a");
+    auto docB = assetDoc("decoder/b/0", "$b");
+    EXPECT_CALL(builder, CallableOp(docA)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(builder, CallableOp(docB)).Times(2).WillRepeatedly(testing::Return(builtAsset("decoder/b/0")));
+
+    // Both policies use the same asset, built once
+    cache.get(docA, builder);
+    cache.get(docB, builder);
+    cache.retain(base::Name("policy/a/0"), {base::Name("decoder/a/0"), base::Name("decoder/b/0")});
+    cache.get(docA, builder);
+    cache.retain(base::Name("policy/b/0"), {base::Name("decoder/a/0")});
+    EXPECT_EQ(cache.size(), 2);
+
+    // The first policy drops its assets, only the one of the second policy is kept
+    cache.retain(base::Name("policy/a/0"), {});
+    EXPECT_EQ(cache.size(), 1);
+    cache.get(docA, builder);
+    cache.get(docB, builder);
+}
+
+TEST(AssetCacheTest, ReadOnlyReusesWithoutCaching)
+{
+    AssetCache cache;
+    MockAssetBuilder builder;
+
+    auto doc = assetDoc("decoder/a/0", "$a");
+    auto changed = assetDoc("decoder/a/0", "$b");
+    EXPECT_CALL(builder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+    EXPECT_CALL(builder, CallableOp(changed)).Times(2).WillRepeatedly(testing::Return(builtAsset("decoder/a/0")));
+
+    auto cached = cache.get(doc, builder);
+    EXPECT_EQ(cache.get(doc, builder, false), cached);
+
+    // The changed content is built on each read and the cached asset is kept
+    cache.get(changed, builder, false);
+    cache.get(changed, builder, false);
+    EXPECT_EQ(cache.get(doc, builder), cached);
+    EXPECT_EQ(cache.size(), 1);
+}
+
+TEST(AssetCacheTest, CachedAssetBuilder)
+{
+    auto cache = std::make_shared<AssetCache>();
+    auto builder = std::make_shared<MockAssetBuilder>();
+    CachedAssetBuilder cachedBuilder {builder, cache};
+
+    auto doc = assetDoc("decoder/a/0", "$a");
+    EXPECT_CALL(*builder, CallableOp(doc)).WillOnce(testing::Return(builtAsset("decoder/a/0")));
+
+    EXPECT_EQ(cachedBuilder(doc), cachedBuilder(doc));
+    EXPECT_THROW(CachedAssetBuilder(nullptr, cache), std::runtime_error);
+    EXPECT_THROW(CachedAssetBuilder(builder, nullptr), std::runtime_error);
+}
@@ -356,6 +356,86 @@ INSTANTIATE_TEST_SUITE_P(
 
             ));
 
+
+TEST(BuildAssetsParallel, SameAssetsAsSequential)
+{
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+
+    std::unordered_set<base::Name> decoders;
+    for (auto i = 0; i < 16; ++i)
+    {
+        decoders.emplace("decoder/asset/" + std::to_string(i));
+    }
+    factory::PolicyData policyData(D {.name = "test",
+                                      .hash = "test",
+                                      .defaultParents = {{"ns", "decoder/parent"}},
+                                      .assets = {{factory::PolicyData::AssetType::DECODER, {{"ns", decoders}}}}});
+
+    store::Doc asset;
+    EXPECT_CALL(*store, readDoc(testing::_)).WillRepeatedly(testing::Return(storeReadDocResp(asset)));
+    EXPECT_CALL(*assetBuilder, CallableOp(asset)).WillRepeatedly(testing::Return(Asset {}));
+
+    factory::BuiltAssets sequential;
+    factory::BuiltAssets parallel;
+    ASSERT_NO_THROW(sequential = factory::buildAssets(policyData, store, assetBuilder));
+    ASSERT_NO_THROW(parallel = factory::buildAssets(policyData, store, assetBuilder, 4));
+    ASSERT_EQ(parallel, sequential);
+    ASSERT_EQ(parallel.at(factory::PolicyData::AssetType::DECODER).size(), decoders.size());
+    for (const auto& [name, built] : parallel.at(factory::PolicyData::AssetType::DECODER))
+    {
+        ASSERT_EQ(built.parents(), std::vector<base::Name> {base::Name("decoder/parent")});
+    }
+}
+
+TEST(BuildAssetsParallel, FirstErrorStopsTheBuild)
+{
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+
+    std::unordered_set<base::Name> decoders;
+    for (auto i = 0; i < 16; ++i)
+    {
+        decoders.emplace("decoder/asset/" + std::to_string(i));
+    }
+    factory::PolicyData policyData(D {
+        .name = "test", .hash = "test", .assets = {{factory::PolicyData::AssetType::DECODER, {{"ns", decoders}}}}});
+
+    store::Doc asset;
+    EXPECT_CALL(*store, readDoc(testing::_)).WillRepeatedly(testing::Return(storeReadDocResp(asset)));
+    EXPECT_CALL(*assetBuilder, CallableOp(asset)).WillRepeatedly(testing::Throw(std::runtime_error("")));
+
+    ASSERT_THROW(factory::buildAssets(policyData, store, assetBuilder, 4), std::runtime_error);
+}
+TEST(ValidateAssets, ReportsEveryInvalidAsset)
+{
+    auto assetBuilder = std::make_shared<MockAssetBuilder>();
+    auto store = std::make_shared<MockStoreRead>();
+
+    std::unordered_set<base::Name> decoders;
+    for (auto i = 0; i < 8; ++i)
+    {
+        decoders.emplace("decoder/asset/" + std::to_string(i));
+    }
+    factory::PolicyData policyData(D {
+        .name = "test", .hash = "test", .assets = {{factory::PolicyData::AssetType::DECODER, {{"ns", decoders}}}}});
+
+    store::Doc valid {R"({"valid": true})"};
+    store::Doc invalid {R"({"valid": false})"};
+    EXPECT_CALL(*store, readDoc(testing::_))
+        .WillRepeatedly(testing::Invoke(
+            [&](const base::Name& name)
+            { return storeReadDocResp(name.parts().back() == "1" || name.parts().back() == "6" ? invalid : valid); }));
+    EXPECT_CALL(*assetBuilder, CallableOp(valid)).WillRepeatedly(testing::Return(Asset {}));
+    EXPECT_CALL(*assetBuilder, CallableOp(invalid)).WillRepeatedly(testing::Throw(std::runtime_error("invalid")));
+
+    factory::ValidatedAssets validated;
+    ASSERT_NO_THROW(validated = factory::validateAssets(policyData, store, assetBuilder, 4));
+    std::vector<factory::AssetError> expected {{base::Name("decoder/asset/1"), "invalid"},
+                                               {base::Name("decoder/asset/6"), "invalid"}};
+    ASSERT_EQ(validated.errors, expected);
+    ASSERT_EQ(validated.assets.at(factory::PolicyData::AssetType::DECODER).size(), decoders.size() - 2);
+}
 } // namespace buildassetstest
 
 namespace buildgraphtest
@@ -802,3 +882,35 @@ INSTANTIATE_TEST_SUITE_P(
             ));
 
 } // namespace buildexpressiontest
+
+namespace orderbyhitratetest
+{
+void record(
+    metricsManager::AssetStats& stats, const std::string& asset, uint64_t evals, uint64_t successes, uint64_t cost)
+{
+    auto counters = stats.counters(asset);
+    counters->evaluations.add(evals);
+    counters->successes.add(successes);
+    counters->cost.store(cost);
+}
+
+TEST(OrderByHitRate, KeepsOrderWithoutStats)
+{
+    metricsManager::AssetStats stats;
+    std::vector<base::Name> siblings {"decoder/a/0", "decoder/b/0", "decoder/c/0"};
+    EXPECT_EQ(factory::orderByHitRate(siblings, stats), siblings);
+}
+
+TEST(OrderByHitRate, RankedAfterUnranked)
+{
+    metricsManager::AssetStats stats;
+    record(stats, "decoder/a/0", 1000, 10, 2);  // 0.005
+    record(stats, "decoder/b/0", 1000, 500, 5); // 0.1
+    record(stats, "decoder/c/0", 10, 10, 1);    // Not enough evaluations
+    record(stats, "decoder/d/0", 1000, 200, 1); // 0.2
+
+    std::vector<base::Name> siblings {"decoder/a/0", "decoder/b/0", "decoder/c/0", "decoder/d/0", "decoder/e/0"};
+    std::vector<base::Name> expected {"decoder/c/0", "decoder/e/0", "decoder/d/0", "decoder/b/0", "decoder/a/0"};
+    EXPECT_EQ(factory::orderByHitRate(siblings, stats), expected);
+}
+} // namespace orderbyhitratetest
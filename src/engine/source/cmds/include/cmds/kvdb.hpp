@@ -1,6 +1,7 @@
 #ifndef _CMD_KVDB_HPP
 #define _CMD_KVDB_HPP
 
+#include <cstdint>
 #include <string>
 
 #include <CLI/CLI.hpp>
@@ -29,11 +30,14 @@ constexpr auto API_KVDB_SEARCH_SUBCOMMAND {"search"};
 void runList(std::shared_ptr<apiclnt::Client> client, const std::string& kvdbName, bool loaded);
 void runCreate(std::shared_ptr<apiclnt::Client> client,
                const std::string& kvdbName,
-               const std::string& kvdbInputFilePath);
+               const std::string& kvdbInputFilePath,
+               bool memoryResident,
+               std::uint32_t ttl);
 void runDump(std::shared_ptr<apiclnt::Client> client,
              const std::string& kvdbName,
              const unsigned int page,
-             const unsigned int records);
+             const unsigned int records,
+             const bool all);
 void runDelete(std::shared_ptr<apiclnt::Client> client, const std::string& kvdbName);
 void runGetKV(std::shared_ptr<apiclnt::Client> client, const std::string& kvdbName, const std::string& kvdbKey);
 void runInsertKV(std::shared_ptr<apiclnt::Client> client,
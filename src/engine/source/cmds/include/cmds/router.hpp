@@ -77,6 +77,15 @@ void runReload(std::shared_ptr<apiclnt::Client> client, const std::string& nameS
  */
 void runUpdate(std::shared_ptr<apiclnt::Client> client, const std::string& nameStr, int priority);
 
+/**
+ * @brief Updates the events per second a route sends to its policy.
+ *
+ * @param client A shared pointer to the apiclnt::Client instance.
+ * @param nameStr The name of the route to update.
+ * @param eps The new limit of events per second, 0 for no limit.
+ */
+void runLimit(std::shared_ptr<apiclnt::Client> client, const std::string& nameStr, uint eps);
+
 /**
  * @brief Ingests an event into the router with the specified name.
  *
@@ -16,6 +16,12 @@ constexpr auto ENGINE_LOG_OUTPUT_ENV = "WZE_LOG_OUTPUT";
 constexpr auto ENGINE_LOG_TRUNCATE = false;
 constexpr auto ENGINE_LOG_TRUNCATE_ENV = "WZE_LOG_TRUNCATE";
 
+constexpr auto ENGINE_LOG_THREADS = 0;
+constexpr auto ENGINE_LOG_THREADS_ENV = "WZE_LOG_THREADS";
+
+constexpr auto ENGINE_LOG_QUEUE_SIZE = 8192;
+constexpr auto ENGINE_LOG_QUEUE_SIZE_ENV = "WZE_LOG_QUEUE_SIZE";
+
 // Server module
 constexpr auto ENGINE_SRV_PULL_THREADS = 1;
 constexpr auto ENGINE_SRV_PULL_THREADS_ENV = "WZE_PULL_THREADS";
@@ -23,15 +29,58 @@ constexpr auto ENGINE_SRV_PULL_THREADS_ENV = "WZE_PULL_THREADS";
 constexpr auto ENGINE_SRV_EVENT_SOCK = "/var/ossec/queue/sockets/queue";
 constexpr auto ENGINE_SRV_EVENT_SOCK_ENV = "WZE_EVENT_SOCK";
 
+constexpr auto ENGINE_SRV_EVENT_BULK_SOCK = "";
+constexpr auto ENGINE_SRV_EVENT_BULK_SOCK_ENV = "WZE_EVENT_BULK_SOCK";
+
+constexpr auto ENGINE_SRV_EVENT_RING_SOCK = "";
+constexpr auto ENGINE_SRV_EVENT_RING_SOCK_ENV = "WZE_EVENT_RING_SOCK";
+
+constexpr auto ENGINE_SRV_EVENT_RING_SIZE = 16;
+constexpr auto ENGINE_SRV_EVENT_RING_SIZE_ENV = "WZE_EVENT_RING_SIZE";
+
+constexpr auto ENGINE_SRV_EVENT_RING_THREADS = 2;
+constexpr auto ENGINE_SRV_EVENT_RING_THREADS_ENV = "WZE_EVENT_RING_THREADS";
+
+constexpr auto ENGINE_SRV_EVENT_DIVERT_SOCK = "";
+constexpr auto ENGINE_SRV_EVENT_DIVERT_SOCK_ENV = "WZE_EVENT_DIVERT_SOCK";
+
+constexpr auto ENGINE_SRV_AGENT_EVENTS_SOCK = "";
+constexpr auto ENGINE_SRV_AGENT_EVENTS_SOCK_ENV = "WZE_AGENT_EVENTS_SOCK";
+
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK = 0;
 constexpr auto ENGINE_SRV_EVENT_QUEUE_TASK_ENV = "WZE_EVENT_QUEUE_TASK";
 
+constexpr auto ENGINE_SRV_EVENT_THREADS = 0;
+constexpr auto ENGINE_SRV_EVENT_THREADS_ENV = "WZE_EVENT_THREADS";
+
+constexpr auto ENGINE_SRV_CPUS = "";
+constexpr auto ENGINE_SRV_CPUS_ENV = "WZE_SERVER_CPUS";
+
 constexpr auto ENGINE_SRV_API_SOCK = "/var/ossec/queue/sockets/engine-api";
 constexpr auto ENGINE_SRV_API_SOCK_ENV = "WZE_API_SOCK";
 
 constexpr auto ENGINE_SRV_API_QUEUE_TASK = 50;
 constexpr auto ENGINE_SRV_API_QUEUE_TASK_ENV = "WZE_API_QUEUE_TASK";
 
+constexpr auto ENGINE_SRV_API_THREADS = 4;
+constexpr auto ENGINE_SRV_API_THREADS_ENV = "WZE_API_THREADS";
+constexpr auto ENGINE_SRV_API_CONTROL_THREADS = 2;
+constexpr auto ENGINE_SRV_API_CONTROL_THREADS_ENV = "WZE_API_CONTROL_THREADS";
+constexpr auto ENGINE_SRV_API_CONTROL_QUEUE = 50;
+constexpr auto ENGINE_SRV_API_CONTROL_QUEUE_ENV = "WZE_API_CONTROL_QUEUE";
+constexpr auto ENGINE_SRV_API_ADMIN_THREADS = 1;
+constexpr auto ENGINE_SRV_API_ADMIN_THREADS_ENV = "WZE_API_ADMIN_THREADS";
+constexpr auto ENGINE_SRV_API_ADMIN_QUEUE = 20;
+constexpr auto ENGINE_SRV_API_ADMIN_QUEUE_ENV = "WZE_API_ADMIN_QUEUE";
+constexpr auto ENGINE_SRV_API_EVENT_THREADS = 2;
+constexpr auto ENGINE_SRV_API_EVENT_THREADS_ENV = "WZE_API_EVENT_THREADS";
+constexpr auto ENGINE_SRV_API_EVENT_QUEUE = 100;
+constexpr auto ENGINE_SRV_API_EVENT_QUEUE_ENV = "WZE_API_EVENT_QUEUE";
+// Share of the API threads of each class when they compete for them
+constexpr auto ENGINE_SRV_API_CONTROL_WEIGHT = 4;
+constexpr auto ENGINE_SRV_API_ADMIN_WEIGHT = 1;
+constexpr auto ENGINE_SRV_API_EVENT_WEIGHT = 2;
+
 constexpr auto ENGINE_CLIENT_TIMEOUT = 1000;
 constexpr auto ENGINE_SRV_API_TIMEOUT = 1000;
 constexpr auto ENGINE_SRV_API_TIMEOUT_ENV = "WZE_API_TIMEOUT";
@@ -40,10 +89,49 @@ constexpr auto ENGINE_SRV_API_TIMEOUT_ENV = "WZE_API_TIMEOUT";
 constexpr auto ENGINE_DEFAULT_POLICY = "policy/wazuh/0";
 constexpr auto ENGINE_STORE_PATH = "/var/ossec/engine/store";
 constexpr auto ENGINE_STORE_PATH_ENV = "WZE_STORE_PATH";
+constexpr auto ENGINE_STORE_DRIVER = "file";
+constexpr auto ENGINE_STORE_DRIVER_ENV = "WZE_STORE_DRIVER";
+constexpr auto ENGINE_STORE_DB_PATH = "/var/ossec/engine/store_db";
+constexpr auto ENGINE_STORE_DB_PATH_ENV = "WZE_STORE_DB_PATH";
+
+// Builder module
+constexpr auto ENGINE_BUILDER_THREADS = 1;
+constexpr auto ENGINE_BUILDER_THREADS_ENV = "WZE_BUILDER_THREADS";
+
+constexpr auto ENGINE_BUILDER_WDB_UPDATE_ASYNC = false;
+constexpr auto ENGINE_BUILDER_WDB_UPDATE_ASYNC_ENV = "WZE_BUILDER_WDB_UPDATE_ASYNC";
+
+constexpr auto ENGINE_BUILDER_SCA_CACHE_TTL = 0;
+constexpr auto ENGINE_BUILDER_SCA_CACHE_TTL_ENV = "WZE_BUILDER_SCA_CACHE_TTL";
+
+constexpr auto ENGINE_BUILDER_SCA_BATCH_SIZE = 0;
+constexpr auto ENGINE_BUILDER_SCA_BATCH_SIZE_ENV = "WZE_BUILDER_SCA_BATCH_SIZE";
+
+constexpr auto ENGINE_BUILDER_SCA_BATCH_INTERVAL = 1000;
+constexpr auto ENGINE_BUILDER_SCA_BATCH_INTERVAL_ENV = "WZE_BUILDER_SCA_BATCH_INTERVAL";
+
+constexpr auto ENGINE_BUILDER_REORDER_DECODERS = false;
+constexpr auto ENGINE_BUILDER_REORDER_DECODERS_ENV = "WZE_BUILDER_REORDER_DECODERS";
+
+constexpr auto ENGINE_BUILDER_OUTPUT_FLUSH_INTERVAL = 100;
+constexpr auto ENGINE_BUILDER_OUTPUT_FLUSH_INTERVAL_ENV = "WZE_BUILDER_OUTPUT_FLUSH_INTERVAL";
+
+constexpr auto ENGINE_BUILDER_OUTPUT_FSYNC_INTERVAL = 0;
+constexpr auto ENGINE_BUILDER_OUTPUT_FSYNC_INTERVAL_ENV = "WZE_BUILDER_OUTPUT_FSYNC_INTERVAL";
 
 // KVDB module
 constexpr auto ENGINE_KVDB_PATH = "/var/ossec/etc/kvdb/";
 constexpr auto ENGINE_KVDB_PATH_ENV = "WZE_KVDB_PATH";
+constexpr auto ENGINE_KVDB_CACHE_SIZE = 0;
+constexpr auto ENGINE_KVDB_CACHE_SIZE_ENV = "WZE_KVDB_CACHE_SIZE";
+constexpr auto ENGINE_KVDB_BLOOM_BITS = 10;
+constexpr auto ENGINE_KVDB_BLOOM_BITS_ENV = "WZE_KVDB_BLOOM_BITS";
+
+// RocksDB
+constexpr auto ENGINE_ROCKSDB_CACHE_SIZE = 128;
+constexpr auto ENGINE_ROCKSDB_CACHE_SIZE_ENV = "WZE_ROCKSDB_CACHE_SIZE";
+constexpr auto ENGINE_ROCKSDB_WRITE_BUFFER_SIZE = 128;
+constexpr auto ENGINE_ROCKSDB_WRITE_BUFFER_SIZE_ENV = "WZE_ROCKSDB_WRITE_BUFFER_SIZE";
 
 // TZDB
 constexpr auto ENGINE_TZDB_PATH = "/var/ossec/engine/tzdb";
@@ -58,6 +146,48 @@ constexpr auto ENGINE_KVDB_CLI_RECORDS = 50;
 constexpr auto ENGINE_ROUTER_THREADS = 1;
 constexpr auto ENGINE_ROUTER_THREADS_ENV = "WZE_ROUTER_THREADS";
 
+constexpr auto ENGINE_ROUTER_TEST_THREADS = 0;
+constexpr auto ENGINE_ROUTER_TEST_THREADS_ENV = "WZE_ROUTER_TEST_THREADS";
+
+constexpr auto ENGINE_ROUTER_TESTER_IDLE_TIMEOUT = 0;
+constexpr auto ENGINE_ROUTER_TESTER_IDLE_TIMEOUT_ENV = "WZE_ROUTER_TESTER_IDLE_TIMEOUT";
+
+constexpr auto ENGINE_ROUTER_SHARE_BUILDS = false;
+constexpr auto ENGINE_ROUTER_SHARE_BUILDS_ENV = "WZE_ROUTER_SHARE_BUILDS";
+
+constexpr auto ENGINE_ROUTER_BACKGROUND_LOAD = true;
+constexpr auto ENGINE_ROUTER_BACKGROUND_LOAD_ENV = "WZE_ROUTER_BACKGROUND_LOAD";
+
+constexpr auto ENGINE_ROUTER_BATCH_SIZE = 1;
+constexpr auto ENGINE_ROUTER_BATCH_SIZE_ENV = "WZE_ROUTER_BATCH_SIZE";
+
+constexpr auto ENGINE_ROUTER_BATCH_LINGER = 0;
+constexpr auto ENGINE_ROUTER_BATCH_LINGER_ENV = "WZE_ROUTER_BATCH_LINGER";
+
+constexpr auto ENGINE_ROUTER_LATENCY_SAMPLE_RATE = 0;
+constexpr auto ENGINE_ROUTER_LATENCY_SAMPLE_RATE_ENV = "WZE_ROUTER_LATENCY_SAMPLE_RATE";
+
+constexpr auto ENGINE_ROUTER_CPUS = "";
+constexpr auto ENGINE_ROUTER_CPUS_ENV = "WZE_ROUTER_CPUS";
+
+constexpr auto ENGINE_ROUTER_MAX_THREADS = 0;
+constexpr auto ENGINE_ROUTER_MAX_THREADS_ENV = "WZE_ROUTER_MAX_THREADS";
+
+constexpr auto ENGINE_ROUTER_SCALE_DEPTH = 1000;
+constexpr auto ENGINE_ROUTER_SCALE_DEPTH_ENV = "WZE_ROUTER_SCALE_DEPTH";
+
+constexpr auto ENGINE_ROUTER_SCALE_INTERVAL = 1000;
+constexpr auto ENGINE_ROUTER_SCALE_INTERVAL_ENV = "WZE_ROUTER_SCALE_INTERVAL";
+
+constexpr auto ENGINE_ROUTER_EVENT_BUDGET = 0;
+constexpr auto ENGINE_ROUTER_EVENT_BUDGET_ENV = "WZE_ROUTER_EVENT_BUDGET";
+
+constexpr auto ENGINE_ROUTER_EVENT_BUDGET_CHECKS = "asset";
+constexpr auto ENGINE_ROUTER_EVENT_BUDGET_CHECKS_ENV = "WZE_ROUTER_EVENT_BUDGET_CHECKS";
+
+constexpr auto ENGINE_ROUTER_DEAD_LETTER_FILE = "";
+constexpr auto ENGINE_ROUTER_DEAD_LETTER_FILE_ENV = "WZE_ROUTER_DEAD_LETTER_FILE";
+
 // Maxmind module
 constexpr auto ENGINE_MMDB_ASN_PATH = "";
 constexpr auto ENGINE_MMDB_ASN_PATH_ENV = "WZE_MMDB_ASN_PATH";
@@ -78,6 +208,22 @@ constexpr auto ENGINE_QUEUE_FLOOD_ATTEMPTS_ENV = "WZE_QUEUE_FLOOD_ATTEMPTS";
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP = 100;
 constexpr auto ENGINE_QUEUE_FLOOD_SLEEP_ENV = "WZE_QUEUE_FLOOD_SLEEP";
 
+constexpr auto ENGINE_QUEUE_SHARDED = false;
+constexpr auto ENGINE_QUEUE_SHARDED_ENV = "WZE_QUEUE_SHARDED";
+
+constexpr auto ENGINE_QUEUE_SHARD_STEAL = true;
+constexpr auto ENGINE_QUEUE_SHARD_STEAL_ENV = "WZE_QUEUE_SHARD_STEAL";
+
+constexpr auto ENGINE_QUEUE_LANES = "";
+constexpr auto ENGINE_QUEUE_LANES_ENV = "WZE_QUEUE_LANES";
+
+// Metrics module
+constexpr auto ENGINE_METRICS_ADDRESS = "127.0.0.1";
+constexpr auto ENGINE_METRICS_ADDRESS_ENV = "WZE_METRICS_ADDRESS";
+
+constexpr auto ENGINE_METRICS_PORT = 0;
+constexpr auto ENGINE_METRICS_PORT_ENV = "WZE_METRICS_PORT";
+
 // RBAC Module
 constexpr auto ENGINE_RBAC_ROLE = "user-developer";
 
@@ -18,7 +18,10 @@ struct Options
     std::string kvdbName {};
     std::uint32_t page {};
     std::uint32_t records {};
+    bool all {false};
     std::string kvdbInputFilePath {};
+    bool memoryResident {false};
+    std::uint32_t ttl {};
     std::string kvdbKey {};
     std::string kvdbValue {};
     std::string prefix {};
@@ -61,7 +64,9 @@ void runList(std::shared_ptr<apiclnt::Client> client, const std::string& kvdbNam
 
 void runCreate(std::shared_ptr<apiclnt::Client> client,
                const std::string& kvdbName,
-               const std::string& kvdbInputFilePath)
+               const std::string& kvdbInputFilePath,
+               bool memoryResident,
+               std::uint32_t ttl)
 {
     using RequestType = eKVDB::managerPost_Request;
     using ResponseType = eEngine::GenericStatus_Response;
@@ -70,6 +75,14 @@ void runCreate(std::shared_ptr<apiclnt::Client> client,
     // Prepare the request
     RequestType eRequest;
     eRequest.set_name(kvdbName);
+    if (memoryResident)
+    {
+        eRequest.set_memory_resident(true);
+    }
+    if (ttl > 0)
+    {
+        eRequest.set_ttl(ttl);
+    }
 
     if (!kvdbInputFilePath.empty())
     {
@@ -92,7 +105,8 @@ void runCreate(std::shared_ptr<apiclnt::Client> client,
 void runDump(std::shared_ptr<apiclnt::Client> client,
              const std::string& kvdbName,
              const unsigned int page,
-             const unsigned int records)
+             const unsigned int records,
+             const bool all)
 {
     using RequestType = eKVDB::managerDump_Request;
     using ResponseType = eKVDB::managerDump_Response;
@@ -105,13 +119,29 @@ void runDump(std::shared_ptr<apiclnt::Client> client,
     eRequest.set_page(page);
     eRequest.set_records(records);
 
-    // Call the API
-    const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
-    const auto response = client->send(request);
-    const auto eResponse = utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+    // The whole DB is retrieved in pages of records entries, each one continuing after the cursor of the previous
+    if (all)
+    {
+        eRequest.set_cursor("");
+    }
+
+    google::protobuf::RepeatedPtrField<eKVDB::Entry> dump;
+    while (true)
+    {
+        // Call the API
+        const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
+        const auto response = client->send(request);
+        auto eResponse = utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+
+        dump.MergeFrom(eResponse.entries());
+        if (!all || !eResponse.has_next_cursor())
+        {
+            break;
+        }
+        eRequest.set_cursor(eResponse.next_cursor());
+    }
 
     // Print the dump
-    const auto& dump = eResponse.entries();
     const auto json = eMessage::eRepeatedFieldToJson<eKVDB::Entry>(dump);
     std::cout << std::get<std::string>(json) << std::endl;
 }
@@ -283,11 +313,20 @@ void configure(const CLI::App_p& app)
                      "The file must be a JSON file with the following format: {\"key\": VALUE} "
                      "where VALUE can be any JSON type.")
         ->check(CLI::ExistingFile);
+    // create kvdb memory-resident
+    create_subcommand->add_flag("--memory_resident",
+                                options->memoryResident,
+                                "Keep the whole KVDB in memory, its lookups are answered without disk I/O.");
+    // create kvdb with expiring entries
+    create_subcommand->add_option("--ttl",
+                                  options->ttl,
+                                  "Seconds each entry lives after it is written, the expired entries are absent and "
+                                  "dropped from the disk. If not provided, the entries never expire.");
     create_subcommand->callback(
         [options]()
         {
             const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
-            runCreate(client, options->kvdbName, options->kvdbInputFilePath);
+            runCreate(client, options->kvdbName, options->kvdbInputFilePath, options->memoryResident, options->ttl);
         });
 
     // KVDB dump subcommand
@@ -299,11 +338,12 @@ void configure(const CLI::App_p& app)
         ->default_val(ENGINE_KVDB_CLI_PAGE);
     dump_subcommand->add_option("-r, --records", options->records, "Number of records per page.")
         ->default_val(ENGINE_KVDB_CLI_RECORDS);
+    dump_subcommand->add_flag("-a, --all", options->all, "Dump all the pages, the page number is ignored.");
     dump_subcommand->callback(
         [options]()
         {
             const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
-            runDump(client, options->kvdbName, options->page, options->records);
+            runDump(client, options->kvdbName, options->page, options->records, options->all);
         });
 
     // KVDB delete subcommand
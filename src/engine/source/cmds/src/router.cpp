@@ -159,6 +159,23 @@ void runUpdate(std::shared_ptr<apiclnt::Client> client, const std::string& nameS
     utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
 }
 
+void runLimit(std::shared_ptr<apiclnt::Client> client, const std::string& nameStr, uint eps)
+{
+    using RequestType = eRouter::RoutePatchEpsLimit_Request;
+    using ResponseType = eEngine::GenericStatus_Response;
+    const std::string command = "router.route/patchEpsLimit";
+
+    // Prepare the request
+    RequestType eRequest;
+    eRequest.set_name(nameStr);
+    eRequest.set_eps_limit(eps);
+
+    // Call the API, any error will throw an cmd::exception
+    const auto request = utils::apiAdapter::toWazuhRequest<RequestType>(command, details::ORIGIN_NAME, eRequest);
+    const auto response = client->send(request);
+    utils::apiAdapter::fromWazuhResponse<ResponseType>(response);
+}
+
 void runReload(std::shared_ptr<apiclnt::Client> client, const std::string& nameStr)
 {
     using RequestType = eRouter::RouteReload_Request;
@@ -336,6 +353,17 @@ void configure(CLI::App_p app)
             runUpdate(client, options->name, options->priority);
         });
 
+    // Limit
+    auto limitSubcommand = routerApp->add_subcommand("limit", "Limit the events per second of a route.");
+    limitSubcommand->add_option("name", options->name, "Name of the route to limit.")->required();
+    limitSubcommand->add_option("eps", options->eps, "Events per second, 0 for no limit.")->required();
+    limitSubcommand->callback(
+        [options]()
+        {
+            const auto client = std::make_shared<apiclnt::Client>(options->serverApiSock, options->clientTimeout);
+            runLimit(client, options->name, options->eps);
+        });
+
     // Reload
     auto reloadSubcommand = routerApp->add_subcommand("reload", "Try to reconstruct a route.");
     reloadSubcommand->add_option("name", options->name, "Name of the route to modify.")->required();
@@ -1,9 +1,13 @@
 #include "cmds/start.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <csignal>
 #include <exception>
+#include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <thread>
@@ -32,18 +36,28 @@
 #include <logpar/logpar.hpp>
 #include <logpar/registerParsers.hpp>
 #include <metrics/metricsManager.hpp>
+#include <metrics/openMetricsEndpoint.hpp>
 #include <base/parseEvent.hpp>
+#include <base/utils/cpuAffinity.hpp>
+#include <base/utils/rocksDBResources.hpp>
 #include <queue/concurrentQueue.hpp>
+#include <queue/laneQueue.hpp>
+#include <queue/shardedQueue.hpp>
 #include <rbac/rbac.hpp>
 #include <router/orchestrator.hpp>
 #include <schemf/schema.hpp>
 #include <server/endpoints/unixDatagram.hpp> // Event
+#include <server/endpoints/unixShmRing.hpp>
 #include <server/endpoints/unixStream.hpp>   //API
 #include <server/engineServer.hpp>
+#include <server/scheduler.hpp>
 #include <server/protocolHandlers/wStream.hpp>
+#include <sockiface/unixDatagram.hpp>
 #include <sockiface/unixSocketFactory.hpp>
 #include <store/drivers/fileDriver.hpp>
+#include <store/drivers/rocksDBDriver.hpp>
 #include <store/store.hpp>
+#include <wdb/agentCache.hpp>
 #include <wdb/wdbManager.hpp>
 
 #include "base/utils/getExceptionStack.hpp"
@@ -72,29 +86,82 @@ struct Options
     // Server
     int serverThreads;
     std::string serverEventSock;
+    std::string serverEventBulkSock;
+    std::string serverEventRingSock;
+    int serverEventRingSize;
+    int serverEventRingThreads;
+    std::string serverEventDivertSock;
+    std::string serverAgentEventsSock;
     int serverEventQueueSize;
+    int serverEventThreads;
+    std::string serverCpus;
     std::string serverApiSock;
     int serverApiQueueSize;
     int serverApiTimeout;
+    int serverApiThreads;
+    int serverApiControlThreads;
+    int serverApiControlQueue;
+    int serverApiAdminThreads;
+    int serverApiAdminQueue;
+    int serverApiEventThreads;
+    int serverApiEventQueue;
     // Store
     std::string fileStorage;
+    std::string storeDriver;
+    std::string storeDbPath;
+    // Builder
+    int builderThreads;
+    bool builderWdbUpdateAsync;
+    int builderScaCacheTtl;
+    int builderScaBatchSize;
+    int builderScaBatchInterval;
+    bool builderReorderDecoders;
+    int builderOutputFlushInterval;
+    int builderOutputFsyncInterval;
     // KVDB
     std::string kvdbPath;
+    int kvdbCacheSize;
+    int kvdbBloomBits;
+    // RocksDB
+    int rocksdbCacheSize;
+    int rocksdbWriteBufferSize;
     // Orchestration
     int routerThreads;
+    int routerTestThreads;
+    int routerTesterIdleTimeout;
+    bool routerShareBuilds;
+    bool routerBackgroundLoad;
+    int routerBatchSize;
+    int routerBatchLinger;
+    int routerLatencySampleRate;
+    std::string routerCpus;
+    int routerMaxThreads;
+    int routerScaleDepth;
+    int routerScaleInterval;
+    int routerEventBudget;
+    std::string routerEventBudgetChecks;
+    std::string routerDeadLetterFile;
     // Queue
     int queueSize;
     std::string queueFloodFile;
     int queueFloodAttempts;
     int queueFloodSleep;
     bool queueDropFlood;
+    bool queueSharded;
+    bool queueShardSteal;
+    std::string queueLanes;
     // Loggin
     std::string level;
     std::string logOutput;
     bool logTruncate;
+    int logThreads;
+    int logQueueSize;
     // TZ_DB
     std::string tzdbPath;
     bool tzdbAutoUpdate;
+    // Metrics
+    std::string metricsAddress;
+    int metricsPort;
 };
 
 } // namespace
@@ -113,38 +180,95 @@ void runStart(ConfHandler confManager)
     const auto level = confManager->get<std::string>("server.log_level");
     const auto logOutput = confManager->get<std::string>("server.log_output");
     const auto logTruncate = confManager->get<bool>("server.log_truncate");
+    const auto logThreads = confManager->get<int>("server.log_threads");
+    const auto logQueueSize = confManager->get<int>("server.log_queue_size");
 
     // Server config
     const auto serverThreads = confManager->get<int>("server.server_threads");
     const auto serverEventSock = confManager->get<std::string>("server.event_socket");
+    const auto serverEventBulkSock = confManager->get<std::string>("server.event_bulk_socket");
+    const auto serverEventRingSock = confManager->get<std::string>("server.event_ring_socket");
+    const auto serverEventRingSize = confManager->get<int>("server.event_ring_size");
+    const auto serverEventRingThreads = confManager->get<int>("server.event_ring_threads");
+    const auto serverEventDivertSock = confManager->get<std::string>("server.event_divert_socket");
+    const auto serverAgentEventsSock = confManager->get<std::string>("server.agent_events_socket");
     const auto serverEventQueueSize = confManager->get<int>("server.event_queue_tasks");
+    const auto serverEventThreads = confManager->get<int>("server.event_threads");
+    const auto serverCpus = confManager->get<std::string>("server.server_cpus");
     const auto serverApiSock = confManager->get<std::string>("server.api_socket");
     const auto serverApiQueueSize = confManager->get<int>("server.api_queue_tasks");
     const auto serverApiTimeout = confManager->get<int>("server.api_timeout");
+    const auto serverApiThreads = confManager->get<int>("server.api_threads");
+    const auto serverApiControlThreads = confManager->get<int>("server.api_control_threads");
+    const auto serverApiControlQueue = confManager->get<int>("server.api_control_queue");
+    const auto serverApiAdminThreads = confManager->get<int>("server.api_admin_threads");
+    const auto serverApiAdminQueue = confManager->get<int>("server.api_admin_queue");
+    const auto serverApiEventThreads = confManager->get<int>("server.api_event_threads");
+    const auto serverApiEventQueue = confManager->get<int>("server.api_event_queue");
 
     // Store config
     const auto fileStorage = confManager->get<std::string>("server.store_path");
+    const auto storeDriver = confManager->get<std::string>("server.store_driver");
+    const auto storeDbPath = confManager->get<std::string>("server.store_db_path");
+
+    // Metrics config
+    const auto metricsAddress = confManager->get<std::string>("server.metrics_address");
+    const auto metricsPort = confManager->get<int>("server.metrics_port");
 
     // Logging init
     logging::LoggingConfig logConfig;
     logConfig.level = logging::strToLevel(level);
     logConfig.truncate = logTruncate;
     logConfig.filePath = logOutput;
+    logConfig.dedicatedThreads = static_cast<uint32_t>(logThreads);
+    logConfig.queueSize = static_cast<uint32_t>(logQueueSize);
 
     exitHandler.add([]() { logging::stop(); });
     logging::start(logConfig);
 
-    LOG_DEBUG("Logging configuration: filePath='{}', level='{}', flushInterval={}ms.",
+    LOG_DEBUG("Logging configuration: filePath='{}', level='{}', flushInterval={}ms, threads={}, queueSize={}.",
               logConfig.filePath,
               logging::levelToStr(logConfig.level),
-              logConfig.flushInterval);
+              logConfig.flushInterval,
+              logConfig.dedicatedThreads,
+              logConfig.queueSize);
     LOG_INFO("Logging initialized.");
 
+    // Builder config
+    const auto builderThreads = confManager->get<int>("server.builder_threads");
+    const auto builderWdbUpdateAsync = confManager->get<bool>("server.builder_wdb_update_async");
+    const auto builderScaCacheTtl = confManager->get<int>("server.builder_sca_cache_ttl");
+    const auto builderScaBatchSize = confManager->get<int>("server.builder_sca_batch_size");
+    const auto builderScaBatchInterval = confManager->get<int>("server.builder_sca_batch_interval");
+    const auto builderReorderDecoders = confManager->get<bool>("server.builder_reorder_decoders");
+    const auto builderOutputFlushInterval = confManager->get<int>("server.builder_output_flush_interval");
+    const auto builderOutputFsyncInterval = confManager->get<int>("server.builder_output_fsync_interval");
+
     // KVDB config
     const auto kvdbPath = confManager->get<std::string>("server.kvdb_path");
+    const auto kvdbCacheSize = confManager->get<int>("server.kvdb_cache_size");
+    const auto kvdbBloomBits = confManager->get<int>("server.kvdb_bloom_bits");
+
+    // RocksDB config
+    const auto rocksdbCacheSize = confManager->get<int>("server.rocksdb_cache_size");
+    const auto rocksdbWriteBufferSize = confManager->get<int>("server.rocksdb_write_buffer_size");
 
     // Router Config
     const auto routerThreads = confManager->get<int>("server.router_threads");
+    const auto routerTestThreads = confManager->get<int>("server.router_test_threads");
+    const auto routerTesterIdleTimeout = confManager->get<int>("server.router_tester_idle_timeout");
+    const auto routerShareBuilds = confManager->get<bool>("server.router_share_builds");
+    const auto routerBackgroundLoad = confManager->get<bool>("server.router_background_load");
+    const auto routerBatchSize = confManager->get<int>("server.router_batch_size");
+    const auto routerBatchLinger = confManager->get<int>("server.router_batch_linger");
+    const auto routerLatencySampleRate = confManager->get<int>("server.router_latency_sample_rate");
+    const auto routerCpus = confManager->get<std::string>("server.router_cpus");
+    const auto routerMaxThreads = confManager->get<int>("server.router_max_threads");
+    const auto routerScaleDepth = confManager->get<int>("server.router_scale_depth");
+    const auto routerScaleInterval = confManager->get<int>("server.router_scale_interval");
+    const auto routerEventBudget = confManager->get<int>("server.router_event_budget");
+    const auto routerEventBudgetChecks = confManager->get<std::string>("server.router_event_budget_checks");
+    const auto routerDeadLetterFile = confManager->get<std::string>("server.router_dead_letter_file");
 
     // Queue config
     const auto queueSize = confManager->get<int>("server.queue_size");
@@ -152,6 +276,9 @@ void runStart(ConfHandler confManager)
     const auto queueFloodAttempts = confManager->get<int>("server.queue_flood_attempts");
     const auto queueFloodSleep = confManager->get<int>("server.queue_flood_sleep");
     const auto queueDropFlood = confManager->get<bool>("server.queue_drop_flood");
+    const auto queueSharded = confManager->get<bool>("server.queue_sharded");
+    const auto queueShardSteal = confManager->get<bool>("server.queue_shard_steal");
+    const auto queueLanes = confManager->get<std::string>("server.queue_lanes");
 
     // TZDB config
     const auto tzdbPath = confManager->get<std::string>("server.tzdb_path");
@@ -191,6 +318,7 @@ void runStart(ConfHandler confManager)
     std::shared_ptr<schemf::Schema> schema;
     std::shared_ptr<sockiface::UnixSocketFactory> sockFactory;
     std::shared_ptr<wazuhdb::WDBManager> wdbManager;
+    std::shared_ptr<wazuhdb::AgentCache> agentCache;
     std::shared_ptr<rbac::RBAC> rbac;
     std::shared_ptr<api::policy::IPolicy> policyManager;
 
@@ -198,78 +326,133 @@ void runStart(ConfHandler confManager)
     {
         metrics = std::make_shared<metricsManager::MetricsManager>();
 
-        // Store
+        // OpenMetrics endpoint, enabled before creating any scope so all of them are exposed
+        if (metricsPort != 0)
         {
-            auto fileDriver = std::make_shared<store::drivers::FileDriver>(fileStorage);
-            store = std::make_shared<store::Store>(fileDriver);
-            LOG_INFO("Store initialized.");
+            auto endpoint = std::make_shared<metricsManager::OpenMetricsEndpoint>(
+                metrics->enableOpenMetrics(), metricsAddress, metricsPort);
+            endpoint->start();
+            exitHandler.add([endpoint]() { endpoint->stop(); });
         }
 
-        // RBAC
+        // Budget of the block cache and the memtables shared by the RocksDB databases, before any of them is opened
         {
-            rbac = std::make_shared<rbac::RBAC>(store);
-            LOG_INFO("RBAC initialized.");
+            utils::rocksdb::RocksDBResources::Budget budget;
+            budget.blockCacheSize = static_cast<std::size_t>(rocksdbCacheSize) * 1024 * 1024;
+            budget.writeBufferSize = static_cast<std::size_t>(rocksdbWriteBufferSize) * 1024 * 1024;
+            utils::rocksdb::RocksDBResources::configure(budget);
         }
 
-        // KVDB
-        {
-            kvdbManager::KVDBManagerOptions kvdbOptions {kvdbPath, "kvdb"};
-            kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
-            kvdbManager->initialize();
-            LOG_INFO("KVDB initialized.");
-            exitHandler.add(
-                [kvdbManager]()
-                {
-                    kvdbManager->finalize();
-                    LOG_INFO("KVDB terminated.");
-                });
-        }
-
-        // GEO
-        {
-            // TODO: This is a optional right now, but it be mandatory in the future
-            auto geoDownloader = std::make_shared<geo::Downloader>();
-            geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
-            LOG_INFO("Geo initialized.");
-        }
-
-        // Schema
+        // Store
         {
-            schema = std::make_shared<schemf::Schema>();
-            auto result = store->readInternalDoc("schema/engine-schema/0");
-            if (std::holds_alternative<base::Error>(result))
+            std::shared_ptr<store::IDriver> driver;
+            if (storeDriver == "rocksdb")
             {
-                LOG_WARNING("Error loading schema definition: {}", std::get<base::Error>(result).message);
-                LOG_WARNING("Engine running without schema, consistency with indexer mappings is not guaranteed.");
+                auto dbDriver = std::make_shared<store::drivers::RocksDBDriver>(storeDbPath, true);
+                // The first time the database is used, the assets of the file store are migrated
+                auto root = dbDriver->readRoot();
+                if (!base::isError(root) && base::getResponse<store::Col>(root).empty())
+                {
+                    auto imported = dbDriver->importFrom(store::drivers::FileDriver(fileStorage));
+                    if (base::isError(imported))
+                    {
+                        throw std::runtime_error(fmt::format("Store could not be imported from '{}': {}",
+                                                             fileStorage,
+                                                             base::getError(imported).message));
+                    }
+                    LOG_INFO("Store imported {} documents from '{}'.",
+                             base::getResponse<std::size_t>(imported),
+                             fileStorage);
+                }
+                driver = dbDriver;
             }
             else
             {
-                auto schemaJson = std::get<json::Json>(result);
-                schema->load(schemaJson);
+                driver = std::make_shared<store::drivers::FileDriver>(fileStorage);
             }
-            LOG_INFO("Schema initialized.");
+            store = std::make_shared<store::Store>(driver);
+            LOG_INFO("Store initialized.");
         }
 
-        // HLP
+        // RBAC
         {
-            hlp::initTZDB(tzdbPath, tzdbAutoUpdate);
+            rbac = std::make_shared<rbac::RBAC>(store);
+            LOG_INFO("RBAC initialized.");
+        }
 
-            base::Name hlpConfigFileName({"schema", "wazuh-logpar-types", "0"});
-            auto hlpParsers = store->readInternalDoc(hlpConfigFileName);
-            if (std::holds_alternative<base::Error>(hlpParsers))
+        // KVDB, GEO and the schema with HLP only depend on the store, they are initialized at once
+        auto kvdbInit = std::async(
+            std::launch::async,
+            [&]()
+            {
+                kvdbManager::KVDBManagerOptions kvdbOptions {
+                    kvdbPath, "kvdb", static_cast<std::size_t>(kvdbCacheSize) * 1024 * 1024, kvdbBloomBits};
+                kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbOptions, metrics);
+                kvdbManager->initialize();
+                LOG_INFO("KVDB initialized.");
+            });
+
+        auto geoInit = std::async(
+            std::launch::async,
+            [&]()
+            {
+                // TODO: This is a optional right now, but it be mandatory in the future
+                auto geoDownloader = std::make_shared<geo::Downloader>();
+                geoManager = std::make_shared<geo::Manager>(store, geoDownloader);
+                LOG_INFO("Geo initialized.");
+            });
+
+        auto hlpInit = std::async(
+            std::launch::async,
+            [&]()
             {
-                LOG_ERROR("Could not retreive configuration file [{}] needed by the "
-                          "HLP module, error: {}",
-                          hlpConfigFileName.fullName(),
-                          std::get<base::Error>(hlpParsers).message);
+                // Schema
+                schema = std::make_shared<schemf::Schema>();
+                auto result = store->readInternalDoc("schema/engine-schema/0");
+                if (std::holds_alternative<base::Error>(result))
+                {
+                    LOG_WARNING("Error loading schema definition: {}", std::get<base::Error>(result).message);
+                    LOG_WARNING(
+                        "Engine running without schema, consistency with indexer mappings is not guaranteed.");
+                }
+                else
+                {
+                    auto schemaJson = std::get<json::Json>(result);
+                    schema->load(schemaJson);
+                }
+                LOG_INFO("Schema initialized.");
 
-                exitHandler.execute();
-                return;
-            }
-            logpar = std::make_shared<hlp::logpar::Logpar>(std::get<json::Json>(hlpParsers), schema);
-            hlp::registerParsers(logpar);
-            LOG_INFO("HLP initialized.");
-        }
+                // HLP
+                hlp::initTZDB(tzdbPath, tzdbAutoUpdate);
+
+                base::Name hlpConfigFileName({"schema", "wazuh-logpar-types", "0"});
+                auto hlpParsers = store->readInternalDoc(hlpConfigFileName);
+                if (std::holds_alternative<base::Error>(hlpParsers))
+                {
+                    throw std::runtime_error(fmt::format("Could not retreive configuration file [{}] needed by the "
+                                                         "HLP module, error: {}",
+                                                         hlpConfigFileName.fullName(),
+                                                         std::get<base::Error>(hlpParsers).message));
+                }
+                logpar = std::make_shared<hlp::logpar::Logpar>(std::get<json::Json>(hlpParsers), schema);
+                hlp::registerParsers(logpar);
+                LOG_INFO("HLP initialized.");
+            });
+
+        // All of them are waited for before any error is raised, so the KVDB is finalized if another one failed
+        kvdbInit.wait();
+        geoInit.wait();
+        hlpInit.wait();
+
+        kvdbInit.get();
+        exitHandler.add(
+            [kvdbManager]()
+            {
+                kvdbManager->finalize();
+                LOG_INFO("KVDB terminated.");
+            });
+        geoInit.get();
+        hlpInit.get();
 
         // Builder and registry
         {
@@ -281,7 +464,33 @@ void runStart(ConfHandler confManager)
             builderDeps.sockFactory = std::make_shared<sockiface::UnixSocketFactory>();
             builderDeps.wdbManager =
                 std::make_shared<wazuhdb::WDBManager>(std::string(wazuhdb::WDB_SOCK_PATH), builderDeps.sockFactory);
+            builderDeps.wdbUpdateAsync = builderWdbUpdateAsync;
+            builderDeps.scaCacheTtl = static_cast<std::size_t>(builderScaCacheTtl);
+            builderDeps.scaBatchSize = static_cast<std::size_t>(builderScaBatchSize);
+            builderDeps.scaBatchInterval = static_cast<std::size_t>(builderScaBatchInterval);
+
+            // Agent metadata of agent_info, kept current by the agent change notifications of wazuh-db
+            if (!serverAgentEventsSock.empty())
+            {
+                agentCache = std::make_shared<wazuhdb::AgentCache>(builderDeps.wdbManager);
+                try
+                {
+                    LOG_INFO("Agent cache loaded with {} agents.", agentCache->load());
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_WARNING("The agent cache could not be loaded, the agents are added as their change "
+                                "notifications arrive: {}",
+                                e.what());
+                }
+                builderDeps.agentCache = agentCache;
+            }
             builderDeps.geoManager = geoManager;
+            builderDeps.buildThreads = static_cast<std::size_t>(builderThreads);
+            builderDeps.reorderDecoders = builderReorderDecoders;
+            builderDeps.outputFlushInterval = static_cast<std::size_t>(builderOutputFlushInterval);
+            builderDeps.outputFsyncInterval = static_cast<std::size_t>(builderOutputFsyncInterval);
+            builderDeps.metricsManager = metrics;
             auto defs = std::make_shared<defs::DefinitionsBuilder>();
             builder = std::make_shared<builder::Builder>(store, schema, defs, builderDeps);
             LOG_INFO("Builder initialized.");
@@ -307,16 +516,87 @@ void runStart(ConfHandler confManager)
             using QEventType = base::queue::ConcurrentQueue<base::Event, QueueTraits>;
             using QTestType = base::queue::ConcurrentQueue<router::test::QueueType>;
 
-            std::shared_ptr<QEventType> eventQueue {};
+            std::shared_ptr<router::ProdQueueType> eventQueue {};
+            std::vector<std::shared_ptr<router::ProdQueueType>> eventShards {};
             std::shared_ptr<QTestType> testQueue {};
             {
                 auto scope = metrics->getMetricsScope("EventQueue");
                 auto scopeDelta = metrics->getMetricsScope("EventQueueDelta");
-                // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
-                eventQueue = std::make_shared<QEventType>(
-                    queueSize, scope, scopeDelta, queueFloodFile, queueFloodAttempts, queueFloodSleep, queueDropFlood);
 
-                LOG_DEBUG("Event queue created.");
+                // Prioritized lanes by the Wazuh queue id of the events, each one with its own flooding policy
+                const auto lanes = base::queue::parseLaneSpecs(queueLanes);
+                auto makeEventQueue = [&](int capacity, const std::string& floodFile)
+                {
+                    using base::queue::LaneFlood;
+                    if (lanes.empty())
+                    {
+                        return std::shared_ptr<router::ProdQueueType>(std::make_shared<QEventType>(capacity,
+                                                                                                  scope,
+                                                                                                  scopeDelta,
+                                                                                                  floodFile,
+                                                                                                  queueFloodAttempts,
+                                                                                                  queueFloodSleep,
+                                                                                                  queueDropFlood));
+                    }
+
+                    std::vector<base::queue::LaneQueue<base::Event>::Lane> eventLanes;
+                    for (std::size_t i = 0; i < lanes.size(); ++i)
+                    {
+                        const auto flood = lanes[i].flood.value_or(queueDropFlood      ? LaneFlood::DROP
+                                                                   : floodFile.empty() ? LaneFlood::BLOCK
+                                                                                       : LaneFlood::SPILL);
+                        if (flood == LaneFlood::SPILL && floodFile.empty())
+                        {
+                            throw std::runtime_error(
+                                fmt::format("The lane '{}' spills its events but there is no queue flood file",
+                                            lanes[i].queues));
+                        }
+
+                        const auto laneFloodFile =
+                            flood == LaneFlood::SPILL ? fmt::format("{}.lane{}", floodFile, i) : std::string {};
+                        eventLanes.push_back({std::make_shared<QEventType>(capacity,
+                                                                           scope,
+                                                                           scopeDelta,
+                                                                           laneFloodFile,
+                                                                           queueFloodAttempts,
+                                                                           queueFloodSleep,
+                                                                           flood == LaneFlood::DROP),
+                                              lanes[i].weight});
+                    }
+
+                    auto laneOf = [table = base::queue::laneTable(lanes)](const base::Event& event)
+                    { return table[static_cast<unsigned char>(base::parseEvent::queueId(event))]; };
+                    return std::shared_ptr<router::ProdQueueType>(
+                        std::make_shared<base::queue::LaneQueue<base::Event>>(std::move(eventLanes), laneOf));
+                };
+
+                // TODO queueFloodFile, queueFloodAttempts, queueFloodSleep -> Move to Queue.flood options
+                if (!queueSharded)
+                {
+                    eventQueue = makeEventQueue(queueSize, queueFloodFile);
+                    LOG_DEBUG("Event queue created ({} lanes).", std::max<std::size_t>(1, lanes.size()));
+                }
+                else
+                {
+                    // One shard per router worker, the events of an agent always go to the same worker
+                    std::vector<std::shared_ptr<router::ProdQueueType>> shards;
+                    const auto shardSize = std::max(1, queueSize / routerThreads);
+                    for (auto i = 0; i < routerThreads; ++i)
+                    {
+                        const auto floodFile =
+                            queueFloodFile.empty() ? queueFloodFile : fmt::format("{}.{}", queueFloodFile, i);
+                        shards.emplace_back(makeEventQueue(shardSize, floodFile));
+                    }
+
+                    auto sharded = std::make_shared<base::queue::ShardedQueue<base::Event>>(
+                        std::move(shards), base::parseEvent::sourceHash, queueShardSteal);
+                    for (auto i = 0; i < routerThreads; ++i)
+                    {
+                        eventShards.emplace_back(sharded->consumer(i));
+                    }
+                    eventQueue = sharded;
+                    LOG_DEBUG("Sharded event queue created ({} shards).", routerThreads);
+                }
             }
             {
                 auto scope = metrics->getMetricsScope("TestQueue");
@@ -325,19 +605,139 @@ void runStart(ConfHandler confManager)
                 LOG_DEBUG("Test queue created.");
             }
 
-            router::Orchestrator::Options config {.m_numThreads = routerThreads,
-                                                  .m_wStore = store,
-                                                  .m_builder = builder,
-                                                  .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(),
-                                                  .m_prodQueue = eventQueue,
-                                                  .m_testQueue = testQueue,
-                                                  .m_testTimeout = serverApiTimeout};
+            // Sampled latency histograms, the stages and assets of each policy are kept in their own scope
+            bk::LatencyOptions latency {};
+            bk::LatencyRecorder queueLatency {};
+            if (routerLatencySampleRate > 0)
+            {
+                latency.sampleRate = routerLatencySampleRate;
+                latency.recorderFor = [metrics, scopesMutex = std::make_shared<std::mutex>()](
+                                          const std::string& policy, const std::string& name) -> bk::LatencyRecorder
+                {
+                    // The controllers are built by the router workers
+                    std::lock_guard lock {*scopesMutex};
+                    auto histogram = metrics->getMetricsScope("RouterLatency." + policy)->getHistogramUInteger(name);
+                    return [histogram](uint64_t nanoseconds) { histogram->recordValue(nanoseconds); };
+                };
+
+                auto histogram = metrics->getMetricsScope("EventQueue")->getHistogramUInteger("WaitTime");
+                queueLatency = [histogram](uint64_t nanoseconds) { histogram->recordValue(nanoseconds); };
+                LOG_DEBUG("Router latency instrumentation enabled (1 in {} events).", routerLatencySampleRate);
+            }
+
+            // Per event deadline, the events that run out of budget are counted by asset and written to the dead
+            // letter file instead of the outputs
+            bk::DeadlineOptions deadline {};
+            if (routerEventBudget > 0)
+            {
+                deadline.budget = std::chrono::microseconds(routerEventBudget);
+                if (routerEventBudgetChecks == "stage")
+                {
+                    deadline.granularity = bk::DeadlineGranularity::STAGE;
+                }
+                else if (routerEventBudgetChecks == "helper")
+                {
+                    deadline.granularity = bk::DeadlineGranularity::HELPER;
+                }
+
+                std::shared_ptr<std::ofstream> deadLetter {};
+                if (!routerDeadLetterFile.empty())
+                {
+                    deadLetter = std::make_shared<std::ofstream>(routerDeadLetterFile, std::ios::app);
+                    if (!deadLetter->is_open())
+                    {
+                        throw std::runtime_error(
+                            fmt::format("Cannot open the dead letter file '{}'", routerDeadLetterFile));
+                    }
+                }
+
+                deadline.onExceeded = [metrics, deadLetter, mutex = std::make_shared<std::mutex>()](
+                                          const std::string& policy,
+                                          const std::string& expression,
+                                          const std::string& helper,
+                                          const base::Event& event)
+                {
+                    // Only the events that exceed the budget get here, the lock is not in the path of the others
+                    std::lock_guard lock {*mutex};
+                    auto scope = metrics->getMetricsScope("RouterDeadline." + policy);
+                    scope->getCounterUInteger(expression)->addValue(1);
+                    if (!helper.empty())
+                    {
+                        scope->getCounterUInteger(expression + "/" + helper)->addValue(1);
+                    }
+
+                    if (deadLetter)
+                    {
+                        *deadLetter << event->str() << '\n';
+                        deadLetter->flush();
+                    }
+                };
+                LOG_DEBUG("Router event budget enabled ({} us, checked by {}).",
+                          routerEventBudget,
+                          routerEventBudgetChecks);
+            }
+
+            // The events diverted by the ingress filter are forwarded as they were received
+            std::function<void(std::string_view)> divertSink;
+            if (!serverEventDivertSock.empty())
+            {
+                divertSink = [socket = std::make_shared<sockiface::unixDatagram>(serverEventDivertSock),
+                              mutex = std::make_shared<std::mutex>()](std::string_view event)
+                {
+                    sockiface::ISockHandler::SendRetval result {sockiface::ISockHandler::SendRetval::SOCKET_ERROR};
+                    try
+                    {
+                        std::lock_guard lock {*mutex};
+                        result = socket->sendMsg(std::string {event});
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_WARNING_LIMITED("Cannot divert an event: {}", e.what());
+                        return;
+                    }
+                    if (sockiface::ISockHandler::SendRetval::SUCCESS != result)
+                    {
+                        LOG_WARNING_LIMITED("Cannot divert an event to '{}'", socket->getPath());
+                    }
+                };
+                LOG_INFO("The events diverted by the ingress filter are sent to '{}'.", serverEventDivertSock);
+            }
+
+            router::Orchestrator::Options config {
+                .m_numThreads = routerThreads,
+                .m_numTestThreads = routerTestThreads,
+                .m_wStore = store,
+                .m_builder = builder,
+                .m_controllerMaker = std::make_shared<bk::rx::ControllerMaker>(latency, deadline),
+                .m_prodQueue = eventQueue,
+                .m_testQueue = testQueue,
+                .m_prodShards = eventShards,
+                .m_testTimeout = serverApiTimeout,
+                .m_testerIdleTimeout = routerTesterIdleTimeout,
+                .m_batchSize = routerBatchSize,
+                .m_batchLingerUsec = routerBatchLinger,
+                .m_shareBuilds = routerShareBuilds,
+                .m_latencySampleRate = static_cast<std::size_t>(routerLatencySampleRate),
+                .m_queueLatency = queueLatency,
+                .m_cpus = utils::affinity::parseCpuSet(routerCpus),
+                .m_maxThreads = routerMaxThreads,
+                .m_scaleUpDepth = routerScaleDepth,
+                .m_scaleIntervalMsec = routerScaleInterval,
+                .m_loadInBackground = routerBackgroundLoad,
+                .m_divertSink = divertSink};
 
             orchestrator = std::make_shared<router::Orchestrator>(config);
             orchestrator->start();
 
             exitHandler.add([orchestrator]() { orchestrator->stop(); });
-            LOG_INFO("Router initialized.");
+            if (routerBackgroundLoad)
+            {
+                LOG_INFO("Router initialized, the policies are loaded in the background.");
+            }
+            else
+            {
+                LOG_INFO("Router initialized.");
+            }
         }
 
         // Create and configure the api endpints
@@ -399,6 +799,19 @@ void runStart(ConfHandler confManager)
         // Server
         {
             using namespace engineserver;
+
+            // The loop runs on this thread, the threads started from now on (API scheduler, event receivers, libuv
+            // pool) inherit its CPUs
+            const auto cpus = utils::affinity::parseCpuSet(serverCpus);
+            if (auto error = utils::affinity::pinThread(cpus); error)
+            {
+                throw std::runtime_error(error->message);
+            }
+            if (!cpus.empty())
+            {
+                LOG_INFO("Server pinned to the CPUs {}.", serverCpus);
+            }
+
             server = std::make_shared<EngineServer>();
             g_engineServer = server;
 
@@ -410,21 +823,149 @@ void runStart(ConfHandler confManager)
             apiClientFactory->setErrorResponse(base::utils::wazuhProtocol::WazuhResponse::unknownError().toString());
             apiClientFactory->setBusyResponse(base::utils::wazuhProtocol::WazuhResponse::busyServer().toString());
 
+            // API scheduler, each class of request with its own threads and queue
+            std::shared_ptr<Scheduler> apiScheduler;
+            if (0 < serverApiThreads)
+            {
+                Scheduler::Options schedulerOptions;
+                schedulerOptions.threads = serverApiThreads;
+                schedulerOptions.classes[static_cast<std::size_t>(TaskClass::CONTROL)] = {
+                    static_cast<std::size_t>(serverApiControlThreads),
+                    static_cast<std::size_t>(serverApiControlQueue),
+                    ENGINE_SRV_API_CONTROL_WEIGHT};
+                schedulerOptions.classes[static_cast<std::size_t>(TaskClass::ADMIN)] = {
+                    static_cast<std::size_t>(serverApiAdminThreads),
+                    static_cast<std::size_t>(serverApiAdminQueue),
+                    ENGINE_SRV_API_ADMIN_WEIGHT};
+                schedulerOptions.classes[static_cast<std::size_t>(TaskClass::EVENT)] = {
+                    static_cast<std::size_t>(serverApiEventThreads),
+                    static_cast<std::size_t>(serverApiEventQueue),
+                    ENGINE_SRV_API_EVENT_WEIGHT};
+                apiScheduler = std::make_shared<Scheduler>(schedulerOptions);
+                LOG_INFO("API scheduler initialized with {} threads.", serverApiThreads);
+            }
+
             auto apiEndpointCfg = std::make_shared<endpoint::UnixStream>(serverApiSock,
                                                                          apiClientFactory,
                                                                          apiMetricScope,
                                                                          apiMetricScopeDelta,
                                                                          serverApiQueueSize,
-                                                                         serverApiTimeout);
+                                                                         serverApiTimeout,
+                                                                         apiScheduler);
             server->addEndpoint("API", apiEndpointCfg);
 
             // Event Endpoint
             auto eventMetricScope = metrics->getMetricsScope("endpointEvent");
             auto eventMetricScopeDelta = metrics->getMetricsScope("endpointEventRate", true);
-            auto eventHandler = std::bind(&router::Orchestrator::pushEvent, orchestrator, std::placeholders::_1);
-            auto eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(
-                serverEventSock, eventHandler, eventMetricScope, eventMetricScopeDelta, serverEventQueueSize);
+            std::shared_ptr<endpoint::UnixDatagram> eventEndpointCfg;
+            if (0 < serverEventThreads)
+            {
+                // The receive threads parse each batch in place and push it to the queue at once
+                endpoint::UnixDatagram::BatchCallback eventHandler =
+                    [orchestrator](const std::vector<std::string_view>& events)
+                {
+                    orchestrator->pushEvents(events);
+                };
+                eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(
+                    serverEventSock, eventHandler, eventMetricScope, eventMetricScopeDelta, serverEventThreads);
+            }
+            else
+            {
+                auto eventHandler =
+                    std::bind(&router::Orchestrator::pushEvent, orchestrator, std::placeholders::_1);
+                eventEndpointCfg = std::make_shared<endpoint::UnixDatagram>(serverEventSock,
+                                                                            eventHandler,
+                                                                            eventMetricScope,
+                                                                            eventMetricScopeDelta,
+                                                                            serverEventQueueSize,
+                                                                            serverEventThreads);
+            }
+            // The ingress filter discards the raw events before they are copied or parsed
+            eventEndpointCfg->setFilter([orchestrator](std::string_view event)
+                                        { return orchestrator->admitEvent(event); });
             server->addEndpoint("EVENT", eventEndpointCfg);
+
+            // Bulk event endpoint, each frame is a batch of events separated by new lines
+            if (!serverEventBulkSock.empty())
+            {
+                auto bulkMetricScope = metrics->getMetricsScope("endpointEventBulk");
+                auto bulkMetricScopeDelta = metrics->getMetricsScope("endpointEventBulkRate", true);
+                auto bulkHandler = [orchestrator](const std::string& batch,
+                                                  std::function<void(const std::string&)> callback)
+                {
+                    std::vector<std::string_view> events;
+                    std::string_view pending {batch};
+                    while (!pending.empty())
+                    {
+                        const auto end = pending.find('\n');
+                        const auto event = pending.substr(0, end);
+                        if (!event.empty())
+                        {
+                            events.emplace_back(event);
+                        }
+                        pending = end == std::string_view::npos ? std::string_view {} : pending.substr(end + 1);
+                    }
+
+                    const auto accepted = orchestrator->pushEvents(events);
+                    callback(fmt::format(R"({{"accepted":{},"discarded":{}}})", accepted, events.size() - accepted));
+                };
+                auto bulkClientFactory = std::make_shared<ph::WStreamFactory>(bulkHandler);
+                bulkClientFactory->setErrorResponse(
+                    base::utils::wazuhProtocol::WazuhResponse::unknownError().toString());
+                bulkClientFactory->setBusyResponse(
+                    base::utils::wazuhProtocol::WazuhResponse::busyServer().toString());
+
+                auto bulkEndpointCfg = std::make_shared<endpoint::UnixStream>(serverEventBulkSock,
+                                                                              bulkClientFactory,
+                                                                              bulkMetricScope,
+                                                                              bulkMetricScopeDelta,
+                                                                              serverEventQueueSize,
+                                                                              serverApiTimeout);
+                server->addEndpoint("EVENT_BULK", bulkEndpointCfg);
+            }
+
+            // Shared-memory ring endpoint, each producer writes its events to its own ring
+            if (!serverEventRingSock.empty())
+            {
+                auto ringMetricScope = metrics->getMetricsScope("endpointEventRing");
+                auto ringMetricScopeDelta = metrics->getMetricsScope("endpointEventRingRate", true);
+                endpoint::UnixShmRing::BatchCallback ringHandler =
+                    [orchestrator](const std::vector<std::string_view>& events)
+                {
+                    orchestrator->pushEvents(events);
+                };
+                auto ringEndpointCfg = std::make_shared<endpoint::UnixShmRing>(
+                    serverEventRingSock,
+                    ringHandler,
+                    ringMetricScope,
+                    ringMetricScopeDelta,
+                    static_cast<std::size_t>(serverEventRingSize) * 1024 * 1024,
+                    static_cast<std::size_t>(serverEventRingThreads));
+                ringEndpointCfg->setFilter([orchestrator](std::string_view event)
+                                           { return orchestrator->admitEvent(event); });
+                server->addEndpoint("EVENT_RING", ringEndpointCfg);
+            }
+
+            // Agent change notifications of wazuh-db, applied in order by a single receive thread
+            if (agentCache)
+            {
+                std::function<void(const std::string&)> agentEventsHandler =
+                    [agentCache](const std::string& notification)
+                {
+                    if (auto error = agentCache->apply(notification); base::isError(error))
+                    {
+                        LOG_WARNING("Agent change notification discarded: {}", base::getError(error).message);
+                    }
+                };
+                auto agentEventsEndpointCfg =
+                    std::make_shared<endpoint::UnixDatagram>(serverAgentEventsSock,
+                                                             agentEventsHandler,
+                                                             metrics->getMetricsScope("endpointAgentEvents"),
+                                                             metrics->getMetricsScope("endpointAgentEventsRate", true),
+                                                             0,
+                                                             1);
+                server->addEndpoint("AGENT_EVENTS", agentEventsEndpointCfg);
+            }
             LOG_DEBUG("Server configured.");
         }
     }
@@ -480,6 +1021,22 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_LOG_TRUNCATE)
         ->envname(ENGINE_LOG_TRUNCATE_ENV);
 
+    serverApp
+        ->add_option("--log_threads",
+                     options->logThreads,
+                     "Sets the number of threads writing the logs, 0 to write them from the threads that log.")
+        ->default_val(ENGINE_LOG_THREADS)
+        ->check(CLI::Range(0, 16))
+        ->envname(ENGINE_LOG_THREADS_ENV);
+
+    serverApp
+        ->add_option("--log_queue_size",
+                     options->logQueueSize,
+                     "Sets the messages queued for the log threads, the oldest ones are dropped when it is full.")
+        ->default_val(ENGINE_LOG_QUEUE_SIZE)
+        ->check(CLI::Range(1, 1048576))
+        ->envname(ENGINE_LOG_QUEUE_SIZE_ENV);
+
     // Server module
     serverApp
         ->add_option("--server_threads", options->serverThreads, "Sets the number of threads for server worker pool.")
@@ -489,6 +1046,49 @@ void configure(CLI::App_p app)
     serverApp->add_option("--event_socket", options->serverEventSock, "Sets the events server socket address.")
         ->default_val(ENGINE_SRV_EVENT_SOCK)
         ->envname(ENGINE_SRV_EVENT_SOCK_ENV);
+    serverApp
+        ->add_option("--event_bulk_socket",
+                     options->serverEventBulkSock,
+                     "Sets the bulk events server socket address, each message is a batch of events separated by new "
+                     "lines (empty = disabled).")
+        ->default_val(ENGINE_SRV_EVENT_BULK_SOCK)
+        ->envname(ENGINE_SRV_EVENT_BULK_SOCK_ENV);
+    serverApp
+        ->add_option("--event_ring_socket",
+                     options->serverEventRingSock,
+                     "Sets the socket address where the producers get a shared-memory ring to write the events to "
+                     "(empty = disabled).")
+        ->default_val(ENGINE_SRV_EVENT_RING_SOCK)
+        ->envname(ENGINE_SRV_EVENT_RING_SOCK_ENV);
+    serverApp
+        ->add_option("--event_ring_size",
+                     options->serverEventRingSize,
+                     "Sets the size in MiB of the shared-memory ring of each producer, the largest event is half of "
+                     "it.")
+        ->default_val(ENGINE_SRV_EVENT_RING_SIZE)
+        ->check(CLI::Range(1, 1024))
+        ->envname(ENGINE_SRV_EVENT_RING_SIZE_ENV);
+    serverApp
+        ->add_option("--event_ring_threads",
+                     options->serverEventRingThreads,
+                     "Sets the number of threads reading the shared-memory ring of each producer.")
+        ->default_val(ENGINE_SRV_EVENT_RING_THREADS)
+        ->check(CLI::Range(1, 64))
+        ->envname(ENGINE_SRV_EVENT_RING_THREADS_ENV);
+    serverApp
+        ->add_option("--event_divert_socket",
+                     options->serverEventDivertSock,
+                     "Sets the datagram socket address where the events diverted by the ingress filter are sent "
+                     "(empty = the ingress rules can only drop events).")
+        ->default_val(ENGINE_SRV_EVENT_DIVERT_SOCK)
+        ->envname(ENGINE_SRV_EVENT_DIVERT_SOCK_ENV);
+    serverApp
+        ->add_option("--agent_events_socket",
+                     options->serverAgentEventsSock,
+                     "Sets the datagram socket address where wazuh-db sends the agent change notifications, it enables "
+                     "the agent cache of agent_info (empty = disabled).")
+        ->default_val(ENGINE_SRV_AGENT_EVENTS_SOCK)
+        ->envname(ENGINE_SRV_AGENT_EVENTS_SOCK_ENV);
     serverApp
         ->add_option("--event_queue_tasks",
                      options->serverEventQueueSize,
@@ -496,6 +1096,21 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_SRV_EVENT_QUEUE_TASK)
         ->check(CLI::NonNegativeNumber)
         ->envname(ENGINE_SRV_EVENT_QUEUE_TASK_ENV);
+    serverApp
+        ->add_option("--event_threads",
+                     options->serverEventThreads,
+                     "Sets the number of threads receiving the events from the socket (0 = receive them in the server "
+                     "loop).")
+        ->default_val(ENGINE_SRV_EVENT_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_SRV_EVENT_THREADS_ENV);
+    serverApp
+        ->add_option("--server_cpus",
+                     options->serverCpus,
+                     "Sets the CPUs of the server loop and its threads, as a list of CPUs, ranges and NUMA nodes, "
+                     "e.g. \"0-3,8\" or \"node0\" (empty = not pinned).")
+        ->default_val(ENGINE_SRV_CPUS)
+        ->envname(ENGINE_SRV_CPUS_ENV);
     serverApp->add_option("--api_socket", options->serverApiSock, "Sets the API server socket address.")
         ->default_val(ENGINE_SRV_API_SOCK)
         ->envname(ENGINE_SRV_API_SOCK_ENV);
@@ -511,6 +1126,56 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_SRV_API_TIMEOUT)
         ->check(CLI::NonNegativeNumber)
         ->envname(ENGINE_SRV_API_TIMEOUT_ENV);
+    serverApp
+        ->add_option("--api_threads",
+                     options->serverApiThreads,
+                     "Sets the number of threads of the API scheduler (0 = disable, use the server thread pool and the "
+                     "API task queue).")
+        ->default_val(ENGINE_SRV_API_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_SRV_API_THREADS_ENV);
+    serverApp
+        ->add_option("--api_control_threads",
+                     options->serverApiControlThreads,
+                     "Sets the maximum API threads running control and status requests at once.")
+        ->default_val(ENGINE_SRV_API_CONTROL_THREADS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_SRV_API_CONTROL_THREADS_ENV);
+    serverApp
+        ->add_option("--api_control_queue",
+                     options->serverApiControlQueue,
+                     "Sets the size of the API queue of control and status requests.")
+        ->default_val(ENGINE_SRV_API_CONTROL_QUEUE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_SRV_API_CONTROL_QUEUE_ENV);
+    serverApp
+        ->add_option("--api_admin_threads",
+                     options->serverApiAdminThreads,
+                     "Sets the maximum API threads running administration requests at once.")
+        ->default_val(ENGINE_SRV_API_ADMIN_THREADS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_SRV_API_ADMIN_THREADS_ENV);
+    serverApp
+        ->add_option("--api_admin_queue",
+                     options->serverApiAdminQueue,
+                     "Sets the size of the API queue of administration requests.")
+        ->default_val(ENGINE_SRV_API_ADMIN_QUEUE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_SRV_API_ADMIN_QUEUE_ENV);
+    serverApp
+        ->add_option("--api_event_threads",
+                     options->serverApiEventThreads,
+                     "Sets the maximum API threads running event requests (enqueue and test) at once.")
+        ->default_val(ENGINE_SRV_API_EVENT_THREADS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_SRV_API_EVENT_THREADS_ENV);
+    serverApp
+        ->add_option("--api_event_queue",
+                     options->serverApiEventQueue,
+                     "Sets the size of the API queue of event requests.")
+        ->default_val(ENGINE_SRV_API_EVENT_QUEUE)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_SRV_API_EVENT_QUEUE_ENV);
 
     // Store Module
     serverApp
@@ -519,6 +1184,74 @@ void configure(CLI::App_p app)
         ->default_val(ENGINE_STORE_PATH)
         ->check(CLI::ExistingDirectory)
         ->envname(ENGINE_STORE_PATH_ENV);
+    serverApp->add_option("--store_driver", options->storeDriver, "Sets the driver of the store.")
+        ->default_val(ENGINE_STORE_DRIVER)
+        ->check(CLI::IsMember({"file", "rocksdb"}))
+        ->envname(ENGINE_STORE_DRIVER_ENV);
+    serverApp
+        ->add_option("--store_db_path",
+                     options->storeDbPath,
+                     "Sets the path to the database of the rocksdb store driver, the assets of the store path are "
+                     "imported when it is empty.")
+        ->default_val(ENGINE_STORE_DB_PATH)
+        ->envname(ENGINE_STORE_DB_PATH_ENV);
+
+    // Builder Module
+    serverApp
+        ->add_option("--builder_threads", options->builderThreads, "Sets the number of threads building a policy.")
+        ->default_val(ENGINE_BUILDER_THREADS)
+        ->check(CLI::Range(1, 128))
+        ->envname(ENGINE_BUILDER_THREADS_ENV);
+    serverApp
+        ->add_flag("--builder_wdb_update_async,!--no-builder_wdb_update_async",
+                   options->builderWdbUpdateAsync,
+                   "Queue the wdb_update queries instead of waiting for their results.")
+        ->default_val(ENGINE_BUILDER_WDB_UPDATE_ASYNC)
+        ->envname(ENGINE_BUILDER_WDB_UPDATE_ASYNC_ENV);
+    serverApp
+        ->add_option("--builder_sca_cache_ttl",
+                     options->builderScaCacheTtl,
+                     "Sets the time in seconds the SCA decoder caches the check and policy lookups of an agent (0 = "
+                     "do not cache).")
+        ->default_val(ENGINE_BUILDER_SCA_CACHE_TTL)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_BUILDER_SCA_CACHE_TTL_ENV);
+    serverApp
+        ->add_option("--builder_sca_batch_size",
+                     options->builderScaBatchSize,
+                     "Sets the number of check updates of an agent the SCA decoder coalesces before writing them (0 = "
+                     "write each one).")
+        ->default_val(ENGINE_BUILDER_SCA_BATCH_SIZE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_BUILDER_SCA_BATCH_SIZE_ENV);
+    serverApp
+        ->add_option("--builder_sca_batch_interval",
+                     options->builderScaBatchInterval,
+                     "Sets the maximum time in miliseconds a coalesced SCA check update waits to be written.")
+        ->default_val(ENGINE_BUILDER_SCA_BATCH_INTERVAL)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_BUILDER_SCA_BATCH_INTERVAL_ENV);
+    serverApp
+        ->add_flag("--builder_reorder_decoders,!--no-builder_reorder_decoders",
+                   options->builderReorderDecoders,
+                   "Order the sibling decoders by their hit rate on each policy build, the first sibling matching an "
+                   "event may change.")
+        ->default_val(ENGINE_BUILDER_REORDER_DECODERS)
+        ->envname(ENGINE_BUILDER_REORDER_DECODERS_ENV);
+    serverApp
+        ->add_option("--builder_output_flush_interval",
+                     options->builderOutputFlushInterval,
+                     "Sets the maximum time in miliseconds an event waits to be written to the file outputs.")
+        ->default_val(ENGINE_BUILDER_OUTPUT_FLUSH_INTERVAL)
+        ->check(CLI::Range(1, 60000))
+        ->envname(ENGINE_BUILDER_OUTPUT_FLUSH_INTERVAL_ENV);
+    serverApp
+        ->add_option("--builder_output_fsync_interval",
+                     options->builderOutputFsyncInterval,
+                     "Sets the minimum time in miliseconds between syncs of the file outputs (0 = never sync).")
+        ->default_val(ENGINE_BUILDER_OUTPUT_FSYNC_INTERVAL)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_BUILDER_OUTPUT_FSYNC_INTERVAL_ENV);
 
     // KVDB Module
     serverApp->add_option("--kvdb_path", options->kvdbPath, "Sets the path to the KVDB folder.")
@@ -526,6 +1259,39 @@ void configure(CLI::App_p app)
         ->check(CLI::ExistingDirectory)
         ->envname(ENGINE_KVDB_PATH_ENV);
 
+    serverApp
+        ->add_option("--kvdb_cache_size",
+                     options->kvdbCacheSize,
+                     "Sets the memory in MiB for the parsed values cached of each KVDB, 0 disables the cache.")
+        ->default_val(ENGINE_KVDB_CACHE_SIZE)
+        ->check(CLI::Range(0, 4096))
+        ->envname(ENGINE_KVDB_CACHE_SIZE_ENV);
+
+    serverApp
+        ->add_option("--kvdb_bloom_bits",
+                     options->kvdbBloomBits,
+                     "Sets the bits per key of the bloom filters of the KVDBs, 0 disables them.")
+        ->default_val(ENGINE_KVDB_BLOOM_BITS)
+        ->check(CLI::Range(0, 64))
+        ->envname(ENGINE_KVDB_BLOOM_BITS_ENV);
+
+    // RocksDB
+    serverApp
+        ->add_option("--rocksdb_cache_size",
+                     options->rocksdbCacheSize,
+                     "Sets the memory in MiB of the block cache shared by all the RocksDB databases.")
+        ->default_val(ENGINE_ROCKSDB_CACHE_SIZE)
+        ->check(CLI::Range(8, 65536))
+        ->envname(ENGINE_ROCKSDB_CACHE_SIZE_ENV);
+
+    serverApp
+        ->add_option("--rocksdb_write_buffer_size",
+                     options->rocksdbWriteBufferSize,
+                     "Sets the memory in MiB of the memtables of all the RocksDB databases, charged to the cache.")
+        ->default_val(ENGINE_ROCKSDB_WRITE_BUFFER_SIZE)
+        ->check(CLI::Range(8, 65536))
+        ->envname(ENGINE_ROCKSDB_WRITE_BUFFER_SIZE_ENV);
+
     // TZ_DB Installation Path
     serverApp->add_option("--tzdb_path", options->tzdbPath, "Sets the install path to the time zone database.")
         ->default_val(ENGINE_TZDB_PATH)
@@ -538,12 +1304,129 @@ void configure(CLI::App_p app)
          ->default_val(ENGINE_TZDB_AUTO_UPDATE)
          ->envname(ENGINE_TZDB_AUTO_UPDATE_ENV);
 
+    // Metrics module
+    serverApp
+        ->add_option("--metrics_address",
+                     options->metricsAddress,
+                     "Sets the address of the OpenMetrics endpoint scraped on /metrics.")
+        ->default_val(ENGINE_METRICS_ADDRESS)
+        ->envname(ENGINE_METRICS_ADDRESS_ENV);
+    serverApp
+        ->add_option("--metrics_port",
+                     options->metricsPort,
+                     "Sets the port of the OpenMetrics endpoint scraped on /metrics (0 = disabled).")
+        ->default_val(ENGINE_METRICS_PORT)
+        ->check(CLI::Range(0, 65535))
+        ->envname(ENGINE_METRICS_PORT_ENV);
+
     // Router module
     serverApp
         ->add_option("--router_threads", options->routerThreads, "Sets the number of threads to be used by the router.")
         ->default_val(ENGINE_ROUTER_THREADS)
         ->check(CLI::Range(1, 128))
         ->envname(ENGINE_ROUTER_THREADS_ENV);
+    serverApp
+        ->add_option("--router_test_threads",
+                     options->routerTestThreads,
+                     "Sets the number of threads dedicated to the test sessions (0 = run them on the router threads).")
+        ->default_val(ENGINE_ROUTER_TEST_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_ROUTER_TEST_THREADS_ENV);
+    serverApp
+        ->add_option("--router_tester_idle_timeout",
+                     options->routerTesterIdleTimeout,
+                     "Sets the seconds without tests before a test session is unloaded, the sessions are then loaded "
+                     "on their first test (0 = load them at start and keep them).")
+        ->default_val(ENGINE_ROUTER_TESTER_IDLE_TIMEOUT)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_ROUTER_TESTER_IDLE_TIMEOUT_ENV);
+    serverApp
+        ->add_flag("--router_share_builds,!--no-router_share_builds",
+                   options->routerShareBuilds,
+                   "Build each policy once and share it among the router threads.")
+        ->default_val(ENGINE_ROUTER_SHARE_BUILDS)
+        ->envname(ENGINE_ROUTER_SHARE_BUILDS_ENV);
+    serverApp
+        ->add_flag("--router_background_load,!--no-router_background_load",
+                   options->routerBackgroundLoad,
+                   "Build the policies of the router threads in the background, the server accepts and queues the "
+                   "events meanwhile and the API requests wait for them.")
+        ->default_val(ENGINE_ROUTER_BACKGROUND_LOAD)
+        ->envname(ENGINE_ROUTER_BACKGROUND_LOAD_ENV);
+    serverApp
+        ->add_option("--router_batch_size",
+                     options->routerBatchSize,
+                     "Sets the maximum number of events each router thread dequeues at once (1 = disable batching).")
+        ->default_val(ENGINE_ROUTER_BATCH_SIZE)
+        ->check(CLI::Range(1, 65536))
+        ->envname(ENGINE_ROUTER_BATCH_SIZE_ENV);
+    serverApp
+        ->add_option("--router_batch_linger",
+                     options->routerBatchLinger,
+                     "Sets the maximum number of microseconds a router thread waits for a batch to fill up.")
+        ->default_val(ENGINE_ROUTER_BATCH_LINGER)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_ROUTER_BATCH_LINGER_ENV);
+    serverApp
+        ->add_option("--router_latency_sample_rate",
+                     options->routerLatencySampleRate,
+                     "Sets the sampling of the router latency histograms, one in N events is timed (0 = disabled).")
+        ->default_val(ENGINE_ROUTER_LATENCY_SAMPLE_RATE)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_ROUTER_LATENCY_SAMPLE_RATE_ENV);
+    serverApp
+        ->add_option("--router_cpus",
+                     options->routerCpus,
+                     "Sets the CPUs of the router threads, each one is pinned to one of them in turn, as a list of "
+                     "CPUs, ranges and NUMA nodes, e.g. \"4-7\" or \"node1\" (empty = not pinned).")
+        ->default_val(ENGINE_ROUTER_CPUS)
+        ->envname(ENGINE_ROUTER_CPUS_ENV);
+    serverApp
+        ->add_option("--router_max_threads",
+                     options->routerMaxThreads,
+                     "Sets the maximum number of router threads, they are added while the queue is backed up and "
+                     "removed once idle, down to router_threads (0 = always router_threads). Not compatible with "
+                     "queue_sharded.")
+        ->default_val(ENGINE_ROUTER_MAX_THREADS)
+        ->check(CLI::Range(0, 128))
+        ->envname(ENGINE_ROUTER_MAX_THREADS_ENV);
+    serverApp
+        ->add_option("--router_scale_depth",
+                     options->routerScaleDepth,
+                     "Sets the queued events per router thread above which the queue is backed up and a thread is "
+                     "added, if the threads are busy.")
+        ->default_val(ENGINE_ROUTER_SCALE_DEPTH)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_ROUTER_SCALE_DEPTH_ENV);
+    serverApp
+        ->add_option("--router_scale_interval",
+                     options->routerScaleInterval,
+                     "Sets the interval in milliseconds between the scaling decisions of the router threads.")
+        ->default_val(ENGINE_ROUTER_SCALE_INTERVAL)
+        ->check(CLI::PositiveNumber)
+        ->envname(ENGINE_ROUTER_SCALE_INTERVAL_ENV);
+    serverApp
+        ->add_option("--router_event_budget",
+                     options->routerEventBudget,
+                     "Sets the processing budget of each event in microseconds, the events that exceed it skip the "
+                     "rest of the policy and are written to the dead letter file (0 = disabled).")
+        ->default_val(ENGINE_ROUTER_EVENT_BUDGET)
+        ->check(CLI::NonNegativeNumber)
+        ->envname(ENGINE_ROUTER_EVENT_BUDGET_ENV);
+    serverApp
+        ->add_option("--router_event_budget_checks",
+                     options->routerEventBudgetChecks,
+                     "Sets where the event budget is checked: after each stage, asset or helper. The finer checks "
+                     "find the asset or helper that exceeded it, at the cost of a clock read after each of them.")
+        ->default_val(ENGINE_ROUTER_EVENT_BUDGET_CHECKS)
+        ->check(CLI::IsMember({"stage", "asset", "helper"}))
+        ->envname(ENGINE_ROUTER_EVENT_BUDGET_CHECKS_ENV);
+    serverApp
+        ->add_option("--router_dead_letter_file",
+                     options->routerDeadLetterFile,
+                     "Sets the file where the events that exceed their budget are written (empty = discarded).")
+        ->default_val(ENGINE_ROUTER_DEAD_LETTER_FILE)
+        ->envname(ENGINE_ROUTER_DEAD_LETTER_FILE_ENV);
 
     // Queue module
     serverApp
@@ -556,7 +1439,7 @@ void configure(CLI::App_p app)
     serverApp
         ->add_option("--queue_flood_file",
                      options->queueFloodFile,
-                     "Sets the path to the file where the flood events will be stored.")
+                     "Sets the path to the spill log where the flood events are kept until the queue has room.")
         ->default_val(ENGINE_QUEUE_FLOOD_FILE)
         ->envname(ENGINE_QUEUE_FLOOD_FILE_ENV);
 
@@ -580,6 +1463,31 @@ void configure(CLI::App_p app)
                         options->queueDropFlood,
                         "If enabled, the queue will drop the flood events instead of storing them in the file.");
 
+    serverApp
+        ->add_flag("--queue_sharded,!--no-queue_sharded",
+                   options->queueSharded,
+                   "Split the event queue in one shard per router thread, the events of an agent are always "
+                   "processed by the same thread.")
+        ->default_val(ENGINE_QUEUE_SHARDED)
+        ->envname(ENGINE_QUEUE_SHARDED_ENV);
+
+    serverApp
+        ->add_flag("--queue_shard_steal,!--no-queue_shard_steal",
+                   options->queueShardSteal,
+                   "A router thread whose shard is empty takes events from the other shards, the stolen events "
+                   "may be processed out of order.")
+        ->default_val(ENGINE_QUEUE_SHARD_STEAL)
+        ->envname(ENGINE_QUEUE_SHARD_STEAL_ENV);
+
+    serverApp
+        ->add_option("--queue_lanes",
+                     options->queueLanes,
+                     "Splits the event queue in prioritized lanes by the Wazuh queue id of the events, as a list of "
+                     "<queue ids>:<weight>[:<block|spill|drop>], e.g. \"3:8,8d:1:drop,*:4\". Each lane gets a share "
+                     "of the processing in proportion to its weight and holds queue_size events (empty = one lane).")
+        ->default_val(ENGINE_QUEUE_LANES)
+        ->envname(ENGINE_QUEUE_LANES_ENV);
+
     // Start subcommand
     auto startApp = serverApp->add_subcommand("start", "Start a Wazuh engine instance");
 
@@ -12,22 +12,30 @@
 #ifndef _DATABASE_FEED_MANAGER_HPP
 #define _DATABASE_FEED_MANAGER_HPP
 
-#include "base/lruCache.hpp"
+#include "base/shardedCache.hpp"
 #include "base/utils/rocksDBWrapper.hpp"
+#include "osMappingIndex.hpp"
 #include "packageTranslation_generated.h"
+#include "vendorMapIndex.hpp"
 #include "vulnerabilityCandidate_generated.h"
 #include "vulnerabilityDescription_generated.h"
 #include "vulnerabilityRemediations_generated.h"
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <regex>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 constexpr auto DATABASE_PATH {"queue/vd/feed"};
 constexpr auto OFFSET_TRANSACTION_SIZE {1000};
+constexpr auto MIN_RESOURCES_PER_WORKER {64};
 constexpr auto EMPTY_KEY {""};
 constexpr auto TRANSLATIONS_COLUMN {"translation"};
 constexpr auto VENDOR_MAP_COLUMN {"vendor_map"};
@@ -75,6 +83,18 @@ struct FlatbufferDataPair final
     const FlatbufferType* data = nullptr;
 };
 
+/**
+ * @brief Vulnerability descriptions retrieved in a batch, by CVE ID.
+ */
+using VulnerabilityDescriptions =
+    std::unordered_map<std::string, FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>>;
+
+/**
+ * @brief Vulnerability remediations retrieved in a batch, by CVE ID.
+ */
+using VulnerabilityRemediations =
+    std::unordered_map<std::string, FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo>>;
+
 /**
  * @brief Represents a translation entry containing regular expressions for product and vendor identification,
  *        along with a vector of translated data.
@@ -89,10 +109,65 @@ struct Translation final
 };
 
 /**
- * @brief Translations cache.
+ * @brief Translations cache, in the order of their IDs in the feed database.
  * @details Key: Translation ID, Value: Translation information.
  */
-using TranslationLRUCache = LRUCache<std::string, Translation>;
+using TranslationL2Cache = std::vector<std::pair<std::string, Translation>>;
+
+// Maximum number of translations kept in each cache level.
+constexpr size_t TRANSLATION_CACHE_SIZE {1024};
+
+/**
+ * @brief CVEs remediated by the hotfixes installed on an agent.
+ *
+ * The CVEs with remediations are numbered when the feed maps are reloaded, and the remediated ones are a bitmap
+ * over those numbers, so checking a CVE costs a hash lookup and a bit test.
+ */
+class HotfixRemediations final
+{
+public:
+    HotfixRemediations() = default;
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param cveIds Number of each CVE with remediations.
+     * @param bitmap Bit set for each remediated CVE number.
+     */
+    HotfixRemediations(const std::unordered_map<std::string, uint32_t>* cveIds, std::vector<uint64_t> bitmap)
+        : m_cveIds {cveIds}
+        , m_bitmap {std::move(bitmap)}
+    {
+    }
+
+    /**
+     * @brief Checks if any hotfix remediates a CVE.
+     *
+     * @param cveId CVE id.
+     * @return true if the feed has remediations for the CVE.
+     */
+    bool hasRemediation(const std::string& cveId) const { return m_cveIds && m_cveIds->count(cveId) > 0; }
+
+    /**
+     * @brief Checks if an installed hotfix remediates a CVE.
+     *
+     * @param cveId CVE id.
+     * @return true if one of the hotfixes remediates the CVE.
+     */
+    bool isRemediated(const std::string& cveId) const
+    {
+        if (!m_cveIds)
+        {
+            return false;
+        }
+        const auto it = m_cveIds->find(cveId);
+        return it != m_cveIds->end() && (m_bitmap[it->second / 64] & (uint64_t {1} << (it->second % 64))) != 0;
+    }
+
+private:
+    const std::unordered_map<std::string, uint32_t>* m_cveIds {nullptr}; ///< Number of each CVE with remediations.
+    std::vector<uint64_t> m_bitmap;                                      ///< Bit set for each remediated CVE.
+};
 
 /**
  * @brief DatabaseFeedManager class.
@@ -104,9 +179,14 @@ public:
      * @brief Class constructor.
      *
      * @param mutex Mutex to protect the access to the internal databases.
+     * @param trustFeedDatabase If true, the FlatBuffers stored by the feed update are verified once per column
+     * instead of on every read.
+     * @param feedTuning Block cache size and compression of the feed database.
      */
     // LCOV_EXCL_START
-    explicit DatabaseFeedManager(std::shared_mutex& mutex);
+    explicit DatabaseFeedManager(std::shared_mutex& mutex,
+                                 bool trustFeedDatabase = false,
+                                 const utils::rocksdb::RocksDBTuning& feedTuning = {});
     /**
      * @brief Retrieves vulnerability remediation information from the database, for a given CVE ID.
      *
@@ -125,6 +205,20 @@ public:
                                      FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo>& dtoVulnRemediation);
     ;
 
+    /**
+     * @brief Retrieves the remediation information of several CVE IDs with a single database lookup.
+     *
+     * The CVE IDs already in the container and the repeated ones are not looked up again, so the container can be
+     * shared by the lookups of a whole scan. The CVE IDs without remediation are not added to the container.
+     *
+     * @param cveIds The CVE IDs for which remediation information is requested.
+     * @param remediations Container where the retrieved remediation information is stored.
+     *
+     * @throws std::runtime_error if the retrieved data from the database is invalid or
+     *         not in the expected FlatBuffers format.
+     */
+    void getVulnerabilitiesRemediation(const std::vector<std::string>& cveIds, VulnerabilityRemediations& remediations);
+
     /**
      * @brief Retrieves the vulnerabilities information from the database, for a given hotfix ID.
      *
@@ -140,6 +234,17 @@ public:
      */
     std::unordered_set<std::string> getHotfixVulnerabilities(const std::string& hotfix);
 
+    /**
+     * @brief Gets the CVEs remediated by a set of installed hotfixes.
+     *
+     * The hotfix to CVE relations are loaded with the feed maps, so no database access is needed. The result is
+     * valid until the next feed update.
+     *
+     * @param hotfixes Installed hotfixes, an array of hotfix ids.
+     * @return HotfixRemediations CVEs remediated by the hotfixes.
+     */
+    HotfixRemediations getHotfixRemediations(const nlohmann::json& hotfixes) const;
+
     /**
      * @brief Fills the Level 2 cache with translations from the feed database.
      *
@@ -211,6 +316,19 @@ public:
     void getVulnerabiltyDescriptiveInformation(
         std::string_view cveId, FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer);
 
+    /**
+     * @brief Gets descriptive information for several cveids with a single database lookup.
+     *
+     * The cveids already in the container and the repeated ones are not looked up again, so the container can be
+     * shared by the lookups of a whole scan.
+     *
+     * @param cveIds cveids to search.
+     * @param resultContainer container to store the results, by cveid.
+     * @throws std::runtime_error if a cveid is not found or its data is invalid.
+     */
+    void getVulnerabilitiesDescriptiveInformation(const std::vector<std::string>& cveIds,
+                                                  VulnerabilityDescriptions& resultContainer);
+
     /**
      * @brief Get CNA/ADP name based on the package source.
      *
@@ -271,6 +389,15 @@ public:
      */
     auto cpeMappings() const -> const nlohmann::json&;
 
+    /**
+     * @brief Get the OS mapping index.
+     *
+     * The CPE and CNA mappings compiled at load time, so the scans get their CPE and CNA names without walking them.
+     *
+     * @return const OsMappingIndex& OS mapping index.
+     */
+    auto osMappingIndex() const -> const OsMappingIndex&;
+
     /**
      * @brief Get vendors map.
      *
@@ -280,6 +407,27 @@ public:
      */
     auto vendorsMap() const -> const nlohmann::json&;
 
+    /**
+     * @brief Get the feed generation.
+     *
+     * The generation changes every time a feed update is applied, so the callers can tell when the data cached from
+     * previous scans is stale.
+     *
+     * @return uint64_t Feed generation.
+     */
+    uint64_t feedGeneration() const;
+
+    /**
+     * @brief Applies a feed update.
+     *
+     * The resources are encoded in parallel first, while the scans keep reading the current feed. Then they are
+     * stored in order into a single write batch, which is applied atomically, so no scan sees a partially updated
+     * feed. The scans only wait while the batch is staged and written.
+     *
+     * @param resources Created, updated and deleted resources, in the order they must be applied.
+     */
+    void updateFeed(const std::vector<nlohmann::json>& resources);
+
 private:
     /**
      * Do not change the order of definition of these variables.
@@ -288,14 +436,33 @@ private:
     std::shared_mutex& m_mutex;
     std::unique_ptr<utils::rocksdb::RocksDBWrapper> m_feedDatabase;
     // TODO: Get size from the config
-    std::unique_ptr<TranslationLRUCache> m_translationL2Cache = std::make_unique<TranslationLRUCache>(1024);
+    std::unique_ptr<TranslationL2Cache> m_translationL2Cache = std::make_unique<TranslationL2Cache>();
 
     std::unique_ptr<std::unordered_set<std::string>> m_translationFilter =
         std::make_unique<std::unordered_set<std::string>>();
 
     // TODO: Get size from the config
-    std::unique_ptr<LRUCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
-        std::make_unique<LRUCache<std::string, std::vector<PackageData>>>(1024);
+    std::unique_ptr<base::ShardedCache<std::string, std::vector<PackageData>>> m_translationL1Cache =
+        std::make_unique<base::ShardedCache<std::string, std::vector<PackageData>>>(TRANSLATION_CACHE_SIZE);
+
+    std::shared_mutex m_translationMutex; ///< Guards the translation filter.
+
+    std::atomic<uint64_t> m_feedGeneration {0}; ///< Incremented each time the feed maps are reloaded.
+
+    const bool m_trustFeedDatabase; ///< Verify each column once instead of every value read.
+    std::unordered_map<std::string, bool> m_columnTrust; ///< Result of the verification of each column.
+    std::shared_mutex m_columnTrustMutex;                  ///< Guards the column verification results.
+
+    /**
+     * @brief Checks if the values of a column can be read without verifying them.
+     *
+     * The first call for a column verifies all its values, and the result is kept until the next feed update.
+     *
+     * @param columnName Column name.
+     * @param verify FlatBuffers verification function of the values stored in the column.
+     * @return true if trusting the feed database is enabled and every value of the column is valid.
+     */
+    bool isTrustedColumn(const std::string& columnName, bool (*verify)(flatbuffers::Verifier&));
 
     /**
      * @brief Reads the vendor and os cpe maps from the database and loads the data into memory.
@@ -305,9 +472,19 @@ private:
      */
     void reloadGlobalMaps();
 
+    /**
+     * @brief Loads the hotfix to CVE relations of the feed database into memory.
+     */
+    void loadHotfixRemediations();
+
+    std::unordered_map<std::string, uint32_t> m_remediatedCveIds;        ///< Number of each CVE with remediations.
+    std::unordered_map<std::string, std::vector<uint32_t>> m_hotfixCves; ///< CVE numbers remediated by each hotfix.
+
     nlohmann::json m_cnaMappings;
     nlohmann::json m_vendorsMap;
     nlohmann::json m_cpeMappings;
+    VendorMapIndex m_vendorMapIndex; ///< Lookup structures compiled from the vendors map.
+    OsMappingIndex m_osMappingIndex; ///< Lookup structures compiled from the CPE and CNA mappings.
 };
 
 #endif // _DATABASE_FEED_MANAGER_HPP
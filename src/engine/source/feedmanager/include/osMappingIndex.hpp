@@ -0,0 +1,291 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _OS_MAPPING_INDEX_HPP
+#define _OS_MAPPING_INDEX_HPP
+
+#include "base/utils/stringUtils.hpp"
+#include <array>
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief OS fields the CPE and CNA names of a scan depend on.
+ */
+struct OsMappingFields final
+{
+    std::string_view name;           ///< OS name.
+    std::string_view platform;       ///< OS platform.
+    std::string_view majorVersion;   ///< OS major version.
+    std::string_view minorVersion;   ///< OS minor version.
+    std::string_view displayVersion; ///< OS display version.
+    std::string_view version;        ///< OS version.
+    std::string_view release;        ///< OS release.
+};
+
+/**
+ * @brief Lookup structures compiled from the OS CPE and the CNA mappings of the feed.
+ *
+ * The mappings hold name templates with $(VARIABLE) placeholders. Each template is split once into its literal parts
+ * and its variables, so a scan builds its names in a single pass instead of replacing each variable in turn. The
+ * platform and major version equivalences are kept in hash maps by platform, then by version.
+ */
+class OsMappingIndex final
+{
+private:
+    /**
+     * @brief Variable of a template.
+     */
+    enum class Variable
+    {
+        None,
+        Platform,
+        MajorVersion,
+        MinorVersion,
+        DisplayVersion,
+        Version,
+        Release,
+        VersionUpdateHyphen
+    };
+
+    /**
+     * @brief Name template, as a list of literals each one followed by a variable.
+     */
+    class Template final
+    {
+    private:
+        std::vector<std::pair<std::string, Variable>> m_segments;
+
+    public:
+        Template() = default;
+
+        /**
+         * @brief Splits a template. The placeholders that aren't in the variables are kept as literals.
+         */
+        template<std::size_t N>
+        Template(std::string_view text, const std::array<std::pair<std::string_view, Variable>, N>& variables)
+        {
+            std::string literal;
+            while (!text.empty())
+            {
+                auto variable = Variable::None;
+                if (text.front() == '$')
+                {
+                    for (const auto& [placeholder, value] : variables)
+                    {
+                        if (base::utils::string::startsWith(text, placeholder))
+                        {
+                            variable = value;
+                            text.remove_prefix(placeholder.size());
+                            break;
+                        }
+                    }
+                }
+
+                if (variable == Variable::None)
+                {
+                    literal.push_back(text.front());
+                    text.remove_prefix(1);
+                }
+                else
+                {
+                    m_segments.emplace_back(std::move(literal), variable);
+                    literal.clear();
+                }
+            }
+            if (!literal.empty())
+            {
+                m_segments.emplace_back(std::move(literal), Variable::None);
+            }
+        }
+
+        bool empty() const { return m_segments.empty(); }
+
+        /**
+         * @brief Appends the name of the template.
+         *
+         * @param output Name.
+         * @param valueOf Value of each variable.
+         */
+        template<typename TValueOf>
+        void render(std::string& output, const TValueOf& valueOf) const
+        {
+            for (const auto& [literal, variable] : m_segments)
+            {
+                output.append(literal);
+                if (variable != Variable::None)
+                {
+                    valueOf(variable, output);
+                }
+            }
+        }
+    };
+
+    static constexpr std::array<std::pair<std::string_view, Variable>, 2> CNA_VARIABLES {
+        {{"$(PLATFORM)", Variable::Platform}, {"$(MAJOR_VERSION)", Variable::MajorVersion}}};
+
+    static constexpr std::array<std::pair<std::string_view, Variable>, 6> CPE_VARIABLES {
+        {{"$(MAJOR_VERSION)", Variable::MajorVersion},
+         {"$(MINOR_VERSION)", Variable::MinorVersion},
+         {"$(DISPLAY_VERSION)", Variable::DisplayVersion},
+         {"$(VERSION)", Variable::Version},
+         {"$(RELEASE)", Variable::Release},
+         {"$(VERSION_UPDATE_HYPHEN)", Variable::VersionUpdateHyphen}}};
+
+    std::unordered_map<std::string, Template> m_cnaTemplates;           ///< Template of each CNA base name.
+    std::unordered_map<std::string, std::string> m_platformEquivalence; ///< CNA platform of each OS platform.
+    /// CNA major version of each OS platform and major version.
+    std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_majorVersionEquivalence;
+    std::vector<std::pair<std::string, Template>> m_cpeRules; ///< OS name or platform and CPE template, by priority.
+
+    static const std::string* find(const std::unordered_map<std::string, std::string>& map, std::string_view key)
+    {
+        const auto it = map.find(std::string {key});
+        return it != map.end() ? &it->second : nullptr;
+    }
+
+public:
+    /**
+     * @brief Compiles the mappings.
+     *
+     * @param cpeMappings OS CPE mappings, the CPE template of each OS name prefix or platform.
+     * @param cnaMappings CNA mappings, with the "cnaMapping", "platformEquivalence" and "majorVersionEquivalence" maps.
+     */
+    void build(const nlohmann::json& cpeMappings, const nlohmann::json& cnaMappings)
+    {
+        m_cnaTemplates.clear();
+        m_platformEquivalence.clear();
+        m_majorVersionEquivalence.clear();
+        m_cpeRules.clear();
+
+        if (const auto it = cnaMappings.find("cnaMapping"); it != cnaMappings.end())
+        {
+            for (const auto& [cna, base] : it->items())
+            {
+                m_cnaTemplates.emplace(cna, Template(base.get_ref<const std::string&>(), CNA_VARIABLES));
+            }
+        }
+        if (const auto it = cnaMappings.find("platformEquivalence"); it != cnaMappings.end())
+        {
+            for (const auto& [platform, equivalence] : it->items())
+            {
+                m_platformEquivalence.emplace(platform, equivalence.get<std::string>());
+            }
+        }
+        if (const auto it = cnaMappings.find("majorVersionEquivalence"); it != cnaMappings.end())
+        {
+            for (const auto& [platform, versions] : it->items())
+            {
+                auto& equivalences = m_majorVersionEquivalence[platform];
+                for (const auto& [version, equivalence] : versions.items())
+                {
+                    equivalences.emplace(version, equivalence.get<std::string>());
+                }
+            }
+        }
+
+        // The last keys win, so the longer of two names with a common prefix is tried first.
+        for (auto it = cpeMappings.rbegin(); it != cpeMappings.rend(); ++it)
+        {
+            m_cpeRules.emplace_back(it.key(), Template(it.value().get_ref<const std::string&>(), CPE_VARIABLES));
+        }
+    }
+
+    /**
+     * @brief Gets the CNA name of a scan, with the platform and major version of the OS in the CNA terms.
+     *
+     * @param cnaName CNA name.
+     * @param platform OS platform.
+     * @param majorVersion OS major version.
+     * @return std::string CNA name, the one given if it has no base name mapping.
+     */
+    std::string cnaName(const std::string& cnaName, std::string_view platform, std::string_view majorVersion) const
+    {
+        const auto it = m_cnaTemplates.find(cnaName);
+        if (it == m_cnaTemplates.end())
+        {
+            return cnaName;
+        }
+
+        std::string name;
+        it->second.render(name,
+                          [&](const Variable variable, std::string& output)
+                          {
+                              if (variable == Variable::Platform)
+                              {
+                                  const auto* equivalence = find(m_platformEquivalence, platform);
+                                  output.append(equivalence ? std::string_view {*equivalence} : platform);
+                                  return;
+                              }
+
+                              const std::string* equivalence {nullptr};
+                              if (const auto versions = m_majorVersionEquivalence.find(std::string {platform});
+                                  versions != m_majorVersionEquivalence.end())
+                              {
+                                  equivalence = find(versions->second, majorVersion);
+                              }
+                              output.append(equivalence ? std::string_view {*equivalence} : majorVersion);
+                          });
+        return name;
+    }
+
+    /**
+     * @brief Gets the CPE name of an OS.
+     *
+     * @param os OS fields.
+     * @return std::string Lowercase CPE name, empty if the OS has no mapping.
+     */
+    std::string cpeName(const OsMappingFields& os) const
+    {
+        for (const auto& [key, cpe] : m_cpeRules)
+        {
+            if (!base::utils::string::startsWith(os.name, key) && os.platform != key)
+            {
+                continue;
+            }
+            if (cpe.empty())
+            {
+                return {};
+            }
+
+            std::string name {"cpe:/o:"};
+            cpe.render(name,
+                       [&os](const Variable variable, std::string& output)
+                       {
+                           switch (variable)
+                           {
+                               case Variable::MajorVersion: output.append(os.majorVersion); break;
+                               case Variable::MinorVersion: output.append(os.minorVersion); break;
+                               case Variable::DisplayVersion: output.append(os.displayVersion); break;
+                               case Variable::Version: output.append(os.version); break;
+                               case Variable::Release: output.append(os.release); break;
+                               case Variable::VersionUpdateHyphen:
+                                   // For SUSE the version holds the version update after a hyphen, a colon in the CPE.
+                                   for (const auto character : os.version)
+                                   {
+                                       output.push_back(character == '-' ? ':' : character);
+                                   }
+                                   break;
+                               default: break;
+                           }
+                       });
+            base::utils::string::toLowerCaseInPlace(name);
+            return name;
+        }
+        return {};
+    }
+};
+
+#endif // _OS_MAPPING_INDEX_HPP
@@ -0,0 +1,288 @@
+/*
+ * Wazuh Vulnerability scanner - Database Feed Manager
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _VENDOR_MAP_INDEX_HPP
+#define _VENDOR_MAP_INDEX_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Lookup structures compiled from the vendor map of the feed.
+ *
+ * The vendor map lists ordered rules, and the first rule that applies gives the CNA name. The source and format rules
+ * are exact matches, kept in hash maps. The prefix rules are kept in a trie and the "contains" rules in an
+ * Aho-Corasick automaton, so a vendor is matched against every rule in a single pass over it. When several rules
+ * apply, the one listed first wins, as when walking the map.
+ */
+class VendorMapIndex final
+{
+private:
+    static constexpr auto NO_NODE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Rule that applies to some platforms only.
+     */
+    struct PlatformRule final
+    {
+        std::string cna;                    ///< CNA name.
+        std::vector<std::string> platforms; ///< Platforms the rule applies to.
+    };
+
+    /**
+     * @brief Trie node, also used as Aho-Corasick automaton state.
+     */
+    struct Node final
+    {
+        std::map<char, uint32_t> next; ///< Child of each character.
+        uint32_t fail {0};             ///< Longest proper suffix state, automaton only.
+        uint32_t output {NO_NODE};     ///< Closest suffix state that ends a pattern, automaton only.
+        std::vector<uint32_t> rules;   ///< Rules whose pattern ends in this node, in map order.
+    };
+
+    std::unordered_map<std::string, std::string> m_sources; ///< CNA name of each package source.
+    std::unordered_map<std::string, std::string> m_formats; ///< CNA name of each package format.
+    std::vector<PlatformRule> m_prefixRules;                ///< Prefix rules, in map order.
+    std::vector<Node> m_prefixTrie;                         ///< Trie of the prefix rules.
+    std::vector<PlatformRule> m_containsRules;              ///< Contains rules, in map order.
+    std::vector<Node> m_containsAutomaton;                  ///< Aho-Corasick automaton of the contains rules.
+
+    static void buildExactMap(const nlohmann::json& vendorMap,
+                              const char* section,
+                              std::unordered_map<std::string, std::string>& exactMap)
+    {
+        exactMap.clear();
+        if (!vendorMap.contains(section))
+        {
+            return;
+        }
+
+        for (const auto& item : vendorMap.at(section))
+        {
+            // The first rule for a key wins.
+            exactMap.emplace(item.begin().key(), item.begin().value().get<std::string>());
+        }
+    }
+
+    static void buildTrie(const nlohmann::json& vendorMap,
+                          const char* section,
+                          std::vector<PlatformRule>& rules,
+                          std::vector<Node>& trie)
+    {
+        rules.clear();
+        trie.assign(1, Node {});
+        if (!vendorMap.contains(section))
+        {
+            return;
+        }
+
+        for (const auto& item : vendorMap.at(section))
+        {
+            const auto& value = item.begin().value();
+            rules.push_back(
+                {value.at("cna").get<std::string>(), value.at("platforms").get<std::vector<std::string>>()});
+
+            uint32_t node = 0;
+            for (const auto character : item.begin().key())
+            {
+                if (const auto it = trie[node].next.find(character); it != trie[node].next.end())
+                {
+                    node = it->second;
+                }
+                else
+                {
+                    trie.emplace_back();
+                    node = trie[node].next[character] = static_cast<uint32_t>(trie.size() - 1);
+                }
+            }
+            trie[node].rules.push_back(static_cast<uint32_t>(rules.size() - 1));
+        }
+    }
+
+    static void buildAutomaton(std::vector<Node>& trie)
+    {
+        std::queue<uint32_t> pending;
+        for (const auto& [character, child] : trie[0].next)
+        {
+            pending.push(child);
+        }
+
+        // Breadth first, so the suffix states of a node are complete before visiting it.
+        while (!pending.empty())
+        {
+            const auto node = pending.front();
+            pending.pop();
+
+            for (const auto& [character, child] : trie[node].next)
+            {
+                auto fail = trie[node].fail;
+                while (fail != 0 && trie[fail].next.count(character) == 0)
+                {
+                    fail = trie[fail].fail;
+                }
+                const auto it = trie[fail].next.find(character);
+                trie[child].fail = it != trie[fail].next.end() && it->second != child ? it->second : 0;
+
+                const auto& suffix = trie[trie[child].fail];
+                trie[child].output = trie[child].fail != 0 && !suffix.rules.empty() ? trie[child].fail : suffix.output;
+
+                pending.push(child);
+            }
+        }
+    }
+
+    /**
+     * @brief Keeps the first rule of a node that applies to the platform, if it precedes the best one so far.
+     */
+    static void selectRule(const Node& node,
+                           const std::vector<PlatformRule>& rules,
+                           std::string_view platform,
+                           uint32_t& best)
+    {
+        for (const auto rule : node.rules)
+        {
+            if (rule >= best)
+            {
+                return;
+            }
+            if (const auto& platforms = rules[rule].platforms;
+                std::find(platforms.begin(), platforms.end(), platform) != platforms.end())
+            {
+                best = rule;
+                return;
+            }
+        }
+    }
+
+    static std::string exactMatch(const std::unordered_map<std::string, std::string>& exactMap, std::string_view key)
+    {
+        const auto it = exactMap.find(std::string {key});
+        return it != exactMap.end() ? it->second : std::string {};
+    }
+
+public:
+    /**
+     * @brief Compiles the rules of a vendor map.
+     *
+     * @param vendorMap Vendor map, with the "source", "format", "prefix" and "contains" rule lists.
+     */
+    void build(const nlohmann::json& vendorMap)
+    {
+        buildExactMap(vendorMap, "source", m_sources);
+        buildExactMap(vendorMap, "format", m_formats);
+        buildTrie(vendorMap, "prefix", m_prefixRules, m_prefixTrie);
+        buildTrie(vendorMap, "contains", m_containsRules, m_containsAutomaton);
+        buildAutomaton(m_containsAutomaton);
+    }
+
+    /**
+     * @brief Get CNA/ADP name based on the package source.
+     *
+     * @param source Package source.
+     * @return std::string CNA/ADP name. Empty string otherwise.
+     */
+    std::string bySource(std::string_view source) const
+    {
+        return exactMatch(m_sources, source);
+    }
+
+    /**
+     * @brief Get CNA/ADP name based on the package format.
+     *
+     * @param format Package format.
+     * @return std::string CNA/ADP name. Empty string otherwise.
+     */
+    std::string byFormat(std::string_view format) const
+    {
+        return exactMatch(m_formats, format);
+    }
+
+    /**
+     * @brief Get CNA/ADP name based on the package vendor when it starts with the rule key.
+     *
+     * @param vendor Package vendor.
+     * @param platform Os platform.
+     * @return std::string CNA/ADP name. Empty string otherwise.
+     */
+    std::string byPrefix(std::string_view vendor, std::string_view platform) const
+    {
+        if (m_prefixTrie.empty())
+        {
+            return {};
+        }
+
+        auto best = NO_NODE;
+        uint32_t node = 0;
+        selectRule(m_prefixTrie[node], m_prefixRules, platform, best);
+        for (const auto character : vendor)
+        {
+            const auto it = m_prefixTrie[node].next.find(character);
+            if (it == m_prefixTrie[node].next.end())
+            {
+                break;
+            }
+            node = it->second;
+            selectRule(m_prefixTrie[node], m_prefixRules, platform, best);
+        }
+
+        return best != NO_NODE ? m_prefixRules[best].cna : std::string {};
+    }
+
+    /**
+     * @brief Get CNA/ADP name based on the package vendor when it contains the rule key.
+     *
+     * @param vendor Package vendor.
+     * @param platform Os platform.
+     * @return std::string CNA/ADP name. Empty string otherwise.
+     */
+    std::string byContains(std::string_view vendor, std::string_view platform) const
+    {
+        if (m_containsAutomaton.empty())
+        {
+            return {};
+        }
+
+        auto best = NO_NODE;
+        uint32_t state = 0;
+        selectRule(m_containsAutomaton[state], m_containsRules, platform, best);
+        for (const auto character : vendor)
+        {
+            while (state != 0 && m_containsAutomaton[state].next.count(character) == 0)
+            {
+                state = m_containsAutomaton[state].fail;
+            }
+            if (const auto it = m_containsAutomaton[state].next.find(character);
+                it != m_containsAutomaton[state].next.end())
+            {
+                state = it->second;
+            }
+
+            // Every pattern ending here is the state itself or one of its suffix states.
+            for (auto match = m_containsAutomaton[state].rules.empty() ? m_containsAutomaton[state].output : state;
+                 match != NO_NODE && match != 0;
+                 match = m_containsAutomaton[match].output)
+            {
+                selectRule(m_containsAutomaton[match], m_containsRules, platform, best);
+            }
+        }
+
+        return best != NO_NODE ? m_containsRules[best].cna : std::string {};
+    }
+};
+
+#endif // _VENDOR_MAP_INDEX_HPP
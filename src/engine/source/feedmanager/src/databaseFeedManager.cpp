@@ -13,14 +13,46 @@
 #include "base/logging.hpp"
 #include "eventDecoder.hpp"
 #include "storeModel.hpp"
+#include <algorithm>
+#include <exception>
+#include <iterator>
+#include <thread>
 
-DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
+namespace
+{
+/**
+ * @brief Gets the keys that are not in the container yet, without repetitions and sorted as MultiGet expects them.
+ *
+ * @param keys Requested keys.
+ * @param container Container of the already retrieved keys.
+ * @return std::vector<std::string> Keys to look up.
+ */
+template<typename Container>
+std::vector<std::string> pendingKeys(const std::vector<std::string>& keys, const Container& container)
+{
+    std::vector<std::string> pending;
+    pending.reserve(keys.size());
+    std::copy_if(keys.begin(),
+                 keys.end(),
+                 std::back_inserter(pending),
+                 [&container](const auto& key) { return container.find(key) == container.end(); });
+
+    std::sort(pending.begin(), pending.end());
+    pending.erase(std::unique(pending.begin(), pending.end()), pending.end());
+    return pending;
+}
+} // namespace
+
+DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex,
+                                         const bool trustFeedDatabase,
+                                         const utils::rocksdb::RocksDBTuning& feedTuning)
     : m_mutex(mutex)
+    , m_trustFeedDatabase(trustFeedDatabase)
 {
     try
     {
         LOG_INFO("Starting database file decompression.");
-        m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(DATABASE_PATH, false);
+        m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(DATABASE_PATH, false, feedTuning);
 
         // Try to load global maps from the database, if it fails we throw an exception to force the download of
         // the complete feed.
@@ -32,7 +64,7 @@ DatabaseFeedManager::DatabaseFeedManager(std::shared_mutex& mutex)
         if (!m_feedDatabase)
         {
             std::filesystem::remove_all(DATABASE_PATH);
-            m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(DATABASE_PATH, false);
+            m_feedDatabase = std::make_unique<utils::rocksdb::RocksDBWrapper>(DATABASE_PATH, false, feedTuning);
         }
 
         LOG_ERROR("Error opening the database: {}, trying to re-download the feed.", ex.what());
@@ -90,6 +122,39 @@ void DatabaseFeedManager::getVulnerabilityRemediation(
         NSVulnerabilityScanner::GetRemediationInfo(reinterpret_cast<const uint8_t*>(dtoVulnRemediation.slice.data()));
 }
 
+void DatabaseFeedManager::getVulnerabilitiesRemediation(const std::vector<std::string>& cveIds,
+                                                        VulnerabilityRemediations& remediations)
+{
+    const auto keys = pendingKeys(cveIds, remediations);
+    if (keys.empty())
+    {
+        return;
+    }
+
+    std::vector<rocksdb::PinnableSlice> values;
+    const auto found = m_feedDatabase->multiGet(keys, values, REMEDIATIONS_COLUMN);
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        // If the remediation information is not found in the database, there is no remediation for the CVE.
+        if (!found[i])
+        {
+            continue;
+        }
+
+        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
+            !NSVulnerabilityScanner::VerifyRemediationInfoBuffer(verifier))
+        {
+            throw std::runtime_error("Error: Invalid FlatBuffers data in RocksDB.");
+        }
+
+        auto& remediation = remediations[keys[i]];
+        remediation.slice = std::move(values[i]);
+        remediation.data =
+            NSVulnerabilityScanner::GetRemediationInfo(reinterpret_cast<const uint8_t*>(remediation.slice.data()));
+    }
+}
+
 std::unordered_set<std::string> DatabaseFeedManager::getHotfixVulnerabilities(const std::string& hotfix)
 {
     std::unordered_set<std::string> hotfixVulnerabilities;
@@ -103,6 +168,53 @@ std::unordered_set<std::string> DatabaseFeedManager::getHotfixVulnerabilities(co
     return hotfixVulnerabilities;
 }
 
+HotfixRemediations DatabaseFeedManager::getHotfixRemediations(const nlohmann::json& hotfixes) const
+{
+    std::vector<uint64_t> bitmap((m_remediatedCveIds.size() + 63) / 64, 0);
+    for (const auto& hotfix : hotfixes)
+    {
+        if (!hotfix.is_string())
+        {
+            continue;
+        }
+
+        if (const auto it = m_hotfixCves.find(hotfix.get_ref<const std::string&>()); it != m_hotfixCves.end())
+        {
+            for (const auto cve : it->second)
+            {
+                bitmap[cve / 64] |= uint64_t {1} << (cve % 64);
+            }
+        }
+    }
+
+    return {&m_remediatedCveIds, std::move(bitmap)};
+}
+
+void DatabaseFeedManager::loadHotfixRemediations()
+{
+    m_remediatedCveIds.clear();
+    m_hotfixCves.clear();
+
+    if (!m_feedDatabase->columnExists(HOTFIXES_APPLICATIONS_COLUMN))
+    {
+        return;
+    }
+
+    // The keys are '${hotfix}_${CVE-ID}', and CVE ids have no underscores.
+    for (const auto& [key, value] : m_feedDatabase->begin(HOTFIXES_APPLICATIONS_COLUMN))
+    {
+        const auto separator = key.rfind('_');
+        if (separator == std::string::npos)
+        {
+            continue;
+        }
+
+        const auto cve = m_remediatedCveIds.emplace(key.substr(separator + 1),
+                                                    static_cast<uint32_t>(m_remediatedCveIds.size()));
+        m_hotfixCves[key.substr(0, separator)].push_back(cve.first->second);
+    }
+}
+
 void DatabaseFeedManager::fillL2CacheTranslations()
 {
     // Clear the Level 1 and Level 2 cache before filling the Level 2 cache
@@ -117,7 +229,7 @@ void DatabaseFeedManager::fillL2CacheTranslations()
     for (const auto& [key, value] : m_feedDatabase->begin(TRANSLATIONS_COLUMN))
     {
         // Check if the cache is full
-        if (m_translationL2Cache->isFull())
+        if (m_translationL2Cache->size() >= TRANSLATION_CACHE_SIZE)
         {
             break; // Exit the loop if cache is full
         }
@@ -159,7 +271,7 @@ void DatabaseFeedManager::fillL2CacheTranslations()
         }
 
         // Insert translation into cache
-        m_translationL2Cache->insertKey(key, translationQuery);
+        m_translationL2Cache->emplace_back(key, std::move(translationQuery));
     }
 }
 
@@ -169,50 +281,49 @@ std::vector<PackageData> DatabaseFeedManager::getTranslationFromL2(const Package
     // Vector to store the resulting translations
     std::vector<PackageData> translationResult;
 
-    // Iterate over the Level 2 cache data
-    m_translationL2Cache->forEach(
-        [&]([[maybe_unused]] const auto& key, const auto& cacheData)
+    // Iterate over the Level 2 cache data, in the order of the translation IDs
+    for ([[maybe_unused]] const auto& [key, cacheData] : *m_translationL2Cache)
+    {
+        /* Check conditions, skip the translation if any of them fails */
+        // - The target platform matches the provided OS platform
+        if (std::find(cacheData.target.begin(), cacheData.target.end(), osPlatform) == cacheData.target.end())
         {
-            /* Check conditions, return true to continue the loop, false to break it */
-            // - The target platform matches the provided OS platform
-            if (std::find(cacheData.target.begin(), cacheData.target.end(), osPlatform) == cacheData.target.end())
-            {
-                return true;
-            }
-            // - The package name matches the product regex if present
-            if (cacheData.productRegex.has_value() && !std::regex_search(package.name, cacheData.productRegex.value()))
-            {
-                return true;
-            }
-            // - The vendor matches the vendor regex if present
-            if (cacheData.vendorRegex.has_value() && !std::regex_search(package.vendor, cacheData.vendorRegex.value()))
+            continue;
+        }
+        // - The package name matches the product regex if present
+        if (cacheData.productRegex.has_value() && !std::regex_search(package.name, cacheData.productRegex.value()))
+        {
+            continue;
+        }
+        // - The vendor matches the vendor regex if present
+        if (cacheData.vendorRegex.has_value() && !std::regex_search(package.vendor, cacheData.vendorRegex.value()))
+        {
+            continue;
+        }
+
+        // Append the matching translation to the result vector
+        for (const auto& translatedPackage : cacheData.translation)
+        {
+            PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
+            // Search for version regex or use translated version
+            if (std::smatch stringFound;
+                cacheData.versionRegex.has_value()
+                && std::regex_search(package.name, stringFound, cacheData.versionRegex.value())
+                && !stringFound.empty())
             {
-                return true;
+                // We only consider the first capture group
+                translatedResult.version = stringFound.str(1);
             }
-
-            // Append the matching translation to the result vector
-            for (const auto& translatedPackage : cacheData.translation)
+            else
             {
-                PackageData translatedResult {.name = translatedPackage.name, .vendor = translatedPackage.vendor};
-                // Search for version regex or use translated version
-                if (std::smatch stringFound;
-                    cacheData.versionRegex.has_value()
-                    && std::regex_search(package.name, stringFound, cacheData.versionRegex.value())
-                    && !stringFound.empty())
-                {
-                    // We only consider the first capture group
-                    translatedResult.version = stringFound.str(1);
-                }
-                else
-                {
-                    translatedResult.version = translatedPackage.version;
-                }
-                translationResult.push_back(std::move(translatedResult));
+                translatedResult.version = translatedPackage.version;
             }
+            translationResult.push_back(std::move(translatedResult));
+        }
 
-            // Break the loop after finding the first matching translation
-            return false;
-        });
+        // Break the loop after finding the first matching translation
+        break;
+    }
 
     // Return the vector containing the matching translations
     return translationResult;
@@ -234,10 +345,12 @@ void DatabaseFeedManager::getVulnerabilitiesCandidates(
     packageNameWithSeparator.append(package.name);
     packageNameWithSeparator.append("_CVE");
 
+    const auto trusted = isTrustedColumn(cnaName, NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer);
+
     for (const auto& [key, value] : m_feedDatabase->seek(packageNameWithSeparator, cnaName))
     {
         if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
-            !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
+            !trusted && !NSVulnerabilityScanner::VerifyScanVulnerabilityCandidateArrayBuffer(verifier))
         {
             throw std::runtime_error(
                 "Error getting ScanVulnerabilityCandidateArray object from rocksdb. FlatBuffers verifier failed");
@@ -287,26 +400,30 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
         }
     };
 
-    // Check first the filter
-    if (m_translationFilter->count(cacheKey) > 0)
+    // The filter is updated while scanning, so several scans may access it at once.
     {
-        LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
-                  package.name,
-                  osPlatform);
-        return vulnerabilityTranslations;
+        std::shared_lock filterLock(m_translationMutex);
+
+        // Check first the filter
+        if (m_translationFilter->count(cacheKey) > 0)
+        {
+            LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
+                      package.name,
+                      osPlatform);
+            return vulnerabilityTranslations;
+        }
     }
 
-    // Check Level 1 cache
-    if (m_translationL1Cache->isHit(cacheKey))
+    // Check Level 1 cache, it has its own locking
+    if (const auto L1Translations = m_translationL1Cache->getValue(cacheKey); L1Translations.has_value())
     {
         LOG_DEBUG("Translation for package '{}' on platform '{}' found in Level 1 cache.", package.name, osPlatform);
 
-        const auto L1Translations = m_translationL1Cache->getValue(cacheKey).value();
-        translatePackage(L1Translations);
+        translatePackage(L1Translations.value());
         return vulnerabilityTranslations;
     }
 
-    // Check Level 2 cache
+    // Check Level 2 cache, it is only written during the feed update
     const auto L2Translations = getTranslationFromL2(package, osPlatform);
     if (!L2Translations.empty())
     {
@@ -320,7 +437,10 @@ std::vector<PackageData> DatabaseFeedManager::checkAndTranslatePackage(const Pac
     }
 
     // Insert the key in the filter to avoid searching for it again
-    m_translationFilter->insert(cacheKey);
+    {
+        std::unique_lock filterLock(m_translationMutex);
+        m_translationFilter->insert(cacheKey);
+    }
     LOG_DEBUG("No translation exists for package '{}' on platform '{}'. Using provided package data.",
               package.name,
               osPlatform);
@@ -357,71 +477,58 @@ void DatabaseFeedManager::getVulnerabiltyDescriptiveInformation(
         NSVulnerabilityScanner::GetVulnerabilityDescription(resultContainer.slice.data()));
 }
 
-std::string DatabaseFeedManager::getCnaNameBySource(std::string_view source) const
+void DatabaseFeedManager::getVulnerabilitiesDescriptiveInformation(const std::vector<std::string>& cveIds,
+                                                                   VulnerabilityDescriptions& resultContainer)
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("source"))
+    const auto keys = pendingKeys(cveIds, resultContainer);
+    if (keys.empty())
     {
-        for (const auto& item : vendorMap.at("source"))
-        {
-            if (source == item.begin().key())
-            {
-                return item.begin().value();
-            }
-        }
+        return;
     }
 
-    return {};
-}
+    std::vector<rocksdb::PinnableSlice> values;
+    const auto found = m_feedDatabase->multiGet(keys, values, DESCRIPTIONS_COLUMN);
 
-std::string DatabaseFeedManager::getCnaNameByFormat(std::string_view format) const
-{
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("format"))
+    for (size_t i = 0; i < keys.size(); ++i)
     {
-        for (const auto& item : vendorMap.at("format"))
+        if (!found[i])
         {
-            if (format == item.begin().key())
-            {
-                return item.begin().value();
-            }
+            throw std::runtime_error(
+                "Error getting VulnerabilityDescription object from rocksdb. Object not found for cveId: " + keys[i]);
+        }
+
+        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(values[i].data()), values[i].size());
+            NSVulnerabilityScanner::VerifyVulnerabilityDescriptionBuffer(verifier) == false)
+        {
+            throw std::runtime_error(
+                "Error getting VulnerabilityDescription object from rocksdb. FlatBuffers verifier failed");
         }
+
+        auto& description = resultContainer[keys[i]];
+        description.slice = std::move(values[i]);
+        description.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+            NSVulnerabilityScanner::GetVulnerabilityDescription(description.slice.data()));
     }
+}
 
-    return {};
+std::string DatabaseFeedManager::getCnaNameBySource(std::string_view source) const
+{
+    return m_vendorMapIndex.bySource(source);
 }
 
-std::string DatabaseFeedManager::getCnaNameByContains(std::string_view vendor, std::string_view platform) const
+std::string DatabaseFeedManager::getCnaNameByFormat(std::string_view format) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("contains"))
-    {
-        for (const auto& item : vendorMap.at("contains"))
-        {
-            if (const auto& platforms = item.begin().value().at("platforms");
-                vendor.find(item.begin().key()) != std::string::npos
-                && std::find(platforms.begin(), platforms.end(), platform) != platforms.end())
-            {
-                return item.begin().value().at("cna");
-            }
-        }
-    }
+    return m_vendorMapIndex.byFormat(format);
+}
 
-    return {};
+std::string DatabaseFeedManager::getCnaNameByContains(std::string_view vendor, std::string_view platform) const
+{
+    return m_vendorMapIndex.byContains(vendor, platform);
 }
 
 std::string DatabaseFeedManager::getCnaNameByPrefix(std::string_view vendor, std::string_view platform) const
 {
-    if (const auto& vendorMap = vendorsMap(); vendorMap.contains("prefix"))
-    {
-        for (const auto& item : vendorMap.at("prefix"))
-        {
-            if (const auto& platforms = item.begin().value().at("platforms");
-                base::utils::string::startsWith(vendor.data(), item.begin().key())
-                && std::find(platforms.begin(), platforms.end(), platform) != platforms.end())
-            {
-                return item.begin().value().at("cna");
-            }
-        }
-    }
-    return {};
+    return m_vendorMapIndex.byPrefix(vendor, platform);
 }
 
 uint32_t DatabaseFeedManager::getCacheSizeFromConfig() const
@@ -446,6 +553,7 @@ void DatabaseFeedManager::reloadGlobalMaps()
     }
 
     m_vendorsMap = nlohmann::json::parse(result);
+    m_vendorMapIndex.build(m_vendorsMap);
 
     rocksdb::PinnableSlice queryResult;
     if (!m_feedDatabase->get("OSCPE-GLOBAL", queryResult, OS_CPE_RULES_COLUMN))
@@ -461,9 +569,150 @@ void DatabaseFeedManager::reloadGlobalMaps()
         throw std::runtime_error("Error getting CNA Mapping content from rocksdb.");
     }
     m_cnaMappings = nlohmann::json::parse(queryResult.ToString());
+    m_osMappingIndex.build(m_cpeMappings, m_cnaMappings);
 
     // Load translations into the Level 2 cache
     fillL2CacheTranslations();
+
+    // Load the hotfix remediations used by the Windows scans
+    loadHotfixRemediations();
+
+    // Any result computed with the previous feed is now stale.
+    ++m_feedGeneration;
+
+    // The columns may have new values, they must be verified again.
+    std::unique_lock columnTrustLock(m_columnTrustMutex);
+    m_columnTrust.clear();
+}
+
+bool DatabaseFeedManager::isTrustedColumn(const std::string& columnName, bool (*verify)(flatbuffers::Verifier&))
+{
+    if (!m_trustFeedDatabase)
+    {
+        return false;
+    }
+
+    {
+        std::shared_lock lock(m_columnTrustMutex);
+        if (const auto it = m_columnTrust.find(columnName); it != m_columnTrust.end())
+        {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(m_columnTrustMutex);
+    // Another scan may have verified the column while waiting for the lock.
+    if (const auto it = m_columnTrust.find(columnName); it != m_columnTrust.end())
+    {
+        return it->second;
+    }
+
+    // Unknown columns are left to the caller, which reports the error on read.
+    if (!m_feedDatabase->columnExists(columnName))
+    {
+        return false;
+    }
+
+    auto trusted = true;
+    for (const auto& [key, value] : m_feedDatabase->begin(columnName))
+    {
+        if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(value.data()), value.size());
+            !verify(verifier))
+        {
+            LOG_WARNING("Invalid FlatBuffers data in column '{}' for key '{}', its values will be verified on read.",
+                        columnName,
+                        key);
+            trusted = false;
+            break;
+        }
+    }
+
+    m_columnTrust.emplace(columnName, trusted);
+    return trusted;
+}
+
+void DatabaseFeedManager::updateFeed(const std::vector<nlohmann::json>& resources)
+{
+    LOG_INFO("Initiating update feed process.");
+
+    // Encoding the payloads is most of the work and needs no database access, so the workers take it over.
+    std::vector<flatbuffers::DetachedBuffer> decoded(resources.size());
+    std::atomic<size_t> nextResource {0};
+    std::atomic<bool> failed {false};
+    std::exception_ptr error;
+
+    auto worker = [&]()
+    {
+        try
+        {
+            for (auto i = nextResource++; i < resources.size() && !failed; i = nextResource++)
+            {
+                decoded[i] = EventDecoder::decodeCreatedResource(resources[i]);
+            }
+        }
+        catch (...)
+        {
+            // Keep the first error, it is rethrown once all the workers are done.
+            if (!failed.exchange(true))
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    const auto workers = std::clamp<size_t>(
+        resources.size() / MIN_RESOURCES_PER_WORKER, 1, std::max(1U, std::thread::hardware_concurrency()));
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t i = 1; i < workers; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    auto eventDecoder = std::make_shared<EventDecoder>();
+    eventDecoder->setLast(std::make_shared<StoreModel>());
+
+    {
+        // Storing may create columns, which isn't safe while scanning, so the scans wait until the batch is written.
+        std::unique_lock lock(m_mutex);
+
+        static const std::vector<char> EMPTY_MESSAGE;
+        utils::rocksdb::RocksDBWriteBatch batch(m_feedDatabase.get());
+        for (size_t i = 0; i < resources.size(); ++i)
+        {
+            auto eventContext = std::make_shared<EventContext>(EventContext {.message = EMPTY_MESSAGE,
+                                                                             .resource = resources[i],
+                                                                             .feedDatabase = &batch,
+                                                                             .resourceType = ResourceType::UNKNOWN,
+                                                                             .decodedPayload = std::move(decoded[i])});
+            eventDecoder->handleRequest(std::move(eventContext));
+        }
+
+        LOG_DEBUG("Writing {} feed changes.", batch.size());
+        batch.commit();
+    }
+
+    // Verify vendor-map and oscpe-map values and update the maps in memory
+    reloadGlobalMaps();
+
+    LOG_INFO("Feed update process completed.");
+}
+
+uint64_t DatabaseFeedManager::feedGeneration() const
+{
+    return m_feedGeneration;
 }
 
 auto DatabaseFeedManager::cnaMappings() const -> const nlohmann::json&
@@ -476,6 +725,11 @@ auto DatabaseFeedManager::cpeMappings() const -> const nlohmann::json&
     return m_cpeMappings;
 }
 
+auto DatabaseFeedManager::osMappingIndex() const -> const OsMappingIndex&
+{
+    return m_osMappingIndex;
+}
+
 auto DatabaseFeedManager::vendorsMap() const -> const nlohmann::json&
 {
     return m_vendorsMap;
@@ -38,6 +38,7 @@ struct EventContext final
     flatbuffers::DetachedBuffer cve5Buffer;        ///< CVE data.
     utils::rocksdb::IRocksDBWrapper* feedDatabase; ///< CVEs database.
     ResourceType resourceType;                     ///< Resource type.
+    flatbuffers::DetachedBuffer decodedPayload;    ///< Payload already encoded in FlatBuffers, empty if not.
 };
 
 #endif // _EVENT_CONTEXT_HPP
@@ -50,30 +50,8 @@ private:
     {
         if (data->resource.contains("resource"))
         {
-            if (base::utils::string::startsWith(data->resource.at("resource").get<std::string_view>(), "TID-"))
-            {
-                data->resourceType = ResourceType::TRANSLATION;
-            }
-            else if (base::utils::string::startsWith(data->resource.at("resource").get<std::string_view>(), "CVE-"))
-            {
-                data->resourceType = ResourceType::CVE;
-            }
-            else if (base::utils::string::startsWith(data->resource.at("resource").get<std::string_view>(),
-                                                     "FEED-GLOBAL"))
-            {
-                data->resourceType = ResourceType::VENDOR_MAP;
-            }
-            else if (base::utils::string::startsWith(data->resource.at("resource").get<std::string_view>(),
-                                                     "OSCPE-GLOBAL"))
-            {
-                data->resourceType = ResourceType::OSCPE_RULES;
-            }
-            else if (base::utils::string::startsWith(data->resource.at("resource").get<std::string_view>(),
-                                                     "CNA-MAPPING-GLOBAL"))
-            {
-                data->resourceType = ResourceType::CNA_MAPPING;
-            }
-            else
+            data->resourceType = resourceType(data->resource.at("resource").get<std::string_view>());
+            if (data->resourceType == ResourceType::UNKNOWN)
             {
                 LOG_ERROR("Invalid resource type: {}.", data->resource.at("resource").get_ref<const std::string&>());
                 return;
@@ -100,21 +78,15 @@ private:
                 }
                 else
                 {
-                    // Resources in flatbuffer format.
-                    flatbuffers::Parser parser;
-
-                    if (!parser.Parse(schema) || !parser.Parse(data->resource.at("payload").dump().c_str()))
-                    {
-                        throw std::runtime_error("Unable to parse payload: " + parser.error_);
-                    }
+                    // Resources in flatbuffer format, unless they were decoded beforehand.
+                    auto buffer = data->decodedPayload.data() ? std::move(data->decodedPayload)
+                                                              : decodePayload(schema, data->resource.at("payload"));
 
-                    rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(parser.builder_.GetBufferPointer()),
-                                                      parser.builder_.GetSize());
+                    rocksdb::Slice flatbufferResource(reinterpret_cast<const char*>(buffer.data()), buffer.size());
                     data->feedDatabase->put(data->resource.at("resource"), flatbufferResource, column);
                     if (data->resourceType == ResourceType::CVE)
                     {
-                        flatbuffers::FlatBufferBuilder& builder = parser.builder_;
-                        data->cve5Buffer = builder.Release();
+                        data->cve5Buffer = std::move(buffer);
                     }
                 }
             }
@@ -205,7 +177,82 @@ private:
         }
     }
 
+    /**
+     * @brief Encodes a payload in the FlatBuffers format of its schema.
+     *
+     * @param schema FlatBuffers schema of the resource.
+     * @param payload Resource payload.
+     * @return flatbuffers::DetachedBuffer Encoded payload.
+     */
+    static flatbuffers::DetachedBuffer decodePayload(const char* schema, const nlohmann::json& payload)
+    {
+        flatbuffers::Parser parser;
+
+        if (!parser.Parse(schema) || !parser.Parse(payload.dump().c_str()))
+        {
+            throw std::runtime_error("Unable to parse payload: " + parser.error_);
+        }
+
+        return parser.builder_.Release();
+    }
+
 public:
+    /**
+     * @brief Gets the type of a resource from its name.
+     *
+     * @param resource Resource name.
+     * @return ResourceType Resource type, UNKNOWN if the name has no known prefix.
+     */
+    static ResourceType resourceType(std::string_view resource)
+    {
+        if (base::utils::string::startsWith(resource, "TID-"))
+        {
+            return ResourceType::TRANSLATION;
+        }
+        if (base::utils::string::startsWith(resource, "CVE-"))
+        {
+            return ResourceType::CVE;
+        }
+        if (base::utils::string::startsWith(resource, "FEED-GLOBAL"))
+        {
+            return ResourceType::VENDOR_MAP;
+        }
+        if (base::utils::string::startsWith(resource, "OSCPE-GLOBAL"))
+        {
+            return ResourceType::OSCPE_RULES;
+        }
+        if (base::utils::string::startsWith(resource, "CNA-MAPPING-GLOBAL"))
+        {
+            return ResourceType::CNA_MAPPING;
+        }
+        return ResourceType::UNKNOWN;
+    }
+
+    /**
+     * @brief Encodes the payload of a created resource in FlatBuffers format, without touching the database.
+     *
+     * Decoding is most of the cost of storing a resource, and it doesn't depend on any other resource, so the feed
+     * update decodes the resources in parallel before storing them in order.
+     *
+     * @param resource Resource message.
+     * @return flatbuffers::DetachedBuffer Encoded payload, empty if the resource isn't a FlatBuffers creation.
+     */
+    static flatbuffers::DetachedBuffer decodeCreatedResource(const nlohmann::json& resource)
+    {
+        if (!resource.contains("resource") || !resource.contains("payload") || resource.value("type", "") != "create")
+        {
+            return {};
+        }
+
+        const auto type = resourceType(resource.at("resource").get<std::string_view>());
+        if (type == ResourceType::UNKNOWN || !SCHEMA.at(type))
+        {
+            return {};
+        }
+
+        return decodePayload(SCHEMA.at(type), resource.at("payload"));
+    }
+
     /**
      * @brief Handles request and passes control to the next step of the chain.
      *
@@ -46,6 +46,16 @@ public:
                  FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo>& dtoVulnRemediation),
                 ());
 
+    /**
+     * @brief Mock method for getVulnerabilitiesRemediation.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(void,
+                getVulnerabilitiesRemediation,
+                (const std::vector<std::string>& cveIds, VulnerabilityRemediations& remediations),
+                ());
+
     /**
      * @brief Mock method for fillL2CacheTranslations.
      *
@@ -105,6 +115,16 @@ public:
                  FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer),
                 ());
 
+    /**
+     * @brief Mock method for getVulnerabilitiesDescriptiveInformation.
+     *
+     * @note This method is intended for testing purposes and does not perform any real action.
+     */
+    MOCK_METHOD(void,
+                getVulnerabilitiesDescriptiveInformation,
+                (const std::vector<std::string>& cveIds, VulnerabilityDescriptions& resultContainer),
+                ());
+
     /**
      * @brief Mock method for getCnaNameByFormat.
      */
@@ -139,6 +159,24 @@ public:
      *
      */
     MOCK_METHOD(const nlohmann::json&, cnaMappings, (), ());
+
+    /**
+     * @brief Mock method for osMappingIndex.
+     *
+     */
+    MOCK_METHOD(const OsMappingIndex&, osMappingIndex, (), ());
+
+    /**
+     * @brief Mock method for feedGeneration.
+     *
+     */
+    MOCK_METHOD(uint64_t, feedGeneration, (), ());
+
+    /**
+     * @brief Mock method for getHotfixRemediations.
+     *
+     */
+    MOCK_METHOD(HotfixRemediations, getHotfixRemediations, (const nlohmann::json& hotfixes), ());
 };
 
 #endif // _MOCK_DATABASEFEEDMANAGER_HPP
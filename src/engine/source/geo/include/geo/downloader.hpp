@@ -12,6 +12,7 @@ public:
     virtual ~Downloader() = default;
 
     base::RespOrError<std::string> downloadHTTPS(const std::string& url) const override;
+    base::RespOrError<std::string> downloadHTTPSToFile(const std::string& url, const std::string& path) const override;
     std::string computeMD5(const std::string& data) const override;
     base::RespOrError<std::string> downloadMD5(const std::string& url) const override;
 };
@@ -3,6 +3,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
 #include <string>
 
@@ -17,12 +18,14 @@ namespace geo
  * @brief Class to hold the needed information for a database.
  */
 class DbEntry;
+class DbHandle;
 
 auto constexpr MAX_RETRIES = 3;
 static const std::string INTERNAL_NAME = "geo";
 static const std::string PATH_PATH = "/path";
 static const std::string HASH_PATH = "/hash";
 static const std::string TYPE_PATH = "/type";
+static const std::string TMP_SUFFIX = ".tmp"; ///< Suffix of the downloaded database until it replaces the previous one
 
 class Manager final : public IManager
 {
@@ -30,10 +33,20 @@ private:
     std::map<std::string, std::shared_ptr<DbEntry>> m_dbs; ///< The databases that have been added.
     std::map<Type, std::string> m_dbTypes;  ///< Map by Types for quick access to the db name. (only one db per type)
     mutable std::shared_mutex m_rwMapMutex; ///< Mutex to avoid simultaneous updates on the db map
+    std::mutex m_upsertMutex;               ///< Mutex to guard the per database update mutexes
+    std::map<std::string, std::shared_ptr<std::mutex>> m_upsertMutexes; ///< One remote update at a time per database
 
     std::shared_ptr<store::IStoreInternal> m_store; ///< The store used to store the MMDB hash.
     std::shared_ptr<IDownloader> m_downloader;      ///< The downloader used to download the MMDB database.
 
+    /**
+     * @brief Get the mutex that serializes the remote updates of a database.
+     *
+     * @param name The name of the database.
+     * @return std::shared_ptr<std::mutex> The mutex of the database, created on first use.
+     */
+    std::shared_ptr<std::mutex> upsertMutex(const std::string& name);
+
     /**
      * @brief Upsert the internal store entry for a database.
      *
@@ -42,6 +55,15 @@ private:
      */
     base::OptError upsertStoreEntry(const std::string& path);
 
+    /**
+     * @brief Upsert the internal store entry for a database whose hash is already known.
+     *
+     * @param path The path to the database.
+     * @param hash The MD5 of the database.
+     * @return base::OptError An error if the store entry could not be upserted.
+     */
+    base::OptError upsertStoreEntry(const std::string& path, const std::string& hash);
+
     /**
      * @brief Remove the internal store entry for a database.
      *
@@ -56,9 +78,11 @@ private:
      * @param path Path to the database.
      * @param type Type of the database.
      * @param upsertStore Whether to upsert the store entry.
+     * @param handle The opened database, nullptr to open it from the path.
      * @return base::OptError An error if the database could not be added.
      */
-    base::OptError addDbUnsafe(const std::string& path, Type type, bool upsertStore);
+    base::OptError
+    addDbUnsafe(const std::string& path, Type type, bool upsertStore, std::shared_ptr<const DbHandle> handle = nullptr);
 
     /**
      * @brief Remove a database from the manager without any thread safety checks.
@@ -69,13 +93,12 @@ private:
     base::OptError removeDbUnsafe(const std::string& path);
 
     /**
-     * @brief Write the MMDB database to the filesystem.
+     * @brief Create the directories of a database file.
      *
      * @param path Path to store the database.
-     * @param content The content of the database.
-     * @return base::OptError An error if the database could not be written.
+     * @return base::OptError An error if the directories could not be created.
      */
-    base::OptError writeDb(const std::string& path, const std::string& content);
+    base::OptError createDbDirectories(const std::string& path);
 
 public:
     virtual ~Manager() = default;
@@ -13,6 +13,17 @@ public:
     virtual ~IDownloader() = default;
 
     virtual base::RespOrError<std::string> downloadHTTPS(const std::string& url) const = 0;
+
+    /**
+     * @brief Download the content of the URL into a file, hashing it as it is received, so the content is neither held
+     * in memory nor read back to be verified.
+     *
+     * @param url URL to download.
+     * @param path File to write, replaced if it exists.
+     * @return base::RespOrError<std::string> The MD5 of the content, or an error if the download failed.
+     */
+    virtual base::RespOrError<std::string> downloadHTTPSToFile(const std::string& url,
+                                                               const std::string& path) const = 0;
     virtual std::string computeMD5(const std::string& data) const = 0;
     virtual base::RespOrError<std::string> downloadMD5(const std::string& url) const = 0;
 };
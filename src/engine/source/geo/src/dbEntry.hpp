@@ -1,32 +1,91 @@
 #ifndef _GEO_DBENTRY_HPP
 #define _GEO_DBENTRY_HPP
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
+#include <string>
 
+#include <fmt/format.h>
 #include <maxminddb.h>
 
+#include <base/error.hpp>
 #include <geo/imanager.hpp>
 
 namespace geo
 {
 
+/**
+ * @brief Opened MMDB database, closed when the last reader releases it.
+ */
+class DbHandle
+{
+private:
+    static inline std::atomic<uint64_t> s_ids {1}; ///< Ids of the opened databases, 0 is never used
+
+    bool m_opened; ///< The database was opened and must be closed
+
+    DbHandle()
+        : m_opened(false)
+        , id(s_ids.fetch_add(1, std::memory_order_relaxed))
+        , mmdb(std::make_unique<MMDB_s>())
+    {
+    }
+
+public:
+    const uint64_t id;                  ///< Unique id of the opened database, for the lookup caches
+    const std::unique_ptr<MMDB_s> mmdb; ///< The MMDB database.
+
+    /**
+     * @brief Open a MMDB database.
+     *
+     * @param path The path to the database.
+     * @return base::RespOrError<std::shared_ptr<const DbHandle>> The opened database or an error.
+     */
+    static base::RespOrError<std::shared_ptr<const DbHandle>> open(const std::string& path)
+    {
+        std::shared_ptr<DbHandle> handle(new DbHandle());
+        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, handle->mmdb.get());
+        if (MMDB_SUCCESS != status)
+        {
+            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        }
+
+        handle->m_opened = true;
+        return std::shared_ptr<const DbHandle>(std::move(handle));
+    }
+
+    DbHandle(const DbHandle&) = delete;
+    DbHandle& operator=(const DbHandle&) = delete;
+
+    ~DbHandle()
+    {
+        if (m_opened)
+        {
+            MMDB_close(mmdb.get());
+        }
+    }
+};
+
 /**
  * @brief Class to hold the needed information for a database.
+ *
+ * The opened database is swapped atomically when it is updated, the lookups in progress keep the previous one until
+ * they release it.
  */
 class DbEntry
 {
+private:
+    std::shared_ptr<const DbHandle> m_handle; ///< The opened database, accessed atomically
+
 public:
-    std::string path;                  ///< The path to the database.
-    Type type;                         ///< The type of database.
-    mutable std::shared_mutex rwMutex; ///< Read-Write mutex for thread safety access to the MMDB database.
-    std::unique_ptr<MMDB_s> mmdb;      ///< The MMDB database.
+    std::string path; ///< The path to the database.
+    Type type;        ///< The type of database.
 
     DbEntry(const std::string& path, Type type)
         : path(path)
         , type(type)
     {
-        mmdb = std::make_unique<MMDB_s>();
     }
 
     DbEntry(const DbEntry&) = delete;
@@ -34,12 +93,24 @@ public:
     DbEntry(DbEntry&&) = delete;
     DbEntry& operator=(DbEntry&&) = delete;
 
-    ~DbEntry()
+    /**
+     * @brief Get the opened database.
+     *
+     * @return std::shared_ptr<const DbHandle> The opened database, nullptr if it is not available.
+     */
+    std::shared_ptr<const DbHandle> handle() const
     {
-        if (mmdb != nullptr)
-        {
-            MMDB_close(mmdb.get());
-        }
+        return std::atomic_load_explicit(&m_handle, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Replace the opened database.
+     *
+     * @param handle The new opened database, nullptr to make it unavailable.
+     */
+    void setHandle(std::shared_ptr<const DbHandle> handle)
+    {
+        std::atomic_store_explicit(&m_handle, std::move(handle), std::memory_order_release);
     }
 };
 } // namespace geo
@@ -2,7 +2,9 @@
 
 #include <algorithm>
 #include <curl/curl.h>
+#include <fstream>
 #include <iomanip>
+#include <memory>
 #include <openssl/evp.h>
 #include <sstream>
 
@@ -18,6 +20,35 @@ size_t writeCallback(void* contents, size_t size, size_t nmemb, std::string* use
     return size * nmemb;
 }
 
+// State of a download into a file, the content is hashed as it is written.
+struct FileSink
+{
+    std::ofstream file;
+    EVP_MD_CTX* ctx;
+};
+
+// Write callback of the downloads into a file. Returning less than the received size aborts the transfer.
+size_t writeFileCallback(void* contents, size_t size, size_t nmemb, FileSink* sink)
+{
+    const auto bytes = size * nmemb;
+    sink->file.write(static_cast<const char*>(contents), bytes);
+    if (!sink->file || EVP_DigestUpdate(sink->ctx, contents, bytes) != 1)
+    {
+        return 0;
+    }
+    return bytes;
+}
+
+std::string toHex(const unsigned char* digest, unsigned int length)
+{
+    std::stringstream ss;
+    for (unsigned int i = 0; i < length; ++i)
+    {
+        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
+    }
+    return ss.str();
+}
+
 bool isMD5Hash(const std::string& str)
 {
     // Check if the string has 32 characters and consists of hexadecimal digits
@@ -72,6 +103,68 @@ base::RespOrError<std::string> Downloader::downloadHTTPS(const std::string& url)
     return readBuffer;
 }
 
+// Function to download content of the URL into a file, computing its MD5 hash on the way
+base::RespOrError<std::string> Downloader::downloadHTTPSToFile(const std::string& url, const std::string& path) const
+{
+    std::unique_ptr<EVP_MD_CTX, decltype(&EVP_MD_CTX_free)> ctx(EVP_MD_CTX_new(), EVP_MD_CTX_free);
+    if (!ctx || EVP_DigestInit_ex(ctx.get(), EVP_md5(), nullptr) != 1)
+    {
+        return base::Error {"Failed to initialize the MD5 digest"};
+    }
+
+    FileSink sink {std::ofstream(path, std::ios::binary | std::ios::trunc), ctx.get()};
+    if (!sink.file.is_open())
+    {
+        return base::Error {fmt::format("Cannot open file '{}'", path)};
+    }
+
+    curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    std::unique_ptr<CURL, decltype(&curl_easy_cleanup)> curl(curl_easy_init(), curl_easy_cleanup);
+    if (!curl)
+    {
+        curl_global_cleanup();
+        return base::Error {"Failed to initialize the download"};
+    }
+
+    curl_easy_setopt(curl.get(), CURLOPT_URL, url.c_str());
+
+    // Enable SSL certificate verification
+    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl.get(), CURLOPT_SSL_VERIFYHOST, 1L);
+
+    // Set option to follow redirects
+    curl_easy_setopt(curl.get(), CURLOPT_FOLLOWLOCATION, 1L);
+
+    // Write and hash each chunk of data as it is received
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEFUNCTION, writeFileCallback);
+    curl_easy_setopt(curl.get(), CURLOPT_WRITEDATA, &sink);
+
+    const auto res = curl_easy_perform(curl.get());
+    curl.reset();
+    curl_global_cleanup();
+
+    if (res != CURLE_OK)
+    {
+        return base::Error {fmt::format("Failed to download file from '{}', error: {}", url, curl_easy_strerror(res))};
+    }
+
+    sink.file.close();
+    if (!sink.file)
+    {
+        return base::Error {fmt::format("Cannot write to file '{}'", path)};
+    }
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int digestLen;
+    if (EVP_DigestFinal_ex(ctx.get(), digest, &digestLen) != 1)
+    {
+        return base::Error {"Failed to compute the MD5 digest"};
+    }
+
+    return toHex(digest, digestLen);
+}
+
 // Function to compute the MD5 hash of input data
 std::string Downloader::computeMD5(const std::string& data) const
 {
@@ -108,13 +201,7 @@ std::string Downloader::computeMD5(const std::string& data) const
 
     EVP_MD_CTX_free(ctx);
 
-    std::stringstream ss;
-    for (unsigned int i = 0; i < digest_len; ++i)
-    {
-        ss << std::hex << std::setw(2) << std::setfill('0') << (int)digest[i];
-    }
-
-    return ss.str();
+    return toHex(digest, digest_len);
 }
 
 base::RespOrError<std::string> Downloader::downloadMD5(const std::string& url) const
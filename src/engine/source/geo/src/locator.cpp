@@ -1,12 +1,17 @@
 #include "locator.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
-#include <shared_mutex>
 #include <sstream>
 
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
 #include "dbEntry.hpp"
 #include "manager.hpp"
 
@@ -15,17 +20,16 @@ namespace
 /**
  * @brief Converts a DotPath object to a vector of C-style strings.
  *
- * This function takes a DotPath object and converts it to a vector of C-style strings.
- * Each part of the DotPath is converted to a C-style string and stored in the resulting vector.
- * The vector is terminated with a nullptr.
+ * Each part of the DotPath is stored as a C-style string in the resulting vector, which is terminated with a nullptr.
+ * The vector is reused by the thread on every call, so the lookups do not allocate it.
  *
- * @param path The DotPath object to convert.
+ * @param path The DotPath object to convert, it must outlive the use of the vector.
  * @return A vector of C-style strings representing the DotPath.
  */
-std::vector<const char*> getPathCStrVec(const DotPath& path)
+const std::vector<const char*>& getPathCStrVec(const DotPath& path)
 {
-    std::vector<const char*> pathCStrVec;
-    pathCStrVec.reserve(path.parts().size() + 1);
+    thread_local std::vector<const char*> pathCStrVec;
+    pathCStrVec.clear();
 
     for (const std::string& pathStr : path.parts())
     {
@@ -81,211 +85,153 @@ std::string bytesToHexString(const uint8_t* bytes, size_t length)
     return ss.str();
 }
 
+static const std::string TRANSLATE_ERROR = "Error translating IP address ";
+static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
+
 /**
- * @brief Dumps the contents of entry in the MMDB database to a JSON object.
- *
- * This function takes a linked list of MMDB entry data representing a map entry in the
- * MMDB database, and dumps its contents to a JSON object. The dumped data is stored in
- * the provided JSON object `jDump` under the specified `path`.
- *
- * @param eDataList The linked list of MMDB entry data representing the map entry.
- * @param jDump The JSON object to store the dumped data.
- * @param path The path where the dumped data should be stored in the JSON object.
- * @return The next node in the linked list after the map entry has been dumped.
- * @throws std::runtime_error if the provided entry data list is null or the entry data type is not MMDB_DATA_TYPE_MAP.
- * @throws std::runtime_error if an error occurs while dumping the map entry data.
+ * @brief Lookup result of an IP address in an opened database.
  */
-MMDB_entry_data_list_s*
-dumpEntryDataList(MMDB_entry_data_list_s* eDataList, json::Json& jDump, const std::string& path);
+struct CachedLookup
+{
+    uint64_t dbId {0};              ///< Id of the opened database, 0 if the slot is empty
+    std::string ip;                 ///< The IP address looked up.
+    MMDB_lookup_result_s result {}; ///< The lookup result.
+};
+
+constexpr std::size_t LOOKUP_CACHE_SIZE = 16; ///< Lookups cached per thread
 
 /**
- * @brief Dumps the contents of a map entry in the MMDB database to a JSON object.
+ * @brief Retrieves the lookups cached by the calling thread, the most recently used first.
  *
- * This function takes a linked list of MMDB entry data representing a map entry in the
- * MMDB database, and dumps its contents to a JSON object. The dumped data is stored in
- * the provided JSON object `jDump` under the specified `path`.
- *
- * @param eDataList The linked list of MMDB entry data representing the map entry.
- * @param jDump The JSON object to store the dumped data.
- * @param path The path where the dumped data should be stored in the JSON object.
- * @return The next node in the linked list after the map entry has been dumped.
- * @throws std::runtime_error if the provided entry data list is null or the entry data type is not MMDB_DATA_TYPE_MAP.
- * @throws std::runtime_error if an error occurs while dumping the map entry data.
+ * The results of the databases no longer opened are never matched again, as the ids are not reused, and are evicted
+ * as the new lookups are cached.
  */
-MMDB_entry_data_list_s* dumpMap(MMDB_entry_data_list_s* eDataList, json::Json& jDump, const std::string& path)
+std::array<CachedLookup, LOOKUP_CACHE_SIZE>& threadLookups()
 {
-    if (eDataList == nullptr || eDataList->entry_data.type != MMDB_DATA_TYPE_MAP)
-    {
-        throw std::runtime_error {"Error dumping map"};
-    }
-
-    jDump.setObject(path);
-
-    uint32_t size = eDataList->entry_data.data_size;
-    for (eDataList = eDataList->next; size && eDataList; size--)
-    {
-
-        if (MMDB_DATA_TYPE_UTF8_STRING != eDataList->entry_data.type)
-        {
-            throw std::runtime_error {fmt::format("Error dumping map: {}", MMDB_strerror(MMDB_INVALID_DATA_ERROR))};
-        }
-        std::string fullKey =
-            path + "/" + std::string(eDataList->entry_data.utf8_string, eDataList->entry_data.data_size);
-
-        eDataList = eDataList->next;
-        eDataList = dumpEntryDataList(eDataList, jDump, fullKey);
-    }
-
-    return eDataList;
+    thread_local std::array<CachedLookup, LOOKUP_CACHE_SIZE> lookups;
+    return lookups;
 }
 
 /**
- * @brief Dumps the array data from MMDB_entry_data_list_s to a JSON object.
+ * @brief Looks up an IP address in a database.
  *
- * This function dumps the array data from the given MMDB_entry_data_list_s
- * to a JSON object specified by the provided path. It iterates through the
- * linked list and recursively calls dumpEntryDataList to dump each entry data.
+ * The addresses in standard notation are parsed with inet_pton and looked up as binary addresses, avoiding the
+ * getaddrinfo call of MMDB_lookup_string, which is only used for the rest of notations.
  *
- * @param eDataList The MMDB_entry_data_list_s to dump.
- * @param jDump The JSON object to dump the array data into.
- * @param path The path to the array in the JSON object.
- * @return The next MMDB_entry_data_list_s node after the dumped array.
- * @throws std::runtime_error if the provided eDataList is nullptr or the entry data type is not MMDB_DATA_TYPE_ARRAY.
+ * @param mmdb The opened database.
+ * @param ip The IP address to look up.
+ * @return base::RespOrError<MMDB_lookup_result_s> The lookup result or an error message if the lookup failed.
  */
-MMDB_entry_data_list_s* dumpArray(MMDB_entry_data_list_s* eDataList, json::Json& jDump, const std::string& path)
+base::RespOrError<MMDB_lookup_result_s> lookupAddress(const MMDB_s* mmdb, const std::string& ip)
 {
-    if (eDataList == nullptr || eDataList->entry_data.type != MMDB_DATA_TYPE_ARRAY)
+    int mmdb_error;
+    MMDB_lookup_result_s result;
+
+    sockaddr_in addr4 {};
+    sockaddr_in6 addr6 {};
+    if (1 == inet_pton(AF_INET, ip.c_str(), &addr4.sin_addr))
     {
-        throw std::runtime_error {fmt::format("Error dumping array: {}", MMDB_strerror(MMDB_INVALID_DATA_ERROR))};
+        addr4.sin_family = AF_INET;
+        result = MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&addr4), &mmdb_error);
     }
-
-    jDump.setArray(path);
-
-    uint32_t size = eDataList->entry_data.data_size;
-    uint32_t index = 0;
-    for (eDataList = eDataList->next; size && eDataList; size--)
+    else if (1 == inet_pton(AF_INET6, ip.c_str(), &addr6.sin6_addr))
     {
-        std::string fullKey = path + "/" + std::to_string(index++);
-        eDataList = dumpEntryDataList(eDataList, jDump, fullKey);
+        addr6.sin6_family = AF_INET6;
+        result = MMDB_lookup_sockaddr(mmdb, reinterpret_cast<const sockaddr*>(&addr6), &mmdb_error);
     }
+    else
+    {
+        int gai_error;
+        result = MMDB_lookup_string(mmdb, ip.c_str(), &gai_error, &mmdb_error);
 
-    return eDataList;
-}
+        if (0 != gai_error) // translation error
+        {
+            return base::Error {TRANSLATE_ERROR + ip + ": " + gai_strerror(gai_error)};
+        }
+    }
 
-/**
- * @brief Dumps the MMDB entry data list to a JSON object.
- *
- * This function iterates over the MMDB entry data list and converts each data type
- * to its corresponding JSON representation. The resulting JSON object is stored in
- * the provided `jDump` object at the specified `path`.
- *
- * @param eDataList The MMDB entry data list to be dumped.
- * @param jDump The JSON object to store the dumped data.
- * @param path The path within the JSON object to store the dumped data.
- * @return The updated MMDB entry data list after dumping the current node.
- * @throws std::runtime_error if an error occurs while dumping the entry data list.
- */
-MMDB_entry_data_list_s* dumpEntryDataList(MMDB_entry_data_list_s* eDataList, json::Json& jDump, const std::string& path)
-{
-    switch (eDataList->entry_data.type)
+    if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
     {
-        case MMDB_DATA_TYPE_MAP: eDataList = dumpMap(eDataList, jDump, path); break;
-        case MMDB_DATA_TYPE_ARRAY: eDataList = dumpArray(eDataList, jDump, path); break;
-        case MMDB_DATA_TYPE_UTF8_STRING:
-            jDump.setString(std::string(eDataList->entry_data.utf8_string, eDataList->entry_data.data_size), path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_BYTES:
-            jDump.setString(bytesToHexString(eDataList->entry_data.bytes, eDataList->entry_data.data_size), path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_DOUBLE:
-            jDump.setDouble(eDataList->entry_data.double_value, path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_FLOAT:
-            jDump.setFloat(eDataList->entry_data.float_value, path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_UINT16:
-            jDump.setInt64(eDataList->entry_data.uint16, path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_UINT32:
-            jDump.setInt64(eDataList->entry_data.uint32, path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_BOOLEAN:
-            jDump.setBool(eDataList->entry_data.boolean, path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_UINT64:
-            jDump.setString(std::to_string(eDataList->entry_data.uint64), path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_UINT128:
-            jDump.setString(uint128toHexString(eDataList->entry_data.uint128), path);
-            eDataList = eDataList->next;
-            break;
-        case MMDB_DATA_TYPE_INT32:
-            jDump.setInt64(eDataList->entry_data.int32, path);
-            eDataList = eDataList->next;
-            break;
-        default:
-            throw std::runtime_error {
-                fmt::format("Error dumping entry data list: {}", MMDB_strerror(MMDB_INVALID_DATA_ERROR))};
+        return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
     }
 
-    return eDataList;
+    return result;
 }
 
-static const std::string TRANSLATE_ERROR = "Error translating IP address ";
-static const std::string LIBMMD_ERROR = "Error from libmaxminddb: ";
-
 } // namespace
 
 namespace geo
 {
 
-base::OptError Locator::lookup(const std::string& ip, const std::shared_ptr<DbEntry>& entry)
+base::RespOrError<std::shared_ptr<const DbHandle>> Locator::getHandle() const
 {
-    // Check if the IP address is the same as the cached one
-    if (ip == m_cachedIp)
+    // Check if the database entry is still valid
+    auto entry = m_weakDbEntry.lock();
+    if (entry == nullptr)
     {
-        return base::noError();
+        return base::Error {"Database is not available"};
     }
 
-    // Lookup the IP address in the database
-    int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(entry->mmdb.get(), ip.c_str(), &gai_error, &mmdb_error);
-
-    if (0 != gai_error) // translation error
+    // Check the database is still opened, it is kept while the handle is held
+    auto handle = entry->handle();
+    if (handle == nullptr)
     {
-        return base::Error {TRANSLATE_ERROR + ip + ": " + gai_strerror(gai_error)};
+        return base::Error {"Database is not available"};
     }
 
-    if (MMDB_SUCCESS != mmdb_error) // libmaxminddb error, should not happen
+    return handle;
+}
+
+base::RespOrError<MMDB_lookup_result_s> Locator::lookup(const std::string& ip, const DbHandle& handle)
+{
+    auto& lookups = threadLookups();
+
+    // Check if the IP address is cached by the thread
+    auto cached = std::find_if(lookups.begin(),
+                               lookups.end(),
+                               [&](const CachedLookup& cachedLookup)
+                               { return cachedLookup.dbId == handle.id && cachedLookup.ip == ip; });
+
+    if (cached == lookups.end())
     {
-        return base::Error {LIBMMD_ERROR + MMDB_strerror(mmdb_error)};
-    }
+        // Lookup the IP address in the database
+        auto resultResp = lookupAddress(handle.mmdb.get(), ip);
+        if (base::isError(resultResp))
+        {
+            return base::getError(resultResp);
+        }
 
-    m_cachedIp = ip;
-    m_cachedResult = result;
+        // Replace the least recently used
+        cached = std::prev(lookups.end());
+        cached->dbId = handle.id;
+        cached->ip = ip;
+        cached->result = base::getResponse(resultResp);
+    }
 
-    return base::noError();
+    std::rotate(lookups.begin(), cached, std::next(cached));
+    return lookups.front().result;
 }
 
-base::RespOrError<MMDB_entry_data_s> Locator::getEData(const DotPath& path)
+base::RespOrError<MMDB_entry_data_s>
+Locator::getEData(const std::string& ip, const DotPath& path, const DbHandle& handle)
 {
-    if (!m_cachedResult.found_entry)
+    // Lookup the IP address in the database
+    auto resultResp = lookup(ip, handle);
+    if (base::isError(resultResp))
+    {
+        return base::getError(resultResp);
+    }
+
+    auto& result = base::getResponse(resultResp);
+    if (!result.found_entry)
     {
         return base::Error {"No data found for the IP address"};
     }
 
     MMDB_entry_data_s eData;
-    auto pathCStrVec = getPathCStrVec(path);
+    const auto& pathCStrVec = getPathCStrVec(path);
 
-    int status = MMDB_aget_value((MMDB_entry_s* const)&m_cachedResult.entry, &eData, pathCStrVec.data());
+    int status = MMDB_aget_value(&result.entry, &eData, pathCStrVec.data());
     if (MMDB_SUCCESS != status)
     {
         return base::Error {fmt::format("Error getting value: {}", MMDB_strerror(status))};
@@ -294,35 +240,49 @@ base::RespOrError<MMDB_entry_data_s> Locator::getEData(const DotPath& path)
     return eData;
 }
 
-base::RespOrError<std::string> Locator::getString(const std::string& ip, const DotPath& path)
+std::string Locator::getCachedIp() const
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::Error {"Database is not available"};
+        return {};
     }
 
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
+    const auto id = base::getResponse(handleResp)->id;
+    const auto& lookups = threadLookups();
+    auto cached = std::find_if(
+        lookups.begin(), lookups.end(), [id](const CachedLookup& cachedLookup) { return cachedLookup.dbId == id; });
 
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    return cached == lookups.end() ? std::string {} : cached->ip;
+}
+
+MMDB_lookup_result_s Locator::getCachedResult() const
+{
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::Error {"Database is not available"};
+        return {};
     }
 
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
+    const auto id = base::getResponse(handleResp)->id;
+    const auto& lookups = threadLookups();
+    auto cached = std::find_if(
+        lookups.begin(), lookups.end(), [id](const CachedLookup& cachedLookup) { return cachedLookup.dbId == id; });
+
+    return cached == lookups.end() ? MMDB_lookup_result_s {} : cached->result;
+}
+
+base::RespOrError<std::string> Locator::getString(const std::string& ip, const DotPath& path)
+{
+    // Hold the opened database while its data is read
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::getError(lookError);
+        return base::getError(handleResp);
     }
 
     // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    auto eDataResp = getEData(ip, path, *base::getResponse(handleResp));
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -340,33 +300,15 @@ base::RespOrError<std::string> Locator::getString(const std::string& ip, const D
 
 base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
+    // Hold the opened database while its data is read
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
-    {
-        return base::getError(lookError);
+        return base::getError(handleResp);
     }
 
     // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    auto eDataResp = getEData(ip, path, *base::getResponse(handleResp));
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -384,33 +326,15 @@ base::RespOrError<uint32_t> Locator::getUint32(const std::string& ip, const DotP
 
 base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
+    // Hold the opened database while its data is read
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::getError(lookError);
+        return base::getError(handleResp);
     }
 
     // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    auto eDataResp = getEData(ip, path, *base::getResponse(handleResp));
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
@@ -428,33 +352,15 @@ base::RespOrError<double> Locator::getDouble(const std::string& ip, const DotPat
 
 base::RespOrError<json::Json> Locator::getAsJson(const std::string& ip, const DotPath& path)
 {
-    // Check if the database entry is still valid
-    auto entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Hold read lock on the map
-    std::shared_lock lock(entry->rwMutex);
-
-    // Check the entry is not expired while holding the lock
-    entry.reset();
-    entry = m_weakDbEntry.lock();
-    if (entry == nullptr)
-    {
-        return base::Error {"Database is not available"};
-    }
-
-    // Lookup the IP address in the database
-    auto lookError = lookup(ip, entry);
-    if (base::isError(lookError))
+    // Hold the opened database while its data is read
+    auto handleResp = getHandle();
+    if (base::isError(handleResp))
     {
-        return base::getError(lookError);
+        return base::getError(handleResp);
     }
 
     // Retrieve the entry data for the given path
-    auto eDataResp = getEData(path);
+    auto eDataResp = getEData(ip, path, *base::getResponse(handleResp));
     if (base::isError(eDataResp))
     {
         return base::getError(eDataResp);
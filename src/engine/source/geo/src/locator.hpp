@@ -8,32 +8,46 @@
 namespace geo
 {
 
-class DbEntry; ///< Forward declaration
-
+class DbEntry;  ///< Forward declaration
+class DbHandle; ///< Forward declaration
+
+/**
+ * @brief Locator of the IP addresses in a database.
+ *
+ * The lookups do not take any lock: each one reads the opened database of the entry, which the manager swaps
+ * atomically. The results of the last IP addresses looked up are reused by each thread, so the several fields read from
+ * the same address on an event cost a single lookup.
+ */
 class Locator final : public ILocator
 {
 private:
     std::weak_ptr<DbEntry> m_weakDbEntry; ///< The weak pointer to the database entry.
 
-    std::string m_cachedIp;              ///< The cached IP address.
-    MMDB_lookup_result_s m_cachedResult; ///< The cached lookup result.
+    /**
+     * @brief Retrieves the opened database of the entry.
+     *
+     * @return A base::RespOrError object containing the opened database or an error message if it is not available.
+     */
+    base::RespOrError<std::shared_ptr<const DbHandle>> getHandle() const;
 
     /**
      * @brief Retrieves the entry data for a given dot path.
      *
+     * @param ip The IP address to look up.
      * @param path The dot path to retrieve the entry data for.
+     * @param handle The opened database, it must outlive the use of the entry data.
      * @return A base::RespOrError object containing the entry data or an error message.
      */
-    base::RespOrError<MMDB_entry_data_s> getEData(const DotPath& path);
+    base::RespOrError<MMDB_entry_data_s> getEData(const std::string& ip, const DotPath& path, const DbHandle& handle);
 
     /**
-     * @brief Looks up the given IP address in the database if it is not already cached.
+     * @brief Looks up the given IP address in the database if it is not cached by the thread.
      *
      * @param ip The IP address to look up.
-     * @param dbEntry The database entry to use for the lookup.
-     * @return A base::OptError object containing an error message if the lookup failed.
+     * @param handle The opened database to use for the lookup.
+     * @return A base::RespOrError object containing the lookup result or an error message if the lookup failed.
      */
-    base::OptError lookup(const std::string& ip, const std::shared_ptr<DbEntry>& dbEntry);
+    base::RespOrError<MMDB_lookup_result_s> lookup(const std::string& ip, const DbHandle& handle);
 
 public:
     virtual ~Locator() = default;
@@ -75,18 +89,18 @@ public:
     base::RespOrError<json::Json> getAsJson(const std::string& ip, const DotPath& path) override;
 
     /**
-     * @brief Retrieves the cached IP address.
+     * @brief Retrieves the last IP address looked up by the calling thread in the database.
      *
-     * @return The cached IP address.
+     * @return The cached IP address, empty if there is none.
      */
-    inline const std::string& getCachedIp() const { return m_cachedIp; }
+    std::string getCachedIp() const;
 
     /**
-     * @brief Retrieves the cached lookup result.
+     * @brief Retrieves the last lookup result of the calling thread in the database.
      *
-     * @return The cached lookup result.
+     * @return The cached lookup result, empty if there is none.
      */
-    inline const MMDB_lookup_result_s& getCachedResult() const { return m_cachedResult; }
+    MMDB_lookup_result_s getCachedResult() const;
 };
 
 } // namespace geo
@@ -63,8 +63,6 @@ Manager::Manager(const std::shared_ptr<store::IStoreInternal>& store, const std:
 
 base::OptError Manager::upsertStoreEntry(const std::string& path)
 {
-    std::filesystem::path dbPath(path);
-
     // Open file and compute hash
     auto file = std::ifstream(path, std::ios::binary);
     if (!file.is_open())
@@ -78,6 +76,13 @@ base::OptError Manager::upsertStoreEntry(const std::string& path)
     auto hash = m_downloader->computeMD5(content);
     file.close();
 
+    return upsertStoreEntry(path, hash);
+}
+
+base::OptError Manager::upsertStoreEntry(const std::string& path, const std::string& hash)
+{
+    std::filesystem::path dbPath(path);
+
     // Create and upsert the internal document
     auto internalName = base::Name({INTERNAL_NAME, dbPath.filename().string()});
     auto doc = store::Doc();
@@ -96,7 +101,8 @@ base::OptError Manager::removeInternalEntry(const std::string& path)
     return m_store->deleteInternalDoc(internalName);
 }
 
-base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool upsertStore)
+base::OptError
+Manager::addDbUnsafe(const std::string& path, Type type, bool upsertStore, std::shared_ptr<const DbHandle> handle)
 {
     auto name = std::filesystem::path(path).filename().string();
 
@@ -113,13 +119,19 @@ base::OptError Manager::addDbUnsafe(const std::string& path, Type type, bool ups
     }
 
     // Add the database
-    auto entry = std::make_shared<DbEntry>(path, type);
-    int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->mmdb.get());
-    if (MMDB_SUCCESS != status)
+    if (handle == nullptr)
     {
-        return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+        auto handleResp = DbHandle::open(path);
+        if (base::isError(handleResp))
+        {
+            return base::getError(handleResp);
+        }
+        handle = base::getResponse(std::move(handleResp));
     }
 
+    auto entry = std::make_shared<DbEntry>(path, type);
+    entry->setHandle(std::move(handle));
+
     m_dbs.emplace(name, std::move(entry));
     m_dbTypes.emplace(type, name);
 
@@ -145,22 +157,10 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
         return base::Error {fmt::format("Database '{}' not found", name)};
     }
 
-    {
-        // We need to hold the entry so the lock is not released after the entry is removed
-        auto entry = m_dbs.at(name);
-
-        // Lock the database entry internal mutex for write
-        std::unique_lock<std::shared_mutex> lockEntry(entry->rwMutex);
-
-        // Remove the database
-        m_dbs.erase(name);
-
-        // Unlock the entry mutex
-        lockEntry.unlock();
-
-        // Freed the entry
-        entry.reset();
-    }
+    // The locators holding the entry see it unavailable, the lookups in progress keep the opened database until they
+    // finish
+    m_dbs.at(name)->setHandle(nullptr);
+    m_dbs.erase(name);
 
     // Remove the type from the map if it was the one in use
     for (auto it = m_dbTypes.begin(); it != m_dbTypes.end(); ++it)
@@ -175,7 +175,7 @@ base::OptError Manager::removeDbUnsafe(const std::string& path)
     return removeInternalEntry(path);
 }
 
-base::OptError Manager::writeDb(const std::string& path, const std::string& content)
+base::OptError Manager::createDbDirectories(const std::string& path)
 {
     auto filePath = std::filesystem::path(path);
 
@@ -189,23 +189,6 @@ base::OptError Manager::writeDb(const std::string& path, const std::string& cont
         return base::Error {fmt::format("Cannot create directories for '{}': {}", path, e.what())};
     }
 
-    // Write the content to the file
-    std::ofstream file(path, std::ios::binary);
-    if (!file.is_open())
-    {
-        return base::Error {fmt::format("Cannot open file '{}'", path)};
-    }
-    try
-    {
-        file.write(content.c_str(), content.size());
-        file.close();
-    }
-    catch (const std::exception& e)
-    {
-        file.close();
-        return base::Error {fmt::format("Cannot write to file '{}': {}", path, e.what())};
-    }
-
     return base::noError();
 }
 
@@ -227,18 +210,44 @@ base::OptError Manager::removeDb(const std::string& path)
     return resp;
 }
 
+std::shared_ptr<std::mutex> Manager::upsertMutex(const std::string& name)
+{
+    std::lock_guard lock(m_upsertMutex);
+    auto& mutex = m_upsertMutexes[name];
+    if (mutex == nullptr)
+    {
+        mutex = std::make_shared<std::mutex>();
+    }
+    return mutex;
+}
+
 base::OptError
 Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& dbUrl, const std::string& hashUrl)
 {
     auto name = std::filesystem::path(path).filename().string();
 
-    // Hold write lock on the map
-    std::unique_lock lock(m_rwMapMutex);
+    // Only one update at a time per database, the updates of other databases, the lookups and the rest of operations
+    // go on while it downloads. A caller that waits for an update of the same database finds the new hash stored and
+    // does not download it again.
+    auto dbUpsertMutex = upsertMutex(name);
+    std::unique_lock upsertLock(*dbUpsertMutex);
 
-    // If the type has a different database, fail
-    if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+    std::shared_ptr<DbEntry> entry;
     {
-        return base::Error {fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        std::shared_lock lock(m_rwMapMutex);
+
+        // If the type has a different database, fail
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
+        {
+            return base::Error {
+                fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
+        }
+
+        auto it = m_dbs.find(name);
+        if (it != m_dbs.end())
+        {
+            entry = it->second;
+        }
     }
 
     // Download the database hash
@@ -251,8 +260,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
     auto hash = base::getResponse(hashResp);
 
     // Check if it is already updated
-    auto entry = m_dbs.find(name);
-    if (entry != m_dbs.end())
+    if (entry != nullptr)
     {
         auto internalResp =
             m_store->readInternalDoc(base::Name(fmt::format("{}{}{}", INTERNAL_NAME, base::Name::SEPARATOR_S, name)));
@@ -266,12 +274,20 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
         }
     }
 
-    // Download the database while MAX_RETRIES if failed
-    std::string content;
+    // Download the database aside while MAX_RETRIES if failed, the database in use is not touched until the new one
+    // is ready. The download is hashed as it is written, so it is verified without reading it back.
+    const auto tmpPath = path + TMP_SUFFIX;
+    auto dirResp = createDbDirectories(tmpPath);
+    if (base::isError(dirResp))
+    {
+        return base::getError(dirResp);
+    }
+
+    std::error_code ec;
     base::OptError error;
     for (int i = 0; i < MAX_RETRIES; ++i)
     {
-        auto dbResp = m_downloader->downloadHTTPS(dbUrl);
+        auto dbResp = m_downloader->downloadHTTPSToFile(dbUrl, tmpPath);
         if (base::isError(dbResp))
         {
             error = base::Error {
@@ -279,9 +295,7 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
             continue;
         }
 
-        content = base::getResponse(dbResp);
-        auto computedHash = m_downloader->computeMD5(content);
-        if (computedHash == hash)
+        if (base::getResponse(dbResp) == hash)
         {
             error = base::noError();
             break;
@@ -292,52 +306,75 @@ Manager::remoteUpsertDb(const std::string& path, Type type, const std::string& d
 
     if (base::isError(error))
     {
+        std::filesystem::remove(tmpPath, ec);
         return error;
     }
 
-    // Write the database to the file
-    // If the database is already added, hold the internal mutex for write
-    if (entry != m_dbs.end())
+    // Open the verified database
+    auto handleResp = DbHandle::open(tmpPath);
+    if (base::isError(handleResp))
     {
-        std::unique_lock lockEntry(entry->second->rwMutex);
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
-        {
-            return base::getError(writeResp);
-        }
+        std::filesystem::remove(tmpPath, ec);
+        return base::getError(handleResp);
+    }
+    auto handle = base::getResponse(std::move(handleResp));
 
-        // Close the MMDB and reopen it
-        MMDB_close(entry->second->mmdb.get());
-        int status = MMDB_open(path.c_str(), MMDB_MODE_MMAP, entry->second->mmdb.get());
-        if (MMDB_SUCCESS != status)
+    // The new database must be of the same kind as the one it replaces
+    if (entry != nullptr)
+    {
+        auto current = entry->handle();
+        if (current != nullptr
+            && std::string(current->mmdb->metadata.database_type) != handle->mmdb->metadata.database_type)
         {
-            // Remove the database
-            lockEntry.unlock();
-            removeDbUnsafe(path);
-
-            return base::Error {fmt::format("Cannot add database '{}': {}", path, MMDB_strerror(status))};
+            std::filesystem::remove(tmpPath, ec);
+            return base::Error {fmt::format("Cannot replace database '{}' of type '{}' with a database of type '{}'",
+                                            path,
+                                            current->mmdb->metadata.database_type,
+                                            handle->mmdb->metadata.database_type)};
         }
     }
-    else
+
     {
-        auto writeResp = writeDb(path, content);
-        if (base::isError(writeResp))
+        // Hold write lock on the map
+        std::unique_lock lock(m_rwMapMutex);
+
+        // Another database may have taken the type while this one was downloading
+        if (m_dbTypes.find(type) != m_dbTypes.end() && m_dbTypes.at(type) != name)
         {
-            return base::getError(writeResp);
+            std::filesystem::remove(tmpPath, ec);
+            return base::Error {
+                fmt::format("Type '{}' already has the database '{}'", typeName(type), m_dbTypes.at(type))};
         }
 
-        auto addResp = addDbUnsafe(path, type, false);
-        if (base::isError(addResp))
+        // The file is renamed while mapped, the lookups in progress keep reading the previous one
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
         {
-            return base::getError(addResp);
+            const auto msg = ec.message();
+            std::filesystem::remove(tmpPath, ec);
+            return base::Error {fmt::format("Cannot replace database '{}': {}", path, msg)};
         }
-    }
 
-    // Update the internal store
-    auto internalResp = upsertStoreEntry(path);
-    if (base::isError(internalResp))
-    {
-        LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
+        auto it = m_dbs.find(name);
+        if (it != m_dbs.end())
+        {
+            it->second->setHandle(std::move(handle));
+        }
+        else
+        {
+            auto addResp = addDbUnsafe(path, type, false, std::move(handle));
+            if (base::isError(addResp))
+            {
+                return base::getError(addResp);
+            }
+        }
+
+        // Update the internal store with the hash verified on the download
+        auto internalResp = upsertStoreEntry(path, hash);
+        if (base::isError(internalResp))
+        {
+            LOG_WARNING("Cannot update internal store for '{}': {}", path, base::getError(internalResp).message);
+        }
     }
 
     return base::noError();
@@ -11,6 +11,10 @@ class MockDownloader : public IDownloader
 {
 public:
     MOCK_METHOD((base::RespOrError<std::string>), downloadHTTPS, (const std::string& url), (const override));
+    MOCK_METHOD((base::RespOrError<std::string>),
+                downloadHTTPSToFile,
+                (const std::string& url, const std::string& path),
+                (const override));
     MOCK_METHOD(std::string, computeMD5, (const std::string& data), (const override));
     MOCK_METHOD(base::RespOrError<std::string>, downloadMD5, (const std::string& url), (const override));
 };
@@ -252,6 +252,46 @@ TEST_F(LocatorTest, GetUpdatesCache)
     ASSERT_EQ(locator->getCachedIp(), g_ipNotFound);
 }
 
+// The locator reads the updated database, without reusing the lookups of the previous one
+TEST_F(LocatorTest, GetAfterRemoteUpsert)
+{
+    testAllGetBehavesEqual(g_ipFullData, true);
+    MMDB_lookup_result_s prev = locator->getCachedResult();
+
+    auto path = tmpFiles.front();
+    auto internalName =
+        base::Name(fmt::format("{}/{}", INTERNAL_NAME, std::filesystem::path(path).filename().string()));
+    std::ifstream ifs(g_maxmindDbPath, std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    json::Json docJson;
+    docJson.setString(path, PATH_PATH);
+    docJson.setString(typeName(Type::CITY), TYPE_PATH);
+    docJson.setString("old_hash", HASH_PATH);
+
+    EXPECT_CALL(*mockDownloader, downloadMD5("hashUrl"))
+        .WillOnce(testing::Return(base::RespOrError<std::string>("hash")));
+    EXPECT_CALL(*mockStore, readInternalDoc(internalName)).WillOnce(testing::Return(storeReadDocResp(docJson)));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile("dbUrl", path + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(
+            [&content](const std::string&, const std::string& tmpPath) -> base::RespOrError<std::string>
+            {
+                std::ofstream file(tmpPath, std::ios::binary);
+                file << content;
+                return std::string("hash");
+            }));
+    EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager->remoteUpsertDb(path, Type::CITY, "dbUrl", "hashUrl"));
+    ASSERT_FALSE(base::isError(error));
+    ASSERT_FALSE(std::filesystem::exists(path + TMP_SUFFIX));
+
+    ASSERT_EQ(locator->getCachedIp(), "");
+    testAllGetBehavesEqual(g_ipFullData, true);
+    ASSERT_FALSE(compareLookupResult(prev, locator->getCachedResult()));
+}
+
 /************************************************************
  * Test each get method use cases
  ************************************************************/
@@ -17,6 +17,17 @@ using namespace store::mocks;
 namespace
 {
 const std::string g_maxmindDbPath {MMDB_PATH_TEST};
+
+// Action of a download into a file: writes the content and returns the hash computed on the way
+auto downloadToFile(const std::string& content, const std::string& hash)
+{
+    return [content, hash](const std::string&, const std::string& path) -> base::RespOrError<std::string>
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << content;
+        return hash;
+    };
+}
 } // namespace
 
 class GeoManagerTest : public ::testing::Test
@@ -416,9 +427,8 @@ TEST_F(GeoManagerTest, RemoteUpsertDb)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(downloadToFile(content, hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -495,10 +505,9 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneDownload)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
         .WillOnce(testing::Return(base::Error {"error"}))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+        .WillOnce(testing::Invoke(downloadToFile(content, hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -523,13 +532,9 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailOneHash)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content))
-        .WillOnce(testing::Return("other_hash"))
-        .WillOnce(testing::Return(hash))
-        .WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(downloadToFile(content, "other_hash")))
+        .WillOnce(testing::Invoke(downloadToFile(content, hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeOk()));
 
     base::OptError error;
@@ -554,9 +559,7 @@ TEST_F(GeoManagerTest, RemoteUpsertDbErrorWriting)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(testing::_, testing::_)).Times(0);
 
     base::OptError error;
     ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, dbType, dbUrl, hashUrl));
@@ -578,9 +581,8 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailInternalStore)
     auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
 
     EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl)).WillOnce(testing::Return(base::RespOrError<std::string>(hash)));
-    EXPECT_CALL(*mockDownloader, downloadHTTPS(dbUrl))
-        .WillOnce(testing::Return(base::RespOrError<std::string>(content)));
-    EXPECT_CALL(*mockDownloader, computeMD5(content)).WillOnce(testing::Return(hash)).WillOnce(testing::Return(hash));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(downloadToFile(content, hash)));
     EXPECT_CALL(*mockStore, upsertInternalDoc(internalName, testing::_)).WillOnce(testing::Return(storeError()));
 
     base::OptError error;
@@ -590,3 +592,98 @@ TEST_F(GeoManagerTest, RemoteUpsertDbFailInternalStore)
     ASSERT_EQ(manager.listDbs()[0].name, std::filesystem::path(dbFile).filename().string());
     ASSERT_EQ(manager.listDbs()[0].type, dbType);
 }
+
+TEST_F(GeoManagerTest, RemoteUpsertDbInvalidKeepsDb)
+{
+    auto dbFile = getTmpDb();
+    auto dbPath = std::filesystem::path(dbFile).string();
+    auto dbType = Type::ASN;
+    auto hashUrl = "hashUrl";
+    auto dbUrl = "dbUrl";
+    auto content = std::string {"not a mmdb database"};
+    auto dbDoc = json::Json();
+    dbDoc.setString(dbPath, PATH_PATH);
+    dbDoc.setString(typeName(dbType), TYPE_PATH);
+    dbDoc.setString("old_hash", HASH_PATH);
+    auto internalName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(dbFile).filename().string());
+
+    auto manager = getManagerWithDb(dbPath, dbType);
+    auto locatorResp = manager.getLocator(dbType);
+    ASSERT_FALSE(base::isError(locatorResp));
+    auto locator = base::getResponse(locatorResp);
+
+    EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>("hash")));
+    EXPECT_CALL(*mockStore, readInternalDoc(internalName)).WillOnce(testing::Return(storeReadDocResp(dbDoc)));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(downloadToFile(content, "hash")));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, dbType, dbUrl, hashUrl));
+    ASSERT_TRUE(base::isError(error));
+    ASSERT_FALSE(std::filesystem::exists(dbPath + TMP_SUFFIX));
+    ASSERT_EQ(manager.listDbs().size(), 1);
+
+    // The database in use is not replaced
+    auto res = locator->getString("1.2.3.4", "test_map.test_str1");
+    ASSERT_FALSE(base::isError(res)) << base::getError(res).message;
+    ASSERT_EQ(base::getResponse(res), "Wazuh");
+}
+
+TEST_F(GeoManagerTest, RemoteUpsertDbHashMismatchRemovesDownload)
+{
+    auto manager = getEmptyManager();
+
+    auto dbFile = getTmpDb();
+    auto dbPath = std::filesystem::path(dbFile).string();
+    auto dbUrl = "dbUrl";
+    auto hashUrl = "hashUrl";
+    auto content = getContentDb(dbFile);
+
+    EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>("hash")));
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .Times(MAX_RETRIES)
+        .WillRepeatedly(testing::Invoke(downloadToFile(content, "other_hash")));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, Type::ASN, dbUrl, hashUrl));
+    ASSERT_TRUE(base::isError(error));
+    ASSERT_FALSE(std::filesystem::exists(dbPath + TMP_SUFFIX));
+    ASSERT_EQ(manager.listDbs().size(), 0);
+}
+
+TEST_F(GeoManagerTest, RemoteUpsertDbTypeTakenWhileDownloading)
+{
+    auto manager = getEmptyManager();
+
+    auto dbFile = getTmpDb();
+    auto otherFile = getTmpDb();
+    auto dbPath = std::filesystem::path(dbFile).string();
+    auto otherPath = std::filesystem::path(otherFile).string();
+    auto dbUrl = "dbUrl";
+    auto hashUrl = "hashUrl";
+    auto content = getContentDb(dbFile);
+    auto otherName = base::Name(INTERNAL_NAME) + base::Name(std::filesystem::path(otherFile).filename().string());
+
+    EXPECT_CALL(*mockDownloader, downloadMD5(hashUrl))
+        .WillOnce(testing::Return(base::RespOrError<std::string>("hash")));
+    EXPECT_CALL(*mockDownloader, computeMD5(testing::_)).WillOnce(testing::Return("other_hash"));
+    EXPECT_CALL(*mockStore, upsertInternalDoc(otherName, testing::_)).WillOnce(testing::Return(storeOk()));
+
+    // The lookups and the rest of operations go on while downloading, another database takes the type meanwhile
+    EXPECT_CALL(*mockDownloader, downloadHTTPSToFile(dbUrl, dbPath + TMP_SUFFIX))
+        .WillOnce(testing::Invoke(
+            [&](const std::string& url, const std::string& path) -> base::RespOrError<std::string>
+            {
+                EXPECT_FALSE(base::isError(manager.addDb(otherPath, Type::ASN)));
+                return downloadToFile(content, "hash")(url, path);
+            }));
+
+    base::OptError error;
+    ASSERT_NO_THROW(error = manager.remoteUpsertDb(dbPath, Type::ASN, dbUrl, hashUrl));
+    ASSERT_TRUE(base::isError(error));
+    ASSERT_FALSE(std::filesystem::exists(dbPath + TMP_SUFFIX));
+    ASSERT_EQ(manager.listDbs().size(), 1);
+    ASSERT_EQ(manager.listDbs()[0].name, std::filesystem::path(otherFile).filename().string());
+}
@@ -124,6 +124,13 @@ public:
      */
     const T& value() const { return m_value; }
 
+    /**
+     * @brief Returns the extracted value.
+     *
+     * @return T&
+     */
+    T& value() { return m_value; }
+
     /**
      * @brief Returns the nested results.
      *
@@ -131,6 +138,13 @@ public:
      */
     const Nested& nested() const { return m_nested; }
 
+    /**
+     * @brief Returns the nested results.
+     *
+     * @return Nested&
+     */
+    Nested& nested() { return m_nested; }
+
     /**
      * @brief Returns the contextual information about the parser failure (name).
      *
@@ -137,13 +137,11 @@ Parser getDateParser(const Params& params);
  * up to the stop substring and then will validate
  * whether it is a valid ipv4 or ipv6 address.
  *
- * It uses the standard inet_pton(3) to parse.
+ * It accepts the notations of inet_pton(3), parsed
+ * straight from the input without copies.
  * If the string is accepted as valid address,
  * its format will not change.
  *
- * inet_pton implementation might differ depending
- * on the system on which the engine is built.
- *
  * @param params.name name of the parser
  * @param params.targetField: field to store the parsed value, if not present, the value is ignored
  * @param params.stop List of end tokens
@@ -1,9 +1,14 @@
 #ifndef _HLP_PARSER_HPP
 #define _HLP_PARSER_HPP
 
+#include <cmath>
 #include <functional>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <variant>
 #include <vector>
 
@@ -18,37 +23,186 @@
  */
 namespace hlp::parser
 {
-// Mapper functions dont check
-using Mapper = std::function<void(json::Json&)>;
+/**
+ * @brief Fields mapped under the target field, as pairs of path relative to the target and value. A field without
+ * value is mapped as null.
+ */
+using Fields = std::vector<std::pair<std::string, std::optional<std::string>>>;
 
 /**
- * @brief Empty mapper function, used when a parser has semantic parser but it is told to not map.
+ * @brief Fields mapped under the target field, as views of static relative paths and of the parsed text.
+ */
+using FieldViews = std::vector<std::pair<std::string_view, std::string_view>>;
+
+/**
+ * @brief Fields mapped under the target field, shared with a cache of the parser.
+ */
+using SharedFields = std::shared_ptr<const Fields>;
+
+/**
+ * @brief Value a token maps to its target field.
  *
- * @return Mapper
+ * Plain values are held in place and strings are views of the parsed text, so a token only owns memory for the values
+ * built from it (documents, transformed strings). An error is a semantic failure found while parsing the syntax,
+ * reported with the other semantic errors.
+ */
+using Value = std::variant<std::monostate,
+                           std::string_view,
+                           std::string,
+                           bool,
+                           int8_t,
+                           int64_t,
+                           float_t,
+                           double_t,
+                           std::shared_ptr<const json::Json>,
+                           Fields,
+                           FieldViews,
+                           SharedFields,
+                           base::Error>;
+
+/**
+ * @brief Semantic parser, checks the parsed text and sets the value to map.
  */
-inline Mapper noMapper()
+using SemParser = std::function<std::optional<base::Error>(std::string_view parsed, Value& value)>;
+
+/**
+ * @brief Semantic step of a parser. It is built once with the parser and its tokens only point to it, so the parser
+ * must outlive the results it returns.
+ */
+struct Semantic
 {
-    return [](json::Json&) {
-    };
+    std::string target; ///< Field the values are mapped to, empty to only check them.
+    SemParser parse;    ///< Semantic parser, empty if the value is set when parsing the syntax.
+};
+using SemanticPtr = std::shared_ptr<const Semantic>;
+
+/**
+ * @brief Builds the semantic step of a parser.
+ *
+ * @param target Field the values are mapped to, empty to only check them.
+ * @param parse Semantic parser, empty if the value is set when parsing the syntax.
+ * @return SemanticPtr
+ */
+inline SemanticPtr makeSemantic(const std::string& target, SemParser parse = {})
+{
+    return std::make_shared<const Semantic>(Semantic {target, std::move(parse)});
 }
-using SemParser = std::function<std::variant<Mapper, base::Error>(std::string_view)>;
+
 struct SemToken
 {
-    std::string_view parsed;
-    SemParser semParser;
+    std::string_view parsed;            ///< Text consumed by the parser.
+    const Semantic* semantic {nullptr}; ///< Semantic step of the parser, null if there is nothing to check or map.
+    Value value {};                     ///< Value mapped to the target field.
 };
 
 /**
- * @brief Empty semantic parser function, used when a parser has no semantic parser and it is told to not map.
+ * @brief Runs the semantic parser of a token, setting its value.
+ *
+ * @param token Token to parse.
+ * @return std::optional<base::Error> Error if the token is not semantically valid.
+ */
+inline std::optional<base::Error> semParse(SemToken& token)
+{
+    if (token.semantic != nullptr && token.semantic->parse)
+    {
+        if (auto error = token.semantic->parse(token.parsed, token.value))
+        {
+            return error;
+        }
+    }
+
+    if (std::holds_alternative<base::Error>(token.value))
+    {
+        return std::get<base::Error>(token.value);
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief Maps the value of a token to its target field of the event.
  *
- * @return SemParser
+ * @param token Token semantically parsed.
+ * @param event Event to map to.
  */
-inline SemParser noSemParser()
+inline void map(const SemToken& token, json::Json& event)
 {
-    return [](std::string_view) -> std::variant<Mapper, base::Error>
+    if (token.semantic == nullptr || token.semantic->target.empty())
     {
-        return noMapper();
+        return;
+    }
+
+    const std::string_view target {token.semantic->target};
+    const auto mapFields = [&event, target](const Fields& fields)
+    {
+        std::string path {target};
+        for (const auto& [relative, field] : fields)
+        {
+            path.resize(target.size());
+            path += relative;
+            if (field)
+            {
+                event.setString(*field, path);
+            }
+            else
+            {
+                event.setNull(path);
+            }
+        }
     };
+
+    std::visit(
+        [&event, target, &mapFields](const auto& value)
+        {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>)
+            {
+                event.setString(value, target);
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                event.setBool(value, target);
+            }
+            else if constexpr (std::is_same_v<T, int8_t>)
+            {
+                event.setInt(value, target);
+            }
+            else if constexpr (std::is_same_v<T, int64_t>)
+            {
+                event.setInt64(value, target);
+            }
+            else if constexpr (std::is_same_v<T, float_t>)
+            {
+                event.setFloat(value, target);
+            }
+            else if constexpr (std::is_same_v<T, double_t>)
+            {
+                event.setDouble(value, target);
+            }
+            else if constexpr (std::is_same_v<T, std::shared_ptr<const json::Json>>)
+            {
+                event.set(target, *value);
+            }
+            else if constexpr (std::is_same_v<T, Fields>)
+            {
+                mapFields(value);
+            }
+            else if constexpr (std::is_same_v<T, SharedFields>)
+            {
+                mapFields(*value);
+            }
+            else if constexpr (std::is_same_v<T, FieldViews>)
+            {
+                std::string path {target};
+                for (const auto& [relative, field] : value)
+                {
+                    path.resize(target.size());
+                    path += relative;
+                    event.setString(field, path);
+                }
+            }
+        },
+        token.value);
 }
 
 using ResultT = SemToken;
@@ -56,40 +210,101 @@ using Result = abs::Result<ResultT>;
 using Parser = abs::Parser<ResultT>;
 
 /**
- * @brief Runs three steps of parsing: syntax, semantic and mapping. Returns an error if any of the steps fails at any
+ * @brief Failure of a run.
+ *
+ * A syntax failure only keeps the name of the parser that failed and where, the message is formatted when it is
+ * requested, so runs that are not traced do not pay for it. It holds views of the parser and of the text parsed, it
+ * must not outlive them.
+ */
+class Failure
+{
+private:
+    std::string_view m_trace;              ///< Name of the parser that failed the syntax step.
+    std::string_view m_remaining;          ///< Text left when the syntax step failed.
+    std::optional<base::Error> m_semantic; ///< Error of the semantic step.
+
+public:
+    /**
+     * @brief Syntax failure.
+     *
+     * @param trace Name of the parser that failed.
+     * @param remaining Text left when it failed.
+     */
+    Failure(std::string_view trace, std::string_view remaining)
+        : m_trace(trace)
+        , m_remaining(remaining)
+    {
+    }
+
+    /**
+     * @brief Semantic failure.
+     *
+     * @param error Error of the semantic parser.
+     */
+    explicit Failure(base::Error error)
+        : m_semantic(std::move(error))
+    {
+    }
+
+    /**
+     * @brief Whether the semantic step failed, otherwise the syntax step did.
+     */
+    bool semantic() const { return m_semantic.has_value(); }
+
+    /**
+     * @brief Text left when the syntax step failed, empty for semantic failures.
+     */
+    std::string_view remaining() const { return m_remaining; }
+
+    /**
+     * @brief Formats the failure message.
+     *
+     * @return std::string
+     */
+    std::string message() const
+    {
+        if (m_semantic)
+        {
+            return m_semantic->message;
+        }
+
+        return fmt::format("Parser {} failed at: {}", m_trace, m_remaining);
+    }
+};
+
+/**
+ * @brief Runs three steps of parsing: syntax, semantic and mapping. Returns a failure if any of the steps fails at any
  * point.
  *
+ * The tokens hold their values, so the semantic step checks all of them before the mapping step writes any to the
+ * event, without building intermediate mappers.
+ *
  * @param parser Parser to run
  * @param text Text to parse
  * @param event Event to map to
- * @return std::optional<base::Error>
+ * @return std::optional<Failure>
  */
-inline std::optional<base::Error> run(const Parser& parser, std::string_view text, json::Json& event)
+inline std::optional<Failure> run(const Parser& parser, std::string_view text, json::Json& event)
 {
     // Syntax parsing
     auto synRes = parser(text);
     if (synRes.failure())
     {
-        const auto error = fmt::format("Parser {} failed at: {}", synRes.trace(), synRes.remaining());
-        return base::Error {error};
+        return Failure {synRes.trace(), synRes.remaining()};
     }
 
     // Semantinc parsing
-    std::vector<Mapper> mappers;
-    auto semVisitor = [&mappers](const Result& result, auto& recurRef) -> std::optional<base::Error>
+    auto semVisitor = [](Result& result, auto& recurRef) -> std::optional<base::Error>
     {
         if (result.hasValue())
         {
-            auto res = result.value().semParser(result.value().parsed);
-            if (std::holds_alternative<base::Error>(res))
+            if (auto error = semParse(result.value()))
             {
-                return std::get<base::Error>(res);
+                return error;
             }
-
-            mappers.emplace_back(std::get<Mapper>(std::move(res)));
         }
 
-        for (const auto& child : result.nested())
+        for (auto& child : result.nested())
         {
             auto error = recurRef(child, recurRef);
             if (error)
@@ -104,14 +319,23 @@ inline std::optional<base::Error> run(const Parser& parser, std::string_view tex
     auto error = semVisitor(synRes, semVisitor);
     if (error)
     {
-        return std::move(error);
+        return Failure {std::move(error.value())};
     }
 
     // Mappings
-    for (const auto& mapper : mappers)
+    auto mapVisitor = [&event](const Result& result, auto& recurRef) -> void
     {
-        mapper(event);
-    }
+        if (result.hasValue())
+        {
+            map(result.value(), event);
+        }
+
+        for (const auto& child : result.nested())
+        {
+            recurRef(child, recurRef);
+        }
+    };
+    mapVisitor(synRes, mapVisitor);
 
     return std::nullopt;
 }
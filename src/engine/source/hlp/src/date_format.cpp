@@ -0,0 +1,466 @@
+#include "date_format.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdint>
+
+namespace
+{
+// Full names and then abbreviations, in the order of their values: months from January, weekdays from Sunday.
+constexpr std::array<std::string_view, 24> MONTH_NAMES {
+    "January", "February", "March", "April", "May", "June", "July", "August", "September", "October", "November",
+    "December", "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+constexpr std::array<std::string_view, 14> WEEKDAY_NAMES {
+    "Sunday", "Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday",
+    "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+
+// Seconds with the nanoseconds read by date::parse: two digits, the decimal point and nine decimals.
+constexpr std::size_t SECONDS_WIDTH {12};
+constexpr std::size_t MAX_DECIMALS {9};
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Reads an unsigned number of 1 to maxDigits digits.
+ */
+std::optional<unsigned> readNumber(std::string_view text, std::size_t& pos, std::size_t maxDigits)
+{
+    unsigned value {0};
+    std::size_t digits {0};
+    while (pos < text.size() && digits < maxDigits && isDigit(text[pos]))
+    {
+        value = value * 10 + static_cast<unsigned>(text[pos] - '0');
+        ++pos;
+        ++digits;
+    }
+
+    if (digits == 0)
+    {
+        return std::nullopt;
+    }
+    return value;
+}
+
+/**
+ * @brief Reads the longest name matching the text, and returns its index modulo the number of values.
+ *
+ * date::parse keeps reading while a longer name may match, and then fails if it doesn't, so a text that goes on
+ * matching a longer name is rejected.
+ */
+template<std::size_t N>
+std::optional<unsigned> readName(std::string_view text, std::size_t& pos, const std::array<std::string_view, N>& names)
+{
+    const auto input {text.substr(pos)};
+    std::optional<std::size_t> best;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (input.substr(0, names[i].size()) == names[i] && (!best || names[i].size() > names[*best].size()))
+        {
+            best = i;
+        }
+    }
+
+    if (!best)
+    {
+        return std::nullopt;
+    }
+
+    const auto matched {names[*best].size()};
+    for (const auto& name : names)
+    {
+        if (name.size() > matched && input.size() > matched
+            && input.substr(0, matched + 1) == name.substr(0, matched + 1))
+        {
+            return std::nullopt;
+        }
+    }
+
+    pos += matched;
+    return static_cast<unsigned>(*best % (N / 2));
+}
+
+/**
+ * @brief Reads an UTC offset, [+|-]hh[mm], or [+|-]h[h][:mm] if extended.
+ */
+std::optional<std::chrono::minutes> readOffset(std::string_view text, std::size_t& pos, bool extended)
+{
+    bool negative {false};
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-'))
+    {
+        negative = text[pos] == '-';
+        ++pos;
+    }
+
+    const auto start {pos};
+    const auto hours {readNumber(text, pos, 2)};
+    if (!hours || (!extended && pos - start != 2) || *hours > 23)
+    {
+        return std::nullopt;
+    }
+
+    unsigned minutes {0};
+    const auto hasMinutes {extended ? pos < text.size() && text[pos] == ':'
+                                    : pos < text.size() && isDigit(text[pos])};
+    if (hasMinutes)
+    {
+        pos += extended ? 1 : 0;
+        const auto minutesStart {pos};
+        const auto value {readNumber(text, pos, 2)};
+        if (!value || pos - minutesStart != 2 || *value > 59)
+        {
+            return std::nullopt;
+        }
+        minutes = *value;
+    }
+
+    const std::chrono::minutes offset {*hours * 60 + minutes};
+    return negative ? -offset : offset;
+}
+
+/**
+ * @brief Reads seconds with an optional decimal part, of up to width characters.
+ */
+std::optional<std::chrono::nanoseconds> readSeconds(std::string_view text, std::size_t& pos, std::size_t width)
+{
+    const auto end {std::min(text.size(), pos + width)};
+    const auto start {pos};
+    const auto seconds {readNumber(text.substr(0, end), pos, width)};
+    if (!seconds || pos - start > 2 || *seconds > 59)
+    {
+        return std::nullopt;
+    }
+
+    std::chrono::nanoseconds value {std::chrono::seconds {*seconds}};
+    if (pos < end && text[pos] == '.')
+    {
+        ++pos;
+        int64_t decimals {0};
+        std::size_t digits {0};
+        while (pos < end && isDigit(text[pos]))
+        {
+            if (++digits > MAX_DECIMALS)
+            {
+                // date::parse rounds the extra decimals, leave it to it
+                return std::nullopt;
+            }
+            decimals = decimals * 10 + (text[pos] - '0');
+            ++pos;
+        }
+        for (auto i = digits; i < MAX_DECIMALS; ++i)
+        {
+            decimals *= 10;
+        }
+        value += std::chrono::nanoseconds {decimals};
+    }
+
+    return value;
+}
+
+bool isLeapYear(int year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+unsigned lastDay(int year, bool hasYear, unsigned month)
+{
+    constexpr std::array<unsigned, 12> DAYS {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    // Without a year, the 29th of February may still be valid
+    return month == 2 && (!hasYear || isLeapYear(year)) ? 29 : DAYS[month - 1];
+}
+
+/**
+ * @brief Day of the week, from Sunday, of a date of the proleptic Gregorian calendar.
+ */
+unsigned weekday(int year, unsigned month, unsigned day)
+{
+    constexpr std::array<int, 12> OFFSETS {0, 3, 2, 5, 0, 3, 5, 1, 4, 6, 2, 4};
+    if (month < 3)
+    {
+        --year;
+    }
+    const auto days {year + year / 4 - year / 100 + year / 400 + OFFSETS[month - 1] + static_cast<int>(day)};
+    return static_cast<unsigned>(days % 7);
+}
+
+bool isZoneChar(char c)
+{
+    return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '/' || c == '-' || c == '+';
+}
+} // namespace
+
+namespace hlp::datefmt
+{
+
+std::optional<Format> Format::compile(std::string_view format, std::string_view locale)
+{
+    // The names read are the English ones
+    if (locale != "C" && locale != "POSIX" && locale.substr(0, 3) != "en_")
+    {
+        return std::nullopt;
+    }
+
+    Format compiled;
+    auto& steps {compiled.m_steps};
+    bool hasMonth {false};
+    bool hasDay {false};
+
+    for (std::size_t i = 0; i < format.size(); ++i)
+    {
+        const auto c {format[i]};
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            // A space matches any number of spaces, even none
+            if (steps.empty() || steps.back().kind != Kind::SPACES)
+            {
+                steps.push_back({Kind::SPACES});
+            }
+            continue;
+        }
+
+        if (c != '%')
+        {
+            steps.push_back({Kind::LITERAL, c});
+            continue;
+        }
+
+        // Directive: %[width][E|O]conversion
+        std::size_t width {0};
+        while (++i < format.size() && isDigit(format[i]))
+        {
+            width = width * 10 + static_cast<std::size_t>(format[i] - '0');
+        }
+        char modifier {'\0'};
+        if (i < format.size() && (format[i] == 'E' || format[i] == 'O'))
+        {
+            modifier = format[i++];
+        }
+        if (i >= format.size())
+        {
+            return std::nullopt;
+        }
+
+        const auto conversion {format[i]};
+        const auto isNumeric {conversion == 'Y' || conversion == 'y' || conversion == 'm' || conversion == 'd'
+                              || conversion == 'H' || conversion == 'M' || conversion == 'S'};
+        if ((width != 0 && !isNumeric) || (modifier != '\0' && conversion != 'z'))
+        {
+            return std::nullopt;
+        }
+
+        const auto numeric = [&steps, width](Kind kind, std::size_t defaultWidth)
+        {
+            steps.push_back({kind, '\0', width != 0 ? width : defaultWidth});
+        };
+        const auto literal = [&steps](char lit)
+        {
+            steps.push_back({Kind::LITERAL, lit});
+        };
+
+        switch (conversion)
+        {
+            case '%': literal('%'); break;
+            case 'Y': numeric(Kind::YEAR, 4); break;
+            case 'y': numeric(Kind::YEAR2, 2); break;
+            case 'm':
+                numeric(Kind::MONTH, 2);
+                hasMonth = true;
+                break;
+            case 'd':
+                numeric(Kind::DAY, 2);
+                hasDay = true;
+                break;
+            case 'H': numeric(Kind::HOUR, 2); break;
+            case 'M': numeric(Kind::MINUTE, 2); break;
+            case 'S': numeric(Kind::SECOND, SECONDS_WIDTH); break;
+            case 'F':
+                numeric(Kind::YEAR, 4);
+                literal('-');
+                numeric(Kind::MONTH, 2);
+                literal('-');
+                numeric(Kind::DAY, 2);
+                hasMonth = hasDay = true;
+                break;
+            case 'T':
+                numeric(Kind::HOUR, 2);
+                literal(':');
+                numeric(Kind::MINUTE, 2);
+                literal(':');
+                numeric(Kind::SECOND, SECONDS_WIDTH);
+                break;
+            case 'R':
+                numeric(Kind::HOUR, 2);
+                literal(':');
+                numeric(Kind::MINUTE, 2);
+                break;
+            case 'b':
+            case 'B':
+            case 'h':
+                steps.push_back({Kind::MONTH_NAME});
+                hasMonth = true;
+                break;
+            case 'a':
+            case 'A': steps.push_back({Kind::WEEKDAY_NAME}); break;
+            case 'z': steps.push_back({modifier == '\0' ? Kind::OFFSET : Kind::OFFSET_EXT}); break;
+            case 'Z': steps.push_back({Kind::ZONE}); break;
+            default: return std::nullopt;
+        }
+    }
+
+    // Dates without a month or a day are left to date::parse
+    if (!hasMonth || !hasDay)
+    {
+        return std::nullopt;
+    }
+
+    return compiled;
+}
+
+std::optional<Fields> Format::parse(std::string_view text) const
+{
+    Fields fields;
+    std::optional<unsigned> weekdayRead;
+    std::chrono::hours hours {0};
+    std::chrono::minutes minutes {0};
+    std::chrono::nanoseconds seconds {0};
+    std::size_t pos {0};
+
+    for (const auto& step : m_steps)
+    {
+        switch (step.kind)
+        {
+            case Kind::LITERAL:
+                if (pos >= text.size() || text[pos] != step.literal)
+                {
+                    return std::nullopt;
+                }
+                ++pos;
+                break;
+            case Kind::SPACES:
+                while (pos < text.size() && std::isspace(static_cast<unsigned char>(text[pos])))
+                {
+                    ++pos;
+                }
+                break;
+            case Kind::YEAR:
+            case Kind::YEAR2:
+            case Kind::MONTH:
+            case Kind::DAY:
+            case Kind::HOUR:
+            case Kind::MINUTE:
+            {
+                const auto value {readNumber(text, pos, step.width)};
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+
+                if (step.kind == Kind::YEAR || step.kind == Kind::YEAR2)
+                {
+                    // Two digit years are 1969 to 2068
+                    fields.year = static_cast<int>(*value);
+                    if (step.kind == Kind::YEAR2)
+                    {
+                        fields.year += *value < 69 ? 2000 : 1900;
+                    }
+                    fields.hasYear = true;
+                }
+                else if (step.kind == Kind::MONTH && *value >= 1 && *value <= 12)
+                {
+                    fields.month = *value;
+                }
+                else if (step.kind == Kind::DAY && *value >= 1 && *value <= 31)
+                {
+                    fields.day = *value;
+                }
+                else if (step.kind == Kind::HOUR && *value <= 23)
+                {
+                    hours = std::chrono::hours {*value};
+                }
+                else if (step.kind == Kind::MINUTE && *value <= 59)
+                {
+                    minutes = std::chrono::minutes {*value};
+                }
+                else
+                {
+                    return std::nullopt;
+                }
+                break;
+            }
+            case Kind::SECOND:
+            {
+                const auto value {readSeconds(text, pos, step.width)};
+                if (!value)
+                {
+                    return std::nullopt;
+                }
+                seconds = *value;
+                break;
+            }
+            case Kind::MONTH_NAME:
+            {
+                const auto month {readName(text, pos, MONTH_NAMES)};
+                if (!month)
+                {
+                    return std::nullopt;
+                }
+                fields.month = *month + 1;
+                break;
+            }
+            case Kind::WEEKDAY_NAME:
+            {
+                weekdayRead = readName(text, pos, WEEKDAY_NAMES);
+                if (!weekdayRead)
+                {
+                    return std::nullopt;
+                }
+                break;
+            }
+            case Kind::OFFSET:
+            case Kind::OFFSET_EXT:
+            {
+                const auto offset {readOffset(text, pos, step.kind == Kind::OFFSET_EXT)};
+                if (!offset)
+                {
+                    return std::nullopt;
+                }
+                fields.offset = *offset;
+                break;
+            }
+            case Kind::ZONE:
+            {
+                const auto start {pos};
+                while (pos < text.size() && isZoneChar(text[pos]))
+                {
+                    ++pos;
+                }
+                if (pos == start)
+                {
+                    return std::nullopt;
+                }
+                fields.abbrev = text.substr(start, pos - start);
+                break;
+            }
+        }
+    }
+
+    if (fields.day > lastDay(fields.year, fields.hasYear, fields.month))
+    {
+        return std::nullopt;
+    }
+
+    // The weekday can only be checked against a full date
+    if (weekdayRead && (!fields.hasYear || *weekdayRead != weekday(fields.year, fields.month, fields.day)))
+    {
+        return std::nullopt;
+    }
+
+    fields.timeOfDay = hours + minutes + seconds;
+    fields.size = pos;
+    return fields;
+}
+
+} // namespace hlp::datefmt
@@ -0,0 +1,89 @@
+#ifndef _HLP_DATE_FORMAT_HPP
+#define _HLP_DATE_FORMAT_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Date formats compiled into a sequence of steps, read straight from the input without streams or locales.
+ *
+ * Only the directives of the common formats are compiled (numeric fields, English month and weekday names, UTC
+ * offsets and zone abbreviations). A compiled format is stricter than date::parse: when it rejects an input, the
+ * caller is expected to fall back to date::parse, which settles it.
+ */
+namespace hlp::datefmt
+{
+
+/**
+ * @brief Date and time read by a compiled format.
+ */
+struct Fields
+{
+    int year {0};                           ///< Year, only if hasYear.
+    bool hasYear {false};                   ///< The format reads the year.
+    unsigned month {0};                     ///< Month, from 1 to 12.
+    unsigned day {0};                       ///< Day of the month, from 1 to 31.
+    std::chrono::nanoseconds timeOfDay {0}; ///< Time since midnight.
+    std::chrono::minutes offset {0};        ///< Offset to UTC (%z).
+    std::string_view abbrev;                ///< Time zone abbreviation (%Z), a view of the input.
+    std::size_t size {0};                   ///< Characters read from the input.
+};
+
+/**
+ * @brief Compiled date format.
+ */
+class Format
+{
+public:
+    /**
+     * @brief Compiles a date format in the date::parse syntax.
+     *
+     * @param format Date format.
+     * @param locale Locale of the dates, only English locales are compiled.
+     * @return std::optional<Format> The compiled format, or nullopt if it has directives that are not compiled.
+     */
+    static std::optional<Format> compile(std::string_view format, std::string_view locale);
+
+    /**
+     * @brief Reads a date from the start of the text.
+     *
+     * @param text Text to read.
+     * @return std::optional<Fields> The date read, or nullopt if the text does not match the format.
+     */
+    std::optional<Fields> parse(std::string_view text) const;
+
+private:
+    enum class Kind
+    {
+        LITERAL,
+        SPACES,
+        YEAR,
+        YEAR2,
+        MONTH,
+        MONTH_NAME,
+        DAY,
+        WEEKDAY_NAME,
+        HOUR,
+        MINUTE,
+        SECOND,
+        OFFSET,
+        OFFSET_EXT,
+        ZONE
+    };
+
+    struct Step
+    {
+        Kind kind;            ///< What the step reads.
+        char literal {'\0'};  ///< Character matched by a literal step.
+        std::size_t width {}; ///< Maximum characters read by a numeric step.
+    };
+
+    std::vector<Step> m_steps;
+};
+
+} // namespace hlp::datefmt
+
+#endif // _HLP_DATE_FORMAT_HPP
@@ -12,21 +12,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getMapper(parsed, targetField);
-    };
-}
 
 syntax::Parser getSynParser(const std::string& additional = "")
 {
@@ -45,10 +30,9 @@ Parser getAlphanumericParser(const Params& params)
     }
 
     const auto synP = params.options.size() == 1 ? getSynParser(params.options[0]) : getSynParser();
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -56,7 +40,8 @@ Parser getAlphanumericParser(const Params& params)
             return abs::makeFailure<ResultT>(synR.remaining(), name);
         }
 
-        return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+        const auto parsed = syntax::parsed(synR, txt);
+        return abs::makeSuccess(SemToken {parsed, semantic.get(), parsed}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -13,23 +14,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField, const std::string& startToken, const std::string& endToken)
-{
-    return [targetField, startToken, endToken](std::string_view parsed)
-    {
-        auto between = parsed.substr(startToken.size(), parsed.size() - startToken.size() - endToken.size());
-        return getMapper(between, targetField);
-    };
-}
-
 syntax::Parser getSynParser(const std::string& startToken, const std::string& endToken)
 {
     return [startToken, endToken](std::string_view input) -> syntax::Result
@@ -39,7 +23,7 @@ syntax::Parser getSynParser(const std::string& startToken, const std::string& en
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto endPos = input.find(endToken, startToken.size());
+        auto endPos = scan::find(input, endToken, startToken.size());
         if (endPos == std::string_view::npos)
         {
             return abs::makeFailure<syntax::ResultT>(input, {});
@@ -70,11 +54,9 @@ Parser getBetweenParser(const Params& params)
     const auto end = params.options[1];
 
     const auto synP = getSynParser(start, end);
-    const auto semP = params.targetField.empty()
-                          ? noSemParser()
-                          : getSemParser(params.targetField, start, end);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic, startSize = start.size(), endSize = end.size()](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -82,7 +64,9 @@ Parser getBetweenParser(const Params& params)
             return abs::makeFailure<ResultT>(synR.remaining(), name);
         }
 
-        return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+        const auto parsed = syntax::parsed(synR, txt);
+        const auto between = parsed.substr(startSize, parsed.size() - startSize - endSize);
+        return abs::makeSuccess(SemToken {parsed, semantic.get(), between}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
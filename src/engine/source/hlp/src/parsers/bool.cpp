@@ -12,30 +12,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(bool parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setBool(parsed, targetField);
-    };
-}
-
-SemParser getTrueSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getMapper(true, targetField);
-    };
-}
-
-SemParser getFalseSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getMapper(false, targetField);
-    };
-}
-
 syntax::Parser getTrueSynParser()
 {
     return syntax::parsers::literal("true", false);
@@ -58,23 +34,22 @@ Parser getBoolParser(const Params& params)
 
     const auto trueSynP = getTrueSynParser();
     const auto falseSynP = getFalseSynParser();
-    const auto trueSemP =
-        params.targetField.empty() ? noSemParser() : getTrueSemParser(params.targetField);
-    const auto falseSemP =
-        params.targetField.empty() ? noSemParser() : getFalseSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, trueSynP, trueSemP, falseSynP, falseSemP](std::string_view txt)
+    return [name = params.name, trueSynP, falseSynP, semantic](std::string_view txt)
     {
         const auto trueSynR = trueSynP(txt);
         if (trueSynR.success())
         {
-            return abs::makeSuccess(SemToken {syntax::parsed(trueSynR, txt), trueSemP}, trueSynR.remaining());
+            return abs::makeSuccess(SemToken {syntax::parsed(trueSynR, txt), semantic.get(), true},
+                                    trueSynR.remaining());
         }
 
         const auto falseSynR = falseSynP(txt);
         if (falseSynR.success())
         {
-            return abs::makeSuccess(SemToken {syntax::parsed(falseSynR, txt), falseSemP}, falseSynR.remaining());
+            return abs::makeSuccess(SemToken {syntax::parsed(falseSynR, txt), semantic.get(), false},
+                                    falseSynR.remaining());
         }
 
         return abs::makeFailure<ResultT>(txt, name);
@@ -1,8 +1,11 @@
 #include <chrono>
+#include <limits>
 #include <locale>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <variant>
 #include <vector>
 
 #include <curl/curl.h>
@@ -10,82 +13,163 @@
 #include <date/tz.h>
 
 #include <base/logging.hpp>
+#include <base/shardedCache.hpp>
 
+#include "date_format.hpp"
 #include "hlp.hpp"
 #include "syntax.hpp"
 
-
 namespace
 {
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::string&& parsed, std::string_view targetField)
+// Abbreviations whose time zone lookup is cached.
+constexpr size_t ZONE_CACHE_SIZE {1024};
+
+/**
+ * @brief Time zone of an abbreviation, or the error of its lookup.
+ */
+using ZoneLookup = std::variant<const date::time_zone*, std::string>;
+
+/**
+ * @brief Cache of the time zone lookups. Locating a zone searches the database, and the abbreviations of a source
+ * repeat on every event.
+ */
+base::ShardedCache<std::string, ZoneLookup>& zoneCache()
 {
-    return [parsed = std::move(parsed), targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
+    static base::ShardedCache<std::string, ZoneLookup> cache {ZONE_CACHE_SIZE};
+    return cache;
 }
 
-SemParser getSemParser(std::string_view targetField,
-                       date::fields<std::chrono::nanoseconds> fds,
-                       std::string&& abbrev,
-                       std::string_view name,
-                       std::chrono::minutes offset)
+/**
+ * @brief Locates the time zone of an abbreviation, through the cache.
+ *
+ * @param abbrev Time zone abbreviation.
+ * @return ZoneLookup The time zone or the error of its lookup.
+ */
+ZoneLookup locateZone(std::string_view abbrev)
 {
+    const std::string key {abbrev};
+    if (auto cached = zoneCache().getValue(key))
+    {
+        return std::move(cached.value());
+    }
 
-    return [targetField, fds, abbrev = std::move(abbrev), name, offset](
-               std::string_view) -> std::variant<hlp::parser::Mapper, base::Error>
+    ZoneLookup lookup;
+    try
     {
-        // if no year is parsed, we add our current year
-        date::year_month_day ymd = fds.ymd;
-        if (!fds.ymd.year().ok())
-        {
-            auto now = date::floor<date::days>(std::chrono::system_clock::now());
-            auto ny = date::year_month_day {now}.year();
-            ymd = ny / fds.ymd.month() / fds.ymd.day();
-        }
+        lookup = date::locate_zone(key);
+    }
+    catch (std::exception& e)
+    {
+        lookup = std::string {e.what()};
+    }
 
-        auto tp = date::sys_days(ymd) + fds.tod.to_duration();
+    zoneCache().insertKey(key, lookup);
+    return lookup;
+}
 
-        // Format to strict_date_optional_time
-        std::ostringstream out {};
-        out.imbue(std::locale("en_US.UTF-8"));
+/**
+ * @brief Formats a time point as %Y-%m-%dT%H:%M:%SZ without a stream.
+ *
+ * @return std::optional<std::string> The formatted time point, or nullopt if its year doesn't have four digits.
+ */
+template<typename Clock>
+std::optional<std::string> formatTimePoint(std::chrono::time_point<Clock, std::chrono::milliseconds> tp)
+{
+    const auto days = date::floor<date::days>(tp);
+    const date::year_month_day ymd {days};
+    const date::hh_mm_ss<std::chrono::milliseconds> tod {tp - days};
+    const auto year = static_cast<int>(ymd.year());
+    if (year < 0 || year > 9999)
+    {
+        return std::nullopt;
+    }
 
-        // If we have timezone information, transform it to UTC
-        // else, assume we have UTC.
-        //
-        // If there is no timezone, we substract the offset to UTC
-        // as default offset is 0
-        {
-            auto tms = date::floor<std::chrono::milliseconds>(tp);
-            if (!abbrev.empty())
-            {
-                // TODO: evaluate this function as it can be expensive
-                // we might consider restrict the abbrev supported
-                try
-                {
-                    auto tz = date::make_zoned(abbrev, tms);
-                    date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tz);
-                }
-                catch (std::exception& e)
-                {
-                    return base::Error {fmt::format("{} failed to set timezone: {}", name, e.what())};
-                }
-            }
-            else
-            {
-                date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tms - offset);
-            }
-        }
+    return fmt::format("{:04}-{:02}-{:02}T{:02}:{:02}:{:02}.{:03}Z",
+                       year,
+                       static_cast<unsigned>(ymd.month()),
+                       static_cast<unsigned>(ymd.day()),
+                       tod.hours().count(),
+                       tod.minutes().count(),
+                       tod.seconds().count(),
+                       tod.subseconds().count());
+}
+
+/**
+ * @brief Formats a time point as %Y-%m-%dT%H:%M:%SZ.
+ */
+template<typename TimePoint>
+std::string toStream(const TimePoint& tp)
+{
+    std::ostringstream out {};
+    out.imbue(std::locale("en_US.UTF-8"));
+    date::to_stream(out, "%Y-%m-%dT%H:%M:%SZ", tp);
+    return out.str();
+}
+
+/**
+ * @brief Formats the parsed date as strict_date_optional_time, in UTC.
+ *
+ * The parsed fields are only known per token, so the date is formatted when parsing the syntax and a failure is kept
+ * as the value of the token, reported by the semantic step.
+ *
+ * @return Value The formatted date or the error.
+ */
+Value formatDate(const date::fields<std::chrono::nanoseconds>& fds,
+                 std::string_view abbrev,
+                 std::string_view name,
+                 std::chrono::minutes offset)
+{
+    // if no year is parsed, we add our current year
+    date::year_month_day ymd = fds.ymd;
+    if (!fds.ymd.year().ok())
+    {
+        auto now = date::floor<date::days>(std::chrono::system_clock::now());
+        auto ny = date::year_month_day {now}.year();
+        ymd = ny / fds.ymd.month() / fds.ymd.day();
+    }
 
-        if (targetField.empty())
+    auto tp = date::sys_days(ymd) + fds.tod.to_duration();
+
+    // Format to strict_date_optional_time
+    //
+    // If we have timezone information, transform it to UTC
+    // else, assume we have UTC.
+    //
+    // If there is no timezone, we substract the offset to UTC
+    // as default offset is 0
+    auto tms = date::floor<std::chrono::milliseconds>(tp);
+    if (!abbrev.empty())
+    {
+        const auto zone = locateZone(abbrev);
+        if (std::holds_alternative<std::string>(zone))
         {
-            return noMapper();
+            return base::Error {fmt::format("{} failed to set timezone: {}", name, std::get<std::string>(zone))};
         }
-        return getMapper(out.str(), targetField);
-    };
+
+        const auto tz = date::make_zoned(std::get<const date::time_zone*>(zone), tms);
+        auto formatted = formatTimePoint(tz.get_local_time());
+        return formatted ? std::move(formatted.value()) : toStream(tz);
+    }
+
+    const auto utc = tms - offset;
+    auto formatted = formatTimePoint(utc);
+    return formatted ? std::move(formatted.value()) : toStream(utc);
+}
+
+/**
+ * @brief Converts the fields read by a compiled format to the date::parse ones.
+ */
+date::fields<std::chrono::nanoseconds> toFields(const datefmt::Fields& fields)
+{
+    date::fields<std::chrono::nanoseconds> fds {};
+    // date::parse leaves the year not ok when it is not read
+    const auto year = fields.hasYear ? date::year {fields.year} : date::year {std::numeric_limits<short>::min()};
+    fds.ymd = year / date::month {fields.month} / date::day {fields.day};
+    fds.tod = date::hh_mm_ss<std::chrono::nanoseconds> {fields.timeOfDay};
+    return fds;
 }
 
 /**
@@ -208,6 +292,8 @@ void downloadAndInstallTimeZoneDB(const std::string& version)
     }
 
     date::reload_tzdb();
+    // The cached zones belong to the previous database
+    zoneCache().clear();
 
 }
 } // namespace
@@ -269,10 +355,24 @@ Parser getDateParser(const Params& params)
         }
     }
 
-    const auto target = params.targetField.empty() ? std::string {} : params.targetField;
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
+    // Common formats are read without a stream, date::parse settles the dates they reject
+    const auto compiled = datefmt::Format::compile(format, localeStr);
 
-    return [format, locale, name = params.name, target](std::string_view text)
+    return [format, compiled, locale, name = params.name, semantic](std::string_view text)
     {
+        if (compiled)
+        {
+            if (const auto fields = compiled->parse(text))
+            {
+                return abs::makeSuccess(
+                    SemToken {text.substr(0, fields->size),
+                              semantic.get(),
+                              formatDate(toFields(*fields), fields->abbrev, name, fields->offset)},
+                    text.substr(fields->size));
+            }
+        }
+
         auto ss = std::istringstream(std::string(text));
         ss.imbue(locale);
 
@@ -288,9 +388,8 @@ Parser getDateParser(const Params& params)
 
         auto pos = (ss.tellg() == -1) ? text.size() : static_cast<std::size_t>(ss.tellg());
 
-        return abs::makeSuccess(
-            SemToken {text.substr(0, pos), getSemParser(target, fds, std::move(abbrev), name, offset)},
-            text.substr(pos));
+        return abs::makeSuccess(SemToken {text.substr(0, pos), semantic.get(), formatDate(fds, abbrev, name, offset)},
+                                text.substr(pos));
     };
 }
 
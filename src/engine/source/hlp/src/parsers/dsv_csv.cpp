@@ -17,22 +17,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
-{
-    return [doc, targetField](json::Json& event)
-    {
-        event.set(targetField, doc);
-    };
-}
-
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
-{
-    return [targetField, doc](std::string_view)
-    {
-        return getMapper(doc, targetField);
-    };
-}
-
 /**
  * @brief Return the dsv parser function
  *
@@ -57,8 +41,9 @@ inline Parser dsvParserFunction(std::string name,
     }
 
     const auto toStopP = syntax::parsers::toEnd(endTokens);
+    const auto semantic = targetField.empty() ? nullptr : makeSemantic(targetField);
 
-    return [toStopP, target = targetField, delimiterChar, quoteChar, headers, escapeChar, name](std::string_view txt)
+    return [toStopP, semantic, delimiterChar, quoteChar, headers, escapeChar, name](std::string_view txt)
     {
         auto synR = toStopP(txt);
         if (synR.failure())
@@ -71,7 +56,8 @@ inline Parser dsvParserFunction(std::string name,
 
         std::size_t start {0};
 
-        json::Json doc {};
+        std::vector<Field> fields;
+        fields.reserve(headers.size());
         auto i = 0;
 
         while (start <= parsed.size() && i < headers.size())
@@ -85,11 +71,10 @@ inline Parser dsvParserFunction(std::string name,
             }
 
             auto fValue = field.value();
+            fValue.addOffset(start);
+            fields.emplace_back(fValue);
 
-            auto v = remaining.substr(fValue.start(), fValue.len());
-            updateDoc(doc, headers[i], v, fValue.isEscaped(), std::string_view {&escapeChar, 1}, fValue.isQuoted());
-
-            start += fValue.end() + 1;
+            start = fValue.end() + 1;
             i++;
         }
 
@@ -109,16 +94,23 @@ inline Parser dsvParserFunction(std::string name,
             return abs::makeFailure<ResultT>(txt.substr(start-1), name);
         }
 
-        SemParser semP;
-        if (target.empty())
+        if (!semantic)
         {
-            semP = noSemParser();
+            return abs::makeSuccess<ResultT>(SemToken {parsed}, synR.remaining());
         }
-        else
+
+        // The input is valid, materialize the fields found by the scan, mapped straight under the target
+        Fields values;
+        values.reserve(fields.size());
+        for (auto j = 0; j < fields.size(); j++)
         {
-            semP = getSemParser(std::move(doc), target);
+            addField(values,
+                     headers[j],
+                     parsed.substr(fields[j].start(), fields[j].len()),
+                     fields[j].isEscaped(),
+                     std::string_view {&escapeChar, 1});
         }
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get(), std::move(values)}, synR.remaining());
     };
 }
 } // namespace
@@ -6,6 +6,7 @@
 #include <fmt/format.h>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -13,47 +14,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-inline bool isBase64(const char c)
-{
-    if ((c >= 'A') && (c <= 'Z'))
-    {
-        return true;
-    }
-
-    if ((c >= 'a') && (c <= 'z'))
-    {
-        return true;
-    }
-
-    if ((c >= '0') && (c <= '9'))
-    {
-        return true;
-    }
-
-    if ((c == '+') || (c == '/'))
-    {
-        return true;
-    }
-
-    return false;
-}
-
-Mapper getMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getMapper(parsed, targetField);
-    };
-}
-
 syntax::Parser getSynParser()
 {
     return [](std::string_view input) -> syntax::Result
@@ -63,13 +23,10 @@ syntax::Parser getSynParser()
             return abs::makeFailure<syntax::ResultT>(input, {});
         }
 
-        auto i = 0;
-        for (; i != input.size(); ++i)
+        auto i = scan::findFirstNotBase64(input);
+        if (i == std::string_view::npos)
         {
-            if (!isBase64(input[i]))
-            {
-                break;
-            }
+            i = input.size();
         }
 
         if (i == 0)
@@ -108,11 +65,10 @@ Parser getBinaryParser(const Params& params)
         throw std::runtime_error("binary parser doesn't accept parameters");
     }
 
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
     const auto synP = getSynParser();
 
-    return [name = params.name, semP, synP](std::string_view txt)
+    return [name = params.name, semantic, synP](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -120,7 +76,8 @@ Parser getBinaryParser(const Params& params)
             return abs::makeFailure<ResultT>(synR.remaining(), name);
         }
 
-        return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+        const auto parsed = syntax::parsed(synR, txt);
+        return abs::makeSuccess(SemToken {parsed, semantic.get(), parsed}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
@@ -10,11 +10,11 @@ Parser getEofParser(const Params& params)
         throw(std::runtime_error("Eof parser does not accept options"));
     }
 
-    return [name = params.name, semP = noSemParser()](std::string_view txt)
+    return [name = params.name](std::string_view txt)
     {
         if (txt.empty())
         {
-            return abs::makeSuccess<ResultT>(SemToken {txt, semP}, txt);
+            return abs::makeSuccess<ResultT>(SemToken {txt}, txt);
         }
         else
         {
@@ -1,3 +1,4 @@
+#include <iterator>
 #include <map>
 #include <stdexcept>
 #include <string>
@@ -13,18 +14,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::map<std::string, std::string>&& fileAttrs, std::string_view targetField)
-{
-    return [fileAttrs, targetField](json::Json& event)
-    {
-        for (const auto& [attr, value] : fileAttrs)
-        {
-            const auto attrPath = std::string(targetField) + attr;
-            event.setString(value, attrPath);
-        }
-    };
-}
-
 std::map<std::string, std::string> parseFp(char slash, std::string_view in)
 {
     std::map<std::string, std::string> out {};
@@ -57,13 +46,14 @@ std::map<std::string, std::string> parseFp(char slash, std::string_view in)
     return out;
 }
 
-SemParser getSemParser(const std::string& targetField)
+SemParser getSemParser()
 {
-    return [targetField](std::string_view parsed)
+    return [](std::string_view parsed, Value& value) -> std::optional<base::Error>
     {
         auto res = parsed.find('\\') != std::string::npos ? parseFp('\\', parsed) : parseFp('/', parsed);
 
-        return getMapper(std::move(res), targetField);
+        value = Fields(std::make_move_iterator(res.begin()), std::make_move_iterator(res.end()));
+        return std::nullopt;
     };
 }
 
@@ -85,10 +75,9 @@ Parser getFilePathParser(const Params& params)
     }
 
     const auto synP = syntax::parsers::toEnd(params.stop);
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField, getSemParser());
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -97,7 +86,7 @@ Parser getFilePathParser(const Params& params)
         }
 
         const auto parsed = syntax::parsed(synR, txt);
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get()}, synR.remaining());
     };
 }
 
@@ -31,9 +31,7 @@ Parser getIgnoreParser(const Params& params)
     }
 
     auto synP = getSynParser(params.options[0]);
-    auto semP = noSemParser();
-
-    return [synP, semP, name = params.name](std::string_view txt)
+    return [synP, name = params.name](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -41,7 +39,7 @@ Parser getIgnoreParser(const Params& params)
             return abs::makeFailure<ResultT>(synR.remaining(), name);
         }
 
-        return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+        return abs::makeSuccess(SemToken {syntax::parsed(synR, txt)}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
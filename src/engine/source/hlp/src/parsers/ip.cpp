@@ -1,9 +1,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <sys/types.h>
 
-#include <arpa/inet.h>
+#include <base/utils/ipUtils.hpp>
 #include <fmt/format.h>
 
 #include "hlp.hpp"
@@ -14,33 +13,19 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::string_view parsed, std::string_view targetField)
+SemParser getSemParser()
 {
-    return [parsed, targetField](json::Json& event)
+    return [](std::string_view parsed, Value& value) -> std::optional<base::Error>
     {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
-    {
-        struct in_addr ip;
-        struct in6_addr ip6;
-
-        if (!inet_pton(AF_INET, std::string(parsed).c_str(), &ip)
-            && !inet_pton(AF_INET6, std::string(parsed).c_str(), &ip6))
+        // Checked straight from the view, without null terminated copies for inet_pton
+        uint8_t address[16];
+        if (!::utils::ip::parseIPv4(parsed, address) && !::utils::ip::parseIPv6(parsed, address))
         {
             return base::Error {"Invalid IPv4 or IPv6 address"};
         }
 
-        if (targetField.empty())
-        {
-            return noMapper();
-        }
-
-        return getMapper(parsed, targetField);
+        value = parsed;
+        return std::nullopt;
     };
 }
 
@@ -79,10 +64,9 @@ Parser getIPParser(const Params& params)
 
     syntax::Parser synP = getSynParser();
 
-    auto target = params.targetField.empty() ? "" : params.targetField;
-    auto semP = getSemParser(target);
+    const auto semantic = makeSemantic(params.targetField, getSemParser());
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -92,7 +76,7 @@ Parser getIPParser(const Params& params)
         else
         {
             auto parsed = syntax::parsed(synR, txt);
-            return abs::makeSuccess(SemToken {parsed, semP}, synR.remaining());
+            return abs::makeSuccess(SemToken {parsed, semantic.get()}, synR.remaining());
         }
     };
 }
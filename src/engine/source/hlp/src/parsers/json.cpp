@@ -4,7 +4,8 @@
 
 #include <fmt/format.h>
 #include <rapidjson/document.h>
-#include <rapidjson/stringbuffer.h>
+#include <rapidjson/memorystream.h>
+#include <rapidjson/reader.h>
 
 #include "hlp.hpp"
 #include "syntax.hpp"
@@ -14,21 +15,7 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.set(targetField, parsed);
-    };
-}
-
-SemParser getSemParser(std::string_view targetField, json::Json&& parsed)
-{
-    return [targetField, parsed = std::move(parsed)](std::string_view)
-    {
-        return getMapper(parsed, targetField);
-    };
-}
+constexpr auto PARSE_FLAGS = rapidjson::kParseStopWhenDoneFlag;
 
 } // namespace
 namespace hlp::parsers
@@ -41,29 +28,40 @@ Parser getJSONParser(const Params& params)
         throw std::runtime_error(fmt::format("JSON parser do not accept arguments!"));
     }
 
-    const auto target = params.targetField.empty() ? "" : params.targetField;
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, target](std::string_view txt)
+    return [name = params.name, semantic](std::string_view txt)
     {
         if (txt.empty())
         {
             return abs::makeFailure<ResultT>(txt, name);
         }
 
-        rapidjson::Reader reader;
-        const auto ssInput = std::string(txt);
-        rapidjson::StringStream ss(ssInput.c_str());
-        rapidjson::Document doc;
+        // The stream reads the view in place, it does not need a null terminated copy of the input
+        rapidjson::MemoryStream ms(txt.data(), txt.size());
+        if (!semantic)
+        {
+            // Nothing is mapped, the input is only validated without building a document
+            rapidjson::Reader reader;
+            rapidjson::BaseReaderHandler<> handler;
+            if (reader.Parse<PARSE_FLAGS>(ms, handler).IsError())
+            {
+                return abs::makeFailure<ResultT>(txt, name);
+            }
+            return abs::makeSuccess<ResultT>(SemToken {txt.substr(0, ms.Tell())}, txt.substr(ms.Tell()));
+        }
 
-        doc.ParseStream<rapidjson::kParseStopWhenDoneFlag>(ss);
+        rapidjson::Document doc;
+        doc.ParseStream<PARSE_FLAGS, rapidjson::UTF8<>>(ms);
         if (doc.HasParseError())
         {
             return abs::makeFailure<ResultT>(txt, name);
         }
-        const auto parsed = txt.substr(0, ss.Tell());
-        const auto remaining = txt.substr(ss.Tell());
-        const auto semP = target.empty() ? noSemParser() : getSemParser(target, json::Json(std::move(doc)));
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, remaining);
+
+        // The mapping copies the document into the event with the event allocator
+        return abs::makeSuccess<ResultT>(
+            SemToken {txt.substr(0, ms.Tell()), semantic.get(), std::make_shared<const json::Json>(std::move(doc))},
+            txt.substr(ms.Tell()));
     };
 }
 } // namespace hlp::parsers
@@ -16,21 +16,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const json::Json& doc, std::string_view targetField)
-{
-    return [doc, targetField](json::Json& event)
-    {
-        event.set(targetField, doc);
-    };
-}
-
-SemParser getSemParser(json::Json&& doc, const std::string& targetField)
-{
-    return [targetField, doc](std::string_view)
-    {
-        return getMapper(doc, targetField);
-    };
-}
 } // namespace
 
 namespace hlp::parsers
@@ -63,16 +48,15 @@ Parser getKVParser(const Params& params)
         throw std::runtime_error(fmt::format("KV parser: separator and delimiter must be different"));
     }
 
-    const auto targetField = params.targetField.empty() ? "" : params.targetField;
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [sep, delim, quote, esc, name = params.name, targetField](std::string_view txt)
+    return [sep, delim, quote, esc, name = params.name, semantic](std::string_view txt)
     {
         std::string_view kvInput = txt;
 
         auto remaining = txt.substr(kvInput.size());
 
         size_t start {0}, end {0};
-        json::Json doc;
 
         std::vector<Field> kv;
         auto dlm = sep;
@@ -108,9 +92,7 @@ Parser getKVParser(const Params& params)
 
         for (auto i = 0; i < kv.size() - 1; i += 2)
         {
-            auto k = kvInput.substr(kv[i].start(), kv[i].len());
-            auto v = kvInput.substr(kv[i + 1].start(), kv[i + 1].len());
-            if (k.empty())
+            if (kv[i].len() == 0)
             {
                 return abs::makeFailure<ResultT>(txt.substr(kv[i].start()), name);
                 // return parsec::makeError<json::Json>(
@@ -119,8 +101,6 @@ Parser getKVParser(const Params& params)
                 //     index);
             }
             end = kv[i + 1].end();
-            updateDoc(
-                doc, fmt::format("/{}", k), v, kv[i + 1].isEscaped(), std::string_view {&esc, 1}, kv[i + 1].isQuoted());
         }
 
         if (start - 1 != end)
@@ -135,8 +115,25 @@ Parser getKVParser(const Params& params)
             return abs::makeFailure<ResultT>(txt.substr(end), name);
         }
 
-        const auto semP = targetField.empty() ? noSemParser() : getSemParser(std::move(doc), targetField);
-        return abs::makeSuccess<ResultT>(SemToken {kvInput, std::move(semP)}, remaining);
+        if (!semantic)
+        {
+            return abs::makeSuccess<ResultT>(SemToken {kvInput}, remaining);
+        }
+
+        // The input is valid, materialize the pairs found by the scan, mapped straight under the target
+        Fields fields;
+        fields.reserve(kv.size() / 2);
+        for (auto i = 0; i < kv.size() - 1; i += 2)
+        {
+            auto key = std::string {"/"};
+            key += kvInput.substr(kv[i].start(), kv[i].len());
+            addField(fields,
+                     std::move(key),
+                     kvInput.substr(kv[i + 1].start(), kv[i + 1].len()),
+                     kv[i + 1].isEscaped(),
+                     std::string_view {&esc, 1});
+        }
+        return abs::makeSuccess<ResultT>(SemToken {kvInput, semantic.get(), std::move(fields)}, remaining);
     };
 }
 
@@ -12,22 +12,6 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(std::string_view parsed, const std::string& targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(std::string_view parsed, const Mapper& mapper)
-{
-    return [parsed, mapper](std::string_view)
-    {
-        return mapper;
-    };
-}
-
 syntax::Parser getSynParser(const std::string& literal)
 {
     return syntax::parsers::literal(literal);
@@ -46,10 +30,9 @@ Parser getLiteralParser(const Params& params)
 
     const auto& literal = params.options[0];
     const auto synP = getSynParser(literal);
-    const auto mapper = params.targetField.empty() ? noMapper() : getMapper(literal, params.targetField);
-    const auto semP = getSemParser(literal, mapper);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -58,7 +41,9 @@ Parser getLiteralParser(const Params& params)
         }
         else
         {
-            return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+            // The literal is case sensitive, so the parsed text is the literal itself
+            const auto parsed = syntax::parsed(synR, txt);
+            return abs::makeSuccess(SemToken {parsed, semantic.get(), parsed}, synR.remaining());
         }
     };
 }
@@ -10,26 +10,6 @@
 
 namespace utils
 {
-void setNumber(std::string_view targetField, json::Json& doc, int8_t val)
-{
-    doc.setInt(val, targetField);
-}
-
-void setNumber(std::string_view targetField, json::Json& doc, int64_t val)
-{
-    doc.setInt64(val, targetField);
-}
-
-void setNumber(std::string_view targetField, json::Json& doc, float_t val)
-{
-    doc.setFloat(val, targetField);
-}
-
-void setNumber(std::string_view targetField, json::Json& doc, double_t val)
-{
-    doc.setDouble(val, targetField);
-}
-
 std::from_chars_result from_chars(const char* first, const char* last, int8_t& val)
 {
     return std::from_chars(first, last, val);
@@ -16,10 +16,6 @@
 
 namespace utils
 {
-void setNumber(std::string_view targetField, json::Json& doc, int8_t val);
-void setNumber(std::string_view targetField, json::Json& doc, int64_t val);
-void setNumber(std::string_view targetField, json::Json& doc, float_t val);
-void setNumber(std::string_view targetField, json::Json& doc, double_t val);
 std::from_chars_result from_chars(const char* first, const char* last, int8_t& val);
 std::from_chars_result from_chars(const char* first, const char* last, int64_t& val);
 std::from_chars_result from_chars(const char* first, const char* last, float& val);
@@ -32,29 +28,16 @@ using namespace hlp;
 using namespace hlp::parser;
 
 template<typename T>
-Mapper getMapper(const std::string& targetField, T val)
+SemParser getSemParser()
 {
-    return [targetField, val](json::Json& event)
-    {
-        utils::setNumber(targetField, event, val);
-    };
-}
-
-template<typename T>
-SemParser getSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    return [](std::string_view parsed, Value& value) -> std::optional<base::Error>
     {
         T val {};
         const auto [ptr, ec] {utils::from_chars(parsed.begin(), parsed.end(), val)};
         if (ec == std::errc())
         {
-            if (!targetField.empty())
-            {
-                return getMapper<T>(targetField, val);
-            }
-
-            return noMapper();
+            value = val;
+            return std::nullopt;
         }
         else if (ec == std::errc::result_out_of_range)
         {
@@ -98,10 +81,9 @@ Parser getNumericParser(const Params& params)
     }
 
     const auto synP = getSynParser<T>();
-    const auto targetPath = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getSemParser<T>(targetPath);
+    const auto semantic = makeSemantic(params.targetField, getSemParser<T>());
 
-    return [name = params.name, synP, semP](std::string_view text)
+    return [name = params.name, synP, semantic](std::string_view text)
     {
         auto synR = synP(text);
         if (synR.failure())
@@ -110,7 +92,7 @@ Parser getNumericParser(const Params& params)
         }
         else
         {
-            return abs::makeSuccess(SemToken {syntax::parsed(synR, text), semP}, synR.remaining());
+            return abs::makeSuccess(SemToken {syntax::parsed(synR, text), semantic.get()}, synR.remaining());
         }
     };
 }
@@ -1,8 +1,8 @@
 #include "parse_field.hpp"
 #include "fmt/format.h"
 #include "number.hpp"
+#include "scan.hpp"
 #include <iostream>
-#include <base/json.hpp>
 #include <string_view>
 namespace hlp
 {
@@ -25,7 +25,9 @@ std::optional<Field> getField(std::string_view input,
     bool isEscaped = false;
     bool isQuoted = false;
 
-    for (auto i = 0ul; i < input.size(); i++)
+    // Only the delimiter, quote and escape characters change the state, skip to the next one of them
+    for (auto i = scan::findFirstOf(input, delimiter, quote, escape); i != std::string_view::npos;
+         i = scan::findFirstOf(input, delimiter, quote, escape, i + 1))
     {
         if (input[i] == delimiter && !quote_opened)
         {
@@ -89,23 +91,18 @@ void unescape(bool is_escaped, std::string& vs, std::string_view escape)
     }
 }
 
-void updateDoc(json::Json& doc,
-               std::string_view key,
-               std::string_view value,
-               bool is_escaped,
-               std::string_view escape,
-               bool is_quoted)
+void addField(parser::Fields& fields, std::string key, std::string_view value, bool is_escaped, std::string_view escape)
 {
     if (value.empty())
     {
-        doc.setNull(key);
+        fields.emplace_back(std::move(key), std::nullopt);
         return;
     }
 
-    // If the value is a string, unescape it if necessary and add it to the JSON document
+    // If the value is a string, unescape it if necessary
     auto vs = std::string {value.data(), value.size()};
     unescape(is_escaped, vs, escape);
-    doc.setString(vs, key);
+    fields.emplace_back(std::move(key), std::move(vs));
 }
 
 } // namespace hlp
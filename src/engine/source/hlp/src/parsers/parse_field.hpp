@@ -1,11 +1,13 @@
 #ifndef WAZUH_ENGINE_PARSE_FIELD_HPP
 #define WAZUH_ENGINE_PARSE_FIELD_HPP
 
-#include <base/json.hpp>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <tuple>
 
+#include "parser.hpp"
+
 namespace hlp
 {
 
@@ -74,21 +76,19 @@ std::optional<Field> getField(std::string_view input,
 void unescape(bool is_escaped, std::string& vs, std::string_view escape);
 
 /**
- * @brief Adds a key:value pair to a JSON document. Unescapes the value if necessary.
+ * @brief Adds a key:value pair to the fields mapped under the target. Unescapes the value if necessary.
  *
- * @param doc The JSON document to update.
- * @param key The key to be added to the document.
- * @param value The value to be added to the document.
+ * @param fields The fields to update.
+ * @param key The path of the field relative to the target.
+ * @param value The value of the field, an empty value is mapped as null.
  * @param is_escaped Whether the value should be unescaped.
  * @param escape The character used to unescape quote or escape characters inside the string value.
- * @param is_quoted Whether the value is quoted. If false, it tries to parse the value as int or double.
  */
-void updateDoc(json::Json& doc,
-               std::string_view key,
-               std::string_view value,
-               bool is_escaped,
-               std::string_view escape,
-               bool is_quoted);
+void addField(parser::Fields& fields,
+              std::string key,
+              std::string_view value,
+              bool is_escaped,
+              std::string_view escape);
 
 } // namespace hlp
 #endif // WAZUH_ENGINE_PARSE_FIELD_HPP
@@ -13,21 +13,14 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getMapper(const std::string& parsed, std::string_view targetField)
+SemParser getSemParser(char escape)
 {
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField, char escape)
-{
-    return [targetField, escape](std::string_view parsed)
+    return [escape](std::string_view parsed, Value& value) -> std::optional<base::Error>
     {
         std::string tr(parsed.begin() + 1, parsed.end() - 1);
         tr.erase(std::remove(tr.begin(), tr.end(), escape), tr.end());
-        return getMapper(tr, targetField);
+        value = std::move(tr);
+        return std::nullopt;
     };
 }
 
@@ -120,12 +113,11 @@ Parser getQuotedParser(const Params& params)
     }
 
     const auto synP = getSynParser(quoteChar, escapeChar);
-    const auto semP = params.targetField.empty()
-                          ? noSemParser()
-                          : getSemParser(params.targetField, escapeChar);
+    const auto semantic =
+        params.targetField.empty() ? nullptr : makeSemantic(params.targetField, getSemParser(escapeChar));
 
     // The parser
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -134,7 +126,7 @@ Parser getQuotedParser(const Params& params)
         }
 
         const auto parsed = syntax::parsed(synR, txt);
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get()}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
@@ -7,29 +7,6 @@
 #include "hlp.hpp"
 #include "syntax.hpp"
 
-namespace
-{
-using namespace hlp;
-using namespace hlp::parser;
-
-Mapper getMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
-
-SemParser getSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getMapper(parsed, targetField);
-    };
-}
-
-} // namespace
-
 namespace hlp::parsers
 {
 Parser getTextParser(const Params& params)
@@ -53,10 +30,9 @@ Parser getTextParser(const Params& params)
         synP = synP | next;
     }
 
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -65,7 +41,8 @@ Parser getTextParser(const Params& params)
         }
         else
         {
-            return abs::makeSuccess(SemToken {syntax::parsed(synR, txt), semP}, synR.remaining());
+            const auto parsed = syntax::parsed(synR, txt);
+            return abs::makeSuccess(SemToken {parsed, semantic.get(), parsed}, synR.remaining());
         }
     };
 }
@@ -9,30 +9,115 @@
 #include <curl/curl.h>
 #include <fmt/format.h>
 
+#include <base/shardedCache.hpp>
+
 #include "hlp.hpp"
 #include "syntax.hpp"
+#include "uri.hpp"
+#include "useragent.hpp"
 
 namespace
 {
 using namespace hlp;
 using namespace hlp::parser;
 
-Mapper getUriMapper(std::map<std::string, std::string>&& uriAttrs, std::string_view targetField)
+// Option of the user agent parser that maps the details of the agent
+constexpr auto UA_DETAILS_OPTION = "details";
+
+// Distinct user agents whose details are cached, web logs only have a few thousands
+constexpr size_t UA_CACHE_SIZE {8192};
+
+/**
+ * @brief Cache of the details of the user agents, shared by all the user agent parsers.
+ */
+base::ShardedCache<std::string, SharedFields>& uaCache()
+{
+    static base::ShardedCache<std::string, SharedFields> cache {UA_CACHE_SIZE};
+    return cache;
+}
+
+/**
+ * @brief Fields of a user agent, extracted once per distinct user agent.
+ *
+ * @param parsed User agent.
+ * @return SharedFields Original user agent and its details.
+ */
+SharedFields getUAFields(std::string_view parsed)
 {
-    return [uriAttrs, targetField](json::Json& event)
+    std::string key {parsed};
+    if (auto cached = uaCache().getValue(key))
     {
-        for (const auto& [attr, value] : uriAttrs)
+        return std::move(cached.value());
+    }
+
+    const auto details = useragent::extract(parsed);
+    auto fields = std::make_shared<Fields>();
+    fields->emplace_back("/original", key);
+    auto load = [&fields](const std::string& value, const std::string& path)
+    {
+        if (!value.empty())
         {
-            const auto attrPath = std::string(targetField) + attr;
-            event.setString(value, attrPath);
+            fields->emplace_back(path, value);
         }
     };
+    load(details.name, "/name");
+    load(details.version, "/version");
+    load(details.osName, "/os/name");
+    load(details.osVersion, "/os/version");
+    load(details.osFull, "/os/full");
+    load(details.deviceName, "/device/name");
+
+    SharedFields shared {std::move(fields)};
+    uaCache().insertKey(key, shared);
+    return shared;
 }
 
-SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields, const std::string& targetField)
+SemParser getUASemParser()
 {
-    return [mapCurlFields, targetField](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    return [](std::string_view parsed, Value& value) -> std::optional<base::Error>
     {
+        value = getUAFields(parsed);
+        return std::nullopt;
+    };
+}
+
+SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields, bool mapped)
+{
+    return [mapCurlFields, mapped](std::string_view parsed, Value& value) -> std::optional<base::Error>
+    {
+        // Most URLs are the ones libcurl keeps as they are, their parts are mapped as views of the parsed text
+        if (const auto parts = uri::scan(parsed))
+        {
+            if (mapped)
+            {
+                FieldViews uriAttrs;
+                uriAttrs.reserve(9);
+                auto load = [&uriAttrs](const std::optional<std::string_view>& part, std::string_view path)
+                {
+                    if (part)
+                    {
+                        uriAttrs.emplace_back(path, *part);
+                    }
+                };
+
+                // Same order as the libcurl fields
+                uriAttrs.emplace_back("/original", parsed);
+                uriAttrs.emplace_back("/scheme", parts->scheme);
+                load(parts->username, "/username");
+                load(parts->password, "/password");
+                uriAttrs.emplace_back("/domain", parts->host);
+                load(parts->port, "/port");
+                uriAttrs.emplace_back("/path", parts->path);
+                load(parts->query, "/query");
+                load(parts->fragment, "/fragment");
+
+                value = std::move(uriAttrs);
+            }
+
+            return std::nullopt;
+        }
+
+        // The rest is normalized by libcurl
         const auto urlstr = std::string(parsed);
         auto urlCleanup = [](auto* url)
         {
@@ -55,21 +140,17 @@ SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields,
         // char ptr and we will copy it again into the string for the result
         // Check if there's a way to avoid all the copying here
 
-        if (targetField.empty())
-        {
-            return noMapper();
-        }
-        else
+        if (mapped)
         {
             // Load the fild values into the result
-            std::map<std::string, std::string> uriAttrs;
+            Fields uriAttrs;
             auto load = [&uriAttrs, &url](CURLUPart field, const std::string& path)
             {
                 char* str = nullptr;
                 auto uc = curl_url_get(url.get(), field, &str, 0);
                 if (uc == CURLUE_OK)
                 {
-                    uriAttrs[path] = std::string {str};
+                    uriAttrs.emplace_back(path, std::string {str});
                     curl_free(str);
                 }
             };
@@ -80,41 +161,10 @@ SemParser getUriSemParser(const std::map<CURLUPart, std::string>& mapCurlFields,
             }
             // TODO Check if urlstr.size() == doc["original"].size()
 
-            return getUriMapper(std::move(uriAttrs), targetField);
+            value = std::move(uriAttrs);
         }
-    };
-}
-
-Mapper getStrMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        event.setString(parsed, targetField);
-    };
-}
 
-SemParser getStrSemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getStrMapper(parsed, targetField);
-    };
-}
-
-Mapper getUAMapper(std::string_view parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
-    {
-        auto originalPath = std::string(targetField) + "/original";
-        event.setString(parsed, originalPath);
-    };
-}
-
-SemParser getUASemParser(const std::string& targetField)
-{
-    return [targetField](std::string_view parsed)
-    {
-        return getUAMapper(parsed, targetField);
+        return std::nullopt;
     };
 }
 
@@ -188,10 +238,10 @@ Parser getUriParser(const Params& params)
     };
 
     const auto synP = syntax::parsers::toEnd(params.stop);
-    const auto target = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getUriSemParser(mapCurlFields, target);
+    const auto semantic =
+        makeSemantic(params.targetField, getUriSemParser(mapCurlFields, !params.targetField.empty()));
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -201,7 +251,7 @@ Parser getUriParser(const Params& params)
 
         const auto parsed = syntax::parsed(synR, txt);
 
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get()}, synR.remaining());
     };
 }
 
@@ -212,16 +262,23 @@ Parser getUAParser(const Params& params)
         throw std::runtime_error(fmt::format("User-agent parser needs a stop string"));
     }
 
-    if (!params.options.empty())
+    if (params.options.size() > 1 || (params.options.size() == 1 && params.options[0] != UA_DETAILS_OPTION))
     {
-        throw std::runtime_error(fmt::format("URL parser do not accept arguments!"));
+        throw std::runtime_error(
+            fmt::format("User-agent parser only accepts the '{}' option to map the details", UA_DETAILS_OPTION));
     }
+    const auto details = !params.options.empty();
 
     const auto synP = syntax::parsers::toEnd(params.stop);
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getUASemParser(params.targetField);
+    // The user agent is mapped as the original field of the target, and with its details under the target
+    SemanticPtr semantic;
+    if (!params.targetField.empty())
+    {
+        semantic = details ? makeSemantic(params.targetField, getUASemParser())
+                           : makeSemantic(params.targetField + "/original");
+    }
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -230,7 +287,7 @@ Parser getUAParser(const Params& params)
         }
 
         const auto parsed = syntax::parsed(synR, txt);
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get(), parsed}, synR.remaining());
     };
 }
 
@@ -246,10 +303,9 @@ Parser getFQDNParser(const Params& params)
     }
 
     syntax::Parser synP = getFQDNSynParser();
-    const auto semP =
-        params.targetField.empty() ? noSemParser() : getStrSemParser(params.targetField);
+    const auto semantic = params.targetField.empty() ? nullptr : makeSemantic(params.targetField);
 
-    return [name = params.name, synP, semP](std::string_view txt)
+    return [name = params.name, synP, semantic](std::string_view txt)
     {
         std::string_view fqdnInput = txt;
 
@@ -264,7 +320,7 @@ Parser getFQDNParser(const Params& params)
 
         const auto parsed = syntax::parsed(synR, fqdnInput);
 
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, remaining);
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get(), parsed}, remaining);
     };
 }
 
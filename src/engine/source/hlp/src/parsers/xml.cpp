@@ -1,11 +1,17 @@
+#include <algorithm>
+#include <deque>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 #include <pugixml.hpp>
 
 #include "hlp.hpp"
+#include "scan.hpp"
 #include "syntax.hpp"
 
 namespace
@@ -13,31 +19,47 @@ namespace
 using namespace hlp;
 using namespace hlp::parser;
 
-using xmlModule = std::function<bool(pugi::xml_node&, json::Json&, std::string&)>;
-bool xmlWinModule(pugi::xml_node& node, json::Json& docJson, std::string path)
+/**
+ * @brief Element of the xml, as the conversion to json sees it. The values are views of the input or of the decoded
+ * values of the scanner.
+ */
+struct XmlElement
 {
-    auto nodeName = std::string_view {node.name()};
-    if (nodeName == "Data")
+    std::string_view name;                                                 ///< Name of the element
+    std::vector<std::pair<std::string_view, std::string_view>> attributes; ///< Attributes, as name and value
+    bool hasText {false};                                                  ///< The element has a text child
+    std::string_view text;       ///< Value of the first text child, empty if none
+    std::string_view firstValue; ///< Value of the first child, empty if it is an element
+};
+
+/**
+ * @brief Special rules of a module for an element.
+ *
+ * @return true if the element was processed by the module, false if it is converted by the default rules
+ */
+using xmlModule = std::function<bool(const XmlElement&, json::Json&, const std::string&)>;
+bool xmlWinModule(const XmlElement& element, json::Json& docJson, const std::string& path)
+{
+    if (element.name == "Data")
     {
-        const auto name = node.attribute("Name");
-        if (name.empty())
+        const auto name = std::find_if(element.attributes.begin(),
+                                       element.attributes.end(),
+                                       [](const auto& attr) { return attr.first == "Name"; });
+        if (name == element.attributes.end())
         {
             // Treat it as an array in order to avoid data loss
-            docJson.appendString(node.first_child().value(), path);
-            return true;
+            docJson.appendString(element.firstValue, path);
         }
         else
         {
-            path.append("/").append(name.as_string());
-            docJson.setString(node.text().as_string(), path);
+            docJson.setString(element.text, std::string {path}.append("/").append(name->second));
         }
 
         return true;
     }
-    else if (nodeName == "Event")
+    else if (element.name == "Event")
     {
         // Skip Event in result json
-        path += "/Event";
         return true;
     }
     else
@@ -51,9 +73,74 @@ std::unordered_map<std::string_view, xmlModule> xmlModules = {
     {"windows", xmlWinModule},
 };
 
-void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod, const std::string& path = "")
+/**
+ * @brief Writes an element in the json.
+ *
+ * @return std::string The path the children of the element are written to
+ */
+std::string writeElement(const XmlElement& element, json::Json& docJson, const xmlModule& mod, const std::string& path)
 {
     // TODO: add array support
+    std::string localPath {path};
+
+    // Check if we have special rules and if are applied
+    auto processed = false;
+    if (mod)
+    {
+        processed = mod(element, docJson, localPath);
+    }
+
+    bool isElementOfArray = false; // If the element is an array, the path should be adjusted
+
+    if (!processed)
+    {
+        localPath.append("/").append(element.name);
+
+        // Check if the element already exists
+        if (docJson.exists(localPath))
+        {
+            isElementOfArray = true; // If exists, should be an array
+            if (docJson.isObject(localPath))
+            {
+                json::Json tmp = docJson.getJson(localPath).value();
+                docJson.setArray(localPath);
+                docJson.appendJson(tmp, localPath);
+                localPath += "/1";
+            }
+            else if (docJson.isArray(localPath))
+            {
+                size_t index = docJson.size(localPath);
+                localPath += "/" + std::to_string(index);
+            }
+        }
+
+        if (element.hasText)
+        {
+            docJson.setString(element.text, localPath + "/#text");
+        }
+
+        for (const auto& [name, value] : element.attributes)
+        {
+            docJson.setString(value, std::string {localPath}.append("/@").append(name));
+        }
+
+        if (!element.hasText && element.attributes.empty())
+        {
+            docJson.setObject(localPath);
+        }
+    }
+
+    // Ajdust path if the element is an array
+    if (isElementOfArray)
+    {
+        localPath = localPath.substr(0, localPath.find_last_of('/'));
+    }
+
+    return localPath;
+}
+
+void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod, const std::string& path = "")
+{
     // Iterate over the xml generating the corresponding json
     for (auto node : docXml.children())
     {
@@ -63,98 +150,469 @@ void xmlToJson(pugi::xml_node& docXml, json::Json& docJson, const xmlModule& mod
             continue;
         }
 
-        std::string localPath {path};
+        XmlElement element;
+        element.name = node.name();
+        for (auto attr : node.attributes())
+        {
+            element.attributes.emplace_back(attr.name(), attr.value());
+        }
+        element.hasText = !node.text().empty();
+        element.text = node.text().as_string();
+        element.firstValue = node.first_child().value();
+
+        auto localPath = writeElement(element, docJson, mod, path);
 
-        // Check if we have special rules and if are applied
-        auto processed = false;
-        if (mod)
+        // Process children
+        if (!node.first_child().empty())
         {
-            processed = mod(node, docJson, localPath);
+            xmlToJson(node, docJson, mod, localPath);
         }
+    }
+}
+
+/**
+ * @brief Streaming xml scanner, converts the xml to json as it reads it, without copying the input into a DOM.
+ *
+ * It reads the subset of xml found in the events (elements, attributes, text, comments and the xml declaration) and
+ * produces the same json as the conversion of the pugixml document. It rejects everything else (CDATA sections,
+ * DOCTYPE, encodings declared, text interleaved after child elements...) and malformed inputs, the caller falls back
+ * to pugixml for them.
+ */
+class XmlScanner
+{
+private:
+    std::string_view m_input;
+    std::size_t m_pos {0};
+    json::Json& m_doc;
+    const xmlModule& m_mod;
+    std::deque<std::string> m_decoded; ///< Decoded values, stable while the elements are written
 
-        bool isElementOfArray = false; // If the element is an array, the path should be adjusted
+    static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    static bool isNameStart(char c)
+    {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':'
+               || static_cast<unsigned char>(c) >= 0x80;
+    }
 
-        if (!processed)
+    static bool isName(char c) { return isNameStart(c) || (c >= '0' && c <= '9') || c == '-' || c == '.'; }
+
+    bool startsWith(std::string_view prefix) const { return m_input.substr(m_pos, prefix.size()) == prefix; }
+
+    void skipSpaces()
+    {
+        while (m_pos < m_input.size() && isSpace(m_input[m_pos]))
+        {
+            ++m_pos;
+        }
+    }
+
+    bool skipPast(std::string_view end)
+    {
+        const auto found = scan::find(m_input, end, m_pos);
+        if (found == std::string_view::npos)
+        {
+            return false;
+        }
+        m_pos = found + end.size();
+        return true;
+    }
+
+    std::optional<std::string_view> readName()
+    {
+        const auto start = m_pos;
+        if (m_pos >= m_input.size() || !isNameStart(m_input[m_pos]))
+        {
+            return std::nullopt;
+        }
+        while (m_pos < m_input.size() && isName(m_input[m_pos]))
+        {
+            ++m_pos;
+        }
+        return m_input.substr(start, m_pos - start);
+    }
+
+    /**
+     * @brief Decodes a character reference (&#...;) as pugixml does.
+     *
+     * @param raw Value as found in the input
+     * @param pos Position of the '&' of the reference
+     * @param out Decoded value
+     * @param unsupported Set if the reference is the null character, which pugixml does not keep
+     * @return std::size_t Characters of the reference, 0 if it is not a valid one and it is kept as is
+     */
+    static std::size_t decodeReference(std::string_view raw, std::size_t pos, std::string& out, bool& unsupported)
+    {
+        // raw[pos] is the '&' of "&#"
+        auto i = pos + 2;
+        const bool hex = i < raw.size() && raw[i] == 'x';
+        i += hex ? 1 : 0;
+        if (i >= raw.size() || raw[i] == ';')
         {
-            localPath += "/" + std::string {node.name()};
+            return 0;
+        }
 
-            // Check if the element already exists
-            if (docJson.exists(localPath))
+        uint32_t code = 0;
+        for (; i < raw.size() && raw[i] != ';'; ++i)
+        {
+            const auto c = static_cast<unsigned char>(raw[i]);
+            if (c >= '0' && c <= '9')
+            {
+                code = code * (hex ? 16 : 10) + (c - '0');
+            }
+            else if (hex && (c | ' ') >= 'a' && (c | ' ') <= 'f')
+            {
+                code = code * 16 + ((c | ' ') - 'a' + 10);
+            }
+            else
             {
-                isElementOfArray = true; // If exists, should be an array
-                if (docJson.isObject(localPath))
+                return 0;
+            }
+        }
+        if (i >= raw.size())
+        {
+            return 0;
+        }
+        if (code == 0)
+        {
+            // pugixml ends the string at the null character
+            unsupported = true;
+            return 0;
+        }
+
+        // UTF-8 encoding, as the pugixml writer
+        if (code < 0x80)
+        {
+            out += static_cast<char>(code);
+        }
+        else if (code < 0x800)
+        {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else if (code < 0x10000)
+        {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+        else
+        {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+
+        return i + 1 - pos;
+    }
+
+    /**
+     * @brief Decodes the references and line ends of a text or attribute value, as pugixml does by default.
+     *
+     * @param raw Value as found in the input
+     * @param attribute Attribute values also turn the whitespace characters into spaces
+     * @return std::optional<std::string_view> The value, a view of the input if nothing is decoded, nullopt if it has
+     * references not supported
+     */
+    std::optional<std::string_view> decode(std::string_view raw, bool attribute)
+    {
+        const std::string_view special = attribute ? "&\r\n\t" : "&\r";
+        auto next = raw.find_first_of(special);
+        if (next == std::string_view::npos)
+        {
+            return raw;
+        }
+
+        auto& out = m_decoded.emplace_back();
+        out.reserve(raw.size());
+        std::size_t done = 0;
+        for (; next != std::string_view::npos; next = raw.find_first_of(special, done))
+        {
+            out.append(raw.substr(done, next - done));
+            done = next + 1;
+
+            const auto c = raw[next];
+            if (c == '\r')
+            {
+                // "\r\n" and '\r' are line ends, attribute values turn them into a single space
+                out += attribute ? ' ' : '\n';
+                done += (done < raw.size() && raw[done] == '\n') ? 1 : 0;
+                continue;
+            }
+            if (c != '&')
+            {
+                out += ' ';
+                continue;
+            }
+
+            static constexpr std::pair<std::string_view, char> ENTITIES[] {
+                {"&amp;", '&'}, {"&apos;", '\''}, {"&gt;", '>'}, {"&lt;", '<'}, {"&quot;", '"'}};
+            const auto rest = raw.substr(next);
+            const auto entity = std::find_if(std::begin(ENTITIES),
+                                             std::end(ENTITIES),
+                                             [&rest](const auto& e)
+                                             { return rest.substr(0, e.first.size()) == e.first; });
+            if (entity != std::end(ENTITIES))
+            {
+                out += entity->second;
+                done = next + entity->first.size();
+            }
+            else if (rest.size() > 1 && rest[1] == '#')
+            {
+                bool unsupported = false;
+                const auto size = decodeReference(raw, next, out, unsupported);
+                if (unsupported)
                 {
-                    json::Json tmp = docJson.getJson(localPath).value();
-                    docJson.setArray(localPath);
-                    docJson.appendJson(tmp, localPath);
-                    localPath += "/1";
+                    return std::nullopt;
                 }
-                else if (docJson.isArray(localPath))
+                if (size == 0)
                 {
-                    size_t index = docJson.size(localPath);
-                    localPath += "/" + std::to_string(index);
+                    out += '&';
                 }
+                done = next + std::max<std::size_t>(size, 1);
             }
-
-            if (!node.text().empty())
+            else
             {
-                docJson.setString(node.text().as_string(), localPath + "/#text");
+                // Not a reference, kept as is
+                out += '&';
             }
+        }
+        out.append(raw.substr(done));
+
+        return out;
+    }
+
+    /**
+     * @brief Reads an element and its children, writing them to the json.
+     *
+     * @param path Path of the parent element
+     * @return true if the element was read
+     */
+    bool element(const std::string& path)
+    {
+        // m_input[m_pos] is the '<' of the start tag
+        ++m_pos;
+        XmlElement element;
+        const auto name = readName();
+        if (!name)
+        {
+            return false;
+        }
+        element.name = name.value();
 
-            for (auto attr : node.attributes())
+        // Attributes
+        bool empty = false;
+        while (true)
+        {
+            const auto spaces = m_pos;
+            skipSpaces();
+            if (m_pos >= m_input.size())
             {
-                docJson.setString(attr.value(), localPath + "/@" + attr.name());
+                return false;
             }
-
-            if (node.text().empty() && node.attributes().empty())
+            if (m_input[m_pos] == '>')
+            {
+                ++m_pos;
+                break;
+            }
+            if (startsWith("/>"))
             {
-                docJson.setObject(localPath);
+                m_pos += 2;
+                empty = true;
+                break;
             }
+            const auto attrName = readName();
+            if (spaces == m_pos || !attrName)
+            {
+                return false;
+            }
+            skipSpaces();
+            if (m_pos >= m_input.size() || m_input[m_pos] != '=')
+            {
+                return false;
+            }
+            ++m_pos;
+            skipSpaces();
+            if (m_pos >= m_input.size() || (m_input[m_pos] != '"' && m_input[m_pos] != '\''))
+            {
+                return false;
+            }
+            const auto quote = m_input[m_pos++];
+            const auto end = scan::find(m_input, quote, m_pos);
+            if (end == std::string_view::npos)
+            {
+                return false;
+            }
+            const auto value = decode(m_input.substr(m_pos, end - m_pos), true);
+            if (!value)
+            {
+                return false;
+            }
+            element.attributes.emplace_back(attrName.value(), value.value());
+            m_pos = end + 1;
         }
 
-        // Ajdust path if the element is an array
-        if (isElementOfArray)
+        if (empty)
         {
-            localPath = localPath.substr(0, localPath.find_last_of('/'));
+            writeElement(element, m_doc, m_mod, path);
+            return true;
         }
 
-        // Process children
-        if (!node.first_child().empty())
+        // Content, the element is written once its text is known, before its first child
+        std::optional<std::string> childrenPath;
+        while (true)
         {
-            xmlToJson(node, docJson, mod, localPath);
+            const auto tag = scan::find(m_input, '<', m_pos);
+            if (tag == std::string_view::npos)
+            {
+                return false;
+            }
+
+            const auto raw = m_input.substr(m_pos, tag - m_pos);
+            if (!element.hasText && std::any_of(raw.begin(), raw.end(), [](char c) { return !isSpace(c); }))
+            {
+                // The first text after a child is not supported
+                const auto text = decode(raw, false);
+                if (childrenPath || !text)
+                {
+                    return false;
+                }
+                element.hasText = true;
+                element.text = text.value();
+                element.firstValue = text.value();
+            }
+            m_pos = tag;
+
+            if (startsWith("</"))
+            {
+                m_pos += 2;
+                const auto endName = readName();
+                skipSpaces();
+                if (!endName || endName.value() != element.name || m_pos >= m_input.size() || m_input[m_pos] != '>')
+                {
+                    return false;
+                }
+                ++m_pos;
+                if (!childrenPath)
+                {
+                    writeElement(element, m_doc, m_mod, path);
+                }
+                return true;
+            }
+            if (startsWith("<!--"))
+            {
+                m_pos += 4;
+                if (!skipPast("-->"))
+                {
+                    return false;
+                }
+                continue;
+            }
+            if (startsWith("<!") || startsWith("<?"))
+            {
+                return false;
+            }
+
+            if (!childrenPath)
+            {
+                childrenPath = writeElement(element, m_doc, m_mod, path);
+            }
+            if (!this->element(childrenPath.value()))
+            {
+                return false;
+            }
         }
     }
-}
 
-Mapper getMapper(const json::Json& parsed, std::string_view targetField)
-{
-    return [parsed, targetField](json::Json& event)
+public:
+    XmlScanner(std::string_view input, json::Json& doc, const xmlModule& mod)
+        : m_input(input)
+        , m_doc(doc)
+        , m_mod(mod)
     {
-        event.set(targetField, parsed);
-    };
-}
+    }
 
-SemParser getSemParser(const std::string& targetField, xmlModule moduleFn)
-{
-    return [targetField, moduleFn](std::string_view parsed) -> std::variant<Mapper, base::Error>
+    /**
+     * @brief Reads the document.
+     *
+     * @return true if the document was converted, false if it is not supported or not valid
+     */
+    bool run()
     {
-        json::Json jParsed;
-        pugi::xml_document xmlDoc;
-        auto bufferInput = std::string(parsed);
-        auto parseResult = xmlDoc.load_buffer(bufferInput.data(), bufferInput.size());
+        // pugixml ends the document at a null character
+        if (scan::find(m_input, '\0') != std::string_view::npos)
+        {
+            return false;
+        }
 
-        if (parseResult.status != pugi::status_ok)
+        bool hasElement = false;
+        while (true)
         {
-            return base::Error {"Invalid XML"};
+            skipSpaces();
+            if (m_pos >= m_input.size())
+            {
+                return hasElement;
+            }
+
+            if (startsWith("<?"))
+            {
+                // Only the xml declaration, without encoding
+                m_pos += 2;
+                const auto start = m_pos;
+                if (!readName() || !skipPast("?>")
+                    || m_input.substr(start, m_pos - start).find("encoding") != std::string_view::npos)
+                {
+                    return false;
+                }
+            }
+            else if (startsWith("<!--"))
+            {
+                m_pos += 4;
+                if (!skipPast("-->"))
+                {
+                    return false;
+                }
+            }
+            else if (m_input[m_pos] == '<' && !startsWith("<!") && !startsWith("</"))
+            {
+                if (!element(""))
+                {
+                    return false;
+                }
+                hasElement = true;
+            }
+            else
+            {
+                return false;
+            }
         }
-        xmlToJson(xmlDoc, jParsed, moduleFn);
+    }
+};
 
-        if (targetField.empty())
+SemParser getSemParser(xmlModule moduleFn)
+{
+    return [moduleFn](std::string_view parsed, Value& value) -> std::optional<base::Error>
+    {
+        auto jParsed = std::make_shared<json::Json>();
+
+        // Read straight from the input, the DOM is only built for the documents the scanner does not support
+        if (!XmlScanner(parsed, *jParsed, moduleFn).run())
         {
-            return noMapper();
+            jParsed = std::make_shared<json::Json>();
+            pugi::xml_document xmlDoc;
+            auto bufferInput = std::string(parsed);
+            auto parseResult = xmlDoc.load_buffer(bufferInput.data(), bufferInput.size());
+
+            if (parseResult.status != pugi::status_ok)
+            {
+                return base::Error {"Invalid XML"};
+            }
+            xmlToJson(xmlDoc, *jParsed, moduleFn);
         }
 
-        return getMapper(jParsed, targetField);
+        value = std::shared_ptr<const json::Json>(std::move(jParsed));
+        return std::nullopt;
     };
 }
 
@@ -190,11 +648,10 @@ Parser getXMLParser(const Params& params)
     }
 
     xmlModule moduleFn = xmlModules[moduleName];
-    const auto target = params.targetField.empty() ? "" : params.targetField;
-    const auto semP = getSemParser(target, moduleFn);
+    const auto semantic = makeSemantic(params.targetField, getSemParser(moduleFn));
     const auto synP = syntax::parsers::toEnd(params.stop);
 
-    return [moduleFn, name = params.name, semP, synP](std::string_view txt)
+    return [moduleFn, name = params.name, semantic, synP](std::string_view txt)
     {
         auto synR = synP(txt);
         if (synR.failure())
@@ -204,7 +661,7 @@ Parser getXMLParser(const Params& params)
 
         const auto parsed = syntax::parsed(synR, txt);
 
-        return abs::makeSuccess<ResultT>(SemToken {parsed, semP}, synR.remaining());
+        return abs::makeSuccess<ResultT>(SemToken {parsed, semantic.get()}, synR.remaining());
     };
 }
 } // namespace hlp::parsers
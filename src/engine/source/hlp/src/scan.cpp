@@ -0,0 +1,391 @@
+#include "scan.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HLP_SCAN_X86
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define HLP_SCAN_NEON
+#endif
+
+namespace
+{
+constexpr auto NPOS = std::string_view::npos;
+
+using FirstOfFn = std::size_t (*)(const char*, std::size_t, char, char, char);
+using FindFn = std::size_t (*)(const char*, std::size_t, const char*, std::size_t);
+using FirstNotBase64Fn = std::size_t (*)(const char*, std::size_t);
+
+struct Kernels
+{
+    FirstOfFn firstOf;
+    FindFn find;
+    FirstNotBase64Fn firstNotBase64;
+};
+
+std::size_t firstOfScalar(const char* data, std::size_t size, char c0, char c1, char c2)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (data[i] == c0 || data[i] == c1 || data[i] == c2)
+        {
+            return i;
+        }
+    }
+
+    return NPOS;
+}
+
+// Continue the search of a kernel on the bytes left, that do not fill a vector
+std::size_t findTail(const char* data, std::size_t size, const char* needle, std::size_t needleSize, std::size_t i)
+{
+    auto pos = std::string_view(data + i, size - i).find(std::string_view(needle, needleSize));
+    return pos == NPOS ? NPOS : i + pos;
+}
+
+std::size_t findScalar(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+{
+    return findTail(data, size, needle, needleSize, 0);
+}
+
+inline bool isBase64(char c)
+{
+    // Setting the case bit maps the uppercase letters to the lowercase ones, and no other character to a letter
+    const auto lower = static_cast<char>(c | 0x20);
+    return (lower >= 'a' && lower <= 'z') || (c >= '/' && c <= '9') || c == '+';
+}
+
+std::size_t firstNotBase64Scalar(const char* data, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (!isBase64(data[i]))
+        {
+            return i;
+        }
+    }
+
+    return NPOS;
+}
+
+/*
+ * The base64 kernels classify the characters with the same ranges as isBase64: the letters after setting the case
+ * bit, '/' to '9', and '+'. The bytes above 0x7f are negative for the signed comparisons of x86, so they fail the
+ * ranges.
+ *
+ * The substring kernels compare the first and last characters of the needle against two blocks of the input, and only
+ * the candidates where both match are compared with memcmp.
+ */
+
+#ifdef HLP_SCAN_X86
+__attribute__((target("sse2"))) std::size_t firstOfSse2(const char* data, std::size_t size, char c0, char c1, char c2)
+{
+    const auto v0 = _mm_set1_epi8(c0);
+    const auto v1 = _mm_set1_epi8(c1);
+    const auto v2 = _mm_set1_epi8(c2);
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, v0), _mm_cmpeq_epi8(block, v1)),
+                                     _mm_cmpeq_epi8(block, v2));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    const auto pos = firstOfScalar(data + i, size - i, c0, c1, c2);
+    return pos == NPOS ? NPOS : i + pos;
+}
+
+__attribute__((target("sse2"))) std::size_t
+findSse2(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+{
+    const auto first = _mm_set1_epi8(needle[0]);
+    const auto last = _mm_set1_epi8(needle[needleSize - 1]);
+
+    std::size_t i = 0;
+    for (; i + needleSize - 1 + 16 <= size; i += 16)
+    {
+        const auto blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + needleSize - 1));
+        auto mask = static_cast<unsigned>(
+            _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, blockFirst), _mm_cmpeq_epi8(last, blockLast))));
+        while (mask != 0)
+        {
+            const auto bit = __builtin_ctz(mask);
+            if (std::memcmp(data + i + bit + 1, needle + 1, needleSize - 2) == 0)
+            {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return findTail(data, size, needle, needleSize, i);
+}
+
+__attribute__((target("sse2"))) std::size_t firstNotBase64Sse2(const char* data, std::size_t size)
+{
+    const auto caseBit = _mm_set1_epi8(0x20);
+    const auto beforeA = _mm_set1_epi8('a' - 1);
+    const auto afterZ = _mm_set1_epi8('z' + 1);
+    const auto beforeSlash = _mm_set1_epi8('/' - 1);
+    const auto afterNine = _mm_set1_epi8('9' + 1);
+    const auto plus = _mm_set1_epi8('+');
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const auto lower = _mm_or_si128(block, caseBit);
+        const auto letter = _mm_and_si128(_mm_cmpgt_epi8(lower, beforeA), _mm_cmpgt_epi8(afterZ, lower));
+        const auto digit = _mm_and_si128(_mm_cmpgt_epi8(block, beforeSlash), _mm_cmpgt_epi8(afterNine, block));
+        const auto valid = _mm_or_si128(_mm_or_si128(letter, digit), _mm_cmpeq_epi8(block, plus));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(valid)) ^ 0xFFFFU;
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    const auto pos = firstNotBase64Scalar(data + i, size - i);
+    return pos == NPOS ? NPOS : i + pos;
+}
+
+__attribute__((target("avx2"))) std::size_t firstOfAvx2(const char* data, std::size_t size, char c0, char c1, char c2)
+{
+    const auto v0 = _mm256_set1_epi8(c0);
+    const auto v1 = _mm256_set1_epi8(c1);
+    const auto v2 = _mm256_set1_epi8(c2);
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, v0), _mm256_cmpeq_epi8(block, v1)),
+                                        _mm256_cmpeq_epi8(block, v2));
+        const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    const auto pos = firstOfSse2(data + i, size - i, c0, c1, c2);
+    return pos == NPOS ? NPOS : i + pos;
+}
+
+__attribute__((target("avx2"))) std::size_t
+findAvx2(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+{
+    const auto first = _mm256_set1_epi8(needle[0]);
+    const auto last = _mm256_set1_epi8(needle[needleSize - 1]);
+
+    std::size_t i = 0;
+    for (; i + needleSize - 1 + 32 <= size; i += 32)
+    {
+        const auto blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + needleSize - 1));
+        auto mask = static_cast<unsigned>(_mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(first, blockFirst), _mm256_cmpeq_epi8(last, blockLast))));
+        while (mask != 0)
+        {
+            const auto bit = __builtin_ctz(mask);
+            if (std::memcmp(data + i + bit + 1, needle + 1, needleSize - 2) == 0)
+            {
+                return i + bit;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    return findTail(data, size, needle, needleSize, i);
+}
+__attribute__((target("avx2"))) std::size_t firstNotBase64Avx2(const char* data, std::size_t size)
+{
+    const auto caseBit = _mm256_set1_epi8(0x20);
+    const auto beforeA = _mm256_set1_epi8('a' - 1);
+    const auto afterZ = _mm256_set1_epi8('z' + 1);
+    const auto beforeSlash = _mm256_set1_epi8('/' - 1);
+    const auto afterNine = _mm256_set1_epi8('9' + 1);
+    const auto plus = _mm256_set1_epi8('+');
+
+    std::size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const auto block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const auto lower = _mm256_or_si256(block, caseBit);
+        const auto letter = _mm256_and_si256(_mm256_cmpgt_epi8(lower, beforeA), _mm256_cmpgt_epi8(afterZ, lower));
+        const auto digit =
+            _mm256_and_si256(_mm256_cmpgt_epi8(block, beforeSlash), _mm256_cmpgt_epi8(afterNine, block));
+        const auto valid = _mm256_or_si256(_mm256_or_si256(letter, digit), _mm256_cmpeq_epi8(block, plus));
+        const auto mask = ~static_cast<unsigned>(_mm256_movemask_epi8(valid));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+
+    const auto pos = firstNotBase64Sse2(data + i, size - i);
+    return pos == NPOS ? NPOS : i + pos;
+}
+#endif // HLP_SCAN_X86
+
+#ifdef HLP_SCAN_NEON
+// Narrow the comparison to 4 bits per byte, so it fits in a 64 bits mask
+inline uint64_t neonMask(uint8x16_t eq)
+{
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+}
+
+std::size_t firstOfNeon(const char* data, std::size_t size, char c0, char c1, char c2)
+{
+    const auto v0 = vdupq_n_u8(static_cast<uint8_t>(c0));
+    const auto v1 = vdupq_n_u8(static_cast<uint8_t>(c1));
+    const auto v2 = vdupq_n_u8(static_cast<uint8_t>(c2));
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        const auto eq = vorrq_u8(vorrq_u8(vceqq_u8(block, v0), vceqq_u8(block, v1)), vceqq_u8(block, v2));
+        const auto mask = neonMask(eq);
+        if (mask != 0)
+        {
+            return i + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    const auto pos = firstOfScalar(data + i, size - i, c0, c1, c2);
+    return pos == NPOS ? NPOS : i + pos;
+}
+
+std::size_t findNeon(const char* data, std::size_t size, const char* needle, std::size_t needleSize)
+{
+    const auto first = vdupq_n_u8(static_cast<uint8_t>(needle[0]));
+    const auto last = vdupq_n_u8(static_cast<uint8_t>(needle[needleSize - 1]));
+
+    std::size_t i = 0;
+    for (; i + needleSize - 1 + 16 <= size; i += 16)
+    {
+        const auto blockFirst = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        const auto blockLast = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i + needleSize - 1));
+        auto mask = neonMask(vandq_u8(vceqq_u8(first, blockFirst), vceqq_u8(last, blockLast)));
+        while (mask != 0)
+        {
+            const auto bit = __builtin_ctzll(mask) >> 2;
+            if (std::memcmp(data + i + bit + 1, needle + 1, needleSize - 2) == 0)
+            {
+                return i + bit;
+            }
+            mask &= ~(0xFULL << (bit * 4));
+        }
+    }
+
+    return findTail(data, size, needle, needleSize, i);
+}
+std::size_t firstNotBase64Neon(const char* data, std::size_t size)
+{
+    const auto caseBit = vdupq_n_u8(0x20);
+    const auto a = vdupq_n_u8('a');
+    const auto z = vdupq_n_u8('z');
+    const auto slash = vdupq_n_u8('/');
+    const auto nine = vdupq_n_u8('9');
+    const auto plus = vdupq_n_u8('+');
+
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16)
+    {
+        const auto block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        const auto lower = vorrq_u8(block, caseBit);
+        const auto letter = vandq_u8(vcgeq_u8(lower, a), vcleq_u8(lower, z));
+        const auto digit = vandq_u8(vcgeq_u8(block, slash), vcleq_u8(block, nine));
+        const auto mask = neonMask(vmvnq_u8(vorrq_u8(vorrq_u8(letter, digit), vceqq_u8(block, plus))));
+        if (mask != 0)
+        {
+            return i + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+
+    const auto pos = firstNotBase64Scalar(data + i, size - i);
+    return pos == NPOS ? NPOS : i + pos;
+}
+#endif // HLP_SCAN_NEON
+
+const Kernels& kernels()
+{
+    static const Kernels selected = []() -> Kernels
+    {
+#if defined(HLP_SCAN_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return {firstOfAvx2, findAvx2, firstNotBase64Avx2};
+        }
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return {firstOfSse2, findSse2, firstNotBase64Sse2};
+        }
+#elif defined(HLP_SCAN_NEON)
+        return {firstOfNeon, findNeon, firstNotBase64Neon};
+#endif
+        return {firstOfScalar, findScalar, firstNotBase64Scalar};
+    }();
+
+    return selected;
+}
+} // namespace
+
+namespace hlp::scan
+{
+
+std::size_t findFirstOf(std::string_view input, char c0, char c1, char c2, std::size_t pos)
+{
+    if (pos >= input.size())
+    {
+        return NPOS;
+    }
+
+    const auto found = kernels().firstOf(input.data() + pos, input.size() - pos, c0, c1, c2);
+    return found == NPOS ? NPOS : pos + found;
+}
+
+std::size_t find(std::string_view input, std::string_view needle, std::size_t pos)
+{
+    if (needle.empty())
+    {
+        return pos <= input.size() ? pos : NPOS;
+    }
+
+    if (pos >= input.size() || needle.size() > input.size() - pos)
+    {
+        return NPOS;
+    }
+
+    if (needle.size() == 1)
+    {
+        return findFirstOf(input, needle[0], needle[0], needle[0], pos);
+    }
+
+    const auto found = kernels().find(input.data() + pos, input.size() - pos, needle.data(), needle.size());
+    return found == NPOS ? NPOS : pos + found;
+}
+
+std::size_t findFirstNotBase64(std::string_view input, std::size_t pos)
+{
+    if (pos >= input.size())
+    {
+        return NPOS;
+    }
+
+    const auto found = kernels().firstNotBase64(input.data() + pos, input.size() - pos);
+    return found == NPOS ? NPOS : pos + found;
+}
+
+} // namespace hlp::scan
@@ -0,0 +1,63 @@
+#ifndef _HLP_SCAN_HPP
+#define _HLP_SCAN_HPP
+
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Vectorized search kernels shared by the parsers that scan the input for delimiters, end tokens and encoded
+ * content.
+ *
+ * The kernel is selected at runtime, once, from the instructions supported by the CPU (AVX2 or SSE2 on x86, NEON on
+ * aarch64), with a scalar fallback. All functions follow the std::string_view::find semantics.
+ */
+namespace hlp::scan
+{
+
+/**
+ * @brief Find the first occurrence of any of the three characters, starting at pos.
+ *
+ * @param input Input to search
+ * @param c0 First character
+ * @param c1 Second character
+ * @param c2 Third character
+ * @param pos Position to start the search
+ * @return std::size_t Position of the character found or std::string_view::npos
+ */
+std::size_t findFirstOf(std::string_view input, char c0, char c1, char c2, std::size_t pos = 0);
+
+/**
+ * @brief Find the first occurrence of the character, starting at pos.
+ *
+ * @param input Input to search
+ * @param c Character to find
+ * @param pos Position to start the search
+ * @return std::size_t Position of the character found or std::string_view::npos
+ */
+inline std::size_t find(std::string_view input, char c, std::size_t pos = 0)
+{
+    return findFirstOf(input, c, c, c, pos);
+}
+
+/**
+ * @brief Find the first occurrence of the needle, starting at pos.
+ *
+ * @param input Input to search
+ * @param needle Substring to find
+ * @param pos Position to start the search
+ * @return std::size_t Position of the needle found or std::string_view::npos
+ */
+std::size_t find(std::string_view input, std::string_view needle, std::size_t pos = 0);
+
+/**
+ * @brief Find the first character that is not in the base64 alphabet (A-Z, a-z, 0-9, + and /), starting at pos.
+ *
+ * @param input Input to search
+ * @param pos Position to start the search
+ * @return std::size_t Position of the character found or std::string_view::npos
+ */
+std::size_t findFirstNotBase64(std::string_view input, std::size_t pos = 0);
+
+} // namespace hlp::scan
+
+#endif // _HLP_SCAN_HPP
@@ -5,6 +5,7 @@
 #include <stdexcept>
 
 #include "abstractParser.hpp"
+#include "scan.hpp"
 
 /**
  * @brief Contains the Parser and Result types for the syntax parsers
@@ -253,7 +254,7 @@ inline Parser toEnd(char endToken)
 {
     return [endToken](std::string_view input) -> Result
     {
-        const auto pos = input.find(endToken);
+        const auto pos = scan::find(input, endToken);
         if (pos == std::string_view::npos || pos == 0)
         {
             return abs::makeFailure<ResultT>(input, {});
@@ -274,7 +275,7 @@ inline Parser toEnd(const std::string& endToken)
 {
     return [endToken](std::string_view input) -> Result
     {
-        const auto pos = input.find(endToken);
+        const auto pos = scan::find(input, endToken);
         if (pos == std::string_view::npos || pos == 0)
         {
             return abs::makeFailure<ResultT>(input, {});
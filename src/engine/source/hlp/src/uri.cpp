@@ -0,0 +1,330 @@
+#include "uri.hpp"
+
+#include <cstddef>
+
+namespace hlp::uri
+{
+namespace
+{
+
+constexpr auto PORT_MAX = 65535;
+
+bool isPrintable(char c)
+{
+    return c > ' ' && c < '\x7f';
+}
+
+bool isUnreserved(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '-' || c == '.'
+           || c == '_' || c == '~';
+}
+
+bool isSubDelim(char c)
+{
+    switch (c)
+    {
+        case '!':
+        case '$':
+        case '&':
+        case '\'':
+        case '(':
+        case ')':
+        case '*':
+        case '+':
+        case ',':
+        case ';':
+        case '=': return true;
+        default: return false;
+    }
+}
+
+bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * @brief Whether libcurl would read the host as an IPv4 address, which it rewrites unless it is a plain dotted quad.
+ *
+ * libcurl takes as an address any host whose labels are all numbers, decimal, octal or hexadecimal.
+ */
+bool isNumericHost(std::string_view host)
+{
+    std::size_t start = 0;
+    while (true)
+    {
+        auto end = host.find('.', start);
+        auto label = host.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+        if (label.empty())
+        {
+            // A trailing dot may end an address
+            if (end != std::string_view::npos || start == 0)
+            {
+                return false;
+            }
+        }
+        else if (label.size() > 1 && label[0] == '0' && (label[1] == 'x' || label[1] == 'X'))
+        {
+            for (auto i = 2u; i < label.size(); ++i)
+            {
+                const auto c = label[i];
+                if (!isDigit(c) && !(c >= 'a' && c <= 'f') && !(c >= 'A' && c <= 'F'))
+                {
+                    return false;
+                }
+            }
+        }
+        else
+        {
+            for (const auto c : label)
+            {
+                if (!isDigit(c))
+                {
+                    return false;
+                }
+            }
+        }
+
+        if (end == std::string_view::npos)
+        {
+            return true;
+        }
+        start = end + 1;
+    }
+}
+
+/**
+ * @brief Whether the host is an address libcurl keeps as it is: four decimal octets, without leading zeros.
+ */
+bool isDottedQuad(std::string_view host)
+{
+    auto octets = 0;
+    std::size_t pos = 0;
+    while (pos <= host.size())
+    {
+        auto end = host.find('.', pos);
+        if (end == std::string_view::npos)
+        {
+            end = host.size();
+        }
+        const auto octet = host.substr(pos, end - pos);
+        if (octet.empty() || octet.size() > 3 || (octet.size() > 1 && octet[0] == '0'))
+        {
+            return false;
+        }
+        auto value = 0;
+        for (const auto c : octet)
+        {
+            value = value * 10 + (c - '0');
+        }
+        if (value > 255 || ++octets > 4)
+        {
+            return false;
+        }
+        pos = end + 1;
+    }
+
+    return octets == 4;
+}
+
+bool scanUserinfo(std::string_view userinfo, Parts& parts)
+{
+    const auto colon = userinfo.find(':');
+    const auto username = userinfo.substr(0, colon);
+    if (username.empty())
+    {
+        return false;
+    }
+
+    for (const auto c : userinfo)
+    {
+        if (!isUnreserved(c) && !isSubDelim(c) && c != ':')
+        {
+            return false;
+        }
+    }
+
+    parts.username = username;
+    if (colon != std::string_view::npos)
+    {
+        parts.password = userinfo.substr(colon + 1);
+    }
+
+    return true;
+}
+
+bool scanHost(std::string_view host, Parts& parts)
+{
+    if (host.empty())
+    {
+        return false;
+    }
+
+    for (const auto c : host)
+    {
+        if (!isUnreserved(c) || c == '~')
+        {
+            return false;
+        }
+    }
+
+    if (isNumericHost(host) && !isDottedQuad(host))
+    {
+        return false;
+    }
+
+    parts.host = host;
+    return true;
+}
+
+bool scanPort(std::string_view port, Parts& parts)
+{
+    // libcurl drops the empty ports and the leading zeros
+    if (port.empty() || port.size() > 5 || port[0] == '0')
+    {
+        return false;
+    }
+
+    auto value = 0;
+    for (const auto c : port)
+    {
+        if (!isDigit(c))
+        {
+            return false;
+        }
+        value = value * 10 + (c - '0');
+    }
+
+    if (value > PORT_MAX)
+    {
+        return false;
+    }
+
+    parts.port = port;
+    return true;
+}
+
+/**
+ * @brief Whether the path has a "." or ".." segment, which libcurl removes, or an encoded dot it may remove.
+ */
+bool hasDotSegment(std::string_view path)
+{
+    for (auto pos = path.find('%'); pos != std::string_view::npos; pos = path.find('%', pos + 1))
+    {
+        if (path.substr(pos + 1, 2) == "2e" || path.substr(pos + 1, 2) == "2E")
+        {
+            return true;
+        }
+    }
+
+    for (auto pos = path.find("/."); pos != std::string_view::npos; pos = path.find("/.", pos + 1))
+    {
+        auto next = pos + 2;
+        if (next < path.size() && path[next] == '.')
+        {
+            ++next;
+        }
+        if (next == path.size() || path[next] == '/')
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace
+
+std::optional<Parts> scan(std::string_view url)
+{
+    Parts parts;
+
+    // Scheme, libcurl lowercases it and only the web ones are kept as they are
+    std::size_t pos;
+    if (url.substr(0, 7) == "http://")
+    {
+        pos = 7;
+    }
+    else if (url.substr(0, 8) == "https://")
+    {
+        pos = 8;
+    }
+    else
+    {
+        return std::nullopt;
+    }
+    parts.scheme = url.substr(0, pos - 3);
+
+    // Everything else is printable ASCII, libcurl rejects the controls and spaces and keeps the rest
+    for (auto i = pos; i < url.size(); ++i)
+    {
+        if (!isPrintable(url[i]))
+        {
+            return std::nullopt;
+        }
+    }
+
+    // Authority, up to the path. Without a path libcurl adds one to the URL, which is then not a view of the input
+    const auto pathStart = url.find_first_of("/?#", pos);
+    if (pathStart == std::string_view::npos || url[pathStart] != '/')
+    {
+        return std::nullopt;
+    }
+    auto authority = url.substr(pos, pathStart - pos);
+
+    const auto at = authority.find('@');
+    if (at != std::string_view::npos)
+    {
+        if (authority.find('@', at + 1) != std::string_view::npos || !scanUserinfo(authority.substr(0, at), parts))
+        {
+            return std::nullopt;
+        }
+        authority.remove_prefix(at + 1);
+    }
+
+    const auto colon = authority.find(':');
+    if (!scanHost(authority.substr(0, colon), parts))
+    {
+        return std::nullopt;
+    }
+    if (colon != std::string_view::npos && !scanPort(authority.substr(colon + 1), parts))
+    {
+        return std::nullopt;
+    }
+
+    // Path, query and fragment. libcurl drops the empty query and fragment from the URL
+    const auto fragmentStart = url.find('#', pathStart);
+    const auto queryStart = url.substr(0, fragmentStart).find('?', pathStart);
+    const auto pathEnd = queryStart != std::string_view::npos ? queryStart : fragmentStart;
+
+    parts.path =
+        url.substr(pathStart, pathEnd == std::string_view::npos ? std::string_view::npos : pathEnd - pathStart);
+    if (hasDotSegment(parts.path))
+    {
+        return std::nullopt;
+    }
+
+    if (queryStart != std::string_view::npos)
+    {
+        const auto queryEnd = fragmentStart == std::string_view::npos ? url.size() : fragmentStart;
+        parts.query = url.substr(queryStart + 1, queryEnd - queryStart - 1);
+        if (parts.query->empty())
+        {
+            return std::nullopt;
+        }
+    }
+
+    if (fragmentStart != std::string_view::npos)
+    {
+        parts.fragment = url.substr(fragmentStart + 1);
+        if (parts.fragment->empty())
+        {
+            return std::nullopt;
+        }
+    }
+
+    return parts;
+}
+
+} // namespace hlp::uri
@@ -0,0 +1,43 @@
+#ifndef _HLP_URI_HPP
+#define _HLP_URI_HPP
+
+#include <optional>
+#include <string_view>
+
+/**
+ * @brief Single pass scanner of the http and https URLs found in web logs, reading the components as views of the
+ * input, without copies.
+ *
+ * It only accepts the URLs libcurl keeps as they are (lowercase scheme, explicit path, no dot segments, no numeric
+ * hosts other than plain dotted quads, printable ASCII only...), so its components are the ones libcurl would return.
+ * When it rejects an input, the caller is expected to fall back to libcurl, which settles it.
+ */
+namespace hlp::uri
+{
+
+/**
+ * @brief Components of a URL, views of the scanned text. The optional ones are empty when they are not in the URL.
+ */
+struct Parts
+{
+    std::string_view scheme;                  ///< Scheme, without "://"
+    std::optional<std::string_view> username; ///< User of the userinfo
+    std::optional<std::string_view> password; ///< Password of the userinfo, only if it has a ':'
+    std::string_view host;                    ///< Host
+    std::optional<std::string_view> port;     ///< Port, without ':'
+    std::string_view path;                    ///< Path, starting with '/'
+    std::optional<std::string_view> query;    ///< Query, without '?'
+    std::optional<std::string_view> fragment; ///< Fragment, without '#'
+};
+
+/**
+ * @brief Scans a whole URL.
+ *
+ * @param url URL to scan.
+ * @return std::optional<Parts> The components of the URL, or nullopt if it is not in the accepted subset.
+ */
+std::optional<Parts> scan(std::string_view url);
+
+} // namespace hlp::uri
+
+#endif // _HLP_URI_HPP
@@ -0,0 +1,192 @@
+#include "useragent.hpp"
+
+#include <array>
+#include <utility>
+
+namespace hlp::useragent
+{
+namespace
+{
+
+/**
+ * @brief Agent named by a product token, the first rule whose token is found wins.
+ */
+struct AgentRule
+{
+    std::string_view token;        ///< Product token, the version follows it
+    std::string_view name;         ///< Name of the agent
+    std::string_view versionToken; ///< Token the version follows instead, if not empty
+    std::string_view device;       ///< Device implied by the agent, if not empty
+};
+
+// The specific agents go first, the browsers built on Chrome or Safari also carry their tokens
+constexpr std::array<AgentRule, 27> AGENTS {{
+    {"Googlebot/", "Googlebot", "", "Spider"},
+    {"bingbot/", "bingbot", "", "Spider"},
+    {"YandexBot/", "YandexBot", "", "Spider"},
+    {"DuckDuckBot/", "DuckDuckBot", "", "Spider"},
+    {"Baiduspider/", "Baiduspider", "", "Spider"},
+    {"curl/", "curl", "", ""},
+    {"Wget/", "Wget", "", ""},
+    {"python-requests/", "Python Requests", "", ""},
+    {"Go-http-client/", "Go-http-client", "", ""},
+    {"okhttp/", "okhttp", "", ""},
+    {"PostmanRuntime/", "PostmanRuntime", "", ""},
+    {"Edg/", "Edge", "", ""},
+    {"EdgA/", "Edge Mobile", "", ""},
+    {"EdgiOS/", "Edge Mobile", "", ""},
+    {"Edge/", "Edge", "", ""},
+    {"OPR/", "Opera", "", ""},
+    {"SamsungBrowser/", "Samsung Internet", "", ""},
+    {"YaBrowser/", "Yandex Browser", "", ""},
+    {"Vivaldi/", "Vivaldi", "", ""},
+    {"FxiOS/", "Firefox iOS", "", ""},
+    {"CriOS/", "Chrome Mobile iOS", "", ""},
+    {"Firefox/", "Firefox", "", ""},
+    {"Chrome/", "Chrome", "", ""},
+    {"MSIE ", "IE", "", ""},
+    {"Trident/", "IE", "rv:", ""},
+    {"Safari/", "Safari", "Version/", ""},
+    {"Opera/", "Opera", "Version/", ""},
+}};
+
+/**
+ * @brief Operating system named by a token, the first rule whose token is found wins.
+ */
+struct OsRule
+{
+    std::string_view token; ///< Token, the version follows it
+    std::string_view name;  ///< Name of the operating system
+};
+
+// iOS before Mac OS X, its user agents say "like Mac OS X"
+constexpr std::array<OsRule, 7> SYSTEMS {{
+    {"Windows NT ", "Windows"},
+    {"iPhone OS ", "iOS"},
+    {"CPU OS ", "iOS"},
+    {"Android ", "Android"},
+    {"Mac OS X ", "Mac OS X"},
+    {"CrOS ", "Chrome OS"},
+    {"Linux", "Linux"},
+}};
+
+// Releases of the Windows NT versions
+constexpr std::array<std::pair<std::string_view, std::string_view>, 7> WINDOWS_RELEASES {{
+    {"10.0", "10"},
+    {"6.3", "8.1"},
+    {"6.2", "8"},
+    {"6.1", "7"},
+    {"6.0", "Vista"},
+    {"5.2", "XP"},
+    {"5.1", "XP"},
+}};
+
+constexpr std::array<std::pair<std::string_view, std::string_view>, 4> DEVICES {{
+    {"iPhone", "iPhone"},
+    {"iPad", "iPad"},
+    {"iPod", "iPod"},
+    {"Macintosh", "Mac"},
+}};
+
+/**
+ * @brief Reads the version at the start of the text: digits and dots, and underscores read as dots.
+ */
+std::string readVersion(std::string_view text)
+{
+    std::string version;
+    for (const auto c : text)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            version.push_back(c);
+        }
+        else if ((c == '.' || c == '_') && !version.empty())
+        {
+            version.push_back('.');
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    while (!version.empty() && version.back() == '.')
+    {
+        version.pop_back();
+    }
+
+    return version;
+}
+
+/**
+ * @brief Reads the version that follows the token, if it is found.
+ */
+std::string versionAfter(std::string_view userAgent, std::string_view token)
+{
+    const auto pos = userAgent.find(token);
+    return pos == std::string_view::npos ? std::string {} : readVersion(userAgent.substr(pos + token.size()));
+}
+
+} // namespace
+
+Details extract(std::string_view userAgent)
+{
+    Details details;
+
+    for (const auto& rule : AGENTS)
+    {
+        const auto pos = userAgent.find(rule.token);
+        if (pos == std::string_view::npos)
+        {
+            continue;
+        }
+
+        details.name = rule.name;
+        details.version = rule.versionToken.empty() ? readVersion(userAgent.substr(pos + rule.token.size()))
+                                                    : versionAfter(userAgent, rule.versionToken);
+        details.deviceName = rule.device;
+        break;
+    }
+
+    for (const auto& rule : SYSTEMS)
+    {
+        const auto pos = userAgent.find(rule.token);
+        if (pos == std::string_view::npos)
+        {
+            continue;
+        }
+
+        details.osName = rule.name;
+        details.osVersion = readVersion(userAgent.substr(pos + rule.token.size()));
+        if (rule.name == "Windows")
+        {
+            for (const auto& [version, release] : WINDOWS_RELEASES)
+            {
+                if (details.osVersion == version)
+                {
+                    details.osVersion = release;
+                    break;
+                }
+            }
+        }
+
+        details.osFull = details.osVersion.empty() ? details.osName : details.osName + " " + details.osVersion;
+        break;
+    }
+
+    if (details.deviceName.empty())
+    {
+        for (const auto& [token, device] : DEVICES)
+        {
+            if (userAgent.find(token) != std::string_view::npos)
+            {
+                details.deviceName = device;
+                break;
+            }
+        }
+    }
+
+    return details;
+}
+
+} // namespace hlp::useragent
@@ -0,0 +1,40 @@
+#ifndef _HLP_USERAGENT_HPP
+#define _HLP_USERAGENT_HPP
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Extraction of the agent, operating system and device of a user agent string.
+ *
+ * The rules are tables of the product tokens of the common browsers, tools, crawlers and operating systems, tried in
+ * order and built once for the whole process. They cover the user agents found in web logs, not the full ua-parser
+ * database: an unknown agent only gets the fields its tokens reveal.
+ */
+namespace hlp::useragent
+{
+
+/**
+ * @brief Details of a user agent, the fields not found are empty.
+ */
+struct Details
+{
+    std::string name;       ///< Name of the agent (browser, tool or crawler)
+    std::string version;    ///< Version of the agent
+    std::string osName;     ///< Name of the operating system
+    std::string osVersion;  ///< Version of the operating system
+    std::string osFull;     ///< Name and version of the operating system
+    std::string deviceName; ///< Name of the device
+};
+
+/**
+ * @brief Extracts the details of a user agent.
+ *
+ * @param userAgent User agent string.
+ * @return Details Details found.
+ */
+Details extract(std::string_view userAgent);
+
+} // namespace hlp::useragent
+
+#endif // _HLP_USERAGENT_HPP
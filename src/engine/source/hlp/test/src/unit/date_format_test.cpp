@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "date_format.hpp"
+
+using namespace hlp::datefmt;
+using namespace std::chrono_literals;
+
+namespace
+{
+Fields parseOk(std::string_view format, std::string_view text)
+{
+    const auto compiled = Format::compile(format, "en_US.UTF-8");
+    EXPECT_TRUE(compiled.has_value()) << format;
+    const auto fields = compiled->parse(text);
+    EXPECT_TRUE(fields.has_value()) << text;
+    return fields.value_or(Fields {});
+}
+} // namespace
+
+TEST(DateFormatTest, CompileCommonFormats)
+{
+    for (const auto* format : {"%b %d %T",
+                               "%b %d %R:%6S %Z",
+                               "%FT%T%Ez",
+                               "%FT%TZ",
+                               "%FT%TZ%Ez",
+                               "%d/%b/%Y:%T %z",
+                               "%Y/%m/%d %T",
+                               "%a, %d %b %Y %T %Z",
+                               "%A, %d-%b-%y %T %Z"})
+    {
+        EXPECT_TRUE(Format::compile(format, "en_US.UTF-8").has_value()) << format;
+    }
+}
+
+TEST(DateFormatTest, CompileUnsupported)
+{
+    // Directives not compiled, dates without month or day and non English locales
+    EXPECT_FALSE(Format::compile("%D %T", "en_US.UTF-8").has_value());
+    EXPECT_FALSE(Format::compile("%FT%T%Oj", "en_US.UTF-8").has_value());
+    EXPECT_FALSE(Format::compile("%Y %T", "en_US.UTF-8").has_value());
+    EXPECT_FALSE(Format::compile("%FT%T %", "en_US.UTF-8").has_value());
+    EXPECT_FALSE(Format::compile("%b %d %T", "fr_FR.UTF-8").has_value());
+}
+
+TEST(DateFormatTest, ParseIso8601)
+{
+    const auto fields = parseOk("%FT%T%Ez", "2018-08-14T14:30:02.203151+02:00 rest");
+    EXPECT_TRUE(fields.hasYear);
+    EXPECT_EQ(fields.year, 2018);
+    EXPECT_EQ(fields.month, 8U);
+    EXPECT_EQ(fields.day, 14U);
+    EXPECT_EQ(fields.timeOfDay, 14h + 30min + 2s + 203151us);
+    EXPECT_EQ(fields.offset, 2h);
+    EXPECT_EQ(fields.size, 32U);
+}
+
+TEST(DateFormatTest, ParseOffsets)
+{
+    EXPECT_EQ(parseOk("%FT%TZ%Ez", "2016-12-26T16:16:55Z07:00").offset, 7h);
+    EXPECT_EQ(parseOk("%d/%b/%Y:%T %z", "26/Dec/2016:16:22:14 -0730").offset, -(7h + 30min));
+    EXPECT_EQ(parseOk("%d/%b/%Y:%T %z", "26/Dec/2016:16:22:14 +00").offset, 0min);
+    EXPECT_FALSE(Format::compile("%d/%b/%Y:%T %z", "C")->parse("26/Dec/2016:16:22:14 MST").has_value());
+}
+
+TEST(DateFormatTest, ParseSyslog)
+{
+    auto fields = parseOk("%b %d %R:%6S %Z", "Mar  1 18:48:50.483 UTC");
+    EXPECT_FALSE(fields.hasYear);
+    EXPECT_EQ(fields.month, 3U);
+    EXPECT_EQ(fields.day, 1U);
+    EXPECT_EQ(fields.timeOfDay, 18h + 48min + 50s + 483ms);
+    EXPECT_EQ(fields.abbrev, "UTC");
+
+    fields = parseOk("%B %d %T", "June 14 15:16:01");
+    EXPECT_EQ(fields.month, 6U);
+    EXPECT_EQ(fields.size, 16U);
+}
+
+TEST(DateFormatTest, ParseNames)
+{
+    const auto format = Format::compile("%a %b %d %T %Y", "C");
+    ASSERT_TRUE(format.has_value());
+    EXPECT_TRUE(format->parse("Mon Dec 26 16:15:55 2016").has_value());
+    EXPECT_TRUE(format->parse("Monday December 26 16:15:55 2016").has_value());
+    // Weekday not matching the date
+    EXPECT_FALSE(format->parse("Tue Dec 26 16:15:55 2016").has_value());
+    // The text goes on matching a longer name
+    EXPECT_FALSE(format->parse("Mon Decem 26 16:15:55 2016").has_value());
+    EXPECT_FALSE(format->parse("mon dec 26 16:15:55 2016").has_value());
+}
+
+TEST(DateFormatTest, ParseInvalid)
+{
+    const auto format = Format::compile("%F %T", "C");
+    ASSERT_TRUE(format.has_value());
+    EXPECT_FALSE(format->parse("2019-13-12 00:00:00").has_value());
+    EXPECT_FALSE(format->parse("2019-02-29 00:00:00").has_value());
+    EXPECT_FALSE(format->parse("2019-12-12 24:00:00").has_value());
+    EXPECT_FALSE(format->parse("2019-12-12 00:00:0.1234567891").has_value());
+    EXPECT_FALSE(format->parse("ABC2019-12-12 00:00:00").has_value());
+    EXPECT_TRUE(format->parse("2020-02-29 00:00:00").has_value());
+}
@@ -45,12 +45,11 @@ void parseTest(
     {
         ASSERT_TRUE(result.success()) << result.trace() << "failed at: '" << result.remaining() << "'";
         ASSERT_TRUE(result.hasValue());
-        auto mapper = result.value().semParser(result.value().parsed);
-        ASSERT_TRUE(std::holds_alternative<hlp::parser::Mapper>(mapper))
-            << "SemParser failed: " << std::get<base::Error>(mapper).message;
+        auto error = hlp::parser::semParse(result.value());
+        ASSERT_FALSE(error) << "SemParser failed: " << error.value().message;
         auto event = json::Json {};
         event.setObject();
-        std::get<hlp::parser::Mapper>(mapper)(event);
+        hlp::parser::map(result.value(), event);
         ASSERT_EQ(event, expected);
     }
     else
@@ -58,8 +57,7 @@ void parseTest(
         if (result.success())
         {
             ASSERT_TRUE(result.hasValue());
-            auto mapper = result.value().semParser(result.value().parsed);
-            ASSERT_TRUE(std::holds_alternative<base::Error>(mapper)) << "Parser succeeded";
+            ASSERT_TRUE(hlp::parser::semParse(result.value())) << "Parser succeeded";
         }
     }
 
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <random>
+#include <string>
+#include <string_view>
+
+#include "scan.hpp"
+
+namespace
+{
+// Small alphabet so the characters and needles are found often, lengths cover the vector tails
+std::string randomString(std::mt19937& gen, std::size_t maxSize)
+{
+    static constexpr std::string_view ALPHABET {"ab,\"\\|"};
+    std::string str(gen() % (maxSize + 1), ' ');
+    for (auto& c : str)
+    {
+        c = ALPHABET[gen() % ALPHABET.size()];
+    }
+    return str;
+}
+} // namespace
+
+TEST(ScanTest, FindFirstOf)
+{
+    std::mt19937 gen {42};
+    for (auto i = 0; i < 20000; ++i)
+    {
+        const auto input = randomString(gen, 100);
+        const auto pos = gen() % (input.size() + 2);
+        ASSERT_EQ(hlp::scan::findFirstOf(input, ',', '"', '\\', pos),
+                  std::string_view(input).find_first_of(",\"\\", pos))
+            << "Input: '" << input << "', pos: " << pos;
+        ASSERT_EQ(hlp::scan::find(input, '|', pos), std::string_view(input).find('|', pos))
+            << "Input: '" << input << "', pos: " << pos;
+    }
+}
+
+TEST(ScanTest, Find)
+{
+    std::mt19937 gen {42};
+    for (auto i = 0; i < 20000; ++i)
+    {
+        const auto input = randomString(gen, 100);
+        const auto needle = randomString(gen, 4);
+        const auto pos = gen() % (input.size() + 2);
+        ASSERT_EQ(hlp::scan::find(input, needle, pos), std::string_view(input).find(needle, pos))
+            << "Input: '" << input << "', needle: '" << needle << "', pos: " << pos;
+    }
+}
+
+TEST(ScanTest, FindLongInput)
+{
+    std::string input(4096, 'a');
+    input += "end";
+    ASSERT_EQ(hlp::scan::find(input, "end"), 4096);
+    ASSERT_EQ(hlp::scan::find(input, 'e'), 4096);
+    ASSERT_EQ(hlp::scan::find(input, "ends"), std::string_view::npos);
+    ASSERT_EQ(hlp::scan::findFirstOf(input, 'x', 'y', 'd'), 4098);
+}
+
+TEST(ScanTest, FindFirstNotBase64)
+{
+    // Every byte against the scalar definition, at each lane of the vectors
+    const auto isBase64 = [](unsigned char c)
+    {
+        return std::isalnum(c) || c == '+' || c == '/';
+    };
+    for (auto c = 0; c < 256; ++c)
+    {
+        for (std::size_t at : {0, 15, 31, 40})
+        {
+            std::string input(64, 'A');
+            input[at] = static_cast<char>(c);
+            const auto expected = isBase64(static_cast<unsigned char>(c)) ? std::string_view::npos : at;
+            ASSERT_EQ(hlp::scan::findFirstNotBase64(input), expected) << "Byte: " << c << ", at: " << at;
+        }
+    }
+
+    std::mt19937 gen {42};
+    static constexpr std::string_view ALPHABET {"aZ09+/=\n"};
+    for (auto i = 0; i < 20000; ++i)
+    {
+        std::string input(gen() % 101, ' ');
+        for (auto& c : input)
+        {
+            // Mostly base64 characters, so the spans are long
+            c = ALPHABET[gen() % 16 < 15 ? gen() % 6 : 6 + gen() % 2];
+        }
+        const auto pos = gen() % (input.size() + 2);
+        ASSERT_EQ(hlp::scan::findFirstNotBase64(input, pos), std::string_view(input).find_first_of("=\n", pos))
+            << "Input: '" << input << "', pos: " << pos;
+    }
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "useragent.hpp"
+
+using namespace hlp::useragent;
+
+TEST(UserAgentTest, Browsers)
+{
+    auto details = extract("Mozilla/5.0 (Windows NT 6.1; Win64; x64; rv:47.0) Gecko/20100101 Firefox/47.0");
+    EXPECT_EQ(details.name, "Firefox");
+    EXPECT_EQ(details.version, "47.0");
+    EXPECT_EQ(details.osName, "Windows");
+    EXPECT_EQ(details.osVersion, "7");
+    EXPECT_EQ(details.osFull, "Windows 7");
+    EXPECT_EQ(details.deviceName, "");
+
+    details = extract("Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 (KHTML, like Gecko) Chrome/51.0.2704.106 "
+                      "Safari/537.36 OPR/38.0.2220.41");
+    EXPECT_EQ(details.name, "Opera");
+    EXPECT_EQ(details.version, "38.0.2220.41");
+    EXPECT_EQ(details.osFull, "Linux");
+
+    details = extract("Mozilla/5.0 (iPhone; CPU iPhone OS 15_4 like Mac OS X) AppleWebKit/605.1.15 (KHTML, like "
+                      "Gecko) Version/15.4 Mobile/15E148 Safari/604.1");
+    EXPECT_EQ(details.name, "Safari");
+    EXPECT_EQ(details.version, "15.4");
+    EXPECT_EQ(details.osName, "iOS");
+    EXPECT_EQ(details.osVersion, "15.4");
+    EXPECT_EQ(details.deviceName, "iPhone");
+
+    details = extract("Mozilla/5.0 (Macintosh; Intel Mac OS X x.y; rv:42.0) Gecko/20100101 Firefox/42.0");
+    EXPECT_EQ(details.osName, "Mac OS X");
+    EXPECT_EQ(details.osVersion, "");
+    EXPECT_EQ(details.osFull, "Mac OS X");
+    EXPECT_EQ(details.deviceName, "Mac");
+
+    details = extract("Mozilla/5.0 (Windows NT 6.3; Trident/7.0; rv:11.0) like Gecko");
+    EXPECT_EQ(details.name, "IE");
+    EXPECT_EQ(details.version, "11.0");
+    EXPECT_EQ(details.osFull, "Windows 8.1");
+}
+
+TEST(UserAgentTest, ToolsAndCrawlers)
+{
+    auto details = extract("curl/7.64.1");
+    EXPECT_EQ(details.name, "curl");
+    EXPECT_EQ(details.version, "7.64.1");
+    EXPECT_EQ(details.osName, "");
+
+    details = extract("Mozilla/5.0 (compatible; Googlebot/2.1; +http://www.google.com/bot.html)");
+    EXPECT_EQ(details.name, "Googlebot");
+    EXPECT_EQ(details.version, "2.1");
+    EXPECT_EQ(details.deviceName, "Spider");
+}
+
+TEST(UserAgentTest, Unknown)
+{
+    const auto details = extract("custom-agent");
+    EXPECT_EQ(details.name, "");
+    EXPECT_EQ(details.version, "");
+    EXPECT_EQ(details.osFull, "");
+    EXPECT_EQ(details.deviceName, "");
+}
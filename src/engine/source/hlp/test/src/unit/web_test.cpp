@@ -59,6 +59,24 @@ INSTANTIATE_TEST_SUITE_P(
                 TARGET.substr(1))),
             23,
             getUriParser,
+            {NAME, TARGET, {""}, {}}),
+        ParseT(
+            SUCCESS,
+            "http://admin:@192.168.0.1:8080/login.php?user=admin",
+            j(fmt::format(
+                R"({{"{}":{{"original":"http://admin:@192.168.0.1:8080/login.php?user=admin","domain":"192.168.0.1","path":"/login.php","scheme":"http","username":"admin","password":"","port":"8080","query":"user=admin"}}}})",
+                TARGET.substr(1))),
+            51,
+            getUriParser,
+            {NAME, TARGET, {""}, {}}),
+        ParseT(
+            SUCCESS,
+            "HTTP://demo.wazuh.com:080/a/../b?#",
+            j(fmt::format(
+                R"({{"{}":{{"original":"http://demo.wazuh.com:80/b","domain":"demo.wazuh.com","path":"/b","scheme":"http","port":"80"}}}})",
+                TARGET.substr(1))),
+            34,
+            getUriParser,
             {NAME, TARGET, {""}, {}})));
 // TestCase {
 //     "mailto:John.Doe@example.com",
@@ -208,7 +226,25 @@ INSTANTIATE_TEST_SUITE_P(
                 TARGET.substr(1))),
             120,
             getUAParser,
-            {NAME, TARGET, {"-----"}, {}})));
+            {NAME, TARGET, {"-----"}, {}}),
+        ParseT(
+            SUCCESS,
+            R"(Mozilla/5.0 (Windows NT 6.1; Win64; x64; rv:47.0) Gecko/20100101 Firefox/47.0)",
+            j(fmt::format(
+                R"d({{"{}":{{"original":"Mozilla/5.0 (Windows NT 6.1; Win64; x64; rv:47.0) Gecko/20100101 Firefox/47.0","name":"Firefox","version":"47.0","os":{{"name":"Windows","version":"7","full":"Windows 7"}}}}}})d",
+                TARGET.substr(1))),
+            77,
+            getUAParser,
+            {NAME, TARGET, {""}, {"details"}}),
+        ParseT(
+            SUCCESS,
+            R"(Mozilla/5.0 (compatible; Googlebot/2.1; +http://www.google.com/bot.html))",
+            j(fmt::format(
+                R"d({{"{}":{{"original":"Mozilla/5.0 (compatible; Googlebot/2.1; +http://www.google.com/bot.html)","name":"Googlebot","version":"2.1","device":{{"name":"Spider"}}}}}})d",
+                TARGET.substr(1))),
+            72,
+            getUAParser,
+            {NAME, TARGET, {""}, {"details"}})));
 
 /************************************
  *  FQDNParser test
@@ -254,5 +254,13 @@ Name='IpAddress'>::1</Data><Data Name='IpPort'>0</Data></EventData>)",
 )")),
                1573,
                getXMLParser,
-               {NAME, TARGET, {""}})
+               {NAME, TARGET, {""}}),
+                ParseT(SUCCESS,
+                       "<?xml version=\"1.0\"?><a b=\"x&amp;y&#x41;\" c='1\t2'><!-- note -->1 &lt; 2&#9;<d>&bogus;</d></a>",
+                       j(fmt::format(R"({{"{}":{}}})",
+                                     TARGET.substr(1),
+                                     R"({"a":{"#text":"1 < 2\t","@b":"x&yA","@c":"1 2","d":{"#text":"&bogus;"}}})")),
+                       93,
+                       getXMLParser,
+                       {NAME, TARGET, {""}})
                        ));
@@ -0,0 +1,33 @@
+#ifndef _INDEXERCONNECTOR_IINDEXERCONNECTOR_HPP
+#define _INDEXERCONNECTOR_IINDEXERCONNECTOR_HPP
+
+#include <string_view>
+
+namespace indexerconnector
+{
+
+/**
+ * @brief Sends documents to the wazuh-indexer.
+ *
+ * Implementations queue the documents in a bounded buffer and send them in bulk requests, batched by number of
+ * documents and bytes. While the indexer is slow or unreachable the queued documents are kept on disk, so indexing
+ * never blocks the caller on the network.
+ */
+class IIndexerConnector
+{
+public:
+    virtual ~IIndexerConnector() = default;
+
+    /**
+     * @brief Queue a document to be indexed, thread-safe.
+     *
+     * @param index Name of the index.
+     * @param document Serialized JSON document, copied before returning.
+     * @throw std::runtime_error if the document cannot be queued.
+     */
+    virtual void index(std::string_view index, std::string_view document) = 0;
+};
+
+} // namespace indexerconnector
+
+#endif // _INDEXERCONNECTOR_IINDEXERCONNECTOR_HPP
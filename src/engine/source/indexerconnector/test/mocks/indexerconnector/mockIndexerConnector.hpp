@@ -0,0 +1,17 @@
+#ifndef _INDEXERCONNECTOR_MOCK_INDEXERCONNECTOR_HPP
+#define _INDEXERCONNECTOR_MOCK_INDEXERCONNECTOR_HPP
+
+#include <gmock/gmock.h>
+
+#include <indexerconnector/iindexerconnector.hpp>
+
+namespace indexerconnector::mocks
+{
+class MockIndexerConnector : public IIndexerConnector
+{
+public:
+    MOCK_METHOD(void, index, (std::string_view index, std::string_view document), (override));
+};
+} // namespace indexerconnector::mocks
+
+#endif // _INDEXERCONNECTOR_MOCK_INDEXERCONNECTOR_HPP
@@ -0,0 +1,103 @@
+#ifndef _KVDB_CHANGE_FEED_H
+#define _KVDB_CHANGE_FEED_H
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+
+#include <kvdb/ikvdbmanager.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Versions and subscribers of the changes of the DBs of a Manager.
+ *
+ * Each DB has a channel, shared with its handlers, that holds the version of its content and its subscribers. The
+ * handlers publish the keys they write or remove, and the Manager publishes the loads and deletions of the whole DB.
+ * The channels are kept when their DB is deleted, so the versions never go back and the subscriptions last.
+ *
+ */
+class ChangeFeed
+{
+public:
+    /**
+     * @brief Version and subscribers of a DB.
+     *
+     */
+    class Channel
+    {
+    public:
+        /**
+         * @brief Construct a new Channel object
+         *
+         * @param dbName Name of the DB.
+         */
+        explicit Channel(const std::string& dbName);
+
+        /**
+         * @brief Get the version of the DB, it does not lock the channel.
+         *
+         * @return uint64_t Version of the DB.
+         */
+        uint64_t version() const;
+
+        /**
+         * @brief Bump the version of the DB and call its subscribers.
+         *
+         * @param key Key written or removed, empty when the whole DB changed.
+         */
+        void publish(const std::optional<std::string>& key);
+
+    private:
+        friend class ChangeFeed;
+
+        const std::string m_dbName;                                 ///< Name of the DB
+        std::atomic<uint64_t> m_version;                            ///< Version of the DB
+        std::atomic<std::size_t> m_subscribers;                     ///< Size of m_callbacks, read without the lock
+        std::mutex m_mutex;                                         ///< Protects the callbacks while they are called
+        std::map<KVDBSubscription, KVDBChangeCallback> m_callbacks; ///< Callbacks by subscription
+    };
+
+    /**
+     * @brief Get the channel of a DB, created if it does not exist.
+     *
+     * @param dbName Name of the DB.
+     * @return std::shared_ptr<Channel> Channel of the DB.
+     */
+    std::shared_ptr<Channel> channel(const std::string& dbName);
+
+    /**
+     * @copydoc IKVDBManager::subscribe
+     *
+     */
+    KVDBSubscription subscribe(const std::string& dbName, KVDBChangeCallback callback);
+
+    /**
+     * @copydoc IKVDBManager::unsubscribe
+     *
+     */
+    void unsubscribe(KVDBSubscription subscription);
+
+    /**
+     * @brief Publish a change of a DB.
+     *
+     * @param dbName Name of the DB.
+     * @param key Key written or removed, empty when the whole DB changed.
+     */
+    void publish(const std::string& dbName, const std::optional<std::string>& key);
+
+private:
+    std::mutex m_mutex;                                                   ///< Protects the maps
+    std::map<std::string, std::shared_ptr<Channel>> m_channels;           ///< Channels by DB name
+    std::map<KVDBSubscription, std::shared_ptr<Channel>> m_subscriptions; ///< Channel of each subscription
+    KVDBSubscription m_nextSubscription {1};                              ///< Id of the next subscription
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_CHANGE_FEED_H
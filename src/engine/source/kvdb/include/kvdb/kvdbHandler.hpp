@@ -3,6 +3,8 @@
 
 #include <kvdb/ikvdbhandler.hpp>
 #include <kvdb/ikvdbhandlercollection.hpp>
+#include <kvdb/changeFeed.hpp>
+#include <kvdb/valueCache.hpp>
 
 #include <rocksdb/slice.h>
 
@@ -34,18 +36,27 @@ public:
      * @param cfHandle Pointer to the RocksDB:ColumnFamilyHandle instance.
      * @param dbName Name of the DB.
      * @param scopeName Name of the Scope.
+     * @param valueCache Cache of the parsed values of the DB, nullptr to parse every value read.
+     * @param changes Channel of the changes of the DB, nullptr to not publish them.
+     * @param ttl Seconds each entry lives after it is written, 0 to keep the entries forever.
      *
      */
-    KVDBHandler(std::weak_ptr<rocksdb::DB> weakDB,
-                std::weak_ptr<rocksdb::ColumnFamilyHandle> weakCFHandle,
+    KVDBHandler(std::shared_ptr<rocksdb::DB> db,
+                std::shared_ptr<rocksdb::ColumnFamilyHandle> cfHandle,
                 std::shared_ptr<IKVDBHandlerCollection> collection,
                 const std::string& dbName,
-                const std::string& scopeName)
-        : m_weakDB {weakDB}
-        , m_weakCFHandle {weakCFHandle}
+                const std::string& scopeName,
+                std::shared_ptr<ValueCache> valueCache = nullptr,
+                std::shared_ptr<ChangeFeed::Channel> changes = nullptr,
+                uint32_t ttl = 0)
+        : m_spCFHandle {std::move(cfHandle)}
+        , m_spDB {std::move(db)}
         , m_dbName {dbName}
         , m_scopeName {scopeName}
         , m_spCollection {collection}
+        , m_spValueCache {valueCache}
+        , m_spChanges {changes}
+        , m_ttl {ttl}
     {
     }
 
@@ -91,6 +102,19 @@ public:
      */
     base::RespOrError<std::string> get(const std::string& key) override;
 
+    /**
+     * @copydoc IKVDBHandler::getJson
+     *
+     */
+    base::RespOrError<std::shared_ptr<const json::Json>> getJson(const std::string& key) override;
+
+    /**
+     * @copydoc IKVDBHandler::version
+     *
+     * Tracked by the channel of the changes of the DB, or by its value cache if there is no channel.
+     */
+    std::optional<uint64_t> version() const override;
+
     /**
      * @copydoc IKVDBHandler::dump
      *
@@ -105,18 +129,29 @@ public:
     base::RespOrError<std::list<std::pair<std::string, std::string>>>
     search(const std::string& filter, const unsigned int page, const unsigned int records) override;
 
+    /**
+     * @copydoc IKVDBHandler::scan
+     *
+     */
+    base::RespOrError<KVDBPage>
+    scan(const std::string& prefix, const std::string& cursor, const unsigned int records) override;
+
 protected:
     /**
-     *  @brief Weak Pointer to the RocksDB:ColumnFamilyHandle instance.
+     * @brief Pointer to the RocksDB:ColumnFamilyHandle instance.
+     *
+     * Pinned for the lifetime of the handler, so the lookups do not touch the shared reference counts. The Manager
+     * does not delete a DB while it has handlers, see KVDBHandlerCollection, and the DB is closed once the Manager is
+     * finalized and the last handler is released.
      *
      */
-    std::weak_ptr<rocksdb::ColumnFamilyHandle> m_weakCFHandle;
+    std::shared_ptr<rocksdb::ColumnFamilyHandle> m_spCFHandle;
 
     /**
-     * @brief Weak Pointer to the RocksDB:DB instance.
+     * @brief Pointer to the RocksDB:DB instance, pinned as the Column Family Handle.
      *
      */
-    std::weak_ptr<rocksdb::DB> m_weakDB;
+    std::shared_ptr<rocksdb::DB> m_spDB;
 
     /**
      * @brief Name of the Database. Kept reference to remove handler from collection.
@@ -136,27 +171,52 @@ protected:
      */
     std::shared_ptr<IKVDBHandlerCollection> m_spCollection;
 
+    /**
+     * @brief Cache of the parsed values, shared by the handlers of the DB. Nullptr if disabled.
+     *
+     */
+    std::shared_ptr<ValueCache> m_spValueCache;
+
+    /**
+     * @brief Channel of the changes of the DB, shared by the handlers of the DB. Nullptr if not published.
+     *
+     */
+    std::shared_ptr<ChangeFeed::Channel> m_spChanges;
+
+    /**
+     * @brief Seconds each entry lives after it is written, 0 if the entries never expire.
+     *
+     * The values of a DB with TTL are stored after their expiry, see ttl::encode.
+     *
+     */
+    uint32_t m_ttl;
+
 private:
     /**
-     * @brief Function to page the content of iterator
+     * @brief Get the value of an entry from its stored value.
+     *
+     * @param stored Stored value.
+     * @param nowMs Current time, in milliseconds since the epoch. Unused if the entries never expire.
+     * @return std::optional<rocksdb::Slice> Value of the entry, it points into the stored one. Empty if it expired.
+     */
+    std::optional<rocksdb::Slice> liveValue(const rocksdb::Slice& stored, int64_t nowMs) const;
+
+    /**
+     * @brief Current time to check the expiry of the entries, 0 if the entries never expire.
      *
-     * @param page
-     * @param records
-     * @param filter
-     * @return base::RespOrError<std::list<std::pair<std::string, std::string>>>, base::Error>
      */
-    base::RespOrError<std::list<std::pair<std::string, std::string>>> pageContent(
-        const unsigned int page, const unsigned int records, const std::function<bool(const rocksdb::Slice&)>& filter);
+    int64_t expiryClock() const;
 
     /**
      * @brief Function to page the content of iterator
      *
      * @param page
      * @param records
+     * @param prefix Only the keys starting with it are iterated, empty to iterate all of them
      * @return base::RespOrError<std::list<std::pair<std::string, std::string>>>, base::Error>
      */
-    base::RespOrError<std::list<std::pair<std::string, std::string>>> pageContent(const unsigned int page,
-                                                                                  const unsigned int records);
+    base::RespOrError<std::list<std::pair<std::string, std::string>>>
+    pageContent(const unsigned int page, const unsigned int records, const std::string& prefix);
 };
 
 } // namespace kvdbManager
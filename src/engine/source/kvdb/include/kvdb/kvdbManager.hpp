@@ -5,15 +5,20 @@
 #include <filesystem>
 #include <map>
 #include <mutex>
+#include <set>
 
 #include <rocksdb/db.h>
 #include <rocksdb/options.h>
+#include <rocksdb/cache.h>
 
 #include <base/error.hpp>
+#include <base/utils/rocksDBResources.hpp>
 
+#include <kvdb/changeFeed.hpp>
 #include <kvdb/ikvdbmanager.hpp>
 #include <kvdb/kvdbHandler.hpp>
 #include <kvdb/kvdbHandlerCollection.hpp>
+#include <kvdb/valueCache.hpp>
 
 namespace metricsManager
 {
@@ -25,6 +30,8 @@ namespace kvdbManager
 {
 
 constexpr static const char* DEFAULT_CF_NAME {"default"};
+constexpr static const char* MEMORY_RESIDENT_PREFIX {"memory_resident/"}; ///< Prefix of the marks in the default CF
+constexpr static const char* TTL_PREFIX {"ttl/"}; ///< Prefix of the TTL of the DBs in the default CF, in seconds
 
 /**
  * @brief Options for the KVDBManager.
@@ -34,6 +41,8 @@ struct KVDBManagerOptions
 {
     std::filesystem::path dbStoragePath;
     std::string dbName;
+    std::size_t valueCacheSize {0}; ///< Memory in bytes for the parsed values cached of each DB, 0 disables the cache
+    int bloomFilterBits {10};       ///< Bits per key of the whole-key bloom filters of the DBs, 0 disables them
 };
 
 /**
@@ -87,6 +96,18 @@ public:
      */
     uint32_t getKVDBHandlersCount(const std::string& dbName) const override;
 
+    /**
+     * @copydoc IKVDBManager::subscribe
+     *
+     */
+    KVDBSubscription subscribe(const std::string& dbName, KVDBChangeCallback callback) override;
+
+    /**
+     * @copydoc IKVDBManager::unsubscribe
+     *
+     */
+    void unsubscribe(KVDBSubscription subscription) override;
+
     /**
      * @copydoc IKVDBManager::getKVDBHandler
      *
@@ -118,6 +139,30 @@ public:
      */
     base::OptError createDB(const std::string& name, const std::string& path) override;
 
+    /**
+     * @copydoc IKVDBManager::createDB(const std::string& name, const KVDBOptions& options)
+     *
+     */
+    base::OptError createDB(const std::string& name, const KVDBOptions& options) override;
+
+    /**
+     * @copydoc IKVDBManager::createDB(const std::string& name, const std::string& path, const KVDBOptions& options)
+     *
+     */
+    base::OptError createDB(const std::string& name, const std::string& path, const KVDBOptions& options) override;
+
+    /**
+     * @copydoc IKVDBManager::isMemoryResident
+     *
+     */
+    bool isMemoryResident(const std::string& name) override;
+
+    /**
+     * @copydoc IKVDBManager::getTTL
+     *
+     */
+    uint32_t getTTL(const std::string& name) override;
+
     /**
      * @copydoc IKVDBManager::loadDBFromJson
      *
@@ -137,6 +182,39 @@ private:
      */
     void initializeOptions();
 
+    /**
+     * @brief Get the options of the Column Family of a DB.
+     * The tables have whole-key bloom filters, so the lookups of missing keys are answered from memory.
+     *
+     * @param options Options of the DB. The blocks of a memory-resident DB are cached without limit, the compactions
+     * of a DB with TTL drop its expired entries.
+     * @return rocksdb::ColumnFamilyOptions Options of the Column Family.
+     */
+    rocksdb::ColumnFamilyOptions columnFamilyOptions(const KVDBOptions& options) const;
+
+    /**
+     * @brief Get the options a DB was created with, from the marks read when opened.
+     *
+     * @param name Name of the DB.
+     * @return KVDBOptions Options of the DB.
+     */
+    KVDBOptions dbOptions(const std::string& name) const;
+
+    /**
+     * @brief Read the names of the memory-resident DBs and the TTL of the DBs, marked in the default Column Family.
+     * Populate m_memoryResidentDBs and m_ttlDBs.
+     *
+     * @param dbNameFullPath Path of the RocksDB instance.
+     */
+    void readDBMarks(const std::string& dbNameFullPath);
+
+    /**
+     * @brief Read the whole content of a DB, to load its blocks into the cache.
+     *
+     * @param name Name of the DB.
+     */
+    void warmUp(const std::string& name);
+
     /**
      * @brief Initialize the Main DB. Setup Filesystem, open RocksDB, create initial maps.
      *
@@ -150,12 +228,14 @@ private:
     void finalizeMainDB();
 
     /**
-     * @brief Get the content of a json file
+     * @brief Load the content of a json file into a DB.
+     * The file is parsed as it is read and its entries are written in batches, it is never held in memory.
      *
-     * @param path Path of the json file.
-     * @return base::RespOrError<json::Json> A json document or specific error.
+     * @param name Name of the DB.
+     * @param path Path of the json file, it must contain an object.
+     * @return base::OptError Specific error, the entries written before the error are kept.
      */
-    base::RespOrError<json::Json> getContentFromJsonFile(const std::string& path);
+    base::OptError loadDBFromFile(const std::string& name, const std::string& path);
 
     /**
      * @brief Create a Shared Column Family Shared Pointer with custom delete function.
@@ -165,6 +245,27 @@ private:
      */
     std::shared_ptr<rocksdb::ColumnFamilyHandle> createSharedCFHandle(rocksdb::ColumnFamilyHandle* cfRawPtr);
 
+    /**
+     * @brief Create the cache of the parsed values of a DB, if the cache is enabled.
+     *
+     * @param name Name of the DB.
+     */
+    void createValueCache(const std::string& name);
+
+    /**
+     * @brief Clear the cache of the parsed values of a DB, if any.
+     *
+     * @param name Name of the DB.
+     */
+    void clearValueCache(const std::string& name);
+
+    /**
+     * @brief Clear the cached values of a DB whose whole content changed and publish the change.
+     *
+     * @param name Name of the DB.
+     */
+    void dbChanged(const std::string& name);
+
     /**
      * @brief Custom Collection Object to wrap maps, searchs, references, related to handlers and scopes.
      *
@@ -181,9 +282,10 @@ private:
      * @brief Create a Column Family object and store in map.
      *
      * @param name Name of the DB -> mapped to Column Family.
+     * @param options Options of the DB, the ones that are not the default are marked in the default Column Family.
      * @return base::OptError Specific error.
      */
-    base::OptError createColumnFamily(const std::string& name);
+    base::OptError createColumnFamily(const std::string& name, const KVDBOptions& options);
 
     /**
      * @brief Options the Manager was built with.
@@ -209,6 +311,43 @@ private:
      */
     std::map<std::string, std::shared_ptr<rocksdb::ColumnFamilyHandle>> m_mapCFHandles;
 
+    /**
+     * @brief Internal map of the caches of parsed values, shared by the handlers of each DB.
+     * Empty if the cache is disabled.
+     *
+     */
+    std::map<std::string, std::shared_ptr<ValueCache>> m_mapValueCaches;
+
+    /**
+     * @brief Versions and subscribers of the changes of the DBs, shared with the handlers.
+     *
+     */
+    std::shared_ptr<ChangeFeed> m_spChangeFeed;
+
+    /**
+     * @brief Names of the memory-resident DBs.
+     *
+     */
+    std::set<std::string> m_memoryResidentDBs;
+
+    /**
+     * @brief TTL in seconds of the DBs whose entries expire.
+     *
+     */
+    std::map<std::string, uint32_t> m_ttlDBs;
+
+    /**
+     * @brief Block cache of the memory-resident DBs, it never evicts.
+     *
+     */
+    std::shared_ptr<rocksdb::Cache> m_residentBlockCache;
+
+    /**
+     * @brief Registration of the DB in the usage report of the process-wide RocksDB resources.
+     *
+     */
+    utils::rocksdb::RocksDBResources::Consumer m_consumer;
+
     /**
      * @brief Default Column Family Handle
      *
@@ -0,0 +1,79 @@
+#ifndef _KVDB_TTL_H
+#define _KVDB_TTL_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <rocksdb/compaction_filter.h>
+#include <rocksdb/slice.h>
+
+namespace kvdbManager::ttl
+{
+
+/**
+ * @brief Size of the expiry stored before each value of a DB with TTL: milliseconds since the epoch, little-endian.
+ *
+ */
+constexpr std::size_t HEADER_SIZE {sizeof(int64_t)};
+
+/**
+ * @brief Current time, in milliseconds since the epoch.
+ *
+ */
+int64_t nowMs();
+
+/**
+ * @brief Build the value stored for an entry of a DB with TTL.
+ *
+ * @param value Value of the entry.
+ * @param expiryMs Time the entry expires at, in milliseconds since the epoch.
+ * @return std::string Expiry followed by the value.
+ */
+std::string encode(std::string_view value, int64_t expiryMs);
+
+/**
+ * @brief Check if a stored value expired. The values shorter than the expiry never expire.
+ *
+ * @param stored Stored value.
+ * @param nowMs Current time, in milliseconds since the epoch.
+ * @return true The entry expired, it is treated as absent.
+ */
+bool isExpired(const rocksdb::Slice& stored, int64_t nowMs);
+
+/**
+ * @brief Get the value of an entry from its stored value, the values shorter than the expiry are returned as they are.
+ *
+ * @param stored Stored value.
+ * @return rocksdb::Slice Value of the entry, it points into the stored one.
+ */
+rocksdb::Slice payload(const rocksdb::Slice& stored);
+
+/**
+ * @brief Compaction filter dropping the expired entries of the DBs with TTL.
+ *
+ * Stateless, the expiry is read from each value, so a single instance serves all the DBs with TTL.
+ *
+ */
+class CompactionFilter final : public rocksdb::CompactionFilter
+{
+public:
+    bool Filter(int level,
+                const rocksdb::Slice& key,
+                const rocksdb::Slice& existingValue,
+                std::string* newValue,
+                bool* valueChanged) const override;
+
+    const char* Name() const override { return "kvdb.TTLCompactionFilter"; }
+};
+
+/**
+ * @brief Get the compaction filter of the DBs with TTL. It lives as long as the process, as the filter must outlive
+ * the RocksDB instances that use it.
+ *
+ */
+const CompactionFilter* compactionFilter();
+
+} // namespace kvdbManager::ttl
+
+#endif // _KVDB_TTL_H
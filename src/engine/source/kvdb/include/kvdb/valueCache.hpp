@@ -0,0 +1,115 @@
+#ifndef _KVDB_VALUE_CACHE_H
+#define _KVDB_VALUE_CACHE_H
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <base/json.hpp>
+
+namespace kvdbManager
+{
+
+/**
+ * @brief Cache of the parsed values of a DB, shared by all the handlers of the DB.
+ *
+ * The least recently used values are evicted once the memory of the cached values exceeds the limit. The handlers
+ * invalidate the keys they write, and the manager clears the cache when the DB is loaded or removed.
+ *
+ */
+class ValueCache
+{
+public:
+    /**
+     * @brief Construct a new ValueCache object
+     *
+     * @param maxBytes Memory limit of the cached values.
+     */
+    explicit ValueCache(std::size_t maxBytes);
+
+    /**
+     * @brief Get the cached value of a key.
+     *
+     * @param key Provided key.
+     * @return std::shared_ptr<const json::Json> Cached value, nullptr if the key is not cached.
+     */
+    std::shared_ptr<const json::Json> get(const std::string& key);
+
+    /**
+     * @brief Get the version of the cache, it changes every time a key is invalidated or the cache is cleared.
+     *
+     * It must be read before reading a value from the DB, to cache it with put. Reading it does not lock the cache.
+     *
+     * @return uint64_t Version of the cache.
+     */
+    uint64_t version() const;
+
+    /**
+     * @brief Cache the value of a key read from the DB.
+     *
+     * The value is discarded if the cache changed since the version was read, as it may have been overwritten.
+     *
+     * @param key Provided key.
+     * @param value Parsed value.
+     * @param bytes Memory used by the value.
+     * @param version Version of the cache read before reading the value from the DB.
+     */
+    void put(const std::string& key, std::shared_ptr<const json::Json> value, std::size_t bytes, uint64_t version);
+
+    /**
+     * @brief Remove the cached value of a key.
+     *
+     * @param key Provided key.
+     */
+    void invalidate(const std::string& key);
+
+    /**
+     * @brief Remove all the cached values.
+     *
+     */
+    void clear();
+
+    /**
+     * @brief Get the number of cached values.
+     *
+     * @return std::size_t Number of cached values.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Get the memory used by the cached values.
+     *
+     * @return std::size_t Memory used, in bytes.
+     */
+    std::size_t bytes() const;
+
+private:
+    struct Entry
+    {
+        std::string key;                         ///< Key of the value
+        std::shared_ptr<const json::Json> value; ///< Parsed value
+        std::size_t bytes;                       ///< Memory used by the value
+    };
+
+    /**
+     * @brief Remove an entry, the lock must be held.
+     *
+     * @param it Entry to remove.
+     */
+    void erase(std::list<Entry>::iterator it);
+
+    const std::size_t m_maxBytes;                                           ///< Memory limit of the cached values
+    mutable std::mutex m_mutex;                                             ///< Protects the cache
+    std::list<Entry> m_entries;                                             ///< Entries, the most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_mapIndex; ///< Entries by key
+    std::size_t m_bytes;                                                    ///< Memory used by the cached values
+    std::atomic<uint64_t> m_version;                                        ///< Version of the cache
+};
+
+} // namespace kvdbManager
+
+#endif // _KVDB_VALUE_CACHE_H
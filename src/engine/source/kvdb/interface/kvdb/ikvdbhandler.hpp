@@ -1,8 +1,11 @@
 #ifndef _I_KVDB_HANDLER_H
 #define _I_KVDB_HANDLER_H
 
+#include <cstdint>
 #include <list>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <variant>
@@ -13,6 +16,16 @@
 namespace kvdbManager
 {
 
+/**
+ * @brief Entries of the database read from a cursor.
+ *
+ */
+struct KVDBPage
+{
+    std::list<std::pair<std::string, std::string>> entries; ///< Key-value pairs, in key order
+    std::optional<std::string> nextCursor;                  ///< Cursor of the next entries, empty if there are no more
+};
+
 /**
  * @brief Interface of KVDB Handler. Holds the basic operations to interact with the database.
  *
@@ -80,6 +93,35 @@ public:
      */
     virtual base::RespOrError<std::string> get(const std::string& key) = 0;
 
+    /**
+     * @brief Gets the value of a key parsed as Json.
+     *
+     * @param key Provided key.
+     * @return base::RespOrError<std::shared_ptr<const json::Json>> Json value of the key. Specific error otherwise.
+     * @throw std::runtime_error If the value of the key is not a valid Json.
+     * @note The value may be shared with other callers, it must not be modified.
+     */
+    virtual base::RespOrError<std::shared_ptr<const json::Json>> getJson(const std::string& key)
+    {
+        auto result = get(key);
+        if (base::isError(result))
+        {
+            return base::getError(result);
+        }
+
+        return std::make_shared<const json::Json>(base::getResponse<std::string>(result).c_str());
+    }
+
+    /**
+     * @brief Gets the version of the contents of the database.
+     *
+     * The version changes every time a key is written or removed, or the database is loaded again, so a value read
+     * while the version does not change is still up to date.
+     *
+     * @return std::optional<uint64_t> Version of the contents, empty if the handler does not track the changes.
+     */
+    virtual std::optional<uint64_t> version() const { return std::nullopt; }
+
     /**
      * @brief Retrieves all content with pagination from the database.
      *
@@ -131,6 +173,20 @@ public:
     {
         return search(prefix, 0, 0);
     };
+
+    /**
+     * @brief Retrieves the entries of the database from a cursor, optionally filtered by a prefix.
+     *
+     * Unlike the pages of dump and search, each call seeks directly to its cursor, so reading the whole database
+     * costs the same no matter how many calls it takes.
+     *
+     * @param prefix Filter value, empty to retrieve all the entries.
+     * @param cursor Opaque cursor returned by the previous call, empty to start from the first entry.
+     * @param records Maximum quantity of records to retrieve, 0 to retrieve all of them.
+     * @return base::RespOrError<KVDBPage> Entries and the cursor of the next ones. Specific error otherwise.
+     */
+    virtual base::RespOrError<KVDBPage>
+    scan(const std::string& prefix, const std::string& cursor, const unsigned int records) = 0;
 };
 
 } // namespace kvdbManager
@@ -1,6 +1,8 @@
 #ifndef _I_KVDB_MANAGER_H
 #define _I_KVDB_MANAGER_H
 
+#include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -18,6 +20,30 @@ namespace kvdbManager
  */
 using RefInfo = std::map<std::string, uint32_t>;
 
+/**
+ * @brief Options of a DB, set when the DB is created.
+ *
+ */
+struct KVDBOptions
+{
+    bool memoryResident {false}; ///< Keep the whole DB in memory, its lookups are answered without disk I/O
+    uint32_t ttl {0};            ///< Seconds each entry lives after it is written, 0 to keep the entries forever
+};
+
+/**
+ * @brief Change of the content of a DB, published to its subscribers.
+ *
+ */
+struct KVDBChange
+{
+    std::string dbName;             ///< Name of the DB
+    uint64_t version;               ///< Version of the DB after the change, see IKVDBHandler::version
+    std::optional<std::string> key; ///< Key written or removed, empty when the whole DB changed (load or delete)
+};
+
+using KVDBChangeCallback = std::function<void(const KVDBChange&)>;
+using KVDBSubscription = uint64_t; ///< Id of a subscription, to unsubscribe
+
 /**
  * @brief Interface for the KVDBManager class.
  *
@@ -78,6 +104,49 @@ public:
      */
     virtual base::OptError createDB(const std::string& name, const std::string& path) = 0;
 
+    /**
+     * @brief Creates a DB with the provided name and options.
+     *
+     * @param name Name of the DB.
+     * @param options Options of the DB.
+     * @return base::OptError If base::Error not exists the DB was created successfully. Specific error
+     * otherwise.
+     *
+     */
+    virtual base::OptError createDB(const std::string& name, const KVDBOptions& options) = 0;
+
+    /**
+     * @brief Creates a DB with the provided name and options from a json file.
+     *
+     * @param name Name of the DB.
+     * @param path Path of the json file.
+     * @param options Options of the DB.
+     * @return base::OptError If base::Error not exists the DB was created successfully. Specific error
+     * otherwise.
+     *
+     */
+    virtual base::OptError createDB(const std::string& name, const std::string& path, const KVDBOptions& options) = 0;
+
+    /**
+     * @brief Checks if a DB is kept in memory.
+     *
+     * @param name Name of the DB.
+     * @return true The DB exists and it was created memory-resident.
+     * @return false Otherwise.
+     */
+    virtual bool isMemoryResident(const std::string& name) = 0;
+
+    /**
+     * @brief Gets the time to live of the entries of a DB.
+     *
+     * The expired entries are treated as absent by the handlers and dropped from the disk by the compactions.
+     *
+     * @param name Name of the DB.
+     * @return uint32_t Seconds each entry lives after it is written, 0 if the DB does not exist or its entries never
+     * expire.
+     */
+    virtual uint32_t getTTL(const std::string& name) = 0;
+
     /**
      * @brief Load a DB with the provided file path.
      *
@@ -133,6 +202,26 @@ public:
      *
      */
     virtual uint32_t getKVDBHandlersCount(const std::string& dbName) const = 0;
+
+    /**
+     * @brief Subscribe to the changes of a DB.
+     *
+     * The callback is called by the thread that changed the DB, after the change is visible to the readers, so it
+     * must not block nor call back into the Manager. The DB does not need to exist, the subscription lasts until it
+     * is removed, even if the DB is deleted and created again.
+     *
+     * @param dbName Name of the DB.
+     * @param callback Called with each change of the DB.
+     * @return KVDBSubscription Id of the subscription.
+     */
+    virtual KVDBSubscription subscribe(const std::string& dbName, KVDBChangeCallback callback) = 0;
+
+    /**
+     * @brief Remove a subscription, its callback is not called once this returns.
+     *
+     * @param subscription Id returned by subscribe, unknown ids are ignored.
+     */
+    virtual void unsubscribe(KVDBSubscription subscription) = 0;
 };
 
 } // namespace kvdbManager
@@ -0,0 +1,90 @@
+#include <kvdb/changeFeed.hpp>
+
+namespace kvdbManager
+{
+
+ChangeFeed::Channel::Channel(const std::string& dbName)
+    : m_dbName {dbName}
+    , m_version {0}
+    , m_subscribers {0}
+{
+}
+
+uint64_t ChangeFeed::Channel::version() const
+{
+    return m_version.load(std::memory_order_acquire);
+}
+
+void ChangeFeed::Channel::publish(const std::optional<std::string>& key)
+{
+    const auto version = m_version.fetch_add(1, std::memory_order_acq_rel) + 1;
+
+    // Most DBs have no subscribers, their writes do not take the lock
+    if (m_subscribers.load(std::memory_order_acquire) == 0)
+    {
+        return;
+    }
+
+    // The lock is held while the callbacks run, so none is called after it is unsubscribed
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const KVDBChange change {m_dbName, version, key};
+    for (const auto& [subscription, callback] : m_callbacks)
+    {
+        callback(change);
+    }
+}
+
+std::shared_ptr<ChangeFeed::Channel> ChangeFeed::channel(const std::string& dbName)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto& channel = m_channels[dbName];
+    if (!channel)
+    {
+        channel = std::make_shared<Channel>(dbName);
+    }
+
+    return channel;
+}
+
+KVDBSubscription ChangeFeed::subscribe(const std::string& dbName, KVDBChangeCallback callback)
+{
+    auto dbChannel = channel(dbName);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto subscription = m_nextSubscription++;
+    {
+        std::lock_guard<std::mutex> channelLock(dbChannel->m_mutex);
+        dbChannel->m_callbacks.emplace(subscription, std::move(callback));
+        dbChannel->m_subscribers.store(dbChannel->m_callbacks.size(), std::memory_order_release);
+    }
+    m_subscriptions.emplace(subscription, std::move(dbChannel));
+
+    return subscription;
+}
+
+void ChangeFeed::unsubscribe(KVDBSubscription subscription)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_subscriptions.find(subscription);
+    if (it == m_subscriptions.end())
+    {
+        return;
+    }
+
+    {
+        auto& dbChannel = *it->second;
+        std::lock_guard<std::mutex> channelLock(dbChannel.m_mutex);
+        dbChannel.m_callbacks.erase(subscription);
+        dbChannel.m_subscribers.store(dbChannel.m_callbacks.size(), std::memory_order_release);
+    }
+    m_subscriptions.erase(it);
+}
+
+void ChangeFeed::publish(const std::string& dbName, const std::optional<std::string>& key)
+{
+    channel(dbName)->publish(key);
+}
+
+} // namespace kvdbManager
@@ -1,4 +1,8 @@
 #include <kvdb/kvdbHandler.hpp>
+#include <kvdb/ttl.hpp>
+
+#include <algorithm>
+#include <limits>
 
 #include <fmt/format.h>
 #include <base/json.hpp>
@@ -8,24 +12,92 @@
 namespace kvdbManager
 {
 
+namespace
+{
+/**
+ * @brief Read options bounding the iteration to the keys that start with a prefix.
+ *
+ */
+struct PrefixReadOptions
+{
+    std::string upperBound;         ///< First key after the ones with the prefix
+    rocksdb::Slice upperBoundSlice; ///< Slice of the bound, it must outlive the iterator
+    rocksdb::ReadOptions options;   ///< Options of the iterator
+
+    explicit PrefixReadOptions(const std::string& prefix)
+        : upperBound {prefix}
+    {
+        // The bound is the prefix with its last byte incremented, the trailing 0xFF bytes have no successor
+        while (!upperBound.empty() && static_cast<unsigned char>(upperBound.back()) == 0xFF)
+        {
+            upperBound.pop_back();
+        }
+
+        if (!upperBound.empty())
+        {
+            upperBound.back() = static_cast<char>(static_cast<unsigned char>(upperBound.back()) + 1);
+            upperBoundSlice = rocksdb::Slice(upperBound);
+            options.iterate_upper_bound = &upperBoundSlice;
+        }
+    }
+
+    PrefixReadOptions(const PrefixReadOptions&) = delete;
+    PrefixReadOptions& operator=(const PrefixReadOptions&) = delete;
+};
+} // namespace
+
 KVDBHandler::~KVDBHandler()
 {
     m_spCollection->removeKVDBHandler(m_dbName, m_scopeName);
 }
 
+std::optional<rocksdb::Slice> KVDBHandler::liveValue(const rocksdb::Slice& stored, int64_t nowMs) const
+{
+    if (m_ttl == 0)
+    {
+        return stored;
+    }
+
+    if (ttl::isExpired(stored, nowMs))
+    {
+        return std::nullopt;
+    }
+
+    return ttl::payload(stored);
+}
+
+int64_t KVDBHandler::expiryClock() const
+{
+    return m_ttl == 0 ? 0 : ttl::nowMs();
+}
+
 std::optional<base::Error> KVDBHandler::set(const std::string& key, const std::string& value)
 {
-    auto pRocksDB = m_weakDB.lock();
+    const auto& pRocksDB = m_spDB;
     if (pRocksDB)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
+        const auto& pCFhandle = m_spCFHandle;
         if (pCFhandle)
         {
-            auto status =
-                pRocksDB->Put(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key), rocksdb::Slice(value));
+            // The entries of a DB with TTL expire once the time passed since their last write
+            const auto stored = m_ttl == 0 ? std::string {}
+                                           : ttl::encode(value, ttl::nowMs() + static_cast<int64_t>(m_ttl) * 1000);
+            auto status = pRocksDB->Put(rocksdb::WriteOptions(),
+                                        pCFhandle.get(),
+                                        rocksdb::Slice(key),
+                                        rocksdb::Slice(m_ttl == 0 ? value : stored));
+
+            if (m_spValueCache)
+            {
+                m_spValueCache->invalidate(key);
+            }
 
             if (status.ok())
             {
+                if (m_spChanges)
+                {
+                    m_spChanges->publish(key);
+                }
                 return std::nullopt;
             }
             else
@@ -55,16 +127,25 @@ std::optional<base::Error> KVDBHandler::add(const std::string& key)
 
 std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 {
-    auto pRocksDB = m_weakDB.lock();
+    const auto& pRocksDB = m_spDB;
     if (pRocksDB)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
+        const auto& pCFhandle = m_spCFHandle;
         if (pCFhandle)
         {
             auto status = pRocksDB->Delete(rocksdb::WriteOptions(), pCFhandle.get(), rocksdb::Slice(key));
 
+            if (m_spValueCache)
+            {
+                m_spValueCache->invalidate(key);
+            }
+
             if (status.ok())
             {
+                if (m_spChanges)
+                {
+                    m_spChanges->publish(key);
+                }
                 return std::nullopt;
             }
             else
@@ -84,10 +165,10 @@ std::optional<base::Error> KVDBHandler::remove(const std::string& key)
 
 std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 {
-    auto pRocksDB = m_weakDB.lock();
+    const auto& pRocksDB = m_spDB;
     if (pRocksDB)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
+        const auto& pCFhandle = m_spCFHandle;
         if (pCFhandle)
         {
             try
@@ -95,21 +176,23 @@ std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
                 std::string value; // mandatory to pass to KeyMayExist.
                 bool valueFound = false;
 
-                pRocksDB->KeyMayExist(
-                    rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value, &valueFound);
+                // The bloom filters and the memtables answer most of the misses without reading the tables
+                if (!pRocksDB->KeyMayExist(
+                        rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value, &valueFound))
+                {
+                    return false;
+                }
 
-                // confirm exists
                 if (valueFound)
                 {
-                    auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value);
-
-                    if (!status.ok())
-                    {
-                        valueFound = false;
-                    }
+                    return liveValue(value, expiryClock()).has_value();
                 }
 
-                return valueFound;
+                // confirm exists
+                rocksdb::PinnableSlice pinnedValue;
+                auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &pinnedValue);
+
+                return status.ok() && liveValue(pinnedValue, expiryClock()).has_value();
             }
             catch (const std::exception& ex)
             {
@@ -127,15 +210,27 @@ std::variant<bool, base::Error> KVDBHandler::contains(const std::string& key)
 
 std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
 {
-    auto pRocksDB = m_weakDB.lock();
+    const auto& pRocksDB = m_spDB;
     if (pRocksDB)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
+        const auto& pCFhandle = m_spCFHandle;
         if (pCFhandle)
         {
             std::string value;
             auto status = pRocksDB->Get(rocksdb::ReadOptions(), pCFhandle.get(), rocksdb::Slice(key), &value);
 
+            if (status.ok() && m_ttl != 0)
+            {
+                // An expired entry is absent until a compaction drops it
+                if (const auto live = liveValue(value, expiryClock()))
+                {
+                    return live->ToString();
+                }
+
+                value.clear();
+                status = rocksdb::Status::NotFound();
+            }
+
             if (status.ok())
             {
                 return value;
@@ -158,60 +253,95 @@ std::variant<std::string, base::Error> KVDBHandler::get(const std::string& key)
     return base::Error {"Can not access RocksDB::DB"};
 }
 
-std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
-                                                                                            const unsigned int records)
+base::RespOrError<std::shared_ptr<const json::Json>> KVDBHandler::getJson(const std::string& key)
 {
-    return pageContent(page, records);
+    if (!m_spValueCache)
+    {
+        return IKVDBHandler::getJson(key);
+    }
+
+    if (auto cached = m_spValueCache->get(key))
+    {
+        return cached;
+    }
+
+    // Read the version before the DB, a write in between discards the value read
+    const auto version = m_spValueCache->version();
+    auto result = get(key);
+    if (base::isError(result))
+    {
+        return base::getError(result);
+    }
+
+    const auto& rawValue = base::getResponse<std::string>(result);
+    auto value = std::make_shared<const json::Json>(rawValue.c_str());
+
+    // The parsed document takes roughly twice the memory of its text
+    m_spValueCache->put(key, value, key.size() + 2 * rawValue.size(), version);
+
+    return value;
 }
 
-std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
-KVDBHandler::search(const std::string& prefix, const unsigned int page, const unsigned int records)
+std::optional<uint64_t> KVDBHandler::version() const
 {
-    auto filter = [&prefix](const rocksdb::Slice& keyIter) -> bool
+    if (m_spChanges)
     {
-        rocksdb::Slice slicePrefix(prefix);
+        return m_spChanges->version();
+    }
 
-        if (slicePrefix.empty())
-            return true;
-        else
-            return keyIter.starts_with(slicePrefix);
-    };
+    if (m_spValueCache)
+    {
+        return m_spValueCache->version();
+    }
 
-    return pageContent(page, records, filter);
+    return std::nullopt;
+}
+
+std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::dump(const unsigned int page,
+                                                                                            const unsigned int records)
+{
+    return pageContent(page, records, "");
 }
 
 std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
-KVDBHandler::pageContent(const unsigned int page, const unsigned int records)
+KVDBHandler::search(const std::string& prefix, const unsigned int page, const unsigned int records)
 {
-    return pageContent(page, records, {});
+    return pageContent(page, records, prefix);
 }
 
-std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHandler::pageContent(
-    const unsigned int page, const unsigned int records, const std::function<bool(const rocksdb::Slice&)>& filter)
+std::variant<std::list<std::pair<std::string, std::string>>, base::Error>
+KVDBHandler::pageContent(const unsigned int page, const unsigned int records, const std::string& prefix)
 {
-    auto pRocksDB = m_weakDB.lock();
+    const auto& pRocksDB = m_spDB;
     if (pRocksDB)
     {
-        auto pCFhandle = m_weakCFHandle.lock();
+        const auto& pCFhandle = m_spCFHandle;
         if (pCFhandle)
         {
-            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), pCFhandle.get()));
+            PrefixReadOptions readOptions {prefix};
+            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(readOptions.options, pCFhandle.get()));
             std::list<std::pair<std::string, std::string>> content;
 
-            unsigned int fromRecords = (page - 1) * records;
-            unsigned int toRecords = fromRecords + records;
+            // Without records, the whole content is retrieved
+            unsigned int fromRecords = records == 0 ? 0 : (page - 1) * records;
+            unsigned int toRecords = records == 0 ? std::numeric_limits<unsigned int>::max() : fromRecords + records;
 
+            // The expired entries are skipped, they do not count for the pages
+            const auto nowMs = expiryClock();
             unsigned int i = 0;
-            for (iter->SeekToFirst(); iter->Valid() && i < toRecords; iter->Next())
+            for (iter->Seek(prefix); iter->Valid() && i < toRecords; iter->Next())
             {
-                if (!filter || filter(iter->key()))
+                const auto value = liveValue(iter->value(), nowMs);
+                if (!value)
                 {
-                    if (i >= fromRecords)
-                    {
-                        content.emplace_back(std::make_pair(iter->key().ToString(), iter->value().ToString()));
-                    }
-                    i++;
+                    continue;
                 }
+
+                if (i >= fromRecords)
+                {
+                    content.emplace_back(std::make_pair(iter->key().ToString(), value->ToString()));
+                }
+                i++;
             }
 
             if (!iter->status().ok())
@@ -229,4 +359,53 @@ std::variant<std::list<std::pair<std::string, std::string>>, base::Error> KVDBHa
     return base::Error {"Can not access RocksDB::DB"};
 }
 
+base::RespOrError<KVDBPage>
+KVDBHandler::scan(const std::string& prefix, const std::string& cursor, const unsigned int records)
+{
+    const auto& pRocksDB = m_spDB;
+    if (pRocksDB)
+    {
+        const auto& pCFhandle = m_spCFHandle;
+        if (pCFhandle)
+        {
+            PrefixReadOptions readOptions {prefix};
+            std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(readOptions.options, pCFhandle.get()));
+            KVDBPage page;
+
+            // The cursor is the last key retrieved, the entries continue after it
+            iter->Seek(std::max(cursor, prefix));
+            if (!cursor.empty() && iter->Valid() && iter->key() == rocksdb::Slice(cursor))
+            {
+                iter->Next();
+            }
+
+            const auto nowMs = expiryClock();
+            for (; iter->Valid() && (records == 0 || page.entries.size() < records); iter->Next())
+            {
+                if (const auto value = liveValue(iter->value(), nowMs))
+                {
+                    page.entries.emplace_back(iter->key().ToString(), value->ToString());
+                }
+            }
+
+            if (!iter->status().ok())
+            {
+                return base::Error {fmt::format(
+                    "Database '{}': Could not iterate over database: '{}'", m_dbName, iter->status().ToString())};
+            }
+
+            if (iter->Valid() && !page.entries.empty())
+            {
+                page.nextCursor = page.entries.back().first;
+            }
+
+            return page;
+        }
+
+        return base::Error {"Can not access RocksDB Column Family Handle"};
+    }
+
+    return base::Error {"Can not access RocksDB::DB"};
+}
+
 } // namespace kvdbManager
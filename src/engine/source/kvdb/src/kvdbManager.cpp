@@ -1,24 +1,250 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
 #include <filesystem>
 #include <fmt/format.h>
-#include <fstream>
+#include <limits>
+#include <memory>
 #include <optional>
+#include <vector>
 
 #include "rocksdb/db.h"
+#include "rocksdb/filter_policy.h"
 #include "rocksdb/options.h"
+#include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
+
+#include <rapidjson/error/en.h>
+#include <rapidjson/filereadstream.h>
+#include <rapidjson/reader.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <kvdb/kvdbManager.hpp>
+#include <kvdb/ttl.hpp>
 #include <base/logging.hpp>
 #include <metrics/metricsManager.hpp>
 
 namespace kvdbManager
 {
 
+namespace
+{
+constexpr std::size_t IMPORT_BATCH_BYTES {4 * 1024 * 1024}; ///< Data written to the DB by each batch of an import
+constexpr std::size_t IMPORT_READ_BUFFER {64 * 1024};       ///< Buffer to read the file of an import
+constexpr uint64_t TTL_MIN_COMPACTION_PERIOD {60 * 60};     ///< Seconds between the compactions of a file with TTL
+
+/**
+ * @brief Writes the entries of an import in batches, without the WAL, and flushes them once all are written.
+ *
+ * In a DB with TTL all the entries of the import expire at once, counted from the start of the import.
+ *
+ */
+class BatchWriter
+{
+public:
+    BatchWriter(rocksdb::DB* db, rocksdb::ColumnFamilyHandle* cfHandle, uint32_t ttl)
+        : m_db {db}
+        , m_cfHandle {cfHandle}
+        , m_ttl {ttl}
+        , m_expiryMs {ttl == 0 ? 0 : ttl::nowMs() + static_cast<int64_t>(ttl) * 1000}
+    {
+    }
+
+    base::OptError put(const rocksdb::Slice& key, const rocksdb::Slice& value)
+    {
+        const auto status = m_ttl == 0 ? m_batch.Put(m_cfHandle, key, value)
+                                       : m_batch.Put(m_cfHandle, key, ttl::encode(value.ToStringView(), m_expiryMs));
+        if (!status.ok())
+        {
+            return base::Error {fmt::format("An error occurred while inserting data key {}, value {}: {}",
+                                            key.ToString(),
+                                            value.ToString(),
+                                            status.ToString())};
+        }
+
+        return m_batch.GetDataSize() >= IMPORT_BATCH_BYTES ? write() : std::nullopt;
+    }
+
+    base::OptError finish()
+    {
+        if (auto error = write())
+        {
+            return error;
+        }
+
+        // The batches skip the WAL, the flush makes the import durable
+        const auto status = m_db->Flush(rocksdb::FlushOptions(), m_cfHandle);
+        if (!status.ok())
+        {
+            return base::Error {
+                fmt::format("An error occurred while flushing the imported data: {}", status.ToString())};
+        }
+
+        return std::nullopt;
+    }
+
+private:
+    base::OptError write()
+    {
+        if (m_batch.Count() == 0)
+        {
+            return std::nullopt;
+        }
+
+        rocksdb::WriteOptions writeOptions;
+        writeOptions.disableWAL = true;
+        const auto status = m_db->Write(writeOptions, &m_batch);
+        m_batch.Clear();
+        if (!status.ok())
+        {
+            return base::Error {
+                fmt::format("An error occurred while writing the imported data: {}", status.ToString())};
+        }
+
+        return std::nullopt;
+    }
+
+    rocksdb::DB* m_db;
+    rocksdb::ColumnFamilyHandle* m_cfHandle;
+    uint32_t m_ttl;
+    int64_t m_expiryMs;
+    rocksdb::WriteBatch m_batch;
+};
+
+/**
+ * @brief SAX handler writing the members of a json object as entries, each one as soon as its value is parsed.
+ *
+ * Only the value being parsed is kept in memory, the values are serialized as json::Json::str does.
+ */
+class ImportHandler : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, ImportHandler>
+{
+public:
+    explicit ImportHandler(BatchWriter& writer)
+        : m_writer {writer}
+        , m_valueWriter {m_buffer}
+    {
+    }
+
+    const base::OptError& error() const { return m_error; }
+    bool notObject() const { return m_notObject; }
+
+    bool Null()
+    {
+        return value([](auto& writer) { return writer.Null(); });
+    }
+    bool Bool(bool b)
+    {
+        return value([b](auto& writer) { return writer.Bool(b); });
+    }
+    bool Int(int i)
+    {
+        return value([i](auto& writer) { return writer.Int(i); });
+    }
+    bool Uint(unsigned u)
+    {
+        return value([u](auto& writer) { return writer.Uint(u); });
+    }
+    bool Int64(int64_t i)
+    {
+        return value([i](auto& writer) { return writer.Int64(i); });
+    }
+    bool Uint64(uint64_t u)
+    {
+        return value([u](auto& writer) { return writer.Uint64(u); });
+    }
+    bool Double(double d)
+    {
+        return value([d](auto& writer) { return writer.Double(d); });
+    }
+    bool String(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        return value([=](auto& writer) { return writer.String(str, length, copy); });
+    }
+
+    bool StartObject()
+    {
+        return m_depth++ == 0 || m_valueWriter.StartObject();
+    }
+
+    bool Key(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        if (m_depth == 1)
+        {
+            m_key.assign(str, length);
+            return true;
+        }
+
+        return m_valueWriter.Key(str, length, copy);
+    }
+
+    bool EndObject(rapidjson::SizeType memberCount)
+    {
+        return --m_depth == 0 || (m_valueWriter.EndObject(memberCount) && endValue());
+    }
+
+    bool StartArray()
+    {
+        if (m_depth == 0)
+        {
+            m_notObject = true;
+            return false;
+        }
+
+        ++m_depth;
+        return m_valueWriter.StartArray();
+    }
+
+    bool EndArray(rapidjson::SizeType elementCount)
+    {
+        --m_depth;
+        return m_valueWriter.EndArray(elementCount) && endValue();
+    }
+
+private:
+    template<typename Write>
+    bool value(Write&& write)
+    {
+        if (m_depth == 0)
+        {
+            m_notObject = true;
+            return false;
+        }
+
+        return write(m_valueWriter) && endValue();
+    }
+
+    // Write the entry if the value of the member is complete
+    bool endValue()
+    {
+        if (m_depth > 1)
+        {
+            return true;
+        }
+
+        m_error = m_writer.put(m_key, rocksdb::Slice(m_buffer.GetString(), m_buffer.GetSize()));
+        m_buffer.Clear();
+        m_valueWriter.Reset(m_buffer);
+        return !m_error;
+    }
+
+    BatchWriter& m_writer;
+    rapidjson::StringBuffer m_buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> m_valueWriter;
+    std::string m_key;
+    int m_depth {0};
+    bool m_notObject {false};
+    base::OptError m_error;
+};
+} // namespace
+
 KVDBManager::KVDBManager(const KVDBManagerOptions& options,
                          const std::shared_ptr<metricsManager::IMetricsManager>& metricsManager)
 {
     m_ManagerOptions = options;
     m_spMetricsScope = metricsManager->getMetricsScope("KVDB");
     m_kvdbHandlerCollection = std::make_shared<KVDBHandlerCollection>();
+    m_spChangeFeed = std::make_shared<ChangeFeed>();
 }
 
 void KVDBManager::initialize()
@@ -46,6 +272,130 @@ void KVDBManager::initializeOptions()
     m_rocksDBOptions.IncreaseParallelism();
     m_rocksDBOptions.OptimizeLevelStyleCompaction();
     m_rocksDBOptions.create_if_missing = true;
+    // The memtables are charged to the process-wide budget of the RocksDB databases
+    m_rocksDBOptions.write_buffer_manager = utils::rocksdb::RocksDBResources::instance().writeBufferManager();
+
+    // The blocks read from the memory-resident DBs are never evicted
+    m_residentBlockCache = rocksdb::NewLRUCache(std::numeric_limits<std::size_t>::max());
+}
+
+rocksdb::ColumnFamilyOptions KVDBManager::columnFamilyOptions(const KVDBOptions& options) const
+{
+    rocksdb::ColumnFamilyOptions cfOptions;
+    rocksdb::BlockBasedTableOptions tableOptions;
+
+    if (m_ManagerOptions.bloomFilterBits > 0)
+    {
+        // The lookups of missing keys, most of them for the blocklists, are answered by the filters
+        tableOptions.filter_policy.reset(rocksdb::NewBloomFilterPolicy(m_ManagerOptions.bloomFilterBits));
+        tableOptions.whole_key_filtering = true;
+        cfOptions.memtable_whole_key_filtering = true;
+        cfOptions.memtable_prefix_bloom_size_ratio = 0.02;
+    }
+
+    // Keep the filters and indexes of the fresh tables in memory, the lookups of the helpers need them on every read
+    tableOptions.block_cache = utils::rocksdb::RocksDBResources::instance().blockCache();
+    tableOptions.cache_index_and_filter_blocks = true;
+    tableOptions.cache_index_and_filter_blocks_with_high_priority = true;
+    tableOptions.metadata_cache_options.unpartitioned_pinning = rocksdb::PinningTier::kFlushedAndSimilar;
+
+    if (options.memoryResident)
+    {
+        tableOptions.block_cache = m_residentBlockCache;
+        tableOptions.metadata_cache_options.unpartitioned_pinning = rocksdb::PinningTier::kAll;
+        tableOptions.prepopulate_block_cache = rocksdb::BlockBasedTableOptions::PrepopulateBlockCache::kFlushOnly;
+    }
+
+    if (options.ttl > 0)
+    {
+        // The expired entries are dropped as their files are compacted, the files nobody writes over are compacted
+        // once their oldest entry expired, so the DB does not grow with the entries that are not written again
+        cfOptions.compaction_filter = ttl::compactionFilter();
+        cfOptions.periodic_compaction_seconds = std::max<uint64_t>(options.ttl, TTL_MIN_COMPACTION_PERIOD);
+    }
+
+    cfOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(tableOptions));
+    return cfOptions;
+}
+
+KVDBOptions KVDBManager::dbOptions(const std::string& name) const
+{
+    KVDBOptions options;
+    options.memoryResident = m_memoryResidentDBs.count(name) > 0;
+
+    const auto it = m_ttlDBs.find(name);
+    if (it != m_ttlDBs.end())
+    {
+        options.ttl = it->second;
+    }
+
+    return options;
+}
+
+void KVDBManager::readDBMarks(const std::string& dbNameFullPath)
+{
+    m_memoryResidentDBs.clear();
+    m_ttlDBs.clear();
+
+    // Only the default CF is needed, it is read before opening the DB with the options of each CF
+    std::vector<rocksdb::ColumnFamilyDescriptor> cfDescriptors {
+        rocksdb::ColumnFamilyDescriptor(rocksdb::kDefaultColumnFamilyName, rocksdb::ColumnFamilyOptions())};
+    std::vector<rocksdb::ColumnFamilyHandle*> cfHandles;
+    rocksdb::DB* rawRocksDBPtr {nullptr};
+
+    const auto statusOpen =
+        rocksdb::DB::OpenForReadOnly(rocksdb::DBOptions(), dbNameFullPath, cfDescriptors, &cfHandles, &rawRocksDBPtr);
+    if (!statusOpen.ok())
+    {
+        LOG_WARNING("Could not read the options of the KVDBs, they are opened as the rest: {}", statusOpen.ToString());
+        return;
+    }
+
+    std::unique_ptr<rocksdb::DB> pRocksDB {rawRocksDBPtr};
+    {
+        std::unique_ptr<rocksdb::Iterator> iter(pRocksDB->NewIterator(rocksdb::ReadOptions(), cfHandles.front()));
+        const rocksdb::Slice prefix {MEMORY_RESIDENT_PREFIX};
+        for (iter->Seek(prefix); iter->Valid() && iter->key().starts_with(prefix); iter->Next())
+        {
+            m_memoryResidentDBs.emplace(iter->key().ToString().substr(prefix.size()));
+        }
+
+        const rocksdb::Slice ttlPrefix {TTL_PREFIX};
+        for (iter->Seek(ttlPrefix); iter->Valid() && iter->key().starts_with(ttlPrefix); iter->Next())
+        {
+            const auto name = iter->key().ToString().substr(ttlPrefix.size());
+            const auto value = iter->value();
+            uint32_t ttl {0};
+            const auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), ttl);
+            if (ec != std::errc() || end != value.data() + value.size())
+            {
+                LOG_WARNING("Invalid TTL '{}' of the KVDB '{}', its entries do not expire", value.ToString(), name);
+                continue;
+            }
+            m_ttlDBs.emplace(name, ttl);
+        }
+    }
+
+    pRocksDB->DestroyColumnFamilyHandle(cfHandles.front());
+}
+
+void KVDBManager::warmUp(const std::string& name)
+{
+    const auto it = m_mapCFHandles.find(name);
+    if (it == m_mapCFHandles.end())
+    {
+        return;
+    }
+
+    std::unique_ptr<rocksdb::Iterator> iter(m_pRocksDB->NewIterator(rocksdb::ReadOptions(), it->second.get()));
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next())
+    {
+    }
+
+    if (!iter->status().ok())
+    {
+        LOG_WARNING("Could not load the KVDB '{}' into memory: {}", name, iter->status().ToString());
+    }
 }
 
 void KVDBManager::initializeMainDB()
@@ -65,14 +415,18 @@ void KVDBManager::initializeMainDB()
     const auto listStatus = rocksdb::DB::ListColumnFamilies(rocksdb::DBOptions(), dbNameFullPath, &columnNames);
     if (listStatus.ok())
     {
+        readDBMarks(dbNameFullPath);
+
         for (const auto& cfName : columnNames)
         {
             if (rocksdb::kDefaultColumnFamilyName == cfName)
             {
                 hasDefaultCF = true;
+                cfDescriptors.emplace_back(cfName, rocksdb::ColumnFamilyOptions());
+                continue;
             }
 
-            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, rocksdb::ColumnFamilyOptions());
+            auto newDescriptor = rocksdb::ColumnFamilyDescriptor(cfName, columnFamilyOptions(dbOptions(cfName)));
             cfDescriptors.push_back(newDescriptor);
         }
     }
@@ -90,6 +444,7 @@ void KVDBManager::initializeMainDB()
     if (statusOpen.ok())
     {
         m_pRocksDB = std::shared_ptr<rocksdb::DB>(rawRocksDBPtr);
+        m_consumer = utils::rocksdb::RocksDBResources::instance().registerConsumer("kvdb", m_pRocksDB.get());
 
         // rocksdb::DB::Open returns two vectors.
         // One with the descriptors containing the names of the DBs. (cfDescriptors)
@@ -101,12 +456,18 @@ void KVDBManager::initializeMainDB()
             if (rocksdb::kDefaultColumnFamilyName != dbName)
             {
                 m_mapCFHandles.emplace(dbName, createSharedCFHandle(cfHandles[cfDescriptorIndex]));
+                createValueCache(dbName);
             }
             else
             {
                 m_pDefaultCFHandle = createSharedCFHandle(cfHandles[cfDescriptorIndex]);
             }
         }
+
+        for (const auto& name : m_memoryResidentDBs)
+        {
+            warmUp(name);
+        }
     }
     else
     {
@@ -117,8 +478,12 @@ void KVDBManager::initializeMainDB()
 
 void KVDBManager::finalizeMainDB()
 {
+    m_mapValueCaches.clear();
+    m_memoryResidentDBs.clear();
+    m_ttlDBs.clear();
     m_mapCFHandles.clear();
     m_pDefaultCFHandle.reset();
+    m_consumer = utils::rocksdb::RocksDBResources::Consumer {};
     m_pRocksDB.reset();
 }
 
@@ -136,9 +501,23 @@ base::RespOrError<std::shared_ptr<IKVDBHandler>> KVDBManager::getKVDBHandler(con
         return base::Error {fmt::format("The DB '{}' does not exists.", dbName)};
     }
 
+    std::shared_ptr<ValueCache> valueCache;
+    const auto itCache = m_mapValueCaches.find(dbName);
+    if (itCache != m_mapValueCaches.end())
+    {
+        valueCache = itCache->second;
+    }
+
     m_kvdbHandlerCollection->addKVDBHandler(dbName, scopeName);
 
-    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB, cfHandle, m_kvdbHandlerCollection, dbName, scopeName);
+    auto kvdbHandler = std::make_shared<KVDBHandler>(m_pRocksDB,
+                                                     cfHandle,
+                                                     m_kvdbHandlerCollection,
+                                                     dbName,
+                                                     scopeName,
+                                                     std::move(valueCache),
+                                                     m_spChangeFeed->channel(dbName),
+                                                     getTTL(dbName));
 
     return kvdbHandler;
 }
@@ -176,6 +555,20 @@ base::OptError KVDBManager::deleteDB(const std::string& name)
             if (opStatus.ok())
             {
                 m_mapCFHandles.erase(it);
+                // The handlers still holding the cache see a new version
+                dbChanged(name);
+                m_mapValueCaches.erase(name);
+                if (m_memoryResidentDBs.erase(name) > 0)
+                {
+                    m_pRocksDB->Delete(rocksdb::WriteOptions(),
+                                       m_pDefaultCFHandle.get(),
+                                       fmt::format("{}{}", MEMORY_RESIDENT_PREFIX, name));
+                }
+                if (m_ttlDBs.erase(name) > 0)
+                {
+                    m_pRocksDB->Delete(
+                        rocksdb::WriteOptions(), m_pDefaultCFHandle.get(), fmt::format("{}{}", TTL_PREFIX, name));
+                }
             }
             else
             {
@@ -212,37 +605,100 @@ base::OptError KVDBManager::loadDBFromJson(const std::string& name, const json::
 
     entries = content.getObject().value();
 
+    BatchWriter writer {m_pRocksDB.get(), cfHandle.get(), getTTL(name)};
     for (const auto& [key, value] : entries)
     {
-        const auto status = m_pRocksDB->Put(rocksdb::WriteOptions(), cfHandle.get(), key, value.str());
-        if (!status.ok())
+        if (auto error = writer.put(key, value.str()))
         {
-            return base::Error {fmt::format(
-                "An error occurred while inserting data key {}, value {}: ", key, value.str(), status.ToString())};
+            dbChanged(name);
+            return error;
         }
     }
 
-    return std::nullopt;
+    auto error = writer.finish();
+    dbChanged(name);
+
+    return error;
+}
+
+base::OptError KVDBManager::loadDBFromFile(const std::string& name, const std::string& path)
+{
+    const auto it = m_mapCFHandles.find(name);
+    if (it == m_mapCFHandles.end())
+    {
+        return base::Error {fmt::format("The DB '{}' does not exists.", name)};
+    }
+
+    // TODO: No check the size, the location, the type of file, the permissions it's a
+    // security issue. The API should be changed to receive a stream instead of a path
+    std::unique_ptr<std::FILE, decltype(&std::fclose)> file {std::fopen(path.c_str(), "rb"), &std::fclose};
+    if (!file)
+    {
+        return base::Error {fmt::format("An error occurred while opening the file '{}'", path.c_str())};
+    }
+
+    // The file is parsed as it is read, the entries are written in batches
+    std::vector<char> readBuffer(IMPORT_READ_BUFFER);
+    rapidjson::FileReadStream stream {file.get(), readBuffer.data(), readBuffer.size()};
+    BatchWriter writer {m_pRocksDB.get(), it->second.get(), getTTL(name)};
+    ImportHandler handler {writer};
+    rapidjson::Reader reader;
+
+    const auto parseResult = reader.Parse(stream, handler);
+    base::OptError error;
+    if (handler.error())
+    {
+        error = handler.error();
+    }
+    else if (handler.notObject())
+    {
+        error = base::Error {
+            fmt::format("An error occurred while parsing the JSON file '{}': JSON is not an object", path.c_str())};
+    }
+    else if (parseResult.IsError())
+    {
+        error = base::Error {fmt::format("An error occurred while parsing the JSON file '{}': {} at offset {}",
+                                         path.c_str(),
+                                         rapidjson::GetParseError_En(parseResult.Code()),
+                                         parseResult.Offset())};
+    }
+    else
+    {
+        error = writer.finish();
+    }
+
+    dbChanged(name);
+
+    return error;
 }
 
 base::OptError KVDBManager::createDB(const std::string& name, const std::string& path)
 {
-    auto result = getContentFromJsonFile(path);
+    return createDB(name, path, KVDBOptions {});
+}
 
-    if (std::holds_alternative<base::Error>(result))
+base::OptError KVDBManager::createDB(const std::string& name, const std::string& path, const KVDBOptions& options)
+{
+    // TODO: to improve
+    if (path.empty())
+    {
+        return base::Error {"The path is empty."};
+    }
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(path, ec))
     {
-        return std::get<base::Error>(result);
+        return base::Error {fmt::format("An error occurred while opening the file '{}'", path.c_str())};
     }
 
-    auto content = std::get<json::Json>(result);
-    auto errorCreate = createDB(name);
+    auto errorCreate = createDB(name, options);
 
     if (errorCreate)
     {
         return errorCreate;
     }
 
-    auto errorLoad = loadDBFromJson(name, content);
+    auto errorLoad = loadDBFromFile(name, path);
 
     if (errorLoad)
     {
@@ -252,19 +708,37 @@ base::OptError KVDBManager::createDB(const std::string& name, const std::string&
         {
             return errorDelete;
         }
+
+        return errorLoad;
     }
 
     return std::nullopt;
 }
 
 base::OptError KVDBManager::createDB(const std::string& name)
+{
+    return createDB(name, KVDBOptions {});
+}
+
+base::OptError KVDBManager::createDB(const std::string& name, const KVDBOptions& options)
 {
     if (existsDB(name))
     {
         return std::nullopt;
     }
 
-    return createColumnFamily(name);
+    return createColumnFamily(name, options);
+}
+
+bool KVDBManager::isMemoryResident(const std::string& name)
+{
+    return m_memoryResidentDBs.count(name) > 0;
+}
+
+uint32_t KVDBManager::getTTL(const std::string& name)
+{
+    const auto it = m_ttlDBs.find(name);
+    return it != m_ttlDBs.end() ? it->second : 0;
 }
 
 bool KVDBManager::existsDB(const std::string& name)
@@ -341,14 +815,48 @@ uint32_t KVDBManager::getKVDBHandlersCount(const std::string& dbName) const
     return retValue;
 }
 
-base::OptError KVDBManager::createColumnFamily(const std::string& name)
+base::OptError KVDBManager::createColumnFamily(const std::string& name, const KVDBOptions& options)
 {
     rocksdb::ColumnFamilyHandle* cfHandle {nullptr};
-    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(rocksdb::ColumnFamilyOptions(), name, &cfHandle)};
+    rocksdb::Status s {m_pRocksDB->CreateColumnFamily(columnFamilyOptions(options), name, &cfHandle)};
 
     if (s.ok())
     {
-        m_mapCFHandles.emplace(name, createSharedCFHandle(cfHandle));
+        auto spCFHandle = createSharedCFHandle(cfHandle);
+
+        // The marks are read on the next start, to open the CF with the same options
+        rocksdb::WriteBatch marks;
+        if (options.memoryResident)
+        {
+            marks.Put(m_pDefaultCFHandle.get(), fmt::format("{}{}", MEMORY_RESIDENT_PREFIX, name), rocksdb::Slice());
+        }
+        if (options.ttl > 0)
+        {
+            marks.Put(m_pDefaultCFHandle.get(), fmt::format("{}{}", TTL_PREFIX, name), std::to_string(options.ttl));
+        }
+
+        if (marks.Count() > 0)
+        {
+            const auto markStatus = m_pRocksDB->Write(rocksdb::WriteOptions(), &marks);
+            if (!markStatus.ok())
+            {
+                m_pRocksDB->DropColumnFamily(spCFHandle.get());
+                return base::Error {fmt::format(
+                    "Could not record the options of DB '{}', RocksDB Status: {}", name, markStatus.ToString())};
+            }
+        }
+
+        if (options.memoryResident)
+        {
+            m_memoryResidentDBs.insert(name);
+        }
+        if (options.ttl > 0)
+        {
+            m_ttlDBs.insert_or_assign(name, options.ttl);
+        }
+
+        m_mapCFHandles.emplace(name, std::move(spCFHandle));
+        createValueCache(name);
         return std::nullopt;
     }
 
@@ -370,52 +878,38 @@ std::shared_ptr<rocksdb::ColumnFamilyHandle> KVDBManager::createSharedCFHandle(r
         });
 }
 
-base::RespOrError<json::Json> KVDBManager::getContentFromJsonFile(const std::string& path)
+void KVDBManager::createValueCache(const std::string& name)
 {
-    std::vector<std::tuple<std::string, json::Json>> entries {};
-
-    // TODO: to improve
-    if (path.empty())
+    // The cached values do not expire, the values of a DB with TTL are always read from the DB
+    if (m_ManagerOptions.valueCacheSize > 0 && getTTL(name) == 0)
     {
-        return base::Error {"The path is empty."};
+        m_mapValueCaches.insert_or_assign(name, std::make_shared<ValueCache>(m_ManagerOptions.valueCacheSize));
     }
+}
 
-    // Open file and read content
-    std::string contents;
-    // TODO: No check the size, the location, the type of file, the permissions it's a
-    // security issue. The API should be changed to receive a stream instead of a path
-    std::ifstream in(path, std::ios::in | std::ios::binary);
-    if (in)
-    {
-        in.seekg(0, std::ios::end);
-        contents.resize(in.tellg());
-        in.seekg(0, std::ios::beg);
-        in.read(&contents[0], static_cast<std::streamsize>(contents.size()));
-        in.close();
-    }
-    else
+void KVDBManager::clearValueCache(const std::string& name)
+{
+    const auto it = m_mapValueCaches.find(name);
+    if (it != m_mapValueCaches.end())
     {
-        return base::Error {fmt::format("An error occurred while opening the file '{}'", path.c_str())};
+        it->second->clear();
     }
+}
 
-    json::Json fileContentsJson;
-
-    try
-    {
-        fileContentsJson = json::Json {contents.c_str()};
-    }
-    catch (const std::exception& e)
-    {
-        return base::Error {fmt::format("An error occurred while parsing the JSON file '{}'", path.c_str())};
-    }
+void KVDBManager::dbChanged(const std::string& name)
+{
+    clearValueCache(name);
+    m_spChangeFeed->publish(name, std::nullopt);
+}
 
-    if (!fileContentsJson.isObject())
-    {
-        return base::Error {
-            fmt::format("An error occurred while parsing the JSON file '{}': JSON is not an object", path.c_str())};
-    }
+KVDBSubscription KVDBManager::subscribe(const std::string& dbName, KVDBChangeCallback callback)
+{
+    return m_spChangeFeed->subscribe(dbName, std::move(callback));
+}
 
-    return fileContentsJson;
+void KVDBManager::unsubscribe(KVDBSubscription subscription)
+{
+    m_spChangeFeed->unsubscribe(subscription);
 }
 
 } // namespace kvdbManager
@@ -0,0 +1,69 @@
+#include <kvdb/ttl.hpp>
+
+#include <chrono>
+
+namespace kvdbManager::ttl
+{
+
+int64_t nowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+std::string encode(std::string_view value, int64_t expiryMs)
+{
+    std::string stored(HEADER_SIZE, '\0');
+    auto expiry = static_cast<uint64_t>(expiryMs);
+    for (auto& byte : stored)
+    {
+        byte = static_cast<char>(expiry & 0xFF);
+        expiry >>= 8;
+    }
+
+    stored.append(value);
+    return stored;
+}
+
+bool isExpired(const rocksdb::Slice& stored, int64_t nowMs)
+{
+    if (stored.size() < HEADER_SIZE)
+    {
+        return false;
+    }
+
+    uint64_t expiry {0};
+    for (auto i = HEADER_SIZE; i > 0; --i)
+    {
+        expiry = (expiry << 8) | static_cast<unsigned char>(stored[i - 1]);
+    }
+
+    return static_cast<int64_t>(expiry) <= nowMs;
+}
+
+rocksdb::Slice payload(const rocksdb::Slice& stored)
+{
+    if (stored.size() < HEADER_SIZE)
+    {
+        return stored;
+    }
+
+    return rocksdb::Slice(stored.data() + HEADER_SIZE, stored.size() - HEADER_SIZE);
+}
+
+bool CompactionFilter::Filter(int /*level*/,
+                              const rocksdb::Slice& /*key*/,
+                              const rocksdb::Slice& existingValue,
+                              std::string* /*newValue*/,
+                              bool* /*valueChanged*/) const
+{
+    return isExpired(existingValue, nowMs());
+}
+
+const CompactionFilter* compactionFilter()
+{
+    static const CompactionFilter filter;
+    return &filter;
+}
+
+} // namespace kvdbManager::ttl
@@ -0,0 +1,103 @@
+#include <kvdb/valueCache.hpp>
+
+#include <iterator>
+
+namespace kvdbManager
+{
+
+ValueCache::ValueCache(std::size_t maxBytes)
+    : m_maxBytes {maxBytes}
+    , m_bytes {0}
+    , m_version {0}
+{
+}
+
+std::shared_ptr<const json::Json> ValueCache::get(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_mapIndex.find(key);
+    if (it == m_mapIndex.end())
+    {
+        return nullptr;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->value;
+}
+
+uint64_t ValueCache::version() const
+{
+    return m_version.load(std::memory_order_acquire);
+}
+
+void ValueCache::put(const std::string& key,
+                     std::shared_ptr<const json::Json> value,
+                     std::size_t bytes,
+                     uint64_t version)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (version != m_version.load(std::memory_order_relaxed) || bytes > m_maxBytes)
+    {
+        return;
+    }
+
+    const auto it = m_mapIndex.find(key);
+    if (it != m_mapIndex.end())
+    {
+        erase(it->second);
+    }
+
+    while (!m_entries.empty() && m_bytes + bytes > m_maxBytes)
+    {
+        erase(std::prev(m_entries.end()));
+    }
+
+    m_entries.push_front(Entry {key, std::move(value), bytes});
+    m_mapIndex.emplace(key, m_entries.begin());
+    m_bytes += bytes;
+}
+
+void ValueCache::invalidate(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_version.fetch_add(1, std::memory_order_release);
+    const auto it = m_mapIndex.find(key);
+    if (it != m_mapIndex.end())
+    {
+        erase(it->second);
+    }
+}
+
+void ValueCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_version.fetch_add(1, std::memory_order_release);
+    m_mapIndex.clear();
+    m_entries.clear();
+    m_bytes = 0;
+}
+
+std::size_t ValueCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+std::size_t ValueCache::bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_bytes;
+}
+
+void ValueCache::erase(std::list<Entry>::iterator it)
+{
+    m_bytes -= it->bytes;
+    m_mapIndex.erase(it->key);
+    m_entries.erase(it);
+}
+
+} // namespace kvdbManager
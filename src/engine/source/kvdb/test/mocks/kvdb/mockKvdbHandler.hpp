@@ -82,6 +82,10 @@ public:
                 search,
                 (const std::string& prefix),
                 ());
+    MOCK_METHOD((base::RespOrError<kvdbManager::KVDBPage>),
+                scan,
+                (const std::string& prefix, const std::string& cursor, const unsigned int records),
+                (override));
 };
 
 } // namespace kvdb::mocks
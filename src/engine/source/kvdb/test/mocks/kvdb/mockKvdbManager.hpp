@@ -50,6 +50,16 @@ public:
     MOCK_METHOD((base::OptError), deleteDB, (const std::string& name), (override));
     MOCK_METHOD((base::OptError), createDB, (const std::string& name), (override));
     MOCK_METHOD((base::OptError), createDB, (const std::string& name, const std::string& path), (override));
+    MOCK_METHOD((base::OptError),
+                createDB,
+                (const std::string& name, const kvdbManager::KVDBOptions& options),
+                (override));
+    MOCK_METHOD((base::OptError),
+                createDB,
+                (const std::string& name, const std::string& path, const kvdbManager::KVDBOptions& options),
+                (override));
+    MOCK_METHOD((bool), isMemoryResident, (const std::string& name), (override));
+    MOCK_METHOD((uint32_t), getTTL, (const std::string& name), (override));
     MOCK_METHOD((base::OptError), loadDBFromJson, (const std::string& name, const json::Json& content), (override));
     MOCK_METHOD((bool), existsDB, (const std::string& name), (override));
     MOCK_METHOD((std::map<std::string, kvdbManager::RefInfo>), getKVDBScopesInfo, (), ());
@@ -59,6 +69,11 @@ public:
                 (const std::string& dbName, const std::string& scopeName),
                 (override));
     MOCK_METHOD((uint32_t), getKVDBHandlersCount, (const std::string& dbName), (const));
+    MOCK_METHOD((kvdbManager::KVDBSubscription),
+                subscribe,
+                (const std::string& dbName, kvdbManager::KVDBChangeCallback callback),
+                (override));
+    MOCK_METHOD((void), unsubscribe, (kvdbManager::KVDBSubscription subscription), (override));
 };
 
 } // namespace kvdb::mocks
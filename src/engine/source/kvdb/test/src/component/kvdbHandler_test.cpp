@@ -4,6 +4,7 @@
 #include <random>
 #include <thread>
 #include <unistd.h>
+#include <vector>
 
 #include <base/json.hpp>
 #include <kvdb/ikvdbmanager.hpp>
@@ -133,6 +134,24 @@ TEST_F(KVDBHandlerTest, AddKey)
     ASSERT_TRUE(std::get<bool>(resultContains));
 }
 
+TEST_F(KVDBHandlerTest, HandlerPinsTheDB)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("HandlerPinsTheDB"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("HandlerPinsTheDB", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+    ASSERT_EQ(handler->set("key1", "value1"), std::nullopt);
+
+    // In use, the DB is not deleted
+    ASSERT_TRUE(m_kvdbManager->deleteDB("HandlerPinsTheDB").has_value());
+
+    // The DB is closed with its last handler
+    m_kvdbManager->finalize();
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value1");
+}
+
 TEST_F(KVDBHandlerTest, SetKeyWithStringValue)
 {
     ASSERT_FALSE(m_kvdbManager->createDB("SetKeyWithStringValue"));
@@ -326,4 +345,254 @@ INSTANTIATE_TEST_SUITE_P(KVDB,
                                            std::make_tuple(3, 1, 2, 2),
                                            std::make_tuple(3, 3, 50, 0)));
 
+TEST_F(KVDBHandlerTest, SearchBoundedByPrefix)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("SearchBoundedByPrefix"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("SearchBoundedByPrefix", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (const auto& key : {"ka", "kb1", "kb2", "kb\xff", "kc"})
+    {
+        ASSERT_EQ(handler->set(key, "value"), std::nullopt);
+    }
+
+    const auto result = handler->search("kb", 1, 10);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(result));
+    const auto& entries = std::get<std::list<std::pair<std::string, std::string>>>(result);
+    ASSERT_EQ(entries.size(), 3);
+    ASSERT_EQ(entries.front().first, "kb1");
+    ASSERT_EQ(entries.back().first, "kb\xff");
+}
+
+TEST_F(KVDBHandlerTest, DumpAllRecords)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("DumpAllRecords"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("DumpAllRecords", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (auto i = 0; i < 120; i++)
+    {
+        ASSERT_EQ(handler->set(fmt::format("{0}", i), fmt::format("value {0}", i)), std::nullopt);
+    }
+
+    const auto result = handler->dump(1, 0);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(result));
+    ASSERT_EQ(std::get<std::list<std::pair<std::string, std::string>>>(result).size(), 120);
+}
+
+TEST_F(KVDBHandlerTest, ScanWithCursor)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("ScanWithCursor"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("ScanWithCursor", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (auto i = 0; i < 25; i++)
+    {
+        ASSERT_EQ(handler->set(fmt::format("key{:02}", i), fmt::format("value {0}", i)), std::nullopt);
+        ASSERT_EQ(handler->set(fmt::format("other{:02}", i), fmt::format("value {0}", i)), std::nullopt);
+    }
+
+    std::vector<std::string> keys;
+    std::string cursor;
+    auto pages = 0;
+    do
+    {
+        auto result = handler->scan("key", cursor, 10);
+        ASSERT_FALSE(base::isError(result));
+        auto page = base::getResponse(std::move(result));
+        for (const auto& [key, value] : page.entries)
+        {
+            keys.push_back(key);
+        }
+        cursor = page.nextCursor.value_or("");
+        pages++;
+    } while (!cursor.empty());
+
+    ASSERT_EQ(pages, 3);
+    ASSERT_EQ(keys.size(), 25);
+    for (auto i = 0; i < 25; i++)
+    {
+        ASSERT_EQ(keys[i], fmt::format("key{:02}", i));
+    }
+}
+
+TEST_F(KVDBHandlerTest, ScanCursorRemoved)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("ScanCursorRemoved"));
+    auto resultHandler = m_kvdbManager->getKVDBHandler("ScanCursorRemoved", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::move(std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler));
+
+    for (const auto& key : {"key1", "key2", "key3", "key4"})
+    {
+        ASSERT_EQ(handler->set(key, "value"), std::nullopt);
+    }
+
+    auto first = handler->scan("", "", 2);
+    ASSERT_FALSE(base::isError(first));
+    ASSERT_EQ(base::getResponse(first).nextCursor, std::make_optional<std::string>("key2"));
+
+    // The scan continues after the cursor even if its key is gone
+    ASSERT_EQ(handler->remove("key2"), std::nullopt);
+    auto second = handler->scan("", "key2", 0);
+    ASSERT_FALSE(base::isError(second));
+    const auto& page = base::getResponse(second);
+    ASSERT_EQ(page.entries.size(), 2);
+    ASSERT_EQ(page.entries.front().first, "key3");
+    ASSERT_FALSE(page.nextCursor.has_value());
+}
+
+class KVDBHandlerValueCacheTest : public ::testing::Test
+{
+private:
+    std::string kvdbPath;
+
+protected:
+    std::shared_ptr<kvdbManager::IKVDBManager> m_kvdbManager;
+
+    void SetUp() override
+    {
+        kvdbPath = uniquePath(KVDB_PATH);
+        ::Setup(kvdbPath);
+
+        kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME, 1024 * 1024};
+
+        m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+
+        m_kvdbManager->initialize();
+    };
+
+    void TearDown() override
+    {
+        try
+        {
+            m_kvdbManager->finalize();
+        }
+        catch (const std::exception& e)
+        {
+            FAIL() << "Exception: " << e.what();
+        }
+
+        ::TearDown(kvdbPath);
+    };
+
+    std::shared_ptr<kvdbManager::IKVDBHandler> getHandler(const std::string& dbName, const std::string& scopeName)
+    {
+        auto resultHandler = m_kvdbManager->getKVDBHandler(dbName, scopeName);
+        EXPECT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        return std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+    }
+};
+
+TEST_F(KVDBHandlerValueCacheTest, GetJsonIsCached)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("GetJsonIsCached"));
+    auto handler = getHandler("GetJsonIsCached", "scope1");
+    ASSERT_EQ(handler->set("key1", json::Json {R"({"a":1})"}), std::nullopt);
+
+    auto first = handler->getJson("key1");
+    ASSERT_FALSE(base::isError(first));
+    ASSERT_EQ(*base::getResponse(first), json::Json {R"({"a":1})"});
+
+    auto second = handler->getJson("key1");
+    ASSERT_FALSE(base::isError(second));
+    ASSERT_EQ(base::getResponse(first).get(), base::getResponse(second).get());
+}
+
+TEST_F(KVDBHandlerValueCacheTest, SetInvalidatesOtherHandlers)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("SetInvalidatesOtherHandlers"));
+    auto reader = getHandler("SetInvalidatesOtherHandlers", "scope1");
+    auto writer = getHandler("SetInvalidatesOtherHandlers", "scope2");
+    ASSERT_EQ(writer->set("key1", json::Json {"1"}), std::nullopt);
+
+    auto result = reader->getJson("key1");
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(*base::getResponse(result), json::Json {"1"});
+
+    ASSERT_EQ(writer->set("key1", json::Json {"2"}), std::nullopt);
+    result = reader->getJson("key1");
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(*base::getResponse(result), json::Json {"2"});
+}
+
+TEST_F(KVDBHandlerValueCacheTest, RemoveInvalidates)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("RemoveInvalidates"));
+    auto handler = getHandler("RemoveInvalidates", "scope1");
+    ASSERT_EQ(handler->set("key1", json::Json {"1"}), std::nullopt);
+    ASSERT_FALSE(base::isError(handler->getJson("key1")));
+
+    ASSERT_EQ(handler->remove("key1"), std::nullopt);
+    ASSERT_TRUE(base::isError(handler->getJson("key1")));
+}
+
+TEST_F(KVDBHandlerValueCacheTest, LoadInvalidates)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("LoadInvalidates"));
+    auto handler = getHandler("LoadInvalidates", "scope1");
+    ASSERT_EQ(handler->set("key1", json::Json {"1"}), std::nullopt);
+    ASSERT_FALSE(base::isError(handler->getJson("key1")));
+
+    ASSERT_EQ(m_kvdbManager->loadDBFromJson("LoadInvalidates", json::Json {R"({"key1":2})"}), std::nullopt);
+    auto result = handler->getJson("key1");
+    ASSERT_FALSE(base::isError(result));
+    ASSERT_EQ(*base::getResponse(result), json::Json {"2"});
+}
+
+TEST_F(KVDBHandlerValueCacheTest, VersionChangesOnWrites)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("VersionChangesOnWrites"));
+    auto reader = getHandler("VersionChangesOnWrites", "scope1");
+    auto writer = getHandler("VersionChangesOnWrites", "scope2");
+
+    const auto first = reader->version();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_EQ(reader->version(), first);
+
+    ASSERT_EQ(writer->set("key1", json::Json {"1"}), std::nullopt);
+    const auto second = reader->version();
+    ASSERT_NE(second, first);
+
+    ASSERT_EQ(m_kvdbManager->loadDBFromJson("VersionChangesOnWrites", json::Json {R"({"key1":2})"}), std::nullopt);
+    ASSERT_NE(reader->version(), second);
+}
+
+TEST_F(KVDBHandlerValueCacheTest, SubscribersGetTheChanges)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("SubscribersGetTheChanges"));
+    auto handler = getHandler("SubscribersGetTheChanges", "scope1");
+
+    std::vector<kvdbManager::KVDBChange> changes;
+    const auto subscription = m_kvdbManager->subscribe("SubscribersGetTheChanges",
+                                                       [&changes](const kvdbManager::KVDBChange& change)
+                                                       { changes.push_back(change); });
+
+    ASSERT_EQ(handler->set("key1", json::Json {"1"}), std::nullopt);
+    ASSERT_EQ(handler->remove("key1"), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->loadDBFromJson("SubscribersGetTheChanges", json::Json {R"({"key1":2})"}), std::nullopt);
+
+    ASSERT_EQ(changes.size(), 3);
+    ASSERT_EQ(changes[0].key, "key1");
+    ASSERT_EQ(changes[1].key, "key1");
+    ASSERT_EQ(changes[2].key, std::nullopt);
+    ASSERT_EQ(changes[2].version, handler->version());
+
+    m_kvdbManager->unsubscribe(subscription);
+    ASSERT_EQ(handler->set("key1", json::Json {"3"}), std::nullopt);
+    ASSERT_EQ(changes.size(), 3);
+}
+
+TEST_F(KVDBHandlerValueCacheTest, GetJsonMalformedValue)
+{
+    ASSERT_FALSE(m_kvdbManager->createDB("GetJsonMalformedValue"));
+    auto handler = getHandler("GetJsonMalformedValue", "scope1");
+    ASSERT_EQ(handler->set("key1", "{malformed"), std::nullopt);
+
+    ASSERT_THROW(handler->getJson("key1"), std::runtime_error);
+}
+
 } // namespace
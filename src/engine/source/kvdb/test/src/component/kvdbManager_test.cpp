@@ -1,4 +1,5 @@
 #include <filesystem>
+#include <fstream>
 #include <gtest/gtest.h>
 #include <iostream>
 #include <random>
@@ -185,4 +186,243 @@ TEST_F(KVDBManagerTest, DeleteDataBaseWithRestart)
     dbList = m_kvdbManager->listDBs(true);
     ASSERT_EQ(dbList.size(), 0);
 }
+
+TEST_F(KVDBManagerTest, MemoryResidentDBWithRestart)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("MemoryResident", kvdbManager::KVDBOptions {true}), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->createDB("OnDisk"), std::nullopt);
+    ASSERT_TRUE(m_kvdbManager->isMemoryResident("MemoryResident"));
+    ASSERT_FALSE(m_kvdbManager->isMemoryResident("OnDisk"));
+
+    {
+        auto resultHandler = m_kvdbManager->getKVDBHandler("MemoryResident", "scope1");
+        ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+        ASSERT_EQ(handler->add("key1"), std::nullopt);
+    }
+
+    m_kvdbManager->finalize();
+    m_kvdbManager.reset();
+
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME};
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    m_kvdbManager->initialize();
+
+    ASSERT_TRUE(m_kvdbManager->isMemoryResident("MemoryResident"));
+    ASSERT_FALSE(m_kvdbManager->isMemoryResident("OnDisk"));
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("MemoryResident", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+    auto resultContains = handler->contains("key1");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_TRUE(std::get<bool>(resultContains));
+    handler.reset();
+
+    ASSERT_EQ(m_kvdbManager->deleteDB("MemoryResident"), std::nullopt);
+    ASSERT_FALSE(m_kvdbManager->isMemoryResident("MemoryResident"));
+    ASSERT_EQ(m_kvdbManager->createDB("MemoryResident"), std::nullopt);
+    ASSERT_FALSE(m_kvdbManager->isMemoryResident("MemoryResident"));
+}
+
+TEST_F(KVDBManagerTest, TTLDBWithRestart)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("Expiring", kvdbManager::KVDBOptions {false, 3600}), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->createDB("Persistent"), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->getTTL("Expiring"), 3600);
+    ASSERT_EQ(m_kvdbManager->getTTL("Persistent"), 0);
+
+    {
+        auto resultHandler = m_kvdbManager->getKVDBHandler("Expiring", "scope1");
+        ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+        ASSERT_EQ(handler->set("key1", "value1"), std::nullopt);
+    }
+
+    m_kvdbManager->finalize();
+    m_kvdbManager.reset();
+
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME};
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    m_kvdbManager->initialize();
+
+    ASSERT_EQ(m_kvdbManager->getTTL("Expiring"), 3600);
+    ASSERT_EQ(m_kvdbManager->getTTL("Persistent"), 0);
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("Expiring", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+
+    // The expiry is not part of the values read
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value1");
+
+    auto resultDump = handler->dump();
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    const auto& entries = std::get<std::list<std::pair<std::string, std::string>>>(resultDump);
+    ASSERT_EQ(entries.size(), 1);
+    ASSERT_EQ(entries.front().second, "value1");
+    handler.reset();
+
+    ASSERT_EQ(m_kvdbManager->deleteDB("Expiring"), std::nullopt);
+    ASSERT_EQ(m_kvdbManager->getTTL("Expiring"), 0);
+}
+
+TEST_F(KVDBManagerTest, TTLEntriesExpire)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("Expiring", kvdbManager::KVDBOptions {false, 1}), std::nullopt);
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("Expiring", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+    ASSERT_EQ(handler->set("key1", "value1"), std::nullopt);
+    ASSERT_EQ(handler->add("key2"), std::nullopt);
+
+    auto resultContains = handler->contains("key1");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_TRUE(std::get<bool>(resultContains));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+
+    // The expired entries are absent for every read
+    resultContains = handler->contains("key1");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_FALSE(std::get<bool>(resultContains));
+    ASSERT_TRUE(std::holds_alternative<base::Error>(handler->get("key1")));
+
+    auto resultDump = handler->dump();
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    ASSERT_TRUE(std::get<std::list<std::pair<std::string, std::string>>>(resultDump).empty());
+
+    auto resultScan = handler->scan("", "", 0);
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultScan));
+    ASSERT_TRUE(std::get<kvdbManager::KVDBPage>(resultScan).entries.empty());
+
+    // Writing an entry again renews it
+    ASSERT_EQ(handler->set("key1", "value2"), std::nullopt);
+    auto resultGet = handler->get("key1");
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), "value2");
+}
+
+TEST_F(KVDBManagerTest, ContainsKeyInTablesWithRestart)
+{
+    ASSERT_EQ(m_kvdbManager->createDB("ContainsKeyInTables"), std::nullopt);
+    {
+        auto resultHandler = m_kvdbManager->getKVDBHandler("ContainsKeyInTables", "scope1");
+        ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+        auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+        ASSERT_EQ(handler->set("key1", "value1"), std::nullopt);
+    }
+
+    // The memtables are flushed to the tables when the DB is opened again
+    m_kvdbManager->finalize();
+    m_kvdbManager.reset();
+
+    kvdbManager::KVDBManagerOptions kvdbManagerOptions {kvdbPath, KVDB_DB_FILENAME};
+    m_kvdbManager = std::make_shared<kvdbManager::KVDBManager>(kvdbManagerOptions, metricsManager);
+    m_kvdbManager->initialize();
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("ContainsKeyInTables", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+
+    auto resultContains = handler->contains("key1");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_TRUE(std::get<bool>(resultContains));
+
+    resultContains = handler->contains("key2");
+    ASSERT_TRUE(std::holds_alternative<bool>(resultContains));
+    ASSERT_FALSE(std::get<bool>(resultContains));
+}
+
+TEST_F(KVDBManagerTest, CreateDBFromFile)
+{
+    const auto path = std::filesystem::path(kvdbPath) / "CreateDBFromFile.json";
+    {
+        std::ofstream file(path);
+        file << R"({"key1": "value1", "key2": {"a": [1, 2.5, null], "b": {}}, "key3": [], "key4": true})";
+    }
+
+    ASSERT_EQ(m_kvdbManager->createDB("CreateDBFromFile", path.string()), std::nullopt);
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("CreateDBFromFile", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+
+    const std::map<std::string, std::string> expected {
+        {"key1", R"("value1")"}, {"key2", R"({"a":[1,2.5,null],"b":{}})"}, {"key3", "[]"}, {"key4", "true"}};
+    for (const auto& [key, value] : expected)
+    {
+        auto resultGet = handler->get(key);
+        ASSERT_TRUE(std::holds_alternative<std::string>(resultGet)) << key;
+        ASSERT_EQ(std::get<std::string>(resultGet), value);
+    }
+}
+
+TEST_F(KVDBManagerTest, CreateDBFromFileInBatches)
+{
+    constexpr auto ENTRIES = 70000;
+    // Enough entries for several batches
+    const auto path = std::filesystem::path(kvdbPath) / "CreateDBFromFileInBatches.json";
+    {
+        std::ofstream file(path);
+        file << "{";
+        for (auto i = 0; i < ENTRIES; i++)
+        {
+            file << (i ? "," : "") << fmt::format(R"("key{}":"{:064}")", i, i);
+        }
+        file << "}";
+    }
+
+    ASSERT_EQ(m_kvdbManager->createDB("CreateDBFromFileInBatches", path.string()), std::nullopt);
+
+    auto resultHandler = m_kvdbManager->getKVDBHandler("CreateDBFromFileInBatches", "scope1");
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultHandler));
+    auto handler = std::get<std::shared_ptr<kvdbManager::IKVDBHandler>>(resultHandler);
+
+    auto resultDump = handler->dump();
+    ASSERT_FALSE(std::holds_alternative<base::Error>(resultDump));
+    ASSERT_EQ(std::get<std::list<std::pair<std::string, std::string>>>(resultDump).size(), ENTRIES);
+
+    auto resultGet = handler->get(fmt::format("key{}", ENTRIES - 1));
+    ASSERT_TRUE(std::holds_alternative<std::string>(resultGet));
+    ASSERT_EQ(std::get<std::string>(resultGet), fmt::format(R"("{:064}")", ENTRIES - 1));
+}
+
+TEST_F(KVDBManagerTest, CreateDBFromFileNotObject)
+{
+    const auto path = std::filesystem::path(kvdbPath) / "CreateDBFromFileNotObject.json";
+    {
+        std::ofstream file(path);
+        file << R"(["key1", "key2"])";
+    }
+
+    auto error = m_kvdbManager->createDB("CreateDBFromFileNotObject", path.string());
+    ASSERT_TRUE(error.has_value());
+    ASSERT_EQ(error.value().message,
+              fmt::format("An error occurred while parsing the JSON file '{}': JSON is not an object", path.string()));
+    ASSERT_FALSE(m_kvdbManager->existsDB("CreateDBFromFileNotObject"));
+}
+
+TEST_F(KVDBManagerTest, CreateDBFromFileMalformed)
+{
+    const auto path = std::filesystem::path(kvdbPath) / "CreateDBFromFileMalformed.json";
+    {
+        std::ofstream file(path);
+        file << R"({"key1": "value1", "key2": )";
+    }
+
+    auto error = m_kvdbManager->createDB("CreateDBFromFileMalformed", path.string());
+    ASSERT_TRUE(error.has_value());
+    ASSERT_FALSE(m_kvdbManager->existsDB("CreateDBFromFileMalformed"));
+}
+
+TEST_F(KVDBManagerTest, CreateDBFromFileNotExists)
+{
+    auto error = m_kvdbManager->createDB("CreateDBFromFileNotExists", "/tmp/kvdb_not_exists.json");
+    ASSERT_TRUE(error.has_value());
+    ASSERT_FALSE(m_kvdbManager->existsDB("CreateDBFromFileNotExists"));
+}
 } // namespace
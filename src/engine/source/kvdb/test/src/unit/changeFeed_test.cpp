@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <kvdb/changeFeed.hpp>
+
+using namespace kvdbManager;
+
+TEST(ChangeFeedTest, PublishBumpsVersion)
+{
+    ChangeFeed feed;
+    auto channel = feed.channel("db");
+    const auto version = channel->version();
+
+    feed.publish("db", "key");
+    ASSERT_EQ(channel->version(), version + 1);
+    ASSERT_EQ(feed.channel("db"), channel);
+
+    feed.publish("other", "key");
+    ASSERT_EQ(channel->version(), version + 1);
+}
+
+TEST(ChangeFeedTest, SubscribersGetTheChanges)
+{
+    ChangeFeed feed;
+    std::vector<KVDBChange> changes;
+    feed.subscribe("db", [&changes](const KVDBChange& change) { changes.push_back(change); });
+
+    feed.publish("db", "key");
+    feed.publish("db", std::nullopt);
+    feed.publish("other", "key");
+
+    ASSERT_EQ(changes.size(), 2);
+    ASSERT_EQ(changes[0].dbName, "db");
+    ASSERT_EQ(changes[0].key, "key");
+    ASSERT_EQ(changes[1].key, std::nullopt);
+    ASSERT_EQ(changes[1].version, feed.channel("db")->version());
+    ASSERT_LT(changes[0].version, changes[1].version);
+}
+
+TEST(ChangeFeedTest, Unsubscribe)
+{
+    ChangeFeed feed;
+    auto calls = 0;
+    const auto subscription = feed.subscribe("db", [&calls](const KVDBChange&) { ++calls; });
+
+    feed.publish("db", "key");
+    feed.unsubscribe(subscription);
+    feed.publish("db", "key");
+    feed.unsubscribe(subscription);
+
+    ASSERT_EQ(calls, 1);
+}
@@ -0,0 +1,47 @@
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <kvdb/ttl.hpp>
+
+using namespace kvdbManager;
+
+TEST(TTLTest, EncodePayload)
+{
+    const auto stored = ttl::encode("value", 1000);
+    ASSERT_EQ(stored.size(), ttl::HEADER_SIZE + 5);
+    ASSERT_EQ(ttl::payload(stored).ToString(), "value");
+
+    const auto empty = ttl::encode("", 1000);
+    ASSERT_EQ(empty.size(), ttl::HEADER_SIZE);
+    ASSERT_EQ(ttl::payload(empty).ToString(), "");
+}
+
+TEST(TTLTest, Expiry)
+{
+    const int64_t expiry {1700000000123};
+    const auto stored = ttl::encode("value", expiry);
+    ASSERT_FALSE(ttl::isExpired(stored, expiry - 1));
+    ASSERT_TRUE(ttl::isExpired(stored, expiry));
+    ASSERT_TRUE(ttl::isExpired(stored, expiry + 1));
+}
+
+TEST(TTLTest, ShortValuesNeverExpire)
+{
+    const std::string stored {"abc"};
+    ASSERT_FALSE(ttl::isExpired(stored, std::numeric_limits<int64_t>::max()));
+    ASSERT_EQ(ttl::payload(stored).ToString(), stored);
+}
+
+TEST(TTLTest, CompactionFilter)
+{
+    const auto* filter = ttl::compactionFilter();
+    ASSERT_EQ(filter, ttl::compactionFilter());
+
+    std::string newValue;
+    bool valueChanged {false};
+    const auto now = ttl::nowMs();
+    ASSERT_TRUE(filter->Filter(0, "key", ttl::encode("value", now - 1), &newValue, &valueChanged));
+    ASSERT_FALSE(filter->Filter(0, "key", ttl::encode("value", now + 60 * 1000), &newValue, &valueChanged));
+    ASSERT_FALSE(valueChanged);
+}
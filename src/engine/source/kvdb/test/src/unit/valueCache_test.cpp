@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+
+#include <kvdb/valueCache.hpp>
+
+using namespace kvdbManager;
+
+namespace
+{
+std::shared_ptr<const json::Json> value(const std::string& raw)
+{
+    return std::make_shared<const json::Json>(raw.c_str());
+}
+} // namespace
+
+TEST(ValueCacheTest, GetMiss)
+{
+    ValueCache cache(100);
+    ASSERT_EQ(cache.get("key"), nullptr);
+}
+
+TEST(ValueCacheTest, PutGet)
+{
+    ValueCache cache(100);
+    auto cached = value("1");
+    cache.put("key", cached, 10, cache.version());
+
+    ASSERT_EQ(cache.get("key"), cached);
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(cache.bytes(), 10);
+}
+
+TEST(ValueCacheTest, PutReplaces)
+{
+    ValueCache cache(100);
+    cache.put("key", value("1"), 10, cache.version());
+    auto cached = value("2");
+    cache.put("key", cached, 20, cache.version());
+
+    ASSERT_EQ(cache.get("key"), cached);
+    ASSERT_EQ(cache.size(), 1);
+    ASSERT_EQ(cache.bytes(), 20);
+}
+
+TEST(ValueCacheTest, PutStaleVersionDiscarded)
+{
+    ValueCache cache(100);
+    const auto version = cache.version();
+    cache.invalidate("key");
+    cache.put("key", value("1"), 10, version);
+
+    ASSERT_EQ(cache.get("key"), nullptr);
+    ASSERT_EQ(cache.bytes(), 0);
+}
+
+TEST(ValueCacheTest, PutLargerThanLimitDiscarded)
+{
+    ValueCache cache(100);
+    cache.put("key", value("1"), 101, cache.version());
+
+    ASSERT_EQ(cache.get("key"), nullptr);
+    ASSERT_EQ(cache.size(), 0);
+}
+
+TEST(ValueCacheTest, EvictsLeastRecentlyUsed)
+{
+    ValueCache cache(30);
+    cache.put("key1", value("1"), 10, cache.version());
+    cache.put("key2", value("2"), 10, cache.version());
+    cache.put("key3", value("3"), 10, cache.version());
+
+    // key1 becomes the most recently used
+    ASSERT_NE(cache.get("key1"), nullptr);
+    cache.put("key4", value("4"), 10, cache.version());
+
+    ASSERT_NE(cache.get("key1"), nullptr);
+    ASSERT_EQ(cache.get("key2"), nullptr);
+    ASSERT_NE(cache.get("key3"), nullptr);
+    ASSERT_NE(cache.get("key4"), nullptr);
+    ASSERT_EQ(cache.bytes(), 30);
+}
+
+TEST(ValueCacheTest, Invalidate)
+{
+    ValueCache cache(100);
+    cache.put("key1", value("1"), 10, cache.version());
+    cache.put("key2", value("2"), 10, cache.version());
+    cache.invalidate("key1");
+
+    ASSERT_EQ(cache.get("key1"), nullptr);
+    ASSERT_NE(cache.get("key2"), nullptr);
+    ASSERT_EQ(cache.bytes(), 10);
+}
+
+TEST(ValueCacheTest, Clear)
+{
+    ValueCache cache(100);
+    const auto version = cache.version();
+    cache.put("key1", value("1"), 10, version);
+    cache.clear();
+
+    ASSERT_EQ(cache.get("key1"), nullptr);
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.bytes(), 0);
+    ASSERT_NE(cache.version(), version);
+}
@@ -1,9 +1,11 @@
 #ifndef _LOGICEXPR_EVALUATOR_H
 #define _LOGICEXPR_EVALUATOR_H
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
-#include <stack>
 #include <stdexcept>
 #include <vector>
 
@@ -125,86 +127,313 @@ private:
     }
 };
 
+namespace detail
+{
+
 /**
- * @brief Get the Dijstra Evaluator function from a logic expression tree
+ * @brief Expression tree where the operands of chained ANDs (or ORs) are gathered in a single operator.
  *
  * @tparam Event
- * @param expression root expression
- * @return Expression<Event>::FunctionType
  */
 template<typename Event>
-typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
+struct Node
 {
-    // Struct for operators stack
-    struct Operator
+    ExpressionType m_type;                               ///< Node type.
+    typename Expression<Event>::FunctionType m_function; ///< Term function, only for TERM nodes.
+    std::vector<Node> m_operands;                        ///< Operands, 1 for NOT, 2 or more for AND and OR.
+    std::size_t m_cost {1};                              ///< Number of terms below the node.
+    std::size_t m_stat {0};                              ///< Statistics slot of the node as an AND/OR operand.
+};
+
+/**
+ * @brief Statistics of an AND/OR operand.
+ *
+ */
+struct Stat
+{
+    std::uint32_t m_evals {0}; ///< Times the operand has been evaluated.
+    std::uint32_t m_hits {0};  ///< Times the operand has decided the operator (false for AND, true for OR).
+};
+
+/**
+ * @brief Instruction of a compiled expression.
+ *
+ * Instructions work on a single boolean register: terms set it, NOT negates it and the jumps skip the remaining
+ * operands of an AND (OR) when it is false (true).
+ */
+template<typename Event>
+struct Instruction
+{
+    enum class Code
     {
-        ExpressionType m_type;
-        typename Expression<Event>::FunctionType m_function;
+        TERM,
+        NOT,
+        JUMP_IF_FALSE,
+        JUMP_IF_TRUE
     };
 
-    // Operators stack, while semantically it is a stack of operators a vector
-    // is used to iterate and avoid moving data
-    std::vector<Operator> operators;
+    Code m_code;                                         ///< Instruction code.
+    typename Expression<Event>::FunctionType m_function; ///< Term function, only for TERM.
+    std::size_t m_jump {0};                              ///< Target of the jumps.
+    std::size_t m_stat {0};                              ///< Statistics slot of the operand ended by a jump.
+};
+
+template<typename Event>
+using Program = std::vector<Instruction<Event>>;
+
+/**
+ * @brief Builds the node tree of an expression, gathering chained ANDs (ORs) in a single operator.
+ *
+ * @param expression Expression tree.
+ * @param stats Number of statistics slots used so far, one per AND/OR operand.
+ * @return Node<Event>
+ * @throws std::runtime_error if the expression has unknown or missing nodes.
+ */
+template<typename Event>
+Node<Event> buildNode(const std::shared_ptr<const Expression<Event>>& expression, std::size_t& stats)
+{
+    if (!expression)
+    {
+        throw std::runtime_error("Engine logic expression evaluator got an operator without operands.");
+    }
 
-    // Visitor to poputale operators stack
-    auto visitor = [&operators](const Expression<Event>& expression)
+    Node<Event> node {expression->m_type, nullptr, {}};
+    switch (expression->m_type)
     {
-        if (expression.m_type == ExpressionType::TERM)
+        case ExpressionType::TERM: node.m_function = expression->m_function; return node;
+        case ExpressionType::NOT:
+            node.m_operands.emplace_back(buildNode<Event>(expression->m_left, stats));
+            node.m_cost = node.m_operands.back().m_cost;
+            return node;
+        case ExpressionType::AND:
+        case ExpressionType::OR:
         {
-            operators.push_back({expression.m_type, expression.m_function});
+            // Gather the operands of the chained operators of the same type, in evaluation order
+            std::vector<std::shared_ptr<const Expression<Event>>> pending {expression->m_right, expression->m_left};
+            node.m_cost = 0;
+            while (!pending.empty())
+            {
+                auto operand = pending.back();
+                pending.pop_back();
+                if (operand && operand->m_type == expression->m_type)
+                {
+                    pending.push_back(operand->m_right);
+                    pending.push_back(operand->m_left);
+                    continue;
+                }
+
+                node.m_operands.emplace_back(buildNode<Event>(operand, stats));
+                node.m_operands.back().m_stat = stats++;
+                node.m_cost += node.m_operands.back().m_cost;
+            }
+            return node;
         }
-        else
+        default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
+    }
+}
+
+/**
+ * @brief Appends the instructions of a node to a program.
+ *
+ * @param node Node to compile.
+ * @param program Program being compiled.
+ */
+template<typename Event>
+void compile(const Node<Event>& node, Program<Event>& program)
+{
+    using Code = typename Instruction<Event>::Code;
+
+    switch (node.m_type)
+    {
+        case ExpressionType::TERM: program.push_back({Code::TERM, node.m_function}); break;
+        case ExpressionType::NOT:
+            compile(node.m_operands.front(), program);
+            program.push_back({Code::NOT, nullptr});
+            break;
+        default:
         {
-            operators.push_back({expression.m_type, nullptr});
+            // Every operand is followed by a jump to the end, the last one only records its statistics
+            const auto code = node.m_type == ExpressionType::AND ? Code::JUMP_IF_FALSE : Code::JUMP_IF_TRUE;
+            std::vector<std::size_t> jumps;
+            for (const auto& operand : node.m_operands)
+            {
+                compile(operand, program);
+                jumps.push_back(program.size());
+                program.push_back({code, nullptr, 0, operand.m_stat});
+            }
+            for (auto jump : jumps)
+            {
+                program[jump].m_jump = program.size();
+            }
         }
+    }
+}
+
+/**
+ * @brief Runs a compiled program.
+ *
+ * @tparam Count Whether to record the statistics of the AND/OR operands.
+ * @param program Compiled program.
+ * @param event Event to evaluate.
+ * @param stats Statistics slots, only used if Count.
+ * @return bool Result of the expression, false for an empty program.
+ */
+template<bool Count, typename Event>
+bool run(const Program<Event>& program, const Event& event, Stat* stats)
+{
+    using Code = typename Instruction<Event>::Code;
+
+    bool result {false};
+    std::size_t pc {0};
+    while (pc < program.size())
+    {
+        const auto& instruction = program[pc];
+        switch (instruction.m_code)
+        {
+            case Code::TERM:
+                result = instruction.m_function(event);
+                ++pc;
+                break;
+            case Code::NOT:
+                result = !result;
+                ++pc;
+                break;
+            default:
+            {
+                const bool decided = (instruction.m_code == Code::JUMP_IF_TRUE) == result;
+                if constexpr (Count)
+                {
+                    ++stats[instruction.m_stat].m_evals;
+                    stats[instruction.m_stat].m_hits += decided;
+                }
+                pc = decided ? instruction.m_jump : pc + 1;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Sorts the AND/OR operands so the cheapest ones that most often decide the operator go first.
+ *
+ * Operands are ranked by cost over the estimated probability of deciding the operator, which is the order that
+ * minimizes the expected number of terms evaluated when operands are independent.
+ *
+ * @param node Node to reorder, recursively.
+ * @param stats Statistics of the operands.
+ */
+template<typename Event>
+void reorder(Node<Event>& node, const std::vector<Stat>& stats)
+{
+    for (auto& operand : node.m_operands)
+    {
+        reorder(operand, stats);
+    }
+
+    if (node.m_type != ExpressionType::AND && node.m_type != ExpressionType::OR)
+    {
+        return;
+    }
+
+    auto rank = [&stats](const Node<Event>& operand)
+    {
+        const auto& stat = stats[operand.m_stat];
+        return static_cast<double>(operand.m_cost) * (stat.m_evals + 2.0) / (stat.m_hits + 1.0);
     };
+    std::stable_sort(node.m_operands.begin(),
+                     node.m_operands.end(),
+                     [&rank](const Node<Event>& lhs, const Node<Event>& rhs) { return rank(lhs) < rank(rhs); });
+}
 
-    Expression<Event>::visitPreOrder(expression, visitor);
+} // namespace detail
+
+/**
+ * @brief Get the Dijstra Evaluator function from a logic expression tree
+ *
+ * The tree is compiled into a flat program evaluated in source order that stops evaluating the operands of an AND
+ * (OR) as soon as one is false (true).
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @return Expression<Event>::FunctionType
+ * @throws std::runtime_error if the expression has unknown or missing nodes.
+ */
+template<typename Event>
+typename Expression<Event>::FunctionType getDijstraEvaluator(const std::shared_ptr<const Expression<Event>>& expression)
+{
+    detail::Program<Event> program;
+    if (expression)
+    {
+        std::size_t stats {0};
+        detail::compile(detail::buildNode<Event>(expression, stats), program);
+    }
 
     // Evaluator function
-    return [operators](Event event) -> bool
+    return [program = std::move(program)](Event event) -> bool
+    {
+        return detail::run<false>(program, event, nullptr);
+    };
+}
+
+/**
+ * @brief Get an evaluator function that reorders the AND/OR operands from the results seen so far.
+ *
+ * Every `period` evaluations the operands of each AND (OR) are sorted to try first the cheapest ones that are most
+ * often false (true), and the statistics are halved to follow changes in the events. Terms must have no side
+ * effects, as the order in which they are evaluated changes.
+ *
+ * The returned function keeps its own statistics: a single instance must not be called concurrently, while copies
+ * are independent from each other.
+ *
+ * @tparam Event
+ * @param expression root expression
+ * @param period Evaluations between reorders.
+ * @return Expression<Event>::FunctionType
+ * @throws std::runtime_error if the expression has unknown or missing nodes or period is 0.
+ */
+template<typename Event>
+typename Expression<Event>::FunctionType
+getAdaptiveEvaluator(const std::shared_ptr<const Expression<Event>>& expression, std::size_t period = 1024)
+{
+    if (period == 0)
+    {
+        throw std::runtime_error("Engine logic expression evaluator got a reorder period of 0.");
+    }
+
+    if (!expression)
     {
-        std::stack<bool> operands;
-        bool result {false};
+        return getDijstraEvaluator<Event>(expression);
+    }
 
-        for (auto it = operators.crbegin(); it != operators.crend(); ++it)
+    std::size_t statsSize {0};
+    auto root = detail::buildNode<Event>(expression, statsSize);
+    if (statsSize == 0)
+    {
+        return getDijstraEvaluator<Event>(expression);
+    }
+
+    detail::Program<Event> program;
+    detail::compile(root, program);
+
+    return [root = std::move(root),
+            program = std::move(program),
+            stats = std::vector<detail::Stat>(statsSize),
+            period,
+            countdown = period](Event event) mutable -> bool
+    {
+        const auto result = detail::run<true>(program, event, stats.data());
+        if (--countdown == 0)
         {
-            switch (it->m_type)
+            detail::reorder(root, stats);
+            program.clear();
+            detail::compile(root, program);
+            for (auto& stat : stats)
             {
-                case ExpressionType::TERM:
-                    // Handle only term expression
-                    // TODO: dont allow expressions with one term only, use check list
-                    // instead
-                    if (operators.size() == 1)
-                    {
-                        result = it->m_function(event);
-                    }
-                    else
-                    {
-                        operands.push(it->m_function(event));
-                    }
-                    break;
-                case ExpressionType::NOT:
-                    result = !operands.top();
-                    operands.pop();
-                    operands.push(result);
-                    break;
-                case ExpressionType::AND:
-                    result = operands.top();
-                    operands.pop();
-                    result = result && operands.top();
-                    operands.pop();
-                    operands.push(result);
-                    break;
-                case ExpressionType::OR:
-                    result = operands.top();
-                    operands.pop();
-                    result = result || operands.top();
-                    operands.pop();
-                    operands.push(result);
-                    break;
-                default: throw std::runtime_error("Engine logic expression evaluator got unknown operator type.");
+                stat.m_evals /= 2;
+                stat.m_hits /= 2;
             }
+            countdown = period;
         }
 
         return result;
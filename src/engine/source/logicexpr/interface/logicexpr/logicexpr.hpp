@@ -15,21 +15,20 @@ namespace logicexpr
 {
 
 /**
- * @brief Generate evaluation function from a string logic expression.
+ * @brief Generate the expression tree, with all term's functions, from a string logic expression.
  * This function parses the string and generates a token tree, then uses the
  * provided builder to generate the expression tree with all term's functions.
- * Finally generates the function from built expression tree.
  *
  * @tparam Event Type of the event to be evaluated.
  * @param expression String logic expression.
  * @param termBuilder Builder to generate the term's evaluation function from
  * its description.
  * @param termParser Parser to parse the term's of the expression.
- * @return std::function<bool(Event)> Evaluation function.
+ * @return std::shared_ptr<evaluator::Expression<Event>> Root of the expression tree.
  */
 template<typename Event, typename TermType, typename TermBuilder, typename TermParser>
-std::function<bool(Event)>
-buildDijstraEvaluator(const std::string& expression, TermBuilder&& termBuilder, TermParser&& termParser)
+std::shared_ptr<evaluator::Expression<Event>>
+buildExpressionTree(const std::string& expression, TermBuilder&& termBuilder, TermParser&& termParser)
 {
 
     // visitor to generate an evaluator::Expression tree from a
@@ -74,12 +73,53 @@ buildDijstraEvaluator(const std::string& expression, TermBuilder&& termBuilder,
             fmt::format("Engine logic expression: Unexpected token type of token '{}'", tokenExpr->m_token->text()));
     };
 
-    // Parse, build and return the evaluator function.
+    // Parse, build and return the expression tree.
     auto tokenExpression = parser::parse(expression, std::forward<TermParser>(termParser));
-    auto builtExprPtr = visit(tokenExpression, visit);
-    auto evaluatorFunction = evaluator::getDijstraEvaluator<Event>(builtExprPtr);
+    return visit(tokenExpression, visit);
+}
 
-    return evaluatorFunction;
+/**
+ * @brief Generate evaluation function from a string logic expression.
+ * The expression tree is built with buildExpressionTree and compiled into a
+ * function that evaluates the operands in source order.
+ *
+ * @tparam Event Type of the event to be evaluated.
+ * @param expression String logic expression.
+ * @param termBuilder Builder to generate the term's evaluation function from
+ * its description.
+ * @param termParser Parser to parse the term's of the expression.
+ * @return std::function<bool(Event)> Evaluation function.
+ */
+template<typename Event, typename TermType, typename TermBuilder, typename TermParser>
+std::function<bool(Event)>
+buildDijstraEvaluator(const std::string& expression, TermBuilder&& termBuilder, TermParser&& termParser)
+{
+    auto builtExprPtr = buildExpressionTree<Event, TermType>(
+        expression, std::forward<TermBuilder>(termBuilder), std::forward<TermParser>(termParser));
+    return evaluator::getDijstraEvaluator<Event>(builtExprPtr);
+}
+
+/**
+ * @brief Generate an evaluation function that reorders the AND/OR operands
+ * from the results seen so far, see evaluator::getAdaptiveEvaluator.
+ *
+ * @tparam Event Type of the event to be evaluated.
+ * @param expression String logic expression.
+ * @param termBuilder Builder to generate the term's evaluation function from
+ * its description, the functions must have no side effects.
+ * @param termParser Parser to parse the term's of the expression.
+ * @param period Evaluations between reorders.
+ * @return std::function<bool(Event)> Evaluation function.
+ */
+template<typename Event, typename TermType, typename TermBuilder, typename TermParser>
+std::function<bool(Event)> buildAdaptiveEvaluator(const std::string& expression,
+                                                  TermBuilder&& termBuilder,
+                                                  TermParser&& termParser,
+                                                  std::size_t period = 1024)
+{
+    auto builtExprPtr = buildExpressionTree<Event, TermType>(
+        expression, std::forward<TermBuilder>(termBuilder), std::forward<TermParser>(termParser));
+    return evaluator::getAdaptiveEvaluator<Event>(builtExprPtr, period);
 }
 
 } // namespace logicexpr
@@ -107,3 +107,73 @@ TEST(LogicExpressionEvaluator, getDijstraEvaluatorSingleTerm)
     EXPECT_TRUE(evaluator(6));
     EXPECT_FALSE(evaluator(7));
 }
+
+TEST(LogicExpressionEvaluator, getDijstraEvaluatorShortCircuit)
+{
+    // True if: i>1 or pair or i>5, the terms after a true one are not evaluated
+    std::vector<int> calls(3, 0);
+    auto term = [&calls](size_t n, auto fn)
+    {
+        return Expression<int>::create(
+            [&calls, n, fn](int i)
+            {
+                ++calls[n];
+                return fn(i);
+            });
+    };
+    auto root = Expression<int>::create(ExpressionType::OR);
+    root->m_left = Expression<int>::create(ExpressionType::OR);
+    root->m_left->m_left = term(0, [](int i) { return i > 1; });
+    root->m_left->m_right = term(1, [](int i) { return i % 2 == 0; });
+    root->m_right = term(2, [](int i) { return i > 5; });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_NO_THROW(evaluator = getDijstraEvaluator<int>(root));
+
+    EXPECT_TRUE(evaluator(7));
+    EXPECT_EQ(calls, (std::vector<int> {1, 0, 0}));
+    EXPECT_TRUE(evaluator(0));
+    EXPECT_EQ(calls, (std::vector<int> {2, 1, 0}));
+    EXPECT_FALSE(evaluator(1));
+    EXPECT_EQ(calls, (std::vector<int> {3, 2, 1}));
+}
+
+TEST(LogicExpressionEvaluator, getDijstraEvaluatorMissingOperand)
+{
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create([](int i) { return i > 1; });
+    EXPECT_THROW(getDijstraEvaluator<int>(root), std::runtime_error);
+}
+
+TEST(LogicExpressionEvaluator, getAdaptiveEvaluator)
+{
+    // True if: i<1000 and pair, pair is false more often so it ends up first
+    int calls {0};
+    auto root = Expression<int>::create(ExpressionType::AND);
+    root->m_left = Expression<int>::create(
+        [&calls](int i)
+        {
+            ++calls;
+            return i < 1000;
+        });
+    root->m_right = Expression<int>::create(ExpressionType::NOT);
+    root->m_right->m_left = Expression<int>::create([](int i) { return i % 2 != 0; });
+
+    std::function<bool(int)> evaluator;
+    ASSERT_THROW(getAdaptiveEvaluator<int>(root, 0), std::runtime_error);
+    ASSERT_NO_THROW(evaluator = getAdaptiveEvaluator<int>(root, 16));
+
+    for (auto i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(evaluator(i), i % 2 == 0);
+    }
+    EXPECT_EQ(calls, 16);
+
+    calls = 0;
+    for (auto i = 0; i < 16; ++i)
+    {
+        EXPECT_EQ(evaluator(i), i % 2 == 0);
+    }
+    EXPECT_EQ(calls, 8);
+    EXPECT_FALSE(evaluator(2000));
+}
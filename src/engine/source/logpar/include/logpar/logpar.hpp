@@ -3,6 +3,7 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -382,6 +383,22 @@ private:
     std::unordered_map<SchemaType, ParserType> m_typeParsers;
     std::unordered_map<ParserType, ParserBuilder> m_parserBuilders;
 
+    /**
+     * @brief Node of the prefix trie, the parser of a segment of an expression (up to and including a top level
+     * literal). Its result is cached per input, so expressions sharing the prefix parse it only once.
+     */
+    struct PrefixNode
+    {
+        std::size_t id; ///< Unique identifier, the key of the cached results
+        Hlp parser;     ///< Parser of the segment
+    };
+
+    mutable std::mutex m_prefixMutex; ///< Protects m_prefixNodes
+    mutable std::unordered_map<std::string, std::weak_ptr<const PrefixNode>> m_prefixNodes; ///< Prefix key -> node
+
+    mutable std::mutex m_exprMutex;                                                 ///< Protects m_exprParsers
+    mutable std::unordered_map<std::string, std::weak_ptr<const Hlp>> m_exprParsers; ///< Expression -> parser
+
     // build the parsers from the different parser info types
     Hlp buildLiteralParser(const parser::Literal& literal) const;
     Hlp buildFieldParser(const parser::Field& field, const std::vector<std::string>& endTokens = {}) const;
@@ -391,6 +408,13 @@ private:
     // build the parsers while adding the target field to the json
     Hlp buildParsers(const std::list<parser::ParserInfo>& parserInfos, size_t recurLvl) const;
 
+    // build the parser of a logpar expression, without looking up the ones already built
+    Hlp buildExpression(std::string_view logpar) const;
+
+    // get the node of the prefix trie for the given prefix key, building the segment parser if needed
+    std::shared_ptr<const PrefixNode> getPrefixNode(const std::string& key,
+                                                    const std::list<parser::ParserInfo>& segment) const;
+
 public:
     /**
      * @brief Construct a new Logpar object
@@ -421,6 +445,13 @@ public:
      *
      * The parser returned will return a json object with the parsed fields if any
      *
+     * The expression is split after each top level literal, and every prefix is a node of a trie shared by all the
+     * expressions built by this logpar. When sibling decoders parse the same input, a common prefix (i.e. a syslog
+     * header) is parsed once and its result is reused by the rest of them.
+     *
+     * The parsers are also shared by expression, building an expression again while its parser is alive (i.e. the
+     * same fragment in several assets) returns the same parser without parsing the expression.
+     *
      * @param logpar the logpar expression
      * @return parsec::Parser<json::Json> the parser
      * @throws std::runtime_error if errors occur while building the parser
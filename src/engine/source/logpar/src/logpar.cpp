@@ -1,9 +1,11 @@
 #include "logpar.hpp"
 
+#include <atomic>
 #include <list>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 #include <fmt/format.h>
 
@@ -220,20 +222,24 @@ parsec::Result<Group> pG(std::string_view text, size_t i)
     }
     lastIdx = resStart.index();
 
-    parsec::Parser<Group> pGfn = pG;
-    auto pGmap =
-        parsec::fmap<parsec::Values<ParserInfo>, Group>([](auto v) { return parsec::Values<ParserInfo> {v}; }, pGfn);
-    auto pBody = parsec::fmap<parsec::Values<ParserInfo>, parsec::Values<parsec::Values<ParserInfo>>>(
-        [](auto v)
-        {
-            parsec::Values<ParserInfo> merge {};
-            for (auto& vv : v)
+    // Built once, the parsers of the body are the same for every group
+    static const auto pBody = []()
+    {
+        parsec::Parser<Group> pGfn = pG;
+        auto pGmap = parsec::fmap<parsec::Values<ParserInfo>, Group>(
+            [](auto v) { return parsec::Values<ParserInfo> {v}; }, pGfn);
+        return parsec::fmap<parsec::Values<ParserInfo>, parsec::Values<parsec::Values<ParserInfo>>>(
+            [](auto v)
             {
-                merge.splice(merge.end(), vv);
-            }
-            return merge;
-        },
-        parsec::many1(pExpr() | pGmap));
+                parsec::Values<ParserInfo> merge {};
+                for (auto& vv : v)
+                {
+                    merge.splice(merge.end(), vv);
+                }
+                return merge;
+            },
+            parsec::many1(pExpr() | pGmap));
+    }();
 
     auto resBody = pBody(text, lastIdx);
     if (resBody.failure())
@@ -283,6 +289,111 @@ parsec::Parser<std::list<ParserInfo>> pLogpar()
 
 namespace hlp::logpar
 {
+namespace
+{
+/**
+ * @brief Results of the prefix nodes for the last input parsed by the thread.
+ */
+struct PrefixCache
+{
+    std::string input;                                            ///< Copy of the last input
+    std::unordered_map<std::size_t, hlp::parser::Result> results; ///< Node id -> result
+};
+
+PrefixCache& prefixCache()
+{
+    thread_local PrefixCache cache;
+    return cache;
+}
+
+std::atomic<std::size_t> g_nextPrefixNodeId {0};
+
+std::string escapeKey(std::string_view text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (auto c : text)
+    {
+        if (c == syntax::EXPR_ESCAPE || c == syntax::EXPR_BEGIN || c == syntax::EXPR_END || c == syntax::EXPR_ARG_SEP
+            || c == syntax::EXPR_OPT || c == syntax::EXPR_GROUP_BEGIN || c == syntax::EXPR_GROUP_END)
+        {
+            escaped += syntax::EXPR_ESCAPE;
+        }
+        escaped += c;
+    }
+
+    return escaped;
+}
+
+std::string fieldKey(const parser::Field& field)
+{
+    std::string key {syntax::EXPR_BEGIN};
+    if (field.optional)
+    {
+        key += syntax::EXPR_OPT;
+    }
+    key += field.name.value;
+    for (const auto& arg : field.args)
+    {
+        key += syntax::EXPR_ARG_SEP;
+        key += escapeKey(arg);
+    }
+    key += syntax::EXPR_END;
+
+    return key;
+}
+
+/**
+ * @brief Canonical form of a parser info, the infos with the same key build the same parser.
+ */
+std::string infoKey(const parser::ParserInfo& info)
+{
+    return std::visit(
+        [](const auto& value) -> std::string
+        {
+            using T = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<T, parser::Literal>)
+            {
+                return escapeKey(value.value);
+            }
+            else if constexpr (std::is_same_v<T, parser::Field>)
+            {
+                return fieldKey(value);
+            }
+            else if constexpr (std::is_same_v<T, parser::Choice>)
+            {
+                return fieldKey(value.left) + syntax::EXPR_OPT + fieldKey(value.right);
+            }
+            else
+            {
+                std::string key {syntax::EXPR_GROUP_BEGIN, syntax::EXPR_OPT};
+                for (const auto& child : value.children)
+                {
+                    key += infoKey(child);
+                }
+                key += syntax::EXPR_GROUP_END;
+                return key;
+            }
+        },
+        info);
+}
+
+/**
+ * @brief Drops the expired entries of a cache of weak pointers before it grows.
+ */
+template<typename Cache>
+void dropExpired(Cache& cache)
+{
+    if (cache.size() >= cache.bucket_count())
+    {
+        for (auto it = cache.begin(); it != cache.end();)
+        {
+            it = it->second.expired() ? cache.erase(it) : std::next(it);
+        }
+    }
+}
+} // namespace
+
 Logpar::Logpar(const json::Json& ecsFieldTypes,
                const std::shared_ptr<schemf::ISchema>& schema,
                size_t maxGroupRecursion,
@@ -635,16 +746,141 @@ void Logpar::registerBuilder(ParserType type, const ParserBuilder& builder)
 
 Logpar::Hlp Logpar::build(std::string_view logpar) const
 {
-    auto result = parser::pLogpar()(logpar, 0);
+    std::string key {logpar};
+    std::shared_ptr<const Hlp> parser;
+    {
+        std::lock_guard lock {m_exprMutex};
+        auto it = m_exprParsers.find(key);
+        if (it != m_exprParsers.end())
+        {
+            parser = it->second.lock();
+        }
+    }
+
+    // Built without the lock, as building may take a while. If another thread built it meanwhile, its parser is kept
+    if (!parser)
+    {
+        auto built = std::make_shared<const Hlp>(buildExpression(logpar));
+
+        std::lock_guard lock {m_exprMutex};
+        auto it = m_exprParsers.find(key);
+        if (it != m_exprParsers.end())
+        {
+            parser = it->second.lock();
+        }
+        if (!parser)
+        {
+            dropExpired(m_exprParsers);
+            parser = std::move(built);
+            m_exprParsers[key] = parser;
+        }
+    }
+
+    return [parser = std::move(parser)](std::string_view text) -> hlp::parser::Result
+    {
+        return (*parser)(text);
+    };
+}
+
+Logpar::Hlp Logpar::buildExpression(std::string_view logpar) const
+{
+    // The grammar does not depend on the instance, it is built once
+    static const auto pLogpar = parser::pLogpar();
+
+    auto result = pLogpar(logpar, 0);
     if (result.failure())
     {
         throw std::runtime_error(parsec::formatTrace(logpar, result.trace(), 1));
     }
 
     auto parserInfos = result.value();
-    auto p = buildParsers(parserInfos, 0);
 
-    return hlp::parser::combinator::all({p, hlp::parsers::getEofParser({.name = "EOF"})});
+    // Split after each top level literal, so the end tokens of every segment are resolved inside it
+    std::vector<std::shared_ptr<const PrefixNode>> nodes;
+    std::string key;
+    auto segmentBegin = parserInfos.begin();
+    for (auto it = parserInfos.begin(); it != parserInfos.end(); ++it)
+    {
+        key += infoKey(*it);
+        if (std::holds_alternative<parser::Literal>(*it))
+        {
+            nodes.emplace_back(getPrefixNode(key, std::list<parser::ParserInfo>(segmentBegin, std::next(it))));
+            segmentBegin = std::next(it);
+        }
+    }
+
+    auto eof = hlp::parsers::getEofParser({.name = "EOF"});
+    if (nodes.empty())
+    {
+        return hlp::parser::combinator::all({buildParsers(parserInfos, 0), eof});
+    }
+
+    std::list<parser::ParserInfo> restInfos(segmentBegin, parserInfos.end());
+    auto rest = restInfos.empty() ? eof : hlp::parser::combinator::all({buildParsers(restInfos, 0), eof});
+
+    return [nodes = std::move(nodes), rest = std::move(rest)](std::string_view text) -> hlp::parser::Result
+    {
+        auto& cache = prefixCache();
+        if (cache.input != text)
+        {
+            cache.input.assign(text.data(), text.size());
+            cache.results.clear();
+        }
+
+        std::string_view remaining {cache.input};
+        hlp::parser::Result::Nested results;
+        results.reserve(nodes.size() + 1);
+        for (const auto& node : nodes)
+        {
+            auto it = cache.results.find(node->id);
+            if (it == cache.results.end())
+            {
+                it = cache.results.emplace(node->id, node->parser(remaining)).first;
+            }
+
+            if (it->second.failure())
+            {
+                return it->second;
+            }
+
+            remaining = it->second.remaining();
+            results.emplace_back(it->second);
+        }
+
+        auto restResult = rest(remaining);
+        if (restResult.failure())
+        {
+            return restResult;
+        }
+
+        remaining = restResult.remaining();
+        results.emplace_back(std::move(restResult));
+        return hlp::abs::makeSuccess<hlp::parser::ResultT>(remaining, std::move(results));
+    };
+}
+
+std::shared_ptr<const Logpar::PrefixNode> Logpar::getPrefixNode(const std::string& key,
+                                                                const std::list<parser::ParserInfo>& segment) const
+{
+    std::lock_guard lock {m_prefixMutex};
+
+    auto it = m_prefixNodes.find(key);
+    if (it != m_prefixNodes.end())
+    {
+        if (auto node = it->second.lock())
+        {
+            return node;
+        }
+    }
+
+    // The nodes are released with the parsers of the assets, drop the expired ones before growing
+    dropExpired(m_prefixNodes);
+
+    auto node =
+        std::make_shared<const PrefixNode>(PrefixNode {.id = g_nextPrefixNodeId++, .parser = buildParsers(segment, 0)});
+    m_prefixNodes[key] = node;
+
+    return node;
 }
 
 } // namespace hlp::logpar
@@ -104,7 +104,7 @@ TEST_P(LogparBuildParseTest, BuildParse)
 
     if (shouldPass)
     {
-        ASSERT_FALSE(error) << error.value().message;
+        ASSERT_FALSE(error) << error.value().message();
         ASSERT_EQ(event, expected);
     }
     else
@@ -146,6 +146,86 @@ INSTANTIATE_TEST_SUITE_P(
         BuildParseT(false, "[date] <~host> <text>(?|<~opt/text>|):<~>", "[date] host text|opt|:", {}),
         BuildParseT(false, "[date] <~host> <text>(?|<~opt/text>|):<~>", "[date] host text|opt|left over", {})));
 
+class LogparPrefixTest
+    : public ::testing::Test
+    , public logpar_test::LogparPBase
+{
+protected:
+    void SetUp() override { init(); }
+};
+
+TEST_F(LogparPrefixTest, SharedPrefix)
+{
+    auto parserText = logpar->build("[<~a/long>] <text>");
+    auto parserLong = logpar->build("[<~a/long>] <long>");
+
+    // Same input, the second parser reuses the prefix parsed by the first one
+    json::Json eventText;
+    ASSERT_FALSE(hlp::parser::run(parserText, "[1] 22", eventText));
+    ASSERT_EQ(eventText, logpar_test::J(R"({"~a":1,"text":"22"})"));
+
+    json::Json eventLong;
+    ASSERT_FALSE(hlp::parser::run(parserLong, "[1] 22", eventLong));
+    ASSERT_EQ(eventLong, logpar_test::J(R"({"~a":1,"long":22})"));
+
+    // A different input is parsed again
+    json::Json eventOther;
+    ASSERT_FALSE(hlp::parser::run(parserLong, "[3] 44", eventOther));
+    ASSERT_EQ(eventOther, logpar_test::J(R"({"~a":3,"long":44})"));
+
+    // The failure of the shared prefix is reused as well
+    json::Json eventFailure;
+    ASSERT_TRUE(hlp::parser::run(parserText, "[x] 22", eventFailure));
+    ASSERT_TRUE(hlp::parser::run(parserLong, "[x] 22", eventFailure));
+
+    // The prefix succeeds but the rest fails
+    ASSERT_FALSE(hlp::parser::run(parserText, "[5] text", eventFailure));
+    ASSERT_TRUE(hlp::parser::run(parserLong, "[5] text", eventFailure));
+}
+
+TEST_F(LogparPrefixTest, FailureMessage)
+{
+    auto parser = logpar->build("[<~a/long>] <long>");
+
+    json::Json event;
+    auto syntax = hlp::parser::run(parser, "[x] 22", event);
+    ASSERT_TRUE(syntax);
+    ASSERT_FALSE(syntax->semantic());
+    ASSERT_NE(syntax->message().find("failed at: "), std::string::npos) << syntax->message();
+
+    auto semantic = hlp::parser::run(parser, "[1] 99999999999999999999999", event);
+    ASSERT_TRUE(semantic);
+    ASSERT_TRUE(semantic->semantic());
+    ASSERT_EQ(semantic->message(), "Number is out of range");
+}
+
+TEST_F(LogparPrefixTest, SharedExpression)
+{
+    auto parser = logpar->build("[<~a/long>] <text>");
+    auto same = logpar->build("[<~a/long>] <text>");
+    auto other = logpar->build("[<~a/long>] <long>");
+
+    json::Json event;
+    ASSERT_FALSE(hlp::parser::run(same, "[1] 22", event));
+    ASSERT_EQ(event, logpar_test::J(R"({"~a":1,"text":"22"})"));
+
+    json::Json eventOther;
+    ASSERT_FALSE(hlp::parser::run(other, "[1] 22", eventOther));
+    ASSERT_EQ(eventOther, logpar_test::J(R"({"~a":1,"long":22})"));
+
+    // Built again once the previous parsers are released
+    parser = nullptr;
+    same = nullptr;
+    auto rebuilt = logpar->build("[<~a/long>] <text>");
+    json::Json eventRebuilt;
+    ASSERT_FALSE(hlp::parser::run(rebuilt, "[3] 44", eventRebuilt));
+    ASSERT_EQ(eventRebuilt, logpar_test::J(R"({"~a":3,"text":"44"})"));
+
+    // Failed builds are not cached
+    ASSERT_THROW(logpar->build("[<~a/unknown>] <text>"), std::runtime_error);
+    ASSERT_THROW(logpar->build("[<~a/unknown>] <text>"), std::runtime_error);
+}
+
 using FieldParserT = std::tuple<bool, std::string, std::string, bool, std::list<std::string>, bool, size_t>;
 class LogparFieldParserTest : public ::testing::TestWithParam<FieldParserT>
 {
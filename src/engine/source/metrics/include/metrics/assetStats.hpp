@@ -0,0 +1,105 @@
+#ifndef _METRICS_ASSET_STATS_H
+#define _METRICS_ASSET_STATS_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <metrics/threadCells.hpp>
+
+namespace metricsManager
+{
+
+/**
+ * @brief Hit-rate statistics of the assets, how many times their condition is evaluated and how many it succeeds.
+ *
+ * The counters of an asset are kept across the builds of the policies, so a rebuilt asset continues the statistics of
+ * its previous version and the policy can be ordered by them.
+ */
+class AssetStats
+{
+public:
+    /**
+     * @brief Counters of an asset.
+     */
+    struct Counters
+    {
+        ThreadCells<uint64_t, 4> evaluations; ///< Evaluations of the condition
+        ThreadCells<uint64_t, 4> successes;   ///< Evaluations of the condition that succeeded
+        std::atomic<uint64_t> cost {0};       ///< Operations of the condition in its last build
+    };
+
+    /**
+     * @brief Statistics of an asset.
+     */
+    struct Entry
+    {
+        std::string asset;    ///< Asset name
+        uint64_t evaluations; ///< Evaluations of the condition
+        uint64_t successes;   ///< Evaluations of the condition that succeeded
+        uint64_t cost;        ///< Operations of the condition in its last build
+    };
+
+    /**
+     * @brief Evaluations needed before the success rate of an asset is used to order it.
+     */
+    static constexpr uint64_t MIN_EVALUATIONS {100};
+
+    /**
+     * @brief Statistics of the engine, shared by the builder and the API.
+     *
+     * @return const std::shared_ptr<AssetStats>&
+     */
+    static const std::shared_ptr<AssetStats>& global();
+
+    /**
+     * @brief Gets the counters of an asset, created on the first request.
+     *
+     * @param asset Asset name.
+     * @return std::shared_ptr<Counters>
+     */
+    std::shared_ptr<Counters> counters(const std::string& asset);
+
+    /**
+     * @brief Gets the statistics of an asset.
+     *
+     * @param asset Asset name.
+     * @return std::optional<Entry> The statistics, or nullopt if the asset was never built.
+     */
+    std::optional<Entry> entry(const std::string& asset) const;
+
+    /**
+     * @brief Gets the statistics of all the assets, sorted by name.
+     *
+     * @return std::vector<Entry>
+     */
+    std::vector<Entry> entries() const;
+
+    /**
+     * @brief Sets the evaluations and successes of all the assets to zero.
+     */
+    void reset();
+
+    /**
+     * @brief Rank of an asset in an ordered choice, the success rate per operation evaluated.
+     *
+     * Evaluating the siblings by descending rank minimizes the operations evaluated until the first success.
+     *
+     * @param entry Statistics of the asset.
+     * @return std::optional<double> The rank, or nullopt if the asset has less than MIN_EVALUATIONS evaluations.
+     */
+    static std::optional<double> rank(const Entry& entry);
+
+private:
+    mutable std::shared_mutex m_mutex;                                   ///< Protects the map
+    std::unordered_map<std::string, std::shared_ptr<Counters>> m_assets; ///< Counters by asset name
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_ASSET_STATS_H
@@ -1,12 +1,14 @@
 #ifndef _METRICS_INSTRUMENTS_H
 #define _METRICS_INSTRUMENTS_H
 
+#include <atomic>
 #include <mutex>
 
 #include "opentelemetry/sdk/metrics/meter_provider.h"
 #include "opentelemetry/metrics/async_instruments.h"
 
 #include <metrics/iMetricsInstruments.hpp>
+#include <metrics/threadCells.hpp>
 
 
 namespace metricsManager
@@ -28,7 +30,7 @@ public:
      *
      * @param newStatus The new enabled status.
      */
-    virtual void setEnabledStatus(bool newStatus) { m_status = newStatus; }
+    virtual void setEnabledStatus(bool newStatus) { m_status.store(newStatus, std::memory_order_relaxed); }
 
     /**
      * @brief Gets the enabled status of the instrument.
@@ -36,35 +38,46 @@ public:
      * @param instrumentName The name of the instrument.
      * @return The enabled status of the instrument.
      */
-    virtual bool getEnabledStatus() { return m_status; }
+    virtual bool getEnabledStatus() { return m_status.load(std::memory_order_relaxed); }
 private:
     /**
-     * @brief Holds the enabled status
+     * @brief Holds the enabled status, read on every recorded value
      */
-    bool m_status {true};
+    std::atomic<bool> m_status {true};
 };
 
 /**
  * @brief Template class to build Counter Class. Instrument
- * that encapsulates the Internal OpenTelemetry Object.
+ * that encapsulates an Observable OpenTelemetry Object.
+ *
+ * The values are added into per-thread cells, the internal instrument observes their sum when the exporter collects.
  *
- * @tparam T Internal OpenTelemetry object type.
  * @tparam U Basic value type held by the Internal.
  */
-template <typename T, typename U>
+template <typename U>
 class Counter : public iCounter<U>, public Instrument
 {
 public:
+    /**
+     * @brief Observed type of the internal instrument, OpenTelemetry only observes int64_t and double.
+     */
+    using Observed = std::conditional_t<std::is_integral_v<U>, int64_t, double>;
+
     /**
      * @brief Construct a new Counter object
      *
-     * @param ptr A unique pointer to the instrument created with the OpenTelemetry MeterProvider Meter.
+     * @param ptr A shared pointer to the observable instrument created with the OpenTelemetry MeterProvider Meter.
      */
-    Counter(OTstd::unique_ptr<T> ptr)
+    Counter(OTstd::shared_ptr<OTMetrics::ObservableInstrument> ptr)
         : m_counter {std::move(ptr)}
     {
     }
 
+    /**
+     * @brief Registers the callback that reports the counter into the internal instrument.
+     */
+    void AddCallback() { m_counter->AddCallback(Counter::Fetcher, static_cast<void*>(this)); }
+
     /**
      * @brief Adds a value to the counter.
      *
@@ -74,15 +87,48 @@ public:
     {
         if (getEnabledStatus())
         {
-            m_counter->Add(value);
+            m_cells.add(value);
         }
     }
 
+    /**
+     * @brief Returns the accumulated value to any consumer.
+     *
+     * @return The Value itself
+     */
+    U readValue() const { return m_cells.sum(); }
+
+    /**
+     * @brief Destroy the Counter object and removes the internal callback.
+     */
+    ~Counter() { m_counter->RemoveCallback(Counter::Fetcher, static_cast<void*>(this)); }
+
 private:
     /**
-     * @brief A unique pointer to the instrument created with the OpenTelemetry MeterProvider.
+     * @brief A shared pointer to the instrument created with the OpenTelemetry MeterProvider.
+     */
+    OTstd::shared_ptr<OTMetrics::ObservableInstrument> m_counter;
+
+    /**
+     * @brief Per-thread cells of the counter.
+     */
+    ThreadCells<U> m_cells;
+
+    /**
+     * @brief Callback of the internal instrument, observes the accumulated value.
+     *
+     * @param observer_result Internals Open Telemetry holding the observer result.
+     * @param id The counter.
      */
-    OTstd::unique_ptr<T> m_counter;
+    static void Fetcher(OTMetrics::ObserverResult observer_result, void* id)
+    {
+        using Result = OTstd::shared_ptr<OTMetrics::ObserverResultT<Observed>>;
+        if (OTstd::holds_alternative<Result>(observer_result))
+        {
+            auto counter = static_cast<Counter*>(id);
+            OTstd::get<Result>(observer_result)->Observe(static_cast<Observed>(counter->readValue()));
+        }
+    }
 };
 
 /**
@@ -113,16 +159,17 @@ public:
      */
     void recordValue(const U& value) override
     {
-        auto context = opentelemetry::context::Context{};
-        std::map<std::string, std::string> labels;
-        auto labelkv = opentelemetry::common::KeyValueIterableView<decltype(labels)>{labels};
-
         if (getEnabledStatus())
         {
-            m_histogram->Record(value, labelkv, context);
+            m_histogram->Record(value, m_context);
         }
     }
 private:
+    /**
+     * @brief Empty context of the records, histograms have no labels.
+     */
+    const opentelemetry::context::Context m_context {};
+
     /**
      * @brief A unique pointer to the instrument created with the OpenTelemetry MeterProvider.
      */
@@ -9,6 +9,7 @@
 #include <metrics/iMetricsManagerAPI.hpp>
 #include <metrics/dataHub.hpp>
 #include <metrics/metricsScope.hpp>
+#include <metrics/openMetricsRegistry.hpp>
 
 namespace metricsManager
 {
@@ -47,6 +48,13 @@ public:
     */
     json::Json getAllMetrics() override;
 
+    /**
+     * @brief Exposes the scopes created from now on in the OpenMetrics registry.
+     *
+     * @return Registry with the OpenMetrics text of the scopes.
+     */
+    std::shared_ptr<OpenMetricsRegistry> enableOpenMetrics();
+
     // API Commands
     std::variant<std::string, base::Error> dumpCmd() override;
 
@@ -86,6 +94,11 @@ private:
      */
     std::mutex m_mutexScopes;
 
+    /**
+     * @brief Registry of the OpenMetrics exposition, null while it is disabled
+     */
+    std::shared_ptr<OpenMetricsRegistry> m_openMetrics;
+
     /**
      * @brief Metrics Scope for Testing Instrument
      */
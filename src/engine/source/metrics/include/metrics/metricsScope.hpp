@@ -11,6 +11,7 @@
 #include <metrics/iMetricsScope.hpp>
 #include <metrics/instrumentCollection.hpp>
 #include <metrics/metricsInstruments.hpp>
+#include <metrics/openMetricsRegistry.hpp>
 
 namespace metricsManager
 {
@@ -29,8 +30,14 @@ public:
      * @param delta Aggregation temporality type is Delta or Accummulative.
      * @param exporterIntervalMS Time in ms by which the exporters retrieves the data from the Instruments.
      * @param exporterTimeoutMS Time in ms by which the exporters fallback in timeout if can't retrieve.
+     * @param name Name of the scope in the OpenMetrics exposition.
+     * @param openMetrics Registry of the OpenMetrics exposition, if null the scope is not exposed.
      */
-    void initialize(bool delta, int exporterIntervalMS, int exporterTimeoutMS);
+    void initialize(bool delta,
+                    int exporterIntervalMS,
+                    int exporterTimeoutMS,
+                    const std::string& name = "",
+                    const std::shared_ptr<OpenMetricsRegistry>& openMetrics = nullptr);
 
     /**
      * @brief Get the collected data in the DataHub of this scope or associated with the provided instrument.
@@ -109,31 +116,27 @@ private:
     std::shared_ptr<OTSDKMeterProvider> m_meterProvider;
 
     /**
-     * @brief Collection of Double Counters mapping to OpenTelemetry internals.
+     * @brief Collection of double counters that map to OpenTelemetry observable internals.
      */
-    InstrumentCollection<Counter<OTMetrics::Counter<double>, double>,
-                        OTstd::unique_ptr<OTMetrics::Counter<double>>>
+    InstrumentCollection<Counter<double>, OTstd::shared_ptr<OTMetrics::ObservableInstrument>>
         m_collection_counter_double;
 
     /**
-     * @brief Collection of unsigned integer counters that map to OpenTelemetry internals.
+     * @brief Collection of unsigned integer counters that map to OpenTelemetry observable internals.
      */
-    InstrumentCollection<Counter<OTMetrics::Counter<uint64_t>, uint64_t>,
-                         OTstd::unique_ptr<OTMetrics::Counter<uint64_t>>>
+    InstrumentCollection<Counter<uint64_t>, OTstd::shared_ptr<OTMetrics::ObservableInstrument>>
         m_collection_counter_integer;
 
     /**
-     * @brief Collection of double up-down counters that map to OpenTelemetry internals.
+     * @brief Collection of double up-down counters that map to OpenTelemetry observable internals.
      */
-    InstrumentCollection<Counter<OTMetrics::UpDownCounter<double>, double>,
-                         OTstd::unique_ptr<OTMetrics::UpDownCounter<double>>>
+    InstrumentCollection<Counter<double>, OTstd::shared_ptr<OTMetrics::ObservableInstrument>>
         m_collection_updowncounter_double;
 
     /**
-     * @brief Collection of integer up-down counters that map to OpenTelemetry internals.
+     * @brief Collection of integer up-down counters that map to OpenTelemetry observable internals.
      */
-    InstrumentCollection<Counter<OTMetrics::UpDownCounter<int64_t>, int64_t>,
-                         OTstd::unique_ptr<OTMetrics::UpDownCounter<int64_t>>>
+    InstrumentCollection<Counter<int64_t>, OTstd::shared_ptr<OTMetrics::ObservableInstrument>>
         m_collection_updowncounter_integer;
 
     /**
@@ -0,0 +1,61 @@
+#ifndef _METRICS_OPENMETRICS_ENDPOINT_H
+#define _METRICS_OPENMETRICS_ENDPOINT_H
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <metrics/openMetricsRegistry.hpp>
+
+namespace httplib
+{
+class Server;
+} // namespace httplib
+
+namespace metricsManager
+{
+
+/**
+ * @brief HTTP endpoint that serves the OpenMetrics exposition on GET /metrics, to be scraped by Prometheus.
+ *
+ * A scrape only renders the texts already held by the registry.
+ */
+class OpenMetricsEndpoint
+{
+public:
+    /**
+     * @brief Construct a new OpenMetrics Endpoint object, it does not listen until started.
+     *
+     * @param registry Registry with the exposition of the scopes.
+     * @param address Address to listen on.
+     * @param port Port to listen on.
+     */
+    OpenMetricsEndpoint(std::shared_ptr<OpenMetricsRegistry> registry, std::string address, int port);
+    ~OpenMetricsEndpoint();
+
+    OpenMetricsEndpoint(const OpenMetricsEndpoint&) = delete;
+    OpenMetricsEndpoint& operator=(const OpenMetricsEndpoint&) = delete;
+
+    /**
+     * @brief Binds the address and starts serving in its own thread.
+     *
+     * @throw std::runtime_error if the address cannot be bound.
+     */
+    void start();
+
+    /**
+     * @brief Stops serving and waits for the thread.
+     */
+    void stop();
+
+private:
+    std::shared_ptr<OpenMetricsRegistry> m_registry; ///< Registry with the exposition
+    std::string m_address;                           ///< Address to listen on
+    int m_port;                                      ///< Port to listen on
+    std::unique_ptr<httplib::Server> m_server;       ///< HTTP server
+    std::thread m_thread;                            ///< Thread serving the requests
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_OPENMETRICS_ENDPOINT_H
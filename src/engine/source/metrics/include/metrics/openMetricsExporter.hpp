@@ -0,0 +1,60 @@
+#ifndef _METRICS_OPENMETRICS_EXPORTER_H
+#define _METRICS_OPENMETRICS_EXPORTER_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "opentelemetry/sdk/metrics/data/metric_data.h"
+#include "opentelemetry/sdk/metrics/instruments.h"
+#include "opentelemetry/sdk/metrics/push_metric_exporter.h"
+#include "opentelemetry/version.h"
+
+#include <metrics/openMetricsRegistry.hpp>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+namespace exporter
+{
+namespace metrics
+{
+
+/**
+ * @brief Exporter that renders the collected aggregations of a scope in OpenMetrics text format.
+ *
+ * The metric families are named wazuh_engine_<scope>_<instrument>. Cumulative sums of counters are exposed as
+ * counters and the rest of sums as gauges. Delta histograms are exposed as gauge histograms.
+ */
+class OpenMetricsExporter final : public opentelemetry::sdk::metrics::PushMetricExporter
+{
+public:
+    OpenMetricsExporter(std::shared_ptr<metricsManager::OpenMetricsRegistry> registry,
+                        std::string scopeName,
+                        sdk::metrics::AggregationTemporality aggregationTemporality =
+                            sdk::metrics::AggregationTemporality::kCumulative) noexcept;
+
+    sdk::common::ExportResult Export(const sdk::metrics::ResourceMetrics& data) noexcept override;
+
+    sdk::metrics::AggregationTemporality
+    GetAggregationTemporality(sdk::metrics::InstrumentType instrument_type) const noexcept override;
+
+    bool ForceFlush(std::chrono::microseconds timeout) noexcept override;
+
+    bool Shutdown(std::chrono::microseconds timeout) noexcept override;
+
+private:
+    std::shared_ptr<metricsManager::OpenMetricsRegistry> m_registry;
+
+    std::string m_scopeName;
+
+    sdk::metrics::AggregationTemporality m_aggregationTemporality;
+
+    std::atomic<bool> m_isShutdown {false};
+
+    void renderMetricData(std::string& out, const sdk::metrics::MetricData& metricData) const;
+};
+
+} // namespace metrics
+} // namespace exporter
+OPENTELEMETRY_END_NAMESPACE
+
+#endif // _METRICS_OPENMETRICS_EXPORTER_H
@@ -0,0 +1,55 @@
+#ifndef _METRICS_OPENMETRICS_REGISTRY_H
+#define _METRICS_OPENMETRICS_REGISTRY_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace metricsManager
+{
+
+/**
+ * @brief Holds the last OpenMetrics text exposition of each scope.
+ *
+ * The exporters render the text once per collection interval, so a scrape only concatenates the rendered texts and
+ * never touches the instruments nor the DataHub.
+ */
+class OpenMetricsRegistry
+{
+public:
+    /**
+     * @brief Content type of the exposition.
+     */
+    static constexpr auto CONTENT_TYPE = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+    /**
+     * @brief Replaces the rendered text of a scope.
+     *
+     * @param scope Name of the scope.
+     * @param text Metric families of the scope in OpenMetrics text format, without the EOF marker.
+     */
+    void setScope(const std::string& scope, std::string text);
+
+    /**
+     * @brief Renders the exposition of all the scopes.
+     *
+     * @return OpenMetrics text, terminated by the EOF marker.
+     */
+    std::string render() const;
+
+private:
+    /**
+     * @brief Rendered text of each scope, replaced as a whole so the lock is only held to copy the pointers.
+     */
+    std::map<std::string, std::shared_ptr<const std::string>> m_scopes;
+
+    /**
+     * @brief Synchronization object
+     */
+    mutable std::mutex m_mutex;
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_OPENMETRICS_REGISTRY_H
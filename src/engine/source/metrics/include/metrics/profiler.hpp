@@ -0,0 +1,142 @@
+#ifndef _METRICS_PROFILER_H
+#define _METRICS_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace metricsManager
+{
+
+/**
+ * @brief Profiler of the operations of the assets, enabled for a time window.
+ *
+ * Each built operation registers a site, with the frames of the asset, stage and operation. While the profiler is
+ * active the operations record their executions and time in their site, while it is inactive they only check the
+ * active flag. The sites are rendered as a collapsed-stack profile, ready for a flamegraph.
+ */
+class Profiler
+{
+public:
+    /**
+     * @brief Execution counters of an operation.
+     */
+    struct Site
+    {
+        std::string asset;                ///< Asset of the operation
+        std::string stage;                ///< Stage of the operation
+        std::string operation;            ///< Operation name
+        std::atomic<uint64_t> count {0};  ///< Executions in the window
+        std::atomic<uint64_t> timeNs {0}; ///< Cumulative execution time in the window
+    };
+
+    /**
+     * @brief Profile entry of a site.
+     */
+    struct Entry
+    {
+        std::string asset;     ///< Asset of the operation
+        std::string stage;     ///< Stage of the operation
+        std::string operation; ///< Operation name
+        uint64_t count;        ///< Executions in the window
+        uint64_t timeUs;       ///< Cumulative execution time in the window
+    };
+
+    /**
+     * @brief Longest window allowed.
+     */
+    static constexpr std::chrono::seconds MAX_WINDOW {300};
+
+    /**
+     * @brief Profiler of the engine, shared by the builder and the API.
+     *
+     * @return const std::shared_ptr<Profiler>&
+     */
+    static const std::shared_ptr<Profiler>& global();
+
+    /**
+     * @brief Registers the site of an operation, kept while the operation holds it.
+     *
+     * @param asset Asset of the operation.
+     * @param stage Stage of the operation.
+     * @param operation Operation name.
+     * @return std::shared_ptr<Site>
+     */
+    std::shared_ptr<Site> site(const std::string& asset, const std::string& stage, const std::string& operation);
+
+    /**
+     * @brief Checks if the operations must be recorded.
+     */
+    inline bool active() const { return m_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Records an execution, ignored once the window is over.
+     *
+     * @param site Site of the operation.
+     * @param start Start of the execution.
+     * @param end End of the execution.
+     */
+    inline void
+    record(Site& site, std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+    {
+        if (end.time_since_epoch().count() > m_deadline.load(std::memory_order_relaxed))
+        {
+            m_active.store(false, std::memory_order_relaxed);
+            return;
+        }
+
+        site.count.fetch_add(1, std::memory_order_relaxed);
+        site.timeNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(),
+                              std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Resets the counters and starts recording.
+     *
+     * @param window Time recording, at most MAX_WINDOW.
+     * @throw std::runtime_error if the window is empty or too long.
+     */
+    void start(std::chrono::seconds window);
+
+    /**
+     * @brief Stops recording, the counters are kept.
+     */
+    void stop();
+
+    /**
+     * @brief Gets the sites executed in the last window.
+     *
+     * @return std::vector<Entry>
+     */
+    std::vector<Entry> entries() const;
+
+    /**
+     * @brief Renders the sites executed in the last window as collapsed stacks, asset;stage;operation <microseconds>.
+     *
+     * @return std::string One line per site.
+     */
+    std::string collapsed() const;
+
+    /**
+     * @brief Renders entries as collapsed stacks, asset;stage;operation <microseconds>.
+     *
+     * @param entries Entries of the sites.
+     * @return std::string One line per entry.
+     */
+    static std::string collapse(const std::vector<Entry>& entries);
+
+private:
+    std::atomic<bool> m_active {false};       ///< Recording
+    std::atomic<int64_t> m_deadline {0};      ///< End of the window, in steady clock ticks
+    mutable std::mutex m_mutex;               ///< Protects the sites
+    std::vector<std::weak_ptr<Site>> m_sites; ///< Registered sites
+    std::size_t m_pruneAt {1024};             ///< Registered sites that trigger pruning the expired ones
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_PROFILER_H
@@ -0,0 +1,96 @@
+#ifndef _METRICS_THREAD_CELLS_H
+#define _METRICS_THREAD_CELLS_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace metricsManager
+{
+
+/**
+ * @brief Per-thread accumulation cells of a value.
+ *
+ * Each thread adds into its own cache line, so the hot paths don't contend on a shared value. The cells are merged only
+ * when the value is read, once per collection interval or query.
+ *
+ * @tparam U Basic value type accumulated.
+ * @tparam SIZE Number of cells, threads beyond it share cells.
+ */
+template <typename U, std::size_t SIZE = 16>
+class ThreadCells
+{
+public:
+    /**
+     * @brief Adds a value to the cell of the calling thread.
+     *
+     * @param value The value itself.
+     */
+    void add(const U& value)
+    {
+        auto& cell = m_cells[cellIndex()].m_value;
+        if constexpr (std::is_integral_v<U>)
+        {
+            cell.fetch_add(value, std::memory_order_relaxed);
+        }
+        else
+        {
+            auto current = cell.load(std::memory_order_relaxed);
+            while (!cell.compare_exchange_weak(current, current + value, std::memory_order_relaxed))
+            {
+            }
+        }
+    }
+
+    /**
+     * @brief Merges all the cells.
+     *
+     * @return The accumulated value.
+     */
+    U sum() const
+    {
+        U total {0};
+        for (const auto& cell : m_cells)
+        {
+            total += cell.m_value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Sets all the cells to zero, the values added meanwhile may be lost.
+     */
+    void reset()
+    {
+        for (auto& cell : m_cells)
+        {
+            cell.m_value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    /**
+     * @brief Cell padded to its own cache line.
+     */
+    struct alignas(64) Cell
+    {
+        std::atomic<U> m_value {0};
+    };
+
+    /**
+     * @brief Gets the cell of the calling thread, assigned on its first use.
+     */
+    static std::size_t cellIndex()
+    {
+        static std::atomic<std::size_t> next {0};
+        thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed) % SIZE;
+        return index;
+    }
+
+    std::array<Cell, SIZE> m_cells;
+};
+
+} // namespace metricsManager
+
+#endif // _METRICS_THREAD_CELLS_H
@@ -0,0 +1,95 @@
+#include <metrics/assetStats.hpp>
+
+#include <algorithm>
+#include <mutex>
+
+namespace metricsManager
+{
+
+namespace
+{
+AssetStats::Entry toEntry(const std::string& asset, const AssetStats::Counters& counters)
+{
+    return AssetStats::Entry {asset,
+                              counters.evaluations.sum(),
+                              counters.successes.sum(),
+                              counters.cost.load(std::memory_order_relaxed)};
+}
+} // namespace
+
+const std::shared_ptr<AssetStats>& AssetStats::global()
+{
+    static const auto stats = std::make_shared<AssetStats>();
+    return stats;
+}
+
+std::shared_ptr<AssetStats::Counters> AssetStats::counters(const std::string& asset)
+{
+    {
+        const std::shared_lock lock(m_mutex);
+        auto it = m_assets.find(asset);
+        if (it != m_assets.end())
+        {
+            return it->second;
+        }
+    }
+
+    const std::unique_lock lock(m_mutex);
+    auto& counters = m_assets[asset];
+    if (!counters)
+    {
+        counters = std::make_shared<Counters>();
+    }
+    return counters;
+}
+
+std::optional<AssetStats::Entry> AssetStats::entry(const std::string& asset) const
+{
+    const std::shared_lock lock(m_mutex);
+    auto it = m_assets.find(asset);
+    if (it == m_assets.end())
+    {
+        return std::nullopt;
+    }
+    return toEntry(it->first, *it->second);
+}
+
+std::vector<AssetStats::Entry> AssetStats::entries() const
+{
+    std::vector<Entry> retValue;
+    {
+        const std::shared_lock lock(m_mutex);
+        retValue.reserve(m_assets.size());
+        for (const auto& [asset, counters] : m_assets)
+        {
+            retValue.emplace_back(toEntry(asset, *counters));
+        }
+    }
+
+    std::sort(retValue.begin(), retValue.end(), [](const auto& lhs, const auto& rhs) { return lhs.asset < rhs.asset; });
+    return retValue;
+}
+
+void AssetStats::reset()
+{
+    const std::shared_lock lock(m_mutex);
+    for (const auto& [asset, counters] : m_assets)
+    {
+        counters->evaluations.reset();
+        counters->successes.reset();
+    }
+}
+
+std::optional<double> AssetStats::rank(const Entry& entry)
+{
+    if (entry.evaluations < MIN_EVALUATIONS)
+    {
+        return std::nullopt;
+    }
+
+    // Conditions without operations still cost their evaluation
+    const auto rate = static_cast<double>(entry.successes) / static_cast<double>(entry.evaluations);
+    return rate / static_cast<double>(std::max<uint64_t>(entry.cost, 1));
+}
+
+} // namespace metricsManager
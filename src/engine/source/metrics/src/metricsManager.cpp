@@ -42,6 +42,18 @@ json::Json MetricsManager::getAllMetrics()
     return retValue;
 }
 
+std::shared_ptr<OpenMetricsRegistry> MetricsManager::enableOpenMetrics()
+{
+    const std::lock_guard<std::mutex> lock(m_mutexScopes);
+
+    if (!m_openMetrics)
+    {
+        m_openMetrics = std::make_shared<OpenMetricsRegistry>();
+    }
+
+    return m_openMetrics;
+}
+
 std::shared_ptr<IMetricsScope> MetricsManager::getMetricsScope(const std::string& metricsScopeName,
                                                                bool delta,
                                                                int exporterIntervalMS,
@@ -63,7 +75,7 @@ std::shared_ptr<IMetricsScope> MetricsManager::getMetricsScope(const std::string
 
         auto& retScope = m_mapScopes[metricsScopeName];
 
-        retScope->initialize(delta, exporterIntervalMS, exporterTimeoutMS);
+        retScope->initialize(delta, exporterIntervalMS, exporterTimeoutMS, metricsScopeName, m_openMetrics);
 
         return retScope;
     }
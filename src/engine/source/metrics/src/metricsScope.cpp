@@ -1,8 +1,11 @@
 #include <metrics/metricsScope.hpp>
 
+#include <metrics/openMetricsExporter.hpp>
+
 using OTSDKMetricExporter = opentelemetry::sdk::metrics::PushMetricExporter;
 using OTSDKMetricReader = opentelemetry::sdk::metrics::MetricReader;
 using OTDataHubExporter = opentelemetry::exporter::metrics::DataHubExporter;
+using OTOpenMetricsExporter = opentelemetry::exporter::metrics::OpenMetricsExporter;
 using OTSDKPerodicMetricReader = opentelemetry::sdk::metrics::PeriodicExportingMetricReader;
 using OTSDKPerodicMetricReaderOptions = opentelemetry::sdk::metrics::PeriodicExportingMetricReaderOptions;
 using OTGaugeInteger = opentelemetry::nostd::shared_ptr<opentelemetry::metrics::ObserverResultT<int64_t>>;
@@ -12,7 +15,11 @@ using OTTemporality = opentelemetry::v1::sdk::metrics::AggregationTemporality;
 namespace metricsManager
 {
 
-void MetricsScope::initialize(bool delta, int exporterIntervalMS, int exporterTimeoutMS)
+void MetricsScope::initialize(bool delta,
+                              int exporterIntervalMS,
+                              int exporterTimeoutMS,
+                              const std::string& name,
+                              const std::shared_ptr<OpenMetricsRegistry>& openMetrics)
 {
     m_dataHub = std::make_shared<DataHub>();
 
@@ -31,6 +38,16 @@ void MetricsScope::initialize(bool delta, int exporterIntervalMS, int exporterTi
     m_meterProvider = std::shared_ptr<OTSDKMeterProvider>(new opentelemetry::sdk::metrics::MeterProvider());
 
     m_meterProvider->AddMetricReader(std::move(metricReader));
+
+    // The OpenMetrics exposition is rendered by its own reader, at the same interval
+    if (openMetrics)
+    {
+        std::unique_ptr<OTSDKMetricExporter> openMetricsExporter(
+            new OTOpenMetricsExporter(openMetrics, name, temporality));
+        std::unique_ptr<OTSDKMetricReader> openMetricsReader(
+            new OTSDKPerodicMetricReader(std::move(openMetricsExporter), options));
+        m_meterProvider->AddMetricReader(std::move(openMetricsReader));
+    }
 }
 
 json::Json MetricsScope::getAllMetrics(const std::string& metricsInstrumentName)
@@ -52,7 +69,11 @@ std::shared_ptr<iCounter<double>> MetricsScope::getCounterDouble(const std::stri
         [&]()
         {
             auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateDoubleCounter(name);
+            return meter->CreateDoubleObservableCounter(name);
+        },
+        [](const std::shared_ptr<Counter<double>>& counter)
+        {
+            counter->AddCallback();
         }
     );
 
@@ -68,7 +89,11 @@ std::shared_ptr<iCounter<uint64_t>> MetricsScope::getCounterUInteger(const std::
         [&]()
         {
             auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateUInt64Counter(name);
+            return meter->CreateInt64ObservableCounter(name);
+        },
+        [](const std::shared_ptr<Counter<uint64_t>>& counter)
+        {
+            counter->AddCallback();
         }
     );
 
@@ -84,7 +109,11 @@ std::shared_ptr<iCounter<double>> MetricsScope::getUpDownCounterDouble(const std
         [&]()
         {
             auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateDoubleUpDownCounter(name);
+            return meter->CreateDoubleObservableUpDownCounter(name);
+        },
+        [](const std::shared_ptr<Counter<double>>& counter)
+        {
+            counter->AddCallback();
         }
     );
 
@@ -100,7 +129,11 @@ std::shared_ptr<iCounter<int64_t>> MetricsScope::getUpDownCounterInteger(const s
         [&]()
         {
             auto meter = m_meterProvider->GetMeter(name);
-            return meter->CreateInt64UpDownCounter(name);
+            return meter->CreateInt64ObservableUpDownCounter(name);
+        },
+        [](const std::shared_ptr<Counter<int64_t>>& counter)
+        {
+            counter->AddCallback();
         }
     );
 
@@ -0,0 +1,55 @@
+#include <metrics/openMetricsEndpoint.hpp>
+
+#include <stdexcept>
+
+#include <fmt/format.h>
+#include <httplib.h>
+
+#include <base/logging.hpp>
+
+namespace metricsManager
+{
+
+OpenMetricsEndpoint::OpenMetricsEndpoint(std::shared_ptr<OpenMetricsRegistry> registry, std::string address, int port)
+    : m_registry(std::move(registry))
+    , m_address(std::move(address))
+    , m_port(port)
+    , m_server(std::make_unique<httplib::Server>())
+{
+    m_server->Get("/metrics",
+                  [registry = m_registry](const httplib::Request&, httplib::Response& res)
+                  { res.set_content(registry->render(), OpenMetricsRegistry::CONTENT_TYPE); });
+}
+
+OpenMetricsEndpoint::~OpenMetricsEndpoint()
+{
+    stop();
+}
+
+void OpenMetricsEndpoint::start()
+{
+    if (m_thread.joinable())
+    {
+        return;
+    }
+
+    if (!m_server->bind_to_port(m_address, m_port))
+    {
+        throw std::runtime_error(fmt::format("OpenMetrics endpoint could not listen on {}:{}", m_address, m_port));
+    }
+
+    m_thread = std::thread([server = m_server.get()]() { server->listen_after_bind(); });
+    LOG_INFO("OpenMetrics endpoint listening on {}:{}.", m_address, m_port);
+}
+
+void OpenMetricsEndpoint::stop()
+{
+    if (m_thread.joinable())
+    {
+        m_server->stop();
+        m_thread.join();
+        LOG_DEBUG("OpenMetrics endpoint stopped.");
+    }
+}
+
+} // namespace metricsManager
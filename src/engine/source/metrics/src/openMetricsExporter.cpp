@@ -0,0 +1,214 @@
+#include <metrics/openMetricsExporter.hpp>
+
+#include <cmath>
+
+#include <fmt/format.h>
+
+namespace
+{
+using namespace opentelemetry::sdk::metrics;
+
+constexpr auto FAMILY_PREFIX = "wazuh_engine_";
+
+/**
+ * @brief Replaces the characters not allowed in a metric name by '_'.
+ */
+void appendSanitized(std::string& out, const std::string& name)
+{
+    for (auto c : name)
+    {
+        const bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        out += valid ? c : '_';
+    }
+}
+
+/**
+ * @brief Escapes a text of a HELP line.
+ */
+std::string escapeHelp(const std::string& text)
+{
+    std::string retValue;
+    retValue.reserve(text.size());
+    for (auto c : text)
+    {
+        if (c == '\\')
+        {
+            retValue += "\\\\";
+        }
+        else if (c == '\n')
+        {
+            retValue += "\\n";
+        }
+        else
+        {
+            retValue += c;
+        }
+    }
+    return retValue;
+}
+
+std::string formatDouble(double value)
+{
+    if (std::isnan(value))
+    {
+        return "NaN";
+    }
+    if (std::isinf(value))
+    {
+        return value > 0 ? "+Inf" : "-Inf";
+    }
+    return fmt::format("{}", value);
+}
+
+std::string formatValue(const ValueType& value)
+{
+    if (opentelemetry::nostd::holds_alternative<int64_t>(value))
+    {
+        return std::to_string(opentelemetry::nostd::get<int64_t>(value));
+    }
+    return formatDouble(opentelemetry::nostd::get<double>(value));
+}
+
+bool isMonotonic(InstrumentType type)
+{
+    return type == InstrumentType::kCounter || type == InstrumentType::kObservableCounter;
+}
+
+void appendFamilyHeader(std::string& out, const std::string& family, const char* type, const std::string& description)
+{
+    out += fmt::format("# TYPE {} {}\n", family, type);
+    if (!description.empty())
+    {
+        out += fmt::format("# HELP {} {}\n", family, escapeHelp(description));
+    }
+}
+
+void appendHistogram(std::string& out, const std::string& family, const HistogramPointData& point, bool cumulative)
+{
+    uint64_t count = 0;
+    for (std::size_t i = 0; i < point.counts_.size(); ++i)
+    {
+        count += point.counts_[i];
+        const auto bound = i < point.boundaries_.size() ? formatDouble(point.boundaries_[i]) : std::string {"+Inf"};
+        out += fmt::format("{}_bucket{{le=\"{}\"}} {}\n", family, bound, count);
+    }
+    if (point.counts_.empty())
+    {
+        out += fmt::format("{}_bucket{{le=\"+Inf\"}} 0\n", family);
+    }
+
+    // Gauge histograms use their own names for the count and the sum
+    out += fmt::format("{}_{} {}\n", family, cumulative ? "count" : "gcount", count);
+    out += fmt::format("{}_{} {}\n", family, cumulative ? "sum" : "gsum", formatValue(point.sum_));
+}
+
+} // namespace
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+
+namespace exporter::metrics
+{
+
+OpenMetricsExporter::OpenMetricsExporter(std::shared_ptr<metricsManager::OpenMetricsRegistry> registry,
+                                         std::string scopeName,
+                                         sdk::metrics::AggregationTemporality aggregationTemporality) noexcept
+    : m_registry(std::move(registry))
+    , m_scopeName(std::move(scopeName))
+    , m_aggregationTemporality(aggregationTemporality)
+{
+}
+
+sdk::metrics::AggregationTemporality
+OpenMetricsExporter::GetAggregationTemporality(sdk::metrics::InstrumentType /* instrument_type */) const noexcept
+{
+    return m_aggregationTemporality;
+}
+
+sdk::common::ExportResult OpenMetricsExporter::Export(const sdk::metrics::ResourceMetrics& data) noexcept
+{
+    if (m_isShutdown.load())
+    {
+        return sdk::common::ExportResult::kFailure;
+    }
+
+    try
+    {
+        std::string text;
+        for (const auto& scopeMetrics : data.scope_metric_data_)
+        {
+            for (const auto& metricData : scopeMetrics.metric_data_)
+            {
+                renderMetricData(text, metricData);
+            }
+        }
+        m_registry->setScope(m_scopeName, std::move(text));
+    }
+    catch (const std::exception&)
+    {
+        return sdk::common::ExportResult::kFailure;
+    }
+
+    return sdk::common::ExportResult::kSuccess;
+}
+
+void OpenMetricsExporter::renderMetricData(std::string& out, const sdk::metrics::MetricData& metricData) const
+{
+    const auto& descriptor = metricData.instrument_descriptor;
+    const bool cumulative = metricData.aggregation_temporality == sdk::metrics::AggregationTemporality::kCumulative;
+
+    std::string family {FAMILY_PREFIX};
+    appendSanitized(family, m_scopeName);
+    family += '_';
+    appendSanitized(family, descriptor.name_);
+
+    // Instruments have no attributes, only the first point of each one is exposed
+    for (const auto& pointAttributes : metricData.point_data_attr_)
+    {
+        const auto& point = pointAttributes.point_data;
+        if (nostd::holds_alternative<sdk::metrics::SumPointData>(point))
+        {
+            const auto& sum = nostd::get<sdk::metrics::SumPointData>(point);
+            if (cumulative && isMonotonic(descriptor.type_))
+            {
+                appendFamilyHeader(out, family, "counter", descriptor.description_);
+                out += fmt::format("{}_total {}\n", family, formatValue(sum.value_));
+            }
+            else
+            {
+                appendFamilyHeader(out, family, "gauge", descriptor.description_);
+                out += fmt::format("{} {}\n", family, formatValue(sum.value_));
+            }
+            return;
+        }
+        if (nostd::holds_alternative<sdk::metrics::HistogramPointData>(point))
+        {
+            appendFamilyHeader(out, family, cumulative ? "histogram" : "gaugehistogram", descriptor.description_);
+            appendHistogram(out, family, nostd::get<sdk::metrics::HistogramPointData>(point), cumulative);
+            return;
+        }
+        if (nostd::holds_alternative<sdk::metrics::LastValuePointData>(point))
+        {
+            const auto& lastValue = nostd::get<sdk::metrics::LastValuePointData>(point);
+            if (lastValue.is_lastvalue_valid_)
+            {
+                appendFamilyHeader(out, family, "gauge", descriptor.description_);
+                out += fmt::format("{} {}\n", family, formatValue(lastValue.value_));
+            }
+            return;
+        }
+    }
+}
+
+bool OpenMetricsExporter::ForceFlush(std::chrono::microseconds /* timeout */) noexcept
+{
+    return true;
+}
+
+bool OpenMetricsExporter::Shutdown(std::chrono::microseconds /* timeout */) noexcept
+{
+    m_isShutdown.store(true);
+    return true;
+}
+
+} // namespace exporter::metrics
+OPENTELEMETRY_END_NAMESPACE
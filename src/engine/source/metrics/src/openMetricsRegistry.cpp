@@ -0,0 +1,45 @@
+#include <metrics/openMetricsRegistry.hpp>
+
+#include <vector>
+
+namespace metricsManager
+{
+
+void OpenMetricsRegistry::setScope(const std::string& scope, std::string text)
+{
+    auto rendered = std::make_shared<const std::string>(std::move(text));
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    m_scopes[scope] = std::move(rendered);
+}
+
+std::string OpenMetricsRegistry::render() const
+{
+    std::vector<std::shared_ptr<const std::string>> texts;
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        texts.reserve(m_scopes.size());
+        for (const auto& [scope, text] : m_scopes)
+        {
+            texts.push_back(text);
+        }
+    }
+
+    std::size_t size = 0;
+    for (const auto& text : texts)
+    {
+        size += text->size();
+    }
+
+    std::string retValue;
+    retValue.reserve(size + 6);
+    for (const auto& text : texts)
+    {
+        retValue += *text;
+    }
+    retValue += "# EOF\n";
+
+    return retValue;
+}
+
+} // namespace metricsManager
@@ -0,0 +1,120 @@
+#include <metrics/profiler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+namespace metricsManager
+{
+
+namespace
+{
+/**
+ * @brief Frames cannot contain the stack separator nor line breaks.
+ */
+std::string frame(const std::string& name)
+{
+    std::string retValue {name};
+    std::replace(retValue.begin(), retValue.end(), ';', ',');
+    std::replace(retValue.begin(), retValue.end(), '\n', ' ');
+    return retValue;
+}
+} // namespace
+
+const std::shared_ptr<Profiler>& Profiler::global()
+{
+    static const auto profiler = std::make_shared<Profiler>();
+    return profiler;
+}
+
+std::shared_ptr<Profiler::Site>
+Profiler::site(const std::string& asset, const std::string& stage, const std::string& operation)
+{
+    auto retValue = std::make_shared<Site>();
+    retValue->asset = asset;
+    retValue->stage = stage;
+    retValue->operation = operation;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_sites.size() >= m_pruneAt)
+    {
+        m_sites.erase(std::remove_if(m_sites.begin(), m_sites.end(), [](const auto& site) { return site.expired(); }),
+                      m_sites.end());
+        m_pruneAt = std::max<std::size_t>(1024, m_sites.size() * 2);
+    }
+    m_sites.emplace_back(retValue);
+
+    return retValue;
+}
+
+void Profiler::start(std::chrono::seconds window)
+{
+    if (window.count() <= 0 || window > MAX_WINDOW)
+    {
+        throw std::runtime_error(
+            fmt::format("The window must be between 1 and {} seconds, got {}", MAX_WINDOW.count(), window.count()));
+    }
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& weakSite : m_sites)
+    {
+        if (auto site = weakSite.lock())
+        {
+            site->count.store(0, std::memory_order_relaxed);
+            site->timeNs.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + window;
+    m_deadline.store(deadline.time_since_epoch().count(), std::memory_order_relaxed);
+    m_active.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::stop()
+{
+    m_active.store(false, std::memory_order_relaxed);
+}
+
+std::vector<Profiler::Entry> Profiler::entries() const
+{
+    std::vector<Entry> retValue;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& weakSite : m_sites)
+    {
+        auto site = weakSite.lock();
+        if (!site)
+        {
+            continue;
+        }
+
+        const auto count = site->count.load(std::memory_order_relaxed);
+        if (count != 0)
+        {
+            const auto timeUs = site->timeNs.load(std::memory_order_relaxed) / 1000;
+            retValue.push_back({site->asset, site->stage, site->operation, count, timeUs});
+        }
+    }
+
+    return retValue;
+}
+
+std::string Profiler::collapsed() const
+{
+    return collapse(entries());
+}
+
+std::string Profiler::collapse(const std::vector<Entry>& entries)
+{
+    std::string retValue;
+    for (const auto& entry : entries)
+    {
+        retValue += fmt::format(
+            "{};{};{} {}\n", frame(entry.asset), frame(entry.stage), frame(entry.operation), entry.timeUs);
+    }
+
+    return retValue;
+}
+
+} // namespace metricsManager
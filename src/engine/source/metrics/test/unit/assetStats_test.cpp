@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include <metrics/assetStats.hpp>
+
+using namespace metricsManager;
+
+TEST(AssetStatsTest, UnknownAsset)
+{
+    AssetStats stats;
+    EXPECT_FALSE(stats.entry("decoder/a/0").has_value());
+    EXPECT_TRUE(stats.entries().empty());
+}
+
+TEST(AssetStatsTest, SameCounters)
+{
+    AssetStats stats;
+    auto counters = stats.counters("decoder/a/0");
+    EXPECT_EQ(counters, stats.counters("decoder/a/0"));
+    EXPECT_NE(counters, stats.counters("decoder/b/0"));
+}
+
+TEST(AssetStatsTest, Entries)
+{
+    AssetStats stats;
+    auto b = stats.counters("decoder/b/0");
+    auto a = stats.counters("decoder/a/0");
+    a->evaluations.add(3);
+    a->successes.add(1);
+    a->cost.store(2);
+
+    auto entries = stats.entries();
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].asset, "decoder/a/0");
+    EXPECT_EQ(entries[0].evaluations, 3);
+    EXPECT_EQ(entries[0].successes, 1);
+    EXPECT_EQ(entries[0].cost, 2);
+    EXPECT_EQ(entries[1].asset, "decoder/b/0");
+    EXPECT_EQ(entries[1].evaluations, 0);
+
+    stats.reset();
+    auto entry = stats.entry("decoder/a/0");
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->evaluations, 0);
+    EXPECT_EQ(entry->successes, 0);
+    EXPECT_EQ(entry->cost, 2);
+}
+
+TEST(AssetStatsTest, Threads)
+{
+    AssetStats stats;
+    auto counters = stats.counters("decoder/a/0");
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 8; ++i)
+    {
+        threads.emplace_back(
+            [counters]()
+            {
+                for (auto j = 0; j < 1000; ++j)
+                {
+                    counters->evaluations.add(1);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(stats.entry("decoder/a/0")->evaluations, 8000);
+}
+
+TEST(AssetStatsTest, Rank)
+{
+    EXPECT_FALSE(AssetStats::rank({"a", AssetStats::MIN_EVALUATIONS - 1, 10, 1}).has_value());
+    EXPECT_DOUBLE_EQ(AssetStats::rank({"a", 200, 50, 5}).value(), 0.05);
+    EXPECT_DOUBLE_EQ(AssetStats::rank({"a", 200, 50, 0}).value(), 0.25);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <thread>
+#include <vector>
+
 #include <metrics/dataHubExporter.hpp>
 #include <metrics/metricsScope.hpp>
 
@@ -43,7 +46,7 @@ TEST_F(MetricsScopeTest, MetricsCounter)
         "instrument_name":"counter_0",
         "instrument_description":"",
         "unit":"",
-        "type":"Counter",
+        "type":"ObservableCounter",
         "attributes":[
             {"type":"SumPointData",
             "value":1.0}
@@ -52,6 +55,33 @@ TEST_F(MetricsScopeTest, MetricsCounter)
     EXPECT_EQ(expected, arrayCounter[0]);
 }
 
+TEST_F(MetricsScopeTest, MetricsCounterThreads)
+{
+    auto counter = m_spMetricsScope->getCounterUInteger("counter_1");
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 32; ++i)
+    {
+        threads.emplace_back(
+            [counter]()
+            {
+                for (auto j = 0; j < 1000; ++j)
+                {
+                    counter->addValue(1);
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(2000));
+    auto arrayCounter = m_spMetricsScope->getAllMetrics().getJson("/counter_1").value().getArray("/records").value();
+    auto value = arrayCounter[0].getInt64("/attributes/0/value");
+
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(32000, value.value());
+}
+
 TEST_F(MetricsScopeTest, MetricsUpDownCounter)
 {
     auto counterUpDown = m_spMetricsScope->getUpDownCounterDouble("counterUpDown_0");
@@ -64,7 +94,7 @@ TEST_F(MetricsScopeTest, MetricsUpDownCounter)
         "instrument_name":"counterUpDown_0",
         "instrument_description":"",
         "unit":"",
-        "type":"UpDownCounter",
+        "type":"ObservableUpDownCounter",
         "attributes":[
             {"type":"SumPointData",
             "value":-1.0}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <metrics/openMetricsExporter.hpp>
+#include <metrics/openMetricsRegistry.hpp>
+
+OPENTELEMETRY_BEGIN_NAMESPACE
+
+namespace
+{
+sdk::metrics::MetricData metricData(const std::string& name,
+                                    sdk::metrics::InstrumentType type,
+                                    sdk::metrics::AggregationTemporality temporality,
+                                    const sdk::metrics::PointType& point)
+{
+    return sdk::metrics::MetricData {
+        sdk::metrics::InstrumentDescriptor {name, "", "", type, sdk::metrics::InstrumentValueType::kDouble},
+        temporality,
+        opentelemetry::common::SystemTimestamp {},
+        opentelemetry::common::SystemTimestamp {},
+        std::vector<sdk::metrics::PointDataAttributes> {{sdk::metrics::PointAttributes {}, point}}};
+}
+
+std::string exportMetrics(sdk::metrics::AggregationTemporality temporality,
+                          const std::vector<sdk::metrics::MetricData>& metrics)
+{
+    auto registry = std::make_shared<metricsManager::OpenMetricsRegistry>();
+    exporter::metrics::OpenMetricsExporter metricsExporter(registry, "endpoint.Event", temporality);
+
+    sdk::metrics::ResourceMetrics data;
+    auto resource = opentelemetry::sdk::resource::Resource::Create(opentelemetry::sdk::resource::ResourceAttributes {});
+    data.resource_ = &resource;
+    auto scope = opentelemetry::sdk::instrumentationscope::InstrumentationScope::Create("library_name", "1.2.0");
+    data.scope_metric_data_ = std::vector<sdk::metrics::ScopeMetrics> {{scope.get(), metrics}};
+
+    EXPECT_EQ(metricsExporter.Export(data), sdk::common::ExportResult::kSuccess);
+    return registry->render();
+}
+} // namespace
+
+TEST(OpenMetricsRegistryTest, RenderEmpty)
+{
+    metricsManager::OpenMetricsRegistry registry;
+    EXPECT_EQ(registry.render(), "# EOF\n");
+}
+
+TEST(OpenMetricsRegistryTest, RenderScopes)
+{
+    metricsManager::OpenMetricsRegistry registry;
+    registry.setScope("b", "b 1\n");
+    registry.setScope("a", "a 1\n");
+    registry.setScope("b", "b 2\n");
+    EXPECT_EQ(registry.render(), "a 1\nb 2\n# EOF\n");
+}
+
+TEST(OpenMetricsExporterTest, CumulativeCounter)
+{
+    sdk::metrics::SumPointData sumPointData {};
+    sumPointData.value_ = int64_t {10};
+
+    auto text = exportMetrics(
+        sdk::metrics::AggregationTemporality::kCumulative,
+        {metricData("Bytes/Received",
+                    sdk::metrics::InstrumentType::kObservableCounter,
+                    sdk::metrics::AggregationTemporality::kCumulative,
+                    sumPointData)});
+
+    EXPECT_EQ(text,
+              "# TYPE wazuh_engine_endpoint_Event_Bytes_Received counter\n"
+              "wazuh_engine_endpoint_Event_Bytes_Received_total 10\n"
+              "# EOF\n");
+}
+
+TEST(OpenMetricsExporterTest, DeltaCounterAsGauge)
+{
+    sdk::metrics::SumPointData sumPointData {};
+    sumPointData.value_ = 2.5;
+
+    auto text = exportMetrics(sdk::metrics::AggregationTemporality::kDelta,
+                              {metricData("Rate",
+                                          sdk::metrics::InstrumentType::kCounter,
+                                          sdk::metrics::AggregationTemporality::kDelta,
+                                          sumPointData)});
+
+    EXPECT_EQ(text,
+              "# TYPE wazuh_engine_endpoint_Event_Rate gauge\n"
+              "wazuh_engine_endpoint_Event_Rate 2.5\n"
+              "# EOF\n");
+}
+
+TEST(OpenMetricsExporterTest, CumulativeHistogram)
+{
+    sdk::metrics::HistogramPointData histogramPointData {};
+    histogramPointData.boundaries_ = std::vector<double> {1.0, 5.0};
+    histogramPointData.counts_ = std::vector<uint64_t> {1, 2, 3};
+    histogramPointData.sum_ = 30.0;
+    histogramPointData.count_ = 6;
+
+    auto text = exportMetrics(sdk::metrics::AggregationTemporality::kCumulative,
+                              {metricData("WaitTime",
+                                          sdk::metrics::InstrumentType::kHistogram,
+                                          sdk::metrics::AggregationTemporality::kCumulative,
+                                          histogramPointData)});
+
+    EXPECT_EQ(text,
+              "# TYPE wazuh_engine_endpoint_Event_WaitTime histogram\n"
+              "wazuh_engine_endpoint_Event_WaitTime_bucket{le=\"1\"} 1\n"
+              "wazuh_engine_endpoint_Event_WaitTime_bucket{le=\"5\"} 3\n"
+              "wazuh_engine_endpoint_Event_WaitTime_bucket{le=\"+Inf\"} 6\n"
+              "wazuh_engine_endpoint_Event_WaitTime_count 6\n"
+              "wazuh_engine_endpoint_Event_WaitTime_sum 30\n"
+              "# EOF\n");
+}
+
+TEST(OpenMetricsExporterTest, Gauge)
+{
+    sdk::metrics::LastValuePointData lastValuePointData {};
+    lastValuePointData.value_ = int64_t {7};
+    lastValuePointData.is_lastvalue_valid_ = true;
+
+    auto text = exportMetrics(sdk::metrics::AggregationTemporality::kCumulative,
+                              {metricData("Size",
+                                          sdk::metrics::InstrumentType::kObservableGauge,
+                                          sdk::metrics::AggregationTemporality::kCumulative,
+                                          lastValuePointData)});
+
+    EXPECT_EQ(text,
+              "# TYPE wazuh_engine_endpoint_Event_Size gauge\n"
+              "wazuh_engine_endpoint_Event_Size 7\n"
+              "# EOF\n");
+}
+
+OPENTELEMETRY_END_NAMESPACE
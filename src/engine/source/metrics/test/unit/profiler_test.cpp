@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <metrics/profiler.hpp>
+
+using namespace metricsManager;
+
+TEST(ProfilerTest, InactiveByDefault)
+{
+    Profiler profiler;
+    EXPECT_FALSE(profiler.active());
+    EXPECT_TRUE(profiler.entries().empty());
+    EXPECT_EQ(profiler.collapsed(), "");
+}
+
+TEST(ProfilerTest, InvalidWindow)
+{
+    Profiler profiler;
+    EXPECT_THROW(profiler.start(std::chrono::seconds(0)), std::runtime_error);
+    EXPECT_THROW(profiler.start(Profiler::MAX_WINDOW + std::chrono::seconds(1)), std::runtime_error);
+    EXPECT_FALSE(profiler.active());
+}
+
+TEST(ProfilerTest, RecordWindow)
+{
+    Profiler profiler;
+    auto site = profiler.site("decoder/a;b/0", "normalize", "field: helper(1)");
+    auto unused = profiler.site("decoder/c/0", "check", "field: exists()");
+
+    profiler.start(std::chrono::seconds(10));
+    ASSERT_TRUE(profiler.active());
+
+    const auto start = std::chrono::steady_clock::now();
+    profiler.record(*site, start, start + std::chrono::microseconds(3));
+    profiler.record(*site, start, start + std::chrono::microseconds(4));
+
+    profiler.stop();
+    EXPECT_FALSE(profiler.active());
+
+    auto entries = profiler.entries();
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].asset, "decoder/a;b/0");
+    EXPECT_EQ(entries[0].count, 2);
+    EXPECT_EQ(entries[0].timeUs, 7);
+
+    // The stack separator is replaced in the frames
+    EXPECT_EQ(profiler.collapsed(), "decoder/a,b/0;normalize;field: helper(1) 7\n");
+
+    // A new window resets the counters
+    profiler.start(std::chrono::seconds(10));
+    EXPECT_TRUE(profiler.entries().empty());
+}
+
+TEST(ProfilerTest, WindowOver)
+{
+    Profiler profiler;
+    auto site = profiler.site("decoder/a/0", "check", "field: exists()");
+
+    profiler.start(std::chrono::seconds(1));
+    const auto late = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    profiler.record(*site, late, late);
+
+    EXPECT_FALSE(profiler.active());
+    EXPECT_TRUE(profiler.entries().empty());
+}
+
+TEST(ProfilerTest, ExpiredSites)
+{
+    Profiler profiler;
+    {
+        auto site = profiler.site("decoder/a/0", "check", "field: exists()");
+        profiler.start(std::chrono::seconds(10));
+        const auto start = std::chrono::steady_clock::now();
+        profiler.record(*site, start, start);
+    }
+
+    EXPECT_TRUE(profiler.entries().empty());
+}
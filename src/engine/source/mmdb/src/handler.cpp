@@ -1,3 +1,7 @@
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
 #include <base/logging.hpp>
 
 #include "handler.hpp"
@@ -39,8 +43,26 @@ std::shared_ptr<IResult> Handler::lookup(const std::string& ipStr) const
         throw std::runtime_error("MMDB database is not open");
     }
 
-    int gai_error, mmdb_error;
-    MMDB_lookup_result_s result = MMDB_lookup_string(mmdb.get(), ipStr.c_str(), &gai_error, &mmdb_error);
+    // The addresses in standard notation are looked up as binary addresses, without the getaddrinfo call of
+    // MMDB_lookup_string
+    int gai_error {0}, mmdb_error;
+    MMDB_lookup_result_s result;
+    sockaddr_in addr4 {};
+    sockaddr_in6 addr6 {};
+    if (1 == inet_pton(AF_INET, ipStr.c_str(), &addr4.sin_addr))
+    {
+        addr4.sin_family = AF_INET;
+        result = MMDB_lookup_sockaddr(mmdb.get(), reinterpret_cast<const sockaddr*>(&addr4), &mmdb_error);
+    }
+    else if (1 == inet_pton(AF_INET6, ipStr.c_str(), &addr6.sin6_addr))
+    {
+        addr6.sin6_family = AF_INET6;
+        result = MMDB_lookup_sockaddr(mmdb.get(), reinterpret_cast<const sockaddr*>(&addr6), &mmdb_error);
+    }
+    else
+    {
+        result = MMDB_lookup_string(mmdb.get(), ipStr.c_str(), &gai_error, &mmdb_error);
+    }
 
     if (0 != gai_error) // translation error
     {
@@ -0,0 +1,670 @@
+#ifndef _PARSEC_STATIC_PARSER_HPP_
+#define _PARSEC_STATIC_PARSER_HPP_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <parsec/parsec.hpp>
+
+/**
+ * @brief Parser combinators with static types
+ *
+ * Each combinator is a class template that holds its parsers by value, so a whole grammar is a single type that the
+ * compiler can inline, without the indirect call and the closure allocation of each parsec::Parser step. The results
+ * carry no trace, a failure only keeps the index and a static message. A grammar is type erased once, at its
+ * boundary, with erase(), and a parsec::Parser can be used inside a grammar with lift().
+ */
+namespace parsec::sp
+{
+/****************************************************************************************
+ * Type definitions
+ ****************************************************************************************/
+
+/**
+ * @brief Return type of the static parsers
+ *
+ * @tparam T type of the contained value
+ */
+template<typename T>
+class Result
+{
+private:
+    std::optional<T> m_value;
+    size_t m_index;
+    const char* m_error;
+
+public:
+    using ValueT = T;
+
+    Result(std::optional<T>&& value, size_t index, const char* error)
+        : m_value {std::move(value)}
+        , m_index {index}
+        , m_error {error}
+    {
+    }
+
+    /**
+     * @brief Check if the result is a success
+     */
+    bool success() const { return m_value.has_value(); }
+
+    /**
+     * @brief Check if the result is a failure
+     */
+    bool failure() const { return !success(); }
+
+    /**
+     * @brief Get the value
+     *
+     * @pre success() == true
+     */
+    const T& value() const& { return *m_value; }
+
+    /**
+     * @brief Get the value
+     *
+     * @pre success() == true
+     */
+    T&& value() && { return std::move(*m_value); }
+
+    /**
+     * @brief Get the error message
+     *
+     * @pre failure() == true
+     */
+    const char* error() const { return m_error; }
+
+    /**
+     * @brief Index pointing to the next character not consumed, or to the character where the parser failed
+     */
+    size_t index() const { return m_index; }
+};
+
+/**
+ * @brief Create a success result
+ *
+ * @tparam T type of the value returned by the parser
+ * @param value value returned by the parser
+ * @param index index pointing to the next character not consumed by the parser
+ * @return Result<T> success result
+ */
+template<typename T>
+Result<T> makeSuccess(T&& value, size_t index)
+{
+    return Result<T> {std::make_optional<T>(std::forward<T>(value)), index, nullptr};
+}
+
+/**
+ * @brief Create a failure result
+ *
+ * @tparam T type of the value returned by the parser
+ * @param error static error message
+ * @param index index where the parser failed
+ * @return Result<T> failure result
+ */
+template<typename T>
+Result<T> makeError(const char* error, size_t index)
+{
+    return Result<T> {std::nullopt, index, error};
+}
+
+/****************************************************************************************
+ * Traits
+ ****************************************************************************************/
+namespace traits
+{
+struct ParserTag
+{
+};
+
+template<typename P>
+inline constexpr bool isParser = std::is_base_of_v<ParserTag, std::decay_t<P>>;
+
+template<typename P>
+using valueT = typename std::decay_t<P>::ValueT;
+} // namespace traits
+
+/**
+ * @brief Base of the static parsers, a static parser is callable as (std::string_view, size_t) -> Result<T>
+ *
+ * @tparam T value returned by the parser
+ */
+template<typename T>
+struct ParserBase : traits::ParserTag
+{
+    using ValueT = T;
+};
+
+/****************************************************************************************
+ * Parsers
+ ****************************************************************************************/
+
+/**
+ * @brief Parser from a callable
+ *
+ * @tparam T value returned by the parser
+ * @tparam F callable (std::string_view, size_t) -> Result<T>
+ */
+template<typename T, typename F>
+class Fn final : public ParserBase<T>
+{
+private:
+    F m_fn;
+
+public:
+    explicit Fn(F fn)
+        : m_fn {std::move(fn)}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const { return m_fn(text, index); }
+};
+
+/**
+ * @brief Make a static parser from a callable, the value type is taken from the Result it returns
+ *
+ * @param fn callable (std::string_view, size_t) -> Result<T>
+ * @return Fn<T, F> parser
+ */
+template<typename F>
+auto make(F fn)
+{
+    using ResultT = std::invoke_result_t<const F&, std::string_view, size_t>;
+    return Fn<typename ResultT::ValueT, F> {std::move(fn)};
+}
+
+/**
+ * @brief Parser that calls a parsec::Parser, so dynamic parsers can be used in a static grammar
+ *
+ * @tparam T value returned by the parser
+ */
+template<typename T>
+class Lift final : public ParserBase<T>
+{
+private:
+    parsec::Parser<T> m_parser;
+
+public:
+    explicit Lift(parsec::Parser<T> parser)
+        : m_parser {std::move(parser)}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_parser(text, index);
+        if (res.failure())
+        {
+            return makeError<T>("LIFT(P), P failed", res.index());
+        }
+
+        return makeSuccess<T>(std::move(res.value()), res.index());
+    }
+};
+
+template<typename T>
+Lift<T> lift(parsec::Parser<T> parser)
+{
+    return Lift<T> {std::move(parser)};
+}
+
+/**
+ * @brief Type erase a static parser at the boundary of a grammar
+ *
+ * A failure is reported with the message and the index of the innermost parser that failed.
+ *
+ * @param parser static parser
+ * @return parsec::Parser<T> parser
+ */
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+parsec::Parser<traits::valueT<P>> erase(P parser)
+{
+    using T = traits::valueT<P>;
+    return [parser = std::move(parser)](std::string_view text, size_t index) -> parsec::Result<T>
+    {
+        auto res = parser(text, index);
+        if (res.failure())
+        {
+            return parsec::makeError<T>(res.error() != nullptr ? res.error() : "", res.index());
+        }
+
+        const auto next = res.index();
+        return parsec::makeSuccess<T>(std::move(res).value(), next);
+    };
+}
+
+/****************************************************************************************
+ * Parser combinators
+ ****************************************************************************************/
+
+/**
+ * @brief Makes parser optional. Always succeeds, returning the value of the parser if it succeeds, or the default
+ * value if it fails.
+ */
+template<typename P>
+class Opt final : public ParserBase<traits::valueT<P>>
+{
+private:
+    P m_p;
+
+public:
+    explicit Opt(P p)
+        : m_p {std::move(p)}
+    {
+    }
+
+    Result<traits::valueT<P>> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_p(text, index);
+        if (res.success())
+        {
+            return res;
+        }
+
+        return makeSuccess<traits::valueT<P>>({}, index);
+    }
+};
+
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+Opt<P> opt(P p)
+{
+    return Opt<P> {std::move(p)};
+}
+
+/**
+ * @brief Succeeds if the given parser fails, and fails if the given parser succeeds. Consumes no input.
+ */
+template<typename P>
+class NegativeLook final : public ParserBase<traits::valueT<P>>
+{
+private:
+    P m_p;
+
+public:
+    explicit NegativeLook(P p)
+        : m_p {std::move(p)}
+    {
+    }
+
+    Result<traits::valueT<P>> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_p(text, index);
+        if (res.success())
+        {
+            return makeError<traits::valueT<P>>("NEG(P), P succeeded", res.index());
+        }
+
+        return makeSuccess<traits::valueT<P>>({}, index);
+    }
+};
+
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+NegativeLook<P> negativeLook(P p)
+{
+    return NegativeLook<P> {std::move(p)};
+}
+
+/**
+ * @brief Succeeds if the given parser succeeds, and fails if the given parser fails. Consumes no input.
+ */
+template<typename P>
+class PositiveLook final : public ParserBase<traits::valueT<P>>
+{
+private:
+    P m_p;
+
+public:
+    explicit PositiveLook(P p)
+        : m_p {std::move(p)}
+    {
+    }
+
+    Result<traits::valueT<P>> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_p(text, index);
+        if (res.failure())
+        {
+            return res;
+        }
+
+        return makeSuccess<traits::valueT<P>>({}, index);
+    }
+};
+
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+PositiveLook<P> positiveLook(P p)
+{
+    return PositiveLook<P> {std::move(p)};
+}
+
+/**
+ * @brief Returns the result of the first parser and ignores the result of the second. If any of the parsers fails,
+ * the result is a failure.
+ */
+template<typename L, typename R>
+class KeepLeft final : public ParserBase<traits::valueT<L>>
+{
+private:
+    L m_l;
+    R m_r;
+
+public:
+    KeepLeft(L l, R r)
+        : m_l {std::move(l)}
+        , m_r {std::move(r)}
+    {
+    }
+
+    Result<traits::valueT<L>> operator()(std::string_view text, size_t index) const
+    {
+        auto resL = m_l(text, index);
+        if (resL.failure())
+        {
+            return resL;
+        }
+
+        auto resR = m_r(text, resL.index());
+        if (resR.failure())
+        {
+            return makeError<traits::valueT<L>>(resR.error(), resR.index());
+        }
+
+        return makeSuccess<traits::valueT<L>>(std::move(resL).value(), resR.index());
+    }
+};
+
+template<typename L, typename R, std::enable_if_t<traits::isParser<L> && traits::isParser<R>, int> = 0>
+KeepLeft<L, R> operator<<(L l, R r)
+{
+    return KeepLeft<L, R> {std::move(l), std::move(r)};
+}
+
+/**
+ * @brief Returns the result of the second parser and ignores the result of the first. If any of the parsers fails,
+ * the result is a failure.
+ */
+template<typename L, typename R>
+class KeepRight final : public ParserBase<traits::valueT<R>>
+{
+private:
+    L m_l;
+    R m_r;
+
+public:
+    KeepRight(L l, R r)
+        : m_l {std::move(l)}
+        , m_r {std::move(r)}
+    {
+    }
+
+    Result<traits::valueT<R>> operator()(std::string_view text, size_t index) const
+    {
+        auto resL = m_l(text, index);
+        if (resL.failure())
+        {
+            return makeError<traits::valueT<R>>(resL.error(), resL.index());
+        }
+
+        return m_r(text, resL.index());
+    }
+};
+
+template<typename L, typename R, std::enable_if_t<traits::isParser<L> && traits::isParser<R>, int> = 0>
+KeepRight<L, R> operator>>(L l, R r)
+{
+    return KeepRight<L, R> {std::move(l), std::move(r)};
+}
+
+/**
+ * @brief Returns the result of the first parser if it succeeds, or the result of the second parser if the first
+ * fails.
+ */
+template<typename L, typename R>
+class Alt final : public ParserBase<traits::valueT<L>>
+{
+    static_assert(std::is_same_v<traits::valueT<L>, traits::valueT<R>>, "Alternatives must return the same type");
+
+private:
+    L m_l;
+    R m_r;
+
+public:
+    Alt(L l, R r)
+        : m_l {std::move(l)}
+        , m_r {std::move(r)}
+    {
+    }
+
+    Result<traits::valueT<L>> operator()(std::string_view text, size_t index) const
+    {
+        auto resL = m_l(text, index);
+        if (resL.success())
+        {
+            return resL;
+        }
+
+        return m_r(text, index);
+    }
+};
+
+template<typename L, typename R, std::enable_if_t<traits::isParser<L> && traits::isParser<R>, int> = 0>
+Alt<L, R> operator|(L l, R r)
+{
+    return Alt<L, R> {std::move(l), std::move(r)};
+}
+
+/**
+ * @brief Returns a tuple of the results of the two parsers. If any of the parsers fails, the result is a failure.
+ */
+template<typename L, typename R>
+class Seq final : public ParserBase<std::tuple<traits::valueT<L>, traits::valueT<R>>>
+{
+private:
+    using T = std::tuple<traits::valueT<L>, traits::valueT<R>>;
+
+    L m_l;
+    R m_r;
+
+public:
+    Seq(L l, R r)
+        : m_l {std::move(l)}
+        , m_r {std::move(r)}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const
+    {
+        auto resL = m_l(text, index);
+        if (resL.failure())
+        {
+            return makeError<T>(resL.error(), resL.index());
+        }
+
+        auto resR = m_r(text, resL.index());
+        if (resR.failure())
+        {
+            return makeError<T>(resR.error(), resR.index());
+        }
+
+        const auto next = resR.index();
+        return makeSuccess<T>(T {std::move(resL).value(), std::move(resR).value()}, next);
+    }
+};
+
+template<typename L, typename R, std::enable_if_t<traits::isParser<L> && traits::isParser<R>, int> = 0>
+Seq<L, R> operator&(L l, R r)
+{
+    return Seq<L, R> {std::move(l), std::move(r)};
+}
+
+/**
+ * @brief Executes the function f on the result of the given parser and returns the result of the function. If the
+ * given parser fails, the result is a failure.
+ */
+template<typename P, typename F>
+class Map final : public ParserBase<std::decay_t<std::invoke_result_t<const F&, traits::valueT<P>&&>>>
+{
+private:
+    using T = std::decay_t<std::invoke_result_t<const F&, traits::valueT<P>&&>>;
+
+    P m_p;
+    F m_f;
+
+public:
+    Map(P p, F f)
+        : m_p {std::move(p)}
+        , m_f {std::move(f)}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_p(text, index);
+        if (res.failure())
+        {
+            return makeError<T>(res.error(), res.index());
+        }
+
+        const auto next = res.index();
+        return makeSuccess<T>(T(m_f(std::move(res).value())), next);
+    }
+};
+
+template<typename F, typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+Map<P, F> fmap(F f, P p)
+{
+    return Map<P, F> {std::move(p), std::move(f)};
+}
+
+/**
+ * @brief Creates a parser from the result of the given parser using the factory function f, and runs it on the rest
+ * of the input. If any of the parsers fails, the result is a failure.
+ */
+template<typename P, typename F>
+class Bind final : public ParserBase<traits::valueT<std::invoke_result_t<const F&, traits::valueT<P>&&>>>
+{
+private:
+    using T = traits::valueT<std::invoke_result_t<const F&, traits::valueT<P>&&>>;
+
+    P m_p;
+    F m_f;
+
+public:
+    Bind(P p, F f)
+        : m_p {std::move(p)}
+        , m_f {std::move(f)}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const
+    {
+        auto res = m_p(text, index);
+        if (res.failure())
+        {
+            return makeError<T>(res.error(), res.index());
+        }
+
+        const auto next = res.index();
+        return m_f(std::move(res).value())(text, next);
+    }
+};
+
+template<typename P, typename F, std::enable_if_t<traits::isParser<P> && !traits::isParser<F>, int> = 0>
+Bind<P, F> operator>>=(P p, F f)
+{
+    return Bind<P, F> {std::move(p), std::move(f)};
+}
+
+/* List of values helper type */
+template<typename T>
+using Values = std::vector<T>;
+
+/**
+ * @brief Executes the given parser min or more times and returns a list of the results. Fails if the given parser
+ * does not succeed at least min times.
+ */
+template<typename P>
+class Many final : public ParserBase<Values<traits::valueT<P>>>
+{
+private:
+    using T = Values<traits::valueT<P>>;
+
+    P m_p;
+    size_t m_min;
+
+public:
+    Many(P p, size_t min)
+        : m_p {std::move(p)}
+        , m_min {min}
+    {
+    }
+
+    Result<T> operator()(std::string_view text, size_t index) const
+    {
+        T values;
+        for (;;)
+        {
+            auto res = m_p(text, index);
+            if (res.failure())
+            {
+                if (values.size() < m_min)
+                {
+                    return makeError<T>(res.error(), res.index());
+                }
+                break;
+            }
+
+            // A parser that consumes nothing would match forever
+            const auto next = res.index();
+            values.push_back(std::move(res).value());
+            if (next == index)
+            {
+                break;
+            }
+            index = next;
+        }
+
+        return makeSuccess<T>(std::move(values), index);
+    }
+};
+
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+Many<P> many(P p)
+{
+    return Many<P> {std::move(p), 0};
+}
+
+template<typename P, std::enable_if_t<traits::isParser<P>, int> = 0>
+Many<P> many1(P p)
+{
+    return Many<P> {std::move(p), 1};
+}
+
+/**
+ * @brief Adds a tag to the result of the given parser. If the given parser fails, the result is a failure.
+ */
+template<typename P, typename Tag, std::enable_if_t<traits::isParser<P>, int> = 0>
+auto tag(P p, Tag tag)
+{
+    return fmap([tag](traits::valueT<P>&& val) { return std::make_tuple(std::move(val), tag); }, std::move(p));
+}
+
+/**
+ * @brief Replaces the result of the given parser with the given tag. If the given parser fails, the result is a
+ * failure.
+ */
+template<typename P, typename Tag, std::enable_if_t<traits::isParser<P>, int> = 0>
+auto replace(P p, Tag tag)
+{
+    return fmap([tag](traits::valueT<P>&&) { return tag; }, std::move(p));
+}
+
+} // namespace parsec::sp
+
+#endif // _PARSEC_STATIC_PARSER_HPP_
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include <parsec/staticParser.hpp>
+
+namespace sp = parsec::sp;
+
+namespace
+{
+auto charP(char c)
+{
+    return sp::make(
+        [c](std::string_view text, size_t index)
+        {
+            if (index < text.size() && text[index] == c)
+            {
+                return sp::makeSuccess<char>(char {c}, index + 1);
+            }
+            return sp::makeError<char>("unexpected character", index);
+        });
+}
+
+auto digitP()
+{
+    return sp::make(
+        [](std::string_view text, size_t index)
+        {
+            if (index < text.size() && text[index] >= '0' && text[index] <= '9')
+            {
+                return sp::makeSuccess<int>(text[index] - '0', index + 1);
+            }
+            return sp::makeError<int>("expected digit", index);
+        });
+}
+} // namespace
+
+TEST(StaticParserTest, Make)
+{
+    auto p = charP('a');
+    static_assert(sp::traits::isParser<decltype(p)>);
+    static_assert(std::is_same_v<sp::traits::valueT<decltype(p)>, char>);
+
+    auto res = p("ab", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(res.index(), 1);
+
+    res = p("ab", 1);
+    ASSERT_TRUE(res.failure());
+    ASSERT_STREQ(res.error(), "unexpected character");
+    ASSERT_EQ(res.index(), 1);
+}
+
+TEST(StaticParserTest, Opt)
+{
+    auto p = sp::opt(charP('a'));
+
+    auto res = p("a", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(res.index(), 1);
+
+    res = p("b", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), char {});
+    ASSERT_EQ(res.index(), 0);
+}
+
+TEST(StaticParserTest, Lookahead)
+{
+    auto neg = sp::negativeLook(charP('a'));
+    ASSERT_TRUE(neg("b", 0).success());
+    ASSERT_EQ(neg("b", 0).index(), 0);
+    ASSERT_TRUE(neg("a", 0).failure());
+
+    auto pos = sp::positiveLook(charP('a'));
+    ASSERT_TRUE(pos("a", 0).success());
+    ASSERT_EQ(pos("a", 0).index(), 0);
+    ASSERT_TRUE(pos("b", 0).failure());
+}
+
+TEST(StaticParserTest, KeepLeftAndRight)
+{
+    auto left = charP('a') << charP('b');
+    auto res = left("ab", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'a');
+    ASSERT_EQ(res.index(), 2);
+    res = left("ac", 0);
+    ASSERT_TRUE(res.failure());
+    ASSERT_EQ(res.index(), 1);
+
+    auto right = charP('a') >> charP('b');
+    res = right("ab", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'b');
+    ASSERT_EQ(res.index(), 2);
+    ASSERT_TRUE(right("bb", 0).failure());
+}
+
+TEST(StaticParserTest, Alternative)
+{
+    auto p = charP('a') | charP('b');
+    ASSERT_EQ(p("a", 0).value(), 'a');
+    ASSERT_EQ(p("b", 0).value(), 'b');
+    ASSERT_TRUE(p("c", 0).failure());
+}
+
+TEST(StaticParserTest, Sequence)
+{
+    auto p = charP('a') & digitP();
+    auto res = p("a7", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), std::make_tuple('a', 7));
+    ASSERT_EQ(res.index(), 2);
+
+    res = p("ax", 0);
+    ASSERT_TRUE(res.failure());
+    ASSERT_STREQ(res.error(), "expected digit");
+    ASSERT_EQ(res.index(), 1);
+}
+
+TEST(StaticParserTest, Fmap)
+{
+    auto p = sp::fmap([](int digit) { return std::to_string(digit * 2); }, digitP());
+    static_assert(std::is_same_v<sp::traits::valueT<decltype(p)>, std::string>);
+    ASSERT_EQ(p("4", 0).value(), "8");
+    ASSERT_TRUE(p("x", 0).failure());
+}
+
+TEST(StaticParserTest, Bind)
+{
+    // The digit tells which character follows
+    auto p = digitP() >>= [](int digit) { return charP(static_cast<char>('a' + digit)); };
+    auto res = p("2c", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), 'c');
+    ASSERT_EQ(res.index(), 2);
+    ASSERT_TRUE(p("2b", 0).failure());
+}
+
+TEST(StaticParserTest, Many)
+{
+    auto p = sp::many(digitP());
+    auto res = p("123x", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), sp::Values<int>({1, 2, 3}));
+    ASSERT_EQ(res.index(), 3);
+
+    res = p("x", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_TRUE(res.value().empty());
+    ASSERT_EQ(res.index(), 0);
+
+    // A parser that consumes nothing only matches once
+    auto empty = sp::many(sp::opt(charP('a')));
+    ASSERT_EQ(empty("b", 0).value().size(), 1);
+}
+
+TEST(StaticParserTest, Many1)
+{
+    auto p = sp::many1(digitP());
+    ASSERT_EQ(p("12", 0).value(), sp::Values<int>({1, 2}));
+    ASSERT_TRUE(p("x", 0).failure());
+}
+
+TEST(StaticParserTest, TagAndReplace)
+{
+    auto tagged = sp::tag(charP('a'), 5);
+    ASSERT_EQ(tagged("a", 0).value(), std::make_tuple('a', 5));
+
+    auto replaced = sp::replace(charP('a'), std::string {"A"});
+    ASSERT_EQ(replaced("a", 0).value(), "A");
+}
+
+TEST(StaticParserTest, EraseAndLift)
+{
+    parsec::Parser<sp::Values<int>> erased = sp::erase(sp::many1(digitP()) << charP(';'));
+
+    auto res = erased("42;", 0);
+    ASSERT_TRUE(res.success());
+    ASSERT_EQ(res.value(), sp::Values<int>({4, 2}));
+    ASSERT_EQ(res.index(), 3);
+
+    res = erased("42", 0);
+    ASSERT_TRUE(res.failure());
+    ASSERT_EQ(res.error(), "unexpected character");
+    ASSERT_EQ(res.index(), 2);
+
+    auto lifted = sp::lift(erased) >> charP('!');
+    ASSERT_EQ(lifted("1;!", 0).value(), '!');
+    ASSERT_TRUE(lifted("1!", 0).failure());
+}
@@ -5,6 +5,7 @@
 #include <variant>
 
 #include <base/error.hpp>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/message.h>
 #include <google/protobuf/struct.pb.h>
 #include <google/protobuf/stubs/common.h>
@@ -13,18 +14,35 @@
 namespace eMessage
 {
 
+constexpr std::size_t ARENA_START_BLOCK_SIZE = 16 * 1024; ///< First block of the arenas of the API messages
+constexpr std::size_t ARENA_MAX_BLOCK_SIZE = 1024 * 1024; ///< Largest block of the arenas of the API messages
+
 /**
-* @brief Parse a JSON string into a google::protobuf::Message.
+ * @brief Options of the arenas of the API messages.
  *
-* @tparam T The type of the google::protobuf::Message.
-* @param json The JSON string to parse.
-* @return A variant object with either an error message or the parsed message.
-*/
+ * The messages of a request and its response, and all their submessages and strings, are allocated in a few large
+ * blocks released at once with the arena, instead of one heap allocation each.
+ */
+inline google::protobuf::ArenaOptions arenaOptions()
+{
+    google::protobuf::ArenaOptions options;
+    options.start_block_size = ARENA_START_BLOCK_SIZE;
+    options.max_block_size = ARENA_MAX_BLOCK_SIZE;
+    return options;
+}
+
+/**
+ * @brief Parse a JSON string into an existing google::protobuf::Message, which may be allocated on an arena.
+ *
+ * @tparam T The type of the google::protobuf::Message.
+ * @param json The JSON string to parse.
+ * @param message The message to parse into.
+ * @return base::OptError The error if the JSON is not a valid message.
+ */
 template<typename T>
-std::variant<base::Error, T> eMessageFromJson(const std::string& json)
+base::OptError eMessageFromJson(const std::string& json, T& message)
 {
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
-    T message;
 
     google::protobuf::util::JsonParseOptions inOptions = google::protobuf::util::JsonParseOptions();
     // inOptions.ignore_unknown_fields = false;
@@ -34,24 +52,61 @@ std::variant<base::Error, T> eMessageFromJson(const std::string& json)
     const auto res = google::protobuf::util::JsonStringToMessage(json, &message, inOptions);
     if (res.ok())
     {
-        return message;
+        return std::nullopt;
     }
     return base::Error {res.ToString()};
 }
 
 /**
-* @brief Serialize a google::protobuf::Message into a JSON string.
-*
+* @brief Parse a JSON string into a google::protobuf::Message.
+ *
 * @tparam T The type of the google::protobuf::Message.
-* @param message The message to serialize.
-* @param printPrimitiveFields Whether to always print primitive fields, even if their values are their default values.
-* @return A variant object with either an error message or the JSON string.
+* @param json The JSON string to parse.
+* @return A variant object with either an error message or the parsed message.
 */
 template<typename T>
-std::variant<base::Error, std::string> eMessageToJson(const T& message, bool printPrimitiveFields = true)
+std::variant<base::Error, T> eMessageFromJson(const std::string& json)
+{
+    T message;
+    if (auto error = eMessageFromJson<T>(json, message))
+    {
+        return std::move(error.value());
+    }
+    return message;
+}
+
+/**
+ * @brief Parse a JSON string into a google::protobuf::Message allocated on an arena.
+ *
+ * @tparam T The type of the google::protobuf::Message.
+ * @param json The JSON string to parse.
+ * @param arena The arena that owns the message.
+ * @return A variant object with either an error message or the parsed message, released with the arena.
+ */
+template<typename T>
+std::variant<base::Error, T*> eMessageFromJson(const std::string& json, google::protobuf::Arena& arena)
+{
+    auto* message = google::protobuf::Arena::CreateMessage<T>(&arena);
+    if (auto error = eMessageFromJson<T>(json, *message))
+    {
+        return std::move(error.value());
+    }
+    return message;
+}
+
+/**
+ * @brief Serialize a google::protobuf::Message into a JSON string, written to an output buffer.
+ *
+ * @tparam T The type of the google::protobuf::Message.
+ * @param message The message to serialize.
+ * @param out The buffer the JSON is written to, its capacity is reused. It may be moved to the wire as is.
+ * @param printPrimitiveFields Whether to always print primitive fields, even if their values are their default values.
+ * @return base::OptError The error if the message cannot be serialized.
+ */
+template<typename T>
+base::OptError eMessageToJson(const T& message, std::string& out, bool printPrimitiveFields = true)
 {
     static_assert(std::is_base_of<google::protobuf::Message, T>::value, "T must be a derived class of proto::Message");
-    std::string dataStr;
 
     google::protobuf::util::JsonPrintOptions outOptions = google::protobuf::util::JsonPrintOptions();
     outOptions.add_whitespace = false;
@@ -59,14 +114,34 @@ std::variant<base::Error, std::string> eMessageToJson(const T& message, bool pri
     outOptions.preserve_proto_field_names = true;
     outOptions.always_print_enums_as_ints = false;
 
-    const auto res = google::protobuf::util::MessageToJsonString(message, &dataStr, outOptions);
+    out.clear();
+    const auto res = google::protobuf::util::MessageToJsonString(message, &out, outOptions);
     if (res.ok())
     {
-        return dataStr;
+        return std::nullopt;
     }
     return base::Error {res.ToString()};
 }
 
+/**
+* @brief Serialize a google::protobuf::Message into a JSON string.
+*
+* @tparam T The type of the google::protobuf::Message.
+* @param message The message to serialize.
+* @param printPrimitiveFields Whether to always print primitive fields, even if their values are their default values.
+* @return A variant object with either an error message or the JSON string.
+*/
+template<typename T>
+std::variant<base::Error, std::string> eMessageToJson(const T& message, bool printPrimitiveFields = true)
+{
+    std::string dataStr;
+    if (auto error = eMessageToJson<T>(message, dataStr, printPrimitiveFields))
+    {
+        return std::move(error.value());
+    }
+    return dataStr;
+}
+
 /**
 * @brief Serialize a google::protobuf::RepeatedPtrField<T> into a JSON string.
 *
@@ -52,6 +52,45 @@ namespace wazuh {
 namespace api {
 namespace engine {
 namespace metrics {
+class AllocationEntry;
+struct AllocationEntryDefaultTypeInternal;
+extern AllocationEntryDefaultTypeInternal _AllocationEntry_default_instance_;
+class AllocationsGet_Request;
+struct AllocationsGet_RequestDefaultTypeInternal;
+extern AllocationsGet_RequestDefaultTypeInternal _AllocationsGet_Request_default_instance_;
+class AllocationsGet_Response;
+struct AllocationsGet_ResponseDefaultTypeInternal;
+extern AllocationsGet_ResponseDefaultTypeInternal _AllocationsGet_Response_default_instance_;
+class AllocationsReset_Request;
+struct AllocationsReset_RequestDefaultTypeInternal;
+extern AllocationsReset_RequestDefaultTypeInternal _AllocationsReset_Request_default_instance_;
+class AllocationsReset_Response;
+struct AllocationsReset_ResponseDefaultTypeInternal;
+extern AllocationsReset_ResponseDefaultTypeInternal _AllocationsReset_Response_default_instance_;
+class ArenaEntry;
+struct ArenaEntryDefaultTypeInternal;
+extern ArenaEntryDefaultTypeInternal _ArenaEntry_default_instance_;
+class ArenasGet_Request;
+struct ArenasGet_RequestDefaultTypeInternal;
+extern ArenasGet_RequestDefaultTypeInternal _ArenasGet_Request_default_instance_;
+class ArenasGet_Response;
+struct ArenasGet_ResponseDefaultTypeInternal;
+extern ArenasGet_ResponseDefaultTypeInternal _ArenasGet_Response_default_instance_;
+class AssetStatsEntry;
+struct AssetStatsEntryDefaultTypeInternal;
+extern AssetStatsEntryDefaultTypeInternal _AssetStatsEntry_default_instance_;
+class AssetStatsGet_Request;
+struct AssetStatsGet_RequestDefaultTypeInternal;
+extern AssetStatsGet_RequestDefaultTypeInternal _AssetStatsGet_Request_default_instance_;
+class AssetStatsGet_Response;
+struct AssetStatsGet_ResponseDefaultTypeInternal;
+extern AssetStatsGet_ResponseDefaultTypeInternal _AssetStatsGet_Response_default_instance_;
+class AssetStatsReset_Request;
+struct AssetStatsReset_RequestDefaultTypeInternal;
+extern AssetStatsReset_RequestDefaultTypeInternal _AssetStatsReset_Request_default_instance_;
+class AssetStatsReset_Response;
+struct AssetStatsReset_ResponseDefaultTypeInternal;
+extern AssetStatsReset_ResponseDefaultTypeInternal _AssetStatsReset_Response_default_instance_;
 class Dump_Request;
 struct Dump_RequestDefaultTypeInternal;
 extern Dump_RequestDefaultTypeInternal _Dump_Request_default_instance_;
@@ -76,6 +115,27 @@ extern List_RequestDefaultTypeInternal _List_Request_default_instance_;
 class List_Response;
 struct List_ResponseDefaultTypeInternal;
 extern List_ResponseDefaultTypeInternal _List_Response_default_instance_;
+class ProfileEntry;
+struct ProfileEntryDefaultTypeInternal;
+extern ProfileEntryDefaultTypeInternal _ProfileEntry_default_instance_;
+class ProfilerGet_Request;
+struct ProfilerGet_RequestDefaultTypeInternal;
+extern ProfilerGet_RequestDefaultTypeInternal _ProfilerGet_Request_default_instance_;
+class ProfilerGet_Response;
+struct ProfilerGet_ResponseDefaultTypeInternal;
+extern ProfilerGet_ResponseDefaultTypeInternal _ProfilerGet_Response_default_instance_;
+class ProfilerStart_Request;
+struct ProfilerStart_RequestDefaultTypeInternal;
+extern ProfilerStart_RequestDefaultTypeInternal _ProfilerStart_Request_default_instance_;
+class ProfilerStart_Response;
+struct ProfilerStart_ResponseDefaultTypeInternal;
+extern ProfilerStart_ResponseDefaultTypeInternal _ProfilerStart_Response_default_instance_;
+class ProfilerStop_Request;
+struct ProfilerStop_RequestDefaultTypeInternal;
+extern ProfilerStop_RequestDefaultTypeInternal _ProfilerStop_Request_default_instance_;
+class ProfilerStop_Response;
+struct ProfilerStop_ResponseDefaultTypeInternal;
+extern ProfilerStop_ResponseDefaultTypeInternal _ProfilerStop_Response_default_instance_;
 class Test_Request;
 struct Test_RequestDefaultTypeInternal;
 extern Test_RequestDefaultTypeInternal _Test_Request_default_instance_;
@@ -88,6 +148,19 @@ extern Test_ResponseDefaultTypeInternal _Test_Response_default_instance_;
 }  // namespace wazuh
 }  // namespace com
 PROTOBUF_NAMESPACE_OPEN
+template<> ::com::wazuh::api::engine::metrics::AllocationEntry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AllocationEntry>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AllocationsGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AllocationsGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AllocationsGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AllocationsGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AllocationsReset_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AllocationsReset_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AllocationsReset_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AllocationsReset_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ArenaEntry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ArenaEntry>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ArenasGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ArenasGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ArenasGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ArenasGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AssetStatsEntry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AssetStatsEntry>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AssetStatsGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AssetStatsGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AssetStatsGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AssetStatsGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AssetStatsReset_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AssetStatsReset_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::AssetStatsReset_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::AssetStatsReset_Response>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::Dump_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Dump_Request>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::Dump_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Dump_Response>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::Enable_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Enable_Request>(Arena*);
@@ -96,6 +169,13 @@ template<> ::com::wazuh::api::engine::metrics::Get_Request* Arena::CreateMaybeMe
 template<> ::com::wazuh::api::engine::metrics::Get_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Get_Response>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::List_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::List_Request>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::List_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::List_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfileEntry* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfileEntry>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerStart_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerStart_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerStart_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerStart_Response>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerStop_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerStop_Request>(Arena*);
+template<> ::com::wazuh::api::engine::metrics::ProfilerStop_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::ProfilerStop_Response>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::Test_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Test_Request>(Arena*);
 template<> ::com::wazuh::api::engine::metrics::Test_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::metrics::Test_Response>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -1781,82 +1861,5002 @@ class Test_Response final :
   union { Impl_ _impl_; };
   friend struct ::TableStruct_metrics_2eproto;
 };
+// -------------------------------------------------------------------
+
+class ProfilerStart_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerStart_Request) */ {
+ public:
+  inline ProfilerStart_Request() : ProfilerStart_Request(nullptr) {}
+  ~ProfilerStart_Request() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerStart_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerStart_Request(const ProfilerStart_Request& from);
+  ProfilerStart_Request(ProfilerStart_Request&& from) noexcept
+    : ProfilerStart_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerStart_Request& operator=(const ProfilerStart_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerStart_Request& operator=(ProfilerStart_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerStart_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerStart_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerStart_Request*>(
+               &_ProfilerStart_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(ProfilerStart_Request& a, ProfilerStart_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerStart_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerStart_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerStart_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerStart_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerStart_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerStart_Request& from) {
+    ProfilerStart_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerStart_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerStart_Request";
+  }
+  protected:
+  explicit ProfilerStart_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSecondsFieldNumber = 1,
+  };
+  // optional uint32 seconds = 1;
+  bool has_seconds() const;
+  private:
+  bool _internal_has_seconds() const;
+  public:
+  void clear_seconds();
+  uint32_t seconds() const;
+  void set_seconds(uint32_t value);
+  private:
+  uint32_t _internal_seconds() const;
+  void _internal_set_seconds(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerStart_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t seconds_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerStart_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerStart_Response) */ {
+ public:
+  inline ProfilerStart_Response() : ProfilerStart_Response(nullptr) {}
+  ~ProfilerStart_Response() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerStart_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerStart_Response(const ProfilerStart_Response& from);
+  ProfilerStart_Response(ProfilerStart_Response&& from) noexcept
+    : ProfilerStart_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerStart_Response& operator=(const ProfilerStart_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerStart_Response& operator=(ProfilerStart_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerStart_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerStart_Response* internal_default_instance() {
+    return reinterpret_cast<const ProfilerStart_Response*>(
+               &_ProfilerStart_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(ProfilerStart_Response& a, ProfilerStart_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerStart_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerStart_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerStart_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerStart_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerStart_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerStart_Response& from) {
+    ProfilerStart_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerStart_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerStart_Response";
+  }
+  protected:
+  explicit ProfilerStart_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerStart_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerStop_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerStop_Request) */ {
+ public:
+  inline ProfilerStop_Request() : ProfilerStop_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ProfilerStop_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerStop_Request(const ProfilerStop_Request& from);
+  ProfilerStop_Request(ProfilerStop_Request&& from) noexcept
+    : ProfilerStop_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerStop_Request& operator=(const ProfilerStop_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerStop_Request& operator=(ProfilerStop_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerStop_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerStop_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerStop_Request*>(
+               &_ProfilerStop_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(ProfilerStop_Request& a, ProfilerStop_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerStop_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerStop_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerStop_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerStop_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ProfilerStop_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ProfilerStop_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerStop_Request";
+  }
+  protected:
+  explicit ProfilerStop_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerStop_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerStop_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerStop_Response) */ {
+ public:
+  inline ProfilerStop_Response() : ProfilerStop_Response(nullptr) {}
+  ~ProfilerStop_Response() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerStop_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerStop_Response(const ProfilerStop_Response& from);
+  ProfilerStop_Response(ProfilerStop_Response&& from) noexcept
+    : ProfilerStop_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerStop_Response& operator=(const ProfilerStop_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerStop_Response& operator=(ProfilerStop_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerStop_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerStop_Response* internal_default_instance() {
+    return reinterpret_cast<const ProfilerStop_Response*>(
+               &_ProfilerStop_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(ProfilerStop_Response& a, ProfilerStop_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerStop_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerStop_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerStop_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerStop_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerStop_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerStop_Response& from) {
+    ProfilerStop_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerStop_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerStop_Response";
+  }
+  protected:
+  explicit ProfilerStop_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerStop_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfileEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfileEntry) */ {
+ public:
+  inline ProfileEntry() : ProfileEntry(nullptr) {}
+  ~ProfileEntry() override;
+  explicit PROTOBUF_CONSTEXPR ProfileEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfileEntry(const ProfileEntry& from);
+  ProfileEntry(ProfileEntry&& from) noexcept
+    : ProfileEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfileEntry& operator=(const ProfileEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfileEntry& operator=(ProfileEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfileEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfileEntry* internal_default_instance() {
+    return reinterpret_cast<const ProfileEntry*>(
+               &_ProfileEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ProfileEntry& a, ProfileEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfileEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfileEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfileEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfileEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfileEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfileEntry& from) {
+    ProfileEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfileEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfileEntry";
+  }
+  protected:
+  explicit ProfileEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetFieldNumber = 1,
+    kStageFieldNumber = 2,
+    kOperationFieldNumber = 3,
+    kCountFieldNumber = 4,
+    kTimeUsFieldNumber = 5,
+  };
+  // string asset = 1;
+  void clear_asset();
+  const std::string& asset() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_asset(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_asset();
+  PROTOBUF_NODISCARD std::string* release_asset();
+  void set_allocated_asset(std::string* asset);
+  private:
+  const std::string& _internal_asset() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_asset(const std::string& value);
+  std::string* _internal_mutable_asset();
+  public:
+
+  // string stage = 2;
+  void clear_stage();
+  const std::string& stage() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_stage(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_stage();
+  PROTOBUF_NODISCARD std::string* release_stage();
+  void set_allocated_stage(std::string* stage);
+  private:
+  const std::string& _internal_stage() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_stage(const std::string& value);
+  std::string* _internal_mutable_stage();
+  public:
+
+  // string operation = 3;
+  void clear_operation();
+  const std::string& operation() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_operation(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_operation();
+  PROTOBUF_NODISCARD std::string* release_operation();
+  void set_allocated_operation(std::string* operation);
+  private:
+  const std::string& _internal_operation() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_operation(const std::string& value);
+  std::string* _internal_mutable_operation();
+  public:
+
+  // uint64 count = 4;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // uint64 timeUs = 5;
+  void clear_timeus();
+  uint64_t timeus() const;
+  void set_timeus(uint64_t value);
+  private:
+  uint64_t _internal_timeus() const;
+  void _internal_set_timeus(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfileEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr asset_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr stage_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr operation_;
+    uint64_t count_;
+    uint64_t timeus_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerGet_Request) */ {
+ public:
+  inline ProfilerGet_Request() : ProfilerGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ProfilerGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerGet_Request(const ProfilerGet_Request& from);
+  ProfilerGet_Request(ProfilerGet_Request&& from) noexcept
+    : ProfilerGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerGet_Request& operator=(const ProfilerGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerGet_Request& operator=(ProfilerGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerGet_Request* internal_default_instance() {
+    return reinterpret_cast<const ProfilerGet_Request*>(
+               &_ProfilerGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(ProfilerGet_Request& a, ProfilerGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ProfilerGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ProfilerGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerGet_Request";
+  }
+  protected:
+  explicit ProfilerGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProfilerGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ProfilerGet_Response) */ {
+ public:
+  inline ProfilerGet_Response() : ProfilerGet_Response(nullptr) {}
+  ~ProfilerGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR ProfilerGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProfilerGet_Response(const ProfilerGet_Response& from);
+  ProfilerGet_Response(ProfilerGet_Response&& from) noexcept
+    : ProfilerGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ProfilerGet_Response& operator=(const ProfilerGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProfilerGet_Response& operator=(ProfilerGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ProfilerGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProfilerGet_Response* internal_default_instance() {
+    return reinterpret_cast<const ProfilerGet_Response*>(
+               &_ProfilerGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ProfilerGet_Response& a, ProfilerGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProfilerGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProfilerGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProfilerGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProfilerGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ProfilerGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ProfilerGet_Response& from) {
+    ProfilerGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ProfilerGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ProfilerGet_Response";
+  }
+  protected:
+  explicit ProfilerGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 5,
+    kErrorFieldNumber = 2,
+    kCollapsedFieldNumber = 4,
+    kStatusFieldNumber = 1,
+    kActiveFieldNumber = 3,
+  };
+  // repeated .com.wazuh.api.engine.metrics.ProfileEntry entries = 5;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::com::wazuh::api::engine::metrics::ProfileEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ProfileEntry >*
+      mutable_entries();
+  private:
+  const ::com::wazuh::api::engine::metrics::ProfileEntry& _internal_entries(int index) const;
+  ::com::wazuh::api::engine::metrics::ProfileEntry* _internal_add_entries();
+  public:
+  const ::com::wazuh::api::engine::metrics::ProfileEntry& entries(int index) const;
+  ::com::wazuh::api::engine::metrics::ProfileEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ProfileEntry >&
+      entries() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // optional string collapsed = 4;
+  bool has_collapsed() const;
+  private:
+  bool _internal_has_collapsed() const;
+  public:
+  void clear_collapsed();
+  const std::string& collapsed() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_collapsed(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_collapsed();
+  PROTOBUF_NODISCARD std::string* release_collapsed();
+  void set_allocated_collapsed(std::string* collapsed);
+  private:
+  const std::string& _internal_collapsed() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_collapsed(const std::string& value);
+  std::string* _internal_mutable_collapsed();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // optional bool active = 3;
+  bool has_active() const;
+  private:
+  bool _internal_has_active() const;
+  public:
+  void clear_active();
+  bool active() const;
+  void set_active(bool value);
+  private:
+  bool _internal_active() const;
+  void _internal_set_active(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ProfilerGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ProfileEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr collapsed_;
+    int status_;
+    bool active_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AssetStatsEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AssetStatsEntry) */ {
+ public:
+  inline AssetStatsEntry() : AssetStatsEntry(nullptr) {}
+  ~AssetStatsEntry() override;
+  explicit PROTOBUF_CONSTEXPR AssetStatsEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AssetStatsEntry(const AssetStatsEntry& from);
+  AssetStatsEntry(AssetStatsEntry&& from) noexcept
+    : AssetStatsEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline AssetStatsEntry& operator=(const AssetStatsEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AssetStatsEntry& operator=(AssetStatsEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AssetStatsEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AssetStatsEntry* internal_default_instance() {
+    return reinterpret_cast<const AssetStatsEntry*>(
+               &_AssetStatsEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(AssetStatsEntry& a, AssetStatsEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AssetStatsEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AssetStatsEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AssetStatsEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AssetStatsEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AssetStatsEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AssetStatsEntry& from) {
+    AssetStatsEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AssetStatsEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AssetStatsEntry";
+  }
+  protected:
+  explicit AssetStatsEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetFieldNumber = 1,
+    kEvaluationsFieldNumber = 2,
+    kSuccessesFieldNumber = 3,
+    kCostFieldNumber = 4,
+  };
+  // string asset = 1;
+  void clear_asset();
+  const std::string& asset() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_asset(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_asset();
+  PROTOBUF_NODISCARD std::string* release_asset();
+  void set_allocated_asset(std::string* asset);
+  private:
+  const std::string& _internal_asset() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_asset(const std::string& value);
+  std::string* _internal_mutable_asset();
+  public:
+
+  // uint64 evaluations = 2;
+  void clear_evaluations();
+  uint64_t evaluations() const;
+  void set_evaluations(uint64_t value);
+  private:
+  uint64_t _internal_evaluations() const;
+  void _internal_set_evaluations(uint64_t value);
+  public:
+
+  // uint64 successes = 3;
+  void clear_successes();
+  uint64_t successes() const;
+  void set_successes(uint64_t value);
+  private:
+  uint64_t _internal_successes() const;
+  void _internal_set_successes(uint64_t value);
+  public:
+
+  // uint64 cost = 4;
+  void clear_cost();
+  uint64_t cost() const;
+  void set_cost(uint64_t value);
+  private:
+  uint64_t _internal_cost() const;
+  void _internal_set_cost(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AssetStatsEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr asset_;
+    uint64_t evaluations_;
+    uint64_t successes_;
+    uint64_t cost_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AssetStatsGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AssetStatsGet_Request) */ {
+ public:
+  inline AssetStatsGet_Request() : AssetStatsGet_Request(nullptr) {}
+  ~AssetStatsGet_Request() override;
+  explicit PROTOBUF_CONSTEXPR AssetStatsGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AssetStatsGet_Request(const AssetStatsGet_Request& from);
+  AssetStatsGet_Request(AssetStatsGet_Request&& from) noexcept
+    : AssetStatsGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline AssetStatsGet_Request& operator=(const AssetStatsGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AssetStatsGet_Request& operator=(AssetStatsGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AssetStatsGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AssetStatsGet_Request* internal_default_instance() {
+    return reinterpret_cast<const AssetStatsGet_Request*>(
+               &_AssetStatsGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(AssetStatsGet_Request& a, AssetStatsGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AssetStatsGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AssetStatsGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AssetStatsGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AssetStatsGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AssetStatsGet_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AssetStatsGet_Request& from) {
+    AssetStatsGet_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AssetStatsGet_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AssetStatsGet_Request";
+  }
+  protected:
+  explicit AssetStatsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAssetFieldNumber = 1,
+  };
+  // optional string asset = 1;
+  bool has_asset() const;
+  private:
+  bool _internal_has_asset() const;
+  public:
+  void clear_asset();
+  const std::string& asset() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_asset(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_asset();
+  PROTOBUF_NODISCARD std::string* release_asset();
+  void set_allocated_asset(std::string* asset);
+  private:
+  const std::string& _internal_asset() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_asset(const std::string& value);
+  std::string* _internal_mutable_asset();
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AssetStatsGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr asset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AssetStatsGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AssetStatsGet_Response) */ {
+ public:
+  inline AssetStatsGet_Response() : AssetStatsGet_Response(nullptr) {}
+  ~AssetStatsGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR AssetStatsGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AssetStatsGet_Response(const AssetStatsGet_Response& from);
+  AssetStatsGet_Response(AssetStatsGet_Response&& from) noexcept
+    : AssetStatsGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline AssetStatsGet_Response& operator=(const AssetStatsGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AssetStatsGet_Response& operator=(AssetStatsGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AssetStatsGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AssetStatsGet_Response* internal_default_instance() {
+    return reinterpret_cast<const AssetStatsGet_Response*>(
+               &_AssetStatsGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(AssetStatsGet_Response& a, AssetStatsGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AssetStatsGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AssetStatsGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AssetStatsGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AssetStatsGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AssetStatsGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AssetStatsGet_Response& from) {
+    AssetStatsGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AssetStatsGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AssetStatsGet_Response";
+  }
+  protected:
+  explicit AssetStatsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.metrics.AssetStatsEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::com::wazuh::api::engine::metrics::AssetStatsEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AssetStatsEntry >*
+      mutable_entries();
+  private:
+  const ::com::wazuh::api::engine::metrics::AssetStatsEntry& _internal_entries(int index) const;
+  ::com::wazuh::api::engine::metrics::AssetStatsEntry* _internal_add_entries();
+  public:
+  const ::com::wazuh::api::engine::metrics::AssetStatsEntry& entries(int index) const;
+  ::com::wazuh::api::engine::metrics::AssetStatsEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AssetStatsEntry >&
+      entries() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AssetStatsGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AssetStatsEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AssetStatsReset_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AssetStatsReset_Request) */ {
+ public:
+  inline AssetStatsReset_Request() : AssetStatsReset_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR AssetStatsReset_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AssetStatsReset_Request(const AssetStatsReset_Request& from);
+  AssetStatsReset_Request(AssetStatsReset_Request&& from) noexcept
+    : AssetStatsReset_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline AssetStatsReset_Request& operator=(const AssetStatsReset_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AssetStatsReset_Request& operator=(AssetStatsReset_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AssetStatsReset_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AssetStatsReset_Request* internal_default_instance() {
+    return reinterpret_cast<const AssetStatsReset_Request*>(
+               &_AssetStatsReset_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(AssetStatsReset_Request& a, AssetStatsReset_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AssetStatsReset_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AssetStatsReset_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AssetStatsReset_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AssetStatsReset_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const AssetStatsReset_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const AssetStatsReset_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AssetStatsReset_Request";
+  }
+  protected:
+  explicit AssetStatsReset_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AssetStatsReset_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AssetStatsReset_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AssetStatsReset_Response) */ {
+ public:
+  inline AssetStatsReset_Response() : AssetStatsReset_Response(nullptr) {}
+  ~AssetStatsReset_Response() override;
+  explicit PROTOBUF_CONSTEXPR AssetStatsReset_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AssetStatsReset_Response(const AssetStatsReset_Response& from);
+  AssetStatsReset_Response(AssetStatsReset_Response&& from) noexcept
+    : AssetStatsReset_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline AssetStatsReset_Response& operator=(const AssetStatsReset_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AssetStatsReset_Response& operator=(AssetStatsReset_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AssetStatsReset_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AssetStatsReset_Response* internal_default_instance() {
+    return reinterpret_cast<const AssetStatsReset_Response*>(
+               &_AssetStatsReset_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(AssetStatsReset_Response& a, AssetStatsReset_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AssetStatsReset_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AssetStatsReset_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AssetStatsReset_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AssetStatsReset_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AssetStatsReset_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AssetStatsReset_Response& from) {
+    AssetStatsReset_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AssetStatsReset_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AssetStatsReset_Response";
+  }
+  protected:
+  explicit AssetStatsReset_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AssetStatsReset_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AllocationEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AllocationEntry) */ {
+ public:
+  inline AllocationEntry() : AllocationEntry(nullptr) {}
+  ~AllocationEntry() override;
+  explicit PROTOBUF_CONSTEXPR AllocationEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AllocationEntry(const AllocationEntry& from);
+  AllocationEntry(AllocationEntry&& from) noexcept
+    : AllocationEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline AllocationEntry& operator=(const AllocationEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AllocationEntry& operator=(AllocationEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AllocationEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AllocationEntry* internal_default_instance() {
+    return reinterpret_cast<const AllocationEntry*>(
+               &_AllocationEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(AllocationEntry& a, AllocationEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AllocationEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AllocationEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AllocationEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllocationEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AllocationEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AllocationEntry& from) {
+    AllocationEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AllocationEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AllocationEntry";
+  }
+  protected:
+  explicit AllocationEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPolicyFieldNumber = 1,
+    kNameFieldNumber = 2,
+    kEventsFieldNumber = 3,
+    kAllocationsFieldNumber = 4,
+    kBytesFieldNumber = 5,
+  };
+  // string policy = 1;
+  void clear_policy();
+  const std::string& policy() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_policy(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_policy();
+  PROTOBUF_NODISCARD std::string* release_policy();
+  void set_allocated_policy(std::string* policy);
+  private:
+  const std::string& _internal_policy() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_policy(const std::string& value);
+  std::string* _internal_mutable_policy();
+  public:
+
+  // string name = 2;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 events = 3;
+  void clear_events();
+  uint64_t events() const;
+  void set_events(uint64_t value);
+  private:
+  uint64_t _internal_events() const;
+  void _internal_set_events(uint64_t value);
+  public:
+
+  // uint64 allocations = 4;
+  void clear_allocations();
+  uint64_t allocations() const;
+  void set_allocations(uint64_t value);
+  private:
+  uint64_t _internal_allocations() const;
+  void _internal_set_allocations(uint64_t value);
+  public:
+
+  // uint64 bytes = 5;
+  void clear_bytes();
+  uint64_t bytes() const;
+  void set_bytes(uint64_t value);
+  private:
+  uint64_t _internal_bytes() const;
+  void _internal_set_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AllocationEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr policy_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t events_;
+    uint64_t allocations_;
+    uint64_t bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AllocationsGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AllocationsGet_Request) */ {
+ public:
+  inline AllocationsGet_Request() : AllocationsGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR AllocationsGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AllocationsGet_Request(const AllocationsGet_Request& from);
+  AllocationsGet_Request(AllocationsGet_Request&& from) noexcept
+    : AllocationsGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline AllocationsGet_Request& operator=(const AllocationsGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AllocationsGet_Request& operator=(AllocationsGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AllocationsGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AllocationsGet_Request* internal_default_instance() {
+    return reinterpret_cast<const AllocationsGet_Request*>(
+               &_AllocationsGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(AllocationsGet_Request& a, AllocationsGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AllocationsGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AllocationsGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AllocationsGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllocationsGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const AllocationsGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const AllocationsGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AllocationsGet_Request";
+  }
+  protected:
+  explicit AllocationsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AllocationsGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AllocationsGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AllocationsGet_Response) */ {
+ public:
+  inline AllocationsGet_Response() : AllocationsGet_Response(nullptr) {}
+  ~AllocationsGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR AllocationsGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AllocationsGet_Response(const AllocationsGet_Response& from);
+  AllocationsGet_Response(AllocationsGet_Response&& from) noexcept
+    : AllocationsGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline AllocationsGet_Response& operator=(const AllocationsGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AllocationsGet_Response& operator=(AllocationsGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AllocationsGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AllocationsGet_Response* internal_default_instance() {
+    return reinterpret_cast<const AllocationsGet_Response*>(
+               &_AllocationsGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(AllocationsGet_Response& a, AllocationsGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AllocationsGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AllocationsGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AllocationsGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllocationsGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AllocationsGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AllocationsGet_Response& from) {
+    AllocationsGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AllocationsGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AllocationsGet_Response";
+  }
+  protected:
+  explicit AllocationsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.metrics.AllocationEntry entries = 3;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::com::wazuh::api::engine::metrics::AllocationEntry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AllocationEntry >*
+      mutable_entries();
+  private:
+  const ::com::wazuh::api::engine::metrics::AllocationEntry& _internal_entries(int index) const;
+  ::com::wazuh::api::engine::metrics::AllocationEntry* _internal_add_entries();
+  public:
+  const ::com::wazuh::api::engine::metrics::AllocationEntry& entries(int index) const;
+  ::com::wazuh::api::engine::metrics::AllocationEntry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AllocationEntry >&
+      entries() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AllocationsGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AllocationEntry > entries_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AllocationsReset_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AllocationsReset_Request) */ {
+ public:
+  inline AllocationsReset_Request() : AllocationsReset_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR AllocationsReset_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AllocationsReset_Request(const AllocationsReset_Request& from);
+  AllocationsReset_Request(AllocationsReset_Request&& from) noexcept
+    : AllocationsReset_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline AllocationsReset_Request& operator=(const AllocationsReset_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AllocationsReset_Request& operator=(AllocationsReset_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AllocationsReset_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AllocationsReset_Request* internal_default_instance() {
+    return reinterpret_cast<const AllocationsReset_Request*>(
+               &_AllocationsReset_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    25;
+
+  friend void swap(AllocationsReset_Request& a, AllocationsReset_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AllocationsReset_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AllocationsReset_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AllocationsReset_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllocationsReset_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const AllocationsReset_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const AllocationsReset_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AllocationsReset_Request";
+  }
+  protected:
+  explicit AllocationsReset_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AllocationsReset_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class AllocationsReset_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.AllocationsReset_Response) */ {
+ public:
+  inline AllocationsReset_Response() : AllocationsReset_Response(nullptr) {}
+  ~AllocationsReset_Response() override;
+  explicit PROTOBUF_CONSTEXPR AllocationsReset_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  AllocationsReset_Response(const AllocationsReset_Response& from);
+  AllocationsReset_Response(AllocationsReset_Response&& from) noexcept
+    : AllocationsReset_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline AllocationsReset_Response& operator=(const AllocationsReset_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline AllocationsReset_Response& operator=(AllocationsReset_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const AllocationsReset_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const AllocationsReset_Response* internal_default_instance() {
+    return reinterpret_cast<const AllocationsReset_Response*>(
+               &_AllocationsReset_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    26;
+
+  friend void swap(AllocationsReset_Response& a, AllocationsReset_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(AllocationsReset_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(AllocationsReset_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  AllocationsReset_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<AllocationsReset_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const AllocationsReset_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const AllocationsReset_Response& from) {
+    AllocationsReset_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(AllocationsReset_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.AllocationsReset_Response";
+  }
+  protected:
+  explicit AllocationsReset_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.AllocationsReset_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ArenaEntry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ArenaEntry) */ {
+ public:
+  inline ArenaEntry() : ArenaEntry(nullptr) {}
+  ~ArenaEntry() override;
+  explicit PROTOBUF_CONSTEXPR ArenaEntry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ArenaEntry(const ArenaEntry& from);
+  ArenaEntry(ArenaEntry&& from) noexcept
+    : ArenaEntry() {
+    *this = ::std::move(from);
+  }
+
+  inline ArenaEntry& operator=(const ArenaEntry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ArenaEntry& operator=(ArenaEntry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ArenaEntry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ArenaEntry* internal_default_instance() {
+    return reinterpret_cast<const ArenaEntry*>(
+               &_ArenaEntry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    27;
+
+  friend void swap(ArenaEntry& a, ArenaEntry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ArenaEntry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArenaEntry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ArenaEntry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ArenaEntry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ArenaEntry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ArenaEntry& from) {
+    ArenaEntry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ArenaEntry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ArenaEntry";
+  }
+  protected:
+  explicit ArenaEntry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSubsystemFieldNumber = 1,
+    kAllocationsFieldNumber = 2,
+    kDeallocationsFieldNumber = 3,
+    kRemoteFreesFieldNumber = 4,
+    kLargeAllocationsFieldNumber = 5,
+    kBytesInUseFieldNumber = 6,
+    kBytesReservedFieldNumber = 7,
+    kCachesFieldNumber = 8,
+  };
+  // string subsystem = 1;
+  void clear_subsystem();
+  const std::string& subsystem() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_subsystem(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_subsystem();
+  PROTOBUF_NODISCARD std::string* release_subsystem();
+  void set_allocated_subsystem(std::string* subsystem);
+  private:
+  const std::string& _internal_subsystem() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_subsystem(const std::string& value);
+  std::string* _internal_mutable_subsystem();
+  public:
+
+  // uint64 allocations = 2;
+  void clear_allocations();
+  uint64_t allocations() const;
+  void set_allocations(uint64_t value);
+  private:
+  uint64_t _internal_allocations() const;
+  void _internal_set_allocations(uint64_t value);
+  public:
+
+  // uint64 deallocations = 3;
+  void clear_deallocations();
+  uint64_t deallocations() const;
+  void set_deallocations(uint64_t value);
+  private:
+  uint64_t _internal_deallocations() const;
+  void _internal_set_deallocations(uint64_t value);
+  public:
+
+  // uint64 remote_frees = 4;
+  void clear_remote_frees();
+  uint64_t remote_frees() const;
+  void set_remote_frees(uint64_t value);
+  private:
+  uint64_t _internal_remote_frees() const;
+  void _internal_set_remote_frees(uint64_t value);
+  public:
+
+  // uint64 large_allocations = 5;
+  void clear_large_allocations();
+  uint64_t large_allocations() const;
+  void set_large_allocations(uint64_t value);
+  private:
+  uint64_t _internal_large_allocations() const;
+  void _internal_set_large_allocations(uint64_t value);
+  public:
+
+  // uint64 bytes_in_use = 6;
+  void clear_bytes_in_use();
+  uint64_t bytes_in_use() const;
+  void set_bytes_in_use(uint64_t value);
+  private:
+  uint64_t _internal_bytes_in_use() const;
+  void _internal_set_bytes_in_use(uint64_t value);
+  public:
+
+  // uint64 bytes_reserved = 7;
+  void clear_bytes_reserved();
+  uint64_t bytes_reserved() const;
+  void set_bytes_reserved(uint64_t value);
+  private:
+  uint64_t _internal_bytes_reserved() const;
+  void _internal_set_bytes_reserved(uint64_t value);
+  public:
+
+  // uint64 caches = 8;
+  void clear_caches();
+  uint64_t caches() const;
+  void set_caches(uint64_t value);
+  private:
+  uint64_t _internal_caches() const;
+  void _internal_set_caches(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ArenaEntry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr subsystem_;
+    uint64_t allocations_;
+    uint64_t deallocations_;
+    uint64_t remote_frees_;
+    uint64_t large_allocations_;
+    uint64_t bytes_in_use_;
+    uint64_t bytes_reserved_;
+    uint64_t caches_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ArenasGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ArenasGet_Request) */ {
+ public:
+  inline ArenasGet_Request() : ArenasGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR ArenasGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ArenasGet_Request(const ArenasGet_Request& from);
+  ArenasGet_Request(ArenasGet_Request&& from) noexcept
+    : ArenasGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline ArenasGet_Request& operator=(const ArenasGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ArenasGet_Request& operator=(ArenasGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ArenasGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ArenasGet_Request* internal_default_instance() {
+    return reinterpret_cast<const ArenasGet_Request*>(
+               &_ArenasGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    28;
+
+  friend void swap(ArenasGet_Request& a, ArenasGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ArenasGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArenasGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ArenasGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ArenasGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const ArenasGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const ArenasGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ArenasGet_Request";
+  }
+  protected:
+  explicit ArenasGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ArenasGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ArenasGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.metrics.ArenasGet_Response) */ {
+ public:
+  inline ArenasGet_Response() : ArenasGet_Response(nullptr) {}
+  ~ArenasGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR ArenasGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ArenasGet_Response(const ArenasGet_Response& from);
+  ArenasGet_Response(ArenasGet_Response&& from) noexcept
+    : ArenasGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline ArenasGet_Response& operator=(const ArenasGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ArenasGet_Response& operator=(ArenasGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ArenasGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ArenasGet_Response* internal_default_instance() {
+    return reinterpret_cast<const ArenasGet_Response*>(
+               &_ArenasGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    29;
+
+  friend void swap(ArenasGet_Response& a, ArenasGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ArenasGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ArenasGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ArenasGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ArenasGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ArenasGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ArenasGet_Response& from) {
+    ArenasGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ArenasGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.metrics.ArenasGet_Response";
+  }
+  protected:
+  explicit ArenasGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kArenasFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kArenaAllocatorFieldNumber = 4,
+  };
+  // repeated .com.wazuh.api.engine.metrics.ArenaEntry arenas = 3;
+  int arenas_size() const;
+  private:
+  int _internal_arenas_size() const;
+  public:
+  void clear_arenas();
+  ::com::wazuh::api::engine::metrics::ArenaEntry* mutable_arenas(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ArenaEntry >*
+      mutable_arenas();
+  private:
+  const ::com::wazuh::api::engine::metrics::ArenaEntry& _internal_arenas(int index) const;
+  ::com::wazuh::api::engine::metrics::ArenaEntry* _internal_add_arenas();
+  public:
+  const ::com::wazuh::api::engine::metrics::ArenaEntry& arenas(int index) const;
+  ::com::wazuh::api::engine::metrics::ArenaEntry* add_arenas();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ArenaEntry >&
+      arenas() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // bool arena_allocator = 4;
+  void clear_arena_allocator();
+  bool arena_allocator() const;
+  void set_arena_allocator(bool value);
+  private:
+  bool _internal_arena_allocator() const;
+  void _internal_set_arena_allocator(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.metrics.ArenasGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ArenaEntry > arenas_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    bool arena_allocator_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_metrics_2eproto;
+};
+// ===================================================================
+
+
 // ===================================================================
 
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Dump_Request
+
+// -------------------------------------------------------------------
+
+// Dump_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void Dump_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus Dump_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus Dump_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.status)
+  return _internal_status();
+}
+inline void Dump_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void Dump_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Dump_Response.status)
+}
+
+// optional string error = 2;
+inline bool Dump_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Dump_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Dump_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Dump_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Dump_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Dump_Response.error)
+}
+inline std::string* Dump_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Dump_Response.error)
+  return _s;
+}
+inline const std::string& Dump_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Dump_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Dump_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Dump_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Dump_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Dump_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.error)
+}
+
+// optional .google.protobuf.Value value = 3;
+inline bool Dump_Response::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline bool Dump_Response::has_value() const {
+  return _internal_has_value();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Dump_Response::_internal_value() const {
+  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Dump_Response::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.value)
+  return _internal_value();
+}
+inline void Dump_Response::unsafe_arena_set_allocated_value(
+    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.value)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::release_value() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Dump_Response.value)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::mutable_value() {
+  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Dump_Response.value)
+  return _msg;
+}
+inline void Dump_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.value)
+}
+
+// -------------------------------------------------------------------
+
+// Get_Request
+
+// optional string scopeName = 1;
+inline bool Get_Request::_internal_has_scopename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Get_Request::has_scopename() const {
+  return _internal_has_scopename();
+}
+inline void Get_Request::clear_scopename() {
+  _impl_.scopename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Get_Request::scopename() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+  return _internal_scopename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Get_Request::set_scopename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+}
+inline std::string* Get_Request::mutable_scopename() {
+  std::string* _s = _internal_mutable_scopename();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+  return _s;
+}
+inline const std::string& Get_Request::_internal_scopename() const {
+  return _impl_.scopename_.Get();
+}
+inline void Get_Request::_internal_set_scopename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Get_Request::_internal_mutable_scopename() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Get_Request::release_scopename() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+  if (!_internal_has_scopename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopename_.IsDefault()) {
+    _impl_.scopename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Get_Request::set_allocated_scopename(std::string* scopename) {
+  if (scopename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.scopename_.SetAllocated(scopename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopename_.IsDefault()) {
+    _impl_.scopename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+}
+
+// optional string instrumentName = 2;
+inline bool Get_Request::_internal_has_instrumentname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Get_Request::has_instrumentname() const {
+  return _internal_has_instrumentname();
+}
+inline void Get_Request::clear_instrumentname() {
+  _impl_.instrumentname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Get_Request::instrumentname() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+  return _internal_instrumentname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Get_Request::set_instrumentname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.instrumentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+}
+inline std::string* Get_Request::mutable_instrumentname() {
+  std::string* _s = _internal_mutable_instrumentname();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+  return _s;
+}
+inline const std::string& Get_Request::_internal_instrumentname() const {
+  return _impl_.instrumentname_.Get();
+}
+inline void Get_Request::_internal_set_instrumentname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.instrumentname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Get_Request::_internal_mutable_instrumentname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.instrumentname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Get_Request::release_instrumentname() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+  if (!_internal_has_instrumentname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.instrumentname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrumentname_.IsDefault()) {
+    _impl_.instrumentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Get_Request::set_allocated_instrumentname(std::string* instrumentname) {
+  if (instrumentname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.instrumentname_.SetAllocated(instrumentname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrumentname_.IsDefault()) {
+    _impl_.instrumentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+}
+
+// -------------------------------------------------------------------
+
+// Get_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void Get_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus Get_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus Get_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.status)
+  return _internal_status();
+}
+inline void Get_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void Get_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Response.status)
+}
+
+// optional string error = 2;
+inline bool Get_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Get_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Get_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Get_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Get_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Response.error)
+}
+inline std::string* Get_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Response.error)
+  return _s;
+}
+inline const std::string& Get_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Get_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Get_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Get_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Get_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Response.error)
+}
+
+// optional .google.protobuf.Value value = 3;
+inline bool Get_Response::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline bool Get_Response::has_value() const {
+  return _internal_has_value();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Get_Response::_internal_value() const {
+  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& Get_Response::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.value)
+  return _internal_value();
+}
+inline void Get_Response::unsafe_arena_set_allocated_value(
+    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.Get_Response.value)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::release_value() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Response.value)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::mutable_value() {
+  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Response.value)
+  return _msg;
+}
+inline void Get_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Response.value)
+}
+
+// -------------------------------------------------------------------
+
+// Enable_Request
+
+// optional string scopeName = 1;
+inline bool Enable_Request::_internal_has_scopename() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Enable_Request::has_scopename() const {
+  return _internal_has_scopename();
+}
+inline void Enable_Request::clear_scopename() {
+  _impl_.scopename_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Enable_Request::scopename() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+  return _internal_scopename();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Enable_Request::set_scopename(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.scopename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+}
+inline std::string* Enable_Request::mutable_scopename() {
+  std::string* _s = _internal_mutable_scopename();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+  return _s;
+}
+inline const std::string& Enable_Request::_internal_scopename() const {
+  return _impl_.scopename_.Get();
+}
+inline void Enable_Request::_internal_set_scopename(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.scopename_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Enable_Request::_internal_mutable_scopename() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.scopename_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Enable_Request::release_scopename() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+  if (!_internal_has_scopename()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.scopename_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopename_.IsDefault()) {
+    _impl_.scopename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Enable_Request::set_allocated_scopename(std::string* scopename) {
+  if (scopename != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.scopename_.SetAllocated(scopename, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.scopename_.IsDefault()) {
+    _impl_.scopename_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+}
+
+// optional string instrumentName = 2;
+inline bool Enable_Request::_internal_has_instrumentname() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Enable_Request::has_instrumentname() const {
+  return _internal_has_instrumentname();
+}
+inline void Enable_Request::clear_instrumentname() {
+  _impl_.instrumentname_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Enable_Request::instrumentname() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+  return _internal_instrumentname();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Enable_Request::set_instrumentname(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.instrumentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+}
+inline std::string* Enable_Request::mutable_instrumentname() {
+  std::string* _s = _internal_mutable_instrumentname();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+  return _s;
+}
+inline const std::string& Enable_Request::_internal_instrumentname() const {
+  return _impl_.instrumentname_.Get();
+}
+inline void Enable_Request::_internal_set_instrumentname(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.instrumentname_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Enable_Request::_internal_mutable_instrumentname() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.instrumentname_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Enable_Request::release_instrumentname() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+  if (!_internal_has_instrumentname()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.instrumentname_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrumentname_.IsDefault()) {
+    _impl_.instrumentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Enable_Request::set_allocated_instrumentname(std::string* instrumentname) {
+  if (instrumentname != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.instrumentname_.SetAllocated(instrumentname, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.instrumentname_.IsDefault()) {
+    _impl_.instrumentname_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+}
+
+// optional bool status = 3;
+inline bool Enable_Request::_internal_has_status() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Enable_Request::has_status() const {
+  return _internal_has_status();
+}
+inline void Enable_Request::clear_status() {
+  _impl_.status_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool Enable_Request::_internal_status() const {
+  return _impl_.status_;
+}
+inline bool Enable_Request::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.status)
+  return _internal_status();
+}
+inline void Enable_Request::_internal_set_status(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.status_ = value;
+}
+inline void Enable_Request::set_status(bool value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.status)
+}
+
+// -------------------------------------------------------------------
+
+// Enable_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void Enable_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus Enable_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus Enable_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.status)
+  return _internal_status();
+}
+inline void Enable_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void Enable_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.status)
+}
+
+// optional string error = 2;
+inline bool Enable_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Enable_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Enable_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Enable_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Enable_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.error)
+}
+inline std::string* Enable_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Response.error)
+  return _s;
+}
+inline const std::string& Enable_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Enable_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Enable_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Enable_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Enable_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Response.error)
+}
+
+// optional string content = 3;
+inline bool Enable_Response::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Enable_Response::has_content() const {
+  return _internal_has_content();
+}
+inline void Enable_Response::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Enable_Response::content() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Enable_Response::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.content)
+}
+inline std::string* Enable_Response::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Response.content)
+  return _s;
+}
+inline const std::string& Enable_Response::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void Enable_Response::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Enable_Response::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Enable_Response::release_content() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Response.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Enable_Response::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Response.content)
+}
+
+// -------------------------------------------------------------------
+
+// List_Request
+
+// -------------------------------------------------------------------
+
+// List_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void List_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus List_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus List_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.status)
+  return _internal_status();
+}
+inline void List_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void List_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.List_Response.status)
+}
+
+// optional string error = 2;
+inline bool List_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool List_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void List_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& List_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void List_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.List_Response.error)
+}
+inline std::string* List_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.List_Response.error)
+  return _s;
+}
+inline const std::string& List_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void List_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* List_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* List_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.List_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void List_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.List_Response.error)
+}
+
+// optional .google.protobuf.Value value = 3;
+inline bool List_Response::_internal_has_value() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
+  return value;
+}
+inline bool List_Response::has_value() const {
+  return _internal_has_value();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& List_Response::_internal_value() const {
+  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
+  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
+      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Value& List_Response::value() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.value)
+  return _internal_value();
+}
+inline void List_Response::unsafe_arena_set_allocated_value(
+    ::PROTOBUF_NAMESPACE_ID::Value* value) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  _impl_.value_ = value;
+  if (value) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.List_Response.value)
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::release_value() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.List_Response.value)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
+  _impl_.value_ = nullptr;
+  return temp;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::_internal_mutable_value() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
+    _impl_.value_ = p;
+  }
+  return _impl_.value_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::mutable_value() {
+  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.List_Response.value)
+  return _msg;
+}
+inline void List_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+  }
+  if (value) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
+    if (message_arena != submessage_arena) {
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.List_Response.value)
+}
+
+// -------------------------------------------------------------------
+
+// Test_Request
+
+// -------------------------------------------------------------------
+
+// Test_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void Test_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus Test_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus Test_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.status)
+  return _internal_status();
+}
+inline void Test_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void Test_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.status)
+}
+
+// optional string error = 2;
+inline bool Test_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Test_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void Test_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Test_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Test_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.error)
+}
+inline std::string* Test_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Test_Response.error)
+  return _s;
+}
+inline const std::string& Test_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void Test_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Test_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Test_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Test_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Test_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Test_Response.error)
+}
+
+// repeated string content = 3;
+inline int Test_Response::_internal_content_size() const {
+  return _impl_.content_.size();
+}
+inline int Test_Response::content_size() const {
+  return _internal_content_size();
+}
+inline void Test_Response::clear_content() {
+  _impl_.content_.Clear();
+}
+inline std::string* Test_Response::add_content() {
+  std::string* _s = _internal_add_content();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.metrics.Test_Response.content)
+  return _s;
+}
+inline const std::string& Test_Response::_internal_content(int index) const {
+  return _impl_.content_.Get(index);
+}
+inline const std::string& Test_Response::content(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.content)
+  return _internal_content(index);
+}
+inline std::string* Test_Response::mutable_content(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Test_Response.content)
+  return _impl_.content_.Mutable(index);
+}
+inline void Test_Response::set_content(int index, const std::string& value) {
+  _impl_.content_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::set_content(int index, std::string&& value) {
+  _impl_.content_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::set_content(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.content_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::set_content(int index, const char* value, size_t size) {
+  _impl_.content_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline std::string* Test_Response::_internal_add_content() {
+  return _impl_.content_.Add();
+}
+inline void Test_Response::add_content(const std::string& value) {
+  _impl_.content_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::add_content(std::string&& value) {
+  _impl_.content_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::add_content(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.content_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline void Test_Response::add_content(const char* value, size_t size) {
+  _impl_.content_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.metrics.Test_Response.content)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Test_Response::content() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.Test_Response.content)
+  return _impl_.content_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Test_Response::mutable_content() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.Test_Response.content)
+  return &_impl_.content_;
+}
+
+// -------------------------------------------------------------------
+
+// ProfilerStart_Request
+
+// optional uint32 seconds = 1;
+inline bool ProfilerStart_Request::_internal_has_seconds() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProfilerStart_Request::has_seconds() const {
+  return _internal_has_seconds();
+}
+inline void ProfilerStart_Request::clear_seconds() {
+  _impl_.seconds_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ProfilerStart_Request::_internal_seconds() const {
+  return _impl_.seconds_;
+}
+inline uint32_t ProfilerStart_Request::seconds() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerStart_Request.seconds)
+  return _internal_seconds();
+}
+inline void ProfilerStart_Request::_internal_set_seconds(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.seconds_ = value;
+}
+inline void ProfilerStart_Request::set_seconds(uint32_t value) {
+  _internal_set_seconds(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerStart_Request.seconds)
+}
+
+// -------------------------------------------------------------------
+
+// ProfilerStart_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void ProfilerStart_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerStart_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerStart_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerStart_Response.status)
+  return _internal_status();
+}
+inline void ProfilerStart_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ProfilerStart_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerStart_Response.status)
+}
+
+// optional string error = 2;
+inline bool ProfilerStart_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProfilerStart_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void ProfilerStart_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProfilerStart_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerStart_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfilerStart_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerStart_Response.error)
+}
+inline std::string* ProfilerStart_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfilerStart_Response.error)
+  return _s;
+}
+inline const std::string& ProfilerStart_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ProfilerStart_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfilerStart_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfilerStart_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfilerStart_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProfilerStart_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfilerStart_Response.error)
+}
+
+// -------------------------------------------------------------------
+
+// ProfilerStop_Request
+
+// -------------------------------------------------------------------
+
+// ProfilerStop_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void ProfilerStop_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerStop_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerStop_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerStop_Response.status)
+  return _internal_status();
+}
+inline void ProfilerStop_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void ProfilerStop_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerStop_Response.status)
+}
+
+// optional string error = 2;
+inline bool ProfilerStop_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProfilerStop_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void ProfilerStop_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProfilerStop_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerStop_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfilerStop_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerStop_Response.error)
+}
+inline std::string* ProfilerStop_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfilerStop_Response.error)
+  return _s;
+}
+inline const std::string& ProfilerStop_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void ProfilerStop_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfilerStop_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfilerStop_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfilerStop_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProfilerStop_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfilerStop_Response.error)
+}
+
+// -------------------------------------------------------------------
+
+// ProfileEntry
+
+// string asset = 1;
+inline void ProfileEntry::clear_asset() {
+  _impl_.asset_.ClearToEmpty();
+}
+inline const std::string& ProfileEntry::asset() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfileEntry.asset)
+  return _internal_asset();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfileEntry::set_asset(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.asset_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfileEntry.asset)
+}
+inline std::string* ProfileEntry::mutable_asset() {
+  std::string* _s = _internal_mutable_asset();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfileEntry.asset)
+  return _s;
+}
+inline const std::string& ProfileEntry::_internal_asset() const {
+  return _impl_.asset_.Get();
+}
+inline void ProfileEntry::_internal_set_asset(const std::string& value) {
+  
+  _impl_.asset_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::_internal_mutable_asset() {
+  
+  return _impl_.asset_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::release_asset() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfileEntry.asset)
+  return _impl_.asset_.Release();
+}
+inline void ProfileEntry::set_allocated_asset(std::string* asset) {
+  if (asset != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.asset_.SetAllocated(asset, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfileEntry.asset)
+}
+
+// string stage = 2;
+inline void ProfileEntry::clear_stage() {
+  _impl_.stage_.ClearToEmpty();
+}
+inline const std::string& ProfileEntry::stage() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfileEntry.stage)
+  return _internal_stage();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfileEntry::set_stage(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.stage_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfileEntry.stage)
+}
+inline std::string* ProfileEntry::mutable_stage() {
+  std::string* _s = _internal_mutable_stage();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfileEntry.stage)
+  return _s;
+}
+inline const std::string& ProfileEntry::_internal_stage() const {
+  return _impl_.stage_.Get();
+}
+inline void ProfileEntry::_internal_set_stage(const std::string& value) {
+  
+  _impl_.stage_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::_internal_mutable_stage() {
+  
+  return _impl_.stage_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::release_stage() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfileEntry.stage)
+  return _impl_.stage_.Release();
+}
+inline void ProfileEntry::set_allocated_stage(std::string* stage) {
+  if (stage != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.stage_.SetAllocated(stage, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.stage_.IsDefault()) {
+    _impl_.stage_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfileEntry.stage)
+}
+
+// string operation = 3;
+inline void ProfileEntry::clear_operation() {
+  _impl_.operation_.ClearToEmpty();
+}
+inline const std::string& ProfileEntry::operation() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfileEntry.operation)
+  return _internal_operation();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfileEntry::set_operation(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.operation_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfileEntry.operation)
+}
+inline std::string* ProfileEntry::mutable_operation() {
+  std::string* _s = _internal_mutable_operation();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfileEntry.operation)
+  return _s;
+}
+inline const std::string& ProfileEntry::_internal_operation() const {
+  return _impl_.operation_.Get();
+}
+inline void ProfileEntry::_internal_set_operation(const std::string& value) {
+  
+  _impl_.operation_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::_internal_mutable_operation() {
+  
+  return _impl_.operation_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfileEntry::release_operation() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfileEntry.operation)
+  return _impl_.operation_.Release();
+}
+inline void ProfileEntry::set_allocated_operation(std::string* operation) {
+  if (operation != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.operation_.SetAllocated(operation, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.operation_.IsDefault()) {
+    _impl_.operation_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfileEntry.operation)
+}
+
+// uint64 count = 4;
+inline void ProfileEntry::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t ProfileEntry::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t ProfileEntry::count() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfileEntry.count)
+  return _internal_count();
+}
+inline void ProfileEntry::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void ProfileEntry::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfileEntry.count)
+}
 
-// ===================================================================
+// uint64 timeUs = 5;
+inline void ProfileEntry::clear_timeus() {
+  _impl_.timeus_ = uint64_t{0u};
+}
+inline uint64_t ProfileEntry::_internal_timeus() const {
+  return _impl_.timeus_;
+}
+inline uint64_t ProfileEntry::timeus() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfileEntry.timeUs)
+  return _internal_timeus();
+}
+inline void ProfileEntry::_internal_set_timeus(uint64_t value) {
+  
+  _impl_.timeus_ = value;
+}
+inline void ProfileEntry::set_timeus(uint64_t value) {
+  _internal_set_timeus(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfileEntry.timeUs)
+}
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Dump_Request
+// -------------------------------------------------------------------
+
+// ProfilerGet_Request
 
 // -------------------------------------------------------------------
 
-// Dump_Response
+// ProfilerGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void Dump_Response::clear_status() {
+inline void ProfilerGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus Dump_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus Dump_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus ProfilerGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerGet_Response.status)
   return _internal_status();
 }
-inline void Dump_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfilerGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void Dump_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ProfilerGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Dump_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool Dump_Response::_internal_has_error() const {
+inline bool ProfilerGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Dump_Response::has_error() const {
+inline bool ProfilerGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void Dump_Response::clear_error() {
+inline void ProfilerGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Dump_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.error)
+inline const std::string& ProfilerGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Dump_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void ProfilerGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Dump_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerGet_Response.error)
 }
-inline std::string* Dump_Response::mutable_error() {
+inline std::string* ProfilerGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Dump_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfilerGet_Response.error)
   return _s;
 }
-inline const std::string& Dump_Response::_internal_error() const {
+inline const std::string& ProfilerGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void Dump_Response::_internal_set_error(const std::string& value) {
+inline void ProfilerGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Dump_Response::_internal_mutable_error() {
+inline std::string* ProfilerGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Dump_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Dump_Response.error)
+inline std::string* ProfilerGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfilerGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -1869,7 +6869,7 @@ inline std::string* Dump_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Dump_Response::set_allocated_error(std::string* error) {
+inline void ProfilerGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -1881,301 +6881,532 @@ inline void Dump_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfilerGet_Response.error)
 }
 
-// optional .google.protobuf.Value value = 3;
-inline bool Dump_Response::_internal_has_value() const {
+// optional bool active = 3;
+inline bool ProfilerGet_Response::_internal_has_active() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ProfilerGet_Response::has_active() const {
+  return _internal_has_active();
+}
+inline void ProfilerGet_Response::clear_active() {
+  _impl_.active_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool ProfilerGet_Response::_internal_active() const {
+  return _impl_.active_;
+}
+inline bool ProfilerGet_Response::active() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerGet_Response.active)
+  return _internal_active();
+}
+inline void ProfilerGet_Response::_internal_set_active(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.active_ = value;
+}
+inline void ProfilerGet_Response::set_active(bool value) {
+  _internal_set_active(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerGet_Response.active)
+}
+
+// optional string collapsed = 4;
+inline bool ProfilerGet_Response::_internal_has_collapsed() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
   return value;
 }
-inline bool Dump_Response::has_value() const {
-  return _internal_has_value();
+inline bool ProfilerGet_Response::has_collapsed() const {
+  return _internal_has_collapsed();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Dump_Response::_internal_value() const {
-  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
-      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+inline void ProfilerGet_Response::clear_collapsed() {
+  _impl_.collapsed_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Dump_Response::value() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Dump_Response.value)
-  return _internal_value();
+inline const std::string& ProfilerGet_Response::collapsed() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerGet_Response.collapsed)
+  return _internal_collapsed();
 }
-inline void Dump_Response::unsafe_arena_set_allocated_value(
-    ::PROTOBUF_NAMESPACE_ID::Value* value) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProfilerGet_Response::set_collapsed(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.collapsed_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ProfilerGet_Response.collapsed)
+}
+inline std::string* ProfilerGet_Response::mutable_collapsed() {
+  std::string* _s = _internal_mutable_collapsed();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfilerGet_Response.collapsed)
+  return _s;
+}
+inline const std::string& ProfilerGet_Response::_internal_collapsed() const {
+  return _impl_.collapsed_.Get();
+}
+inline void ProfilerGet_Response::_internal_set_collapsed(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.collapsed_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProfilerGet_Response::_internal_mutable_collapsed() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.collapsed_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProfilerGet_Response::release_collapsed() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ProfilerGet_Response.collapsed)
+  if (!_internal_has_collapsed()) {
+    return nullptr;
   }
-  _impl_.value_ = value;
-  if (value) {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.collapsed_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.collapsed_.IsDefault()) {
+    _impl_.collapsed_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProfilerGet_Response::set_allocated_collapsed(std::string* collapsed) {
+  if (collapsed != nullptr) {
     _impl_._has_bits_[0] |= 0x00000002u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.value)
-}
-inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::release_value() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  _impl_.collapsed_.SetAllocated(collapsed, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.collapsed_.IsDefault()) {
+    _impl_.collapsed_.Set("", GetArenaForAllocation());
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ProfilerGet_Response.collapsed)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Dump_Response.value)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-  return temp;
+
+// repeated .com.wazuh.api.engine.metrics.ProfileEntry entries = 5;
+inline int ProfilerGet_Response::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::_internal_mutable_value() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
-    _impl_.value_ = p;
+inline int ProfilerGet_Response::entries_size() const {
+  return _internal_entries_size();
+}
+inline void ProfilerGet_Response::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::com::wazuh::api::engine::metrics::ProfileEntry* ProfilerGet_Response::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ProfilerGet_Response.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ProfileEntry >*
+ProfilerGet_Response::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.ProfilerGet_Response.entries)
+  return &_impl_.entries_;
+}
+inline const ::com::wazuh::api::engine::metrics::ProfileEntry& ProfilerGet_Response::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::com::wazuh::api::engine::metrics::ProfileEntry& ProfilerGet_Response::entries(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ProfilerGet_Response.entries)
+  return _internal_entries(index);
+}
+inline ::com::wazuh::api::engine::metrics::ProfileEntry* ProfilerGet_Response::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::com::wazuh::api::engine::metrics::ProfileEntry* ProfilerGet_Response::add_entries() {
+  ::com::wazuh::api::engine::metrics::ProfileEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.ProfilerGet_Response.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ProfileEntry >&
+ProfilerGet_Response::entries() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.ProfilerGet_Response.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
+// AssetStatsEntry
+
+// string asset = 1;
+inline void AssetStatsEntry::clear_asset() {
+  _impl_.asset_.ClearToEmpty();
+}
+inline const std::string& AssetStatsEntry::asset() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsEntry.asset)
+  return _internal_asset();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AssetStatsEntry::set_asset(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.asset_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsEntry.asset)
+}
+inline std::string* AssetStatsEntry::mutable_asset() {
+  std::string* _s = _internal_mutable_asset();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AssetStatsEntry.asset)
+  return _s;
+}
+inline const std::string& AssetStatsEntry::_internal_asset() const {
+  return _impl_.asset_.Get();
+}
+inline void AssetStatsEntry::_internal_set_asset(const std::string& value) {
+  
+  _impl_.asset_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AssetStatsEntry::_internal_mutable_asset() {
+  
+  return _impl_.asset_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AssetStatsEntry::release_asset() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AssetStatsEntry.asset)
+  return _impl_.asset_.Release();
+}
+inline void AssetStatsEntry::set_allocated_asset(std::string* asset) {
+  if (asset != nullptr) {
+    
+  } else {
+    
   }
-  return _impl_.value_;
+  _impl_.asset_.SetAllocated(asset, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AssetStatsEntry.asset)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Dump_Response::mutable_value() {
-  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Dump_Response.value)
-  return _msg;
+
+// uint64 evaluations = 2;
+inline void AssetStatsEntry::clear_evaluations() {
+  _impl_.evaluations_ = uint64_t{0u};
 }
-inline void Dump_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
+inline uint64_t AssetStatsEntry::_internal_evaluations() const {
+  return _impl_.evaluations_;
+}
+inline uint64_t AssetStatsEntry::evaluations() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsEntry.evaluations)
+  return _internal_evaluations();
+}
+inline void AssetStatsEntry::_internal_set_evaluations(uint64_t value) {
+  
+  _impl_.evaluations_ = value;
+}
+inline void AssetStatsEntry::set_evaluations(uint64_t value) {
+  _internal_set_evaluations(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsEntry.evaluations)
+}
+
+// uint64 successes = 3;
+inline void AssetStatsEntry::clear_successes() {
+  _impl_.successes_ = uint64_t{0u};
+}
+inline uint64_t AssetStatsEntry::_internal_successes() const {
+  return _impl_.successes_;
+}
+inline uint64_t AssetStatsEntry::successes() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsEntry.successes)
+  return _internal_successes();
+}
+inline void AssetStatsEntry::_internal_set_successes(uint64_t value) {
+  
+  _impl_.successes_ = value;
+}
+inline void AssetStatsEntry::set_successes(uint64_t value) {
+  _internal_set_successes(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsEntry.successes)
+}
+
+// uint64 cost = 4;
+inline void AssetStatsEntry::clear_cost() {
+  _impl_.cost_ = uint64_t{0u};
+}
+inline uint64_t AssetStatsEntry::_internal_cost() const {
+  return _impl_.cost_;
+}
+inline uint64_t AssetStatsEntry::cost() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsEntry.cost)
+  return _internal_cost();
+}
+inline void AssetStatsEntry::_internal_set_cost(uint64_t value) {
+  
+  _impl_.cost_ = value;
+}
+inline void AssetStatsEntry::set_cost(uint64_t value) {
+  _internal_set_cost(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsEntry.cost)
+}
+
+// -------------------------------------------------------------------
+
+// AssetStatsGet_Request
+
+// optional string asset = 1;
+inline bool AssetStatsGet_Request::_internal_has_asset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool AssetStatsGet_Request::has_asset() const {
+  return _internal_has_asset();
+}
+inline void AssetStatsGet_Request::clear_asset() {
+  _impl_.asset_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& AssetStatsGet_Request::asset() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsGet_Request.asset)
+  return _internal_asset();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AssetStatsGet_Request::set_asset(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.asset_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsGet_Request.asset)
+}
+inline std::string* AssetStatsGet_Request::mutable_asset() {
+  std::string* _s = _internal_mutable_asset();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AssetStatsGet_Request.asset)
+  return _s;
+}
+inline const std::string& AssetStatsGet_Request::_internal_asset() const {
+  return _impl_.asset_.Get();
+}
+inline void AssetStatsGet_Request::_internal_set_asset(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.asset_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AssetStatsGet_Request::_internal_mutable_asset() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.asset_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AssetStatsGet_Request::release_asset() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AssetStatsGet_Request.asset)
+  if (!_internal_has_asset()) {
+    return nullptr;
   }
-  if (value) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
-    if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.asset_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void AssetStatsGet_Request::set_allocated_asset(std::string* asset) {
+  if (asset != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Dump_Response.value)
+  _impl_.asset_.SetAllocated(asset, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.asset_.IsDefault()) {
+    _impl_.asset_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AssetStatsGet_Request.asset)
 }
 
 // -------------------------------------------------------------------
 
-// Get_Request
+// AssetStatsGet_Response
 
-// optional string scopeName = 1;
-inline bool Get_Request::_internal_has_scopename() const {
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void AssetStatsGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus AssetStatsGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus AssetStatsGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsGet_Response.status)
+  return _internal_status();
+}
+inline void AssetStatsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void AssetStatsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool AssetStatsGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Get_Request::has_scopename() const {
-  return _internal_has_scopename();
+inline bool AssetStatsGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void Get_Request::clear_scopename() {
-  _impl_.scopename_.ClearToEmpty();
+inline void AssetStatsGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Get_Request::scopename() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Request.scopeName)
-  return _internal_scopename();
+inline const std::string& AssetStatsGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Get_Request::set_scopename(ArgT0&& arg0, ArgT... args) {
+void AssetStatsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.scopename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsGet_Response.error)
 }
-inline std::string* Get_Request::mutable_scopename() {
-  std::string* _s = _internal_mutable_scopename();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+inline std::string* AssetStatsGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AssetStatsGet_Response.error)
   return _s;
 }
-inline const std::string& Get_Request::_internal_scopename() const {
-  return _impl_.scopename_.Get();
+inline const std::string& AssetStatsGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Get_Request::_internal_set_scopename(const std::string& value) {
+inline void AssetStatsGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.scopename_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Get_Request::_internal_mutable_scopename() {
+inline std::string* AssetStatsGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.scopename_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Get_Request::release_scopename() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Request.scopeName)
-  if (!_internal_has_scopename()) {
+inline std::string* AssetStatsGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AssetStatsGet_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.scopename_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.scopename_.IsDefault()) {
-    _impl_.scopename_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Get_Request::set_allocated_scopename(std::string* scopename) {
-  if (scopename != nullptr) {
+inline void AssetStatsGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.scopename_.SetAllocated(scopename, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.scopename_.IsDefault()) {
-    _impl_.scopename_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Request.scopeName)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AssetStatsGet_Response.error)
 }
 
-// optional string instrumentName = 2;
-inline bool Get_Request::_internal_has_instrumentname() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
+// repeated .com.wazuh.api.engine.metrics.AssetStatsEntry entries = 3;
+inline int AssetStatsGet_Response::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline bool Get_Request::has_instrumentname() const {
-  return _internal_has_instrumentname();
-}
-inline void Get_Request::clear_instrumentname() {
-  _impl_.instrumentname_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline int AssetStatsGet_Response::entries_size() const {
+  return _internal_entries_size();
 }
-inline const std::string& Get_Request::instrumentname() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
-  return _internal_instrumentname();
+inline void AssetStatsGet_Response::clear_entries() {
+  _impl_.entries_.Clear();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Get_Request::set_instrumentname(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.instrumentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+inline ::com::wazuh::api::engine::metrics::AssetStatsEntry* AssetStatsGet_Response::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AssetStatsGet_Response.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline std::string* Get_Request::mutable_instrumentname() {
-  std::string* _s = _internal_mutable_instrumentname();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
-  return _s;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AssetStatsEntry >*
+AssetStatsGet_Response::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.AssetStatsGet_Response.entries)
+  return &_impl_.entries_;
 }
-inline const std::string& Get_Request::_internal_instrumentname() const {
-  return _impl_.instrumentname_.Get();
+inline const ::com::wazuh::api::engine::metrics::AssetStatsEntry& AssetStatsGet_Response::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline void Get_Request::_internal_set_instrumentname(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.instrumentname_.Set(value, GetArenaForAllocation());
+inline const ::com::wazuh::api::engine::metrics::AssetStatsEntry& AssetStatsGet_Response::entries(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsGet_Response.entries)
+  return _internal_entries(index);
 }
-inline std::string* Get_Request::_internal_mutable_instrumentname() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.instrumentname_.Mutable(GetArenaForAllocation());
+inline ::com::wazuh::api::engine::metrics::AssetStatsEntry* AssetStatsGet_Response::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-inline std::string* Get_Request::release_instrumentname() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
-  if (!_internal_has_instrumentname()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.instrumentname_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instrumentname_.IsDefault()) {
-    _impl_.instrumentname_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline ::com::wazuh::api::engine::metrics::AssetStatsEntry* AssetStatsGet_Response::add_entries() {
+  ::com::wazuh::api::engine::metrics::AssetStatsEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.AssetStatsGet_Response.entries)
+  return _add;
 }
-inline void Get_Request::set_allocated_instrumentname(std::string* instrumentname) {
-  if (instrumentname != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.instrumentname_.SetAllocated(instrumentname, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instrumentname_.IsDefault()) {
-    _impl_.instrumentname_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Request.instrumentName)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AssetStatsEntry >&
+AssetStatsGet_Response::entries() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.AssetStatsGet_Response.entries)
+  return _impl_.entries_;
 }
 
 // -------------------------------------------------------------------
 
-// Get_Response
+// AssetStatsReset_Request
+
+// -------------------------------------------------------------------
+
+// AssetStatsReset_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void Get_Response::clear_status() {
+inline void AssetStatsReset_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus Get_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus AssetStatsReset_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus Get_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus AssetStatsReset_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsReset_Response.status)
   return _internal_status();
 }
-inline void Get_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void AssetStatsReset_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void Get_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void AssetStatsReset_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsReset_Response.status)
 }
 
 // optional string error = 2;
-inline bool Get_Response::_internal_has_error() const {
+inline bool AssetStatsReset_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Get_Response::has_error() const {
+inline bool AssetStatsReset_Response::has_error() const {
   return _internal_has_error();
 }
-inline void Get_Response::clear_error() {
+inline void AssetStatsReset_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Get_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.error)
+inline const std::string& AssetStatsReset_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AssetStatsReset_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Get_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void AssetStatsReset_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Get_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AssetStatsReset_Response.error)
 }
-inline std::string* Get_Response::mutable_error() {
+inline std::string* AssetStatsReset_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AssetStatsReset_Response.error)
   return _s;
 }
-inline const std::string& Get_Response::_internal_error() const {
+inline const std::string& AssetStatsReset_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void Get_Response::_internal_set_error(const std::string& value) {
+inline void AssetStatsReset_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Get_Response::_internal_mutable_error() {
+inline std::string* AssetStatsReset_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Get_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Response.error)
+inline std::string* AssetStatsReset_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AssetStatsReset_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -2188,7 +7419,7 @@ inline std::string* Get_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Get_Response::set_allocated_error(std::string* error) {
+inline void AssetStatsReset_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2200,329 +7431,378 @@ inline void Get_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AssetStatsReset_Response.error)
 }
 
-// optional .google.protobuf.Value value = 3;
-inline bool Get_Response::_internal_has_value() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
-  return value;
+// -------------------------------------------------------------------
+
+// AllocationEntry
+
+// string policy = 1;
+inline void AllocationEntry::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
 }
-inline bool Get_Response::has_value() const {
-  return _internal_has_value();
+inline const std::string& AllocationEntry::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationEntry.policy)
+  return _internal_policy();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Get_Response::_internal_value() const {
-  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
-      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AllocationEntry::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationEntry.policy)
+}
+inline std::string* AllocationEntry::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AllocationEntry.policy)
+  return _s;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& Get_Response::value() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Get_Response.value)
-  return _internal_value();
+inline const std::string& AllocationEntry::_internal_policy() const {
+  return _impl_.policy_.Get();
 }
-inline void Get_Response::unsafe_arena_set_allocated_value(
-    ::PROTOBUF_NAMESPACE_ID::Value* value) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
-  }
-  _impl_.value_ = value;
-  if (value) {
-    _impl_._has_bits_[0] |= 0x00000002u;
+inline void AllocationEntry::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AllocationEntry::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AllocationEntry::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AllocationEntry.policy)
+  return _impl_.policy_.Release();
+}
+inline void AllocationEntry::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.Get_Response.value)
-}
-inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::release_value() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
   }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AllocationEntry.policy)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Get_Response.value)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-  return temp;
+
+// string name = 2;
+inline void AllocationEntry::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::_internal_mutable_value() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
-    _impl_.value_ = p;
-  }
-  return _impl_.value_;
+inline const std::string& AllocationEntry::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationEntry.name)
+  return _internal_name();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* Get_Response::mutable_value() {
-  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Get_Response.value)
-  return _msg;
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void AllocationEntry::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationEntry.name)
+}
+inline std::string* AllocationEntry::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AllocationEntry.name)
+  return _s;
 }
-inline void Get_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
-  }
-  if (value) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
-    if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
+inline const std::string& AllocationEntry::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void AllocationEntry::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* AllocationEntry::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* AllocationEntry::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AllocationEntry.name)
+  return _impl_.name_.Release();
+}
+inline void AllocationEntry::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    
   }
-  _impl_.value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Get_Response.value)
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AllocationEntry.name)
+}
+
+// uint64 events = 3;
+inline void AllocationEntry::clear_events() {
+  _impl_.events_ = uint64_t{0u};
+}
+inline uint64_t AllocationEntry::_internal_events() const {
+  return _impl_.events_;
+}
+inline uint64_t AllocationEntry::events() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationEntry.events)
+  return _internal_events();
+}
+inline void AllocationEntry::_internal_set_events(uint64_t value) {
+  
+  _impl_.events_ = value;
+}
+inline void AllocationEntry::set_events(uint64_t value) {
+  _internal_set_events(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationEntry.events)
+}
+
+// uint64 allocations = 4;
+inline void AllocationEntry::clear_allocations() {
+  _impl_.allocations_ = uint64_t{0u};
+}
+inline uint64_t AllocationEntry::_internal_allocations() const {
+  return _impl_.allocations_;
+}
+inline uint64_t AllocationEntry::allocations() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationEntry.allocations)
+  return _internal_allocations();
+}
+inline void AllocationEntry::_internal_set_allocations(uint64_t value) {
+  
+  _impl_.allocations_ = value;
+}
+inline void AllocationEntry::set_allocations(uint64_t value) {
+  _internal_set_allocations(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationEntry.allocations)
+}
+
+// uint64 bytes = 5;
+inline void AllocationEntry::clear_bytes() {
+  _impl_.bytes_ = uint64_t{0u};
+}
+inline uint64_t AllocationEntry::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline uint64_t AllocationEntry::bytes() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationEntry.bytes)
+  return _internal_bytes();
+}
+inline void AllocationEntry::_internal_set_bytes(uint64_t value) {
+  
+  _impl_.bytes_ = value;
+}
+inline void AllocationEntry::set_bytes(uint64_t value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationEntry.bytes)
 }
 
 // -------------------------------------------------------------------
 
-// Enable_Request
+// AllocationsGet_Request
+
+// -------------------------------------------------------------------
+
+// AllocationsGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void AllocationsGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus AllocationsGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus AllocationsGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationsGet_Response.status)
+  return _internal_status();
+}
+inline void AllocationsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void AllocationsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationsGet_Response.status)
+}
 
-// optional string scopeName = 1;
-inline bool Enable_Request::_internal_has_scopename() const {
+// optional string error = 2;
+inline bool AllocationsGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Enable_Request::has_scopename() const {
-  return _internal_has_scopename();
+inline bool AllocationsGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void Enable_Request::clear_scopename() {
-  _impl_.scopename_.ClearToEmpty();
+inline void AllocationsGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Enable_Request::scopename() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
-  return _internal_scopename();
+inline const std::string& AllocationsGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationsGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Enable_Request::set_scopename(ArgT0&& arg0, ArgT... args) {
+void AllocationsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.scopename_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationsGet_Response.error)
 }
-inline std::string* Enable_Request::mutable_scopename() {
-  std::string* _s = _internal_mutable_scopename();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+inline std::string* AllocationsGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AllocationsGet_Response.error)
   return _s;
 }
-inline const std::string& Enable_Request::_internal_scopename() const {
-  return _impl_.scopename_.Get();
+inline const std::string& AllocationsGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Enable_Request::_internal_set_scopename(const std::string& value) {
+inline void AllocationsGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.scopename_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Enable_Request::_internal_mutable_scopename() {
+inline std::string* AllocationsGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.scopename_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Enable_Request::release_scopename() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
-  if (!_internal_has_scopename()) {
+inline std::string* AllocationsGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AllocationsGet_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.scopename_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.scopename_.IsDefault()) {
-    _impl_.scopename_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Enable_Request::set_allocated_scopename(std::string* scopename) {
-  if (scopename != nullptr) {
+inline void AllocationsGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.scopename_.SetAllocated(scopename, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.scopename_.IsDefault()) {
-    _impl_.scopename_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Request.scopeName)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AllocationsGet_Response.error)
 }
 
-// optional string instrumentName = 2;
-inline bool Enable_Request::_internal_has_instrumentname() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline bool Enable_Request::has_instrumentname() const {
-  return _internal_has_instrumentname();
+// repeated .com.wazuh.api.engine.metrics.AllocationEntry entries = 3;
+inline int AllocationsGet_Response::_internal_entries_size() const {
+  return _impl_.entries_.size();
 }
-inline void Enable_Request::clear_instrumentname() {
-  _impl_.instrumentname_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline int AllocationsGet_Response::entries_size() const {
+  return _internal_entries_size();
 }
-inline const std::string& Enable_Request::instrumentname() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
-  return _internal_instrumentname();
+inline void AllocationsGet_Response::clear_entries() {
+  _impl_.entries_.Clear();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Enable_Request::set_instrumentname(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.instrumentname_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+inline ::com::wazuh::api::engine::metrics::AllocationEntry* AllocationsGet_Response::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AllocationsGet_Response.entries)
+  return _impl_.entries_.Mutable(index);
 }
-inline std::string* Enable_Request::mutable_instrumentname() {
-  std::string* _s = _internal_mutable_instrumentname();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
-  return _s;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AllocationEntry >*
+AllocationsGet_Response::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.AllocationsGet_Response.entries)
+  return &_impl_.entries_;
 }
-inline const std::string& Enable_Request::_internal_instrumentname() const {
-  return _impl_.instrumentname_.Get();
+inline const ::com::wazuh::api::engine::metrics::AllocationEntry& AllocationsGet_Response::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
 }
-inline void Enable_Request::_internal_set_instrumentname(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.instrumentname_.Set(value, GetArenaForAllocation());
+inline const ::com::wazuh::api::engine::metrics::AllocationEntry& AllocationsGet_Response::entries(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationsGet_Response.entries)
+  return _internal_entries(index);
 }
-inline std::string* Enable_Request::_internal_mutable_instrumentname() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.instrumentname_.Mutable(GetArenaForAllocation());
+inline ::com::wazuh::api::engine::metrics::AllocationEntry* AllocationsGet_Response::_internal_add_entries() {
+  return _impl_.entries_.Add();
 }
-inline std::string* Enable_Request::release_instrumentname() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
-  if (!_internal_has_instrumentname()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.instrumentname_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instrumentname_.IsDefault()) {
-    _impl_.instrumentname_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline ::com::wazuh::api::engine::metrics::AllocationEntry* AllocationsGet_Response::add_entries() {
+  ::com::wazuh::api::engine::metrics::AllocationEntry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.AllocationsGet_Response.entries)
+  return _add;
 }
-inline void Enable_Request::set_allocated_instrumentname(std::string* instrumentname) {
-  if (instrumentname != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.instrumentname_.SetAllocated(instrumentname, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.instrumentname_.IsDefault()) {
-    _impl_.instrumentname_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Request.instrumentName)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::AllocationEntry >&
+AllocationsGet_Response::entries() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.AllocationsGet_Response.entries)
+  return _impl_.entries_;
 }
 
-// optional bool status = 3;
-inline bool Enable_Request::_internal_has_status() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
-  return value;
-}
-inline bool Enable_Request::has_status() const {
-  return _internal_has_status();
-}
-inline void Enable_Request::clear_status() {
-  _impl_.status_ = false;
-  _impl_._has_bits_[0] &= ~0x00000004u;
-}
-inline bool Enable_Request::_internal_status() const {
-  return _impl_.status_;
-}
-inline bool Enable_Request::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Request.status)
-  return _internal_status();
-}
-inline void Enable_Request::_internal_set_status(bool value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
-  _impl_.status_ = value;
-}
-inline void Enable_Request::set_status(bool value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Request.status)
-}
+// -------------------------------------------------------------------
+
+// AllocationsReset_Request
 
 // -------------------------------------------------------------------
 
-// Enable_Response
+// AllocationsReset_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void Enable_Response::clear_status() {
+inline void AllocationsReset_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus Enable_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus AllocationsReset_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus Enable_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus AllocationsReset_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationsReset_Response.status)
   return _internal_status();
 }
-inline void Enable_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void AllocationsReset_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void Enable_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void AllocationsReset_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationsReset_Response.status)
 }
 
 // optional string error = 2;
-inline bool Enable_Response::_internal_has_error() const {
+inline bool AllocationsReset_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Enable_Response::has_error() const {
+inline bool AllocationsReset_Response::has_error() const {
   return _internal_has_error();
 }
-inline void Enable_Response::clear_error() {
+inline void AllocationsReset_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Enable_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.error)
+inline const std::string& AllocationsReset_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.AllocationsReset_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Enable_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void AllocationsReset_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.AllocationsReset_Response.error)
 }
-inline std::string* Enable_Response::mutable_error() {
+inline std::string* AllocationsReset_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.AllocationsReset_Response.error)
   return _s;
 }
-inline const std::string& Enable_Response::_internal_error() const {
+inline const std::string& AllocationsReset_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void Enable_Response::_internal_set_error(const std::string& value) {
+inline void AllocationsReset_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Enable_Response::_internal_mutable_error() {
+inline std::string* AllocationsReset_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Enable_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Response.error)
+inline std::string* AllocationsReset_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.AllocationsReset_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -2535,7 +7815,7 @@ inline std::string* Enable_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Enable_Response::set_allocated_error(std::string* error) {
+inline void AllocationsReset_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2547,329 +7827,272 @@ inline void Enable_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.AllocationsReset_Response.error)
 }
 
-// optional string content = 3;
-inline bool Enable_Response::_internal_has_content() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  return value;
-}
-inline bool Enable_Response::has_content() const {
-  return _internal_has_content();
-}
-inline void Enable_Response::clear_content() {
-  _impl_.content_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+// -------------------------------------------------------------------
+
+// ArenaEntry
+
+// string subsystem = 1;
+inline void ArenaEntry::clear_subsystem() {
+  _impl_.subsystem_.ClearToEmpty();
 }
-inline const std::string& Enable_Response::content() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Enable_Response.content)
-  return _internal_content();
+inline const std::string& ArenaEntry::subsystem() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.subsystem)
+  return _internal_subsystem();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Enable_Response::set_content(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
- _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Enable_Response.content)
-}
-inline std::string* Enable_Response::mutable_content() {
-  std::string* _s = _internal_mutable_content();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Enable_Response.content)
+void ArenaEntry::set_subsystem(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.subsystem_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.subsystem)
+}
+inline std::string* ArenaEntry::mutable_subsystem() {
+  std::string* _s = _internal_mutable_subsystem();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ArenaEntry.subsystem)
   return _s;
 }
-inline const std::string& Enable_Response::_internal_content() const {
-  return _impl_.content_.Get();
+inline const std::string& ArenaEntry::_internal_subsystem() const {
+  return _impl_.subsystem_.Get();
 }
-inline void Enable_Response::_internal_set_content(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  _impl_.content_.Set(value, GetArenaForAllocation());
+inline void ArenaEntry::_internal_set_subsystem(const std::string& value) {
+  
+  _impl_.subsystem_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Enable_Response::_internal_mutable_content() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  return _impl_.content_.Mutable(GetArenaForAllocation());
+inline std::string* ArenaEntry::_internal_mutable_subsystem() {
+  
+  return _impl_.subsystem_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Enable_Response::release_content() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Enable_Response.content)
-  if (!_internal_has_content()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  auto* p = _impl_.content_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline std::string* ArenaEntry::release_subsystem() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ArenaEntry.subsystem)
+  return _impl_.subsystem_.Release();
 }
-inline void Enable_Response::set_allocated_content(std::string* content) {
-  if (content != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
+inline void ArenaEntry::set_allocated_subsystem(std::string* subsystem) {
+  if (subsystem != nullptr) {
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    
   }
-  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+  _impl_.subsystem_.SetAllocated(subsystem, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.content_.IsDefault()) {
-    _impl_.content_.Set("", GetArenaForAllocation());
+  if (_impl_.subsystem_.IsDefault()) {
+    _impl_.subsystem_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Enable_Response.content)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ArenaEntry.subsystem)
 }
 
-// -------------------------------------------------------------------
-
-// List_Request
-
-// -------------------------------------------------------------------
-
-// List_Response
+// uint64 allocations = 2;
+inline void ArenaEntry::clear_allocations() {
+  _impl_.allocations_ = uint64_t{0u};
+}
+inline uint64_t ArenaEntry::_internal_allocations() const {
+  return _impl_.allocations_;
+}
+inline uint64_t ArenaEntry::allocations() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.allocations)
+  return _internal_allocations();
+}
+inline void ArenaEntry::_internal_set_allocations(uint64_t value) {
+  
+  _impl_.allocations_ = value;
+}
+inline void ArenaEntry::set_allocations(uint64_t value) {
+  _internal_set_allocations(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.allocations)
+}
 
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void List_Response::clear_status() {
-  _impl_.status_ = 0;
+// uint64 deallocations = 3;
+inline void ArenaEntry::clear_deallocations() {
+  _impl_.deallocations_ = uint64_t{0u};
 }
-inline ::com::wazuh::api::engine::ReturnStatus List_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+inline uint64_t ArenaEntry::_internal_deallocations() const {
+  return _impl_.deallocations_;
 }
-inline ::com::wazuh::api::engine::ReturnStatus List_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.status)
-  return _internal_status();
+inline uint64_t ArenaEntry::deallocations() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.deallocations)
+  return _internal_deallocations();
 }
-inline void List_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ArenaEntry::_internal_set_deallocations(uint64_t value) {
   
-  _impl_.status_ = value;
+  _impl_.deallocations_ = value;
 }
-inline void List_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.List_Response.status)
+inline void ArenaEntry::set_deallocations(uint64_t value) {
+  _internal_set_deallocations(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.deallocations)
 }
 
-// optional string error = 2;
-inline bool List_Response::_internal_has_error() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
+// uint64 remote_frees = 4;
+inline void ArenaEntry::clear_remote_frees() {
+  _impl_.remote_frees_ = uint64_t{0u};
 }
-inline bool List_Response::has_error() const {
-  return _internal_has_error();
+inline uint64_t ArenaEntry::_internal_remote_frees() const {
+  return _impl_.remote_frees_;
 }
-inline void List_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+inline uint64_t ArenaEntry::remote_frees() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.remote_frees)
+  return _internal_remote_frees();
+}
+inline void ArenaEntry::_internal_set_remote_frees(uint64_t value) {
+  
+  _impl_.remote_frees_ = value;
+}
+inline void ArenaEntry::set_remote_frees(uint64_t value) {
+  _internal_set_remote_frees(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.remote_frees)
+}
+
+// uint64 large_allocations = 5;
+inline void ArenaEntry::clear_large_allocations() {
+  _impl_.large_allocations_ = uint64_t{0u};
 }
-inline const std::string& List_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.error)
-  return _internal_error();
+inline uint64_t ArenaEntry::_internal_large_allocations() const {
+  return _impl_.large_allocations_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void List_Response::set_error(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.List_Response.error)
+inline uint64_t ArenaEntry::large_allocations() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.large_allocations)
+  return _internal_large_allocations();
 }
-inline std::string* List_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.List_Response.error)
-  return _s;
+inline void ArenaEntry::_internal_set_large_allocations(uint64_t value) {
+  
+  _impl_.large_allocations_ = value;
 }
-inline const std::string& List_Response::_internal_error() const {
-  return _impl_.error_.Get();
+inline void ArenaEntry::set_large_allocations(uint64_t value) {
+  _internal_set_large_allocations(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.large_allocations)
 }
-inline void List_Response::_internal_set_error(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
+
+// uint64 bytes_in_use = 6;
+inline void ArenaEntry::clear_bytes_in_use() {
+  _impl_.bytes_in_use_ = uint64_t{0u};
 }
-inline std::string* List_Response::_internal_mutable_error() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+inline uint64_t ArenaEntry::_internal_bytes_in_use() const {
+  return _impl_.bytes_in_use_;
 }
-inline std::string* List_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.List_Response.error)
-  if (!_internal_has_error()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline uint64_t ArenaEntry::bytes_in_use() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.bytes_in_use)
+  return _internal_bytes_in_use();
 }
-inline void List_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
-  }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.List_Response.error)
+inline void ArenaEntry::_internal_set_bytes_in_use(uint64_t value) {
+  
+  _impl_.bytes_in_use_ = value;
+}
+inline void ArenaEntry::set_bytes_in_use(uint64_t value) {
+  _internal_set_bytes_in_use(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.bytes_in_use)
 }
 
-// optional .google.protobuf.Value value = 3;
-inline bool List_Response::_internal_has_value() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.value_ != nullptr);
-  return value;
+// uint64 bytes_reserved = 7;
+inline void ArenaEntry::clear_bytes_reserved() {
+  _impl_.bytes_reserved_ = uint64_t{0u};
 }
-inline bool List_Response::has_value() const {
-  return _internal_has_value();
+inline uint64_t ArenaEntry::_internal_bytes_reserved() const {
+  return _impl_.bytes_reserved_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& List_Response::_internal_value() const {
-  const ::PROTOBUF_NAMESPACE_ID::Value* p = _impl_.value_;
-  return p != nullptr ? *p : reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Value&>(
-      ::PROTOBUF_NAMESPACE_ID::_Value_default_instance_);
+inline uint64_t ArenaEntry::bytes_reserved() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.bytes_reserved)
+  return _internal_bytes_reserved();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Value& List_Response::value() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.List_Response.value)
-  return _internal_value();
+inline void ArenaEntry::_internal_set_bytes_reserved(uint64_t value) {
+  
+  _impl_.bytes_reserved_ = value;
 }
-inline void List_Response::unsafe_arena_set_allocated_value(
-    ::PROTOBUF_NAMESPACE_ID::Value* value) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
-  }
-  _impl_.value_ = value;
-  if (value) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.metrics.List_Response.value)
+inline void ArenaEntry::set_bytes_reserved(uint64_t value) {
+  _internal_set_bytes_reserved(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.bytes_reserved)
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::release_value() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+
+// uint64 caches = 8;
+inline void ArenaEntry::clear_caches() {
+  _impl_.caches_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.List_Response.value)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::PROTOBUF_NAMESPACE_ID::Value* temp = _impl_.value_;
-  _impl_.value_ = nullptr;
-  return temp;
+inline uint64_t ArenaEntry::_internal_caches() const {
+  return _impl_.caches_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::_internal_mutable_value() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::PROTOBUF_NAMESPACE_ID::Value>(GetArenaForAllocation());
-    _impl_.value_ = p;
-  }
-  return _impl_.value_;
+inline uint64_t ArenaEntry::caches() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenaEntry.caches)
+  return _internal_caches();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Value* List_Response::mutable_value() {
-  ::PROTOBUF_NAMESPACE_ID::Value* _msg = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.List_Response.value)
-  return _msg;
+inline void ArenaEntry::_internal_set_caches(uint64_t value) {
+  
+  _impl_.caches_ = value;
 }
-inline void List_Response::set_allocated_value(::PROTOBUF_NAMESPACE_ID::Value* value) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.value_);
-  }
-  if (value) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value));
-    if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  _impl_.value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.List_Response.value)
+inline void ArenaEntry::set_caches(uint64_t value) {
+  _internal_set_caches(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenaEntry.caches)
 }
 
 // -------------------------------------------------------------------
 
-// Test_Request
+// ArenasGet_Request
 
 // -------------------------------------------------------------------
 
-// Test_Response
+// ArenasGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void Test_Response::clear_status() {
+inline void ArenasGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus Test_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus ArenasGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus Test_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus ArenasGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenasGet_Response.status)
   return _internal_status();
 }
-inline void Test_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ArenasGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void Test_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void ArenasGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenasGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool Test_Response::_internal_has_error() const {
+inline bool ArenasGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Test_Response::has_error() const {
+inline bool ArenasGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void Test_Response::clear_error() {
+inline void ArenasGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Test_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.error)
+inline const std::string& ArenasGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenasGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Test_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void ArenasGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenasGet_Response.error)
 }
-inline std::string* Test_Response::mutable_error() {
+inline std::string* ArenasGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Test_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ArenasGet_Response.error)
   return _s;
 }
-inline const std::string& Test_Response::_internal_error() const {
+inline const std::string& ArenasGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void Test_Response::_internal_set_error(const std::string& value) {
+inline void ArenasGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Test_Response::_internal_mutable_error() {
+inline std::string* ArenasGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Test_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.Test_Response.error)
+inline std::string* ArenasGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.metrics.ArenasGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -2882,7 +8105,7 @@ inline std::string* Test_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Test_Response::set_allocated_error(std::string* error) {
+inline void ArenasGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -2894,82 +8117,67 @@ inline void Test_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.Test_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.metrics.ArenasGet_Response.error)
 }
 
-// repeated string content = 3;
-inline int Test_Response::_internal_content_size() const {
-  return _impl_.content_.size();
-}
-inline int Test_Response::content_size() const {
-  return _internal_content_size();
-}
-inline void Test_Response::clear_content() {
-  _impl_.content_.Clear();
-}
-inline std::string* Test_Response::add_content() {
-  std::string* _s = _internal_add_content();
-  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.metrics.Test_Response.content)
-  return _s;
+// repeated .com.wazuh.api.engine.metrics.ArenaEntry arenas = 3;
+inline int ArenasGet_Response::_internal_arenas_size() const {
+  return _impl_.arenas_.size();
 }
-inline const std::string& Test_Response::_internal_content(int index) const {
-  return _impl_.content_.Get(index);
+inline int ArenasGet_Response::arenas_size() const {
+  return _internal_arenas_size();
 }
-inline const std::string& Test_Response::content(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.Test_Response.content)
-  return _internal_content(index);
+inline void ArenasGet_Response::clear_arenas() {
+  _impl_.arenas_.Clear();
 }
-inline std::string* Test_Response::mutable_content(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.Test_Response.content)
-  return _impl_.content_.Mutable(index);
+inline ::com::wazuh::api::engine::metrics::ArenaEntry* ArenasGet_Response::mutable_arenas(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.metrics.ArenasGet_Response.arenas)
+  return _impl_.arenas_.Mutable(index);
 }
-inline void Test_Response::set_content(int index, const std::string& value) {
-  _impl_.content_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.content)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ArenaEntry >*
+ArenasGet_Response::mutable_arenas() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.ArenasGet_Response.arenas)
+  return &_impl_.arenas_;
 }
-inline void Test_Response::set_content(int index, std::string&& value) {
-  _impl_.content_.Mutable(index)->assign(std::move(value));
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.Test_Response.content)
+inline const ::com::wazuh::api::engine::metrics::ArenaEntry& ArenasGet_Response::_internal_arenas(int index) const {
+  return _impl_.arenas_.Get(index);
 }
-inline void Test_Response::set_content(int index, const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.content_.Mutable(index)->assign(value);
-  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.metrics.Test_Response.content)
+inline const ::com::wazuh::api::engine::metrics::ArenaEntry& ArenasGet_Response::arenas(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenasGet_Response.arenas)
+  return _internal_arenas(index);
 }
-inline void Test_Response::set_content(int index, const char* value, size_t size) {
-  _impl_.content_.Mutable(index)->assign(
-    reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.metrics.Test_Response.content)
+inline ::com::wazuh::api::engine::metrics::ArenaEntry* ArenasGet_Response::_internal_add_arenas() {
+  return _impl_.arenas_.Add();
 }
-inline std::string* Test_Response::_internal_add_content() {
-  return _impl_.content_.Add();
+inline ::com::wazuh::api::engine::metrics::ArenaEntry* ArenasGet_Response::add_arenas() {
+  ::com::wazuh::api::engine::metrics::ArenaEntry* _add = _internal_add_arenas();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.ArenasGet_Response.arenas)
+  return _add;
 }
-inline void Test_Response::add_content(const std::string& value) {
-  _impl_.content_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.Test_Response.content)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::metrics::ArenaEntry >&
+ArenasGet_Response::arenas() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.ArenasGet_Response.arenas)
+  return _impl_.arenas_;
 }
-inline void Test_Response::add_content(std::string&& value) {
-  _impl_.content_.Add(std::move(value));
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.metrics.Test_Response.content)
+
+// bool arena_allocator = 4;
+inline void ArenasGet_Response::clear_arena_allocator() {
+  _impl_.arena_allocator_ = false;
 }
-inline void Test_Response::add_content(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  _impl_.content_.Add()->assign(value);
-  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.metrics.Test_Response.content)
+inline bool ArenasGet_Response::_internal_arena_allocator() const {
+  return _impl_.arena_allocator_;
 }
-inline void Test_Response::add_content(const char* value, size_t size) {
-  _impl_.content_.Add()->assign(reinterpret_cast<const char*>(value), size);
-  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.metrics.Test_Response.content)
+inline bool ArenasGet_Response::arena_allocator() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.metrics.ArenasGet_Response.arena_allocator)
+  return _internal_arena_allocator();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
-Test_Response::content() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.metrics.Test_Response.content)
-  return _impl_.content_;
+inline void ArenasGet_Response::_internal_set_arena_allocator(bool value) {
+  
+  _impl_.arena_allocator_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
-Test_Response::mutable_content() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.metrics.Test_Response.content)
-  return &_impl_.content_;
+inline void ArenasGet_Response::set_arena_allocator(bool value) {
+  _internal_set_arena_allocator(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.metrics.ArenasGet_Response.arena_allocator)
 }
 
 #ifdef __GNUC__
@@ -2993,6 +8201,46 @@ Test_Response::mutable_content() {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -33,7 +33,8 @@ PROTOBUF_CONSTEXPR EntryPost::EntryPost(
   , /*decltype(_impl_.policy_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.filter_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.description_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.priority_)*/0u} {}
+  , /*decltype(_impl_.priority_)*/0u
+  , /*decltype(_impl_.eps_limit_)*/0u} {}
 struct EntryPostDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EntryPostDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -54,7 +55,9 @@ PROTOBUF_CONSTEXPR Entry::Entry(
   , /*decltype(_impl_.priority_)*/0u
   , /*decltype(_impl_.policy_sync_)*/0
   , /*decltype(_impl_.entry_status_)*/0
-  , /*decltype(_impl_.uptime_)*/0u} {}
+  , /*decltype(_impl_.uptime_)*/0u
+  , /*decltype(_impl_.throttled_)*/uint64_t{0u}
+  , /*decltype(_impl_.eps_limit_)*/0u} {}
 struct EntryDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EntryDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -147,6 +150,20 @@ struct RoutePatchPriority_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutePatchPriority_RequestDefaultTypeInternal _RoutePatchPriority_Request_default_instance_;
+PROTOBUF_CONSTEXPR RoutePatchEpsLimit_Request::RoutePatchEpsLimit_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.eps_limit_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutePatchEpsLimit_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutePatchEpsLimit_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutePatchEpsLimit_RequestDefaultTypeInternal() {}
+  union {
+    RoutePatchEpsLimit_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutePatchEpsLimit_RequestDefaultTypeInternal _RoutePatchEpsLimit_Request_default_instance_;
 PROTOBUF_CONSTEXPR TableGet_Request::TableGet_Request(
     ::_pbi::ConstantInitialized) {}
 struct TableGet_RequestDefaultTypeInternal {
@@ -187,6 +204,36 @@ struct QueuePost_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueuePost_RequestDefaultTypeInternal _QueuePost_Request_default_instance_;
+PROTOBUF_CONSTEXPR QueuePostBulk_Request::QueuePostBulk_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.wazuh_events_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct QueuePostBulk_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueuePostBulk_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueuePostBulk_RequestDefaultTypeInternal() {}
+  union {
+    QueuePostBulk_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueuePostBulk_RequestDefaultTypeInternal _QueuePostBulk_Request_default_instance_;
+PROTOBUF_CONSTEXPR QueuePostBulk_Response::QueuePostBulk_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.accepted_)*/0u
+  , /*decltype(_impl_.discarded_)*/0u} {}
+struct QueuePostBulk_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR QueuePostBulk_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~QueuePostBulk_ResponseDefaultTypeInternal() {}
+  union {
+    QueuePostBulk_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 QueuePostBulk_ResponseDefaultTypeInternal _QueuePostBulk_Response_default_instance_;
 PROTOBUF_CONSTEXPR EpsUpdate_Request::EpsUpdate_Request(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.eps_)*/0u
@@ -252,13 +299,86 @@ struct EpsDisable_RequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpsDisable_RequestDefaultTypeInternal _EpsDisable_Request_default_instance_;
+PROTOBUF_CONSTEXPR IngressRule::IngressRule(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.contains_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.location_prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hits_)*/uint64_t{0u}
+  , /*decltype(_impl_.action_)*/0} {}
+struct IngressRuleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IngressRuleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IngressRuleDefaultTypeInternal() {}
+  union {
+    IngressRule _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IngressRuleDefaultTypeInternal _IngressRule_default_instance_;
+PROTOBUF_CONSTEXPR IngressPost_Request::IngressPost_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rule_)*/nullptr} {}
+struct IngressPost_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IngressPost_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IngressPost_RequestDefaultTypeInternal() {}
+  union {
+    IngressPost_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IngressPost_RequestDefaultTypeInternal _IngressPost_Request_default_instance_;
+PROTOBUF_CONSTEXPR IngressDelete_Request::IngressDelete_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IngressDelete_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IngressDelete_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IngressDelete_RequestDefaultTypeInternal() {}
+  union {
+    IngressDelete_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IngressDelete_RequestDefaultTypeInternal _IngressDelete_Request_default_instance_;
+PROTOBUF_CONSTEXPR IngressGet_Request::IngressGet_Request(
+    ::_pbi::ConstantInitialized) {}
+struct IngressGet_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IngressGet_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IngressGet_RequestDefaultTypeInternal() {}
+  union {
+    IngressGet_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IngressGet_RequestDefaultTypeInternal _IngressGet_Request_default_instance_;
+PROTOBUF_CONSTEXPR IngressGet_Response::IngressGet_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.rules_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct IngressGet_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IngressGet_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IngressGet_ResponseDefaultTypeInternal() {}
+  union {
+    IngressGet_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IngressGet_ResponseDefaultTypeInternal _IngressGet_Response_default_instance_;
 }  // namespace router
 }  // namespace engine
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_router_2eproto[16];
-static const ::_pb::EnumDescriptor* file_level_enum_descriptors_router_2eproto[2];
+static ::_pb::Metadata file_level_metadata_router_2eproto[24];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_router_2eproto[3];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_router_2eproto = nullptr;
 
 const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -273,11 +393,13 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.filter_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.priority_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.description_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EntryPost, _impl_.eps_limit_),
   ~0u,
   ~0u,
   ~0u,
   ~0u,
   0,
+  1,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -292,6 +414,8 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.policy_sync_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.entry_status_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.uptime_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.eps_limit_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::Entry, _impl_.throttled_),
   ~0u,
   ~0u,
   ~0u,
@@ -300,6 +424,8 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,
   ~0u,
   ~0u,
+  ~0u,
+  ~0u,
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePost_Request, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -350,6 +476,14 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePatchPriority_Request, _impl_.name_),
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePatchPriority_Request, _impl_.priority_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request, _impl_.eps_limit_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::TableGet_Request, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -375,6 +509,27 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePost_Request, _impl_.wazuh_event_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Request, _impl_.wazuh_events_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _impl_.accepted_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::QueuePostBulk_Response, _impl_.discarded_),
+  ~0u,
+  0,
+  ~0u,
+  ~0u,
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::EpsUpdate_Request, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -416,24 +571,83 @@ const uint32_t TableStruct_router_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.action_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.queue_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.location_prefix_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.contains_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressRule, _impl_.hits_),
+  ~0u,
+  ~0u,
+  0,
+  1,
+  ~0u,
+  ~0u,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressPost_Request, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressPost_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressPost_Request, _impl_.rule_),
+  0,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressDelete_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressDelete_Request, _impl_.name_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::router::IngressGet_Response, _impl_.rules_),
+  ~0u,
+  0,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, 11, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
-  { 16, 30, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
-  { 38, 45, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
-  { 46, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
-  { 53, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
-  { 60, 69, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
-  { 72, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
-  { 79, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
-  { 87, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
-  { 93, 102, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
-  { 105, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
-  { 112, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
-  { 120, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
-  { 126, 137, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
-  { 142, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
-  { 148, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 0, 12, -1, sizeof(::com::wazuh::api::engine::router::EntryPost)},
+  { 18, 34, -1, sizeof(::com::wazuh::api::engine::router::Entry)},
+  { 44, 51, -1, sizeof(::com::wazuh::api::engine::router::RoutePost_Request)},
+  { 52, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteDelete_Request)},
+  { 59, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Request)},
+  { 66, 75, -1, sizeof(::com::wazuh::api::engine::router::RouteGet_Response)},
+  { 78, -1, -1, sizeof(::com::wazuh::api::engine::router::RouteReload_Request)},
+  { 85, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchPriority_Request)},
+  { 93, -1, -1, sizeof(::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request)},
+  { 101, -1, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Request)},
+  { 107, 116, -1, sizeof(::com::wazuh::api::engine::router::TableGet_Response)},
+  { 119, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePost_Request)},
+  { 126, -1, -1, sizeof(::com::wazuh::api::engine::router::QueuePostBulk_Request)},
+  { 133, 143, -1, sizeof(::com::wazuh::api::engine::router::QueuePostBulk_Response)},
+  { 147, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsUpdate_Request)},
+  { 155, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Request)},
+  { 161, 172, -1, sizeof(::com::wazuh::api::engine::router::EpsGet_Response)},
+  { 177, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsEnable_Request)},
+  { 183, -1, -1, sizeof(::com::wazuh::api::engine::router::EpsDisable_Request)},
+  { 189, 201, -1, sizeof(::com::wazuh::api::engine::router::IngressRule)},
+  { 207, 214, -1, sizeof(::com::wazuh::api::engine::router::IngressPost_Request)},
+  { 215, -1, -1, sizeof(::com::wazuh::api::engine::router::IngressDelete_Request)},
+  { 222, -1, -1, sizeof(::com::wazuh::api::engine::router::IngressGet_Request)},
+  { 228, 237, -1, sizeof(::com::wazuh::api::engine::router::IngressGet_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -445,64 +659,95 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::router::_RouteGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_RouteReload_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_RoutePatchPriority_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_RoutePatchEpsLimit_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_TableGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_TableGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_QueuePost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_QueuePostBulk_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_QueuePostBulk_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsUpdate_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsGet_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsEnable_Request_default_instance_._instance,
   &::com::wazuh::api::engine::router::_EpsDisable_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_IngressRule_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_IngressPost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_IngressDelete_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_IngressGet_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::router::_IngressGet_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_router_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\014router.proto\022\033com.wazuh.api.engine.rou"
-  "ter\032\014engine.proto\"u\n\tEntryPost\022\014\n\004name\030\001"
-  " \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010"
-  "priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001"
-  "B\016\n\014_description\"\363\001\n\005Entry\022\014\n\004name\030\001 \001(\t"
-  "\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010prio"
-  "rity\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001\0226\n\013"
-  "policy_sync\030\006 \001(\0162!.com.wazuh.api.engine"
-  ".router.Sync\0228\n\014entry_status\030\007 \001(\0162\".com"
-  ".wazuh.api.engine.router.State\022\016\n\006uptime"
-  "\030\010 \001(\rB\016\n\014_description\"Y\n\021RoutePost_Requ"
-  "est\022:\n\005route\030\001 \001(\0132&.com.wazuh.api.engin"
-  "e.router.EntryPostH\000\210\001\001B\010\n\006_route\"#\n\023Rou"
-  "teDelete_Request\022\014\n\004name\030\001 \001(\t\" \n\020RouteG"
-  "et_Request\022\014\n\004name\030\001 \001(\t\"\247\001\n\021RouteGet_Re"
-  "sponse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.e"
-  "ngine.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0226"
-  "\n\005route\030\003 \001(\0132\".com.wazuh.api.engine.rou"
-  "ter.EntryH\001\210\001\001B\010\n\006_errorB\010\n\006_route\"#\n\023Ro"
-  "uteReload_Request\022\014\n\004name\030\001 \001(\t\"<\n\032Route"
-  "PatchPriority_Request\022\014\n\004name\030\001 \001(\t\022\020\n\010p"
-  "riority\030\002 \001(\r\"\022\n\020TableGet_Request\"\230\001\n\021Ta"
-  "bleGet_Response\0222\n\006status\030\001 \001(\0162\".com.wa"
-  "zuh.api.engine.ReturnStatus\022\022\n\005error\030\002 \001"
-  "(\tH\000\210\001\001\0221\n\005table\030\003 \003(\0132\".com.wazuh.api.e"
-  "ngine.router.EntryB\010\n\006_error\"5\n\021QueuePos"
-  "t_Request\022\023\n\013wazuh_event\030\001 \001(\tJ\004\010\002\020\003R\005ev"
-  "ent\":\n\021EpsUpdate_Request\022\013\n\003eps\030\001 \001(\r\022\030\n"
-  "\020refresh_interval\030\002 \001(\r\"\020\n\016EpsGet_Reques"
-  "t\"\233\001\n\017EpsGet_Response\0222\n\006status\030\001 \001(\0162\"."
-  "com.wazuh.api.engine.ReturnStatus\022\022\n\005err"
-  "or\030\002 \001(\tH\000\210\001\001\022\013\n\003eps\030\003 \001(\r\022\030\n\020refresh_in"
-  "terval\030\004 \001(\r\022\017\n\007enabled\030\005 \001(\010B\010\n\006_error\""
-  "\023\n\021EpsEnable_Request\"\024\n\022EpsDisable_Reque"
-  "st*5\n\005State\022\021\n\rSTATE_UNKNOWN\020\000\022\014\n\010DISABL"
-  "ED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sync\022\020\n\014SYNC_UNKNOW"
-  "N\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUTDATED\020\002\022\t\n\005ERROR\020"
-  "\003b\006proto3"
+  "ter\032\014engine.proto\"\233\001\n\tEntryPost\022\014\n\004name\030"
+  "\001 \001(\t\022\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n"
+  "\010priority\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001"
+  "\001\022\026\n\teps_limit\030\006 \001(\rH\001\210\001\001B\016\n\014_descriptio"
+  "nB\014\n\n_eps_limit\"\231\002\n\005Entry\022\014\n\004name\030\001 \001(\t\022"
+  "\016\n\006policy\030\002 \001(\t\022\016\n\006filter\030\003 \001(\t\022\020\n\010prior"
+  "ity\030\004 \001(\r\022\030\n\013description\030\005 \001(\tH\000\210\001\001\0226\n\013p"
+  "olicy_sync\030\006 \001(\0162!.com.wazuh.api.engine."
+  "router.Sync\0228\n\014entry_status\030\007 \001(\0162\".com."
+  "wazuh.api.engine.router.State\022\016\n\006uptime\030"
+  "\010 \001(\r\022\021\n\teps_limit\030\t \001(\r\022\021\n\tthrottled\030\n "
+  "\001(\004B\016\n\014_description\"Y\n\021RoutePost_Request"
+  "\022:\n\005route\030\001 \001(\0132&.com.wazuh.api.engine.r"
+  "outer.EntryPostH\000\210\001\001B\010\n\006_route\"#\n\023RouteD"
+  "elete_Request\022\014\n\004name\030\001 \001(\t\" \n\020RouteGet_"
+  "Request\022\014\n\004name\030\001 \001(\t\"\247\001\n\021RouteGet_Respo"
+  "nse\0222\n\006status\030\001 \001(\0162\".com.wazuh.api.engi"
+  "ne.ReturnStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0226\n\005r"
+  "oute\030\003 \001(\0132\".com.wazuh.api.engine.router"
+  ".EntryH\001\210\001\001B\010\n\006_errorB\010\n\006_route\"#\n\023Route"
+  "Reload_Request\022\014\n\004name\030\001 \001(\t\"<\n\032RoutePat"
+  "chPriority_Request\022\014\n\004name\030\001 \001(\t\022\020\n\010prio"
+  "rity\030\002 \001(\r\"=\n\032RoutePatchEpsLimit_Request"
+  "\022\014\n\004name\030\001 \001(\t\022\021\n\teps_limit\030\002 \001(\r\"\022\n\020Tab"
+  "leGet_Request\"\230\001\n\021TableGet_Response\0222\n\006s"
+  "tatus\030\001 \001(\0162\".com.wazuh.api.engine.Retur"
+  "nStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0221\n\005table\030\003 \003"
+  "(\0132\".com.wazuh.api.engine.router.EntryB\010"
+  "\n\006_error\"5\n\021QueuePost_Request\022\023\n\013wazuh_e"
+  "vent\030\001 \001(\tJ\004\010\002\020\003R\005event\"-\n\025QueuePostBulk"
+  "_Request\022\024\n\014wazuh_events\030\001 \003(\t\"\217\001\n\026Queue"
+  "PostBulk_Response\0222\n\006status\030\001 \001(\0162\".com."
+  "wazuh.api.engine.ReturnStatus\022\022\n\005error\030\002"
+  " \001(\tH\000\210\001\001\022\020\n\010accepted\030\003 \001(\r\022\021\n\tdiscarded"
+  "\030\004 \001(\rB\010\n\006_error\":\n\021EpsUpdate_Request\022\013\n"
+  "\003eps\030\001 \001(\r\022\030\n\020refresh_interval\030\002 \001(\r\"\020\n\016"
+  "EpsGet_Request\"\233\001\n\017EpsGet_Response\0222\n\006st"
+  "atus\030\001 \001(\0162\".com.wazuh.api.engine.Return"
+  "Status\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022\013\n\003eps\030\003 \001(\r\022"
+  "\030\n\020refresh_interval\030\004 \001(\r\022\017\n\007enabled\030\005 \001"
+  "(\010B\010\n\006_error\"\023\n\021EpsEnable_Request\"\024\n\022Eps"
+  "Disable_Request\"\307\001\n\013IngressRule\022\014\n\004name\030"
+  "\001 \001(\t\022:\n\006action\030\002 \001(\0162*.com.wazuh.api.en"
+  "gine.router.IngressAction\022\022\n\005queue\030\003 \001(\t"
+  "H\000\210\001\001\022\034\n\017location_prefix\030\004 \001(\tH\001\210\001\001\022\020\n\010c"
+  "ontains\030\005 \003(\t\022\014\n\004hits\030\006 \001(\004B\010\n\006_queueB\022\n"
+  "\020_location_prefix\"[\n\023IngressPost_Request"
+  "\022;\n\004rule\030\001 \001(\0132(.com.wazuh.api.engine.ro"
+  "uter.IngressRuleH\000\210\001\001B\007\n\005_rule\"%\n\025Ingres"
+  "sDelete_Request\022\014\n\004name\030\001 \001(\t\"\024\n\022Ingress"
+  "Get_Request\"\240\001\n\023IngressGet_Response\0222\n\006s"
+  "tatus\030\001 \001(\0162\".com.wazuh.api.engine.Retur"
+  "nStatus\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0227\n\005rules\030\003 \003"
+  "(\0132(.com.wazuh.api.engine.router.Ingress"
+  "RuleB\010\n\006_error*5\n\005State\022\021\n\rSTATE_UNKNOWN"
+  "\020\000\022\014\n\010DISABLED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sync\022\020\n"
+  "\014SYNC_UNKNOWN\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUTDATED"
+  "\020\002\022\t\n\005ERROR\020\003*A\n\rIngressAction\022\032\n\026INGRES"
+  "S_ACTION_UNKNOWN\020\000\022\010\n\004DROP\020\001\022\n\n\006DIVERT\020\002"
+  "b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_router_2eproto_deps[1] = {
   &::descriptor_table_engine_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_router_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_router_2eproto = {
-    false, false, 1489, descriptor_table_protodef_router_2eproto,
+    false, false, 2408, descriptor_table_protodef_router_2eproto,
     "router.proto",
-    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 16,
+    &descriptor_table_router_2eproto_once, descriptor_table_router_2eproto_deps, 1, 24,
     schemas, file_default_instances, TableStruct_router_2eproto::offsets,
     file_level_metadata_router_2eproto, file_level_enum_descriptors_router_2eproto,
     file_level_service_descriptors_router_2eproto,
@@ -549,6 +794,21 @@ bool Sync_IsValid(int value) {
   }
 }
 
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IngressAction_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_router_2eproto);
+  return file_level_enum_descriptors_router_2eproto[2];
+}
+bool IngressAction_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -558,6 +818,9 @@ class EntryPost::_Internal {
   static void set_has_description(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
+  static void set_has_eps_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 EntryPost::EntryPost(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -576,7 +839,8 @@ EntryPost::EntryPost(const EntryPost& from)
     , decltype(_impl_.policy_){}
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
-    , decltype(_impl_.priority_){}};
+    , decltype(_impl_.priority_){}
+    , decltype(_impl_.eps_limit_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_.InitDefault();
@@ -611,7 +875,9 @@ EntryPost::EntryPost(const EntryPost& from)
     _this->_impl_.description_.Set(from._internal_description(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.priority_ = from._impl_.priority_;
+  ::memcpy(&_impl_.priority_, &from._impl_.priority_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_limit_) -
+    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.eps_limit_));
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EntryPost)
 }
 
@@ -627,6 +893,7 @@ inline void EntryPost::SharedCtor(
     , decltype(_impl_.filter_){}
     , decltype(_impl_.description_){}
     , decltype(_impl_.priority_){0u}
+    , decltype(_impl_.eps_limit_){0u}
   };
   _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -681,6 +948,7 @@ void EntryPost::Clear() {
     _impl_.description_.ClearNonDefaultToEmpty();
   }
   _impl_.priority_ = 0u;
+  _impl_.eps_limit_ = 0u;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -740,6 +1008,15 @@ const char* EntryPost::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // optional uint32 eps_limit = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_eps_limit(&has_bits);
+          _impl_.eps_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -816,6 +1093,12 @@ uint8_t* EntryPost::_InternalSerialize(
         5, this->_internal_description(), target);
   }
 
+  // optional uint32 eps_limit = 6;
+  if (_internal_has_eps_limit()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_eps_limit(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -866,6 +1149,11 @@ size_t EntryPost::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_priority());
   }
 
+  // optional uint32 eps_limit = 6;
+  if (cached_has_bits & 0x00000002u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps_limit());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -899,6 +1187,9 @@ void EntryPost::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROT
   if (from._internal_priority() != 0) {
     _this->_internal_set_priority(from._internal_priority());
   }
+  if (from._internal_has_eps_limit()) {
+    _this->_internal_set_eps_limit(from._internal_eps_limit());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -935,7 +1226,12 @@ void EntryPost::InternalSwap(EntryPost* other) {
       &_impl_.description_, lhs_arena,
       &other->_impl_.description_, rhs_arena
   );
-  swap(_impl_.priority_, other->_impl_.priority_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EntryPost, _impl_.eps_limit_)
+      + sizeof(EntryPost::_impl_.eps_limit_)
+      - PROTOBUF_FIELD_OFFSET(EntryPost, _impl_.priority_)>(
+          reinterpret_cast<char*>(&_impl_.priority_),
+          reinterpret_cast<char*>(&other->_impl_.priority_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata EntryPost::GetMetadata() const {
@@ -973,7 +1269,9 @@ Entry::Entry(const Entry& from)
     , decltype(_impl_.priority_){}
     , decltype(_impl_.policy_sync_){}
     , decltype(_impl_.entry_status_){}
-    , decltype(_impl_.uptime_){}};
+    , decltype(_impl_.uptime_){}
+    , decltype(_impl_.throttled_){}
+    , decltype(_impl_.eps_limit_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.name_.InitDefault();
@@ -1009,8 +1307,8 @@ Entry::Entry(const Entry& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.priority_, &from._impl_.priority_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.uptime_) -
-    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.uptime_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.eps_limit_) -
+    reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.eps_limit_));
   // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.Entry)
 }
 
@@ -1029,6 +1327,8 @@ inline void Entry::SharedCtor(
     , decltype(_impl_.policy_sync_){0}
     , decltype(_impl_.entry_status_){0}
     , decltype(_impl_.uptime_){0u}
+    , decltype(_impl_.throttled_){uint64_t{0u}}
+    , decltype(_impl_.eps_limit_){0u}
   };
   _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1083,8 +1383,8 @@ void Entry::Clear() {
     _impl_.description_.ClearNonDefaultToEmpty();
   }
   ::memset(&_impl_.priority_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.uptime_) -
-      reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.uptime_));
+      reinterpret_cast<char*>(&_impl_.eps_limit_) -
+      reinterpret_cast<char*>(&_impl_.priority_)) + sizeof(_impl_.eps_limit_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1170,6 +1470,22 @@ const char* Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
+      // uint32 eps_limit = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.eps_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 throttled = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.throttled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1266,6 +1582,18 @@ uint8_t* Entry::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(8, this->_internal_uptime(), target);
   }
 
+  // uint32 eps_limit = 9;
+  if (this->_internal_eps_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(9, this->_internal_eps_limit(), target);
+  }
+
+  // uint64 throttled = 10;
+  if (this->_internal_throttled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_throttled(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1333,6 +1661,16 @@ size_t Entry::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_uptime());
   }
 
+  // uint64 throttled = 10;
+  if (this->_internal_throttled() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_throttled());
+  }
+
+  // uint32 eps_limit = 9;
+  if (this->_internal_eps_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps_limit());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1375,6 +1713,12 @@ void Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF
   if (from._internal_uptime() != 0) {
     _this->_internal_set_uptime(from._internal_uptime());
   }
+  if (from._internal_throttled() != 0) {
+    _this->_internal_set_throttled(from._internal_throttled());
+  }
+  if (from._internal_eps_limit() != 0) {
+    _this->_internal_set_eps_limit(from._internal_eps_limit());
+  }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1412,8 +1756,8 @@ void Entry::InternalSwap(Entry* other) {
       &other->_impl_.description_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Entry, _impl_.uptime_)
-      + sizeof(Entry::_impl_.uptime_)
+      PROTOBUF_FIELD_OFFSET(Entry, _impl_.eps_limit_)
+      + sizeof(Entry::_impl_.eps_limit_)
       - PROTOBUF_FIELD_OFFSET(Entry, _impl_.priority_)>(
           reinterpret_cast<char*>(&_impl_.priority_),
           reinterpret_cast<char*>(&other->_impl_.priority_));
@@ -2774,102 +3118,54 @@ void RoutePatchPriority_Request::InternalSwap(RoutePatchPriority_Request* other)
 
 // ===================================================================
 
-class TableGet_Request::_Internal {
- public:
-};
-
-TableGet_Request::TableGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TableGet_Request)
-}
-TableGet_Request::TableGet_Request(const TableGet_Request& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  TableGet_Request* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TableGet_Request)
-}
-
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableGet_Request::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableGet_Request::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata TableGet_Request::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[8]);
-}
-
-// ===================================================================
-
-class TableGet_Response::_Internal {
+class RoutePatchEpsLimit_Request::_Internal {
  public:
-  using HasBits = decltype(std::declval<TableGet_Response>()._impl_._has_bits_);
-  static void set_has_error(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
 };
 
-TableGet_Response::TableGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+RoutePatchEpsLimit_Request::RoutePatchEpsLimit_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TableGet_Response)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
 }
-TableGet_Response::TableGet_Response(const TableGet_Response& from)
+RoutePatchEpsLimit_Request::RoutePatchEpsLimit_Request(const RoutePatchEpsLimit_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  TableGet_Response* const _this = this; (void)_this;
+  RoutePatchEpsLimit_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.table_){from._impl_.table_}
-    , decltype(_impl_.error_){}
-    , decltype(_impl_.status_){}};
+      decltype(_impl_.name_){}
+    , decltype(_impl_.eps_limit_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.error_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_error()) {
-    _this->_impl_.error_.Set(from._internal_error(), 
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.status_ = from._impl_.status_;
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TableGet_Response)
+  _this->_impl_.eps_limit_ = from._impl_.eps_limit_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
 }
 
-inline void TableGet_Response::SharedCtor(
+inline void RoutePatchEpsLimit_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.name_){}
+    , decltype(_impl_.eps_limit_){0u}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.table_){arena}
-    , decltype(_impl_.error_){}
-    , decltype(_impl_.status_){0}
   };
-  _impl_.error_.InitDefault();
+  _impl_.name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.error_.Set("", GetArenaForAllocation());
+    _impl_.name_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-TableGet_Response::~TableGet_Response() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.TableGet_Response)
+RoutePatchEpsLimit_Request::~RoutePatchEpsLimit_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2877,28 +3173,306 @@ TableGet_Response::~TableGet_Response() {
   SharedDtor();
 }
 
-inline void TableGet_Response::SharedDtor() {
+inline void RoutePatchEpsLimit_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.table_.~RepeatedPtrField();
-  _impl_.error_.Destroy();
+  _impl_.name_.Destroy();
 }
 
-void TableGet_Response::SetCachedSize(int size) const {
+void RoutePatchEpsLimit_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void TableGet_Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.TableGet_Response)
+void RoutePatchEpsLimit_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.table_.Clear();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.error_.ClearNonDefaultToEmpty();
-  }
-  _impl_.status_ = 0;
+  _impl_.name_.ClearToEmpty();
+  _impl_.eps_limit_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoutePatchEpsLimit_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 eps_limit = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.eps_limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoutePatchEpsLimit_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // uint32 eps_limit = 2;
+  if (this->_internal_eps_limit() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_eps_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+  return target;
+}
+
+size_t RoutePatchEpsLimit_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint32 eps_limit = 2;
+  if (this->_internal_eps_limit() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps_limit());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutePatchEpsLimit_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutePatchEpsLimit_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutePatchEpsLimit_Request::GetClassData() const { return &_class_data_; }
+
+
+void RoutePatchEpsLimit_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutePatchEpsLimit_Request*>(&to_msg);
+  auto& from = static_cast<const RoutePatchEpsLimit_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_eps_limit() != 0) {
+    _this->_internal_set_eps_limit(from._internal_eps_limit());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoutePatchEpsLimit_Request::CopyFrom(const RoutePatchEpsLimit_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoutePatchEpsLimit_Request::IsInitialized() const {
+  return true;
+}
+
+void RoutePatchEpsLimit_Request::InternalSwap(RoutePatchEpsLimit_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.eps_limit_, other->_impl_.eps_limit_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoutePatchEpsLimit_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[8]);
+}
+
+// ===================================================================
+
+class TableGet_Request::_Internal {
+ public:
+};
+
+TableGet_Request::TableGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TableGet_Request)
+}
+TableGet_Request::TableGet_Request(const TableGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  TableGet_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TableGet_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TableGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TableGet_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata TableGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[9]);
+}
+
+// ===================================================================
+
+class TableGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<TableGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+TableGet_Response::TableGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.TableGet_Response)
+}
+TableGet_Response::TableGet_Response(const TableGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TableGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_){from._impl_.table_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.TableGet_Response)
+}
+
+inline void TableGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.table_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+TableGet_Response::~TableGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.TableGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TableGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void TableGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TableGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.TableGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.table_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -3090,7 +3664,7 @@ void TableGet_Response::InternalSwap(TableGet_Response* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata TableGet_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[9]);
+      file_level_metadata_router_2eproto[10]);
 }
 
 // ===================================================================
@@ -3293,49 +3867,44 @@ void QueuePost_Request::InternalSwap(QueuePost_Request* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata QueuePost_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[10]);
+      file_level_metadata_router_2eproto[11]);
 }
 
 // ===================================================================
 
-class EpsUpdate_Request::_Internal {
+class QueuePostBulk_Request::_Internal {
  public:
 };
 
-EpsUpdate_Request::EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+QueuePostBulk_Request::QueuePostBulk_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsUpdate_Request)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.QueuePostBulk_Request)
 }
-EpsUpdate_Request::EpsUpdate_Request(const EpsUpdate_Request& from)
+QueuePostBulk_Request::QueuePostBulk_Request(const QueuePostBulk_Request& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  EpsUpdate_Request* const _this = this; (void)_this;
+  QueuePostBulk_Request* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.eps_){}
-    , decltype(_impl_.refresh_interval_){}
+      decltype(_impl_.wazuh_events_){from._impl_.wazuh_events_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::memcpy(&_impl_.eps_, &from._impl_.eps_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.refresh_interval_) -
-    reinterpret_cast<char*>(&_impl_.eps_)) + sizeof(_impl_.refresh_interval_));
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsUpdate_Request)
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.QueuePostBulk_Request)
 }
 
-inline void EpsUpdate_Request::SharedCtor(
+inline void QueuePostBulk_Request::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.eps_){0u}
-    , decltype(_impl_.refresh_interval_){0u}
+      decltype(_impl_.wazuh_events_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-EpsUpdate_Request::~EpsUpdate_Request() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.EpsUpdate_Request)
+QueuePostBulk_Request::~QueuePostBulk_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.QueuePostBulk_Request)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3343,45 +3912,43 @@ EpsUpdate_Request::~EpsUpdate_Request() {
   SharedDtor();
 }
 
-inline void EpsUpdate_Request::SharedDtor() {
+inline void QueuePostBulk_Request::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.wazuh_events_.~RepeatedPtrField();
 }
 
-void EpsUpdate_Request::SetCachedSize(int size) const {
+void QueuePostBulk_Request::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void EpsUpdate_Request::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+void QueuePostBulk_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.QueuePostBulk_Request)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&_impl_.eps_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.refresh_interval_) -
-      reinterpret_cast<char*>(&_impl_.eps_)) + sizeof(_impl_.refresh_interval_));
+  _impl_.wazuh_events_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EpsUpdate_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* QueuePostBulk_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // uint32 eps = 1;
+      // repeated string wazuh_events = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // uint32 refresh_interval = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.refresh_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_wazuh_events();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -3408,140 +3975,86 @@ failure:
 #undef CHK_
 }
 
-uint8_t* EpsUpdate_Request::_InternalSerialize(
+uint8_t* QueuePostBulk_Request::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.QueuePostBulk_Request)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // uint32 eps = 1;
-  if (this->_internal_eps() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_eps(), target);
-  }
-
-  // uint32 refresh_interval = 2;
-  if (this->_internal_refresh_interval() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_refresh_interval(), target);
+  // repeated string wazuh_events = 1;
+  for (int i = 0, n = this->_internal_wazuh_events_size(); i < n; i++) {
+    const auto& s = this->_internal_wazuh_events(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events");
+    target = stream->WriteString(1, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.EpsUpdate_Request)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.QueuePostBulk_Request)
   return target;
 }
 
-size_t EpsUpdate_Request::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+size_t QueuePostBulk_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.QueuePostBulk_Request)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // uint32 eps = 1;
-  if (this->_internal_eps() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps());
-  }
-
-  // uint32 refresh_interval = 2;
-  if (this->_internal_refresh_interval() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_refresh_interval());
+  // repeated string wazuh_events = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.wazuh_events_.size());
+  for (int i = 0, n = _impl_.wazuh_events_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.wazuh_events_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsUpdate_Request::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueuePostBulk_Request::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    EpsUpdate_Request::MergeImpl
+    QueuePostBulk_Request::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsUpdate_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueuePostBulk_Request::GetClassData() const { return &_class_data_; }
 
 
-void EpsUpdate_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<EpsUpdate_Request*>(&to_msg);
-  auto& from = static_cast<const EpsUpdate_Request&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+void QueuePostBulk_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueuePostBulk_Request*>(&to_msg);
+  auto& from = static_cast<const QueuePostBulk_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.QueuePostBulk_Request)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_eps() != 0) {
-    _this->_internal_set_eps(from._internal_eps());
-  }
-  if (from._internal_refresh_interval() != 0) {
-    _this->_internal_set_refresh_interval(from._internal_refresh_interval());
-  }
+  _this->_impl_.wazuh_events_.MergeFrom(from._impl_.wazuh_events_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EpsUpdate_Request::CopyFrom(const EpsUpdate_Request& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+void QueuePostBulk_Request::CopyFrom(const QueuePostBulk_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.QueuePostBulk_Request)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EpsUpdate_Request::IsInitialized() const {
+bool QueuePostBulk_Request::IsInitialized() const {
   return true;
 }
 
-void EpsUpdate_Request::InternalSwap(EpsUpdate_Request* other) {
+void QueuePostBulk_Request::InternalSwap(QueuePostBulk_Request* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EpsUpdate_Request, _impl_.refresh_interval_)
-      + sizeof(EpsUpdate_Request::_impl_.refresh_interval_)
-      - PROTOBUF_FIELD_OFFSET(EpsUpdate_Request, _impl_.eps_)>(
-          reinterpret_cast<char*>(&_impl_.eps_),
-          reinterpret_cast<char*>(&other->_impl_.eps_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata EpsUpdate_Request::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[11]);
-}
-
-// ===================================================================
-
-class EpsGet_Request::_Internal {
- public:
-};
-
-EpsGet_Request::EpsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsGet_Request)
-}
-EpsGet_Request::EpsGet_Request(const EpsGet_Request& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  EpsGet_Request* const _this = this; (void)_this;
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsGet_Request)
+  _impl_.wazuh_events_.InternalSwap(&other->_impl_.wazuh_events_);
 }
 
-
-
-
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsGet_Request::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsGet_Request::GetClassData() const { return &_class_data_; }
-
-
-
-
-
-
-
-::PROTOBUF_NAMESPACE_ID::Metadata EpsGet_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata QueuePostBulk_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
       file_level_metadata_router_2eproto[12]);
@@ -3549,31 +4062,30 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsGet_Request::GetClassData()
 
 // ===================================================================
 
-class EpsGet_Response::_Internal {
+class QueuePostBulk_Response::_Internal {
  public:
-  using HasBits = decltype(std::declval<EpsGet_Response>()._impl_._has_bits_);
+  using HasBits = decltype(std::declval<QueuePostBulk_Response>()._impl_._has_bits_);
   static void set_has_error(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
 };
 
-EpsGet_Response::EpsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+QueuePostBulk_Response::QueuePostBulk_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsGet_Response)
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.QueuePostBulk_Response)
 }
-EpsGet_Response::EpsGet_Response(const EpsGet_Response& from)
+QueuePostBulk_Response::QueuePostBulk_Response(const QueuePostBulk_Response& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  EpsGet_Response* const _this = this; (void)_this;
+  QueuePostBulk_Response* const _this = this; (void)_this;
   new (&_impl_) Impl_{
       decltype(_impl_._has_bits_){from._impl_._has_bits_}
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.error_){}
     , decltype(_impl_.status_){}
-    , decltype(_impl_.eps_){}
-    , decltype(_impl_.refresh_interval_){}
-    , decltype(_impl_.enabled_){}};
+    , decltype(_impl_.accepted_){}
+    , decltype(_impl_.discarded_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.error_.InitDefault();
@@ -3585,12 +4097,12 @@ EpsGet_Response::EpsGet_Response(const EpsGet_Response& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.status_, &from._impl_.status_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.enabled_) -
-    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.enabled_));
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsGet_Response)
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.discarded_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.discarded_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.QueuePostBulk_Response)
 }
 
-inline void EpsGet_Response::SharedCtor(
+inline void QueuePostBulk_Response::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
@@ -3599,9 +4111,8 @@ inline void EpsGet_Response::SharedCtor(
     , /*decltype(_impl_._cached_size_)*/{}
     , decltype(_impl_.error_){}
     , decltype(_impl_.status_){0}
-    , decltype(_impl_.eps_){0u}
-    , decltype(_impl_.refresh_interval_){0u}
-    , decltype(_impl_.enabled_){false}
+    , decltype(_impl_.accepted_){0u}
+    , decltype(_impl_.discarded_){0u}
   };
   _impl_.error_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -3609,8 +4120,8 @@ inline void EpsGet_Response::SharedCtor(
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-EpsGet_Response::~EpsGet_Response() {
-  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.EpsGet_Response)
+QueuePostBulk_Response::~QueuePostBulk_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.QueuePostBulk_Response)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -3618,17 +4129,17 @@ EpsGet_Response::~EpsGet_Response() {
   SharedDtor();
 }
 
-inline void EpsGet_Response::SharedDtor() {
+inline void QueuePostBulk_Response::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   _impl_.error_.Destroy();
 }
 
-void EpsGet_Response::SetCachedSize(int size) const {
+void QueuePostBulk_Response::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void EpsGet_Response::Clear() {
-// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.EpsGet_Response)
+void QueuePostBulk_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.QueuePostBulk_Response)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
@@ -3638,13 +4149,13 @@ void EpsGet_Response::Clear() {
     _impl_.error_.ClearNonDefaultToEmpty();
   }
   ::memset(&_impl_.status_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&_impl_.enabled_) -
-      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.enabled_));
+      reinterpret_cast<char*>(&_impl_.discarded_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.discarded_));
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* EpsGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* QueuePostBulk_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -3666,30 +4177,22 @@ const char* EpsGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContex
           auto str = _internal_mutable_error();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.EpsGet_Response.error"));
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.QueuePostBulk_Response.error"));
         } else
           goto handle_unusual;
         continue;
-      // uint32 eps = 3;
+      // uint32 accepted = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          _impl_.accepted_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // uint32 refresh_interval = 4;
+      // uint32 discarded = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _impl_.refresh_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // bool enabled = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _impl_.enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _impl_.discarded_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -3718,9 +4221,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* EpsGet_Response::_InternalSerialize(
+uint8_t* QueuePostBulk_Response::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.EpsGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.QueuePostBulk_Response)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -3736,39 +4239,33 @@ uint8_t* EpsGet_Response::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
       this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "com.wazuh.api.engine.router.EpsGet_Response.error");
+      "com.wazuh.api.engine.router.QueuePostBulk_Response.error");
     target = stream->WriteStringMaybeAliased(
         2, this->_internal_error(), target);
   }
 
-  // uint32 eps = 3;
-  if (this->_internal_eps() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_eps(), target);
-  }
-
-  // uint32 refresh_interval = 4;
-  if (this->_internal_refresh_interval() != 0) {
+  // uint32 accepted = 3;
+  if (this->_internal_accepted() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_refresh_interval(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_accepted(), target);
   }
 
-  // bool enabled = 5;
-  if (this->_internal_enabled() != 0) {
+  // uint32 discarded = 4;
+  if (this->_internal_discarded() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_enabled(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_discarded(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.EpsGet_Response)
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.QueuePostBulk_Response)
   return target;
 }
 
-size_t EpsGet_Response::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.EpsGet_Response)
+size_t QueuePostBulk_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.QueuePostBulk_Response)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
@@ -3789,35 +4286,30 @@ size_t EpsGet_Response::ByteSizeLong() const {
       ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
   }
 
-  // uint32 eps = 3;
-  if (this->_internal_eps() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps());
-  }
-
-  // uint32 refresh_interval = 4;
-  if (this->_internal_refresh_interval() != 0) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_refresh_interval());
+  // uint32 accepted = 3;
+  if (this->_internal_accepted() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_accepted());
   }
 
-  // bool enabled = 5;
-  if (this->_internal_enabled() != 0) {
-    total_size += 1 + 1;
+  // uint32 discarded = 4;
+  if (this->_internal_discarded() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_discarded());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsGet_Response::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData QueuePostBulk_Response::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    EpsGet_Response::MergeImpl
+    QueuePostBulk_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsGet_Response::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*QueuePostBulk_Response::GetClassData() const { return &_class_data_; }
 
 
-void EpsGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<EpsGet_Response*>(&to_msg);
-  auto& from = static_cast<const EpsGet_Response&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.EpsGet_Response)
+void QueuePostBulk_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<QueuePostBulk_Response*>(&to_msg);
+  auto& from = static_cast<const QueuePostBulk_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.QueuePostBulk_Response)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
@@ -3828,30 +4320,27 @@ void EpsGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const
   if (from._internal_status() != 0) {
     _this->_internal_set_status(from._internal_status());
   }
-  if (from._internal_eps() != 0) {
-    _this->_internal_set_eps(from._internal_eps());
-  }
-  if (from._internal_refresh_interval() != 0) {
-    _this->_internal_set_refresh_interval(from._internal_refresh_interval());
+  if (from._internal_accepted() != 0) {
+    _this->_internal_set_accepted(from._internal_accepted());
   }
-  if (from._internal_enabled() != 0) {
-    _this->_internal_set_enabled(from._internal_enabled());
+  if (from._internal_discarded() != 0) {
+    _this->_internal_set_discarded(from._internal_discarded());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void EpsGet_Response::CopyFrom(const EpsGet_Response& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.EpsGet_Response)
+void QueuePostBulk_Response::CopyFrom(const QueuePostBulk_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.QueuePostBulk_Response)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool EpsGet_Response::IsInitialized() const {
+bool QueuePostBulk_Response::IsInitialized() const {
   return true;
 }
 
-void EpsGet_Response::InternalSwap(EpsGet_Response* other) {
+void QueuePostBulk_Response::InternalSwap(QueuePostBulk_Response* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
@@ -3862,14 +4351,14 @@ void EpsGet_Response::InternalSwap(EpsGet_Response* other) {
       &other->_impl_.error_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EpsGet_Response, _impl_.enabled_)
-      + sizeof(EpsGet_Response::_impl_.enabled_)
-      - PROTOBUF_FIELD_OFFSET(EpsGet_Response, _impl_.status_)>(
+      PROTOBUF_FIELD_OFFSET(QueuePostBulk_Response, _impl_.discarded_)
+      + sizeof(QueuePostBulk_Response::_impl_.discarded_)
+      - PROTOBUF_FIELD_OFFSET(QueuePostBulk_Response, _impl_.status_)>(
           reinterpret_cast<char*>(&_impl_.status_),
           reinterpret_cast<char*>(&other->_impl_.status_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata EpsGet_Response::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata QueuePostBulk_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
       file_level_metadata_router_2eproto[13]);
@@ -3877,31 +4366,1529 @@ void EpsGet_Response::InternalSwap(EpsGet_Response* other) {
 
 // ===================================================================
 
-class EpsEnable_Request::_Internal {
+class EpsUpdate_Request::_Internal {
  public:
 };
 
-EpsEnable_Request::EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+EpsUpdate_Request::EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsEnable_Request)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsUpdate_Request)
 }
-EpsEnable_Request::EpsEnable_Request(const EpsEnable_Request& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  EpsEnable_Request* const _this = this; (void)_this;
+EpsUpdate_Request::EpsUpdate_Request(const EpsUpdate_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpsUpdate_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eps_){}
+    , decltype(_impl_.refresh_interval_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsEnable_Request)
+  ::memcpy(&_impl_.eps_, &from._impl_.eps_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.refresh_interval_) -
+    reinterpret_cast<char*>(&_impl_.eps_)) + sizeof(_impl_.refresh_interval_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsUpdate_Request)
 }
 
+inline void EpsUpdate_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.eps_){0u}
+    , decltype(_impl_.refresh_interval_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
 
+EpsUpdate_Request::~EpsUpdate_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.EpsUpdate_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpsUpdate_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void EpsUpdate_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpsUpdate_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.eps_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.refresh_interval_) -
+      reinterpret_cast<char*>(&_impl_.eps_)) + sizeof(_impl_.refresh_interval_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpsUpdate_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 eps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 refresh_interval = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.refresh_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpsUpdate_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 eps = 1;
+  if (this->_internal_eps() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_eps(), target);
+  }
+
+  // uint32 refresh_interval = 2;
+  if (this->_internal_refresh_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_refresh_interval(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.EpsUpdate_Request)
+  return target;
+}
+
+size_t EpsUpdate_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 eps = 1;
+  if (this->_internal_eps() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps());
+  }
+
+  // uint32 refresh_interval = 2;
+  if (this->_internal_refresh_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_refresh_interval());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsUpdate_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpsUpdate_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsUpdate_Request::GetClassData() const { return &_class_data_; }
+
+
+void EpsUpdate_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpsUpdate_Request*>(&to_msg);
+  auto& from = static_cast<const EpsUpdate_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_eps() != 0) {
+    _this->_internal_set_eps(from._internal_eps());
+  }
+  if (from._internal_refresh_interval() != 0) {
+    _this->_internal_set_refresh_interval(from._internal_refresh_interval());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpsUpdate_Request::CopyFrom(const EpsUpdate_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.EpsUpdate_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpsUpdate_Request::IsInitialized() const {
+  return true;
+}
+
+void EpsUpdate_Request::InternalSwap(EpsUpdate_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpsUpdate_Request, _impl_.refresh_interval_)
+      + sizeof(EpsUpdate_Request::_impl_.refresh_interval_)
+      - PROTOBUF_FIELD_OFFSET(EpsUpdate_Request, _impl_.eps_)>(
+          reinterpret_cast<char*>(&_impl_.eps_),
+          reinterpret_cast<char*>(&other->_impl_.eps_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpsUpdate_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[14]);
+}
+
+// ===================================================================
+
+class EpsGet_Request::_Internal {
+ public:
+};
+
+EpsGet_Request::EpsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsGet_Request)
+}
+EpsGet_Request::EpsGet_Request(const EpsGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  EpsGet_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsGet_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsGet_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsGet_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpsGet_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[15]);
+}
+
+// ===================================================================
+
+class EpsGet_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EpsGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+EpsGet_Response::EpsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsGet_Response)
+}
+EpsGet_Response::EpsGet_Response(const EpsGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  EpsGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.eps_){}
+    , decltype(_impl_.refresh_interval_){}
+    , decltype(_impl_.enabled_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.status_, &from._impl_.status_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.enabled_) -
+    reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.enabled_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsGet_Response)
+}
+
+inline void EpsGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.eps_){0u}
+    , decltype(_impl_.refresh_interval_){0u}
+    , decltype(_impl_.enabled_){false}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EpsGet_Response::~EpsGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.EpsGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EpsGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+}
+
+void EpsGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EpsGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.EpsGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  ::memset(&_impl_.status_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.enabled_) -
+      reinterpret_cast<char*>(&_impl_.status_)) + sizeof(_impl_.enabled_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* EpsGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.EpsGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 eps = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.eps_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 refresh_interval = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.refresh_interval_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool enabled = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.enabled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EpsGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.EpsGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.EpsGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // uint32 eps = 3;
+  if (this->_internal_eps() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_eps(), target);
+  }
+
+  // uint32 refresh_interval = 4;
+  if (this->_internal_refresh_interval() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_refresh_interval(), target);
+  }
+
+  // bool enabled = 5;
+  if (this->_internal_enabled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_enabled(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.EpsGet_Response)
+  return target;
+}
+
+size_t EpsGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.EpsGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint32 eps = 3;
+  if (this->_internal_eps() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_eps());
+  }
+
+  // uint32 refresh_interval = 4;
+  if (this->_internal_refresh_interval() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_refresh_interval());
+  }
+
+  // bool enabled = 5;
+  if (this->_internal_enabled() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    EpsGet_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsGet_Response::GetClassData() const { return &_class_data_; }
+
+
+void EpsGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<EpsGet_Response*>(&to_msg);
+  auto& from = static_cast<const EpsGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.EpsGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_eps() != 0) {
+    _this->_internal_set_eps(from._internal_eps());
+  }
+  if (from._internal_refresh_interval() != 0) {
+    _this->_internal_set_refresh_interval(from._internal_refresh_interval());
+  }
+  if (from._internal_enabled() != 0) {
+    _this->_internal_set_enabled(from._internal_enabled());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void EpsGet_Response::CopyFrom(const EpsGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.EpsGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EpsGet_Response::IsInitialized() const {
+  return true;
+}
+
+void EpsGet_Response::InternalSwap(EpsGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpsGet_Response, _impl_.enabled_)
+      + sizeof(EpsGet_Response::_impl_.enabled_)
+      - PROTOBUF_FIELD_OFFSET(EpsGet_Response, _impl_.status_)>(
+          reinterpret_cast<char*>(&_impl_.status_),
+          reinterpret_cast<char*>(&other->_impl_.status_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpsGet_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[16]);
+}
+
+// ===================================================================
+
+class EpsEnable_Request::_Internal {
+ public:
+};
+
+EpsEnable_Request::EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsEnable_Request)
+}
+EpsEnable_Request::EpsEnable_Request(const EpsEnable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  EpsEnable_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsEnable_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsEnable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsEnable_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpsEnable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[17]);
+}
+
+// ===================================================================
+
+class EpsDisable_Request::_Internal {
+ public:
+};
+
+EpsDisable_Request::EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsDisable_Request)
+}
+EpsDisable_Request::EpsDisable_Request(const EpsDisable_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  EpsDisable_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsDisable_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsDisable_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsDisable_Request::GetClassData() const { return &_class_data_; }
+
+
+
+
+
+
+
+::PROTOBUF_NAMESPACE_ID::Metadata EpsDisable_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[18]);
+}
+
+// ===================================================================
+
+class IngressRule::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IngressRule>()._impl_._has_bits_);
+  static void set_has_queue(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_location_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+IngressRule::IngressRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.IngressRule)
+}
+IngressRule::IngressRule(const IngressRule& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IngressRule* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.contains_){from._impl_.contains_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.location_prefix_){}
+    , decltype(_impl_.hits_){}
+    , decltype(_impl_.action_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_queue()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.location_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_location_prefix()) {
+    _this->_impl_.location_prefix_.Set(from._internal_location_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.hits_, &from._impl_.hits_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.action_) -
+    reinterpret_cast<char*>(&_impl_.hits_)) + sizeof(_impl_.action_));
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.IngressRule)
+}
+
+inline void IngressRule::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.contains_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.queue_){}
+    , decltype(_impl_.location_prefix_){}
+    , decltype(_impl_.hits_){uint64_t{0u}}
+    , decltype(_impl_.action_){0}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.location_prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+IngressRule::~IngressRule() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.IngressRule)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IngressRule::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.contains_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+  _impl_.queue_.Destroy();
+  _impl_.location_prefix_.Destroy();
+}
+
+void IngressRule::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IngressRule::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.IngressRule)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.contains_.Clear();
+  _impl_.name_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.queue_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.location_prefix_.ClearNonDefaultToEmpty();
+    }
+  }
+  ::memset(&_impl_.hits_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.action_) -
+      reinterpret_cast<char*>(&_impl_.hits_)) + sizeof(_impl_.action_));
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IngressRule::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressRule.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .com.wazuh.api.engine.router.IngressAction action = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_action(static_cast<::com::wazuh::api::engine::router::IngressAction>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string queue = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressRule.queue"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string location_prefix = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_location_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressRule.location_prefix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string contains = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_contains();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressRule.contains"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 hits = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.hits_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IngressRule::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.IngressRule)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressRule.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .com.wazuh.api.engine.router.IngressAction action = 2;
+  if (this->_internal_action() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_action(), target);
+  }
+
+  // optional string queue = 3;
+  if (_internal_has_queue()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressRule.queue");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_queue(), target);
+  }
+
+  // optional string location_prefix = 4;
+  if (_internal_has_location_prefix()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_location_prefix().data(), static_cast<int>(this->_internal_location_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressRule.location_prefix");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_location_prefix(), target);
+  }
+
+  // repeated string contains = 5;
+  for (int i = 0, n = this->_internal_contains_size(); i < n; i++) {
+    const auto& s = this->_internal_contains(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressRule.contains");
+    target = stream->WriteString(5, s, target);
+  }
+
+  // uint64 hits = 6;
+  if (this->_internal_hits() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_hits(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.IngressRule)
+  return target;
+}
+
+size_t IngressRule::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.IngressRule)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string contains = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.contains_.size());
+  for (int i = 0, n = _impl_.contains_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.contains_.Get(i));
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string queue = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_queue());
+    }
+
+    // optional string location_prefix = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_location_prefix());
+    }
+
+  }
+  // uint64 hits = 6;
+  if (this->_internal_hits() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_hits());
+  }
+
+  // .com.wazuh.api.engine.router.IngressAction action = 2;
+  if (this->_internal_action() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_action());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IngressRule::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IngressRule::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IngressRule::GetClassData() const { return &_class_data_; }
+
+
+void IngressRule::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IngressRule*>(&to_msg);
+  auto& from = static_cast<const IngressRule&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.IngressRule)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.contains_.MergeFrom(from._impl_.contains_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_queue(from._internal_queue());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_location_prefix(from._internal_location_prefix());
+    }
+  }
+  if (from._internal_hits() != 0) {
+    _this->_internal_set_hits(from._internal_hits());
+  }
+  if (from._internal_action() != 0) {
+    _this->_internal_set_action(from._internal_action());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IngressRule::CopyFrom(const IngressRule& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.IngressRule)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IngressRule::IsInitialized() const {
+  return true;
+}
+
+void IngressRule::InternalSwap(IngressRule* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.contains_.InternalSwap(&other->_impl_.contains_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.location_prefix_, lhs_arena,
+      &other->_impl_.location_prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IngressRule, _impl_.action_)
+      + sizeof(IngressRule::_impl_.action_)
+      - PROTOBUF_FIELD_OFFSET(IngressRule, _impl_.hits_)>(
+          reinterpret_cast<char*>(&_impl_.hits_),
+          reinterpret_cast<char*>(&other->_impl_.hits_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IngressRule::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[19]);
+}
+
+// ===================================================================
+
+class IngressPost_Request::_Internal {
+ public:
+  using HasBits = decltype(std::declval<IngressPost_Request>()._impl_._has_bits_);
+  static const ::com::wazuh::api::engine::router::IngressRule& rule(const IngressPost_Request* msg);
+  static void set_has_rule(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+const ::com::wazuh::api::engine::router::IngressRule&
+IngressPost_Request::_Internal::rule(const IngressPost_Request* msg) {
+  return *msg->_impl_.rule_;
+}
+IngressPost_Request::IngressPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.IngressPost_Request)
+}
+IngressPost_Request::IngressPost_Request(const IngressPost_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IngressPost_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_){nullptr}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_rule()) {
+    _this->_impl_.rule_ = new ::com::wazuh::api::engine::router::IngressRule(*from._impl_.rule_);
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.IngressPost_Request)
+}
+
+inline void IngressPost_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rule_){nullptr}
+  };
+}
+
+IngressPost_Request::~IngressPost_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.IngressPost_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IngressPost_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.rule_;
+}
+
+void IngressPost_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IngressPost_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.IngressPost_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    GOOGLE_DCHECK(_impl_.rule_ != nullptr);
+    _impl_.rule_->Clear();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IngressPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .com.wazuh.api.engine.router.IngressRule rule = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rule(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IngressPost_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.IngressPost_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // optional .com.wazuh.api.engine.router.IngressRule rule = 1;
+  if (_internal_has_rule()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rule(this),
+        _Internal::rule(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.IngressPost_Request)
+  return target;
+}
+
+size_t IngressPost_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.IngressPost_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .com.wazuh.api.engine.router.IngressRule rule = 1;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rule_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IngressPost_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IngressPost_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IngressPost_Request::GetClassData() const { return &_class_data_; }
+
+
+void IngressPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IngressPost_Request*>(&to_msg);
+  auto& from = static_cast<const IngressPost_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.IngressPost_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_rule()) {
+    _this->_internal_mutable_rule()->::com::wazuh::api::engine::router::IngressRule::MergeFrom(
+        from._internal_rule());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IngressPost_Request::CopyFrom(const IngressPost_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.IngressPost_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IngressPost_Request::IsInitialized() const {
+  return true;
+}
+
+void IngressPost_Request::InternalSwap(IngressPost_Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  swap(_impl_.rule_, other->_impl_.rule_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IngressPost_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[20]);
+}
+
+// ===================================================================
+
+class IngressDelete_Request::_Internal {
+ public:
+};
+
+IngressDelete_Request::IngressDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.IngressDelete_Request)
+}
+IngressDelete_Request::IngressDelete_Request(const IngressDelete_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IngressDelete_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.IngressDelete_Request)
+}
+
+inline void IngressDelete_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+IngressDelete_Request::~IngressDelete_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.IngressDelete_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IngressDelete_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+}
+
+void IngressDelete_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IngressDelete_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.IngressDelete_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IngressDelete_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressDelete_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IngressDelete_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.IngressDelete_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressDelete_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.IngressDelete_Request)
+  return target;
+}
+
+size_t IngressDelete_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.IngressDelete_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IngressDelete_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IngressDelete_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IngressDelete_Request::GetClassData() const { return &_class_data_; }
+
+
+void IngressDelete_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IngressDelete_Request*>(&to_msg);
+  auto& from = static_cast<const IngressDelete_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.IngressDelete_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IngressDelete_Request::CopyFrom(const IngressDelete_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.IngressDelete_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IngressDelete_Request::IsInitialized() const {
+  return true;
+}
+
+void IngressDelete_Request::InternalSwap(IngressDelete_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IngressDelete_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
+      file_level_metadata_router_2eproto[21]);
+}
 
+// ===================================================================
 
+class IngressGet_Request::_Internal {
+ public:
+};
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsEnable_Request::_class_data_ = {
+IngressGet_Request::IngressGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.IngressGet_Request)
+}
+IngressGet_Request::IngressGet_Request(const IngressGet_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
+  IngressGet_Request* const _this = this; (void)_this;
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.IngressGet_Request)
+}
+
+
+
+
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IngressGet_Request::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsEnable_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IngressGet_Request::GetClassData() const { return &_class_data_; }
 
 
 
@@ -3909,50 +5896,291 @@ const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsEnable_Request::GetClassDat
 
 
 
-::PROTOBUF_NAMESPACE_ID::Metadata EpsEnable_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata IngressGet_Request::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[14]);
+      file_level_metadata_router_2eproto[22]);
 }
 
 // ===================================================================
 
-class EpsDisable_Request::_Internal {
+class IngressGet_Response::_Internal {
  public:
+  using HasBits = decltype(std::declval<IngressGet_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
 };
 
-EpsDisable_Request::EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+IngressGet_Response::IngressGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase(arena, is_message_owned) {
-  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.EpsDisable_Request)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.router.IngressGet_Response)
 }
-EpsDisable_Request::EpsDisable_Request(const EpsDisable_Request& from)
-  : ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase() {
-  EpsDisable_Request* const _this = this; (void)_this;
+IngressGet_Response::IngressGet_Response(const IngressGet_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IngressGet_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rules_){from._impl_.rules_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.EpsDisable_Request)
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.router.IngressGet_Response)
+}
+
+inline void IngressGet_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.rules_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
+IngressGet_Response::~IngressGet_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.router.IngressGet_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
 
+inline void IngressGet_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.rules_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
 
+void IngressGet_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
 
+void IngressGet_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.router.IngressGet_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData EpsDisable_Request::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl,
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl,
+  _impl_.rules_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IngressGet_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.router.IngressGet_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.router.IngressRule rules = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rules(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IngressGet_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.router.IngressGet_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.router.IngressGet_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.router.IngressRule rules = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rules_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rules(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.router.IngressGet_Response)
+  return target;
+}
+
+size_t IngressGet_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.router.IngressGet_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.router.IngressRule rules = 3;
+  total_size += 1UL * this->_internal_rules_size();
+  for (const auto& msg : this->_impl_.rules_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IngressGet_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IngressGet_Response::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*EpsDisable_Request::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IngressGet_Response::GetClassData() const { return &_class_data_; }
 
 
+void IngressGet_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IngressGet_Response*>(&to_msg);
+  auto& from = static_cast<const IngressGet_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.router.IngressGet_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
 
+  _this->_impl_.rules_.MergeFrom(from._impl_.rules_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
 
+void IngressGet_Response::CopyFrom(const IngressGet_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.router.IngressGet_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
 
+bool IngressGet_Response::IsInitialized() const {
+  return true;
+}
 
+void IngressGet_Response::InternalSwap(IngressGet_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.rules_.InternalSwap(&other->_impl_.rules_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
 
-::PROTOBUF_NAMESPACE_ID::Metadata EpsDisable_Request::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata IngressGet_Response::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_router_2eproto_getter, &descriptor_table_router_2eproto_once,
-      file_level_metadata_router_2eproto[15]);
+      file_level_metadata_router_2eproto[23]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -3994,6 +6222,10 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePatchPriori
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePatchPriority_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::TableGet_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::TableGet_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::TableGet_Request >(arena);
@@ -4006,6 +6238,14 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::QueuePost_Reques
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::QueuePost_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::QueuePost_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::QueuePostBulk_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::QueuePostBulk_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::QueuePostBulk_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::QueuePostBulk_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::QueuePostBulk_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::QueuePostBulk_Response >(arena);
+}
 template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EpsUpdate_Request*
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EpsUpdate_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EpsUpdate_Request >(arena);
@@ -4026,6 +6266,26 @@ template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::EpsDisable_Reque
 Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::EpsDisable_Request >(Arena* arena) {
   return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::EpsDisable_Request >(arena);
 }
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::IngressRule*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::IngressRule >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::IngressRule >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::IngressPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::IngressPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::IngressPost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::IngressDelete_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::IngressDelete_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::IngressDelete_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::IngressGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::IngressGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::IngressGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::router::IngressGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::router::IngressGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::router::IngressGet_Response >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
@@ -73,6 +73,27 @@ extern EpsGet_ResponseDefaultTypeInternal _EpsGet_Response_default_instance_;
 class EpsUpdate_Request;
 struct EpsUpdate_RequestDefaultTypeInternal;
 extern EpsUpdate_RequestDefaultTypeInternal _EpsUpdate_Request_default_instance_;
+class IngressDelete_Request;
+struct IngressDelete_RequestDefaultTypeInternal;
+extern IngressDelete_RequestDefaultTypeInternal _IngressDelete_Request_default_instance_;
+class IngressGet_Request;
+struct IngressGet_RequestDefaultTypeInternal;
+extern IngressGet_RequestDefaultTypeInternal _IngressGet_Request_default_instance_;
+class IngressGet_Response;
+struct IngressGet_ResponseDefaultTypeInternal;
+extern IngressGet_ResponseDefaultTypeInternal _IngressGet_Response_default_instance_;
+class IngressPost_Request;
+struct IngressPost_RequestDefaultTypeInternal;
+extern IngressPost_RequestDefaultTypeInternal _IngressPost_Request_default_instance_;
+class IngressRule;
+struct IngressRuleDefaultTypeInternal;
+extern IngressRuleDefaultTypeInternal _IngressRule_default_instance_;
+class QueuePostBulk_Request;
+struct QueuePostBulk_RequestDefaultTypeInternal;
+extern QueuePostBulk_RequestDefaultTypeInternal _QueuePostBulk_Request_default_instance_;
+class QueuePostBulk_Response;
+struct QueuePostBulk_ResponseDefaultTypeInternal;
+extern QueuePostBulk_ResponseDefaultTypeInternal _QueuePostBulk_Response_default_instance_;
 class QueuePost_Request;
 struct QueuePost_RequestDefaultTypeInternal;
 extern QueuePost_RequestDefaultTypeInternal _QueuePost_Request_default_instance_;
@@ -85,6 +106,9 @@ extern RouteGet_RequestDefaultTypeInternal _RouteGet_Request_default_instance_;
 class RouteGet_Response;
 struct RouteGet_ResponseDefaultTypeInternal;
 extern RouteGet_ResponseDefaultTypeInternal _RouteGet_Response_default_instance_;
+class RoutePatchEpsLimit_Request;
+struct RoutePatchEpsLimit_RequestDefaultTypeInternal;
+extern RoutePatchEpsLimit_RequestDefaultTypeInternal _RoutePatchEpsLimit_Request_default_instance_;
 class RoutePatchPriority_Request;
 struct RoutePatchPriority_RequestDefaultTypeInternal;
 extern RoutePatchPriority_RequestDefaultTypeInternal _RoutePatchPriority_Request_default_instance_;
@@ -113,10 +137,18 @@ template<> ::com::wazuh::api::engine::router::EpsEnable_Request* Arena::CreateMa
 template<> ::com::wazuh::api::engine::router::EpsGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsGet_Response>(Arena*);
 template<> ::com::wazuh::api::engine::router::EpsUpdate_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::EpsUpdate_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::IngressDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::IngressDelete_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::IngressGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::IngressGet_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::IngressGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::IngressGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::IngressPost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::IngressPost_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::IngressRule* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::IngressRule>(Arena*);
+template<> ::com::wazuh::api::engine::router::QueuePostBulk_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::QueuePostBulk_Request>(Arena*);
+template<> ::com::wazuh::api::engine::router::QueuePostBulk_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::QueuePostBulk_Response>(Arena*);
 template<> ::com::wazuh::api::engine::router::QueuePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::QueuePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteDelete_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteDelete_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteGet_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteGet_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteGet_Response* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteGet_Response>(Arena*);
+template<> ::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RoutePatchEpsLimit_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RoutePatchPriority_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RoutePatchPriority_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RoutePost_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RoutePost_Request>(Arena*);
 template<> ::com::wazuh::api::engine::router::RouteReload_Request* Arena::CreateMaybeMessage<::com::wazuh::api::engine::router::RouteReload_Request>(Arena*);
@@ -182,6 +214,32 @@ inline bool Sync_Parse(
   return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Sync>(
     Sync_descriptor(), name, value);
 }
+enum IngressAction : int {
+  INGRESS_ACTION_UNKNOWN = 0,
+  DROP = 1,
+  DIVERT = 2,
+  IngressAction_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  IngressAction_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool IngressAction_IsValid(int value);
+constexpr IngressAction IngressAction_MIN = INGRESS_ACTION_UNKNOWN;
+constexpr IngressAction IngressAction_MAX = DIVERT;
+constexpr int IngressAction_ARRAYSIZE = IngressAction_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* IngressAction_descriptor();
+template<typename T>
+inline const std::string& IngressAction_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, IngressAction>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function IngressAction_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    IngressAction_descriptor(), enum_t_value);
+}
+inline bool IngressAction_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, IngressAction* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<IngressAction>(
+    IngressAction_descriptor(), name, value);
+}
 // ===================================================================
 
 class EntryPost final :
@@ -310,6 +368,7 @@ class EntryPost final :
     kFilterFieldNumber = 3,
     kDescriptionFieldNumber = 5,
     kPriorityFieldNumber = 4,
+    kEpsLimitFieldNumber = 6,
   };
   // string name = 1;
   void clear_name();
@@ -380,6 +439,19 @@ class EntryPost final :
   void _internal_set_priority(uint32_t value);
   public:
 
+  // optional uint32 eps_limit = 6;
+  bool has_eps_limit() const;
+  private:
+  bool _internal_has_eps_limit() const;
+  public:
+  void clear_eps_limit();
+  uint32_t eps_limit() const;
+  void set_eps_limit(uint32_t value);
+  private:
+  uint32_t _internal_eps_limit() const;
+  void _internal_set_eps_limit(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EntryPost)
  private:
   class _Internal;
@@ -395,6 +467,7 @@ class EntryPost final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr filter_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr description_;
     uint32_t priority_;
+    uint32_t eps_limit_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
@@ -530,6 +603,8 @@ class Entry final :
     kPolicySyncFieldNumber = 6,
     kEntryStatusFieldNumber = 7,
     kUptimeFieldNumber = 8,
+    kThrottledFieldNumber = 10,
+    kEpsLimitFieldNumber = 9,
   };
   // string name = 1;
   void clear_name();
@@ -627,6 +702,24 @@ class Entry final :
   void _internal_set_uptime(uint32_t value);
   public:
 
+  // uint64 throttled = 10;
+  void clear_throttled();
+  uint64_t throttled() const;
+  void set_throttled(uint64_t value);
+  private:
+  uint64_t _internal_throttled() const;
+  void _internal_set_throttled(uint64_t value);
+  public:
+
+  // uint32 eps_limit = 9;
+  void clear_eps_limit();
+  uint32_t eps_limit() const;
+  void set_eps_limit(uint32_t value);
+  private:
+  uint32_t _internal_eps_limit() const;
+  void _internal_set_eps_limit(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.Entry)
  private:
   class _Internal;
@@ -645,6 +738,8 @@ class Entry final :
     int policy_sync_;
     int entry_status_;
     uint32_t uptime_;
+    uint64_t throttled_;
+    uint32_t eps_limit_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
@@ -1621,6 +1716,170 @@ class RoutePatchPriority_Request final :
 };
 // -------------------------------------------------------------------
 
+class RoutePatchEpsLimit_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request) */ {
+ public:
+  inline RoutePatchEpsLimit_Request() : RoutePatchEpsLimit_Request(nullptr) {}
+  ~RoutePatchEpsLimit_Request() override;
+  explicit PROTOBUF_CONSTEXPR RoutePatchEpsLimit_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoutePatchEpsLimit_Request(const RoutePatchEpsLimit_Request& from);
+  RoutePatchEpsLimit_Request(RoutePatchEpsLimit_Request&& from) noexcept
+    : RoutePatchEpsLimit_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline RoutePatchEpsLimit_Request& operator=(const RoutePatchEpsLimit_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoutePatchEpsLimit_Request& operator=(RoutePatchEpsLimit_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoutePatchEpsLimit_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoutePatchEpsLimit_Request* internal_default_instance() {
+    return reinterpret_cast<const RoutePatchEpsLimit_Request*>(
+               &_RoutePatchEpsLimit_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(RoutePatchEpsLimit_Request& a, RoutePatchEpsLimit_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoutePatchEpsLimit_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoutePatchEpsLimit_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoutePatchEpsLimit_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoutePatchEpsLimit_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoutePatchEpsLimit_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoutePatchEpsLimit_Request& from) {
+    RoutePatchEpsLimit_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoutePatchEpsLimit_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.RoutePatchEpsLimit_Request";
+  }
+  protected:
+  explicit RoutePatchEpsLimit_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kEpsLimitFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint32 eps_limit = 2;
+  void clear_eps_limit();
+  uint32_t eps_limit() const;
+  void set_eps_limit(uint32_t value);
+  private:
+  uint32_t _internal_eps_limit() const;
+  void _internal_set_eps_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint32_t eps_limit_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
 class TableGet_Request final :
     public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.TableGet_Request) */ {
  public:
@@ -1668,7 +1927,7 @@ class TableGet_Request final :
                &_TableGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
   friend void swap(TableGet_Request& a, TableGet_Request& b) {
     a.Swap(&b);
@@ -1787,7 +2046,7 @@ class TableGet_Response final :
                &_TableGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
   friend void swap(TableGet_Response& a, TableGet_Response& b) {
     a.Swap(&b);
@@ -1976,7 +2235,7 @@ class QueuePost_Request final :
                &_QueuePost_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    11;
 
   friend void swap(QueuePost_Request& a, QueuePost_Request& b) {
     a.Swap(&b);
@@ -2081,24 +2340,24 @@ class QueuePost_Request final :
 };
 // -------------------------------------------------------------------
 
-class EpsUpdate_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsUpdate_Request) */ {
+class QueuePostBulk_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.QueuePostBulk_Request) */ {
  public:
-  inline EpsUpdate_Request() : EpsUpdate_Request(nullptr) {}
-  ~EpsUpdate_Request() override;
-  explicit PROTOBUF_CONSTEXPR EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QueuePostBulk_Request() : QueuePostBulk_Request(nullptr) {}
+  ~QueuePostBulk_Request() override;
+  explicit PROTOBUF_CONSTEXPR QueuePostBulk_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EpsUpdate_Request(const EpsUpdate_Request& from);
-  EpsUpdate_Request(EpsUpdate_Request&& from) noexcept
-    : EpsUpdate_Request() {
+  QueuePostBulk_Request(const QueuePostBulk_Request& from);
+  QueuePostBulk_Request(QueuePostBulk_Request&& from) noexcept
+    : QueuePostBulk_Request() {
     *this = ::std::move(from);
   }
 
-  inline EpsUpdate_Request& operator=(const EpsUpdate_Request& from) {
+  inline QueuePostBulk_Request& operator=(const QueuePostBulk_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EpsUpdate_Request& operator=(EpsUpdate_Request&& from) noexcept {
+  inline QueuePostBulk_Request& operator=(QueuePostBulk_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2121,20 +2380,20 @@ class EpsUpdate_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const EpsUpdate_Request& default_instance() {
+  static const QueuePostBulk_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const EpsUpdate_Request* internal_default_instance() {
-    return reinterpret_cast<const EpsUpdate_Request*>(
-               &_EpsUpdate_Request_default_instance_);
+  static inline const QueuePostBulk_Request* internal_default_instance() {
+    return reinterpret_cast<const QueuePostBulk_Request*>(
+               &_QueuePostBulk_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    12;
 
-  friend void swap(EpsUpdate_Request& a, EpsUpdate_Request& b) {
+  friend void swap(QueuePostBulk_Request& a, QueuePostBulk_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(EpsUpdate_Request* other) {
+  inline void Swap(QueuePostBulk_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2147,7 +2406,7 @@ class EpsUpdate_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(EpsUpdate_Request* other) {
+  void UnsafeArenaSwap(QueuePostBulk_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2155,14 +2414,14 @@ class EpsUpdate_Request final :
 
   // implements Message ----------------------------------------------
 
-  EpsUpdate_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<EpsUpdate_Request>(arena);
+  QueuePostBulk_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueuePostBulk_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const EpsUpdate_Request& from);
+  void CopyFrom(const QueuePostBulk_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const EpsUpdate_Request& from) {
-    EpsUpdate_Request::MergeImpl(*this, from);
+  void MergeFrom( const QueuePostBulk_Request& from) {
+    QueuePostBulk_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2180,15 +2439,15 @@ class EpsUpdate_Request final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(EpsUpdate_Request* other);
+  void InternalSwap(QueuePostBulk_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.router.EpsUpdate_Request";
+    return "com.wazuh.api.engine.router.QueuePostBulk_Request";
   }
   protected:
-  explicit EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QueuePostBulk_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2202,28 +2461,33 @@ class EpsUpdate_Request final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kEpsFieldNumber = 1,
-    kRefreshIntervalFieldNumber = 2,
+    kWazuhEventsFieldNumber = 1,
   };
-  // uint32 eps = 1;
-  void clear_eps();
-  uint32_t eps() const;
-  void set_eps(uint32_t value);
+  // repeated string wazuh_events = 1;
+  int wazuh_events_size() const;
   private:
-  uint32_t _internal_eps() const;
-  void _internal_set_eps(uint32_t value);
+  int _internal_wazuh_events_size() const;
   public:
-
-  // uint32 refresh_interval = 2;
-  void clear_refresh_interval();
-  uint32_t refresh_interval() const;
-  void set_refresh_interval(uint32_t value);
+  void clear_wazuh_events();
+  const std::string& wazuh_events(int index) const;
+  std::string* mutable_wazuh_events(int index);
+  void set_wazuh_events(int index, const std::string& value);
+  void set_wazuh_events(int index, std::string&& value);
+  void set_wazuh_events(int index, const char* value);
+  void set_wazuh_events(int index, const char* value, size_t size);
+  std::string* add_wazuh_events();
+  void add_wazuh_events(const std::string& value);
+  void add_wazuh_events(std::string&& value);
+  void add_wazuh_events(const char* value);
+  void add_wazuh_events(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& wazuh_events() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_wazuh_events();
   private:
-  uint32_t _internal_refresh_interval() const;
-  void _internal_set_refresh_interval(uint32_t value);
+  const std::string& _internal_wazuh_events(int index) const;
+  std::string* _internal_add_wazuh_events();
   public:
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsUpdate_Request)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.QueuePostBulk_Request)
  private:
   class _Internal;
 
@@ -2231,8 +2495,7 @@ class EpsUpdate_Request final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    uint32_t eps_;
-    uint32_t refresh_interval_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> wazuh_events_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -2240,23 +2503,24 @@ class EpsUpdate_Request final :
 };
 // -------------------------------------------------------------------
 
-class EpsGet_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsGet_Request) */ {
+class QueuePostBulk_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.QueuePostBulk_Response) */ {
  public:
-  inline EpsGet_Request() : EpsGet_Request(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR EpsGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline QueuePostBulk_Response() : QueuePostBulk_Response(nullptr) {}
+  ~QueuePostBulk_Response() override;
+  explicit PROTOBUF_CONSTEXPR QueuePostBulk_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EpsGet_Request(const EpsGet_Request& from);
-  EpsGet_Request(EpsGet_Request&& from) noexcept
-    : EpsGet_Request() {
+  QueuePostBulk_Response(const QueuePostBulk_Response& from);
+  QueuePostBulk_Response(QueuePostBulk_Response&& from) noexcept
+    : QueuePostBulk_Response() {
     *this = ::std::move(from);
   }
 
-  inline EpsGet_Request& operator=(const EpsGet_Request& from) {
+  inline QueuePostBulk_Response& operator=(const QueuePostBulk_Response& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EpsGet_Request& operator=(EpsGet_Request&& from) noexcept {
+  inline QueuePostBulk_Response& operator=(QueuePostBulk_Response&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2279,20 +2543,20 @@ class EpsGet_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const EpsGet_Request& default_instance() {
+  static const QueuePostBulk_Response& default_instance() {
     return *internal_default_instance();
   }
-  static inline const EpsGet_Request* internal_default_instance() {
-    return reinterpret_cast<const EpsGet_Request*>(
-               &_EpsGet_Request_default_instance_);
+  static inline const QueuePostBulk_Response* internal_default_instance() {
+    return reinterpret_cast<const QueuePostBulk_Response*>(
+               &_QueuePostBulk_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    12;
+    13;
 
-  friend void swap(EpsGet_Request& a, EpsGet_Request& b) {
+  friend void swap(QueuePostBulk_Response& a, QueuePostBulk_Response& b) {
     a.Swap(&b);
   }
-  inline void Swap(EpsGet_Request* other) {
+  inline void Swap(QueuePostBulk_Response* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2305,7 +2569,7 @@ class EpsGet_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(EpsGet_Request* other) {
+  void UnsafeArenaSwap(QueuePostBulk_Response* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2313,26 +2577,40 @@ class EpsGet_Request final :
 
   // implements Message ----------------------------------------------
 
-  EpsGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<EpsGet_Request>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const EpsGet_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  QueuePostBulk_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<QueuePostBulk_Response>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const EpsGet_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const QueuePostBulk_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const QueuePostBulk_Response& from) {
+    QueuePostBulk_Response::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(QueuePostBulk_Response* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.router.EpsGet_Request";
+    return "com.wazuh.api.engine.router.QueuePostBulk_Response";
   }
   protected:
-  explicit EpsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit QueuePostBulk_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2345,37 +2623,95 @@ class EpsGet_Request final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsGet_Request)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  struct Impl_ {
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kAcceptedFieldNumber = 3,
+    kDiscardedFieldNumber = 4,
   };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // uint32 accepted = 3;
+  void clear_accepted();
+  uint32_t accepted() const;
+  void set_accepted(uint32_t value);
+  private:
+  uint32_t _internal_accepted() const;
+  void _internal_set_accepted(uint32_t value);
+  public:
+
+  // uint32 discarded = 4;
+  void clear_discarded();
+  uint32_t discarded() const;
+  void set_discarded(uint32_t value);
+  private:
+  uint32_t _internal_discarded() const;
+  void _internal_set_discarded(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.QueuePostBulk_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    uint32_t accepted_;
+    uint32_t discarded_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EpsGet_Response final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsGet_Response) */ {
+class EpsUpdate_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsUpdate_Request) */ {
  public:
-  inline EpsGet_Response() : EpsGet_Response(nullptr) {}
-  ~EpsGet_Response() override;
-  explicit PROTOBUF_CONSTEXPR EpsGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline EpsUpdate_Request() : EpsUpdate_Request(nullptr) {}
+  ~EpsUpdate_Request() override;
+  explicit PROTOBUF_CONSTEXPR EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EpsGet_Response(const EpsGet_Response& from);
-  EpsGet_Response(EpsGet_Response&& from) noexcept
-    : EpsGet_Response() {
+  EpsUpdate_Request(const EpsUpdate_Request& from);
+  EpsUpdate_Request(EpsUpdate_Request&& from) noexcept
+    : EpsUpdate_Request() {
     *this = ::std::move(from);
   }
 
-  inline EpsGet_Response& operator=(const EpsGet_Response& from) {
+  inline EpsUpdate_Request& operator=(const EpsUpdate_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EpsGet_Response& operator=(EpsGet_Response&& from) noexcept {
+  inline EpsUpdate_Request& operator=(EpsUpdate_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2398,20 +2734,20 @@ class EpsGet_Response final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const EpsGet_Response& default_instance() {
+  static const EpsUpdate_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const EpsGet_Response* internal_default_instance() {
-    return reinterpret_cast<const EpsGet_Response*>(
-               &_EpsGet_Response_default_instance_);
+  static inline const EpsUpdate_Request* internal_default_instance() {
+    return reinterpret_cast<const EpsUpdate_Request*>(
+               &_EpsUpdate_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    13;
+    14;
 
-  friend void swap(EpsGet_Response& a, EpsGet_Response& b) {
+  friend void swap(EpsUpdate_Request& a, EpsUpdate_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(EpsGet_Response* other) {
+  inline void Swap(EpsUpdate_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2424,7 +2760,7 @@ class EpsGet_Response final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(EpsGet_Response* other) {
+  void UnsafeArenaSwap(EpsUpdate_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2432,14 +2768,14 @@ class EpsGet_Response final :
 
   // implements Message ----------------------------------------------
 
-  EpsGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<EpsGet_Response>(arena);
+  EpsUpdate_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpsUpdate_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const EpsGet_Response& from);
+  void CopyFrom(const EpsUpdate_Request& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const EpsGet_Response& from) {
-    EpsGet_Response::MergeImpl(*this, from);
+  void MergeFrom( const EpsUpdate_Request& from) {
+    EpsUpdate_Request::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -2457,15 +2793,15 @@ class EpsGet_Response final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(EpsGet_Response* other);
+  void InternalSwap(EpsUpdate_Request* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.router.EpsGet_Response";
+    return "com.wazuh.api.engine.router.EpsUpdate_Request";
   }
   protected:
-  explicit EpsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit EpsUpdate_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2479,40 +2815,10 @@ class EpsGet_Response final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kErrorFieldNumber = 2,
-    kStatusFieldNumber = 1,
-    kEpsFieldNumber = 3,
-    kRefreshIntervalFieldNumber = 4,
-    kEnabledFieldNumber = 5,
+    kEpsFieldNumber = 1,
+    kRefreshIntervalFieldNumber = 2,
   };
-  // optional string error = 2;
-  bool has_error() const;
-  private:
-  bool _internal_has_error() const;
-  public:
-  void clear_error();
-  const std::string& error() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_error(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_error();
-  PROTOBUF_NODISCARD std::string* release_error();
-  void set_allocated_error(std::string* error);
-  private:
-  const std::string& _internal_error() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
-  std::string* _internal_mutable_error();
-  public:
-
-  // .com.wazuh.api.engine.ReturnStatus status = 1;
-  void clear_status();
-  ::com::wazuh::api::engine::ReturnStatus status() const;
-  void set_status(::com::wazuh::api::engine::ReturnStatus value);
-  private:
-  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
-  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
-  public:
-
-  // uint32 eps = 3;
+  // uint32 eps = 1;
   void clear_eps();
   uint32_t eps() const;
   void set_eps(uint32_t value);
@@ -2521,7 +2827,7 @@ class EpsGet_Response final :
   void _internal_set_eps(uint32_t value);
   public:
 
-  // uint32 refresh_interval = 4;
+  // uint32 refresh_interval = 2;
   void clear_refresh_interval();
   uint32_t refresh_interval() const;
   void set_refresh_interval(uint32_t value);
@@ -2530,16 +2836,7 @@ class EpsGet_Response final :
   void _internal_set_refresh_interval(uint32_t value);
   public:
 
-  // bool enabled = 5;
-  void clear_enabled();
-  bool enabled() const;
-  void set_enabled(bool value);
-  private:
-  bool _internal_enabled() const;
-  void _internal_set_enabled(bool value);
-  public:
-
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsGet_Response)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsUpdate_Request)
  private:
   class _Internal;
 
@@ -2547,36 +2844,32 @@ class EpsGet_Response final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
-    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
-    int status_;
     uint32_t eps_;
     uint32_t refresh_interval_;
-    bool enabled_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EpsEnable_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsEnable_Request) */ {
+class EpsGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsGet_Request) */ {
  public:
-  inline EpsEnable_Request() : EpsEnable_Request(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline EpsGet_Request() : EpsGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR EpsGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EpsEnable_Request(const EpsEnable_Request& from);
-  EpsEnable_Request(EpsEnable_Request&& from) noexcept
-    : EpsEnable_Request() {
+  EpsGet_Request(const EpsGet_Request& from);
+  EpsGet_Request(EpsGet_Request&& from) noexcept
+    : EpsGet_Request() {
     *this = ::std::move(from);
   }
 
-  inline EpsEnable_Request& operator=(const EpsEnable_Request& from) {
+  inline EpsGet_Request& operator=(const EpsGet_Request& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EpsEnable_Request& operator=(EpsEnable_Request&& from) noexcept {
+  inline EpsGet_Request& operator=(EpsGet_Request&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2599,20 +2892,20 @@ class EpsEnable_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const EpsEnable_Request& default_instance() {
+  static const EpsGet_Request& default_instance() {
     return *internal_default_instance();
   }
-  static inline const EpsEnable_Request* internal_default_instance() {
-    return reinterpret_cast<const EpsEnable_Request*>(
-               &_EpsEnable_Request_default_instance_);
+  static inline const EpsGet_Request* internal_default_instance() {
+    return reinterpret_cast<const EpsGet_Request*>(
+               &_EpsGet_Request_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    14;
+    15;
 
-  friend void swap(EpsEnable_Request& a, EpsEnable_Request& b) {
+  friend void swap(EpsGet_Request& a, EpsGet_Request& b) {
     a.Swap(&b);
   }
-  inline void Swap(EpsEnable_Request* other) {
+  inline void Swap(EpsGet_Request* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2625,7 +2918,7 @@ class EpsEnable_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(EpsEnable_Request* other) {
+  void UnsafeArenaSwap(EpsGet_Request* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2633,15 +2926,15 @@ class EpsEnable_Request final :
 
   // implements Message ----------------------------------------------
 
-  EpsEnable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<EpsEnable_Request>(arena);
+  EpsGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpsGet_Request>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const EpsEnable_Request& from) {
+  inline void CopyFrom(const EpsGet_Request& from) {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
   }
   using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const EpsEnable_Request& from) {
+  void MergeFrom(const EpsGet_Request& from) {
     ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
   }
   public:
@@ -2649,10 +2942,10 @@ class EpsEnable_Request final :
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.router.EpsEnable_Request";
+    return "com.wazuh.api.engine.router.EpsGet_Request";
   }
   protected:
-  explicit EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit EpsGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2665,7 +2958,7 @@ class EpsEnable_Request final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsEnable_Request)
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsGet_Request)
  private:
   class _Internal;
 
@@ -2678,23 +2971,24 @@ class EpsEnable_Request final :
 };
 // -------------------------------------------------------------------
 
-class EpsDisable_Request final :
-    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsDisable_Request) */ {
+class EpsGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsGet_Response) */ {
  public:
-  inline EpsDisable_Request() : EpsDisable_Request(nullptr) {}
-  explicit PROTOBUF_CONSTEXPR EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline EpsGet_Response() : EpsGet_Response(nullptr) {}
+  ~EpsGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR EpsGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  EpsDisable_Request(const EpsDisable_Request& from);
-  EpsDisable_Request(EpsDisable_Request&& from) noexcept
-    : EpsDisable_Request() {
+  EpsGet_Response(const EpsGet_Response& from);
+  EpsGet_Response(EpsGet_Response&& from) noexcept
+    : EpsGet_Response() {
     *this = ::std::move(from);
   }
 
-  inline EpsDisable_Request& operator=(const EpsDisable_Request& from) {
+  inline EpsGet_Response& operator=(const EpsGet_Response& from) {
     CopyFrom(from);
     return *this;
   }
-  inline EpsDisable_Request& operator=(EpsDisable_Request&& from) noexcept {
+  inline EpsGet_Response& operator=(EpsGet_Response&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -2717,20 +3011,20 @@ class EpsDisable_Request final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const EpsDisable_Request& default_instance() {
+  static const EpsGet_Response& default_instance() {
     return *internal_default_instance();
   }
-  static inline const EpsDisable_Request* internal_default_instance() {
-    return reinterpret_cast<const EpsDisable_Request*>(
-               &_EpsDisable_Request_default_instance_);
+  static inline const EpsGet_Response* internal_default_instance() {
+    return reinterpret_cast<const EpsGet_Response*>(
+               &_EpsGet_Response_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    15;
+    16;
 
-  friend void swap(EpsDisable_Request& a, EpsDisable_Request& b) {
+  friend void swap(EpsGet_Response& a, EpsGet_Response& b) {
     a.Swap(&b);
   }
-  inline void Swap(EpsDisable_Request* other) {
+  inline void Swap(EpsGet_Response* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -2743,7 +3037,7 @@ class EpsDisable_Request final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(EpsDisable_Request* other) {
+  void UnsafeArenaSwap(EpsGet_Response* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -2751,26 +3045,40 @@ class EpsDisable_Request final :
 
   // implements Message ----------------------------------------------
 
-  EpsDisable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<EpsDisable_Request>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
-  inline void CopyFrom(const EpsDisable_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  EpsGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpsGet_Response>(arena);
   }
-  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
-  void MergeFrom(const EpsDisable_Request& from) {
-    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const EpsGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const EpsGet_Response& from) {
+    EpsGet_Response::MergeImpl(*this, from);
   }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
   public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-  private:
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(EpsGet_Response* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "com.wazuh.api.engine.router.EpsDisable_Request";
+    return "com.wazuh.api.engine.router.EpsGet_Response";
   }
   protected:
-  explicit EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit EpsGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -2783,7 +3091,68 @@ class EpsDisable_Request final :
 
   // accessors -------------------------------------------------------
 
-  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsDisable_Request)
+  enum : int {
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+    kEpsFieldNumber = 3,
+    kRefreshIntervalFieldNumber = 4,
+    kEnabledFieldNumber = 5,
+  };
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // uint32 eps = 3;
+  void clear_eps();
+  uint32_t eps() const;
+  void set_eps(uint32_t value);
+  private:
+  uint32_t _internal_eps() const;
+  void _internal_set_eps(uint32_t value);
+  public:
+
+  // uint32 refresh_interval = 4;
+  void clear_refresh_interval();
+  uint32_t refresh_interval() const;
+  void set_refresh_interval(uint32_t value);
+  private:
+  uint32_t _internal_refresh_interval() const;
+  void _internal_set_refresh_interval(uint32_t value);
+  public:
+
+  // bool enabled = 5;
+  void clear_enabled();
+  bool enabled() const;
+  void set_enabled(bool value);
+  private:
+  bool _internal_enabled() const;
+  void _internal_set_enabled(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsGet_Response)
  private:
   class _Internal;
 
@@ -2791,56 +3160,1430 @@ class EpsDisable_Request final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+    uint32_t eps_;
+    uint32_t refresh_interval_;
+    bool enabled_;
   };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_router_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
+
+class EpsEnable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsEnable_Request) */ {
+ public:
+  inline EpsEnable_Request() : EpsEnable_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpsEnable_Request(const EpsEnable_Request& from);
+  EpsEnable_Request(EpsEnable_Request&& from) noexcept
+    : EpsEnable_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline EpsEnable_Request& operator=(const EpsEnable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpsEnable_Request& operator=(EpsEnable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpsEnable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpsEnable_Request* internal_default_instance() {
+    return reinterpret_cast<const EpsEnable_Request*>(
+               &_EpsEnable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(EpsEnable_Request& a, EpsEnable_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpsEnable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpsEnable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpsEnable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpsEnable_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const EpsEnable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const EpsEnable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.EpsEnable_Request";
+  }
+  protected:
+  explicit EpsEnable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
 
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsEnable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpsDisable_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.EpsDisable_Request) */ {
+ public:
+  inline EpsDisable_Request() : EpsDisable_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EpsDisable_Request(const EpsDisable_Request& from);
+  EpsDisable_Request(EpsDisable_Request&& from) noexcept
+    : EpsDisable_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline EpsDisable_Request& operator=(const EpsDisable_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EpsDisable_Request& operator=(EpsDisable_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const EpsDisable_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EpsDisable_Request* internal_default_instance() {
+    return reinterpret_cast<const EpsDisable_Request*>(
+               &_EpsDisable_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(EpsDisable_Request& a, EpsDisable_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EpsDisable_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EpsDisable_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EpsDisable_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EpsDisable_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const EpsDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const EpsDisable_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.EpsDisable_Request";
+  }
+  protected:
+  explicit EpsDisable_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.EpsDisable_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IngressRule final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.IngressRule) */ {
+ public:
+  inline IngressRule() : IngressRule(nullptr) {}
+  ~IngressRule() override;
+  explicit PROTOBUF_CONSTEXPR IngressRule(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IngressRule(const IngressRule& from);
+  IngressRule(IngressRule&& from) noexcept
+    : IngressRule() {
+    *this = ::std::move(from);
+  }
+
+  inline IngressRule& operator=(const IngressRule& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IngressRule& operator=(IngressRule&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IngressRule& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IngressRule* internal_default_instance() {
+    return reinterpret_cast<const IngressRule*>(
+               &_IngressRule_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(IngressRule& a, IngressRule& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IngressRule* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IngressRule* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IngressRule* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IngressRule>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IngressRule& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IngressRule& from) {
+    IngressRule::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IngressRule* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.IngressRule";
+  }
+  protected:
+  explicit IngressRule(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContainsFieldNumber = 5,
+    kNameFieldNumber = 1,
+    kQueueFieldNumber = 3,
+    kLocationPrefixFieldNumber = 4,
+    kHitsFieldNumber = 6,
+    kActionFieldNumber = 2,
+  };
+  // repeated string contains = 5;
+  int contains_size() const;
+  private:
+  int _internal_contains_size() const;
+  public:
+  void clear_contains();
+  const std::string& contains(int index) const;
+  std::string* mutable_contains(int index);
+  void set_contains(int index, const std::string& value);
+  void set_contains(int index, std::string&& value);
+  void set_contains(int index, const char* value);
+  void set_contains(int index, const char* value, size_t size);
+  std::string* add_contains();
+  void add_contains(const std::string& value);
+  void add_contains(std::string&& value);
+  void add_contains(const char* value);
+  void add_contains(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& contains() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_contains();
+  private:
+  const std::string& _internal_contains(int index) const;
+  std::string* _internal_add_contains();
+  public:
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // optional string queue = 3;
+  bool has_queue() const;
+  private:
+  bool _internal_has_queue() const;
+  public:
+  void clear_queue();
+  const std::string& queue() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_queue(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_queue();
+  PROTOBUF_NODISCARD std::string* release_queue();
+  void set_allocated_queue(std::string* queue);
+  private:
+  const std::string& _internal_queue() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_queue(const std::string& value);
+  std::string* _internal_mutable_queue();
+  public:
+
+  // optional string location_prefix = 4;
+  bool has_location_prefix() const;
+  private:
+  bool _internal_has_location_prefix() const;
+  public:
+  void clear_location_prefix();
+  const std::string& location_prefix() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_location_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_location_prefix();
+  PROTOBUF_NODISCARD std::string* release_location_prefix();
+  void set_allocated_location_prefix(std::string* location_prefix);
+  private:
+  const std::string& _internal_location_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_location_prefix(const std::string& value);
+  std::string* _internal_mutable_location_prefix();
+  public:
+
+  // uint64 hits = 6;
+  void clear_hits();
+  uint64_t hits() const;
+  void set_hits(uint64_t value);
+  private:
+  uint64_t _internal_hits() const;
+  void _internal_set_hits(uint64_t value);
+  public:
+
+  // .com.wazuh.api.engine.router.IngressAction action = 2;
+  void clear_action();
+  ::com::wazuh::api::engine::router::IngressAction action() const;
+  void set_action(::com::wazuh::api::engine::router::IngressAction value);
+  private:
+  ::com::wazuh::api::engine::router::IngressAction _internal_action() const;
+  void _internal_set_action(::com::wazuh::api::engine::router::IngressAction value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.IngressRule)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> contains_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr queue_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr location_prefix_;
+    uint64_t hits_;
+    int action_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IngressPost_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.IngressPost_Request) */ {
+ public:
+  inline IngressPost_Request() : IngressPost_Request(nullptr) {}
+  ~IngressPost_Request() override;
+  explicit PROTOBUF_CONSTEXPR IngressPost_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IngressPost_Request(const IngressPost_Request& from);
+  IngressPost_Request(IngressPost_Request&& from) noexcept
+    : IngressPost_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline IngressPost_Request& operator=(const IngressPost_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IngressPost_Request& operator=(IngressPost_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IngressPost_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IngressPost_Request* internal_default_instance() {
+    return reinterpret_cast<const IngressPost_Request*>(
+               &_IngressPost_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(IngressPost_Request& a, IngressPost_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IngressPost_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IngressPost_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IngressPost_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IngressPost_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IngressPost_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IngressPost_Request& from) {
+    IngressPost_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IngressPost_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.IngressPost_Request";
+  }
+  protected:
+  explicit IngressPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRuleFieldNumber = 1,
+  };
+  // optional .com.wazuh.api.engine.router.IngressRule rule = 1;
+  bool has_rule() const;
+  private:
+  bool _internal_has_rule() const;
+  public:
+  void clear_rule();
+  const ::com::wazuh::api::engine::router::IngressRule& rule() const;
+  PROTOBUF_NODISCARD ::com::wazuh::api::engine::router::IngressRule* release_rule();
+  ::com::wazuh::api::engine::router::IngressRule* mutable_rule();
+  void set_allocated_rule(::com::wazuh::api::engine::router::IngressRule* rule);
+  private:
+  const ::com::wazuh::api::engine::router::IngressRule& _internal_rule() const;
+  ::com::wazuh::api::engine::router::IngressRule* _internal_mutable_rule();
+  public:
+  void unsafe_arena_set_allocated_rule(
+      ::com::wazuh::api::engine::router::IngressRule* rule);
+  ::com::wazuh::api::engine::router::IngressRule* unsafe_arena_release_rule();
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.IngressPost_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::com::wazuh::api::engine::router::IngressRule* rule_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IngressDelete_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.IngressDelete_Request) */ {
+ public:
+  inline IngressDelete_Request() : IngressDelete_Request(nullptr) {}
+  ~IngressDelete_Request() override;
+  explicit PROTOBUF_CONSTEXPR IngressDelete_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IngressDelete_Request(const IngressDelete_Request& from);
+  IngressDelete_Request(IngressDelete_Request&& from) noexcept
+    : IngressDelete_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline IngressDelete_Request& operator=(const IngressDelete_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IngressDelete_Request& operator=(IngressDelete_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IngressDelete_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IngressDelete_Request* internal_default_instance() {
+    return reinterpret_cast<const IngressDelete_Request*>(
+               &_IngressDelete_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(IngressDelete_Request& a, IngressDelete_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IngressDelete_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IngressDelete_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IngressDelete_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IngressDelete_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IngressDelete_Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IngressDelete_Request& from) {
+    IngressDelete_Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IngressDelete_Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.IngressDelete_Request";
+  }
+  protected:
+  explicit IngressDelete_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.IngressDelete_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IngressGet_Request final :
+    public ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.IngressGet_Request) */ {
+ public:
+  inline IngressGet_Request() : IngressGet_Request(nullptr) {}
+  explicit PROTOBUF_CONSTEXPR IngressGet_Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IngressGet_Request(const IngressGet_Request& from);
+  IngressGet_Request(IngressGet_Request&& from) noexcept
+    : IngressGet_Request() {
+    *this = ::std::move(from);
+  }
+
+  inline IngressGet_Request& operator=(const IngressGet_Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IngressGet_Request& operator=(IngressGet_Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IngressGet_Request& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IngressGet_Request* internal_default_instance() {
+    return reinterpret_cast<const IngressGet_Request*>(
+               &_IngressGet_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(IngressGet_Request& a, IngressGet_Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IngressGet_Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IngressGet_Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IngressGet_Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IngressGet_Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyFrom;
+  inline void CopyFrom(const IngressGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::CopyImpl(*this, from);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeFrom;
+  void MergeFrom(const IngressGet_Request& from) {
+    ::PROTOBUF_NAMESPACE_ID::internal::ZeroFieldsBase::MergeImpl(*this, from);
+  }
+  public:
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.IngressGet_Request";
+  }
+  protected:
+  explicit IngressGet_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.IngressGet_Request)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+  };
+  friend struct ::TableStruct_router_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IngressGet_Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:com.wazuh.api.engine.router.IngressGet_Response) */ {
+ public:
+  inline IngressGet_Response() : IngressGet_Response(nullptr) {}
+  ~IngressGet_Response() override;
+  explicit PROTOBUF_CONSTEXPR IngressGet_Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IngressGet_Response(const IngressGet_Response& from);
+  IngressGet_Response(IngressGet_Response&& from) noexcept
+    : IngressGet_Response() {
+    *this = ::std::move(from);
+  }
+
+  inline IngressGet_Response& operator=(const IngressGet_Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IngressGet_Response& operator=(IngressGet_Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IngressGet_Response& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IngressGet_Response* internal_default_instance() {
+    return reinterpret_cast<const IngressGet_Response*>(
+               &_IngressGet_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(IngressGet_Response& a, IngressGet_Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IngressGet_Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IngressGet_Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IngressGet_Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IngressGet_Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IngressGet_Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IngressGet_Response& from) {
+    IngressGet_Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IngressGet_Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "com.wazuh.api.engine.router.IngressGet_Response";
+  }
+  protected:
+  explicit IngressGet_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRulesFieldNumber = 3,
+    kErrorFieldNumber = 2,
+    kStatusFieldNumber = 1,
+  };
+  // repeated .com.wazuh.api.engine.router.IngressRule rules = 3;
+  int rules_size() const;
+  private:
+  int _internal_rules_size() const;
+  public:
+  void clear_rules();
+  ::com::wazuh::api::engine::router::IngressRule* mutable_rules(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::IngressRule >*
+      mutable_rules();
+  private:
+  const ::com::wazuh::api::engine::router::IngressRule& _internal_rules(int index) const;
+  ::com::wazuh::api::engine::router::IngressRule* _internal_add_rules();
+  public:
+  const ::com::wazuh::api::engine::router::IngressRule& rules(int index) const;
+  ::com::wazuh::api::engine::router::IngressRule* add_rules();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::IngressRule >&
+      rules() const;
+
+  // optional string error = 2;
+  bool has_error() const;
+  private:
+  bool _internal_has_error() const;
+  public:
+  void clear_error();
+  const std::string& error() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_error(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_error();
+  PROTOBUF_NODISCARD std::string* release_error();
+  void set_allocated_error(std::string* error);
+  private:
+  const std::string& _internal_error() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_error(const std::string& value);
+  std::string* _internal_mutable_error();
+  public:
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  void clear_status();
+  ::com::wazuh::api::engine::ReturnStatus status() const;
+  void set_status(::com::wazuh::api::engine::ReturnStatus value);
+  private:
+  ::com::wazuh::api::engine::ReturnStatus _internal_status() const;
+  void _internal_set_status(::com::wazuh::api::engine::ReturnStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:com.wazuh.api.engine.router.IngressGet_Response)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::IngressRule > rules_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr error_;
+    int status_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_router_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EntryPost
+
+// string name = 1;
+inline void EntryPost::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& EntryPost::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
+}
+inline std::string* EntryPost::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void EntryPost::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
+  return _impl_.name_.Release();
+}
+inline void EntryPost::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
+}
+
+// string policy = 2;
+inline void EntryPost::clear_policy() {
+  _impl_.policy_.ClearToEmpty();
+}
+inline const std::string& EntryPost::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
+  return _internal_policy();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
+}
+inline std::string* EntryPost::mutable_policy() {
+  std::string* _s = _internal_mutable_policy();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_policy() const {
+  return _impl_.policy_.Get();
+}
+inline void EntryPost::_internal_set_policy(const std::string& value) {
+  
+  _impl_.policy_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_policy() {
+  
+  return _impl_.policy_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
+  return _impl_.policy_.Release();
+}
+inline void EntryPost::set_allocated_policy(std::string* policy) {
+  if (policy != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.policy_.IsDefault()) {
+    _impl_.policy_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
+}
+
+// string filter = 3;
+inline void EntryPost::clear_filter() {
+  _impl_.filter_.ClearToEmpty();
+}
+inline const std::string& EntryPost::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
+  return _internal_filter();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
+}
+inline std::string* EntryPost::mutable_filter() {
+  std::string* _s = _internal_mutable_filter();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_filter() const {
+  return _impl_.filter_.Get();
+}
+inline void EntryPost::_internal_set_filter(const std::string& value) {
+  
+  _impl_.filter_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_filter() {
+  
+  return _impl_.filter_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
+  return _impl_.filter_.Release();
+}
+inline void EntryPost::set_allocated_filter(std::string* filter) {
+  if (filter != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.filter_.IsDefault()) {
+    _impl_.filter_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
+}
+
+// uint32 priority = 4;
+inline void EntryPost::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t EntryPost::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t EntryPost::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
+  return _internal_priority();
+}
+inline void EntryPost::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void EntryPost::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
+}
+
+// optional string description = 5;
+inline bool EntryPost::_internal_has_description() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EntryPost::has_description() const {
+  return _internal_has_description();
+}
+inline void EntryPost::clear_description() {
+  _impl_.description_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EntryPost::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
+  return _internal_description();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
+}
+inline std::string* EntryPost::mutable_description() {
+  std::string* _s = _internal_mutable_description();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  return _s;
+}
+inline const std::string& EntryPost::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void EntryPost::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EntryPost::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EntryPost::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EntryPost::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+}
+
+// optional uint32 eps_limit = 6;
+inline bool EntryPost::_internal_has_eps_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EntryPost::has_eps_limit() const {
+  return _internal_has_eps_limit();
+}
+inline void EntryPost::clear_eps_limit() {
+  _impl_.eps_limit_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t EntryPost::_internal_eps_limit() const {
+  return _impl_.eps_limit_;
+}
+inline uint32_t EntryPost::eps_limit() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.eps_limit)
+  return _internal_eps_limit();
+}
+inline void EntryPost::_internal_set_eps_limit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.eps_limit_ = value;
+}
+inline void EntryPost::set_eps_limit(uint32_t value) {
+  _internal_set_eps_limit(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.eps_limit)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// EntryPost
+// Entry
 
 // string name = 1;
-inline void EntryPost::clear_name() {
+inline void Entry::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& EntryPost::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.name)
+inline const std::string& Entry::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_name(ArgT0&& arg0, ArgT... args) {
+void Entry::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
 }
-inline std::string* EntryPost::mutable_name() {
+inline std::string* Entry::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
   return _s;
 }
-inline const std::string& EntryPost::_internal_name() const {
+inline const std::string& Entry::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void EntryPost::_internal_set_name(const std::string& value) {
+inline void Entry::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EntryPost::_internal_mutable_name() {
+inline std::string* Entry::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EntryPost::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.name)
+inline std::string* Entry::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
   return _impl_.name_.Release();
 }
-inline void EntryPost::set_allocated_name(std::string* name) {
+inline void Entry::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -2852,45 +4595,45 @@ inline void EntryPost::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
 }
 
 // string policy = 2;
-inline void EntryPost::clear_policy() {
+inline void Entry::clear_policy() {
   _impl_.policy_.ClearToEmpty();
 }
-inline const std::string& EntryPost::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.policy)
+inline const std::string& Entry::policy() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
   return _internal_policy();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_policy(ArgT0&& arg0, ArgT... args) {
+void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
  
  _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.policy)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
 }
-inline std::string* EntryPost::mutable_policy() {
+inline std::string* Entry::mutable_policy() {
   std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.policy)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
   return _s;
 }
-inline const std::string& EntryPost::_internal_policy() const {
+inline const std::string& Entry::_internal_policy() const {
   return _impl_.policy_.Get();
 }
-inline void EntryPost::_internal_set_policy(const std::string& value) {
+inline void Entry::_internal_set_policy(const std::string& value) {
   
   _impl_.policy_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EntryPost::_internal_mutable_policy() {
+inline std::string* Entry::_internal_mutable_policy() {
   
   return _impl_.policy_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EntryPost::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.policy)
+inline std::string* Entry::release_policy() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
   return _impl_.policy_.Release();
 }
-inline void EntryPost::set_allocated_policy(std::string* policy) {
+inline void Entry::set_allocated_policy(std::string* policy) {
   if (policy != nullptr) {
     
   } else {
@@ -2902,45 +4645,45 @@ inline void EntryPost::set_allocated_policy(std::string* policy) {
     _impl_.policy_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.policy)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
 }
 
 // string filter = 3;
-inline void EntryPost::clear_filter() {
+inline void Entry::clear_filter() {
   _impl_.filter_.ClearToEmpty();
 }
-inline const std::string& EntryPost::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.filter)
+inline const std::string& Entry::filter() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
   return _internal_filter();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_filter(ArgT0&& arg0, ArgT... args) {
+void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
  
  _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.filter)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
 }
-inline std::string* EntryPost::mutable_filter() {
+inline std::string* Entry::mutable_filter() {
   std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.filter)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
   return _s;
 }
-inline const std::string& EntryPost::_internal_filter() const {
+inline const std::string& Entry::_internal_filter() const {
   return _impl_.filter_.Get();
 }
-inline void EntryPost::_internal_set_filter(const std::string& value) {
+inline void Entry::_internal_set_filter(const std::string& value) {
   
   _impl_.filter_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EntryPost::_internal_mutable_filter() {
+inline std::string* Entry::_internal_mutable_filter() {
   
   return _impl_.filter_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EntryPost::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.filter)
+inline std::string* Entry::release_filter() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
   return _impl_.filter_.Release();
 }
-inline void EntryPost::set_allocated_filter(std::string* filter) {
+inline void Entry::set_allocated_filter(std::string* filter) {
   if (filter != nullptr) {
     
   } else {
@@ -2952,137 +4695,331 @@ inline void EntryPost::set_allocated_filter(std::string* filter) {
     _impl_.filter_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.filter)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
 }
 
 // uint32 priority = 4;
-inline void EntryPost::clear_priority() {
+inline void Entry::clear_priority() {
   _impl_.priority_ = 0u;
 }
-inline uint32_t EntryPost::_internal_priority() const {
+inline uint32_t Entry::_internal_priority() const {
   return _impl_.priority_;
 }
-inline uint32_t EntryPost::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.priority)
+inline uint32_t Entry::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
   return _internal_priority();
 }
-inline void EntryPost::_internal_set_priority(uint32_t value) {
+inline void Entry::_internal_set_priority(uint32_t value) {
   
   _impl_.priority_ = value;
 }
-inline void EntryPost::set_priority(uint32_t value) {
+inline void Entry::set_priority(uint32_t value) {
   _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.priority)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
 }
 
 // optional string description = 5;
-inline bool EntryPost::_internal_has_description() const {
+inline bool Entry::_internal_has_description() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool EntryPost::has_description() const {
+inline bool Entry::has_description() const {
   return _internal_has_description();
 }
-inline void EntryPost::clear_description() {
+inline void Entry::clear_description() {
   _impl_.description_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EntryPost::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EntryPost.description)
+inline const std::string& Entry::description() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
   return _internal_description();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EntryPost::set_description(ArgT0&& arg0, ArgT... args) {
+void Entry::set_description(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
 }
-inline std::string* EntryPost::mutable_description() {
+inline std::string* Entry::mutable_description() {
   std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EntryPost.description)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
   return _s;
 }
-inline const std::string& EntryPost::_internal_description() const {
-  return _impl_.description_.Get();
+inline const std::string& Entry::_internal_description() const {
+  return _impl_.description_.Get();
+}
+inline void Entry::_internal_set_description(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.description_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Entry::_internal_mutable_description() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.description_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Entry::release_description() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
+  if (!_internal_has_description()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.description_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Entry::set_allocated_description(std::string* description) {
+  if (description != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.description_.IsDefault()) {
+    _impl_.description_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
+}
+
+// .com.wazuh.api.engine.router.Sync policy_sync = 6;
+inline void Entry::clear_policy_sync() {
+  _impl_.policy_sync_ = 0;
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
+  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
+}
+inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
+  return _internal_policy_sync();
+}
+inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  
+  _impl_.policy_sync_ = value;
+}
+inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
+  _internal_set_policy_sync(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
+}
+
+// .com.wazuh.api.engine.router.State entry_status = 7;
+inline void Entry::clear_entry_status() {
+  _impl_.entry_status_ = 0;
+}
+inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
+  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
+}
+inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
+  return _internal_entry_status();
+}
+inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
+  
+  _impl_.entry_status_ = value;
+}
+inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
+  _internal_set_entry_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
+}
+
+// uint32 uptime = 8;
+inline void Entry::clear_uptime() {
+  _impl_.uptime_ = 0u;
+}
+inline uint32_t Entry::_internal_uptime() const {
+  return _impl_.uptime_;
+}
+inline uint32_t Entry::uptime() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
+  return _internal_uptime();
+}
+inline void Entry::_internal_set_uptime(uint32_t value) {
+  
+  _impl_.uptime_ = value;
+}
+inline void Entry::set_uptime(uint32_t value) {
+  _internal_set_uptime(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+}
+
+// uint32 eps_limit = 9;
+inline void Entry::clear_eps_limit() {
+  _impl_.eps_limit_ = 0u;
+}
+inline uint32_t Entry::_internal_eps_limit() const {
+  return _impl_.eps_limit_;
+}
+inline uint32_t Entry::eps_limit() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.eps_limit)
+  return _internal_eps_limit();
+}
+inline void Entry::_internal_set_eps_limit(uint32_t value) {
+  
+  _impl_.eps_limit_ = value;
+}
+inline void Entry::set_eps_limit(uint32_t value) {
+  _internal_set_eps_limit(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.eps_limit)
+}
+
+// uint64 throttled = 10;
+inline void Entry::clear_throttled() {
+  _impl_.throttled_ = uint64_t{0u};
+}
+inline uint64_t Entry::_internal_throttled() const {
+  return _impl_.throttled_;
+}
+inline uint64_t Entry::throttled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.throttled)
+  return _internal_throttled();
+}
+inline void Entry::_internal_set_throttled(uint64_t value) {
+  
+  _impl_.throttled_ = value;
+}
+inline void Entry::set_throttled(uint64_t value) {
+  _internal_set_throttled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.throttled)
+}
+
+// -------------------------------------------------------------------
+
+// RoutePost_Request
+
+// optional .com.wazuh.api.engine.router.EntryPost route = 1;
+inline bool RoutePost_Request::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
+  return value;
+}
+inline bool RoutePost_Request::has_route() const {
+  return _internal_has_route();
+}
+inline void RoutePost_Request::clear_route() {
+  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
+  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
+      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
 }
-inline void EntryPost::_internal_set_description(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.description_.Set(value, GetArenaForAllocation());
+inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _internal_route();
 }
-inline std::string* EntryPost::_internal_mutable_description() {
-  _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.description_.Mutable(GetArenaForAllocation());
+inline void RoutePost_Request::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::EntryPost* route) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
+  }
+  _impl_.route_ = route;
+  if (route) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
 }
-inline std::string* EntryPost::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EntryPost.description)
-  if (!_internal_has_description()) {
-    return nullptr;
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.description_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+  _impl_.route_ = nullptr;
+  return temp;
+}
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.route_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
+    _impl_.route_ = p;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+  return _impl_.route_;
 }
-inline void EntryPost::set_allocated_description(std::string* description) {
-  if (description != nullptr) {
+inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
+  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
+  return _msg;
+}
+inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.route_;
+  }
+  if (route) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
+    if (message_arena != submessage_arena) {
+      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, route, submessage_arena);
+    }
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EntryPost.description)
+  _impl_.route_ = route;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
 }
 
 // -------------------------------------------------------------------
 
-// Entry
+// RouteDelete_Request
 
 // string name = 1;
-inline void Entry::clear_name() {
+inline void RouteDelete_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Entry::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.name)
+inline const std::string& RouteDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_name(ArgT0&& arg0, ArgT... args) {
+void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
 }
-inline std::string* Entry::mutable_name() {
+inline std::string* RouteDelete_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_name() const {
+inline const std::string& RouteDelete_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_name(const std::string& value) {
+inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_name() {
+inline std::string* RouteDelete_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.name)
+inline std::string* RouteDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
   return _impl_.name_.Release();
 }
-inline void Entry::set_allocated_name(std::string* name) {
+inline void RouteDelete_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3094,299 +5031,193 @@ inline void Entry::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
 }
 
-// string policy = 2;
-inline void Entry::clear_policy() {
-  _impl_.policy_.ClearToEmpty();
-}
-inline const std::string& Entry::policy() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy)
-  return _internal_policy();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_policy(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.policy_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy)
-}
-inline std::string* Entry::mutable_policy() {
-  std::string* _s = _internal_mutable_policy();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.policy)
-  return _s;
-}
-inline const std::string& Entry::_internal_policy() const {
-  return _impl_.policy_.Get();
-}
-inline void Entry::_internal_set_policy(const std::string& value) {
-  
-  _impl_.policy_.Set(value, GetArenaForAllocation());
-}
-inline std::string* Entry::_internal_mutable_policy() {
-  
-  return _impl_.policy_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Entry::release_policy() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.policy)
-  return _impl_.policy_.Release();
-}
-inline void Entry::set_allocated_policy(std::string* policy) {
-  if (policy != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.policy_.SetAllocated(policy, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.policy_.IsDefault()) {
-    _impl_.policy_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.policy)
-}
+// -------------------------------------------------------------------
 
-// string filter = 3;
-inline void Entry::clear_filter() {
-  _impl_.filter_.ClearToEmpty();
+// RouteGet_Request
+
+// string name = 1;
+inline void RouteGet_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline const std::string& Entry::filter() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.filter)
-  return _internal_filter();
+inline const std::string& RouteGet_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_filter(ArgT0&& arg0, ArgT... args) {
+void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
- _impl_.filter_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.filter)
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
 }
-inline std::string* Entry::mutable_filter() {
-  std::string* _s = _internal_mutable_filter();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.filter)
+inline std::string* RouteGet_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
   return _s;
 }
-inline const std::string& Entry::_internal_filter() const {
-  return _impl_.filter_.Get();
+inline const std::string& RouteGet_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline void Entry::_internal_set_filter(const std::string& value) {
+inline void RouteGet_Request::_internal_set_name(const std::string& value) {
   
-  _impl_.filter_.Set(value, GetArenaForAllocation());
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_filter() {
+inline std::string* RouteGet_Request::_internal_mutable_name() {
   
-  return _impl_.filter_.Mutable(GetArenaForAllocation());
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_filter() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.filter)
-  return _impl_.filter_.Release();
+inline std::string* RouteGet_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
+  return _impl_.name_.Release();
 }
-inline void Entry::set_allocated_filter(std::string* filter) {
-  if (filter != nullptr) {
+inline void RouteGet_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
     
   } else {
     
   }
-  _impl_.filter_.SetAllocated(filter, GetArenaForAllocation());
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.filter_.IsDefault()) {
-    _impl_.filter_.Set("", GetArenaForAllocation());
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.filter)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
 }
 
-// uint32 priority = 4;
-inline void Entry::clear_priority() {
-  _impl_.priority_ = 0u;
+// -------------------------------------------------------------------
+
+// RouteGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void RouteGet_Response::clear_status() {
+  _impl_.status_ = 0;
 }
-inline uint32_t Entry::_internal_priority() const {
-  return _impl_.priority_;
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline uint32_t Entry::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.priority)
-  return _internal_priority();
+inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+  return _internal_status();
 }
-inline void Entry::_internal_set_priority(uint32_t value) {
+inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
-  _impl_.priority_ = value;
-}
-inline void Entry::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.priority)
+  _impl_.status_ = value;
+}
+inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
 }
 
-// optional string description = 5;
-inline bool Entry::_internal_has_description() const {
+// optional string error = 2;
+inline bool RouteGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Entry::has_description() const {
-  return _internal_has_description();
+inline bool RouteGet_Response::has_error() const {
+  return _internal_has_error();
 }
-inline void Entry::clear_description() {
-  _impl_.description_.ClearToEmpty();
+inline void RouteGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Entry::description() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.description)
-  return _internal_description();
+inline const std::string& RouteGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+  return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Entry::set_description(ArgT0&& arg0, ArgT... args) {
+void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.description_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.description)
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
 }
-inline std::string* Entry::mutable_description() {
-  std::string* _s = _internal_mutable_description();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.Entry.description)
+inline std::string* RouteGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
   return _s;
 }
-inline const std::string& Entry::_internal_description() const {
-  return _impl_.description_.Get();
+inline const std::string& RouteGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
 }
-inline void Entry::_internal_set_description(const std::string& value) {
+inline void RouteGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.description_.Set(value, GetArenaForAllocation());
+  _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Entry::_internal_mutable_description() {
+inline std::string* RouteGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.description_.Mutable(GetArenaForAllocation());
+  return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Entry::release_description() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.Entry.description)
-  if (!_internal_has_description()) {
+inline std::string* RouteGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+  if (!_internal_has_error()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.description_.Release();
+  auto* p = _impl_.error_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Entry::set_allocated_description(std::string* description) {
-  if (description != nullptr) {
+inline void RouteGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.description_.SetAllocated(description, GetArenaForAllocation());
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.description_.IsDefault()) {
-    _impl_.description_.Set("", GetArenaForAllocation());
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.Entry.description)
-}
-
-// .com.wazuh.api.engine.router.Sync policy_sync = 6;
-inline void Entry::clear_policy_sync() {
-  _impl_.policy_sync_ = 0;
-}
-inline ::com::wazuh::api::engine::router::Sync Entry::_internal_policy_sync() const {
-  return static_cast< ::com::wazuh::api::engine::router::Sync >(_impl_.policy_sync_);
-}
-inline ::com::wazuh::api::engine::router::Sync Entry::policy_sync() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.policy_sync)
-  return _internal_policy_sync();
-}
-inline void Entry::_internal_set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
-  
-  _impl_.policy_sync_ = value;
-}
-inline void Entry::set_policy_sync(::com::wazuh::api::engine::router::Sync value) {
-  _internal_set_policy_sync(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.policy_sync)
-}
-
-// .com.wazuh.api.engine.router.State entry_status = 7;
-inline void Entry::clear_entry_status() {
-  _impl_.entry_status_ = 0;
-}
-inline ::com::wazuh::api::engine::router::State Entry::_internal_entry_status() const {
-  return static_cast< ::com::wazuh::api::engine::router::State >(_impl_.entry_status_);
-}
-inline ::com::wazuh::api::engine::router::State Entry::entry_status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.entry_status)
-  return _internal_entry_status();
-}
-inline void Entry::_internal_set_entry_status(::com::wazuh::api::engine::router::State value) {
-  
-  _impl_.entry_status_ = value;
-}
-inline void Entry::set_entry_status(::com::wazuh::api::engine::router::State value) {
-  _internal_set_entry_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.entry_status)
-}
-
-// uint32 uptime = 8;
-inline void Entry::clear_uptime() {
-  _impl_.uptime_ = 0u;
-}
-inline uint32_t Entry::_internal_uptime() const {
-  return _impl_.uptime_;
-}
-inline uint32_t Entry::uptime() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.Entry.uptime)
-  return _internal_uptime();
-}
-inline void Entry::_internal_set_uptime(uint32_t value) {
-  
-  _impl_.uptime_ = value;
-}
-inline void Entry::set_uptime(uint32_t value) {
-  _internal_set_uptime(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.Entry.uptime)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
 }
 
-// -------------------------------------------------------------------
-
-// RoutePost_Request
-
-// optional .com.wazuh.api.engine.router.EntryPost route = 1;
-inline bool RoutePost_Request::_internal_has_route() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+// optional .com.wazuh.api.engine.router.Entry route = 3;
+inline bool RouteGet_Response::_internal_has_route() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
   return value;
 }
-inline bool RoutePost_Request::has_route() const {
+inline bool RouteGet_Response::has_route() const {
   return _internal_has_route();
 }
-inline void RoutePost_Request::clear_route() {
+inline void RouteGet_Response::clear_route() {
   if (_impl_.route_ != nullptr) _impl_.route_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000001u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::_internal_route() const {
-  const ::com::wazuh::api::engine::router::EntryPost* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::EntryPost&>(
-      ::com::wazuh::api::engine::router::_EntryPost_default_instance_);
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
+  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
+      ::com::wazuh::api::engine::router::_Entry_default_instance_);
 }
-inline const ::com::wazuh::api::engine::router::EntryPost& RoutePost_Request::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePost_Request.route)
+inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
   return _internal_route();
 }
-inline void RoutePost_Request::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::EntryPost* route) {
+inline void RouteGet_Response::unsafe_arena_set_allocated_route(
+    ::com::wazuh::api::engine::router::Entry* route) {
   if (GetArenaForAllocation() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
   }
   _impl_.route_ = route;
   if (route) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
   _impl_.route_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
   auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
@@ -3399,27 +5230,27 @@ inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::release_
 #endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePost_Request.route)
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  ::com::wazuh::api::engine::router::EntryPost* temp = _impl_.route_;
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
   _impl_.route_ = nullptr;
   return temp;
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::_internal_mutable_route() {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
+  _impl_._has_bits_[0] |= 0x00000002u;
   if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::EntryPost>(GetArenaForAllocation());
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
     _impl_.route_ = p;
   }
   return _impl_.route_;
 }
-inline ::com::wazuh::api::engine::router::EntryPost* RoutePost_Request::mutable_route() {
-  ::com::wazuh::api::engine::router::EntryPost* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePost_Request.route)
+inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
+  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
   return _msg;
 }
-inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::router::EntryPost* route) {
+inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
     delete _impl_.route_;
@@ -3431,54 +5262,108 @@ inline void RoutePost_Request::set_allocated_route(::com::wazuh::api::engine::ro
       route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, route, submessage_arena);
     }
-    _impl_._has_bits_[0] |= 0x00000001u;
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePost_Request.route)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+}
+
+// -------------------------------------------------------------------
+
+// RouteReload_Request
+
+// string name = 1;
+inline void RouteReload_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& RouteReload_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
+}
+inline std::string* RouteReload_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _s;
+}
+inline const std::string& RouteReload_Request::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void RouteReload_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RouteReload_Request::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RouteReload_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
+  return _impl_.name_.Release();
+}
+inline void RouteReload_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
 }
 
 // -------------------------------------------------------------------
 
-// RouteDelete_Request
+// RoutePatchPriority_Request
 
 // string name = 1;
-inline void RouteDelete_Request::clear_name() {
+inline void RoutePatchPriority_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RouteDelete_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteDelete_Request.name)
+inline const std::string& RoutePatchPriority_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
 }
-inline std::string* RouteDelete_Request::mutable_name() {
+inline std::string* RoutePatchPriority_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _s;
 }
-inline const std::string& RouteDelete_Request::_internal_name() const {
+inline const std::string& RoutePatchPriority_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RouteDelete_Request::_internal_set_name(const std::string& value) {
+inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::_internal_mutable_name() {
+inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteDelete_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteDelete_Request.name)
+inline std::string* RoutePatchPriority_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
   return _impl_.name_.Release();
 }
-inline void RouteDelete_Request::set_allocated_name(std::string* name) {
+inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3490,128 +5375,437 @@ inline void RouteDelete_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteDelete_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+}
+
+// uint32 priority = 2;
+inline void RoutePatchPriority_Request::clear_priority() {
+  _impl_.priority_ = 0u;
+}
+inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
+  return _impl_.priority_;
+}
+inline uint32_t RoutePatchPriority_Request::priority() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+  return _internal_priority();
+}
+inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
+  
+  _impl_.priority_ = value;
+}
+inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
+  _internal_set_priority(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
 }
 
 // -------------------------------------------------------------------
 
-// RouteGet_Request
+// RoutePatchEpsLimit_Request
 
 // string name = 1;
-inline void RouteGet_Request::clear_name() {
+inline void RoutePatchEpsLimit_Request::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RouteGet_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Request.name)
+inline const std::string& RoutePatchEpsLimit_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void RoutePatchEpsLimit_Request::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name)
 }
-inline std::string* RouteGet_Request::mutable_name() {
+inline std::string* RoutePatchEpsLimit_Request::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name)
   return _s;
 }
-inline const std::string& RouteGet_Request::_internal_name() const {
+inline const std::string& RoutePatchEpsLimit_Request::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RouteGet_Request::_internal_set_name(const std::string& value) {
+inline void RoutePatchEpsLimit_Request::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteGet_Request::_internal_mutable_name() {
+inline std::string* RoutePatchEpsLimit_Request::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteGet_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Request.name)
+inline std::string* RoutePatchEpsLimit_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name)
   return _impl_.name_.Release();
 }
-inline void RouteGet_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
+inline void RoutePatchEpsLimit_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.name)
+}
+
+// uint32 eps_limit = 2;
+inline void RoutePatchEpsLimit_Request::clear_eps_limit() {
+  _impl_.eps_limit_ = 0u;
+}
+inline uint32_t RoutePatchEpsLimit_Request::_internal_eps_limit() const {
+  return _impl_.eps_limit_;
+}
+inline uint32_t RoutePatchEpsLimit_Request::eps_limit() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.eps_limit)
+  return _internal_eps_limit();
+}
+inline void RoutePatchEpsLimit_Request::_internal_set_eps_limit(uint32_t value) {
+  
+  _impl_.eps_limit_ = value;
+}
+inline void RoutePatchEpsLimit_Request::set_eps_limit(uint32_t value) {
+  _internal_set_eps_limit(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchEpsLimit_Request.eps_limit)
+}
+
+// -------------------------------------------------------------------
+
+// TableGet_Request
+
+// -------------------------------------------------------------------
+
+// TableGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void TableGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
+  return _internal_status();
+}
+inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool TableGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool TableGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void TableGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& TableGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
+}
+inline std::string* TableGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+  return _s;
+}
+inline const std::string& TableGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void TableGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* TableGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void TableGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+}
+
+// repeated .com.wazuh.api.engine.router.Entry table = 3;
+inline int TableGet_Response::_internal_table_size() const {
+  return _impl_.table_.size();
+}
+inline int TableGet_Response::table_size() const {
+  return _internal_table_size();
+}
+inline void TableGet_Response::clear_table() {
+  _impl_.table_.Clear();
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
+TableGet_Response::mutable_table() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return &_impl_.table_;
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
+  return _impl_.table_.Get(index);
+}
+inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _internal_table(index);
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
+  return _impl_.table_.Add();
+}
+inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
+  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
+TableGet_Response::table() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
+  return _impl_.table_;
+}
+
+// -------------------------------------------------------------------
+
+// QueuePost_Request
+
+// string wazuh_event = 1;
+inline void QueuePost_Request::clear_wazuh_event() {
+  _impl_.wazuh_event_.ClearToEmpty();
+}
+inline const std::string& QueuePost_Request::wazuh_event() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _internal_wazuh_event();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+}
+inline std::string* QueuePost_Request::mutable_wazuh_event() {
+  std::string* _s = _internal_mutable_wazuh_event();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _s;
+}
+inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
+  return _impl_.wazuh_event_.Get();
+}
+inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
+  
+  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
+}
+inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
+  
+  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
+}
+inline std::string* QueuePost_Request::release_wazuh_event() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  return _impl_.wazuh_event_.Release();
+}
+inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
+  if (wazuh_event != nullptr) {
     
   } else {
     
   }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
+  if (_impl_.wazuh_event_.IsDefault()) {
+    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Request.name)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
 }
 
 // -------------------------------------------------------------------
 
-// RouteGet_Response
+// QueuePostBulk_Request
+
+// repeated string wazuh_events = 1;
+inline int QueuePostBulk_Request::_internal_wazuh_events_size() const {
+  return _impl_.wazuh_events_.size();
+}
+inline int QueuePostBulk_Request::wazuh_events_size() const {
+  return _internal_wazuh_events_size();
+}
+inline void QueuePostBulk_Request::clear_wazuh_events() {
+  _impl_.wazuh_events_.Clear();
+}
+inline std::string* QueuePostBulk_Request::add_wazuh_events() {
+  std::string* _s = _internal_add_wazuh_events();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+  return _s;
+}
+inline const std::string& QueuePostBulk_Request::_internal_wazuh_events(int index) const {
+  return _impl_.wazuh_events_.Get(index);
+}
+inline const std::string& QueuePostBulk_Request::wazuh_events(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+  return _internal_wazuh_events(index);
+}
+inline std::string* QueuePostBulk_Request::mutable_wazuh_events(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+  return _impl_.wazuh_events_.Mutable(index);
+}
+inline void QueuePostBulk_Request::set_wazuh_events(int index, const std::string& value) {
+  _impl_.wazuh_events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::set_wazuh_events(int index, std::string&& value) {
+  _impl_.wazuh_events_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::set_wazuh_events(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.wazuh_events_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::set_wazuh_events(int index, const char* value, size_t size) {
+  _impl_.wazuh_events_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline std::string* QueuePostBulk_Request::_internal_add_wazuh_events() {
+  return _impl_.wazuh_events_.Add();
+}
+inline void QueuePostBulk_Request::add_wazuh_events(const std::string& value) {
+  _impl_.wazuh_events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::add_wazuh_events(std::string&& value) {
+  _impl_.wazuh_events_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::add_wazuh_events(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.wazuh_events_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline void QueuePostBulk_Request::add_wazuh_events(const char* value, size_t size) {
+  _impl_.wazuh_events_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+QueuePostBulk_Request::wazuh_events() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+  return _impl_.wazuh_events_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+QueuePostBulk_Request::mutable_wazuh_events() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.QueuePostBulk_Request.wazuh_events)
+  return &_impl_.wazuh_events_;
+}
+
+// -------------------------------------------------------------------
+
+// QueuePostBulk_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void RouteGet_Response::clear_status() {
+inline void QueuePostBulk_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus QueuePostBulk_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus RouteGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus QueuePostBulk_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePostBulk_Response.status)
   return _internal_status();
 }
-inline void RouteGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void QueuePostBulk_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void RouteGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void QueuePostBulk_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Response.status)
 }
 
 // optional string error = 2;
-inline bool RouteGet_Response::_internal_has_error() const {
+inline bool QueuePostBulk_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool RouteGet_Response::has_error() const {
+inline bool QueuePostBulk_Response::has_error() const {
   return _internal_has_error();
 }
-inline void RouteGet_Response::clear_error() {
+inline void QueuePostBulk_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& RouteGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline const std::string& QueuePostBulk_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePostBulk_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RouteGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void QueuePostBulk_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Response.error)
 }
-inline std::string* RouteGet_Response::mutable_error() {
+inline std::string* QueuePostBulk_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePostBulk_Response.error)
   return _s;
 }
-inline const std::string& RouteGet_Response::_internal_error() const {
+inline const std::string& QueuePostBulk_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void RouteGet_Response::_internal_set_error(const std::string& value) {
+inline void QueuePostBulk_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::_internal_mutable_error() {
+inline std::string* QueuePostBulk_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RouteGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.error)
+inline std::string* QueuePostBulk_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePostBulk_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -3624,7 +5818,7 @@ inline std::string* RouteGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void RouteGet_Response::set_allocated_error(std::string* error) {
+inline void QueuePostBulk_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -3636,193 +5830,297 @@ inline void RouteGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePostBulk_Response.error)
 }
 
-// optional .com.wazuh.api.engine.router.Entry route = 3;
-inline bool RouteGet_Response::_internal_has_route() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
-  PROTOBUF_ASSUME(!value || _impl_.route_ != nullptr);
-  return value;
+// uint32 accepted = 3;
+inline void QueuePostBulk_Response::clear_accepted() {
+  _impl_.accepted_ = 0u;
 }
-inline bool RouteGet_Response::has_route() const {
-  return _internal_has_route();
+inline uint32_t QueuePostBulk_Response::_internal_accepted() const {
+  return _impl_.accepted_;
 }
-inline void RouteGet_Response::clear_route() {
-  if (_impl_.route_ != nullptr) _impl_.route_->Clear();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+inline uint32_t QueuePostBulk_Response::accepted() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePostBulk_Response.accepted)
+  return _internal_accepted();
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::_internal_route() const {
-  const ::com::wazuh::api::engine::router::Entry* p = _impl_.route_;
-  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::Entry&>(
-      ::com::wazuh::api::engine::router::_Entry_default_instance_);
+inline void QueuePostBulk_Response::_internal_set_accepted(uint32_t value) {
+  
+  _impl_.accepted_ = value;
 }
-inline const ::com::wazuh::api::engine::router::Entry& RouteGet_Response::route() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _internal_route();
+inline void QueuePostBulk_Response::set_accepted(uint32_t value) {
+  _internal_set_accepted(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Response.accepted)
 }
-inline void RouteGet_Response::unsafe_arena_set_allocated_route(
-    ::com::wazuh::api::engine::router::Entry* route) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.route_);
-  }
-  _impl_.route_ = route;
-  if (route) {
-    _impl_._has_bits_[0] |= 0x00000002u;
-  } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+
+// uint32 discarded = 4;
+inline void QueuePostBulk_Response::clear_discarded() {
+  _impl_.discarded_ = 0u;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::release_route() {
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline uint32_t QueuePostBulk_Response::_internal_discarded() const {
+  return _impl_.discarded_;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::unsafe_arena_release_route() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteGet_Response.route)
-  _impl_._has_bits_[0] &= ~0x00000002u;
-  ::com::wazuh::api::engine::router::Entry* temp = _impl_.route_;
-  _impl_.route_ = nullptr;
-  return temp;
+inline uint32_t QueuePostBulk_Response::discarded() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePostBulk_Response.discarded)
+  return _internal_discarded();
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::_internal_mutable_route() {
-  _impl_._has_bits_[0] |= 0x00000002u;
-  if (_impl_.route_ == nullptr) {
-    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::Entry>(GetArenaForAllocation());
-    _impl_.route_ = p;
-  }
-  return _impl_.route_;
+inline void QueuePostBulk_Response::_internal_set_discarded(uint32_t value) {
+  
+  _impl_.discarded_ = value;
 }
-inline ::com::wazuh::api::engine::router::Entry* RouteGet_Response::mutable_route() {
-  ::com::wazuh::api::engine::router::Entry* _msg = _internal_mutable_route();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteGet_Response.route)
-  return _msg;
+inline void QueuePostBulk_Response::set_discarded(uint32_t value) {
+  _internal_set_discarded(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePostBulk_Response.discarded)
 }
-inline void RouteGet_Response::set_allocated_route(::com::wazuh::api::engine::router::Entry* route) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete _impl_.route_;
+
+// -------------------------------------------------------------------
+
+// EpsUpdate_Request
+
+// uint32 eps = 1;
+inline void EpsUpdate_Request::clear_eps() {
+  _impl_.eps_ = 0u;
+}
+inline uint32_t EpsUpdate_Request::_internal_eps() const {
+  return _impl_.eps_;
+}
+inline uint32_t EpsUpdate_Request::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+  return _internal_eps();
+}
+inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
+  
+  _impl_.eps_ = value;
+}
+inline void EpsUpdate_Request::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+}
+
+// uint32 refresh_interval = 2;
+inline void EpsUpdate_Request::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
+}
+inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
+}
+inline uint32_t EpsUpdate_Request::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+  return _internal_refresh_interval();
+}
+inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+  
+  _impl_.refresh_interval_ = value;
+}
+inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+}
+
+// -------------------------------------------------------------------
+
+// EpsGet_Request
+
+// -------------------------------------------------------------------
+
+// EpsGet_Response
+
+// .com.wazuh.api.engine.ReturnStatus status = 1;
+inline void EpsGet_Response::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
+  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+}
+inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
+  return _internal_status();
+}
+inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
+}
+
+// optional string error = 2;
+inline bool EpsGet_Response::_internal_has_error() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EpsGet_Response::has_error() const {
+  return _internal_has_error();
+}
+inline void EpsGet_Response::clear_error() {
+  _impl_.error_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EpsGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
+  return _internal_error();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
+}
+inline std::string* EpsGet_Response::mutable_error() {
+  std::string* _s = _internal_mutable_error();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
+  return _s;
+}
+inline const std::string& EpsGet_Response::_internal_error() const {
+  return _impl_.error_.Get();
+}
+inline void EpsGet_Response::_internal_set_error(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.error_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EpsGet_Response::_internal_mutable_error() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.error_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EpsGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
+  if (!_internal_has_error()) {
+    return nullptr;
   }
-  if (route) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(route);
-    if (message_arena != submessage_arena) {
-      route = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, route, submessage_arena);
-    }
-    _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.error_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EpsGet_Response::set_allocated_error(std::string* error) {
+  if (error != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.route_ = route;
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteGet_Response.route)
+  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.error_.IsDefault()) {
+    _impl_.error_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
 }
 
-// -------------------------------------------------------------------
-
-// RouteReload_Request
-
-// string name = 1;
-inline void RouteReload_Request::clear_name() {
-  _impl_.name_.ClearToEmpty();
+// uint32 eps = 3;
+inline void EpsGet_Response::clear_eps() {
+  _impl_.eps_ = 0u;
 }
-inline const std::string& RouteReload_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _internal_name();
+inline uint32_t EpsGet_Response::_internal_eps() const {
+  return _impl_.eps_;
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void RouteReload_Request::set_name(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RouteReload_Request.name)
+inline uint32_t EpsGet_Response::eps() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
+  return _internal_eps();
 }
-inline std::string* RouteReload_Request::mutable_name() {
-  std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _s;
+inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
+  
+  _impl_.eps_ = value;
 }
-inline const std::string& RouteReload_Request::_internal_name() const {
-  return _impl_.name_.Get();
+inline void EpsGet_Response::set_eps(uint32_t value) {
+  _internal_set_eps(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
 }
-inline void RouteReload_Request::_internal_set_name(const std::string& value) {
-  
-  _impl_.name_.Set(value, GetArenaForAllocation());
+
+// uint32 refresh_interval = 4;
+inline void EpsGet_Response::clear_refresh_interval() {
+  _impl_.refresh_interval_ = 0u;
 }
-inline std::string* RouteReload_Request::_internal_mutable_name() {
+inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
+  return _impl_.refresh_interval_;
+}
+inline uint32_t EpsGet_Response::refresh_interval() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+  return _internal_refresh_interval();
+}
+inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
   
-  return _impl_.name_.Mutable(GetArenaForAllocation());
+  _impl_.refresh_interval_ = value;
 }
-inline std::string* RouteReload_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RouteReload_Request.name)
-  return _impl_.name_.Release();
+inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
+  _internal_set_refresh_interval(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
 }
-inline void RouteReload_Request::set_allocated_name(std::string* name) {
-  if (name != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.name_.IsDefault()) {
-    _impl_.name_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RouteReload_Request.name)
+
+// bool enabled = 5;
+inline void EpsGet_Response::clear_enabled() {
+  _impl_.enabled_ = false;
+}
+inline bool EpsGet_Response::_internal_enabled() const {
+  return _impl_.enabled_;
+}
+inline bool EpsGet_Response::enabled() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
+  return _internal_enabled();
+}
+inline void EpsGet_Response::_internal_set_enabled(bool value) {
+  
+  _impl_.enabled_ = value;
+}
+inline void EpsGet_Response::set_enabled(bool value) {
+  _internal_set_enabled(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
 }
 
 // -------------------------------------------------------------------
 
-// RoutePatchPriority_Request
+// EpsEnable_Request
+
+// -------------------------------------------------------------------
+
+// EpsDisable_Request
+
+// -------------------------------------------------------------------
+
+// IngressRule
 
 // string name = 1;
-inline void RoutePatchPriority_Request::clear_name() {
+inline void IngressRule::clear_name() {
   _impl_.name_.ClearToEmpty();
 }
-inline const std::string& RoutePatchPriority_Request::name() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+inline const std::string& IngressRule::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.name)
   return _internal_name();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void RoutePatchPriority_Request::set_name(ArgT0&& arg0, ArgT... args) {
+void IngressRule::set_name(ArgT0&& arg0, ArgT... args) {
  
  _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.name)
 }
-inline std::string* RoutePatchPriority_Request::mutable_name() {
+inline std::string* IngressRule::mutable_name() {
   std::string* _s = _internal_mutable_name();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressRule.name)
   return _s;
 }
-inline const std::string& RoutePatchPriority_Request::_internal_name() const {
+inline const std::string& IngressRule::_internal_name() const {
   return _impl_.name_.Get();
 }
-inline void RoutePatchPriority_Request::_internal_set_name(const std::string& value) {
+inline void IngressRule::_internal_set_name(const std::string& value) {
   
   _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline std::string* RoutePatchPriority_Request::_internal_mutable_name() {
+inline std::string* IngressRule::_internal_mutable_name() {
   
   return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline std::string* RoutePatchPriority_Request::release_name() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
+inline std::string* IngressRule::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressRule.name)
   return _impl_.name_.Release();
 }
-inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
+inline void IngressRule::set_allocated_name(std::string* name) {
   if (name != nullptr) {
     
   } else {
@@ -3834,332 +6132,477 @@ inline void RoutePatchPriority_Request::set_allocated_name(std::string* name) {
     _impl_.name_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.RoutePatchPriority_Request.name)
-}
-
-// uint32 priority = 2;
-inline void RoutePatchPriority_Request::clear_priority() {
-  _impl_.priority_ = 0u;
-}
-inline uint32_t RoutePatchPriority_Request::_internal_priority() const {
-  return _impl_.priority_;
-}
-inline uint32_t RoutePatchPriority_Request::priority() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
-  return _internal_priority();
-}
-inline void RoutePatchPriority_Request::_internal_set_priority(uint32_t value) {
-  
-  _impl_.priority_ = value;
-}
-inline void RoutePatchPriority_Request::set_priority(uint32_t value) {
-  _internal_set_priority(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.RoutePatchPriority_Request.priority)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressRule.name)
 }
 
-// -------------------------------------------------------------------
-
-// TableGet_Request
-
-// -------------------------------------------------------------------
-
-// TableGet_Response
-
-// .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void TableGet_Response::clear_status() {
-  _impl_.status_ = 0;
+// .com.wazuh.api.engine.router.IngressAction action = 2;
+inline void IngressRule::clear_action() {
+  _impl_.action_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::_internal_status() const {
-  return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
+inline ::com::wazuh::api::engine::router::IngressAction IngressRule::_internal_action() const {
+  return static_cast< ::com::wazuh::api::engine::router::IngressAction >(_impl_.action_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus TableGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.status)
-  return _internal_status();
+inline ::com::wazuh::api::engine::router::IngressAction IngressRule::action() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.action)
+  return _internal_action();
 }
-inline void TableGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void IngressRule::_internal_set_action(::com::wazuh::api::engine::router::IngressAction value) {
   
-  _impl_.status_ = value;
+  _impl_.action_ = value;
 }
-inline void TableGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
-  _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.status)
+inline void IngressRule::set_action(::com::wazuh::api::engine::router::IngressAction value) {
+  _internal_set_action(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.action)
 }
 
-// optional string error = 2;
-inline bool TableGet_Response::_internal_has_error() const {
+// optional string queue = 3;
+inline bool IngressRule::_internal_has_queue() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool TableGet_Response::has_error() const {
-  return _internal_has_error();
+inline bool IngressRule::has_queue() const {
+  return _internal_has_queue();
 }
-inline void TableGet_Response::clear_error() {
-  _impl_.error_.ClearToEmpty();
+inline void IngressRule::clear_queue() {
+  _impl_.queue_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& TableGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.error)
-  return _internal_error();
+inline const std::string& IngressRule::queue() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.queue)
+  return _internal_queue();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void TableGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void IngressRule::set_queue(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.TableGet_Response.error)
+ _impl_.queue_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.queue)
 }
-inline std::string* TableGet_Response::mutable_error() {
-  std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.error)
+inline std::string* IngressRule::mutable_queue() {
+  std::string* _s = _internal_mutable_queue();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressRule.queue)
   return _s;
 }
-inline const std::string& TableGet_Response::_internal_error() const {
-  return _impl_.error_.Get();
+inline const std::string& IngressRule::_internal_queue() const {
+  return _impl_.queue_.Get();
 }
-inline void TableGet_Response::_internal_set_error(const std::string& value) {
+inline void IngressRule::_internal_set_queue(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.error_.Set(value, GetArenaForAllocation());
+  _impl_.queue_.Set(value, GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::_internal_mutable_error() {
+inline std::string* IngressRule::_internal_mutable_queue() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.error_.Mutable(GetArenaForAllocation());
+  return _impl_.queue_.Mutable(GetArenaForAllocation());
 }
-inline std::string* TableGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.TableGet_Response.error)
-  if (!_internal_has_error()) {
+inline std::string* IngressRule::release_queue() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressRule.queue)
+  if (!_internal_has_queue()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.error_.Release();
+  auto* p = _impl_.queue_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void TableGet_Response::set_allocated_error(std::string* error) {
-  if (error != nullptr) {
+inline void IngressRule::set_allocated_queue(std::string* queue) {
+  if (queue != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.error_.SetAllocated(error, GetArenaForAllocation());
+  _impl_.queue_.SetAllocated(queue, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.error_.IsDefault()) {
-    _impl_.error_.Set("", GetArenaForAllocation());
+  if (_impl_.queue_.IsDefault()) {
+    _impl_.queue_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.TableGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressRule.queue)
+}
+
+// optional string location_prefix = 4;
+inline bool IngressRule::_internal_has_location_prefix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool IngressRule::has_location_prefix() const {
+  return _internal_has_location_prefix();
+}
+inline void IngressRule::clear_location_prefix() {
+  _impl_.location_prefix_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& IngressRule::location_prefix() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.location_prefix)
+  return _internal_location_prefix();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IngressRule::set_location_prefix(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.location_prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.location_prefix)
+}
+inline std::string* IngressRule::mutable_location_prefix() {
+  std::string* _s = _internal_mutable_location_prefix();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressRule.location_prefix)
+  return _s;
+}
+inline const std::string& IngressRule::_internal_location_prefix() const {
+  return _impl_.location_prefix_.Get();
+}
+inline void IngressRule::_internal_set_location_prefix(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.location_prefix_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IngressRule::_internal_mutable_location_prefix() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.location_prefix_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IngressRule::release_location_prefix() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressRule.location_prefix)
+  if (!_internal_has_location_prefix()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.location_prefix_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.location_prefix_.IsDefault()) {
+    _impl_.location_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void IngressRule::set_allocated_location_prefix(std::string* location_prefix) {
+  if (location_prefix != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.location_prefix_.SetAllocated(location_prefix, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.location_prefix_.IsDefault()) {
+    _impl_.location_prefix_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressRule.location_prefix)
+}
+
+// repeated string contains = 5;
+inline int IngressRule::_internal_contains_size() const {
+  return _impl_.contains_.size();
+}
+inline int IngressRule::contains_size() const {
+  return _internal_contains_size();
+}
+inline void IngressRule::clear_contains() {
+  _impl_.contains_.Clear();
+}
+inline std::string* IngressRule::add_contains() {
+  std::string* _s = _internal_add_contains();
+  // @@protoc_insertion_point(field_add_mutable:com.wazuh.api.engine.router.IngressRule.contains)
+  return _s;
+}
+inline const std::string& IngressRule::_internal_contains(int index) const {
+  return _impl_.contains_.Get(index);
+}
+inline const std::string& IngressRule::contains(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.contains)
+  return _internal_contains(index);
+}
+inline std::string* IngressRule::mutable_contains(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressRule.contains)
+  return _impl_.contains_.Mutable(index);
+}
+inline void IngressRule::set_contains(int index, const std::string& value) {
+  _impl_.contains_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.contains)
+}
+inline void IngressRule::set_contains(int index, std::string&& value) {
+  _impl_.contains_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.contains)
+}
+inline void IngressRule::set_contains(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contains_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:com.wazuh.api.engine.router.IngressRule.contains)
+}
+inline void IngressRule::set_contains(int index, const char* value, size_t size) {
+  _impl_.contains_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:com.wazuh.api.engine.router.IngressRule.contains)
+}
+inline std::string* IngressRule::_internal_add_contains() {
+  return _impl_.contains_.Add();
+}
+inline void IngressRule::add_contains(const std::string& value) {
+  _impl_.contains_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.IngressRule.contains)
 }
-
-// repeated .com.wazuh.api.engine.router.Entry table = 3;
-inline int TableGet_Response::_internal_table_size() const {
-  return _impl_.table_.size();
+inline void IngressRule::add_contains(std::string&& value) {
+  _impl_.contains_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.IngressRule.contains)
 }
-inline int TableGet_Response::table_size() const {
-  return _internal_table_size();
+inline void IngressRule::add_contains(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.contains_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:com.wazuh.api.engine.router.IngressRule.contains)
 }
-inline void TableGet_Response::clear_table() {
-  _impl_.table_.Clear();
+inline void IngressRule::add_contains(const char* value, size_t size) {
+  _impl_.contains_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:com.wazuh.api.engine.router.IngressRule.contains)
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::mutable_table(int index) {
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_.Mutable(index);
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+IngressRule::contains() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.IngressRule.contains)
+  return _impl_.contains_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >*
-TableGet_Response::mutable_table() {
-  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return &_impl_.table_;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+IngressRule::mutable_contains() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.IngressRule.contains)
+  return &_impl_.contains_;
 }
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::_internal_table(int index) const {
-  return _impl_.table_.Get(index);
+
+// uint64 hits = 6;
+inline void IngressRule::clear_hits() {
+  _impl_.hits_ = uint64_t{0u};
 }
-inline const ::com::wazuh::api::engine::router::Entry& TableGet_Response::table(int index) const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _internal_table(index);
+inline uint64_t IngressRule::_internal_hits() const {
+  return _impl_.hits_;
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::_internal_add_table() {
-  return _impl_.table_.Add();
+inline uint64_t IngressRule::hits() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressRule.hits)
+  return _internal_hits();
 }
-inline ::com::wazuh::api::engine::router::Entry* TableGet_Response::add_table() {
-  ::com::wazuh::api::engine::router::Entry* _add = _internal_add_table();
-  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _add;
+inline void IngressRule::_internal_set_hits(uint64_t value) {
+  
+  _impl_.hits_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::Entry >&
-TableGet_Response::table() const {
-  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.TableGet_Response.table)
-  return _impl_.table_;
+inline void IngressRule::set_hits(uint64_t value) {
+  _internal_set_hits(value);
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressRule.hits)
 }
 
 // -------------------------------------------------------------------
 
-// QueuePost_Request
+// IngressPost_Request
 
-// string wazuh_event = 1;
-inline void QueuePost_Request::clear_wazuh_event() {
-  _impl_.wazuh_event_.ClearToEmpty();
+// optional .com.wazuh.api.engine.router.IngressRule rule = 1;
+inline bool IngressPost_Request::_internal_has_rule() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.rule_ != nullptr);
+  return value;
 }
-inline const std::string& QueuePost_Request::wazuh_event() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _internal_wazuh_event();
+inline bool IngressPost_Request::has_rule() const {
+  return _internal_has_rule();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void QueuePost_Request::set_wazuh_event(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.wazuh_event_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+inline void IngressPost_Request::clear_rule() {
+  if (_impl_.rule_ != nullptr) _impl_.rule_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline std::string* QueuePost_Request::mutable_wazuh_event() {
-  std::string* _s = _internal_mutable_wazuh_event();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _s;
+inline const ::com::wazuh::api::engine::router::IngressRule& IngressPost_Request::_internal_rule() const {
+  const ::com::wazuh::api::engine::router::IngressRule* p = _impl_.rule_;
+  return p != nullptr ? *p : reinterpret_cast<const ::com::wazuh::api::engine::router::IngressRule&>(
+      ::com::wazuh::api::engine::router::_IngressRule_default_instance_);
 }
-inline const std::string& QueuePost_Request::_internal_wazuh_event() const {
-  return _impl_.wazuh_event_.Get();
+inline const ::com::wazuh::api::engine::router::IngressRule& IngressPost_Request::rule() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressPost_Request.rule)
+  return _internal_rule();
 }
-inline void QueuePost_Request::_internal_set_wazuh_event(const std::string& value) {
-  
-  _impl_.wazuh_event_.Set(value, GetArenaForAllocation());
+inline void IngressPost_Request::unsafe_arena_set_allocated_rule(
+    ::com::wazuh::api::engine::router::IngressRule* rule) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rule_);
+  }
+  _impl_.rule_ = rule;
+  if (rule) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:com.wazuh.api.engine.router.IngressPost_Request.rule)
 }
-inline std::string* QueuePost_Request::_internal_mutable_wazuh_event() {
-  
-  return _impl_.wazuh_event_.Mutable(GetArenaForAllocation());
+inline ::com::wazuh::api::engine::router::IngressRule* IngressPost_Request::release_rule() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::IngressRule* temp = _impl_.rule_;
+  _impl_.rule_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* QueuePost_Request::release_wazuh_event() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
-  return _impl_.wazuh_event_.Release();
+inline ::com::wazuh::api::engine::router::IngressRule* IngressPost_Request::unsafe_arena_release_rule() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressPost_Request.rule)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::com::wazuh::api::engine::router::IngressRule* temp = _impl_.rule_;
+  _impl_.rule_ = nullptr;
+  return temp;
 }
-inline void QueuePost_Request::set_allocated_wazuh_event(std::string* wazuh_event) {
-  if (wazuh_event != nullptr) {
-    
-  } else {
-    
+inline ::com::wazuh::api::engine::router::IngressRule* IngressPost_Request::_internal_mutable_rule() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.rule_ == nullptr) {
+    auto* p = CreateMaybeMessage<::com::wazuh::api::engine::router::IngressRule>(GetArenaForAllocation());
+    _impl_.rule_ = p;
   }
-  _impl_.wazuh_event_.SetAllocated(wazuh_event, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.wazuh_event_.IsDefault()) {
-    _impl_.wazuh_event_.Set("", GetArenaForAllocation());
+  return _impl_.rule_;
+}
+inline ::com::wazuh::api::engine::router::IngressRule* IngressPost_Request::mutable_rule() {
+  ::com::wazuh::api::engine::router::IngressRule* _msg = _internal_mutable_rule();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressPost_Request.rule)
+  return _msg;
+}
+inline void IngressPost_Request::set_allocated_rule(::com::wazuh::api::engine::router::IngressRule* rule) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rule_;
   }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.QueuePost_Request.wazuh_event)
+  if (rule) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rule);
+    if (message_arena != submessage_arena) {
+      rule = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rule, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.rule_ = rule;
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressPost_Request.rule)
 }
 
 // -------------------------------------------------------------------
 
-// EpsUpdate_Request
+// IngressDelete_Request
 
-// uint32 eps = 1;
-inline void EpsUpdate_Request::clear_eps() {
-  _impl_.eps_ = 0u;
-}
-inline uint32_t EpsUpdate_Request::_internal_eps() const {
-  return _impl_.eps_;
-}
-inline uint32_t EpsUpdate_Request::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
-  return _internal_eps();
+// string name = 1;
+inline void IngressDelete_Request::clear_name() {
+  _impl_.name_.ClearToEmpty();
 }
-inline void EpsUpdate_Request::_internal_set_eps(uint32_t value) {
-  
-  _impl_.eps_ = value;
+inline const std::string& IngressDelete_Request::name() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressDelete_Request.name)
+  return _internal_name();
 }
-inline void EpsUpdate_Request::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.eps)
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IngressDelete_Request::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressDelete_Request.name)
 }
-
-// uint32 refresh_interval = 2;
-inline void EpsUpdate_Request::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+inline std::string* IngressDelete_Request::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressDelete_Request.name)
+  return _s;
 }
-inline uint32_t EpsUpdate_Request::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline const std::string& IngressDelete_Request::_internal_name() const {
+  return _impl_.name_.Get();
 }
-inline uint32_t EpsUpdate_Request::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
-  return _internal_refresh_interval();
+inline void IngressDelete_Request::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
 }
-inline void EpsUpdate_Request::_internal_set_refresh_interval(uint32_t value) {
+inline std::string* IngressDelete_Request::_internal_mutable_name() {
   
-  _impl_.refresh_interval_ = value;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
 }
-inline void EpsUpdate_Request::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsUpdate_Request.refresh_interval)
+inline std::string* IngressDelete_Request::release_name() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressDelete_Request.name)
+  return _impl_.name_.Release();
+}
+inline void IngressDelete_Request::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressDelete_Request.name)
 }
 
 // -------------------------------------------------------------------
 
-// EpsGet_Request
+// IngressGet_Request
 
 // -------------------------------------------------------------------
 
-// EpsGet_Response
+// IngressGet_Response
 
 // .com.wazuh.api.engine.ReturnStatus status = 1;
-inline void EpsGet_Response::clear_status() {
+inline void IngressGet_Response::clear_status() {
   _impl_.status_ = 0;
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::_internal_status() const {
+inline ::com::wazuh::api::engine::ReturnStatus IngressGet_Response::_internal_status() const {
   return static_cast< ::com::wazuh::api::engine::ReturnStatus >(_impl_.status_);
 }
-inline ::com::wazuh::api::engine::ReturnStatus EpsGet_Response::status() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.status)
+inline ::com::wazuh::api::engine::ReturnStatus IngressGet_Response::status() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressGet_Response.status)
   return _internal_status();
 }
-inline void EpsGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void IngressGet_Response::_internal_set_status(::com::wazuh::api::engine::ReturnStatus value) {
   
   _impl_.status_ = value;
 }
-inline void EpsGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
+inline void IngressGet_Response::set_status(::com::wazuh::api::engine::ReturnStatus value) {
   _internal_set_status(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.status)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressGet_Response.status)
 }
 
 // optional string error = 2;
-inline bool EpsGet_Response::_internal_has_error() const {
+inline bool IngressGet_Response::_internal_has_error() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool EpsGet_Response::has_error() const {
+inline bool IngressGet_Response::has_error() const {
   return _internal_has_error();
 }
-inline void EpsGet_Response::clear_error() {
+inline void IngressGet_Response::clear_error() {
   _impl_.error_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EpsGet_Response::error() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline const std::string& IngressGet_Response::error() const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressGet_Response.error)
   return _internal_error();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EpsGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
+void IngressGet_Response::set_error(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.error_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.IngressGet_Response.error)
 }
-inline std::string* EpsGet_Response::mutable_error() {
+inline std::string* IngressGet_Response::mutable_error() {
   std::string* _s = _internal_mutable_error();
-  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressGet_Response.error)
   return _s;
 }
-inline const std::string& EpsGet_Response::_internal_error() const {
+inline const std::string& IngressGet_Response::_internal_error() const {
   return _impl_.error_.Get();
 }
-inline void EpsGet_Response::_internal_set_error(const std::string& value) {
+inline void IngressGet_Response::_internal_set_error(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.error_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::_internal_mutable_error() {
+inline std::string* IngressGet_Response::_internal_mutable_error() {
   _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.error_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EpsGet_Response::release_error() {
-  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.EpsGet_Response.error)
+inline std::string* IngressGet_Response::release_error() {
+  // @@protoc_insertion_point(field_release:com.wazuh.api.engine.router.IngressGet_Response.error)
   if (!_internal_has_error()) {
     return nullptr;
   }
@@ -4172,7 +6615,7 @@ inline std::string* EpsGet_Response::release_error() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void EpsGet_Response::set_allocated_error(std::string* error) {
+inline void IngressGet_Response::set_allocated_error(std::string* error) {
   if (error != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
@@ -4184,80 +6627,68 @@ inline void EpsGet_Response::set_allocated_error(std::string* error) {
     _impl_.error_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.EpsGet_Response.error)
+  // @@protoc_insertion_point(field_set_allocated:com.wazuh.api.engine.router.IngressGet_Response.error)
 }
 
-// uint32 eps = 3;
-inline void EpsGet_Response::clear_eps() {
-  _impl_.eps_ = 0u;
+// repeated .com.wazuh.api.engine.router.IngressRule rules = 3;
+inline int IngressGet_Response::_internal_rules_size() const {
+  return _impl_.rules_.size();
 }
-inline uint32_t EpsGet_Response::_internal_eps() const {
-  return _impl_.eps_;
+inline int IngressGet_Response::rules_size() const {
+  return _internal_rules_size();
 }
-inline uint32_t EpsGet_Response::eps() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.eps)
-  return _internal_eps();
+inline void IngressGet_Response::clear_rules() {
+  _impl_.rules_.Clear();
 }
-inline void EpsGet_Response::_internal_set_eps(uint32_t value) {
-  
-  _impl_.eps_ = value;
+inline ::com::wazuh::api::engine::router::IngressRule* IngressGet_Response::mutable_rules(int index) {
+  // @@protoc_insertion_point(field_mutable:com.wazuh.api.engine.router.IngressGet_Response.rules)
+  return _impl_.rules_.Mutable(index);
 }
-inline void EpsGet_Response::set_eps(uint32_t value) {
-  _internal_set_eps(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.eps)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::IngressRule >*
+IngressGet_Response::mutable_rules() {
+  // @@protoc_insertion_point(field_mutable_list:com.wazuh.api.engine.router.IngressGet_Response.rules)
+  return &_impl_.rules_;
 }
-
-// uint32 refresh_interval = 4;
-inline void EpsGet_Response::clear_refresh_interval() {
-  _impl_.refresh_interval_ = 0u;
+inline const ::com::wazuh::api::engine::router::IngressRule& IngressGet_Response::_internal_rules(int index) const {
+  return _impl_.rules_.Get(index);
 }
-inline uint32_t EpsGet_Response::_internal_refresh_interval() const {
-  return _impl_.refresh_interval_;
+inline const ::com::wazuh::api::engine::router::IngressRule& IngressGet_Response::rules(int index) const {
+  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.IngressGet_Response.rules)
+  return _internal_rules(index);
 }
-inline uint32_t EpsGet_Response::refresh_interval() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
-  return _internal_refresh_interval();
+inline ::com::wazuh::api::engine::router::IngressRule* IngressGet_Response::_internal_add_rules() {
+  return _impl_.rules_.Add();
 }
-inline void EpsGet_Response::_internal_set_refresh_interval(uint32_t value) {
-  
-  _impl_.refresh_interval_ = value;
+inline ::com::wazuh::api::engine::router::IngressRule* IngressGet_Response::add_rules() {
+  ::com::wazuh::api::engine::router::IngressRule* _add = _internal_add_rules();
+  // @@protoc_insertion_point(field_add:com.wazuh.api.engine.router.IngressGet_Response.rules)
+  return _add;
 }
-inline void EpsGet_Response::set_refresh_interval(uint32_t value) {
-  _internal_set_refresh_interval(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.refresh_interval)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::com::wazuh::api::engine::router::IngressRule >&
+IngressGet_Response::rules() const {
+  // @@protoc_insertion_point(field_list:com.wazuh.api.engine.router.IngressGet_Response.rules)
+  return _impl_.rules_;
 }
 
-// bool enabled = 5;
-inline void EpsGet_Response::clear_enabled() {
-  _impl_.enabled_ = false;
-}
-inline bool EpsGet_Response::_internal_enabled() const {
-  return _impl_.enabled_;
-}
-inline bool EpsGet_Response::enabled() const {
-  // @@protoc_insertion_point(field_get:com.wazuh.api.engine.router.EpsGet_Response.enabled)
-  return _internal_enabled();
-}
-inline void EpsGet_Response::_internal_set_enabled(bool value) {
-  
-  _impl_.enabled_ = value;
-}
-inline void EpsGet_Response::set_enabled(bool value) {
-  _internal_set_enabled(value);
-  // @@protoc_insertion_point(field_set:com.wazuh.api.engine.router.EpsGet_Response.enabled)
-}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// EpsEnable_Request
+// -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
 
-// EpsDisable_Request
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic pop
-#endif  // __GNUC__
 // -------------------------------------------------------------------
 
 // -------------------------------------------------------------------
@@ -4309,6 +6740,11 @@ template <>
 inline const EnumDescriptor* GetEnumDescriptor< ::com::wazuh::api::engine::router::Sync>() {
   return ::com::wazuh::api::engine::router::Sync_descriptor();
 }
+template <> struct is_proto_enum< ::com::wazuh::api::engine::router::IngressAction> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::com::wazuh::api::engine::router::IngressAction>() {
+  return ::com::wazuh::api::engine::router::IngressAction_descriptor();
+}
 
 PROTOBUF_NAMESPACE_CLOSE
 
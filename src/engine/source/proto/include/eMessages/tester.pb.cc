@@ -222,12 +222,76 @@ struct RunPost_ResponseDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RunPost_ResponseDefaultTypeInternal _RunPost_Response_default_instance_;
+PROTOBUF_CONSTEXPR BatchPost_Request_Event::BatchPost_Request_Event(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.location_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.queue_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchPost_Request_EventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPost_Request_EventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPost_Request_EventDefaultTypeInternal() {}
+  union {
+    BatchPost_Request_Event _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPost_Request_EventDefaultTypeInternal _BatchPost_Request_Event_default_instance_;
+PROTOBUF_CONSTEXPR BatchPost_Request::BatchPost_Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.asset_trace_)*/{}
+  , /*decltype(_impl_.namespaces_)*/{}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.trace_level_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BatchPost_RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPost_RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPost_RequestDefaultTypeInternal() {}
+  union {
+    BatchPost_Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPost_RequestDefaultTypeInternal _BatchPost_Request_default_instance_;
+PROTOBUF_CONSTEXPR BatchPost_Response_Item::BatchPost_Response_Item(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.result_)*/nullptr
+  , /*decltype(_impl_.index_)*/0u} {}
+struct BatchPost_Response_ItemDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPost_Response_ItemDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPost_Response_ItemDefaultTypeInternal() {}
+  union {
+    BatchPost_Response_Item _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPost_Response_ItemDefaultTypeInternal _BatchPost_Response_Item_default_instance_;
+PROTOBUF_CONSTEXPR BatchPost_Response::BatchPost_Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_.error_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.status_)*/0} {}
+struct BatchPost_ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchPost_ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BatchPost_ResponseDefaultTypeInternal() {}
+  union {
+    BatchPost_Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchPost_ResponseDefaultTypeInternal _BatchPost_Response_default_instance_;
 }  // namespace tester
 }  // namespace engine
 }  // namespace api
 }  // namespace wazuh
 }  // namespace com
-static ::_pb::Metadata file_level_metadata_tester_2eproto[13];
+static ::_pb::Metadata file_level_metadata_tester_2eproto[17];
 static const ::_pb::EnumDescriptor* file_level_enum_descriptors_tester_2eproto[3];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_tester_2eproto = nullptr;
 
@@ -367,6 +431,50 @@ const uint32_t TableStruct_tester_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,
   0,
   1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request_Event, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request_Event, _impl_.message_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request_Event, _impl_.location_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request_Event, _impl_.queue_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _impl_.events_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _impl_.trace_level_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _impl_.asset_trace_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Request, _impl_.namespaces_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response_Item, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response_Item, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response_Item, _impl_.index_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response_Item, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response_Item, _impl_.result_),
+  ~0u,
+  0,
+  1,
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response, _impl_.error_),
+  PROTOBUF_FIELD_OFFSET(::com::wazuh::api::engine::tester::BatchPost_Response, _impl_.results_),
+  ~0u,
+  0,
+  ~0u,
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, 10, -1, sizeof(::com::wazuh::api::engine::tester::SessionPost)},
@@ -382,6 +490,10 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 98, 107, -1, sizeof(::com::wazuh::api::engine::tester::TableGet_Response)},
   { 110, -1, -1, sizeof(::com::wazuh::api::engine::tester::RunPost_Request)},
   { 123, 132, -1, sizeof(::com::wazuh::api::engine::tester::RunPost_Response)},
+  { 135, -1, -1, sizeof(::com::wazuh::api::engine::tester::BatchPost_Request_Event)},
+  { 144, -1, -1, sizeof(::com::wazuh::api::engine::tester::BatchPost_Request)},
+  { 155, 164, -1, sizeof(::com::wazuh::api::engine::tester::BatchPost_Response_Item)},
+  { 167, 176, -1, sizeof(::com::wazuh::api::engine::tester::BatchPost_Response)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -398,6 +510,10 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::com::wazuh::api::engine::tester::_TableGet_Response_default_instance_._instance,
   &::com::wazuh::api::engine::tester::_RunPost_Request_default_instance_._instance,
   &::com::wazuh::api::engine::tester::_RunPost_Response_default_instance_._instance,
+  &::com::wazuh::api::engine::tester::_BatchPost_Request_Event_default_instance_._instance,
+  &::com::wazuh::api::engine::tester::_BatchPost_Request_default_instance_._instance,
+  &::com::wazuh::api::engine::tester::_BatchPost_Response_Item_default_instance_._instance,
+  &::com::wazuh::api::engine::tester::_BatchPost_Response_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_tester_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -439,11 +555,26 @@ const char descriptor_table_protodef_tester_2eproto[] PROTOBUF_SECTION_VARIABLE(
   " \001(\0162\".com.wazuh.api.engine.ReturnStatus"
   "\022\022\n\005error\030\002 \001(\tH\000\210\001\001\0228\n\006result\030\003 \001(\0132#.c"
   "om.wazuh.api.engine.tester.ResultH\001\210\001\001B\010"
-  "\n\006_errorB\t\n\007_result*5\n\005State\022\021\n\rSTATE_UN"
-  "KNOWN\020\000\022\014\n\010DISABLED\020\001\022\013\n\007ENABLED\020\002*>\n\004Sy"
-  "nc\022\020\n\014SYNC_UNKNOWN\020\000\022\013\n\007UPDATED\020\001\022\014\n\010OUT"
-  "DATED\020\002\022\t\n\005ERROR\020\003*/\n\nTraceLevel\022\010\n\004NONE"
-  "\020\000\022\016\n\nASSET_ONLY\020\001\022\007\n\003ALL\020\002b\006proto3"
+  "\n\006_errorB\t\n\007_result\"\211\002\n\021BatchPost_Reques"
+  "t\022\014\n\004name\030\001 \001(\t\022D\n\006events\030\002 \003(\01324.com.wa"
+  "zuh.api.engine.tester.BatchPost_Request."
+  "Event\022<\n\013trace_level\030\003 \001(\0162\'.com.wazuh.a"
+  "pi.engine.tester.TraceLevel\022\023\n\013asset_tra"
+  "ce\030\004 \003(\t\022\022\n\nnamespaces\030\005 \003(\t\0329\n\005Event\022\017\n"
+  "\007message\030\001 \001(\t\022\020\n\010location\030\002 \001(\t\022\r\n\005queu"
+  "e\030\003 \001(\t\"\247\002\n\022BatchPost_Response\0222\n\006status"
+  "\030\001 \001(\0162\".com.wazuh.api.engine.ReturnStat"
+  "us\022\022\n\005error\030\002 \001(\tH\000\210\001\001\022E\n\007results\030\003 \003(\0132"
+  "4.com.wazuh.api.engine.tester.BatchPost_"
+  "Response.Item\032x\n\004Item\022\r\n\005index\030\001 \001(\r\022\022\n\005"
+  "error\030\002 \001(\tH\000\210\001\001\0228\n\006result\030\003 \001(\0132#.com.w"
+  "azuh.api.engine.tester.ResultH\001\210\001\001B\010\n\006_e"
+  "rrorB\t\n\007_resultB\010\n\006_error*5\n\005State\022\021\n\rST"
+  "ATE_UNKNOWN\020\000\022\014\n\010DISABLED\020\001\022\013\n\007ENABLED\020\002"
+  "*>\n\004Sync\022\020\n\014SYNC_UNKNOWN\020\000\022\013\n\007UPDATED\020\001\022"
+  "\014\n\010OUTDATED\020\002\022\t\n\005ERROR\020\003*/\n\nTraceLevel\022\010"
+  "\n\004NONE\020\000\022\016\n\nASSET_ONLY\020\001\022\007\n\003ALL\020\002b\006proto"
+  "3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_tester_2eproto_deps[2] = {
   &::descriptor_table_engine_2eproto,
@@ -451,9 +582,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_tester_2eproto_deps
 };
 static ::_pbi::once_flag descriptor_table_tester_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_tester_2eproto = {
-    false, false, 1715, descriptor_table_protodef_tester_2eproto,
+    false, false, 2281, descriptor_table_protodef_tester_2eproto,
     "tester.proto",
-    &descriptor_table_tester_2eproto_once, descriptor_table_tester_2eproto_deps, 2, 13,
+    &descriptor_table_tester_2eproto_once, descriptor_table_tester_2eproto_deps, 2, 17,
     schemas, file_default_instances, TableStruct_tester_2eproto::offsets,
     file_level_metadata_tester_2eproto, file_level_enum_descriptors_tester_2eproto,
     file_level_service_descriptors_tester_2eproto,
@@ -3995,64 +4126,1309 @@ void RunPost_Response::InternalSwap(RunPost_Response* other) {
       file_level_metadata_tester_2eproto[12]);
 }
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace tester
-}  // namespace engine
-}  // namespace api
-}  // namespace wazuh
-}  // namespace com
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionPost*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionPost >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionPost >(arena);
-}
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Session*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Session >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Session >(arena);
-}
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Result_AssetTrace*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Result_AssetTrace >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Result_AssetTrace >(arena);
-}
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Result*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Result >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Result >(arena);
-}
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionPost_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionPost_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionPost_Request >(arena);
+// ===================================================================
+
+class BatchPost_Request_Event::_Internal {
+ public:
+};
+
+BatchPost_Request_Event::BatchPost_Request_Event(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.tester.BatchPost_Request.Event)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionDelete_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionDelete_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionDelete_Request >(arena);
+BatchPost_Request_Event::BatchPost_Request_Event(const BatchPost_Request_Event& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPost_Request_Event* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.location_){}
+    , decltype(_impl_.queue_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.location_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_location().empty()) {
+    _this->_impl_.location_.Set(from._internal_location(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_queue().empty()) {
+    _this->_impl_.queue_.Set(from._internal_queue(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.tester.BatchPost_Request.Event)
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionGet_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionGet_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionGet_Request >(arena);
+
+inline void BatchPost_Request_Event::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.message_){}
+    , decltype(_impl_.location_){}
+    , decltype(_impl_.queue_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.location_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.location_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.queue_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.queue_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionGet_Response*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionGet_Response >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionGet_Response >(arena);
+
+BatchPost_Request_Event::~BatchPost_Request_Event() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionReload_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionReload_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionReload_Request >(arena);
+
+inline void BatchPost_Request_Event::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.message_.Destroy();
+  _impl_.location_.Destroy();
+  _impl_.queue_.Destroy();
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::TableGet_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::TableGet_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::TableGet_Request >(arena);
+
+void BatchPost_Request_Event::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::TableGet_Response*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::TableGet_Response >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::TableGet_Response >(arena);
+
+void BatchPost_Request_Event::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.message_.ClearToEmpty();
+  _impl_.location_.ClearToEmpty();
+  _impl_.queue_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::RunPost_Request*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::RunPost_Request >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::RunPost_Request >(arena);
+
+const char* BatchPost_Request_Event::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string message = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.Event.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string location = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_location();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.Event.location"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string queue = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_queue();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.Event.queue"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::RunPost_Response*
-Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::RunPost_Response >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::RunPost_Response >(arena);
+
+uint8_t* BatchPost_Request_Event::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.Event.message");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_message(), target);
+  }
+
+  // string location = 2;
+  if (!this->_internal_location().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_location().data(), static_cast<int>(this->_internal_location().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.Event.location");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_location(), target);
+  }
+
+  // string queue = 3;
+  if (!this->_internal_queue().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_queue().data(), static_cast<int>(this->_internal_queue().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.Event.queue");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_queue(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  return target;
+}
+
+size_t BatchPost_Request_Event::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string message = 1;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  // string location = 2;
+  if (!this->_internal_location().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_location());
+  }
+
+  // string queue = 3;
+  if (!this->_internal_queue().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_queue());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPost_Request_Event::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPost_Request_Event::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPost_Request_Event::GetClassData() const { return &_class_data_; }
+
+
+void BatchPost_Request_Event::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPost_Request_Event*>(&to_msg);
+  auto& from = static_cast<const BatchPost_Request_Event&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  if (!from._internal_location().empty()) {
+    _this->_internal_set_location(from._internal_location());
+  }
+  if (!from._internal_queue().empty()) {
+    _this->_internal_set_queue(from._internal_queue());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPost_Request_Event::CopyFrom(const BatchPost_Request_Event& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.tester.BatchPost_Request.Event)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPost_Request_Event::IsInitialized() const {
+  return true;
+}
+
+void BatchPost_Request_Event::InternalSwap(BatchPost_Request_Event* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.location_, lhs_arena,
+      &other->_impl_.location_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.queue_, lhs_arena,
+      &other->_impl_.queue_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPost_Request_Event::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tester_2eproto_getter, &descriptor_table_tester_2eproto_once,
+      file_level_metadata_tester_2eproto[13]);
+}
+
+// ===================================================================
+
+class BatchPost_Request::_Internal {
+ public:
+};
+
+BatchPost_Request::BatchPost_Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.tester.BatchPost_Request)
+}
+BatchPost_Request::BatchPost_Request(const BatchPost_Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPost_Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.asset_trace_){from._impl_.asset_trace_}
+    , decltype(_impl_.namespaces_){from._impl_.namespaces_}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.trace_level_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.trace_level_ = from._impl_.trace_level_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.tester.BatchPost_Request)
+}
+
+inline void BatchPost_Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.events_){arena}
+    , decltype(_impl_.asset_trace_){arena}
+    , decltype(_impl_.namespaces_){arena}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.trace_level_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchPost_Request::~BatchPost_Request() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.tester.BatchPost_Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchPost_Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.events_.~RepeatedPtrField();
+  _impl_.asset_trace_.~RepeatedPtrField();
+  _impl_.namespaces_.~RepeatedPtrField();
+  _impl_.name_.Destroy();
+}
+
+void BatchPost_Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchPost_Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.tester.BatchPost_Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.events_.Clear();
+  _impl_.asset_trace_.Clear();
+  _impl_.namespaces_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.trace_level_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchPost_Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.tester.BatchPost_Request.Event events = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .com.wazuh.api.engine.tester.TraceLevel trace_level = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_trace_level(static_cast<::com::wazuh::api::engine::tester::TraceLevel>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string asset_trace = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_asset_trace();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.asset_trace"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string namespaces = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_namespaces();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Request.namespaces"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchPost_Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.tester.BatchPost_Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.tester.BatchPost_Request.Event events = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .com.wazuh.api.engine.tester.TraceLevel trace_level = 3;
+  if (this->_internal_trace_level() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_trace_level(), target);
+  }
+
+  // repeated string asset_trace = 4;
+  for (int i = 0, n = this->_internal_asset_trace_size(); i < n; i++) {
+    const auto& s = this->_internal_asset_trace(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.asset_trace");
+    target = stream->WriteString(4, s, target);
+  }
+
+  // repeated string namespaces = 5;
+  for (int i = 0, n = this->_internal_namespaces_size(); i < n; i++) {
+    const auto& s = this->_internal_namespaces(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Request.namespaces");
+    target = stream->WriteString(5, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.tester.BatchPost_Request)
+  return target;
+}
+
+size_t BatchPost_Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.tester.BatchPost_Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.tester.BatchPost_Request.Event events = 2;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated string asset_trace = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.asset_trace_.size());
+  for (int i = 0, n = _impl_.asset_trace_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.asset_trace_.Get(i));
+  }
+
+  // repeated string namespaces = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.namespaces_.size());
+  for (int i = 0, n = _impl_.namespaces_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.namespaces_.Get(i));
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .com.wazuh.api.engine.tester.TraceLevel trace_level = 3;
+  if (this->_internal_trace_level() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_trace_level());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPost_Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPost_Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPost_Request::GetClassData() const { return &_class_data_; }
+
+
+void BatchPost_Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPost_Request*>(&to_msg);
+  auto& from = static_cast<const BatchPost_Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.tester.BatchPost_Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  _this->_impl_.asset_trace_.MergeFrom(from._impl_.asset_trace_);
+  _this->_impl_.namespaces_.MergeFrom(from._impl_.namespaces_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_trace_level() != 0) {
+    _this->_internal_set_trace_level(from._internal_trace_level());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPost_Request::CopyFrom(const BatchPost_Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.tester.BatchPost_Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPost_Request::IsInitialized() const {
+  return true;
+}
+
+void BatchPost_Request::InternalSwap(BatchPost_Request* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  _impl_.asset_trace_.InternalSwap(&other->_impl_.asset_trace_);
+  _impl_.namespaces_.InternalSwap(&other->_impl_.namespaces_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.trace_level_, other->_impl_.trace_level_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPost_Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tester_2eproto_getter, &descriptor_table_tester_2eproto_once,
+      file_level_metadata_tester_2eproto[14]);
+}
+
+// ===================================================================
+
+class BatchPost_Response_Item::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BatchPost_Response_Item>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::com::wazuh::api::engine::tester::Result& result(const BatchPost_Response_Item* msg);
+  static void set_has_result(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+};
+
+const ::com::wazuh::api::engine::tester::Result&
+BatchPost_Response_Item::_Internal::result(const BatchPost_Response_Item* msg) {
+  return *msg->_impl_.result_;
+}
+BatchPost_Response_Item::BatchPost_Response_Item(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+}
+BatchPost_Response_Item::BatchPost_Response_Item(const BatchPost_Response_Item& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPost_Response_Item* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.index_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_result()) {
+    _this->_impl_.result_ = new ::com::wazuh::api::engine::tester::Result(*from._impl_.result_);
+  }
+  _this->_impl_.index_ = from._impl_.index_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+}
+
+inline void BatchPost_Response_Item::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.result_){nullptr}
+    , decltype(_impl_.index_){0u}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchPost_Response_Item::~BatchPost_Response_Item() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchPost_Response_Item::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.error_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.result_;
+}
+
+void BatchPost_Response_Item::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchPost_Response_Item::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.error_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.result_ != nullptr);
+      _impl_.result_->Clear();
+    }
+  }
+  _impl_.index_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchPost_Response_Item::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 index = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Response.Item.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .com.wazuh.api.engine.tester.Result result = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchPost_Response_Item::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 index = 1;
+  if (this->_internal_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_index(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Response.Item.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // optional .com.wazuh.api.engine.tester.Result result = 3;
+  if (_internal_has_result()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::result(this),
+        _Internal::result(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  return target;
+}
+
+size_t BatchPost_Response_Item::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional string error = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_error());
+    }
+
+    // optional .com.wazuh.api.engine.tester.Result result = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_);
+    }
+
+  }
+  // uint32 index = 1;
+  if (this->_internal_index() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_index());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPost_Response_Item::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPost_Response_Item::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPost_Response_Item::GetClassData() const { return &_class_data_; }
+
+
+void BatchPost_Response_Item::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPost_Response_Item*>(&to_msg);
+  auto& from = static_cast<const BatchPost_Response_Item&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_error(from._internal_error());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_result()->::com::wazuh::api::engine::tester::Result::MergeFrom(
+          from._internal_result());
+    }
+  }
+  if (from._internal_index() != 0) {
+    _this->_internal_set_index(from._internal_index());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPost_Response_Item::CopyFrom(const BatchPost_Response_Item& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.tester.BatchPost_Response.Item)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPost_Response_Item::IsInitialized() const {
+  return true;
+}
+
+void BatchPost_Response_Item::InternalSwap(BatchPost_Response_Item* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BatchPost_Response_Item, _impl_.index_)
+      + sizeof(BatchPost_Response_Item::_impl_.index_)
+      - PROTOBUF_FIELD_OFFSET(BatchPost_Response_Item, _impl_.result_)>(
+          reinterpret_cast<char*>(&_impl_.result_),
+          reinterpret_cast<char*>(&other->_impl_.result_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPost_Response_Item::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tester_2eproto_getter, &descriptor_table_tester_2eproto_once,
+      file_level_metadata_tester_2eproto[15]);
+}
+
+// ===================================================================
+
+class BatchPost_Response::_Internal {
+ public:
+  using HasBits = decltype(std::declval<BatchPost_Response>()._impl_._has_bits_);
+  static void set_has_error(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+BatchPost_Response::BatchPost_Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:com.wazuh.api.engine.tester.BatchPost_Response)
+}
+BatchPost_Response::BatchPost_Response(const BatchPost_Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BatchPost_Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.results_){from._impl_.results_}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_error()) {
+    _this->_impl_.error_.Set(from._internal_error(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.status_ = from._impl_.status_;
+  // @@protoc_insertion_point(copy_constructor:com.wazuh.api.engine.tester.BatchPost_Response)
+}
+
+inline void BatchPost_Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.results_){arena}
+    , decltype(_impl_.error_){}
+    , decltype(_impl_.status_){0}
+  };
+  _impl_.error_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.error_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+BatchPost_Response::~BatchPost_Response() {
+  // @@protoc_insertion_point(destructor:com.wazuh.api.engine.tester.BatchPost_Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BatchPost_Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedPtrField();
+  _impl_.error_.Destroy();
+}
+
+void BatchPost_Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BatchPost_Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:com.wazuh.api.engine.tester.BatchPost_Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.error_.ClearNonDefaultToEmpty();
+  }
+  _impl_.status_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchPost_Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .com.wazuh.api.engine.ReturnStatus status = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::com::wazuh::api::engine::ReturnStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string error = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_error();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "com.wazuh.api.engine.tester.BatchPost_Response.error"));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .com.wazuh.api.engine.tester.BatchPost_Response.Item results = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_results(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BatchPost_Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:com.wazuh.api.engine.tester.BatchPost_Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status(), target);
+  }
+
+  // optional string error = 2;
+  if (_internal_has_error()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_error().data(), static_cast<int>(this->_internal_error().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "com.wazuh.api.engine.tester.BatchPost_Response.error");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_error(), target);
+  }
+
+  // repeated .com.wazuh.api.engine.tester.BatchPost_Response.Item results = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_results_size()); i < n; i++) {
+    const auto& repfield = this->_internal_results(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:com.wazuh.api.engine.tester.BatchPost_Response)
+  return target;
+}
+
+size_t BatchPost_Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:com.wazuh.api.engine.tester.BatchPost_Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .com.wazuh.api.engine.tester.BatchPost_Response.Item results = 3;
+  total_size += 1UL * this->_internal_results_size();
+  for (const auto& msg : this->_impl_.results_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional string error = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_error());
+  }
+
+  // .com.wazuh.api.engine.ReturnStatus status = 1;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchPost_Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BatchPost_Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchPost_Response::GetClassData() const { return &_class_data_; }
+
+
+void BatchPost_Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BatchPost_Response*>(&to_msg);
+  auto& from = static_cast<const BatchPost_Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:com.wazuh.api.engine.tester.BatchPost_Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  if (from._internal_has_error()) {
+    _this->_internal_set_error(from._internal_error());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BatchPost_Response::CopyFrom(const BatchPost_Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:com.wazuh.api.engine.tester.BatchPost_Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchPost_Response::IsInitialized() const {
+  return true;
+}
+
+void BatchPost_Response::InternalSwap(BatchPost_Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.error_, lhs_arena,
+      &other->_impl_.error_, rhs_arena
+  );
+  swap(_impl_.status_, other->_impl_.status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchPost_Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_tester_2eproto_getter, &descriptor_table_tester_2eproto_once,
+      file_level_metadata_tester_2eproto[16]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace tester
+}  // namespace engine
+}  // namespace api
+}  // namespace wazuh
+}  // namespace com
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionPost*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionPost >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionPost >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Session*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Session >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Session >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Result_AssetTrace*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Result_AssetTrace >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Result_AssetTrace >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::Result*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::Result >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::Result >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionPost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionDelete_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionDelete_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionDelete_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionGet_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::SessionReload_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::SessionReload_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::SessionReload_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::TableGet_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::TableGet_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::TableGet_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::TableGet_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::TableGet_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::TableGet_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::RunPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::RunPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::RunPost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::RunPost_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::RunPost_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::RunPost_Response >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::BatchPost_Request_Event*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::BatchPost_Request_Event >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::BatchPost_Request_Event >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::BatchPost_Request*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::BatchPost_Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::BatchPost_Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::BatchPost_Response_Item*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::BatchPost_Response_Item >(arena);
+}
+template<> PROTOBUF_NOINLINE ::com::wazuh::api::engine::tester::BatchPost_Response*
+Arena::CreateMaybeMessage< ::com::wazuh::api::engine::tester::BatchPost_Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::com::wazuh::api::engine::tester::BatchPost_Response >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -1,18 +1,24 @@
 #ifndef _QUEUE_CONCURRENTQUEUE_HPP
 #define _QUEUE_CONCURRENTQUEUE_HPP
 
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <fcntl.h>
 #include <filesystem>
-#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <concurrentqueue/blockingconcurrentqueue.h>
 #include <queue/iqueue.hpp>
+#include <queue/spillLog.hpp>
 
 #include <base/logging.hpp>
 #include <metrics/iMetricsManager.hpp>
@@ -36,72 +42,22 @@ struct has_str_method<T, std::void_t<decltype(std::declval<T>()->str())>> : std:
 
 template<typename T>
 inline constexpr bool has_str_method_v = has_str_method<T>::value;
-/**
- * @brief Provides a wrapper for the flooding file
- *
- * @warning this is thread safe for the write operation
- */
-class FloodingFile
+// Check if T is a pointer to a type that can be rebuilt from its str method
+template<typename T, typename = std::void_t<>>
+struct is_spillable : std::false_type
 {
-private:
-    std::ofstream m_file; ///< File stream for the flooding file
-    std::string m_error;  ///< Error message if the file is not good
-    std::mutex m_mutex;   ///< Mutex for the write operation
+};
 
-public:
-    /**
-     * @brief Construct a new FloodingFile object
-     *
-     * The file will be opened in append mode, and the file pointer will be set at the end of the file.
-     * @param path (const std::string&) Path to the flooding file
-     */
-    explicit FloodingFile(const std::string& path)
-        : m_file(path, std::ios::out | std::ios::app | std::ios::ate)
-        , m_error {}
-        , m_mutex {}
-    {
-        if (!m_file.good())
-        {
-            m_error = strerror(errno);
-        }
-    }
+template<typename T>
+struct is_spillable<T, std::void_t<typename T::element_type>>
+    : std::bool_constant<has_str_method_v<T> && std::is_constructible_v<typename T::element_type, const char*>>
+{
+};
 
-    /**
-     * @brief Checks if the file is open and ready to write
-     *
-     * @return std::optional<std::string> containing an error message if the file is not good
-     */
-    std::optional<std::string> getError() const
-    {
-        if (m_file.good())
-        {
-            return std::nullopt;
-        }
-        else if (m_error.empty())
-        {
-            return "Unknown error";
-        }
-        return m_error;
-    }
+template<typename T>
+inline constexpr bool is_spillable_v = is_spillable<T>::value;
 
-    /**
-     * @brief Writes a message to the flooding file
-     *
-     * @param message (const std::string&) Message to write
-     *
-     * @return true if the write operation was successful, false otherwise
-     */
-    bool write(const std::string& message)
-    {
-        if (m_file.is_open())
-        {
-            std::lock_guard<std::mutex> lock {m_mutex};
-            m_file << message << std::endl;
-            return true;
-        }
-        return false;
-    }
-};
+constexpr std::size_t SPILL_REFILL_BATCH = 1024; ///< Maximum number of spilled events moved back at once
 
 /**
  * @brief A thread-safe queue that can be used to pass messages between threads.
@@ -110,8 +66,9 @@ public:
  * It provides a simple interface to use the queue.
  * It also provides a way to flood the queue when it is full.
  * The queue will be flooded when the push method is called and the queue is full
- * and the pathFloodedFile is provided.
- * @tparam T The type of the data to be stored in the queue.
+ * and the pathFloodedFile is provided: the events are spilled to a disk backed ring log (SpillLog) and moved back to
+ * the queue by the consumers once it has room, in the same order.
+ * @tparam T The type of the data to be stored in the queue, it must be rebuilt from its str method to be flooded.
  */
 template<typename T, typename D = moodycamel::ConcurrentQueueDefaultTraits>
 class ConcurrentQueue : public iQueue<T>
@@ -133,9 +90,13 @@ private:
 
     moodycamel::BlockingConcurrentQueue<T, D> m_queue {}; ///< The queue itself.
 
-    std::shared_ptr<FloodingFile> m_floodingFile; ///< The flooding file.
-    std::size_t m_maxAttempts;                    ///< The maximum number of attempts to push an element to the queue.
-    std::chrono::microseconds m_waitTime;         ///< The time to wait for the queue to be not full.
+    std::shared_ptr<SpillLog> m_spillLog; ///< The log where the events are spilled when the queue is full.
+    std::size_t m_maxAttempts;            ///< The maximum number of attempts to push an element to the queue.
+    std::chrono::microseconds m_waitTime; ///< The time to wait for the queue to be not full.
+
+    std::atomic<std::size_t> m_spilled; ///< Spilled events not moved back to the queue yet
+    std::mutex m_refillMutex;           ///< Only one consumer moves the spilled events back at a time
+    std::optional<T> m_refillPending;   ///< Event read from the log that did not fit in the queue
     bool m_discard; ///< If true, the queue will discard the events when it is full instead of flooding the file or
                     ///< blocking.
 
@@ -159,7 +120,7 @@ private:
             return;
         }
 
-        if (!m_floodingFile)
+        if (!m_spillLog)
         {
             while (!m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
             {
@@ -172,22 +133,110 @@ private:
         }
         else
         {
-            for (std::size_t attempts {0}; attempts < m_maxAttempts; ++attempts)
+            // Once spilling, the new events go to the log until it is drained, to keep the order
+            if (m_spilled.load(std::memory_order_relaxed) == 0)
             {
-                if (m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
+                for (std::size_t attempts {0}; attempts < m_maxAttempts; ++attempts)
                 {
-                    m_metrics.m_queued->addValue(1UL);
-                    m_metrics.m_used->addValue(1UL);
-                    return;
+                    if (m_queue.try_enqueue(std::move(element))) // TODO Wait whats? Move more than once?
+                    {
+                        m_metrics.m_queued->addValue(1UL);
+                        m_metrics.m_used->addValue(1UL);
+                        return;
+                    }
+                    std::this_thread::sleep_for(m_waitTime);
                 }
+            }
+
+            if (element == nullptr)
+            {
+                return;
+            }
+
+            if (spill(element))
+            {
+                m_metrics.m_flooded->addValue(1UL);
+                return;
+            }
+
+            // The log is full too, wait for room in the queue
+            while (!m_queue.try_enqueue(std::move(element)))
+            {
                 std::this_thread::sleep_for(m_waitTime);
             }
-            if (element != nullptr)
+            m_metrics.m_queued->addValue(1UL);
+            m_metrics.m_used->addValue(1);
+        }
+    }
+
+    bool spill(const T& element)
+    {
+        if constexpr (is_spillable_v<T>)
+        {
+            // Counted before writing, so a consumer never sees a record that is not counted yet
+            m_spilled.fetch_add(1, std::memory_order_relaxed);
+            if (m_spillLog->write(element->str()))
+            {
+                return true;
+            }
+            m_spilled.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Moves the spilled events back to the queue while it has room.
+     *
+     * Called by the consumers, it returns right away if another consumer is already doing it.
+     */
+    void refill()
+    {
+        if constexpr (is_spillable_v<T>)
+        {
+            std::unique_lock<std::mutex> lock {m_refillMutex, std::try_to_lock};
+            if (!lock.owns_lock())
             {
-                m_floodingFile->write(element->str());
+                return;
             }
 
-            m_metrics.m_flooded->addValue(1UL);
+            std::string record;
+            for (std::size_t moved {0}; moved < SPILL_REFILL_BATCH; ++moved)
+            {
+                if (!m_refillPending)
+                {
+                    if (!m_spillLog->read(record))
+                    {
+                        break;
+                    }
+
+                    try
+                    {
+                        m_refillPending = std::make_shared<typename T::element_type>(record.c_str());
+                    }
+                    catch (const std::exception& e)
+                    {
+                        LOG_WARNING("Discarding a spilled event that cannot be rebuilt: {}", e.what());
+                        m_spilled.fetch_sub(1, std::memory_order_relaxed);
+                        continue;
+                    }
+                }
+
+                if (!m_queue.try_enqueue(std::move(*m_refillPending)))
+                {
+                    break;
+                }
+                m_refillPending.reset();
+                m_spilled.fetch_sub(1, std::memory_order_relaxed);
+                m_metrics.m_used->addValue(1);
+            }
+        }
+    }
+
+    void refillIfSpilled()
+    {
+        if (m_spilled.load(std::memory_order_relaxed) > 0)
+        {
+            refill();
         }
     }
 
@@ -204,7 +253,7 @@ public:
      * @param capacity The capacity of the queue. (Approximate)
      * @param metricsManager The metrics manager to use for the queue.
      * @param metricsScopeName The name of the metrics scope for the queue.
-     * @param pathFloodedFile The path to the file where the queue will be flooded.
+     * @param pathFloodedFile The path to the spill log where the queue will be flooded.
      * @param maxAttempts The maximum number of attempts to push an element to the queue. (ignored if
      * pathFloodedFile is not provided)
      * @param waitTime The time to wait for the queue to be not full. (ignored if pathFloodedFile is not provided)
@@ -212,6 +261,7 @@ public:
      * @throw std::runtime_error if the capacity is less than or equal to 0
      * @throw std::runtime_error if the pathFloodedFile is provided and the maxAttempts is less than or equal to 0
      * @throw std::runtime_error if the pathFloodedFile is provided and the waitTime is less than or equal to 0
+     * @throw std::runtime_error if the pathFloodedFile is provided and T cannot be rebuilt from its str method
      * @note If the pathFloodedFile is not provided, the queue will not be flooded,and the
      * push method will block until there is space in the queue.
      */
@@ -222,7 +272,9 @@ public:
                              const int maxAttempts = -1,
                              const int waitTime = -1,
                              const bool discard = false)
-        : m_floodingFile {nullptr}
+        : m_spillLog {nullptr}
+        , m_maxAttempts {maxAttempts > 0 ? static_cast<std::size_t>(maxAttempts) : 1}
+        , m_spilled {0}
         , m_discard {discard}
     {
         if (capacity <= 0)
@@ -248,10 +300,15 @@ public:
             m_waitTime = std::chrono::microseconds(waitTime);
             m_maxAttempts = maxAttempts;
 
-            m_floodingFile = std::make_shared<FloodingFile>(pathFloodedFile);
-            if (m_floodingFile->getError())
+            if (!is_spillable_v<T>)
             {
-                throw std::runtime_error("Error opening the flooding file: " + m_floodingFile->getError().value());
+                throw std::runtime_error("The queue cannot be flooded, the type T cannot be rebuilt from its str");
+            }
+
+            m_spillLog = std::make_shared<SpillLog>(pathFloodedFile);
+            if (m_spillLog->getError())
+            {
+                throw std::runtime_error("Error opening the flooding file: " + m_spillLog->getError().value());
             }
             else
             {
@@ -285,6 +342,39 @@ public:
         }
     }
 
+    /**
+     * @brief Pushes the elements to the queue in a single bulk operation.
+     *
+     * If the queue has no room for all of them, or events are spilled, each element is pushed as push does, so the
+     * full queue is handled the same way.
+     *
+     * @param elements The elements to be pushed, they will be moved and the vector cleared.
+     */
+    void pushBulk(std::vector<T>& elements) override
+    {
+        if (elements.empty())
+        {
+            return;
+        }
+
+        // The spilled events go back first, the new ones cannot overtake them
+        if (m_spilled.load(std::memory_order_relaxed) == 0
+            && m_queue.try_enqueue_bulk(std::make_move_iterator(elements.begin()), elements.size()))
+        {
+            m_metrics.m_queued->addValue(elements.size());
+            m_metrics.m_used->addValue(static_cast<int64_t>(elements.size()));
+        }
+        else
+        {
+            for (auto& element : elements)
+            {
+                push(std::move(element));
+            }
+        }
+
+        elements.clear();
+    }
+
     /**
      * @brief Pushes a new element to the queue.
      *
@@ -326,6 +416,7 @@ public:
      */
     bool waitPop(T& element, int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
     {
+        refillIfSpilled();
         auto result = m_queue.wait_dequeue_timed(element, timeout);
         if (result)
         {
@@ -337,8 +428,38 @@ public:
         return result;
     }
 
+    /**
+     * @brief Pops up to maxElements elements from the queue in a single bulk operation.
+     *
+     * @param elements Vector where the popped elements are appended.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout The timeout in microseconds to wait for the first element.
+     * @return std::size_t The number of elements popped (0 if the timeout was reached).
+     */
+    std::size_t waitPopBulk(std::vector<T>& elements,
+                            std::size_t maxElements,
+                            int64_t timeout = WAIT_DEQUEUE_TIMEOUT_USEC) override
+    {
+        if (maxElements == 0)
+        {
+            return 0;
+        }
+
+        refillIfSpilled();
+        auto count = m_queue.wait_dequeue_bulk_timed(std::back_inserter(elements), maxElements, timeout);
+        if (count > 0)
+        {
+            m_metrics.m_consumed->addValue(count);
+            m_metrics.m_used->addValue(-static_cast<int64_t>(count));
+            m_metrics.m_consumendPerSecond->addValue(count);
+        }
+
+        return count;
+    }
+
     bool tryPop(T& element) override
     {
+        refillIfSpilled();
         auto result = m_queue.try_dequeue(element);
         if (result)
         {
@@ -352,18 +473,18 @@ public:
     /**
      * @brief Checks if the queue is empty.
      *
-     * @note The size is approximate.
+     * @note The size is approximate, the spilled events are included.
      * @return true if the queue is empty.
      * @return false otherwise.
      */
-    bool empty() const override { return m_queue.size_approx() == 0; }
+    bool empty() const override { return size() == 0; }
     /**
      * @brief Gets the size of the queue.
      *
-     * @note The size is approximate.
+     * @note The size is approximate, the spilled events are included.
      * @return size_t The size of the queue.
      */
-    size_t size() const override { return m_queue.size_approx(); }
+    size_t size() const override { return m_queue.size_approx() + m_spilled.load(std::memory_order_relaxed); }
 };
 
 } // namespace base::queue
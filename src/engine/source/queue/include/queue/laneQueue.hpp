@@ -0,0 +1,310 @@
+#ifndef _QUEUE_LANEQUEUE_HPP
+#define _QUEUE_LANEQUEUE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <queue/iqueue.hpp>
+#include <queue/pollWait.hpp>
+
+namespace base::queue
+{
+
+constexpr int64_t LANE_POLL_INTERVAL_USEC = 1000; ///< Time a consumer waits on a lane between polls of the others
+constexpr std::size_t MAX_LANE_WEIGHT = 1000;     ///< Maximum weight of a lane
+
+/**
+ * @brief What a lane does with the events that do not fit
+ */
+enum class LaneFlood
+{
+    BLOCK, ///< The producer waits for room in the lane
+    SPILL, ///< The events are spilled to the flood file of the lane
+    DROP   ///< The events are discarded
+};
+
+/**
+ * @brief Settings of a lane of the event queue
+ */
+struct LaneSpec
+{
+    std::string queues;             ///< Wazuh queue ids of the events of the lane, "*" for the events of the others
+    std::size_t weight;             ///< Pops of the lane per round, when all the lanes have events
+    std::optional<LaneFlood> flood; ///< What the lane does when it is full, the settings of the queue if not set
+};
+
+/**
+ * @brief Parse the lanes of the event queue.
+ *
+ * The lanes are separated by commas, each one is "<queue ids>:<weight>[:<block|spill|drop>]", e.g. "3:8,8d:1:drop,*:4"
+ * puts the events of the queue '3' in a lane that is popped eight times as often as the one of the queues '8' and
+ * 'd', which discards them when it is full, and the events of the other queues in a third lane.
+ *
+ * @param specs The lanes, empty for no lanes.
+ * @return std::vector<LaneSpec> The lanes, in the order they are polled when the scheduled one is empty.
+ * @throw std::runtime_error if a lane is invalid or a queue id is in more than one lane.
+ */
+std::vector<LaneSpec> parseLaneSpecs(std::string_view specs);
+
+/**
+ * @brief Table of the lane of each queue id.
+ *
+ * @param lanes The lanes, not empty.
+ * @return std::array<std::size_t, 256> Lane index by queue id, the events of the queues that are in no lane go to the
+ * "*" lane, or to the last one if there is none.
+ */
+std::array<std::size_t, 256> laneTable(const std::vector<LaneSpec>& lanes);
+
+/**
+ * @brief A queue split in prioritized lanes, a classifier picks the lane of each element.
+ *
+ * The consumers pop the lanes in a weighted round robin: each lane gets a share of the pops in proportion to its
+ * weight while all of them have elements, so a flooded lane cannot starve the others and a low weight lane is still
+ * served. A pop whose scheduled lane is empty takes from the others in order instead of waiting. The elements of a
+ * lane keep their order.
+ *
+ * Each lane is a queue of its own, with its own capacity and flooding policy.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ */
+template<typename T>
+class LaneQueue : public iQueue<T>
+{
+public:
+    using LaneFn = std::function<std::size_t(const T&)>; ///< Lane of an element
+
+    /**
+     * @brief A lane and its weight
+     */
+    struct Lane
+    {
+        std::shared_ptr<iQueue<T>> queue; ///< Queue of the lane
+        std::size_t weight;               ///< Pops of the lane per round
+    };
+
+private:
+    std::vector<Lane> m_lanes;           ///< The lanes
+    LaneFn m_laneOf;                     ///< Classifier of the elements
+    std::vector<std::size_t> m_schedule; ///< Lane scheduled for each pop of a round
+    std::atomic<std::size_t> m_next;     ///< Next pop of the round
+
+    std::size_t laneOf(const T& element) const { return std::min(m_laneOf(element), m_lanes.size() - 1); }
+
+    /**
+     * @brief Build the round of a smooth weighted round robin, the pops of a lane are spread along it
+     */
+    void buildSchedule()
+    {
+        std::size_t total {0};
+        for (const auto& lane : m_lanes)
+        {
+            total += lane.weight;
+        }
+
+        std::vector<int64_t> current(m_lanes.size(), 0);
+        m_schedule.reserve(total);
+        for (std::size_t pop = 0; pop < total; ++pop)
+        {
+            std::size_t best {0};
+            for (std::size_t lane = 0; lane < m_lanes.size(); ++lane)
+            {
+                current[lane] += static_cast<int64_t>(m_lanes[lane].weight);
+                if (current[lane] > current[best])
+                {
+                    best = lane;
+                }
+            }
+            current[best] -= static_cast<int64_t>(total);
+            m_schedule.push_back(best);
+        }
+    }
+
+    /**
+     * @brief Lane popped in the turn-th place of a pop that starts on the scheduled one, then the others in order
+     */
+    std::size_t laneAt(std::size_t scheduled, std::size_t turn) const
+    {
+        if (turn == 0)
+        {
+            return scheduled;
+        }
+        return turn <= scheduled ? turn - 1 : turn;
+    }
+
+    std::size_t scheduled() { return m_schedule[m_next.fetch_add(1, std::memory_order_relaxed) % m_schedule.size()]; }
+
+public:
+    /**
+     * @brief Construct a new Lane Queue object
+     *
+     * @param lanes The lanes, in the order they are popped when the scheduled one is empty.
+     * @param laneOf Classifier of the elements, the last lane gets the elements of the lanes that do not exist.
+     *
+     * @throw std::runtime_error if there are no lanes, a lane is empty or its weight is not between 1 and
+     * MAX_LANE_WEIGHT, or the classifier is not set.
+     */
+    LaneQueue(std::vector<Lane> lanes, LaneFn laneOf)
+        : m_lanes(std::move(lanes))
+        , m_laneOf(std::move(laneOf))
+        , m_next(0)
+    {
+        if (m_lanes.empty())
+        {
+            throw std::runtime_error("The lane queue must have at least one lane");
+        }
+
+        for (const auto& lane : m_lanes)
+        {
+            if (!lane.queue)
+            {
+                throw std::runtime_error("The lanes of the queue cannot be empty");
+            }
+            if (lane.weight == 0 || lane.weight > MAX_LANE_WEIGHT)
+            {
+                throw std::runtime_error("The weight of a lane must be between 1 and "
+                                         + std::to_string(MAX_LANE_WEIGHT));
+            }
+        }
+
+        if (!m_laneOf)
+        {
+            throw std::runtime_error("The classifier of the lane queue must be set");
+        }
+
+        buildSchedule();
+    }
+
+    /**
+     * @brief Gets the number of lanes.
+     */
+    std::size_t lanes() const { return m_lanes.size(); }
+
+    /**
+     * @brief Gets the queue of a lane.
+     */
+    const std::shared_ptr<iQueue<T>>& lane(std::size_t index) const { return m_lanes.at(index).queue; }
+
+    void push(T&& element) override
+    {
+        const auto lane = laneOf(element);
+        m_lanes[lane].queue->push(std::move(element));
+    }
+
+    /**
+     * @brief Pushes the elements to their lanes, each lane gets its elements in a single bulk operation.
+     *
+     * @param elements The elements to be pushed, they will be moved and the vector cleared.
+     */
+    void pushBulk(std::vector<T>& elements) override
+    {
+        std::vector<std::vector<T>> buckets(m_lanes.size());
+        for (auto& element : elements)
+        {
+            const auto lane = laneOf(element);
+            buckets[lane].emplace_back(std::move(element));
+        }
+        elements.clear();
+
+        for (std::size_t lane = 0; lane < m_lanes.size(); ++lane)
+        {
+            if (!buckets[lane].empty())
+            {
+                m_lanes[lane].queue->pushBulk(buckets[lane]);
+            }
+        }
+    }
+
+    bool tryPush(const T& element) override { return m_lanes[laneOf(element)].queue->tryPush(element); }
+
+    bool waitPop(T& element, int64_t timeout = 0) override
+    {
+        const auto deadline = detail::deadlineOf(timeout);
+        while (true)
+        {
+            const auto first = scheduled();
+            for (std::size_t turn = 0; turn < m_lanes.size(); ++turn)
+            {
+                if (m_lanes[laneAt(first, turn)].queue->tryPop(element))
+                {
+                    return true;
+                }
+            }
+
+            const auto wait = detail::pollWait(timeout, deadline, LANE_POLL_INTERVAL_USEC);
+            if (wait == 0 && timeout >= 0)
+            {
+                return false;
+            }
+            if (m_lanes[first].queue->waitPop(element, wait))
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Pops up to maxElements elements, from the scheduled lane first and then from the others in order.
+     */
+    std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) override
+    {
+        if (maxElements == 0)
+        {
+            return 0;
+        }
+
+        const auto deadline = detail::deadlineOf(timeout);
+        while (true)
+        {
+            const auto first = scheduled();
+            std::size_t count {0};
+            for (std::size_t turn = 0; turn < m_lanes.size() && count < maxElements; ++turn)
+            {
+                count += m_lanes[laneAt(first, turn)].queue->waitPopBulk(elements, maxElements - count, 0);
+            }
+            if (count > 0)
+            {
+                return count;
+            }
+
+            const auto wait = detail::pollWait(timeout, deadline, LANE_POLL_INTERVAL_USEC);
+            if (wait == 0 && timeout >= 0)
+            {
+                return 0;
+            }
+            if (auto popped = m_lanes[first].queue->waitPopBulk(elements, maxElements, wait))
+            {
+                return popped;
+            }
+        }
+    }
+
+    bool tryPop(T& element) override { return waitPop(element, 0); }
+
+    bool empty() const override
+    {
+        return std::all_of(m_lanes.begin(), m_lanes.end(), [](const auto& lane) { return lane.queue->empty(); });
+    }
+
+    size_t size() const override
+    {
+        std::size_t size = 0;
+        for (const auto& lane : m_lanes)
+        {
+            size += lane.queue->size();
+        }
+        return size;
+    }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_LANEQUEUE_HPP
@@ -0,0 +1,41 @@
+#ifndef _QUEUE_POLLWAIT_HPP
+#define _QUEUE_POLLWAIT_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace base::queue::detail
+{
+
+/**
+ * @brief Deadline of a timeout in microseconds, a negative timeout is handled by pollWait
+ */
+inline std::chrono::steady_clock::time_point deadlineOf(int64_t timeout)
+{
+    return std::chrono::steady_clock::now() + std::chrono::microseconds(std::max<int64_t>(0, timeout));
+}
+
+/**
+ * @brief Time to wait on one of the queues polled in turn, in microseconds
+ *
+ * @param timeout Timeout of the pop, a negative one never expires
+ * @param deadline Deadline of the timeout
+ * @param interval Maximum time to wait before polling the queues again
+ * @return int64_t The time left until the deadline, up to the interval, 0 once it expired
+ */
+inline int64_t pollWait(int64_t timeout, std::chrono::steady_clock::time_point deadline, int64_t interval)
+{
+    if (timeout < 0)
+    {
+        return interval;
+    }
+
+    const auto left =
+        std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now());
+    return std::max<int64_t>(0, std::min<int64_t>(left.count(), interval));
+}
+
+} // namespace base::queue::detail
+
+#endif // _QUEUE_POLLWAIT_HPP
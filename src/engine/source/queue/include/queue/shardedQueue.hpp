@@ -0,0 +1,267 @@
+#ifndef _QUEUE_SHARDEDQUEUE_HPP
+#define _QUEUE_SHARDEDQUEUE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <queue/iqueue.hpp>
+#include <queue/pollWait.hpp>
+
+namespace base::queue
+{
+
+constexpr int64_t STEAL_INTERVAL_USEC = 1000; ///< Time a consumer waits on its shard between attempts to steal
+
+/**
+ * @brief A queue split in shards, the elements with the same key always go to the same shard.
+ *
+ * Each consumer gets a view that pops from its own shard, so the elements of a key are consumed by the same consumer
+ * and in order, and the consumers do not contend on a single queue. With work stealing, a consumer whose shard is
+ * empty pops from the others instead of waiting, which keeps the consumers busy under skewed keys at the cost of the
+ * per-key order of the stolen elements.
+ *
+ * The queue itself can be popped from too, from all the shards in turn.
+ *
+ * @tparam T The type of the data to be stored in the queue.
+ */
+template<typename T>
+class ShardedQueue
+    : public iQueue<T>
+    , public std::enable_shared_from_this<ShardedQueue<T>>
+{
+public:
+    using KeyFn = std::function<std::size_t(const T&)>; ///< Hash of the key of an element
+
+private:
+    std::vector<std::shared_ptr<iQueue<T>>> m_shards; ///< The shards
+    KeyFn m_keyOf;                                    ///< Key of the elements
+    bool m_steal;                                     ///< The consumers pop from the other shards if theirs is empty
+    std::atomic<std::size_t> m_next;                  ///< Next shard of the pops of the queue itself
+
+    /**
+     * @brief A view of the queue that pops from a shard, pushing routes the elements as the queue does
+     */
+    class Consumer : public iQueue<T>
+    {
+    private:
+        std::shared_ptr<ShardedQueue<T>> m_queue; ///< The sharded queue
+        std::size_t m_shard;                      ///< Shard popped from
+
+    public:
+        Consumer(std::shared_ptr<ShardedQueue<T>> queue, std::size_t shard)
+            : m_queue(std::move(queue))
+            , m_shard(shard)
+        {
+        }
+
+        void push(T&& element) override { m_queue->push(std::move(element)); }
+        void pushBulk(std::vector<T>& elements) override { m_queue->pushBulk(elements); }
+        bool tryPush(const T& element) override { return m_queue->tryPush(element); }
+
+        bool waitPop(T& element, int64_t timeout = 0) override
+        {
+            return m_queue->popFrom(m_shard, element, timeout, m_queue->m_steal);
+        }
+
+        std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) override
+        {
+            return m_queue->popBulkFrom(m_shard, elements, maxElements, timeout, m_queue->m_steal);
+        }
+
+        bool tryPop(T& element) override { return m_queue->popFrom(m_shard, element, 0, m_queue->m_steal); }
+        bool empty() const override { return m_queue->m_shards[m_shard]->empty(); }
+        size_t size() const override { return m_queue->m_shards[m_shard]->size(); }
+    };
+
+    std::size_t shardOf(const T& element) const { return m_keyOf(element) % m_shards.size(); }
+
+    /**
+     * @brief Pops an element from the shard, or from the others if steal is set and it is empty
+     */
+    bool popFrom(std::size_t shard, T& element, int64_t timeout, bool steal)
+    {
+        if (!steal)
+        {
+            return m_shards[shard]->waitPop(element, timeout);
+        }
+
+        const auto deadline = detail::deadlineOf(timeout);
+        while (true)
+        {
+            for (std::size_t i = 0; i < m_shards.size(); ++i)
+            {
+                if (m_shards[(shard + i) % m_shards.size()]->tryPop(element))
+                {
+                    return true;
+                }
+            }
+
+            const auto wait = detail::pollWait(timeout, deadline, STEAL_INTERVAL_USEC);
+            if (wait == 0 && timeout >= 0)
+            {
+                return false;
+            }
+            if (m_shards[shard]->waitPop(element, wait))
+            {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Pops up to maxElements elements from the shard, or from one of the others if steal is set and it is empty
+     */
+    std::size_t
+    popBulkFrom(std::size_t shard, std::vector<T>& elements, std::size_t maxElements, int64_t timeout, bool steal)
+    {
+        if (!steal || maxElements == 0)
+        {
+            return m_shards[shard]->waitPopBulk(elements, maxElements, timeout);
+        }
+
+        const auto deadline = detail::deadlineOf(timeout);
+        while (true)
+        {
+            for (std::size_t i = 0; i < m_shards.size(); ++i)
+            {
+                if (auto count = m_shards[(shard + i) % m_shards.size()]->waitPopBulk(elements, maxElements, 0))
+                {
+                    return count;
+                }
+            }
+
+            const auto wait = detail::pollWait(timeout, deadline, STEAL_INTERVAL_USEC);
+            if (wait == 0 && timeout >= 0)
+            {
+                return 0;
+            }
+            if (auto count = m_shards[shard]->waitPopBulk(elements, maxElements, wait))
+            {
+                return count;
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new Sharded Queue object
+     *
+     * @param shards The shards, one per consumer.
+     * @param keyOf Hash of the key of an element, the elements are pushed to the shard of their key.
+     * @param steal If true, the consumers pop from the other shards when theirs is empty.
+     *
+     * @throw std::runtime_error if there are no shards, a shard is empty or the key function is not set.
+     */
+    ShardedQueue(std::vector<std::shared_ptr<iQueue<T>>> shards, KeyFn keyOf, bool steal)
+        : m_shards(std::move(shards))
+        , m_keyOf(std::move(keyOf))
+        , m_steal(steal)
+        , m_next(0)
+    {
+        if (m_shards.empty())
+        {
+            throw std::runtime_error("The sharded queue must have at least one shard");
+        }
+
+        if (std::any_of(m_shards.begin(), m_shards.end(), [](const auto& shard) { return !shard; }))
+        {
+            throw std::runtime_error("The shards of the queue cannot be empty");
+        }
+
+        if (!m_keyOf)
+        {
+            throw std::runtime_error("The key function of the sharded queue must be set");
+        }
+    }
+
+    /**
+     * @brief Gets the view of the queue of a consumer, it pops from the shard of the consumer.
+     *
+     * @param index The index of the consumer, the shard is index modulo the number of shards.
+     * @return std::shared_ptr<iQueue<T>> The view of the queue, it keeps the queue alive.
+     * @note The queue must be owned by a shared_ptr.
+     */
+    std::shared_ptr<iQueue<T>> consumer(std::size_t index)
+    {
+        return std::make_shared<Consumer>(this->shared_from_this(), index % m_shards.size());
+    }
+
+    /**
+     * @brief Gets the number of shards.
+     */
+    std::size_t shards() const { return m_shards.size(); }
+
+    void push(T&& element) override
+    {
+        const auto shard = shardOf(element);
+        m_shards[shard]->push(std::move(element));
+    }
+
+    /**
+     * @brief Pushes the elements to their shards, each shard gets its elements in a single bulk operation.
+     *
+     * @param elements The elements to be pushed, they will be moved and the vector cleared.
+     */
+    void pushBulk(std::vector<T>& elements) override
+    {
+        if (m_shards.size() == 1)
+        {
+            m_shards.front()->pushBulk(elements);
+            return;
+        }
+
+        std::vector<std::vector<T>> buckets(m_shards.size());
+        for (auto& element : elements)
+        {
+            const auto shard = shardOf(element);
+            buckets[shard].emplace_back(std::move(element));
+        }
+        elements.clear();
+
+        for (std::size_t shard = 0; shard < m_shards.size(); ++shard)
+        {
+            if (!buckets[shard].empty())
+            {
+                m_shards[shard]->pushBulk(buckets[shard]);
+            }
+        }
+    }
+
+    bool tryPush(const T& element) override { return m_shards[shardOf(element)]->tryPush(element); }
+
+    bool waitPop(T& element, int64_t timeout = 0) override
+    {
+        return popFrom(m_next.fetch_add(1, std::memory_order_relaxed) % m_shards.size(), element, timeout, true);
+    }
+
+    std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) override
+    {
+        return popBulkFrom(
+            m_next.fetch_add(1, std::memory_order_relaxed) % m_shards.size(), elements, maxElements, timeout, true);
+    }
+
+    bool tryPop(T& element) override { return waitPop(element, 0); }
+
+    bool empty() const override
+    {
+        return std::all_of(m_shards.begin(), m_shards.end(), [](const auto& shard) { return shard->empty(); });
+    }
+
+    size_t size() const override
+    {
+        std::size_t size = 0;
+        for (const auto& shard : m_shards)
+        {
+            size += shard->size();
+        }
+        return size;
+    }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SHARDEDQUEUE_HPP
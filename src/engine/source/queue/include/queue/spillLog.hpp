@@ -0,0 +1,112 @@
+#ifndef _QUEUE_SPILLLOG_HPP
+#define _QUEUE_SPILLLOG_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace base::queue
+{
+
+/**
+ * @brief Disk backed ring log where a full queue spills its events.
+ *
+ * The file is memory mapped and split in fixed size segments used as a ring. Records are appended to the current
+ * segment and the writer rotates to the next one when it is full, while the reader drains the records in the same
+ * order. A segment is reused once it has been completely drained, the log is full when the writer would rotate into
+ * the segment being read.
+ *
+ * The log is a buffer for the transient bursts, it is truncated when it is opened and its records are not recovered
+ * after a restart.
+ *
+ * @warning this is thread safe for the write and read operations
+ */
+class SpillLog
+{
+public:
+    static constexpr std::size_t DEFAULT_SEGMENT_SIZE {64 * 1024 * 1024}; ///< Default size of each segment
+    static constexpr std::size_t DEFAULT_SEGMENTS {4};                    ///< Default number of segments of the ring
+
+private:
+    using RecordSize = uint32_t; ///< Header of every record, the size of its payload
+
+    int m_fd;                  ///< File descriptor of the log
+    char* m_data;              ///< Mapping of the whole file
+    std::size_t m_segmentSize; ///< Size of each segment
+    std::size_t m_segments;    ///< Number of segments
+    std::string m_error;       ///< Error message if the log could not be opened
+
+    std::mutex m_mutex;              ///< Mutex for the write and read operations
+    std::vector<std::size_t> m_ends; ///< Bytes used by each segment, final once the writer rotates
+    std::size_t m_writeSegment;      ///< Segment being written
+    std::size_t m_readSegment;       ///< Segment being read
+    std::size_t m_readOffset;        ///< Offset of the next record to read in the read segment
+    std::atomic<std::size_t> m_size; ///< Number of records pending to be read
+
+    char* segment(std::size_t index) const { return m_data + index * m_segmentSize; }
+
+public:
+    /**
+     * @brief Construct a new SpillLog object
+     *
+     * The file is created (or truncated) with the size of all segments.
+     * @param path (const std::string&) Path to the log file
+     * @param segmentSize Size of each segment, the largest record that fits is slightly smaller
+     * @param segments Number of segments of the ring, at least 2
+     */
+    explicit SpillLog(const std::string& path,
+                      std::size_t segmentSize = DEFAULT_SEGMENT_SIZE,
+                      std::size_t segments = DEFAULT_SEGMENTS);
+
+    ~SpillLog();
+
+    SpillLog(const SpillLog&) = delete;
+    SpillLog& operator=(const SpillLog&) = delete;
+
+    /**
+     * @brief Checks if the log is mapped and ready to be used
+     *
+     * @return std::optional<std::string> containing an error message if the log is not good
+     */
+    std::optional<std::string> getError() const;
+
+    /**
+     * @brief Appends a record to the log
+     *
+     * @param record (std::string_view) Record to write
+     *
+     * @return true if the record was written, false if the log is full, not good or the record does not fit in a
+     * segment
+     */
+    bool write(std::string_view record);
+
+    /**
+     * @brief Reads the oldest record of the log
+     *
+     * @param record (std::string&) Where the record is written
+     *
+     * @return true if a record was read, false if the log is empty
+     */
+    bool read(std::string& record);
+
+    /**
+     * @brief Gets the number of records pending to be read
+     *
+     * @return std::size_t
+     */
+    std::size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Checks if there are no records pending to be read
+     */
+    bool empty() const { return size() == 0; }
+};
+
+} // namespace base::queue
+
+#endif // _QUEUE_SPILLLOG_HPP
@@ -1,7 +1,9 @@
 #ifndef _QUEUE_IQUEUE_HPP
 #define _QUEUE_IQUEUE_HPP
 
-
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace base::queue
 {
@@ -30,6 +32,14 @@ public:
      */
     virtual void push(T&& element) = 0;
 
+    /**
+     * @brief Push the elements into the queue in a single bulk operation, or one by one as push does when there is
+     * no room for all of them.
+     *
+     * @param elements The elements to push, they are moved and the vector is cleared.
+     */
+    virtual void pushBulk(std::vector<T>& elements) = 0;
+
     /**
      * @brief Try to push an element into the queue
      *
@@ -46,6 +56,19 @@ public:
      */
     virtual bool waitPop(T& element, int64_t timeout = 0) = 0;
 
+    /**
+     * @brief Wait for and pop up to maxElements elements from the queue.
+     *
+     * Blocks until at least one element is available or the timeout expires, then dequeues as many elements as
+     * are available without exceeding maxElements.
+     *
+     * @param elements Vector where the popped elements are appended.
+     * @param maxElements The maximum number of elements to pop.
+     * @param timeout (Optional) The maximum time to wait for the first element (in microseconds).
+     * @return The number of elements popped.
+     */
+    virtual std::size_t waitPopBulk(std::vector<T>& elements, std::size_t maxElements, int64_t timeout = 0) = 0;
+
     /**
      * @brief Try to pop an element from the queue.
      *
@@ -0,0 +1,140 @@
+#include <queue/laneQueue.hpp>
+
+#include <fmt/format.h>
+
+namespace base::queue
+{
+
+namespace
+{
+constexpr char LANE_SEPARATOR {','};
+constexpr char FIELD_SEPARATOR {':'};
+constexpr std::string_view OTHER_QUEUES {"*"};
+
+std::vector<std::string_view> split(std::string_view str, char separator)
+{
+    std::vector<std::string_view> parts;
+    while (true)
+    {
+        const auto end = str.find(separator);
+        parts.push_back(str.substr(0, end));
+        if (end == std::string_view::npos)
+        {
+            return parts;
+        }
+        str.remove_prefix(end + 1);
+    }
+}
+
+LaneFlood parseFlood(std::string_view flood, std::string_view lane)
+{
+    if (flood == "block")
+    {
+        return LaneFlood::BLOCK;
+    }
+    if (flood == "spill")
+    {
+        return LaneFlood::SPILL;
+    }
+    if (flood == "drop")
+    {
+        return LaneFlood::DROP;
+    }
+    throw std::runtime_error(
+        fmt::format("Invalid flooding policy '{}' of the lane '{}', it must be block, spill or drop", flood, lane));
+}
+} // namespace
+
+std::vector<LaneSpec> parseLaneSpecs(std::string_view specs)
+{
+    std::vector<LaneSpec> lanes;
+    if (specs.empty())
+    {
+        return lanes;
+    }
+
+    std::array<bool, 256> seen {};
+    bool other {false};
+    for (const auto lane : split(specs, LANE_SEPARATOR))
+    {
+        const auto fields = split(lane, FIELD_SEPARATOR);
+        if (fields.size() < 2 || fields.size() > 3 || fields[0].empty())
+        {
+            throw std::runtime_error(
+                fmt::format("Invalid lane '{}', it must be <queue ids>:<weight>[:<flooding policy>]", lane));
+        }
+
+        std::size_t weight {0};
+        for (const auto digit : fields[1])
+        {
+            if (digit < '0' || digit > '9' || weight > MAX_LANE_WEIGHT)
+            {
+                weight = 0;
+                break;
+            }
+            weight = weight * 10 + static_cast<std::size_t>(digit - '0');
+        }
+        if (weight == 0 || weight > MAX_LANE_WEIGHT)
+        {
+            throw std::runtime_error(
+                fmt::format("Invalid weight of the lane '{}', it must be between 1 and {}", lane, MAX_LANE_WEIGHT));
+        }
+
+        if (fields[0] == OTHER_QUEUES)
+        {
+            if (other)
+            {
+                throw std::runtime_error("Only one lane can take the events of the other queues");
+            }
+            other = true;
+        }
+        else
+        {
+            for (const auto queue : fields[0])
+            {
+                auto& inLane = seen[static_cast<unsigned char>(queue)];
+                if (inLane)
+                {
+                    throw std::runtime_error(fmt::format("The queue '{}' is in more than one lane", queue));
+                }
+                inLane = true;
+            }
+        }
+
+        std::optional<LaneFlood> flood;
+        if (fields.size() == 3)
+        {
+            flood = parseFlood(fields[2], lane);
+        }
+        lanes.push_back({std::string(fields[0]), weight, flood});
+    }
+
+    return lanes;
+}
+
+std::array<std::size_t, 256> laneTable(const std::vector<LaneSpec>& lanes)
+{
+    if (lanes.empty())
+    {
+        throw std::runtime_error("The lane table needs at least one lane");
+    }
+
+    const auto other =
+        std::find_if(lanes.begin(), lanes.end(), [](const auto& lane) { return lane.queues == OTHER_QUEUES; });
+    std::array<std::size_t, 256> table {};
+    table.fill(other != lanes.end() ? static_cast<std::size_t>(other - lanes.begin()) : lanes.size() - 1);
+
+    for (std::size_t index = 0; index < lanes.size(); ++index)
+    {
+        if (lanes[index].queues != OTHER_QUEUES)
+        {
+            for (const auto queue : lanes[index].queues)
+            {
+                table[static_cast<unsigned char>(queue)] = index;
+            }
+        }
+    }
+    return table;
+}
+
+} // namespace base::queue
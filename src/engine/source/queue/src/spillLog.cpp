@@ -0,0 +1,152 @@
+#include <queue/spillLog.hpp>
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace base::queue
+{
+
+SpillLog::SpillLog(const std::string& path, std::size_t segmentSize, std::size_t segments)
+    : m_fd {-1}
+    , m_data {nullptr}
+    , m_segmentSize {segmentSize}
+    , m_segments {segments}
+    , m_error {}
+    , m_mutex {}
+    , m_ends(segments, 0)
+    , m_writeSegment {0}
+    , m_readSegment {0}
+    , m_readOffset {0}
+    , m_size {0}
+{
+    if (m_segmentSize <= sizeof(RecordSize) || m_segments < 2)
+    {
+        m_error = "Invalid spill log geometry";
+        return;
+    }
+
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0640);
+    if (m_fd < 0)
+    {
+        m_error = strerror(errno);
+        return;
+    }
+
+    // The file is sparse, disk blocks are only used by the written records
+    const auto fileSize = m_segmentSize * m_segments;
+    if (::ftruncate(m_fd, static_cast<off_t>(fileSize)) != 0)
+    {
+        m_error = strerror(errno);
+        return;
+    }
+
+    auto data = ::mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (data == MAP_FAILED)
+    {
+        m_error = strerror(errno);
+        return;
+    }
+    m_data = static_cast<char*>(data);
+}
+
+SpillLog::~SpillLog()
+{
+    if (m_data != nullptr)
+    {
+        ::munmap(m_data, m_segmentSize * m_segments);
+    }
+
+    if (m_fd >= 0)
+    {
+        ::close(m_fd);
+    }
+}
+
+std::optional<std::string> SpillLog::getError() const
+{
+    if (m_data != nullptr)
+    {
+        return std::nullopt;
+    }
+    else if (m_error.empty())
+    {
+        return "Unknown error";
+    }
+    return m_error;
+}
+
+bool SpillLog::write(std::string_view record)
+{
+    const auto recordSize = sizeof(RecordSize) + record.size();
+    if (m_data == nullptr || recordSize > m_segmentSize)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock {m_mutex};
+
+    if (m_ends[m_writeSegment] + recordSize > m_segmentSize)
+    {
+        // Rotate, unless the next segment has not been drained yet
+        auto next = (m_writeSegment + 1) % m_segments;
+        if (next == m_readSegment)
+        {
+            return false;
+        }
+        m_writeSegment = next;
+        m_ends[m_writeSegment] = 0;
+    }
+
+    auto dst = segment(m_writeSegment) + m_ends[m_writeSegment];
+    auto size = static_cast<RecordSize>(record.size());
+    std::memcpy(dst, &size, sizeof(RecordSize));
+    std::memcpy(dst + sizeof(RecordSize), record.data(), record.size());
+    m_ends[m_writeSegment] += recordSize;
+    m_size.fetch_add(1, std::memory_order_relaxed);
+
+    return true;
+}
+
+bool SpillLog::read(std::string& record)
+{
+    if (empty())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock {m_mutex};
+
+    // Move to the next segment once the current one is drained and the writer has left it
+    while (m_readOffset == m_ends[m_readSegment] && m_readSegment != m_writeSegment)
+    {
+        m_readSegment = (m_readSegment + 1) % m_segments;
+        m_readOffset = 0;
+    }
+
+    if (m_readOffset == m_ends[m_readSegment])
+    {
+        return false;
+    }
+
+    auto src = segment(m_readSegment) + m_readOffset;
+    RecordSize size;
+    std::memcpy(&size, src, sizeof(RecordSize));
+    record.assign(src + sizeof(RecordSize), size);
+    m_readOffset += sizeof(RecordSize) + size;
+    m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    // Rewind the ring when it is drained, so the writer starts over the same segment
+    if (m_readSegment == m_writeSegment && m_readOffset == m_ends[m_writeSegment])
+    {
+        m_readOffset = 0;
+        m_ends[m_writeSegment] = 0;
+    }
+
+    return true;
+}
+
+} // namespace base::queue
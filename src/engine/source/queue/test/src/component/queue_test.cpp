@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <filesystem>
+#include <thread>
+
 #include <gtest/gtest.h>
 
 #include <queue/concurrentQueue.hpp>
+#include <queue/laneQueue.hpp>
+#include <queue/shardedQueue.hpp>
 
 #include "fakeMetric.hpp" // TODO Remove after implementing metrics mocks 
 
@@ -17,6 +23,12 @@ public:
     {
     }
 
+    // Rebuilds the dummy from its str
+    explicit Dummy(const char* str)
+        : value(std::stoi(std::string(str).substr(sizeof("Dummy: ") - 1)))
+    {
+    }
+
     std::string str() const { return "Dummy: " + std::to_string(value); }
 };
 
@@ -33,28 +45,72 @@ protected:
 
     void TearDown() override {}
 };
-TEST(FloodingFileTest, CanOpenAndWriteToFile)
+TEST(SpillLogTest, CanWriteAndRead)
 {
-    std::string filename = "testfile.txt";
+    std::string filename = "testspill.log";
     {
-        FloodingFile ff(filename);
-        ASSERT_FALSE(ff.getError().has_value());
-        ASSERT_TRUE(ff.write("This is a test message"));
+        SpillLog log(filename);
+        ASSERT_FALSE(log.getError().has_value());
+        ASSERT_TRUE(log.empty());
+        ASSERT_TRUE(log.write("first"));
+        ASSERT_TRUE(log.write("second"));
+        ASSERT_EQ(log.size(), 2);
+
+        std::string record;
+        ASSERT_TRUE(log.read(record));
+        ASSERT_EQ(record, "first");
+        ASSERT_TRUE(log.read(record));
+        ASSERT_EQ(record, "second");
+        ASSERT_FALSE(log.read(record));
+        ASSERT_TRUE(log.empty());
     }
-    std::ifstream testfile(filename);
-    std::string line;
-    std::getline(testfile, line);
-    ASSERT_EQ(line, "This is a test message");
-    testfile.close();
     std::filesystem::remove(filename);
 }
 
-TEST(FloodingFileTest, CannotOpenFile)
+TEST(SpillLogTest, RotatesSegments)
+{
+    std::string filename = "testspill.log";
+    {
+        // Each segment fits 2 records of 12 bytes (4 bytes of header)
+        SpillLog log(filename, 32, 3);
+        ASSERT_FALSE(log.getError().has_value());
+        for (auto i = 0; i < 6; ++i)
+        {
+            ASSERT_TRUE(log.write("record_" + std::to_string(i)));
+        }
+        // All segments are in use
+        ASSERT_FALSE(log.write("record_6"));
+
+        // Drain the first segment, the writer can use it again
+        std::string record;
+        ASSERT_TRUE(log.read(record));
+        ASSERT_EQ(record, "record_0");
+        ASSERT_TRUE(log.read(record));
+        ASSERT_EQ(record, "record_1");
+        ASSERT_FALSE(log.write("record_6"));
+        ASSERT_TRUE(log.read(record));
+        ASSERT_EQ(record, "record_2");
+        ASSERT_TRUE(log.write("record_6"));
+
+        for (auto i = 3; i < 7; ++i)
+        {
+            ASSERT_TRUE(log.read(record));
+            ASSERT_EQ(record, "record_" + std::to_string(i));
+        }
+        ASSERT_TRUE(log.empty());
+
+        // The record does not fit in a segment
+        ASSERT_FALSE(log.write(std::string(32, 'a')));
+    }
+    std::filesystem::remove(filename);
+}
+
+TEST(SpillLogTest, CannotOpenFile)
 {
     std::string invalid_path = "/nonexistent_dir/nonexistent_file.txt";
-    FloodingFile ff(invalid_path);
-    ASSERT_TRUE(ff.getError().has_value());
-    ASSERT_FALSE(ff.write("This should fail"));
+    SpillLog log(invalid_path);
+    ASSERT_TRUE(log.getError().has_value());
+    ASSERT_FALSE(log.write("This should fail"));
 }
 
 TEST_F(ConcurrentQueueTest, CanConstruct)
@@ -104,19 +160,18 @@ TEST_F(ConcurrentQueueTest, FloodsWhenFull)
         cq.push(std::make_shared<Dummy>(i));
     }
 
+    // The flooded events are spilled to the log and counted in the size
     ASSERT_FALSE(cq.empty());
-    ASSERT_EQ(cq.size(), 32);
+    ASSERT_EQ(cq.size(), 35);
 
-    std::ifstream floodfile(flood_file);
-    int num_flooded = 0;
-    std::string line;
-    while (std::getline(floodfile, line))
+    // The spilled events are moved back to the queue in order
+    for (int i = 0; i < 35; i++)
     {
-        num_flooded++;
+        auto d = std::make_shared<Dummy>(-1);
+        ASSERT_TRUE(cq.waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
     }
-
-    ASSERT_EQ(num_flooded, 3);
-    floodfile.close();
+    ASSERT_TRUE(cq.empty());
     std::filesystem::remove(flood_file);
 }
 
@@ -128,3 +183,351 @@ TEST_F(ConcurrentQueueTest, Timeout)
     ASSERT_FALSE(cq.waitPop(d, 0));
     ASSERT_EQ(d->value, 0);
 }
+
+TEST_F(ConcurrentQueueTest, CanPopBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        8, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    for (int i = 0; i < 5; i++)
+    {
+        cq.push(std::make_shared<Dummy>(i));
+    }
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 3), 3);
+    ASSERT_EQ(batch.size(), 3);
+    ASSERT_EQ(batch[0]->value, 0);
+    ASSERT_EQ(batch[2]->value, 2);
+    ASSERT_EQ(cq.size(), 2);
+
+    ASSERT_EQ(cq.waitPopBulk(batch, 10), 2);
+    ASSERT_EQ(batch.size(), 5);
+    ASSERT_EQ(batch[4]->value, 4);
+    ASSERT_TRUE(cq.empty());
+}
+
+TEST_F(ConcurrentQueueTest, PopBulkTimeout)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(cq.waitPopBulk(batch, 4, 0), 0);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.waitPopBulk(batch, 0, 0), 0);
+}
+
+TEST_F(ConcurrentQueueTest, CanPushBulk)
+{
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        8, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 5; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+
+    cq.pushBulk(batch);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.size(), 5);
+
+    ASSERT_EQ(cq.waitPopBulk(batch, 10), 5);
+    for (int i = 0; i < 5; i++)
+    {
+        ASSERT_EQ(batch[i]->value, i);
+    }
+}
+
+TEST_F(ConcurrentQueueTest, PushBulkFloodsWhenFull)
+{
+    std::string flood_file = "floodfile_bulk.txt";
+    ConcurrentQueue<std::shared_ptr<Dummy>> cq(
+        32, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), flood_file, 3, 500);
+
+    // The bulk does not fit, its elements are pushed one by one and the ones left are spilled
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 40; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+    cq.pushBulk(batch);
+    ASSERT_TRUE(batch.empty());
+    ASSERT_EQ(cq.size(), 40);
+
+    for (int i = 0; i < 40; i++)
+    {
+        auto d = std::make_shared<Dummy>(-1);
+        ASSERT_TRUE(cq.waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
+    }
+    ASSERT_TRUE(cq.empty());
+    std::filesystem::remove(flood_file);
+}
+
+namespace
+{
+using DummyQueue = iQueue<std::shared_ptr<Dummy>>;
+
+// Sharded queue of ConcurrentQueue shards, keyed by the value of the dummy
+std::shared_ptr<ShardedQueue<std::shared_ptr<Dummy>>> makeShardedQueue(std::size_t shards, bool steal)
+{
+    std::vector<std::shared_ptr<DummyQueue>> queues;
+    for (std::size_t i = 0; i < shards; ++i)
+    {
+        queues.emplace_back(std::make_shared<ConcurrentQueue<std::shared_ptr<Dummy>>>(
+            64, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>()));
+    }
+
+    return std::make_shared<ShardedQueue<std::shared_ptr<Dummy>>>(
+        std::move(queues), [](const std::shared_ptr<Dummy>& dummy) { return dummy->value; }, steal);
+}
+} // namespace
+
+TEST_F(ConcurrentQueueTest, ShardedQueueErrorConstructor)
+{
+    using Sharded = ShardedQueue<std::shared_ptr<Dummy>>;
+    auto keyOf = [](const std::shared_ptr<Dummy>& dummy) -> std::size_t { return dummy->value; };
+
+    ASSERT_THROW(Sharded({}, keyOf, false), std::runtime_error);
+    ASSERT_THROW(Sharded({nullptr}, keyOf, false), std::runtime_error);
+
+    std::vector<std::shared_ptr<DummyQueue>> queues {std::make_shared<ConcurrentQueue<std::shared_ptr<Dummy>>>(
+        2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>())};
+    ASSERT_THROW(Sharded(queues, nullptr, false), std::runtime_error);
+}
+
+TEST_F(ConcurrentQueueTest, ShardedQueueRoutesByKey)
+{
+    auto queue = makeShardedQueue(2, false);
+    auto even = queue->consumer(0);
+    auto odd = queue->consumer(1);
+
+    // Same key, same shard and order
+    for (int i = 0; i < 6; i++)
+    {
+        queue->push(std::make_shared<Dummy>(i));
+    }
+    ASSERT_EQ(queue->size(), 6);
+    ASSERT_EQ(even->size(), 3);
+    ASSERT_EQ(odd->size(), 3);
+
+    for (int i = 0; i < 6; i += 2)
+    {
+        auto d = std::make_shared<Dummy>(-1);
+        ASSERT_TRUE(even->waitPop(d, 0));
+        ASSERT_EQ(d->value, i);
+    }
+
+    // Without stealing, the consumer of an empty shard does not take the elements of the others
+    auto d = std::make_shared<Dummy>(-1);
+    ASSERT_FALSE(even->waitPop(d, 0));
+    ASSERT_FALSE(even->tryPop(d));
+    ASSERT_EQ(odd->size(), 3);
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(odd->waitPopBulk(batch, 10, 0), 3);
+    ASSERT_EQ(batch[0]->value, 1);
+    ASSERT_EQ(batch[2]->value, 5);
+    ASSERT_TRUE(queue->empty());
+}
+
+TEST_F(ConcurrentQueueTest, ShardedQueuePushBulk)
+{
+    auto queue = makeShardedQueue(3, false);
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 9; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+
+    queue->pushBulk(batch);
+    ASSERT_TRUE(batch.empty());
+    for (std::size_t shard = 0; shard < 3; ++shard)
+    {
+        auto consumer = queue->consumer(shard);
+        ASSERT_EQ(consumer->waitPopBulk(batch, 10, 0), 3);
+        for (const auto& dummy : batch)
+        {
+            ASSERT_EQ(static_cast<std::size_t>(dummy->value % 3), shard);
+        }
+        batch.clear();
+    }
+}
+
+TEST_F(ConcurrentQueueTest, ShardedQueueSteals)
+{
+    auto queue = makeShardedQueue(2, true);
+    auto even = queue->consumer(0);
+
+    queue->push(std::make_shared<Dummy>(1));
+    queue->push(std::make_shared<Dummy>(3));
+    queue->push(std::make_shared<Dummy>(5));
+
+    // The own shard is empty, the elements of the other are popped
+    auto d = std::make_shared<Dummy>(-1);
+    ASSERT_TRUE(even->waitPop(d, 0));
+    ASSERT_EQ(d->value, 1);
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(even->waitPopBulk(batch, 10, 0), 2);
+    ASSERT_TRUE(queue->empty());
+
+    // Nothing to steal, the timeout expires
+    ASSERT_FALSE(even->waitPop(d, 2000));
+    ASSERT_EQ(even->waitPopBulk(batch, 10, 2000), 0);
+}
+
+TEST_F(ConcurrentQueueTest, ShardedQueuePopsAllShards)
+{
+    auto queue = makeShardedQueue(4, false);
+    for (int i = 0; i < 4; i++)
+    {
+        queue->push(std::make_shared<Dummy>(i));
+    }
+
+    // The queue itself pops from every shard
+    std::vector<int> values;
+    auto d = std::make_shared<Dummy>(-1);
+    while (queue->tryPop(d))
+    {
+        values.push_back(d->value);
+    }
+    std::sort(values.begin(), values.end());
+    ASSERT_EQ(values, (std::vector<int> {0, 1, 2, 3}));
+}
+
+namespace
+{
+// Lane queue of ConcurrentQueue lanes, the dummies above 100 go to the second lane
+std::shared_ptr<LaneQueue<std::shared_ptr<Dummy>>> makeLaneQueue(std::size_t highWeight, std::size_t lowWeight)
+{
+    std::vector<LaneQueue<std::shared_ptr<Dummy>>::Lane> lanes;
+    for (const auto weight : {highWeight, lowWeight})
+    {
+        lanes.push_back({std::make_shared<ConcurrentQueue<std::shared_ptr<Dummy>>>(
+                             1024, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>()),
+                         weight});
+    }
+
+    return std::make_shared<LaneQueue<std::shared_ptr<Dummy>>>(
+        std::move(lanes), [](const std::shared_ptr<Dummy>& dummy) -> std::size_t { return dummy->value > 100; });
+}
+} // namespace
+
+TEST_F(ConcurrentQueueTest, LaneQueueErrorConstructor)
+{
+    using Lanes = LaneQueue<std::shared_ptr<Dummy>>;
+    auto laneOf = [](const std::shared_ptr<Dummy>&) -> std::size_t { return 0; };
+    auto queue = std::make_shared<ConcurrentQueue<std::shared_ptr<Dummy>>>(
+        2, std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>());
+
+    ASSERT_THROW(Lanes({}, laneOf), std::runtime_error);
+    ASSERT_THROW(Lanes({{nullptr, 1}}, laneOf), std::runtime_error);
+    ASSERT_THROW(Lanes({{queue, 0}}, laneOf), std::runtime_error);
+    ASSERT_THROW(Lanes({{queue, MAX_LANE_WEIGHT + 1}}, laneOf), std::runtime_error);
+    ASSERT_THROW(Lanes({{queue, 1}}, nullptr), std::runtime_error);
+}
+
+TEST_F(ConcurrentQueueTest, LaneQueuePopsByWeight)
+{
+    auto queue = makeLaneQueue(3, 1);
+
+    // The low lane is flooded, the high one still gets three pops out of four
+    std::vector<std::shared_ptr<Dummy>> batch;
+    for (int i = 0; i < 12; i++)
+    {
+        batch.push_back(std::make_shared<Dummy>(1000 + i));
+        batch.push_back(std::make_shared<Dummy>(i));
+    }
+    queue->pushBulk(batch);
+    ASSERT_EQ(queue->lane(0)->size(), 12);
+    ASSERT_EQ(queue->lane(1)->size(), 12);
+
+    std::size_t high {0};
+    auto d = std::make_shared<Dummy>(-1);
+    for (int i = 0; i < 8; i++)
+    {
+        ASSERT_TRUE(queue->waitPop(d, 0));
+        high += d->value < 100;
+    }
+    ASSERT_EQ(high, 6);
+
+    // Each lane keeps its order
+    ASSERT_TRUE(queue->waitPop(d, 0));
+    ASSERT_EQ(d->value, 6);
+}
+
+TEST_F(ConcurrentQueueTest, LaneQueueNeverStarvesALane)
+{
+    auto queue = makeLaneQueue(1, 1);
+    queue->push(std::make_shared<Dummy>(1000));
+    for (int i = 0; i < 10; i++)
+    {
+        queue->push(std::make_shared<Dummy>(i));
+    }
+
+    // The low lane is served within the first round
+    auto d = std::make_shared<Dummy>(-1);
+    bool low {false};
+    for (int i = 0; i < 2; i++)
+    {
+        ASSERT_TRUE(queue->waitPop(d, 0));
+        low = low || d->value == 1000;
+    }
+    ASSERT_TRUE(low);
+}
+
+TEST_F(ConcurrentQueueTest, LaneQueuePopBulkFillsFromTheOtherLanes)
+{
+    auto queue = makeLaneQueue(1, 1);
+    queue->push(std::make_shared<Dummy>(1));
+    queue->push(std::make_shared<Dummy>(1001));
+    queue->push(std::make_shared<Dummy>(1002));
+
+    std::vector<std::shared_ptr<Dummy>> batch;
+    ASSERT_EQ(queue->waitPopBulk(batch, 10, 0), 3);
+    ASSERT_TRUE(queue->empty());
+
+    // Nothing to pop, the timeout expires
+    auto d = std::make_shared<Dummy>(-1);
+    ASSERT_FALSE(queue->waitPop(d, 2000));
+    ASSERT_EQ(queue->waitPopBulk(batch, 10, 2000), 0);
+
+    // A blocked consumer gets the elements of any lane
+    std::thread producer([&queue]() { queue->push(std::make_shared<Dummy>(2000)); });
+    ASSERT_TRUE(queue->waitPop(d, -1));
+    ASSERT_EQ(d->value, 2000);
+    producer.join();
+}
+
+TEST(LaneSpecsTest, Parse)
+{
+    ASSERT_TRUE(parseLaneSpecs("").empty());
+
+    auto lanes = parseLaneSpecs("3:8,8d:1:drop,*:4:spill");
+    ASSERT_EQ(lanes.size(), 3);
+    ASSERT_EQ(lanes[0].queues, "3");
+    ASSERT_EQ(lanes[0].weight, 8);
+    ASSERT_FALSE(lanes[0].flood);
+    ASSERT_EQ(lanes[1].queues, "8d");
+    ASSERT_EQ(lanes[1].flood, LaneFlood::DROP);
+    ASSERT_EQ(lanes[2].flood, LaneFlood::SPILL);
+
+    auto table = laneTable(lanes);
+    ASSERT_EQ(table['3'], 0);
+    ASSERT_EQ(table['8'], 1);
+    ASSERT_EQ(table['d'], 1);
+    ASSERT_EQ(table['1'], 2);
+
+    // Without a lane for the other queues they go to the last one
+    ASSERT_EQ(laneTable(parseLaneSpecs("*:1,3:2,8:1"))['3'], 1);
+    ASSERT_EQ(laneTable(parseLaneSpecs("3:2,8:1"))['1'], 1);
+}
+
+TEST(LaneSpecsTest, Invalid)
+{
+    for (const auto specs : {"3", "3:", ":1", "3:0", "3:1001", "3:x", "3:1:wait", "3:1:drop:x", "3:1,3:2", "*:1,*:2",
+                             "3:1,"})
+    {
+        ASSERT_THROW(parseLaneSpecs(specs), std::runtime_error) << specs;
+    }
+}
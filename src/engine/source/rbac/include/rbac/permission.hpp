@@ -1,6 +1,7 @@
 #ifndef _RBAC_PERMISSION_HPP
 #define _RBAC_PERMISSION_HPP
 
+#include <bitset>
 #include <string>
 #include <variant>
 
@@ -14,8 +15,15 @@ namespace detail
 {
 auto constexpr OP_JPATH = "/operation";
 auto constexpr RES_JPATH = "/resource";
+auto constexpr RESOURCE_COUNT = static_cast<std::size_t>(Resource::ASSET) + 1;
+auto constexpr OPERATION_COUNT = static_cast<std::size_t>(Operation::WRITE) + 1;
 } // namespace detail
 
+/**
+ * @brief Set of permissions with one bit per resource and operation, so a permission is checked with a single test.
+ */
+using PermissionSet = std::bitset<detail::RESOURCE_COUNT * detail::OPERATION_COUNT>;
+
 class Permission
 {
 private:
@@ -38,6 +46,14 @@ public:
 
     const Operation& getOperation() const { return m_operation; }
 
+    /**
+     * @brief Get the bit of the permission in a PermissionSet.
+     */
+    std::size_t index() const
+    {
+        return static_cast<std::size_t>(m_resource) * detail::OPERATION_COUNT + static_cast<std::size_t>(m_operation);
+    }
+
     std::string getName() const { return std::string(resToStr(m_resource)) + "." + std::string(opToStr(m_operation)); }
 
     friend inline bool operator==(const Permission& lhs, const Permission& rhs)
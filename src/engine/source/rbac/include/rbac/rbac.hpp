@@ -2,8 +2,10 @@
 #define _RBAC_RBAC_HPP
 
 #include <map>
+#include <memory>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
 
 #include <fmt/format.h>
 
@@ -30,7 +32,10 @@ constexpr auto ROLE_WAZUH = "wazuh";
 class RBAC : public IRBAC
 {
 private:
+    using CompiledRoles = std::unordered_map<std::string, PermissionSet>;
+
     std::map<std::string, Role> m_roles;
+    std::shared_ptr<const CompiledRoles> m_compiledRoles; ///< Permissions of each role, shared by the AuthFns
     // std::unordered_map<std::string, Subject> m_subjects;
 
     std::weak_ptr<store::IStoreInternal> m_store;
@@ -112,6 +117,17 @@ private:
         m_roles[defaultModel::ROLE_SYSTEM] = Role(defaultModel::ROLE_SYSTEM, permissions);
     }
 
+    void compileRoles()
+    {
+        auto compiledRoles = std::make_shared<CompiledRoles>();
+        compiledRoles->reserve(m_roles.size());
+        for (const auto& [roleName, role] : m_roles)
+        {
+            compiledRoles->emplace(roleName, role.getPermissionSet());
+        }
+        m_compiledRoles = std::move(compiledRoles);
+    }
+
 public:
     RBAC(std::weak_ptr<store::IStoreInternal> store)
         : m_store(store)
@@ -128,26 +144,18 @@ public:
                 LOG_WARNING("Could not save RBAC model: {}", saveError->message);
             }
         }
+
+        compileRoles();
     }
 
     AuthFn getAuthFn(Resource res, Operation op) const override
     {
-        auto permission = Permission(res, op);
+        const auto bit = Permission(res, op).index();
 
-        return [permission, roles = m_roles](const std::string& roleName)
+        return [bit, roles = m_compiledRoles](const std::string& roleName)
         {
-            auto role = roles.find(roleName);
-            if (role == roles.end())
-            {
-                return false;
-            }
-
-            if (role->second.getPermissions().find(permission) == role->second.getPermissions().end())
-            {
-                return false;
-            }
-
-            return true;
+            auto role = roles->find(roleName);
+            return role != roles->end() && role->second.test(bit);
         };
     }
 
@@ -35,6 +35,19 @@ public:
 
     const std::set<Permission>& getPermissions() const { return m_permissions; }
 
+    /**
+     * @brief Get the permissions of the role as a PermissionSet.
+     */
+    PermissionSet getPermissionSet() const
+    {
+        PermissionSet set;
+        for (const auto& permission : m_permissions)
+        {
+            set.set(permission.index());
+        }
+        return set;
+    }
+
     friend inline bool operator==(const Role& lhs, const Role& rhs)
     {
         return lhs.m_name == rhs.m_name && lhs.m_permissions == rhs.m_permissions;
@@ -186,4 +186,8 @@ INSTANTIATE_TEST_SUITE_P(RBAC,
                                            AuthInput {false, BAD_ROLE, BAD_RESOURCE, OK_OPERATION},
                                            AuthInput {false, BAD_ROLE, OK_RESOURCE, BAD_OPERATION},
                                            AuthInput {false, OK_ROLE, BAD_RESOURCE, BAD_OPERATION},
-                                           AuthInput {false, BAD_ROLE, BAD_RESOURCE, BAD_OPERATION}));
+                                           AuthInput {false, BAD_ROLE, BAD_RESOURCE, BAD_OPERATION},
+                                           AuthInput {true, "role2", Resource::ASSET, Operation::WRITE},
+                                           AuthInput {false, "role2", Resource::SYSTEM_ASSET, Operation::READ},
+                                           AuthInput {true, "role3", Resource::SYSTEM_ASSET, Operation::WRITE},
+                                           AuthInput {false, "role3", Resource::UNKNOWN, Operation::UNKNOWN}));
@@ -1,13 +1,22 @@
 #ifndef _ROUTER_ORCHESTATOR_HPP
 #define _ROUTER_ORCHESTATOR_HPP
 
+#include <condition_variable>
+#include <functional>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include <bk/icontroller.hpp>
+#include <bk/latency.hpp>
 #include <builder/ibuilder.hpp>
+#include <base/arenaAllocator.hpp>
 #include <base/parseEvent.hpp>
+#include <base/utils/cpuAffinity.hpp>
 #include <queue/iqueue.hpp>
 #include <store/istore.hpp>
 
@@ -24,6 +33,9 @@ using TestQueueType = base::queue::iQueue<test::QueueType>;
 class IWorker;
 class EnvironmentBuilder;
 class EntryConverter;
+class QueueProbe;
+class IngressFilter;
+class RouteLimits;
 
 // Change name to syncronizer
 class Orchestrator
@@ -38,29 +50,86 @@ protected:
     constexpr static const char* STORE_PATH_TESTER_TABLE = "router/tester/0"; ///< Default path for the tester state
     constexpr static const char* STORE_PATH_ROUTER_TABLE = "router/router/0"; ///< Default path for the router state
     constexpr static const char* STORE_PATH_ROUTER_EPS = "router/eps/0";      ///< Default path for the EPS state
+    constexpr static const char* STORE_PATH_ROUTER_INGRESS = "router/ingress/0"; ///< Path for the ingress rules
 
     // Workers synchronization
-    std::list<std::shared_ptr<IWorker>> m_workers; ///< List of workers
-    mutable std::shared_mutex m_syncMutex;         ///< Mutex for the Workers synchronization (1 query at a time)
+    std::list<std::shared_ptr<IWorker>> m_workers;     ///< List of workers
+    std::list<std::shared_ptr<IWorker>> m_testWorkers; ///< Test only workers, if empty m_workers run the tests
+    mutable std::shared_mutex m_syncMutex;             ///< Mutex for the Workers synchronization (1 query at a time)
 
     // Workers configuration
     std::shared_ptr<ProdQueueType> m_eventQueue;      ///< The event queue
     std::shared_ptr<TestQueueType> m_testQueue;       ///< The test queue
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< The environment builder
+    std::shared_ptr<QueueProbe> m_queueProbe;         ///< Probe of the queue wait, nullptr if it is disabled
+    std::shared_ptr<RouteLimits> m_routeLimits;       ///< EPS limiters of the routes, shared by the workers
+
+    // Ingress filter
+    std::shared_ptr<IngressFilter> m_ingressFilter;     ///< Pre-filter of the raw events, null for testing
+    std::function<void(std::string_view)> m_divertSink; ///< Receives the diverted events, unset to only drop them
 
     // Configuration options
     std::weak_ptr<store::IStoreInternal> m_wStore; ///< Read and store configurations
     base::Name m_storeTesterName;                  ///< Path of internal configuration state for testers
     base::Name m_storeRouterName;                  ///< Path of internal configuration state for routers
     std::size_t m_testTimeout;                     ///< Timeout for the tests
+    std::size_t m_testerIdleTimeout {0};           ///< Seconds before an idle tester environment is released
+    std::size_t m_batchSize {1};                   ///< Max events dequeued at once by each worker
+    int64_t m_batchLingerUsec {0};                 ///< Max time a worker waits for a batch to fill up
+    utils::affinity::CpuSet m_cpus;                ///< CPUs of the workers, empty if they are not pinned
+    bool m_dedicatedTesters {false};               ///< The tests are run by test only workers
+
+    // Workers scaling
+    std::size_t m_minThreads {0};       ///< Minimum number of production workers
+    std::size_t m_maxThreads {0};       ///< Maximum number of production workers, m_minThreads if not scaled
+    std::size_t m_scaleUpDepth {0};     ///< Queued events per worker above which the queue is backed up
+    int64_t m_scaleIntervalMsec {0};    ///< Interval between the scaling decisions
+    std::thread m_scaler;               ///< Thread that scales the workers, not started if they are not scaled
+    std::mutex m_scalerMutex;           ///< Protects the stop of the scaling thread
+    std::condition_variable m_scalerCv; ///< Wakes up the scaling thread to stop it
+    bool m_scalerStop {false};          ///< The scaling thread must stop
+
+    // Initial load
+    std::size_t m_numTestThreads {0};                         ///< Number of test only workers
+    std::vector<std::shared_ptr<ProdQueueType>> m_prodShards; ///< Queues of the production workers, if sharded
+    bool m_loadInBackground {false};                          ///< The workers are loaded by start() in m_loader
+    std::thread m_loader;                                     ///< Thread that loads the workers in the background
 
     using WorkerOp = std::function<base::OptError(const std::shared_ptr<IWorker>&)>;
-    base::OptError forEachWorker(const WorkerOp& f); ///< Apply the function f to each worker
+    base::OptError forEachWorker(const WorkerOp& f);     ///< Apply the function f to each worker
+    base::OptError forEachTestWorker(const WorkerOp& f); ///< Apply the function f to each worker running the tests
+
+    /**
+     * @brief Create a production worker
+     *
+     * @param index Index of the worker, selects its CPU
+     * @param queue Queue the worker pops from
+     */
+    std::shared_ptr<IWorker> makeProdWorker(std::size_t index, const std::shared_ptr<ProdQueueType>& queue) const;
+    std::function<std::size_t(std::size_t)> prodEpsLimit() const; ///< New share of the EPS limit of a worker
+
+    void runScaler();  ///< Scaling loop, samples the queue and the workers each interval
+    void scaleUp();    ///< Add a production worker with a copy of the environments of the others
+    void stopScaler(); ///< Stop the scaling thread, if it is running
+
+    void loadWorkers();  ///< Create the workers and build the initial states from the store
+    void startWorkers(); ///< Start the workers and the scaling thread, the workers must be locked
+    void stopLoader();   ///< Wait for the background load, if it is running
+
+    /**
+     * @brief Get the workers that run the tests, the test only workers if there are any or the production ones
+     */
+    const std::list<std::shared_ptr<IWorker>>& testWorkers() const
+    {
+        return m_testWorkers.empty() ? m_workers : m_testWorkers;
+    }
 
     void dumpTesters() const;                                                ///< Dump the testers to the store
     void dumpRouters() const;                                                ///< Dump the routers to the store
     void dumpEps() const;                                                    ///< Dump the EPS to the store
     void loadEpsCounter(const std::weak_ptr<store::IStoreInternal>& wStore); ///< Load the EPS counter from the store
+    void dumpIngressRules() const;                                           ///< Dump the ingress rules to the store
+    void loadIngressRules();                                                 ///< Load the ingress rules from the store
 
     /**
      * @brief Initialize a worker
@@ -75,19 +144,22 @@ protected:
                               const std::vector<EntryConverter>& testerEntries);
 
     base::OptError addWorker(std::shared_ptr<IWorker> worker); ///< Add a new worker to the list
+    void enqueue(base::Event&& event);                         ///< Push an event to the event queue
+    void enqueueBulk(std::vector<base::Event>& events);        ///< Push the events to the event queue at once
     base::OptError removeWorker();                             ///< Remove a worker from the list
 
     Orchestrator() = default; ///< Default constructor for testing purposes
 
 public:
-    ~Orchestrator() = default;
+    ~Orchestrator();
     /**
      * @brief Configuration for the Orchestrator
      *
      */
     struct Options
     {
-        int m_numThreads; ///< Number of workers to create
+        int m_numThreads;         ///< Number of workers to create, the minimum if they are scaled
+        int m_numTestThreads = 0; ///< Number of test only workers (0 = the production workers run the tests)
 
         std::weak_ptr<store::IStore> m_wStore;      ///< Store to read namespaces and configurations
         std::weak_ptr<builder::IBuilder> m_builder; ///< Builder use for creating environments
@@ -96,7 +168,50 @@ public:
         std::shared_ptr<ProdQueueType> m_prodQueue;              ///< The event queue
         std::shared_ptr<TestQueueType> m_testQueue;              ///< The test queue
 
-        int m_testTimeout; ///< Timeout for handlers of testers
+        /**
+         * @brief Queues of the production workers, one per worker, empty if they all pop from m_prodQueue. The events
+         * are still pushed to m_prodQueue, which routes them to these queues (e.g. the consumers of a ShardedQueue).
+         */
+        std::vector<std::shared_ptr<ProdQueueType>> m_prodShards;
+
+        int m_testTimeout;           ///< Timeout for handlers of testers
+        int m_testerIdleTimeout = 0; ///< Seconds before an idle tester environment is released (0 = load and keep)
+
+        int m_batchSize = 1;       ///< Max events dequeued at once by each worker (1 = batching disabled)
+        int m_batchLingerUsec = 0; ///< Max time in microseconds a worker waits for a batch to fill up
+
+        bool m_shareBuilds = false; ///< Build the environments once and share them among the workers
+
+        std::size_t m_latencySampleRate = 0; ///< Sample one in m_latencySampleRate events to time them (0 = disabled)
+        bk::LatencyRecorder m_queueLatency;  ///< Recorder of the sampled times the events wait in the queue
+
+        /**
+         * @brief CPUs of the workers, empty to not pin them. Each production worker is pinned to one of them in
+         * turn and the test workers to all of them. The environments are built on them too, so the policy memory is
+         * placed on their NUMA nodes.
+         */
+        utils::affinity::CpuSet m_cpus;
+
+        /**
+         * @brief Maximum number of production workers, 0 to keep m_numThreads. Above m_numThreads, the workers are
+         * added while the queue is backed up and the workers are busy, and removed once they are idle again. The
+         * environments of the added workers reuse the builds of the running ones. Not compatible with m_prodShards.
+         */
+        int m_maxThreads = 0;
+        int m_scaleUpDepth = 1000;      ///< Queued events per worker above which the queue is backed up
+        int m_scaleIntervalMsec = 1000; ///< Interval in milliseconds between the scaling decisions
+
+        /**
+         * @brief Load the workers in the background from start(), instead of in the constructor. The events are
+         * queued meanwhile and the API calls wait until the workers are loaded.
+         */
+        bool m_loadInBackground = false;
+
+        /**
+         * @brief Receives the raw events diverted by the ingress filter, it must be thread-safe. If unset, the ingress
+         * rules can only drop the events.
+         */
+        std::function<void(std::string_view)> m_divertSink;
 
         void validate() const; ///< Validate the configuration options if is invalid throw an  std::runtime_error
     };
@@ -106,6 +221,7 @@ public:
     /**
      * @brief Start the router
      *
+     * With m_loadInBackground, the workers are loaded and started in the background and this returns right away.
      */
     void start();
 
@@ -122,11 +238,12 @@ public:
      */
     void pushEvent(const std::string& eventStr)
     {
+        base::arena::ScopedSubsystem arena {base::arena::Subsystem::ROUTER};
         base::Event event;
         try
         {
             event = base::parseEvent::parseWazuhEvent(eventStr);
-            m_eventQueue->push(std::move(event));
+            enqueue(std::move(event));
         }
         catch (const std::exception& e)
         {
@@ -134,6 +251,23 @@ public:
         }
     }
 
+    /**
+     * @brief Parse a batch of events and push them to the event queue at once
+     *
+     * @param eventStrs The events to push, the ones that cannot be parsed are discarded
+     * @return std::size_t The number of events pushed
+     */
+    std::size_t pushEvents(const std::vector<std::string_view>& eventStrs);
+
+    /**
+     * @brief Check a raw event against the ingress filter, before it is parsed
+     *
+     * The diverted events are handed over to the divert sink here.
+     * @param eventStr The raw event
+     * @return true if the event must be pushed, false if it was dropped or diverted
+     */
+    bool admitEvent(std::string_view eventStr);
+
     /**************************************************************************
      * IRouterAPI
      *************************************************************************/
@@ -163,6 +297,11 @@ public:
      */
     base::OptError changeEntryPriority(const std::string& name, size_t priority) override;
 
+    /**
+     * @copydoc router::IRouterAPI::changeEntryEpsLimit
+     */
+    base::OptError changeEntryEpsLimit(const std::string& name, std::size_t epsLimit) override;
+
     /**
      * @copydoc router::IRouterAPI::getEntries
      */
@@ -171,13 +310,23 @@ public:
     /**
      * @copydoc router::IRouterAPI::postEvent
      */
-    void postEvent(base::Event&& event) override { m_eventQueue->push(std::move(event)); }
+    void postEvent(base::Event&& event) override { enqueue(std::move(event)); }
 
     /**
      * @copydoc router::IRouterAPI::postStrEvent
      */
     base::OptError postStrEvent(std::string_view event) override;
 
+    /**
+     * @copydoc router::IRouterAPI::postStrEvents
+     */
+    std::size_t postStrEvents(const std::vector<std::string_view>& events) override { return pushEvents(events); }
+
+    /**
+     * @copydoc router::IRouterAPI::sampleTraces
+     */
+    base::RespOrError<prod::SampledTraces> sampleTraces(const prod::TraceOptions& opt) override;
+
     /**
      * @copydoc router::IRouterAPI::changeEpsSettings
      */
@@ -193,6 +342,21 @@ public:
      */
     base::OptError activateEpsCounter(bool activate) override;
 
+    /**
+     * @copydoc router::IRouterAPI::postIngressRule
+     */
+    base::OptError postIngressRule(const prod::IngressRule& rule) override;
+
+    /**
+     * @copydoc router::IRouterAPI::deleteIngressRule
+     */
+    base::OptError deleteIngressRule(const std::string& name) override;
+
+    /**
+     * @copydoc router::IRouterAPI::getIngressRules
+     */
+    std::list<prod::IngressRule> getIngressRules() const override;
+
     /**************************************************************************
      * ITesterAPI
      *************************************************************************/
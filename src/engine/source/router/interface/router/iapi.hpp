@@ -4,6 +4,7 @@
 #include <future>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -24,6 +25,7 @@ public:
 
     virtual base::OptError reloadEntry(const std::string& name) = 0;
     virtual base::OptError changeEntryPriority(const std::string& name, size_t priority) = 0;
+    virtual base::OptError changeEntryEpsLimit(const std::string& name, std::size_t epsLimit) = 0;
 
     // Production: Table
     virtual std::list<prod::Entry> getEntries() const = 0;
@@ -31,6 +33,11 @@ public:
     // Production: Ingest
     virtual void postEvent(base::Event&& event) = 0;
     virtual base::OptError postStrEvent(std::string_view event) = 0;
+    // Parse a batch of events and push them at once, returns the number of events pushed
+    virtual std::size_t postStrEvents(const std::vector<std::string_view>& events) = 0;
+
+    // Production: Sampled traces of a live environment (blocks until the samples are collected or the timeout expires)
+    virtual base::RespOrError<prod::SampledTraces> sampleTraces(const prod::TraceOptions& opt) = 0;
 
     // Orchestrator: Change EPS settings
     virtual base::OptError changeEpsSettings(uint eps, uint refreshInterval) = 0;
@@ -40,6 +47,11 @@ public:
 
     // Orchestrator: Activate/Deactivate EPS counter
     virtual base::OptError activateEpsCounter(bool activate) = 0;
+
+    // Orchestrator: Ingress filter of the raw events, the rules are checked in the order they were added
+    virtual base::OptError postIngressRule(const prod::IngressRule& rule) = 0;
+    virtual base::OptError deleteIngressRule(const std::string& name) = 0;
+    virtual std::list<prod::IngressRule> getIngressRules() const = 0;
 };
 
 class ITesterAPI
@@ -7,6 +7,7 @@
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <vector>
 
 #include <base/logging.hpp>
 
@@ -51,6 +52,7 @@ private:
     base::Name m_filter;                      ///< Filter of the environment
     std::size_t m_priority;                   ///< Priority of the environment
     std::optional<std::string> m_description; ///< Description of the environment
+    std::size_t m_epsLimit;                   ///< Events per second routed to the policy, 0 for no limit
 
     static constexpr std::size_t MAX_PRIORITY = 1000; ///< Max priority of the environment
 
@@ -71,6 +73,7 @@ public:
         , m_description {}
         , m_filter {std::move(filter)}
         , m_priority {priority}
+        , m_epsLimit {0}
     {
     }
 
@@ -117,6 +120,9 @@ public:
     std::size_t priority() const { return m_priority; }
     void priority(std::size_t priority) { m_priority = priority; }
 
+    std::size_t epsLimit() const { return m_epsLimit; }
+    void epsLimit(std::size_t epsLimit) { m_epsLimit = epsLimit; }
+
     static std::size_t maxPriority() { return MAX_PRIORITY; }
 };
 
@@ -130,13 +136,15 @@ private:
     env::State m_status;        ///< Status of the environment
     std::uint64_t m_lastUpdate; /// Last update of the environment [TODO: Review this metadata]
     std::string m_hash;         /// Hash of the policy
+    std::uint64_t m_throttled;  ///< Events accepted by the filter and discarded by the EPS limit
 
 public:
     Entry(const EntryPost& entryPost)
         : EntryPost {entryPost}
         , m_lastUpdate {0}
         , m_policySync {env::Sync::UNKNOWN}
-        , m_status {env::State::UNKNOWN} {};
+        , m_status {env::State::UNKNOWN}
+        , m_throttled {0} {};
 
     // Setters and getters
     std::uint64_t lastUpdate() const { return m_lastUpdate; }
@@ -150,6 +158,9 @@ public:
 
     const std::string& hash() const { return m_hash; }
     void hash(const std::string& hash) { m_hash = hash; }
+
+    std::uint64_t throttled() const { return m_throttled; }
+    void throttled(std::uint64_t throttled) { m_throttled = throttled; }
 };
 
 } // namespace prod
@@ -361,6 +372,198 @@ using QueueType = std::shared_ptr<TestingTuple>;
 
 } // namespace test
 
+/**************************************************************************
+ *                 Sampled traces of production environments              *
+ *************************************************************************/
+namespace prod
+{
+
+/**
+ * @brief Options for sampling the traces of the events processed by a production environment
+ *
+ * The traces are collected from the live environment, without building a testing copy of the policy.
+ */
+class TraceOptions
+{
+private:
+    std::string m_environmentName;            ///< Name of the production environment
+    test::Options::TraceLevel m_traceLevel;   ///< Tracing level
+    std::unordered_set<std::string> m_assets; ///< Assets to trace
+    std::size_t m_sampleRate;                 ///< Trace one in m_sampleRate events
+    std::size_t m_maxSamples;                 ///< Number of traced events to collect
+    std::size_t m_timeoutMs;                  ///< Maximum time to wait for the samples (milliseconds)
+
+public:
+    /**
+     * @brief Create new options for sampling traces
+     *
+     * @param envName Name of the production environment
+     * @param traceLevel Tracing level
+     * @param assets Assets to trace
+     * @param sampleRate Trace one in sampleRate events processed by the environment
+     * @param maxSamples Number of traced events to collect
+     * @param timeoutMs Maximum time to wait for the samples, the ones collected until then are returned
+     */
+    TraceOptions(const std::string& envName,
+                 test::Options::TraceLevel traceLevel,
+                 const decltype(m_assets)& assets,
+                 std::size_t sampleRate,
+                 std::size_t maxSamples,
+                 std::size_t timeoutMs)
+        : m_environmentName {envName}
+        , m_traceLevel {traceLevel}
+        , m_assets {assets}
+        , m_sampleRate {sampleRate}
+        , m_maxSamples {maxSamples}
+        , m_timeoutMs {timeoutMs}
+    {
+    }
+
+    /**
+     * @brief Validate the options
+     *
+     * @return base::OptError Error if the options are not valid
+     */
+    base::OptError validate() const
+    {
+        if (m_environmentName.empty())
+        {
+            return base::Error {"Environment name cannot be empty"};
+        }
+
+        if (m_traceLevel == test::Options::TraceLevel::NONE || m_assets.empty())
+        {
+            return base::Error {"Trace level and assets must be set to sample traces"};
+        }
+
+        if (m_sampleRate == 0 || m_maxSamples == 0)
+        {
+            return base::Error {"Sample rate and number of samples must be greater than 0"};
+        }
+
+        if (m_timeoutMs == 0)
+        {
+            return base::Error {"Timeout must be greater than 0"};
+        }
+
+        return base::OptError {};
+    }
+
+    // Setters and getters
+    const std::string& environmentName() const { return m_environmentName; }
+    test::Options::TraceLevel traceLevel() const { return m_traceLevel; }
+    auto assets() const -> const decltype(m_assets)& { return m_assets; }
+    std::size_t sampleRate() const { return m_sampleRate; }
+    std::size_t maxSamples() const { return m_maxSamples; }
+    std::size_t timeoutMs() const { return m_timeoutMs; }
+};
+
+using SampledTraces = std::list<test::Output>; ///< Traced events, with their output and traces
+
+} // namespace prod
+
+/**************************************************************************
+ *                  Ingress filter of the raw events                      *
+ *************************************************************************/
+namespace prod
+{
+
+/**
+ * @brief Action of an ingress rule on the events it matches
+ */
+enum class IngressAction : std::uint8_t
+{
+    DROP,   ///< The event is discarded
+    DIVERT, ///< The event is handed over to the divert sink instead of being routed
+};
+
+/**
+ * @brief Rule of the ingress filter, matched on the raw event before it is parsed
+ *
+ * An event matches when all the conditions that are set match: the queue ID, the prefix of the location, as written
+ * in the raw event (with the colons escaped), and the substrings, that must all be somewhere in the raw event.
+ */
+class IngressRule
+{
+private:
+    std::string m_name;                  ///< Name of the rule
+    IngressAction m_action;              ///< Action on the matching events
+    std::optional<char> m_queue;         ///< Queue ID of the matching events
+    std::string m_locationPrefix;        ///< Prefix of the location of the matching events
+    std::vector<std::string> m_contains; ///< Substrings of the matching events
+    std::uint64_t m_hits;                ///< Events matched by the rule
+
+public:
+    IngressRule() = delete;
+
+    /**
+     * @brief New ingress rule, without conditions
+     *
+     * @param name Name of the rule
+     * @param action Action on the matching events
+     */
+    IngressRule(std::string name, IngressAction action)
+        : m_name {std::move(name)}
+        , m_action {action}
+        , m_queue {}
+        , m_locationPrefix {}
+        , m_contains {}
+        , m_hits {0}
+    {
+    }
+
+    /**
+     * @brief Validate the rule
+     *
+     * @return base::OptError Error if the rule is not valid
+     */
+    base::OptError validate() const
+    {
+        if (m_name.empty())
+        {
+            return base::Error {"Name cannot be empty"};
+        }
+        if (!m_queue && m_locationPrefix.empty() && m_contains.empty())
+        {
+            return base::Error {"At least one condition must be set"};
+        }
+        // An unescaped colon ends the location, the prefix would match the message
+        for (std::size_t i = 0; i < m_locationPrefix.size(); ++i)
+        {
+            if (m_locationPrefix[i] == ':' && (i == 0 || m_locationPrefix[i - 1] != '|'))
+            {
+                return base::Error {"Location prefix cannot contain unescaped colons"};
+            }
+        }
+        for (const auto& substring : m_contains)
+        {
+            if (substring.empty())
+            {
+                return base::Error {"Substrings cannot be empty"};
+            }
+        }
+        return base::OptError {};
+    }
+
+    // Setters and getters
+    const std::string& name() const { return m_name; }
+    IngressAction action() const { return m_action; }
+
+    const std::optional<char>& queue() const { return m_queue; }
+    void queue(char queue) { m_queue = queue; }
+
+    const std::string& locationPrefix() const { return m_locationPrefix; }
+    void locationPrefix(std::string_view prefix) { m_locationPrefix = prefix; }
+
+    const std::vector<std::string>& contains() const { return m_contains; }
+    void contains(std::vector<std::string> substrings) { m_contains = std::move(substrings); }
+
+    std::uint64_t hits() const { return m_hits; }
+    void hits(std::uint64_t hits) { m_hits = hits; }
+};
+
+} // namespace prod
+
 } // namespace router
 
 #endif // _ROUTER_TYPES_HPP
@@ -21,6 +21,11 @@ EntryConverter::EntryConverter(const prod::Entry& entry)
     , m_filter {entry.filter()}
     , m_priority {entry.priority()}
 {
+    // Unlimited routes are stored as before the limits existed
+    if (entry.epsLimit() > 0)
+    {
+        m_epsLimit = entry.epsLimit();
+    }
 }
 
 EntryConverter::EntryConverter(const json::Json& jEntry)
@@ -39,6 +44,10 @@ EntryConverter::EntryConverter(const json::Json& jEntry)
     m_lastUse = jEntry.getInt64(LAST_USE_PATH);
     m_filter = jEntry.getString(FILTER_PATH);
     m_priority = jEntry.getInt64(PRIORITY_PATH);
+    if (auto epsLimit = jEntry.getInt64(EPS_LIMIT_PATH); epsLimit && epsLimit.value() > 0)
+    {
+        m_epsLimit = static_cast<size_t>(epsLimit.value());
+    }
 }
 
 const std::string& EntryConverter::name() const
@@ -94,6 +103,11 @@ EntryConverter::operator json::Json() const
         jEntry.setInt64(static_cast<int64_t>(m_priority.value()), PRIORITY_PATH);
     }
 
+    if (m_epsLimit)
+    {
+        jEntry.setInt64(static_cast<int64_t>(m_epsLimit.value()), EPS_LIMIT_PATH);
+    }
+
     return jEntry;
 }
 
@@ -127,6 +141,10 @@ EntryConverter::operator prod::EntryPost() const
     {
         entryPost.description(m_description.value());
     }
+    if (m_epsLimit)
+    {
+        entryPost.epsLimit(m_epsLimit.value());
+    }
 
     return entryPost;
 }
@@ -1,5 +1,11 @@
 #include "environment.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "traceSampler.hpp"
+
 namespace
 {
 /**
@@ -92,4 +98,89 @@ bool Environment::isAccepted(const base::Event& event) const
     return evalExpr(m_filter, event);
 }
 
+struct Environment::TraceSession
+{
+    std::shared_ptr<TraceSampler> sampler;                               ///< Sampler shared by the workers
+    std::vector<std::pair<std::string, bk::Subscription>> subscriptions; ///< Subscriptions to the traced assets
+    std::shared_ptr<test::InternalOutput> current; ///< Output of the event being traced, nullptr if none
+};
+
+base::OptError Environment::attachSampler(const std::shared_ptr<TraceSampler>& sampler)
+{
+    std::lock_guard lock {m_traceMutex};
+    if (m_traceSession)
+    {
+        return base::Error {"A trace sampler is already attached to the environment"};
+    }
+
+    auto session = std::make_shared<TraceSession>();
+    session->sampler = sampler;
+    const auto level = sampler->options().traceLevel();
+    for (const auto& asset : sampler->options().assets())
+    {
+        // Only the traces of the sampled events are collected, the traces are published from the worker thread
+        bk::Subscriber subFn = [session = session.get(), asset, level](const std::string& trace, bool success)
+        {
+            if (session->current != nullptr)
+            {
+                session->current->addTrace(asset, trace, success, level);
+            }
+        };
+        auto subscription = m_controller->subscribe(asset, subFn);
+        if (base::isError(subscription))
+        {
+            for (const auto& [name, id] : session->subscriptions)
+            {
+                m_controller->unsubscribe(name, id);
+            }
+            return base::Error {
+                fmt::format("Cannot trace asset '{}': {}", asset, base::getError(subscription).message)};
+        }
+        session->subscriptions.emplace_back(asset, base::getResponse<bk::Subscription>(subscription));
+    }
+
+    m_traceSession = std::move(session);
+    m_tracing.store(true, std::memory_order_relaxed);
+    return std::nullopt;
+}
+
+void Environment::detachSampler(const std::shared_ptr<TraceSampler>& sampler)
+{
+    std::lock_guard lock {m_traceMutex};
+    if (!m_traceSession || (sampler != nullptr && m_traceSession->sampler != sampler))
+    {
+        return;
+    }
+
+    // No trace is published once the subscriptions are removed, so the session can be released
+    m_tracing.store(false, std::memory_order_relaxed);
+    for (const auto& [asset, id] : m_traceSession->subscriptions)
+    {
+        m_controller->unsubscribe(asset, id);
+    }
+    m_traceSession.reset();
+}
+
+void Environment::ingestTraced(base::Event&& event) const
+{
+    std::shared_ptr<TraceSession> session;
+    {
+        std::lock_guard lock {m_traceMutex};
+        session = m_traceSession;
+    }
+
+    if (!session || !session->sampler->next())
+    {
+        m_controller->ingest(std::move(event));
+        return;
+    }
+
+    session->current = std::make_shared<test::InternalOutput>();
+    session->current->event() = m_controller->ingestGet(std::move(event));
+    auto output = std::move(session->current);
+
+    // The output is handed over, the requester waits for it on its own thread
+    session->sampler->collect(std::move(*output));
+}
+
 } // namespace router
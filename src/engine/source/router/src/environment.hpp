@@ -1,24 +1,43 @@
 #ifndef _ROUTER_ENVIRONMENT_HPP
 #define _ROUTER_ENVIRONMENT_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 
 #include <bk/icontroller.hpp>
 #include <base/expression.hpp>
 
 #include <router/types.hpp>
 
+#include "filterIndex.hpp"
+
 namespace router
 {
 
+class TraceSampler;
+
 class Environment
 {
 
 private:
+    struct TraceSession; ///< Trace sampler attached to the environment
     base::Expression m_filter;                     ///< Filter of the route
+    std::optional<FilterKey> m_filterKey;          ///< Discriminating condition of the filter, if any
     std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy
     std::string m_hash;                            ///< Hash of the current policy (controller)
 
+    mutable std::mutex m_traceMutex;              ///< Protects the trace session
+    std::shared_ptr<TraceSession> m_traceSession; ///< Attached trace session, nullptr if none
+    std::atomic_bool m_tracing {false};           ///< True while a trace session is attached
+
+    /**
+     * @brief Ingest an event while a trace sampler is attached, the sampled events are traced
+     *
+     * @param event Event to ingest
+     */
+    void ingestTraced(base::Event&& event) const;
+
     /**
      * @brief Stop the controller
      */
@@ -40,6 +59,7 @@ public:
      */
     Environment(base::Expression&& filter, std::shared_ptr<bk::IController>&& controller, std::string&& hash)
         : m_filter {filter}
+        , m_filterKey {getFilterKey(m_filter)}
         , m_controller {controller}
         , m_hash {hash}
     {
@@ -73,14 +93,51 @@ public:
      *
      * @param event Event to ingest
      */
-    void ingest(base::Event&& event) const { m_controller->ingest(std::move(event)); }
+    void ingest(base::Event&& event) const
+    {
+        if (m_tracing.load(std::memory_order_relaxed))
+        {
+            ingestTraced(std::move(event));
+            return;
+        }
+        m_controller->ingest(std::move(event));
+    }
+
+    /**
+     * @brief Attach a trace sampler, the sampled events are traced on the live controller
+     *
+     * The traced assets are subscribed until the sampler is detached. The events that are not sampled are processed as
+     * usual and their traces ignored.
+     *
+     * @param sampler Sampler of the traces
+     * @return base::OptError Error if a sampler is already attached or an asset cannot be traced
+     */
+    base::OptError attachSampler(const std::shared_ptr<TraceSampler>& sampler);
+
+    /**
+     * @brief Detach the trace sampler
+     *
+     * @param sampler Sampler to detach, another attached sampler is kept. If nullptr, any sampler is detached
+     */
+    void detachSampler(const std::shared_ptr<TraceSampler>& sampler = nullptr);
 
     /**
      * @brief Set a new filter of the environment
      *
      * @param filter
      */
-    void setFilter(base::Expression&& filter) { m_filter = std::move(filter); }
+    void setFilter(base::Expression&& filter)
+    {
+        m_filter = std::move(filter);
+        m_filterKey = getFilterKey(m_filter);
+    }
+
+    /**
+     * @brief Get the discriminating equality condition of the filter, used to index the route
+     *
+     * @return const std::optional<FilterKey>& The condition, or std::nullopt if the filter has none
+     */
+    const std::optional<FilterKey>& filterKey() const { return m_filterKey; }
 
     /**
      * @brief Set the Controller object
@@ -92,6 +149,8 @@ public:
         {
             throw std::runtime_error {"Invalid controller"};
         }
+        // The subscriptions belong to the previous controller
+        detachSampler();
         m_controller = std::move(controller);
     }
 
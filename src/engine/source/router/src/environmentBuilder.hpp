@@ -1,10 +1,14 @@
 #ifndef _ROUTER_ENVIRONMENT_BUILD_HPP
 #define _ROUTER_ENVIRONMENT_BUILD_HPP
 
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
+#include <base/logging.hpp>
 #include <bk/icontroller.hpp>
 #include <builder/ibuilder.hpp>
 
@@ -19,10 +23,81 @@ namespace router
  */
 class EnvironmentBuilder
 {
+public:
+    class SharedScope;
+    class ReuseScope;
+
 private:
     std::weak_ptr<builder::IBuilder> m_builder;              ///< The builder used to construct the policy and filter.
     std::shared_ptr<bk::IControllerMaker> m_controllerMaker; ///< The controller maker used to construct the controller.
 
+    // Shared builds, see SharedScope
+    bool m_shareBuilds;                                                            ///< Share the builds in a scope
+    std::mutex m_sharedMutex;                                                      ///< Protects the shared builds
+    std::size_t m_sharedScopes;                                                    ///< Open shared scopes
+    std::unordered_map<std::string, std::shared_ptr<builder::IPolicy>> m_policies; ///< Policies built in the scope
+    std::unordered_map<std::string, base::Expression> m_filters;                   ///< Filters built in the scope
+
+    // Retained builds, see ReuseScope
+    bool m_retainBuilds;                                                                   ///< Keep the last builds
+    std::size_t m_reuseScopes;                                                             ///< Open reuse scopes
+    std::unordered_set<std::string> m_reused;                                              ///< Reused in the scopes
+    std::unordered_map<std::string, std::shared_ptr<builder::IPolicy>> m_retainedPolicies; ///< Last policy builds
+    std::unordered_map<std::string, base::Expression> m_retainedFilters;                   ///< Last filter builds
+
+    /**
+     * @brief Build an asset or get the one already built in the open shared scope, or the retained one in an open
+     * reuse scope.
+     *
+     * @param cache Built assets of the scope
+     * @param retained Last builds of the assets
+     * @param name Name of the asset
+     * @param build Function to build the asset
+     */
+    template<typename T, typename F>
+    T getShared(std::unordered_map<std::string, T>& cache,
+                std::unordered_map<std::string, T>& retained,
+                const base::Name& name,
+                F&& build)
+    {
+        if (!m_shareBuilds && !m_retainBuilds)
+        {
+            return build();
+        }
+
+        std::lock_guard lock {m_sharedMutex};
+        const auto key = name.toStr();
+        if (m_reuseScopes > 0)
+        {
+            m_reused.emplace(key);
+            if (auto it = retained.find(key); it != retained.end())
+            {
+                return it->second;
+            }
+        }
+
+        T built;
+        if (m_shareBuilds && m_sharedScopes > 0)
+        {
+            auto it = cache.find(key);
+            if (it == cache.end())
+            {
+                it = cache.emplace(key, build()).first;
+            }
+            built = it->second;
+        }
+        else
+        {
+            built = build();
+        }
+
+        if (m_retainBuilds)
+        {
+            retained[key] = built;
+        }
+        return built;
+    }
+
     /**
      * @brief Get the Expression object for a given filter.
      *
@@ -44,17 +119,126 @@ private:
             throw std::runtime_error {"The builder is not available"};
         }
 
-        return builder->buildAsset(filterName);
+        return getShared(
+            m_filters, m_retainedFilters, filterName, [&]() { return builder->buildAsset(filterName); });
     }
 
 public:
+    /**
+     * @brief Scope in which the environments created with the same policy or filter share their build.
+     *
+     * The workers hold a copy of every environment, when the scope spans the creation of all the copies the asset graph
+     * is built once. The expressions are immutable and the helpers are stateless, so the controllers share them and
+     * only their execution state is per worker. The builds are discarded when the last open scope is closed, so the
+     * assets are built again from the catalog in the next scope.
+     */
+    class SharedScope
+    {
+    private:
+        std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Builder whose builds are shared, nullptr if none
+
+    public:
+        explicit SharedScope(std::shared_ptr<EnvironmentBuilder> envBuilder)
+            : m_envBuilder(std::move(envBuilder))
+        {
+            if (m_envBuilder && m_envBuilder->m_shareBuilds)
+            {
+                std::lock_guard lock {m_envBuilder->m_sharedMutex};
+                ++m_envBuilder->m_sharedScopes;
+            }
+        }
+
+        ~SharedScope()
+        {
+            if (m_envBuilder && m_envBuilder->m_shareBuilds)
+            {
+                std::lock_guard lock {m_envBuilder->m_sharedMutex};
+                if (--m_envBuilder->m_sharedScopes == 0)
+                {
+                    m_envBuilder->m_policies.clear();
+                    m_envBuilder->m_filters.clear();
+                }
+            }
+        }
+
+        SharedScope(const SharedScope&) = delete;
+        SharedScope& operator=(const SharedScope&) = delete;
+    };
+
+    /**
+     * @brief Scope in which the environments reuse the last build of their policy and filter, if it was retained.
+     *
+     * Used to copy the environments to a new worker without building them again: the running builds are the last ones,
+     * because the environments are rebuilt in all the workers at once. The retained builds that are not reused in the
+     * scope are released when it is closed, so the assets no longer in use are not kept.
+     */
+    class ReuseScope
+    {
+    private:
+        std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Builder whose builds are reused, nullptr if none
+
+        template<typename T>
+        static void prune(std::unordered_map<std::string, T>& retained, const std::unordered_set<std::string>& reused)
+        {
+            for (auto it = retained.begin(); it != retained.end();)
+            {
+                it = reused.find(it->first) == reused.end() ? retained.erase(it) : std::next(it);
+            }
+        }
+
+    public:
+        explicit ReuseScope(std::shared_ptr<EnvironmentBuilder> envBuilder)
+            : m_envBuilder(std::move(envBuilder))
+        {
+            if (m_envBuilder && m_envBuilder->m_retainBuilds)
+            {
+                std::lock_guard lock {m_envBuilder->m_sharedMutex};
+                ++m_envBuilder->m_reuseScopes;
+            }
+        }
+
+        ~ReuseScope()
+        {
+            if (m_envBuilder && m_envBuilder->m_retainBuilds)
+            {
+                std::lock_guard lock {m_envBuilder->m_sharedMutex};
+                if (--m_envBuilder->m_reuseScopes == 0)
+                {
+                    prune(m_envBuilder->m_retainedPolicies, m_envBuilder->m_reused);
+                    prune(m_envBuilder->m_retainedFilters, m_envBuilder->m_reused);
+                    m_envBuilder->m_reused.clear();
+                }
+            }
+        }
+
+        ReuseScope(const ReuseScope&) = delete;
+        ReuseScope& operator=(const ReuseScope&) = delete;
+    };
+
     /**
      * @brief Create a new EnvironmentBuilder
      *
+     * @param builder The builder used to construct the policy and filter.
+     * @param controllerMaker The controller maker used to construct the controller.
+     * @param shareBuilds Share the builds of the environments created in a SharedScope.
+     * @param retainBuilds Keep the last build of each policy and filter, to be reused in a ReuseScope.
      */
-    EnvironmentBuilder(std::weak_ptr<builder::IBuilder> builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
+    EnvironmentBuilder(std::weak_ptr<builder::IBuilder> builder,
+                       std::shared_ptr<bk::IControllerMaker> controllerMaker,
+                       bool shareBuilds = false,
+                       bool retainBuilds = false)
         : m_builder(std::move(builder))
         , m_controllerMaker(std::move(controllerMaker))
+        , m_shareBuilds(shareBuilds)
+        , m_sharedMutex()
+        , m_sharedScopes(0)
+        , m_policies()
+        , m_filters()
+        , m_retainBuilds(retainBuilds)
+        , m_reuseScopes(0)
+        , m_reused()
+        , m_retainedPolicies()
+        , m_retainedFilters()
     {
         if (m_builder.expired() || m_builder.lock() == nullptr)
         {
@@ -91,7 +275,17 @@ public:
             throw std::runtime_error {"The builder is not available"};
         }
 
-        auto policy = builder->buildPolicy(policyName);
+        auto policy = getShared(m_policies,
+                                m_retainedPolicies,
+                                policyName,
+                                [&]()
+                                {
+                                    auto built = builder->buildPolicy(policyName);
+                                    LOG_DEBUG("Policy '{}' built with {} runtime schema validations",
+                                              policyName,
+                                              built->runtimeValidations());
+                                    return built;
+                                });
         if (policy->assets().empty())
         {
             throw std::runtime_error {fmt::format("Policy '{}' has no assets", policyName)};
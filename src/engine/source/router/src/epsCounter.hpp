@@ -1,8 +1,15 @@
 #ifndef _ROUTER_EPS_COUNTER_HPP
 #define _ROUTER_EPS_COUNTER_HPP
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
 
 namespace router
 {
@@ -10,19 +17,34 @@ constexpr auto DEFAULT_EPS = 1000;
 constexpr auto DEFAULT_INTERVAL = 10;
 constexpr auto DEFAULT_STATE = false;
 
+constexpr std::size_t SHARD_TOKEN_BATCH = 64; ///< Tokens taken at once from the bucket by each shard
+constexpr auto THROTTLED_PARK_TIMEOUT = std::chrono::milliseconds(100); ///< Max time a throttled worker is parked
+
 /**
- * @brief Class to count events per second and reset the counter after a given interval
+ * @brief Token bucket to limit the events per interval.
  *
+ * The bucket holds eps * interval tokens and a refill thread fills it up again at the start of each interval. Each
+ * event takes one token, the workers take them in batches through a Shard, so the bucket is touched once per batch
+ * instead of once per event. A worker that finds the bucket empty parks until the next refill instead of spinning.
  */
 class Orchestrator::EpsCounter
 {
+public:
+    class Shard;
+
 private:
-    std::atomic_uint m_count;     ///< Counter for the number of events
-    std::atomic_bool m_canReset;  ///< Flag to ensure only one thread resets the counter
-    std::atomic_uint m_limit;     ///< Limit for the number of events per interval
-    std::atomic_ulong m_interval; ///< Interval windows size in nanoseconds
-    std::chrono::time_point<std::chrono::steady_clock> m_lastReset; ///< Last time the counter was reset
-    std::atomic_bool active;                                        ///< Flag to indicate if the counter is active
+    std::atomic<std::size_t> m_tokens; ///< Tokens left in the current interval
+    std::atomic_uint64_t m_epoch;      ///< Number of refills, tokens of a previous interval are discarded by the shards
+    std::atomic_uint m_limit;          ///< Limit for the number of events per interval
+    std::atomic_ulong m_interval;      ///< Interval windows size in nanoseconds
+    std::atomic_bool active;           ///< Flag to indicate if the counter is active
+
+    std::mutex m_mutex;                   ///< Protects the refill and the parking of the workers
+    std::condition_variable m_refilledCv; ///< Notifies the parked workers of a refill
+    std::condition_variable m_refillCv;   ///< Wakes up the refill thread on stop or on new settings
+    bool m_stopping;                      ///< Flag to stop the refill thread
+    bool m_settingsChanged;               ///< Flag to refill and restart the interval with the new settings
+    std::thread m_refillThread;           ///< Thread refilling the bucket at the start of each interval
 
     void checkSettings(uint eps, uint intervalSec)
     {
@@ -37,15 +59,40 @@ private:
         }
     }
 
+    // Fill up the bucket and start a new interval, the lock must be held
+    void refill()
+    {
+        m_tokens.store(m_limit.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        m_epoch.fetch_add(1, std::memory_order_relaxed);
+        m_refilledCv.notify_all();
+    }
+
+    void refillLoop()
+    {
+        std::unique_lock lock {m_mutex};
+        while (!m_stopping)
+        {
+            auto interval = std::chrono::nanoseconds(m_interval.load(std::memory_order_relaxed));
+            m_refillCv.wait_for(lock, interval, [this]() { return m_stopping || m_settingsChanged; });
+            if (!m_stopping)
+            {
+                m_settingsChanged = false;
+                refill();
+            }
+        }
+    }
+
 public:
     EpsCounter()
-        : m_count(0)
-        , m_canReset(true)
+        : m_tokens(DEFAULT_EPS * DEFAULT_INTERVAL)
+        , m_epoch(0)
         , m_limit(DEFAULT_EPS * DEFAULT_INTERVAL)
         , m_interval(1e9 * DEFAULT_INTERVAL)
-        , m_lastReset(std::chrono::steady_clock::now())
         , active(DEFAULT_STATE)
+        , m_stopping(false)
+        , m_settingsChanged(false)
     {
+        m_refillThread = std::thread(&EpsCounter::refillLoop, this);
     }
 
     /**
@@ -53,51 +100,97 @@ public:
      *
      * @param eps Maximum number of events per second
      * @param intervalSec Interval window size in seconds
+     * @param state Initial state of the counter
      */
     EpsCounter(uint eps, uint intervalSec, bool state)
-        : m_count(0)
-        , m_lastReset(std::chrono::steady_clock::now())
-        , m_canReset(true)
+        : m_tokens(0)
+        , m_epoch(0)
         , active(state)
+        , m_stopping(false)
+        , m_settingsChanged(false)
     {
         checkSettings(eps, intervalSec);
         m_limit.store(eps * intervalSec, std::memory_order_relaxed);
         m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+        m_tokens.store(eps * intervalSec, std::memory_order_relaxed);
+        m_refillThread = std::thread(&EpsCounter::refillLoop, this);
     }
 
-    bool limitReached()
+    EpsCounter(const EpsCounter&) = delete;
+    EpsCounter& operator=(const EpsCounter&) = delete;
+
+    ~EpsCounter()
     {
-        // Preemptively check the limit, only then check and reset the counter
-        auto current = m_count.fetch_add(1, std::memory_order_relaxed);
-        if (++current <= m_limit.load(std::memory_order_relaxed))
         {
-            return false;
+            std::lock_guard lock {m_mutex};
+            m_stopping = true;
         }
+        m_refillCv.notify_one();
+        m_refilledCv.notify_all();
+        m_refillThread.join();
+    }
 
-        auto now = std::chrono::steady_clock::now();
-        auto especulativeElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
-
-        if (especulativeElapsedTime >= m_interval.load(std::memory_order_relaxed))
+    /**
+     * @brief Take up to the requested number of tokens from the bucket.
+     *
+     * @param wanted Number of tokens requested
+     * @return std::size_t Number of tokens taken, 0 if the bucket is empty
+     */
+    std::size_t take(std::size_t wanted)
+    {
+        auto available = m_tokens.load(std::memory_order_relaxed);
+        std::size_t granted;
+        do
         {
-            // Ensure only one thread resets the counter
-            bool expected = true;
-            if (m_canReset.compare_exchange_strong(expected, false, std::memory_order_acquire))
+            if (available == 0)
             {
-                auto realElapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_lastReset).count();
-                if (realElapsedTime >= m_interval.load(std::memory_order_relaxed))
-                {
-                    m_lastReset = now;
-                    m_count.store(0, std::memory_order_relaxed);
-                }
-
-                m_canReset.store(true, std::memory_order_release);
+                return 0;
             }
-        }
+            granted = std::min(available, wanted);
+        } while (!m_tokens.compare_exchange_weak(available, available - granted, std::memory_order_relaxed));
+
+        return granted;
+    }
+
+    /**
+     * @brief Take one token from the bucket.
+     *
+     * @return true if the bucket is empty and the event must not be processed
+     */
+    bool limitReached() { return take(1) == 0; }
 
-        return true;
+    /**
+     * @brief Get the number of refills, it changes at the start of each interval.
+     */
+    uint64_t epoch() const { return m_epoch.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Park the calling thread until the bucket is refilled, the counter is stopped or the timeout expires.
+     *
+     * @param epoch Epoch seen by the caller when the bucket was found empty
+     * @param timeout Maximum time to wait
+     */
+    void waitRefill(uint64_t epoch, std::chrono::nanoseconds timeout)
+    {
+        std::unique_lock lock {m_mutex};
+        m_refilledCv.wait_for(lock,
+                              timeout,
+                              [this, epoch]()
+                              {
+                                  return m_stopping || epoch != m_epoch.load(std::memory_order_relaxed)
+                                         || !active.load(std::memory_order_relaxed);
+                              });
     }
 
-    void stop() { active.store(false, std::memory_order_relaxed); }
+    void stop()
+    {
+        {
+            std::lock_guard lock {m_mutex};
+            active.store(false, std::memory_order_relaxed);
+        }
+        // Release the parked workers
+        m_refilledCv.notify_all();
+    }
 
     void start() { active.store(true, std::memory_order_relaxed); }
 
@@ -109,6 +202,13 @@ public:
 
         m_limit.store(eps * intervalSec, std::memory_order_relaxed);
         m_interval.store(1e9 * intervalSec, std::memory_order_relaxed);
+
+        // Start a new interval with the new settings
+        {
+            std::lock_guard lock {m_mutex};
+            m_settingsChanged = true;
+        }
+        m_refillCv.notify_one();
     }
 
     uint getEps() const
@@ -117,6 +217,66 @@ public:
     }
     uint getRefreshInterval() const { return m_interval.load(std::memory_order_relaxed) / 1e9; }
 };
+
+/**
+ * @brief Share of the bucket owned by a single worker.
+ *
+ * Tokens are taken from the bucket in batches of SHARD_TOKEN_BATCH and handed out locally. The tokens left from a
+ * previous interval are discarded, so a shard can never exceed the limit by more than one batch.
+ */
+class Orchestrator::EpsCounter::Shard
+{
+private:
+    std::shared_ptr<EpsCounter> m_counter; ///< Shared bucket
+    std::size_t m_tokens;                  ///< Tokens owned by the shard
+    uint64_t m_epoch;                      ///< Epoch of the owned tokens
+
+public:
+    explicit Shard(std::shared_ptr<EpsCounter> counter)
+        : m_counter(std::move(counter))
+        , m_tokens(0)
+        , m_epoch(m_counter->epoch())
+    {
+    }
+
+    /**
+     * @brief Acquire up to the requested number of events from the limit.
+     *
+     * If no event can be acquired, the caller is parked until the next refill (at most THROTTLED_PARK_TIMEOUT).
+     *
+     * @param wanted Number of events requested
+     * @return std::size_t Number of events that can be processed, 0 if the limit is reached
+     */
+    std::size_t acquire(std::size_t wanted)
+    {
+        if (!m_counter->isActive())
+        {
+            return wanted;
+        }
+
+        auto epoch = m_counter->epoch();
+        if (epoch != m_epoch)
+        {
+            m_tokens = 0;
+            m_epoch = epoch;
+        }
+
+        if (m_tokens < wanted)
+        {
+            m_tokens += m_counter->take(std::max(wanted - m_tokens, SHARD_TOKEN_BATCH));
+        }
+
+        if (m_tokens == 0)
+        {
+            m_counter->waitRefill(epoch, THROTTLED_PARK_TIMEOUT);
+            return 0;
+        }
+
+        auto granted = std::min(wanted, m_tokens);
+        m_tokens -= granted;
+        return granted;
+    }
+};
 } // namespace router
 
 #endif // _ROUTER_EPS_COUNTER_HPP
@@ -0,0 +1,185 @@
+#include "filterIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string_view>
+
+namespace
+{
+constexpr std::string_view NAME_SEPARATOR = ": "; ///< Separator between the field and the helper of a term name
+constexpr std::array<std::string_view, 3> EQUALITY_HELPERS = {"filter", "string_equal", "int_equal"};
+
+std::optional<std::string> integralKey(double value)
+{
+    // 2^63, the integral doubles below it are exactly representable as int64
+    constexpr double INT64_LIMIT = 9223372036854775808.0;
+    if (std::trunc(value) != value || value >= INT64_LIMIT || value < -INT64_LIMIT)
+    {
+        return std::nullopt;
+    }
+    return "n" + std::to_string(static_cast<int64_t>(value));
+}
+
+/**
+ * @brief Get the condition of a term named '<field>: <helper>(<value>)' (see builder::builders::baseHelperBuilder)
+ */
+std::optional<router::FilterKey> termKey(const std::string& name)
+{
+    auto separator = name.find(NAME_SEPARATOR);
+    if (separator == std::string::npos || separator == 0 || name.back() != ')')
+    {
+        return std::nullopt;
+    }
+
+    auto helper = std::string_view(name).substr(separator + NAME_SEPARATOR.size());
+    auto open = helper.find('(');
+    if (open == std::string_view::npos
+        || std::find(EQUALITY_HELPERS.begin(), EQUALITY_HELPERS.end(), helper.substr(0, open))
+               == EQUALITY_HELPERS.end())
+    {
+        return std::nullopt;
+    }
+
+    // The argument is the json representation of a single value, references and lists are not valid json
+    auto argument = std::string(helper.substr(open + 1, helper.size() - open - 2));
+    std::optional<std::string> key;
+    try
+    {
+        key = router::FilterIndex::valueKey(json::Json(argument.c_str()));
+    }
+    catch (const std::exception&)
+    {
+        return std::nullopt;
+    }
+
+    if (!key)
+    {
+        return std::nullopt;
+    }
+
+    return router::FilterKey {json::Json::formatJsonPath(name.substr(0, separator)), std::move(key.value())};
+}
+
+std::optional<std::string> eventKey(const base::Event& event, const json::Path& path)
+{
+    if (event->isString(path))
+    {
+        return "s" + event->getString(path).value();
+    }
+    if (event->isInt64(path))
+    {
+        return "n" + std::to_string(event->getInt64(path).value());
+    }
+    if (event->isDouble(path))
+    {
+        return integralKey(event->getDouble(path).value());
+    }
+    if (event->isBool(path))
+    {
+        return event->getBool(path).value() ? "btrue" : "bfalse";
+    }
+    return std::nullopt;
+}
+} // namespace
+
+namespace router
+{
+
+std::optional<FilterKey> getFilterKey(const base::Expression& filter)
+{
+    if (filter == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    if (filter->isTerm())
+    {
+        return termKey(filter->getName());
+    }
+
+    if (filter->isAnd())
+    {
+        for (const auto& operand : filter->getPtr<base::And>()->getOperands())
+        {
+            auto key = getFilterKey(operand);
+            if (key)
+            {
+                return key;
+            }
+        }
+    }
+    else if (filter->isImplication())
+    {
+        return getFilterKey(filter->getPtr<base::Implication>()->getOperands()[0]);
+    }
+
+    return std::nullopt;
+}
+
+std::optional<std::string> FilterIndex::valueKey(const json::Json& value)
+{
+    if (value.isString())
+    {
+        return "s" + value.getString().value();
+    }
+    if (value.isInt64())
+    {
+        return "n" + std::to_string(value.getInt64().value());
+    }
+    if (value.isDouble())
+    {
+        return integralKey(value.getDouble().value());
+    }
+    if (value.isBool())
+    {
+        return value.getBool().value() ? "btrue" : "bfalse";
+    }
+    return std::nullopt;
+}
+
+void FilterIndex::add(std::size_t position, const std::optional<FilterKey>& key)
+{
+    if (!key)
+    {
+        m_always.emplace_back(position);
+        return;
+    }
+
+    auto field = std::find_if(
+        m_fields.begin(), m_fields.end(), [&key](const FieldIndex& field) { return field.path.str() == key->path; });
+    if (field == m_fields.end())
+    {
+        field = m_fields.insert(m_fields.end(), FieldIndex {json::Path(key->path), {}});
+    }
+
+    field->routes[key->value].emplace_back(position);
+    m_indexed = true;
+}
+
+void FilterIndex::candidates(const base::Event& event, std::vector<std::size_t>& candidates) const
+{
+    candidates.assign(m_always.begin(), m_always.end());
+
+    for (const auto& field : m_fields)
+    {
+        auto key = eventKey(event, field.path);
+        if (!key)
+        {
+            continue;
+        }
+
+        auto it = field.routes.find(key.value());
+        if (it != field.routes.end())
+        {
+            candidates.insert(candidates.end(), it->second.begin(), it->second.end());
+        }
+    }
+
+    if (!m_fields.empty())
+    {
+        std::sort(candidates.begin(), candidates.end());
+    }
+}
+
+} // namespace router
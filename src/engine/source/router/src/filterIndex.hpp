@@ -0,0 +1,92 @@
+#ifndef _ROUTER_FILTER_INDEX_HPP
+#define _ROUTER_FILTER_INDEX_HPP
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <base/baseTypes.hpp>
+#include <base/expression.hpp>
+#include <base/json.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Equality condition that every event accepted by a filter meets.
+ */
+struct FilterKey
+{
+    std::string path;  ///< Json pointer path of the field
+    std::string value; ///< Index key of the value, see FilterIndex::valueKey
+};
+
+/**
+ * @brief Extract a discriminating equality condition from a filter expression.
+ *
+ * Only the conditions every accepted event has to meet are considered: the operands of an And and the condition of an
+ * Implication. The first term comparing a field against a string, integer or boolean value with the 'filter',
+ * 'string_equal' or 'int_equal' helpers is taken.
+ *
+ * @param filter Filter expression of the route
+ * @return std::optional<FilterKey> The condition, or std::nullopt if the filter has none
+ */
+std::optional<FilterKey> getFilterKey(const base::Expression& filter);
+
+/**
+ * @brief Dispatch index of the routes by the value of their discriminating field.
+ *
+ * The routes are identified by their position in priority order. A route without a discriminating condition is a
+ * candidate for every event, the rest are only candidates for the events with the same value in their field. The
+ * candidates still have to be checked against the whole filter.
+ */
+class FilterIndex
+{
+private:
+    struct FieldIndex
+    {
+        json::Path path;                                                  ///< Path of the field
+        std::unordered_map<std::string, std::vector<std::size_t>> routes; ///< Routes by value key, in priority order
+    };
+
+    std::vector<FieldIndex> m_fields;  ///< Indexed fields
+    std::vector<std::size_t> m_always; ///< Routes without a discriminating condition, in priority order
+    bool m_indexed {false};            ///< True if at least one route is indexed
+
+public:
+    /**
+     * @brief Get the index key of a json value.
+     *
+     * Integral numbers share the key regardless of their representation, as the filters compare them by value.
+     *
+     * @param value Value to get the key from
+     * @return std::optional<std::string> The key, or std::nullopt if the type of the value is not indexed
+     */
+    static std::optional<std::string> valueKey(const json::Json& value);
+
+    /**
+     * @brief Add the next route in priority order.
+     *
+     * @param position Position of the route
+     * @param key Discriminating condition of the route filter, if any
+     */
+    void add(std::size_t position, const std::optional<FilterKey>& key);
+
+    /**
+     * @brief Check if no route is indexed, so every route is a candidate.
+     */
+    bool empty() const { return !m_indexed; }
+
+    /**
+     * @brief Get the candidate routes for an event.
+     *
+     * @param event Event to route
+     * @param candidates Where the positions of the candidates are written, in priority order
+     */
+    void candidates(const base::Event& event, std::vector<std::size_t>& candidates) const;
+};
+
+} // namespace router
+
+#endif // _ROUTER_FILTER_INDEX_HPP
@@ -0,0 +1,215 @@
+#include "ingressFilter.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+
+#include <fmt/format.h>
+
+namespace
+{
+constexpr std::size_t LOCATION_OFFSET {2}; ///< Given the "q:" prefix
+
+constexpr std::string_view ACTION_DROP {"drop"};
+constexpr std::string_view ACTION_DIVERT {"divert"};
+} // namespace
+
+namespace router
+{
+
+IngressFilter::IngressFilter()
+    : m_snapshot(std::make_shared<const Snapshot>())
+    , m_empty(true)
+{
+}
+
+bool IngressFilter::matches(const prod::IngressRule& rule, std::string_view event)
+{
+    if (rule.queue() && (event.empty() || event.front() != rule.queue().value()))
+    {
+        return false;
+    }
+
+    const auto& prefix = rule.locationPrefix();
+    if (!prefix.empty()
+        && (event.size() < LOCATION_OFFSET + prefix.size()
+            || event.compare(LOCATION_OFFSET, prefix.size(), prefix) != 0))
+    {
+        return false;
+    }
+
+    return std::all_of(rule.contains().begin(),
+                       rule.contains().end(),
+                       [event](const auto& substring) { return event.find(substring) != std::string_view::npos; });
+}
+
+void IngressFilter::publish(std::shared_ptr<const Snapshot> snapshot)
+{
+    m_empty.store(snapshot->empty(), std::memory_order_relaxed);
+    std::atomic_store_explicit(&m_snapshot, std::move(snapshot), std::memory_order_release);
+}
+
+IngressFilter::Verdict IngressFilter::check(std::string_view event) const
+{
+    if (m_empty.load(std::memory_order_relaxed))
+    {
+        return Verdict::ACCEPT;
+    }
+
+    const auto snapshot = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+    for (const auto& [rule, hits] : *snapshot)
+    {
+        if (matches(rule, event))
+        {
+            hits->fetch_add(1, std::memory_order_relaxed);
+            return rule.action() == prod::IngressAction::DROP ? Verdict::DROP : Verdict::DIVERT;
+        }
+    }
+
+    return Verdict::ACCEPT;
+}
+
+base::OptError IngressFilter::add(const prod::IngressRule& rule)
+{
+    if (auto error = rule.validate())
+    {
+        return error;
+    }
+
+    std::lock_guard lock {m_mutex};
+    const auto& current = *m_snapshot;
+    if (std::any_of(
+            current.begin(), current.end(), [&rule](const auto& entry) { return entry.rule.name() == rule.name(); }))
+    {
+        return base::Error {fmt::format("The ingress rule '{}' already exists", rule.name())};
+    }
+
+    auto snapshot = std::make_shared<Snapshot>(current);
+    snapshot->push_back({rule, std::make_shared<std::atomic_uint64_t>(0)});
+    publish(std::move(snapshot));
+    return base::OptError {};
+}
+
+base::OptError IngressFilter::remove(const std::string& name)
+{
+    std::lock_guard lock {m_mutex};
+    auto snapshot = std::make_shared<Snapshot>(*m_snapshot);
+    const auto it = std::find_if(
+        snapshot->begin(), snapshot->end(), [&name](const auto& entry) { return entry.rule.name() == name; });
+    if (it == snapshot->end())
+    {
+        return base::Error {fmt::format("The ingress rule '{}' does not exist", name)};
+    }
+
+    snapshot->erase(it);
+    publish(std::move(snapshot));
+    return base::OptError {};
+}
+
+std::list<prod::IngressRule> IngressFilter::rules() const
+{
+    const auto snapshot = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+    std::list<prod::IngressRule> rules;
+    for (const auto& [rule, hits] : *snapshot)
+    {
+        rules.push_back(rule);
+        rules.back().hits(hits->load(std::memory_order_relaxed));
+    }
+    return rules;
+}
+
+json::Json IngressFilter::dump() const
+{
+    json::Json dump;
+    dump.setArray();
+    for (const auto& rule : rules())
+    {
+        json::Json jRule;
+        jRule.setObject();
+        jRule.setString(rule.name(), "/name");
+        jRule.setString(rule.action() == prod::IngressAction::DROP ? ACTION_DROP : ACTION_DIVERT, "/action");
+        if (rule.queue())
+        {
+            jRule.setString(std::string(1, rule.queue().value()), "/queue");
+        }
+        if (!rule.locationPrefix().empty())
+        {
+            jRule.setString(rule.locationPrefix(), "/location_prefix");
+        }
+        jRule.setArray("/contains");
+        for (const auto& substring : rule.contains())
+        {
+            jRule.appendString(substring, "/contains");
+        }
+        dump.appendJson(jRule);
+    }
+    return dump;
+}
+
+base::OptError IngressFilter::load(const json::Json& dump)
+{
+    const auto jRules = dump.getArray();
+    if (!jRules)
+    {
+        return base::Error {"The ingress rules must be an array"};
+    }
+
+    auto snapshot = std::make_shared<Snapshot>();
+    std::unordered_set<std::string> names;
+    for (const auto& jRule : jRules.value())
+    {
+        const auto name = jRule.getString("/name");
+        const auto action = jRule.getString("/action");
+        if (!name || !action || (action.value() != ACTION_DROP && action.value() != ACTION_DIVERT))
+        {
+            return base::Error {"An ingress rule has no name or an invalid action"};
+        }
+
+        prod::IngressRule rule {name.value(),
+                                action.value() == ACTION_DROP ? prod::IngressAction::DROP
+                                                              : prod::IngressAction::DIVERT};
+        if (const auto queue = jRule.getString("/queue"); queue)
+        {
+            if (queue->size() != 1)
+            {
+                return base::Error {
+                    fmt::format("The queue of the ingress rule '{}' must be a character", name.value())};
+            }
+            rule.queue(queue->front());
+        }
+        if (const auto prefix = jRule.getString("/location_prefix"); prefix)
+        {
+            rule.locationPrefix(prefix.value());
+        }
+        if (const auto jContains = jRule.getArray("/contains"); jContains)
+        {
+            std::vector<std::string> contains;
+            for (const auto& jSubstring : jContains.value())
+            {
+                const auto substring = jSubstring.getString();
+                if (!substring)
+                {
+                    return base::Error {
+                        fmt::format("The substrings of the ingress rule '{}' must be strings", name.value())};
+                }
+                contains.push_back(substring.value());
+            }
+            rule.contains(std::move(contains));
+        }
+
+        if (auto error = rule.validate())
+        {
+            return base::Error {fmt::format("Invalid ingress rule '{}': {}", name.value(), error->message)};
+        }
+        if (!names.insert(name.value()).second)
+        {
+            return base::Error {fmt::format("The ingress rule '{}' is repeated", name.value())};
+        }
+        snapshot->push_back({std::move(rule), std::make_shared<std::atomic_uint64_t>(0)});
+    }
+
+    std::lock_guard lock {m_mutex};
+    publish(std::move(snapshot));
+    return base::OptError {};
+}
+
+} // namespace router
@@ -0,0 +1,109 @@
+#ifndef _ROUTER_INGRESS_FILTER_HPP
+#define _ROUTER_INGRESS_FILTER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include <base/json.hpp>
+
+#include <router/types.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Pre-filter of the raw events, checked before they are parsed.
+ *
+ * The rules are checked in the order they were added and the first one that matches decides the fate of the event.
+ * The ingress path reads an immutable snapshot of the rules, replaced atomically on each change, so it never takes a
+ * lock. The hits of a rule are kept across the snapshots, they are only reset when the rule is deleted.
+ */
+class IngressFilter
+{
+public:
+    /**
+     * @brief Fate of a raw event
+     */
+    enum class Verdict : std::uint8_t
+    {
+        ACCEPT, ///< No rule matches, the event is routed
+        DROP,   ///< The event is discarded
+        DIVERT, ///< The event is handed over to the divert sink
+    };
+
+private:
+    struct Rule
+    {
+        prod::IngressRule rule;                     ///< Rule, its hits are not updated
+        std::shared_ptr<std::atomic_uint64_t> hits; ///< Events matched by the rule, shared by the snapshots
+    };
+    using Snapshot = std::vector<Rule>;
+
+    std::shared_ptr<const Snapshot> m_snapshot; ///< Rules, accessed atomically by the ingress path
+    std::atomic_bool m_empty;                   ///< There are no rules, the events are accepted right away
+    std::mutex m_mutex;                         ///< Serializes the changes of the rules
+
+    /**
+     * @brief Check if a raw event matches the conditions of a rule
+     */
+    static bool matches(const prod::IngressRule& rule, std::string_view event);
+
+    /**
+     * @brief Replace the snapshot of the rules, the lock must be held
+     */
+    void publish(std::shared_ptr<const Snapshot> snapshot);
+
+public:
+    IngressFilter();
+
+    /**
+     * @brief Check a raw event against the rules, counting the hit of the matching rule
+     *
+     * @param event Raw event, "<Queue>:<Location>:<Message>"
+     * @return Verdict Fate of the event
+     */
+    Verdict check(std::string_view event) const;
+
+    /**
+     * @brief Add a rule after the existing ones
+     *
+     * @param rule Rule to add
+     * @return base::OptError Error if the rule is not valid or there is already a rule with its name
+     */
+    base::OptError add(const prod::IngressRule& rule);
+
+    /**
+     * @brief Delete a rule
+     *
+     * @param name Name of the rule
+     * @return base::OptError Error if the rule does not exist
+     */
+    base::OptError remove(const std::string& name);
+
+    /**
+     * @brief Get the rules, in the order they are checked, with their hits
+     */
+    std::list<prod::IngressRule> rules() const;
+
+    /**
+     * @brief Dump the rules, without their hits, to be stored
+     */
+    json::Json dump() const;
+
+    /**
+     * @brief Replace the rules with the ones dumped
+     *
+     * @param dump Dumped rules
+     * @return base::OptError Error if the dump is not valid, the rules are not changed then
+     */
+    base::OptError load(const json::Json& dump);
+};
+
+} // namespace router
+
+#endif // _ROUTER_INGRESS_FILTER_HPP
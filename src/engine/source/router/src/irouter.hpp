@@ -4,6 +4,7 @@
 #include <list>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -62,6 +63,15 @@ public:
      */
     virtual base::OptError changePriority(const std::string& name, size_t priority) = 0;
 
+    /**
+     * @brief Change the events per second a route sends to its policy.
+     *
+     * @param name The name of the route.
+     * @param epsLimit The new limit, 0 for no limit.
+     * @return An optional error indicating the success or failure of the operation.
+     */
+    virtual base::OptError changeEpsLimit(const std::string& name, std::size_t epsLimit) = 0;
+
     /**
      * @brief dumps the router table.
      *
@@ -81,6 +91,30 @@ public:
      * @param event The event to be ingested.
      */
     virtual void ingest(base::Event&& event) = 0;
+
+    /**
+     * @brief Ingest a batch of events into the router.
+     *
+     * The route table is looked up once for the whole batch, events are processed in order.
+     * @param events The events to be ingested, null events are skipped.
+     */
+    virtual void ingest(std::vector<base::Event>&& events) = 0;
+
+    /**
+     * @brief Attach a trace sampler to an enabled environment, its sampled events are traced on the live controller.
+     *
+     * @param name The name of the environment to be traced.
+     * @param sampler The sampler of the traces.
+     * @return An optional error if the operation failed.
+     */
+    virtual base::OptError attachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler) = 0;
+
+    /**
+     * @brief Detach a trace sampler from the environment, if it is attached.
+     * @param name The name of the environment.
+     * @param sampler The sampler to detach.
+     */
+    virtual void detachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler) = 0;
 };
 
 } // namespace router
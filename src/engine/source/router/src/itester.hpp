@@ -28,6 +28,8 @@ public:
      * @param entryPost The entry information for testing policy
      * @param ignoreFail If true, if the operation fails the entry is added in disabled state.
      * @return An optional error if the operation failed.
+     * @note When the tester releases the idle entries, the ones added with ignoreFail are not built until their first
+     * test, see releaseIdle.
      */
     virtual base::OptError addEntry(const test::EntryPost& entryPost, bool ignoreFail = false) = 0;
 
@@ -80,11 +82,11 @@ public:
     virtual base::RespOrError<test::Output> ingestTest(base::Event&& event, const test::Options& opt) = 0;
 
     /**
-     * @brief get the assets of the policy of the entry.
+     * @brief get the assets of the policy of the entry, building it if it is not loaded.
      * @param name The name of the entry.
      * @return base::RespOrError<std::unordered_set<std::string>> The assets of the policy.
      */
-    virtual base::RespOrError<std::unordered_set<std::string>> getAssets(const std::string& name) const = 0;
+    virtual base::RespOrError<std::unordered_set<std::string>> getAssets(const std::string& name) = 0;
 
     /**
      * @brief Update the last time the entry was used.
@@ -93,6 +95,14 @@ public:
      * @return false if the entry does not exist.
      */
     virtual bool updateLastUsed(const std::string& name, uint64_t lastUsed = std::numeric_limits<uint64_t>::max()) = 0;
+
+    /**
+     * @brief Release the controllers of the entries not tested during the idle timeout of the tester.
+     *
+     * The released entries keep their state and are built again on their next test. It does nothing if the tester has
+     * no idle timeout.
+     */
+    virtual void releaseIdle() = 0;
 };
 
 } // namespace router
@@ -1,6 +1,7 @@
 #ifndef ROUTER_IWORKER_HPP
 #define ROUTER_IWORKER_HPP
 
+#include <cstdint>
 #include <memory>
 
 #include "irouter.hpp"
@@ -12,14 +13,20 @@ namespace router
 class IWorker
 {
 public:
-    using EpsLimit = std::function<bool()>;
+    /**
+     * @brief Acquire up to the requested number of events from the EPS limit.
+     *
+     * Returns the number of events that can be processed, 0 if the limit is reached. A throttled caller may be parked
+     * for a while before 0 is returned.
+     */
+    using EpsLimit = std::function<std::size_t(std::size_t)>;
 
     virtual ~IWorker() = default;
 
     /**
      * @brief Start the worker
      *
-     * @param epsCounter The counter to measure the events per second
+     * @param epsLimit The limit of events per second
      */
     virtual void start(const EpsLimit& epsLimit) = 0;
 
@@ -39,6 +46,12 @@ public:
      * @return A constant reference to the shared pointer of the tester.
      */
     virtual const std::shared_ptr<ITester>& getTester() const = 0;
+
+    /**
+     * @brief Get the time the worker has spent processing production events since it was created.
+     * @return The busy time in nanoseconds.
+     */
+    virtual uint64_t busyTime() const = 0;
 };
 
 } // namespace router
@@ -1,8 +1,18 @@
 #include <router/orchestrator.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <unordered_map>
+
 #include "entryConverter.hpp"
 #include "epsCounter.hpp"
+#include "ingressFilter.hpp"
+#include "queueProbe.hpp"
+#include "routeLimiter.hpp"
+#include "traceSampler.hpp"
 #include "worker.hpp"
+#include "workerScaler.hpp"
 
 namespace router
 {
@@ -28,6 +38,9 @@ void validatePointer(const T& ptr, const std::string& name)
 // Private
 base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
 {
+    // The copies of the environments built by the operation share the build, placed on the nodes of the workers
+    EnvironmentBuilder::SharedScope shared {m_envBuilder};
+    utils::affinity::ScopedPin pin {m_cpus};
     for (const auto& worker : m_workers)
     {
         if (auto error = f(worker); error)
@@ -38,6 +51,20 @@ base::OptError Orchestrator::forEachWorker(const WorkerOp& f)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::forEachTestWorker(const WorkerOp& f)
+{
+    EnvironmentBuilder::SharedScope shared {m_envBuilder};
+    utils::affinity::ScopedPin pin {m_cpus};
+    for (const auto& worker : testWorkers())
+    {
+        if (auto error = f(worker); error)
+        {
+            return error;
+        }
+    }
+    return std::nullopt;
+}
+
 /**************************************************************************
  * Manage configuration - Dump
  *************************************************************************/
@@ -50,6 +77,7 @@ base::OptError loadTesterOnWorker(const std::vector<EntryConverter>& entries, co
         {
             return err;
         }
+        // With an idle timeout the entry is not built yet, it is enabled to be built on its first test
         worker->getTester()->updateLastUsed(entry.name(), entry.lastUse().value_or(0));
         worker->getTester()->enableEntry(entry.name());
     }
@@ -85,7 +113,7 @@ void saveConfig(const std::weak_ptr<store::IStoreInternal>& wStore, const base::
 
 void Orchestrator::dumpTesters() const
 {
-    auto jDump = EntryConverter::toJsonArray(m_workers.front()->getTester()->getEntries());
+    auto jDump = EntryConverter::toJsonArray(testWorkers().front()->getTester()->getEntries());
     saveConfig(m_wStore, m_storeTesterName, jDump);
 }
 
@@ -149,6 +177,55 @@ void Orchestrator::loadEpsCounter(const std::weak_ptr<store::IStoreInternal>& wS
 
     m_epsCounter = std::make_shared<EpsCounter>(eps.value(), refreshInterval.value(), active.value());
 }
+
+void Orchestrator::dumpIngressRules() const
+{
+    saveConfig(m_wStore, STORE_PATH_ROUTER_INGRESS, m_ingressFilter->dump());
+    LOG_INFO("Router: Ingress rules dumped to the store");
+}
+
+void Orchestrator::loadIngressRules()
+{
+    m_ingressFilter = std::make_shared<IngressFilter>();
+
+    auto store = m_wStore.lock();
+    if (!store)
+    {
+        LOG_ERROR("Store is unavailable for loading the ingress rules, no event is filtered");
+        return;
+    }
+
+    // The rules are optional, there are none until the first one is posted
+    if (!store->existsInternalDoc(STORE_PATH_ROUTER_INGRESS))
+    {
+        return;
+    }
+
+    auto rulesResp = store->readInternalDoc(STORE_PATH_ROUTER_INGRESS);
+    if (base::isError(rulesResp))
+    {
+        LOG_WARNING("Router: Ingress rules could not be loaded from the store due to '{}', no event is filtered",
+                    base::getError(rulesResp).message);
+        return;
+    }
+
+    if (auto error = m_ingressFilter->load(base::getResponse(rulesResp)); error)
+    {
+        LOG_ERROR("Router: Ingress rules found in the store are invalid ({}), no event is filtered", error->message);
+        return;
+    }
+
+    if (!m_divertSink)
+    {
+        const auto rules = m_ingressFilter->rules();
+        if (std::any_of(rules.begin(),
+                        rules.end(),
+                        [](const auto& rule) { return rule.action() == prod::IngressAction::DIVERT; }))
+        {
+            LOG_WARNING("Router: There is no divert sink, the events matching the divert ingress rules are dropped");
+        }
+    }
+}
 /**************************************************************************
  * Manage configuration - Loader
  *************************************************************************/
@@ -204,15 +281,61 @@ void Orchestrator::Options::validate() const
     {
         throw std::runtime_error {"Configuration error: numThreads must be between 1 and 128"};
     }
+    if (m_numTestThreads < 0 || m_numTestThreads > 128)
+    {
+        throw std::runtime_error {"Configuration error: numTestThreads must be between 0 and 128"};
+    }
     validatePointer(m_wStore, "store");
     validatePointer(m_builder, "builder");
     validatePointer(m_controllerMaker, "controllerMaker");
     validatePointer(m_prodQueue, "prodQueue");
     validatePointer(m_testQueue, "testQueue");
+    if (!m_prodShards.empty())
+    {
+        if (m_prodShards.size() != static_cast<std::size_t>(m_numThreads))
+        {
+            throw std::runtime_error {"Configuration error: prodShards must have one queue per worker"};
+        }
+        for (const auto& shard : m_prodShards)
+        {
+            validatePointer(shard, "prodShards");
+        }
+    }
     if (m_testTimeout < 1)
     {
         throw std::runtime_error {"Configuration error: testTimeout must be greater than 0"};
     }
+    if (m_testerIdleTimeout < 0)
+    {
+        throw std::runtime_error {"Configuration error: testerIdleTimeout cannot be negative"};
+    }
+    if (m_batchSize < 1 || m_batchSize > 65536)
+    {
+        throw std::runtime_error {"Configuration error: batchSize must be between 1 and 65536"};
+    }
+    if (m_batchLingerUsec < 0)
+    {
+        throw std::runtime_error {"Configuration error: batchLingerUsec cannot be negative"};
+    }
+    if (m_maxThreads != 0)
+    {
+        if (m_maxThreads < m_numThreads || m_maxThreads > 128)
+        {
+            throw std::runtime_error {"Configuration error: maxThreads must be between numThreads and 128"};
+        }
+        if (!m_prodShards.empty())
+        {
+            throw std::runtime_error {"Configuration error: maxThreads cannot be used with prodShards"};
+        }
+        if (m_scaleUpDepth < 1)
+        {
+            throw std::runtime_error {"Configuration error: scaleUpDepth must be greater than 0"};
+        }
+        if (m_scaleIntervalMsec < 1)
+        {
+            throw std::runtime_error {"Configuration error: scaleIntervalMsec must be greater than 0"};
+        }
+    }
 }
 
 base::OptError Orchestrator::addWorker(std::shared_ptr<IWorker> worker)
@@ -228,6 +351,199 @@ base::OptError Orchestrator::addWorker(std::shared_ptr<IWorker> worker)
     return std::nullopt;
 }
 
+void Orchestrator::enqueue(base::Event&& event)
+{
+    if (m_queueProbe)
+    {
+        m_queueProbe->pushed(event);
+    }
+    m_eventQueue->push(std::move(event));
+}
+
+void Orchestrator::enqueueBulk(std::vector<base::Event>& events)
+{
+    if (m_queueProbe)
+    {
+        for (const auto& event : events)
+        {
+            m_queueProbe->pushed(event);
+        }
+    }
+    m_eventQueue->pushBulk(events);
+}
+
+std::size_t Orchestrator::pushEvents(const std::vector<std::string_view>& eventStrs)
+{
+    // The events are parsed in the arena of the router, where the workers release them
+    base::arena::ScopedSubsystem arena {base::arena::Subsystem::ROUTER};
+    std::vector<base::Event> events;
+    events.reserve(eventStrs.size());
+    for (const auto& eventStr : eventStrs)
+    {
+        try
+        {
+            events.emplace_back(base::parseEvent::parseWazuhEvent(eventStr));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING_LIMITED("Error parsing event: '{}' (discarding...)", e.what());
+        }
+    }
+
+    const auto pushed = events.size();
+    enqueueBulk(events);
+    return pushed;
+}
+
+bool Orchestrator::admitEvent(std::string_view eventStr)
+{
+    if (!m_ingressFilter)
+    {
+        return true;
+    }
+
+    switch (m_ingressFilter->check(eventStr))
+    {
+        case IngressFilter::Verdict::ACCEPT: return true;
+        case IngressFilter::Verdict::DIVERT:
+            if (m_divertSink)
+            {
+                m_divertSink(eventStr);
+            }
+            return false;
+        default: return false;
+    }
+}
+
+std::shared_ptr<IWorker> Orchestrator::makeProdWorker(std::size_t index,
+                                                      const std::shared_ptr<ProdQueueType>& queue) const
+{
+    auto cpus = m_cpus.empty() ? m_cpus : utils::affinity::CpuSet {m_cpus[index % m_cpus.size()]};
+    return std::make_shared<Worker>(m_envBuilder,
+                                    queue,
+                                    m_testQueue,
+                                    m_batchSize,
+                                    m_batchLingerUsec,
+                                    m_queueProbe,
+                                    m_dedicatedTesters ? Worker::Role::PRODUCTION : Worker::Role::ALL,
+                                    m_testerIdleTimeout,
+                                    std::move(cpus),
+                                    m_routeLimits);
+}
+
+std::function<std::size_t(std::size_t)> Orchestrator::prodEpsLimit() const
+{
+    // Each worker owns a shard of the EPS bucket
+    return [shard = std::make_shared<EpsCounter::Shard>(m_epsCounter)](std::size_t wanted)
+    {
+        return shard->acquire(wanted);
+    };
+}
+
+void Orchestrator::scaleUp()
+{
+    std::unique_lock lock {m_syncMutex};
+    auto worker = makeProdWorker(m_workers.size(), m_eventQueue);
+    {
+        // The environments are copied from a running worker, reusing their builds
+        EnvironmentBuilder::ReuseScope reuse {m_envBuilder};
+        utils::affinity::ScopedPin pin {m_cpus};
+        std::vector<EntryConverter> routerEntries;
+        for (const auto& entry : m_workers.front()->getRouter()->getEntries())
+        {
+            routerEntries.emplace_back(entry);
+        }
+        std::vector<EntryConverter> testerEntries;
+        if (!m_dedicatedTesters)
+        {
+            for (const auto& entry : m_workers.front()->getTester()->getEntries())
+            {
+                testerEntries.emplace_back(entry);
+            }
+        }
+
+        if (auto error = initWorker(worker, routerEntries, testerEntries); error)
+        {
+            LOG_WARNING("Router: The new worker cannot load all the entries: {}", error->message);
+        }
+    }
+
+    worker->start(prodEpsLimit());
+    m_workers.emplace_back(std::move(worker));
+}
+
+void Orchestrator::runScaler()
+{
+    WorkerScaler scaler {m_minThreads, m_maxThreads, m_scaleUpDepth};
+    std::unordered_map<const IWorker*, uint64_t> lastBusy;
+    auto last = std::chrono::steady_clock::now();
+
+    std::unique_lock stopLock {m_scalerMutex};
+    while (!m_scalerCv.wait_for(
+        stopLock, std::chrono::milliseconds(m_scaleIntervalMsec), [this]() { return m_scalerStop; }))
+    {
+        stopLock.unlock();
+
+        // The busy time of each worker since the last sample, the removed workers are forgotten
+        WorkerScaler::Sample sample {};
+        {
+            std::shared_lock lock {m_syncMutex};
+            std::unordered_map<const IWorker*, uint64_t> busy;
+            for (const auto& worker : m_workers)
+            {
+                const auto workerBusy = worker->busyTime();
+                const auto it = lastBusy.find(worker.get());
+                sample.busyNs += workerBusy - (it == lastBusy.end() ? 0 : it->second);
+                busy.emplace(worker.get(), workerBusy);
+            }
+            lastBusy = std::move(busy);
+            sample.workers = m_workers.size();
+        }
+        sample.depth = m_eventQueue->size();
+        const auto now = std::chrono::steady_clock::now();
+        sample.intervalNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - last).count();
+        last = now;
+
+        const auto change = scaler.next(sample);
+        if (change > 0)
+        {
+            scaleUp();
+            LOG_INFO("Router: Scaled up to {} workers (queue depth: {}, utilization: {:.0f}%)",
+                     sample.workers + 1,
+                     sample.depth,
+                     100 * WorkerScaler::utilization(sample));
+        }
+        else if (change < 0)
+        {
+            if (auto error = removeWorker(); error)
+            {
+                LOG_WARNING("Router: Cannot remove a worker: {}", error->message);
+            }
+            else
+            {
+                LOG_INFO("Router: Scaled down to {} workers (utilization: {:.0f}%)",
+                         sample.workers - 1,
+                         100 * WorkerScaler::utilization(sample));
+            }
+        }
+
+        stopLock.lock();
+    }
+}
+
+void Orchestrator::stopScaler()
+{
+    {
+        std::lock_guard lock {m_scalerMutex};
+        m_scalerStop = true;
+    }
+    m_scalerCv.notify_all();
+    if (m_scaler.joinable())
+    {
+        m_scaler.join();
+    }
+}
+
 base::OptError Orchestrator::removeWorker()
 {
     std::unique_lock lock {m_syncMutex};
@@ -242,6 +558,7 @@ base::OptError Orchestrator::removeWorker()
 
 Orchestrator::Orchestrator(const Options& opt)
     : m_workers()
+    , m_testWorkers()
     , m_eventQueue(opt.m_prodQueue)
     , m_testQueue(opt.m_testQueue)
     , m_envBuilder()
@@ -251,10 +568,46 @@ Orchestrator::Orchestrator(const Options& opt)
 {
     opt.validate();
 
-    m_envBuilder = std::make_shared<EnvironmentBuilder>(opt.m_builder, opt.m_controllerMaker);
+    m_minThreads = opt.m_numThreads;
+    m_maxThreads = opt.m_maxThreads > 0 ? opt.m_maxThreads : opt.m_numThreads;
+    m_scaleUpDepth = opt.m_scaleUpDepth;
+    m_scaleIntervalMsec = opt.m_scaleIntervalMsec;
+    m_dedicatedTesters = opt.m_numTestThreads > 0;
+
+    // With scaling, the builds are retained for the workers that are added later
+    m_envBuilder = std::make_shared<EnvironmentBuilder>(
+        opt.m_builder, opt.m_controllerMaker, opt.m_shareBuilds, m_maxThreads > m_minThreads);
     m_testTimeout = opt.m_testTimeout;
+    m_testerIdleTimeout = opt.m_testerIdleTimeout;
+    m_batchSize = opt.m_batchSize;
+    m_batchLingerUsec = opt.m_batchLingerUsec;
+    m_cpus = opt.m_cpus;
     m_wStore = opt.m_wStore;
+    m_routeLimits = std::make_shared<RouteLimits>();
+    if (opt.m_latencySampleRate > 0 && opt.m_queueLatency)
+    {
+        m_queueProbe = std::make_shared<QueueProbe>(opt.m_latencySampleRate, opt.m_queueLatency);
+    }
 
+    m_numTestThreads = static_cast<std::size_t>(opt.m_numTestThreads);
+    m_prodShards = opt.m_prodShards;
+    m_loadInBackground = opt.m_loadInBackground;
+
+    // Initialize the EpsCounter
+    loadEpsCounter(m_wStore);
+
+    // Initialize the ingress filter
+    m_divertSink = opt.m_divertSink;
+    loadIngressRules();
+
+    if (!m_loadInBackground)
+    {
+        loadWorkers();
+    }
+}
+
+void Orchestrator::loadWorkers()
+{
     // Get the initial states from the store
     auto store = m_wStore.lock();
     if (!store)
@@ -265,11 +618,14 @@ Orchestrator::Orchestrator(const Options& opt)
     auto routerEntries = getEntriesFromStore(store, m_storeRouterName);
     auto testerEntries = getEntriesFromStore(store, m_storeTesterName);
 
-    // Create the workers
-    for (std::size_t i = 0; i < opt.m_numThreads; ++i)
+    // Create the workers, with test only workers the production ones do not load the testers
+    EnvironmentBuilder::SharedScope shared {m_envBuilder};
+    utils::affinity::ScopedPin pin {m_cpus};
+    for (std::size_t i = 0; i < m_minThreads; ++i)
     {
-        auto worker = std::make_shared<Worker>(m_envBuilder, m_eventQueue, m_testQueue);
-        auto error = initWorker(worker, routerEntries, testerEntries);
+        auto worker = makeProdWorker(i, m_prodShards.empty() ? m_eventQueue : m_prodShards[i]);
+        auto error =
+            initWorker(worker, routerEntries, m_dedicatedTesters ? std::vector<EntryConverter> {} : testerEntries);
         if (error)
         {
             LOG_ERROR("Router: Cannot load initial states from store: {}", error->message);
@@ -277,36 +633,120 @@ Orchestrator::Orchestrator(const Options& opt)
         m_workers.emplace_back(std::move(worker));
     }
 
-    // Initialize the EpsCounter
-    loadEpsCounter(m_wStore);
+    for (std::size_t i = 0; i < m_numTestThreads; ++i)
+    {
+        auto worker = std::make_shared<Worker>(m_envBuilder,
+                                               m_eventQueue,
+                                               m_testQueue,
+                                               DEFAULT_BATCH_SIZE,
+                                               DEFAULT_BATCH_LINGER_USEC,
+                                               nullptr,
+                                               Worker::Role::TEST,
+                                               m_testerIdleTimeout,
+                                               m_cpus);
+        auto error = initWorker(worker, {}, testerEntries);
+        if (error)
+        {
+            LOG_ERROR("Router: Cannot load initial tester states from store: {}", error->message);
+        }
+        m_testWorkers.emplace_back(std::move(worker));
+    }
+}
+
+void Orchestrator::startWorkers()
+{
+    for (const auto& worker : m_workers)
+    {
+        worker->start(prodEpsLimit());
+    }
+
+    // The test events are not limited by the EPS
+    for (const auto& worker : m_testWorkers)
+    {
+        worker->start([](std::size_t wanted) { return wanted; });
+    }
+
+    if (m_maxThreads > m_minThreads && !m_scaler.joinable())
+    {
+        m_scalerStop = false;
+        m_scaler = std::thread(&Orchestrator::runScaler, this);
+    }
 }
 
 void Orchestrator::start()
 {
-    std::shared_lock lock {m_syncMutex};
-    IWorker::EpsLimit epsLimit = [epsCounter = m_epsCounter]() -> bool
+    if (!m_loadInBackground)
     {
-        if (epsCounter->isActive())
+        std::shared_lock lock {m_syncMutex};
+        startWorkers();
+        return;
+    }
+
+    if (m_loader.joinable())
+    {
+        return;
+    }
+
+    // The loader holds the workers until they are built and started, the API calls wait for it while the events are
+    // queued. start() returns once the lock is taken, so no call gets in before the workers are loaded.
+    std::promise<void> locked;
+    auto lockTaken = locked.get_future();
+    m_loader = std::thread(
+        [this, locked = std::move(locked)]() mutable
         {
-            return epsCounter->limitReached();
-        }
-        return false;
-    };
+            std::unique_lock lock {m_syncMutex};
+            locked.set_value();
+
+            const auto begin = std::chrono::steady_clock::now();
+            try
+            {
+                loadWorkers();
+            }
+            catch (const std::exception& e)
+            {
+                LOG_ERROR("Router: Cannot load the workers: {}", e.what());
+                return;
+            }
+            startWorkers();
+
+            const auto elapsed =
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+            LOG_INFO("Router: Workers loaded in {} ms, {} events queued meanwhile.",
+                     elapsed.count(),
+                     m_eventQueue->size());
+        });
+    lockTaken.wait();
+}
 
-    for (const auto& worker : m_workers)
+Orchestrator::~Orchestrator()
+{
+    stopLoader();
+    stopScaler();
+}
+
+void Orchestrator::stopLoader()
+{
+    if (m_loader.joinable())
     {
-        worker->start(epsLimit);
+        m_loader.join();
     }
 }
 
 void Orchestrator::stop()
 {
+    // The loader and the scaling thread take the lock of the workers
+    stopLoader();
+    stopScaler();
     std::shared_lock lock {m_syncMutex};
     dumpTesters(); // TODO: For save the last used time
     for (const auto& worker : m_workers)
     {
         worker->stop();
     }
+    for (const auto& worker : m_testWorkers)
+    {
+        worker->stop();
+    }
 }
 
 /**************************************************************************
@@ -399,6 +839,24 @@ base::OptError Orchestrator::changeEntryPriority(const std::string& name, size_t
     return std::nullopt;
 }
 
+base::OptError Orchestrator::changeEntryEpsLimit(const std::string& name, std::size_t epsLimit)
+{
+    if (name.empty())
+    {
+        return base::Error {"Name cannot be empty"};
+    }
+
+    std::unique_lock lock {m_syncMutex};
+    auto error = forEachWorker([&name, epsLimit](const auto& worker)
+                               { return worker->getRouter()->changeEpsLimit(name, epsLimit); });
+    if (error)
+    {
+        return error;
+    }
+    dumpRouters();
+    return std::nullopt;
+}
+
 std::list<prod::Entry> Orchestrator::getEntries() const
 {
     std::shared_lock lock {m_syncMutex};
@@ -415,7 +873,7 @@ base::OptError Orchestrator::postStrEvent(std::string_view event)
     base::OptError err = std::nullopt;
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
+        base::Event ev = base::parseEvent::parseWazuhEvent(event);
         this->postEvent(std::move(ev));
     }
     catch (const std::exception& e)
@@ -430,6 +888,40 @@ base::OptError Orchestrator::postStrEvent(std::string_view event)
     return std::nullopt;
 }
 
+base::RespOrError<prod::SampledTraces> Orchestrator::sampleTraces(const prod::TraceOptions& opt)
+{
+    if (auto err = opt.validate())
+    {
+        return *err;
+    }
+
+    // The sampler is shared by the environment of every worker
+    auto sampler = std::make_shared<TraceSampler>(opt);
+    auto detach = [&opt, &sampler](const auto& worker)
+    {
+        worker->getRouter()->detachSampler(opt.environmentName(), sampler);
+        return base::OptError {};
+    };
+
+    {
+        std::unique_lock lock {m_syncMutex};
+        auto error = forEachWorker([&opt, &sampler](const auto& worker)
+                                   { return worker->getRouter()->attachSampler(opt.environmentName(), sampler); });
+        if (error)
+        {
+            forEachWorker(detach);
+            return *error;
+        }
+    }
+
+    // The workers are not blocked while the samples are collected
+    auto samples = sampler->wait();
+
+    std::unique_lock lock {m_syncMutex};
+    forEachWorker(detach);
+    return samples;
+}
+
 base::OptError Orchestrator::changeEpsSettings(uint eps, uint refreshInterval)
 {
     try
@@ -476,6 +968,48 @@ base::OptError Orchestrator::activateEpsCounter(bool activate)
     return std::nullopt;
 }
 
+base::OptError Orchestrator::postIngressRule(const prod::IngressRule& rule)
+{
+    if (!m_ingressFilter)
+    {
+        return base::Error {"The ingress filter is not initialized"};
+    }
+
+    if (rule.action() == prod::IngressAction::DIVERT && !m_divertSink)
+    {
+        return base::Error {"There is no divert sink configured, the events can only be dropped"};
+    }
+
+    if (auto error = m_ingressFilter->add(rule))
+    {
+        return error;
+    }
+
+    dumpIngressRules();
+    return std::nullopt;
+}
+
+base::OptError Orchestrator::deleteIngressRule(const std::string& name)
+{
+    if (!m_ingressFilter)
+    {
+        return base::Error {"The ingress filter is not initialized"};
+    }
+
+    if (auto error = m_ingressFilter->remove(name))
+    {
+        return error;
+    }
+
+    dumpIngressRules();
+    return std::nullopt;
+}
+
+std::list<prod::IngressRule> Orchestrator::getIngressRules() const
+{
+    return m_ingressFilter ? m_ingressFilter->rules() : std::list<prod::IngressRule> {};
+}
+
 /**************************************************************************
  * ITesterAPI
  *************************************************************************/
@@ -488,13 +1022,13 @@ base::OptError Orchestrator::postTestEntry(const test::EntryPost& entry)
     }
 
     std::unique_lock lock {m_syncMutex};
-    auto error = forEachWorker([&entry](const auto& worker) { return worker->getTester()->addEntry(entry); });
+    auto error = forEachTestWorker([&entry](const auto& worker) { return worker->getTester()->addEntry(entry); });
     if (error)
     {
         return error;
     }
 
-    error = forEachWorker([&entry](const auto& worker) { return worker->getTester()->enableEntry(entry.name()); });
+    error = forEachTestWorker([&entry](const auto& worker) { return worker->getTester()->enableEntry(entry.name()); });
     if (error)
     {
         return error;
@@ -512,7 +1046,7 @@ base::OptError Orchestrator::deleteTestEntry(const std::string& name)
         return base::Error {"Name cannot be empty"};
     }
 
-    auto error = forEachWorker([&name](const auto& worker) { return worker->getTester()->removeEntry(name); });
+    auto error = forEachTestWorker([&name](const auto& worker) { return worker->getTester()->removeEntry(name); });
     if (error)
     {
         return error;
@@ -529,7 +1063,7 @@ base::RespOrError<test::Entry> Orchestrator::getTestEntry(const std::string& nam
     }
 
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getEntry(name);
+    return testWorkers().front()->getTester()->getEntry(name);
 }
 
 base::OptError Orchestrator::reloadTestEntry(const std::string& name)
@@ -540,18 +1074,18 @@ base::OptError Orchestrator::reloadTestEntry(const std::string& name)
     }
 
     std::unique_lock lock {m_syncMutex};
-    auto error = forEachWorker([&name](const auto& worker) { return worker->getTester()->rebuildEntry(name); });
+    auto error = forEachTestWorker([&name](const auto& worker) { return worker->getTester()->rebuildEntry(name); });
     if (error)
     {
         return error;
     }
-    return forEachWorker([&name](const auto& worker) { return worker->getTester()->enableEntry(name); });
+    return forEachTestWorker([&name](const auto& worker) { return worker->getTester()->enableEntry(name); });
 }
 
 std::list<test::Entry> Orchestrator::getTestEntries() const
 {
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getEntries();
+    return testWorkers().front()->getTester()->getEntries();
 }
 
 std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Event&& event, const test::Options& opt)
@@ -584,7 +1118,7 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(base::Even
 
     {
         std::shared_lock lock {m_syncMutex};
-        m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
+        testWorkers().front()->getTester()->updateLastUsed(opt.environmentName());
     }
     return future;
 }
@@ -594,7 +1128,7 @@ std::future<base::RespOrError<test::Output>> Orchestrator::ingestTest(std::strin
 
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
+        base::Event ev = base::parseEvent::parseWazuhEvent(event);
         return this->ingestTest(std::move(ev), opt);
     }
     catch (const std::exception& e)
@@ -625,7 +1159,7 @@ base::OptError Orchestrator::ingestTest(base::Event&& event,
 
     {
         std::shared_lock lock {m_syncMutex};
-        m_workers.front()->getTester()->updateLastUsed(opt.environmentName());
+        testWorkers().front()->getTester()->updateLastUsed(opt.environmentName());
     }
 
     return std::nullopt;
@@ -637,15 +1171,13 @@ base::OptError Orchestrator::ingestTest(std::string_view event,
 {
     try
     {
-        base::Event ev = base::parseEvent::parseWazuhEvent(event.data());
-        this->ingestTest(std::move(ev), opt, callbackFn);
+        base::Event ev = base::parseEvent::parseWazuhEvent(event);
+        return this->ingestTest(std::move(ev), opt, callbackFn);
     }
     catch (const std::exception& e)
     {
         return base::Error {e.what()};
     }
-
-    return std::nullopt;
 }
 
 base::RespOrError<std::unordered_set<std::string>> Orchestrator::getAssets(const std::string& name) const
@@ -656,7 +1188,7 @@ base::RespOrError<std::unordered_set<std::string>> Orchestrator::getAssets(const
     }
 
     std::shared_lock lock {m_syncMutex};
-    return m_workers.front()->getTester()->getAssets(name);
+    return testWorkers().front()->getTester()->getAssets(name);
 }
 
 } // namespace router
@@ -0,0 +1,105 @@
+#ifndef _ROUTER_QUEUE_PROBE_HPP
+#define _ROUTER_QUEUE_PROBE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+#include <base/baseTypes.hpp>
+#include <bk/latency.hpp>
+
+namespace router
+{
+
+/**
+ * @brief Sampled probe of the time the events wait in the production queue.
+ *
+ * One in sampleRate pushed events is stamped, and the wait is recorded when a worker pops it. A single event is probed
+ * at a time, so the workers only compare the popped event against the probed one. The probed event is tracked by a
+ * weak reference, if the queue discards it the probe is replaced by the next sampled event.
+ */
+class QueueProbe
+{
+private:
+    std::size_t m_rate;                ///< Sample one in m_rate pushed events
+    bk::LatencyRecorder m_recorder;    ///< Where the wait times are recorded
+    std::atomic_size_t m_pushes;       ///< Pushed events, to sample them
+    std::atomic<const void*> m_probed; ///< Address of the probed event, nullptr if there is none
+
+    std::mutex m_mutex;                            ///< Protects the probed event
+    std::weak_ptr<json::Json> m_event;             ///< Probed event
+    std::chrono::steady_clock::time_point m_stamp; ///< Time the probed event was pushed
+
+public:
+    /**
+     * @brief Construct a new Queue Probe
+     *
+     * @param rate Sample one in rate pushed events
+     * @param recorder Where the wait times are recorded, in nanoseconds
+     */
+    QueueProbe(std::size_t rate, bk::LatencyRecorder recorder)
+        : m_rate(rate)
+        , m_recorder(std::move(recorder))
+        , m_pushes(0)
+        , m_probed(nullptr)
+    {
+        if (m_rate == 0 || m_recorder == nullptr)
+        {
+            throw std::logic_error("Invalid sample rate or recorder for the queue probe");
+        }
+    }
+
+    /**
+     * @brief Notify an event is about to be pushed to the queue.
+     *
+     * @param event Event to push
+     */
+    void pushed(const base::Event& event)
+    {
+        if (m_pushes.fetch_add(1, std::memory_order_relaxed) % m_rate != 0 || event == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard lock {m_mutex};
+        if (m_probed.load(std::memory_order_relaxed) != nullptr && !m_event.expired())
+        {
+            return;
+        }
+
+        m_event = event;
+        m_stamp = std::chrono::steady_clock::now();
+        m_probed.store(event.get(), std::memory_order_release);
+    }
+
+    /**
+     * @brief Notify an event has been popped from the queue.
+     *
+     * @param event Popped event
+     */
+    void popped(const base::Event& event)
+    {
+        if (m_probed.load(std::memory_order_acquire) != event.get() || event == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard lock {m_mutex};
+        // The address may belong to a new event if the probed one was discarded
+        if (m_event.lock() != event)
+        {
+            return;
+        }
+
+        auto wait = std::chrono::steady_clock::now() - m_stamp;
+        m_recorder(std::chrono::duration_cast<std::chrono::nanoseconds>(wait).count());
+        m_event.reset();
+        m_probed.store(nullptr, std::memory_order_relaxed);
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_QUEUE_PROBE_HPP
@@ -0,0 +1,128 @@
+#ifndef _ROUTER_ROUTE_LIMITER_HPP
+#define _ROUTER_ROUTE_LIMITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace router
+{
+
+/**
+ * @brief Limit of the events per second a route sends to its policy.
+ *
+ * The events are counted in windows of one second, the ones accepted by the filter of the route beyond the limit are
+ * throttled. The limiter of a route is shared by the routers of all the workers, so the limit is for the whole engine
+ * and not for each worker. The count is not exact when the window changes while other workers are counting, a few
+ * events of the previous second may be accounted to the new one.
+ */
+class RouteLimiter
+{
+private:
+    std::atomic_uint64_t m_limit;     ///< Events per second, 0 for no limit
+    std::atomic_int64_t m_second;     ///< Second of the current window
+    std::atomic_uint64_t m_used;      ///< Events admitted in the current window
+    std::atomic_uint64_t m_throttled; ///< Events throttled since the limiter was created
+
+public:
+    RouteLimiter()
+        : m_limit(0)
+        , m_second(0)
+        , m_used(0)
+        , m_throttled(0)
+    {
+    }
+
+    RouteLimiter(const RouteLimiter&) = delete;
+    RouteLimiter& operator=(const RouteLimiter&) = delete;
+
+    /**
+     * @brief Account an event in the window of a second.
+     *
+     * @param nowSec Current second.
+     * @return true if the event is admitted, false if it is throttled.
+     */
+    bool admit(int64_t nowSec)
+    {
+        const auto limit = m_limit.load(std::memory_order_relaxed);
+        if (0 == limit)
+        {
+            return true;
+        }
+
+        auto second = m_second.load(std::memory_order_relaxed);
+        if (second != nowSec && m_second.compare_exchange_strong(second, nowSec, std::memory_order_relaxed))
+        {
+            m_used.store(0, std::memory_order_relaxed);
+        }
+
+        if (m_used.fetch_add(1, std::memory_order_relaxed) < limit)
+        {
+            return true;
+        }
+        m_throttled.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Account an event in the window of the current second.
+     */
+    bool admit()
+    {
+        // Only unlimited routes skip the clock
+        if (0 == m_limit.load(std::memory_order_relaxed))
+        {
+            return true;
+        }
+        return admit(std::chrono::duration_cast<std::chrono::seconds>(
+                         std::chrono::steady_clock::now().time_since_epoch())
+                         .count());
+    }
+
+    void limit(uint64_t eps) { m_limit.store(eps, std::memory_order_relaxed); }
+    uint64_t limit() const { return m_limit.load(std::memory_order_relaxed); }
+    uint64_t throttled() const { return m_throttled.load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Limiters of the routes by name, shared by the routers of the workers.
+ *
+ * A limiter lives while a router has its route, so the throttled events of a route are kept across its rebuilds and
+ * restart from zero once it is deleted from all the workers.
+ */
+class RouteLimits
+{
+private:
+    std::mutex m_mutex;                                                    ///< Protects the limiters
+    std::unordered_map<std::string, std::weak_ptr<RouteLimiter>> m_limits; ///< Limiters by route name
+
+public:
+    /**
+     * @brief Get the limiter of a route, creating it if there is none.
+     */
+    std::shared_ptr<RouteLimiter> get(const std::string& name)
+    {
+        std::lock_guard lock {m_mutex};
+        auto limiter = m_limits[name].lock();
+        if (!limiter)
+        {
+            // Drop the limiters of the deleted routes
+            for (auto it = m_limits.begin(); it != m_limits.end();)
+            {
+                it = it->second.expired() && it->first != name ? m_limits.erase(it) : std::next(it);
+            }
+
+            limiter = std::make_shared<RouteLimiter>();
+            m_limits[name] = limiter;
+        }
+        return limiter;
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_ROUTE_LIMITER_HPP
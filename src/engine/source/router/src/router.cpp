@@ -1,3 +1,4 @@
+#include <atomic>
 #include <chrono>
 #include <functional>
 
@@ -54,7 +55,11 @@ base::OptError Router::addEntry(const prod::EntryPost& entryPost, bool ignoreFai
         {
             return base::Error {"The priority of the route  is already in use"};
         }
+        entry.limiter() = m_routeLimits->get(entryPost.name());
+        entry.limiter()->limit(entryPost.epsLimit());
         m_table.insert(entryPost.name(), entryPost.priority(), std::move(entry));
+        // Disabled entries are not routed, but the snapshot is kept in sync with the table
+        publishSnapshot();
     }
 
     return std::nullopt;
@@ -69,30 +74,51 @@ base::OptError Router::removeEntry(const std::string& name)
         return base::Error {"The route not exist"};
     }
     m_table.erase(name);
+    publishSnapshot();
     return std::nullopt;
 }
 
 base::OptError Router::rebuildEntry(const std::string& name)
 {
-    std::unique_lock lock {m_mutex};
-    if (!m_table.nameExists(name))
+    // The environment is built without holding the table, and swapped once it is ready
+    base::Name policy;
+    base::Name filter;
     {
-        return base::Error {"The route not exist"};
+        std::shared_lock lock {m_mutex};
+        if (!m_table.nameExists(name))
+        {
+            return base::Error {"The route not exist"};
+        }
+        policy = m_table.get(name).policy();
+        filter = m_table.get(name).filter();
     }
-    auto& entry = m_table.get(name);
+
+    std::unique_ptr<Environment> uniqueEnv;
     try
     {
-        auto uniqueEnv = m_envBuilder->create(entry.policy(), entry.filter());
-        entry.environment() = std::move(uniqueEnv);
-        entry.lastUpdate(getStartTime());
-        entry.hash(entry.environment()->hash());
-        // Mantaing the status of the environment
+        uniqueEnv = m_envBuilder->create(policy, filter);
     }
     catch (const std::exception& e)
     {
         return base::Error {fmt::format("Failed to reload the route: {}", e.what())};
     }
 
+    std::unique_lock lock {m_mutex};
+    if (!m_table.nameExists(name))
+    {
+        return base::Error {"The route not exist"};
+    }
+    auto& entry = m_table.get(name);
+    if (entry.policy() != policy || entry.filter() != filter)
+    {
+        return base::Error {"The route changed while it was reloaded"};
+    }
+    entry.environment() = std::move(uniqueEnv);
+    entry.lastUpdate(getStartTime());
+    entry.hash(entry.environment()->hash());
+    // Mantaing the status of the environment
+    publishSnapshot();
+
     return std::nullopt;
 }
 
@@ -109,6 +135,7 @@ base::OptError Router::enableEntry(const std::string& name)
         return base::Error {"The route is not buided"};
     }
     entry.status(env::State::ENABLED);
+    publishSnapshot();
     return {};
 }
 
@@ -139,10 +166,26 @@ base::OptError Router::changePriority(const std::string& name, size_t priority)
     }
     // Sync the priority
     m_table.get(name).priority(priority);
+    publishSnapshot();
 
     return {};
 }
 
+base::OptError Router::changeEpsLimit(const std::string& name, std::size_t epsLimit)
+{
+    std::unique_lock lock {m_mutex};
+    if (!m_table.nameExists(name))
+    {
+        return base::Error {"The route not exist"};
+    }
+
+    // The snapshot shares the limiter, the new limit is applied to the next event
+    auto& entry = m_table.get(name);
+    entry.epsLimit(epsLimit);
+    entry.limiter()->limit(epsLimit);
+    return {};
+}
+
 std::list<prod::Entry> Router::getEntries() const
 {
     std::shared_lock lock {m_mutex};
@@ -151,6 +194,7 @@ std::list<prod::Entry> Router::getEntries() const
     for (const auto& entry : m_table)
     {
         entries.push_back(entry);
+        entries.back().throttled(entry.limiter()->throttled());
     }
     return entries;
 }
@@ -162,26 +206,117 @@ base::RespOrError<prod::Entry> Router::getEntry(const std::string& name) const
     {
         return base::Error {"The route not exist"};
     }
-    return m_table.get(name);
+    const auto& entry = m_table.get(name);
+    prod::Entry result {entry};
+    result.throttled(entry.limiter()->throttled());
+    return result;
 }
 
-void Router::ingest(base::Event&& event)
+base::OptError Router::attachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler)
 {
-    std::shared_lock lock {m_mutex};
+    std::unique_lock lock {m_mutex};
+    if (!m_table.nameExists(name))
+    {
+        return base::Error {"The route not exist"};
+    }
+    auto& entry = m_table.get(name);
+    if (entry.status() != env::State::ENABLED || entry.environment() == nullptr)
+    {
+        return base::Error {"The route is not enabled"};
+    }
+    return entry.environment()->attachSampler(sampler);
+}
+
+void Router::detachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler)
+{
+    std::unique_lock lock {m_mutex};
+    if (m_table.nameExists(name) && m_table.get(name).environment() != nullptr)
+    {
+        m_table.get(name).environment()->detachSampler(sampler);
+    }
+}
 
+void Router::publishSnapshot()
+{
+    auto snapshot = std::make_shared<RouteSnapshot>();
+    snapshot->routes.reserve(m_table.size());
+    snapshot->limiters.reserve(m_table.size());
     for (const auto& entry : m_table)
     {
-        if (entry.status() == env::State::ENABLED && entry.environment()->isAccepted(event))
+        if (entry.status() == env::State::ENABLED && entry.environment() != nullptr)
         {
-            entry.environment()->ingest(std::move(event));
+            snapshot->index.add(snapshot->routes.size(), entry.environment()->filterKey());
+            snapshot->routes.emplace_back(entry.environment());
+            snapshot->limiters.emplace_back(entry.limiter());
+        }
+    }
+
+    std::atomic_store_explicit(
+        &m_snapshot, std::shared_ptr<const RouteSnapshot>(std::move(snapshot)), std::memory_order_release);
+}
+
+void Router::route(const RouteSnapshot& snapshot, base::Event&& event)
+{
+    auto accept = [&snapshot, &event](std::size_t position)
+    {
+        const auto& environment = snapshot.routes[position];
+        if (environment->isAccepted(event))
+        {
+            // A throttled event is discarded, it does not fall through to the routes of lower priority
+            if (snapshot.limiters[position]->admit())
+            {
+                environment->ingest(std::move(event));
+            }
             event = nullptr;
-            break;
+            return true;
+        }
+        return false;
+    };
+
+    if (snapshot.index.empty())
+    {
+        for (std::size_t position = 0; position < snapshot.routes.size(); ++position)
+        {
+            if (accept(position))
+            {
+                break;
+            }
+        }
+    }
+    else
+    {
+        thread_local std::vector<std::size_t> candidates;
+        snapshot.index.candidates(event, candidates);
+        for (auto position : candidates)
+        {
+            if (accept(position))
+            {
+                break;
+            }
         }
     }
 
     if (event)
     {
-        LOG_WARNING("Event not processed: {}", event->str());
+        LOG_WARNING_LIMITED("Event not processed: {}", event->str());
+    }
+}
+
+void Router::ingest(base::Event&& event)
+{
+    const auto snapshot = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+    route(*snapshot, std::move(event));
+}
+
+void Router::ingest(std::vector<base::Event>&& events)
+{
+    const auto snapshot = std::atomic_load_explicit(&m_snapshot, std::memory_order_acquire);
+    for (auto& event : events)
+    {
+        if (event)
+        {
+            route(*snapshot, std::move(event));
+        }
     }
 }
 
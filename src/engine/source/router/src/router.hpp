@@ -3,11 +3,14 @@
 
 #include <memory>
 #include <shared_mutex>
+#include <vector>
 
 #include <builder/ibuilder.hpp>
 
-#include "table.hpp"
+#include "filterIndex.hpp"
 #include "irouter.hpp"
+#include "routeLimiter.hpp"
+#include "table.hpp"
 
 namespace router
 {
@@ -21,30 +24,71 @@ private:
     class RuntimeEntry : public prod::Entry
     {
     private:
-        std::unique_ptr<Environment> m_env; ///< The environment associated with the entry.
+        std::shared_ptr<Environment> m_env;      ///< The environment associated with the entry.
+        std::shared_ptr<RouteLimiter> m_limiter; ///< The EPS limiter of the route, shared by the workers.
 
     public:
         explicit RuntimeEntry(const prod::EntryPost& entry)
             : prod::Entry(entry) {};
 
-        const std::unique_ptr<Environment>& environment() const { return m_env; }
-        std::unique_ptr<Environment>& environment() { return m_env; }
+        const std::shared_ptr<Environment>& environment() const { return m_env; }
+        std::shared_ptr<Environment>& environment() { return m_env; }
+
+        const std::shared_ptr<RouteLimiter>& limiter() const { return m_limiter; }
+        std::shared_ptr<RouteLimiter>& limiter() { return m_limiter; }
+    };
+
+    /**
+     * @brief Immutable view of the enabled environments, sorted by priority.
+     *
+     * The snapshot shares ownership of the environments, so an environment removed or rebuilt from the table stays
+     * alive until the last event being routed with an older snapshot is done.
+     */
+    struct RouteSnapshot
+    {
+        std::vector<std::shared_ptr<const Environment>> routes; ///< Enabled environments, sorted by priority
+        std::vector<std::shared_ptr<RouteLimiter>> limiters;    ///< EPS limiters, in the order of the routes
+        FilterIndex index;                                      ///< Dispatch index of the routes by their filters
     };
 
     internal::Table<RuntimeEntry> m_table; ///< Internal table for managing Production Environments.
-    mutable std::shared_mutex m_mutex;     ///< Mutex for the table.
+    mutable std::shared_mutex m_mutex;     ///< Mutex for the table (writers and management queries only).
+
+    std::shared_ptr<const RouteSnapshot> m_snapshot; ///< Enabled routes, accessed atomically by the ingest path
 
     std::shared_ptr<EnvironmentBuilder> m_envBuilder; ///< Environment builder for create new entries
+    std::shared_ptr<RouteLimits> m_routeLimits;       ///< EPS limiters of the routes, shared with other routers
+
+    /**
+     * @brief Rebuild the route snapshot from the table and publish it.
+     *
+     * @note The caller must hold the unique lock on m_mutex.
+     */
+    void publishSnapshot();
+
+    /**
+     * @brief Route the event to the first environment of the snapshot that accepts it.
+     *
+     * Only the candidates of the dispatch index are checked, in priority order. An event accepted by a route beyond
+     * its EPS limit is throttled, it is discarded instead of being offered to the next routes.
+     *
+     * @param snapshot The route snapshot to use.
+     * @param event The event to be routed.
+     */
+    static void route(const RouteSnapshot& snapshot, base::Event&& event);
 
 public:
     /**
      * @brief Constructs a Router with the specified environment builder.
      * @param envBuilder The shared pointer to the EnvironmentBuilder.
+     * @param routeLimits The EPS limiters shared with the routers of the other workers, nullptr for own ones.
      */
-    Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
+    Router(const std::shared_ptr<EnvironmentBuilder>& envBuilder, std::shared_ptr<RouteLimits> routeLimits = nullptr)
         : m_table()
         , m_mutex()
-        , m_envBuilder(envBuilder) {};
+        , m_snapshot(std::make_shared<const RouteSnapshot>())
+        , m_envBuilder(envBuilder)
+        , m_routeLimits(routeLimits ? std::move(routeLimits) : std::make_shared<RouteLimits>()) {};
 
     /**
      * @brief Constructs a Router with the specified builder.
@@ -53,7 +97,9 @@ public:
     Router(const std::weak_ptr<builder::IBuilder>& builder, std::shared_ptr<bk::IControllerMaker> controllerMaker)
         : m_table()
         , m_mutex()
-        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker)) {};
+        , m_snapshot(std::make_shared<const RouteSnapshot>())
+        , m_envBuilder(std::make_shared<EnvironmentBuilder>(builder, controllerMaker))
+        , m_routeLimits(std::make_shared<RouteLimits>()) {};
 
     /**
      * @copydoc IRouter::addEntry
@@ -80,6 +126,11 @@ public:
      */
     base::OptError changePriority(const std::string& name, size_t priority) override;
 
+    /**
+     * @copydoc IRouter::changeEpsLimit
+     */
+    base::OptError changeEpsLimit(const std::string& name, std::size_t epsLimit) override;
+
     /**
      * @copydoc IRouter::getEntries
      */
@@ -94,6 +145,21 @@ public:
      * @copydoc IRouter::ingest
      */
     void ingest(base::Event&& event) override;
+
+    /**
+     * @copydoc IRouter::ingest(std::vector<base::Event>&&)
+     */
+    void ingest(std::vector<base::Event>&& events) override;
+
+    /**
+     * @copydoc IRouter::attachSampler
+     */
+    base::OptError attachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler) override;
+
+    /**
+     * @copydoc IRouter::detachSampler
+     */
+    void detachSampler(const std::string& name, const std::shared_ptr<TraceSampler>& sampler) override;
 };
 
 } // namespace router
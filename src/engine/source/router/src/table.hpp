@@ -1,11 +1,13 @@
 #ifndef _ROUTER_TABLE_HPP
 #define _ROUTER_TABLE_HPP
 
-#include <list>
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <router/types.hpp>
 
@@ -22,8 +24,9 @@ namespace internal
  *
  * @tparam T The type of object to be stored. Must be move constructible.
  *
- * The objects are stored in a set sorted by priority, and can be accessed by name
- * using a hash map for fast lookup.
+ * The objects are stored contiguously in a vector sorted by priority, so iterating the table walks adjacent memory,
+ * and can be accessed by name using a hash map of positions for fast lookup. The positions are rebuilt on every
+ * mutation, the references returned by get are invalidated by insert, erase and setPriority.
  */
 template<typename T>
 class Table
@@ -44,17 +47,37 @@ private:
         }
     };
 
-    // List to store the items, sorted by priority if needed.
-    std::list<Item> m_itemList;
+    // Vector to store the items, sorted by priority.
+    std::vector<Item> m_items;
 
-    // Hash map to index the items by name.
-    std::unordered_map<std::string, typename std::list<Item>::iterator> m_nameIndex;
+    // Hash map to index the position of the items by name.
+    std::unordered_map<std::string, std::size_t> m_nameIndex;
 
     // Function to find the insertion point based on priority.
-    typename std::list<Item>::iterator findInsertionPoint(std::size_t priority)
+    typename std::vector<Item>::const_iterator findInsertionPoint(std::size_t priority) const
     {
-        return std::find_if(
-            m_itemList.begin(), m_itemList.end(), [priority](const Item& item) { return item.priority >= priority; });
+        return std::lower_bound(m_items.cbegin(),
+                                m_items.cend(),
+                                priority,
+                                [](const Item& item, std::size_t value) { return item.priority < value; });
+    }
+
+    // Function to update the positions of the items from the given one onwards.
+    void reindex(std::size_t from)
+    {
+        for (auto position = from; position < m_items.size(); ++position)
+        {
+            m_nameIndex[m_items[position].name] = position;
+        }
+    }
+
+    // Function to insert an item in its place by priority.
+    void emplaceSorted(Item&& item)
+    {
+        auto it = findInsertionPoint(item.priority);
+        auto position = static_cast<std::size_t>(std::distance(m_items.cbegin(), it));
+        m_items.emplace(it, std::move(item));
+        reindex(position);
     }
 
 public:
@@ -71,14 +94,8 @@ public:
      */
     bool priorityExists(std::size_t priority) const
     {
-        for (const auto& item : m_itemList)
-        {
-            if (item.priority == priority)
-                return true;
-            if (item.priority > priority)
-                break;
-        }
-        return false;
+        auto it = findInsertionPoint(priority);
+        return it != m_items.cend() && it->priority == priority;
     }
 
     /**
@@ -105,9 +122,7 @@ public:
             return false;
         }
 
-        auto it = findInsertionPoint(priority);
-        auto emplacedItem = m_itemList.emplace(it, Item(name, priority, std::move(object)));
-        m_nameIndex[name] = emplacedItem;
+        emplaceSorted(Item(name, priority, std::move(object)));
         return true;
     }
 
@@ -127,9 +142,7 @@ public:
             return false;
         }
 
-        auto it = findInsertionPoint(priority);
-        auto emplacedItem = m_itemList.emplace(it, Item(name, priority, object));
-        m_nameIndex[name] = emplacedItem;
+        emplaceSorted(Item(name, priority, object));
         return true;
     }
 
@@ -143,8 +156,10 @@ public:
         auto it = m_nameIndex.find(name);
         if (it != m_nameIndex.end())
         {
-            m_itemList.erase(it->second);
+            auto position = it->second;
+            m_items.erase(m_items.begin() + position);
             m_nameIndex.erase(it);
+            reindex(position);
             return true;
         }
         return false;
@@ -166,7 +181,8 @@ public:
             return false; // Name does not exist
         }
 
-        if (name_it->second->priority == newPriority)
+        auto position = name_it->second;
+        if (m_items[position].priority == newPriority)
         {
             return true; // New priority is the same
         }
@@ -175,18 +191,11 @@ public:
             return false; // New priority is already used
         }
 
-        // Create a new Item object with the new priority
-        auto item_it = name_it->second;
-        Item newItem(item_it->name, newPriority, std::move(item_it->object));
-
-        // Erase the old item and update the index
-        m_itemList.erase(item_it);
-        m_nameIndex.erase(name_it);
-
-        // Insert the new item and update the index
-        auto new_it = findInsertionPoint(newPriority);
-        auto emplacedItem = m_itemList.emplace(new_it, std::move(newItem));
-        m_nameIndex[name] = emplacedItem;
+        // Move the item out with the new priority and insert it again in its place
+        Item newItem(std::move(m_items[position].name), newPriority, std::move(m_items[position].object));
+        m_items.erase(m_items.begin() + position);
+        reindex(position);
+        emplaceSorted(std::move(newItem));
 
         return true;
     }
@@ -236,7 +245,7 @@ public:
             throw std::out_of_range("No element with the given name.");
         }
         // Return a reference to the object of type T within the Item struct.
-        return it->second->object;
+        return m_items[it->second].object;
     }
 
     /**
@@ -254,15 +263,15 @@ public:
             throw std::out_of_range("No element with the given name.");
         }
         // Return a reference to the object of type T within the Item struct.
-        return it->second->object;
+        return m_items[it->second].object;
     }
 
     class iterator
     {
-        typename std::list<Item>::iterator it;
+        typename std::vector<Item>::iterator it;
 
     public:
-        iterator(typename std::list<Item>::iterator it)
+        iterator(typename std::vector<Item>::iterator it)
             : it(it)
         {
         }
@@ -290,12 +299,12 @@ public:
     class const_iterator
     {
     private:
-        typename std::list<Item>::const_iterator it;
+        typename std::vector<Item>::const_iterator it;
 
     public:
         const_iterator() = default;
 
-        explicit const_iterator(typename std::list<Item>::const_iterator it)
+        explicit const_iterator(typename std::vector<Item>::const_iterator it)
             : it(it)
         {
         }
@@ -325,54 +334,54 @@ public:
      *
      * @return An iterator to the beginning of the set.
      */
-    iterator begin() { return iterator(m_itemList.begin()); }
+    iterator begin() { return iterator(m_items.begin()); }
 
     /**
      * @brief Get an iterator to the end of the set.
      *
      * @return An iterator to the end of the set.
      */
-    iterator end() { return iterator(m_itemList.end()); }
+    iterator end() { return iterator(m_items.end()); }
 
     /**
      * @brief Get a const iterator to the beginning of the set.
      *
      * @return A const iterator to the beginning of the set.
      */
-    const_iterator begin() const { return const_iterator(m_itemList.cbegin()); }
+    const_iterator begin() const { return const_iterator(m_items.cbegin()); }
 
     /**
      * @brief Get a const iterator to the end of the set.
      *
      * @return A const iterator to the end of the set.
      */
-    const_iterator end() const { return const_iterator(m_itemList.cend()); }
+    const_iterator end() const { return const_iterator(m_items.cend()); }
 
     /**
      * @brief Get a const iterator to the beginning of the set.
      *
      * @return A const iterator to the beginning of the set.
      */
-    const_iterator cbegin() const { return const_iterator(m_itemList.cbegin()); }
+    const_iterator cbegin() const { return const_iterator(m_items.cbegin()); }
 
     /**
      * @brief Get a const iterator to the end of the set.
      *
      * @return A const iterator to the end of the set.
      */
-    const_iterator cend() const { return const_iterator(m_itemList.cend()); }
+    const_iterator cend() const { return const_iterator(m_items.cend()); }
 
     /**
      * @brief Size of the set.
      *
      */
-    std::size_t size() const { return m_itemList.size(); }
+    std::size_t size() const { return m_items.size(); }
 
     /**
      * @brief Check if the set is empty.
      *
      */
-    bool empty() const { return m_itemList.empty(); }
+    bool empty() const { return m_items.empty(); }
 
     /**
      * @brief Get list of all names and priorities.
@@ -381,8 +390,8 @@ public:
     std::vector<std::pair<std::string, std::size_t>> list() const
     {
         std::vector<std::pair<std::string, std::size_t>> result;
-        result.reserve(m_itemList.size());
-        for (const auto& item : m_itemList)
+        result.reserve(m_items.size());
+        for (const auto& item : m_items)
         {
             result.emplace_back(item.name, item.priority);
         }
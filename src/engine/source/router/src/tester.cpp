@@ -1,5 +1,7 @@
 #include "tester.hpp"
 
+#include <vector>
+
 namespace
 {
 /**
@@ -11,76 +13,40 @@ inline int64_t getStartTime()
     return std::chrono::duration_cast<std::chrono::seconds>(startTime.time_since_epoch()).count();
 }
 
+constexpr auto RELEASE_INTERVAL = std::chrono::seconds(1); ///< Minimum time between two looks for idle controllers
+
 } // namespace
 
 namespace router
 {
 
-namespace test
-{
-class InternalOutput : public Output
-{
-private:
-    std::unordered_map<std::string, std::list<DataPair>::iterator> m_dataMap;
-
-public:
-    InternalOutput()
-        : Output()
-        , m_dataMap()
-    {
-    }
-
-    void addTrace(const std::string& asset,
-                  const std::string& traceContent,
-                  bool result,
-                  const test::Options::TraceLevel level)
-    {
-        if (traceContent.empty())
-        {
-            return;
-        }
-
-        // Try inserting the asset into the map.
-        auto [it, inserted] = m_dataMap.try_emplace(asset, m_traces.end());
-
-        // If is new, insert it into the list.
-        if (inserted)
-        {
-            m_traces.emplace_back(asset, Output::AssetTrace {});
-            it->second = std::prev(m_traces.end());
-        }
-
-        auto& data = it->second->second;
-
-        if (traceContent == "SUCCESS")
-        {
-            data.success = true;
-        }
-        else if (level == test::Options::TraceLevel::ALL)
-        {
-            data.traces.push_back(traceContent);
-        }
-    }
-};
-} // namespace test
-
 base::OptError Tester::addEntry(const test::EntryPost& entryPost, bool ignoreFail)
 {
     auto entry = RuntimeEntry(entryPost);
-    try
+    if (ignoreFail && m_idleTimeout.count() > 0)
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
-        entry.controller() = controller;
-        entry.hash(hash);
+        // The loaded entries are built on their first test
+        entry.lazy(true);
+        entry.hash("");
     }
-    catch (const std::exception& e)
+    else
     {
-        if (!ignoreFail)
+        try
         {
-            return base::Error {fmt::format("Failed to create the testing environment: {}", e.what())};
+            auto [controller, hash] = m_envBuilder->makeController(entry.policy());
+            entry.controller() = controller;
+            entry.hash(hash);
+            entry.touch();
+        }
+        catch (const std::exception& e)
+        {
+            if (!ignoreFail)
+            {
+                return base::Error {fmt::format("Failed to create the testing environment: {}", e.what())};
+            }
+            entry.controller() = nullptr;
+            entry.hash("");
         }
-        entry.controller() = nullptr;
-        entry.hash("");
     }
     entry.status(env::State::DISABLED); // It is disabled until all tester are ready
     entry.lifetime(entry.lifetime());
@@ -113,6 +79,29 @@ base::OptError Tester::removeEntry(const std::string& name)
 
 base::OptError Tester::rebuildEntry(const std::string& name)
 {
+    // The controller is built without holding the table, and swapped once it is ready
+    base::Name policy;
+    {
+        std::shared_lock lock {m_mutex};
+        auto it = m_table.find(name);
+        if (it == m_table.end())
+        {
+            return base::Error {"The testing environment not exist"};
+        }
+        policy = it->second.policy();
+    }
+
+    std::shared_ptr<bk::IController> controller;
+    std::string hash;
+    try
+    {
+        std::tie(controller, hash) = m_envBuilder->makeController(policy);
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Failed to create the testing environment: {}", e.what())};
+    }
+
     std::unique_lock lock {m_mutex};
     auto it = m_table.find(name);
     if (it == m_table.end())
@@ -120,16 +109,70 @@ base::OptError Tester::rebuildEntry(const std::string& name)
         return base::Error {"The testing environment not exist"};
     }
     auto& entry = it->second;
+    if (entry.policy() != policy)
+    {
+        return base::Error {"The testing environment changed while it was reloaded"};
+    }
+    entry.controller() = controller;
+    entry.traceSession().reset();
+    entry.hash(hash);
+    entry.touch();
+    return std::nullopt;
+}
+
+base::OptError Tester::loadEntry(const std::string& name)
+{
+    base::Name policy;
+    {
+        std::shared_lock lock {m_mutex};
+        auto it = m_table.find(name);
+        if (it == m_table.end())
+        {
+            return base::Error {"The testing environment not exist"};
+        }
+        if (it->second.controller() != nullptr)
+        {
+            return std::nullopt;
+        }
+        policy = it->second.policy();
+    }
+
+    std::shared_ptr<bk::IController> controller;
+    std::string hash;
     try
     {
-        auto [controller, hash] = m_envBuilder->makeController(entry.policy());
-        entry.controller() = controller;
-        entry.hash(hash);
+        std::tie(controller, hash) = m_envBuilder->makeController(policy);
     }
     catch (const std::exception& e)
     {
         return base::Error {fmt::format("Failed to create the testing environment: {}", e.what())};
     }
+
+    std::unique_lock lock {m_mutex};
+    auto it = m_table.find(name);
+    if (it == m_table.end())
+    {
+        return base::Error {"The testing environment not exist"};
+    }
+    auto& entry = it->second;
+    if (entry.policy() != policy)
+    {
+        return base::Error {"The testing environment changed while it was loaded"};
+    }
+
+    // Another thread may have loaded it in the meantime
+    if (entry.controller() == nullptr)
+    {
+        entry.controller() = controller;
+        entry.traceSession().reset();
+        entry.hash(hash);
+        entry.touch();
+        LOG_DEBUG("Tester: testing environment '{}' loaded", name);
+    }
+    else
+    {
+        controller->stop();
+    }
     return std::nullopt;
 }
 
@@ -142,7 +185,7 @@ base::OptError Tester::enableEntry(const std::string& name)
         return base::Error {"The testing environment not exist"};
     }
     auto& entry = it->second;
-    if (entry.controller() == nullptr)
+    if (entry.controller() == nullptr && !entry.lazy())
     {
         return base::Error {"The testing environment is not builded"};
     }
@@ -175,6 +218,24 @@ base::RespOrError<test::Entry> Tester::getEntry(const std::string& name) const
 // Testing
 base::RespOrError<test::Output> Tester::ingestTest(base::Event&& event, const test::Options& opt)
 {
+    // Build the lazy entries on their first test
+    bool load = false;
+    {
+        std::shared_lock lock {m_mutex};
+        auto it = m_table.find(opt.environmentName());
+        if (it != m_table.end() && it->second.status() == env::State::ENABLED)
+        {
+            load = it->second.controller() == nullptr && it->second.lazy();
+        }
+    }
+    if (load)
+    {
+        if (auto err = loadEntry(opt.environmentName()); err)
+        {
+            return *err;
+        }
+    }
+
     std::shared_lock lock {m_mutex};
 
     auto it = m_table.find(opt.environmentName());
@@ -189,45 +250,81 @@ base::RespOrError<test::Output> Tester::ingestTest(base::Event&& event, const te
         return base::Error {"The testing environment is not enabled"};
     }
 
-    // Configure the environment
-    auto result = std::make_shared<test::InternalOutput>();
-    for (const auto& asset : opt.assets())
+    // Configure the environment, the subscriptions are kept while the tests trace the same assets. Only the worker
+    // owning this tester runs the tests, so the session is not shared with other threads.
+    auto& session = entry.traceSession();
+    if (!session || session->assets != opt.assets())
     {
-        bk::Subscriber subFn = [asset, result, level = opt.traceLevel()](const std::string& trace, bool success) -> void
-        {
-            result->addTrace(asset, trace, success, level);
-        };
-        auto err = entry.controller()->subscribe(asset, subFn);
-        if (base::isError(err))
+        if (session)
         {
             entry.controller()->unsubscribeAll();
-            return base::getError(err);
         }
+        session = std::make_shared<TraceSession>();
+        for (const auto& asset : opt.assets())
+        {
+            bk::Subscriber subFn = [asset, session](const std::string& trace, bool success) -> void
+            {
+                if (session->current != nullptr)
+                {
+                    session->current->addTrace(asset, trace, success, session->level);
+                }
+            };
+            auto err = entry.controller()->subscribe(asset, subFn);
+            if (base::isError(err))
+            {
+                entry.controller()->unsubscribeAll();
+                session.reset();
+                return base::getError(err);
+            }
+        }
+        session->assets = opt.assets();
     }
 
     // Run the test
-    result->event() = entry.controller()->ingestGet(std::move(event));
+    entry.touch();
+    session->level = opt.traceLevel();
+    session->current = std::make_shared<test::InternalOutput>();
+    session->current->event() = entry.controller()->ingestGet(std::move(event));
+    auto output = std::move(session->current);
 
-    // Reset controller
-    entry.controller()->unsubscribeAll();
-
-    return *result;
+    return std::move(*output);
 }
 
-base::RespOrError<std::unordered_set<std::string>> Tester::getAssets(const std::string& name) const
+base::RespOrError<std::unordered_set<std::string>> Tester::getAssets(const std::string& name)
 {
-    std::shared_lock lock {m_mutex};
-    auto it = m_table.find(name);
-    if (it == m_table.end())
+    bool load = false;
     {
-        return base::Error {"The testing environment not exist"};
+        std::shared_lock lock {m_mutex};
+        auto it = m_table.find(name);
+        if (it == m_table.end())
+        {
+            return base::Error {"The testing environment not exist"};
+        }
+        auto& entry = it->second;
+        if (entry.status() == env::State::ENABLED && entry.controller() != nullptr)
+        {
+            return entry.controller()->getTraceables();
+        }
+        load = entry.status() == env::State::ENABLED && entry.lazy();
     }
-    auto& entry = it->second;
-    if (entry.status() != env::State::ENABLED || entry.controller() == nullptr)
+
+    // The assets are asked before the first test, so the lazy entries are built here
+    if (!load)
+    {
+        return base::Error {"The testing environment is not builded"};
+    }
+    if (auto err = loadEntry(name); err)
+    {
+        return *err;
+    }
+
+    std::shared_lock lock {m_mutex};
+    auto it = m_table.find(name);
+    if (it == m_table.end() || it->second.controller() == nullptr)
     {
         return base::Error {"The testing environment is not builded"};
     }
-    return entry.controller()->getTraceables();
+    return it->second.controller()->getTraceables();
 }
 
 bool Tester::updateLastUsed(const std::string& name, uint64_t lastUsed)
@@ -249,4 +346,41 @@ bool Tester::updateLastUsed(const std::string& name, uint64_t lastUsed)
     }
     return true;
 }
+
+void Tester::releaseIdle()
+{
+    if (m_idleTimeout.count() == 0)
+    {
+        return;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (now < m_nextRelease)
+    {
+        return;
+    }
+    m_nextRelease = now + RELEASE_INTERVAL;
+
+    // The controllers are stopped out of the table lock
+    std::vector<std::shared_ptr<bk::IController>> released;
+    {
+        std::unique_lock lock {m_mutex};
+        for (auto& [name, entry] : m_table)
+        {
+            if (entry.controller() != nullptr && now - entry.lastTest() >= m_idleTimeout)
+            {
+                released.emplace_back(std::move(entry.controller()));
+                entry.controller() = nullptr;
+                entry.traceSession().reset();
+                entry.lazy(true);
+                LOG_DEBUG("Tester: testing environment '{}' released after {}s idle", name, m_idleTimeout.count());
+            }
+        }
+    }
+
+    for (const auto& controller : released)
+    {
+        controller->stop();
+    }
+}
 } // namespace router
@@ -1,10 +1,12 @@
 #ifndef ROUTER_TESTER_HPP
 #define ROUTER_TESTER_HPP
 
+#include <chrono>
 #include <list>
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 #include <bk/icontroller.hpp>
 
@@ -12,20 +14,38 @@
 
 #include "environmentBuilder.hpp"
 #include "itester.hpp"
+#include "traceSampler.hpp"
 
 namespace router
 {
 
 /**
  * @copydoc ITester
+ *
+ * With an idle timeout, the entries loaded with ignoreFail are built on their first test, and the controllers of the
+ * entries not tested during the timeout are released until the next test. Each worker owns its tester, so the idle
+ * time is tracked per tester and not with the last use of the entries.
  */
 class Tester : public ITester
 {
 private:
+    /**
+     * @brief Trace subscriptions of an entry, kept while the tests trace the same assets.
+     */
+    struct TraceSession
+    {
+        std::unordered_set<std::string> assets;        ///< Subscribed assets
+        test::Options::TraceLevel level {};            ///< Trace level of the running test
+        std::shared_ptr<test::InternalOutput> current; ///< Output of the running test, nullptr if none
+    };
+
     class RuntimeEntry : public test::Entry
     {
     private:
-        std::shared_ptr<bk::IController> m_controller; ///< Controller of the policy to be tested.
+        std::shared_ptr<bk::IController> m_controller;    ///< Controller of the policy to be tested.
+        std::shared_ptr<TraceSession> m_traceSession;     ///< Subscriptions to the controller, nullptr if none
+        bool m_lazy {false};                              ///< Null controller built on use, not a build failure
+        std::chrono::steady_clock::time_point m_lastTest; ///< Last time the controller was built or tested
 
     public:
         explicit RuntimeEntry(const test::EntryPost& entry)
@@ -43,6 +63,9 @@ private:
         RuntimeEntry(RuntimeEntry&& other) noexcept
             : test::Entry(std::move(other))
             , m_controller(std::move(other.m_controller))
+            , m_traceSession(std::move(other.m_traceSession))
+            , m_lazy(other.m_lazy)
+            , m_lastTest(other.m_lastTest)
         {
             other.m_controller = nullptr;
         };
@@ -54,6 +77,9 @@ private:
             {
                 test::Entry::operator=(std::move(other));
                 m_controller = std::move(other.m_controller);
+                m_traceSession = std::move(other.m_traceSession);
+                m_lazy = other.m_lazy;
+                m_lastTest = other.m_lastTest;
                 other.m_controller = nullptr;
             }
             return *this;
@@ -61,17 +87,43 @@ private:
 
         const std::shared_ptr<bk::IController>& controller() const { return m_controller; }
         std::shared_ptr<bk::IController>& controller() { return m_controller; }
+        std::shared_ptr<TraceSession>& traceSession() { return m_traceSession; }
+        bool lazy() const { return m_lazy; }
+        void lazy(bool lazy) { m_lazy = lazy; }
+        std::chrono::steady_clock::time_point lastTest() const { return m_lastTest; }
+        void touch() { m_lastTest = std::chrono::steady_clock::now(); }
     };
 
     std::shared_ptr<bk::IController> createController(const base::Name& policy);
 
+    /**
+     * @brief Build the controller of a lazy entry, if it is not built yet
+     *
+     * The controller is built without holding the table, as rebuildEntry does.
+     * @param name Name of the entry
+     * @return base::OptError The error if the entry does not exist or the controller cannot be built
+     */
+    base::OptError loadEntry(const std::string& name);
+
     std::shared_ptr<EnvironmentBuilder> m_envBuilder;      ///< Shared pointer to the controller builder.
     std::unordered_map<std::string, RuntimeEntry> m_table; ///< Internal table for managing Testing Environments.
     mutable std::shared_mutex m_mutex;                     ///< Mutex for the table.
 
+    std::chrono::seconds m_idleTimeout;                  ///< Idle time before a controller is released, 0 = never
+    std::chrono::steady_clock::time_point m_nextRelease; ///< Next time releaseIdle looks for idle controllers
+
 public:
-    Tester(const std::shared_ptr<EnvironmentBuilder>& envBuilder)
-        : m_envBuilder(envBuilder) {};
+    /**
+     * @brief Construct a new Tester
+     *
+     * @param envBuilder Builder of the controllers
+     * @param idleTimeout Seconds without tests before the controller of an entry is released (0 = build the entries
+     * when they are added and keep them)
+     */
+    Tester(const std::shared_ptr<EnvironmentBuilder>& envBuilder, std::size_t idleTimeout = 0)
+        : m_envBuilder(envBuilder)
+        , m_idleTimeout(idleTimeout)
+        , m_nextRelease() {};
 
     /**
      * @copydoc ITester::addEntry
@@ -111,12 +163,17 @@ public:
     /**
      * @copydoc ITester::getAssets
      */
-    base::RespOrError<std::unordered_set<std::string>> getAssets(const std::string& name) const override;
+    base::RespOrError<std::unordered_set<std::string>> getAssets(const std::string& name) override;
 
     /**
      * @copydoc ITester::updateLastUsed
      */
     bool updateLastUsed(const std::string& name, uint64_t lastUsed = std::numeric_limits<uint64_t>::max()) override;
+
+    /**
+     * @copydoc ITester::releaseIdle
+     */
+    void releaseIdle() override;
 };
 } // namespace router
 
@@ -0,0 +1,159 @@
+#ifndef _ROUTER_TRACE_SAMPLER_HPP
+#define _ROUTER_TRACE_SAMPLER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <router/types.hpp>
+
+namespace router
+{
+
+namespace test
+{
+/**
+ * @brief Output of a traced event, with the traces grouped by asset in order of arrival
+ */
+class InternalOutput : public Output
+{
+private:
+    std::unordered_map<std::string, std::list<DataPair>::iterator> m_dataMap;
+
+public:
+    InternalOutput()
+        : Output()
+        , m_dataMap()
+    {
+    }
+
+    void addTrace(const std::string& asset,
+                  const std::string& traceContent,
+                  bool result,
+                  const test::Options::TraceLevel level)
+    {
+        if (traceContent.empty())
+        {
+            return;
+        }
+
+        // Try inserting the asset into the map.
+        auto [it, inserted] = m_dataMap.try_emplace(asset, m_traces.end());
+
+        // If is new, insert it into the list.
+        if (inserted)
+        {
+            m_traces.emplace_back(asset, Output::AssetTrace {});
+            it->second = std::prev(m_traces.end());
+        }
+
+        auto& data = it->second->second;
+
+        if (traceContent == "SUCCESS")
+        {
+            data.success = true;
+        }
+        else if (level == test::Options::TraceLevel::ALL)
+        {
+            data.traces.push_back(traceContent);
+        }
+    }
+};
+} // namespace test
+
+/**
+ * @brief Collector of the traces sampled from a production environment.
+ *
+ * A sampler is shared by the copies of the environment in every worker. The workers only check if an event is sampled
+ * and hand over its output, the samples are waited for and delivered from the thread that requested them.
+ */
+class TraceSampler
+{
+private:
+    prod::TraceOptions m_options; ///< Sampling options
+    std::atomic_size_t m_seen;    ///< Events seen by the environments
+    std::atomic_bool m_done;      ///< Flag to stop sampling, all samples are collected or the wait is over
+
+    std::mutex m_mutex;                          ///< Protects the samples
+    prod::SampledTraces m_samples;               ///< Collected samples
+    std::promise<prod::SampledTraces> m_promise; ///< Fulfilled once all samples are collected
+
+    // Deliver the collected samples, the lock must be held
+    void deliver()
+    {
+        if (!m_done.exchange(true))
+        {
+            m_promise.set_value(std::move(m_samples));
+        }
+    }
+
+public:
+    /**
+     * @brief Construct a new Trace Sampler
+     *
+     * @param options Sampling options, they must be valid
+     */
+    explicit TraceSampler(const prod::TraceOptions& options)
+        : m_options(options)
+        , m_seen(0)
+        , m_done(false)
+    {
+    }
+
+    const prod::TraceOptions& options() const { return m_options; }
+
+    /**
+     * @brief Check if the next event processed by the environment is traced.
+     */
+    bool next()
+    {
+        return !m_done.load(std::memory_order_relaxed)
+               && m_seen.fetch_add(1, std::memory_order_relaxed) % m_options.sampleRate() == 0;
+    }
+
+    /**
+     * @brief Add the output of a traced event, discarded if the samples are already delivered.
+     *
+     * @param output Output of the traced event
+     */
+    void collect(test::Output&& output)
+    {
+        std::lock_guard lock {m_mutex};
+        if (m_done.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+
+        m_samples.emplace_back(std::move(output));
+        if (m_samples.size() >= m_options.maxSamples())
+        {
+            deliver();
+        }
+    }
+
+    /**
+     * @brief Wait until all samples are collected or the timeout of the options expires.
+     *
+     * @return prod::SampledTraces The samples collected, fewer than requested if the timeout expired
+     */
+    prod::SampledTraces wait()
+    {
+        auto future = m_promise.get_future();
+        if (future.wait_for(std::chrono::milliseconds(m_options.timeoutMs())) != std::future_status::ready)
+        {
+            std::lock_guard lock {m_mutex};
+            deliver();
+        }
+
+        return future.get();
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_TRACE_SAMPLER_HPP
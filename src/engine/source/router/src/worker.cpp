@@ -1,10 +1,120 @@
 #include "worker.hpp"
 
+#include <vector>
+
+#include <base/arenaAllocator.hpp>
 #include <base/logging.hpp>
 
 namespace router
 {
 
+void Worker::processTestQueue(int64_t waitUsec)
+{
+    test::QueueType testEvent {};
+    auto popped = waitUsec > 0 ? m_tQueue->waitPop(testEvent, waitUsec) : m_tQueue->tryPop(testEvent);
+    if (popped && testEvent != nullptr)
+    {
+        auto& [event, opt, callback] = *testEvent;
+        auto output = m_tester->ingestTest(std::move(event), opt);
+        try
+        {
+            callback(std::move(output));
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Error when executing API callback: ", e.what());
+        }
+    }
+
+    m_tester->releaseIdle();
+}
+
+void Worker::runSingle(const EpsLimit& epsLimit)
+{
+    while (m_isRunning)
+    {
+        // Process test queue
+        if (m_role == Role::ALL)
+        {
+            processTestQueue();
+        }
+
+        // Process production queue
+        base::Event event {};
+        if (epsLimit(1) == 1 && m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr)
+        {
+            if (m_queueProbe)
+            {
+                m_queueProbe->popped(event);
+            }
+            ingest(std::move(event));
+        }
+    }
+}
+
+void Worker::runBatch(const EpsLimit& epsLimit)
+{
+    std::vector<base::Event> batch;
+    batch.reserve(m_batchSize);
+
+    while (m_isRunning)
+    {
+        // Process test queue, once per batch
+        if (m_role == Role::ALL)
+        {
+            processTestQueue();
+        }
+
+        // The EPS limit is checked once per batch, so the batch is capped by the remaining budget
+        auto budget = epsLimit(m_batchSize);
+
+        if (budget == 0)
+        {
+            continue;
+        }
+
+        // Wait for the first events, then linger until the batch is full or the time is over
+        if (m_rQueue->waitPopBulk(batch, budget, WAIT_DEQUEUE_TIMEOUT_USEC) == 0)
+        {
+            continue;
+        }
+
+        if (m_batchLingerUsec > 0 && batch.size() < budget)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(m_batchLingerUsec);
+            while (batch.size() < budget && m_isRunning)
+            {
+                auto remaining =
+                    std::chrono::duration_cast<std::chrono::microseconds>(deadline - std::chrono::steady_clock::now())
+                        .count();
+                if (remaining <= 0 || m_rQueue->waitPopBulk(batch, budget - batch.size(), remaining) == 0)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (m_queueProbe)
+        {
+            for (const auto& event : batch)
+            {
+                m_queueProbe->popped(event);
+            }
+        }
+
+        ingest(std::move(batch));
+        batch.clear();
+    }
+}
+
+void Worker::runTest()
+{
+    while (m_isRunning)
+    {
+        processTestQueue(WAIT_DEQUEUE_TIMEOUT_USEC);
+    }
+}
+
 void Worker::start(const EpsLimit& epsLimit)
 {
     if (m_isRunning)
@@ -16,32 +126,24 @@ void Worker::start(const EpsLimit& epsLimit)
     m_thread = std::thread(
         [this, epsLimit]()
         {
+            base::arena::ScopedSubsystem arena {base::arena::Subsystem::ROUTER};
             std::size_t tID = std::hash<std::thread::id> {}(std::this_thread::get_id());
-            LOG_DEBUG("Router Worker {} started", tID);
-            while (m_isRunning)
+            if (auto error = utils::affinity::pinThread(m_cpus))
             {
-                // Process test queue
-                test::QueueType testEvent {};
-                if (m_tQueue->tryPop(testEvent) && testEvent != nullptr)
-                {
-                    auto& [event, opt, callback] = *testEvent;
-                    auto output = m_tester->ingestTest(std::move(event), opt);
-                    try
-                    {
-                        callback(std::move(output));
-                    }
-                    catch (const std::exception& e)
-                    {
-                        LOG_ERROR("Error when executing API callback: ", e.what());
-                    }
-                }
-
-                // Process production queue
-                base::Event event {};
-                if (!epsLimit() && m_rQueue->waitPop(event, WAIT_DEQUEUE_TIMEOUT_USEC) && event != nullptr)
-                {
-                    m_router->ingest(std::move(event));
-                }
+                LOG_WARNING("Router Worker {}: {}", tID, error->message);
+            }
+            LOG_DEBUG("Router Worker {} started (batch size: {}, linger: {}us)", tID, m_batchSize, m_batchLingerUsec);
+            if (m_role == Role::TEST)
+            {
+                runTest();
+            }
+            else if (m_batchSize > 1)
+            {
+                runBatch(epsLimit);
+            }
+            else
+            {
+                runSingle(epsLimit);
             }
             LOG_DEBUG("Router Worker {} finished", tID);
         });
@@ -2,15 +2,20 @@
 #define ROUTER_WORKER_HPP
 
 #include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <thread>
+#include <utility>
 
+#include <base/utils/cpuAffinity.hpp>
 #include <queue/iqueue.hpp>
 
 #include <router/types.hpp>
 
 #include "environmentBuilder.hpp"
 #include "iworker.hpp"
+#include "queueProbe.hpp"
 #include "router.hpp"
 #include "tester.hpp"
 
@@ -18,9 +23,22 @@ namespace router
 {
 
 constexpr auto WAIT_DEQUEUE_TIMEOUT_USEC = 1 * 100000;
+constexpr std::size_t DEFAULT_BATCH_SIZE = 1;  ///< Default events per dequeue (1 = batching disabled)
+constexpr int64_t DEFAULT_BATCH_LINGER_USEC = 0; ///< Default time to wait for a batch to fill up
 
 class Worker : public IWorker
 {
+public:
+    /**
+     * @brief Queues served by a worker
+     */
+    enum class Role
+    {
+        ALL,        ///< Production events, and the pending test events in between
+        PRODUCTION, ///< Only production events, the tester is not used
+        TEST        ///< Only test events, the router is not used
+    };
+
 private:
     std::shared_ptr<IRouter> m_router; ///< The router instance
     std::shared_ptr<ITester> m_tester; ///< The tester instance
@@ -30,25 +48,84 @@ private:
     std::shared_ptr<base::queue::iQueue<base::Event>> m_rQueue;     ///< The router queue
     std::shared_ptr<base::queue::iQueue<test::QueueType>> m_tQueue; ///< The tester queue
 
+    std::size_t m_batchSize;   ///< Maximum number of events dequeued at once from the router queue
+    int64_t m_batchLingerUsec; ///< Maximum time to wait for a batch to fill up (microseconds)
+
+    std::shared_ptr<QueueProbe> m_queueProbe; ///< Probe of the queue wait, nullptr if it is disabled
+    Role m_role;                              ///< Queues served by the worker
+    utils::affinity::CpuSet m_cpus;           ///< CPUs the thread is pinned to, empty if it is not pinned
+    std::atomic<uint64_t> m_busyNs;           ///< Time spent processing production events, in nanoseconds
+
+    /**
+     * @brief Ingest production events into the router, accounting the time spent
+     */
+    template<typename Events>
+    void ingest(Events&& events)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        m_router->ingest(std::forward<Events>(events));
+        const auto elapsed = std::chrono::steady_clock::now() - begin;
+        m_busyNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+                           std::memory_order_relaxed);
+    }
+
+    void processTestQueue(int64_t waitUsec = 0); ///< Process one test event and release the idle environments
+    void runSingle(const EpsLimit& epsLimit);    ///< Production loop, one event per iteration
+    void runBatch(const EpsLimit& epsLimit);     ///< Production loop, up to m_batchSize events per iteration
+    void runTest();                              ///< Test loop, blocks on the test queue
+
 public:
     /**
      * @brief Construct a new Worker object
      *
+     * @param envBuilder The environment builder for the router and tester
+     * @param rQueue The router queue
+     * @param tQueue The tester queue
+     * @param batchSize Maximum number of events dequeued at once from the router queue (1 = no batching)
+     * @param batchLingerUsec Maximum time in microseconds to wait for a partial batch to fill up
+     * @param queueProbe Probe notified of the popped events to time their wait in the queue, nullptr to disable it
+     * @param role Queues served by the worker
+     * @param testerIdleTimeout Seconds without tests before the tester releases an environment (0 = never)
+     * @param cpus CPUs the thread is pinned to, empty to not pin it
+     * @param routeLimits EPS limiters of the routes shared with the other workers, nullptr for own ones
      */
     Worker(std::shared_ptr<EnvironmentBuilder> envBuilder,
            std::shared_ptr<base::queue::iQueue<base::Event>> rQueue,
-           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue)
-        : m_router(std::make_shared<Router>(envBuilder))
-        , m_tester(std::make_shared<Tester>(envBuilder))
+           std::shared_ptr<base::queue::iQueue<test::QueueType>> tQueue,
+           std::size_t batchSize = DEFAULT_BATCH_SIZE,
+           int64_t batchLingerUsec = DEFAULT_BATCH_LINGER_USEC,
+           std::shared_ptr<QueueProbe> queueProbe = nullptr,
+           Role role = Role::ALL,
+           std::size_t testerIdleTimeout = 0,
+           utils::affinity::CpuSet cpus = {},
+           std::shared_ptr<RouteLimits> routeLimits = nullptr)
+        : m_router(std::make_shared<Router>(envBuilder, std::move(routeLimits)))
+        , m_tester(std::make_shared<Tester>(envBuilder, testerIdleTimeout))
         , m_isRunning(false)
         , m_thread()
         , m_rQueue(rQueue)
         , m_tQueue(tQueue)
+        , m_batchSize(batchSize)
+        , m_batchLingerUsec(batchLingerUsec)
+        , m_queueProbe(std::move(queueProbe))
+        , m_role(role)
+        , m_cpus(std::move(cpus))
+        , m_busyNs(0)
     {
         if (!m_rQueue || !m_tQueue)
         {
             throw std::logic_error("Invalid queues for the worker");
         }
+
+        if (m_batchSize == 0)
+        {
+            throw std::logic_error("Invalid batch size for the worker");
+        }
+
+        if (m_batchLingerUsec < 0)
+        {
+            throw std::logic_error("Invalid batch linger time for the worker");
+        }
     }
 
     ~Worker() { stop(); }
@@ -65,6 +142,12 @@ public:
 
     const std::shared_ptr<IRouter>& getRouter() const { return m_router; }
     const std::shared_ptr<ITester>& getTester() const { return m_tester; }
+    Role getRole() const { return m_role; }
+
+    /**
+     * @copydoc IWorker::busyTime
+     */
+    uint64_t busyTime() const override { return m_busyNs.load(std::memory_order_relaxed); }
 };
 
 } // namespace router
@@ -0,0 +1,110 @@
+#ifndef _ROUTER_WORKER_SCALER_HPP
+#define _ROUTER_WORKER_SCALER_HPP
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace router
+{
+
+/**
+ * @brief Decides when the production workers are scaled, from the depth of the queue and the utilization of the
+ * workers.
+ *
+ * A worker is added when the queue is backed up and the workers are already busy, so a queue that fills up because of
+ * the EPS limit or a stalled output does not scale the workers. A worker is removed once the queue has been drained and
+ * the workers have been mostly idle for several samples in a row, so a short pause in a burst does not shrink them.
+ *
+ * @note this is not thread-safe, it is fed by the single scaling thread.
+ */
+class WorkerScaler
+{
+public:
+    static constexpr double SCALE_UP_UTILIZATION = 0.8;   ///< Utilization above which the workers are busy
+    static constexpr double SCALE_DOWN_UTILIZATION = 0.3; ///< Utilization below which the workers are idle
+    static constexpr std::size_t SCALE_DOWN_SAMPLES = 5;  ///< Idle samples in a row before a worker is removed
+
+    /**
+     * @brief State of the workers and the queue over the last interval.
+     */
+    struct Sample
+    {
+        std::size_t workers; ///< Production workers running
+        std::size_t depth;   ///< Events in the queue
+        uint64_t busyNs;     ///< Time spent processing events by all the workers in the interval
+        uint64_t intervalNs; ///< Length of the interval
+    };
+
+private:
+    std::size_t m_min;         ///< Minimum number of workers
+    std::size_t m_max;         ///< Maximum number of workers
+    std::size_t m_depth;       ///< Queued events per worker above which the queue is backed up
+    std::size_t m_idleSamples; ///< Idle samples in a row
+
+public:
+    /**
+     * @brief Construct a new Worker Scaler
+     *
+     * @param min Minimum number of workers
+     * @param max Maximum number of workers
+     * @param depth Queued events per worker above which the queue is backed up
+     */
+    WorkerScaler(std::size_t min, std::size_t max, std::size_t depth)
+        : m_min(min)
+        , m_max(max)
+        , m_depth(depth)
+        , m_idleSamples(0)
+    {
+        if (m_min == 0 || m_max < m_min || m_depth == 0)
+        {
+            throw std::logic_error("Invalid limits for the worker scaler");
+        }
+    }
+
+    /**
+     * @brief Get the utilization of the workers in a sample, between 0 and 1.
+     */
+    static double utilization(const Sample& sample)
+    {
+        if (sample.workers == 0 || sample.intervalNs == 0)
+        {
+            return 0;
+        }
+
+        const auto utilization = static_cast<double>(sample.busyNs) / (sample.intervalNs * sample.workers);
+        return utilization < 1 ? utilization : 1;
+    }
+
+    /**
+     * @brief Decide the change of workers after a sample.
+     *
+     * @param sample State over the last interval
+     * @return int 1 to add a worker, -1 to remove one, 0 to keep them
+     */
+    int next(const Sample& sample)
+    {
+        const auto busy = utilization(sample);
+        if (sample.depth > m_depth * sample.workers && busy >= SCALE_UP_UTILIZATION)
+        {
+            m_idleSamples = 0;
+            return sample.workers < m_max ? 1 : 0;
+        }
+
+        if (sample.depth < m_depth && busy <= SCALE_DOWN_UTILIZATION && sample.workers > m_min)
+        {
+            if (++m_idleSamples >= SCALE_DOWN_SAMPLES)
+            {
+                m_idleSamples = 0;
+                return -1;
+            }
+            return 0;
+        }
+
+        m_idleSamples = 0;
+        return 0;
+    }
+};
+
+} // namespace router
+
+#endif // _ROUTER_WORKER_SCALER_HPP
@@ -16,12 +16,21 @@ public:
     MOCK_METHOD(base::RespOrError<::router::prod::Entry>, getEntry, (const std::string& name), (const, override));
     MOCK_METHOD(base::OptError, reloadEntry, (const std::string& name), (override));
     MOCK_METHOD(base::OptError, changeEntryPriority, (const std::string& name, size_t priority), (override));
+    MOCK_METHOD(base::OptError, changeEntryEpsLimit, (const std::string& name, std::size_t epsLimit), (override));
     MOCK_METHOD(std::list<::router::prod::Entry>, getEntries, (), (const, override));
     MOCK_METHOD(void, postEvent, (base::Event&& event), (override));
     MOCK_METHOD(base::OptError, postStrEvent, (std::string_view event), (override));
+    MOCK_METHOD(std::size_t, postStrEvents, (const std::vector<std::string_view>& events), (override));
+    MOCK_METHOD(base::RespOrError<::router::prod::SampledTraces>,
+                sampleTraces,
+                (const ::router::prod::TraceOptions& opt),
+                (override));
     MOCK_METHOD(base::OptError, changeEpsSettings, (uint eps, uint refreshInterval), (override));
     MOCK_METHOD((base::RespOrError<std::tuple<uint, uint, bool>>), getEpsSettings, (), (const, override));
     MOCK_METHOD(base::OptError, activateEpsCounter, (bool activate), (override));
+    MOCK_METHOD(base::OptError, postIngressRule, (const ::router::prod::IngressRule& rule), (override));
+    MOCK_METHOD(base::OptError, deleteIngressRule, (const std::string& name), (override));
+    MOCK_METHOD(std::list<::router::prod::IngressRule>, getIngressRules, (), (const, override));
 };
 
 }
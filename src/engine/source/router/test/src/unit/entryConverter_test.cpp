@@ -24,6 +24,18 @@ TEST(EntryConverter, prodEntryConverter)
     EXPECT_EQ(entryPost.priority(), entryPost2.priority());
 }
 
+TEST(EntryConverter, prodEntryConverterEpsLimit)
+{
+    ::prod::EntryPost entryPost("name", "policy/test/0", "filter/test/0", 1);
+    EXPECT_FALSE(json::Json(EntryConverter(::prod::Entry(entryPost))).exists("/epsLimit"));
+
+    entryPost.epsLimit(100);
+    json::Json jEntry = json::Json(EntryConverter(::prod::Entry(entryPost)));
+    ::prod::EntryPost entryPost2(EntryConverter {jEntry});
+
+    EXPECT_EQ(entryPost2.epsLimit(), 100);
+}
+
 
 TEST(EntryConverter, testEntryConverter)
 {
@@ -97,3 +97,119 @@ TEST(EnvironmentBuilderTest, Create_ValidPolicyAndInvalidFilter)
     EXPECT_CALL(*mockController, stop()).WillOnce(Return());
     ASSERT_THROW(eBuilder.create(policyName, filterName), std::runtime_error);
 }
+
+TEST(EnvironmentBuilderTest, SharedScopeBuildsOnce)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    auto eBuilder = std::make_shared<EnvironmentBuilder>(builder, controllerMaker, true);
+
+    auto policyName = base::Name("policy/test/0");
+    auto filterName = base::Name("filter/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*mockController, stop()).WillRepeatedly(Return());
+
+    // Each environment has its own controller
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(3)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    // The build is shared in the scope, and discarded when it is closed
+    EXPECT_CALL(*builder, buildPolicy(policyName)).Times(2).WillRepeatedly(Return(resPolicy));
+    EXPECT_CALL(*builder, buildAsset(filterName)).Times(2).WillRepeatedly(Return(emptyExpression));
+    {
+        EnvironmentBuilder::SharedScope shared {eBuilder};
+        EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+        EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+    }
+    EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+}
+
+TEST(EnvironmentBuilderTest, SharedScopeDisabled)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    auto eBuilder = std::make_shared<EnvironmentBuilder>(builder, controllerMaker);
+
+    auto policyName = base::Name("policy/test/0");
+    auto filterName = base::Name("filter/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*mockController, stop()).WillRepeatedly(Return());
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(2)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    EXPECT_CALL(*builder, buildPolicy(policyName)).Times(2).WillRepeatedly(Return(resPolicy));
+    EXPECT_CALL(*builder, buildAsset(filterName)).Times(2).WillRepeatedly(Return(emptyExpression));
+
+    EnvironmentBuilder::SharedScope shared {eBuilder};
+    EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+    EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+}
+
+TEST(EnvironmentBuilderTest, ReuseScopeReusesRetainedBuilds)
+{
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    auto controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+
+    auto eBuilder = std::make_shared<EnvironmentBuilder>(builder, controllerMaker, false, true);
+
+    auto policyName = base::Name("policy/test/0");
+    auto otherPolicyName = base::Name("policy/test/1");
+    auto filterName = base::Name("filter/test/0");
+
+    auto mockPolicy = std::make_shared<builder::mocks::MockPolicy>();
+    std::shared_ptr<builder::IPolicy> resPolicy(mockPolicy);
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    EXPECT_CALL(*mockPolicy, assets()).WillRepeatedly(ReturnRef(fakeAssets));
+    auto emptyExpression = base::Expression {};
+    EXPECT_CALL(*mockPolicy, expression()).WillRepeatedly(ReturnRef(emptyExpression));
+    std::string hash = "hash";
+    EXPECT_CALL(*mockPolicy, hash()).WillRepeatedly(ReturnRef(hash));
+
+    auto mockController = std::make_shared<bk::mocks::MockController>();
+    EXPECT_CALL(*mockController, stop()).WillRepeatedly(Return());
+    EXPECT_CALL(*controllerMaker, create(testing::_, testing::_, testing::_))
+        .Times(5)
+        .WillRepeatedly(::testing::Return(mockController));
+
+    // Out of a reuse scope everything is built, the last builds are retained
+    EXPECT_CALL(*builder, buildPolicy(policyName)).Times(2).WillRepeatedly(Return(resPolicy));
+    EXPECT_CALL(*builder, buildPolicy(otherPolicyName)).Times(2).WillRepeatedly(Return(resPolicy));
+    EXPECT_CALL(*builder, buildAsset(filterName)).Times(3).WillRepeatedly(Return(emptyExpression));
+    EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+    EXPECT_NE(eBuilder->create(otherPolicyName, filterName), nullptr);
+
+    // The retained builds are reused, the ones not reused are released
+    {
+        EnvironmentBuilder::ReuseScope reuse {eBuilder};
+        EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+    }
+    EXPECT_NE(eBuilder->create(policyName, filterName), nullptr);
+    {
+        EnvironmentBuilder::ReuseScope reuse {eBuilder};
+        EXPECT_NE(eBuilder->create(otherPolicyName, filterName), nullptr);
+    }
+}
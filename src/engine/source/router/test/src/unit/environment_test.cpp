@@ -3,6 +3,7 @@
 #include <bk/mockController.hpp>
 
 #include "environment.hpp"
+#include "traceSampler.hpp"
 
 using namespace router;
 
@@ -63,3 +64,78 @@ TEST(EnvironmentTest, IngestGet)
     EXPECT_EQ(*res, *eventExpected);
 }
 
+
+namespace
+{
+std::shared_ptr<TraceSampler> makeSampler(std::size_t sampleRate, std::size_t maxSamples)
+{
+    return std::make_shared<TraceSampler>(prod::TraceOptions(
+        "env", test::Options::TraceLevel::ALL, {"decoder/test/0"}, sampleRate, maxSamples, 1000));
+}
+} // namespace
+
+TEST(EnvironmentTest, SampledTraces)
+{
+    auto controller = getMockController();
+    bk::Subscriber subscriber;
+    EXPECT_CALL(*controller, subscribe("decoder/test/0", testing::_))
+        .WillOnce(testing::DoAll(testing::SaveArg<1>(&subscriber), testing::Return(bk::Subscription {7})));
+    EXPECT_CALL(*controller, unsubscribe("decoder/test/0", 7)).WillOnce(testing::Return());
+
+    auto environment = Environment(getDummyTerm(true), controller, std::string("-"));
+    auto sampler = makeSampler(2, 1);
+    ASSERT_FALSE(environment.attachSampler(sampler));
+    ASSERT_TRUE(environment.attachSampler(makeSampler(1, 1)));
+
+    // The first event is sampled, its traces are collected and the second is processed as usual
+    base::Event event = std::make_shared<json::Json>(R"({"test": "test"})");
+    EXPECT_CALL(*controller, ingestGet(testing::_))
+        .WillOnce(testing::Invoke(
+            [&subscriber](base::Event&& event)
+            {
+                subscriber("trace", true);
+                return event;
+            }));
+    EXPECT_CALL(*controller, ingest(testing::_))
+        .WillOnce(testing::Invoke([&subscriber](base::Event&&) { subscriber("ignored", true); }));
+    environment.ingest(base::Event(event));
+    environment.ingest(base::Event(event));
+
+    auto samples = sampler->wait();
+    ASSERT_EQ(samples.size(), 1);
+    EXPECT_EQ(*samples.front().event(), *event);
+    ASSERT_EQ(samples.front().traceList().size(), 1);
+    EXPECT_EQ(samples.front().traceList().front().first, "decoder/test/0");
+    EXPECT_EQ(samples.front().traceList().front().second.traces, std::vector<std::string> {"trace"});
+
+    // Other samplers are not detached
+    environment.detachSampler(makeSampler(1, 1));
+    environment.detachSampler(sampler);
+}
+
+TEST(EnvironmentTest, AttachSamplerAssetNotFound)
+{
+    auto controller = getMockController();
+    EXPECT_CALL(*controller, subscribe("decoder/test/0", testing::_))
+        .WillOnce(testing::Return(base::Error {"Traceable not found"}));
+
+    auto environment = Environment(getDummyTerm(true), controller, std::string("-"));
+    ASSERT_TRUE(environment.attachSampler(makeSampler(1, 1)));
+
+    // Not attached, the events are processed as usual
+    EXPECT_CALL(*controller, ingest(testing::_)).WillOnce(testing::Return());
+    environment.ingest(std::make_shared<json::Json>());
+}
+
+TEST(TraceSamplerTest, WaitTimeout)
+{
+    auto sampler = std::make_shared<TraceSampler>(
+        prod::TraceOptions("env", test::Options::TraceLevel::ASSET_ONLY, {"decoder/test/0"}, 1, 2, 10));
+    ASSERT_TRUE(sampler->next());
+    sampler->collect(test::Output {});
+
+    // Fewer samples than requested are delivered on timeout, the sampling is over
+    auto samples = sampler->wait();
+    ASSERT_EQ(samples.size(), 1);
+    ASSERT_FALSE(sampler->next());
+}
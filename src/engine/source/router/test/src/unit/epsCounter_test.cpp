@@ -72,21 +72,75 @@ TEST(EpsCounter, LimitReachedSingleThread)
     auto counter = T::EpsCounter(1, 1, true);
     EXPECT_EQ(counter.limitReached(), false);
     EXPECT_EQ(counter.limitReached(), true);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
-    EXPECT_EQ(counter.limitReached(), true);
+    // The bucket is refilled at the start of each interval
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
     EXPECT_EQ(counter.limitReached(), false);
-    std::this_thread::sleep_for(std::chrono::seconds(1));
-    EXPECT_EQ(counter.limitReached(), true);
-    EXPECT_EQ(counter.limitReached(), false);
-    EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), true);
     std::this_thread::sleep_for(std::chrono::seconds(1));
-    EXPECT_EQ(counter.limitReached(), true);
     EXPECT_EQ(counter.limitReached(), false);
     EXPECT_EQ(counter.limitReached(), true);
-    EXPECT_EQ(counter.limitReached(), true);
-    EXPECT_EQ(counter.limitReached(), true);
+}
+
+TEST(EpsCounter, Take)
+{
+    auto counter = T::EpsCounter(10, 1, true);
+    EXPECT_EQ(counter.take(4), 4);
+    EXPECT_EQ(counter.take(10), 6);
+    EXPECT_EQ(counter.take(1), 0);
+}
+
+TEST(EpsCounter, ChangeSettingsRefills)
+{
+    auto counter = T::EpsCounter(1, 10, true);
+    EXPECT_EQ(counter.take(100), 10);
+    auto epoch = counter.epoch();
+
+    counter.changeSettings(2, 10);
+    counter.waitRefill(epoch, std::chrono::seconds(1));
+    EXPECT_NE(counter.epoch(), epoch);
+    EXPECT_EQ(counter.take(100), 20);
+}
+
+TEST(EpsCounter, ShardInactive)
+{
+    auto counter = std::make_shared<T::EpsCounter>(1, 10, false);
+    auto shard = T::EpsCounter::Shard(counter);
+    EXPECT_EQ(shard.acquire(100), 100);
+    EXPECT_EQ(counter->take(100), 10);
+}
+
+TEST(EpsCounter, ShardAcquire)
+{
+    auto counter = std::make_shared<T::EpsCounter>(100, 10, true);
+    auto shard = T::EpsCounter::Shard(counter);
+
+    // The shard takes a whole batch from the bucket and hands it out locally
+    EXPECT_EQ(shard.acquire(1), 1);
+    EXPECT_EQ(counter->take(1000), 1000 - router::SHARD_TOKEN_BATCH);
+    EXPECT_EQ(shard.acquire(1000), router::SHARD_TOKEN_BATCH - 1);
+
+    // The bucket is empty, the shard parks until the timeout
+    auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(shard.acquire(1), 0);
+    EXPECT_GE(std::chrono::steady_clock::now() - begin, router::THROTTLED_PARK_TIMEOUT);
+}
+
+TEST(EpsCounter, ShardStopReleasesParked)
+{
+    auto counter = std::make_shared<T::EpsCounter>(1, 10, true);
+    auto shard = T::EpsCounter::Shard(counter);
+    EXPECT_EQ(counter->take(100), 10);
+
+    std::thread stopper(
+        [counter]()
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            counter->stop();
+        });
+    EXPECT_EQ(shard.acquire(1), 0);
+    stopper.join();
+    EXPECT_EQ(shard.acquire(1), 1);
 }
 
 TEST(EpsCounter, LimitReachedMultipleThreads)
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "filterIndex.hpp"
+
+using namespace router;
+
+namespace
+{
+base::Expression term(const std::string& name)
+{
+    return base::Term<base::EngineOp>::create(name,
+                                              [](const base::Event& event) -> base::result::Result<base::Event>
+                                              { return base::result::makeSuccess(event); });
+}
+
+// Shape of a filter asset built with a check stage
+base::Expression filterAsset(std::vector<base::Expression> checks)
+{
+    auto check = base::And::create("stage.check", std::move(checks));
+    auto condition = base::And::create("condition", {check, term("AcceptAll")});
+    return base::And::create("filter/test/0", {condition});
+}
+
+std::vector<std::size_t> candidatesOf(const FilterIndex& index, const std::string& event)
+{
+    std::vector<std::size_t> candidates;
+    index.candidates(std::make_shared<json::Json>(event.c_str()), candidates);
+    return candidates;
+}
+} // namespace
+
+TEST(FilterIndexTest, FilterKeyFromEquality)
+{
+    auto key = getFilterKey(filterAsset({term("wazuh.queue: filter(49)")}));
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(key->path, "/wazuh/queue");
+    EXPECT_EQ(key->value, "n49");
+
+    key = getFilterKey(filterAsset({term("wazuh.location: string_equal(\"syscheck\")")}));
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(key->path, "/wazuh/location");
+    EXPECT_EQ(key->value, "ssyscheck");
+
+    // The first discriminating condition of the And is taken
+    key = getFilterKey(filterAsset({term("agent.id: exists"), term("agent.group: filter(\"a\")")}));
+    ASSERT_TRUE(key.has_value());
+    EXPECT_EQ(key->path, "/agent/group");
+}
+
+TEST(FilterIndexTest, FilterKeyNotFound)
+{
+    EXPECT_FALSE(getFilterKey(nullptr).has_value());
+    EXPECT_FALSE(getFilterKey(filterAsset({term("agent.id: exists")})).has_value());
+    EXPECT_FALSE(getFilterKey(filterAsset({term("agent.id: filter($other.field)")})).has_value());
+    EXPECT_FALSE(getFilterKey(filterAsset({term("agent.id: filter(1.5)")})).has_value());
+    EXPECT_FALSE(getFilterKey(filterAsset({term("agent.id: filter([1])")})).has_value());
+    EXPECT_FALSE(getFilterKey(filterAsset({term("stage.check")})).has_value());
+
+    // Only one of the operands has to be met
+    auto orFilter = base::Or::create("or", {term("wazuh.queue: filter(49)"), term("wazuh.queue: filter(50)")});
+    EXPECT_FALSE(getFilterKey(orFilter).has_value());
+}
+
+TEST(FilterIndexTest, Candidates)
+{
+    FilterIndex index;
+    EXPECT_TRUE(index.empty());
+
+    index.add(0, FilterKey {"/wazuh/queue", "n49"});
+    index.add(1, std::nullopt);
+    index.add(2, FilterKey {"/wazuh/queue", "n50"});
+    index.add(3, FilterKey {"/agent/group", "sa"});
+    index.add(4, FilterKey {"/wazuh/queue", "n49"});
+    EXPECT_FALSE(index.empty());
+
+    EXPECT_EQ(candidatesOf(index, R"({"wazuh": {"queue": 49}})"), (std::vector<std::size_t> {0, 1, 4}));
+    EXPECT_EQ(candidatesOf(index, R"({"wazuh": {"queue": 49.0}})"), (std::vector<std::size_t> {0, 1, 4}));
+    EXPECT_EQ(candidatesOf(index, R"({"wazuh": {"queue": 50}, "agent": {"group": "a"}})"),
+              (std::vector<std::size_t> {1, 2, 3}));
+    EXPECT_EQ(candidatesOf(index, R"({"wazuh": {"queue": "49"}})"), (std::vector<std::size_t> {1}));
+    EXPECT_EQ(candidatesOf(index, R"({})"), (std::vector<std::size_t> {1}));
+}
+
+TEST(FilterIndexTest, ValueKey)
+{
+    EXPECT_EQ(FilterIndex::valueKey(json::Json(R"("a")")), "sa");
+    EXPECT_EQ(FilterIndex::valueKey(json::Json("-3")), "n-3");
+    EXPECT_EQ(FilterIndex::valueKey(json::Json("3.0")), "n3");
+    EXPECT_EQ(FilterIndex::valueKey(json::Json("true")), "btrue");
+    EXPECT_FALSE(FilterIndex::valueKey(json::Json("3.5")).has_value());
+    EXPECT_FALSE(FilterIndex::valueKey(json::Json("null")).has_value());
+    EXPECT_FALSE(FilterIndex::valueKey(json::Json("{}")).has_value());
+}
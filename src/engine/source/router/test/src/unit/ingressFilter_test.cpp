@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "ingressFilter.hpp"
+
+using namespace router;
+
+namespace
+{
+prod::IngressRule makeRule(const std::string& name,
+                           prod::IngressAction action,
+                           std::optional<char> queue,
+                           const std::string& prefix,
+                           std::vector<std::string> contains = {})
+{
+    prod::IngressRule rule {name, action};
+    if (queue)
+    {
+        rule.queue(queue.value());
+    }
+    rule.locationPrefix(prefix);
+    rule.contains(std::move(contains));
+    return rule;
+}
+} // namespace
+
+TEST(IngressFilterTest, AcceptsWithoutRules)
+{
+    IngressFilter filter;
+    ASSERT_EQ(filter.check("1:agent:message"), IngressFilter::Verdict::ACCEPT);
+    ASSERT_TRUE(filter.rules().empty());
+}
+
+TEST(IngressFilterTest, InvalidRules)
+{
+    IngressFilter filter;
+    ASSERT_TRUE(filter.add(makeRule("", prod::IngressAction::DROP, '1', "")));
+    ASSERT_TRUE(filter.add(makeRule("empty", prod::IngressAction::DROP, std::nullopt, "")));
+    ASSERT_TRUE(filter.add(makeRule("substring", prod::IngressAction::DROP, std::nullopt, "", {""})));
+    ASSERT_TRUE(filter.add(makeRule("colon", prod::IngressAction::DROP, std::nullopt, "agent:msg")));
+    ASSERT_FALSE(filter.add(makeRule("escaped", prod::IngressAction::DROP, std::nullopt, "[001] (a) any|:1")));
+
+    ASSERT_FALSE(filter.add(makeRule("queue", prod::IngressAction::DROP, '1', "")));
+    ASSERT_TRUE(filter.add(makeRule("queue", prod::IngressAction::DIVERT, '2', "")));
+    ASSERT_EQ(filter.rules().size(), 2);
+}
+
+TEST(IngressFilterTest, MatchesAllTheConditions)
+{
+    IngressFilter filter;
+    ASSERT_FALSE(filter.add(makeRule("health", prod::IngressAction::DROP, '1', "[099]", {"health", "check"})));
+
+    ASSERT_EQ(filter.check("1:[099] (probe) any->/var/log:health check ok"), IngressFilter::Verdict::DROP);
+    ASSERT_EQ(filter.check("2:[099] (probe) any->/var/log:health check ok"), IngressFilter::Verdict::ACCEPT);
+    ASSERT_EQ(filter.check("1:[001] (agent) any->/var/log:health check ok"), IngressFilter::Verdict::ACCEPT);
+    ASSERT_EQ(filter.check("1:[099] (probe) any->/var/log:health ok"), IngressFilter::Verdict::ACCEPT);
+    ASSERT_EQ(filter.check("1:[09"), IngressFilter::Verdict::ACCEPT);
+    ASSERT_EQ(filter.check(""), IngressFilter::Verdict::ACCEPT);
+
+    ASSERT_EQ(filter.rules().front().hits(), 1);
+}
+
+TEST(IngressFilterTest, FirstMatchingRuleWins)
+{
+    IngressFilter filter;
+    ASSERT_FALSE(filter.add(makeRule("divert", prod::IngressAction::DIVERT, std::nullopt, "noisy")));
+    ASSERT_FALSE(filter.add(makeRule("drop", prod::IngressAction::DROP, '1', "")));
+
+    ASSERT_EQ(filter.check("1:noisy:message"), IngressFilter::Verdict::DIVERT);
+    ASSERT_EQ(filter.check("1:quiet:message"), IngressFilter::Verdict::DROP);
+    ASSERT_EQ(filter.check("2:quiet:message"), IngressFilter::Verdict::ACCEPT);
+
+    auto rules = filter.rules();
+    ASSERT_EQ(rules.front().name(), "divert");
+    ASSERT_EQ(rules.front().hits(), 1);
+    ASSERT_EQ(rules.back().hits(), 1);
+}
+
+TEST(IngressFilterTest, HitsSurviveOtherChanges)
+{
+    IngressFilter filter;
+    ASSERT_FALSE(filter.add(makeRule("one", prod::IngressAction::DROP, '1', "")));
+    ASSERT_FALSE(filter.add(makeRule("two", prod::IngressAction::DROP, '2', "")));
+    filter.check("1:location:message");
+    filter.check("2:location:message");
+
+    ASSERT_FALSE(filter.remove("two"));
+    ASSERT_TRUE(filter.remove("two"));
+    ASSERT_FALSE(filter.add(makeRule("two", prod::IngressAction::DROP, '2', "")));
+
+    auto rules = filter.rules();
+    ASSERT_EQ(rules.front().hits(), 1);
+    ASSERT_EQ(rules.back().hits(), 0);
+
+    ASSERT_FALSE(filter.remove("one"));
+    ASSERT_FALSE(filter.remove("two"));
+    ASSERT_EQ(filter.check("1:location:message"), IngressFilter::Verdict::ACCEPT);
+}
+
+TEST(IngressFilterTest, DumpAndLoad)
+{
+    IngressFilter filter;
+    ASSERT_FALSE(filter.add(makeRule("one", prod::IngressAction::DROP, '1', "[001]", {"a", "b"})));
+    ASSERT_FALSE(filter.add(makeRule("two", prod::IngressAction::DIVERT, std::nullopt, "", {"c"})));
+    filter.check("1:[001]:ab");
+
+    IngressFilter loaded;
+    ASSERT_FALSE(loaded.load(filter.dump()));
+    auto rules = loaded.rules();
+    ASSERT_EQ(rules.size(), 2);
+    ASSERT_EQ(rules.front().name(), "one");
+    ASSERT_EQ(rules.front().queue(), '1');
+    ASSERT_EQ(rules.front().locationPrefix(), "[001]");
+    ASSERT_EQ(rules.front().contains(), std::vector<std::string>({"a", "b"}));
+    ASSERT_EQ(rules.front().hits(), 0);
+    ASSERT_EQ(rules.back().action(), prod::IngressAction::DIVERT);
+    ASSERT_FALSE(rules.back().queue());
+
+    // An invalid dump does not change the rules
+    ASSERT_TRUE(loaded.load(json::Json {R"([{"name": "bad", "action": "drop"}])"}));
+    ASSERT_TRUE(loaded.load(json::Json {R"([{"name": "bad", "action": "keep", "queue": "1"}])"}));
+    ASSERT_TRUE(loaded.load(json::Json {R"({"name": "bad"})"}));
+    ASSERT_EQ(loaded.rules().size(), 2);
+}
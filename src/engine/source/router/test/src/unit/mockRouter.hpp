@@ -15,9 +15,19 @@ public:
     MOCK_METHOD(base::OptError, rebuildEntry, (const std::string& name), (override));
     MOCK_METHOD(base::OptError, enableEntry, (const std::string& name), (override));
     MOCK_METHOD(base::OptError, changePriority, (const std::string& name, size_t priority), (override));
+    MOCK_METHOD(base::OptError, changeEpsLimit, (const std::string& name, std::size_t epsLimit), (override));
     MOCK_METHOD(std::list<prod::Entry>, getEntries, (), (const, override));
     MOCK_METHOD(base::RespOrError<prod::Entry>, getEntry, (const std::string& name), (const, override));
     MOCK_METHOD(void, ingest, (base::Event && event), (override));
+    MOCK_METHOD(void, ingest, (std::vector<base::Event> && events), (override));
+    MOCK_METHOD(base::OptError,
+                attachSampler,
+                (const std::string& name, const std::shared_ptr<TraceSampler>& sampler),
+                (override));
+    MOCK_METHOD(void,
+                detachSampler,
+                (const std::string& name, const std::shared_ptr<TraceSampler>& sampler),
+                (override));
 };
 
 } // namespace router
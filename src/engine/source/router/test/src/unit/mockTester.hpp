@@ -21,7 +21,8 @@ public:
                 ingestTest,
                 (base::Event&&, const ::router::test::Options&),
                 (override));
-    MOCK_METHOD(base::RespOrError<std::unordered_set<std::string>>, getAssets, (const std::string&), (const, override));
+    MOCK_METHOD(base::RespOrError<std::unordered_set<std::string>>, getAssets, (const std::string&), (override));
+    MOCK_METHOD(void, releaseIdle, (), (override));
     MOCK_METHOD(bool, updateLastUsed, (const std::string&, uint64_t), (override));
 };
 
@@ -18,6 +18,7 @@ public:
     MOCK_METHOD(void, stop, (), (override));
     MOCK_METHOD(const std::shared_ptr<IRouter>&, getRouter, (), (const, override));
     MOCK_METHOD(const std::shared_ptr<ITester>&, getTester, (), (const, override));
+    MOCK_METHOD(uint64_t, busyTime, (), (const, override));
 };
 
 } // namespace router
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <bk/mockController.hpp>
+#include <builder/mockBuilder.hpp>
+#include <queue/mockQueue.hpp>
 #include <store/mockStore.hpp>
 
 #include <router/orchestrator.hpp>
@@ -44,6 +47,15 @@ public:
         return workerMock;
     }
 
+    auto addMockTestWorker() -> std::shared_ptr<MockWorker>
+    {
+        auto workerMock = std::make_shared<MockWorker>();
+
+        m_testWorkers.emplace_back(workerMock);
+
+        return workerMock;
+    }
+
     /**************************************************************************
      * TESTER EXPECTS CALL
      *************************************************************************/
@@ -863,3 +875,165 @@ TEST_F(OrchestratorTest, postStrEventFailtureInProtocol)
 {
     EXPECT_TRUE(base::isError(m_orchestrator->postStrEvent("message:1:any")));
 }
+
+TEST_F(OrchestratorTest, sampleTracesInvalidOptionsFailture)
+{
+    prod::TraceOptions opt {"test", test::Options::TraceLevel::NONE, {}, 1, 1, 10};
+    EXPECT_TRUE(base::isError(m_orchestrator->sampleTraces(opt)));
+}
+
+TEST_F(OrchestratorTest, sampleTracesAttachFailture)
+{
+    auto routerMock = std::make_shared<MockRouter>();
+    auto irouterMock = std::static_pointer_cast<router::IRouter>(routerMock);
+    m_orchestrator->forEachWorkerMock(
+        [&irouterMock](auto mockWorker)
+        { EXPECT_CALL(*mockWorker, getRouter()).WillRepeatedly(testing::ReturnRefOfCopy(irouterMock)); });
+
+    // The workers already attached are rolled back
+    EXPECT_CALL(*routerMock, attachSampler("test", testing::_))
+        .WillOnce(testing::Return(std::nullopt))
+        .WillOnce(testing::Return(base::Error {"error"}));
+    EXPECT_CALL(*routerMock, detachSampler("test", testing::_)).Times(m_workersSize);
+
+    prod::TraceOptions opt {"test", test::Options::TraceLevel::ALL, {"decoder/test/0"}, 1, 1, 10};
+    EXPECT_TRUE(base::isError(m_orchestrator->sampleTraces(opt)));
+}
+
+TEST_F(OrchestratorTest, sampleTracesTimeout)
+{
+    auto routerMock = std::make_shared<MockRouter>();
+    auto irouterMock = std::static_pointer_cast<router::IRouter>(routerMock);
+    m_orchestrator->forEachWorkerMock(
+        [&irouterMock](auto mockWorker)
+        { EXPECT_CALL(*mockWorker, getRouter()).WillRepeatedly(testing::ReturnRefOfCopy(irouterMock)); });
+
+    EXPECT_CALL(*routerMock, attachSampler("test", testing::_))
+        .Times(m_workersSize)
+        .WillRepeatedly(testing::Return(std::nullopt));
+    EXPECT_CALL(*routerMock, detachSampler("test", testing::_)).Times(m_workersSize);
+
+    // No event is routed, so nothing is sampled before the timeout
+    prod::TraceOptions opt {"test", test::Options::TraceLevel::ALL, {"decoder/test/0"}, 1, 1, 10};
+    auto result = m_orchestrator->sampleTraces(opt);
+    ASSERT_FALSE(base::isError(result));
+    EXPECT_TRUE(base::getResponse<prod::SampledTraces>(result).empty());
+}
+
+TEST_F(OrchestratorTest, testWorkersStartStop)
+{
+    auto testWorker = m_orchestrator->addMockTestWorker();
+
+    m_orchestrator->forEachWorkerMock([](auto mockWorker) { EXPECT_CALL(*mockWorker, start(testing::_)).Times(1); });
+    EXPECT_CALL(*testWorker, start(testing::_)).Times(1);
+    ASSERT_NO_THROW(m_orchestrator->start());
+
+    // The testers are dumped from the test workers
+    auto testerMock = std::make_shared<MockTester>();
+    auto itesterMock = std::static_pointer_cast<router::ITester>(testerMock);
+    EXPECT_CALL(*testWorker, getTester()).WillOnce(testing::ReturnRefOfCopy(itesterMock));
+    EXPECT_CALL(*testerMock, getEntries()).WillOnce(testing::Return(std::list<test::Entry> {}));
+    EXPECT_CALL(*(m_orchestrator->m_mockstore), upsertInternalDoc(testing::_, testing::_))
+        .WillOnce(::testing::Return(store::mocks::storeOk()));
+
+    m_orchestrator->forEachWorkerMock([](auto mockWorker) { EXPECT_CALL(*mockWorker, stop()).Times(1); });
+    EXPECT_CALL(*testWorker, stop()).Times(1);
+    ASSERT_NO_THROW(m_orchestrator->stop());
+}
+
+TEST_F(OrchestratorTest, testWorkersServeTesters)
+{
+    auto testWorkers = std::list<std::shared_ptr<MockWorker>> {m_orchestrator->addMockTestWorker(),
+                                                                m_orchestrator->addMockTestWorker()};
+
+    auto testerMock = std::make_shared<MockTester>();
+    auto itesterMock = std::static_pointer_cast<router::ITester>(testerMock);
+    for (const auto& testWorker : testWorkers)
+    {
+        EXPECT_CALL(*testWorker, getTester()).WillRepeatedly(testing::ReturnRefOfCopy(itesterMock));
+    }
+
+    // The production workers do not hold testers
+    m_orchestrator->forEachWorkerMock([](auto mockWorker) { EXPECT_CALL(*mockWorker, getTester()).Times(0); });
+
+    EXPECT_CALL(*testerMock, addEntry(testing::_, testing::_)).Times(2).WillRepeatedly(testing::Return(std::nullopt));
+    EXPECT_CALL(*testerMock, enableEntry(testing::_)).Times(2).WillRepeatedly(testing::Return(std::nullopt));
+    EXPECT_CALL(*testerMock, getEntries()).WillOnce(testing::Return(std::list<test::Entry> {}));
+    EXPECT_CALL(*(m_orchestrator->m_mockstore), upsertInternalDoc(testing::_, testing::_))
+        .WillOnce(::testing::Return(store::mocks::storeOk()));
+
+    EXPECT_FALSE(m_orchestrator->postTestEntry(test::EntryPost {"test", "policy/test/0", 0}).has_value());
+}
+
+TEST(OrchestratorOptionsTest, numTestThreadsOutOfRange)
+{
+    router::Orchestrator::Options opt {};
+    opt.m_numThreads = 1;
+    opt.m_numTestThreads = -1;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+
+    opt.m_numTestThreads = 129;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+}
+
+TEST(OrchestratorOptionsTest, prodShards)
+{
+    auto store = std::make_shared<store::mocks::MockStore>();
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    router::Orchestrator::Options opt {};
+    opt.m_numThreads = 2;
+    opt.m_numTestThreads = 1;
+    opt.m_wStore = store;
+    opt.m_builder = builder;
+    opt.m_controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+    opt.m_prodQueue = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    opt.m_testQueue = std::make_shared<queue::mocks::MockQueue<test::QueueType>>();
+    opt.m_testTimeout = 1000;
+    EXPECT_NO_THROW(opt.validate());
+
+    // One queue per worker
+    opt.m_prodShards = {std::make_shared<queue::mocks::MockQueue<base::Event>>()};
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+
+    opt.m_prodShards.emplace_back(nullptr);
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+
+    opt.m_prodShards.back() = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    EXPECT_NO_THROW(opt.validate());
+}
+
+TEST(OrchestratorOptionsTest, maxThreads)
+{
+    auto store = std::make_shared<store::mocks::MockStore>();
+    auto builder = std::make_shared<builder::mocks::MockBuilder>();
+    router::Orchestrator::Options opt {};
+    opt.m_numThreads = 2;
+    opt.m_wStore = store;
+    opt.m_builder = builder;
+    opt.m_controllerMaker = std::make_shared<bk::mocks::MockMakerController>();
+    opt.m_prodQueue = std::make_shared<queue::mocks::MockQueue<base::Event>>();
+    opt.m_testQueue = std::make_shared<queue::mocks::MockQueue<test::QueueType>>();
+    opt.m_testTimeout = 1000;
+
+    opt.m_maxThreads = 4;
+    EXPECT_NO_THROW(opt.validate());
+
+    // Below the minimum or above the limit
+    opt.m_maxThreads = 1;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+    opt.m_maxThreads = 129;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+
+    opt.m_maxThreads = 4;
+    opt.m_scaleUpDepth = 0;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+    opt.m_scaleUpDepth = 1000;
+    opt.m_scaleIntervalMsec = 0;
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+    opt.m_scaleIntervalMsec = 1000;
+
+    // The shards are fixed per worker
+    opt.m_prodShards = {std::make_shared<queue::mocks::MockQueue<base::Event>>(),
+                        std::make_shared<queue::mocks::MockQueue<base::Event>>()};
+    EXPECT_THROW(opt.validate(), std::runtime_error);
+}
@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "queueProbe.hpp"
+
+using namespace router;
+
+namespace
+{
+base::Event makeEvent()
+{
+    return std::make_shared<json::Json>();
+}
+} // namespace
+
+TEST(QueueProbeTest, InvalidSettings)
+{
+    ASSERT_THROW(QueueProbe(0, [](uint64_t) {}), std::logic_error);
+    ASSERT_THROW(QueueProbe(1, nullptr), std::logic_error);
+}
+
+TEST(QueueProbeTest, RecordsSampledEvents)
+{
+    std::vector<uint64_t> waits;
+    QueueProbe probe(2, [&waits](uint64_t wait) { waits.emplace_back(wait); });
+
+    // The first pushed event is sampled, the second is not and a third is pushed while the first is still queued
+    auto first = makeEvent();
+    auto second = makeEvent();
+    auto third = makeEvent();
+    probe.pushed(first);
+    probe.pushed(second);
+    probe.pushed(third);
+
+    probe.popped(second);
+    probe.popped(third);
+    ASSERT_TRUE(waits.empty());
+
+    probe.popped(first);
+    ASSERT_EQ(waits.size(), 1);
+
+    // Popped twice, it is recorded once
+    probe.popped(first);
+    ASSERT_EQ(waits.size(), 1);
+}
+
+TEST(QueueProbeTest, DiscardedEventIsReplaced)
+{
+    std::vector<uint64_t> waits;
+    QueueProbe probe(1, [&waits](uint64_t wait) { waits.emplace_back(wait); });
+
+    // The probed event is discarded by the queue
+    probe.pushed(makeEvent());
+
+    auto event = makeEvent();
+    probe.pushed(event);
+    probe.popped(event);
+    ASSERT_EQ(waits.size(), 1);
+}
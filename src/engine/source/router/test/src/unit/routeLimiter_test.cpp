@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include "routeLimiter.hpp"
+
+using namespace router;
+
+TEST(RouteLimiterTest, UnlimitedByDefault)
+{
+    RouteLimiter limiter;
+    for (auto i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(limiter.admit(1));
+    }
+    ASSERT_EQ(limiter.throttled(), 0);
+}
+
+TEST(RouteLimiterTest, ThrottlesWithinTheSecond)
+{
+    RouteLimiter limiter;
+    limiter.limit(2);
+    ASSERT_TRUE(limiter.admit(1));
+    ASSERT_TRUE(limiter.admit(1));
+    ASSERT_FALSE(limiter.admit(1));
+    ASSERT_FALSE(limiter.admit(1));
+
+    // A new second restarts the count, the throttled events are kept
+    ASSERT_TRUE(limiter.admit(2));
+    ASSERT_TRUE(limiter.admit(2));
+    ASSERT_FALSE(limiter.admit(2));
+    ASSERT_EQ(limiter.throttled(), 3);
+
+    limiter.limit(0);
+    ASSERT_TRUE(limiter.admit(2));
+    ASSERT_EQ(limiter.throttled(), 3);
+}
+
+TEST(RouteLimiterTest, SharedByName)
+{
+    RouteLimits limits;
+    auto limiter = limits.get("route");
+    ASSERT_EQ(limits.get("route"), limiter);
+    ASSERT_NE(limits.get("other"), limiter);
+
+    // Once the route is gone from all the routers, it starts over
+    limiter->limit(1);
+    limiter.reset();
+    ASSERT_EQ(limits.get("route")->limit(), 0);
+}
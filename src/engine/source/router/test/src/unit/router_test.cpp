@@ -188,6 +188,25 @@ public:
 
         return mockCalled;
     }
+
+    std::size_t ingestBatch(std::size_t batchSize)
+    {
+        std::vector<base::Event> batch;
+        for (std::size_t i = 0; i < batchSize; ++i)
+        {
+            batch.emplace_back(std::make_shared<json::Json>(R"({"key": "value"})"));
+        }
+        batch.emplace_back(nullptr);
+        std::size_t calls = 0;
+
+        EXPECT_CALL(*m_mockController, ingest(testing::_))
+            .Times(batchSize)
+            .WillRepeatedly(testing::Invoke([&calls]() { ++calls; }));
+
+        m_router->ingest(std::move(batch));
+
+        return calls;
+    }
 };
 
 TEST_F(RouterTest, AddEntryBadPolicyName)
@@ -367,3 +386,64 @@ TEST_F(RouterTest, IngestSuccess)
 
     EXPECT_TRUE(ingestEvent());
 }
+
+TEST_F(RouterTest, IngestBatchSuccess)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    enableEntry(ENVIRONMENT_NAME);
+
+    EXPECT_EQ(ingestBatch(3), 3);
+}
+
+TEST_F(RouterTest, IngestDisabledEntryNotRouted)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    addEntry(entryPost);
+
+    EXPECT_CALL(*m_mockController, ingest(testing::_)).Times(0);
+    m_router->ingest(std::make_shared<json::Json>(R"({"key": "value"})"));
+}
+
+TEST_F(RouterTest, ChangeEpsLimitNameNotFound)
+{
+    EXPECT_TRUE(m_router->changeEpsLimit(ENVIRONMENT_NAME, 10).has_value());
+}
+
+TEST_F(RouterTest, IngestThrottledAboveTheEpsLimit)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    entryPost.epsLimit(1);
+    addEntry(entryPost);
+    enableEntry(ENVIRONMENT_NAME);
+
+    // At most one event per second, the batch may span two of them
+    std::size_t calls = 0;
+    EXPECT_CALL(*m_mockController, ingest(testing::_))
+        .Times(testing::Between(1, 2))
+        .WillRepeatedly(testing::Invoke([&calls]() { ++calls; }));
+    std::vector<base::Event> batch;
+    for (auto i = 0; i < 10; ++i)
+    {
+        batch.emplace_back(std::make_shared<json::Json>(R"({"key": "value"})"));
+    }
+    m_router->ingest(std::move(batch));
+
+    auto entry = base::getResponse(m_router->getEntry(ENVIRONMENT_NAME));
+    EXPECT_EQ(entry.epsLimit(), 1);
+    EXPECT_EQ(entry.throttled() + calls, 10);
+    EXPECT_EQ(m_router->getEntries().front().throttled(), entry.throttled());
+}
+
+TEST_F(RouterTest, IngestNotThrottledOnceTheLimitIsLifted)
+{
+    auto entryPost = router::prod::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, FILTER_NAME, PRIORITY};
+    entryPost.epsLimit(1);
+    addEntry(entryPost);
+    enableEntry(ENVIRONMENT_NAME);
+
+    EXPECT_FALSE(m_router->changeEpsLimit(ENVIRONMENT_NAME, 0).has_value());
+    EXPECT_EQ(ingestBatch(3), 3);
+    EXPECT_EQ(base::getResponse(m_router->getEntry(ENVIRONMENT_NAME)).throttled(), 0);
+}
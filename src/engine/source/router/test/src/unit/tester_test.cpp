@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <thread>
+
 #include <bk/mockController.hpp>
 #include <builder/mockPolicy.hpp>
 #include <builder/mockBuilder.hpp>
@@ -65,7 +68,8 @@ public:
             .WillOnce(::testing::Return(bk::Subscription(1)));
         EXPECT_CALL(*m_mockController, ingestGet(testing::_))
             .WillOnce(::testing::Return(std::make_shared<json::Json>(event)));
-        EXPECT_CALL(*m_mockController, unsubscribeAll());
+        // The subscriptions are kept for the next tests
+        EXPECT_CALL(*m_mockController, unsubscribeAll()).Times(0);
     }
 
     void ingestTestCallersFailture()
@@ -286,6 +290,37 @@ TEST_F(TesterTest, SuccessIngestTest)
     stopControllerCall();
 }
 
+TEST_F(TesterTest, IngestTestReusesSubscriptions)
+{
+    auto entryPost = router::test::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, LIFESPAM};
+    std::unordered_set<base::Name> fakeAssets {};
+    fakeAssets.insert(base::Name("asset/test/0"));
+
+    addEntryCallers(fakeAssets, "hash");
+    m_test->addEntry(entryPost);
+    m_test->enableEntry(ENVIRONMENT_NAME);
+
+    std::unordered_set<std::string> assets {"asset/test/0"};
+    router::test::Options opt(router::test::Options::TraceLevel::ASSET_ONLY, assets, ENVIRONMENT_NAME);
+    router::test::Options otherOpt(router::test::Options::TraceLevel::NONE, {}, ENVIRONMENT_NAME);
+
+    // Subscribed once for the tests tracing the same assets, and again when the assets change
+    EXPECT_CALL(*m_mockController, subscribe(testing::_, testing::_))
+        .WillOnce(::testing::Return(bk::Subscription(1)));
+    EXPECT_CALL(*m_mockController, ingestGet(testing::_))
+        .Times(3)
+        .WillRepeatedly(::testing::Return(std::make_shared<json::Json>(R"({"key": "value"})")));
+    EXPECT_CALL(*m_mockController, unsubscribeAll()).Times(1);
+
+    for (const auto* options : {&opt, &opt, &otherOpt})
+    {
+        auto response = m_test->ingestTest(std::make_shared<json::Json>(R"({"key": "value"})"), *options);
+        EXPECT_FALSE(std::holds_alternative<base::Error>(response));
+    }
+
+    stopControllerCall();
+}
+
 TEST_F(TesterTest, FailtureIngestTestNameNotExist)
 {
     std::unordered_set<std::string> fakeAssetsString {};
@@ -405,3 +440,59 @@ TEST_F(TesterTest, SucessUpdateLast)
 
     stopControllerCall();
 }
+
+TEST_F(TesterTest, LazyEntryBuiltOnFirstTest)
+{
+    auto environmentBuilder = std::make_shared<router::EnvironmentBuilder>(m_mockBuilder, m_mockControllerMaker);
+    m_test = std::make_shared<router::Tester>(environmentBuilder, 3600);
+    auto entryPost = router::test::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, LIFESPAM};
+
+    // The loaded entries are not built until their first test
+    EXPECT_CALL(*m_mockBuilder, buildPolicy(testing::_)).Times(0);
+    EXPECT_FALSE(m_test->addEntry(entryPost, true).has_value());
+    EXPECT_FALSE(m_test->enableEntry(ENVIRONMENT_NAME).has_value());
+    testing::Mock::VerifyAndClearExpectations(m_mockBuilder.get());
+
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    addEntryCallers(fakeAssets, "hash");
+    ingestTestCallersSuccess(R"({"key": "value"})");
+
+    router::test::Options opt(router::test::Options::TraceLevel::ASSET_ONLY, {"asset/test/0"}, ENVIRONMENT_NAME);
+    auto response = m_test->ingestTest(std::make_shared<json::Json>(R"({"key": "value"})"), opt);
+    EXPECT_FALSE(std::holds_alternative<base::Error>(response));
+    EXPECT_EQ(base::getResponse(m_test->getEntry(ENVIRONMENT_NAME)).hash(), "hash");
+
+    stopControllerCall();
+}
+
+TEST_F(TesterTest, ReleaseIdleEntries)
+{
+    auto environmentBuilder = std::make_shared<router::EnvironmentBuilder>(m_mockBuilder, m_mockControllerMaker);
+    m_test = std::make_shared<router::Tester>(environmentBuilder, 1);
+    auto entryPost = router::test::EntryPost {ENVIRONMENT_NAME, POLICY_NAME, LIFESPAM};
+
+    std::unordered_set<base::Name> fakeAssets {base::Name("asset/test/0")};
+    addEntryCallers(fakeAssets, "hash");
+    m_test->addEntry(entryPost);
+    m_test->enableEntry(ENVIRONMENT_NAME);
+
+    // Not idle yet
+    EXPECT_CALL(*m_mockController, stop()).Times(0);
+    m_test->releaseIdle();
+    testing::Mock::VerifyAndClearExpectations(m_mockController.get());
+
+    // Released after the timeout, and built again when it is used
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    stopControllerCall();
+    m_test->releaseIdle();
+    testing::Mock::VerifyAndClearExpectations(m_mockController.get());
+
+    addEntryCallers(fakeAssets, "hash");
+    std::unordered_set<std::string> fakeAssetsString {"asset/test/0"};
+    EXPECT_CALL(*m_mockController, getTraceables()).WillOnce(::testing::ReturnRef(fakeAssetsString));
+    auto assets = m_test->getAssets(ENVIRONMENT_NAME);
+    EXPECT_FALSE(std::holds_alternative<base::Error>(assets));
+    EXPECT_EQ(base::getResponse(assets), fakeAssetsString);
+
+    stopControllerCall();
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include "workerScaler.hpp"
+
+using namespace router;
+
+namespace
+{
+constexpr uint64_t INTERVAL_NS = 1000000000;
+
+WorkerScaler::Sample sample(std::size_t workers, std::size_t depth, double utilization)
+{
+    return {workers, depth, static_cast<uint64_t>(utilization * INTERVAL_NS * workers), INTERVAL_NS};
+}
+} // namespace
+
+TEST(WorkerScalerTest, InvalidLimits)
+{
+    ASSERT_THROW(WorkerScaler(0, 2, 10), std::logic_error);
+    ASSERT_THROW(WorkerScaler(2, 1, 10), std::logic_error);
+    ASSERT_THROW(WorkerScaler(1, 2, 0), std::logic_error);
+    ASSERT_NO_THROW(WorkerScaler(2, 2, 10));
+}
+
+TEST(WorkerScalerTest, Utilization)
+{
+    ASSERT_DOUBLE_EQ(WorkerScaler::utilization(sample(2, 0, 0.5)), 0.5);
+    ASSERT_DOUBLE_EQ(WorkerScaler::utilization({2, 0, 3 * INTERVAL_NS, INTERVAL_NS}), 1);
+    ASSERT_DOUBLE_EQ(WorkerScaler::utilization({0, 0, 0, INTERVAL_NS}), 0);
+    ASSERT_DOUBLE_EQ(WorkerScaler::utilization({1, 0, 0, 0}), 0);
+}
+
+TEST(WorkerScalerTest, ScalesUpWhenBackedUpAndBusy)
+{
+    WorkerScaler scaler(1, 3, 10);
+
+    // Backed up but idle workers are held back by something else
+    ASSERT_EQ(scaler.next(sample(1, 100, 0.5)), 0);
+    // Busy but the queue keeps up
+    ASSERT_EQ(scaler.next(sample(1, 5, 1)), 0);
+
+    ASSERT_EQ(scaler.next(sample(1, 100, 0.9)), 1);
+    ASSERT_EQ(scaler.next(sample(2, 100, 0.9)), 1);
+    // Up to the maximum
+    ASSERT_EQ(scaler.next(sample(3, 100, 0.9)), 0);
+    // The depth is per worker
+    ASSERT_EQ(scaler.next(sample(2, 15, 0.9)), 0);
+}
+
+TEST(WorkerScalerTest, ScalesDownAfterIdleSamples)
+{
+    WorkerScaler scaler(1, 3, 10);
+
+    for (std::size_t i = 1; i < WorkerScaler::SCALE_DOWN_SAMPLES; ++i)
+    {
+        ASSERT_EQ(scaler.next(sample(3, 0, 0.1)), 0);
+    }
+    ASSERT_EQ(scaler.next(sample(3, 0, 0.1)), -1);
+
+    // A busy sample in between restarts the count
+    for (std::size_t i = 1; i < WorkerScaler::SCALE_DOWN_SAMPLES; ++i)
+    {
+        ASSERT_EQ(scaler.next(sample(2, 0, 0.1)), 0);
+    }
+    ASSERT_EQ(scaler.next(sample(2, 0, 0.5)), 0);
+    ASSERT_EQ(scaler.next(sample(2, 0, 0.1)), 0);
+
+    // Not below the minimum
+    WorkerScaler minimum(1, 3, 10);
+    for (std::size_t i = 0; i < 2 * WorkerScaler::SCALE_DOWN_SAMPLES; ++i)
+    {
+        ASSERT_EQ(minimum.next(sample(1, 0, 0)), 0);
+    }
+}
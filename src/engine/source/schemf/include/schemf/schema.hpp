@@ -4,6 +4,7 @@
 #include <experimental/propagate_const>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 #include <schemf/field.hpp>
 #include <schemf/ischema.hpp>
@@ -18,12 +19,43 @@ namespace schemf
 class Schema final : public IValidator
 {
 private:
-    std::map<std::string, Field> m_fields; ///< First level fields of the schema.
+    /**
+     * @brief Type and array flag of a field, the only metadata needed to answer the lookups.
+     */
+    struct FieldInfo
+    {
+        Type type;
+        bool isArray;
+    };
+
+    std::map<std::string, Field> m_fields;               ///< First level fields of the schema.
+    std::unordered_map<std::string, FieldInfo> m_index; ///< Every field of the schema by its full dot path.
     class Validator;
     std::experimental::propagate_const<std::unique_ptr<Validator>> m_validator;
 
     Field get(const DotPath& name) const;
 
+    /**
+     * @brief Get the type and array flag of a field, from the index or walking the fields if it is not indexed.
+     *
+     * @param name Dot-separated path to the field.
+     * @return FieldInfo The type and array flag of the field.
+     *
+     * @throw std::runtime_error If the field does not exist.
+     */
+    FieldInfo info(const DotPath& name) const;
+
+    /**
+     * @brief Add a field and all its properties to the index.
+     *
+     * Paths with parts containing dots or escapes are not indexed, so they cannot be mistaken with other paths, and
+     * are looked up walking the fields.
+     *
+     * @param path Dot-separated path to the field, the parts joined unescaped.
+     * @param field The field to index.
+     */
+    void indexField(const std::string& path, const Field& field);
+
     /**
      * @brief Convert a field JSON entry to a Schema Field object.
      *
@@ -71,12 +103,12 @@ public:
     /**
      * @copydoc ISchema::getType
      */
-    inline Type getType(const DotPath& name) const override { return get(name).type(); }
+    inline Type getType(const DotPath& name) const override { return info(name).type; }
 
     /**
      * @copydoc ISchema::getJsonType
      */
-    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(get(name).type()); }
+    inline json::Json::Type getJsonType(const DotPath& name) const override { return typeToJType(info(name).type); }
 
     /**
      * @copydoc ISchema::hasField
@@ -86,7 +118,7 @@ public:
     /**
      * @copydoc ISchema::isArray
      */
-    inline bool isArray(const DotPath& name) const override { return get(name).isArray(); }
+    inline bool isArray(const DotPath& name) const override { return info(name).isArray; }
 
     /**
      * @brief Load a schema from a JSON object, adding each field to the schema.
@@ -15,6 +15,24 @@ Schema::Schema()
 
 Schema::~Schema() = default;
 
+void Schema::indexField(const std::string& path, const Field& field)
+{
+    m_index.insert_or_assign(path, FieldInfo {field.type(), field.isArray()});
+
+    if (!hasProperties(field.type()))
+    {
+        return;
+    }
+
+    for (const auto& [name, property] : field.properties())
+    {
+        if (name.find_first_of(".\\") == std::string::npos)
+        {
+            indexField(path + "." + name, property);
+        }
+    }
+}
+
 void Schema::addField(const DotPath& name, const Field& field)
 {
     if (name.parts().empty())
@@ -52,6 +70,28 @@ void Schema::addField(const DotPath& name, const Field& field)
     }
 
     current->emplace(name.parts().back(), field);
+
+    // Index the new field and the parents created for it
+    std::string path;
+    for (auto it = name.cbegin(); it != name.cend(); ++it)
+    {
+        if (it->find_first_of(".\\") != std::string::npos)
+        {
+            return;
+        }
+
+        if (!path.empty())
+        {
+            path += ".";
+        }
+        path += *it;
+
+        if (it != name.cend() - 1 && m_index.count(path) == 0)
+        {
+            m_index.emplace(path, FieldInfo {Type::OBJECT, false});
+        }
+    }
+    indexField(path, field);
 }
 
 void Schema::removeField(const DotPath& name)
@@ -81,6 +121,21 @@ void Schema::removeField(const DotPath& name)
     }
 
     current->erase(entry);
+
+    // Drop the field and its properties from the index
+    const auto& path = name.str();
+    const auto prefix = path + ".";
+    for (auto it = m_index.begin(); it != m_index.end();)
+    {
+        if (it->first == path || it->first.compare(0, prefix.size(), prefix) == 0)
+        {
+            it = m_index.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
 }
 
 Field Schema::get(const DotPath& name) const
@@ -134,8 +189,25 @@ Field Schema::get(const DotPath& name) const
     return *target;
 }
 
+Schema::FieldInfo Schema::info(const DotPath& name) const
+{
+    auto indexed = m_index.find(name.str());
+    if (indexed != m_index.end())
+    {
+        return indexed->second;
+    }
+
+    const auto field = get(name);
+    return {field.type(), field.isArray()};
+}
+
 bool Schema::hasField(const DotPath& name) const
 {
+    if (m_index.count(name.str()) != 0)
+    {
+        return true;
+    }
+
     const auto* current = &m_fields;
     auto isParentSchema = false;
     for (auto it = name.cbegin(); it != name.cend(); ++it)
@@ -230,6 +302,7 @@ void Schema::load(const json::Json& json)
         throw std::runtime_error("Schema json must have a 'fields' object");
     }
 
+    m_index.reserve(m_index.size() + fields.value().size());
     for (const auto& [key, value] : fields.value())
     {
         auto field = entryToField(key, value);
@@ -9,7 +9,7 @@ namespace schemf
 void Schema::Validator::registerCompatibles()
 {
     m_compatibles.emplace(Type::BOOLEAN,
-                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), {}});
+                          ValidationInfo {json::Json::Type::Boolean, validators::getBoolValidator(), {}, true});
     m_compatibles.emplace(Type::BYTE,
                           ValidationInfo {json::Json::Type::Number,
                                           validators::getShortValidator(),
@@ -51,7 +51,8 @@ void Schema::Validator::registerCompatibles()
                                            {Type::DATE, false},
                                            {Type::DATE_NANOS, false},
                                            {Type::IP, false},
-                                           {Type::BINARY, false}}});
+                                           {Type::BINARY, false}},
+                                          true});
     m_compatibles.emplace(Type::TEXT,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
@@ -59,7 +60,8 @@ void Schema::Validator::registerCompatibles()
                                            {Type::DATE, false},
                                            {Type::DATE_NANOS, false},
                                            {Type::IP, false},
-                                           {Type::BINARY, false}}});
+                                           {Type::BINARY, false}},
+                                          true});
     m_compatibles.emplace(Type::DATE,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getDateValidator(),
@@ -67,7 +69,8 @@ void Schema::Validator::registerCompatibles()
     m_compatibles.emplace(Type::DATE_NANOS,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getStringValidator(),
-                                          {{Type::KEYWORD, true}, {Type::TEXT, true}}});
+                                          {{Type::KEYWORD, true}, {Type::TEXT, true}},
+                                          true});
     m_compatibles.emplace(Type::IP,
                           ValidationInfo {json::Json::Type::String,
                                           validators::getIpValidator(),
@@ -77,11 +80,11 @@ void Schema::Validator::registerCompatibles()
                                           validators::getBinaryValidator(),
                                           {{Type::KEYWORD, true}, {Type::TEXT, true}}});
     m_compatibles.emplace(Type::OBJECT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
     m_compatibles.emplace(Type::NESTED,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
     m_compatibles.emplace(Type::GEO_POINT,
-                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}});
+                          ValidationInfo {json::Json::Type::Object, validators::getObjectValidator(), {}, true});
 }
 
 base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& name, const JTypeToken& token) const
@@ -96,6 +99,12 @@ base::RespOrError<ValidationResult> Schema::Validator::validate(const DotPath& n
                                         json::Json::typeToStr(entry.type))};
     }
 
+    // The operation already guarantees the JSON type, a validator that only checks it is not needed
+    if (entry.typeOnly && !token.isArray())
+    {
+        return ValidationResult();
+    }
+
     // When validating json types, if the schema type has a validator, use it.
     return ValidationResult(token.isArray() ? asArray(entry.validator) : entry.validator);
 }
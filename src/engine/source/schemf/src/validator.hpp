@@ -14,6 +14,7 @@ struct ValidationInfo
     ValueValidator validator; ///< Validator for the json value.
     /// Compatible types. The bool value indicates whether the compatible type needs additional validation.
     std::unordered_map<schemf::Type, bool> compatibles;
+    bool typeOnly = false; ///< The validator only checks the JSON type, so it is not needed if the type is known.
 };
 
 class Schema::Validator
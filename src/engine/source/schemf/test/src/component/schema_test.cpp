@@ -164,3 +164,40 @@ TEST(SchemaTest, ArrayItem)
     ASSERT_THROW(schema.getType("a.n"), std::runtime_error);
     ASSERT_THROW(schema.getJsonType("a.n"), std::runtime_error);
 }
+
+TEST(SchemaTest, RemoveParent)
+{
+    Schema schema;
+    schema.addField("a.b.c", {Type::INTEGER});
+    schema.addField("a.d", {Type::TEXT});
+    ASSERT_EQ(schema.getType("a.b.c"), Type::INTEGER);
+    ASSERT_EQ(schema.getType("a.b"), Type::OBJECT);
+
+    schema.removeField("a.b");
+    ASSERT_THROW(schema.getType("a.b.c"), std::runtime_error);
+    ASSERT_THROW(schema.getType("a.b"), std::runtime_error);
+    ASSERT_EQ(schema.getType("a.d"), Type::TEXT);
+
+    schema.addField("a.b", {Type::KEYWORD, true});
+    ASSERT_EQ(schema.getType("a.b"), Type::KEYWORD);
+    ASSERT_TRUE(schema.isArray("a.b"));
+}
+
+TEST(SchemaTest, FieldWithProperties)
+{
+    Schema schema;
+    schema.addField("a", {.type = Type::NESTED, .properties = {{"b", Field({.type = Type::IP})}}});
+    ASSERT_TRUE(schema.hasField("a.b"));
+    ASSERT_EQ(schema.getType("a.b"), Type::IP);
+    ASSERT_EQ(schema.getJsonType("a.b"), json::Json::Type::String);
+}
+
+TEST(SchemaTest, EscapedField)
+{
+    Schema schema;
+    schema.addField("a\\.b", {Type::BOOLEAN});
+    ASSERT_TRUE(schema.hasField("a\\.b"));
+    ASSERT_EQ(schema.getType("a\\.b"), Type::BOOLEAN);
+    ASSERT_FALSE(schema.hasField("a.b"));
+    ASSERT_THROW(schema.getType("a.b"), std::runtime_error);
+}
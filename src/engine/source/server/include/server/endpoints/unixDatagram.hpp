@@ -1,8 +1,12 @@
 #ifndef _SERVER_ENDPOINT_UNIX_DATAGRAM_HPP
 #define _SERVER_ENDPOINT_UNIX_DATAGRAM_HPP
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 #include <metrics/iMetricsManager.hpp>
 
@@ -23,16 +27,47 @@ namespace engineserver::endpoint
  * available. If the client is configured as non-blocking, the client will receive a "Resource temporarily unavailable"
  * error. The size of the thread pool is defined by the taskQueueSize parameter.
  *
+ * If the receiveThreads is set to a value greater than 0, the messages are received by that number of threads
+ * instead of the loop, each one reading batches of messages from the socket and calling the callback directly. With a
+ * batch callback, each batch is handed over at once, as views of the receive buffers.
+ *
+ * A filter can be set to check the raw messages before they are copied or batched, the rejected ones are not handed
+ * over to the callback.
+ *
+ * The histograms of the event and queue sizes are sampled, one in HISTOGRAM_SAMPLE_RATE messages is recorded.
+ *
  * @note The thread pool is shared between all the endpoints.
  * @note Currently responses are not implemented, so the callback function must not return a string.
  */
 class UnixDatagram : public Endpoint
 {
+public:
+    /**
+     * @brief Callback of the messages of a batch, the views are only valid while it runs.
+     */
+    using BatchCallback = std::function<void(const std::vector<std::string_view>&)>;
+
+    /**
+     * @brief Filter of the raw messages, returns false to discard the message.
+     */
+    using Filter = std::function<bool(std::string_view)>;
+
+    static constexpr std::size_t HISTOGRAM_SAMPLE_RATE {16}; ///< Messages per sample of the histograms
+
 private:
     std::function<void(std::string&)> m_callback; ///< Callback function to be called when a message is received
+    BatchCallback m_batchCallback;                ///< Callback of the batches of the receive threads, if set
+    Filter m_filter;                              ///< Filter of the raw messages, if set
+    std::size_t m_histogramSamples;               ///< Messages received by the loop, to sample the histograms
     std::shared_ptr<uvw::UDPHandle> m_handle;      ///< Handle to the socket
     int m_bufferSize;                              ///< Size of the receive buffer
 
+    std::size_t m_receiveThreads;                   ///< Number of threads receiving the messages, 0 to use the loop
+    int m_socketFd;                                 ///< Socket read by the receive threads
+    std::atomic_bool m_stopThreads;                 ///< Request the receive threads to stop
+    std::vector<std::thread> m_threads;             ///< Threads receiving the messages
+    std::shared_ptr<uvw::AsyncHandle> m_stopHandle; ///< Stops the receive threads when the loop handles are closed
+
     struct Metric {
         std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;     ///< Metrics scope for the endpoint
         std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecv;    ///< Counter for the total requests
@@ -54,6 +89,16 @@ private:
      */
     int bindUnixDatagramSocket(int& bufferSize);
 
+    /**
+     * @brief Receive batches of messages from the socket until the receive threads are stopped.
+     */
+    void receiveLoop();
+
+    /**
+     * @brief Stop and join the receive threads, and close the socket.
+     */
+    void stopReceiveThreads();
+
 public:
     /**
      * @brief Create a Unix Datagram object
@@ -63,12 +108,32 @@ public:
      * @param metricsScope Metrics scope for the endpoint
      * @param metricsScopeDelta Metrics scope for the endpoint rate
      * @param taskQueueSize Size of the queue of tasks to be processed by the thread pool
+     * @param receiveThreads Number of threads receiving the messages, 0 to receive them in the loop
+     * @note If receiveThreads is greater than 0 the taskQueueSize is ignored, the callback is called in the receive
+     * threads and must be thread-safe.
      */
     UnixDatagram(const std::string& address,
                  const std::function<void(const std::string&)>& callback,
                  std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
                  std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
-                 const std::size_t taskQueueSize = 0);
+                 const std::size_t taskQueueSize = 0,
+                 const std::size_t receiveThreads = 0);
+
+    /**
+     * @brief Create a Unix Datagram object whose receive threads hand over the messages in batches
+     *
+     * @param address Path to the socket
+     * @param batchCallback Callback function to be called with each batch of messages received, it must be
+     * thread-safe
+     * @param metricsScope Metrics scope for the endpoint
+     * @param metricsScopeDelta Metrics scope for the endpoint rate
+     * @param receiveThreads Number of threads receiving the messages, greater than 0
+     */
+    UnixDatagram(const std::string& address,
+                 const BatchCallback& batchCallback,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                 std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                 const std::size_t receiveThreads);
 
     /**
      * @brief Construct a new Unix Datagram object
@@ -104,6 +169,14 @@ public:
      */
     bool resume(void) override;
 
+    /**
+     * @brief Set the filter of the raw messages, checked before they are copied or batched
+     *
+     * @param filter Filter of the messages, it must be thread-safe if there are receive threads
+     * @throw std::runtime_error if the endpoint is already bound
+     */
+    void setFilter(Filter filter);
+
     /**
      * @brief Get the size of the receive buffer
      * @return int Size of the receive buffer
@@ -0,0 +1,210 @@
+#ifndef _SERVER_ENDPOINT_UNIX_SHM_RING_HPP
+#define _SERVER_ENDPOINT_UNIX_SHM_RING_HPP
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <metrics/iMetricsManager.hpp>
+
+#include <server/endpoint.hpp>
+#include <server/shmRing.hpp>
+
+namespace engineserver::endpoint
+{
+/**
+ * @brief Endpoint that receives the events through shared-memory rings, see shmring::Producer.
+ *
+ * @details The endpoint listens on a unix stream socket. Each producer that connects gets its own ring, a memory file
+ * and two eventfds sent over the connection, and writes its events there without a syscall per event. The ring is
+ * read by receiveThreads threads of the endpoint, which claim batches of events and hand them over as views of the
+ * shared memory, so the events are not copied before they are parsed. The producer is limited by the ring size, not
+ * by the size of a datagram.
+ *
+ * The ring of a producer is read until it is empty once the producer closes the connection, then it is released.
+ * A producer that corrupts its ring is disconnected, the events it wrote are lost.
+ *
+ * A filter can be set to check the raw events before they are batched, the rejected ones are not handed over to the
+ * callback.
+ *
+ * @note The connections are accepted by a thread of the endpoint, the loop only closes the endpoint.
+ */
+class UnixShmRing : public Endpoint
+{
+public:
+    /**
+     * @brief Callback of the events of a batch, the views are only valid while it runs.
+     */
+    using BatchCallback = std::function<void(const std::vector<std::string_view>&)>;
+
+    /**
+     * @brief Filter of the raw events, returns false to discard the event.
+     */
+    using Filter = std::function<bool(std::string_view)>;
+
+    static constexpr std::size_t HISTOGRAM_SAMPLE_RATE {16}; ///< Events per sample of the histograms
+    static constexpr std::size_t MAX_PRODUCERS {16};         ///< Producers connected at once, each one with a ring
+
+private:
+    /**
+     * @brief Ring of a producer and the threads reading it.
+     */
+    struct Ring
+    {
+        int connectionFd {-1}; ///< Connection of the producer
+        int memoryFd {-1};     ///< Memory file of the ring
+        int dataFd {-1};       ///< Signaled by the producer when it publishes records
+        int spaceFd {-1};      ///< Signaled by the consumers when they release space
+        void* memory {nullptr};
+        std::size_t memorySize {0};
+        shmring::Header* header {nullptr};
+        const char* data {nullptr};
+        uint64_t capacity {0}; ///< Bytes of data, the one of the header can be changed by the producer
+
+        std::atomic_bool draining {false}; ///< The producer disconnected, read the pending events and stop
+        std::atomic_bool broken {false};   ///< The ring is not valid any more, stop reading it
+        std::vector<std::thread> threads;  ///< Threads reading the ring
+
+        ~Ring();
+    };
+
+    BatchCallback m_callback;       ///< Callback of the batches of events
+    Filter m_filter;                ///< Filter of the raw events, if set
+    std::size_t m_ringSize;         ///< Bytes of data of each ring
+    std::size_t m_receiveThreads;   ///< Threads reading each ring
+    int m_socketFd;                 ///< Socket accepting the producers
+    int m_wakeFd;                   ///< Wakes up the accept thread to stop it
+    std::atomic_bool m_stopThreads; ///< Request the threads to stop
+    std::thread m_acceptThread;     ///< Thread accepting the producers and releasing their rings
+    std::list<std::unique_ptr<Ring>> m_rings;       ///< Rings of the producers, only used by the accept thread
+    std::shared_ptr<uvw::AsyncHandle> m_stopHandle; ///< Stops the threads when the loop handles are closed
+
+    struct Metric
+    {
+        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScope;     ///< Metrics scope for the endpoint
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecv;    ///< Counter for the total requests
+        std::shared_ptr<metricsManager::iHistogram<uint64_t>> m_eventSize; ///< Histogram for the event size
+
+        std::shared_ptr<metricsManager::IMetricsScope> m_metricsScopeDelta; ///< Metrics scope for the endpoint rate
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_byteRecvPerSecond; ///< Byte received per second
+        std::shared_ptr<metricsManager::iCounter<uint64_t>> m_eventPerSecond;    ///< Event received per second
+    };
+    Metric m_metric;
+
+    /**
+     * @brief Open, bind and listen on the unix stream socket of the producers.
+     *
+     * @throw std::runtime_error if the socket cannot be created or bound.
+     */
+    int bindUnixStreamSocket();
+
+    /**
+     * @brief Accept the producers and release the rings of the disconnected ones until the threads are stopped.
+     */
+    void acceptLoop();
+
+    /**
+     * @brief Create the ring of a producer, send it over the connection and start its threads.
+     *
+     * @param connectionFd Connection of the producer, owned by the ring.
+     */
+    void openRing(int connectionFd);
+
+    /**
+     * @brief Read a ring until it is empty after its producer disconnects, or the threads are stopped.
+     *
+     * @param ring Ring to read.
+     */
+    void consumeLoop(Ring& ring);
+
+    /**
+     * @brief Claim the next run of published records of a ring.
+     *
+     * @param ring Ring to claim from, marked as broken if its records are not valid.
+     * @param begin Position of the first record claimed.
+     * @param end Position after the last record claimed.
+     * @return true if records were claimed, false if the ring is empty or broken.
+     */
+    bool claimRecords(Ring& ring, uint64_t& begin, uint64_t& end);
+
+    /**
+     * @brief Hand over a claimed run of records and release it.
+     *
+     * @param ring Ring the records belong to.
+     * @param begin Position of the first record.
+     * @param end Position after the last record.
+     * @param batch Buffer of the views of the events.
+     * @param samples Events read by the thread, to sample the histograms.
+     */
+    void consumeRecords(
+        Ring& ring, uint64_t begin, uint64_t end, std::vector<std::string_view>& batch, std::size_t& samples);
+
+    /**
+     * @brief Release the done records at the tail of a ring, waking up the producer if it waits.
+     *
+     * @param ring Ring to release.
+     */
+    static void releaseRecords(Ring& ring);
+
+    /**
+     * @brief Stop and join the threads, release the rings and close the socket.
+     */
+    void stopThreads();
+
+public:
+    /**
+     * @brief Create a Unix Shared-memory Ring endpoint
+     *
+     * @param address Path to the socket the producers connect to
+     * @param callback Callback function to be called with each batch of events, it must be thread-safe
+     * @param metricsScope Metrics scope for the endpoint
+     * @param metricsScopeDelta Metrics scope for the endpoint rate
+     * @param ringSize Bytes of data of the ring of each producer, the largest event is half of it
+     * @param receiveThreads Number of threads reading the ring of each producer, greater than 0
+     */
+    UnixShmRing(const std::string& address,
+                const BatchCallback& callback,
+                std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                const std::size_t ringSize,
+                const std::size_t receiveThreads);
+    ~UnixShmRing();
+
+    /**
+     * @copydoc link-object::Endpoint::bind
+     */
+    void bind(std::shared_ptr<uvw::Loop> loop) override;
+
+    /**
+     * @copydoc link-object::Endpoint::close
+     */
+    void close(void) override;
+
+    /**
+     * @brief The rings cannot be paused, the producers wait while their ring is full
+     *
+     * @return false
+     */
+    bool pause(void) override { return false; }
+
+    /**
+     * @brief The rings cannot be paused, the producers wait while their ring is full
+     *
+     * @return false
+     */
+    bool resume(void) override { return false; }
+
+    /**
+     * @brief Set the filter of the raw events, checked before they are batched
+     *
+     * @param filter Filter of the events, it must be thread-safe
+     * @throw std::runtime_error if the endpoint is already bound
+     */
+    void setFilter(Filter filter);
+};
+} // namespace engineserver::endpoint
+#endif // _SERVER_ENDPOINT_UNIX_SHM_RING_HPP
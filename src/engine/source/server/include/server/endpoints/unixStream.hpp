@@ -8,6 +8,7 @@
 
 #include <server/endpoint.hpp>
 #include <server/protocolHandler.hpp>
+#include <server/scheduler.hpp>
 
 namespace engineserver::endpoint
 {
@@ -23,6 +24,10 @@ namespace engineserver::endpoint
  * If the queue is full, drop the message and respond with an error from the protocol handler,
  * "resource temporarily unavailable"
  *
+ * If a scheduler is set, the messages are classified and run by it instead of the thread pool, each class with its own
+ * queue limit and threads, and the taskQueueSize is not used. If the queue of the class is full, the message is
+ * dropped with the same error.
+ *
  * @note The thread pool is shared between all the endpoints.
  * @note Currently responses are not implemented, so the callback function must not return a string.
  */
@@ -32,6 +37,7 @@ private:
     std::shared_ptr<uvw::PipeHandle> m_handle;         ///< Handle to the socket
     std::size_t m_timeout;                             ///< Timeout for the connection in milliseconds
     std::shared_ptr<ProtocolHandlerFactory> m_factory; ///< Factory to create protocol handlers for each client
+    std::shared_ptr<Scheduler> m_scheduler;            ///< Scheduler of the messages, the thread pool is used if null
 
     struct Metric
     {
@@ -80,11 +86,13 @@ private:
      * @param asyncs Array of AsyncHandler instance that will be used to send the event using send()
      * @param protocolHandler Protocol handler to process the message
      * @param request Message to be processed
+     * @param taskClass Class of the message, if it is run by the scheduler
      */
     void createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                               std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
                               std::shared_ptr<ProtocolHandler> protocolHandler,
-                              std::string&& request);
+                              std::string&& request,
+                              TaskClass taskClass);
 
     /**
      * @brief Configure the client to close the connection gracefully
@@ -119,13 +127,16 @@ public:
      * @param metricsScopeDelta Metrics scope for the endpoint rate
      * @param taskQueueSize Size of the queue of tasks to be processed by the thread pool
      * @param timeout Timeout for the connection in milliseconds
+     * @param scheduler Scheduler of the messages, stopped when the endpoint is destroyed. If null, the thread pool is
+     * used
      */
     UnixStream(const std::string& address,
                std::shared_ptr<ProtocolHandlerFactory> factory,
                std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
                std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
                const std::size_t taskQueueSize = 0,
-               std::size_t timeout = 5000);
+               std::size_t timeout = 5000,
+               std::shared_ptr<Scheduler> scheduler = nullptr);
     ~UnixStream();
 
     /**
@@ -0,0 +1,141 @@
+#ifndef _SERVER_SCHEDULER_HPP
+#define _SERVER_SCHEDULER_HPP
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace engineserver
+{
+
+/**
+ * @brief Class of the tasks of the scheduler.
+ */
+enum class TaskClass : std::size_t
+{
+    CONTROL = 0, ///< Control plane and status requests, short and latency sensitive
+    ADMIN,       ///< Heavy administration operations (catalog, policies, databases)
+    EVENT        ///< Event work (enqueue and test events)
+};
+
+constexpr std::size_t TASK_CLASSES = 3; ///< Number of task classes
+
+/**
+ * @brief Weighted fair scheduler of tasks over a pool of threads.
+ *
+ * Each class has its own queue and limit of queued tasks, and runs at most its number of threads at once, so a flood
+ * of one class can not take the whole pool. The free threads pick the next task with start-time fair queuing: each
+ * class advances its virtual time by the inverse of its weight for each task it starts, and the class with the lowest
+ * virtual time goes first, so the busy classes share the pool in proportion to their weights and an idle class does
+ * not bank time to flood it later.
+ */
+class Scheduler
+{
+public:
+    using Task = std::function<void()>;
+
+    struct ClassOptions
+    {
+        std::size_t threads;   ///< Maximum tasks of the class running at once
+        std::size_t queueSize; ///< Maximum tasks of the class waiting to run
+        std::size_t weight;    ///< Share of the pool when the classes compete for it
+    };
+
+    struct Options
+    {
+        std::size_t threads;                             ///< Threads of the pool
+        std::array<ClassOptions, TASK_CLASSES> classes; ///< Options of each class, indexed by TaskClass
+    };
+
+private:
+    struct Class
+    {
+        ClassOptions options;    ///< Options of the class
+        std::deque<Task> queue;  ///< Tasks waiting to run
+        std::size_t running {0}; ///< Tasks running
+        double virtualTime {0};  ///< Virtual start time of the next task
+    };
+
+    std::array<Class, TASK_CLASSES> m_classes; ///< Classes, indexed by TaskClass
+    double m_virtualTime;                      ///< Virtual start time of the last task started
+    bool m_stopped;                            ///< Whether the scheduler is stopped
+    mutable std::mutex m_mutex;                ///< Protects the classes and the virtual time
+    std::condition_variable m_cv;              ///< Wakes up the threads when a task is submitted or on stop
+    std::vector<std::thread> m_threads;        ///< Threads of the pool
+
+    /**
+     * @brief Loop of the threads of the pool, runs the tasks until the scheduler is stopped.
+     */
+    void work();
+
+    /**
+     * @brief Picks the class of the next task, the one with the lowest virtual time among the ones that can run.
+     *
+     * @return Class* Class of the next task, null if no class can run a task. Must be called with the mutex held.
+     */
+    Class* next();
+
+public:
+    /**
+     * @brief Construct a new Scheduler object and start its threads.
+     *
+     * @param options Options of the scheduler.
+     * @throw std::runtime_error If there are no threads, or a class has no threads, queue or weight.
+     */
+    explicit Scheduler(const Options& options);
+    ~Scheduler();
+
+    Scheduler(const Scheduler&) = delete;
+    Scheduler& operator=(const Scheduler&) = delete;
+
+    /**
+     * @brief Submit a task to run in the pool.
+     *
+     * @param taskClass Class of the task.
+     * @param task Task to run, its exceptions are logged and discarded.
+     * @return true If the task is queued.
+     * @return false If the queue of the class is full or the scheduler is stopped.
+     */
+    bool trySubmit(TaskClass taskClass, Task task);
+
+    /**
+     * @brief Whether the queue of the class is full, so a task submitted now would be rejected.
+     *
+     * @param taskClass Class to check.
+     */
+    bool full(TaskClass taskClass) const;
+
+    /**
+     * @brief Tasks of the class waiting to run.
+     *
+     * @param taskClass Class to check.
+     */
+    std::size_t size(TaskClass taskClass) const;
+
+    /**
+     * @brief Stop the scheduler, waiting for the running tasks and discarding the queued ones.
+     */
+    void stop();
+};
+
+/**
+ * @brief Class of an API request, from its command.
+ *
+ * The command is found with a scan of the raw request, without parsing the JSON. The commands that carry events are
+ * event work, the metrics, the EPS limiter and the queries of the router, tester and configuration are control, and
+ * the rest, unknown and malformed requests included, are admin.
+ *
+ * @param request API request.
+ * @return TaskClass
+ */
+TaskClass classifyApiRequest(std::string_view request);
+
+} // namespace engineserver
+
+#endif // _SERVER_SCHEDULER_HPP
@@ -0,0 +1,153 @@
+#ifndef _SERVER_SHM_RING_HPP
+#define _SERVER_SHM_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace engineserver::shmring
+{
+/**
+ * @brief Shared-memory ring of events, written by a single producer and read by several consumers.
+ *
+ * @details The ring is a memory file with a Header followed by `capacity` bytes of records. The positions of the
+ * header count the bytes since the ring was created, the offset of a position in the data is `position % capacity`.
+ *
+ * - The producer writes each event as a Record followed by its bytes, padded to RECORD_ALIGNMENT, and publishes it
+ * by advancing `head`. A record that does not fit before the end of the data is written at its start, after a
+ * padding record that fills the end.
+ * - The consumers claim contiguous runs of records by advancing `claim`, read the events in place and mark each
+ * record as done. The done records at `tail` release their space to the producer, in the order they were written.
+ *
+ * The sides sleep on two eventfds, one per direction, and only write them when the other side announced it waits, so
+ * a busy ring has no syscall per event.
+ */
+
+constexpr uint32_t MAGIC {0x57524e47};     ///< Identifies the memory file as a ring ("WRNG")
+constexpr uint32_t VERSION {1};            ///< Version of the layout
+constexpr std::size_t RECORD_ALIGNMENT {8}; ///< Alignment of the records in the data
+
+/**
+ * @brief Flags of a record.
+ */
+enum RecordFlags : uint32_t
+{
+    EVENT = 0,   ///< The record holds an event
+    PADDING = 1, ///< The record fills the end of the data, the next one is at its start
+    DONE = 2     ///< The record was read by a consumer, set by the consumers
+};
+
+/**
+ * @brief Record of the data, followed by `length` bytes.
+ */
+struct Record
+{
+    std::atomic<uint32_t> length; ///< Bytes of the event, or of the padding
+    std::atomic<uint32_t> flags;  ///< RecordFlags
+};
+
+/**
+ * @brief Header of a ring, at the start of the memory file. The positions are on their own cache lines.
+ */
+struct Header
+{
+    uint32_t magic;    ///< MAGIC
+    uint32_t version;  ///< VERSION
+    uint64_t capacity; ///< Bytes of data after the header, a multiple of RECORD_ALIGNMENT
+
+    alignas(64) std::atomic<uint64_t> head; ///< Bytes published by the producer
+    std::atomic<uint32_t> producerWaiting;  ///< The producer sleeps until the consumers release space
+
+    alignas(64) std::atomic<uint64_t> claim; ///< Bytes claimed by the consumers
+    std::atomic<uint32_t> consumersWaiting;  ///< Consumers sleeping until the producer publishes records
+
+    alignas(64) std::atomic<uint64_t> tail; ///< Bytes released by the consumers
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+              "The ring needs lock-free atomics, they are shared between processes");
+
+/**
+ * @brief Get the bytes a record takes in the data.
+ *
+ * @param length Bytes of the event.
+ * @return uint64_t Bytes of the record and its event, aligned.
+ */
+constexpr uint64_t recordSize(uint64_t length)
+{
+    return sizeof(Record) + (length + RECORD_ALIGNMENT - 1) / RECORD_ALIGNMENT * RECORD_ALIGNMENT;
+}
+
+/**
+ * @brief Producer of a ring, connected to a UnixShmRing endpoint.
+ *
+ * @details The endpoint creates a ring for each producer and sends its memory file and eventfds over the socket.
+ * The ring lives until the producer closes the connection, the consumers read the pending events before releasing
+ * it.
+ *
+ * @note A producer is not thread-safe, a process with several writers uses a producer per writer.
+ */
+class Producer
+{
+private:
+    int m_socketFd; ///< Connection to the endpoint, closing it releases the ring
+    int m_dataFd;   ///< Signals the consumers that records were published
+    int m_spaceFd;  ///< Signaled by the consumers when they release space
+    void* m_memory; ///< Mapped memory file
+    std::size_t m_memorySize;
+    Header* m_header;
+    char* m_data;
+    uint64_t m_head; ///< Published position, only written by this producer
+
+    /**
+     * @brief Wait until the consumers released the space to write up to a position.
+     *
+     * @param end Position the next record ends at.
+     * @param timeoutMs Milliseconds to wait, -1 to wait forever.
+     * @return true if there is space.
+     * @throw std::runtime_error if the endpoint closed the connection.
+     */
+    bool waitForSpace(uint64_t end, int timeoutMs);
+
+    /**
+     * @brief Unmap the ring and close the descriptors.
+     */
+    void release();
+
+public:
+    /**
+     * @brief Connect to the endpoint and map the ring it creates.
+     *
+     * @param address Path of the socket of the endpoint.
+     * @throw std::runtime_error if the endpoint cannot be reached or the ring is not valid.
+     */
+    explicit Producer(const std::string& address);
+    ~Producer();
+
+    Producer(const Producer&) = delete;
+    Producer& operator=(const Producer&) = delete;
+
+    /**
+     * @brief Write an event to the ring.
+     *
+     * @param event Event, in the format of the event socket.
+     * @param timeoutMs Milliseconds to wait for space if the ring is full, -1 to wait forever.
+     * @return true if the event was written, false if the ring was still full after the timeout.
+     * @throw std::length_error if the event is larger than maxEventSize.
+     * @throw std::runtime_error if the endpoint closed the connection while the ring was full.
+     */
+    bool push(std::string_view event, int timeoutMs = -1);
+
+    /**
+     * @brief Get the largest event the ring holds, half its data minus the record.
+     *
+     * @return std::size_t Bytes of the largest event.
+     */
+    std::size_t maxEventSize() const;
+};
+
+} // namespace engineserver::shmring
+
+#endif // _SERVER_SHM_RING_HPP
@@ -1,5 +1,6 @@
 #include <server/endpoints/unixDatagram.hpp>
 
+#include <array>
 #include <cstring>      // Unix  socket datagram bind
 #include <fcntl.h>      // Unix socket datagram bind
 #include <sys/socket.h> // Unix socket datagram bind
@@ -12,6 +13,8 @@
 namespace
 {
 constexpr unsigned int MAX_MSG_SIZE {65536 + 512}; ///< Maximum message size (TODO: I think this should be 65507)
+constexpr unsigned int RECV_BATCH_SIZE {16};        ///< Messages received at once by each receive thread
+constexpr long RECV_TIMEOUT_MS {500};               ///< Wake up of the receive threads to check if they must stop
 } // namespace
 
 namespace engineserver::endpoint
@@ -20,11 +23,20 @@ UnixDatagram::UnixDatagram(const std::string& address,
                            const std::function<void(const std::string&)>& callback,
                            std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
                            std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
-                           const std::size_t taskQueueSize)
+                           const std::size_t taskQueueSize,
+                           const std::size_t receiveThreads)
     : Endpoint(address, taskQueueSize)
     , m_callback(callback)
+    , m_batchCallback()
+    , m_filter()
+    , m_histogramSamples(0)
     , m_handle(nullptr)
     , m_bufferSize(-1)
+    , m_receiveThreads(receiveThreads)
+    , m_socketFd(-1)
+    , m_stopThreads(false)
+    , m_threads()
+    , m_stopHandle(nullptr)
 {
     if (address.empty())
     {
@@ -59,16 +71,61 @@ UnixDatagram::UnixDatagram(const std::string& address,
 
 }
 
+UnixDatagram::UnixDatagram(const std::string& address,
+                           const BatchCallback& batchCallback,
+                           std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                           std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                           const std::size_t receiveThreads)
+    : UnixDatagram(
+        address,
+        [batchCallback](const std::string& data) { batchCallback({std::string_view {data}}); },
+        std::move(metricsScope),
+        std::move(metricsScopeDelta),
+        0,
+        receiveThreads)
+{
+    if (!batchCallback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (0 == receiveThreads)
+    {
+        throw std::runtime_error("The batches are only received by receive threads");
+    }
+
+    m_batchCallback = batchCallback;
+}
+
 UnixDatagram::~UnixDatagram()
 {
     if (isBound())
     {
         // Close
-        m_handle->close();
-        m_handle = nullptr;
+        if (m_handle)
+        {
+            m_handle->close();
+            m_handle = nullptr;
+        }
+        if (m_stopHandle)
+        {
+            m_stopHandle->close();
+            m_stopHandle = nullptr;
+        }
         unlink(m_address.c_str());
 
     }
+    stopReceiveThreads();
+}
+
+void UnixDatagram::setFilter(Filter filter)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("The filter must be set before binding the endpoint");
+    }
+
+    m_filter = std::move(filter);
 }
 
 void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
@@ -79,20 +136,62 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
     }
 
     m_loop = loop;
+
+    if (0 < m_receiveThreads)
+    {
+        // The server closes the loop handles when it stops, the receive threads must stop with them
+        m_stopHandle = m_loop->resource<uvw::AsyncHandle>();
+        m_stopHandle->on<uvw::CloseEvent>(
+            [this](const uvw::CloseEvent& event, uvw::AsyncHandle& handle)
+            {
+                stopReceiveThreads();
+                LOG_INFO("[Endpoint: {}] Closed.", m_address);
+            });
+
+        m_socketFd = bindUnixDatagramSocket(m_bufferSize);
+
+        // The threads block on the socket, wake them up periodically as a fallback to check if they must stop
+        timeval timeout {RECV_TIMEOUT_MS / 1000, (RECV_TIMEOUT_MS % 1000) * 1000};
+        if (setsockopt(m_socketFd, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const void*>(&timeout), sizeof(timeout))
+            < 0)
+        {
+            LOG_WARNING(
+                "[Endpoint: {}] Cannot set receive timeout to socket: {} ({})", m_address, strerror(errno), errno);
+        }
+
+        m_stopThreads = false;
+        m_running = true;
+        for (std::size_t i = 0; i < m_receiveThreads; ++i)
+        {
+            m_threads.emplace_back(&UnixDatagram::receiveLoop, this);
+        }
+        return;
+    }
+
     m_handle = m_loop->resource<uvw::UDPHandle>();
 
     // Listen for incoming data
     m_handle->on<uvw::UDPDataEvent>(
         [this](const uvw::UDPDataEvent& event, uvw::UDPHandle& handle)
         {
-            // Get the data
-            auto data = std::string {event.data.get(), event.length};
-
-            // Update metrics
+            // Update metrics, the histograms are sampled
+            const auto sampled {0 == ++m_histogramSamples % HISTOGRAM_SAMPLE_RATE};
             m_metric.m_byteRecv->addValue(event.length);
             m_metric.m_byteRecvPerSecond->addValue(event.length);
             m_metric.m_eventPerSecond->addValue(1UL);
-            m_metric.m_eventSize->recordValue(event.length);
+            if (sampled)
+            {
+                m_metric.m_eventSize->recordValue(event.length);
+            }
+
+            // Discard the filtered messages before copying them
+            if (m_filter && !m_filter(std::string_view {event.data.get(), event.length}))
+            {
+                return;
+            }
+
+            // Get the data
+            auto data = std::string {event.data.get(), event.length};
 
             // Call the callback if is synchronous
             if (0 == m_taskQueueSize)
@@ -118,7 +217,10 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
                 // Update metric
                 m_metric.m_busyQueue->addValue(1UL);
             }
-            m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+            if (sampled)
+            {
+                m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+            }
 
             // Create a job to the worker thread
             std::shared_ptr<std::string> dataPtr {std::make_shared<std::string>(std::move(data))};
@@ -144,8 +246,6 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
                     {
                         LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
                     }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
-
                 });
 
             workerJob->on<uvw::ErrorEvent>(
@@ -158,8 +258,6 @@ void UnixDatagram::bind(std::shared_ptr<uvw::Loop> loop)
                     {
                         LOG_WARNING("[Endpoint: {}] Resume listening.", m_address);
                     }
-                    m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
-
                 });
             workerJob->queue();
         });
@@ -192,8 +290,17 @@ void UnixDatagram::close()
 {
     if (isBound())
     {
-        m_handle->close();
-        m_handle.reset();
+        if (m_handle)
+        {
+            m_handle->close();
+            m_handle.reset();
+        }
+        if (m_stopHandle)
+        {
+            m_stopHandle->close();
+            m_stopHandle.reset();
+        }
+        stopReceiveThreads();
         m_loop.reset();
         m_running = false;
     }
@@ -201,7 +308,8 @@ void UnixDatagram::close()
 
 bool UnixDatagram::pause()
 {
-    if (m_running && isBound())
+    // The receive threads cannot be paused, the callback is called synchronously
+    if (m_running && isBound() && m_handle)
     {
         m_handle->stop();
         m_running = false;
@@ -212,7 +320,7 @@ bool UnixDatagram::pause()
 
 bool UnixDatagram::resume()
 {
-    if (!m_running && isBound())
+    if (!m_running && isBound() && m_handle)
     {
         m_handle->recv();
         m_running = true;
@@ -221,6 +329,140 @@ bool UnixDatagram::resume()
     return false;
 }
 
+void UnixDatagram::receiveLoop()
+{
+    // Unix datagram sockets cannot be balanced with SO_REUSEPORT, all the threads read the same socket
+    std::vector<char> buffers(RECV_BATCH_SIZE * MAX_MSG_SIZE);
+    std::array<iovec, RECV_BATCH_SIZE> iovecs {};
+    std::array<mmsghdr, RECV_BATCH_SIZE> msgs {};
+    for (unsigned int i = 0; i < RECV_BATCH_SIZE; ++i)
+    {
+        iovecs[i].iov_base = buffers.data() + i * MAX_MSG_SIZE;
+        iovecs[i].iov_len = MAX_MSG_SIZE;
+        msgs[i].msg_hdr.msg_iov = &iovecs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    std::vector<std::string_view> batch;
+    batch.reserve(RECV_BATCH_SIZE);
+    std::size_t samples {0};
+
+    while (!m_stopThreads.load(std::memory_order_relaxed))
+    {
+        // Block until a message is available, then take all the queued ones up to the batch size
+        const int received {recvmmsg(m_socketFd, msgs.data(), RECV_BATCH_SIZE, MSG_WAITFORONE, nullptr)};
+        if (0 > received)
+        {
+            if (EINTR == errno || EAGAIN == errno || EWOULDBLOCK == errno)
+            {
+                continue;
+            }
+            if (!m_stopThreads.load(std::memory_order_relaxed))
+            {
+                LOG_WARNING("[Endpoint: {}] Cannot receive messages: {} ({})", m_address, strerror(errno), errno);
+            }
+            break;
+        }
+
+        // The socket was shut down
+        if (0 == received)
+        {
+            break;
+        }
+
+        // Update metrics once per batch, the histogram is sampled
+        uint64_t bytes {0};
+        for (int i = 0; i < received; ++i)
+        {
+            const auto length = msgs[i].msg_len;
+            bytes += length;
+            if (0 == ++samples % HISTOGRAM_SAMPLE_RATE)
+            {
+                m_metric.m_eventSize->recordValue(length);
+            }
+        }
+        m_metric.m_byteRecv->addValue(bytes);
+        m_metric.m_byteRecvPerSecond->addValue(bytes);
+        m_metric.m_eventPerSecond->addValue(static_cast<uint64_t>(received));
+
+        // Hand over the batch in place
+        if (m_batchCallback)
+        {
+            batch.clear();
+            for (int i = 0; i < received; ++i)
+            {
+                const std::string_view message {static_cast<const char*>(iovecs[i].iov_base), msgs[i].msg_len};
+                if (!m_filter || m_filter(message))
+                {
+                    batch.push_back(message);
+                }
+            }
+            if (batch.empty())
+            {
+                continue;
+            }
+
+            try
+            {
+                m_batchCallback(batch);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+            continue;
+        }
+
+        for (int i = 0; i < received; ++i)
+        {
+            const std::string_view message {static_cast<const char*>(iovecs[i].iov_base), msgs[i].msg_len};
+            if (m_filter && !m_filter(message))
+            {
+                continue;
+            }
+
+            auto data = std::string {message};
+            try
+            {
+                m_callback(data);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+            }
+        }
+    }
+}
+
+void UnixDatagram::stopReceiveThreads()
+{
+    if (m_threads.empty() && 0 > m_socketFd)
+    {
+        return;
+    }
+
+    m_stopThreads = true;
+    if (0 <= m_socketFd)
+    {
+        // Wake up the threads blocked on the socket
+        ::shutdown(m_socketFd, SHUT_RDWR);
+    }
+
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+    m_threads.clear();
+
+    if (0 <= m_socketFd)
+    {
+        ::close(m_socketFd);
+        m_socketFd = -1;
+    }
+}
+
 int UnixDatagram::bindUnixDatagramSocket(int& bufferSize)
 {
     sockaddr_un n_us {};
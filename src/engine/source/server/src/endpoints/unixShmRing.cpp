@@ -0,0 +1,688 @@
+#include <server/endpoints/unixShmRing.hpp>
+
+#include <cstring>
+#include <fcntl.h>
+#include <limits>
+#include <new>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <base/logging.hpp>
+#include <uvw.hpp>
+
+namespace
+{
+constexpr std::size_t MIN_RING_SIZE {64 * 1024}; ///< Smallest ring, it holds events of up to half of it
+constexpr std::size_t RING_BATCH_SIZE {64};      ///< Records claimed at once by each thread
+constexpr int WAIT_TIMEOUT_MS {500};             ///< Wake up of the threads to check if they must stop
+constexpr std::size_t SPIN_CHECKS {2048};        ///< Checks of an empty ring before sleeping on its eventfd
+
+/**
+ * @brief Signal an eventfd, the counter is only used as a wake up.
+ */
+void signal(int fd)
+{
+    const uint64_t one {1};
+    while (0 > ::write(fd, &one, sizeof(one)) && EINTR == errno)
+    {
+    }
+}
+
+/**
+ * @brief Reset an eventfd after a wake up.
+ */
+void clear(int fd)
+{
+    uint64_t count {};
+    [[maybe_unused]] const auto bytes = ::read(fd, &count, sizeof(count));
+}
+
+/**
+ * @brief Get the record at a position, if it is within the data and ends before a limit.
+ *
+ * The producer shares the memory, so the records are checked each time they are read, against the capacity the
+ * endpoint created the ring with.
+ *
+ * @return const shmring::Record* The record, nullptr if it is out of bounds.
+ */
+engineserver::shmring::Record*
+recordAt(const char* data, uint64_t capacity, uint64_t position, uint64_t limit, uint64_t& size)
+{
+    using namespace engineserver::shmring;
+
+    const auto offset = position % capacity;
+    if (offset + sizeof(Record) > capacity)
+    {
+        return nullptr;
+    }
+
+    auto* record = reinterpret_cast<Record*>(const_cast<char*>(data) + offset);
+    size = recordSize(record->length.load(std::memory_order_relaxed));
+    if (offset + size > capacity || position + size > limit)
+    {
+        return nullptr;
+    }
+
+    return record;
+}
+} // namespace
+
+namespace engineserver::endpoint
+{
+UnixShmRing::Ring::~Ring()
+{
+    if (nullptr != memory)
+    {
+        munmap(memory, memorySize);
+    }
+    for (const auto fd : {connectionFd, memoryFd, dataFd, spaceFd})
+    {
+        if (0 <= fd)
+        {
+            ::close(fd);
+        }
+    }
+}
+
+UnixShmRing::UnixShmRing(const std::string& address,
+                         const BatchCallback& callback,
+                         std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
+                         std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
+                         const std::size_t ringSize,
+                         const std::size_t receiveThreads)
+    : Endpoint(address, 0)
+    , m_callback(callback)
+    , m_filter()
+    , m_ringSize(ringSize / shmring::RECORD_ALIGNMENT * shmring::RECORD_ALIGNMENT)
+    , m_receiveThreads(receiveThreads)
+    , m_socketFd(-1)
+    , m_wakeFd(-1)
+    , m_stopThreads(false)
+    , m_acceptThread()
+    , m_rings()
+    , m_stopHandle(nullptr)
+{
+    if (address.empty())
+    {
+        throw std::runtime_error("Address must not be empty");
+    }
+
+    if (address.length() >= sizeof(sockaddr_un::sun_path))
+    {
+        auto msg = fmt::format("Path '{}' too long, maximum length is {} ", address, sizeof(sockaddr_un::sun_path));
+        throw std::runtime_error(msg);
+    }
+
+    if (m_address[0] != '/')
+    {
+        throw std::runtime_error("Address must start with '/'");
+    }
+
+    if (!callback)
+    {
+        throw std::runtime_error("Callback must be set");
+    }
+
+    if (0 == receiveThreads)
+    {
+        throw std::runtime_error("The rings must be read by at least one thread");
+    }
+
+    // The length of a record is 32 bits
+    if (MIN_RING_SIZE > m_ringSize || std::numeric_limits<uint32_t>::max() < m_ringSize)
+    {
+        throw std::runtime_error(fmt::format("The ring size must be between {} and {} bytes",
+                                             MIN_RING_SIZE,
+                                             std::numeric_limits<uint32_t>::max()));
+    }
+
+    m_metric.m_metricsScope = std::move(metricsScope);
+    m_metric.m_byteRecv = m_metric.m_metricsScope->getCounterUInteger("BytesReceived");
+    m_metric.m_eventSize = m_metric.m_metricsScope->getHistogramUInteger("EventSizeHistory");
+
+    m_metric.m_metricsScopeDelta = std::move(metricsScopeDelta);
+    m_metric.m_byteRecvPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("BytesReceivedPerSeconds");
+    m_metric.m_eventPerSecond = m_metric.m_metricsScopeDelta->getCounterUInteger("EventsReceivedPerSeconds");
+}
+
+UnixShmRing::~UnixShmRing()
+{
+    if (m_stopHandle)
+    {
+        m_stopHandle->close();
+        m_stopHandle = nullptr;
+    }
+    stopThreads();
+}
+
+void UnixShmRing::setFilter(Filter filter)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("The filter must be set before binding the endpoint");
+    }
+
+    m_filter = std::move(filter);
+}
+
+void UnixShmRing::bind(std::shared_ptr<uvw::Loop> loop)
+{
+    if (isBound())
+    {
+        throw std::runtime_error("Endpoint already bound");
+    }
+
+    m_socketFd = bindUnixStreamSocket();
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (0 > m_wakeFd)
+    {
+        auto msg = fmt::format("Cannot create the eventfd of '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(m_socketFd);
+        m_socketFd = -1;
+        unlink(m_address.c_str());
+        throw std::runtime_error(msg);
+    }
+
+    m_loop = loop;
+
+    // The server closes the loop handles when it stops, the threads must stop with them
+    m_stopHandle = m_loop->resource<uvw::AsyncHandle>();
+    m_stopHandle->on<uvw::CloseEvent>(
+        [this](const uvw::CloseEvent& event, uvw::AsyncHandle& handle)
+        {
+            stopThreads();
+            LOG_INFO("[Endpoint: {}] Closed.", m_address);
+        });
+
+    m_stopThreads = false;
+    m_running = true;
+    m_acceptThread = std::thread(&UnixShmRing::acceptLoop, this);
+}
+
+void UnixShmRing::close()
+{
+    if (isBound())
+    {
+        if (m_stopHandle)
+        {
+            m_stopHandle->close();
+            m_stopHandle.reset();
+        }
+        stopThreads();
+        m_loop.reset();
+        m_running = false;
+    }
+}
+
+void UnixShmRing::acceptLoop()
+{
+    std::vector<pollfd> pfds;
+    while (!m_stopThreads.load(std::memory_order_relaxed))
+    {
+        // The listening socket, the wake up and the connection of each producer, in the order of the rings
+        pfds.clear();
+        pfds.push_back({m_socketFd, POLLIN, 0});
+        pfds.push_back({m_wakeFd, POLLIN, 0});
+        for (const auto& ring : m_rings)
+        {
+            pfds.push_back({ring->connectionFd, POLLIN, 0});
+        }
+
+        const auto ready = poll(pfds.data(), pfds.size(), WAIT_TIMEOUT_MS);
+        if (0 > ready)
+        {
+            if (EINTR == errno)
+            {
+                continue;
+            }
+            LOG_WARNING("[Endpoint: {}] Cannot wait for the producers: {} ({})", m_address, strerror(errno), errno);
+            break;
+        }
+
+        if (0 != pfds[1].revents)
+        {
+            clear(m_wakeFd);
+        }
+
+        // Release the rings of the producers that disconnected, once their pending events are read
+        auto pfd = pfds.begin() + 2;
+        for (auto it = m_rings.begin(); it != m_rings.end(); ++pfd)
+        {
+            auto& ring = **it;
+            if (0 != pfd->revents)
+            {
+                char byte {};
+                const auto bytes = recv(ring.connectionFd, &byte, sizeof(byte), MSG_DONTWAIT);
+                if (0 == bytes || (0 > bytes && EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno))
+                {
+                    ring.draining = true;
+                }
+            }
+
+            if (!ring.draining && !ring.broken)
+            {
+                ++it;
+                continue;
+            }
+
+            // Wake up the threads sleeping on the ring, the eventfd is left signaled until they stop
+            signal(ring.dataFd);
+            for (auto& thread : ring.threads)
+            {
+                thread.join();
+            }
+            if (ring.broken)
+            {
+                LOG_WARNING("[Endpoint: {}] A producer corrupted its ring, it was disconnected.", m_address);
+            }
+            else
+            {
+                LOG_DEBUG("[Endpoint: {}] A producer disconnected, its ring was released.", m_address);
+            }
+            it = m_rings.erase(it);
+        }
+
+        if (0 != pfds[0].revents)
+        {
+            const int connectionFd {accept4(m_socketFd, nullptr, nullptr, SOCK_CLOEXEC)};
+            if (0 > connectionFd)
+            {
+                if (EINTR != errno && EAGAIN != errno && EWOULDBLOCK != errno && ECONNABORTED != errno)
+                {
+                    LOG_WARNING(
+                        "[Endpoint: {}] Cannot accept a producer: {} ({})", m_address, strerror(errno), errno);
+                }
+                continue;
+            }
+
+            if (MAX_PRODUCERS <= m_rings.size())
+            {
+                LOG_WARNING("[Endpoint: {}] Producer rejected, there are already {} producers.",
+                            m_address,
+                            MAX_PRODUCERS);
+                ::close(connectionFd);
+                continue;
+            }
+
+            try
+            {
+                openRing(connectionFd);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("[Endpoint: {}] Cannot create the ring of a producer: {}", m_address, e.what());
+            }
+        }
+    }
+}
+
+void UnixShmRing::openRing(int connectionFd)
+{
+    auto ring = std::make_unique<Ring>();
+    ring->connectionFd = connectionFd;
+
+    // The memory file is sealed, so the producer cannot shrink it under the mapping of the endpoint
+    ring->memoryFd = memfd_create("wazuh-engine-events", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    ring->memorySize = sizeof(shmring::Header) + m_ringSize;
+    if (0 > ring->memoryFd || 0 > ftruncate(ring->memoryFd, static_cast<off_t>(ring->memorySize))
+        || 0 > fcntl(ring->memoryFd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL))
+    {
+        throw std::runtime_error(fmt::format("Cannot create the memory file: {} ({})", strerror(errno), errno));
+    }
+
+    auto* memory = mmap(nullptr, ring->memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, ring->memoryFd, 0);
+    if (MAP_FAILED == memory)
+    {
+        throw std::runtime_error(fmt::format("Cannot map the memory file: {} ({})", strerror(errno), errno));
+    }
+    ring->memory = memory;
+    ring->header = new (memory) shmring::Header {};
+    ring->header->magic = shmring::MAGIC;
+    ring->header->version = shmring::VERSION;
+    ring->header->capacity = m_ringSize;
+    ring->capacity = m_ringSize;
+    ring->data = static_cast<const char*>(memory) + sizeof(shmring::Header);
+
+    ring->dataFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    ring->spaceFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (0 > ring->dataFd || 0 > ring->spaceFd)
+    {
+        throw std::runtime_error(fmt::format("Cannot create the eventfds: {} ({})", strerror(errno), errno));
+    }
+
+    // Send the memory file and the eventfds, in the order shmring::Producer expects them
+    const int fds[] {ring->memoryFd, ring->dataFd, ring->spaceFd};
+    char payload {'R'};
+    iovec iov {&payload, sizeof(payload)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(fds))] {};
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    auto* cmsg = CMSG_FIRSTHDR(&msg);
+    cmsg->cmsg_level = SOL_SOCKET;
+    cmsg->cmsg_type = SCM_RIGHTS;
+    cmsg->cmsg_len = CMSG_LEN(sizeof(fds));
+    std::memcpy(CMSG_DATA(cmsg), fds, sizeof(fds));
+
+    ssize_t sent {};
+    do
+    {
+        sent = sendmsg(connectionFd, &msg, MSG_NOSIGNAL);
+    } while (0 > sent && EINTR == errno);
+    if (0 > sent)
+    {
+        throw std::runtime_error(fmt::format("Cannot send the ring: {} ({})", strerror(errno), errno));
+    }
+
+    // The mapping keeps the memory, the producer has its own descriptor
+    ::close(ring->memoryFd);
+    ring->memoryFd = -1;
+
+    for (std::size_t i = 0; i < m_receiveThreads; ++i)
+    {
+        ring->threads.emplace_back(&UnixShmRing::consumeLoop, this, std::ref(*ring));
+    }
+    m_rings.push_back(std::move(ring));
+    LOG_DEBUG("[Endpoint: {}] A producer connected, ring of {} bytes.", m_address, m_ringSize);
+}
+
+bool UnixShmRing::claimRecords(Ring& ring, uint64_t& begin, uint64_t& end)
+{
+    auto& header = *ring.header;
+    begin = header.claim.load(std::memory_order_acquire);
+    while (true)
+    {
+        const auto head = header.head.load(std::memory_order_acquire);
+        if (head == begin)
+        {
+            return false;
+        }
+
+        // Take the published records up to the batch size, a consumer that claims them first makes the run stale
+        bool valid {head > begin && head - begin <= ring.capacity};
+        end = begin;
+        for (std::size_t records = 0; valid && end < head && records < RING_BATCH_SIZE; ++records)
+        {
+            uint64_t size {};
+            valid = nullptr != recordAt(ring.data, ring.capacity, end, head, size);
+            end += size;
+        }
+
+        if (!valid)
+        {
+            const auto claim = header.claim.load(std::memory_order_acquire);
+            if (claim == begin)
+            {
+                ring.broken = true;
+                signal(m_wakeFd);
+                return false;
+            }
+            begin = claim;
+            continue;
+        }
+
+        if (header.claim.compare_exchange_weak(begin, end, std::memory_order_acq_rel, std::memory_order_acquire))
+        {
+            return true;
+        }
+    }
+}
+
+void UnixShmRing::consumeRecords(Ring& ring,
+                                 uint64_t begin,
+                                 uint64_t end,
+                                 std::vector<std::string_view>& batch,
+                                 std::size_t& samples)
+{
+    // The events are handed over in place, their records are released once the callback returns
+    batch.clear();
+    uint64_t bytes {0};
+    uint64_t events {0};
+    for (auto position = begin; position < end;)
+    {
+        uint64_t size {};
+        const auto* record = recordAt(ring.data, ring.capacity, position, end, size);
+        if (nullptr == record)
+        {
+            ring.broken = true;
+            signal(m_wakeFd);
+            return;
+        }
+
+        const auto length = record->length.load(std::memory_order_relaxed);
+        if (0 == (record->flags.load(std::memory_order_relaxed) & shmring::RecordFlags::PADDING) && 0 < length)
+        {
+            const std::string_view event {reinterpret_cast<const char*>(record) + sizeof(shmring::Record), length};
+            bytes += length;
+            ++events;
+            if (0 == ++samples % HISTOGRAM_SAMPLE_RATE)
+            {
+                m_metric.m_eventSize->recordValue(length);
+            }
+            if (!m_filter || m_filter(event))
+            {
+                batch.push_back(event);
+            }
+        }
+        position += size;
+    }
+
+    m_metric.m_byteRecv->addValue(bytes);
+    m_metric.m_byteRecvPerSecond->addValue(bytes);
+    m_metric.m_eventPerSecond->addValue(events);
+
+    if (!batch.empty())
+    {
+        try
+        {
+            m_callback(batch);
+        }
+        catch (const std::exception& e)
+        {
+            LOG_WARNING("[Endpoint: {}] Error calling the callback: {}", m_address, e.what());
+        }
+    }
+
+    for (auto position = begin; position < end;)
+    {
+        uint64_t size {};
+        auto* record = recordAt(ring.data, ring.capacity, position, end, size);
+        if (nullptr == record)
+        {
+            ring.broken = true;
+            signal(m_wakeFd);
+            return;
+        }
+        record->flags.fetch_or(shmring::RecordFlags::DONE, std::memory_order_release);
+        position += size;
+    }
+
+    releaseRecords(ring);
+}
+
+void UnixShmRing::releaseRecords(Ring& ring)
+{
+    auto& header = *ring.header;
+    bool released {false};
+
+    // The records are released in order, a thread stops at the first one still read by another thread
+    auto tail = header.tail.load(std::memory_order_acquire);
+    while (true)
+    {
+        const auto claim = header.claim.load(std::memory_order_acquire);
+        if (tail >= claim)
+        {
+            break;
+        }
+
+        uint64_t size {};
+        const auto* record = recordAt(ring.data, ring.capacity, tail, claim, size);
+        if (nullptr == record || 0 == (record->flags.load(std::memory_order_acquire) & shmring::RecordFlags::DONE))
+        {
+            // A stale tail is checked again, the record was released and rewritten meanwhile
+            const auto current = header.tail.load(std::memory_order_acquire);
+            if (current == tail)
+            {
+                break;
+            }
+            tail = current;
+            continue;
+        }
+
+        if (header.tail.compare_exchange_weak(tail, tail + size, std::memory_order_seq_cst, std::memory_order_acquire))
+        {
+            tail += size;
+            released = true;
+        }
+    }
+
+    if (released && 0 < header.producerWaiting.load(std::memory_order_seq_cst))
+    {
+        signal(ring.spaceFd);
+    }
+}
+
+void UnixShmRing::consumeLoop(Ring& ring)
+{
+    auto& header = *ring.header;
+    std::vector<std::string_view> batch;
+    batch.reserve(RING_BATCH_SIZE);
+    std::size_t samples {0};
+
+    while (!m_stopThreads.load(std::memory_order_relaxed) && !ring.broken.load(std::memory_order_relaxed))
+    {
+        uint64_t begin {};
+        uint64_t end {};
+        if (claimRecords(ring, begin, end))
+        {
+            consumeRecords(ring, begin, end, batch, samples);
+            continue;
+        }
+
+        // Check the producer is gone before the ring is found empty, so the last events are not missed
+        const auto draining = ring.draining.load(std::memory_order_acquire);
+        const auto empty = header.claim.load(std::memory_order_acquire) == header.head.load(std::memory_order_acquire);
+        if (ring.broken.load(std::memory_order_relaxed) || (draining && empty))
+        {
+            break;
+        }
+
+        // A busy producer publishes again shortly, spin for a while so it does not have to signal each record
+        std::size_t spins {0};
+        while (spins < SPIN_CHECKS
+               && header.head.load(std::memory_order_relaxed) == header.claim.load(std::memory_order_relaxed))
+        {
+            ++spins;
+            std::this_thread::yield();
+        }
+        if (spins < SPIN_CHECKS)
+        {
+            continue;
+        }
+
+        // Announce the wait before checking again, a record published after the check then signals the eventfd
+        header.consumersWaiting.fetch_add(1, std::memory_order_seq_cst);
+        if (header.head.load(std::memory_order_seq_cst) == header.claim.load(std::memory_order_acquire))
+        {
+            pollfd pfd {ring.dataFd, POLLIN, 0};
+            if (0 < poll(&pfd, 1, WAIT_TIMEOUT_MS) && !ring.draining && !m_stopThreads)
+            {
+                clear(ring.dataFd);
+            }
+        }
+        header.consumersWaiting.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+void UnixShmRing::stopThreads()
+{
+    if (!m_acceptThread.joinable() && 0 > m_socketFd)
+    {
+        return;
+    }
+
+    m_stopThreads = true;
+    if (0 <= m_wakeFd)
+    {
+        signal(m_wakeFd);
+    }
+    if (m_acceptThread.joinable())
+    {
+        m_acceptThread.join();
+    }
+
+    // The producers see their connection closed, the events left in the rings are lost
+    for (auto& ring : m_rings)
+    {
+        signal(ring->dataFd);
+        for (auto& thread : ring->threads)
+        {
+            thread.join();
+        }
+    }
+    m_rings.clear();
+
+    if (0 <= m_wakeFd)
+    {
+        ::close(m_wakeFd);
+        m_wakeFd = -1;
+    }
+    if (0 <= m_socketFd)
+    {
+        ::close(m_socketFd);
+        m_socketFd = -1;
+        unlink(m_address.c_str());
+    }
+}
+
+int UnixShmRing::bindUnixStreamSocket()
+{
+    sockaddr_un n_us {};
+
+    // Remove the socket file if it already exists
+    unlinkUnixSocket();
+
+    n_us.sun_family = AF_UNIX;
+    strncpy(n_us.sun_path, m_address.c_str(), sizeof(n_us.sun_path) - 1);
+
+    const int socketFd {socket(PF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    if (0 > socketFd)
+    {
+        auto msg = fmt::format("Cannot create the socket '{}': {} ({})", m_address, strerror(errno), errno);
+        throw std::runtime_error(msg);
+    }
+
+    if (::bind(socketFd, reinterpret_cast<sockaddr*>(&n_us), SUN_LEN(&n_us)) < 0)
+    {
+        auto msg = fmt::format("Cannot bind the socket '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(socketFd);
+        throw std::runtime_error(msg);
+    }
+
+    // Change permissions
+    if (chmod(m_address.c_str(), 0660) < 0)
+    {
+        auto msg =
+            fmt::format("Cannot change permissions of the socket '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(socketFd);
+        throw std::runtime_error(msg);
+    }
+
+    if (listen(socketFd, static_cast<int>(MAX_PRODUCERS)) < 0)
+    {
+        auto msg = fmt::format("Cannot listen on the socket '{}': {} ({})", m_address, strerror(errno), errno);
+        ::close(socketFd);
+        throw std::runtime_error(msg);
+    }
+
+    return socketFd;
+}
+
+} // namespace engineserver::endpoint
@@ -13,11 +13,13 @@ UnixStream::UnixStream(const std::string& address,
                        std::shared_ptr<metricsManager::IMetricsScope> metricsScope,
                        std::shared_ptr<metricsManager::IMetricsScope> metricsScopeDelta,
                        const std::size_t taskQueueSize,
-                       std::size_t timeout)
+                       std::size_t timeout,
+                       std::shared_ptr<Scheduler> scheduler)
     : Endpoint(address, taskQueueSize)
     , m_handle(nullptr)
     , m_timeout(timeout)
     , m_factory(std::move(factory))
+    , m_scheduler(std::move(scheduler))
 {
     if (0 == m_timeout)
     {
@@ -64,6 +66,12 @@ UnixStream::UnixStream(const std::string& address,
 UnixStream::~UnixStream()
 {
     close();
+
+    // The tasks of the scheduler refer to the endpoint
+    if (m_scheduler)
+    {
+        m_scheduler->stop();
+    }
 }
 
 void UnixStream::bind(std::shared_ptr<uvw::Loop> loop)
@@ -211,7 +219,7 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
     for (auto& request : requests)
     {
         // No queue worker, process the message in the main thread
-        if (0 == m_taskQueueSize)
+        if (0 == m_taskQueueSize && !m_scheduler)
         {
             auto callbackFn =
                 [wClient, address = m_address, protocolHandler, metric = m_metric](const std::string& response) -> void
@@ -244,7 +252,9 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
             continue;
         }
         // Send the message to the queue worker (#TODO: Should be add the size of the worker?)
-        if (m_currentTaskQueueSize >= m_taskQueueSize)
+        // The scheduler is only submitted to from the loop, so a class that is not full accepts the task
+        const auto taskClass = m_scheduler ? classifyApiRequest(request) : TaskClass::ADMIN;
+        if (m_scheduler ? m_scheduler->full(taskClass) : m_currentTaskQueueSize >= m_taskQueueSize)
         {
             auto responseTimer = base::chrono::Timer();
             LOG_DEBUG("[Endpoint: {}] endpoint: No queue worker available, disarting...", m_address);
@@ -263,14 +273,15 @@ void UnixStream::processMessages(std::weak_ptr<uvw::PipeHandle> wClient,
             continue;
         }
 
-        createAndEnqueueTask(wClient, asyncs, protocolHandler, std::move(request));
+        createAndEnqueueTask(wClient, asyncs, protocolHandler, std::move(request), taskClass);
     }
 }
 
 void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
                                       std::shared_ptr<std::vector<std::weak_ptr<uvw::AsyncHandle>>> asyncs,
                                       std::shared_ptr<ProtocolHandler> protocolHandler,
-                                      std::string&& request)
+                                      std::string&& request,
+                                      TaskClass taskClass)
 {
     ++m_currentTaskQueueSize;
 
@@ -351,6 +362,38 @@ void UnixStream::createAndEnqueueTask(std::weak_ptr<uvw::PipeHandle> wClient,
         async->send();
     };
 
+    // Run the request in the scheduler
+    if (m_scheduler)
+    {
+        const auto submitted = m_scheduler->trySubmit(
+            taskClass,
+            [request = std::move(request),
+             callbackFn,
+             protocolHandler,
+             address = m_address,
+             metric = m_metric,
+             &currentTaskQueueSize = m_currentTaskQueueSize]()
+            {
+                try
+                {
+                    protocolHandler->onMessage(request, callbackFn);
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("[Endpoint: {}] endpoint: Error processing message: {}", address, e.what());
+                }
+                --currentTaskQueueSize;
+                metric.m_queueSize->recordValue(currentTaskQueueSize.load());
+            });
+        if (!submitted)
+        {
+            LOG_WARNING("[Endpoint: {}] endpoint: Scheduler stopped, discarding message", m_address);
+            --m_currentTaskQueueSize;
+        }
+        m_metric.m_queueSize->recordValue(m_currentTaskQueueSize.load());
+        return;
+    }
+
     // Create a new queue worker for the request
     auto work = m_loop->resource<uvw::WorkReq>([request, callbackFn, protocolHandler, address = m_address]()
                                                { protocolHandler->onMessage(request, callbackFn); });
@@ -1,5 +1,6 @@
 #include <server/protocolHandlers/wStream.hpp>
 
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 
@@ -15,36 +16,73 @@ std::optional<std::vector<std::string>> WStream::onData(std::string_view data)
 {
     std::vector<std::string> messages;
 
-    for (auto c : data)
+    while (!data.empty())
     {
         if (m_stage == Stage::HEADER)
         {
-            m_header.push_back(c);
-            if (m_header.size() == m_headerSize)
+            // The header may be split among reads
+            const auto headerBytes = std::min(data.size(), static_cast<std::size_t>(m_headerSize) - m_header.size());
+            m_header.append(data.data(), headerBytes);
+            data.remove_prefix(headerBytes);
+            if (m_header.size() < static_cast<std::size_t>(m_headerSize))
             {
-                std::memcpy(&m_pending, m_header.data(), m_headerSize);
-                if (m_pending > maxPayloadSize)
-                {
-                    auto msg = fmt::format(
-                        "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
-                    reset();
-                    throw std::runtime_error(msg);
-                }
-                m_stage = Stage::PAYLOAD;
+                break;
             }
+
+            std::memcpy(&m_pending, m_header.data(), m_headerSize);
+            m_header.clear();
+            if (m_pending > maxPayloadSize)
+            {
+                auto msg = fmt::format(
+                    "Payload size [{} bytes] exceeded the maximum allowed [{} bytes]", m_pending, maxPayloadSize);
+                reset();
+                throw std::runtime_error(msg);
+            }
+            if (m_pending < 0)
+            {
+                auto msg = fmt::format("Invalid payload size [{} bytes]", m_pending);
+                reset();
+                throw std::runtime_error(msg);
+            }
+
+            if (0 == m_pending)
+            {
+                messages.emplace_back();
+                continue;
+            }
+            m_stage = Stage::PAYLOAD;
         }
         else
         {
-            m_payload.push_back(c);
-            if (m_payload.size() == m_pending)
+            const auto missing = static_cast<std::size_t>(m_pending) - m_payload.size();
+
+            // The whole payload is in the buffer, the message is copied from it at once
+            if (m_payload.empty() && data.size() >= missing)
             {
-                messages.push_back(m_payload);
-                m_payload.clear();
-                m_header.clear();
+                messages.emplace_back(data.substr(0, missing));
+                data.remove_prefix(missing);
                 m_stage = Stage::HEADER;
+                continue;
+            }
+
+            if (m_payload.empty())
+            {
+                m_payload.reserve(m_pending);
             }
+            const auto payloadBytes = std::min(data.size(), missing);
+            m_payload.append(data.data(), payloadBytes);
+            data.remove_prefix(payloadBytes);
+            if (m_payload.size() < static_cast<std::size_t>(m_pending))
+            {
+                break;
+            }
+
+            messages.push_back(std::move(m_payload));
+            m_payload = std::string {};
+            m_stage = Stage::HEADER;
         }
     }
+
     return messages.empty() ? std::nullopt : std::optional<std::vector<std::string>>(std::move(messages));
 }
 
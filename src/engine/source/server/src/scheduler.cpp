@@ -0,0 +1,225 @@
+#include <server/scheduler.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace engineserver
+{
+
+Scheduler::Scheduler(const Options& options)
+    : m_virtualTime(0)
+    , m_stopped(false)
+{
+    if (0 == options.threads)
+    {
+        throw std::runtime_error("Scheduler threads must be greater than 0");
+    }
+
+    for (std::size_t i = 0; i < TASK_CLASSES; ++i)
+    {
+        const auto& classOptions = options.classes[i];
+        if (0 == classOptions.threads || 0 == classOptions.queueSize || 0 == classOptions.weight)
+        {
+            throw std::runtime_error(
+                fmt::format("Scheduler class {} threads, queue size and weight must be greater than 0", i));
+        }
+        m_classes[i].options = classOptions;
+    }
+
+    m_threads.reserve(options.threads);
+    for (std::size_t i = 0; i < options.threads; ++i)
+    {
+        m_threads.emplace_back(&Scheduler::work, this);
+    }
+}
+
+Scheduler::~Scheduler()
+{
+    stop();
+}
+
+Scheduler::Class* Scheduler::next()
+{
+    Class* selected = nullptr;
+    for (auto& cls : m_classes)
+    {
+        if (!cls.queue.empty() && cls.running < cls.options.threads
+            && (selected == nullptr || cls.virtualTime < selected->virtualTime))
+        {
+            selected = &cls;
+        }
+    }
+
+    return selected;
+}
+
+void Scheduler::work()
+{
+    std::unique_lock lock(m_mutex);
+    while (true)
+    {
+        Class* cls = nullptr;
+        m_cv.wait(lock, [this, &cls]() { return m_stopped || (cls = next()) != nullptr; });
+        if (m_stopped)
+        {
+            return;
+        }
+
+        auto task = std::move(cls->queue.front());
+        cls->queue.pop_front();
+        ++cls->running;
+        m_virtualTime = cls->virtualTime;
+        cls->virtualTime += 1.0 / static_cast<double>(cls->options.weight);
+
+        lock.unlock();
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            LOG_ERROR("Scheduler: Error running task: {}", e.what());
+        }
+        lock.lock();
+
+        // The class may have been capped, another thread may be waiting for it
+        --cls->running;
+        if (!cls->queue.empty())
+        {
+            m_cv.notify_one();
+        }
+    }
+}
+
+bool Scheduler::trySubmit(TaskClass taskClass, Task task)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        auto& cls = m_classes[static_cast<std::size_t>(taskClass)];
+        if (m_stopped || cls.queue.size() >= cls.options.queueSize)
+        {
+            return false;
+        }
+
+        // A class that was idle starts at the current virtual time, it does not keep the time it did not use
+        if (cls.queue.empty())
+        {
+            cls.virtualTime = std::max(cls.virtualTime, m_virtualTime);
+        }
+        cls.queue.push_back(std::move(task));
+    }
+
+    m_cv.notify_one();
+    return true;
+}
+
+bool Scheduler::full(TaskClass taskClass) const
+{
+    std::lock_guard lock(m_mutex);
+    const auto& cls = m_classes[static_cast<std::size_t>(taskClass)];
+    return m_stopped || cls.queue.size() >= cls.options.queueSize;
+}
+
+std::size_t Scheduler::size(TaskClass taskClass) const
+{
+    std::lock_guard lock(m_mutex);
+    return m_classes[static_cast<std::size_t>(taskClass)].queue.size();
+}
+
+void Scheduler::stop()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        if (m_stopped)
+        {
+            return;
+        }
+        m_stopped = true;
+        for (auto& cls : m_classes)
+        {
+            cls.queue.clear();
+        }
+    }
+
+    m_cv.notify_all();
+    for (auto& thread : m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+namespace
+{
+/**
+ * @brief Class of the commands that start with the prefix, the first rule that matches wins.
+ */
+struct ClassRule
+{
+    std::string_view prefix; ///< Prefix of the command
+    TaskClass taskClass;     ///< Class of the command
+};
+
+constexpr std::array<ClassRule, 11> API_CLASSES {{
+    {"router.queue/post", TaskClass::EVENT},
+    {"tester.run/post", TaskClass::EVENT},
+    {"tester.batch/post", TaskClass::EVENT},
+    {"metrics.", TaskClass::CONTROL},
+    {"router.eps/", TaskClass::CONTROL},
+    {"router.route/get", TaskClass::CONTROL},
+    {"router.table/get", TaskClass::CONTROL},
+    {"tester.session/get", TaskClass::CONTROL},
+    {"tester.table/get", TaskClass::CONTROL},
+    {"config.runtime/get", TaskClass::CONTROL},
+    {"policy.namespaces/get", TaskClass::CONTROL},
+}};
+
+/**
+ * @brief Finds the value of the command field of the request, empty if it is not found.
+ */
+std::string_view findCommand(std::string_view request)
+{
+    constexpr std::string_view FIELD {"\"command\""};
+    const auto fieldPos = request.find(FIELD);
+    if (fieldPos == std::string_view::npos)
+    {
+        return {};
+    }
+
+    auto pos = request.find_first_not_of(" \t\r\n", fieldPos + FIELD.size());
+    if (pos == std::string_view::npos || request[pos] != ':')
+    {
+        return {};
+    }
+    pos = request.find_first_not_of(" \t\r\n", pos + 1);
+    if (pos == std::string_view::npos || request[pos] != '"')
+    {
+        return {};
+    }
+
+    const auto end = request.find('"', pos + 1);
+    return end == std::string_view::npos ? std::string_view {} : request.substr(pos + 1, end - pos - 1);
+}
+} // namespace
+
+TaskClass classifyApiRequest(std::string_view request)
+{
+    const auto command = findCommand(request);
+    for (const auto& rule : API_CLASSES)
+    {
+        if (command.substr(0, rule.prefix.size()) == rule.prefix)
+        {
+            return rule.taskClass;
+        }
+    }
+
+    return TaskClass::ADMIN;
+}
+
+} // namespace engineserver
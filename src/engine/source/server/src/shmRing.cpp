@@ -0,0 +1,259 @@
+#include <server/shmRing.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <fmt/format.h>
+
+namespace
+{
+constexpr std::size_t HANDSHAKE_FDS {3}; ///< Memory file, data eventfd and space eventfd
+
+/**
+ * @brief Receive the descriptors of the ring sent by the endpoint.
+ */
+std::array<int, HANDSHAKE_FDS> receiveRingFds(int socketFd)
+{
+    char payload {};
+    iovec iov {&payload, sizeof(payload)};
+    alignas(cmsghdr) char control[CMSG_SPACE(sizeof(int) * HANDSHAKE_FDS)] {};
+
+    msghdr msg {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    ssize_t received {};
+    do
+    {
+        received = recvmsg(socketFd, &msg, MSG_CMSG_CLOEXEC);
+    } while (0 > received && EINTR == errno);
+
+    if (0 >= received)
+    {
+        throw std::runtime_error(
+            fmt::format("The endpoint did not send the ring: {}", 0 > received ? strerror(errno) : "closed"));
+    }
+
+    const auto* cmsg = CMSG_FIRSTHDR(&msg);
+    if (nullptr == cmsg || SOL_SOCKET != cmsg->cmsg_level || SCM_RIGHTS != cmsg->cmsg_type
+        || CMSG_LEN(sizeof(int) * HANDSHAKE_FDS) != cmsg->cmsg_len)
+    {
+        throw std::runtime_error("The endpoint sent an invalid ring handshake");
+    }
+
+    std::array<int, HANDSHAKE_FDS> fds {};
+    std::memcpy(fds.data(), CMSG_DATA(cmsg), sizeof(int) * HANDSHAKE_FDS);
+    return fds;
+}
+
+/**
+ * @brief Signal an eventfd, the counter is only used as a wake up.
+ */
+void signal(int fd)
+{
+    const uint64_t one {1};
+    while (0 > ::write(fd, &one, sizeof(one)) && EINTR == errno)
+    {
+    }
+}
+} // namespace
+
+namespace engineserver::shmring
+{
+Producer::Producer(const std::string& address)
+    : m_socketFd(-1)
+    , m_dataFd(-1)
+    , m_spaceFd(-1)
+    , m_memory(MAP_FAILED)
+    , m_memorySize(0)
+    , m_header(nullptr)
+    , m_data(nullptr)
+    , m_head(0)
+{
+    sockaddr_un addr {};
+    if (address.length() >= sizeof(addr.sun_path))
+    {
+        throw std::runtime_error(
+            fmt::format("Path '{}' too long, maximum length is {}", address, sizeof(addr.sun_path)));
+    }
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, address.c_str(), sizeof(addr.sun_path) - 1);
+
+    m_socketFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (0 > m_socketFd)
+    {
+        throw std::runtime_error(fmt::format("Cannot create the socket: {} ({})", strerror(errno), errno));
+    }
+
+    try
+    {
+        if (0 > connect(m_socketFd, reinterpret_cast<sockaddr*>(&addr), SUN_LEN(&addr)))
+        {
+            throw std::runtime_error(
+                fmt::format("Cannot connect to the ring endpoint '{}': {} ({})", address, strerror(errno), errno));
+        }
+
+        const auto [memoryFd, dataFd, spaceFd] = receiveRingFds(m_socketFd);
+        m_dataFd = dataFd;
+        m_spaceFd = spaceFd;
+
+        struct stat memoryStat
+        {
+        };
+        if (0 > fstat(memoryFd, &memoryStat) || sizeof(Header) > static_cast<std::size_t>(memoryStat.st_size))
+        {
+            ::close(memoryFd);
+            throw std::runtime_error("The memory file of the ring is not valid");
+        }
+
+        m_memorySize = static_cast<std::size_t>(memoryStat.st_size);
+        m_memory = mmap(nullptr, m_memorySize, PROT_READ | PROT_WRITE, MAP_SHARED, memoryFd, 0);
+        ::close(memoryFd);
+        if (MAP_FAILED == m_memory)
+        {
+            throw std::runtime_error(fmt::format("Cannot map the ring: {} ({})", strerror(errno), errno));
+        }
+
+        m_header = static_cast<Header*>(m_memory);
+        if (MAGIC != m_header->magic || VERSION != m_header->version
+            || sizeof(Header) + m_header->capacity != m_memorySize)
+        {
+            throw std::runtime_error("The ring sent by the endpoint is not valid or has another version");
+        }
+        m_data = static_cast<char*>(m_memory) + sizeof(Header);
+        m_head = m_header->head.load(std::memory_order_acquire);
+    }
+    catch (...)
+    {
+        release();
+        throw;
+    }
+}
+
+Producer::~Producer()
+{
+    release();
+}
+
+void Producer::release()
+{
+    if (MAP_FAILED != m_memory)
+    {
+        munmap(m_memory, m_memorySize);
+        m_memory = MAP_FAILED;
+    }
+    for (auto* fd : {&m_dataFd, &m_spaceFd, &m_socketFd})
+    {
+        if (0 <= *fd)
+        {
+            ::close(*fd);
+            *fd = -1;
+        }
+    }
+}
+
+std::size_t Producer::maxEventSize() const
+{
+    // Half the data, so the record fits whatever the offset it starts at once the ring is empty
+    return m_header->capacity / 2 - sizeof(Record);
+}
+
+bool Producer::waitForSpace(uint64_t end, int timeoutMs)
+{
+    const auto& capacity = m_header->capacity;
+    if (end - m_header->tail.load(std::memory_order_acquire) <= capacity)
+    {
+        return true;
+    }
+
+    // Announce the wait before checking again, a release after the check then signals the eventfd
+    m_header->producerWaiting.store(1, std::memory_order_seq_cst);
+    bool hasSpace {false};
+    while (true)
+    {
+        if (end - m_header->tail.load(std::memory_order_seq_cst) <= capacity)
+        {
+            hasSpace = true;
+            break;
+        }
+
+        // The endpoint closes the connection when it stops, the consumers will not release more space
+        std::array<pollfd, 2> pfds {{{m_spaceFd, POLLIN, 0}, {m_socketFd, POLLIN, 0}}};
+        const auto ready = poll(pfds.data(), pfds.size(), timeoutMs);
+        if (0 > ready && EINTR == errno)
+        {
+            continue;
+        }
+        if (0 >= ready)
+        {
+            break;
+        }
+        if (0 != pfds[1].revents)
+        {
+            m_header->producerWaiting.store(0, std::memory_order_relaxed);
+            throw std::runtime_error("The ring endpoint closed the connection");
+        }
+
+        uint64_t count {};
+        [[maybe_unused]] const auto bytes = ::read(m_spaceFd, &count, sizeof(count));
+    }
+    m_header->producerWaiting.store(0, std::memory_order_relaxed);
+
+    return hasSpace || end - m_header->tail.load(std::memory_order_acquire) <= capacity;
+}
+
+bool Producer::push(std::string_view event, int timeoutMs)
+{
+    if (event.size() > maxEventSize())
+    {
+        throw std::length_error(
+            fmt::format("Event of {} bytes, the ring holds events of up to {} bytes", event.size(), maxEventSize()));
+    }
+
+    const auto capacity = m_header->capacity;
+    const auto size = recordSize(event.size());
+    const auto offset = m_head % capacity;
+    const auto contiguous = capacity - offset;
+    const auto padding = size > contiguous ? contiguous : 0;
+
+    if (!waitForSpace(m_head + padding + size, timeoutMs))
+    {
+        return false;
+    }
+
+    auto position = m_head;
+    if (0 < padding)
+    {
+        auto* record = reinterpret_cast<Record*>(m_data + offset);
+        record->length.store(static_cast<uint32_t>(padding - sizeof(Record)), std::memory_order_relaxed);
+        record->flags.store(RecordFlags::PADDING, std::memory_order_relaxed);
+        position += padding;
+    }
+
+    auto* record = reinterpret_cast<Record*>(m_data + position % capacity);
+    record->length.store(static_cast<uint32_t>(event.size()), std::memory_order_relaxed);
+    record->flags.store(RecordFlags::EVENT, std::memory_order_relaxed);
+    std::memcpy(reinterpret_cast<char*>(record) + sizeof(Record), event.data(), event.size());
+    m_head = position + size;
+
+    // Publish the records, then wake up the consumers only if any sleeps
+    m_header->head.store(m_head, std::memory_order_seq_cst);
+    if (0 < m_header->consumersWaiting.load(std::memory_order_seq_cst))
+    {
+        signal(m_dataFd);
+    }
+
+    return true;
+}
+
+} // namespace engineserver::shmring
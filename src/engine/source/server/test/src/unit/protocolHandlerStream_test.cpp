@@ -1,3 +1,5 @@
+#include <cstring>
+
 #include <gtest/gtest.h>
 
 #include "server/protocolHandlers/wStream.hpp"
@@ -68,6 +70,60 @@ TEST_F(WStreamTest, onDataProcessingPartialData)
     EXPECT_EQ((*result2)[0], "HELLO WORLD");
 }
 
+TEST_F(WStreamTest, onDataProcessingManyMessages)
+{
+    std::string data;
+    for (const auto& payload : {"HELLO", "WORLD", "!"})
+    {
+        data += uintToLittleEndianBytes(std::strlen(payload)) + payload;
+    }
+    // Start of the next message
+    data += uintToLittleEndianBytes(4) + "NE";
+
+    auto result = wstream.onData(data);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 3);
+    EXPECT_EQ((*result)[0], "HELLO");
+    EXPECT_EQ((*result)[1], "WORLD");
+    EXPECT_EQ((*result)[2], "!");
+
+    auto result2 = wstream.onData("XT");
+
+    ASSERT_TRUE(result2.has_value());
+    ASSERT_EQ(result2->size(), 1);
+    EXPECT_EQ((*result2)[0], "NEXT");
+}
+
+TEST_F(WStreamTest, onDataProcessingSplitHeader)
+{
+    std::string payload("HELLO WORLD");
+    std::string data = uintToLittleEndianBytes(payload.size()) + payload;
+
+    // One byte at a time
+    for (std::size_t i = 0; i < data.size() - 1; ++i)
+    {
+        ASSERT_FALSE(wstream.onData(data.substr(i, 1)).has_value());
+    }
+    auto result = wstream.onData(data.substr(data.size() - 1));
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 1);
+    EXPECT_EQ((*result)[0], "HELLO WORLD");
+}
+
+TEST_F(WStreamTest, onDataProcessingEmptyPayload)
+{
+    std::string data = uintToLittleEndianBytes(0) + uintToLittleEndianBytes(5) + "HELLO";
+
+    auto result = wstream.onData(data);
+
+    ASSERT_TRUE(result.has_value());
+    ASSERT_EQ(result->size(), 2);
+    EXPECT_EQ((*result)[0], "");
+    EXPECT_EQ((*result)[1], "HELLO");
+}
+
 TEST_F(WStreamTest, onMessageProcessing)
 {
     std::string response;
@@ -117,3 +173,14 @@ TEST_F(WStreamTest, onDataPayloadSizeExceeded)
     std::string data("\x00\xA0\x96\x01", 4); // Exceeded size encoded in 4 bytes
     EXPECT_THROW(wstream2.onData(data), std::runtime_error);
 }
+
+TEST_F(WStreamTest, onDataNegativePayloadSize)
+{
+    std::string data = uintToLittleEndianBytes(0xFFFFFFFF);
+    EXPECT_THROW(wstream.onData(data), std::runtime_error);
+
+    // The stream is reset after the error
+    auto result = wstream.onData(uintToLittleEndianBytes(5) + "HELLO");
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ((*result)[0], "HELLO");
+}
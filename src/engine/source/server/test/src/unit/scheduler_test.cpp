@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <base/logging.hpp>
+#include <server/scheduler.hpp>
+
+using namespace engineserver;
+
+namespace
+{
+Scheduler::Options makeOptions(std::size_t threads, std::size_t classThreads, std::size_t queueSize)
+{
+    Scheduler::Options options;
+    options.threads = threads;
+    options.classes.fill({classThreads, queueSize, 1});
+    return options;
+}
+
+Scheduler::ClassOptions& classOf(Scheduler::Options& options, TaskClass taskClass)
+{
+    return options.classes[static_cast<std::size_t>(taskClass)];
+}
+
+// Waits until the condition holds, fails after a second
+template<typename Condition>
+void waitFor(Condition condition)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+    while (!condition())
+    {
+        ASSERT_LT(std::chrono::steady_clock::now(), deadline) << "Condition not reached";
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+} // namespace
+
+class SchedulerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+};
+
+TEST_F(SchedulerTest, InvalidOptions)
+{
+    ASSERT_THROW(Scheduler(makeOptions(0, 1, 1)), std::runtime_error);
+    ASSERT_THROW(Scheduler(makeOptions(1, 0, 1)), std::runtime_error);
+    ASSERT_THROW(Scheduler(makeOptions(1, 1, 0)), std::runtime_error);
+
+    auto options = makeOptions(1, 1, 1);
+    classOf(options, TaskClass::EVENT).weight = 0;
+    ASSERT_THROW(Scheduler {options}, std::runtime_error);
+}
+
+TEST_F(SchedulerTest, RunsTasks)
+{
+    Scheduler scheduler(makeOptions(2, 2, 16));
+    std::atomic<std::size_t> done {0};
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(scheduler.trySubmit(TaskClass::CONTROL, [&done]() { ++done; }));
+        ASSERT_TRUE(scheduler.trySubmit(TaskClass::EVENT, [&done]() { ++done; }));
+    }
+
+    waitFor([&done]() { return done == 20; });
+}
+
+TEST_F(SchedulerTest, TaskErrorDoesNotStopThread)
+{
+    Scheduler scheduler(makeOptions(1, 1, 4));
+    std::atomic<bool> done {false};
+
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN, []() { throw std::runtime_error("task error"); }));
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN, [&done]() { done = true; }));
+
+    waitFor([&done]() { return done.load(); });
+}
+
+TEST_F(SchedulerTest, QueueLimitPerClass)
+{
+    Scheduler scheduler(makeOptions(1, 1, 2));
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    std::atomic<bool> started {false};
+
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN,
+                                    [gateFuture, &started]()
+                                    {
+                                        started = true;
+                                        gateFuture.wait();
+                                    }));
+    waitFor([&started]() { return started.load(); });
+
+    // The running task does not count, the queue holds two more
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN, []() {}));
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN, []() {}));
+    ASSERT_TRUE(scheduler.full(TaskClass::ADMIN));
+    ASSERT_FALSE(scheduler.trySubmit(TaskClass::ADMIN, []() {}));
+    ASSERT_EQ(scheduler.size(TaskClass::ADMIN), 2);
+
+    // Other classes have their own queue
+    ASSERT_FALSE(scheduler.full(TaskClass::CONTROL));
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::CONTROL, []() {}));
+
+    gate.set_value();
+    waitFor([&scheduler]() { return scheduler.size(TaskClass::ADMIN) == 0; });
+}
+
+TEST_F(SchedulerTest, ClassThreadsLimit)
+{
+    // The admin class runs one task at once, the control class gets the other thread
+    auto options = makeOptions(2, 2, 8);
+    classOf(options, TaskClass::ADMIN).threads = 1;
+    Scheduler scheduler(options);
+
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    std::atomic<std::size_t> adminStarted {0};
+    std::atomic<bool> controlDone {false};
+
+    for (auto i = 0; i < 2; ++i)
+    {
+        ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN,
+                                        [gateFuture, &adminStarted]()
+                                        {
+                                            ++adminStarted;
+                                            gateFuture.wait();
+                                        }));
+    }
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::CONTROL, [&controlDone]() { controlDone = true; }));
+
+    waitFor([&controlDone]() { return controlDone.load(); });
+    ASSERT_EQ(adminStarted, 1);
+    ASSERT_EQ(scheduler.size(TaskClass::ADMIN), 1);
+
+    gate.set_value();
+    waitFor([&adminStarted]() { return adminStarted == 2; });
+}
+
+TEST_F(SchedulerTest, WeightedFairness)
+{
+    auto options = makeOptions(1, 1, 16);
+    classOf(options, TaskClass::CONTROL).weight = 3;
+    Scheduler scheduler(options);
+
+    // Hold the only thread until both classes are queued
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    std::atomic<bool> started {false};
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::ADMIN,
+                                    [gateFuture, &started]()
+                                    {
+                                        started = true;
+                                        gateFuture.wait();
+                                    }));
+    waitFor([&started]() { return started.load(); });
+
+    std::mutex mutex;
+    std::vector<TaskClass> order;
+    for (auto i = 0; i < 8; ++i)
+    {
+        for (auto taskClass : {TaskClass::CONTROL, TaskClass::EVENT})
+        {
+            ASSERT_TRUE(scheduler.trySubmit(taskClass,
+                                            [&mutex, &order, taskClass]()
+                                            {
+                                                std::lock_guard lock(mutex);
+                                                order.push_back(taskClass);
+                                            }));
+        }
+    }
+
+    gate.set_value();
+    waitFor(
+        [&mutex, &order]()
+        {
+            std::lock_guard lock(mutex);
+            return order.size() == 16;
+        });
+
+    // Three control tasks for each event task while both are queued
+    const auto control = std::count(order.begin(), order.begin() + 8, TaskClass::CONTROL);
+    ASSERT_EQ(control, 6);
+}
+
+TEST_F(SchedulerTest, StopDiscardsQueuedTasks)
+{
+    Scheduler scheduler(makeOptions(1, 1, 4));
+    std::promise<void> gate;
+    auto gateFuture = gate.get_future().share();
+    std::atomic<bool> started {false};
+    std::atomic<bool> discarded {true};
+
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::EVENT,
+                                    [gateFuture, &started]()
+                                    {
+                                        started = true;
+                                        gateFuture.wait();
+                                    }));
+    ASSERT_TRUE(scheduler.trySubmit(TaskClass::EVENT, [&discarded]() { discarded = false; }));
+    waitFor([&started]() { return started.load(); });
+
+    std::thread stopper([&scheduler]() { scheduler.stop(); });
+    waitFor([&scheduler]() { return scheduler.full(TaskClass::CONTROL); });
+    gate.set_value();
+    stopper.join();
+
+    ASSERT_TRUE(discarded);
+    ASSERT_FALSE(scheduler.trySubmit(TaskClass::CONTROL, []() {}));
+}
+
+TEST_F(SchedulerTest, ClassifyApiRequest)
+{
+    ASSERT_EQ(classifyApiRequest(R"({"version":1,"command":"router.queue/post","parameters":{}})"), TaskClass::EVENT);
+    ASSERT_EQ(classifyApiRequest(R"({"command" : "tester.run/post"})"), TaskClass::EVENT);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"metrics.manager/dump"})"), TaskClass::CONTROL);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"router.eps/update"})"), TaskClass::CONTROL);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"router.table/get"})"), TaskClass::CONTROL);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"catalog.resource/post"})"), TaskClass::ADMIN);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"policy.asset/post"})"), TaskClass::ADMIN);
+    ASSERT_EQ(classifyApiRequest(R"({"command":"unknown"})"), TaskClass::ADMIN);
+    ASSERT_EQ(classifyApiRequest(R"({"command":1})"), TaskClass::ADMIN);
+    ASSERT_EQ(classifyApiRequest("Hello, World!"), TaskClass::ADMIN);
+}
@@ -5,6 +5,8 @@
 #include <condition_variable>
 #include <filesystem>
 #include <mutex>
+#include <set>
+#include <string_view>
 #include <thread>
 
 #include <sys/socket.h>
@@ -441,3 +443,143 @@ TEST_F(UnixDatagramTest, StopWhenBufferIsFull)
     close(clientFD);
     loopThread.join();
 }
+
+TEST_F(UnixDatagramTest, ReceiveThreads)
+{
+    constexpr std::size_t numMessages = 100;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::size_t receivedMessages = 0;
+
+    UnixDatagram endpoint(
+        socketPath,
+        [&](const std::string& data)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ++receivedMessages;
+            cv.notify_one();
+        },
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        0,
+        4);
+    endpoint.bind(loop);
+    ASSERT_TRUE(endpoint.isBound());
+
+    // The receive threads cannot be paused
+    ASSERT_FALSE(endpoint.pause());
+    ASSERT_FALSE(endpoint.resume());
+
+    int fd = getSendFD(socketPath);
+    for (std::size_t i = 0; i < numMessages; ++i)
+    {
+        sendUnixDatagram(fd, "Hello, Unix Datagram! " + std::to_string(i));
+    }
+    close(fd);
+
+    // The messages are received without running the loop
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(
+            lock, std::chrono::seconds(5), [&]() { return receivedMessages == numMessages; }));
+    }
+
+    ASSERT_NO_THROW(endpoint.close());
+    ASSERT_FALSE(endpoint.isBound());
+    loop->run<uvw::Loop::Mode::ONCE>();
+}
+
+TEST_F(UnixDatagramTest, ReceiveBatches)
+{
+    constexpr std::size_t numMessages = 100;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::set<std::string> receivedMessages;
+
+    ASSERT_THROW(UnixDatagram(socketPath,
+                              UnixDatagram::BatchCallback {[](const std::vector<std::string_view>&) {}},
+                              std::make_shared<FakeMetricScope>(),
+                              std::make_shared<FakeMetricScope>(),
+                              0),
+                 std::runtime_error);
+
+    UnixDatagram endpoint(
+        socketPath,
+        UnixDatagram::BatchCallback {[&](const std::vector<std::string_view>& batch)
+                                     {
+                                         std::lock_guard<std::mutex> lock(mutex);
+                                         for (const auto message : batch)
+                                         {
+                                             receivedMessages.emplace(message);
+                                         }
+                                         cv.notify_one();
+                                     }},
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        2);
+    endpoint.bind(loop);
+    ASSERT_TRUE(endpoint.isBound());
+
+    int fd = getSendFD(socketPath);
+    for (std::size_t i = 0; i < numMessages; ++i)
+    {
+        sendUnixDatagram(fd, "Hello, Unix Datagram! " + std::to_string(i));
+    }
+    close(fd);
+
+    // Every message is handed over once, with its content
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(
+            lock, std::chrono::seconds(5), [&]() { return receivedMessages.size() == numMessages; }));
+        ASSERT_EQ(receivedMessages.count("Hello, Unix Datagram! 42"), 1);
+    }
+
+    ASSERT_NO_THROW(endpoint.close());
+    loop->run<uvw::Loop::Mode::ONCE>();
+}
+
+TEST_F(UnixDatagramTest, FilterBeforeBatching)
+{
+    constexpr std::size_t numMessages = 100;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::set<std::string> receivedMessages;
+
+    UnixDatagram endpoint(
+        socketPath,
+        UnixDatagram::BatchCallback {[&](const std::vector<std::string_view>& batch)
+                                     {
+                                         std::lock_guard<std::mutex> lock(mutex);
+                                         for (const auto message : batch)
+                                         {
+                                             receivedMessages.emplace(message);
+                                         }
+                                         cv.notify_one();
+                                     }},
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        2);
+    endpoint.setFilter([](std::string_view message) { return message.front() == '1'; });
+    endpoint.bind(loop);
+    ASSERT_THROW(endpoint.setFilter({}), std::runtime_error);
+
+    int fd = getSendFD(socketPath);
+    for (std::size_t i = 0; i < numMessages; ++i)
+    {
+        sendUnixDatagram(fd, std::to_string(i % 2 + 1) + ":location:" + std::to_string(i));
+    }
+    close(fd);
+
+    // Only the accepted messages are handed over
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ASSERT_TRUE(cv.wait_for(
+            lock, std::chrono::seconds(5), [&]() { return receivedMessages.size() == numMessages / 2; }));
+        ASSERT_EQ(receivedMessages.count("1:location:42"), 1);
+        ASSERT_EQ(receivedMessages.count("2:location:43"), 0);
+    }
+
+    ASSERT_NO_THROW(endpoint.close());
+    loop->run<uvw::Loop::Mode::ONCE>();
+}
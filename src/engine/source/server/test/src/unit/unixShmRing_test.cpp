@@ -0,0 +1,264 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string_view>
+#include <thread>
+
+#include <unistd.h>
+
+#include <uvw.hpp>
+
+#include "fakeMetric.hpp"
+#include <base/logging.hpp>
+#include <server/endpoints/unixShmRing.hpp>
+#include <server/shmRing.hpp>
+
+using namespace engineserver::endpoint;
+using engineserver::shmring::Producer;
+
+namespace
+{
+constexpr std::size_t RING_SIZE {64 * 1024};
+
+std::filesystem::path uniquePath()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << pid << "_" << tid; // Unique path per thread and process
+    return std::filesystem::path("/tmp") / (ss.str() + "_unixShmRing_test.sock");
+}
+} // namespace
+
+class UnixShmRingTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<uvw::Loop> loop;
+    std::string socketPath;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::multiset<std::string> received;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        socketPath = uniquePath().c_str();
+        loop = uvw::Loop::create();
+    }
+
+    void TearDown() override
+    {
+        loop->close();
+        unlink(socketPath.c_str());
+    }
+
+    UnixShmRing::BatchCallback collector()
+    {
+        return [this](const std::vector<std::string_view>& batch)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto event : batch)
+            {
+                received.emplace(event);
+            }
+            cv.notify_one();
+        };
+    }
+
+    bool waitForEvents(std::size_t count)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_for(lock, std::chrono::seconds(5), [&]() { return received.size() == count; });
+    }
+};
+
+TEST_F(UnixShmRingTest, InvalidOptions)
+{
+    auto metric = std::make_shared<FakeMetricScope>();
+    ASSERT_THROW(UnixShmRing("", collector(), metric, metric, RING_SIZE, 1), std::runtime_error);
+    ASSERT_THROW(UnixShmRing("relative.sock", collector(), metric, metric, RING_SIZE, 1), std::runtime_error);
+    ASSERT_THROW(UnixShmRing(socketPath, {}, metric, metric, RING_SIZE, 1), std::runtime_error);
+    ASSERT_THROW(UnixShmRing(socketPath, collector(), metric, metric, RING_SIZE, 0), std::runtime_error);
+    ASSERT_THROW(UnixShmRing(socketPath, collector(), metric, metric, 1024, 1), std::runtime_error);
+}
+
+TEST_F(UnixShmRingTest, BindAndClose)
+{
+    UnixShmRing endpoint(socketPath,
+                         collector(),
+                         std::make_shared<FakeMetricScope>(),
+                         std::make_shared<FakeMetricScope>(),
+                         RING_SIZE,
+                         1);
+    ASSERT_FALSE(endpoint.isBound());
+    ASSERT_NO_THROW(endpoint.bind(loop));
+    ASSERT_TRUE(endpoint.isBound());
+    ASSERT_TRUE(std::filesystem::exists(socketPath));
+    ASSERT_THROW(endpoint.bind(loop), std::runtime_error);
+
+    // The rings cannot be paused
+    ASSERT_FALSE(endpoint.pause());
+    ASSERT_FALSE(endpoint.resume());
+
+    ASSERT_NO_THROW(endpoint.close());
+    ASSERT_FALSE(endpoint.isBound());
+    ASSERT_FALSE(std::filesystem::exists(socketPath));
+
+    // Nobody listens once closed
+    ASSERT_THROW(Producer {socketPath}, std::runtime_error);
+}
+
+TEST_F(UnixShmRingTest, ReceiveEvents)
+{
+    // More events than the ring holds, so the producer waits for the consumers and the records wrap around
+    constexpr std::size_t numEvents = 20000;
+    UnixShmRing endpoint(socketPath,
+                         collector(),
+                         std::make_shared<FakeMetricScope>(),
+                         std::make_shared<FakeMetricScope>(),
+                         RING_SIZE,
+                         4);
+    endpoint.bind(loop);
+
+    {
+        Producer producer(socketPath);
+        for (std::size_t i = 0; i < numEvents; ++i)
+        {
+            ASSERT_TRUE(producer.push("1:location:event " + std::to_string(i)));
+        }
+        ASSERT_TRUE(waitForEvents(numEvents));
+    }
+
+    // Every event is handed over once, with its content
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(received.count("1:location:event 0"), 1);
+        ASSERT_EQ(received.count("1:location:event 12345"), 1);
+        ASSERT_EQ(received.count("1:location:event 19999"), 1);
+    }
+
+    ASSERT_NO_THROW(endpoint.close());
+}
+
+TEST_F(UnixShmRingTest, EventsLargerThanADatagram)
+{
+    constexpr std::size_t ringSize = 256 * 1024;
+    UnixShmRing endpoint(
+        socketPath, collector(), std::make_shared<FakeMetricScope>(), std::make_shared<FakeMetricScope>(), ringSize, 1);
+    endpoint.bind(loop);
+
+    Producer producer(socketPath);
+    ASSERT_EQ(producer.maxEventSize(), ringSize / 2 - sizeof(engineserver::shmring::Record));
+    ASSERT_THROW(producer.push(std::string(producer.maxEventSize() + 1, 'x')), std::length_error);
+
+    const std::string large(100 * 1024, 'x');
+    for (std::size_t i = 0; i < 10; ++i)
+    {
+        ASSERT_TRUE(producer.push(large));
+    }
+    ASSERT_TRUE(waitForEvents(10));
+    ASSERT_EQ(received.count(large), 10);
+
+    ASSERT_NO_THROW(endpoint.close());
+}
+
+TEST_F(UnixShmRingTest, PushTimesOutWhileFull)
+{
+    std::mutex blocked;
+    std::unique_lock<std::mutex> block(blocked);
+    UnixShmRing endpoint(
+        socketPath,
+        UnixShmRing::BatchCallback {[&](const std::vector<std::string_view>&)
+                                    { std::lock_guard<std::mutex> lock(blocked); }},
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        RING_SIZE,
+        1);
+    endpoint.bind(loop);
+
+    // The consumer is stuck in the callback, the ring fills up
+    Producer producer(socketPath);
+    const std::string event(1024, 'x');
+    bool pushed {true};
+    for (std::size_t i = 0; pushed && i < 2 * RING_SIZE / event.size(); ++i)
+    {
+        pushed = producer.push(event, 10);
+    }
+    ASSERT_FALSE(pushed);
+
+    // The space is released once the consumer resumes
+    block.unlock();
+    ASSERT_TRUE(producer.push(event, 5000));
+
+    ASSERT_NO_THROW(endpoint.close());
+}
+
+TEST_F(UnixShmRingTest, DrainOnDisconnect)
+{
+    constexpr std::size_t numEvents = 500;
+    UnixShmRing endpoint(
+        socketPath,
+        UnixShmRing::BatchCallback {[&, callback = collector()](const std::vector<std::string_view>& batch)
+                                    {
+                                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                                        callback(batch);
+                                    }},
+        std::make_shared<FakeMetricScope>(),
+        std::make_shared<FakeMetricScope>(),
+        1024 * 1024,
+        2);
+    endpoint.bind(loop);
+
+    // The producer leaves before the events are read, they are read anyway
+    {
+        Producer producer(socketPath);
+        for (std::size_t i = 0; i < numEvents; ++i)
+        {
+            ASSERT_TRUE(producer.push("1:location:event " + std::to_string(i)));
+        }
+    }
+    ASSERT_TRUE(waitForEvents(numEvents));
+
+    // A new producer gets a new ring
+    Producer producer(socketPath);
+    ASSERT_TRUE(producer.push("1:location:again"));
+    ASSERT_TRUE(waitForEvents(numEvents + 1));
+
+    ASSERT_NO_THROW(endpoint.close());
+}
+
+TEST_F(UnixShmRingTest, FilterBeforeBatching)
+{
+    constexpr std::size_t numEvents = 100;
+    UnixShmRing endpoint(socketPath,
+                         collector(),
+                         std::make_shared<FakeMetricScope>(),
+                         std::make_shared<FakeMetricScope>(),
+                         RING_SIZE,
+                         2);
+    endpoint.setFilter([](std::string_view event) { return event.front() == '1'; });
+    endpoint.bind(loop);
+    ASSERT_THROW(endpoint.setFilter({}), std::runtime_error);
+
+    Producer producer(socketPath);
+    for (std::size_t i = 0; i < numEvents; ++i)
+    {
+        ASSERT_TRUE(producer.push(std::to_string(i % 2 + 1) + ":location:" + std::to_string(i)));
+    }
+
+    // Only the accepted events are handed over
+    ASSERT_TRUE(waitForEvents(numEvents / 2));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ASSERT_EQ(received.count("1:location:42"), 1);
+        ASSERT_EQ(received.count("2:location:43"), 0);
+    }
+
+    ASSERT_NO_THROW(endpoint.close());
+}
@@ -567,6 +567,84 @@ TEST_F(UnixStreamTest, QueueWorker_SameClient)
     thread.join();
 }
 
+TEST_F(UnixStreamTest, Scheduler_SameClient)
+{
+
+    // Queue of the scheduler, the messages are not API requests so they are all admin
+    const std::size_t taskQueueSize = 16;
+    Scheduler::Options options;
+    options.threads = 2;
+    options.classes.fill({2, taskQueueSize, 1});
+    auto scheduler = std::make_shared<Scheduler>(options);
+
+    // Configure UnixStream server
+    UnixStream server(m_socketPath,
+                      m_factory,
+                      std::make_shared<FakeMetricScope>(),
+                      std::make_shared<FakeMetricScope>(),
+                      0,
+                      5000,
+                      scheduler);
+    server.bind(m_loop);
+    auto [stopHandler, thread] = startLoopThread(m_loop);
+    const auto maxAttempts = 10;
+
+    // Create and connect Unix domain socket client
+    int clientSockfd = createUnixSocketClient(m_socketPath);
+
+    // Send messages taskQueueSize messages to the server
+    std::string expectedResponse {};
+    for (std::size_t i = 0; i < taskQueueSize; ++i)
+    {
+        std::string message = "Hello, World! ";
+        message += std::to_string(i);
+        message += "<END>";
+        auto res = send(clientSockfd, message.c_str(), message.size(), 0);
+        ASSERT_EQ(res, message.size());
+        expectedResponse += message;
+    }
+
+    // Wait for the messages to be processed
+    auto attempts = 0;
+    while (*(m_factory->m_processedMessages) < taskQueueSize)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ASSERT_LT(attempts++, maxAttempts) << "Messages not processed";
+    }
+
+    // Read the responses from the client
+    std::string response {};
+    attempts = 0;
+
+    while (response.length() < expectedResponse.length())
+    {
+        ASSERT_LT(attempts++, maxAttempts) << "Messages not received from client";
+        char buffer[1024] = {};
+        // Non-blocking read
+        ssize_t received = recv(clientSockfd, buffer, sizeof(buffer), MSG_DONTWAIT);
+        if (received == 0)
+        {
+            // Connection closed
+            FAIL() << "Connection closed";
+        }
+        if (received == -1)
+        {
+            // No data available
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+        ASSERT_GT(received, 0);
+        response.append(buffer, received);
+    };
+
+    // Check the responses (order is not guaranteed, so we check the length)
+    ASSERT_EQ(expectedResponse.length(), response.length());
+
+    server.close();
+    stopHandler->send();
+    thread.join();
+}
+
 TEST_F(UnixStreamTest, QueueWorker_multiplesClient)
 {
 
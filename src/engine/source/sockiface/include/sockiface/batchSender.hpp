@@ -0,0 +1,102 @@
+#ifndef _SOCKIFACE_BATCHSENDER_HPP
+#define _SOCKIFACE_BATCHSENDER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <metrics/iMetricsScope.hpp>
+#include <sockiface/isockHandler.hpp>
+
+namespace sockiface
+{
+
+/**
+ * @brief Queue of messages sent in batches to a socket.
+ *
+ * The queued messages are sent with ISockHandler::sendMsgs once the queue reaches the batch size or the oldest message
+ * waited the maximum delay, whatever happens first. The pending messages are sent when the object is destroyed.
+ *
+ * The queue can be bounded, so a stalled socket does not make it grow without limit: the messages pushed while it is
+ * full are dropped. The queued, dropped and failed messages and the backlog are reported to the metrics scope, if any.
+ *
+ * @note The results of the sends are not reported to the producers, the failed messages are logged and discarded.
+ */
+class BatchSender
+{
+private:
+    std::shared_ptr<ISockHandler> m_handler;          ///< Handler of the socket
+    const std::size_t m_batchSize;                    ///< Messages that trigger a send
+    const std::chrono::milliseconds m_maxDelay;       ///< Maximum time a message waits in the queue
+    const std::size_t m_maxQueued;                    ///< Messages that make the queue drop the new ones, 0 for none
+    std::mutex m_mutex;                               ///< Protects the queue
+    std::mutex m_sendMutex;                           ///< Serializes the sends of the flusher thread and flush
+    std::condition_variable m_cv;                     ///< Wakes up the flusher thread
+    std::vector<std::string> m_queue;                 ///< Messages waiting to be sent
+    std::chrono::steady_clock::time_point m_deadline; ///< Time to send the oldest queued message
+    bool m_stop;                                      ///< Request the flusher thread to stop
+    std::thread m_flusher;                            ///< Sends the batches
+
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_queued;  ///< Messages queued
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_dropped; ///< Messages dropped because the queue was full
+    std::shared_ptr<metricsManager::iCounter<uint64_t>> m_failed;  ///< Messages that could not be sent
+    std::shared_ptr<metricsManager::iCounter<int64_t>> m_backlog;  ///< Messages waiting to be sent
+
+    /**
+     * @brief Send the queued batches until the object is destroyed.
+     */
+    void flusherLoop();
+
+    /**
+     * @brief Send a batch of messages, logging the failed ones.
+     *
+     * @param batch messages to send.
+     */
+    void sendBatch(const std::vector<std::string>& batch);
+
+public:
+    /**
+     * @brief Construct a new Batch Sender.
+     *
+     * @param handler handler of the socket, it must not be used by others while the sender is alive.
+     * @param batchSize number of queued messages that trigger a send.
+     * @param maxDelay maximum time a message waits in the queue before it is sent.
+     * @param maxQueued number of queued messages from which the new ones are dropped, 0 to never drop.
+     * @param metrics scope where the counters of the sender are reported, may be null.
+     * @throw std::invalid_argument if the handler is null, the batch size is 0 or the queue is smaller than a batch.
+     */
+    BatchSender(std::shared_ptr<ISockHandler> handler,
+                std::size_t batchSize,
+                std::chrono::milliseconds maxDelay,
+                std::size_t maxQueued = 0,
+                const std::shared_ptr<metricsManager::IMetricsScope>& metrics = nullptr);
+
+    /**
+     * @brief Send the pending messages and destroy the object.
+     */
+    ~BatchSender();
+
+    BatchSender(const BatchSender&) = delete;
+    BatchSender& operator=(const BatchSender&) = delete;
+
+    /**
+     * @brief Queue a message to be sent in the next batch, it never waits for the socket.
+     *
+     * @param msg message to send.
+     * @return true if the message was queued, false if it was dropped because the queue is full.
+     */
+    bool push(std::string msg);
+
+    /**
+     * @brief Send the queued messages now, in the calling thread.
+     */
+    void flush();
+};
+
+} // namespace sockiface
+
+#endif // _SOCKIFACE_BATCHSENDER_HPP
@@ -35,6 +35,13 @@ public:
     */
     SendRetval sendMsg(const std::string& msg) override;
 
+    /**
+     * @copydoc ISockHandler::sendMsgs
+     *
+     * The valid messages are sent with sendmmsg, a system call for the whole batch.
+     */
+    std::vector<SendRetval> sendMsgs(const std::vector<std::string>& msgs) override;
+
     /**
      * @copydoc ISockHandler::recvMsg
     */
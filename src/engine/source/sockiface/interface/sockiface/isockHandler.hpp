@@ -97,6 +97,29 @@ public:
      */
     virtual SendRetval sendMsg(const std::string& msg) = 0;
 
+    /**
+     * @brief Send a batch of messages to the socket. Open the socket if it is not already open.
+     *
+     * Each message is validated and sent as in \ref sendMsg, the implementations may send the whole batch with a
+     * single system call.
+     *
+     * @param msgs messages to send.
+     * @return std::vector<SendRetval> result of each message, in the same order as msgs.
+     *
+     * @throws std::runtime_error if not connected and the socket cannot be connected.
+     * @throws recoverableError if a broken pipe error occurs (EPIPE). The messages after the failed one are not sent.
+     */
+    virtual std::vector<SendRetval> sendMsgs(const std::vector<std::string>& msgs)
+    {
+        std::vector<SendRetval> results;
+        results.reserve(msgs.size());
+        for (const auto& msg : msgs)
+        {
+            results.push_back(sendMsg(msg));
+        }
+        return results;
+    }
+
     /**
      * @brief  Receive a message from the socket.
      *
@@ -0,0 +1,185 @@
+#include "batchSender.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include <base/logging.hpp>
+
+namespace sockiface
+{
+
+BatchSender::BatchSender(std::shared_ptr<ISockHandler> handler,
+                         std::size_t batchSize,
+                         std::chrono::milliseconds maxDelay,
+                         std::size_t maxQueued,
+                         const std::shared_ptr<metricsManager::IMetricsScope>& metrics)
+    : m_handler(std::move(handler))
+    , m_batchSize(batchSize)
+    , m_maxDelay(maxDelay)
+    , m_maxQueued(maxQueued)
+    , m_queue()
+    , m_deadline()
+    , m_stop(false)
+{
+    if (!m_handler)
+    {
+        throw std::invalid_argument("The socket handler cannot be null");
+    }
+
+    if (0 == m_batchSize)
+    {
+        throw std::invalid_argument("The batch size must be greater than 0");
+    }
+
+    if (0 != m_maxQueued && m_maxQueued < m_batchSize)
+    {
+        throw std::invalid_argument("The queue size cannot be smaller than the batch size");
+    }
+
+    if (metrics)
+    {
+        m_queued = metrics->getCounterUInteger("Queued");
+        m_dropped = metrics->getCounterUInteger("Dropped");
+        m_failed = metrics->getCounterUInteger("SendFailed");
+        m_backlog = metrics->getUpDownCounterInteger("Backlog");
+    }
+
+    m_queue.reserve(m_batchSize);
+    m_flusher = std::thread(&BatchSender::flusherLoop, this);
+}
+
+BatchSender::~BatchSender()
+{
+    {
+        std::lock_guard lock {m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_one();
+    m_flusher.join();
+}
+
+bool BatchSender::push(std::string msg)
+{
+    bool notify {false};
+    {
+        std::lock_guard lock {m_mutex};
+        if (0 != m_maxQueued && m_queue.size() >= m_maxQueued)
+        {
+            if (m_dropped)
+            {
+                m_dropped->addValue(1);
+            }
+            return false;
+        }
+
+        const auto first = m_queue.empty();
+        if (first)
+        {
+            m_deadline = std::chrono::steady_clock::now() + m_maxDelay;
+        }
+        m_queue.push_back(std::move(msg));
+
+        // The first message arms the deadline of the flusher thread, a full batch is sent right away
+        notify = first || m_queue.size() >= m_batchSize;
+    }
+
+    if (m_queued)
+    {
+        m_queued->addValue(1);
+        m_backlog->addValue(1);
+    }
+
+    if (notify)
+    {
+        m_cv.notify_one();
+    }
+
+    return true;
+}
+
+void BatchSender::flush()
+{
+    std::vector<std::string> batch;
+    {
+        std::lock_guard lock {m_mutex};
+        batch.swap(m_queue);
+        m_queue.reserve(m_batchSize);
+    }
+    sendBatch(batch);
+}
+
+void BatchSender::flusherLoop()
+{
+    std::unique_lock lock {m_mutex};
+    while (true)
+    {
+        if (m_queue.empty())
+        {
+            if (m_stop)
+            {
+                break;
+            }
+            m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+            continue;
+        }
+
+        // Wait for the batch to fill up until the deadline of the oldest message
+        m_cv.wait_until(lock, m_deadline, [this]() { return m_stop || m_queue.size() >= m_batchSize; });
+
+        std::vector<std::string> batch;
+        batch.swap(m_queue);
+        m_queue.reserve(m_batchSize);
+
+        lock.unlock();
+        sendBatch(batch);
+        lock.lock();
+    }
+}
+
+void BatchSender::sendBatch(const std::vector<std::string>& batch)
+{
+    if (batch.empty())
+    {
+        return;
+    }
+
+    std::lock_guard lock {m_sendMutex};
+    if (m_backlog)
+    {
+        m_backlog->addValue(-static_cast<int64_t>(batch.size()));
+    }
+
+    try
+    {
+        const auto results = m_handler->sendMsgs(batch);
+        std::size_t failed {0};
+        for (const auto result : results)
+        {
+            if (ISockHandler::SendRetval::SUCCESS != result)
+            {
+                ++failed;
+            }
+        }
+        failed += batch.size() - std::min(batch.size(), results.size());
+
+        if (0 < failed)
+        {
+            if (m_failed)
+            {
+                m_failed->addValue(failed);
+            }
+            LOG_WARNING("{} of {} messages could not be sent to '{}'", failed, batch.size(), m_handler->getPath());
+        }
+    }
+    catch (const std::exception& e)
+    {
+        if (m_failed)
+        {
+            m_failed->addValue(batch.size());
+        }
+        LOG_WARNING("Messages could not be sent to '{}': {}", m_handler->getPath(), e.what());
+        m_handler->socketDisconnect();
+    }
+}
+
+} // namespace sockiface
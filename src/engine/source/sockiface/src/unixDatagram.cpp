@@ -1,6 +1,10 @@
 #include "unixDatagram.hpp"
 
+#include <algorithm>
+#include <cerrno>
+
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <sys/un.h>
 #include <unistd.h>
 
@@ -39,6 +43,72 @@ ISockHandler::SendRetval unixDatagram::sendMsg(const std::string& msg)
     return result;
 };
 
+std::vector<ISockHandler::SendRetval> unixDatagram::sendMsgs(const std::vector<std::string>& msgs)
+{
+    std::vector<SendRetval> results(msgs.size(), SendRetval::SOCKET_ERROR);
+
+    if (!isConnected())
+    {
+        socketConnect();
+    }
+
+    // Validate, only the valid messages are sent
+    std::vector<std::size_t> indexes;
+    std::vector<iovec> iovecs;
+    indexes.reserve(msgs.size());
+    iovecs.reserve(msgs.size());
+    for (std::size_t i = 0; i < msgs.size(); ++i)
+    {
+        if (msgs[i].empty())
+        {
+            results[i] = SendRetval::SIZE_ZERO;
+        }
+        else if (getMaxMsgSize() < msgs[i].size())
+        {
+            results[i] = SendRetval::SIZE_TOO_LONG;
+        }
+        else
+        {
+            indexes.push_back(i);
+            iovecs.push_back({const_cast<char*>(msgs[i].data()), msgs[i].size()});
+        }
+    }
+
+    std::vector<mmsghdr> headers(iovecs.size());
+    for (std::size_t i = 0; i < iovecs.size(); ++i)
+    {
+        headers[i].msg_hdr.msg_iov = &iovecs[i];
+        headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // sendmmsg may send only a part of the batch, the failed message is skipped as in sendMsg
+    std::size_t offset {0};
+    while (offset < headers.size())
+    {
+        const auto pending {std::min<std::size_t>(headers.size() - offset, UIO_MAXIOV)};
+        const int sent {sendmmsg(getFD(), headers.data() + offset, pending, MSG_NOSIGNAL)};
+        if (0 > sent)
+        {
+            if (EINTR != errno)
+            {
+                ++offset;
+            }
+            continue;
+        }
+
+        for (auto i = offset; i < offset + static_cast<std::size_t>(sent); ++i)
+        {
+            if (headers[i].msg_len == iovecs[i].iov_len)
+            {
+                results[indexes[i]] = SendRetval::SUCCESS;
+            }
+        }
+        offset += sent;
+    }
+
+    return results;
+}
+
 // TODO: Are we sure about this?
 // This Unix datagram socket implementation is not able to receive messages.
 std::vector<char> unixDatagram::recvMsg()
@@ -44,6 +44,7 @@ public:
     MOCK_METHOD(void, socketDisconnect, (), (override));
     MOCK_METHOD(bool, isConnected, (), (const, noexcept, override));
     MOCK_METHOD(SendRetval, sendMsg, (const std::string& msg), (override));
+    MOCK_METHOD(std::vector<SendRetval>, sendMsgs, (const std::vector<std::string>& msgs), (override));
     MOCK_METHOD(std::vector<char>, recvMsg, (), (override));
 };
 
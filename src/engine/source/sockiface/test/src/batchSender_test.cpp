@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <memory>
+
+#include <base/logging.hpp>
+#include <mockMetricsInstrument.hpp>
+#include <mockMetricsScope.hpp>
+#include <sockiface/batchSender.hpp>
+#include <sockiface/mockSockHandler.hpp>
+
+using namespace sockiface;
+using namespace sockiface::mocks;
+using namespace std::chrono_literals;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+class BatchSenderTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockSockHandler> m_handler;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_handler = std::make_shared<MockSockHandler>();
+        ON_CALL(*m_handler, getPath()).WillByDefault(Return("/tmp/batchSender_test.sock"));
+    }
+};
+
+TEST_F(BatchSenderTest, InvalidArguments)
+{
+    ASSERT_THROW(BatchSender(nullptr, 10, 10ms), std::invalid_argument);
+    ASSERT_THROW(BatchSender(m_handler, 0, 10ms), std::invalid_argument);
+    ASSERT_THROW(BatchSender(m_handler, 10, 10ms, 5), std::invalid_argument);
+}
+
+TEST_F(BatchSenderTest, SendOnBatchSize)
+{
+    std::promise<std::vector<std::string>> sent;
+    EXPECT_CALL(*m_handler, sendMsgs(_))
+        .WillOnce(Invoke(
+            [&](const std::vector<std::string>& msgs)
+            {
+                sent.set_value(msgs);
+                return std::vector<ISockHandler::SendRetval>(msgs.size(), successSendMsgRes());
+            }));
+
+    BatchSender sender(m_handler, 3, 1h);
+    sender.push("msg1");
+    sender.push("msg2");
+    sender.push("msg3");
+
+    auto future = sent.get_future();
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    ASSERT_EQ(future.get(), std::vector<std::string>({"msg1", "msg2", "msg3"}));
+}
+
+TEST_F(BatchSenderTest, SendOnDelay)
+{
+    std::promise<std::vector<std::string>> sent;
+    EXPECT_CALL(*m_handler, sendMsgs(_))
+        .WillOnce(Invoke(
+            [&](const std::vector<std::string>& msgs)
+            {
+                sent.set_value(msgs);
+                return std::vector<ISockHandler::SendRetval>(msgs.size(), successSendMsgRes());
+            }));
+
+    BatchSender sender(m_handler, 100, 10ms);
+    sender.push("msg1");
+
+    auto future = sent.get_future();
+    ASSERT_EQ(future.wait_for(5s), std::future_status::ready);
+    ASSERT_EQ(future.get(), std::vector<std::string>({"msg1"}));
+}
+
+TEST_F(BatchSenderTest, FlushOnDestroy)
+{
+    EXPECT_CALL(*m_handler, sendMsgs(std::vector<std::string>({"msg1", "msg2"})))
+        .WillOnce(Return(std::vector<ISockHandler::SendRetval>(2, successSendMsgRes())));
+
+    {
+        BatchSender sender(m_handler, 100, 1h);
+        sender.push("msg1");
+        sender.push("msg2");
+    }
+}
+
+TEST_F(BatchSenderTest, Flush)
+{
+    EXPECT_CALL(*m_handler, sendMsgs(std::vector<std::string>({"msg1"})))
+        .WillOnce(Return(std::vector<ISockHandler::SendRetval>(1, successSendMsgRes())));
+
+    BatchSender sender(m_handler, 100, 1h);
+    sender.push("msg1");
+    sender.flush();
+
+    // Nothing left to send
+    sender.flush();
+}
+
+TEST_F(BatchSenderTest, SendErrorDisconnects)
+{
+    EXPECT_CALL(*m_handler, sendMsgs(_)).WillOnce(Invoke(
+        [](const std::vector<std::string>&) -> std::vector<ISockHandler::SendRetval>
+        { throw std::runtime_error("Cannot connect"); }));
+    EXPECT_CALL(*m_handler, getPath()).Times(::testing::AnyNumber());
+    EXPECT_CALL(*m_handler, socketDisconnect());
+
+    BatchSender sender(m_handler, 100, 1h);
+    sender.push("msg1");
+    ASSERT_NO_THROW(sender.flush());
+}
+
+TEST_F(BatchSenderTest, DropWhenFull)
+{
+    auto scope = std::make_shared<MockMetricsScope>();
+    auto queued = std::make_shared<MockCounter<uint64_t>>();
+    auto dropped = std::make_shared<MockCounter<uint64_t>>();
+    auto failed = std::make_shared<MockCounter<uint64_t>>();
+    auto backlog = std::make_shared<MockCounter<int64_t>>();
+    EXPECT_CALL(*scope, getCounterUInteger("Queued")).WillOnce(Return(queued));
+    EXPECT_CALL(*scope, getCounterUInteger("Dropped")).WillOnce(Return(dropped));
+    EXPECT_CALL(*scope, getCounterUInteger("SendFailed")).WillOnce(Return(failed));
+    EXPECT_CALL(*scope, getUpDownCounterInteger("Backlog")).WillOnce(Return(backlog));
+
+    EXPECT_CALL(*queued, addValue(1)).Times(4);
+    EXPECT_CALL(*dropped, addValue(1)).Times(1);
+    EXPECT_CALL(*failed, addValue(_)).Times(0);
+    EXPECT_CALL(*backlog, addValue(1)).Times(4);
+    EXPECT_CALL(*backlog, addValue(-2)).Times(2);
+
+    // The first batch blocks the socket until the queue is full again
+    std::promise<void> sending;
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    EXPECT_CALL(*m_handler, sendMsgs(std::vector<std::string>({"msg1", "msg2"})))
+        .WillOnce(Invoke(
+            [&](const std::vector<std::string>& msgs)
+            {
+                sending.set_value();
+                released.wait();
+                return std::vector<ISockHandler::SendRetval>(msgs.size(), successSendMsgRes());
+            }));
+    EXPECT_CALL(*m_handler, sendMsgs(std::vector<std::string>({"msg3", "msg4"})))
+        .WillOnce(Return(std::vector<ISockHandler::SendRetval>(2, successSendMsgRes())));
+
+    {
+        BatchSender sender(m_handler, 2, 1h, 2, scope);
+        ASSERT_TRUE(sender.push("msg1"));
+        ASSERT_TRUE(sender.push("msg2"));
+        ASSERT_EQ(sending.get_future().wait_for(5s), std::future_status::ready);
+
+        ASSERT_TRUE(sender.push("msg3"));
+        ASSERT_TRUE(sender.push("msg4"));
+        ASSERT_FALSE(sender.push("msg5"));
+        release.set_value();
+    }
+}
@@ -270,3 +270,46 @@ TEST_F(unixDatagramSocket, SendMessageDisconnected)
 
     unlink(m_datagramSockPath.c_str());
 }
+
+TEST_F(unixDatagramSocket, SendMessages)
+{
+    unixDatagram uDgram(m_datagramSockPath);
+
+    auto serverSocketFD {testBindUnixSocket(m_datagramSockPath, SOCK_DGRAM)};
+    ASSERT_GT(serverSocketFD, 0);
+
+    const std::vector<std::string> msgs {"first message", "second message", "third message"};
+    std::vector<ISockHandler::SendRetval> results;
+    ASSERT_NO_THROW(results = uDgram.sendMsgs(msgs));
+    ASSERT_EQ(results, std::vector<ISockHandler::SendRetval>(msgs.size(), ISockHandler::SendRetval::SUCCESS));
+
+    for (const auto& msg : msgs)
+    {
+        ASSERT_STREQ(testRecvString(serverSocketFD, SOCK_DGRAM).data(), msg.data());
+    }
+
+    close(serverSocketFD);
+
+    unlink(m_datagramSockPath.c_str());
+}
+
+TEST_F(unixDatagramSocket, SendMessagesSkipInvalid)
+{
+    unixDatagram uDgram(m_datagramSockPath, 10);
+
+    auto serverSocketFD {testBindUnixSocket(m_datagramSockPath, SOCK_DGRAM)};
+    ASSERT_GT(serverSocketFD, 0);
+
+    const std::vector<std::string> msgs {"", "message", "too long message"};
+    const auto results {uDgram.sendMsgs(msgs)};
+    ASSERT_EQ(results,
+              std::vector<ISockHandler::SendRetval>({ISockHandler::SendRetval::SIZE_ZERO,
+                                                     ISockHandler::SendRetval::SUCCESS,
+                                                     ISockHandler::SendRetval::SIZE_TOO_LONG}));
+
+    ASSERT_STREQ(testRecvString(serverSocketFD, SOCK_DGRAM).data(), "message");
+
+    close(serverSocketFD);
+
+    unlink(m_datagramSockPath.c_str());
+}
@@ -0,0 +1,148 @@
+#ifndef _ROCKSDB_DRIVER_H
+#define _ROCKSDB_DRIVER_H
+
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <store/idriver.hpp>
+
+namespace rocksdb
+{
+class DB;
+} // namespace rocksdb
+
+/**
+ * @brief RocksDB driver for the store.
+ *
+ */
+namespace store::drivers
+{
+
+/**
+ * @brief RocksDB driver.
+ *
+ * This driver stores the jsons in a RocksDB database, under a key with the full name of the document. The collections
+ * are not stored, a collection exists while some document has its name as prefix, so the collections are read by
+ * iterating over the prefix of the name instead of listing directories.
+ *
+ * As in the file driver, a name cannot be a document and a collection at the same time.
+ */
+class RocksDBDriver : public IDriver
+{
+private:
+    std::filesystem::path m_path;      ///< Path of the database
+    std::unique_ptr<rocksdb::DB> m_db; ///< Database
+    std::mutex m_writeMutex;           ///< Serializes the checks and writes of the documents
+
+    /**
+     * @brief Check that a document can be created, the document itself is not checked.
+     *
+     * @param name full name of the document.
+     * @param content document content.
+     * @return base::OptError with the error or empty if it can be created.
+     */
+    base::OptError checkNewDoc(const base::Name& name, const Doc& content) const;
+
+    /**
+     * @brief Read the names of the children of a key prefix.
+     *
+     * @param prefix prefix of the keys of the children, empty for the root.
+     * @param parent name of the parent, prepended to the children.
+     * @return Col with the children, empty if there are none.
+     */
+    Col readChildren(const std::string& prefix, const base::Name& parent) const;
+
+public:
+    /**
+     * @brief Construct a new RocksDB Driver object.
+     *
+     * @param path Path of the database.
+     * @param create If true, the database will be created if it doesn't exist.
+     * @throw std::runtime_error if the database cannot be opened.
+     */
+    RocksDBDriver(const std::filesystem::path& path, bool create = false);
+    ~RocksDBDriver();
+
+    RocksDBDriver(const RocksDBDriver&) = delete;
+    RocksDBDriver& operator=(const RocksDBDriver&) = delete;
+
+    /**
+     * @brief Create or update several documents atomically, either all of them are written or none.
+     *
+     * @param docs full names and contents of the documents.
+     * @return base::OptError with the error or empty if no error.
+     */
+    base::OptError upsertDocs(const std::vector<std::pair<base::Name, Doc>>& docs);
+
+    /**
+     * @brief Copy all the documents of another driver, in a single atomic write.
+     *
+     * Used to migrate a file store, the documents already in the database are overwritten.
+     *
+     * @param source driver to read the documents from.
+     * @return base::RespOrError<std::size_t> with the number of documents copied or error.
+     */
+    base::RespOrError<std::size_t> importFrom(const IDriver& source);
+
+    /**
+     * @copydoc IDriver::createDoc
+     */
+    base::OptError createDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::readDoc
+     */
+    base::RespOrError<Doc> readDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::updateDoc
+     */
+    base::OptError updateDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::upsertDoc
+     */
+    base::OptError upsertDoc(const base::Name& name, const json::Json& content) override;
+
+    /**
+     * @copydoc IDriver::deleteDoc
+     */
+    base::OptError deleteDoc(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::readCol
+     */
+    base::RespOrError<Col> readCol(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::readRoot
+     */
+    base::RespOrError<Col> readRoot() const override;
+
+    /**
+     * @copydoc IDriver::deleteCol
+     */
+    base::OptError deleteCol(const base::Name& name) override;
+
+    /**
+     * @copydoc IDriver::exists
+     */
+    bool exists(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsDoc
+     */
+    bool existsDoc(const base::Name& name) const override;
+
+    /**
+     * @copydoc IDriver::existsCol
+     */
+    bool existsCol(const base::Name& name) const override;
+};
+} // namespace store::drivers
+
+#endif // _ROCKSDB_DRIVER_H
@@ -0,0 +1,392 @@
+#include "store/drivers/rocksDBDriver.hpp"
+
+#include <cstring>
+#include <unordered_set>
+
+#include <fmt/format.h>
+#include <rocksdb/db.h>
+#include <rocksdb/options.h>
+#include <rocksdb/write_batch.h>
+
+#include <base/logging.hpp>
+
+namespace store::drivers
+{
+
+namespace
+{
+// The keys of a collection are in [name/, name0), '0' is the character after the separator
+constexpr char SEPARATOR = base::Name::SEPARATOR_C;
+constexpr char AFTER_SEPARATOR = SEPARATOR + 1;
+
+std::string docKey(const base::Name& name)
+{
+    return name.fullName();
+}
+
+std::string colPrefix(const base::Name& name)
+{
+    return name.fullName() + SEPARATOR;
+}
+
+std::string colEnd(const base::Name& name)
+{
+    return name.fullName() + AFTER_SEPARATOR;
+}
+
+bool startsWith(const rocksdb::Slice& key, const std::string& prefix)
+{
+    return key.size() >= prefix.size() && 0 == std::memcmp(key.data(), prefix.data(), prefix.size());
+}
+
+base::OptError checkDuplicateKeys(const base::Name& name, const Doc& content)
+{
+    auto duplicateError = content.checkDuplicateKeys();
+    if (duplicateError)
+    {
+        return base::Error {
+            fmt::format("Content '{}' has duplicate keys: {}", name.fullName(), duplicateError.value().message)};
+    }
+    return base::noError();
+}
+} // namespace
+
+RocksDBDriver::RocksDBDriver(const std::filesystem::path& path, bool create)
+    : m_path(path)
+{
+    LOG_DEBUG("Engine RocksDB driver init with path '{}' and create '{}'.", path.string(), create);
+
+    if (!create && !std::filesystem::exists(path))
+    {
+        throw std::runtime_error(fmt::format("Path '{}' does not exist", path.string()));
+    }
+
+    rocksdb::Options options;
+    options.create_if_missing = create;
+
+    rocksdb::DB* db {nullptr};
+    const auto status = rocksdb::DB::Open(options, path.string(), &db);
+    if (!status.ok())
+    {
+        throw std::runtime_error(
+            fmt::format("Database '{}' could not be opened: {}", path.string(), status.ToString()));
+    }
+    m_db.reset(db);
+}
+
+RocksDBDriver::~RocksDBDriver() = default;
+
+base::OptError RocksDBDriver::checkNewDoc(const base::Name& name, const Doc& content) const
+{
+    if (auto error = checkDuplicateKeys(name, content))
+    {
+        return error;
+    }
+
+    if (existsDoc(name) || existsCol(name))
+    {
+        return base::Error {fmt::format("Document '{}' already exists", name.fullName())};
+    }
+
+    // No parent can be a document
+    const auto& parts = name.parts();
+    for (std::size_t size = 1; size < parts.size(); ++size)
+    {
+        const base::Name parent(std::vector<std::string>(parts.begin(), parts.begin() + size));
+        if (existsDoc(parent))
+        {
+            return base::Error {
+                fmt::format("Document '{}' cannot be created, '{}' is a document", name.fullName(), parent.fullName())};
+        }
+    }
+
+    return base::noError();
+}
+
+Col RocksDBDriver::readChildren(const std::string& prefix, const base::Name& parent) const
+{
+    Col children;
+    std::unique_ptr<rocksdb::Iterator> iter(m_db->NewIterator(rocksdb::ReadOptions()));
+    for (iter->Seek(prefix); iter->Valid() && startsWith(iter->key(), prefix);)
+    {
+        const auto key = iter->key().ToString();
+        const auto end = key.find(SEPARATOR, prefix.size());
+        const auto length = end == std::string::npos ? std::string::npos : end - prefix.size();
+        const auto child = key.substr(prefix.size(), length);
+        children.emplace_back(prefix.empty() ? base::Name(child) : parent + child);
+
+        if (end == std::string::npos)
+        {
+            // A document, the next key is a sibling
+            iter->Next();
+        }
+        else
+        {
+            // A collection, skip all its keys
+            iter->Seek(key.substr(0, end) + AFTER_SEPARATOR);
+        }
+    }
+
+    return children;
+}
+
+base::OptError RocksDBDriver::createDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver createDoc name: '{}'.", name.fullName());
+    LOG_TRACE("RocksDBDriver createDoc content: '{}'.", content.prettyStr());
+
+    std::lock_guard lock {m_writeMutex};
+    if (auto error = checkNewDoc(name, content))
+    {
+        return error;
+    }
+
+    const auto status = m_db->Put(rocksdb::WriteOptions(), docKey(name), content.str());
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Document '{}' could not be written: {}", name.fullName(), status.ToString())};
+    }
+
+    return base::noError();
+}
+
+base::RespOrError<Doc> RocksDBDriver::readDoc(const base::Name& name) const
+{
+    LOG_DEBUG("RocksDBDriver readDoc name: '{}'.", name.fullName());
+
+    std::string value;
+    const auto status = m_db->Get(rocksdb::ReadOptions(), docKey(name), &value);
+    if (status.IsNotFound())
+    {
+        if (existsCol(name))
+        {
+            return base::Error {fmt::format("Document '{}' is a collection", name.fullName())};
+        }
+        return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+    }
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Document '{}' could not be read: {}", name.fullName(), status.ToString())};
+    }
+
+    try
+    {
+        return Doc {value.c_str()};
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Document '{}' could not be parsed: {}", name.fullName(), e.what())};
+    }
+}
+
+base::OptError RocksDBDriver::updateDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver updateDoc name: '{}'.", name.fullName());
+    LOG_TRACE("RocksDBDriver updateDoc content: '{}'.", content.prettyStr());
+
+    if (auto error = checkDuplicateKeys(name, content))
+    {
+        return error;
+    }
+
+    std::lock_guard lock {m_writeMutex};
+    if (!existsDoc(name))
+    {
+        return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+    }
+
+    const auto status = m_db->Put(rocksdb::WriteOptions(), docKey(name), content.str());
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Document '{}' could not be written: {}", name.fullName(), status.ToString())};
+    }
+
+    return base::noError();
+}
+
+base::OptError RocksDBDriver::upsertDoc(const base::Name& name, const Doc& content)
+{
+    LOG_DEBUG("RocksDBDriver upsertDoc name: '{}'.", name.fullName());
+
+    return upsertDocs({{name, content}});
+}
+
+base::OptError RocksDBDriver::upsertDocs(const std::vector<std::pair<base::Name, Doc>>& docs)
+{
+    std::lock_guard lock {m_writeMutex};
+
+    std::unordered_set<base::Name> names;
+    names.reserve(docs.size());
+    for (const auto& [name, content] : docs)
+    {
+        names.insert(name);
+    }
+
+    rocksdb::WriteBatch batch;
+    for (const auto& [name, content] : docs)
+    {
+        auto error = existsDoc(name) ? checkDuplicateKeys(name, content) : checkNewDoc(name, content);
+        if (error)
+        {
+            return error;
+        }
+
+        // No parent can be another document of the batch
+        const auto& parts = name.parts();
+        for (std::size_t size = 1; size < parts.size(); ++size)
+        {
+            const base::Name parent(std::vector<std::string>(parts.begin(), parts.begin() + size));
+            if (names.count(parent) != 0)
+            {
+                return base::Error {fmt::format(
+                    "Document '{}' cannot be written, '{}' is a document", name.fullName(), parent.fullName())};
+            }
+        }
+
+        batch.Put(docKey(name), content.str());
+    }
+
+    const auto status = m_db->Write(rocksdb::WriteOptions(), &batch);
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Documents could not be written: {}", status.ToString())};
+    }
+
+    return base::noError();
+}
+
+base::RespOrError<std::size_t> RocksDBDriver::importFrom(const IDriver& source)
+{
+    LOG_DEBUG("RocksDBDriver importFrom.");
+
+    std::vector<std::pair<base::Name, Doc>> docs;
+    auto root = source.readRoot();
+    if (base::isError(root))
+    {
+        return base::getError(root);
+    }
+
+    auto pending = base::getResponse<Col>(root);
+    while (!pending.empty())
+    {
+        auto name = std::move(pending.back());
+        pending.pop_back();
+
+        if (source.existsDoc(name))
+        {
+            auto doc = source.readDoc(name);
+            if (base::isError(doc))
+            {
+                return base::Error {fmt::format(
+                    "Document '{}' could not be imported: {}", name.fullName(), base::getError(doc).message)};
+            }
+            docs.emplace_back(std::move(name), std::move(base::getResponse<Doc>(doc)));
+            continue;
+        }
+
+        auto col = source.readCol(name);
+        if (base::isError(col))
+        {
+            return base::Error {fmt::format(
+                "Collection '{}' could not be imported: {}", name.fullName(), base::getError(col).message)};
+        }
+        for (auto& child : base::getResponse<Col>(col))
+        {
+            pending.emplace_back(std::move(child));
+        }
+    }
+
+    if (auto error = upsertDocs(docs))
+    {
+        return error.value();
+    }
+
+    return docs.size();
+}
+
+base::OptError RocksDBDriver::deleteDoc(const base::Name& name)
+{
+    LOG_DEBUG("RocksDBDriver deleteDoc name: '{}'.", name.fullName());
+
+    std::lock_guard lock {m_writeMutex};
+    if (!existsDoc(name))
+    {
+        return base::Error {fmt::format("Document '{}' does not exist", name.fullName())};
+    }
+
+    const auto status = m_db->Delete(rocksdb::WriteOptions(), docKey(name));
+    if (!status.ok())
+    {
+        return base::Error {fmt::format("Document '{}' could not be removed: {}", name.fullName(), status.ToString())};
+    }
+
+    return base::noError();
+}
+
+base::RespOrError<Col> RocksDBDriver::readCol(const base::Name& name) const
+{
+    LOG_DEBUG("RocksDBDriver readCol name: '{}'.", name.fullName());
+
+    auto children = readChildren(colPrefix(name), name);
+    if (children.empty())
+    {
+        if (existsDoc(name))
+        {
+            return base::Error {fmt::format("Collection '{}' is a document", name.fullName())};
+        }
+        return base::Error {fmt::format("Collection '{}' does not exist", name.fullName())};
+    }
+
+    return children;
+}
+
+base::RespOrError<Col> RocksDBDriver::readRoot() const
+{
+    LOG_DEBUG("RocksDBDriver readRoot.");
+
+    return readChildren("", base::Name {});
+}
+
+base::OptError RocksDBDriver::deleteCol(const base::Name& name)
+{
+    LOG_DEBUG("RocksDBDriver deleteCol name: '{}'.", name.fullName());
+
+    std::lock_guard lock {m_writeMutex};
+    if (!existsCol(name))
+    {
+        return base::Error {fmt::format("Collection '{}' does not exist", name.fullName())};
+    }
+
+    // All the documents of the collection are removed at once
+    rocksdb::WriteBatch batch;
+    batch.DeleteRange(m_db->DefaultColumnFamily(), colPrefix(name), colEnd(name));
+    const auto status = m_db->Write(rocksdb::WriteOptions(), &batch);
+    if (!status.ok())
+    {
+        return base::Error {
+            fmt::format("Collection '{}' could not be removed: {}", name.fullName(), status.ToString())};
+    }
+
+    return base::noError();
+}
+
+bool RocksDBDriver::exists(const base::Name& name) const
+{
+    return existsDoc(name) || existsCol(name);
+}
+
+bool RocksDBDriver::existsDoc(const base::Name& name) const
+{
+    std::string value;
+    return m_db->Get(rocksdb::ReadOptions(), docKey(name), &value).ok();
+}
+
+bool RocksDBDriver::existsCol(const base::Name& name) const
+{
+    const auto prefix = colPrefix(name);
+    std::unique_ptr<rocksdb::Iterator> iter(m_db->NewIterator(rocksdb::ReadOptions()));
+    iter->Seek(prefix);
+    return iter->Valid() && startsWith(iter->key(), prefix);
+}
+
+} // namespace store::drivers
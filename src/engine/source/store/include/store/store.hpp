@@ -1,8 +1,12 @@
 #ifndef _STORE_HPP
 #define _STORE_HPP
 
+#include <map>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
+#include <vector>
 
 #include <store/idriver.hpp>
 #include <store/istore.hpp>
@@ -21,6 +25,30 @@ private:
     std::unique_ptr<DBDocNames> m_cache; ///< Cache for the doc names and virtual space names.
     mutable std::shared_mutex m_mutex;   ///< sync the m_cache with the store. and protect the m_cache access.
 
+    // Parsed documents read from the driver, dropped when the document is written. The readers fill it holding the
+    // shared m_mutex and the writers drop it holding the unique m_mutex, so a stale document is never cached.
+    mutable std::unordered_map<base::Name, Doc> m_docs; ///< Cache of parsed documents by virtual name.
+    mutable std::mutex m_docsMutex;                     ///< Protects m_docs between the readers.
+
+    std::map<std::size_t, DocChangeHandler> m_handlers; ///< Change handlers by subscription identifier.
+    std::size_t m_nextSubscription {0};                 ///< Identifier of the next subscription.
+    mutable std::mutex m_handlersMutex;                 ///< Protects the handlers, held while they are called.
+
+    /**
+     * @brief Drop a document from the cache of parsed documents.
+     *
+     * @param name The virtual name of the document.
+     */
+    void dropDoc(const base::Name& name);
+
+    /**
+     * @brief Call the change handlers, without holding m_mutex.
+     *
+     * @param names The virtual names of the changed documents.
+     * @param change The kind of change.
+     */
+    void notify(const std::vector<base::Name>& names, DocChange change) const;
+
     /**
      * @brief Translate a virtual name to a real name in the store driver.
      *
@@ -177,6 +205,16 @@ public:
      */
     base::OptError deleteCol(const base::Name& name, const NamespaceId& namespaceId) override;
 
+    /**
+     * @copydoc IStore::subscribe
+     */
+    std::size_t subscribe(DocChangeHandler handler) override;
+
+    /**
+     * @copydoc IStore::unsubscribe
+     */
+    void unsubscribe(std::size_t subscriptionId) override;
+
     /**
      * @copydoc IStoreInternal::createInternalDoc
      */
@@ -1,6 +1,8 @@
 #ifndef _STORE_ISTORE_HPP
 #define _STORE_ISTORE_HPP
 
+#include <cstddef>
+#include <functional>
 #include <list>
 #include <string>
 #include <utility>
@@ -148,6 +150,24 @@ public:
     virtual bool existsInternalDoc(const base::Name& name) const = 0;
 };
 
+/**
+ * @brief Kind of change of a document in the store.
+ */
+enum class DocChange
+{
+    CREATED, ///< The document was added
+    UPDATED, ///< The content of the document changed
+    DELETED  ///< The document was deleted
+};
+
+/**
+ * @brief Function called when a document of the store changes.
+ *
+ * It is called after the change is written, without holding the store locks, so it may read the store. It must not
+ * subscribe or unsubscribe.
+ */
+using DocChangeHandler = std::function<void(const base::Name& name, DocChange change)>;
+
 class IStore : public IStoreReader, public IStoreInternal
 {
 public:
@@ -203,6 +223,21 @@ public:
      * @return base::OptError The error if the collection does not exist or cannot be deleted.
      */
     virtual base::OptError deleteCol(const base::Name& name, const NamespaceId& namespaceId) = 0;
+
+    /**
+     * @brief Subscribe to the changes of the documents in the namespaces, the internal documents are not notified.
+     *
+     * @param handler The function called on each change.
+     * @return std::size_t The subscription identifier, used to unsubscribe.
+     */
+    virtual std::size_t subscribe(DocChangeHandler handler) = 0;
+
+    /**
+     * @brief Cancel a subscription, the handler is not called after this returns.
+     *
+     * @param subscriptionId The subscription identifier returned by subscribe.
+     */
+    virtual void unsubscribe(std::size_t subscriptionId) = 0;
 };
 
 } // namespace store
@@ -283,6 +283,10 @@ Store::Store(std::shared_ptr<IDriver> driver)
     : m_driver(std::move(driver))
     , m_cache(std::make_unique<DBDocNames>())
     , m_mutex()
+    , m_docs()
+    , m_docsMutex()
+    , m_handlers()
+    , m_handlersMutex()
 {
     if (m_driver == nullptr)
     {
@@ -382,10 +386,26 @@ base::RespOrError<Doc> Store::readDoc(const base::Name& name) const
         return base::Error {"Document does not exist"};
     }
 
+    {
+        std::lock_guard<std::mutex> docsLock(m_docsMutex);
+        const auto it = m_docs.find(name);
+        if (it != m_docs.end())
+        {
+            return it->second;
+        }
+    }
+
     // Transform the virtual name to the real name
     const auto rname = virtualToRealName(name, *namespaceId);
 
-    return m_driver->readDoc(rname);
+    auto result = m_driver->readDoc(rname);
+    if (const auto doc = std::get_if<Doc>(&result))
+    {
+        std::lock_guard<std::mutex> docsLock(m_docsMutex);
+        m_docs.emplace(name, *doc);
+    }
+
+    return result;
 }
 
 std::vector<NamespaceId> Store::listNamespaces() const
@@ -444,22 +464,34 @@ base::OptError Store::createDoc(const base::Name& name, const NamespaceId& names
     }
 
     m_cache->add(name, namespaceId);
+    lock.unlock();
+
+    notify({name}, DocChange::CREATED);
     return std::nullopt;
 }
 
 base::OptError Store::updateDoc(const base::Name& name, const Doc& content)
 {
-    // Shared lock because we only read the cache here
-    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    // Unique lock, the readers must not cache the document while it is written
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
     auto namespaceId = m_cache->getNamespaceId(name);
     if (!namespaceId)
     {
         return base::Error {"Document does not exist"};
     }
 
-    // update the document
+    // update the document, a failed write may have changed it too
     auto rName = virtualToRealName(name, *namespaceId);
-    return m_driver->updateDoc(rName, content);
+    auto error = m_driver->updateDoc(rName, content);
+    dropDoc(name);
+    if (error)
+    {
+        return error;
+    }
+    lock.unlock();
+
+    notify({name}, DocChange::UPDATED);
+    return std::nullopt;
 }
 
 base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& namespaceId, const Doc& content)
@@ -475,6 +507,7 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
 
     auto rName = virtualToRealName(name, namespaceId);
     auto error = m_driver->upsertDoc(rName, content);
+    dropDoc(name);
     if (error)
     {
         return error;
@@ -484,7 +517,9 @@ base::OptError Store::upsertDoc(const base::Name& name, const NamespaceId& names
     {
         m_cache->add(name, namespaceId);
     }
+    lock.unlock();
 
+    notify({name}, namespaceIdCache ? DocChange::UPDATED : DocChange::CREATED);
     return std::nullopt;
 }
 
@@ -503,13 +538,16 @@ base::OptError Store::deleteDoc(const base::Name& name)
     auto rName = virtualToRealName(name, *namespaceId);
 
     auto error = m_driver->deleteDoc(rName);
+    dropDoc(name);
     if (error)
     {
         return error;
     }
 
     m_cache->del(name);
+    lock.unlock();
 
+    notify({name}, DocChange::DELETED);
     return std::nullopt;
 }
 
@@ -517,13 +555,18 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
 {
     std::unique_lock<std::shared_mutex> lock(m_mutex);
     // Check if the namespace exists and the collection exists
-    if (m_cache->filterByPrefix(name, namespaceId).empty())
+    const auto names = m_cache->filterByPrefix(name, namespaceId);
+    if (names.empty())
     {
         return base::Error {"Collection does not exist"};
     }
 
-    // Delete the collection
+    // Delete the collection, a failed delete may have removed some documents
     auto error = m_driver->deleteCol(virtualToRealName(name, namespaceId));
+    for (const auto& docName : names)
+    {
+        dropDoc(docName);
+    }
     if (error)
     {
         return error;
@@ -531,10 +574,56 @@ base::OptError Store::deleteCol(const base::Name& name, const NamespaceId& names
 
     // Update the cache
     m_cache->delCol(name, namespaceId);
+    lock.unlock();
 
+    notify(names, DocChange::DELETED);
     return std::nullopt;
 }
 
+void Store::dropDoc(const base::Name& name)
+{
+    std::lock_guard<std::mutex> docsLock(m_docsMutex);
+    m_docs.erase(name);
+}
+
+void Store::notify(const std::vector<base::Name>& names, DocChange change) const
+{
+    std::lock_guard<std::mutex> lock(m_handlersMutex);
+    for (const auto& [id, handler] : m_handlers)
+    {
+        for (const auto& name : names)
+        {
+            try
+            {
+                handler(name, change);
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Store change handler {} failed on document '{}': {}", id, name.fullName(), e.what());
+            }
+        }
+    }
+}
+
+std::size_t Store::subscribe(DocChangeHandler handler)
+{
+    if (!handler)
+    {
+        throw std::runtime_error("Store change handler cannot be empty");
+    }
+
+    std::lock_guard<std::mutex> lock(m_handlersMutex);
+    const auto id = m_nextSubscription++;
+    m_handlers.emplace(id, std::move(handler));
+    return id;
+}
+
+void Store::unsubscribe(std::size_t subscriptionId)
+{
+    std::lock_guard<std::mutex> lock(m_handlersMutex);
+    m_handlers.erase(subscriptionId);
+}
+
 base::OptError Store::createInternalDoc(const base::Name& name, const Doc& content)
 {
     // The internal document not have a namespace, and not store in the cache
@@ -113,6 +113,8 @@ public:
     MOCK_METHOD((base::OptError), upsertDoc, (const base::Name&, const NamespaceId&, const Doc&), (override));
     MOCK_METHOD((base::OptError), deleteDoc, (const base::Name&), (override));
     MOCK_METHOD((base::OptError), deleteCol, (const base::Name&, const NamespaceId&), (override));
+    MOCK_METHOD((std::size_t), subscribe, (DocChangeHandler), (override));
+    MOCK_METHOD((void), unsubscribe, (std::size_t), (override));
 };
 
 } // namespace store::mocks
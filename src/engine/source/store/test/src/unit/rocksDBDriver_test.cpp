@@ -0,0 +1,198 @@
+#include <gtest/gtest.h>
+#include <store/drivers/fileDriver.hpp>
+#include <store/drivers/rocksDBDriver.hpp>
+
+#include <algorithm>
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <base/logging.hpp>
+
+static const std::filesystem::path TEST_PATH = "/tmp/rocksDBDriver_test";
+static const base::Name TEST_NAME({"type", "name", "version"});
+static const base::Name TEST_NAME_COLLECTION(std::vector<std::string> {"type", "name"});
+
+static const json::Json TEST_JSON {R"({"key": "value"})"};
+static const json::Json TEST_JSON2 {R"({"key": "value2"})"};
+
+using namespace store::drivers;
+
+namespace
+{
+std::filesystem::path uniquePath()
+{
+    auto pid = getpid();
+    auto tid = std::this_thread::get_id();
+    std::stringstream ss;
+    ss << pid << "_" << tid; // Unique path per thread and process
+    return TEST_PATH / ss.str();
+}
+
+std::vector<base::Name> sorted(store::Col col)
+{
+    std::sort(col.begin(), col.end(), [](const auto& a, const auto& b) { return a.fullName() < b.fullName(); });
+    return col;
+}
+} // namespace
+
+class RocksDBDriverTest : public ::testing::Test
+{
+protected:
+    std::filesystem::path m_path;
+    std::shared_ptr<RocksDBDriver> m_driver;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        m_path = uniquePath();
+        std::filesystem::remove_all(m_path);
+        m_driver = std::make_shared<RocksDBDriver>(m_path / "db", true);
+    }
+
+    void TearDown() override
+    {
+        m_driver.reset();
+        std::filesystem::remove_all(m_path);
+    }
+};
+
+TEST_F(RocksDBDriverTest, BuildNotExisting)
+{
+    ASSERT_THROW(RocksDBDriver(m_path / "notExisting", false), std::runtime_error);
+}
+
+TEST_F(RocksDBDriverTest, CreateAndRead)
+{
+    ASSERT_FALSE(m_driver->createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_TRUE(m_driver->existsDoc(TEST_NAME));
+    ASSERT_FALSE(m_driver->existsCol(TEST_NAME));
+    ASSERT_TRUE(m_driver->existsCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(m_driver->existsDoc(TEST_NAME_COLLECTION));
+    ASSERT_TRUE(m_driver->exists(TEST_NAME_COLLECTION));
+
+    auto doc = m_driver->readDoc(TEST_NAME);
+    ASSERT_FALSE(base::isError(doc));
+    ASSERT_EQ(base::getResponse<store::Doc>(doc), TEST_JSON);
+
+    ASSERT_TRUE(base::isError(m_driver->readDoc(TEST_NAME_COLLECTION)));
+    ASSERT_TRUE(base::isError(m_driver->readDoc(TEST_NAME + "other")));
+}
+
+TEST_F(RocksDBDriverTest, CreateFail)
+{
+    ASSERT_FALSE(m_driver->createDoc(TEST_NAME, TEST_JSON));
+
+    // Already exists, as document or collection
+    ASSERT_TRUE(m_driver->createDoc(TEST_NAME, TEST_JSON2));
+    ASSERT_TRUE(m_driver->createDoc(TEST_NAME_COLLECTION, TEST_JSON2));
+    // A parent is a document
+    ASSERT_TRUE(m_driver->createDoc(TEST_NAME + "child", TEST_JSON2));
+    // Duplicate keys
+    ASSERT_TRUE(m_driver->createDoc(TEST_NAME_COLLECTION + "other", json::Json {R"({"key": 1, "key": 2})"}));
+
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON);
+}
+
+TEST_F(RocksDBDriverTest, UpdateAndUpsert)
+{
+    ASSERT_TRUE(m_driver->updateDoc(TEST_NAME, TEST_JSON));
+
+    ASSERT_FALSE(m_driver->upsertDoc(TEST_NAME, TEST_JSON));
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON);
+
+    ASSERT_FALSE(m_driver->updateDoc(TEST_NAME, TEST_JSON2));
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON2);
+
+    ASSERT_FALSE(m_driver->upsertDoc(TEST_NAME, TEST_JSON));
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON);
+
+    // A collection cannot be updated
+    ASSERT_TRUE(m_driver->updateDoc(TEST_NAME_COLLECTION, TEST_JSON));
+    ASSERT_TRUE(m_driver->upsertDoc(TEST_NAME_COLLECTION, TEST_JSON));
+}
+
+TEST_F(RocksDBDriverTest, ReadCol)
+{
+    ASSERT_FALSE(m_driver->createDoc(base::Name("a/b/c"), TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("a/b/d/e"), TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("a/b/d/f"), TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("a/b.x"), TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("a/bz/g"), TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("h"), TEST_JSON));
+
+    auto col = m_driver->readCol(base::Name("a"));
+    ASSERT_FALSE(base::isError(col));
+    ASSERT_EQ(sorted(base::getResponse<store::Col>(col)),
+              (std::vector<base::Name> {base::Name("a/b"), base::Name("a/b.x"), base::Name("a/bz")}));
+
+    col = m_driver->readCol(base::Name("a/b"));
+    ASSERT_FALSE(base::isError(col));
+    ASSERT_EQ(sorted(base::getResponse<store::Col>(col)),
+              (std::vector<base::Name> {base::Name("a/b/c"), base::Name("a/b/d")}));
+
+    auto root = m_driver->readRoot();
+    ASSERT_FALSE(base::isError(root));
+    ASSERT_EQ(sorted(base::getResponse<store::Col>(root)),
+              (std::vector<base::Name> {base::Name("a"), base::Name("h")}));
+
+    ASSERT_TRUE(base::isError(m_driver->readCol(base::Name("h"))));
+    ASSERT_TRUE(base::isError(m_driver->readCol(base::Name("x"))));
+}
+
+TEST_F(RocksDBDriverTest, Delete)
+{
+    ASSERT_TRUE(m_driver->deleteDoc(TEST_NAME));
+    ASSERT_TRUE(m_driver->deleteCol(TEST_NAME_COLLECTION));
+
+    ASSERT_FALSE(m_driver->createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(TEST_NAME_COLLECTION + "other", TEST_JSON));
+    ASSERT_FALSE(m_driver->createDoc(base::Name("type/name.x"), TEST_JSON));
+
+    ASSERT_FALSE(m_driver->deleteDoc(TEST_NAME));
+    ASSERT_FALSE(m_driver->existsDoc(TEST_NAME));
+    ASSERT_TRUE(m_driver->existsCol(TEST_NAME_COLLECTION));
+
+    ASSERT_FALSE(m_driver->deleteCol(TEST_NAME_COLLECTION));
+    ASSERT_FALSE(m_driver->existsCol(TEST_NAME_COLLECTION));
+    // The sibling with the name of the collection as prefix is kept
+    ASSERT_TRUE(m_driver->existsDoc(base::Name("type/name.x")));
+}
+
+TEST_F(RocksDBDriverTest, UpsertDocsAtomic)
+{
+    ASSERT_FALSE(m_driver->createDoc(TEST_NAME, TEST_JSON));
+
+    // The second document cannot be written, none is written
+    ASSERT_TRUE(m_driver->upsertDocs({{base::Name("x/y"), TEST_JSON}, {TEST_NAME + "child", TEST_JSON}}));
+    ASSERT_FALSE(m_driver->exists(base::Name("x")));
+
+    // A document of the batch is the parent of another
+    ASSERT_TRUE(m_driver->upsertDocs({{base::Name("x/y"), TEST_JSON}, {base::Name("x/y/z"), TEST_JSON}}));
+    ASSERT_FALSE(m_driver->exists(base::Name("x")));
+
+    ASSERT_FALSE(m_driver->upsertDocs({{base::Name("x/y"), TEST_JSON}, {TEST_NAME, TEST_JSON2}}));
+    ASSERT_TRUE(m_driver->existsDoc(base::Name("x/y")));
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON2);
+}
+
+TEST_F(RocksDBDriverTest, ImportFromFileDriver)
+{
+    const auto filePath = m_path / "files";
+    FileDriver fileDriver(filePath, true);
+    ASSERT_FALSE(fileDriver.createDoc(TEST_NAME, TEST_JSON));
+    ASSERT_FALSE(fileDriver.createDoc(TEST_NAME_COLLECTION + "other", TEST_JSON2));
+    ASSERT_FALSE(fileDriver.createDoc(base::Name("root"), TEST_JSON));
+
+    auto imported = m_driver->importFrom(fileDriver);
+    ASSERT_FALSE(base::isError(imported));
+    ASSERT_EQ(base::getResponse<std::size_t>(imported), 3);
+
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME)), TEST_JSON);
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(TEST_NAME_COLLECTION + "other")), TEST_JSON2);
+    ASSERT_EQ(base::getResponse<store::Doc>(m_driver->readDoc(base::Name("root"))), TEST_JSON);
+}
@@ -234,6 +234,39 @@ TEST_F(StoreTest, ReadDoc_ok)
     ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
 }
 
+TEST_F(StoreTest, ReadDoc_cached)
+{
+    EXPECT_CALL(*driver, readDoc(rDoc_1A)).WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+
+    // Read from the cache
+    auto res = store->readDoc(doc_1A);
+    ASSERT_FALSE(base::isError(res));
+    ASSERT_EQ(std::get<Doc>(res), jdoc_1A);
+}
+
+TEST_F(StoreTest, ReadDoc_cacheDroppedOnWrite)
+{
+    const json::Json jdoc_1A_v2 {R"({"name": "doc_1A", "version": 2})"};
+    EXPECT_CALL(*driver, readDoc(rDoc_1A))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A_v2))))
+        .WillOnce(testing::Return(driverReadDocResp(Doc(jdoc_1A))));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1A_v2)).WillOnce(testing::Return(driverOk()));
+    EXPECT_CALL(*driver, upsertDoc(rDoc_1A, jdoc_1A)).WillOnce(testing::Return(driverOk()));
+
+    ASSERT_FALSE(base::isError(store->readDoc(doc_1A)));
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1A_v2)));
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1A_v2);
+
+    ASSERT_FALSE(base::isError(store->upsertDoc(doc_1A, NamespaceId("ns1"), jdoc_1A)));
+    ASSERT_EQ(std::get<Doc>(store->readDoc(doc_1A)), jdoc_1A);
+
+    EXPECT_CALL(*driver, deleteDoc(rDoc_1A)).WillOnce(testing::Return(driverOk()));
+    ASSERT_FALSE(base::isError(store->deleteDoc(doc_1A)));
+    ASSERT_TRUE(base::isError(store->readDoc(doc_1A)));
+}
+
 /*******************************************************************************
                         Store::readCol
 *******************************************************************************/
@@ -638,3 +671,45 @@ TEST_F(StoreTest, readInternalCol_ok)
     ASSERT_EQ(std::get<Col>(res).size(), 1);
     ASSERT_EQ(std::get<Col>(res)[0], base::Name("a"));
 }
+
+/*******************************************************************************
+                        Store::subscribe
+*******************************************************************************/
+TEST_F(StoreTest, subscribe_notifyChanges)
+{
+    std::vector<std::pair<base::Name, DocChange>> changes;
+    const auto id = store->subscribe([&](const base::Name& name, DocChange change)
+                                     { changes.emplace_back(name, change); });
+
+    EXPECT_CALL(*driver, createDoc(addPrefix("ns1/colC/doc_1C"), jdoc_1A)).WillOnce(testing::Return(driverOk()));
+    EXPECT_CALL(*driver, updateDoc(rDoc_1A, jdoc_1A))
+        .WillOnce(testing::Return(driverOk()))
+        .WillOnce(testing::Return(driverError()))
+        .WillOnce(testing::Return(driverOk()));
+    EXPECT_CALL(*driver, deleteDoc(rDoc_1B)).WillOnce(testing::Return(driverOk()));
+    EXPECT_CALL(*driver, deleteCol(addPrefix("ns2/colA"))).WillOnce(testing::Return(driverOk()));
+
+    ASSERT_FALSE(base::isError(store->createDoc("colC/doc_1C", NamespaceId("ns1"), jdoc_1A)));
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+    ASSERT_FALSE(base::isError(store->deleteDoc(doc_1B)));
+    ASSERT_FALSE(base::isError(store->deleteCol("colA", NamespaceId("ns2"))));
+
+    // Failed writes are not notified
+    ASSERT_TRUE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+
+    const std::vector<std::pair<base::Name, DocChange>> expected {{"colC/doc_1C", DocChange::CREATED},
+                                                                  {doc_1A, DocChange::UPDATED},
+                                                                  {doc_1B, DocChange::DELETED},
+                                                                  {doc_2A, DocChange::DELETED}};
+    ASSERT_EQ(changes, expected);
+
+    // Not notified after unsubscribing
+    store->unsubscribe(id);
+    ASSERT_FALSE(base::isError(store->updateDoc(doc_1A, jdoc_1A)));
+    ASSERT_EQ(changes.size(), expected.size());
+}
+
+TEST_F(StoreTest, subscribe_emptyHandler)
+{
+    ASSERT_THROW(store->subscribe(nullptr), std::runtime_error);
+}
@@ -12,17 +12,43 @@
 #ifndef _SCAN_ORCHESTRATOR_HPP
 #define _SCAN_ORCHESTRATOR_HPP
 
+#include "base/shardedCache.hpp"
 #include "databaseFeedManager.hpp"
+#include <cstddef>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <nlohmann/json_fwd.hpp>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 enum class PayloadType
 {
     PackageList = 0,
-    FullScan = 1
+    FullScan = 1,
+    Delta = 2
 };
 
+/**
+ * @brief Fingerprint of the last scanned inventory of an agent.
+ *
+ * @details Delta scans rescan only the packages whose fingerprint differs from the last scanned one. Every package is
+ * rescanned when the OS, the hotfixes or the feed changed since then, as any verdict may be different.
+ */
+struct InventoryFingerprint final
+{
+    size_t contextHash;                                   ///< Hash of the OS and hotfixes data.
+    uint64_t feedGeneration;                              ///< Feed generation the inventory was scanned against.
+    std::vector<std::pair<std::string, size_t>> packages; ///< Package item ids and data hashes, sorted by item id.
+};
+
+class ResponseWriter;
+
+// Amount of agents whose last scanned inventory is kept for delta scans.
+auto constexpr INVENTORY_CACHE_SIZE {4096};
+
 /**
  * @brief ScanOrchestrator class.
  *
@@ -30,6 +56,8 @@ enum class PayloadType
 class ScanOrchestrator final
 {
 public:
+    using ChunkHandler = std::function<void(std::string_view)>;
+
     /**
      * @brief Class constructor.
      *
@@ -47,18 +75,55 @@ public:
      */
     void processEvent(const std::string& request, std::string& response) const;
 
+    /**
+     * @brief Process an event, streaming the response as the detections are found.
+     *
+     * @param request Event to process.
+     * @param chunkHandler Receives the response in consecutive chunks.
+     */
+    void processEvent(const std::string& request, const ChunkHandler& chunkHandler) const;
+
 private:
+    /**
+     * @brief Decodes a request and writes its response.
+     *
+     * @param request Event to process.
+     * @param writer Response writer.
+     */
+    void process(const std::string& request, ResponseWriter& writer) const;
+
     /**
      * @brief Runs orchestrator, decoding and building context.
      *
-     * @param data Data to process.
-     * @param response Raw data to process.
+     * @param type Scan type.
+     * @param request Scan request.
+     * @param writer Response writer.
      */
-    void run(PayloadType type, const nlohmann::json& request, std::string& response) const;
+    void run(PayloadType type, const nlohmann::json& request, ResponseWriter& writer) const;
 
     std::shared_ptr<DatabaseFeedManager> m_databaseFeedManager;
     mutable std::shared_mutex m_mutex;
     nlohmann::json m_configuration;
+    size_t m_scanThreads; ///< Maximum amount of threads used to scan the packages of a request.
+
+    /**
+     * @brief Gets the fingerprint of the last scanned inventory of an agent.
+     *
+     * @param agentId Agent id.
+     * @return Inventory fingerprint, nullptr if unknown.
+     */
+    std::shared_ptr<const InventoryFingerprint> lastFingerprint(const std::string& agentId) const;
+
+    /**
+     * @brief Stores the fingerprint of the last scanned inventory of an agent.
+     *
+     * @param agentId Agent id.
+     * @param inventory Inventory fingerprint.
+     */
+    void storeFingerprint(const std::string& agentId, std::shared_ptr<const InventoryFingerprint> inventory) const;
+
+    mutable base::ShardedCache<std::string, std::shared_ptr<const InventoryFingerprint>> m_inventories {
+        INVENTORY_CACHE_SIZE}; ///< Last scanned inventory fingerprint of each agent.
 };
 
 #endif // _SCAN_ORCHESTRATOR_HPP
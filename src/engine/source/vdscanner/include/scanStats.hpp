@@ -0,0 +1,156 @@
+/*
+ * Wazuh Vulnerability scanner - Scan statistics
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SCAN_STATS_HPP
+#define _SCAN_STATS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Stages of a scan whose time is measured.
+ */
+enum class ScanStage : size_t
+{
+    Translation = 0,      ///< Translation of the package to the names of the feed.
+    CandidateLookup = 1,  ///< Lookup of the vulnerability candidates in the feed.
+    VersionMatch = 2,     ///< Verification and version match of each candidate.
+    ResponseBuilding = 3, ///< Building of the detections with their descriptive information.
+    Count = 4
+};
+
+/**
+ * @brief Time spent in each stage of the scans, accumulated by all the threads.
+ *
+ * @details Disabled by default, so the scans don't read the clock unless a benchmark asks for it. The time of a stage
+ * doesn't include the one of the stages it runs, e.g. the candidate lookup excludes the match of the candidates.
+ */
+class ScanStats final
+{
+public:
+    /**
+     * @brief Accumulated time of a stage.
+     */
+    struct Totals final
+    {
+        uint64_t count;       ///< Times the stage ran.
+        uint64_t nanoseconds; ///< Time spent in the stage.
+    };
+
+    /**
+     * @brief Gets the statistics of the process.
+     */
+    static ScanStats& instance()
+    {
+        static ScanStats stats;
+        return stats;
+    }
+
+    void enable(const bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+    bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Accounts a run of a stage.
+     *
+     * @param stage Stage.
+     * @param nanoseconds Time spent in the stage.
+     */
+    void add(const ScanStage stage, const uint64_t nanoseconds)
+    {
+        auto& counter = m_stages[static_cast<size_t>(stage)];
+        counter.count.fetch_add(1, std::memory_order_relaxed);
+        counter.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    Totals totals(const ScanStage stage) const
+    {
+        const auto& counter = m_stages[static_cast<size_t>(stage)];
+        return {counter.count.load(std::memory_order_relaxed), counter.nanoseconds.load(std::memory_order_relaxed)};
+    }
+
+    void reset()
+    {
+        for (auto& counter : m_stages)
+        {
+            counter.count.store(0, std::memory_order_relaxed);
+            counter.nanoseconds.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct Counter final
+    {
+        std::atomic<uint64_t> count {0};
+        std::atomic<uint64_t> nanoseconds {0};
+    };
+
+    ScanStats() = default;
+
+    std::atomic<bool> m_enabled {false};
+    std::array<Counter, static_cast<size_t>(ScanStage::Count)> m_stages;
+};
+
+/**
+ * @brief Measures the time of a stage while in scope, if the statistics are enabled.
+ */
+class ScanStageTimer final
+{
+public:
+    explicit ScanStageTimer(const ScanStage stage)
+        : m_stage {stage}
+        , m_enabled {ScanStats::instance().enabled()}
+    {
+        if (m_enabled)
+        {
+            m_outerNested = nestedNanoseconds();
+            nestedNanoseconds() = 0;
+            m_start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScanStageTimer()
+    {
+        if (m_enabled)
+        {
+            const auto elapsed = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start)
+                    .count());
+            const auto nested = nestedNanoseconds();
+            ScanStats::instance().add(m_stage, elapsed > nested ? elapsed - nested : 0);
+
+            // The enclosing stage, if any, doesn't account this one.
+            nestedNanoseconds() = m_outerNested + elapsed;
+        }
+    }
+
+    ScanStageTimer(const ScanStageTimer&) = delete;
+    ScanStageTimer& operator=(const ScanStageTimer&) = delete;
+
+private:
+    /**
+     * @brief Time of the stages run by the current one on this thread.
+     */
+    static uint64_t& nestedNanoseconds()
+    {
+        thread_local uint64_t nanoseconds {0};
+        return nanoseconds;
+    }
+
+    ScanStage m_stage;
+    bool m_enabled;
+    uint64_t m_outerNested {0};
+    std::chrono::steady_clock::time_point m_start;
+};
+
+#endif // _SCAN_STATS_HPP
@@ -15,6 +15,7 @@
 #include "base/utils/chainOfResponsability.hpp"
 #include "databaseFeedManager.hpp"
 #include "scanContext.hpp"
+#include "scanStats.hpp"
 #include "scannerHelper.hpp"
 #include "versionMatcher/versionMatcher.hpp"
 
@@ -52,14 +53,15 @@ public:
     // LCOV_EXCL_START
     std::shared_ptr<ScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        const auto hotfixes = data->hotfixes();
+        const auto& hotfixes = data->hotfixes();
 
-        const auto osCPE = ScannerHelper::parseCPE(data->osCPEName(m_databaseFeedManager->cpeMappings()).data());
+        const auto osCPE = ScannerHelper::parseCPE(data->osCPEName(m_databaseFeedManager->osMappingIndex()).data());
 
         auto vulnerabilityScan = [&](const std::string& cnaName,
                                      const PackageData& package,
                                      const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData)
         {
+            ScanStageTimer timer {ScanStage::VersionMatch};
             try
             {
                 VersionObjectType objectType = VersionObjectType::DPKG;
@@ -243,21 +245,20 @@ public:
                 {
                     PackageData package = {.name = osCPE.product};
 
-                    m_databaseFeedManager->getVulnerabilitiesCandidates("nvd", package, vulnerabilityScan);
+                    {
+                        ScanStageTimer timer {ScanStage::CandidateLookup};
+                        m_databaseFeedManager->getVulnerabilitiesCandidates("nvd", package, vulnerabilityScan);
+                    }
 
                     if (data->osPlatform() == "windows")
                     {
-                        std::vector<std::string> cvesRemediated;
+                        const auto remediations = m_databaseFeedManager->getHotfixRemediations(hotfixes);
 
                         auto it = data->m_elements.begin();
                         while (it != data->m_elements.end())
                         {
                             const auto& cve = it->first;
-                            FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo> remediations {};
-                            m_databaseFeedManager->getVulnerabilityRemediation(cve, remediations);
-
-                            if (remediations.data == nullptr || remediations.data->updates() == nullptr
-                                || remediations.data->updates()->size() == 0)
+                            if (!remediations.hasRemediation(cve))
                             {
                                 LOG_DEBUG(
                                     "No remediation available for OS '{}' on Agent '{}' for CVE: '{}', discarding.",
@@ -268,34 +269,18 @@ public:
                                 continue;
                             }
 
-                            for (const auto& remediation : *(remediations.data->updates()))
+                            // Delete element if the update is already installed
+                            if (remediations.isRemediated(cve))
                             {
-                                // Delete element if the update is already installed
-                                if (std::find_if(hotfixes.begin(),
-                                                 hotfixes.end(),
-                                                 [&](const auto& element) {
-                                                     return element.template get_ref<const std::string&>()
-                                                            == remediation->str();
-                                                 })
-                                    != hotfixes.end())
-                                {
-                                    LOG_DEBUG("Remediation for OS '{}' on Agent '{}' has been found. CVE: '{}', "
-                                              "Remediation: '{}'.",
-                                              osCPE.product,
-                                              data->agentId(),
-                                              cve,
-                                              remediation->str());
-                                    cvesRemediated.push_back(cve);
-                                    break;
-                                }
+                                LOG_DEBUG("Remediation for OS '{}' on Agent '{}' has been found. CVE: '{}'.",
+                                          osCPE.product,
+                                          data->agentId(),
+                                          cve);
+                                it = data->m_elements.erase(it);
+                                continue;
                             }
                             ++it;
                         }
-
-                        for (const auto& cve : cvesRemediated)
-                        {
-                            data->m_elements.erase(cve);
-                        }
                     }
                 }
             }
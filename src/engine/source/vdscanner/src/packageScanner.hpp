@@ -13,18 +13,41 @@
 #define _PACKAGE_SCANNER_HPP
 
 #include "base/logging.hpp"
+#include "base/shardedCache.hpp"
 #include "base/utils/chainOfResponsability.hpp"
 #include "base/utils/stringUtils.hpp"
 #include "databaseFeedManager.hpp"
 #include "scanContext.hpp"
+#include "scanStats.hpp"
 #include "scannerHelper.hpp"
 #include "versionMatcher/versionMatcher.hpp"
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
 #include <variant>
+#include <vector>
 
 auto constexpr DEFAULT_CNA {"nvd"};
 auto constexpr L1_CACHE_SIZE {2048};
 
+/**
+ * @brief Result of a package scan: the CVEs the package is vulnerable to, with the condition that matched each one.
+ */
+using PackageScanVerdict = std::vector<std::pair<std::string, MatchCondition>>;
+
+/**
+ * @brief Installed version of the scanned package, parsed once for all the vulnerability candidates.
+ */
+struct ParsedPackageVersion
+{
+    std::string version;                    ///< Version string.
+    std::string format;                     ///< Package format the version was parsed for.
+    std::shared_ptr<IVersionObject> object; ///< Parsed version, nullptr if it doesn't match the format.
+    bool parsed {false};                    ///< Whether the fields above are set.
+};
+
 /**
  * @brief PackageScanner class.
  * This class is responsible for scanning the package and checking if it is vulnerable.
@@ -57,6 +80,107 @@ private:
 
     std::shared_ptr<TDatabaseFeedManager> m_databaseFeedManager;
 
+    /**
+     * @brief Verdicts of the packages already scanned, shared by all the agents.
+     *
+     * @note Agents running the same OS image report the same packages, so most scans after the first one are
+     * answered from here. The cache is emptied when the feed generation changes.
+     */
+    base::ShardedCache<std::string, PackageScanVerdict> m_verdictCache {L1_CACHE_SIZE};
+    uint64_t m_verdictGeneration {0}; ///< Feed generation of the cached verdicts.
+    std::shared_mutex m_verdictMutex; ///< Guards the generation, exclusive only to empty the cache.
+
+    /**
+     * @brief Builds the verdict cache key of a package scan.
+     *
+     * The key holds every input the verdict depends on: the CNA, the package identity and the OS fields used for
+     * the translation and the platform verification.
+     *
+     * @param cnaName CNA name.
+     * @param ctx Scan context.
+     * @return std::string Cache key.
+     */
+    std::string verdictKey(const std::string& cnaName, const std::shared_ptr<TScanContext>& ctx) const
+    {
+        std::string key;
+        for (const auto field : {std::string_view(cnaName),
+                                 ctx->packageName(),
+                                 ctx->packageVendor(),
+                                 ctx->packageVersion(),
+                                 ctx->packageFormat(),
+                                 ctx->osPlatform(),
+                                 ctx->osName(),
+                                 ctx->osCodeName(),
+                                 ctx->osMajorVersion(),
+                                 ctx->osMinorVersion(),
+                                 ctx->osVersion(),
+                                 ctx->osRelease(),
+                                 ctx->osDisplayVersion()})
+        {
+            key.append(field);
+            // Separator that can't appear in the fields, so different splits never produce the same key.
+            key.push_back('\0');
+        }
+        return key;
+    }
+
+    /**
+     * @brief Fills the scan context with a cached verdict.
+     *
+     * @param key Verdict cache key.
+     * @param generation Current feed generation.
+     * @param ctx Scan context.
+     * @return true if the verdict was cached, false otherwise.
+     */
+    bool restoreVerdict(const std::string& key, const uint64_t generation, const std::shared_ptr<TScanContext>& ctx)
+    {
+        std::shared_lock lock(m_verdictMutex);
+        if (generation != m_verdictGeneration)
+        {
+            lock.unlock();
+            std::unique_lock clearLock(m_verdictMutex);
+            if (generation != m_verdictGeneration)
+            {
+                // The feed was updated, the cached verdicts may be outdated.
+                m_verdictCache.clear();
+                m_verdictGeneration = generation;
+            }
+            return false;
+        }
+
+        // The cache is thread-safe, scans of different packages only share the lock.
+        const auto verdict = m_verdictCache.getValue(key);
+        if (!verdict.has_value())
+        {
+            return false;
+        }
+
+        for (const auto& [cveId, matchCondition] : verdict.value())
+        {
+            ctx->m_elements[cveId] = nlohmann::json::object();
+            ctx->m_matchConditions[cveId] = matchCondition;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Stores the verdict of a package scan.
+     *
+     * @param key Verdict cache key.
+     * @param generation Feed generation used for the scan.
+     * @param ctx Scan context.
+     */
+    void storeVerdict(const std::string& key, const uint64_t generation, const std::shared_ptr<TScanContext>& ctx)
+    {
+        const PackageScanVerdict verdict(ctx->m_matchConditions.begin(), ctx->m_matchConditions.end());
+
+        std::shared_lock lock(m_verdictMutex);
+        if (generation == m_verdictGeneration)
+        {
+            m_verdictCache.insertKey(key, verdict);
+        }
+    }
+
     /**
      * @brief Scans package translation for vulnerabilities.
      *
@@ -80,7 +204,11 @@ private:
                                  const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& vulnerabilityScan)
     {
         const auto osPlatform = data->osPlatform().data();
-        const auto translations = m_databaseFeedManager->checkAndTranslatePackage(packageCandidate, osPlatform);
+        const auto translations = [&]()
+        {
+            ScanStageTimer timer {ScanStage::Translation};
+            return m_databaseFeedManager->checkAndTranslatePackage(packageCandidate, osPlatform);
+        }();
 
         auto scanPackage = [this, &data, &cnaName, &vulnerabilityScan](const PackageData& package)
         {
@@ -94,6 +222,7 @@ private:
                       data->agentId(),
                       data->agentVersion());
 
+            ScanStageTimer timer {ScanStage::CandidateLookup};
             m_databaseFeedManager->getVulnerabilitiesCandidates(cnaName, package, vulnerabilityScan);
         };
 
@@ -144,57 +273,7 @@ private:
             }
         }
 
-        const auto mapping = m_databaseFeedManager->cnaMappings();
-
-        const auto& cnaMapping = mapping.at("cnaMapping");
-        const auto platformEquivalence = [&](const std::string& platform) -> const std::string&
-        {
-            const auto& platformMapping = mapping.at("platformEquivalence");
-            if (const auto it = platformMapping.find(platform); it == platformMapping.end())
-            {
-                return platform;
-            }
-            else
-            {
-                return it->template get_ref<const std::string&>();
-            }
-        };
-
-        const auto majorVersionEquivalence = [&](const std::string& platform,
-                                                 const std::string& majorVersion) -> const std::string&
-        {
-            const auto& majorVersionMapping = mapping.at("majorVersionEquivalence");
-            if (const auto itPlatform = majorVersionMapping.find(platform); itPlatform == majorVersionMapping.end())
-            {
-                return majorVersion;
-            }
-            else
-            {
-                if (const auto itMajorVersion = itPlatform->find(majorVersion); itMajorVersion == itPlatform->end())
-                {
-                    return majorVersion;
-                }
-                else
-                {
-                    return itMajorVersion->template get_ref<const std::string&>();
-                }
-            }
-        };
-
-        if (const auto it = cnaMapping.find(cnaName); it == cnaMapping.end())
-        {
-            return cnaName;
-        }
-        else
-        {
-            std::string base = it->template get<std::string>();
-            base::utils::string::replaceAll(base, "$(PLATFORM)", platformEquivalence(ctx->osPlatform().data()));
-            base::utils::string::replaceAll(
-                base,
-                "$(MAJOR_VERSION)",
-                majorVersionEquivalence(ctx->osPlatform().data(), ctx->osMajorVersion().data()));
-            return base;
-        }
+        return m_databaseFeedManager->osMappingIndex().cnaName(cnaName, ctx->osPlatform(), ctx->osMajorVersion());
     }
 
     bool platformVerify(const std::string& cnaName,
@@ -205,7 +284,7 @@ private:
         // if the platforms are not empty, we need to check if the platform is in the list.
         if (callbackData.platforms())
         {
-            auto agentOsCpe = contextData->osCPEName(m_databaseFeedManager->cpeMappings());
+            auto agentOsCpe = contextData->osCPEName(m_databaseFeedManager->osMappingIndex());
             bool matchPlatform {false};
             for (const auto& platform : *callbackData.platforms())
             {
@@ -312,7 +391,8 @@ private:
     bool versionMatch(const std::string& cnaName,
                       const PackageData& package,
                       const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData,
-                      std::shared_ptr<TScanContext> contextData)
+                      std::shared_ptr<TScanContext> contextData,
+                      ParsedPackageVersion& installedVersion)
     {
         std::variant<VersionObjectType, VersionMatcherStrategy> objectType = VersionMatcherStrategy::Unspecified;
         if (const auto it = m_packageMap.find(package.format); it != m_packageMap.end())
@@ -320,6 +400,14 @@ private:
             objectType = it->second;
         }
 
+        // The installed version is the same for all the candidates of the package, parse it only once.
+        if (!installedVersion.parsed || installedVersion.version != package.version
+            || installedVersion.format != package.format)
+        {
+            installedVersion = {
+                package.version, package.format, VersionMatcher::parse(package.version, objectType), true};
+        }
+
         for (const auto& version : *callbackData.versions())
         {
             const std::string packageVersion {package.version};
@@ -341,7 +429,7 @@ private:
             // No version range specified, check if the installed version is equal to the required version.
             if (versionStringLessThan.empty() && versionStringLessThanOrEqual.empty())
             {
-                if (VersionMatcher::compare(packageVersion, versionString, objectType)
+                if (VersionMatcher::compare(installedVersion.object, packageVersion, versionString, objectType)
                     == VersionComparisonResult::A_EQUAL_B)
                 {
                     // Version match found, the package status is defined by the vulnerability status.
@@ -378,7 +466,8 @@ private:
                 }
                 else
                 {
-                    const auto matchResult = VersionMatcher::compare(packageVersion, versionString, objectType);
+                    const auto matchResult =
+                        VersionMatcher::compare(installedVersion.object, packageVersion, versionString, objectType);
                     lowerBoundMatch = matchResult == VersionComparisonResult::A_GREATER_THAN_B
                                       || matchResult == VersionComparisonResult::A_EQUAL_B;
                 }
@@ -389,14 +478,14 @@ private:
                     auto upperBoundMatch = false;
                     if (!versionStringLessThan.empty() && versionStringLessThan.compare("*") != 0)
                     {
-                        const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThan, objectType);
+                        const auto matchResult = VersionMatcher::compare(
+                            installedVersion.object, packageVersion, versionStringLessThan, objectType);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B;
                     }
                     else if (!versionStringLessThanOrEqual.empty())
                     {
-                        const auto matchResult =
-                            VersionMatcher::compare(packageVersion, versionStringLessThanOrEqual, objectType);
+                        const auto matchResult = VersionMatcher::compare(
+                            installedVersion.object, packageVersion, versionStringLessThanOrEqual, objectType);
                         upperBoundMatch = matchResult == VersionComparisonResult::A_LESS_THAN_B
                                           || matchResult == VersionComparisonResult::A_EQUAL_B;
                     }
@@ -480,54 +569,76 @@ private:
         return false;
     }
 
-    bool packageHotfixSolved(const std::string& cnaName,
-                             const PackageData& package,
-                             const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData,
-                             std::shared_ptr<TScanContext> contextData)
+    /**
+     * @brief Removes the matched vulnerabilities solved by a hotfix installed on the agent.
+     *
+     * The remediations of all the matched CVEs are retrieved at once, after the scan of the package.
+     *
+     * @param contextData Scan context.
+     */
+    void removeHotfixSolved(std::shared_ptr<TScanContext> contextData)
     {
-        FlatbufferDataPair<NSVulnerabilityScanner::RemediationInfo> remediations {};
-        m_databaseFeedManager->getVulnerabilityRemediation(callbackData.cveId()->str(), remediations);
-
-        if (remediations.data == nullptr || remediations.data->updates() == nullptr
-            || remediations.data->updates()->size() == 0)
+        if (contextData->m_elements.empty())
         {
-            return false;
+            return;
         }
 
         // Check that the agent has remediation data.
-        auto agentRemediations = contextData->hotfixes();
+        const auto& agentRemediations = contextData->hotfixes();
         if (agentRemediations.empty())
         {
             LOG_DEBUG("No remediations for agent '{}' have been found.", contextData->agentId());
-            return false;
+            return;
         }
 
-        for (const auto& remediation : *(remediations.data->updates()))
+        std::vector<std::string> cveIds;
+        cveIds.reserve(contextData->m_elements.size());
+        for (const auto& [cveId, element] : contextData->m_elements)
         {
-            // Check if the remediation is installed on the agent.
-            for (const auto& hotfix : agentRemediations)
-            {
-                if (hotfix.template get_ref<const std::string&>().compare(remediation->str()) == 0)
-                {
-                    LOG_DEBUG("Remediation '{}' for package '{}' on agent '{}' that solves CVE '{}' has been found.",
-                              remediation->str(),
-                              package.name,
-                              contextData->agentId(),
-                              callbackData.cveId()->str());
+            cveIds.push_back(cveId);
+        }
 
-                    contextData->m_elements.erase(callbackData.cveId()->str());
-                    contextData->m_matchConditions.erase(callbackData.cveId()->str());
-                    return true;
-                }
+        VulnerabilityRemediations remediations;
+        m_databaseFeedManager->getVulnerabilitiesRemediation(cveIds, remediations);
+
+        for (const auto& cveId : cveIds)
+        {
+            const auto it = remediations.find(cveId);
+            if (it == remediations.end() || it->second.data == nullptr || it->second.data->updates() == nullptr)
+            {
+                continue;
             }
-        }
 
-        LOG_DEBUG("No remediation for package '{}' on agent '{}' that solves CVE '{}' has been found.",
-                  package.name,
-                  contextData->agentId(),
-                  callbackData.cveId()->str());
+            // Check if any remediation is installed on the agent.
+            const auto installed = [&agentRemediations](const auto* remediation)
+            {
+                const auto name = remediation->str();
+                return std::any_of(agentRemediations.begin(),
+                                   agentRemediations.end(),
+                                   [&name](const auto& hotfix)
+                                   { return hotfix.template get_ref<const std::string&>() == name; });
+            };
+            const auto solved =
+                std::any_of(it->second.data->updates()->begin(), it->second.data->updates()->end(), installed);
+
+            if (solved)
+            {
+                LOG_DEBUG("Remediation for package '{}' on agent '{}' that solves CVE '{}' has been found.",
+                          contextData->packageName(),
+                          contextData->agentId(),
+                          cveId);
 
-        return false;
+                contextData->m_elements.erase(cveId);
+                contextData->m_matchConditions.erase(cveId);
+            }
+            else
+            {
+                LOG_DEBUG("No remediation for package '{}' on agent '{}' that solves CVE '{}' has been found.",
+                          contextData->packageName(),
+                          contextData->agentId(),
+                          cveId);
+            }
+        }
     }
 
 public:
@@ -551,10 +662,13 @@ public:
      */
     std::shared_ptr<TScanContext> handleRequest(std::shared_ptr<TScanContext> data) override
     {
-        auto vulnerabilityScan = [&data, this](const std::string& cnaName,
-                                               const PackageData& package,
-                                               const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData)
+        ParsedPackageVersion installedVersion;
+        auto vulnerabilityScan =
+            [&data, &installedVersion, this](const std::string& cnaName,
+                                             const PackageData& package,
+                                             const NSVulnerabilityScanner::ScanVulnerabilityCandidate& callbackData)
         {
+            ScanStageTimer timer {ScanStage::VersionMatch};
             try
             {
                 /* Preliminary verifications before version matching. We return if the basic conditions are not met. */
@@ -572,16 +686,9 @@ public:
                 }
 
                 /* Real version analysis of the candidate. */
-                if (versionMatch(cnaName, package, callbackData, data))
+                if (versionMatch(cnaName, package, callbackData, data, installedVersion))
                 {
-                    // The candidate version matches the package. Post-match filtering.
-                    if (data->osPlatform().compare("windows") == 0
-                        && packageHotfixSolved(cnaName, package, callbackData, data))
-                    {
-                        // An installed hotfix solves the vulnerability.
-                        return false;
-                    }
-
+                    // The candidate version matches the package. The hotfixes are checked once the scan is done.
                     return true;
                 }
 
@@ -602,20 +709,43 @@ public:
 
         const auto CNAValue = getCNA(data);
 
-        try
+        // Windows verdicts depend on the hotfixes installed on each agent, so they can't be shared.
+        const auto useVerdictCache = data->osPlatform().compare("windows") != 0;
+        const auto key = useVerdictCache ? verdictKey(CNAValue, data) : std::string {};
+        const auto generation = useVerdictCache ? m_databaseFeedManager->feedGeneration() : 0;
+
+        if (useVerdictCache && restoreVerdict(key, generation, data))
         {
-            PackageData package = {.name = data->packageName().data(),
-                                   .vendor = data->packageVendor().data(),
-                                   .format = data->packageFormat().data(),
-                                   .version = data->packageVersion().data()};
-            scanPackageTranslation(CNAValue, data, package, vulnerabilityScan);
+            LOG_DEBUG("Verdict for package '{}' on Agent '{}' found in cache.", data->packageName(), data->agentId());
         }
-        catch (const std::exception& e)
+        else
         {
-            LOG_WARNING("Failed to scan package: '{}', CVE Numbering Authorities (CNA): '{}', Error: '{}'.",
-                        data->packageName(),
-                        CNAValue,
-                        e.what());
+            try
+            {
+                PackageData package = {.name = data->packageName().data(),
+                                       .vendor = data->packageVendor().data(),
+                                       .format = data->packageFormat().data(),
+                                       .version = data->packageVersion().data()};
+                scanPackageTranslation(CNAValue, data, package, vulnerabilityScan);
+
+                // Post-match filtering, an installed hotfix may solve the vulnerabilities.
+                if (!useVerdictCache)
+                {
+                    removeHotfixSolved(data);
+                }
+
+                if (useVerdictCache)
+                {
+                    storeVerdict(key, generation, data);
+                }
+            }
+            catch (const std::exception& e)
+            {
+                LOG_WARNING("Failed to scan package: '{}', CVE Numbering Authorities (CNA): '{}', Error: '{}'.",
+                            data->packageName(),
+                            CNAValue,
+                            e.what());
+            }
         }
 
         // Vulnerability scan ended for agent and package...
@@ -19,6 +19,7 @@
 #include "base/utils/timeUtils.hpp"
 #include "databaseFeedManager.hpp"
 #include "scanContext.hpp"
+#include "scanStats.hpp"
 
 /**
  * @brief TResponseBuilder class.
@@ -143,15 +144,27 @@ public:
             throw std::invalid_argument("Package item id is empty");
         }
 
+        ScanStageTimer timer {ScanStage::ResponseBuilding};
         nlohmann::json dataElements = nlohmann::json::array();
 
-        // For each element, we get the vulnerability descriptive information and build the event details.
+        // The descriptive information of all the elements is retrieved at once.
+        std::vector<std::string> cveIds;
+        cveIds.reserve(data->m_elements.size());
+        for (const auto& [cve, json] : data->m_elements)
+        {
+            cveIds.push_back(cve);
+        }
+
+        VulnerabilityDescriptions descriptions;
+        m_databaseFeedManager->getVulnerabilitiesDescriptiveInformation(cveIds, descriptions);
+
+        // For each element, we build the event details from its vulnerability descriptive information.
         for (auto& [cve, json] : data->m_elements)
         {
-            FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription> returnData;
-            m_databaseFeedManager->getVulnerabiltyDescriptiveInformation(cve, returnData);
-            if (returnData.data)
+            const auto description = descriptions.find(cve);
+            if (description != descriptions.end() && description->second.data)
             {
+                const auto& returnData = description->second;
                 switch (data->scannerType())
                 {
                     case ScannerType::Package:
@@ -0,0 +1,209 @@
+/*
+ * Wazuh Vulnerability scanner - Response Writer
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _RESPONSE_WRITER_HPP
+#define _RESPONSE_WRITER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Amount of serialized data handed over at once when streaming a response.
+auto constexpr RESPONSE_CHUNK_SIZE {64 * 1024};
+
+/**
+ * @brief ResponseWriter class.
+ * Serializes a scan response as its values are appended, so the whole response is never held as a JSON tree. The
+ * output is the same as dumping the equivalent tree.
+ *
+ * When a chunk handler is set, the serialized data is handed over each time it reaches the chunk size, and the writer
+ * keeps at most one chunk. Otherwise, the whole response is kept and can be taken once written.
+ */
+class ResponseWriter final
+{
+public:
+    using ChunkHandler = std::function<void(std::string_view)>;
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param chunkHandler Receives the serialized data in chunks. If empty, the data is kept in the writer.
+     * @param chunkSize Amount of data handed over at once.
+     */
+    explicit ResponseWriter(ChunkHandler chunkHandler = nullptr, size_t chunkSize = RESPONSE_CHUNK_SIZE)
+        : m_chunkHandler {std::move(chunkHandler)}
+        , m_chunkSize {chunkSize}
+    {
+    }
+
+    /**
+     * @brief Opens an object.
+     */
+    void beginObject()
+    {
+        separate();
+        m_buffer.push_back('{');
+        m_scopes.push_back({'}', true});
+    }
+
+    /**
+     * @brief Closes the current object.
+     */
+    void endObject() { close('}'); }
+
+    /**
+     * @brief Opens an array.
+     */
+    void beginArray()
+    {
+        separate();
+        m_buffer.push_back('[');
+        m_scopes.push_back({']', true});
+    }
+
+    /**
+     * @brief Closes the current array.
+     */
+    void endArray() { close(']'); }
+
+    /**
+     * @brief Writes the key of the next value of the current object.
+     *
+     * @param name Key name.
+     */
+    void key(std::string_view name)
+    {
+        if (m_scopes.empty() || m_scopes.back().closing != '}' || m_afterKey)
+        {
+            throw std::logic_error("Response key outside of an object");
+        }
+
+        if (!m_scopes.back().empty)
+        {
+            m_buffer.push_back(',');
+        }
+        m_scopes.back().empty = false;
+        m_buffer.append(nlohmann::json(name).dump());
+        m_buffer.push_back(':');
+        m_afterKey = true;
+    }
+
+    /**
+     * @brief Writes a value.
+     *
+     * @param value Value to write.
+     */
+    void value(const nlohmann::json& value)
+    {
+        separate();
+        m_buffer.append(value.dump());
+        written();
+    }
+
+    /**
+     * @brief Hands over the remaining data to the chunk handler.
+     */
+    void finish()
+    {
+        if (!m_scopes.empty())
+        {
+            throw std::logic_error("Unterminated response");
+        }
+
+        if (m_chunkHandler && !m_buffer.empty())
+        {
+            m_chunkHandler(m_buffer);
+            m_buffer.clear();
+        }
+    }
+
+    /**
+     * @brief Takes the data not handed over yet, the whole response when there is no chunk handler.
+     *
+     * @return std::string Serialized data.
+     */
+    std::string take() { return std::exchange(m_buffer, {}); }
+
+private:
+    /**
+     * @brief Open object or array.
+     */
+    struct Scope final
+    {
+        char closing; ///< Closing character.
+        bool empty;   ///< Nothing written inside yet.
+    };
+
+    /**
+     * @brief Writes the separator owed before a new value.
+     */
+    void separate()
+    {
+        if (m_afterKey)
+        {
+            m_afterKey = false;
+            return;
+        }
+
+        if (!m_scopes.empty() && m_scopes.back().closing == '}')
+        {
+            throw std::logic_error("Response value without key");
+        }
+
+        if (!m_scopes.empty())
+        {
+            if (!m_scopes.back().empty)
+            {
+                m_buffer.push_back(',');
+            }
+            m_scopes.back().empty = false;
+        }
+    }
+
+    /**
+     * @brief Closes the current object or array.
+     */
+    void close(const char closing)
+    {
+        if (m_scopes.empty() || m_scopes.back().closing != closing || m_afterKey)
+        {
+            throw std::logic_error("Unbalanced response");
+        }
+
+        m_scopes.pop_back();
+        m_buffer.push_back(closing);
+        written();
+    }
+
+    /**
+     * @brief Hands over the data once it reaches the chunk size.
+     */
+    void written()
+    {
+        if (m_chunkHandler && m_buffer.size() >= m_chunkSize)
+        {
+            m_chunkHandler(m_buffer);
+            m_buffer.clear();
+        }
+    }
+
+    ChunkHandler m_chunkHandler; ///< Receives the serialized data, if set.
+    size_t m_chunkSize;          ///< Amount of data handed over at once.
+    std::string m_buffer;        ///< Serialized data not handed over yet.
+    std::vector<Scope> m_scopes; ///< Open objects and arrays.
+    bool m_afterKey {false};     ///< A key was written and its value is pending.
+};
+
+#endif // _RESPONSE_WRITER_HPP
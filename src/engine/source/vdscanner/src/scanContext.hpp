@@ -13,8 +13,11 @@
 #define _SCAN_CONTEXT_HPP
 
 #include "base/utils/stringUtils.hpp"
+#include "osMappingIndex.hpp"
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
+#include <string_view>
 
 enum class ScannerType
 {
@@ -49,6 +52,100 @@ struct MatchCondition
     MatchRuleCondition condition; ///< Condition.
 };
 
+/**
+ * @brief Gets a string field of a request object without copying it.
+ *
+ * @param object Request object.
+ * @param key Field name.
+ * @return View of the field. A missing field, or one that is not a string, is the empty literal, so data() is always a
+ * C string.
+ */
+inline std::string_view requestField(const nlohmann::json& object, const char* key)
+{
+    if (!object.is_object())
+    {
+        return "";
+    }
+    const auto it = object.find(key);
+    return it != object.end() && it->is_string() ? std::string_view {it->get_ref<const std::string&>()} : "";
+}
+
+/**
+ * @brief Agent and OS of a scan request, shared by the contexts of all its packages.
+ *
+ * The fields are looked up once per request, as views of the parsed request, which must outlive the target.
+ */
+struct ScanTarget final
+{
+    /**
+     * @brief Agent fields.
+     */
+    struct Agent
+    {
+        std::string_view id;
+        std::string_view ip;
+        std::string_view name;
+        std::string_view version;
+    };
+
+    /**
+     * @brief OS fields.
+     */
+    struct Os
+    {
+        std::string_view hostname;
+        std::string_view architecture;
+        std::string_view name;
+        std::string_view version;
+        std::string_view codename;
+        std::string_view major_version;
+        std::string_view minor_version;
+        std::string_view patch;
+        std::string_view build;
+        std::string_view platform;
+        std::string_view kernel_name;
+        std::string_view kernel_release;
+        std::string_view kernel_version;
+        std::string_view release;
+        std::string_view display_version;
+    };
+
+    Agent agent;                     ///< Agent of the request.
+    Os os;                           ///< OS of the agent.
+    const nlohmann::json& hotfixes; ///< Hotfixes installed in the agent.
+
+    /**
+     * @brief Class constructor.
+     *
+     * @param agentData Agent object of the request.
+     * @param osData OS object of the request.
+     * @param hotfixesData Hotfixes of the request.
+     */
+    ScanTarget(const nlohmann::json& agentData, const nlohmann::json& osData, const nlohmann::json& hotfixesData)
+        : agent {requestField(agentData, "id"),
+                 requestField(agentData, "ip"),
+                 requestField(agentData, "name"),
+                 requestField(agentData, "version")}
+        , os {requestField(osData, "hostname"),
+              requestField(osData, "architecture"),
+              requestField(osData, "name"),
+              requestField(osData, "version"),
+              requestField(osData, "codename"),
+              requestField(osData, "major_version"),
+              requestField(osData, "minor_version"),
+              requestField(osData, "patch"),
+              requestField(osData, "build"),
+              requestField(osData, "platform"),
+              requestField(osData, "kernel_name"),
+              requestField(osData, "kernel_release"),
+              requestField(osData, "kernel_version"),
+              requestField(osData, "release"),
+              requestField(osData, "display_version")}
+        , hotfixes {hotfixesData}
+    {
+    }
+};
+
 /**
  * @brief ScanContext structure.
  *
@@ -59,6 +156,50 @@ struct MatchCondition
 struct ScanContext final
 {
 public:
+    /**
+     * @brief Package fields, views of the parsed request.
+     */
+    struct Package
+    {
+        std::string_view name;
+        std::string_view version;
+        std::string_view vendor;
+        std::string_view install_time;
+        std::string_view location;
+        std::string_view architecture;
+        std::string_view groups;
+        std::string_view description;
+        std::string_view priority;
+        std::string_view multiarch;
+        std::string_view source;
+        std::string_view format;
+        std::string_view item_id;
+        uint64_t size;
+
+        explicit Package(const nlohmann::json& data)
+            : name {requestField(data, "name")}
+            , version {requestField(data, "version")}
+            , vendor {requestField(data, "vendor")}
+            , install_time {requestField(data, "install_time")}
+            , location {requestField(data, "location")}
+            , architecture {requestField(data, "architecture")}
+            , groups {requestField(data, "groups")}
+            , description {requestField(data, "description")}
+            , priority {requestField(data, "priority")}
+            , multiarch {requestField(data, "multiarch")}
+            , source {requestField(data, "source")}
+            , format {requestField(data, "format")}
+            , item_id {requestField(data, "item_id")}
+            , size {0}
+        {
+            if (const auto it = data.is_object() ? data.find("size") : data.end();
+                it != data.end() && it->is_number_unsigned())
+            {
+                size = it->get<uint64_t>();
+            }
+        }
+    };
+
     // LCOV_EXCL_START
     /**
      * @brief Class constructor.
@@ -70,7 +211,31 @@ public:
     /**
      * @brief Class constructor.
      *
-     * @param data Scan context.
+     * @param type Scanner type.
+     * @param target Agent and OS of the request.
+     * @param package Package to scan, its fields are looked up once.
+     * @param response Detections of the scan.
+     */
+    explicit ScanContext(const ScannerType type,
+                         std::shared_ptr<const ScanTarget> target,
+                         const nlohmann::json& package,
+                         nlohmann::json& response)
+        : m_type {type}
+        , m_target {std::move(target)}
+        , m_package {package}
+        , responseData {response}
+    {
+    }
+
+    /**
+     * @brief Class constructor, for a context that doesn't share the target.
+     *
+     * @param type Scanner type.
+     * @param agent Agent object of the request.
+     * @param os OS object of the request.
+     * @param package Package to scan.
+     * @param hotfixes Hotfixes of the request.
+     * @param response Detections of the scan.
      */
     explicit ScanContext(const ScannerType type,
                          const nlohmann::json& agent,
@@ -78,12 +243,7 @@ public:
                          const nlohmann::json& package,
                          const nlohmann::json& hotfixes,
                          nlohmann::json& response)
-        : m_type {type}
-        , packageData {package}
-        , agentData {agent}
-        , osData {os}
-        , hotfixesData {hotfixes}
-        , responseData {response}
+        : ScanContext(type, std::make_shared<const ScanTarget>(agent, os, hotfixes), package, response)
     {
     }
 
@@ -99,89 +259,49 @@ public:
      * @brief Gets package name.
      * @return Package name.
      */
-    std::string_view packageName() const
-    {
-        return packageData.contains("/name"_json_pointer)
-                   ? packageData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageName() const { return m_package.name; }
 
     /**
      * @brief Gets package version.
      * @return Package version.
      */
-    std::string_view packageVersion() const
-    {
-        return packageData.contains("/version"_json_pointer)
-                   ? packageData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageVersion() const { return m_package.version; }
 
     /**
      * @brief Gets vendor name.
      * @return Vendor name.
      */
-    std::string_view packageVendor() const
-    {
-        return packageData.contains("/vendor"_json_pointer)
-                   ? packageData.at("/vendor"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageVendor() const { return m_package.vendor; }
 
     /**
      * @brief Gets package install time.
      * @return Package install time.
      */
-    std::string_view packageInstallTime() const
-    {
-        return packageData.contains("/install_time"_json_pointer)
-                   ? packageData.at("/install_time"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageInstallTime() const { return m_package.install_time; }
 
     /**
      * @brief Gets package location.
      * @return Package location.
      */
-    std::string_view packageLocation() const
-    {
-        return packageData.contains("/location"_json_pointer)
-                   ? packageData.at("/location"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageLocation() const { return m_package.location; }
 
     /**
      * @brief Gets package architecture.
      * @return Package architecture.
      */
-    std::string_view packageArchitecture() const
-    {
-        return packageData.contains("/architecture"_json_pointer)
-                   ? packageData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageArchitecture() const { return m_package.architecture; }
 
     /**
      * @brief Gets package groups.
      * @return Package groups.
      */
-    std::string_view packageGroups() const
-    {
-        return packageData.contains("/groups"_json_pointer)
-                   ? packageData.at("/groups"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageGroups() const { return m_package.groups; }
 
     /**
      * @brief Gets package description
      * @return Package description.
      */
-    std::string_view packageDescription() const
-    {
-        return packageData.contains("/description"_json_pointer)
-                   ? packageData.at("/description"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageDescription() const { return m_package.description; }
 
     /**
      * @brief Gets package size.
@@ -189,319 +309,172 @@ public:
      */
     uint64_t packageSize() const
     {
-        return packageData.contains("/size"_json_pointer) ? packageData.at("/size"_json_pointer).get<uint64_t>() : 0;
+        return m_package.size;
     }
 
     /**
      * @brief Gets package priority.
      * @return Package priority.
      */
-    std::string_view packagePriority() const
-    {
-        return packageData.contains("/priority"_json_pointer)
-                   ? packageData.at("/priority"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packagePriority() const { return m_package.priority; }
 
     /**
      * @brief Gets package multi arch.
      * @return Package multi arch.
      */
-    std::string_view packageMultiarch() const
-    {
-        return packageData.contains("/multiarch"_json_pointer)
-                   ? packageData.at("/multiarch"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageMultiarch() const { return m_package.multiarch; }
 
     /**
      * @brief Gets package source
      * @return Package source.
      */
-    std::string_view packageSource() const
-    {
-        return packageData.contains("/source"_json_pointer)
-                   ? packageData.at("/source"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageSource() const { return m_package.source; }
 
     /**
      * @brief Gets package format.
      * @return Package format.
      */
-    std::string_view packageFormat() const
-    {
-        return packageData.contains("/format"_json_pointer)
-                   ? packageData.at("/format"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageFormat() const { return m_package.format; }
 
     /**
      * @brief Gets package id.
      * @return Package id.
      */
-    std::string_view packageItemId() const
-    {
-        return packageData.contains("/item_id"_json_pointer)
-                   ? packageData.at("/item_id"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view packageItemId() const { return m_package.item_id; }
 
     /**
      * @brief Gets agent id.
      * @return Agent id.
      */
-    std::string_view agentId() const
-    {
-        return agentData.contains("/id"_json_pointer)
-                   ? agentData.at("/id"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view agentId() const { return m_target->agent.id; }
 
     /**
      * @brief Gets agent IP.
      *
      * @return Agent IP.
      */
-    std::string_view agentIp() const
-    {
-        return agentData.contains("/ip"_json_pointer)
-                   ? agentData.at("/ip"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view agentIp() const { return m_target->agent.ip; }
 
     /**
      * @brief Gets agent name.
      *
      * @return Agent name.
      */
-    std::string_view agentName() const
-    {
-        return agentData.contains("/name"_json_pointer)
-                   ? agentData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view agentName() const { return m_target->agent.name; }
 
     /**
      * @brief Gets agent version.
      *
      * @return Agent version.
      */
-    std::string_view agentVersion() const
-    {
-        return agentData.contains("/version"_json_pointer)
-                   ? agentData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view agentVersion() const { return m_target->agent.version; }
 
     /**
      * @brief Gets os hostName.
      * @return Os hostName.
      */
-    std::string_view osHostName() const
-    {
-        return osData.contains("/hostname"_json_pointer)
-                   ? osData.at("/hostname"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osHostName() const { return m_target->os.hostname; }
 
     /**
      * @brief Gets os architecture.
      * @return Os architecture.
      */
-    std::string_view osArchitecture() const
-    {
-        return osData.contains("/architecture"_json_pointer)
-                   ? osData.at("/architecture"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osArchitecture() const { return m_target->os.architecture; }
 
     /**
      * @brief Gets os name.
      * @return Os name.
      */
-    std::string_view osName() const
-    {
-        return osData.contains("/name"_json_pointer)
-                   ? osData.at("/name"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osName() const { return m_target->os.name; }
 
     /**
      * @brief Gets os version.
      * @return Os version.
      */
-    std::string_view osVersion() const
-    {
-        return osData.contains("/version"_json_pointer)
-                   ? osData.at("/version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osVersion() const { return m_target->os.version; }
 
     /**
      * @brief Gets os codeName.
      * @return Os codeName.
      */
-    std::string_view osCodeName() const
-    {
-        return osData.contains("/codename"_json_pointer)
-                   ? osData.at("/codename"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osCodeName() const { return m_target->os.codename; }
 
     /**
      * @brief Gets os major version.
      * @return Os major version.
      */
-    std::string_view osMajorVersion() const
-    {
-        return osData.contains("/major_version"_json_pointer)
-                   ? osData.at("/major_version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osMajorVersion() const { return m_target->os.major_version; }
 
     /**
      * @brief Gets os minor version.
      * @return Os minor version.
      */
-    std::string_view osMinorVersion() const
-    {
-        return osData.contains("/minor_version"_json_pointer)
-                   ? osData.at("/minor_version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osMinorVersion() const { return m_target->os.minor_version; }
 
     /**
      * @brief Gets os patch version.
      * @return Os patch version.
      */
-    std::string_view osPatch() const
-    {
-        return osData.contains("/patch"_json_pointer)
-                   ? osData.at("/patch"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osPatch() const { return m_target->os.patch; }
 
     /**
      * @brief Gets os build number.
      * @return Os build number.
      */
-    std::string_view osBuild() const
-    {
-        return osData.contains("/build"_json_pointer)
-                   ? osData.at("/build"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osBuild() const { return m_target->os.build; }
 
     /**
      * @brief Gets os platform.
      * @return Os platform.
      */
-    std::string_view osPlatform() const
-    {
-        return osData.contains("/platform"_json_pointer)
-                   ? osData.at("/platform"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osPlatform() const { return m_target->os.platform; }
 
     /**
      * @brief Gets os kernel sysName.
      * @return Os kernel sysName.
      */
-    std::string_view osKernelSysName() const
-    {
-        return osData.contains("/kernel_name"_json_pointer)
-                   ? osData.at("/kernel_name"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osKernelSysName() const { return m_target->os.kernel_name; }
 
     /**
      * @brief Gets os kernel release.
      * @return Os kernel release.
      */
-    std::string_view osKernelRelease() const
-    {
-        return osData.contains("/kernel_release"_json_pointer)
-                   ? osData.at("/kernel_release"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osKernelRelease() const { return m_target->os.kernel_release; }
 
     /**
      * @brief Gets os kernel version.
      * @return Os kernel version.
      */
-    std::string_view osKernelVersion() const
-    {
-        return osData.contains("/kernel_version"_json_pointer)
-                   ? osData.at("/kernel_version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osKernelVersion() const { return m_target->os.kernel_version; }
 
     /**
      * @brief Gets os release
      * @return Os release.
      */
-    std::string_view osRelease() const
-    {
-        return osData.contains("/release"_json_pointer)
-                   ? osData.at("/release"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osRelease() const { return m_target->os.release; }
 
     /**
      * @brief Gets os display name.
      * @return Os display name.
      */
-    std::string_view osDisplayVersion() const
-    {
-        return osData.contains("/display_version"_json_pointer)
-                   ? osData.at("/display_version"_json_pointer).get_ref<const std::string&>().c_str()
-                   : "";
-    }
+    std::string_view osDisplayVersion() const { return m_target->os.display_version; }
 
     /**
      * @brief Gets OS CPE.
-     * @return OS CPE.
+     * @param osMappings OS mapping index of the feed.
+     * @return OS CPE, empty if the OS is not supported.
      */
-    std::string_view osCPEName(const nlohmann::json& osCpeMaps)
+    std::string_view osCPEName(const OsMappingIndex& osMappings)
     {
         if (m_osCPE.empty())
         {
-            m_osCPE = "cpe:/o:";
-
-            std::string cpe;
-            for (auto it = osCpeMaps.rbegin(); it != osCpeMaps.rend(); ++it)
-            {
-                if (osName().compare(it.key()) == 0 || base::utils::string::startsWith(osName(), it.key())
-                    || osPlatform().compare(it.key()) == 0)
-                {
-                    cpe = it.value();
-                    break;
-                }
-            }
-
-            if (!cpe.empty())
-            {
-                // Replace variables in the CPE name
-                base::utils::string::replaceAll(cpe, "$(MAJOR_VERSION)", osMajorVersion());
-                base::utils::string::replaceAll(cpe, "$(MINOR_VERSION)", osMinorVersion());
-                base::utils::string::replaceAll(cpe, "$(DISPLAY_VERSION)", osDisplayVersion());
-                base::utils::string::replaceAll(cpe, "$(VERSION)", osVersion());
-                base::utils::string::replaceAll(cpe, "$(RELEASE)", osRelease());
-
-                // For SUSE, replace the hyphen in the version with a colon, because inner the version we have the
-                // version update.
-                std::string versionWithHyphen {osVersion()};
-                base::utils::string::replaceAll(versionWithHyphen, "-", ":");
-                base::utils::string::replaceAll(cpe, "$(VERSION_UPDATE_HYPHEN)", versionWithHyphen);
-
-                m_osCPE += base::utils::string::toLowerCase(cpe);
-            }
-            else
-            {
-                // Clear the cpeName if the OS is not supported
-                m_osCPE = "";
-            }
+            m_osCPE = osMappings.cpeName({osName(),
+                                          osPlatform(),
+                                          osMajorVersion(),
+                                          osMinorVersion(),
+                                          osDisplayVersion(),
+                                          osVersion(),
+                                          osRelease()});
         }
         return m_osCPE;
     }
@@ -513,7 +486,7 @@ public:
      *
      * @return std::string_view hotfix identifier.
      */
-    const nlohmann::json& hotfixes() const { return hotfixesData; }
+    const nlohmann::json& hotfixes() const { return m_target->hotfixes; }
 
     /**
      * @brief Elements to process.
@@ -537,10 +510,8 @@ public:
     // LCOV_EXCL_STOP
 private:
     const ScannerType m_type;
-    const nlohmann::json& packageData;
-    const nlohmann::json& agentData;
-    const nlohmann::json& osData;
-    const nlohmann::json& hotfixesData;
+    std::shared_ptr<const ScanTarget> m_target;
+    const Package m_package;
     nlohmann::json& responseData;
     std::string m_osCPE;
 };
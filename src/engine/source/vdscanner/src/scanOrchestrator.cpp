@@ -1,16 +1,189 @@
 #include "scanOrchestrator.hpp"
 #include "base/logging.hpp"
 #include "factoryOrchestrator.hpp"
+#include "responseWriter.hpp"
 #include "scanContext.hpp"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 static const std::map<std::string, PayloadType, std::less<>> SCAN_TYPE {{"packagelist", PayloadType::PackageList},
-                                                                        {"fullscan", PayloadType::FullScan}};
+                                                                        {"fullscan", PayloadType::FullScan},
+                                                                        {"delta", PayloadType::Delta}};
 
-ScanOrchestrator::ScanOrchestrator(const std::string& configuration)
+// Below this amount of packages per worker, starting a thread costs more than the scan it takes over.
+constexpr size_t MIN_PACKAGES_PER_WORKER = 8;
+
+/**
+ * @brief Scans the given packages of the request, spreading them over up to maxWorkers threads.
+ *
+ * Workers pick the next pending package from a shared index, so a slow package doesn't hold back the rest of the
+ * list. Each package writes into its own result buffer, and the buffers are handed to the sink in the package order as
+ * soon as every previous package is done. A buffer is released once handed over, so only the results of the packages
+ * scanned ahead of a slower one are kept, and the output is the same as with a serial scan.
+ *
+ * @param packageScan Package scanner chain.
+ * @param request Scan request.
+ * @param packages Packages of the request to scan.
+ * @param maxWorkers Maximum amount of threads used for the scan.
+ * @param sink Receives each detection, one call at a time.
+ */
+template<typename TScanner>
+static void scanPackages(const TScanner& packageScan,
+                         const nlohmann::json& request,
+                         const std::vector<const nlohmann::json*>& packages,
+                         const size_t maxWorkers,
+                         const std::function<void(const nlohmann::json&)>& sink)
 {
-    // Database feed manager initialization.
-    m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(m_mutex);
+    // The agent and OS fields are looked up once, all the packages of the request share them.
+    const auto target =
+        std::make_shared<const ScanTarget>(request.at("agent"), request.at("os"), request.at("hotfixes"));
+
+    std::vector<nlohmann::json> results(packages.size());
+    std::vector<char> scanned(packages.size(), 0);
+    std::mutex sinkMutex;
+    size_t nextResult {0};
+    std::atomic<size_t> nextPackage {0};
+    std::atomic<bool> failed {false};
+    std::exception_ptr error;
+
+    auto worker = [&]()
+    {
+        try
+        {
+            for (auto i = nextPackage++; i < results.size() && !failed; i = nextPackage++)
+            {
+                packageScan->handleRequest(
+                    std::make_shared<ScanContext>(ScannerType::Package, target, *packages[i], results[i]));
+
+                std::lock_guard lock(sinkMutex);
+                scanned[i] = 1;
+                for (; nextResult < results.size() && scanned[nextResult]; ++nextResult)
+                {
+                    for (const auto& detection : results[nextResult])
+                    {
+                        sink(detection);
+                    }
+                    results[nextResult] = nlohmann::json();
+                }
+            }
+        }
+        catch (...)
+        {
+            // Keep the first error, it is rethrown once all the workers are done.
+            if (!failed.exchange(true))
+            {
+                error = std::current_exception();
+            }
+        }
+    };
+
+    const auto workers =
+        std::clamp<size_t>(results.size() / MIN_PACKAGES_PER_WORKER, 1, std::max<size_t>(maxWorkers, 1));
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (size_t i = 1; i < workers; ++i)
+    {
+        threads.emplace_back(worker);
+    }
+    worker();
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+/**
+ * @brief Lists every package of the request.
+ *
+ * @param request Scan request.
+ * @return Packages of the request.
+ */
+static std::vector<const nlohmann::json*> allPackages(const nlohmann::json& request)
+{
+    const auto& packages = request.at("packages");
+
+    std::vector<const nlohmann::json*> result;
+    result.reserve(packages.size());
+    for (const auto& package : packages)
+    {
+        result.push_back(&package);
+    }
+    return result;
+}
+
+/**
+ * @brief Gets a string field of an object, empty if missing.
+ *
+ * @param object Object data.
+ * @param key Field name.
+ * @return Field value.
+ */
+static std::string stringField(const nlohmann::json& object, const char* key)
+{
+    const auto it = object.find(key);
+    return it != object.end() && it->is_string() ? it->get<std::string>() : std::string {};
+}
+
+/**
+ * @brief Builds the fingerprint of the package inventory of a request.
+ *
+ * @details Packages without item id can't be told apart between requests, so they are left out and always scanned.
+ *
+ * @param request Scan request.
+ * @param feedGeneration Feed generation the request is scanned against.
+ * @return Inventory fingerprint.
+ */
+static std::shared_ptr<const InventoryFingerprint> fingerprint(const nlohmann::json& request,
+                                                               const uint64_t feedGeneration)
+{
+    auto inventory = std::make_shared<InventoryFingerprint>();
+    inventory->contextHash = std::hash<std::string> {}(request.at("os").dump() + request.at("hotfixes").dump());
+    inventory->feedGeneration = feedGeneration;
 
+    const auto& packages = request.at("packages");
+    inventory->packages.reserve(packages.size());
+    for (const auto& package : packages)
+    {
+        if (auto id = stringField(package, "item_id"); !id.empty())
+        {
+            inventory->packages.emplace_back(std::move(id), std::hash<std::string> {}(package.dump()));
+        }
+    }
+    std::sort(inventory->packages.begin(), inventory->packages.end());
+
+    return inventory;
+}
+
+/**
+ * @brief Finds a package in an inventory fingerprint.
+ *
+ * @param inventory Inventory fingerprint.
+ * @param id Package item id.
+ * @return Package entry, nullptr if not found.
+ */
+static const std::pair<std::string, size_t>* findPackage(const InventoryFingerprint& inventory, const std::string& id)
+{
+    const auto it = std::lower_bound(inventory.packages.begin(),
+                                     inventory.packages.end(),
+                                     id,
+                                     [](const auto& entry, const std::string& value) { return entry.first < value; });
+    return it != inventory.packages.end() && it->first == id ? &*it : nullptr;
+}
+
+ScanOrchestrator::ScanOrchestrator(const std::string& configuration)
+{
     // Configuration initialization.
     m_configuration = nlohmann::json::parse(configuration, nullptr, false);
     if (m_configuration.is_discarded())
@@ -18,58 +191,185 @@ ScanOrchestrator::ScanOrchestrator(const std::string& configuration)
         throw std::invalid_argument("Invalid configuration");
     }
 
+    // Database feed manager initialization.
+    const auto trustFeedDatabase = m_configuration.contains("trustFeedDatabase")
+                                   && m_configuration.at("trustFeedDatabase").is_boolean()
+                                   && m_configuration.at("trustFeedDatabase").get<bool>();
+
+    // The candidates are small FlatBuffers records with the same layout, zstd with a dictionary keeps the ratio of
+    // bzip2 while the seeks of a scan decompress the blocks that miss the cache several times faster.
+    utils::rocksdb::RocksDBTuning feedTuning;
+    feedTuning.compression = utils::rocksdb::CompressionProfile::ZSTD_DICTIONARY;
+    if (const auto& compression = m_configuration.find("feedCompression");
+        compression != m_configuration.end() && compression->is_string())
+    {
+        feedTuning.compression = utils::rocksdb::compressionProfileFromString(compression->get<std::string>());
+    }
+    if (const auto& cacheSize = m_configuration.find("feedBlockCacheSize");
+        cacheSize != m_configuration.end() && cacheSize->is_number_unsigned() && cacheSize->get<size_t>() > 0)
+    {
+        feedTuning.blockCacheSize = cacheSize->get<size_t>();
+    }
+    m_databaseFeedManager = std::make_shared<DatabaseFeedManager>(m_mutex, trustFeedDatabase, feedTuning);
+
+    m_scanThreads = std::max(1U, std::thread::hardware_concurrency());
+    if (const auto& threads = m_configuration.find("scanThreads");
+        threads != m_configuration.end() && threads->is_number_unsigned() && threads->get<size_t>() > 0)
+    {
+        m_scanThreads = threads->get<size_t>();
+    }
+
     LOG_DEBUG("Vulnerability scanner module started");
 }
 
 void ScanOrchestrator::processEvent(const std::string& request, std::string& response) const
+{
+    ResponseWriter writer;
+    process(request, writer);
+    response = writer.take();
+}
+
+void ScanOrchestrator::processEvent(const std::string& request, const ChunkHandler& chunkHandler) const
+{
+    ResponseWriter writer(chunkHandler);
+    process(request, writer);
+}
+
+void ScanOrchestrator::process(const std::string& request, ResponseWriter& writer) const
 {
     const auto& requestDeserialized = nlohmann::json::parse(request);
     const auto& scanType = requestDeserialized.at("type").get_ref<const std::string&>();
-    run(SCAN_TYPE.at(scanType), requestDeserialized, response);
+    run(SCAN_TYPE.at(scanType), requestDeserialized, writer);
+    writer.finish();
 
     LOG_DEBUG("Event type: {} processed", scanType);
 }
 
-void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request, std::string& response) const
+void ScanOrchestrator::run(const PayloadType type, const nlohmann::json& request, ResponseWriter& writer) const
 {
     auto static osScan = FactoryOrchestrator::create(ScannerType::Os, m_databaseFeedManager);
     auto static packageScan = FactoryOrchestrator::create(ScannerType::Package, m_databaseFeedManager);
 
     // This locks the mutex to avoid scanning during the feed update processing.
     std::shared_lock lock(m_mutex);
-    nlohmann::json responseJson;
+
+    // Full and package list scans answer with the array of detections, null when there are none.
+    size_t detections {0};
+    const auto appendDetection = [&writer, &detections](const nlohmann::json& detection)
+    {
+        if (detections++ == 0)
+        {
+            writer.beginArray();
+        }
+        writer.value(detection);
+    };
+    const auto endDetections = [&writer, &detections]()
+    {
+        if (detections > 0)
+        {
+            writer.endArray();
+        }
+        else
+        {
+            writer.value(nullptr);
+        }
+    };
 
     if (type == PayloadType::FullScan)
     {
+        nlohmann::json osDetections;
         osScan->handleRequest(std::make_shared<ScanContext>(
-            ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), responseJson));
+            ScannerType::Os, request.at("agent"), request.at("os"), nullptr, request.at("hotfixes"), osDetections));
+        for (const auto& detection : osDetections)
+        {
+            appendDetection(detection);
+        }
 
-        for (const auto& package : request.at("packages"))
+        scanPackages(packageScan, request, allPackages(request), m_scanThreads, appendDetection);
+        endDetections();
+
+        // A full scan carries the whole inventory, so it is the baseline of the next delta scans.
+        if (const auto agentId = stringField(request.at("agent"), "id"); !agentId.empty())
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            storeFingerprint(agentId, fingerprint(request, m_databaseFeedManager->feedGeneration()));
         }
     }
     else if (type == PayloadType::PackageList)
     {
+        scanPackages(packageScan, request, allPackages(request), m_scanThreads, appendDetection);
+        endDetections();
+    }
+    else if (type == PayloadType::Delta)
+    {
+        const auto agentId = stringField(request.at("agent"), "id");
+        const auto inventory = fingerprint(request, m_databaseFeedManager->feedGeneration());
+        const auto previous = agentId.empty() ? nullptr : lastFingerprint(agentId);
+
+        // Without a previous inventory scanned in the same conditions, every package is scanned.
+        const auto reusable = previous && previous->contextHash == inventory->contextHash
+                              && previous->feedGeneration == inventory->feedGeneration;
+
+        std::vector<const nlohmann::json*> changed;
         for (const auto& package : request.at("packages"))
         {
-            packageScan->handleRequest(std::make_shared<ScanContext>(ScannerType::Package,
-                                                                     request.at("agent"),
-                                                                     request.at("os"),
-                                                                     package,
-                                                                     request.at("hotfixes"),
-                                                                     responseJson));
+            const auto id = stringField(package, "item_id");
+            const auto* last = reusable && !id.empty() ? findPackage(*previous, id) : nullptr;
+            if (last == nullptr || last->second != findPackage(*inventory, id)->second)
+            {
+                changed.push_back(&package);
+            }
+        }
+
+        auto removed = nlohmann::json::array();
+        if (previous)
+        {
+            for (const auto& [id, hash] : previous->packages)
+            {
+                if (findPackage(*inventory, id) == nullptr)
+                {
+                    removed.push_back(id);
+                }
+            }
+        }
+
+        // The keys are written in the order a dumped object would have.
+        writer.beginObject();
+        writer.key("detections");
+        writer.beginArray();
+        scanPackages(packageScan,
+                     request,
+                     changed,
+                     m_scanThreads,
+                     [&writer](const nlohmann::json& detection) { writer.value(detection); });
+        writer.endArray();
+        writer.key("removed");
+        writer.value(removed);
+        writer.endObject();
+
+        if (!agentId.empty())
+        {
+            storeFingerprint(agentId, inventory);
         }
+
+        LOG_DEBUG("Delta scan for agent '{}': {} of {} packages scanned, {} removed",
+                  agentId,
+                  changed.size(),
+                  request.at("packages").size(),
+                  removed.size());
     }
     else
     {
         throw std::invalid_argument("Invalid scan type");
     }
+}
 
-    response = responseJson.dump();
+std::shared_ptr<const InventoryFingerprint> ScanOrchestrator::lastFingerprint(const std::string& agentId) const
+{
+    return m_inventories.getValue(agentId).value_or(nullptr);
+}
+
+void ScanOrchestrator::storeFingerprint(const std::string& agentId,
+                                        std::shared_ptr<const InventoryFingerprint> inventory) const
+{
+    m_inventories.insertKey(agentId, inventory);
 }
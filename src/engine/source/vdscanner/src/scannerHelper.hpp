@@ -79,7 +79,9 @@ public:
     static CPE parseCPE(std::string_view cpeString)
     {
         CPE cpe {};
-        std::vector<std::string> cpeParts = base::utils::string::split(cpeString, ':');
+        // Views of the parts, only the fields are copied
+        const auto parts = base::utils::string::splitView(cpeString, ':');
+        const std::vector<std::string_view> cpeParts(parts.begin(), parts.end());
 
         // Check if is 2.2 or 2.3
         // If is 2.2, the first part is "cpe"
@@ -93,7 +95,9 @@ public:
 
         if (maxAvailableIndex >= CPEFIELDS::product + offset)
         {
-            cpe.part = base::utils::string::leftTrim(cpeParts[CPEFIELDS::part + offset], "/");
+            auto part = cpeParts[CPEFIELDS::part + offset];
+            part.remove_prefix(std::min(part.find_first_not_of('/'), part.size()));
+            cpe.part = part;
             cpe.vendor = cpeParts[CPEFIELDS::vendor + offset];
             cpe.product = cpeParts[CPEFIELDS::product + offset];
         }
@@ -12,6 +12,10 @@
 #ifndef _I_VERSION_OBJECT_INTERFACE_HPP
 #define _I_VERSION_OBJECT_INTERFACE_HPP
 
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
 enum class VersionObjectType : int
 {
     CalVer = 0,
@@ -55,6 +59,51 @@ public:
      * @return true/false according to less than condition.
      */
     virtual bool operator<(const IVersionObject& b) const = 0;
+
+protected:
+    /**
+     * @brief Converts a non-empty run of decimal digits to a number, like std::stoul but without building a string.
+     *
+     * @param digits Digits to convert.
+     * @return unsigned long Converted number.
+     * @throws std::out_of_range if the number doesn't fit in an unsigned long.
+     */
+    static unsigned long parseNumber(std::string_view digits)
+    {
+        unsigned long number = 0;
+        for (const auto digit : digits)
+        {
+            const auto value = static_cast<unsigned long>(digit - '0');
+            if (number > (std::numeric_limits<unsigned long>::max() - value) / 10)
+            {
+                throw std::out_of_range {"parseNumber"};
+            }
+            number = number * 10 + value;
+        }
+        return number;
+    }
+
+    /**
+     * @brief Checks if a string is a non-empty run of decimal digits.
+     *
+     * @param value String to check.
+     * @return true/false according to the check.
+     */
+    static bool isNumber(std::string_view value)
+    {
+        if (value.empty())
+        {
+            return false;
+        }
+        for (const auto character : value)
+        {
+            if (character < '0' || character > '9')
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 #endif // _I_VERSION_OBJECT_INTERFACE_HPP
@@ -256,7 +256,25 @@ public:
             const std::string& versionB,
             std::variant<VersionObjectType, VersionMatcherStrategy> type = VersionMatcherStrategy::Unspecified)
     {
-        auto pVersionObjectA = createVersionObject(versionA, type);
+        return compare(createVersionObject(versionA, type), versionA, versionB, type);
+    }
+
+    /**
+     * @brief Compares an already parsed version with a version string.
+     *
+     * @details Allows comparing the same version with many others, parsing it only once (see parse()).
+     *
+     * @param pVersionObjectA parsed version item A to compare, nullptr if it couldn't be parsed.
+     * @param versionA string version item A, used for the error message.
+     * @param versionB string version item B to compare
+     * @param type Version object or matcher strategy used to parse A, and to parse B.
+     * @return VersionComparisonResult result of the comparison.
+     */
+    static VersionComparisonResult compare(const std::shared_ptr<IVersionObject>& pVersionObjectA,
+                                           const std::string& versionA,
+                                           const std::string& versionB,
+                                           std::variant<VersionObjectType, VersionMatcherStrategy> type)
+    {
         auto pVersionObjectB = createVersionObject(versionB, type);
 
         if (pVersionObjectA && pVersionObjectB && pVersionObjectA->getType() == pVersionObjectB->getType())
@@ -279,6 +297,19 @@ public:
         throw std::invalid_argument("Unable to compare versions (" + versionA + " vs " + versionB + ").");
     }
 
+    /**
+     * @brief Parses a version string.
+     *
+     * @param version Version to parse.
+     * @param type Version object or matcher strategy.
+     * @return std::shared_ptr<IVersionObject> Parsed version, nullptr if the version doesn't match the type.
+     */
+    static std::shared_ptr<IVersionObject> parse(const std::string& version,
+                                                 std::variant<VersionObjectType, VersionMatcherStrategy> type)
+    {
+        return createVersionObject(version, type);
+    }
+
     /**
      * @brief Checks whether a version string matches the given version type.
      *
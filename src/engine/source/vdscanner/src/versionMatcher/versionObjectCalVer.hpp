@@ -13,10 +13,11 @@
 #define _VERSION_OBJECT_CALVER_HPP
 
 #include "iVersionObjectInterface.hpp"
+#include <array>
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief CalVer data struct.
@@ -37,7 +38,6 @@ struct CalVer
 class VersionObjectCalVer final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint16_t m_year;
     uint8_t m_month;
     uint8_t m_day;
@@ -47,25 +47,76 @@ public:
     /**
      * @brief Parses a version string and returns a CalVer object.
      *
+     * @details The version is a year of two or four digits followed by up to three dot-separated numbers: the month
+     * and the day, of one or two digits, and the micro. When some numbers are missing, the present ones are assigned
+     * in that order of preference, so "2023.123" has a micro but no month nor day.
+     *
      * @param version version string to parse.
      * @param output CalVer object to store the parsed version.
      * @return true/false according to success/failure.
      */
     static bool match(const std::string& version, CalVer& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 5))
+        constexpr auto MAX_FIELDS = 4;
+        std::array<std::string_view, MAX_FIELDS> fields {};
+        size_t count = 0;
+
+        std::string_view remaining {version};
+        while (true)
+        {
+            const auto separator = remaining.find('.');
+            const auto field = remaining.substr(0, separator);
+            if (count == MAX_FIELDS || !isNumber(field))
+            {
+                return false;
+            }
+            fields[count++] = field;
+
+            if (separator == std::string_view::npos)
+            {
+                break;
+            }
+            remaining.remove_prefix(separator + 1);
+        }
+
+        if (fields[0].size() != 2 && fields[0].size() != 4)
+        {
+            return false;
+        }
+
+        // Pick the first assignment of the numbers to the month, day and micro, in that order of preference.
+        std::string_view month;
+        std::string_view day;
+        std::string_view micro;
+        auto assigned = false;
+        for (auto present = 0b111; present >= 0 && !assigned; --present)
+        {
+            const auto hasMonth = (present & 0b100) != 0;
+            const auto hasDay = (present & 0b010) != 0;
+            const auto hasMicro = (present & 0b001) != 0;
+            if (static_cast<size_t>(hasMonth + hasDay + hasMicro) != count - 1)
+            {
+                continue;
+            }
+
+            auto next = fields.begin() + 1;
+            month = hasMonth ? *next++ : std::string_view {};
+            day = hasDay ? *next++ : std::string_view {};
+            micro = hasMicro ? *next : std::string_view {};
+            assigned = month.size() <= 2 && day.size() <= 2;
+        }
+
+        if (!assigned)
         {
             return false;
         }
 
-        output.year = (parserMatches.str(1).size() == 2)
-                          ? static_cast<uint16_t>(std::stoul(parserMatches.str(1))) + 2000
-                          : static_cast<uint16_t>(std::stoul(parserMatches.str(1)));
+        output.year = (fields[0].size() == 2) ? static_cast<uint16_t>(parseNumber(fields[0])) + 2000
+                                              : static_cast<uint16_t>(parseNumber(fields[0]));
 
-        if (!parserMatches.str(2).empty())
+        if (!month.empty())
         {
-            output.month = static_cast<uint8_t>(std::stoul(parserMatches.str(2).substr(1)));
+            output.month = static_cast<uint8_t>(parseNumber(month));
             if (output.month < 1 || output.month > 12)
             {
                 return false;
@@ -76,9 +127,9 @@ public:
             output.month = 0;
         }
 
-        if (!parserMatches.str(3).empty())
+        if (!day.empty())
         {
-            output.day = static_cast<uint8_t>(std::stoul(parserMatches.str(3).substr(1)));
+            output.day = static_cast<uint8_t>(parseNumber(day));
             if (output.day < 1 || output.day > 31)
             {
                 return false;
@@ -89,8 +140,7 @@ public:
             output.day = 0;
         }
 
-        output.micro =
-            parserMatches.str(4).empty() ? 0 : static_cast<uint32_t>(std::stoul(parserMatches.str(4).substr(1)));
+        output.micro = micro.empty() ? 0 : static_cast<uint32_t>(parseNumber(micro));
 
         return true;
     }
@@ -15,8 +15,8 @@
 #include "iVersionObjectInterface.hpp"
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief MajorMinor data struct.
@@ -34,7 +34,6 @@ struct MajorMinor
 class VersionObjectMajorMinor final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint32_t m_major {};
     uint32_t m_minor {};
 
@@ -42,20 +41,30 @@ public:
     /**
      * @brief Parses a version string and returns a MajorMinor object.
      *
+     * @details The version must be two numbers separated by a dot or a hyphen.
+     *
      * @param version version string to parse.
      * @param output MajorMinor object to store the parsed version.
      * @return true/false according to success/failure.
      */
     static bool match(const std::string& version, MajorMinor& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 3))
+        const auto separator = version.find_first_of(".-");
+        if (separator == std::string::npos)
+        {
+            return false;
+        }
+
+        const std::string_view versionView {version};
+        const auto major = versionView.substr(0, separator);
+        const auto minor = versionView.substr(separator + 1);
+        if (!isNumber(major) || !isNumber(minor))
         {
             return false;
         }
 
-        output.major = static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
-        output.minor = static_cast<uint32_t>(std::stoul(parserMatches.str(2)));
+        output.major = static_cast<uint32_t>(parseNumber(major));
+        output.minor = static_cast<uint32_t>(parseNumber(minor));
 
         return true;
     }
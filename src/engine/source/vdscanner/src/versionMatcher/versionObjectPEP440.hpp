@@ -14,10 +14,11 @@
 
 #include "iVersionObjectInterface.hpp"
 #include <algorithm>
+#include <array>
 #include <cctype>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief PEP440 data struct.
@@ -43,8 +44,6 @@ struct PEP440
 class VersionObjectPEP440 final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
-    static std::regex m_parserVersionStrRegex;
     uint32_t m_epoch;
     std::string m_versionStr;
     std::string m_preReleaseStr;
@@ -56,51 +55,233 @@ private:
     bool m_hasDevRelease;
 
     /**
-     * @brief Comparison method for the versionStr variable members.
+     * @brief Parser for PEP 440 version strings.
      *
-     * @param versionStrA versionStr member of object A.
-     * @param versionStrB versionStr member of object B.
-     * @return 0  if A is equal to B.
-     *         -1 if A is less than B.
-     *         1  if A is greater than B.
+     * @details Matches the whole string against the following case-insensitive expression, which supports the
+     * alternative syntax as well as the canonical form:
+     *
+     *   ^v?(?:(?:([0-9]+)!)?([0-9]+(?:\.[0-9]+)*)(?:[-_\.]?(a|b|c|rc|alpha|beta|pre|preview)[-_\.]?([0-9]+)?)?
+     *   (?:(?:-([0-9]+))|(?:[-_\.]?(post|rev|r)[-_\.]?([0-9]+)?))?(?:[-_\.]?(dev)[-_\.]?([0-9]+)?)?)?$
+     *
+     * The optional parts are tried in the same order a backtracking regex engine would, so the parts found are the
+     * ones the expression captures. Each part is a view of the input, empty when not present.
      */
-    static int compareVersionStr(const std::string& versionStrA, const std::string& versionStrB)
+    class Parser final
     {
-        std::deque<uint32_t> versionStrSplitA;
-        std::sregex_token_iterator itA(versionStrA.begin(), versionStrA.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndA;
-        while (itA != itEndA)
+    private:
+        std::string_view m_input;
+
+        static bool isSeparator(const char character)
+        {
+            return character == '-' || character == '_' || character == '.';
+        }
+
+        size_t digitsAt(const size_t pos) const
+        {
+            auto end = pos;
+            while (end < m_input.size() && m_input[end] >= '0' && m_input[end] <= '9')
+            {
+                ++end;
+            }
+            return end - pos;
+        }
+
+        bool keywordAt(const size_t pos, std::string_view keyword) const
+        {
+            if (m_input.size() - pos < keyword.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < keyword.size(); ++i)
+            {
+                if (std::tolower(static_cast<unsigned char>(m_input[pos + i])) != keyword[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Tries the optional parts "[-_.]?<keyword>[-_.]?[0-9]*" at pos, then calls next with the position
+         * after them. The separators and the number are greedy, the keywords are tried in the given order.
+         */
+        template<size_t N, typename Next>
+        bool labeledPart(const size_t pos,
+                         const std::array<std::string_view, N>& keywords,
+                         std::string_view& label,
+                         std::string_view& number,
+                         Next&& next)
         {
-            versionStrSplitA.push_back(static_cast<uint32_t>(std::stoul(itA->str())));
-            itA++;
+            const auto hasSeparator = pos < m_input.size() && isSeparator(m_input[pos]);
+            for (auto separator = static_cast<size_t>(hasSeparator); separator != static_cast<size_t>(-1); --separator)
+            {
+                const auto labelPos = pos + separator;
+                for (const auto keyword : keywords)
+                {
+                    if (!keywordAt(labelPos, keyword))
+                    {
+                        continue;
+                    }
+
+                    const auto afterLabel = labelPos + keyword.size();
+                    const auto hasSecondSeparator = afterLabel < m_input.size() && isSeparator(m_input[afterLabel]);
+                    for (auto secondSeparator = static_cast<size_t>(hasSecondSeparator);
+                         secondSeparator != static_cast<size_t>(-1);
+                         --secondSeparator)
+                    {
+                        const auto numberPos = afterLabel + secondSeparator;
+                        const auto digits = digitsAt(numberPos);
+                        for (auto numberSize = digits; numberSize != static_cast<size_t>(-1);
+                             numberSize = numberSize == 0 ? static_cast<size_t>(-1) : 0)
+                        {
+                            label = m_input.substr(labelPos, keyword.size());
+                            number = m_input.substr(numberPos, numberSize);
+                            if (next(numberPos + numberSize))
+                            {
+                                return true;
+                            }
+                        }
+                    }
+                }
+            }
+
+            label = {};
+            number = {};
+            return next(pos);
         }
 
-        std::deque<uint32_t> versionStrSplitB;
-        std::sregex_token_iterator itB(versionStrB.begin(), versionStrB.end(), m_parserVersionStrRegex, -1);
-        std::sregex_token_iterator itEndB;
-        while (itB != itEndB)
+        bool devRelease(const size_t pos)
         {
-            versionStrSplitB.push_back(static_cast<uint32_t>(std::stoul(itB->str())));
-            itB++;
+            static constexpr std::array<std::string_view, 1> KEYWORDS {"dev"};
+            return labeledPart(
+                pos, KEYWORDS, dev, devNumber, [this](const size_t end) { return end == m_input.size(); });
         }
 
-        while (versionStrSplitA.size() < versionStrSplitB.size())
+        bool postRelease(const size_t pos)
         {
-            versionStrSplitA.push_back(0);
+            // Implicit post release: "-<number>".
+            if (const auto digits = pos < m_input.size() && m_input[pos] == '-' ? digitsAt(pos + 1) : 0; digits > 0)
+            {
+                implicitPostNumber = m_input.substr(pos + 1, digits);
+                post = {};
+                postNumber = {};
+                if (devRelease(pos + 1 + digits))
+                {
+                    return true;
+                }
+            }
+
+            implicitPostNumber = {};
+            static constexpr std::array<std::string_view, 3> KEYWORDS {"post", "rev", "r"};
+            return labeledPart(
+                pos, KEYWORDS, post, postNumber, [this](const size_t end) { return devRelease(end); });
         }
 
-        while (versionStrSplitB.size() < versionStrSplitA.size())
+        bool preRelease(const size_t pos)
         {
-            versionStrSplitB.push_back(0);
+            static constexpr std::array<std::string_view, 8> KEYWORDS {
+                "a", "b", "c", "rc", "alpha", "beta", "pre", "preview"};
+            return labeledPart(pos, KEYWORDS, pre, preNumber, [this](const size_t end) { return postRelease(end); });
         }
 
-        for (size_t itemIdx = 0; itemIdx < versionStrSplitA.size(); itemIdx++)
+        bool releaseVersion(const size_t pos)
+        {
+            // Taking all the dot-separated numbers is the only choice that can match: no later part starts with them.
+            auto end = pos + digitsAt(pos);
+            if (end == pos)
+            {
+                return false;
+            }
+            while (end < m_input.size() && m_input[end] == '.' && digitsAt(end + 1) > 0)
+            {
+                end += 1 + digitsAt(end + 1);
+            }
+
+            release = m_input.substr(pos, end - pos);
+            return preRelease(end);
+        }
+
+    public:
+        std::string_view epoch;              ///< Epoch.
+        std::string_view release;            ///< Release version string.
+        std::string_view pre;                ///< Pre-release string: a, b, c, rc, alpha, beta, pre, preview.
+        std::string_view preNumber;          ///< Pre-release number.
+        std::string_view implicitPostNumber; ///< Implicit post release number.
+        std::string_view post;               ///< Post-release string: post, r, rev.
+        std::string_view postNumber;         ///< Post-release number.
+        std::string_view dev;                ///< Development release string: dev.
+        std::string_view devNumber;          ///< Development release number.
+
+        explicit Parser(std::string_view input)
+            : m_input {input}
+        {
+        }
+
+        /**
+         * @brief Parses the whole input.
+         *
+         * @return true if the input is a PEP 440 version.
+         */
+        bool parse()
+        {
+            const size_t start = !m_input.empty() && std::tolower(static_cast<unsigned char>(m_input[0])) == 'v';
+
+            if (const auto digits = digitsAt(start);
+                digits > 0 && start + digits < m_input.size() && m_input[start + digits] == '!')
+            {
+                epoch = m_input.substr(start, digits);
+                if (releaseVersion(start + digits + 1))
+                {
+                    return true;
+                }
+            }
+
+            epoch = {};
+            if (releaseVersion(start))
+            {
+                return true;
+            }
+
+            // Everything after the "v" is optional.
+            *this = Parser(m_input);
+            return start == m_input.size();
+        }
+    };
+
+    /**
+     * @brief Comparison method for the versionStr variable members.
+     *
+     * @param versionStrA versionStr member of object A.
+     * @param versionStrB versionStr member of object B.
+     * @return 0  if A is equal to B.
+     *         -1 if A is less than B.
+     *         1  if A is greater than B.
+     */
+    static int compareVersionStr(std::string_view versionStrA, std::string_view versionStrB)
+    {
+        // Pops the next dot-separated number, missing numbers are zero.
+        auto next = [](std::string_view& versionStr)
+        {
+            if (versionStr.empty())
+            {
+                return static_cast<uint32_t>(0);
+            }
+            const auto separator = versionStr.find('.');
+            const auto number = static_cast<uint32_t>(parseNumber(versionStr.substr(0, separator)));
+            versionStr.remove_prefix(separator == std::string_view::npos ? versionStr.size() : separator + 1);
+            return number;
+        };
+
+        while (!versionStrA.empty() || !versionStrB.empty())
         {
-            if (versionStrSplitA[itemIdx] < versionStrSplitB[itemIdx])
+            const auto numberA = next(versionStrA);
+            const auto numberB = next(versionStrB);
+            if (numberA < numberB)
             {
                 return -1;
             }
-            if (versionStrSplitA[itemIdx] > versionStrSplitB[itemIdx])
+            if (numberA > numberB)
             {
                 return 1;
             }
@@ -119,23 +300,23 @@ public:
      */
     static bool match(const std::string& version, PEP440& data)
     {
-        std::smatch parserMatches;
-        if (!std::regex_match(version, parserMatches, m_parserRegex))
+        Parser parser {version};
+        if (!parser.parse())
         {
             return false;
         }
 
         // Epoch
-        data.epoch = parserMatches.str(1).empty() ? 0 : static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
+        data.epoch = parser.epoch.empty() ? 0 : static_cast<uint32_t>(parseNumber(parser.epoch));
 
         // Release version string
-        data.versionStr = parserMatches.str(2);
+        data.versionStr = parser.release;
 
         // Pre-release
-        data.hasPreRelease = parserMatches[3].matched;
+        data.hasPreRelease = !parser.pre.empty();
         if (data.hasPreRelease)
         {
-            data.preReleaseStr = parserMatches.str(3);
+            data.preReleaseStr = parser.pre;
             std::transform(data.preReleaseStr.begin(), data.preReleaseStr.end(), data.preReleaseStr.begin(), ::tolower);
             if (data.preReleaseStr == "alpha")
             {
@@ -150,24 +331,24 @@ public:
                 data.preReleaseStr = "rc";
             }
         }
-        data.preReleaseNumber = parserMatches.str(4).empty() ? 0 : std::stoul(parserMatches.str(4));
+        data.preReleaseNumber = parser.preNumber.empty() ? 0 : parseNumber(parser.preNumber);
 
         // Post release
-        data.hasPostRelease = parserMatches[6].matched || parserMatches[5].matched;
+        data.hasPostRelease = !parser.post.empty() || !parser.implicitPostNumber.empty();
 
-        if (parserMatches[5].matched)
+        if (!parser.implicitPostNumber.empty())
         {
-            data.postReleaseNumber = std::stoul(parserMatches.str(5));
+            data.postReleaseNumber = parseNumber(parser.implicitPostNumber);
         }
         else
         {
-            data.postReleaseNumber = parserMatches.str(7).empty() ? 0 : std::stoul(parserMatches.str(7));
+            data.postReleaseNumber = parser.postNumber.empty() ? 0 : parseNumber(parser.postNumber);
         }
 
         // Development release
-        data.hasDevRelease = parserMatches[8].matched;
+        data.hasDevRelease = !parser.dev.empty();
 
-        data.devReleaseNumber = parserMatches.str(9).empty() ? 0 : std::stoul(parserMatches.str(9));
+        data.devReleaseNumber = parser.devNumber.empty() ? 0 : parseNumber(parser.devNumber);
 
         return true;
     }
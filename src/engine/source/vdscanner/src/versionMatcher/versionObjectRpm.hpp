@@ -17,7 +17,6 @@
 #include <cstring>
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
 
 static auto constexpr RIGHT_IS_NEWER = -1;
@@ -42,7 +41,6 @@ struct Rpm
 class VersionObjectRpm final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint32_t m_epoch;
     std::string m_version;
     std::string m_release;
@@ -13,10 +13,13 @@
 #define _VERSION_OBJECT_SEMVER_HPP
 
 #include "iVersionObjectInterface.hpp"
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <iostream>
 #include <memory>
-#include <regex>
 #include <string>
+#include <string_view>
 
 /**
  * @brief SemVer data struct.
@@ -38,13 +41,49 @@ struct SemVer
 class VersionObjectSemVer final : public IVersionObject
 {
 private:
-    static std::regex m_parserRegex;
     uint32_t m_major;
     uint32_t m_minor;
     uint32_t m_patch;
     std::string m_preRelease;
     std::string m_buildMetadata;
 
+    /**
+     * @brief Checks a list of dot-separated identifiers made of ASCII alphanumerics and hyphens.
+     *
+     * @param identifiers list to check.
+     * @param isPreRelease if true, numeric identifiers must not have leading zeros.
+     * @return true/false according to the check.
+     */
+    static bool isIdentifierList(std::string_view identifiers, bool isPreRelease)
+    {
+        while (true)
+        {
+            const auto separator = identifiers.find('.');
+            const auto identifier = identifiers.substr(0, separator);
+            if (identifier.empty())
+            {
+                return false;
+            }
+            for (const auto character : identifier)
+            {
+                if (!std::isalnum(static_cast<unsigned char>(character)) && character != '-')
+                {
+                    return false;
+                }
+            }
+            if (isPreRelease && identifier.size() > 1 && identifier[0] == '0' && isNumber(identifier))
+            {
+                return false;
+            }
+
+            if (separator == std::string_view::npos)
+            {
+                return true;
+            }
+            identifiers.remove_prefix(separator + 1);
+        }
+    }
+
 public:
     /**
      * @brief Static method to match a version string to a SemVer object.
@@ -55,20 +94,56 @@ public:
      */
     static bool match(const std::string& version, SemVer& output)
     {
-        std::smatch parserMatches;
-        if ((std::regex_match(version, parserMatches, m_parserRegex) == false) || (parserMatches.size() != 6))
+        std::string_view remaining {version};
+
+        // Pre-release and build metadata, "-<pre-release>" up to the first '+' and "+<build metadata>".
+        std::string_view preRelease;
+        std::string_view buildMetadata;
+        if (const auto plus = remaining.find('+'); plus != std::string_view::npos)
         {
-            return false;
+            buildMetadata = remaining.substr(plus + 1);
+            if (!isIdentifierList(buildMetadata, false))
+            {
+                return false;
+            }
+            remaining = remaining.substr(0, plus);
+        }
+        if (const auto dash = remaining.find('-'); dash != std::string_view::npos)
+        {
+            preRelease = remaining.substr(dash + 1);
+            if (!isIdentifierList(preRelease, true))
+            {
+                return false;
+            }
+            remaining = remaining.substr(0, dash);
         }
 
-        output.major = static_cast<uint32_t>(std::stoul(parserMatches.str(1)));
-        output.minor = static_cast<uint32_t>(std::stoul(parserMatches.str(2)));
-        output.patch = static_cast<uint32_t>(std::stoul(parserMatches.str(3)));
-        output.preRelease = parserMatches[4];
-        output.buildMetadata = parserMatches[5];
+        // Core version, three dot-separated numbers.
+        std::array<std::string_view, 3> numbers {};
+        for (size_t i = 0; i < numbers.size(); ++i)
+        {
+            const auto separator = i + 1 < numbers.size() ? remaining.find('.') : remaining.size();
+            if (separator == std::string_view::npos)
+            {
+                return false;
+            }
+            numbers[i] = remaining.substr(0, separator);
+            if (!isNumber(numbers[i]) || (numbers[i].size() > 1 && numbers[i][0] == '0'))
+            {
+                return false;
+            }
+            remaining.remove_prefix(std::min(separator + 1, remaining.size()));
+        }
+
+        output.major = static_cast<uint32_t>(parseNumber(numbers[0]));
+        output.minor = static_cast<uint32_t>(parseNumber(numbers[1]));
+        output.patch = static_cast<uint32_t>(parseNumber(numbers[2]));
+        output.preRelease = preRelease;
+        output.buildMetadata = buildMetadata;
 
         return true;
     }
+
     /**
      * @brief Constructor.
      *
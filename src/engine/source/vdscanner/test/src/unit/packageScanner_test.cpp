@@ -418,6 +418,13 @@ const nlohmann::json CNA_MAPPINGS = R"***(
     }
     )***"_json;
 
+const auto OS_MAPPING_INDEX = []()
+{
+    OsMappingIndex index;
+    index.build(CPE_MAPS, CNA_MAPPINGS);
+    return index;
+}();
+
 } // namespace NSPackageScannerTest
 
 using namespace NSPackageScannerTest;
@@ -480,8 +487,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualTo)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -549,8 +555,7 @@ TEST_F(PackageScannerTest, TestPackageUnaffectedEqualTo)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -608,8 +613,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThan)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -677,8 +681,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThanVendorMissing)
     auto scanContext = std::make_shared<ScanContext>(
         ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_WITHOUT_VENDOR_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -736,8 +739,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThanVendorMismatch)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -795,8 +797,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThanVendorMatch)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -864,8 +865,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThanOrEqual)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -933,8 +933,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedLessThanWithVersionNotZero)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1002,8 +1001,7 @@ TEST_F(PackageScannerTest, TestPackageUnaffectedLessThan)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1061,8 +1059,7 @@ TEST_F(PackageScannerTest, TestPackageDefaultStatusAffected)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1129,8 +1126,7 @@ TEST_F(PackageScannerTest, TestPackageDefaultStatusUnaffected)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1161,7 +1157,7 @@ TEST_F(PackageScannerTest, TestPackageGetVulnerabilitiesCandidatesGeneratesExcep
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1200,7 +1196,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToAlma8)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1237,7 +1233,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToAlas1)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1274,7 +1270,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToAlas2)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1311,7 +1307,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToAlas2022)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1348,7 +1344,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToRedHat7)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1385,7 +1381,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToSLED)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1422,7 +1418,7 @@ TEST_F(PackageScannerTest, TestPackageAffectedEqualToSLES)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1480,8 +1476,7 @@ TEST_F(PackageScannerTest, TestcheckAndTranslatePackage)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1551,8 +1546,7 @@ TEST_F(PackageScannerTest, TestVersionTranslation)
     auto scanContext = std::make_shared<ScanContext>(
         ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_WRONG_VERSION_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1622,8 +1616,7 @@ TEST_F(PackageScannerTest, TestVendorAndVersionTranslation)
     auto scanContext = std::make_shared<ScanContext>(
         ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_WRONG_VERSION_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cpeMappings()).WillOnce(testing::ReturnRef(CPE_MAPS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1674,7 +1667,7 @@ TEST_F(PackageScannerTest, TestGetCnaNameByPrefix)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1714,7 +1707,7 @@ TEST_F(PackageScannerTest, TestGetCnaNameByContains)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1754,7 +1747,7 @@ TEST_F(PackageScannerTest, TestGetCnaNameBySource)
     auto scanContext =
         std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, LOCAL_OS_MSG, PACKAGES_MSG, "{}"_json, response);
 
-    EXPECT_CALL(*spDatabaseFeedManagerMock, cnaMappings()).WillOnce(testing::ReturnRef(CNA_MAPPINGS));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
 
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
@@ -1797,4 +1790,75 @@ TEST_F(PackageScannerTest, TestGetDefaultCna)
     TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
 
     EXPECT_NO_THROW(packageScanner.handleRequest(scanContext));
-}
\ No newline at end of file
+}
+TEST_F(PackageScannerTest, TestVerdictCache)
+{
+    auto mockGetVulnerabilitiesCandidates =
+        [&](const std::string& cnaName,
+            const PackageData& package,
+            const std::function<bool(const std::string& cnaName,
+                                     const PackageData& package,
+                                     const NSVulnerabilityScanner::ScanVulnerabilityCandidate&)>& callback)
+    {
+        std::string candidatesFlatbufferSchemaStr;
+
+        // Read schemas from filesystem.
+        bool valid =
+            flatbuffers::LoadFile(CANDIDATES_FLATBUFFER_SCHEMA_PATH.c_str(), false, &candidatesFlatbufferSchemaStr);
+        ASSERT_EQ(valid, true);
+
+        // Parse schemas and JSON example.
+        flatbuffers::Parser fbParser;
+        const char* includeDirectories[] = {INCLUDE_DIRECTORIES[0], INCLUDE_DIRECTORIES[1]};
+        valid = (fbParser.Parse(candidatesFlatbufferSchemaStr.c_str(), includeDirectories)
+                 && fbParser.Parse(CANDIDATES_AFFECTED_EQUAL_TO_INPUT.c_str()));
+        ASSERT_EQ(valid, true);
+
+        auto candidatesArray = NSVulnerabilityScanner::GetScanVulnerabilityCandidateArray(
+            reinterpret_cast<const uint8_t*>(fbParser.builder_.GetBufferPointer()));
+
+        if (candidatesArray)
+        {
+            for (const auto& candidate : *candidatesArray->candidates())
+            {
+                if (callback(cnaName, package, *candidate))
+                {
+                    // If the candidate is vulnerable, we stop looking for.
+                    break;
+                }
+            }
+        }
+    };
+    auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getCnaNameByFormat(_)).WillRepeatedly(testing::Return("cnaName"));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, osMappingIndex()).WillRepeatedly(testing::ReturnRef(OS_MAPPING_INDEX));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, feedGeneration())
+        .WillOnce(testing::Return(1))
+        .WillOnce(testing::Return(1))
+        .WillOnce(testing::Return(2));
+
+    // The first and the third scans run, the second one is answered from the cache.
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabilitiesCandidates(_, _, _))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(mockGetVulnerabilitiesCandidates));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, checkAndTranslatePackage(_, _)).Times(2);
+
+    TPackageScanner<MockDatabaseFeedManager, ScanContext> packageScanner(spDatabaseFeedManagerMock);
+
+    for (auto i = 0; i < 3; ++i)
+    {
+        nlohmann::json response;
+        auto scanContext =
+            std::make_shared<ScanContext>(ScannerType::Package, AGENT_MSG, OS_MSG, PACKAGES_MSG, "{}"_json, response);
+
+        EXPECT_NO_THROW(packageScanner.handleRequest(scanContext));
+
+        EXPECT_EQ(scanContext->m_elements.size(), 1);
+        EXPECT_NE(scanContext->m_elements.find(CVEID), scanContext->m_elements.end());
+
+        EXPECT_EQ(scanContext->m_matchConditions.size(), 1);
+        const auto& matchCondition = scanContext->m_matchConditions[CVEID];
+        EXPECT_EQ(matchCondition.condition, MatchRuleCondition::Equal);
+        EXPECT_STREQ(matchCondition.version.c_str(), "5.1.9");
+    }
+}
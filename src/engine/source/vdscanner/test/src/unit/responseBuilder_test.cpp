@@ -178,18 +178,20 @@ TEST_F(ResponseBuilderTest, TestSuccessfulPackageResponseCVSS2)
                                                                      "userInteraction_test_string");
     fbBuilder.Finish(vulnerabilityDescriptionData);
 
-    auto mockGetVulnerabiltyDescriptiveInformation =
-        [&](const std::string_view /*cveId*/,
-            FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
+    auto mockGetVulnerabilitiesDescriptiveInformation =
+        [&](const std::vector<std::string>& cveIds, VulnerabilityDescriptions& resultContainer)
     {
         rocksdb::Slice value(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize());
-        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
-            NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        for (const auto& cveId : cveIds)
+        {
+            resultContainer[cveId].data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+                NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        }
     };
 
     auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
-    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabiltyDescriptiveInformation(_, _))
-        .WillRepeatedly(testing::Invoke(mockGetVulnerabiltyDescriptiveInformation));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabilitiesDescriptiveInformation(_, _))
+        .WillOnce(testing::Invoke(mockGetVulnerabilitiesDescriptiveInformation));
 
     nlohmann::json response;
     auto scanContext = std::make_shared<ScanContext>(
@@ -262,18 +264,20 @@ TEST_F(ResponseBuilderTest, TestSuccessfulPackageResponseCVSS3)
                                                                      "userInteraction_test_string");
     fbBuilder.Finish(vulnerabilityDescriptionData);
 
-    auto mockGetVulnerabiltyDescriptiveInformation =
-        [&](const std::string_view /*cveId*/,
-            FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
+    auto mockGetVulnerabilitiesDescriptiveInformation =
+        [&](const std::vector<std::string>& cveIds, VulnerabilityDescriptions& resultContainer)
     {
         rocksdb::Slice value(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize());
-        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
-            NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        for (const auto& cveId : cveIds)
+        {
+            resultContainer[cveId].data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+                NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        }
     };
 
     auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
-    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabiltyDescriptiveInformation(_, _))
-        .WillRepeatedly(testing::Invoke(mockGetVulnerabiltyDescriptiveInformation));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabilitiesDescriptiveInformation(_, _))
+        .WillOnce(testing::Invoke(mockGetVulnerabilitiesDescriptiveInformation));
 
     nlohmann::json response;
     auto scanContext = std::make_shared<ScanContext>(
@@ -384,18 +388,20 @@ TEST_F(ResponseBuilderTest, TestSuccessfulOSResponseCVSS3)
                                                                      "userInteraction_test_string");
     fbBuilder.Finish(vulnerabilityDescriptionData);
 
-    auto mockGetVulnerabiltyDescriptiveInformation =
-        [&](const std::string_view /*cveId*/,
-            FlatbufferDataPair<NSVulnerabilityScanner::VulnerabilityDescription>& resultContainer)
+    auto mockGetVulnerabilitiesDescriptiveInformation =
+        [&](const std::vector<std::string>& cveIds, VulnerabilityDescriptions& resultContainer)
     {
         rocksdb::Slice value(reinterpret_cast<const char*>(fbBuilder.GetBufferPointer()), fbBuilder.GetSize());
-        resultContainer.data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
-            NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        for (const auto& cveId : cveIds)
+        {
+            resultContainer[cveId].data = const_cast<NSVulnerabilityScanner::VulnerabilityDescription*>(
+                NSVulnerabilityScanner::GetVulnerabilityDescription(value.data()));
+        }
     };
 
     auto spDatabaseFeedManagerMock = std::make_shared<MockDatabaseFeedManager>();
-    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabiltyDescriptiveInformation(_, _))
-        .WillRepeatedly(testing::Invoke(mockGetVulnerabiltyDescriptiveInformation));
+    EXPECT_CALL(*spDatabaseFeedManagerMock, getVulnerabilitiesDescriptiveInformation(_, _))
+        .WillOnce(testing::Invoke(mockGetVulnerabilitiesDescriptiveInformation));
 
     nlohmann::json response;
     auto scanContext =
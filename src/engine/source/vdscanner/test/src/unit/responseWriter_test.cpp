@@ -0,0 +1,106 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "../../../src/responseWriter.hpp"
+#include <gtest/gtest.h>
+
+TEST(ResponseWriterTest, WritesTheSameAsDump)
+{
+    const auto detections = R"([{"id":"CVE-2024-0001","score":{"base":7.5}},{"id":"CVE-2024-0002"}])"_json;
+    const auto removed = R"(["item1","item2"])"_json;
+
+    ResponseWriter writer;
+    writer.beginObject();
+    writer.key("detections");
+    writer.beginArray();
+    for (const auto& detection : detections)
+    {
+        writer.value(detection);
+    }
+    writer.endArray();
+    writer.key("removed");
+    writer.value(removed);
+    writer.key("empty");
+    writer.beginArray();
+    writer.endArray();
+    writer.endObject();
+    writer.finish();
+
+    nlohmann::json expected;
+    expected["detections"] = detections;
+    expected["removed"] = removed;
+    expected["empty"] = nlohmann::json::array();
+
+    // The writer keeps the order of the keys, a dumped object sorts them.
+    EXPECT_EQ(nlohmann::json::parse(writer.take()), expected);
+}
+
+TEST(ResponseWriterTest, WritesArrays)
+{
+    ResponseWriter writer;
+    writer.beginArray();
+    writer.value(1);
+    writer.value("two");
+    writer.beginArray();
+    writer.value(nullptr);
+    writer.endArray();
+    writer.endArray();
+    writer.finish();
+
+    EXPECT_EQ(writer.take(), R"([1,"two",[null]])");
+}
+
+TEST(ResponseWriterTest, StreamsChunks)
+{
+    std::vector<std::string> chunks;
+    ResponseWriter writer([&chunks](std::string_view chunk) { chunks.emplace_back(chunk); }, 8);
+
+    writer.beginArray();
+    for (auto i = 0; i < 10; ++i)
+    {
+        writer.value("value");
+    }
+    writer.endArray();
+    writer.finish();
+
+    std::string response;
+    for (const auto& chunk : chunks)
+    {
+        EXPECT_LT(chunk.size(), 16U);
+        response += chunk;
+    }
+
+    EXPECT_GT(chunks.size(), 1U);
+    EXPECT_EQ(response, nlohmann::json(std::vector<std::string>(10, "value")).dump());
+    EXPECT_TRUE(writer.take().empty());
+}
+
+TEST(ResponseWriterTest, RejectsMalformedResponses)
+{
+    {
+        ResponseWriter writer;
+        EXPECT_THROW(writer.key("key"), std::logic_error);
+    }
+    {
+        ResponseWriter writer;
+        writer.beginObject();
+        EXPECT_THROW(writer.value(1), std::logic_error);
+    }
+    {
+        ResponseWriter writer;
+        writer.beginObject();
+        EXPECT_THROW(writer.endArray(), std::logic_error);
+    }
+    {
+        ResponseWriter writer;
+        writer.beginArray();
+        EXPECT_THROW(writer.finish(), std::logic_error);
+    }
+}
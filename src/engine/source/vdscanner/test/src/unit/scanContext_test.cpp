@@ -370,3 +370,45 @@ TEST_F(ScanContextTest, HotfixesTest)
     nlohmann::json actual = scanContext->hotfixes();
     EXPECT_EQ(expected, actual);
 }
+
+// Test case for the fields that are missing or are not strings
+TEST_F(ScanContextTest, MissingFieldsTest)
+{
+    const auto package = R"({"name": 1, "size": "1024"})"_json;
+    ScanContext context(ScannerType::Os, agentData, osData, package, hotfixesData, responseData);
+
+    EXPECT_TRUE(context.packageName().empty());
+    EXPECT_STREQ(context.packageVersion().data(), "");
+    EXPECT_EQ(context.packageSize(), 0);
+
+    ScanContext osContext(ScannerType::Os, agentData, osData, nullptr, hotfixesData, responseData);
+    EXPECT_TRUE(osContext.packageName().empty());
+    EXPECT_EQ(osContext.osName(), "Test OS");
+}
+
+// Test case for the contexts that share the agent and OS of a request
+TEST_F(ScanContextTest, SharedTargetTest)
+{
+    const auto target = std::make_shared<const ScanTarget>(agentData, osData, hotfixesData);
+    const auto otherPackage = R"({"name": "other-package"})"_json;
+    ScanContext first(ScannerType::Package, target, packageData, responseData);
+    ScanContext second(ScannerType::Package, target, otherPackage, responseData);
+
+    EXPECT_EQ(first.packageName(), "test-package");
+    EXPECT_EQ(second.packageName(), "other-package");
+    EXPECT_EQ(first.agentId().data(), second.agentId().data());
+    EXPECT_EQ(second.osHostName(), "test-host");
+}
+
+// Test case for the OS CPE name, built from the OS mapping index
+TEST_F(ScanContextTest, OsCpeNameTest)
+{
+    OsMappingIndex osMappings;
+    osMappings.build(R"***({"Test": "Test:Test_OS:$(MAJOR_VERSION).$(MINOR_VERSION)", "other": "other"})***"_json,
+                     R"({})"_json);
+    EXPECT_EQ(scanContext->osCPEName(osMappings), "cpe:/o:test:test_os:1.0");
+
+    auto unsupported = R"({"name": "Unsupported OS", "platform": "unsupported"})"_json;
+    ScanContext context(ScannerType::Os, agentData, unsupported, nullptr, hotfixesData, responseData);
+    EXPECT_TRUE(context.osCPEName(osMappings).empty());
+}
@@ -0,0 +1,54 @@
+/*
+ * Wazuh Vulnerability Scanner - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "scanStats.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+
+class ScanStatsTest : public ::testing::Test
+{
+protected:
+    void SetUp() override { ScanStats::instance().reset(); }
+
+    void TearDown() override
+    {
+        ScanStats::instance().enable(false);
+        ScanStats::instance().reset();
+    }
+};
+
+TEST_F(ScanStatsTest, DisabledByDefault)
+{
+    {
+        ScanStageTimer timer {ScanStage::Translation};
+    }
+    EXPECT_EQ(ScanStats::instance().totals(ScanStage::Translation).count, 0);
+}
+
+TEST_F(ScanStatsTest, NestedStagesAreExcluded)
+{
+    ScanStats::instance().enable(true);
+    {
+        ScanStageTimer lookup {ScanStage::CandidateLookup};
+        for (auto i = 0; i < 2; ++i)
+        {
+            ScanStageTimer match {ScanStage::VersionMatch};
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+
+    const auto lookup = ScanStats::instance().totals(ScanStage::CandidateLookup);
+    const auto match = ScanStats::instance().totals(ScanStage::VersionMatch);
+    EXPECT_EQ(lookup.count, 1);
+    EXPECT_EQ(match.count, 2);
+    EXPECT_GE(match.nanoseconds, 40'000'000);
+    EXPECT_LT(lookup.nanoseconds, match.nanoseconds);
+}
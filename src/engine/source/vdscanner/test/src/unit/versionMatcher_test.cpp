@@ -798,6 +798,40 @@ TEST_F(VersionMatcherTest, matchCalVer)
 
     EXPECT_FALSE(VersionMatcher::match("21.0.0", VersionObjectType::CalVer));
     EXPECT_FALSE(VersionMatcher::match("202.11.02.1", VersionObjectType::CalVer));
+    EXPECT_FALSE(VersionMatcher::match("2023.11.", VersionObjectType::CalVer));
+    EXPECT_FALSE(VersionMatcher::match("2023.11.02.1.1", VersionObjectType::CalVer));
+}
+
+TEST_F(VersionMatcherTest, compareCalVer_OptionalFields)
+{
+    // A number too long for a month or a day is the micro.
+    EXPECT_EQ(VersionMatcher::compare("2023.123", "2023.124", VersionObjectType::CalVer),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(VersionMatcher::compare("2023.123", "2023.1", VersionObjectType::CalVer),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(VersionMatcher::compare("2023.11.123", "2023.11.1.123", VersionObjectType::CalVer),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(VersionMatcher::compare("2023.11.2", "2023.11.02", VersionObjectType::CalVer),
+              VersionComparisonResult::A_EQUAL_B);
+}
+
+TEST_F(VersionMatcherTest, compareParsed)
+{
+    const auto parsed = VersionMatcher::parse("1.2.3", VersionObjectType::SemVer);
+    ASSERT_NE(parsed, nullptr);
+
+    EXPECT_EQ(VersionMatcher::compare(parsed, "1.2.3", "1.2.3", VersionObjectType::SemVer),
+              VersionComparisonResult::A_EQUAL_B);
+    EXPECT_EQ(VersionMatcher::compare(parsed, "1.2.3", "1.3.0", VersionObjectType::SemVer),
+              VersionComparisonResult::A_LESS_THAN_B);
+    EXPECT_EQ(VersionMatcher::compare(parsed, "1.2.3", "1.2.0", VersionObjectType::SemVer),
+              VersionComparisonResult::A_GREATER_THAN_B);
+    EXPECT_THROW(VersionMatcher::compare(parsed, "1.2.3", "invalid", VersionObjectType::SemVer),
+                 std::invalid_argument);
+
+    EXPECT_EQ(VersionMatcher::parse("invalid", VersionObjectType::SemVer), nullptr);
+    EXPECT_THROW(VersionMatcher::compare(nullptr, "invalid", "1.2.3", VersionObjectType::SemVer),
+                 std::invalid_argument);
 }
 
 TEST_F(VersionMatcherTest, matchPEP440)
@@ -12,7 +12,9 @@
 #ifndef _CMD_ARGS_PARSER_HPP_
 #define _CMD_ARGS_PARSER_HPP_
 
+#include <cstddef>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 /**
@@ -29,8 +31,21 @@ public:
     explicit CmdLineArgs(const int argc, const char* argv[])
         : m_configurationFilePath {paramValueOf(argc, argv, "-c")}
         , m_logFilePath {paramValueOf(argc, argv, "-l", std::make_pair(false, "/dev/stdout"))}
-        , m_socketPath {paramValueOf(argc, argv, "-s")}
+        , m_socketPath {paramValueOf(argc, argv, "-s", std::make_pair(false, ""))}
+        , m_corpusPath {paramValueOf(argc, argv, "-b", std::make_pair(false, ""))}
+        , m_benchmarkThreads {std::stoul(paramValueOf(argc, argv, "-t", std::make_pair(false, "1")))}
+        , m_benchmarkRounds {std::stoul(paramValueOf(argc, argv, "-r", std::make_pair(false, "1")))}
     {
+        // The benchmark replays its corpus instead of serving requests.
+        if (m_socketPath.empty() && m_corpusPath.empty())
+        {
+            throw std::runtime_error {"Switch value: -s not found."};
+        }
+
+        if (m_benchmarkThreads == 0 || m_benchmarkRounds == 0)
+        {
+            throw std::runtime_error {"The benchmark threads and rounds must be greater than zero."};
+        }
     }
 
     /**
@@ -53,6 +68,27 @@ public:
      */
     const std::string& getSocketPath() const { return m_socketPath; }
 
+    /**
+     * @brief Gets the benchmark corpus path.
+     *
+     * @return Path to the corpus of requests to replay, empty if not in benchmark mode.
+     */
+    const std::string& getCorpusPath() const { return m_corpusPath; }
+
+    /**
+     * @brief Gets the amount of requests the benchmark scans at the same time.
+     *
+     * @return Benchmark threads.
+     */
+    size_t getBenchmarkThreads() const { return m_benchmarkThreads; }
+
+    /**
+     * @brief Gets the amount of times the benchmark scans each request of the corpus.
+     *
+     * @return Benchmark rounds.
+     */
+    size_t getBenchmarkRounds() const { return m_benchmarkRounds; }
+
     /**
      * @brief Shows the help to the user.
      */
@@ -63,9 +99,15 @@ public:
                   << "\t-h \t\t\tShow this help message\n"
                   << "\t-c CONFIG_FILE\t\tSpecifies the configuration file.\n"
                   << "\t-l LOG_FILE\t\tSpecifies the log file to write.\n"
+                  << "\t-s SOCKET_FILE\t\tSpecifies the socket to serve the scan requests on.\n"
+                  << "\t-b CORPUS\t\tReplays the requests of a directory, one per file, or of a file, one per line,\n"
+                  << "\t\t\t\tand prints the throughput report instead of serving them.\n"
+                  << "\t-t THREADS\t\tRequests the benchmark scans at the same time. Default: 1.\n"
+                  << "\t-r ROUNDS\t\tTimes the benchmark scans each request. Default: 1.\n"
                   << "\nExample:"
                   << "\n\t./vd_scanner_testtool -c config.json -s test.sock\n"
                   << "\n\t./vd_scanner_testtool -c config.json -s test.sock -l log.txt\n"
+                  << "\n\t./vd_scanner_testtool -c config.json -b corpus/ -t 4 -r 10 -l /dev/null\n"
                   << std::endl;
     }
 
@@ -97,6 +139,9 @@ private:
     const std::string m_configurationFilePath;
     const std::string m_logFilePath;
     const std::string m_socketPath;
+    const std::string m_corpusPath;
+    const size_t m_benchmarkThreads;
+    const size_t m_benchmarkRounds;
 };
 
 #endif // _CMD_ARGS_PARSER_HPP_
@@ -0,0 +1,193 @@
+/*
+ * Wazuh Vulnerability scanner - Benchmark
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BENCHMARK_HPP
+#define _BENCHMARK_HPP
+
+#include "base/logging.hpp"
+#include "scanOrchestrator.hpp"
+#include "scanStats.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+#include <sys/resource.h>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Replays a corpus of recorded scan requests and measures the throughput of the scanner.
+ *
+ * @details The requests are scanned against the feed of the configuration as it is, so two runs over the same feed
+ * snapshot compare the code, and two runs of the same code compare the feeds.
+ */
+class Benchmark final
+{
+public:
+    /**
+     * @brief Loads a corpus of requests.
+     *
+     * @param path Directory with a request per file, taken in name order, or a file with a request per line.
+     * @return Requests of the corpus.
+     */
+    static std::vector<std::string> loadCorpus(const std::string& path)
+    {
+        std::vector<std::string> requests;
+        if (std::filesystem::is_directory(path))
+        {
+            std::vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::directory_iterator(path))
+            {
+                if (entry.is_regular_file())
+                {
+                    files.push_back(entry.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+
+            for (const auto& file : files)
+            {
+                std::ifstream stream(file);
+                requests.emplace_back(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+            }
+        }
+        else
+        {
+            std::ifstream stream(path);
+            if (!stream.is_open())
+            {
+                throw std::runtime_error("Error: Unable to open the corpus: " + path);
+            }
+
+            std::string line;
+            while (std::getline(stream, line))
+            {
+                if (!line.empty())
+                {
+                    requests.push_back(std::move(line));
+                }
+            }
+        }
+
+        if (requests.empty())
+        {
+            throw std::runtime_error("Error: The corpus has no requests: " + path);
+        }
+        return requests;
+    }
+
+    /**
+     * @brief Scans each request of the corpus the given amount of rounds.
+     *
+     * @param scanOrchestrator Scanner.
+     * @param corpus Requests.
+     * @param threads Amount of requests scanned at the same time.
+     * @param rounds Amount of times each request is scanned.
+     * @return Report with the scans per second, the scan latency, the time of each stage and the peak RSS.
+     */
+    static nlohmann::json run(const ScanOrchestrator& scanOrchestrator,
+                              const std::vector<std::string>& corpus,
+                              const size_t threads,
+                              const size_t rounds)
+    {
+        auto& stats = ScanStats::instance();
+        stats.reset();
+        stats.enable(true);
+
+        const auto scans = corpus.size() * rounds;
+        std::vector<uint64_t> latencies(scans, 0);
+        std::atomic<size_t> nextScan {0};
+        std::atomic<size_t> failed {0};
+
+        auto worker = [&]()
+        {
+            std::string response;
+            for (auto i = nextScan++; i < scans; i = nextScan++)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                try
+                {
+                    scanOrchestrator.processEvent(corpus[i % corpus.size()], response);
+                }
+                catch (const std::exception& e)
+                {
+                    LOG_ERROR("Error scanning the request {} of the corpus: {}", i % corpus.size(), e.what());
+                    ++failed;
+                }
+                latencies[i] = elapsedNanoseconds(start);
+            }
+        };
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i)
+        {
+            workers.emplace_back(worker);
+        }
+        for (auto& thread : workers)
+        {
+            thread.join();
+        }
+        const auto elapsed = elapsedNanoseconds(start);
+        stats.enable(false);
+
+        nlohmann::json report;
+        report["requests"] = corpus.size();
+        report["rounds"] = rounds;
+        report["threads"] = workers.size();
+        report["scans"] = scans;
+        report["failed"] = failed.load();
+        report["elapsed_ms"] = static_cast<double>(elapsed) / 1e6;
+        report["scans_per_second"] = elapsed > 0 ? static_cast<double>(scans) * 1e9 / static_cast<double>(elapsed) : 0;
+
+        std::sort(latencies.begin(), latencies.end());
+        auto& latency = report["latency_ms"];
+        for (const auto& [name, percentile] : {std::pair {"p50", 50}, {"p90", 90}, {"p99", 99}})
+        {
+            latency[name] = static_cast<double>(latencies[(latencies.size() - 1) * percentile / 100]) / 1e6;
+        }
+        latency["max"] = static_cast<double>(latencies.back()) / 1e6;
+
+        auto& stages = report["stages"];
+        for (const auto& [name, stage] : {std::pair {"translation", ScanStage::Translation},
+                                          {"candidate_lookup", ScanStage::CandidateLookup},
+                                          {"version_match", ScanStage::VersionMatch},
+                                          {"response_building", ScanStage::ResponseBuilding}})
+        {
+            const auto totals = stats.totals(stage);
+            stages[name]["count"] = totals.count;
+            stages[name]["total_ms"] = static_cast<double>(totals.nanoseconds) / 1e6;
+            stages[name]["mean_us"] =
+                totals.count > 0 ? static_cast<double>(totals.nanoseconds) / 1e3 / static_cast<double>(totals.count)
+                                 : 0;
+        }
+
+        // The peak of the whole process, the feed opening included. Linux reports it in kilobytes.
+        rusage usage {};
+        getrusage(RUSAGE_SELF, &usage);
+        report["peak_rss_kb"] = usage.ru_maxrss;
+
+        return report;
+    }
+
+private:
+    static uint64_t elapsedNanoseconds(const std::chrono::steady_clock::time_point& start)
+    {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+    }
+};
+
+#endif // _BENCHMARK_HPP
@@ -10,10 +10,13 @@
  */
 
 #include "argsParser.hpp"
+#include "benchmark.hpp"
 #include "base/logging.hpp"
 #include "scanOrchestrator.hpp"
 #include <exception>
 #include <httplib.h>
+#include <stdexcept>
+#include <string_view>
 
 int main(const int argc, const char* argv[])
 {
@@ -41,14 +44,58 @@ int main(const int argc, const char* argv[])
 
         ScanOrchestrator scanOrchestrator(configurationData);
 
+        if (!args.getCorpusPath().empty())
+        {
+            const auto corpus = Benchmark::loadCorpus(args.getCorpusPath());
+            std::cout << Benchmark::run(
+                             scanOrchestrator, corpus, args.getBenchmarkThreads(), args.getBenchmarkRounds())
+                             .dump(4)
+                      << std::endl;
+            return 0;
+        }
+
+        // Streamed responses are sent while the scan runs, so a failed scan can only abort the transfer.
+        const auto configuration = nlohmann::json::parse(configurationData, nullptr, false);
+        const auto streamResponses = configuration.is_object() && configuration.contains("streamResponses")
+                                     && configuration.at("streamResponses").is_boolean()
+                                     && configuration.at("streamResponses").get<bool>();
+
         httplib::Server svr;
 
         svr.Post("/v1/vulnerabilityscanner",
                  [&](const httplib::Request& req, httplib::Response& res)
                  {
-                     std::string response;
-                     scanOrchestrator.processEvent(req.body, response);
-                     res.set_content(response, "application/json");
+                     if (!streamResponses)
+                     {
+                         std::string response;
+                         scanOrchestrator.processEvent(req.body, response);
+                         res.set_content(response, "application/json");
+                         return;
+                     }
+
+                     res.set_chunked_content_provider(
+                         "application/json",
+                         [&scanOrchestrator, request = req.body](size_t, httplib::DataSink& sink)
+                         {
+                             try
+                             {
+                                 scanOrchestrator.processEvent(request,
+                                                               [&sink](std::string_view chunk)
+                                                               {
+                                                                   if (!sink.write(chunk.data(), chunk.size()))
+                                                                   {
+                                                                       throw std::runtime_error("Connection closed");
+                                                                   }
+                                                               });
+                                 sink.done();
+                                 return true;
+                             }
+                             catch (const std::exception& e)
+                             {
+                                 LOG_ERROR("Error streaming the scan response: {}", e.what());
+                                 return false;
+                             }
+                         });
                  });
 
         svr.set_error_handler(
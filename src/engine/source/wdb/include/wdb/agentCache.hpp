@@ -0,0 +1,105 @@
+#ifndef _WDB_AGENT_CACHE_HPP
+#define _WDB_AGENT_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+
+#include <base/error.hpp>
+#include <wdb/iagentCache.hpp>
+#include <wdb/iwdbManager.hpp>
+
+namespace wazuhdb
+{
+
+constexpr std::string_view AGENT_EVENT_DELETE {"deleteAgent"}; ///< Action of the notifications of removed agents
+
+/**
+ * @brief Metadata of the agents of the global database, looked up by agent id without querying wazuh-db.
+ *
+ * The cache is loaded at startup with the rows of all the agents, and kept current by the agent change notifications
+ * published by wazuh-db ("wdb-agent-events"):
+ *
+ * @code{.json}
+ * {"action": "upgradeAgentDB", "agent_info": {"agent_id": "001", ...}}
+ * @endcode
+ *
+ * The row of the agent is queried again for any action, so the cache holds what wazuh-db stores and not the partial
+ * view of the notification. The agents of the "deleteAgent" action are removed.
+ *
+ * The lookups take a shared lock, they only wait for the updates of the map and never for wazuh-db.
+ */
+class AgentCache final : public IAgentCache
+{
+private:
+    using Agents = std::unordered_map<int64_t, std::shared_ptr<const json::Json>>;
+
+    std::shared_ptr<IWDBManager> m_wdbManager; ///< Queries the rows of the agents
+    mutable std::shared_mutex m_mutex;         ///< Protects the agents
+    Agents m_agents;                           ///< Row of each agent, by id
+
+    /**
+     * @brief Query the row of an agent.
+     *
+     * @param wdb Connection to wazuh-db.
+     * @param id Id of the agent.
+     * @return std::optional<json::Json> Row of the agent, empty if wazuh-db does not know it.
+     * @throw std::runtime_error if the query fails or its result is not a list of agents.
+     */
+    static std::optional<json::Json> queryAgent(IWDBHandler& wdb, int64_t id);
+
+public:
+    /**
+     * @brief Construct an empty cache.
+     *
+     * @param wdbManager Connects to wazuh-db.
+     * @throw std::runtime_error if the manager is null.
+     */
+    explicit AgentCache(std::shared_ptr<IWDBManager> wdbManager);
+
+    /**
+     * @brief Parse the id of an agent.
+     *
+     * @param agentId Decimal id, with or without leading zeros.
+     * @return std::optional<int64_t> Id, empty if it is not a valid id.
+     */
+    static std::optional<int64_t> parseId(std::string_view agentId) noexcept;
+
+    /**
+     * @brief Replace the content of the cache with all the agents of the global database.
+     *
+     * The agents are queried in pages and the cache is swapped once all of them are read, the lookups meanwhile get
+     * the previous content.
+     *
+     * @return std::size_t Number of agents loaded.
+     * @throw std::runtime_error if wazuh-db cannot be queried, the cache is left untouched.
+     */
+    std::size_t load();
+
+    /**
+     * @brief Apply an agent change notification of wazuh-db.
+     *
+     * @param notification Notification, as published to "wdb-agent-events".
+     * @return base::OptError Error if the notification is invalid or the agent cannot be queried.
+     */
+    base::OptError apply(std::string_view notification);
+
+    /**
+     * @copydoc IAgentCache::get
+     */
+    std::shared_ptr<const json::Json> get(std::string_view agentId) const override;
+
+    /**
+     * @brief Get the number of agents in the cache.
+     *
+     * @return std::size_t
+     */
+    std::size_t size() const;
+};
+
+} // namespace wazuhdb
+
+#endif // _WDB_AGENT_CACHE_HPP
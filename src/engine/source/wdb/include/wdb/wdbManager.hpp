@@ -2,12 +2,14 @@
 #define _WDB_WDB_MANAGER_HPP
 
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <sockiface/isockFactory.hpp>
 #include <wdb/iwdbManager.hpp>
 
 #include "wdbHandler.hpp"
+#include "wdbPool.hpp"
 
 namespace wazuhdb
 {
@@ -17,6 +19,8 @@ class WDBManager final : public IWDBManager
 private:
     std::string m_sockPath;
     std::shared_ptr<sockiface::ISockFactory> m_sockFactory;
+    std::mutex m_poolMutex;          ///< Protects the pool creation
+    std::shared_ptr<WDBPool> m_pool; ///< Pool of connections, created on the first use
 
 public:
     using sockProtocol = sockiface::ISockHandler::Protocol;
@@ -38,6 +42,21 @@ public:
         auto socket = m_sockFactory->getHandler(sockProtocol::STREAM, m_sockPath);
         return std::make_shared<WDBHandler>(socket);
     }
+
+    /**
+     * @copydoc IWDBManager::pooledConnection
+     */
+    std::shared_ptr<IWDBHandler> pooledConnection() override
+    {
+        std::lock_guard lock {m_poolMutex};
+        if (!m_pool)
+        {
+            m_pool = std::make_shared<WDBPool>(
+                [sockPath = m_sockPath, sockFactory = m_sockFactory]() -> std::shared_ptr<IWDBHandler>
+                { return std::make_shared<WDBHandler>(sockFactory->getHandler(sockProtocol::STREAM, sockPath)); });
+        }
+        return m_pool;
+    }
 };
 
 } // namespace wazuhdb
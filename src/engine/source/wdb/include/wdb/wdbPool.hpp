@@ -0,0 +1,131 @@
+#ifndef _WDB_WDB_POOL_HPP
+#define _WDB_WDB_POOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <wdb/iwdbHandler.hpp>
+
+namespace wazuhdb
+{
+
+constexpr std::size_t WDB_ASYNC_QUEUE_SIZE {4096}; ///< Queries waiting to be performed in background
+
+/**
+ * @brief Thread-safe WazuhDB handler over a pool of connections.
+ *
+ * Each query takes an idle connection from the pool, or opens a new one if all of them are busy, and returns it once
+ * the result is received. The pool grows up to the number of concurrent queries, so the callers never wait for the
+ * round trip of others.
+ *
+ * The asynchronous queries are queued and performed by a background thread. When the queue is full the query is
+ * performed by the caller, so no query is lost.
+ */
+class WDBPool final : public IWDBHandler
+{
+public:
+    using ConnectionFactory = std::function<std::shared_ptr<IWDBHandler>()>;
+
+private:
+    class Lease;
+
+    ConnectionFactory m_factory;                              ///< Opens the connections
+    mutable std::mutex m_idleMutex;                           ///< Protects the idle connections
+    mutable std::vector<std::shared_ptr<IWDBHandler>> m_idle; ///< Idle connections
+
+    std::mutex m_asyncMutex;              ///< Protects the asynchronous queries
+    std::condition_variable m_asyncCv;    ///< Wakes up the background thread
+    std::deque<std::string> m_asyncQueue; ///< Queries waiting to be performed
+    bool m_stop;                          ///< Request the background thread to stop
+    std::thread m_asyncThread;            ///< Performs the asynchronous queries
+
+    /**
+     * @brief Take an idle connection, or open a new one.
+     *
+     * @return std::shared_ptr<IWDBHandler> Connection only used by the caller until it is released.
+     */
+    std::shared_ptr<IWDBHandler> acquire() const;
+
+    /**
+     * @brief Return a connection to the pool.
+     *
+     * @param connection Connection to return.
+     */
+    void release(std::shared_ptr<IWDBHandler> connection) const;
+
+    /**
+     * @brief Perform the queued queries until the pool is destroyed.
+     */
+    void asyncLoop();
+
+public:
+    /**
+     * @brief Construct a new pool.
+     *
+     * @param factory Opens a new connection.
+     * @throw std::invalid_argument if the factory is empty.
+     */
+    explicit WDBPool(ConnectionFactory factory);
+
+    /**
+     * @brief Perform the pending asynchronous queries and close the connections.
+     */
+    ~WDBPool();
+
+    WDBPool(const WDBPool&) = delete;
+    WDBPool& operator=(const WDBPool&) = delete;
+
+    /**
+     * @copydoc IWDBHandler::connect
+     */
+    void connect() override;
+
+    /**
+     * @copydoc IWDBHandler::query
+     */
+    std::string query(const std::string& query) override;
+
+    /**
+     * @copydoc IWDBHandler::tryQuery
+     */
+    std::string tryQuery(const std::string& query, uint attempts) noexcept override;
+
+    /**
+     * @copydoc IWDBHandler::parseResult
+     */
+    std::tuple<QueryResultCodes, std::optional<std::string>>
+    parseResult(const std::string& result) const noexcept override;
+
+    /**
+     * @copydoc IWDBHandler::queryAndParseResult
+     */
+    std::tuple<QueryResultCodes, std::optional<std::string>> queryAndParseResult(const std::string& query) override;
+
+    /**
+     * @copydoc IWDBHandler::tryQueryAndParseResult
+     */
+    std::tuple<QueryResultCodes, std::optional<std::string>>
+    tryQueryAndParseResult(const std::string& query, const unsigned int attempts) noexcept override;
+
+    /**
+     * @copydoc IWDBHandler::tryQueryAsync
+     *
+     * The query is performed by the background thread, or by the caller if the queue is full.
+     */
+    void tryQueryAsync(const std::string& query) noexcept override;
+
+    /**
+     * @copydoc IWDBHandler::getQueryMaxSize
+     */
+    size_t getQueryMaxSize() const noexcept override;
+};
+
+} // namespace wazuhdb
+
+#endif // _WDB_WDB_POOL_HPP
@@ -0,0 +1,28 @@
+#ifndef _WDB_IAGENT_CACHE_HPP
+#define _WDB_IAGENT_CACHE_HPP
+
+#include <memory>
+#include <string_view>
+
+#include <base/json.hpp>
+
+namespace wazuhdb
+{
+
+class IAgentCache
+{
+public:
+    virtual ~IAgentCache() = default;
+
+    /**
+     * @brief Get the metadata of an agent, without querying wazuh-db.
+     *
+     * @param agentId Id of the agent, as in agent.id ("001") or as stored by wazuh-db ("1").
+     * @return std::shared_ptr<const json::Json> Row of the agent in the global database, null if it is not known.
+     */
+    virtual std::shared_ptr<const json::Json> get(std::string_view agentId) const = 0;
+};
+
+} // namespace wazuhdb
+
+#endif // _WDB_IAGENT_CACHE_HPP
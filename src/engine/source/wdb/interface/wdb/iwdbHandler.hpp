@@ -141,6 +141,16 @@ public:
         return tryQueryAndParseResult(query, DEFAULT_TRY_ATTEMPTS);
     }
 
+    /**
+     * @brief Perform a query without waiting for its result.
+     *
+     * The query is performed as in \ref tryQuery, the implementations may perform it in background. The default
+     * implementation performs it before returning.
+     *
+     * @param query Query to perform
+     */
+    virtual void tryQueryAsync(const std::string& query) noexcept { tryQuery(query); }
+
     virtual size_t getQueryMaxSize() const noexcept = 0;
 };
 } // namespace wazuhdb
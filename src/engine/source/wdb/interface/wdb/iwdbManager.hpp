@@ -13,7 +13,19 @@ class IWDBManager
 public:
     virtual ~IWDBManager() = default;
 
+    /**
+     * @brief Create a handler with its own connection to wazuh-db.
+     *
+     * @return std::shared_ptr<IWDBHandler> Handler, not thread-safe.
+     */
     virtual std::shared_ptr<IWDBHandler> connection() = 0;
+
+    /**
+     * @brief Get the handler shared by all the callers, each concurrent query takes a connection from a pool.
+     *
+     * @return std::shared_ptr<IWDBHandler> Thread-safe handler.
+     */
+    virtual std::shared_ptr<IWDBHandler> pooledConnection() = 0;
 };
 
 } // namespace wazuhdb
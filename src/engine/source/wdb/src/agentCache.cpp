@@ -0,0 +1,208 @@
+#include "agentCache.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <base/logging.hpp>
+
+namespace wazuhdb
+{
+
+namespace
+{
+constexpr auto QUERY_AGENTS {"global get-all-agents last_id {}"}; ///< Page of the agent ids after last_id
+constexpr auto QUERY_AGENT {"global get-agent-info {}"};          ///< Row of an agent
+
+/**
+ * @brief Parse the payload of a query that lists agents.
+ *
+ * @param query Query performed, for the errors.
+ * @param payload Payload of the result.
+ * @return std::vector<json::Json> Agents of the list.
+ * @throw std::runtime_error if the payload is not a list.
+ */
+std::vector<json::Json> parseAgents(const std::string& query, const std::optional<std::string>& payload)
+{
+    if (!payload.has_value() || payload.value().empty())
+    {
+        return {};
+    }
+
+    auto agents = json::Json(payload.value().c_str()).getArray();
+    if (!agents.has_value())
+    {
+        throw std::runtime_error(fmt::format("The result of the query '{}' is not a list of agents", query));
+    }
+    return std::move(agents.value());
+}
+} // namespace
+
+AgentCache::AgentCache(std::shared_ptr<IWDBManager> wdbManager)
+    : m_wdbManager(std::move(wdbManager))
+    , m_agents()
+{
+    if (!m_wdbManager)
+    {
+        throw std::runtime_error("The agent cache requires a wazuh-db manager");
+    }
+}
+
+std::optional<int64_t> AgentCache::parseId(std::string_view agentId) noexcept
+{
+    if (agentId.empty())
+    {
+        return std::nullopt;
+    }
+
+    int64_t id {};
+    const auto* end = agentId.data() + agentId.size();
+    auto [ptr, ec] = std::from_chars(agentId.data(), end, id);
+    if (ec != std::errc {} || ptr != end || id < 0)
+    {
+        return std::nullopt;
+    }
+    return id;
+}
+
+std::optional<json::Json> AgentCache::queryAgent(IWDBHandler& wdb, int64_t id)
+{
+    const auto query = fmt::format(QUERY_AGENT, id);
+    auto [code, payload] = wdb.tryQueryAndParseResult(query);
+    if (QueryResultCodes::OK != code)
+    {
+        throw std::runtime_error(fmt::format("Query '{}' failed with result code '{}'", query, qrcToStr(code)));
+    }
+
+    auto rows = parseAgents(query, payload);
+    if (rows.empty())
+    {
+        return std::nullopt;
+    }
+    return std::move(rows.front());
+}
+
+std::size_t AgentCache::load()
+{
+    auto wdb = m_wdbManager->pooledConnection();
+    Agents agents;
+
+    // The ids come in pages, the last id of each one is where the next starts
+    int64_t lastId {-1};
+    auto code = QueryResultCodes::DUE;
+    while (QueryResultCodes::DUE == code)
+    {
+        const auto query = fmt::format(QUERY_AGENTS, lastId);
+        auto [result, payload] = wdb->tryQueryAndParseResult(query);
+        code = result;
+        if (QueryResultCodes::OK != code && QueryResultCodes::DUE != code)
+        {
+            throw std::runtime_error(fmt::format("Query '{}' failed with result code '{}'", query, qrcToStr(code)));
+        }
+
+        const auto pageStart = lastId;
+        for (const auto& entry : parseAgents(query, payload))
+        {
+            const auto id = entry.getIntAsInt64("/id");
+            if (!id.has_value())
+            {
+                throw std::runtime_error(fmt::format("The result of the query '{}' has an agent without id", query));
+            }
+            lastId = std::max(lastId, id.value());
+
+            if (auto row = queryAgent(*wdb, id.value()); row.has_value())
+            {
+                agents.insert_or_assign(id.value(), std::make_shared<const json::Json>(std::move(row.value())));
+            }
+        }
+
+        if (QueryResultCodes::DUE == code && lastId == pageStart)
+        {
+            throw std::runtime_error(fmt::format("Query '{}' is pending but returned no agents", query));
+        }
+    }
+
+    const auto loaded = agents.size();
+    {
+        std::unique_lock lock {m_mutex};
+        m_agents.swap(agents);
+    }
+    LOG_DEBUG("Agent cache loaded with {} agents.", loaded);
+
+    return loaded;
+}
+
+base::OptError AgentCache::apply(std::string_view notification)
+{
+    std::string action;
+    std::optional<int64_t> id;
+    try
+    {
+        const json::Json event {std::string(notification).c_str()};
+        action = event.getString("/action").value_or("");
+        id = parseId(event.getString("/agent_info/agent_id").value_or(""));
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Invalid agent change notification: {}", e.what())};
+    }
+
+    if (action.empty() || !id.has_value())
+    {
+        return base::Error {"Invalid agent change notification: expected an action and an agent id"};
+    }
+
+    if (AGENT_EVENT_DELETE == action)
+    {
+        std::unique_lock lock {m_mutex};
+        m_agents.erase(id.value());
+        return base::noError();
+    }
+
+    std::optional<json::Json> row;
+    try
+    {
+        row = queryAgent(*m_wdbManager->pooledConnection(), id.value());
+    }
+    catch (const std::exception& e)
+    {
+        return base::Error {fmt::format("Agent {} could not be updated: {}", id.value(), e.what())};
+    }
+
+    std::unique_lock lock {m_mutex};
+    if (row.has_value())
+    {
+        m_agents.insert_or_assign(id.value(), std::make_shared<const json::Json>(std::move(row.value())));
+    }
+    else
+    {
+        m_agents.erase(id.value());
+    }
+    return base::noError();
+}
+
+std::shared_ptr<const json::Json> AgentCache::get(std::string_view agentId) const
+{
+    const auto id = parseId(agentId);
+    if (!id.has_value())
+    {
+        return nullptr;
+    }
+
+    std::shared_lock lock {m_mutex};
+    auto it = m_agents.find(id.value());
+    return it == m_agents.end() ? nullptr : it->second;
+}
+
+std::size_t AgentCache::size() const
+{
+    std::shared_lock lock {m_mutex};
+    return m_agents.size();
+}
+
+} // namespace wazuhdb
@@ -0,0 +1,210 @@
+#include "wdbPool.hpp"
+
+#include <stdexcept>
+
+#include <base/logging.hpp>
+
+namespace wazuhdb
+{
+
+/**
+ * @brief Connection taken from the pool, returned when the lease is destroyed.
+ */
+class WDBPool::Lease
+{
+private:
+    const WDBPool& m_pool;
+    std::shared_ptr<IWDBHandler> m_connection;
+
+public:
+    explicit Lease(const WDBPool& pool)
+        : m_pool(pool)
+        , m_connection(pool.acquire())
+    {
+    }
+
+    ~Lease() { m_pool.release(std::move(m_connection)); }
+
+    Lease(const Lease&) = delete;
+    Lease& operator=(const Lease&) = delete;
+
+    IWDBHandler* operator->() const { return m_connection.get(); }
+};
+
+WDBPool::WDBPool(ConnectionFactory factory)
+    : m_factory(std::move(factory))
+    , m_idle()
+    , m_asyncQueue()
+    , m_stop(false)
+{
+    if (!m_factory)
+    {
+        throw std::invalid_argument("Engine WDB: The connection factory cannot be empty");
+    }
+
+    m_asyncThread = std::thread(&WDBPool::asyncLoop, this);
+}
+
+WDBPool::~WDBPool()
+{
+    {
+        std::lock_guard lock {m_asyncMutex};
+        m_stop = true;
+    }
+    m_asyncCv.notify_one();
+    m_asyncThread.join();
+}
+
+std::shared_ptr<IWDBHandler> WDBPool::acquire() const
+{
+    {
+        std::lock_guard lock {m_idleMutex};
+        if (!m_idle.empty())
+        {
+            auto connection = std::move(m_idle.back());
+            m_idle.pop_back();
+            return connection;
+        }
+    }
+
+    // All the connections are busy, the new one joins the pool when released
+    auto connection = m_factory();
+    if (!connection)
+    {
+        throw std::runtime_error("Engine WDB: Cannot create a new connection");
+    }
+    return connection;
+}
+
+void WDBPool::release(std::shared_ptr<IWDBHandler> connection) const
+{
+    std::lock_guard lock {m_idleMutex};
+    m_idle.push_back(std::move(connection));
+}
+
+void WDBPool::connect()
+{
+    Lease connection {*this};
+    connection->connect();
+}
+
+std::string WDBPool::query(const std::string& query)
+{
+    Lease connection {*this};
+    return connection->query(query);
+}
+
+std::string WDBPool::tryQuery(const std::string& query, uint attempts) noexcept
+{
+    try
+    {
+        Lease connection {*this};
+        return connection->tryQuery(query, attempts);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Engine WDB: WDBPool::tryQuery() method failed: {}.", e.what());
+        return {};
+    }
+}
+
+std::tuple<QueryResultCodes, std::optional<std::string>>
+WDBPool::parseResult(const std::string& result) const noexcept
+{
+    try
+    {
+        Lease connection {*this};
+        return connection->parseResult(result);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Engine WDB: WDBPool::parseResult() method failed: {}.", e.what());
+        return std::make_tuple(QueryResultCodes::UNKNOWN, std::nullopt);
+    }
+}
+
+std::tuple<QueryResultCodes, std::optional<std::string>> WDBPool::queryAndParseResult(const std::string& query)
+{
+    Lease connection {*this};
+    return connection->queryAndParseResult(query);
+}
+
+std::tuple<QueryResultCodes, std::optional<std::string>>
+WDBPool::tryQueryAndParseResult(const std::string& query, const unsigned int attempts) noexcept
+{
+    try
+    {
+        Lease connection {*this};
+        return connection->tryQueryAndParseResult(query, attempts);
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Engine WDB: WDBPool::tryQueryAndParseResult() method failed: {}.", e.what());
+        return std::make_tuple(QueryResultCodes::UNKNOWN, std::nullopt);
+    }
+}
+
+void WDBPool::tryQueryAsync(const std::string& query) noexcept
+{
+    try
+    {
+        {
+            std::lock_guard lock {m_asyncMutex};
+            if (m_asyncQueue.size() < WDB_ASYNC_QUEUE_SIZE)
+            {
+                m_asyncQueue.push_back(query);
+                m_asyncCv.notify_one();
+                return;
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Engine WDB: Cannot queue the query: {}.", e.what());
+    }
+
+    // The queue is full, the caller waits instead of losing the query
+    tryQuery(query, DEFAULT_TRY_ATTEMPTS);
+}
+
+size_t WDBPool::getQueryMaxSize() const noexcept
+{
+    try
+    {
+        Lease connection {*this};
+        return connection->getQueryMaxSize();
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARNING("Engine WDB: WDBPool::getQueryMaxSize() method failed: {}.", e.what());
+        return 0;
+    }
+}
+
+void WDBPool::asyncLoop()
+{
+    std::unique_lock lock {m_asyncMutex};
+    while (true)
+    {
+        m_asyncCv.wait(lock, [this]() { return m_stop || !m_asyncQueue.empty(); });
+
+        // The pending queries are performed before stopping
+        if (m_asyncQueue.empty())
+        {
+            break;
+        }
+
+        auto query = std::move(m_asyncQueue.front());
+        m_asyncQueue.pop_front();
+
+        lock.unlock();
+        const auto [code, payload] = tryQueryAndParseResult(query, DEFAULT_TRY_ATTEMPTS);
+        if (QueryResultCodes::OK != code)
+        {
+            LOG_DEBUG("Engine WDB: Asynchronous query failed, result code is '{}'.", qrcToStr(code));
+        }
+        lock.lock();
+    }
+}
+
+} // namespace wazuhdb
@@ -0,0 +1,19 @@
+#ifndef _WDB_MOCK_AGENT_CACHE_HPP
+#define _WDB_MOCK_AGENT_CACHE_HPP
+
+#include <gmock/gmock.h>
+
+#include <wdb/iagentCache.hpp>
+
+namespace wazuhdb::mocks
+{
+
+class MockAgentCache : public wazuhdb::IAgentCache
+{
+public:
+    MOCK_METHOD(std::shared_ptr<const json::Json>, get, (std::string_view agentId), (const, override));
+};
+
+} // namespace wazuhdb::mocks
+
+#endif // _WDB_MOCK_AGENT_CACHE_HPP
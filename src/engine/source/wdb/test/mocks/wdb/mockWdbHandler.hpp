@@ -53,6 +53,7 @@ public:
                 tryQueryAndParseResult,
                 (const std::string& query, uint32_t attempts),
                 (noexcept, override));
+    MOCK_METHOD(void, tryQueryAsync, (const std::string& query), (noexcept, override));
     MOCK_METHOD(size_t, getQueryMaxSize, (), (const, noexcept, override));
 };
 } // namespace wazuhdb::mocks
@@ -9,6 +9,7 @@ class MockWdbManager : public wazuhdb::IWDBManager
 {
 public:
     MOCK_METHOD(std::shared_ptr<wazuhdb::IWDBHandler>, connection, (), (override));
+    MOCK_METHOD(std::shared_ptr<wazuhdb::IWDBHandler>, pooledConnection, (), (override));
 };
 
 #endif // _WDB_MOCK_WDB_MANAGER_HPP
@@ -0,0 +1,165 @@
+#include <wdb/agentCache.hpp>
+
+#include <gtest/gtest.h>
+
+#include <base/logging.hpp>
+#include <wdb/mockWdbHandler.hpp>
+#include <wdb/mockWdbManager.hpp>
+
+using namespace wazuhdb;
+using namespace wazuhdb::mocks;
+
+namespace
+{
+const std::string AGENT_1 {R"({"id":1,"name":"agent-1","ip":"10.0.0.1","os_name":"Ubuntu","group":"default"})"};
+const std::string AGENT_2 {R"({"id":2,"name":"agent-2","ip":"10.0.0.2","os_name":"Windows","group":"windows"})"};
+const std::string AGENT_2_UPGRADED {
+    R"({"id":2,"name":"agent-2","ip":"10.0.0.2","os_name":"Windows","group":"windows","version":"4.8.0"})"};
+} // namespace
+
+class AgentCacheTest : public ::testing::Test
+{
+protected:
+    std::shared_ptr<MockWdbManager> wdbManager;
+    std::shared_ptr<MockWdbHandler> wdbHandler;
+
+    void SetUp() override
+    {
+        logging::testInit();
+        wdbManager = std::make_shared<MockWdbManager>();
+        wdbHandler = std::make_shared<MockWdbHandler>();
+        ON_CALL(*wdbManager, pooledConnection()).WillByDefault(testing::Return(wdbHandler));
+        EXPECT_CALL(*wdbManager, pooledConnection()).Times(testing::AnyNumber());
+    }
+
+    void expectQuery(const std::string& query, const QueryRes& result)
+    {
+        EXPECT_CALL(*wdbHandler, tryQueryAndParseResult(query, DEFAULT_TRY_ATTEMPTS)).WillOnce(testing::Return(result));
+    }
+
+    void loadAgents()
+    {
+        expectQuery("global get-all-agents last_id -1", dueQueryRes(R"([{"id":1}])"));
+        expectQuery("global get-agent-info 1", okQueryRes("[" + AGENT_1 + "]"));
+        expectQuery("global get-all-agents last_id 1", okQueryRes(R"([{"id":2}])"));
+        expectQuery("global get-agent-info 2", okQueryRes("[" + AGENT_2 + "]"));
+    }
+};
+
+TEST_F(AgentCacheTest, Init)
+{
+    ASSERT_THROW(AgentCache(nullptr), std::runtime_error);
+    AgentCache cache {wdbManager};
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.get("001"), nullptr);
+}
+
+TEST_F(AgentCacheTest, ParseId)
+{
+    ASSERT_EQ(AgentCache::parseId("000"), 0);
+    ASSERT_EQ(AgentCache::parseId("001"), 1);
+    ASSERT_EQ(AgentCache::parseId("1234"), 1234);
+    ASSERT_FALSE(AgentCache::parseId(""));
+    ASSERT_FALSE(AgentCache::parseId("-1"));
+    ASSERT_FALSE(AgentCache::parseId("+1"));
+    ASSERT_FALSE(AgentCache::parseId("1a"));
+    ASSERT_FALSE(AgentCache::parseId("agent"));
+    ASSERT_FALSE(AgentCache::parseId("99999999999999999999"));
+}
+
+TEST_F(AgentCacheTest, LoadPages)
+{
+    AgentCache cache {wdbManager};
+    loadAgents();
+    ASSERT_EQ(cache.load(), 2);
+    ASSERT_EQ(cache.size(), 2);
+
+    // Looked up with or without the leading zeros of agent.id
+    auto agent = cache.get("001");
+    ASSERT_NE(agent, nullptr);
+    ASSERT_EQ(*agent, json::Json {AGENT_1.c_str()});
+    ASSERT_EQ(cache.get("1"), agent);
+    ASSERT_EQ(cache.get("002")->getString("/os_name"), "Windows");
+    ASSERT_EQ(cache.get("003"), nullptr);
+    ASSERT_EQ(cache.get("agent"), nullptr);
+}
+
+TEST_F(AgentCacheTest, LoadFailureKeepsTheAgents)
+{
+    AgentCache cache {wdbManager};
+    loadAgents();
+    cache.load();
+
+    expectQuery("global get-all-agents last_id -1", dueQueryRes(R"([{"id":1}])"));
+    expectQuery("global get-agent-info 1", okQueryRes("[" + AGENT_1 + "]"));
+    expectQuery("global get-all-agents last_id 1", errorQueryRes("DB error"));
+    ASSERT_THROW(cache.load(), std::runtime_error);
+    ASSERT_EQ(cache.size(), 2);
+
+    expectQuery("global get-all-agents last_id -1", okQueryRes("not json"));
+    ASSERT_THROW(cache.load(), std::runtime_error);
+    expectQuery("global get-all-agents last_id -1", okQueryRes(R"({"id":1})"));
+    ASSERT_THROW(cache.load(), std::runtime_error);
+    expectQuery("global get-all-agents last_id -1", okQueryRes(R"([{"name":"agent-1"}])"));
+    ASSERT_THROW(cache.load(), std::runtime_error);
+    expectQuery("global get-all-agents last_id -1", dueQueryRes("[]"));
+    ASSERT_THROW(cache.load(), std::runtime_error);
+    ASSERT_EQ(cache.size(), 2);
+}
+
+TEST_F(AgentCacheTest, LoadEmpty)
+{
+    AgentCache cache {wdbManager};
+    expectQuery("global get-all-agents last_id -1", okQueryRes());
+    ASSERT_EQ(cache.load(), 0);
+
+    // An agent removed between the pages is skipped
+    expectQuery("global get-all-agents last_id -1", okQueryRes(R"([{"id":1}])"));
+    expectQuery("global get-agent-info 1", okQueryRes("[]"));
+    ASSERT_EQ(cache.load(), 0);
+}
+
+TEST_F(AgentCacheTest, ApplyChanges)
+{
+    AgentCache cache {wdbManager};
+    loadAgents();
+    cache.load();
+    auto previous = cache.get("002");
+
+    // The row is queried again, the previous one is still valid for whoever holds it
+    expectQuery("global get-agent-info 2", okQueryRes("[" + AGENT_2_UPGRADED + "]"));
+    ASSERT_FALSE(cache.apply(R"({"action":"upgradeAgentDB","agent_info":{"agent_id":"002","agent_version":"4.8.0"}})"));
+    ASSERT_EQ(cache.get("002")->getString("/version"), "4.8.0");
+    ASSERT_EQ(previous->getString("/group"), "windows");
+
+    // New agents are added
+    expectQuery("global get-agent-info 3", okQueryRes(R"([{"id":3,"name":"agent-3"}])"));
+    ASSERT_FALSE(cache.apply(R"({"action":"upgradeAgentDB","agent_info":{"agent_id":"003"}})"));
+    ASSERT_EQ(cache.size(), 3);
+
+    // Removed agents are dropped, with or without the query
+    ASSERT_FALSE(cache.apply(R"({"action":"deleteAgent","agent_info":{"agent_id":"001"}})"));
+    ASSERT_EQ(cache.get("001"), nullptr);
+    expectQuery("global get-agent-info 3", okQueryRes("[]"));
+    ASSERT_FALSE(cache.apply(R"({"action":"upgradeAgentDB","agent_info":{"agent_id":"003"}})"));
+    ASSERT_EQ(cache.get("003"), nullptr);
+    ASSERT_EQ(cache.size(), 1);
+}
+
+TEST_F(AgentCacheTest, ApplyInvalid)
+{
+    AgentCache cache {wdbManager};
+    loadAgents();
+    cache.load();
+
+    ASSERT_TRUE(cache.apply("not json"));
+    ASSERT_TRUE(cache.apply(R"({"agent_info":{"agent_id":"001"}})"));
+    ASSERT_TRUE(cache.apply(R"({"action":"deleteAgent"})"));
+    ASSERT_TRUE(cache.apply(R"({"action":"deleteAgent","agent_info":{"agent_id":"manager"}})"));
+
+    // The agent is kept if it cannot be queried
+    expectQuery("global get-agent-info 1", errorQueryRes());
+    ASSERT_TRUE(cache.apply(R"({"action":"upgradeAgentDB","agent_info":{"agent_id":"001"}})"));
+    ASSERT_NE(cache.get("001"), nullptr);
+    ASSERT_EQ(cache.size(), 2);
+}
@@ -1,5 +1,6 @@
 #include <wdb/wdbManager.hpp>
 
+#include <future>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -7,6 +8,7 @@
 #include <base/logging.hpp>
 #include <sockiface/mockSockFactory.hpp>
 #include <sockiface/mockSockHandler.hpp>
+#include <wdb/mockWdbHandler.hpp>
 
 using namespace wazuhdb;
 using namespace sockiface::mocks;
@@ -321,3 +323,103 @@ TEST_F(wdb_tryQueryAndParseResult, SendQueryIrrecoverable)
     ASSERT_EQ(std::get<0>(retval), QueryResultCodes::UNKNOWN);
     ASSERT_FALSE(std::get<1>(retval));
 }
+
+class wdb_pool : public ::testing::Test
+{
+protected:
+    void SetUp() override { logging::testInit(); }
+
+    void TearDown() override {}
+};
+
+TEST_F(wdb_pool, EmptyFactory)
+{
+    ASSERT_THROW(WDBPool(nullptr), std::invalid_argument);
+}
+
+TEST_F(wdb_pool, ReuseIdleConnection)
+{
+    auto handler = std::make_shared<wazuhdb::mocks::MockWdbHandler>();
+    std::size_t created {0};
+    WDBPool pool(
+        [&]() -> std::shared_ptr<IWDBHandler>
+        {
+            ++created;
+            return handler;
+        });
+
+    EXPECT_CALL(*handler, tryQuery(TEST_MESSAGE, 1)).Times(2).WillRepeatedly(testing::Return(TEST_RESPONSE));
+    ASSERT_EQ(pool.tryQuery(TEST_MESSAGE, 1), TEST_RESPONSE);
+    ASSERT_EQ(pool.tryQuery(TEST_MESSAGE, 1), TEST_RESPONSE);
+    ASSERT_EQ(created, 1);
+}
+
+TEST_F(wdb_pool, OpenConnectionWhenBusy)
+{
+    auto first = std::make_shared<wazuhdb::mocks::MockWdbHandler>();
+    auto second = std::make_shared<wazuhdb::mocks::MockWdbHandler>();
+    std::vector<std::shared_ptr<IWDBHandler>> handlers {second, first};
+    WDBPool pool(
+        [&]() -> std::shared_ptr<IWDBHandler>
+        {
+            auto handler = handlers.back();
+            handlers.pop_back();
+            return handler;
+        });
+
+    // A query while the first connection is busy opens the second one
+    EXPECT_CALL(*first, tryQuery(TEST_MESSAGE, 1))
+        .WillOnce(testing::Invoke([&](const std::string& query, uint attempts) { return pool.tryQuery(query, 2); }));
+    EXPECT_CALL(*second, tryQuery(TEST_MESSAGE, 2)).WillOnce(testing::Return(TEST_RESPONSE));
+
+    ASSERT_EQ(pool.tryQuery(TEST_MESSAGE, 1), TEST_RESPONSE);
+    ASSERT_TRUE(handlers.empty());
+}
+
+TEST_F(wdb_pool, FactoryError)
+{
+    WDBPool pool([]() -> std::shared_ptr<IWDBHandler> { throw std::runtime_error("Cannot connect"); });
+
+    ASSERT_THROW(pool.query(TEST_MESSAGE), std::runtime_error);
+    ASSERT_EQ(pool.tryQuery(TEST_MESSAGE, 1), "");
+}
+
+TEST_F(wdb_pool, AsyncQuery)
+{
+    auto handler = std::make_shared<wazuhdb::mocks::MockWdbHandler>();
+    WDBPool pool([&]() -> std::shared_ptr<IWDBHandler> { return handler; });
+
+    std::promise<void> performed;
+    EXPECT_CALL(*handler, tryQueryAndParseResult(TEST_MESSAGE, DEFAULT_TRY_ATTEMPTS))
+        .WillOnce(testing::Invoke(
+            [&](const std::string&, uint)
+            {
+                performed.set_value();
+                return wazuhdb::mocks::okQueryRes();
+            }));
+
+    pool.tryQueryAsync(TEST_MESSAGE);
+    ASSERT_EQ(performed.get_future().wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
+
+TEST_F(wdb_pool, AsyncQueryPerformedOnDestroy)
+{
+    auto handler = std::make_shared<wazuhdb::mocks::MockWdbHandler>();
+    EXPECT_CALL(*handler, tryQueryAndParseResult(TEST_MESSAGE, DEFAULT_TRY_ATTEMPTS))
+        .WillOnce(testing::Return(wazuhdb::mocks::okQueryRes()));
+
+    {
+        WDBPool pool([&]() -> std::shared_ptr<IWDBHandler> { return handler; });
+        pool.tryQueryAsync(TEST_MESSAGE);
+    }
+}
+
+TEST_F(wdb_pool, ManagerSharesPool)
+{
+    auto sockFactoryPtr = std::make_shared<MockSockFactory>();
+    WDBManager wdbManager(TEST_DUMMY_PATH, sockFactoryPtr);
+
+    auto pool = wdbManager.pooledConnection();
+    ASSERT_NE(pool, nullptr);
+    ASSERT_EQ(pool, wdbManager.pooledConnection());
+}
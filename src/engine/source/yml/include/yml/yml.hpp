@@ -21,20 +21,30 @@ public:
     /**
      * @brief Load a YAML file and return a RapidJSON document.
      *
+     * The document is built in a single pass from the parser events, without a YAML node tree.
+     *
      * @param filepath Filepath of the YAML file.
+     * @param allowDuplicates Keep the duplicated keys of a map, otherwise the load fails on the first one.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML file.
+     * @throw YAML::Exception if the file cannot be read or parsed.
+     * @throw std::runtime_error if a map has a duplicated key and they are not allowed, or a non-scalar key.
      */
-    static rapidjson::Document loadYMLfromFile(const std::string& filepath);
+    static rapidjson::Document loadYMLfromFile(const std::string& filepath, bool allowDuplicates = true);
 
     /**
      * @brief Load a YAML string and return a RapidJSON document.
      *
+     * The document is built in a single pass from the parser events, without a YAML node tree.
+     *
      * @param yamlStr YAML string.
+     * @param allowDuplicates Keep the duplicated keys of a map, otherwise the load fails on the first one.
      *
      * @return rapidjson::Document RapidJSON document loaded from the YAML string.
+     * @throw YAML::Exception if the string cannot be parsed.
+     * @throw std::runtime_error if a map has a duplicated key and they are not allowed, or a non-scalar key.
      */
-    static rapidjson::Document loadYMLfromString(const std::string& yamlStr);
+    static rapidjson::Document loadYMLfromString(const std::string& yamlStr, bool allowDuplicates = true);
 
     /**
      * @brief Convert a YAML node to a RapidJSON value.
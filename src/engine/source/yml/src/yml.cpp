@@ -1,23 +1,241 @@
 #include <yml/yml.hpp>
 
+#include <fstream>
 #include <iostream>
+#include <optional>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
+#include <fmt/format.h>
+
 namespace yml
 {
+namespace
+{
+
+/**
+ * @brief Builds a RapidJSON value from the events of the YAML parser, without the YAML node tree.
+ *
+ * The values are converted as Converter::yamlToJson does with the tree that the same events would build. Only the
+ * first document of the stream is handled.
+ */
+class JsonBuilder final : public YAML::EventHandler
+{
+public:
+    JsonBuilder(rapidjson::Document::AllocatorType& allocator, bool allowDuplicates)
+        : m_allocator(allocator)
+        , m_allowDuplicates(allowDuplicates)
+    {
+    }
+
+    rapidjson::Value& root() { return m_root; }
+
+    void OnDocumentStart(const YAML::Mark& /*mark*/) override {}
+    void OnDocumentEnd() override {}
+
+    void OnNull(const YAML::Mark& /*mark*/, YAML::anchor_t anchor) override
+    {
+        rapidjson::Value value;
+        if (isKey())
+        {
+            anchorValue(anchor, value, "null");
+            addKey("null");
+            return;
+        }
+
+        add(std::move(value), anchor, "null");
+    }
+
+    void OnAlias(const YAML::Mark& mark, YAML::anchor_t anchor) override
+    {
+        if (anchor >= m_anchors.size())
+        {
+            throw std::runtime_error(fmt::format("Unknown alias at line {}", mark.line + 1));
+        }
+
+        const auto& anchored = m_anchors[anchor];
+        if (isKey())
+        {
+            if (!anchored.scalar)
+            {
+                throw std::runtime_error(fmt::format("Map key at line {} is not a scalar", mark.line + 1));
+            }
+            addKey(*anchored.scalar);
+            return;
+        }
+
+        add(rapidjson::Value(anchored.value, m_allocator), YAML::NullAnchor);
+    }
+
+    void OnScalar(const YAML::Mark& /*mark*/,
+                  const std::string& tag,
+                  YAML::anchor_t anchor,
+                  const std::string& value) override
+    {
+        const auto key = isKey();
+        if (!key || anchor != YAML::NullAnchor)
+        {
+            m_scalar = value;
+            m_scalar.SetTag(tag);
+            auto parsed = Converter::parseScalar(m_scalar, m_allocator);
+            if (key)
+            {
+                anchorValue(anchor, parsed, value);
+            }
+            else
+            {
+                add(std::move(parsed), anchor, value);
+            }
+        }
+
+        if (key)
+        {
+            addKey(value);
+        }
+    }
+
+    void OnSequenceStart(const YAML::Mark& mark,
+                         const std::string& /*tag*/,
+                         YAML::anchor_t anchor,
+                         YAML::EmitterStyle::value /*style*/) override
+    {
+        start(rapidjson::kArrayType, anchor, mark);
+    }
+
+    void OnSequenceEnd() override { end(); }
+
+    void OnMapStart(const YAML::Mark& mark,
+                    const std::string& /*tag*/,
+                    YAML::anchor_t anchor,
+                    YAML::EmitterStyle::value /*style*/) override
+    {
+        start(rapidjson::kObjectType, anchor, mark);
+    }
+
+    void OnMapEnd() override { end(); }
+
+private:
+    /**
+     * @brief Sequence or map being built.
+     */
+    struct Frame
+    {
+        rapidjson::Value value;               ///< Array or object
+        YAML::anchor_t anchor;                ///< Anchor of the node
+        std::optional<rapidjson::Value> key;  ///< Key waiting for its value, maps only
+        std::unordered_set<std::string> keys; ///< Keys of the map, only when duplicates are rejected
+    };
+
+    /**
+     * @brief Value of an anchor, to be copied by its aliases.
+     */
+    struct Anchored
+    {
+        rapidjson::Value value;             ///< Converted value
+        std::optional<std::string> scalar;  ///< Text of the node when it is a scalar, used by aliases as keys
+    };
 
-rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath)
+    rapidjson::Document::AllocatorType& m_allocator;
+    bool m_allowDuplicates;
+    rapidjson::Value m_root;
+    std::vector<Frame> m_stack;
+    std::vector<Anchored> m_anchors;
+    YAML::Node m_scalar {YAML::NodeType::Scalar}; ///< Reused node for the scalar conversions
+
+    bool isKey() const { return !m_stack.empty() && m_stack.back().value.IsObject() && !m_stack.back().key; }
+
+    void anchorValue(YAML::anchor_t anchor, const rapidjson::Value& value, std::optional<std::string> scalar)
+    {
+        if (anchor == YAML::NullAnchor)
+        {
+            return;
+        }
+        if (anchor >= m_anchors.size())
+        {
+            m_anchors.resize(anchor + 1);
+        }
+        m_anchors[anchor].value.CopyFrom(value, m_allocator);
+        m_anchors[anchor].scalar = std::move(scalar);
+    }
+
+    void addKey(const std::string& key)
+    {
+        auto& frame = m_stack.back();
+        if (!m_allowDuplicates && !frame.keys.emplace(key).second)
+        {
+            throw std::runtime_error(fmt::format("Duplicated key '{}'", key));
+        }
+
+        frame.key.emplace(key.c_str(), static_cast<rapidjson::SizeType>(key.size()), m_allocator);
+    }
+
+    void add(rapidjson::Value&& value, YAML::anchor_t valueAnchor, std::optional<std::string> scalar = std::nullopt)
+    {
+        anchorValue(valueAnchor, value, std::move(scalar));
+
+        if (m_stack.empty())
+        {
+            m_root = std::move(value);
+            return;
+        }
+
+        auto& frame = m_stack.back();
+        if (frame.value.IsArray())
+        {
+            frame.value.PushBack(value, m_allocator);
+        }
+        else
+        {
+            frame.value.AddMember(*frame.key, value, m_allocator);
+            frame.key.reset();
+        }
+    }
+
+    void start(rapidjson::Type type, YAML::anchor_t anchor, const YAML::Mark& mark)
+    {
+        if (isKey())
+        {
+            throw std::runtime_error(fmt::format("Map key at line {} is not a scalar", mark.line + 1));
+        }
+
+        m_stack.push_back(Frame {rapidjson::Value(type), anchor, std::nullopt, {}});
+    }
+
+    void end()
+    {
+        auto frame = std::move(m_stack.back());
+        m_stack.pop_back();
+        add(std::move(frame.value), frame.anchor);
+    }
+};
+
+rapidjson::Document loadYML(std::istream& input, bool allowDuplicates)
 {
-    YAML::Node root = YAML::LoadFile(filepath);
     rapidjson::Document doc;
+    JsonBuilder builder(doc.GetAllocator(), allowDuplicates);
 
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
+    YAML::Parser parser(input);
+    parser.HandleNextDocument(builder);
 
+    static_cast<rapidjson::Value&>(doc) = std::move(builder.root());
     return doc;
 }
 
+} // namespace
+
+rapidjson::Document Converter::loadYMLfromFile(const std::string& filepath, bool allowDuplicates)
+{
+    std::ifstream input(filepath);
+    if (!input)
+    {
+        throw YAML::BadFile(filepath);
+    }
+
+    return loadYML(input, allowDuplicates);
+}
+
 rapidjson::Value Converter::parseScalar(const YAML::Node& node, rapidjson::Document::AllocatorType& allocator)
 {
     rapidjson::Value v;
@@ -80,15 +298,10 @@ YAML::Node Converter::parseScalar(const rapidjson::Value& node)
     return n;
 }
 
-rapidjson::Document Converter::loadYMLfromString(const std::string& yamlStr)
+rapidjson::Document Converter::loadYMLfromString(const std::string& yamlStr, bool allowDuplicates)
 {
-    YAML::Node root = YAML::Load(yamlStr);
-    rapidjson::Document doc;
-
-    rapidjson::Value val = yamlToJson(root, doc.GetAllocator());
-    doc.CopyFrom(val, doc.GetAllocator());
-
-    return doc;
+    std::istringstream input(yamlStr);
+    return loadYML(input, allowDuplicates);
 }
 
 YAML::Node Converter::jsonToYaml(const rapidjson::Value& value)
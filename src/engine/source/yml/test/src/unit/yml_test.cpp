@@ -215,3 +215,72 @@ TEST_F(YmlTest, LoadYMLfromFileTest)
     auto expected = json::Json {expectedJsonStr};
     EXPECT_TRUE(expected == result);
 }
+
+TEST_F(YmlTest, LoadYMLfromStringSameAsNodeTree)
+{
+    std::string yamlStr = R"(
+        quoted: "42"
+        int: 42
+        big: 4294967296
+        double: 3.5
+        bool: yes
+        empty:
+        tilde: ~
+        1: numeric key
+        nested:
+            - [a, 'b', 3]
+            - {k: v, n: null}
+            - - deep
+    )";
+
+    rapidjson::Document document;
+    const auto& treeValue = yml::Converter::yamlToJson(YAML::Load(yamlStr), document.GetAllocator());
+    rapidjson::Document treeDocument;
+    treeDocument.CopyFrom(treeValue, treeDocument.GetAllocator());
+    auto expected = json::Json {std::move(treeDocument)};
+
+    auto result = json::Json {yml::Converter::loadYMLfromString(yamlStr)};
+
+    EXPECT_EQ(expected, result) << expected.str() << " != " << result.str();
+    EXPECT_EQ(result.getString("/quoted").value_or(""), "42");
+    EXPECT_TRUE(result.isNull("/tilde"));
+}
+
+TEST_F(YmlTest, LoadYMLfromStringAliases)
+{
+    std::string yamlStr = R"(
+        base: &base
+            name: John
+            tags: &tags [a, b]
+        copy: *base
+        tags: *tags
+        &key age: 30
+        ageCopy: *key
+    )";
+
+    auto result = json::Json {yml::Converter::loadYMLfromString(yamlStr)};
+
+    EXPECT_EQ(result.getJson("/copy").value(), result.getJson("/base").value());
+    EXPECT_EQ(result.getJson("/tags").value(), json::Json {R"(["a","b"])"});
+    EXPECT_EQ(result.getInt("/age").value_or(0), 30);
+    EXPECT_EQ(result.getString("/ageCopy").value_or(""), "age");
+}
+
+TEST_F(YmlTest, LoadYMLfromStringDuplicatedKeys)
+{
+    std::string yamlStr = R"(
+        name: John
+        address:
+            city: New York
+            city: Boston
+    )";
+
+    EXPECT_NO_THROW(yml::Converter::loadYMLfromString(yamlStr));
+    EXPECT_THROW(yml::Converter::loadYMLfromString(yamlStr, false), std::runtime_error);
+    EXPECT_NO_THROW(yml::Converter::loadYMLfromString("a: {city: x}\nb: {city: y}\n", false));
+}
+
+TEST_F(YmlTest, LoadYMLfromStringNonScalarKey)
+{
+    EXPECT_THROW(yml::Converter::loadYMLfromString("? [a, b]\n: value\n"), std::runtime_error);
+}
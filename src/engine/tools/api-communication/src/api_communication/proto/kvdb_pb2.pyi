@@ -50,26 +50,30 @@ class dbPut_Request(_message.Message):
     def __init__(self, name: _Optional[str] = ..., entry: _Optional[_Union[Entry, _Mapping]] = ...) -> None: ...
 
 class dbSearch_Request(_message.Message):
-    __slots__ = ["name", "page", "prefix", "records"]
+    __slots__ = ["cursor", "name", "page", "prefix", "records"]
+    CURSOR_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PAGE_FIELD_NUMBER: _ClassVar[int]
     PREFIX_FIELD_NUMBER: _ClassVar[int]
     RECORDS_FIELD_NUMBER: _ClassVar[int]
+    cursor: str
     name: str
     page: int
     prefix: str
     records: int
-    def __init__(self, name: _Optional[str] = ..., prefix: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., prefix: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ..., cursor: _Optional[str] = ...) -> None: ...
 
 class dbSearch_Response(_message.Message):
-    __slots__ = ["entries", "error", "status"]
+    __slots__ = ["entries", "error", "next_cursor", "status"]
     ENTRIES_FIELD_NUMBER: _ClassVar[int]
     ERROR_FIELD_NUMBER: _ClassVar[int]
+    NEXT_CURSOR_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     entries: _containers.RepeatedCompositeFieldContainer[Entry]
     error: str
+    next_cursor: str
     status: _engine_pb2.ReturnStatus
-    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ..., next_cursor: _Optional[str] = ...) -> None: ...
 
 class managerDelete_Request(_message.Message):
     __slots__ = ["name"]
@@ -78,24 +82,28 @@ class managerDelete_Request(_message.Message):
     def __init__(self, name: _Optional[str] = ...) -> None: ...
 
 class managerDump_Request(_message.Message):
-    __slots__ = ["name", "page", "records"]
+    __slots__ = ["cursor", "name", "page", "records"]
+    CURSOR_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PAGE_FIELD_NUMBER: _ClassVar[int]
     RECORDS_FIELD_NUMBER: _ClassVar[int]
+    cursor: str
     name: str
     page: int
     records: int
-    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., page: _Optional[int] = ..., records: _Optional[int] = ..., cursor: _Optional[str] = ...) -> None: ...
 
 class managerDump_Response(_message.Message):
-    __slots__ = ["entries", "error", "status"]
+    __slots__ = ["entries", "error", "next_cursor", "status"]
     ENTRIES_FIELD_NUMBER: _ClassVar[int]
     ERROR_FIELD_NUMBER: _ClassVar[int]
+    NEXT_CURSOR_FIELD_NUMBER: _ClassVar[int]
     STATUS_FIELD_NUMBER: _ClassVar[int]
     entries: _containers.RepeatedCompositeFieldContainer[Entry]
     error: str
+    next_cursor: str
     status: _engine_pb2.ReturnStatus
-    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ...) -> None: ...
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[Entry, _Mapping]]] = ..., next_cursor: _Optional[str] = ...) -> None: ...
 
 class managerGet_Request(_message.Message):
     __slots__ = ["filter_by_name", "must_be_loaded"]
@@ -116,9 +124,13 @@ class managerGet_Response(_message.Message):
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., dbs: _Optional[_Iterable[str]] = ...) -> None: ...
 
 class managerPost_Request(_message.Message):
-    __slots__ = ["name", "path"]
+    __slots__ = ["memory_resident", "name", "path", "ttl"]
+    MEMORY_RESIDENT_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     PATH_FIELD_NUMBER: _ClassVar[int]
+    TTL_FIELD_NUMBER: _ClassVar[int]
+    memory_resident: bool
     name: str
     path: str
-    def __init__(self, name: _Optional[str] = ..., path: _Optional[str] = ...) -> None: ...
+    ttl: int
+    def __init__(self, name: _Optional[str] = ..., path: _Optional[str] = ..., memory_resident: bool = ..., ttl: _Optional[int] = ...) -> None: ...
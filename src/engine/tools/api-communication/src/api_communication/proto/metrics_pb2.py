@@ -15,7 +15,7 @@ import api_communication.proto.engine_pb2 as _engine_pb2
 from google.protobuf import struct_pb2 as google_dot_protobuf_dot_struct__pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rmetrics.proto\x12\x1c\x63om.wazuh.api.engine.metrics\x1a\x0c\x65ngine.proto\x1a\x1cgoogle/protobuf/struct.proto\"\x0e\n\x0c\x44ump_Request\"\x97\x01\n\rDump_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"c\n\x0bGet_Request\x12\x16\n\tscopeName\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x1b\n\x0einstrumentName\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x0c\n\n_scopeNameB\x11\n\x0f_instrumentName\"\x96\x01\n\x0cGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\x86\x01\n\x0e\x45nable_Request\x12\x16\n\tscopeName\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x1b\n\x0einstrumentName\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x13\n\x06status\x18\x03 \x01(\x08H\x02\x88\x01\x01\x42\x0c\n\n_scopeNameB\x11\n\x0f_instrumentNameB\t\n\x07_status\"\x85\x01\n\x0f\x45nable_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\n\n\x08_content\"\x0e\n\x0cList_Request\"\x97\x01\n\rList_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\x0e\n\x0cTest_Request\"r\n\rTest_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0f\n\x07\x63ontent\x18\x03 \x03(\tB\x08\n\x06_errorb\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\rmetrics.proto\x12\x1c\x63om.wazuh.api.engine.metrics\x1a\x0c\x65ngine.proto\x1a\x1cgoogle/protobuf/struct.proto\"\x0e\n\x0c\x44ump_Request\"\x97\x01\n\rDump_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"c\n\x0bGet_Request\x12\x16\n\tscopeName\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x1b\n\x0einstrumentName\x18\x02 \x01(\tH\x01\x88\x01\x01\x42\x0c\n\n_scopeNameB\x11\n\x0f_instrumentName\"\x96\x01\n\x0cGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\x86\x01\n\x0e\x45nable_Request\x12\x16\n\tscopeName\x18\x01 \x01(\tH\x00\x88\x01\x01\x12\x1b\n\x0einstrumentName\x18\x02 \x01(\tH\x01\x88\x01\x01\x12\x13\n\x06status\x18\x03 \x01(\x08H\x02\x88\x01\x01\x42\x0c\n\n_scopeNameB\x11\n\x0f_instrumentNameB\t\n\x07_status\"\x85\x01\n\x0f\x45nable_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x14\n\x07\x63ontent\x18\x03 \x01(\tH\x01\x88\x01\x01\x42\x08\n\x06_errorB\n\n\x08_content\"\x0e\n\x0cList_Request\"\x97\x01\n\rList_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12*\n\x05value\x18\x03 \x01(\x0b\x32\x16.google.protobuf.ValueH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_value\"\x0e\n\x0cTest_Request\"r\n\rTest_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0f\n\x07\x63ontent\x18\x03 \x03(\tB\x08\n\x06_error\"9\n\x15ProfilerStart_Request\x12\x14\n\x07seconds\x18\x01 \x01(\rH\x00\x88\x01\x01\x42\n\n\x08_seconds\"j\n\x16ProfilerStart_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x42\x08\n\x06_error\"\x16\n\x14ProfilerStop_Request\"i\n\x15ProfilerStop_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x42\x08\n\x06_error\"^\n\x0cProfileEntry\x12\r\n\x05\x61sset\x18\x01 \x01(\t\x12\r\n\x05stage\x18\x02 \x01(\t\x12\x11\n\toperation\x18\x03 \x01(\t\x12\r\n\x05\x63ount\x18\x04 \x01(\x04\x12\x0e\n\x06timeUs\x18\x05 \x01(\x04\"\x15\n\x13ProfilerGet_Request\"\xeb\x01\n\x14ProfilerGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x13\n\x06\x61\x63tive\x18\x03 \x01(\x08H\x01\x88\x01\x01\x12\x16\n\tcollapsed\x18\x04 \x01(\tH\x02\x88\x01\x01\x12;\n\x07\x65ntries\x18\x05 \x03(\x0b\x32*.com.wazuh.api.engine.metrics.ProfileEntryB\x08\n\x06_errorB\t\n\x07_activeB\x0c\n\n_collapsed\"V\n\x0f\x41ssetStatsEntry\x12\r\n\x05\x61sset\x18\x01 \x01(\t\x12\x13\n\x0b\x65valuations\x18\x02 \x01(\x04\x12\x11\n\tsuccesses\x18\x03 \x01(\x04\x12\x0c\n\x04\x63ost\x18\x04 \x01(\x04\"5\n\x15\x41ssetStatsGet_Request\x12\x12\n\x05\x61sset\x18\x01 \x01(\tH\x00\x88\x01\x01\x42\x08\n\x06_asset\"\xaa\x01\n\x16\x41ssetStatsGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12>\n\x07\x65ntries\x18\x03 \x03(\x0b\x32-.com.wazuh.api.engine.metrics.AssetStatsEntryB\x08\n\x06_error\"\x19\n\x17\x41ssetStatsReset_Request\"l\n\x18\x41ssetStatsReset_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x42\x08\n\x06_error\"c\n\x0f\x41llocationEntry\x12\x0e\n\x06policy\x18\x01 \x01(\t\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x0e\n\x06\x65vents\x18\x03 \x01(\x04\x12\x13\n\x0b\x61llocations\x18\x04 \x01(\x04\x12\r\n\x05\x62ytes\x18\x05 \x01(\x04\"\x18\n\x16\x41llocationsGet_Request\"\xab\x01\n\x17\x41llocationsGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12>\n\x07\x65ntries\x18\x03 \x03(\x0b\x32-.com.wazuh.api.engine.metrics.AllocationEntryB\x08\n\x06_error\"\x1a\n\x18\x41llocationsReset_Request\"m\n\x19\x41llocationsReset_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x42\x08\n\x06_error\"\xba\x01\n\nArenaEntry\x12\x11\n\tsubsystem\x18\x01 \x01(\t\x12\x13\n\x0b\x61llocations\x18\x02 \x01(\x04\x12\x15\n\rdeallocations\x18\x03 \x01(\x04\x12\x14\n\x0cremote_frees\x18\x04 \x01(\x04\x12\x19\n\x11large_allocations\x18\x05 \x01(\x04\x12\x14\n\x0c\x62ytes_in_use\x18\x06 \x01(\x04\x12\x16\n\x0e\x62ytes_reserved\x18\x07 \x01(\x04\x12\x0e\n\x06\x63\x61\x63hes\x18\x08 \x01(\x04\"\x13\n\x11\x41renasGet_Request\"\xb9\x01\n\x12\x41renasGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x38\n\x06\x61renas\x18\x03 \x03(\x0b\x32(.com.wazuh.api.engine.metrics.ArenaEntry\x12\x17\n\x0f\x61rena_allocator\x18\x04 \x01(\x08\x42\x08\n\x06_errorb\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'metrics_pb2', globals())
@@ -42,4 +42,44 @@ if _descriptor._USE_C_DESCRIPTORS == False:
   _TEST_REQUEST._serialized_end=972
   _TEST_RESPONSE._serialized_start=974
   _TEST_RESPONSE._serialized_end=1088
+  _PROFILERSTART_REQUEST._serialized_start=1090
+  _PROFILERSTART_REQUEST._serialized_end=1147
+  _PROFILERSTART_RESPONSE._serialized_start=1149
+  _PROFILERSTART_RESPONSE._serialized_end=1255
+  _PROFILERSTOP_REQUEST._serialized_start=1257
+  _PROFILERSTOP_REQUEST._serialized_end=1279
+  _PROFILERSTOP_RESPONSE._serialized_start=1281
+  _PROFILERSTOP_RESPONSE._serialized_end=1386
+  _PROFILEENTRY._serialized_start=1388
+  _PROFILEENTRY._serialized_end=1482
+  _PROFILERGET_REQUEST._serialized_start=1484
+  _PROFILERGET_REQUEST._serialized_end=1505
+  _PROFILERGET_RESPONSE._serialized_start=1508
+  _PROFILERGET_RESPONSE._serialized_end=1743
+  _ASSETSTATSENTRY._serialized_start=1745
+  _ASSETSTATSENTRY._serialized_end=1831
+  _ASSETSTATSGET_REQUEST._serialized_start=1833
+  _ASSETSTATSGET_REQUEST._serialized_end=1886
+  _ASSETSTATSGET_RESPONSE._serialized_start=1889
+  _ASSETSTATSGET_RESPONSE._serialized_end=2059
+  _ASSETSTATSRESET_REQUEST._serialized_start=2061
+  _ASSETSTATSRESET_REQUEST._serialized_end=2086
+  _ASSETSTATSRESET_RESPONSE._serialized_start=2088
+  _ASSETSTATSRESET_RESPONSE._serialized_end=2196
+  _ALLOCATIONENTRY._serialized_start=2198
+  _ALLOCATIONENTRY._serialized_end=2297
+  _ALLOCATIONSGET_REQUEST._serialized_start=2299
+  _ALLOCATIONSGET_REQUEST._serialized_end=2323
+  _ALLOCATIONSGET_RESPONSE._serialized_start=2326
+  _ALLOCATIONSGET_RESPONSE._serialized_end=2497
+  _ALLOCATIONSRESET_REQUEST._serialized_start=2499
+  _ALLOCATIONSRESET_REQUEST._serialized_end=2525
+  _ALLOCATIONSRESET_RESPONSE._serialized_start=2527
+  _ALLOCATIONSRESET_RESPONSE._serialized_end=2636
+  _ARENAENTRY._serialized_start=2639
+  _ARENAENTRY._serialized_end=2825
+  _ARENASGET_REQUEST._serialized_start=2827
+  _ARENASGET_REQUEST._serialized_end=2846
+  _ARENASGET_RESPONSE._serialized_start=2849
+  _ARENASGET_RESPONSE._serialized_end=3034
 # @@protoc_insertion_point(module_scope)
@@ -7,6 +7,122 @@ from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Map
 
 DESCRIPTOR: _descriptor.FileDescriptor
 
+class AllocationEntry(_message.Message):
+    __slots__ = ["allocations", "bytes", "events", "name", "policy"]
+    ALLOCATIONS_FIELD_NUMBER: _ClassVar[int]
+    BYTES_FIELD_NUMBER: _ClassVar[int]
+    EVENTS_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    POLICY_FIELD_NUMBER: _ClassVar[int]
+    allocations: int
+    bytes: int
+    events: int
+    name: str
+    policy: str
+    def __init__(self, policy: _Optional[str] = ..., name: _Optional[str] = ..., events: _Optional[int] = ..., allocations: _Optional[int] = ..., bytes: _Optional[int] = ...) -> None: ...
+
+class AllocationsGet_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class AllocationsGet_Response(_message.Message):
+    __slots__ = ["entries", "error", "status"]
+    ENTRIES_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    entries: _containers.RepeatedCompositeFieldContainer[AllocationEntry]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[AllocationEntry, _Mapping]]] = ...) -> None: ...
+
+class AllocationsReset_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class AllocationsReset_Response(_message.Message):
+    __slots__ = ["error", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ...) -> None: ...
+
+class ArenaEntry(_message.Message):
+    __slots__ = ["allocations", "bytes_in_use", "bytes_reserved", "caches", "deallocations", "large_allocations", "remote_frees", "subsystem"]
+    ALLOCATIONS_FIELD_NUMBER: _ClassVar[int]
+    BYTES_IN_USE_FIELD_NUMBER: _ClassVar[int]
+    BYTES_RESERVED_FIELD_NUMBER: _ClassVar[int]
+    CACHES_FIELD_NUMBER: _ClassVar[int]
+    DEALLOCATIONS_FIELD_NUMBER: _ClassVar[int]
+    LARGE_ALLOCATIONS_FIELD_NUMBER: _ClassVar[int]
+    REMOTE_FREES_FIELD_NUMBER: _ClassVar[int]
+    SUBSYSTEM_FIELD_NUMBER: _ClassVar[int]
+    allocations: int
+    bytes_in_use: int
+    bytes_reserved: int
+    caches: int
+    deallocations: int
+    large_allocations: int
+    remote_frees: int
+    subsystem: str
+    def __init__(self, subsystem: _Optional[str] = ..., allocations: _Optional[int] = ..., deallocations: _Optional[int] = ..., remote_frees: _Optional[int] = ..., large_allocations: _Optional[int] = ..., bytes_in_use: _Optional[int] = ..., bytes_reserved: _Optional[int] = ..., caches: _Optional[int] = ...) -> None: ...
+
+class ArenasGet_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class ArenasGet_Response(_message.Message):
+    __slots__ = ["arena_allocator", "arenas", "error", "status"]
+    ARENAS_FIELD_NUMBER: _ClassVar[int]
+    ARENA_ALLOCATOR_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    arena_allocator: bool
+    arenas: _containers.RepeatedCompositeFieldContainer[ArenaEntry]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., arenas: _Optional[_Iterable[_Union[ArenaEntry, _Mapping]]] = ..., arena_allocator: bool = ...) -> None: ...
+
+class AssetStatsEntry(_message.Message):
+    __slots__ = ["asset", "cost", "evaluations", "successes"]
+    ASSET_FIELD_NUMBER: _ClassVar[int]
+    COST_FIELD_NUMBER: _ClassVar[int]
+    EVALUATIONS_FIELD_NUMBER: _ClassVar[int]
+    SUCCESSES_FIELD_NUMBER: _ClassVar[int]
+    asset: str
+    cost: int
+    evaluations: int
+    successes: int
+    def __init__(self, asset: _Optional[str] = ..., evaluations: _Optional[int] = ..., successes: _Optional[int] = ..., cost: _Optional[int] = ...) -> None: ...
+
+class AssetStatsGet_Request(_message.Message):
+    __slots__ = ["asset"]
+    ASSET_FIELD_NUMBER: _ClassVar[int]
+    asset: str
+    def __init__(self, asset: _Optional[str] = ...) -> None: ...
+
+class AssetStatsGet_Response(_message.Message):
+    __slots__ = ["entries", "error", "status"]
+    ENTRIES_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    entries: _containers.RepeatedCompositeFieldContainer[AssetStatsEntry]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[AssetStatsEntry, _Mapping]]] = ...) -> None: ...
+
+class AssetStatsReset_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class AssetStatsReset_Response(_message.Message):
+    __slots__ = ["error", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ...) -> None: ...
+
 class Dump_Request(_message.Message):
     __slots__ = []
     def __init__(self) -> None: ...
@@ -73,6 +189,64 @@ class List_Response(_message.Message):
     value: _struct_pb2.Value
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., value: _Optional[_Union[_struct_pb2.Value, _Mapping]] = ...) -> None: ...
 
+class ProfileEntry(_message.Message):
+    __slots__ = ["asset", "count", "operation", "stage", "timeUs"]
+    ASSET_FIELD_NUMBER: _ClassVar[int]
+    COUNT_FIELD_NUMBER: _ClassVar[int]
+    OPERATION_FIELD_NUMBER: _ClassVar[int]
+    STAGE_FIELD_NUMBER: _ClassVar[int]
+    TIMEUS_FIELD_NUMBER: _ClassVar[int]
+    asset: str
+    count: int
+    operation: str
+    stage: str
+    timeUs: int
+    def __init__(self, asset: _Optional[str] = ..., stage: _Optional[str] = ..., operation: _Optional[str] = ..., count: _Optional[int] = ..., timeUs: _Optional[int] = ...) -> None: ...
+
+class ProfilerGet_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class ProfilerGet_Response(_message.Message):
+    __slots__ = ["active", "collapsed", "entries", "error", "status"]
+    ACTIVE_FIELD_NUMBER: _ClassVar[int]
+    COLLAPSED_FIELD_NUMBER: _ClassVar[int]
+    ENTRIES_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    active: bool
+    collapsed: str
+    entries: _containers.RepeatedCompositeFieldContainer[ProfileEntry]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., active: bool = ..., collapsed: _Optional[str] = ..., entries: _Optional[_Iterable[_Union[ProfileEntry, _Mapping]]] = ...) -> None: ...
+
+class ProfilerStart_Request(_message.Message):
+    __slots__ = ["seconds"]
+    SECONDS_FIELD_NUMBER: _ClassVar[int]
+    seconds: int
+    def __init__(self, seconds: _Optional[int] = ...) -> None: ...
+
+class ProfilerStart_Response(_message.Message):
+    __slots__ = ["error", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ...) -> None: ...
+
+class ProfilerStop_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class ProfilerStop_Response(_message.Message):
+    __slots__ = ["error", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ...) -> None: ...
+
 class Test_Request(_message.Message):
     __slots__ = []
     def __init__(self) -> None: ...
@@ -14,47 +14,65 @@ _sym_db = _symbol_database.Default()
 import api_communication.proto.engine_pb2 as _engine_pb2
 
 
-DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"u\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x42\x0e\n\x0c_description\"\xf3\x01\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\rB\x0e\n\x0c_description\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03\x62\x06proto3')
+DESCRIPTOR = _descriptor_pool.Default().AddSerializedFile(b'\n\x0crouter.proto\x12\x1b\x63om.wazuh.api.engine.router\x1a\x0c\x65ngine.proto\"\x9b\x01\n\tEntryPost\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x16\n\teps_limit\x18\x06 \x01(\rH\x01\x88\x01\x01\x42\x0e\n\x0c_descriptionB\x0c\n\n_eps_limit\"\x99\x02\n\x05\x45ntry\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0e\n\x06policy\x18\x02 \x01(\t\x12\x0e\n\x06\x66ilter\x18\x03 \x01(\t\x12\x10\n\x08priority\x18\x04 \x01(\r\x12\x18\n\x0b\x64\x65scription\x18\x05 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x0bpolicy_sync\x18\x06 \x01(\x0e\x32!.com.wazuh.api.engine.router.Sync\x12\x38\n\x0c\x65ntry_status\x18\x07 \x01(\x0e\x32\".com.wazuh.api.engine.router.State\x12\x0e\n\x06uptime\x18\x08 \x01(\r\x12\x11\n\teps_limit\x18\t \x01(\r\x12\x11\n\tthrottled\x18\n \x01(\x04\x42\x0e\n\x0c_description\"Y\n\x11RoutePost_Request\x12:\n\x05route\x18\x01 \x01(\x0b\x32&.com.wazuh.api.engine.router.EntryPostH\x00\x88\x01\x01\x42\x08\n\x06_route\"#\n\x13RouteDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\" \n\x10RouteGet_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\xa7\x01\n\x11RouteGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x36\n\x05route\x18\x03 \x01(\x0b\x32\".com.wazuh.api.engine.router.EntryH\x01\x88\x01\x01\x42\x08\n\x06_errorB\x08\n\x06_route\"#\n\x13RouteReload_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"<\n\x1aRoutePatchPriority_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x10\n\x08priority\x18\x02 \x01(\r\"=\n\x1aRoutePatchEpsLimit_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x11\n\teps_limit\x18\x02 \x01(\r\"\x12\n\x10TableGet_Request\"\x98\x01\n\x11TableGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x31\n\x05table\x18\x03 \x03(\x0b\x32\".com.wazuh.api.engine.router.EntryB\x08\n\x06_error\"5\n\x11QueuePost_Request\x12\x13\n\x0bwazuh_event\x18\x01 \x01(\tJ\x04\x08\x02\x10\x03R\x05\x65vent\"-\n\x15QueuePostBulk_Request\x12\x14\n\x0cwazuh_events\x18\x01 \x03(\t\"\x8f\x01\n\x16QueuePostBulk_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x10\n\x08\x61\x63\x63\x65pted\x18\x03 \x01(\r\x12\x11\n\tdiscarded\x18\x04 \x01(\rB\x08\n\x06_error\":\n\x11\x45psUpdate_Request\x12\x0b\n\x03\x65ps\x18\x01 \x01(\r\x12\x18\n\x10refresh_interval\x18\x02 \x01(\r\"\x10\n\x0e\x45psGet_Request\"\x9b\x01\n\x0f\x45psGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x0b\n\x03\x65ps\x18\x03 \x01(\r\x12\x18\n\x10refresh_interval\x18\x04 \x01(\r\x12\x0f\n\x07\x65nabled\x18\x05 \x01(\x08\x42\x08\n\x06_error\"\x13\n\x11\x45psEnable_Request\"\x14\n\x12\x45psDisable_Request\"\xc7\x01\n\x0bIngressRule\x12\x0c\n\x04name\x18\x01 \x01(\t\x12:\n\x06\x61\x63tion\x18\x02 \x01(\x0e\x32*.com.wazuh.api.engine.router.IngressAction\x12\x12\n\x05queue\x18\x03 \x01(\tH\x00\x88\x01\x01\x12\x1c\n\x0flocation_prefix\x18\x04 \x01(\tH\x01\x88\x01\x01\x12\x10\n\x08\x63ontains\x18\x05 \x03(\t\x12\x0c\n\x04hits\x18\x06 \x01(\x04\x42\x08\n\x06_queueB\x12\n\x10_location_prefix\"[\n\x13IngressPost_Request\x12;\n\x04rule\x18\x01 \x01(\x0b\x32(.com.wazuh.api.engine.router.IngressRuleH\x00\x88\x01\x01\x42\x07\n\x05_rule\"%\n\x15IngressDelete_Request\x12\x0c\n\x04name\x18\x01 \x01(\t\"\x14\n\x12IngressGet_Request\"\xa0\x01\n\x13IngressGet_Response\x12\x32\n\x06status\x18\x01 \x01(\x0e\x32\".com.wazuh.api.engine.ReturnStatus\x12\x12\n\x05\x65rror\x18\x02 \x01(\tH\x00\x88\x01\x01\x12\x37\n\x05rules\x18\x03 \x03(\x0b\x32(.com.wazuh.api.engine.router.IngressRuleB\x08\n\x06_error*5\n\x05State\x12\x11\n\rSTATE_UNKNOWN\x10\x00\x12\x0c\n\x08\x44ISABLED\x10\x01\x12\x0b\n\x07\x45NABLED\x10\x02*>\n\x04Sync\x12\x10\n\x0cSYNC_UNKNOWN\x10\x00\x12\x0b\n\x07UPDATED\x10\x01\x12\x0c\n\x08OUTDATED\x10\x02\x12\t\n\x05\x45RROR\x10\x03*A\n\rIngressAction\x12\x1a\n\x16INGRESS_ACTION_UNKNOWN\x10\x00\x12\x08\n\x04\x44ROP\x10\x01\x12\n\n\x06\x44IVERT\x10\x02\x62\x06proto3')
 
 _builder.BuildMessageAndEnumDescriptors(DESCRIPTOR, globals())
 _builder.BuildTopDescriptorsAndMessages(DESCRIPTOR, 'router_pb2', globals())
 if _descriptor._USE_C_DESCRIPTORS == False:
 
   DESCRIPTOR._options = None
-  _STATE._serialized_start=1364
-  _STATE._serialized_end=1417
-  _SYNC._serialized_start=1419
-  _SYNC._serialized_end=1481
-  _ENTRYPOST._serialized_start=59
-  _ENTRYPOST._serialized_end=176
-  _ENTRY._serialized_start=179
-  _ENTRY._serialized_end=422
-  _ROUTEPOST_REQUEST._serialized_start=424
-  _ROUTEPOST_REQUEST._serialized_end=513
-  _ROUTEDELETE_REQUEST._serialized_start=515
-  _ROUTEDELETE_REQUEST._serialized_end=550
-  _ROUTEGET_REQUEST._serialized_start=552
-  _ROUTEGET_REQUEST._serialized_end=584
-  _ROUTEGET_RESPONSE._serialized_start=587
-  _ROUTEGET_RESPONSE._serialized_end=754
-  _ROUTERELOAD_REQUEST._serialized_start=756
-  _ROUTERELOAD_REQUEST._serialized_end=791
-  _ROUTEPATCHPRIORITY_REQUEST._serialized_start=793
-  _ROUTEPATCHPRIORITY_REQUEST._serialized_end=853
-  _TABLEGET_REQUEST._serialized_start=855
-  _TABLEGET_REQUEST._serialized_end=873
-  _TABLEGET_RESPONSE._serialized_start=876
-  _TABLEGET_RESPONSE._serialized_end=1028
-  _QUEUEPOST_REQUEST._serialized_start=1030
-  _QUEUEPOST_REQUEST._serialized_end=1083
-  _EPSUPDATE_REQUEST._serialized_start=1085
-  _EPSUPDATE_REQUEST._serialized_end=1143
-  _EPSGET_REQUEST._serialized_start=1145
-  _EPSGET_REQUEST._serialized_end=1161
-  _EPSGET_RESPONSE._serialized_start=1164
-  _EPSGET_RESPONSE._serialized_end=1319
-  _EPSENABLE_REQUEST._serialized_start=1321
-  _EPSENABLE_REQUEST._serialized_end=1340
-  _EPSDISABLE_REQUEST._serialized_start=1342
-  _EPSDISABLE_REQUEST._serialized_end=1362
+  _STATE._serialized_start=2216
+  _STATE._serialized_end=2269
+  _SYNC._serialized_start=2271
+  _SYNC._serialized_end=2333
+  _INGRESSACTION._serialized_start=2335
+  _INGRESSACTION._serialized_end=2400
+  _ENTRYPOST._serialized_start=60
+  _ENTRYPOST._serialized_end=215
+  _ENTRY._serialized_start=218
+  _ENTRY._serialized_end=499
+  _ROUTEPOST_REQUEST._serialized_start=501
+  _ROUTEPOST_REQUEST._serialized_end=590
+  _ROUTEDELETE_REQUEST._serialized_start=592
+  _ROUTEDELETE_REQUEST._serialized_end=627
+  _ROUTEGET_REQUEST._serialized_start=629
+  _ROUTEGET_REQUEST._serialized_end=661
+  _ROUTEGET_RESPONSE._serialized_start=664
+  _ROUTEGET_RESPONSE._serialized_end=831
+  _ROUTERELOAD_REQUEST._serialized_start=833
+  _ROUTERELOAD_REQUEST._serialized_end=868
+  _ROUTEPATCHPRIORITY_REQUEST._serialized_start=870
+  _ROUTEPATCHPRIORITY_REQUEST._serialized_end=930
+  _ROUTEPATCHEPSLIMIT_REQUEST._serialized_start=932
+  _ROUTEPATCHEPSLIMIT_REQUEST._serialized_end=993
+  _TABLEGET_REQUEST._serialized_start=995
+  _TABLEGET_REQUEST._serialized_end=1013
+  _TABLEGET_RESPONSE._serialized_start=1016
+  _TABLEGET_RESPONSE._serialized_end=1168
+  _QUEUEPOST_REQUEST._serialized_start=1170
+  _QUEUEPOST_REQUEST._serialized_end=1223
+  _QUEUEPOSTBULK_REQUEST._serialized_start=1225
+  _QUEUEPOSTBULK_REQUEST._serialized_end=1270
+  _QUEUEPOSTBULK_RESPONSE._serialized_start=1273
+  _QUEUEPOSTBULK_RESPONSE._serialized_end=1416
+  _EPSUPDATE_REQUEST._serialized_start=1418
+  _EPSUPDATE_REQUEST._serialized_end=1476
+  _EPSGET_REQUEST._serialized_start=1478
+  _EPSGET_REQUEST._serialized_end=1494
+  _EPSGET_RESPONSE._serialized_start=1497
+  _EPSGET_RESPONSE._serialized_end=1652
+  _EPSENABLE_REQUEST._serialized_start=1654
+  _EPSENABLE_REQUEST._serialized_end=1673
+  _EPSDISABLE_REQUEST._serialized_start=1675
+  _EPSDISABLE_REQUEST._serialized_end=1695
+  _INGRESSRULE._serialized_start=1698
+  _INGRESSRULE._serialized_end=1897
+  _INGRESSPOST_REQUEST._serialized_start=1899
+  _INGRESSPOST_REQUEST._serialized_end=1990
+  _INGRESSDELETE_REQUEST._serialized_start=1992
+  _INGRESSDELETE_REQUEST._serialized_end=2029
+  _INGRESSGET_REQUEST._serialized_start=2031
+  _INGRESSGET_REQUEST._serialized_end=2051
+  _INGRESSGET_RESPONSE._serialized_start=2054
+  _INGRESSGET_RESPONSE._serialized_end=2214
 # @@protoc_insertion_point(module_scope)
@@ -7,46 +7,55 @@ from typing import ClassVar as _ClassVar, Iterable as _Iterable, Mapping as _Map
 
 DESCRIPTOR: _descriptor.FileDescriptor
 DISABLED: State
+DIVERT: IngressAction
+DROP: IngressAction
 ENABLED: State
 ERROR: Sync
+INGRESS_ACTION_UNKNOWN: IngressAction
 OUTDATED: Sync
 STATE_UNKNOWN: State
 SYNC_UNKNOWN: Sync
 UPDATED: Sync
 
 class Entry(_message.Message):
-    __slots__ = ["description", "entry_status", "filter", "name", "policy", "policy_sync", "priority", "uptime"]
+    __slots__ = ["description", "entry_status", "eps_limit", "filter", "name", "policy", "policy_sync", "priority", "throttled", "uptime"]
     DESCRIPTION_FIELD_NUMBER: _ClassVar[int]
     ENTRY_STATUS_FIELD_NUMBER: _ClassVar[int]
+    EPS_LIMIT_FIELD_NUMBER: _ClassVar[int]
     FILTER_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     POLICY_FIELD_NUMBER: _ClassVar[int]
     POLICY_SYNC_FIELD_NUMBER: _ClassVar[int]
     PRIORITY_FIELD_NUMBER: _ClassVar[int]
+    THROTTLED_FIELD_NUMBER: _ClassVar[int]
     UPTIME_FIELD_NUMBER: _ClassVar[int]
     description: str
     entry_status: State
+    eps_limit: int
     filter: str
     name: str
     policy: str
     policy_sync: Sync
     priority: int
+    throttled: int
     uptime: int
-    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., policy_sync: _Optional[_Union[Sync, str]] = ..., entry_status: _Optional[_Union[State, str]] = ..., uptime: _Optional[int] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., policy_sync: _Optional[_Union[Sync, str]] = ..., entry_status: _Optional[_Union[State, str]] = ..., uptime: _Optional[int] = ..., eps_limit: _Optional[int] = ..., throttled: _Optional[int] = ...) -> None: ...
 
 class EntryPost(_message.Message):
-    __slots__ = ["description", "filter", "name", "policy", "priority"]
+    __slots__ = ["description", "eps_limit", "filter", "name", "policy", "priority"]
     DESCRIPTION_FIELD_NUMBER: _ClassVar[int]
+    EPS_LIMIT_FIELD_NUMBER: _ClassVar[int]
     FILTER_FIELD_NUMBER: _ClassVar[int]
     NAME_FIELD_NUMBER: _ClassVar[int]
     POLICY_FIELD_NUMBER: _ClassVar[int]
     PRIORITY_FIELD_NUMBER: _ClassVar[int]
     description: str
+    eps_limit: int
     filter: str
     name: str
     policy: str
     priority: int
-    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ...) -> None: ...
+    def __init__(self, name: _Optional[str] = ..., policy: _Optional[str] = ..., filter: _Optional[str] = ..., priority: _Optional[int] = ..., description: _Optional[str] = ..., eps_limit: _Optional[int] = ...) -> None: ...
 
 class EpsDisable_Request(_message.Message):
     __slots__ = []
@@ -82,6 +91,66 @@ class EpsUpdate_Request(_message.Message):
     refresh_interval: int
     def __init__(self, eps: _Optional[int] = ..., refresh_interval: _Optional[int] = ...) -> None: ...
 
+class IngressDelete_Request(_message.Message):
+    __slots__ = ["name"]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    name: str
+    def __init__(self, name: _Optional[str] = ...) -> None: ...
+
+class IngressGet_Request(_message.Message):
+    __slots__ = []
+    def __init__(self) -> None: ...
+
+class IngressGet_Response(_message.Message):
+    __slots__ = ["error", "rules", "status"]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    RULES_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    rules: _containers.RepeatedCompositeFieldContainer[IngressRule]
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., rules: _Optional[_Iterable[_Union[IngressRule, _Mapping]]] = ...) -> None: ...
+
+class IngressPost_Request(_message.Message):
+    __slots__ = ["rule"]
+    RULE_FIELD_NUMBER: _ClassVar[int]
+    rule: IngressRule
+    def __init__(self, rule: _Optional[_Union[IngressRule, _Mapping]] = ...) -> None: ...
+
+class IngressRule(_message.Message):
+    __slots__ = ["action", "contains", "hits", "location_prefix", "name", "queue"]
+    ACTION_FIELD_NUMBER: _ClassVar[int]
+    CONTAINS_FIELD_NUMBER: _ClassVar[int]
+    HITS_FIELD_NUMBER: _ClassVar[int]
+    LOCATION_PREFIX_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    QUEUE_FIELD_NUMBER: _ClassVar[int]
+    action: IngressAction
+    contains: _containers.RepeatedScalarFieldContainer[str]
+    hits: int
+    location_prefix: str
+    name: str
+    queue: str
+    def __init__(self, name: _Optional[str] = ..., action: _Optional[_Union[IngressAction, str]] = ..., queue: _Optional[str] = ..., location_prefix: _Optional[str] = ..., contains: _Optional[_Iterable[str]] = ..., hits: _Optional[int] = ...) -> None: ...
+
+class QueuePostBulk_Request(_message.Message):
+    __slots__ = ["wazuh_events"]
+    WAZUH_EVENTS_FIELD_NUMBER: _ClassVar[int]
+    wazuh_events: _containers.RepeatedScalarFieldContainer[str]
+    def __init__(self, wazuh_events: _Optional[_Iterable[str]] = ...) -> None: ...
+
+class QueuePostBulk_Response(_message.Message):
+    __slots__ = ["accepted", "discarded", "error", "status"]
+    ACCEPTED_FIELD_NUMBER: _ClassVar[int]
+    DISCARDED_FIELD_NUMBER: _ClassVar[int]
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    accepted: int
+    discarded: int
+    error: str
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., accepted: _Optional[int] = ..., discarded: _Optional[int] = ...) -> None: ...
+
 class QueuePost_Request(_message.Message):
     __slots__ = ["wazuh_event"]
     WAZUH_EVENT_FIELD_NUMBER: _ClassVar[int]
@@ -110,6 +179,14 @@ class RouteGet_Response(_message.Message):
     status: _engine_pb2.ReturnStatus
     def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., route: _Optional[_Union[Entry, _Mapping]] = ...) -> None: ...
 
+class RoutePatchEpsLimit_Request(_message.Message):
+    __slots__ = ["eps_limit", "name"]
+    EPS_LIMIT_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    eps_limit: int
+    name: str
+    def __init__(self, name: _Optional[str] = ..., eps_limit: _Optional[int] = ...) -> None: ...
+
 class RoutePatchPriority_Request(_message.Message):
     __slots__ = ["name", "priority"]
     NAME_FIELD_NUMBER: _ClassVar[int]
@@ -149,3 +226,6 @@ class State(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
 
 class Sync(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
     __slots__ = []
+
+class IngressAction(int, metaclass=_enum_type_wrapper.EnumTypeWrapper):
+    __slots__ = []
@@ -18,6 +18,48 @@ STATE_UNKNOWN: State
 SYNC_UNKNOWN: Sync
 UPDATED: Sync
 
+class BatchPost_Request(_message.Message):
+    __slots__ = ["asset_trace", "events", "name", "namespaces", "trace_level"]
+    class Event(_message.Message):
+        __slots__ = ["location", "message", "queue"]
+        LOCATION_FIELD_NUMBER: _ClassVar[int]
+        MESSAGE_FIELD_NUMBER: _ClassVar[int]
+        QUEUE_FIELD_NUMBER: _ClassVar[int]
+        location: str
+        message: str
+        queue: str
+        def __init__(self, message: _Optional[str] = ..., location: _Optional[str] = ..., queue: _Optional[str] = ...) -> None: ...
+    ASSET_TRACE_FIELD_NUMBER: _ClassVar[int]
+    EVENTS_FIELD_NUMBER: _ClassVar[int]
+    NAMESPACES_FIELD_NUMBER: _ClassVar[int]
+    NAME_FIELD_NUMBER: _ClassVar[int]
+    TRACE_LEVEL_FIELD_NUMBER: _ClassVar[int]
+    asset_trace: _containers.RepeatedScalarFieldContainer[str]
+    events: _containers.RepeatedCompositeFieldContainer[BatchPost_Request.Event]
+    name: str
+    namespaces: _containers.RepeatedScalarFieldContainer[str]
+    trace_level: TraceLevel
+    def __init__(self, name: _Optional[str] = ..., events: _Optional[_Iterable[_Union[BatchPost_Request.Event, _Mapping]]] = ..., trace_level: _Optional[_Union[TraceLevel, str]] = ..., asset_trace: _Optional[_Iterable[str]] = ..., namespaces: _Optional[_Iterable[str]] = ...) -> None: ...
+
+class BatchPost_Response(_message.Message):
+    __slots__ = ["error", "results", "status"]
+    class Item(_message.Message):
+        __slots__ = ["error", "index", "result"]
+        ERROR_FIELD_NUMBER: _ClassVar[int]
+        INDEX_FIELD_NUMBER: _ClassVar[int]
+        RESULT_FIELD_NUMBER: _ClassVar[int]
+        error: str
+        index: int
+        result: Result
+        def __init__(self, index: _Optional[int] = ..., error: _Optional[str] = ..., result: _Optional[_Union[Result, _Mapping]] = ...) -> None: ...
+    ERROR_FIELD_NUMBER: _ClassVar[int]
+    RESULTS_FIELD_NUMBER: _ClassVar[int]
+    STATUS_FIELD_NUMBER: _ClassVar[int]
+    error: str
+    results: _containers.RepeatedCompositeFieldContainer[BatchPost_Response.Item]
+    status: _engine_pb2.ReturnStatus
+    def __init__(self, status: _Optional[_Union[_engine_pb2.ReturnStatus, str]] = ..., error: _Optional[str] = ..., results: _Optional[_Iterable[_Union[BatchPost_Response.Item, _Mapping]]] = ...) -> None: ...
+
 class Result(_message.Message):
     __slots__ = ["asset_traces", "output"]
     class AssetTrace(_message.Message):
@@ -13,6 +13,7 @@
 
 #include "../sharedDefs.hpp"
 #include "IURLRequest.hpp"
+#include "chunkedDownloader.hpp"
 #include "componentsHelper.hpp"
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
@@ -80,6 +81,17 @@ private:
                 throw std::runtime_error("APIDownloader - Could not get response from API because: " + message);
             }};
 
+        // Run the request in parallel ranges, if enabled. Save the file on disk.
+        if (const auto spChunkedDownloader {ChunkedDownloader::create(m_urlRequest, *m_context->spUpdaterBaseContext)};
+            spChunkedDownloader)
+        {
+            if (!spChunkedDownloader->download(m_url, m_fullFilePath))
+            {
+                throw std::runtime_error("APIDownloader - Download interrupted");
+            }
+            return;
+        }
+
         // Run the request. Save the file on disk.
         m_urlRequest.download(
             HttpURL(m_url), m_fullFilePath, onError, {}, {}, m_context->spUpdaterBaseContext->httpUserAgent);
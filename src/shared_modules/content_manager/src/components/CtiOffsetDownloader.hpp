@@ -15,8 +15,11 @@
 #include "../sharedDefs.hpp"
 #include "CtiDownloader.hpp"
 #include "IURLRequest.hpp"
+#include "pagePipeline.hpp"
 #include "updaterContext.hpp"
 #include <algorithm>
+#include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 
@@ -59,6 +62,13 @@ private:
         }
         const auto& consumerLastOffset {ctiParameters.lastOffset.value()};
 
+        // When the pages are pipelined, each one is processed while the following ones are downloaded.
+        std::optional<PagePipeline<std::shared_ptr<UpdaterContext>>> pagePipeline;
+        if (m_spPageChain)
+        {
+            pagePipeline.emplace(m_spPageChain, m_pipelineDepth);
+        }
+
         // Iterate until the current offset is equal to the consumer offset.
         auto pathsArray = nlohmann::json::array();
         while (context.currentOffset < consumerLastOffset)
@@ -66,7 +76,7 @@ private:
             if (stopCondition->check())
             {
                 logWarn(WM_CONTENTUPDATER, "The offsets download has been interrupted.");
-                return;
+                break;
             }
 
             // Amount of offsets to download on each query.
@@ -86,8 +96,27 @@ private:
             // Update the current offset.
             context.currentOffset = toOffset;
 
-            // Save the path of the downloaded content in a temporary variable.
-            pathsArray.push_back(fullFilePath);
+            if (pagePipeline)
+            {
+                // Hand the page over to the rest of the chain, it commits its offset once processed.
+                pagePipeline->push(pageContext(context, fullFilePath));
+            }
+            else
+            {
+                // Save the path of the downloaded content in a temporary variable.
+                pathsArray.push_back(fullFilePath);
+            }
+        }
+
+        if (pagePipeline)
+        {
+            // The pages downloaded are processed even if the download was interrupted, so the offset committed by the
+            // chain afterwards is the one of the last page.
+            pagePipeline->drain();
+        }
+        else if (stopCondition->check())
+        {
+            return;
         }
 
         // Commit changes.
@@ -95,6 +124,24 @@ private:
         context.data.at("offset") = context.currentOffset;
     }
 
+    /**
+     * @brief Creates the context of a single page, to be processed by the page chain.
+     *
+     * @param context Updater context.
+     * @param filePath Path of the page content.
+     * @return std::shared_ptr<UpdaterContext> Page context.
+     */
+    static std::shared_ptr<UpdaterContext> pageContext(const UpdaterContext& context, const std::string& filePath)
+    {
+        auto spPageContext {std::make_shared<UpdaterContext>()};
+        spPageContext->spUpdaterBaseContext = context.spUpdaterBaseContext;
+        spPageContext->currentOffset = context.currentOffset;
+        spPageContext->data.at("type") = context.data.at("type");
+        spPageContext->data.at("offset") = context.currentOffset;
+        spPageContext->data.at("paths").push_back(filePath);
+        return spPageContext;
+    }
+
     /**
      * @brief Get the parameters needed to download the content.
      *
@@ -140,6 +187,8 @@ private:
     std::string m_url {};          ///< URL of the API to connect to.
     std::string m_outputFolder {}; ///< output folder where the file will be saved
     std::string m_fileName {};     ///< name of the file where the content will be saved
+    std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> m_spPageChain; ///< Chain run over each page.
+    size_t m_pipelineDepth {0}; ///< Maximum number of pages downloaded ahead of the one processed.
 
 public:
     /**
@@ -151,6 +200,20 @@ public:
         : CtiDownloader(urlRequest, "CtiOffsetDownloader")
     {
     }
+
+    /**
+     * @brief Processes each page with the given chain as soon as it is downloaded, while the following pages are
+     * downloaded. The pages are processed in order, and the context handed to the next step has no paths left.
+     *
+     * @param spPageChain Chain run over each page. It must not clean up the downloads folder.
+     * @param depth Maximum number of pages downloaded ahead of the one processed.
+     */
+    void pipelinePages(std::shared_ptr<AbstractHandler<std::shared_ptr<UpdaterContext>>> spPageChain,
+                       const size_t depth)
+    {
+        m_spPageChain = std::move(spPageChain);
+        m_pipelineDepth = depth;
+    }
 };
 
 #endif // _CTI_OFFSET_DOWNLOADER_HPP
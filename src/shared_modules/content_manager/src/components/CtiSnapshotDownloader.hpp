@@ -15,6 +15,7 @@
 #include "../sharedDefs.hpp"
 #include "CtiDownloader.hpp"
 #include "IURLRequest.hpp"
+#include "chunkedDownloader.hpp"
 #include "updaterContext.hpp"
 #include <filesystem>
 #include <string>
@@ -60,6 +61,17 @@ private:
 
         logDebug2(WM_CONTENTUPDATER, "Downloading snapshot from '%s'", lastSnapshotURL.string().c_str());
 
+        // Download the content in parallel ranges, if enabled.
+        if (const auto spChunkedDownloader {ChunkedDownloader::create(m_urlRequest, *context.spUpdaterBaseContext)};
+            spChunkedDownloader)
+        {
+            if (spChunkedDownloader->download(lastSnapshotURL.string(), outputFilepath))
+            {
+                onSuccess("");
+            }
+            return;
+        }
+
         // Download the content.
         performQueryWithRetry(lastSnapshotURL, onSuccess, "", outputFilepath);
     }
@@ -25,6 +25,9 @@
 #include <string>
 #include <utility>
 
+// Number of decompression threads. Zero uses all the available threads for the archives split in several blocks.
+constexpr auto XZ_DECOMPRESSION_THREADS {0U};
+
 /**
  * @class XZDecompressor
  *
@@ -60,7 +63,7 @@ private:
             // Decompress.
             logDebug2(
                 WM_CONTENTUPDATER, "Decompressing '%s' into '%s'", inputPath.string().c_str(), outputPath.c_str());
-            Utils::XzHelper(inputPath, outputPath).decompress();
+            Utils::XzHelper(inputPath, outputPath, XZ_DECOMPRESSION_THREADS).decompress();
 
             // Decompression finished: Update context path.
             path = std::move(outputPath);
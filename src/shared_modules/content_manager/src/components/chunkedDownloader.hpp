@@ -0,0 +1,532 @@
+/*
+ * Wazuh content manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CHUNKED_DOWNLOADER_HPP
+#define _CHUNKED_DOWNLOADER_HPP
+
+#include "../sharedDefs.hpp"
+#include "IURLRequest.hpp"
+#include "conditionSync.hpp"
+#include "updaterContext.hpp"
+#include "utils/uniqueFD.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+constexpr size_t DEFAULT_DOWNLOAD_CHUNK_SIZE {8 * 1024 * 1024};
+constexpr auto MAX_CHUNK_DOWNLOAD_ATTEMPTS {5U};
+constexpr auto MAX_CHUNK_RETRY_TIME {30U};
+constexpr auto CHUNKS_PROGRESS_EXTENSION {".chunks"};
+
+/**
+ * @class ChunkedDownloader
+ *
+ * @brief Class in charge of downloading a file in HTTP ranges, over several parallel connections.
+ *
+ * @details The first chunk is downloaded straight into the output file. If the server ignores the range, or the file
+ * fits in one chunk, that is the whole download. Otherwise, the connections claim the following chunks in order and
+ * write each one at its offset, until a short chunk or a 416 (range not satisfiable) response marks the end of the
+ * file. Each chunk is retried on its own, so a network error only repeats that chunk.
+ *
+ * The finished chunks are recorded next to the output file. A download that fails or is interrupted is resumed by the
+ * next one of the same URL into the same file, with the same chunk size, and the record is removed once it completes.
+ */
+class ChunkedDownloader final
+{
+private:
+    /**
+     * @brief Result of the download of a chunk.
+     *
+     */
+    struct ChunkResult
+    {
+        bool succeeded {false}; ///< Whether the server returned the range.
+        long statusCode {0};    ///< Status code of the error, if any.
+        std::string error;      ///< Error message, if any.
+        std::string data;       ///< Content of the range.
+    };
+
+    IURLRequest& m_urlRequest;                        ///< Interface to perform HTTP requests.
+    std::shared_ptr<ConditionSync> m_spStopCondition; ///< Interruption condition.
+    std::string m_userAgent;                          ///< HTTP user agent.
+    size_t m_connections;                             ///< Number of parallel connections.
+    size_t m_chunkSize;                               ///< Size of each range.
+
+    std::mutex m_mutex;                  ///< Protects the state of the current download.
+    std::map<size_t, size_t> m_finished; ///< Size of each finished chunk, by index.
+    size_t m_nextChunk {0};              ///< Next chunk to claim.
+    size_t m_endChunk {0};               ///< First chunk past the end of the file.
+    std::exception_ptr m_error;          ///< First error of the connections.
+    bool m_interrupted {false};          ///< Whether the download was interrupted.
+
+    /**
+     * @brief Header that requests a chunk.
+     *
+     * @param index Chunk index.
+     * @param length Bytes requested from the start of the chunk.
+     * @return std::string Range header.
+     */
+    std::string rangeHeader(const size_t index, const size_t length) const
+    {
+        const auto first {index * m_chunkSize};
+        return "Range: bytes=" + std::to_string(first) + "-" + std::to_string(first + length - 1);
+    }
+
+    /**
+     * @brief Performs a single request for a range.
+     *
+     * @param url URL to download from.
+     * @param range Range header.
+     * @param outputFilepath File where to store the content, empty to keep it in memory.
+     * @return ChunkResult Result of the request.
+     */
+    ChunkResult requestRange(const std::string& url, const std::string& range, const std::string& outputFilepath)
+    {
+        ChunkResult result;
+        const auto onSuccess {[&result](const std::string& data)
+                              {
+                                  result.succeeded = true;
+                                  result.data = data;
+                              }};
+        const auto onError {[&result](const std::string& message, const long statusCode)
+                            {
+                                result.error = message;
+                                result.statusCode = statusCode;
+                            }};
+
+        auto headers {DEFAULT_HEADERS};
+        headers.emplace(range);
+        m_urlRequest.get(HttpURL(url), onSuccess, onError, outputFilepath, headers, {}, m_userAgent);
+        return result;
+    }
+
+    /**
+     * @brief Requests a range until it is returned, the server returns a non-retriable error or the download is
+     * interrupted. The network errors, the 429 (too many requests) and the 5xx responses are retried, with an
+     * exponential backoff, up to MAX_CHUNK_DOWNLOAD_ATTEMPTS times.
+     *
+     * @param url URL to download from.
+     * @param range Range header.
+     * @param outputFilepath File where to store the content, empty to keep it in memory.
+     * @return std::optional<ChunkResult> Result of the last request, or nullopt if interrupted.
+     */
+    std::optional<ChunkResult>
+    requestRangeWithRetry(const std::string& url, const std::string& range, const std::string& outputFilepath)
+    {
+        unsigned int sleepTime {0};
+        for (auto attempt {1U}; !m_spStopCondition->waitFor(std::chrono::seconds(sleepTime)); ++attempt)
+        {
+            auto result {requestRange(url, range, outputFilepath)};
+
+            const auto retriable {result.statusCode <= 0 || result.statusCode == 429 ||
+                                  (result.statusCode >= 500 && result.statusCode <= 599)};
+            if (result.succeeded || !retriable || attempt == MAX_CHUNK_DOWNLOAD_ATTEMPTS)
+            {
+                return result;
+            }
+
+            sleepTime = std::min(MAX_CHUNK_RETRY_TIME, 1U << (attempt - 1));
+            logDebug1(WM_CONTENTUPDATER,
+                      "Error %ld downloading '%s' from '%s': %s. Retrying in %u seconds",
+                      result.statusCode,
+                      range.c_str(),
+                      url.c_str(),
+                      result.error.c_str(),
+                      sleepTime);
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Path of the record of the finished chunks.
+     *
+     * @param outputFilepath Output file.
+     * @return std::filesystem::path Record path.
+     */
+    static std::filesystem::path progressPath(const std::filesystem::path& outputFilepath)
+    {
+        auto path {outputFilepath};
+        path += CHUNKS_PROGRESS_EXTENSION;
+        return path;
+    }
+
+    /**
+     * @brief Loads the finished chunks of a previous download of the same URL into the same file.
+     *
+     * @details The record starts with the URL and the chunk size, followed by the index and the size of each finished
+     * chunk. A record of another download, or of a missing output file, is discarded.
+     *
+     * @param url URL to download from.
+     * @param outputFilepath Output file.
+     */
+    void loadProgress(const std::string& url, const std::filesystem::path& outputFilepath)
+    {
+        std::ifstream progress {progressPath(outputFilepath)};
+        std::string recordedUrl;
+        size_t recordedChunkSize {0};
+
+        if (!std::getline(progress, recordedUrl) || !(progress >> recordedChunkSize) || recordedUrl != url ||
+            recordedChunkSize != m_chunkSize || !std::filesystem::exists(outputFilepath))
+        {
+            return;
+        }
+
+        size_t index {0};
+        size_t size {0};
+        while (progress >> index >> size)
+        {
+            markFinished(index, size);
+        }
+
+        if (!m_finished.empty())
+        {
+            logDebug1(WM_CONTENTUPDATER,
+                      "Resuming download of '%s' with %zu finished chunks",
+                      url.c_str(),
+                      m_finished.size());
+        }
+    }
+
+    /**
+     * @brief Records a finished chunk. A short chunk marks the end of the file.
+     *
+     * @note The caller must hold the mutex, if the connections are running.
+     *
+     * @param index Chunk index.
+     * @param size Chunk size.
+     */
+    void markFinished(const size_t index, const size_t size)
+    {
+        m_finished[index] = size;
+        if (size < m_chunkSize)
+        {
+            m_endChunk = std::min(m_endChunk, size == 0 ? index : index + 1);
+        }
+    }
+
+    /**
+     * @brief Claims the next chunk that is not finished yet.
+     *
+     * @return std::optional<size_t> Chunk index, or nullopt if there are no chunks left or the download stopped.
+     */
+    std::optional<size_t> claimChunk()
+    {
+        std::lock_guard lock {m_mutex};
+        while (m_finished.count(m_nextChunk) != 0)
+        {
+            ++m_nextChunk;
+        }
+
+        if (m_error || m_interrupted || m_nextChunk >= m_endChunk)
+        {
+            return std::nullopt;
+        }
+        return m_nextChunk++;
+    }
+
+    /**
+     * @brief Writes the whole buffer at an offset of the output file.
+     *
+     * @param fd Output file descriptor.
+     * @param data Content of the chunk.
+     * @param offset Offset of the chunk.
+     */
+    static void writeAt(const int fd, const std::string& data, off_t offset)
+    {
+        auto remaining {data.size()};
+        auto buffer {data.data()};
+        while (remaining > 0)
+        {
+            const auto written {::pwrite(fd, buffer, remaining, offset)};
+            if (written == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error {"Unable to write the downloaded chunk: " + std::string(std::strerror(errno))};
+            }
+            buffer += written;
+            remaining -= static_cast<size_t>(written);
+            offset += written;
+        }
+    }
+
+    /**
+     * @brief Connection loop: downloads the claimed chunks into the output file until there are no chunks left.
+     *
+     * @param url URL to download from.
+     * @param fd Output file descriptor.
+     * @param progress Record of the finished chunks.
+     */
+    void connectionLoop(const std::string& url, const int fd, std::ofstream& progress)
+    {
+        while (const auto index {claimChunk()})
+        {
+            const auto result {requestRangeWithRetry(url, rangeHeader(*index, m_chunkSize), "")};
+            if (!result.has_value())
+            {
+                std::lock_guard lock {m_mutex};
+                m_interrupted = true;
+                return;
+            }
+
+            // A range past the end of the file is not satisfiable.
+            size_t size {0};
+            if (result->succeeded)
+            {
+                size = result->data.size();
+                if (size > m_chunkSize)
+                {
+                    throw std::runtime_error {"The server returned more data than requested for chunk " +
+                                              std::to_string(*index) + " of '" + url + "'"};
+                }
+                writeAt(fd, result->data, static_cast<off_t>(*index * m_chunkSize));
+            }
+            else if (result->statusCode != 416)
+            {
+                throw std::runtime_error {"Error " + std::to_string(result->statusCode) + " downloading chunk " +
+                                          std::to_string(*index) + " of '" + url + "': " + result->error};
+            }
+
+            std::lock_guard lock {m_mutex};
+            markFinished(*index, size);
+            progress << *index << " " << size << std::endl;
+        }
+    }
+
+    /**
+     * @brief Downloads the first chunk straight into the output file, and checks whether the server returns ranges.
+     *
+     * @param url URL to download from.
+     * @param outputFilepath Output file.
+     * @return std::optional<bool> Whether there are more chunks to download, or nullopt if interrupted.
+     */
+    std::optional<bool> downloadFirstChunk(const std::string& url, const std::filesystem::path& outputFilepath)
+    {
+        const auto first {requestRangeWithRetry(url, rangeHeader(0, m_chunkSize), outputFilepath)};
+        if (!first.has_value())
+        {
+            return std::nullopt;
+        }
+        if (!first->succeeded && first->statusCode == 416)
+        {
+            // Not even the first byte is satisfiable: the file is empty.
+            std::ofstream {outputFilepath, std::ios::trunc};
+            return false;
+        }
+        if (!first->succeeded)
+        {
+            throw std::runtime_error {"Error " + std::to_string(first->statusCode) + " from server: " + first->error};
+        }
+
+        // A smaller file fits in one chunk, and a larger one was sent whole by a server without range support.
+        if (std::filesystem::file_size(outputFilepath) != m_chunkSize)
+        {
+            return false;
+        }
+
+        // The file has exactly the chunk size either way. The first byte past it tells them apart.
+        const auto next {requestRangeWithRetry(url, rangeHeader(1, 1), "")};
+        if (!next.has_value())
+        {
+            return std::nullopt;
+        }
+        if (!next->succeeded && next->statusCode != 416)
+        {
+            throw std::runtime_error {"Error " + std::to_string(next->statusCode) + " from server: " + next->error};
+        }
+        if (!next->succeeded || next->data.size() != 1)
+        {
+            return false;
+        }
+
+        markFinished(0, m_chunkSize);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param urlRequest Object to perform the HTTP requests.
+     * @param spStopCondition Interruption condition, checked between the requests.
+     * @param userAgent HTTP user agent.
+     * @param connections Number of parallel connections.
+     * @param chunkSize Size of each range.
+     */
+    ChunkedDownloader(IURLRequest& urlRequest,
+                      std::shared_ptr<ConditionSync> spStopCondition,
+                      std::string userAgent,
+                      const size_t connections,
+                      const size_t chunkSize = DEFAULT_DOWNLOAD_CHUNK_SIZE)
+        : m_urlRequest(urlRequest)
+        , m_spStopCondition(std::move(spStopCondition))
+        , m_userAgent(std::move(userAgent))
+        , m_connections(std::max<size_t>(connections, 1))
+        , m_chunkSize(chunkSize)
+    {
+        if (m_chunkSize == 0)
+        {
+            throw std::invalid_argument {"The download chunk size can't be zero"};
+        }
+    }
+
+    /**
+     * @brief Creates a downloader from the "downloadConnections" and "downloadChunkSize" settings of the configuration.
+     *
+     * @param urlRequest Object to perform the HTTP requests.
+     * @param context Updater base context.
+     * @return std::unique_ptr<ChunkedDownloader> Downloader, or nullptr if the configuration doesn't set more than one
+     * connection.
+     */
+    static std::unique_ptr<ChunkedDownloader> create(IURLRequest& urlRequest, const UpdaterBaseContext& context)
+    {
+        const auto& configData {context.configData};
+        if (!configData.is_object() || configData.value("downloadConnections", 1) <= 1)
+        {
+            return nullptr;
+        }
+
+        return std::make_unique<ChunkedDownloader>(urlRequest,
+                                                   context.spStopCondition,
+                                                   context.httpUserAgent,
+                                                   configData.at("downloadConnections").get<size_t>(),
+                                                   configData.value("downloadChunkSize", DEFAULT_DOWNLOAD_CHUNK_SIZE));
+    }
+
+    /**
+     * @brief Downloads a file.
+     *
+     * @param url URL to download from.
+     * @param outputFilepath Output file, replaced unless a previous download of the same URL is resumed.
+     * @return true if the file was downloaded, false if the download was interrupted.
+     */
+    bool download(const std::string& url, const std::filesystem::path& outputFilepath)
+    {
+        m_finished.clear();
+        m_nextChunk = 0;
+        m_endChunk = std::numeric_limits<size_t>::max();
+        m_error = nullptr;
+        m_interrupted = false;
+
+        loadProgress(url, outputFilepath);
+        const auto progressFilepath {progressPath(outputFilepath)};
+
+        if (m_finished.empty())
+        {
+            const auto moreChunks {downloadFirstChunk(url, outputFilepath)};
+            if (!moreChunks.has_value())
+            {
+                return false;
+            }
+            if (!moreChunks.value())
+            {
+                std::filesystem::remove(progressFilepath);
+                return true;
+            }
+
+            std::ofstream progress {progressFilepath, std::ios::trunc};
+            progress << url << "\n" << m_chunkSize << "\n0 " << m_chunkSize << std::endl;
+        }
+
+        const Utils::UniqueFD fd {::open(outputFilepath.c_str(), O_WRONLY | O_CLOEXEC)};
+        if (fd.get() == -1)
+        {
+            throw std::runtime_error {"Unable to open '" + outputFilepath.string() +
+                                      "': " + std::string(std::strerror(errno))};
+        }
+
+        std::ofstream progress {progressFilepath, std::ios::app};
+        std::vector<std::thread> connections;
+        connections.reserve(m_connections);
+        for (size_t i {0}; i < m_connections; ++i)
+        {
+            connections.emplace_back(
+                [this, &url, &fd, &progress]()
+                {
+                    try
+                    {
+                        connectionLoop(url, fd.get(), progress);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock {m_mutex};
+                        if (!m_error)
+                        {
+                            m_error = std::current_exception();
+                        }
+                    }
+                });
+        }
+        for (auto& connection : connections)
+        {
+            connection.join();
+        }
+
+        // The record is kept to resume the download later.
+        if (m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+        if (m_interrupted)
+        {
+            return false;
+        }
+
+        // Only the last chunk can be short, and nothing can follow it. Otherwise a range was cut short, or the file
+        // changed in the middle of the download, and it is downloaded again from scratch.
+        size_t fileSize {0};
+        for (const auto& [index, size] : m_finished)
+        {
+            if ((index + 1 < m_endChunk && size != m_chunkSize) || (index >= m_endChunk && size != 0))
+            {
+                progress.close();
+                std::filesystem::remove(progressFilepath);
+                throw std::runtime_error {"Inconsistent chunk " + std::to_string(index) + " downloaded from '" + url +
+                                          "'"};
+            }
+            if (index < m_endChunk)
+            {
+                fileSize = index * m_chunkSize + size;
+            }
+        }
+        std::filesystem::resize_file(outputFilepath, fileSize);
+
+        progress.close();
+        std::filesystem::remove(progressFilepath);
+        logDebug2(WM_CONTENTUPDATER,
+                  "Downloaded %zu bytes from '%s' in %zu chunks",
+                  fileSize,
+                  url.c_str(),
+                  m_endChunk);
+        return true;
+    }
+};
+
+#endif // _CHUNKED_DOWNLOADER_HPP
@@ -13,6 +13,7 @@
 #define _FACTORY_CONTENT_UPDATER_HPP
 
 #include "../sharedDefs.hpp"
+#include "CtiOffsetDownloader.hpp"
 #include "factoryCleaner.hpp"
 #include "factoryDecompressor.hpp"
 #include "factoryDownloader.hpp"
@@ -58,6 +59,16 @@ public:
             ->setNext(factoryVersionUpdater)
             ->setNext(factoryCleaner);
 
+        // The offsets pages may be decompressed, published and committed while the following ones are downloaded. The
+        // downloads folder is only cleaned up by the main chain, once all the pages are processed.
+        if (const auto spOffsetDownloader {std::dynamic_pointer_cast<CtiOffsetDownloader>(factoryDownloader)};
+            spOffsetDownloader && config.value("offsetsPipelineDepth", 0) > 0)
+        {
+            auto pageChain {FactoryDecompressor::create(config)};
+            pageChain->setNext(std::make_shared<PubSubPublisher>())->setNext(FactoryVersionUpdater::create(config));
+            spOffsetDownloader->pipelinePages(pageChain, config.at("offsetsPipelineDepth").get<size_t>());
+        }
+
         return updaterChain;
     }
 };
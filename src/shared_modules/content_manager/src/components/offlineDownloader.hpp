@@ -20,13 +20,19 @@
 #include "stringHelper.h"
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
+#include "utils/uniqueFD.hpp"
 #include <array>
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
 #include <string>
 #include <utility>
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
 
 /**
  * @class OfflineDownloader
@@ -67,8 +73,55 @@ private:
                   "Copying file from '%s' into '%s'",
                   inputFilepath.string().c_str(),
                   outputFilepath.string().c_str());
-        std::filesystem::copy(unprefixedUrl, outputFilepath, std::filesystem::copy_options::overwrite_existing);
+        if (!cloneFile(unprefixedUrl, outputFilepath))
+        {
+            std::filesystem::copy(unprefixedUrl, outputFilepath, std::filesystem::copy_options::overwrite_existing);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Clone a file, sharing its data blocks with the copy, so a multi-gigabyte snapshot is not written again.
+     *
+     * @note Only the filesystems with copy-on-write support (Btrfs, XFS) can clone files, the copy is a regular one
+     * elsewhere. The clone is not a hard link: changing the input file afterwards doesn't change the copy.
+     *
+     * @param inputFilepath Input path from where to clone the file.
+     * @param outputFilepath Output path of the clone, replaced if it exists.
+     * @return true if the file was cloned, false if it has to be copied.
+     */
+    static bool cloneFile(const std::filesystem::path& inputFilepath, const std::filesystem::path& outputFilepath)
+    {
+#ifdef FICLONE
+        // Opening the output file truncates it, so the input can't be the output.
+        if (std::error_code ec; std::filesystem::exists(outputFilepath, ec) &&
+                                std::filesystem::equivalent(inputFilepath, outputFilepath, ec))
+        {
+            return false;
+        }
+
+        const Utils::UniqueFD input {::open(inputFilepath.c_str(), O_RDONLY | O_CLOEXEC)};
+        if (input.get() == -1)
+        {
+            return false;
+        }
+
+        const Utils::UniqueFD output {
+            ::open(outputFilepath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP)};
+        if (output.get() == -1)
+        {
+            return false;
+        }
+
+        if (::ioctl(output.get(), FICLONE, input.get()) == -1)
+        {
+            logDebug2(WM_CONTENTUPDATER, "File '%s' can't be cloned, copying it", inputFilepath.string().c_str());
+            return false;
+        }
         return true;
+#else
+        return false;
+#endif
     }
 
     /**
@@ -0,0 +1,173 @@
+/*
+ * Wazuh content manager
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _PAGE_PIPELINE_HPP
+#define _PAGE_PIPELINE_HPP
+
+#include "utils/chainOfResponsability.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @class PagePipeline
+ *
+ * @brief Runs a chain of handlers over a sequence of pages in a worker thread, so the page being processed overlaps
+ * with the fetching of the following ones.
+ *
+ * The pages are processed one at a time in the order they were pushed, so the steps of the chain that commit a
+ * progress, such as an offset, commit it in order. At most 'depth' pages wait to be processed: pushing another one
+ * blocks until the worker takes one. Once a page fails, the pages waiting are dropped and the error is rethrown to the
+ * producer.
+ *
+ * @tparam T Type of the pages.
+ */
+template<typename T>
+class PagePipeline final
+{
+private:
+    std::shared_ptr<Handler<T>> m_chain; ///< Chain run over each page.
+    const size_t m_depth;                ///< Maximum number of pages waiting to be processed.
+    std::queue<T> m_pages;               ///< Pages waiting to be processed.
+    bool m_processing {false};           ///< A page is being processed.
+    bool m_stop {false};                 ///< The worker must exit once the pages are processed.
+    std::exception_ptr m_error;          ///< Error of the first page that failed.
+    std::mutex m_mutex;                  ///< Guards the pipeline state.
+    std::condition_variable m_cv;        ///< Signals pages pushed and processed.
+    std::thread m_worker;                ///< Thread that processes the pages.
+
+    /**
+     * @brief Processes the pages as they are pushed.
+     *
+     */
+    void run()
+    {
+        std::unique_lock lock(m_mutex);
+        while (true)
+        {
+            m_cv.wait(lock, [this] { return !m_pages.empty() || m_stop; });
+            if (m_pages.empty())
+            {
+                return;
+            }
+
+            auto page {std::move(m_pages.front())};
+            m_pages.pop();
+            m_processing = true;
+            lock.unlock();
+            m_cv.notify_all();
+
+            std::exception_ptr error;
+            try
+            {
+                m_chain->handleRequest(std::move(page));
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            m_processing = false;
+            if (error)
+            {
+                // The following pages must not be processed without this one.
+                m_error = error;
+                m_pages = {};
+            }
+            m_cv.notify_all();
+        }
+    }
+
+    /**
+     * @brief Rethrows the error of the page that failed, if any.
+     *
+     */
+    void checkError() const
+    {
+        if (m_error)
+        {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+public:
+    /**
+     * @brief Class constructor. Starts the worker thread.
+     *
+     * @param chain Chain of handlers run over each page.
+     * @param depth Maximum number of pages waiting to be processed.
+     */
+    PagePipeline(std::shared_ptr<Handler<T>> chain, const size_t depth)
+        : m_chain(std::move(chain))
+        , m_depth(depth)
+    {
+        if (!m_chain || m_depth == 0)
+        {
+            throw std::invalid_argument {"Invalid page pipeline"};
+        }
+
+        m_worker = std::thread(&PagePipeline::run, this);
+    }
+
+    PagePipeline(const PagePipeline&) = delete;
+    PagePipeline& operator=(const PagePipeline&) = delete;
+
+    /**
+     * @brief Class destructor. Processes the pages pushed and stops the worker thread.
+     *
+     */
+    ~PagePipeline()
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_stop = true;
+        }
+        m_cv.notify_all();
+        m_worker.join();
+    }
+
+    /**
+     * @brief Pushes a page to be processed after the ones already pushed.
+     *
+     * @param page Page to process.
+     * @throws The error of a previous page, if one failed.
+     */
+    void push(T page)
+    {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_pages.size() < m_depth || m_error; });
+        checkError();
+
+        m_pages.push(std::move(page));
+        lock.unlock();
+        m_cv.notify_all();
+    }
+
+    /**
+     * @brief Waits until all the pages pushed are processed.
+     *
+     * @throws The error of the page that failed, if any.
+     */
+    void drain()
+    {
+        std::unique_lock lock(m_mutex);
+        m_cv.wait(lock, [this] { return m_pages.empty() && !m_processing; });
+        checkError();
+    }
+};
+
+#endif // _PAGE_PIPELINE_HPP
@@ -15,7 +15,13 @@
 #include "../sharedDefs.hpp"
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
+#include <cstdint>
+#include <filesystem>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
 
 /**
  * @class PubSubPublisher
@@ -26,6 +32,72 @@
 class PubSubPublisher final : public AbstractHandler<std::shared_ptr<UpdaterContext>>
 {
 private:
+    /**
+     * @brief Sends a message to the subscribers.
+     *
+     * @param context updater context.
+     * @param message message to send.
+     */
+    static void send(const UpdaterContext& context, const nlohmann::json& message)
+    {
+        // serialize the JSON object
+        const auto stringifyJson = message.dump();
+
+        logDebug2(WM_CONTENTUPDATER, "Data to be published: '%s'", stringifyJson.c_str());
+
+        context.spUpdaterBaseContext->spChannel->send({stringifyJson.begin(), stringifyJson.end()});
+        logDebug2(WM_CONTENTUPDATER, "Data published");
+    }
+
+    /**
+     * @brief Publish the paths in chunks whose files add up to the chunk size at most. A file larger than the chunk
+     * size is published alone.
+     *
+     * @details Each message is the original one with a subset of the paths, in their original order, plus a "chunk"
+     * object with the "index" of the message and the "count" of messages. The subscribers can process each chunk and
+     * release it before the next one, instead of loading all the content at once.
+     *
+     * @param context updater context.
+     * @param chunkSize maximum bytes of the files of a chunk.
+     */
+    static void publishChunks(const UpdaterContext& context, const uintmax_t chunkSize)
+    {
+        std::vector<nlohmann::json> chunks;
+        uintmax_t chunkBytes {0};
+        for (const auto& path : context.data.at("paths"))
+        {
+            std::error_code error;
+            auto fileBytes {std::filesystem::file_size(path.get<std::string>(), error)};
+            if (error)
+            {
+                fileBytes = 0;
+            }
+
+            if (chunks.empty() || chunkBytes + fileBytes > chunkSize)
+            {
+                chunks.emplace_back(nlohmann::json::array());
+                chunkBytes = 0;
+            }
+            chunks.back().push_back(path);
+            chunkBytes += fileBytes;
+        }
+
+        const auto& spStopCondition {context.spUpdaterBaseContext->spStopCondition};
+        auto message = context.data;
+        for (size_t index = 0; index < chunks.size(); ++index)
+        {
+            // A partial publication must not be followed by the version update.
+            if (index > 0 && spStopCondition && spStopCondition->check())
+            {
+                throw std::runtime_error {"The chunked publication has been interrupted"};
+            }
+
+            message["paths"] = std::move(chunks[index]);
+            message["chunk"] = {{"index", index}, {"count", chunks.size()}};
+            send(context, message);
+        }
+    }
+
     /**
      * @brief Publish the content.
      *
@@ -36,13 +108,14 @@ private:
         // If there is data to publish, send it
         if (context.data.contains("paths") && !context.data.at("paths").empty())
         {
-            // serialize the JSON object
-            const auto stringifyJson = context.data.dump();
-
-            logDebug2(WM_CONTENTUPDATER, "Data to be published: '%s'", stringifyJson.c_str());
+            const auto& configData {context.spUpdaterBaseContext->configData};
+            if (configData.is_object() && configData.value("publishChunkSize", 0) > 0)
+            {
+                publishChunks(context, configData.at("publishChunkSize").get<uintmax_t>());
+                return;
+            }
 
-            context.spUpdaterBaseContext->spChannel->send({stringifyJson.begin(), stringifyJson.end()});
-            logDebug2(WM_CONTENTUPDATER, "Data published");
+            send(context, context.data);
             return;
         }
 
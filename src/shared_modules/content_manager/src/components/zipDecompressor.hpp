@@ -18,10 +18,12 @@
 #include "updaterContext.hpp"
 #include "utils/chainOfResponsability.hpp"
 #include "utils/zlibHelper.hpp"
+#include <algorithm>
 #include <filesystem>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -44,6 +46,9 @@ private:
         const auto& outputFolder {context.spUpdaterBaseContext->outputFolder / CONTENTS_FOLDER};
         std::vector<std::string> newPaths;
 
+        // The files within a ZIP file are independent, so they're decompressed at the same time.
+        const auto threads {std::max(1U, std::thread::hardware_concurrency())};
+
         for (const auto& path : context.data.at("paths"))
         {
             logDebug2(WM_CONTENTUPDATER,
@@ -52,7 +57,7 @@ private:
                       outputFolder.string().c_str());
 
             // Decompress and move paths.
-            auto decompressedFiles {Utils::ZlibHelper::zipDecompress(path, outputFolder)};
+            auto decompressedFiles {Utils::ZlibHelper::zipDecompress(path, outputFolder, threads)};
             newPaths.insert(newPaths.end(),
                             std::make_move_iterator(decompressedFiles.begin()),
                             std::make_move_iterator(decompressedFiles.end()));
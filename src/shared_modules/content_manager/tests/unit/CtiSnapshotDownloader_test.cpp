@@ -15,6 +15,8 @@
 #include "updaterContext.hpp"
 #include "gtest/gtest.h"
 #include <filesystem>
+#include <fstream>
+#include <iterator>
 #include <memory>
 
 const auto OK_STATUS = R"([{"stage":"CtiSnapshotDownloader","status":"ok"}])"_json;
@@ -120,6 +122,53 @@ TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadWithRetry)
     EXPECT_TRUE(std::filesystem::exists(expectedContentPath));
 }
 
+/**
+ * @brief Tests the download of an snapshot file in parallel ranges.
+ *
+ */
+TEST_F(CtiSnapshotDownloaderTest, SnapshotDownloadInChunks)
+{
+    auto mockMetadata = R"(
+        {
+            "data":
+            {
+                "last_offset": 3,
+                "last_snapshot_offset": 3
+            }
+        }
+    )"_json;
+    mockMetadata["data"]["last_snapshot_link"] = "localhost:4444/xz";
+    m_spFakeServer->setCtiMetadata(mockMetadata.dump());
+
+    // The sample file is five chunks long, so the end is found by a range past it.
+    m_spUpdaterContext->spUpdaterBaseContext->configData["downloadConnections"] = 3;
+    m_spUpdaterContext->spUpdaterBaseContext->configData["downloadChunkSize"] = 16;
+
+    ASSERT_NO_THROW(CtiSnapshotDownloader(HTTPRequest::instance()).handleRequest(m_spUpdaterContext));
+
+    // Set expected data.
+    constexpr auto EXPECTED_CURRENT_OFFSET {3};
+    const auto expectedContentPath {m_spUpdaterContext->spUpdaterBaseContext->downloadsFolder / "xz"};
+    nlohmann::json expectedData;
+    expectedData["paths"] = nlohmann::json::array();
+    expectedData["paths"].push_back(expectedContentPath);
+    expectedData["stageStatus"] = OK_STATUS;
+    expectedData["type"] = CONTENT_TYPE;
+    expectedData["offset"] = EXPECTED_CURRENT_OFFSET;
+
+    EXPECT_EQ(m_spUpdaterContext->currentOffset, EXPECTED_CURRENT_OFFSET);
+    EXPECT_EQ(m_spUpdaterContext->data, expectedData);
+
+    // The chunks are put together in order, and the record of the finished chunks is removed.
+    const auto readFile {[](const std::filesystem::path& path)
+                         {
+                             std::ifstream file {path, std::ios::binary};
+                             return std::string {std::istreambuf_iterator<char>(file), {}};
+                         }};
+    EXPECT_EQ(readFile(expectedContentPath), readFile(std::filesystem::current_path() / "input_files/sample.xz"));
+    EXPECT_FALSE(std::filesystem::exists(expectedContentPath.string() + ".chunks"));
+}
+
 /**
  * @brief Tests the download of the snapshot when last_snapshot_link metadata is missing.
  *
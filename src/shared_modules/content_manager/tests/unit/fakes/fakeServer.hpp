@@ -18,6 +18,7 @@
 #include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <mutex>
 #include <queue>
 #include <sstream>
 #include <string>
@@ -59,6 +60,7 @@ private:
     std::queue<unsigned long> m_errorsQueue; ///< Errors queue used to return error codes for some queries.
     std::string m_ctiMetadataMock;
     std::vector<ServerRecord> m_records; ///< Set of queries recorded by the server.
+    std::mutex m_recordsMutex;           ///< Protects the records from the concurrent queries.
 
     /**
      * @brief Pops and returns the last error code from the error queue.
@@ -83,7 +85,10 @@ private:
     {
         auto handlerWrapper {[this, endpoint, handler](const httplib::Request& req, httplib::Response& res)
                              {
-                                 m_records.emplace_back(endpoint);
+                                 {
+                                     std::lock_guard lock {m_recordsMutex};
+                                     m_records.emplace_back(endpoint);
+                                 }
 
                                  handler(req, res);
                              }};
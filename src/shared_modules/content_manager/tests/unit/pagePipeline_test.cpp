@@ -0,0 +1,117 @@
+/*
+ * Wazuh content manager - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "pagePipeline_test.hpp"
+#include "pagePipeline.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Handler that records the pages it processes, and fails on a given one.
+ *
+ */
+class RecordingHandler final : public AbstractHandler<int>
+{
+public:
+    std::vector<int> m_pages;           ///< Pages processed, in order.
+    std::atomic<int> m_inFlight {0};    ///< Pages being processed at once.
+    std::atomic<int> m_maxInFlight {0}; ///< Maximum number of pages processed at once.
+    int m_failingPage {-1};             ///< Page that fails, if any.
+    std::mutex m_mutex;                 ///< Guards the pages processed.
+
+    int handleRequest(int page) override
+    {
+        const auto inFlight {++m_inFlight};
+        m_maxInFlight = std::max(m_maxInFlight.load(), inFlight);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --m_inFlight;
+
+        if (page == m_failingPage)
+        {
+            throw std::runtime_error {"Page failed"};
+        }
+
+        std::scoped_lock lock(m_mutex);
+        m_pages.push_back(page);
+        return page;
+    }
+};
+
+TEST_F(PagePipelineTest, ProcessesPagesInOrder)
+{
+    auto spHandler {std::make_shared<RecordingHandler>()};
+    {
+        PagePipeline<int> pipeline(spHandler, 2);
+        for (auto page = 0; page < 20; ++page)
+        {
+            pipeline.push(page);
+        }
+        EXPECT_NO_THROW(pipeline.drain());
+    }
+
+    std::vector<int> expected;
+    for (auto page = 0; page < 20; ++page)
+    {
+        expected.push_back(page);
+    }
+    EXPECT_EQ(spHandler->m_pages, expected);
+    EXPECT_EQ(spHandler->m_maxInFlight, 1);
+}
+
+TEST_F(PagePipelineTest, BoundsThePagesWaiting)
+{
+    auto spHandler {std::make_shared<RecordingHandler>()};
+    PagePipeline<int> pipeline(spHandler, 1);
+
+    // Each push waits for the worker to take the previous page, so the producer can't get more than one page ahead.
+    const auto start {std::chrono::steady_clock::now()};
+    for (auto page = 0; page < 10; ++page)
+    {
+        pipeline.push(page);
+    }
+    pipeline.drain();
+
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    EXPECT_EQ(spHandler->m_pages.size(), 10U);
+}
+
+TEST_F(PagePipelineTest, StopsAfterAFailedPage)
+{
+    auto spHandler {std::make_shared<RecordingHandler>()};
+    spHandler->m_failingPage = 3;
+    PagePipeline<int> pipeline(spHandler, 2);
+
+    // The error is rethrown either by a push made after the failure or by the drain.
+    EXPECT_THROW(
+        {
+            for (auto page = 0; page < 20; ++page)
+            {
+                pipeline.push(page);
+            }
+            pipeline.drain();
+        },
+        std::runtime_error);
+
+    // The pages after the failed one are never processed.
+    EXPECT_EQ(spHandler->m_pages, std::vector<int>({0, 1, 2}));
+}
+
+TEST_F(PagePipelineTest, InvalidPipeline)
+{
+    EXPECT_THROW(PagePipeline<int>(nullptr, 1), std::invalid_argument);
+    EXPECT_THROW(PagePipeline<int>(std::make_shared<RecordingHandler>(), 0), std::invalid_argument);
+}
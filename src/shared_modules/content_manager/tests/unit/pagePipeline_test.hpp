@@ -0,0 +1,27 @@
+/*
+ * Wazuh content manager - Unit Tests
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _PAGE_PIPELINE_TEST_HPP
+#define _PAGE_PIPELINE_TEST_HPP
+
+#include "gtest/gtest.h"
+
+/**
+ * @brief Runs unit tests for PagePipeline
+ */
+class PagePipelineTest : public ::testing::Test
+{
+protected:
+    PagePipelineTest() = default;
+    ~PagePipelineTest() override = default;
+};
+
+#endif //_PAGE_PIPELINE_TEST_HPP
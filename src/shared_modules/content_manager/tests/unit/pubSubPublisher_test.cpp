@@ -13,9 +13,12 @@
 #include "mocks/MockRouterProvider.hpp"
 #include "pubSubPublisher.hpp"
 #include "updaterContext.hpp"
+#include <filesystem>
+#include <fstream>
 #include <gmock/gmock.h>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*
  * @brief Tests the instantiation of the PubSubPublisher class
@@ -110,3 +113,68 @@ TEST_F(PubSubPublisherTest, TestPublishEmptyDataWithouStartTheMockRouterProvider
 
     EXPECT_FALSE(m_spUpdaterContext->data.empty());
 }
+
+/*
+ * @brief Tests publish the paths in chunks bounded by the size of their files.
+ */
+TEST_F(PubSubPublisherTest, TestPublishChunks)
+{
+    // Three files of 40 bytes and a chunk size of 100 bytes: two chunks.
+    const auto outputFolder {std::filesystem::temp_directory_path() / "pubSubPublisherChunks"};
+    std::filesystem::create_directories(outputFolder);
+    for (const auto& name : {"1.json", "2.json", "3.json"})
+    {
+        std::ofstream(outputFolder / name) << std::string(40, 'a');
+        m_spUpdaterContext->data.at("paths").push_back((outputFolder / name).string());
+    }
+
+    std::vector<nlohmann::json> messages;
+    auto mockRouterProvider {std::make_shared<MockRouterProvider>()};
+    EXPECT_CALL(*mockRouterProvider, send(::testing::_))
+        .Times(2)
+        .WillRepeatedly([&messages](const std::vector<char>& data)
+                        { messages.push_back(nlohmann::json::parse(data.begin(), data.end())); });
+
+    m_spUpdaterBaseContext->spChannel = mockRouterProvider;
+    m_spUpdaterBaseContext->configData = R"({ "publishChunkSize": 100 })"_json;
+    m_spUpdaterContext->spUpdaterBaseContext = m_spUpdaterBaseContext;
+
+    EXPECT_NO_THROW(m_spPubSubPublisher->handleRequest(m_spUpdaterContext));
+
+    ASSERT_EQ(messages.size(), 2U);
+    EXPECT_EQ(messages[0].at("paths").size(), 2U);
+    EXPECT_EQ(messages[1].at("paths").size(), 1U);
+    EXPECT_EQ(messages[1].at("paths").at(0), (outputFolder / "3.json").string());
+    EXPECT_EQ(messages[0].at("chunk"), R"({ "index": 0, "count": 2 })"_json);
+    EXPECT_EQ(messages[1].at("chunk"), R"({ "index": 1, "count": 2 })"_json);
+
+    std::filesystem::remove_all(outputFolder);
+}
+
+/*
+ * @brief Tests that an interrupted chunked publication throws, so the version is not updated.
+ */
+TEST_F(PubSubPublisherTest, TestPublishChunksInterrupted)
+{
+    // Two files as large as the chunk size: one chunk each.
+    const auto outputFolder {std::filesystem::temp_directory_path() / "pubSubPublisherChunksInterrupted"};
+    std::filesystem::create_directories(outputFolder);
+    for (const auto& name : {"1.json", "2.json"})
+    {
+        std::ofstream(outputFolder / name) << std::string(10, 'a');
+        m_spUpdaterContext->data.at("paths").push_back((outputFolder / name).string());
+    }
+
+    auto mockRouterProvider {std::make_shared<MockRouterProvider>()};
+    EXPECT_CALL(*mockRouterProvider, send(::testing::_))
+        .Times(1)
+        .WillOnce([this](const std::vector<char>&) { m_spStopActionCondition->set(true); });
+
+    m_spUpdaterBaseContext->spChannel = mockRouterProvider;
+    m_spUpdaterBaseContext->configData = R"({ "publishChunkSize": 10 })"_json;
+    m_spUpdaterContext->spUpdaterBaseContext = m_spUpdaterBaseContext;
+
+    EXPECT_THROW(m_spPubSubPublisher->handleRequest(m_spUpdaterContext), std::runtime_error);
+
+    std::filesystem::remove_all(outputFolder);
+}
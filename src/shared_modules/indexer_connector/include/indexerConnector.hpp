@@ -26,6 +26,7 @@ class SecureCommunication;
 #include "threadEventDispatcher.hpp"
 #include <json.hpp>
 #include <string>
+#include <string_view>
 
 using ThreadDispatchQueue = ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>>;
 
@@ -42,18 +43,22 @@ class EXPORTED IndexerConnector final
     std::condition_variable m_cv;
     std::atomic<bool> m_stopping {false};
     std::string m_indexName;
-    std::mutex m_syncMutex;
     std::unique_ptr<ThreadDispatchQueue> m_dispatcher;
 
 public:
     /**
      * @brief Class constructor that initializes the publisher.
      *
-     * @param config Indexer configuration, including database_path and servers.
+     * @param config Indexer configuration, including database_path and servers. The optional "refresh" key sets the
+     * refresh policy of the bulk requests: "wait_for" (default), "true" or "false". The number of elements of the bulk
+     * requests adapts to keep their latency under "bulk_target_latency_ms" (1000 by default), and their body stays
+     * under "bulk_max_bytes" (10 MiB by default). "compression" set to true sends the bodies compressed with GZIP.
+     * "bulk_format" set to "smile" sends the bodies in the binary Smile format instead of "json" (default), which the
+     * indexer decodes without parsing text.
      * @param logFunction Callback function to be called when trying to log a message.
      * @param timeout Server selector time interval.
      * @param workingThreads Number of working threads used by the dispatcher. More than one results in an unordered
-     * processing.
+     * processing, with one bulk request in flight per thread.
      */
     explicit IndexerConnector(const nlohmann::json& config,
                               const std::function<void(const int,
@@ -74,6 +79,21 @@ public:
      * @param message Message to be published.
      */
     void publish(const std::string& message);
+
+    /**
+     * @brief Publish a document to index, already serialized. The message isn't parsed, unlike with publish().
+     *
+     * @param id Document ID.
+     * @param document Serialized document.
+     */
+    void publishIndex(std::string_view id, std::string_view document);
+
+    /**
+     * @brief Publish the deletion of a document.
+     *
+     * @param id Document ID.
+     */
+    void publishDelete(std::string_view id);
 };
 
 #endif // _INDEXER_CONNECTOR_HPP
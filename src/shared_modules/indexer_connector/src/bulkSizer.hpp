@@ -0,0 +1,109 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_SIZER_HPP
+#define _BULK_SIZER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+
+/**
+ * @brief BulkSizer class.
+ * Adapts the number of elements of the bulk requests to the response latency of the cluster. The size grows while the
+ * requests are answered within the target latency, and is halved when they are slower or fail.
+ */
+class BulkSizer final
+{
+private:
+    mutable std::mutex m_mutex;
+    const std::chrono::milliseconds m_targetLatency;
+    const uint64_t m_minElements;
+    const uint64_t m_maxElements;
+    uint64_t m_elements;
+
+    void decrease()
+    {
+        m_elements = std::max(m_minElements, m_elements / 2);
+    }
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param targetLatency Response latency the bulk requests should stay under.
+     * @param initialElements Number of elements of the first bulk requests.
+     * @param minElements Minimum number of elements of a bulk request.
+     * @param maxElements Maximum number of elements of a bulk request.
+     */
+    explicit BulkSizer(const std::chrono::milliseconds targetLatency,
+                       const uint64_t initialElements,
+                       const uint64_t minElements,
+                       const uint64_t maxElements)
+        : m_targetLatency {targetLatency}
+        , m_minElements {minElements}
+        , m_maxElements {maxElements}
+        , m_elements {std::clamp(initialElements, minElements, maxElements)}
+    {
+        if (minElements == 0 || minElements > maxElements)
+        {
+            throw std::invalid_argument("Invalid bulk size limits");
+        }
+    }
+
+    /**
+     * @brief Get the number of elements of the next bulk requests.
+     *
+     * @return uint64_t Number of elements.
+     */
+    uint64_t elements() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_elements;
+    }
+
+    /**
+     * @brief Accounts for a successful bulk request.
+     *
+     * @param sentElements Number of elements of the request.
+     * @param latency Response latency of the request.
+     * @return uint64_t Number of elements of the next bulk requests.
+     */
+    uint64_t success(const uint64_t sentElements, const std::chrono::milliseconds latency)
+    {
+        std::scoped_lock lock(m_mutex);
+        if (latency > m_targetLatency)
+        {
+            decrease();
+        }
+        // Grow only when the bulk was full, a partial one says nothing about larger sizes.
+        else if (sentElements >= m_elements)
+        {
+            m_elements = std::min(m_maxElements, m_elements + std::max<uint64_t>(1, m_elements / 4));
+        }
+        return m_elements;
+    }
+
+    /**
+     * @brief Accounts for a failed bulk request.
+     *
+     * @return uint64_t Number of elements of the next bulk requests.
+     */
+    uint64_t failure()
+    {
+        std::scoped_lock lock(m_mutex);
+        decrease();
+        return m_elements;
+    }
+};
+
+#endif // _BULK_SIZER_HPP
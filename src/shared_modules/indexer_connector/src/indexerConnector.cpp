@@ -11,16 +11,39 @@
 
 #include "indexerConnector.hpp"
 #include "HTTPRequest.hpp"
+#include "bulkSizer.hpp"
 #include "keyStore.hpp"
 #include "loggerHelper.h"
 #include "secureCommunication.hpp"
 #include "serverSelector.hpp"
+#include "smileWriter.hpp"
+#include "zlibHelper.hpp"
+#include <chrono>
 #include <fstream>
+#include <optional>
+#include <vector>
 
 constexpr auto INDEXER_COLUMN {"indexer"};
 constexpr auto USER_KEY {"username"};
 constexpr auto PASSWORD_KEY {"password"};
 constexpr auto ELEMENTS_PER_BULK {1000};
+constexpr auto MIN_ELEMENTS_PER_BULK {10};
+constexpr auto MAX_ELEMENTS_PER_BULK {20000};
+constexpr auto BULK_MAX_BYTES_KEY {"bulk_max_bytes"};
+constexpr auto DEFAULT_BULK_MAX_BYTES {10 * 1024 * 1024};
+constexpr auto BULK_TARGET_LATENCY_KEY {"bulk_target_latency_ms"};
+constexpr auto DEFAULT_BULK_TARGET_LATENCY {1000};
+constexpr auto COMPRESSION_KEY {"compression"};
+constexpr auto BULK_FORMAT_KEY {"bulk_format"};
+constexpr auto DEFAULT_BULK_FORMAT {"json"};
+constexpr auto SMILE_BULK_FORMAT {"smile"};
+constexpr auto REFRESH_KEY {"refresh"};
+constexpr auto DEFAULT_REFRESH {"wait_for"};
+// Size of the action line of a bulk operation, without the index name and the ID.
+constexpr auto BULK_ACTION_OVERHEAD {40};
+// Queued elements: the operation, then the ID and, for the index operation, a new line and the document.
+constexpr auto INDEX_RECORD {'I'};
+constexpr auto DELETE_RECORD {'D'};
 
 namespace Log
 {
@@ -83,6 +106,25 @@ static void initConfiguration(SecureCommunication& secureCommunication, const nl
         .caRootCertificate(caRootCertificate);
 }
 
+static std::string bulkEndpoint(const nlohmann::json& config)
+{
+    // The refresh policy of the bulk requests, waiting for the refresh serializes the requests on each server.
+    const auto refresh =
+        config.contains(REFRESH_KEY) ? config.at(REFRESH_KEY).get<std::string>() : std::string(DEFAULT_REFRESH);
+
+    if (refresh == "false")
+    {
+        return "/_bulk";
+    }
+
+    if (refresh != "true" && refresh != "wait_for")
+    {
+        throw std::runtime_error("Invalid refresh policy: " + refresh);
+    }
+
+    return "/_bulk?refresh=" + refresh;
+}
+
 static void builderBulkDelete(std::string& bulkData, std::string_view id, std::string_view index)
 {
     bulkData.append(R"({"delete":{"_index":")");
@@ -105,6 +147,121 @@ static void builderBulkIndex(std::string& bulkData, std::string_view id, std::st
     bulkData.append("\n");
 }
 
+static void builderSmileBulkAction(std::string& bulkData,
+                                   std::string_view operation,
+                                   std::string_view id,
+                                   std::string_view index)
+{
+    SmileWriter writer {bulkData};
+    writer.header();
+    writer.start_object(1);
+    writer.key(operation);
+    writer.start_object(2);
+    writer.key("_index");
+    writer.string(index);
+    writer.key("_id");
+    writer.string(id);
+    writer.end_object();
+    writer.end_object();
+    bulkData.push_back(SmileWriter::SEPARATOR);
+}
+
+static bool isSmileBulkFormat(const nlohmann::json& config)
+{
+    const auto format = config.contains(BULK_FORMAT_KEY) ? config.at(BULK_FORMAT_KEY).get<std::string>()
+                                                         : std::string(DEFAULT_BULK_FORMAT);
+    if (format != DEFAULT_BULK_FORMAT && format != SMILE_BULK_FORMAT)
+    {
+        throw std::runtime_error("Invalid bulk format: " + format);
+    }
+    return format == SMILE_BULK_FORMAT;
+}
+
+static std::string indexRecord(std::string_view id, std::string_view document)
+{
+    std::string record;
+    record.reserve(id.size() + document.size() + 2);
+    record.push_back(INDEX_RECORD);
+    record.append(id);
+    record.push_back('\n');
+    record.append(document);
+    return record;
+}
+
+static std::string deleteRecord(std::string_view id)
+{
+    std::string record;
+    record.reserve(id.size() + 1);
+    record.push_back(DELETE_RECORD);
+    record.append(id);
+    return record;
+}
+
+/**
+ * @brief Converts a JSON message, with the "id", "operation", "data" and "no-index" fields, to a queued element.
+ *
+ * @return std::optional<std::string> Queued element, none if the element should not be indexed.
+ */
+static std::optional<std::string> messageRecord(const std::string& message)
+{
+    const auto parsedData = nlohmann::json::parse(message);
+    const auto& id = parsedData.at("id").get_ref<const std::string&>();
+    // If the element should not be indexed, only delete it from the sync database.
+    if (parsedData.contains("no-index") && parsedData.at("no-index").get<bool>())
+    {
+        return std::nullopt;
+    }
+
+    if (parsedData.at("operation").get_ref<const std::string&>().compare("DELETED") == 0)
+    {
+        return deleteRecord(id);
+    }
+    return indexRecord(id, parsedData.at("data").dump());
+}
+
+static void builderBulkRecord(std::string& bulkData, std::string_view record, std::string_view index)
+{
+    if (record.front() == DELETE_RECORD)
+    {
+        builderBulkDelete(bulkData, record.substr(1), index);
+    }
+    else if (const auto separator = record.find('\n'); separator != std::string_view::npos)
+    {
+        builderBulkIndex(bulkData, record.substr(1, separator - 1), index, record.substr(separator + 1));
+    }
+}
+
+/**
+ * @brief Appends a queued element to a Smile bulk body. The document is transcoded from its JSON text, an element
+ * that isn't valid JSON is skipped, as the indexer would reject it anyway.
+ */
+static void builderSmileBulkRecord(std::string& bulkData, std::string_view record, std::string_view index)
+{
+    if (record.front() == DELETE_RECORD)
+    {
+        builderSmileBulkAction(bulkData, "delete", record.substr(1), index);
+    }
+    else if (const auto separator = record.find('\n'); separator != std::string_view::npos)
+    {
+        const auto size {bulkData.size()};
+        const auto id {record.substr(1, separator - 1)};
+        builderSmileBulkAction(bulkData, "index", id, index);
+        try
+        {
+            SmileWriter::append(bulkData, record.substr(separator + 1));
+        }
+        catch (const std::exception& e)
+        {
+            bulkData.resize(size);
+            logWarn(IC_NAME,
+                    "Skipping the document '%.*s', it is not valid JSON: %s",
+                    static_cast<int>(id.size()),
+                    id.data(),
+                    e.what());
+        }
+    }
+}
+
 IndexerConnector::IndexerConnector(
     const nlohmann::json& config,
     const std::function<void(
@@ -138,67 +295,148 @@ IndexerConnector::IndexerConnector(
         logDebug1(IC_NAME, "Invalid number of working threads, using default value.");
     }
 
-    m_dispatcher = std::make_unique<ThreadDispatchQueue>(
-        [this, selector, secureCommunication](std::queue<std::string>& dataQueue)
-        {
-            std::scoped_lock lock(m_syncMutex);
+    const auto endpoint {bulkEndpoint(config)};
+    const std::size_t maxBytes {config.contains(BULK_MAX_BYTES_KEY) ? config.at(BULK_MAX_BYTES_KEY).get<std::size_t>()
+                                                                     : DEFAULT_BULK_MAX_BYTES};
+    const std::chrono::milliseconds targetLatency {config.contains(BULK_TARGET_LATENCY_KEY)
+                                                       ? config.at(BULK_TARGET_LATENCY_KEY).get<int64_t>()
+                                                       : DEFAULT_BULK_TARGET_LATENCY};
+    const auto compression {config.contains(COMPRESSION_KEY) && config.at(COMPRESSION_KEY).get<bool>()};
+    const auto smile {isSmileBulkFormat(config)};
+
+    auto headers {DEFAULT_HEADERS};
+    if (smile)
+    {
+        headers.erase("Content-Type: application/json");
+        headers.emplace("Content-Type: application/smile");
+    }
+    if (compression)
+    {
+        headers.emplace("Content-Encoding: gzip");
+    }
 
+    auto sizer {std::make_shared<BulkSizer>(
+        targetLatency, ELEMENTS_PER_BULK, MIN_ELEMENTS_PER_BULK, MAX_ELEMENTS_PER_BULK)};
+
+    m_dispatcher = std::make_unique<ThreadDispatchQueue>(DATABASE_BASE_PATH + m_indexName,
+                                                         sizer->elements(),
+                                                         UNLIMITED_QUEUE_SIZE,
+                                                         workingThreads <= 0 ? SINGLE_ORDERED_DISPATCHING
+                                                                             : workingThreads);
+
+    // The worker starts once the dispatcher is set, the bulk size is adapted from the functor.
+    m_dispatcher->startWorker(
+        [this, selector, sizer, secureCommunication, endpoint, maxBytes, compression, smile, headers](
+            std::queue<std::string>& dataQueue)
+        {
+            // No lock is taken, so with several working threads there are several bulk requests in flight, spread
+            // across the servers by the selector.
             if (m_stopping.load())
             {
                 logDebug2(IC_NAME, "IndexerConnector is stopping, event processing will be skipped.");
                 throw std::runtime_error("IndexerConnector is stopping, event processing will be skipped.");
             }
 
-            auto url = selector->getNext();
-            std::string bulkData;
-            url.append("/_bulk?refresh=wait_for");
-
+            // Take the messages out of the queue first, so the bulk body is allocated only once.
+            std::vector<std::string> messages;
+            messages.reserve(dataQueue.size());
+            std::size_t bulkSize {0};
             while (!dataQueue.empty())
             {
-                auto data = dataQueue.front();
+                bulkSize += dataQueue.front().size() + m_indexName.size() + BULK_ACTION_OVERHEAD;
+                messages.emplace_back(std::move(dataQueue.front()));
                 dataQueue.pop();
-                auto parsedData = nlohmann::json::parse(data);
-                const auto& id = parsedData.at("id").get_ref<const std::string&>();
-                // If the element should not be indexed, only delete it from the sync database.
-                const bool noIndex = parsedData.contains("no-index") ? parsedData.at("no-index").get<bool>() : false;
+            }
 
-                if (parsedData.at("operation").get_ref<const std::string&>().compare("DELETED") == 0)
+            std::string bulkData;
+            bulkData.reserve(std::min(bulkSize, maxBytes));
+            uint64_t elements {0};
+
+            const auto send = [&]()
+            {
+                if (bulkData.empty())
                 {
-                    if (!noIndex)
-                    {
-                        builderBulkDelete(bulkData, id, m_indexName);
-                    }
+                    return;
+                }
+
+                const auto server {selector->getNext()};
+
+                const auto start {std::chrono::steady_clock::now()};
+                try
+                {
+                    // Process data.
+                    HTTPRequest::instance().post(
+                        HttpURL(server + endpoint),
+                        compression ? Utils::ZlibHelper::gzipCompress(bulkData) : bulkData,
+                        [](const std::string& response) { logDebug2(IC_NAME, "Response: %s", response.c_str()); },
+                        [&selector, &server](const std::string& error, const long statusCode)
+                        {
+                            logError(IC_NAME, "%s, status code: %ld.", error.c_str(), statusCode);
+                            selector->reportFailure(server, statusCode);
+                            throw std::runtime_error(error);
+                        },
+                        "",
+                        headers,
+                        secureCommunication);
+                }
+                catch (...)
+                {
+                    m_dispatcher->setBulkSize(sizer->failure());
+                    throw;
+                }
+
+                const auto latency {
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)};
+                selector->reportSuccess(server, latency);
+                m_dispatcher->setBulkSize(
+                    sizer->success(elements, std::chrono::duration_cast<std::chrono::milliseconds>(latency)));
+
+                bulkData.clear();
+                elements = 0;
+            };
+
+            // The elements that don't fit in the byte budget go in the next request, a failed request retries all of
+            // them, which is harmless as the operations are idempotent.
+            const auto add = [&](std::string_view record)
+            {
+                if (!bulkData.empty() &&
+                    bulkData.size() + record.size() + m_indexName.size() + BULK_ACTION_OVERHEAD > maxBytes)
+                {
+                    send();
+                }
+                if (smile)
+                {
+                    builderSmileBulkRecord(bulkData, record, m_indexName);
                 }
                 else
                 {
-                    const auto dataString = parsedData.at("data").dump();
-                    if (!noIndex)
-                    {
-                        builderBulkIndex(bulkData, id, m_indexName, dataString);
-                    }
+                    builderBulkRecord(bulkData, record, m_indexName);
                 }
-            }
+                ++elements;
+            };
 
-            if (!bulkData.empty())
+            for (const auto& data : messages)
             {
-                // Process data.
-                HTTPRequest::instance().post(
-                    HttpURL(url),
-                    bulkData,
-                    [](const std::string& response) { logDebug2(IC_NAME, "Response: %s", response.c_str()); },
-                    [](const std::string& error, const long statusCode)
+                if (data.empty())
+                {
+                    continue;
+                }
+
+                // Elements queued by previous versions are JSON messages.
+                if (data.front() == '{')
+                {
+                    if (const auto record = messageRecord(data); record)
                     {
-                        logError(IC_NAME, "%s, status code: %ld.", error.c_str(), statusCode);
-                        throw std::runtime_error(error);
-                    },
-                    "",
-                    DEFAULT_HEADERS,
-                    secureCommunication);
+                        add(*record);
+                    }
+                }
+                else
+                {
+                    add(data);
+                }
             }
-        },
-        DATABASE_BASE_PATH + m_indexName,
-        ELEMENTS_PER_BULK,
-        workingThreads <= 0 ? SINGLE_ORDERED_DISPATCHING : workingThreads);
+            send();
+        });
 }
 
 IndexerConnector::~IndexerConnector()
@@ -211,5 +449,18 @@ IndexerConnector::~IndexerConnector()
 
 void IndexerConnector::publish(const std::string& message)
 {
-    m_dispatcher->push(message);
+    if (auto record = messageRecord(message); record)
+    {
+        m_dispatcher->push(*record);
+    }
+}
+
+void IndexerConnector::publishIndex(std::string_view id, std::string_view document)
+{
+    m_dispatcher->push(indexRecord(id, document));
+}
+
+void IndexerConnector::publishDelete(std::string_view id)
+{
+    m_dispatcher->push(deleteRecord(id));
 }
@@ -61,27 +61,115 @@ namespace HealthCheckColumns
     };
 };
 
+// Time a health check can take before the server is considered unavailable.
+constexpr auto PROBE_TIMEOUT = std::chrono::seconds(10);
+// Consecutive failed requests (throttled, server error or no response) before the server is considered unavailable.
+constexpr auto MAX_CONSECUTIVE_FAILURES = 3u;
+// Latency assumed for a server until its first request is answered.
+constexpr auto INITIAL_LATENCY = std::chrono::milliseconds(100);
+// Weight of the last request in the latency average, in percent.
+constexpr auto LATENCY_SMOOTHING = 20;
+
 /**
- * @brief Monitoring class.
+ * @brief Health of a server, from the health checks and the requests sent to it.
  *
  */
+struct ServerHealth final
+{
+    bool available {true};                               ///< Last health check result.
+    bool probing {false};                                ///< A health check is in flight.
+    std::chrono::steady_clock::time_point probeStart;    ///< Start of the last health check.
+    std::chrono::microseconds latency {INITIAL_LATENCY}; ///< Moving average of the request latency.
+    uint32_t failures {0};                               ///< Consecutive failed requests.
+};
+
+/**
+ * @brief Monitoring class.
+ * Each server is checked from its own thread, so a slow or dead server doesn't delay the checks of the others. Between
+ * checks, the responses to the requests sent to the servers are reported as passive health signals.
+ */
 class Monitoring final
 {
-    std::map<std::string, bool> m_values;
-    std::thread m_thread;
-    std::mutex m_mutex;
+    std::map<std::string, ServerHealth> m_values;
+    std::vector<std::thread> m_threads;
+    mutable std::mutex m_mutex;
     std::condition_variable m_condition;
     std::atomic<bool> m_stop {false};
     uint32_t m_interval {INTERVAL};
 
+    /**
+     * @brief Checks whether a health check response reports a green cluster.
+     */
+    static bool isGreen(std::string response)
+    {
+        // Remove the tabs and double spaces.
+        Utils::replaceAll(response, "\t", " ");
+        Utils::replaceAll(response, "  ", " ");
+        // Split the response by rows.
+        const auto rows {Utils::split(response, '\n')};
+
+        // Check if the response has the expected number of rows.
+        if (HealthCheckRows::SIZE != rows.size())
+        {
+            return false; // LCOV_EXCL_LINE
+        }
+
+        // Split the data row by spaces.
+        const auto fields {Utils::split(rows.at(HealthCheckRows::DATA), ' ')};
+
+        // Check if the response has the expected number of columns and if the status is green.
+        return fields.size() == HealthCheckColumns::SIZE &&
+               fields.at(HealthCheckColumns::STATUS).compare("green") == 0;
+    }
+
+    void check(const std::string& value, ServerHealth& health, const SecureCommunication& secureCommunication)
+    {
+        const std::unordered_set<std::string> headers {"Accept-Charset: utf-8"};
+        while (!m_stop)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                // Wait for the interval.
+                m_condition.wait_for(lock, std::chrono::seconds(m_interval), [this]() { return m_stop.load(); });
+                if (m_stop)
+                {
+                    break;
+                }
+                health.probing = true;
+                health.probeStart = std::chrono::steady_clock::now();
+            }
+
+            // The lock isn't held during the request, the availability of the servers can be read meanwhile.
+            auto healthy {false};
+            HTTPRequest::instance().get(
+                HttpURL(value + "/_cat/health?v"),
+                [&healthy](const std::string& response) { healthy = isGreen(response); },
+                [&healthy](const std::string& /*error*/, const long /*statusCode*/) { healthy = false; },
+                "",
+                headers,
+                secureCommunication);
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            health.probing = false;
+            health.available = healthy;
+            if (healthy)
+            {
+                health.failures = 0;
+            }
+        }
+    }
+
 public:
     ~Monitoring()
     {
         m_stop = true;
-        m_condition.notify_one();
-        if (m_thread.joinable())
+        m_condition.notify_all();
+        for (auto& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
     }
 
@@ -100,68 +188,15 @@ public:
         // Initialize the map with the values, all servers are available.
         for (auto& value : values)
         {
-            m_values[value] = true;
+            m_values[value] = ServerHealth {};
         }
 
-        // Start the thread, that will check the health of the servers.
-        m_thread = std::thread(
-            [this, secureCommunication]()
-            {
-                const std::unordered_set<std::string> headers {"Accept-Charset: utf-8"};
-                while (!m_stop)
-                {
-                    std::unique_lock<std::mutex> lock(m_mutex);
-                    // Wait for the interval.
-                    m_condition.wait_for(lock, std::chrono::seconds(m_interval), [this]() { return m_stop.load(); });
-
-                    // If the thread is not stopped, check the health of the servers.
-                    if (!m_stop)
-                    {
-                        // Check the health of the servers.
-                        for (auto& value : m_values)
-                        {
-                            // Get the health of the server.
-                            HTTPRequest::instance().get(
-                                HttpURL(value.first + "/_cat/health?v"),
-                                [&](std::string response)
-                                {
-                                    // Remove the tabs and double spaces.
-                                    Utils::replaceAll(response, "\t", " ");
-                                    Utils::replaceAll(response, "  ", " ");
-                                    // Split the response by rows.
-                                    const auto rows {Utils::split(response, '\n')};
-
-                                    // Check if the response has the expected number of rows.
-                                    if (HealthCheckRows::SIZE == rows.size())
-                                    {
-                                        // Split the data row by spaces.
-                                        const auto fields {Utils::split(rows.at(HealthCheckRows::DATA), ' ')};
-
-                                        // Check if the response has the expected number of columns and if the status is
-                                        // green.
-                                        if (fields.size() == HealthCheckColumns::SIZE &&
-                                            fields.at(HealthCheckColumns::STATUS).compare("green") == 0)
-                                        {
-                                            value.second = true;
-                                        }
-                                        else
-                                        {
-                                            value.second = false;
-                                        }
-                                    }
-                                    else
-                                    {
-                                        value.second = false; // LCOV_EXCL_LINE
-                                    }
-                                },
-                                [&](const std::string& error, const long /*statusCode*/) { value.second = false; },
-                                "",
-                                headers,
-                                secureCommunication);
-                        }
-                    }
-                }
-            });
+        // Start the threads, that will check the health of the servers.
+        m_threads.reserve(m_values.size());
+        for (auto& [value, health] : m_values)
+        {
+            m_threads.emplace_back(&Monitoring::check, this, std::cref(value), std::ref(health), secureCommunication);
+        }
     }
 
     /**
@@ -171,11 +206,66 @@ public:
      * @return true if available.
      * @return false if not available.
      */
-    bool isAvailable(const std::string& value)
+    bool isAvailable(const std::string& value) const
+    {
+        return health(value).available;
+    }
+
+    /**
+     * @brief Get the health of a server. A server whose health check takes too long, or whose last requests failed, is
+     * not available.
+     *
+     * @param value Server's address.
+     * @return ServerHealth Health of the server.
+     */
+    ServerHealth health(const std::string& value) const
     {
-        // Check if the server is available.
         std::lock_guard<std::mutex> lock(m_mutex);
-        return m_values.at(value);
+        auto health {m_values.at(value)};
+        if (health.probing && std::chrono::steady_clock::now() - health.probeStart > PROBE_TIMEOUT)
+        {
+            health.available = false;
+        }
+        if (health.failures >= MAX_CONSECUTIVE_FAILURES)
+        {
+            health.available = false;
+        }
+        return health;
+    }
+
+    /**
+     * @brief Reports a request answered by a server.
+     *
+     * @param value Server's address.
+     * @param latency Response latency.
+     */
+    void reportSuccess(const std::string& value, const std::chrono::microseconds latency)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto& health {m_values.at(value)};
+        health.latency = (health.latency * (100 - LATENCY_SMOOTHING) + latency * LATENCY_SMOOTHING) / 100;
+        health.failures = 0;
+    }
+
+    /**
+     * @brief Reports a request failed by a server. Only the throttled requests (429), the server errors (5xx) and the
+     * requests without response (0) count, other errors are caused by the request itself.
+     *
+     * @param value Server's address.
+     * @param statusCode Response status code, 0 if there was no response.
+     */
+    void reportFailure(const std::string& value, const long statusCode)
+    {
+        constexpr auto TOO_MANY_REQUESTS {429};
+        constexpr auto SERVER_ERROR {500};
+
+        if (statusCode != 0 && statusCode != TOO_MANY_REQUESTS && statusCode < SERVER_ERROR)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_values.at(value).failures;
     }
 };
 
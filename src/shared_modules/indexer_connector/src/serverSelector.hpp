@@ -13,25 +13,39 @@
 #define _SERVER_SELECTOR_HPP
 
 #include "monitoring.hpp"
-#include "roundRobinSelector.hpp"
 #include "secureCommunication.hpp"
+#include <chrono>
 #include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 /**
  * @brief ServerSelector class.
- *
+ * Selects the available servers with a smooth weighted round robin, where the weight of a server is the inverse of its
+ * request latency. Servers with the same latency are selected in turns, a faster server is selected more often.
  */
-class ServerSelector final : private RoundRobinSelector<std::string>
+class ServerSelector final
 {
 private:
     std::shared_ptr<Monitoring> monitoring;
+    std::vector<std::string> m_values;
+    std::vector<double> m_currentWeights;
+    std::mutex m_mutex;
+
+    static double weight(const ServerHealth& health)
+    {
+        // Recent failures lower the weight further, the server is avoided before it is flagged as unavailable.
+        const auto latency {std::max<double>(1, static_cast<double>(health.latency.count()))};
+        return 1 / (latency * (1 + health.failures));
+    }
 
 public:
     ~ServerSelector() = default;
 
     /**
-     * @brief Class constructor. Initializes Round Robin selector and monitoring.
+     * @brief Class constructor. Initializes the weights and monitoring.
      *
      * @param values Servers to be selected.
      * @param timeout Timeout for monitoring.
@@ -40,7 +54,8 @@ public:
     explicit ServerSelector(const std::vector<std::string>& values,
                             const uint32_t timeout = INTERVAL,
                             const SecureCommunication& secureCommunication = {})
-        : RoundRobinSelector<std::string>(values)
+        : m_values(values)
+        , m_currentWeights(values.size(), 0)
     {
         monitoring = std::make_shared<Monitoring>(values, timeout, secureCommunication);
     }
@@ -52,18 +67,58 @@ public:
      */
     std::string getNext()
     {
-        auto initialValue {RoundRobinSelector<std::string>::getNext()};
-        auto retValue {initialValue};
+        std::lock_guard<std::mutex> lock(m_mutex);
 
-        while (!monitoring->isAvailable(retValue))
+        // Each available server gains its weight, the one with the highest accumulated weight is selected and loses
+        // the total weight.
+        auto selected {m_values.size()};
+        double totalWeight {0};
+        for (std::size_t i = 0; i < m_values.size(); ++i)
         {
-            retValue = RoundRobinSelector<std::string>::getNext();
-            if (retValue.compare(initialValue) == 0)
+            const auto health {monitoring->health(m_values[i])};
+            if (!health.available)
+            {
+                continue;
+            }
+
+            const auto serverWeight {weight(health)};
+            m_currentWeights[i] += serverWeight;
+            totalWeight += serverWeight;
+            if (selected == m_values.size() || m_currentWeights[i] > m_currentWeights[selected])
             {
-                throw std::runtime_error("No available server");
+                selected = i;
             }
         }
-        return retValue;
+
+        if (selected == m_values.size())
+        {
+            throw std::runtime_error("No available server");
+        }
+
+        m_currentWeights[selected] -= totalWeight;
+        return m_values[selected];
+    }
+
+    /**
+     * @brief Reports a request answered by a server.
+     *
+     * @param value Server's address.
+     * @param latency Response latency.
+     */
+    void reportSuccess(const std::string& value, const std::chrono::microseconds latency)
+    {
+        monitoring->reportSuccess(value, latency);
+    }
+
+    /**
+     * @brief Reports a request failed by a server.
+     *
+     * @param value Server's address.
+     * @param statusCode Response status code, 0 if there was no response.
+     */
+    void reportFailure(const std::string& value, const long statusCode)
+    {
+        monitoring->reportFailure(value, statusCode);
     }
 };
 
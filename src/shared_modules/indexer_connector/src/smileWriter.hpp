@@ -0,0 +1,362 @@
+/*
+ * Wazuh - Indexer connector.
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SMILE_WRITER_HPP
+#define _SMILE_WRITER_HPP
+
+#include "json.hpp"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief SmileWriter class.
+ * Writes the events of a SAX parse (https://json.nlohmann.me/api/json_sax/) as a Smile document, the binary JSON
+ * format the wazuh-indexer accepts in the bulk requests. A JSON text is transcoded in a single pass, without building
+ * its DOM. The names and values are never shared, so the documents don't depend on each other.
+ */
+class SmileWriter final
+{
+public:
+    /// Alias for integer type
+    using NumberIntegerT = typename nlohmann::json::number_integer_t;
+    /// Alias for unsigned type
+    using NumberUnsignedT = typename nlohmann::json::number_unsigned_t;
+    /// Alias for float type
+    using NumberFloatT = typename nlohmann::json::number_float_t;
+    /// Alias for string type
+    using StringT = typename nlohmann::json::string_t;
+    /// Alias for binary type
+    using BinaryT = typename nlohmann::json::binary_t;
+
+    /// Ends each document of a stream, as the new line does in a NDJSON one.
+    static constexpr char SEPARATOR {'\xFF'};
+
+private:
+    static constexpr std::string_view HEADER {":)\n\x00", 4};
+    static constexpr char TOKEN_EMPTY_STRING {'\x20'};
+    static constexpr char TOKEN_NULL {'\x21'};
+    static constexpr char TOKEN_FALSE {'\x22'};
+    static constexpr char TOKEN_TRUE {'\x23'};
+    static constexpr char TOKEN_INT32 {'\x24'};
+    static constexpr char TOKEN_INT64 {'\x25'};
+    static constexpr char TOKEN_BIG_INTEGER {'\x26'};
+    static constexpr char TOKEN_FLOAT64 {'\x29'};
+    static constexpr uint8_t TOKEN_TINY_ASCII {0x40};
+    static constexpr uint8_t TOKEN_SHORT_ASCII {0x60};
+    static constexpr uint8_t TOKEN_TINY_UNICODE {0x80};
+    static constexpr uint8_t TOKEN_SHORT_UNICODE {0xA0};
+    static constexpr uint8_t TOKEN_SMALL_INT {0xC0};
+    static constexpr char TOKEN_LONG_ASCII {'\xE0'};
+    static constexpr char TOKEN_LONG_UNICODE {'\xE4'};
+    static constexpr char TOKEN_START_ARRAY {'\xF8'};
+    static constexpr char TOKEN_END_ARRAY {'\xF9'};
+    static constexpr char TOKEN_START_OBJECT {'\xFA'};
+    static constexpr char TOKEN_END_OBJECT {'\xFB'};
+    static constexpr char END_OF_STRING {'\xFC'};
+    static constexpr char KEY_EMPTY {'\x20'};
+    static constexpr char KEY_LONG_UNICODE {'\x34'};
+    static constexpr uint8_t KEY_SHORT_ASCII {0x80};
+    static constexpr uint8_t KEY_SHORT_UNICODE {0xC0};
+
+    std::string& m_output;
+
+    static bool isAscii(std::string_view str)
+    {
+        for (const auto c : str)
+        {
+            if (static_cast<uint8_t>(c) >= 0x80)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void token(const uint8_t value)
+    {
+        m_output.push_back(static_cast<char>(value));
+    }
+
+    /**
+     * @brief Writes an unsigned variable length integer: 7 bits per byte, the last one has 6 and its high bit set.
+     */
+    void vint(uint64_t value)
+    {
+        char buffer[10];
+        auto pos {sizeof(buffer) - 1};
+        buffer[pos] = static_cast<char>(0x80 | (value & 0x3F));
+        value >>= 6;
+        while (value != 0)
+        {
+            buffer[--pos] = static_cast<char>(value & 0x7F);
+            value >>= 7;
+        }
+        m_output.append(buffer + pos, sizeof(buffer) - pos);
+    }
+
+    /**
+     * @brief Writes bytes in groups of 7 bits, so no byte has the high bit set. Each chunk of up to 7 bytes is split
+     * from its most significant bit, the last group holds the remaining bits.
+     */
+    void sevenBits(const uint8_t* bytes, const std::size_t size)
+    {
+        for (std::size_t chunk = 0; chunk < size; chunk += 7)
+        {
+            const auto chunkSize {std::min<std::size_t>(7, size - chunk)};
+            uint64_t value {0};
+            for (std::size_t i = 0; i < chunkSize; ++i)
+            {
+                value = (value << 8) | bytes[chunk + i];
+            }
+
+            auto bits {chunkSize * 8};
+            while (bits >= 7)
+            {
+                bits -= 7;
+                token(static_cast<uint8_t>((value >> bits) & 0x7F));
+            }
+            if (bits > 0)
+            {
+                token(static_cast<uint8_t>(value & ((1U << bits) - 1)));
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Class constructor.
+     *
+     * @param output Buffer the tokens are appended to.
+     */
+    explicit SmileWriter(std::string& output)
+        : m_output {output}
+    {
+    }
+
+    /**
+     * @brief Appends a JSON text as a Smile document, with its header and the stream separator.
+     *
+     * @param output Buffer the document is appended to, left as it was if the text is not valid.
+     * @param json JSON text.
+     * @throw nlohmann::json::parse_error if the text is not valid JSON.
+     */
+    static void append(std::string& output, std::string_view json)
+    {
+        const auto size {output.size()};
+        SmileWriter writer {output};
+        writer.header();
+        try
+        {
+            nlohmann::json::sax_parse(json, &writer);
+        }
+        catch (...)
+        {
+            output.resize(size);
+            throw;
+        }
+        output.push_back(SEPARATOR);
+    }
+
+    /**
+     * @brief Writes the header of a document.
+     */
+    void header()
+    {
+        m_output.append(HEADER);
+    }
+
+    // The SAX events append their tokens and return true to continue parsing. The strings are views, so the writer
+    // can also be fed by hand.
+
+    // cppcheck-suppress unusedFunction
+    bool null()
+    {
+        m_output.push_back(TOKEN_NULL);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool boolean(bool val)
+    {
+        m_output.push_back(val ? TOKEN_TRUE : TOKEN_FALSE);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool number_integer(NumberIntegerT val) // NOLINT
+    {
+        // Zigzag, so the small negative values have short encodings too.
+        const auto zigzag {(static_cast<uint64_t>(val) << 1) ^ static_cast<uint64_t>(val >> 63)};
+        if (val >= -16 && val <= 15)
+        {
+            token(static_cast<uint8_t>(TOKEN_SMALL_INT + zigzag));
+        }
+        else
+        {
+            m_output.push_back(val >= INT32_MIN && val <= INT32_MAX ? TOKEN_INT32 : TOKEN_INT64);
+            vint(zigzag);
+        }
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool number_unsigned(NumberUnsignedT val) // NOLINT
+    {
+        if (val <= static_cast<NumberUnsignedT>(INT64_MAX))
+        {
+            return number_integer(static_cast<NumberIntegerT>(val));
+        }
+
+        // Beyond the signed range only a big integer holds it: its two's complement bytes, a leading zero first.
+        uint8_t bytes[9] {0};
+        for (auto i = 8; i > 0; --i)
+        {
+            bytes[i] = static_cast<uint8_t>(val & 0xFF);
+            val >>= 8;
+        }
+        m_output.push_back(TOKEN_BIG_INTEGER);
+        vint(sizeof(bytes));
+        sevenBits(bytes, sizeof(bytes));
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool number_float(NumberFloatT val, [[maybe_unused]] const StringT& s) // NOLINT
+    {
+        uint64_t bits;
+        std::memcpy(&bits, &val, sizeof(bits));
+
+        // The 64 bits in ten groups of 7, the first one holds the sign.
+        m_output.push_back(TOKEN_FLOAT64);
+        for (auto shift = 63; shift >= 0; shift -= 7)
+        {
+            token(static_cast<uint8_t>((bits >> shift) & 0x7F));
+        }
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool string(std::string_view val)
+    {
+        const auto size {val.size()};
+        if (size == 0)
+        {
+            m_output.push_back(TOKEN_EMPTY_STRING);
+            return true;
+        }
+
+        const auto ascii {isAscii(val)};
+        if (ascii && size <= 32)
+        {
+            token(static_cast<uint8_t>(TOKEN_TINY_ASCII + size - 1));
+        }
+        else if (ascii && size <= 64)
+        {
+            token(static_cast<uint8_t>(TOKEN_SHORT_ASCII + size - 33));
+        }
+        else if (!ascii && size >= 2 && size <= 33)
+        {
+            token(static_cast<uint8_t>(TOKEN_TINY_UNICODE + size - 2));
+        }
+        else if (!ascii && size >= 34 && size <= 65)
+        {
+            token(static_cast<uint8_t>(TOKEN_SHORT_UNICODE + size - 34));
+        }
+        else
+        {
+            m_output.push_back(ascii ? TOKEN_LONG_ASCII : TOKEN_LONG_UNICODE);
+            m_output.append(val);
+            m_output.push_back(END_OF_STRING);
+            return true;
+        }
+        m_output.append(val);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool binary([[maybe_unused]] BinaryT& val)
+    {
+        throw std::runtime_error("Binary values are not supported by the Smile writer");
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool key(std::string_view val)
+    {
+        const auto size {val.size()};
+        if (size == 0)
+        {
+            m_output.push_back(KEY_EMPTY);
+            return true;
+        }
+
+        const auto ascii {isAscii(val)};
+        if (ascii && size <= 64)
+        {
+            token(static_cast<uint8_t>(KEY_SHORT_ASCII + size - 1));
+        }
+        else if (!ascii && size >= 2 && size <= 57)
+        {
+            token(static_cast<uint8_t>(KEY_SHORT_UNICODE + size - 2));
+        }
+        else
+        {
+            m_output.push_back(KEY_LONG_UNICODE);
+            m_output.append(val);
+            m_output.push_back(END_OF_STRING);
+            return true;
+        }
+        m_output.append(val);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool start_object([[maybe_unused]] std::size_t len) // NOLINT
+    {
+        m_output.push_back(TOKEN_START_OBJECT);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool end_object() // NOLINT
+    {
+        m_output.push_back(TOKEN_END_OBJECT);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool start_array([[maybe_unused]] std::size_t len) // NOLINT
+    {
+        m_output.push_back(TOKEN_START_ARRAY);
+        return true;
+    }
+
+    // cppcheck-suppress unusedFunction
+    bool end_array() // NOLINT
+    {
+        m_output.push_back(TOKEN_END_ARRAY);
+        return true;
+    }
+
+    /**
+     * @brief Processes a parse error. Throws the received exception object.
+     *
+     * @tparam Exception
+     */
+    template<class Exception>
+    bool parse_error(std::size_t /*unused*/, const std::string& /*unused*/, const Exception& ex) // NOLINT
+    {
+        throw ex;
+    }
+};
+
+#endif // _SMILE_WRITER_HPP
@@ -15,6 +15,7 @@
 #include "json.hpp"
 #include "stringHelper.h"
 #include "gtest/gtest.h"
+#include <atomic>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
@@ -473,3 +474,48 @@ TEST_F(IndexerConnectorTest, UpperCaseCharactersIndexName)
     indexerConfig["hosts"] = nlohmann::json::array({A_ADDRESS});
     EXPECT_THROW(IndexerConnector(indexerConfig, logFunction, INDEXER_TIMEOUT), std::runtime_error);
 }
+
+/**
+ * @brief Test the publication without waiting for the refresh, using several working threads.
+ *
+ */
+TEST_F(IndexerConnectorTest, PublishWithoutRefresh)
+{
+    constexpr auto INDEX_DATA {"content"};
+    std::atomic<bool> callbackCalled {false};
+    const auto checkPublishedData {[&callbackCalled, &INDEX_DATA](const std::string& data)
+                                   {
+                                       const auto splitData {Utils::split(data, '\n')};
+                                       ASSERT_EQ(nlohmann::json::parse(splitData.back()), INDEX_DATA);
+                                       callbackCalled = true;
+                                   }};
+    m_indexerServers[A_IDX]->setPublishCallback(checkPublishedData);
+
+    // Create connector and wait until the connection is established.
+    nlohmann::json indexerConfig;
+    indexerConfig["name"] = INDEXER_NAME;
+    indexerConfig["hosts"] = nlohmann::json::array({A_ADDRESS});
+    indexerConfig["refresh"] = "false";
+    auto indexerConnector {IndexerConnector(indexerConfig, logFunction, INDEXER_TIMEOUT, 2)};
+
+    // Publish content and wait until the publication finishes.
+    nlohmann::json publishData;
+    publishData["id"] = INDEX_ID_A;
+    publishData["operation"] = "INSERT";
+    publishData["data"] = INDEX_DATA;
+    ASSERT_NO_THROW(indexerConnector.publish(publishData.dump()));
+    ASSERT_NO_THROW(waitUntil([&callbackCalled]() { return callbackCalled.load(); }, MAX_INDEXER_PUBLISH_TIME_MS));
+}
+
+/**
+ * @brief Test the initialization with an invalid refresh policy.
+ *
+ */
+TEST_F(IndexerConnectorTest, InvalidRefreshPolicy)
+{
+    nlohmann::json indexerConfig;
+    indexerConfig["name"] = INDEXER_NAME;
+    indexerConfig["hosts"] = nlohmann::json::array({A_ADDRESS});
+    indexerConfig["refresh"] = "always";
+    EXPECT_THROW(IndexerConnector(indexerConfig, logFunction, INDEXER_TIMEOUT), std::runtime_error);
+}
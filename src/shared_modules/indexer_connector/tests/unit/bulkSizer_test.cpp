@@ -0,0 +1,60 @@
+/*
+ * Wazuh Indexer Connector - BulkSizer tests
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "bulkSizer_test.hpp"
+#include "bulkSizer.hpp"
+#include <chrono>
+#include <stdexcept>
+
+using namespace std::chrono_literals;
+
+/**
+ * @brief Test instantiation with invalid limits.
+ *
+ */
+TEST_F(BulkSizerTest, TestInvalidLimits)
+{
+    EXPECT_THROW(BulkSizer(100ms, 10, 0, 100), std::invalid_argument);
+    EXPECT_THROW(BulkSizer(100ms, 10, 200, 100), std::invalid_argument);
+    EXPECT_EQ(BulkSizer(100ms, 1000, 10, 100).elements(), 100U);
+}
+
+/**
+ * @brief Test the size grows with fast and full bulks, up to the maximum.
+ *
+ */
+TEST_F(BulkSizerTest, TestGrowsWithFastBulks)
+{
+    BulkSizer sizer(100ms, 100, 10, 200);
+
+    EXPECT_EQ(sizer.success(100, 10ms), 125U);
+    // A partial bulk doesn't grow the size.
+    EXPECT_EQ(sizer.success(50, 10ms), 125U);
+
+    for (auto i = 0; i < 10; ++i)
+    {
+        sizer.success(sizer.elements(), 10ms);
+    }
+    EXPECT_EQ(sizer.elements(), 200U);
+}
+
+/**
+ * @brief Test the size is halved with slow or failed bulks, down to the minimum.
+ *
+ */
+TEST_F(BulkSizerTest, TestShrinksWithSlowBulks)
+{
+    BulkSizer sizer(100ms, 100, 10, 200);
+
+    EXPECT_EQ(sizer.success(100, 500ms), 50U);
+    EXPECT_EQ(sizer.failure(), 25U);
+    EXPECT_EQ(sizer.failure(), 12U);
+    EXPECT_EQ(sizer.failure(), 10U);
+}
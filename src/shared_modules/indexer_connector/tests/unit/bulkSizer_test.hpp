@@ -0,0 +1,26 @@
+/*
+ * Wazuh Indexer Connector - BulkSizer tests
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _BULK_SIZER_TEST_HPP
+#define _BULK_SIZER_TEST_HPP
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief Runs unit tests for BulkSizer class
+ */
+class BulkSizerTest : public ::testing::Test
+{
+protected:
+    BulkSizerTest() = default;
+    ~BulkSizerTest() override = default;
+};
+
+#endif // _BULK_SIZER_TEST_HPP
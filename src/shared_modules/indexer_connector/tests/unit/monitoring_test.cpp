@@ -106,3 +106,33 @@ TEST_F(MonitoringTest, TestCheckIfAnUnregisteredServerIsAvailable)
     // It throws an exception because this is an unregistered server
     EXPECT_THROW(m_monitoring->isAvailable(unregisteredServer), std::out_of_range);
 }
+
+/**
+ * @brief Test the failed requests reported for a server make it unavailable.
+ *
+ */
+TEST_F(MonitoringTest, TestReportedFailures)
+{
+    const auto hostGreenServer {m_servers.at(0)};
+
+    EXPECT_NO_THROW(m_monitoring = std::make_shared<Monitoring>(m_servers, MONITORING_HEALTH_CHECK_INTERVAL));
+
+    // Errors caused by the request don't count.
+    for (auto i = 0u; i < MAX_CONSECUTIVE_FAILURES; ++i)
+    {
+        m_monitoring->reportFailure(hostGreenServer, 400);
+    }
+    EXPECT_TRUE(m_monitoring->isAvailable(hostGreenServer));
+
+    // A success resets the failures.
+    m_monitoring->reportFailure(hostGreenServer, 429);
+    m_monitoring->reportSuccess(hostGreenServer, std::chrono::milliseconds(5));
+    for (auto i = 1u; i < MAX_CONSECUTIVE_FAILURES; ++i)
+    {
+        m_monitoring->reportFailure(hostGreenServer, 500);
+    }
+    EXPECT_TRUE(m_monitoring->isAvailable(hostGreenServer));
+
+    m_monitoring->reportFailure(hostGreenServer, 0);
+    EXPECT_FALSE(m_monitoring->isAvailable(hostGreenServer));
+}
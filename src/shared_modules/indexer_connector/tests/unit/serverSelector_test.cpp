@@ -12,6 +12,7 @@
 #include "serverSelector_test.hpp"
 #include "serverSelector.hpp"
 #include <chrono>
+#include <map>
 #include <memory>
 #include <string>
 #include <thread>
@@ -120,3 +121,51 @@ TEST_F(ServerSelectorTest, TestGextNextWhenThereAreNoAvailableServers)
     // It throws an exception because there are no available servers
     EXPECT_THROW(nextServer = m_selector->getNext(), std::runtime_error);
 }
+
+/**
+ * @brief Test getNext selects the servers in proportion to the inverse of their latency.
+ *
+ */
+TEST_F(ServerSelectorTest, TestGetNextWeightedByLatency)
+{
+    const auto hostGreenServer {m_servers.at(0)};
+    const auto hostRedServer {m_servers.at(1)};
+
+    EXPECT_NO_THROW(m_selector = std::make_shared<ServerSelector>(m_servers, SERVER_SELECTOR_HEALTH_CHECK_INTERVAL));
+
+    // The red server becomes three times slower than the green one.
+    for (auto i = 0; i < 50; ++i)
+    {
+        m_selector->reportSuccess(hostGreenServer, std::chrono::milliseconds(10));
+        m_selector->reportSuccess(hostRedServer, std::chrono::milliseconds(30));
+    }
+
+    std::map<std::string, int> selections;
+    for (auto i = 0; i < 400; ++i)
+    {
+        ++selections[m_selector->getNext()];
+    }
+
+    EXPECT_NEAR(selections[hostGreenServer], 300, 10);
+    EXPECT_NEAR(selections[hostRedServer], 100, 10);
+}
+
+/**
+ * @brief Test getNext skips a server whose last requests failed.
+ *
+ */
+TEST_F(ServerSelectorTest, TestGetNextSkipsFailingServer)
+{
+    const auto hostGreenServer {m_servers.at(0)};
+    const auto hostRedServer {m_servers.at(1)};
+
+    EXPECT_NO_THROW(m_selector = std::make_shared<ServerSelector>(m_servers, SERVER_SELECTOR_HEALTH_CHECK_INTERVAL));
+
+    for (auto i = 0u; i < MAX_CONSECUTIVE_FAILURES; ++i)
+    {
+        m_selector->reportFailure(hostRedServer, 503);
+    }
+
+    EXPECT_EQ(m_selector->getNext(), hostGreenServer);
+    EXPECT_EQ(m_selector->getNext(), hostGreenServer);
+}
@@ -0,0 +1,81 @@
+/*
+ * Wazuh Indexer Connector - SmileWriter tests
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "smileWriter_test.hpp"
+#include "smileWriter.hpp"
+#include <string>
+
+using namespace std::string_literals;
+
+static const auto HEADER {":)\n\x00"s};
+
+/**
+ * @brief Test the scalar values and the object names.
+ *
+ */
+TEST_F(SmileWriterTest, TestScalars)
+{
+    std::string output;
+    SmileWriter::append(output, R"({"a":null,"bc":[true,false,"",0,-1,15,-17]})");
+
+    EXPECT_EQ(output,
+              HEADER + "\xFA\x80"
+                       "a\x21\x81"
+                       "bc\xF8\x23\x22\x20\xC0\xC1\xDE\x24\xA1\xF9\xFB\xFF"s);
+}
+
+/**
+ * @brief Test the short and long strings, in ASCII and in Unicode.
+ *
+ */
+TEST_F(SmileWriterTest, TestStrings)
+{
+    std::string output;
+    SmileWriter::append(output, R"(["abc","hé"])");
+    EXPECT_EQ(output, HEADER + "\xF8\x42"
+                               "abc\x81h\xC3\xA9\xF9\xFF"s);
+
+    const std::string longText(100, 'x');
+    output.clear();
+    SmileWriter::append(output, "\"" + longText + "\"");
+    EXPECT_EQ(output, HEADER + "\xE0" + longText + "\xFC\xFF");
+}
+
+/**
+ * @brief Test the numbers that don't fit in a small integer.
+ *
+ */
+TEST_F(SmileWriterTest, TestNumbers)
+{
+    std::string output;
+    SmileWriter::append(output, "[3000000000,18446744073709551615,1.5]");
+
+    EXPECT_EQ(output,
+              HEADER + "\xF8"
+                       // Zigzag 6000000000, in a variable length integer.
+                       "\x25\x2C\x5A\x05\x70\x80"
+                       // Nine bytes of big integer, 00 and FF x 8, in groups of 7 bits.
+                       "\x26\x89\x00\x3F\x7F\x7F\x7F\x7F\x7F\x7F\x7F\x7F\x03"
+                       // 0x3FF8000000000000 in groups of 7 bits.
+                       "\x29\x00\x3F\x7C\x00\x00\x00\x00\x00\x00\x00"
+                       "\xF9\xFF"s);
+}
+
+/**
+ * @brief Test an invalid text leaves the output as it was.
+ *
+ */
+TEST_F(SmileWriterTest, TestInvalidJson)
+{
+    std::string output {"previous"};
+
+    EXPECT_THROW(SmileWriter::append(output, R"({"a":)"), nlohmann::json::parse_error);
+    EXPECT_EQ(output, "previous");
+}
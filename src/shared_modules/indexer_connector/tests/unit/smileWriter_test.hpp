@@ -0,0 +1,26 @@
+/*
+ * Wazuh Indexer Connector - SmileWriter tests
+ * Copyright (C) 2015, Wazuh Inc.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SMILE_WRITER_TEST_HPP
+#define _SMILE_WRITER_TEST_HPP
+
+#include <gtest/gtest.h>
+
+/**
+ * @brief Runs unit tests for SmileWriter class
+ */
+class SmileWriterTest : public ::testing::Test
+{
+protected:
+    SmileWriterTest() = default;
+    ~SmileWriterTest() override = default;
+};
+
+#endif // _SMILE_WRITER_TEST_HPP
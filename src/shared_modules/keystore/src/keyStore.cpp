@@ -3,6 +3,15 @@
 #include "loggerHelper.h"
 #include "rocksDBWrapper.hpp"
 #include "rsaHelper.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <openssl/crypto.h>
+#include <optional>
+#include <sys/mman.h>
+#include <utility>
 
 // Database constants, based on the keystore path.
 constexpr auto DATABASE_PATH {"queue/keystore"};
@@ -18,6 +27,73 @@ constexpr auto KS_NAME {"keystore"};
 constexpr auto KS_VERSION {"2"};
 constexpr auto KS_VERSION_FIELD {"version"};
 
+/**
+ * @brief Decrypted value kept in memory locked out of swap, zeroed when freed.
+ */
+class SecureValue final
+{
+    std::unique_ptr<char[]> m_data;
+    size_t m_size;
+    bool m_locked;
+
+public:
+    explicit SecureValue(const std::string& value)
+        : m_data {std::make_unique<char[]>(std::max<size_t>(value.size(), 1))}
+        , m_size {value.size()}
+    {
+        value.copy(m_data.get(), m_size);
+        // Best effort, the memory lock limit may be reached.
+        m_locked = ::mlock(m_data.get(), std::max<size_t>(m_size, 1)) == 0;
+    }
+
+    SecureValue(const SecureValue&) = delete;
+    SecureValue& operator=(const SecureValue&) = delete;
+
+    ~SecureValue()
+    {
+        OPENSSL_cleanse(m_data.get(), m_size);
+        if (m_locked)
+        {
+            ::munlock(m_data.get(), std::max<size_t>(m_size, 1));
+        }
+    }
+
+    std::string str() const
+    {
+        return {m_data.get(), m_size};
+    }
+};
+
+/**
+ * @brief Decrypted values of the keystore, valid while the database is not modified.
+ *
+ * The database is written by other processes too (the keystore tool), so the values are dropped when the modification
+ * time of the database directory changes, besides on every put.
+ */
+struct ValuesCache final
+{
+    std::mutex mutex;
+    std::optional<std::filesystem::file_time_type> stamp;
+    std::map<std::pair<std::string, std::string>, std::unique_ptr<SecureValue>, std::less<>> values;
+};
+
+static ValuesCache& valuesCache()
+{
+    static ValuesCache cache;
+    return cache;
+}
+
+static std::optional<std::filesystem::file_time_type> databaseStamp()
+{
+    std::error_code error;
+    const auto stamp = std::filesystem::last_write_time(DATABASE_PATH, error);
+    if (error)
+    {
+        return std::nullopt;
+    }
+    return stamp;
+}
+
 static void upgrade(Utils::RocksDBWrapper& keystoreDB, const std::string& columnFamily)
 {
     std::string versionValue;
@@ -86,6 +162,13 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
 
     EVPHelper().encryptAES256(value, encryptedValue);
 
+    auto& cache = valuesCache();
+    std::scoped_lock lock {cache.mutex};
+
+    // The upgrade may delete the values of the column, all the cached values are dropped.
+    cache.values.clear();
+    cache.stamp.reset();
+
     auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
 
     if (!keystoreDB.columnExists(columnFamily))
@@ -111,22 +194,55 @@ void Keystore::put(const std::string& columnFamily, const std::string& key, cons
  */
 void Keystore::get(const std::string& columnFamily, const std::string& key, std::string& value)
 {
-    std::string encryptedValue;
+    auto& cache = valuesCache();
+    std::scoped_lock lock {cache.mutex};
 
-    auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
+    if (const auto stamp = databaseStamp(); stamp.has_value() && stamp == cache.stamp)
+    {
+        if (const auto it = cache.values.find(std::make_pair(columnFamily, key)); it != cache.values.end())
+        {
+            value = it->second->str();
+            return;
+        }
+    }
 
-    if (!keystoreDB.columnExists(columnFamily))
+    std::string decryptedValue;
+    bool found = false;
     {
-        keystoreDB.createColumn(columnFamily);
+        std::string encryptedValue;
+
+        auto keystoreDB = Utils::RocksDBWrapper(DATABASE_PATH, false);
+
+        if (!keystoreDB.columnExists(columnFamily))
+        {
+            keystoreDB.createColumn(columnFamily);
+        }
+
+        // Upgrade the keystore if necessary and get the key-value pair, to get all keys encrypted with the same
+        // algorithm.
+        upgrade(keystoreDB, columnFamily);
+
+        // Get the key-value pair using AES decryption.
+        if (keystoreDB.get(key, encryptedValue, columnFamily))
+        {
+            std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
+            EVPHelper().decryptAES256(encryptedValueVec, decryptedValue);
+            OPENSSL_cleanse(encryptedValueVec.data(), encryptedValueVec.size());
+            found = true;
+        }
     }
 
-    // Upgrade the keystore if necessary and get the key-value pair, to get all keys encrypted with the same algorithm.
-    upgrade(keystoreDB, columnFamily);
+    // Stamped once the database is closed, opening it modifies its directory.
+    if (const auto stamp = databaseStamp(); stamp != cache.stamp)
+    {
+        cache.values.clear();
+        cache.stamp = stamp;
+    }
 
-    // Get the key-value pair using AES decryption.
-    if (keystoreDB.get(key, encryptedValue, columnFamily))
+    if (found)
     {
-        std::vector<char> encryptedValueVec(encryptedValue.begin(), encryptedValue.end());
-        EVPHelper().decryptAES256(encryptedValueVec, value);
+        cache.values.insert_or_assign(std::make_pair(columnFamily, key), std::make_unique<SecureValue>(decryptedValue));
+        value = decryptedValue;
+        OPENSSL_cleanse(decryptedValue.data(), decryptedValue.size());
     }
 }
@@ -198,3 +198,26 @@ TEST(KeyStoreComponentTest, TestUpgradeFailWithInvalidCerts)
     Keystore::get("default", "key2", out);
     ASSERT_EQ(out, "value2");
 }
+
+TEST(KeyStoreComponentTest, TestGetCachedAfterPut)
+{
+    std::filesystem::remove_all(DATABASE_PATH);
+
+    std::string out;
+    Keystore::put("default", "key1", "value1");
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value1");
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value1");
+
+    // A put drops the cached values
+    Keystore::put("default", "key1", "value2");
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "value2");
+
+    // A write of another process drops them too
+    std::filesystem::remove_all(DATABASE_PATH);
+    out = "";
+    Keystore::get("default", "key1", out);
+    ASSERT_EQ(out, "");
+}
@@ -53,3 +53,25 @@ static void frontBenchmark(benchmark::State& state)
 }
 
 BENCHMARK(frontBenchmark);
+
+static void bulkBenchmark(benchmark::State& state)
+{
+    std::error_code ec;
+    std::filesystem::remove_all(TEST_DB, ec);
+
+    RocksDBQueue<std::string> queue(TEST_DB);
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        for (int i = 0; i < 1000; i++)
+        {
+            queue.push("test");
+        }
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(queue.getBulk(1000));
+        queue.popBulk(1000);
+    }
+}
+
+BENCHMARK(bulkBenchmark);
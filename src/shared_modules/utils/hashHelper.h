@@ -19,6 +19,9 @@
 #include <fstream>
 #include <array>
 #include <string>
+#ifndef WIN32
+#include "mappedFile.hpp"
+#endif
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
@@ -139,6 +142,23 @@ namespace Utils
      */
     static std::vector<unsigned char> hashFile(const std::string& filepath)
     {
+#ifndef WIN32
+        // The file is hashed straight from the page cache.
+        std::unique_ptr<MappedFile> spFile;
+
+        try
+        {
+            spFile = std::make_unique<MappedFile>(filepath);
+        }
+        catch (const std::runtime_error&)
+        {
+            throw std::runtime_error {"Unable to open '" + filepath + "' for hashing."};
+        }
+
+        HashData hash;
+        hash.update(spFile->data(), spFile->size());
+        return hash.hash();
+#else
         std::ifstream inputFile(filepath, std::fstream::in);
         if (inputFile.good())
         {
@@ -156,6 +176,7 @@ namespace Utils
         }
 
         throw std::runtime_error {"Unable to open '" + filepath + "' for hashing."};
+#endif
     };
 } // namespace Utils
 
@@ -13,10 +13,21 @@
 #define _JSON_ARRAY_PARSER_HPP
 
 #include "json.hpp"
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace JsonArray
 {
@@ -451,5 +462,445 @@ namespace JsonArray
         nlohmann::json::sax_parse(file, &arrayParser);
     }
 
+    /**
+     * @brief Cuts the items of the target array of a JSON text into raw byte ranges, without parsing them.
+     * @details The text is fed in chunks of any size. Only its structure is tracked: the strings, the nesting and the
+     * keys and indexes leading to the target array, so cutting is much cheaper than parsing the items. The items are
+     * not validated, an invalid one only fails when it is parsed. The body is the text outside the target array items,
+     * so the original JSON with an empty target array.
+     */
+    class JsonArrayCutter final
+    {
+    public:
+        /**
+         * @brief Construct a new Json Array Cutter object
+         *
+         * @param targetArrayPointer JSON Pointer to the target array.
+         * @param itemCallback Callback invoked with the text of every item found on the target array. If the callback
+         * returns false the cutting stops.
+         */
+        JsonArrayCutter(const nlohmann::json::json_pointer& targetArrayPointer,
+                        std::function<bool(std::string&&)> itemCallback)
+            : m_itemCallback(std::move(itemCallback))
+        {
+            const auto pointer {targetArrayPointer.to_string()};
+            for (size_t start = 0; start < pointer.size();)
+            {
+                // Every reference token starts with a slash, "~1" and "~0" are the escaped slash and tilde.
+                const auto end {std::min(pointer.find('/', start + 1), pointer.size())};
+                auto token {pointer.substr(start + 1, end - start - 1)};
+                for (size_t pos = 0; (pos = token.find('~', pos)) != std::string::npos; ++pos)
+                {
+                    token.replace(pos, 2, token.compare(pos, 2, "~1") == 0 ? "/" : "~");
+                }
+                m_targetTokens.push_back(std::move(token));
+                start = end;
+            }
+        }
+
+        /**
+         * @brief Processes the next chunk of the text.
+         *
+         * @param data Chunk.
+         * @param size Chunk size.
+         * @return true Continue cutting.
+         * @return false The item callback stopped the cutting.
+         */
+        bool feed(const char* data, const size_t size)
+        {
+            for (size_t i = 0; i < size && m_continue; ++i)
+            {
+                process(data[i]);
+            }
+            return m_continue;
+        }
+
+        /**
+         * @brief Gets the body once the whole text was fed.
+         *
+         * @return std::string Text outside the target array items.
+         * @throw std::runtime_error If the target array was not found.
+         */
+        std::string takeBody()
+        {
+            if (!m_targetArrayExists)
+            {
+                throw std::runtime_error {"The target array does not exist."};
+            }
+            return std::move(m_body);
+        }
+
+    private:
+        /**
+         * @brief Container the text is in.
+         */
+        struct Frame final
+        {
+            bool isObject;   ///< Object or array.
+            bool expectKey;  ///< The next string of an object is a key.
+            size_t index;    ///< Index of the current element of an array.
+            std::string key; ///< Key of the current member of an object.
+        };
+
+        void process(const char c)
+        {
+            if (!m_inTargetArray)
+            {
+                m_body.push_back(c);
+            }
+            else if (m_frames.size() > m_targetDepth || m_inString || !isSeparator(c))
+            {
+                m_item.push_back(c);
+            }
+
+            if (m_inString)
+            {
+                processString(c);
+                return;
+            }
+
+            switch (c)
+            {
+                case '"':
+                    m_inString = true;
+                    m_inKey = !m_frames.empty() && m_frames.back().isObject && m_frames.back().expectKey;
+                    m_key.clear();
+                    m_keyEscaped = false;
+                    break;
+                case '{':
+                case '[': open(c == '{'); break;
+                case '}':
+                case ']': close(); break;
+                case ',':
+                    if (m_inTargetArray && m_frames.size() == m_targetDepth)
+                    {
+                        emitItem();
+                    }
+                    if (!m_frames.empty())
+                    {
+                        m_frames.back().expectKey = m_frames.back().isObject;
+                        ++m_frames.back().index;
+                    }
+                    break;
+                default: break;
+            }
+        }
+
+        void processString(const char c)
+        {
+            if (m_escaped)
+            {
+                m_escaped = false;
+            }
+            else if (c == '\\')
+            {
+                m_escaped = true;
+                m_keyEscaped = true;
+            }
+            else if (c == '"')
+            {
+                m_inString = false;
+                if (m_inKey)
+                {
+                    // A key with escape sequences is compared once unescaped.
+                    m_frames.back().key = m_keyEscaped ? nlohmann::json::parse('"' + m_key + '"').get<std::string>()
+                                                       : std::move(m_key);
+                    m_frames.back().expectKey = false;
+                    m_inKey = false;
+                }
+                return;
+            }
+
+            if (m_inKey)
+            {
+                m_key.push_back(c);
+            }
+        }
+
+        void open(const bool isObject)
+        {
+            if (!m_inTargetArray && !isObject && !m_targetArrayExists && isTargetPath())
+            {
+                m_inTargetArray = true;
+                m_targetArrayExists = true;
+                m_targetDepth = m_frames.size() + 1;
+            }
+            m_frames.push_back({isObject, isObject, 0, {}});
+        }
+
+        void close()
+        {
+            if (m_inTargetArray && m_frames.size() == m_targetDepth)
+            {
+                // The end of the target array, the text of its last item ends here.
+                if (!m_item.empty())
+                {
+                    emitItem();
+                }
+                m_inTargetArray = false;
+                m_body.push_back(']');
+            }
+            if (!m_frames.empty())
+            {
+                m_frames.pop_back();
+            }
+        }
+
+        void emitItem()
+        {
+            m_continue = m_itemCallback(std::move(m_item));
+            m_item.clear();
+        }
+
+        /**
+         * @brief Checks if the value being opened is the one the target pointer refers to.
+         */
+        bool isTargetPath() const
+        {
+            if (m_frames.size() != m_targetTokens.size())
+            {
+                return false;
+            }
+            for (size_t i = 0; i < m_frames.size(); ++i)
+            {
+                const auto& frame {m_frames[i]};
+                if (frame.isObject ? frame.key != m_targetTokens[i]
+                                   : std::to_string(frame.index) != m_targetTokens[i])
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Characters between the items of the target array: the commas, the whitespace and its closing bracket.
+         */
+        static bool isSeparator(const char c)
+        {
+            return c == ',' || c == ']' || std::isspace(static_cast<unsigned char>(c));
+        }
+
+        std::function<bool(std::string&&)> m_itemCallback;
+        std::vector<std::string> m_targetTokens;
+        std::vector<Frame> m_frames;
+        std::string m_body;
+        std::string m_item;
+        std::string m_key;
+        size_t m_targetDepth {0};
+        bool m_inTargetArray {false};
+        bool m_targetArrayExists {false};
+        bool m_inString {false};
+        bool m_inKey {false};
+        bool m_escaped {false};
+        bool m_keyEscaped {false};
+        bool m_continue {true};
+    };
+
+    /// Size of the chunks the file is read in by the parallel parser.
+    constexpr size_t PARALLEL_PARSE_CHUNK_SIZE {1 << 20};
+
+    /**
+     * @brief Parses a JSON file on a pool of threads and invokes a callback for each item of the target array, in the
+     * order of the file.
+     * @details The calling thread reads the file and cuts the items of the target array into their raw text (see
+     * JsonArrayCutter). The workers parse the items and convert them with \p transformItemCallback, concurrently. The
+     * converted items are handed to \p processItemCallback one at a time, in the order of the file, so the output is
+     * the same as with a serial parse. At most \p maxPendingItems items are held between the reader and
+     * \p processItemCallback. An error in any of them stops the parsing, and it is rethrown once the workers are done.
+     *
+     * @tparam T Type the items are converted to.
+     * @param filepath Path to the JSON file.
+     * @param transformItemCallback Callback invoked by the workers to convert every parsed item, e.g. into its
+     * FlatBuffers encoding.
+     * @param processItemCallback Callback invoked for every converted item, with its id. If the callback returns false
+     * the parsing stops.
+     * @param arrayPointer JSON Pointer to the target array.
+     * @param threads Amount of worker threads.
+     * @param processBodyCallback Callback invoked at the end of the parsing with the body of the JSON object, as in
+     * parse().
+     * @param maxPendingItems Maximum amount of items cut and not yet processed.
+     */
+    template<typename T>
+    static void parallelParse(
+        const std::filesystem::path& filepath,
+        std::function<T(nlohmann::json&&)> transformItemCallback,
+        std::function<bool(T&&, const size_t)> processItemCallback,
+        const nlohmann::json::json_pointer& arrayPointer = nlohmann::json::json_pointer(),
+        size_t threads = std::thread::hardware_concurrency(),
+        std::function<void(nlohmann::json&&)> processBodyCallback = [](nlohmann::json&&) {},
+        size_t maxPendingItems = 1024)
+    {
+        std::ifstream file(filepath, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error("Unable to open input file: " + filepath.string());
+        }
+
+        threads = std::max<size_t>(threads, 1);
+        maxPendingItems = std::max(maxPendingItems, threads);
+
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable roomAvailable;
+        std::deque<std::pair<size_t, std::string>> pending;
+        std::map<size_t, T> converted;
+        size_t nextItemId {1};
+        size_t nextProcessedId {1};
+        bool processing {false};
+        bool readDone {false};
+        bool stop {false};
+        std::exception_ptr error;
+
+        // Called with the lock held.
+        const auto fail = [&](std::exception_ptr exception)
+        {
+            if (!error)
+            {
+                error = std::move(exception);
+            }
+            stop = true;
+            workAvailable.notify_all();
+            roomAvailable.notify_all();
+        };
+
+        auto worker = [&]()
+        {
+            std::unique_lock lock(mutex);
+            while (true)
+            {
+                workAvailable.wait(lock, [&]() { return stop || readDone || !pending.empty(); });
+                if (stop || pending.empty())
+                {
+                    return;
+                }
+                auto [itemId, text] = std::move(pending.front());
+                pending.pop_front();
+                lock.unlock();
+
+                std::optional<T> item;
+                try
+                {
+                    item.emplace(transformItemCallback(nlohmann::json::parse(text)));
+                }
+                catch (...)
+                {
+                    lock.lock();
+                    fail(std::current_exception());
+                    return;
+                }
+
+                lock.lock();
+                converted.emplace(itemId, std::move(*item));
+
+                // Only one worker hands the items over at a time, and only the next one in order.
+                if (processing)
+                {
+                    continue;
+                }
+                processing = true;
+                while (!stop && !converted.empty() && converted.begin()->first == nextProcessedId)
+                {
+                    auto node = converted.extract(converted.begin());
+                    lock.unlock();
+
+                    bool keepParsing {false};
+                    try
+                    {
+                        keepParsing = processItemCallback(std::move(node.mapped()), node.key());
+                    }
+                    catch (...)
+                    {
+                        lock.lock();
+                        processing = false;
+                        fail(std::current_exception());
+                        return;
+                    }
+
+                    lock.lock();
+                    ++nextProcessedId;
+                    if (!keepParsing)
+                    {
+                        stop = true;
+                        workAvailable.notify_all();
+                    }
+                    roomAvailable.notify_all();
+                }
+                processing = false;
+            }
+        };
+
+        std::vector<std::thread> workers;
+        const auto finish = [&]()
+        {
+            {
+                std::scoped_lock lock(mutex);
+                readDone = true;
+            }
+            workAvailable.notify_all();
+            for (auto& thread : workers)
+            {
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
+            }
+        };
+
+        try
+        {
+            for (size_t i = 0; i < threads; ++i)
+            {
+                workers.emplace_back(worker);
+            }
+
+            // The reader waits while too many items are pending, so a slow consumer bounds the memory.
+            auto cutItem = [&](std::string&& text)
+            {
+                std::unique_lock lock(mutex);
+                roomAvailable.wait(lock, [&]() { return stop || nextItemId - nextProcessedId < maxPendingItems; });
+                if (stop)
+                {
+                    return false;
+                }
+                pending.emplace_back(nextItemId++, std::move(text));
+                workAvailable.notify_one();
+                return true;
+            };
+            JsonArrayCutter cutter(arrayPointer, cutItem);
+
+            std::vector<char> buffer(PARALLEL_PARSE_CHUNK_SIZE);
+            while (file.read(buffer.data(), static_cast<std::streamsize>(buffer.size())) || file.gcount() > 0)
+            {
+                if (!cutter.feed(buffer.data(), static_cast<size_t>(file.gcount())))
+                {
+                    break;
+                }
+            }
+            finish();
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
+            if (stop)
+            {
+                // The item callback stopped the parsing.
+                return;
+            }
+            processBodyCallback(nlohmann::json::parse(cutter.takeBody()));
+        }
+        catch (...)
+        {
+            {
+                std::scoped_lock lock(mutex);
+                stop = true;
+            }
+            roomAvailable.notify_all();
+            finish();
+            throw;
+        }
+    }
+
 } // namespace JsonArray
 #endif // _JSON_ARRAY_PARSER_HPP
@@ -0,0 +1,122 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _MAPPED_FILE_HPP
+#define _MAPPED_FILE_HPP
+
+#include "uniqueFD.hpp"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <utility>
+
+namespace Utils
+{
+    /**
+     * @brief Read-only memory mapping of a whole file, unmapped on destruction.
+     *
+     * The file is read straight from the page cache, without copying it into a user buffer, and the kernel is told it
+     * is read sequentially so it reads ahead and drops the pages behind. An empty file has no mapping.
+     */
+    class MappedFile final
+    {
+    public:
+        /**
+         * @brief Maps a file.
+         *
+         * @param path Path of the file.
+         * @throw std::runtime_error if the file cannot be opened or mapped.
+         */
+        explicit MappedFile(const std::filesystem::path& path)
+        {
+            const UniqueFD fd {::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+            if (fd.get() == -1)
+            {
+                throw std::runtime_error {"Unable to open '" + path.string() + "': " + std::strerror(errno)};
+            }
+
+            struct stat fileStat {};
+
+            if (::fstat(fd.get(), &fileStat) == -1)
+            {
+                throw std::runtime_error {"Unable to stat '" + path.string() + "': " + std::strerror(errno)};
+            }
+
+            m_size = static_cast<size_t>(fileStat.st_size);
+            if (m_size == 0)
+            {
+                return;
+            }
+
+            auto data {::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd.get(), 0)};
+            if (data == MAP_FAILED)
+            {
+                throw std::runtime_error {"Unable to map '" + path.string() + "': " + std::strerror(errno)};
+            }
+
+            // The mapping keeps its own reference to the file, so the descriptor is closed here.
+            ::posix_madvise(data, m_size, POSIX_MADV_SEQUENTIAL);
+            m_data = static_cast<const uint8_t*>(data);
+        }
+
+        ~MappedFile()
+        {
+            if (m_data)
+            {
+                ::munmap(const_cast<uint8_t*>(m_data), m_size);
+            }
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        MappedFile(MappedFile&& other) noexcept
+            : m_data {std::exchange(other.m_data, nullptr)}
+            , m_size {std::exchange(other.m_size, 0)}
+        {
+        }
+
+        MappedFile& operator=(MappedFile&& other) noexcept
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            return *this;
+        }
+
+        /**
+         * @brief Gets the contents of the file, null if it is empty.
+         */
+        const uint8_t* data() const
+        {
+            return m_data;
+        }
+
+        /**
+         * @brief Gets the size of the file.
+         */
+        size_t size() const
+        {
+            return m_size;
+        }
+
+    private:
+        const uint8_t* m_data {nullptr};
+        size_t m_size {0};
+    };
+} // namespace Utils
+
+#endif // _MAPPED_FILE_HPP
@@ -12,7 +12,9 @@
 #ifndef _PACKET_HPP
 #define _PACKET_HPP
 
+#include <algorithm>
 #include <memory>
+#include <sys/uio.h>
 
 class Packet final
 {
@@ -24,6 +26,22 @@ public:
     {
         std::copy(data, data + size, this->data.get());
     }
+    Packet(const struct iovec* vectors, size_t count)
+        : size(0)
+        , offset(0)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            size += vectors[i].iov_len;
+        }
+
+        data = std::make_unique<char[]>(size + 1);
+        auto* position = data.get();
+        for (size_t i = 0; i < count; ++i)
+        {
+            position = std::copy_n(static_cast<const char*>(vectors[i].iov_base), vectors[i].iov_len, position);
+        }
+    }
     virtual ~Packet() = default;
     std::unique_ptr<char[]> data;
     uint32_t size;
@@ -12,7 +12,11 @@
 #ifndef _ROCKS_DB_OPTIONS_HPP
 #define _ROCKS_DB_OPTIONS_HPP
 
+#include "rocksDBResources.hpp"
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <rocksdb/db.h>
 #include <rocksdb/table.h>
 
@@ -24,15 +28,72 @@ namespace Utils
     constexpr auto ROCKSDB_MAX_OPEN_FILES = 256;
     constexpr auto ROCKSDB_NUM_LEVELS = 4;
     constexpr auto ROCKSDB_BLOCK_CACHE_SIZE = 16 * 1024 * 1024;
+    constexpr auto ROCKSDB_ZSTD_DICTIONARY_SIZE = 16 * 1024;
+    constexpr auto ROCKSDB_ZSTD_TRAINING_SIZE = 100 * ROCKSDB_ZSTD_DICTIONARY_SIZE;
+
+    /**
+     * @brief Compression of the data blocks of a database.
+     *
+     * The compression of each block is recorded with it, so a database written with a profile can be opened with
+     * another one, the blocks are rewritten with the new profile as they are compacted.
+     */
+    enum class CompressionProfile
+    {
+        DEFAULT,         ///< RocksDB default (snappy), fast but with a low ratio
+        BZIP2,           ///< High ratio, every block cache miss pays for a very slow decompression
+        ZSTD,            ///< Ratio close to bzip2, decompresses several times faster
+        ZSTD_DICTIONARY, ///< zstd with a dictionary trained on the blocks of each file, for many small similar records
+    };
+
+    /**
+     * @brief Get the compression profile of its name: "default", "bzip2", "zstd" or "zstd-dictionary".
+     *
+     * @throw std::invalid_argument if the name is unknown.
+     */
+    inline CompressionProfile compressionProfileFromString(std::string_view name)
+    {
+        if (name == "default")
+        {
+            return CompressionProfile::DEFAULT;
+        }
+        if (name == "bzip2")
+        {
+            return CompressionProfile::BZIP2;
+        }
+        if (name == "zstd")
+        {
+            return CompressionProfile::ZSTD;
+        }
+        if (name == "zstd-dictionary")
+        {
+            return CompressionProfile::ZSTD_DICTIONARY;
+        }
+        throw std::invalid_argument("Unknown compression profile: " + std::string {name});
+    }
+
+    /**
+     * @brief Tuning of a database, the defaults are the ones of every database of the module.
+     */
+    struct RocksDBTuning
+    {
+        std::size_t blockCacheSize = 0;                               ///< Bytes of a private block cache, 0 to share it
+        CompressionProfile compression = CompressionProfile::DEFAULT; ///< Compression of the data blocks
+        CachePriority priority = CachePriority::LOW;                  ///< Priority of the indexes and filters
+        std::string consumer;                                         ///< Name in the usage report, the path if empty
+    };
 
     class RocksDBOptions final
     {
 
         /**
          * @brief Builds the table options for the RocksDB instance.
+         *
+         * The indexes and filters are kept in the block cache, so its capacity bounds them too.
+         *
          * @return rocksdb::BlockBasedTableOptions Table options.
          */
-        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::BlockBasedTableOptions buildTableOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                                               const CachePriority priority)
         {
             if (readCache == nullptr)
             {
@@ -41,15 +102,50 @@ namespace Utils
 
             rocksdb::BlockBasedTableOptions tableOptions;
             tableOptions.block_cache = readCache;
+            tableOptions.cache_index_and_filter_blocks = true;
+            tableOptions.cache_index_and_filter_blocks_with_high_priority = priority == CachePriority::HIGH;
+            tableOptions.pin_l0_filter_and_index_blocks_in_cache = priority == CachePriority::HIGH;
             return tableOptions;
         }
 
+        /**
+         * @brief Sets the compression of the data blocks of a profile.
+         *
+         * With a dictionary, zstd trains it on a sample of the blocks of each file when it is written, and stores it
+         * in the file. The dictionary holds the structure shared by the records, so small blocks of similar records
+         * compress almost as well as a large one, without the cost of decompressing a large block on each cache miss.
+         */
+        static void applyCompression(rocksdb::ColumnFamilyOptions& options, CompressionProfile profile)
+        {
+            switch (profile)
+            {
+                case CompressionProfile::BZIP2: options.compression = rocksdb::kBZip2Compression; break;
+                case CompressionProfile::ZSTD: options.compression = rocksdb::kZSTD; break;
+                case CompressionProfile::ZSTD_DICTIONARY:
+                    options.compression = rocksdb::kZSTD;
+                    options.compression_opts.max_dict_bytes = ROCKSDB_ZSTD_DICTIONARY_SIZE;
+                    options.compression_opts.zstd_max_train_bytes = ROCKSDB_ZSTD_TRAINING_SIZE;
+                    // The last level holds most of the data, it gets its dictionary too.
+                    options.bottommost_compression = rocksdb::kZSTD;
+                    options.bottommost_compression_opts = options.compression_opts;
+                    options.bottommost_compression_opts.enabled = true;
+                    break;
+                case CompressionProfile::DEFAULT:
+                default: break;
+            }
+        }
+
     public:
         /**
          * @brief Builds the column family options for the RocksDB instance.
+         * @param compression Compression of the data blocks of the column.
+         * @param priority Priority of the indexes and filters of the column in the block cache.
          * @return rocksdb::ColumnFamilyOptions Column family options.
          */
-        static rocksdb::ColumnFamilyOptions buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache)
+        static rocksdb::ColumnFamilyOptions
+        buildColumnFamilyOptions(const std::shared_ptr<rocksdb::Cache>& readCache,
+                                 const CompressionProfile compression = CompressionProfile::DEFAULT,
+                                 const CachePriority priority = CachePriority::LOW)
         {
             rocksdb::ColumnFamilyOptions columnFamilyOptions;
             // Amount of data to build up in memory (backed by an unsorted log
@@ -60,17 +156,23 @@ namespace Utils
             // The maximum number of levels of compaction to allow.
             columnFamilyOptions.num_levels = ROCKSDB_NUM_LEVELS;
             // The size of the LRU cache used to prevent cold reads.
-            columnFamilyOptions.table_factory.reset(rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache)));
+            columnFamilyOptions.table_factory.reset(
+                rocksdb::NewBlockBasedTableFactory(buildTableOptions(readCache, priority)));
+            applyCompression(columnFamilyOptions, compression);
 
             return columnFamilyOptions;
         }
 
         /**
          * @brief Builds the DB options for the RocksDB instance.
+         * @param compression Compression of the data blocks of the default column.
+         * @param priority Priority of the indexes and filters of the default column in the block cache.
          * @return rocksdb::Options DB options.
          */
         static rocksdb::Options buildDBOptions(const std::shared_ptr<rocksdb::WriteBufferManager>& writeManager,
-                                               const std::shared_ptr<rocksdb::Cache>& readCache)
+                                               const std::shared_ptr<rocksdb::Cache>& readCache,
+                                               const CompressionProfile compression = CompressionProfile::DEFAULT,
+                                               const CachePriority priority = CachePriority::LOW)
         {
             if (writeManager == nullptr)
             {
@@ -100,7 +202,8 @@ namespace Utils
             options.max_write_buffer_number = ROCKSDB_MAX_WRITE_BUFFER_NUMBER;
 
             // The size of the LRU cache used to prevent cold reads.
-            options.table_factory.reset(NewBlockBasedTableFactory(buildTableOptions(readCache)));
+            options.table_factory.reset(NewBlockBasedTableFactory(buildTableOptions(readCache, priority)));
+            applyCompression(options, compression);
             return options;
         }
     };
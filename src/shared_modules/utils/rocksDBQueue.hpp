@@ -12,12 +12,18 @@
 #ifndef _ROCKSDB_QUEUE_HPP
 #define _ROCKSDB_QUEUE_HPP
 
+#include "rocksDBResources.hpp"
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
+#include <algorithm>
 #include <filesystem>
+#include <queue>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 // RocksDB integration as queue
 template<typename T, typename U = T>
@@ -27,13 +33,16 @@ public:
     explicit RocksDBQueue(const std::string& connectorName)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
+        // Read cache is used to cache the data read from the disk, shared by the databases of the process.
+        auto& resources = Utils::RocksDBResources::instance();
+        m_readCache = resources.blockCache();
         rocksdb::BlockBasedTableOptions tableOptions;
         tableOptions.block_cache = m_readCache;
+        tableOptions.cache_index_and_filter_blocks = true;
 
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(64 * 1024 * 1024);
+        // Write buffer manager is used to manage the memory used for writing data to the disk, the budget is shared
+        // by the databases of the process.
+        m_writeManager = resources.writeBufferManager();
 
         rocksdb::Options options;
         options.table_factory.reset(NewBlockBasedTableFactory(tableOptions));
@@ -58,39 +67,27 @@ public:
         }
 
         m_db.reset(db);
+        m_consumer = resources.registerConsumer(connectorName, m_db.get());
 
-        // RocksDB counter initialization.
-        m_size = 0;
+        // Keys written by previous versions are decimal strings, which don't sort numerically.
+        migrateLegacyKeys();
 
+        // RocksDB counter initialization. The keys sort in queue order and have no gaps, so the first and last keys
+        // are enough.
         auto it = std::unique_ptr<rocksdb::Iterator>(m_db->NewIterator(rocksdb::ReadOptions()));
         it->SeekToFirst();
         if (it->Valid())
         {
-            auto key = std::stoull(it->key().ToString());
-            m_first = key;
-            m_last = key;
+            m_first = decodeKey(it->key());
+            it->SeekToLast();
+            m_last = decodeKey(it->key());
+            m_size = m_last - m_first + 1;
         }
         else
         {
             m_first = 1;
             m_last = 0;
-        }
-
-        while (it->Valid())
-        {
-            auto key = std::stoull(it->key().ToString());
-            if (key > m_last)
-            {
-                m_last = key;
-            }
-
-            if (key < m_first)
-            {
-                m_first = key;
-            }
-            ++m_size;
-
-            it->Next();
+            m_size = 0;
         }
     }
 
@@ -98,17 +95,44 @@ public:
     {
         // RocksDB enqueue element.
         ++m_last;
-        if (const auto status = m_db->Put(rocksdb::WriteOptions(), std::to_string(m_last), data); !status.ok())
+        if (const auto status = m_db->Put(rocksdb::WriteOptions(), encodeKey(m_last), data); !status.ok())
         {
             throw std::runtime_error("Failed to enqueue element");
         }
         ++m_size;
     }
 
+    /**
+     * @brief Pushes several elements with a single write.
+     *
+     * @param data Elements to push, in queue order.
+     */
+    void pushBulk(const std::vector<T>& data)
+    {
+        if (data.empty())
+        {
+            return;
+        }
+
+        rocksdb::WriteBatch batch;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            batch.Put(encodeKey(m_last + 1 + i), data[i]);
+        }
+
+        if (const auto status = m_db->Write(rocksdb::WriteOptions(), &batch); !status.ok())
+        {
+            throw std::runtime_error("Failed to enqueue elements");
+        }
+
+        m_last += data.size();
+        m_size += data.size();
+    }
+
     void pop()
     {
         // RocksDB dequeue element.
-        if (!m_db->Delete(rocksdb::WriteOptions(), std::to_string(m_first)).ok())
+        if (!m_db->Delete(rocksdb::WriteOptions(), encodeKey(m_first)).ok())
         {
             throw std::runtime_error("Failed to dequeue element, can't delete it");
         }
@@ -136,7 +160,7 @@ public:
     U front() const
     {
         U value;
-        if (!m_db->Get(rocksdb::ReadOptions(), m_db->DefaultColumnFamily(), std::to_string(m_first), &value).ok())
+        if (!m_db->Get(rocksdb::ReadOptions(), m_db->DefaultColumnFamily(), encodeKey(m_first), &value).ok())
         {
             throw std::runtime_error("Failed to get front element");
         }
@@ -152,8 +176,7 @@ public:
         }
 
         U value;
-        if (!m_db->Get(rocksdb::ReadOptions(), m_db->DefaultColumnFamily(), std::to_string(m_first + index), &value)
-                 .ok())
+        if (!m_db->Get(rocksdb::ReadOptions(), m_db->DefaultColumnFamily(), encodeKey(m_first + index), &value).ok())
         {
             throw std::runtime_error("Failed to get element at index");
         }
@@ -161,13 +184,183 @@ public:
         return value;
     }
 
+    /**
+     * @brief Gets the first elements of the queue, reading them with a single iterator.
+     *
+     * @param elementsQuantity Maximum amount of elements to get.
+     * @return std::queue<U> Elements, in queue order.
+     */
+    std::queue<U> getBulk(const uint64_t elementsQuantity) const
+    {
+        std::queue<U> bulkQueue;
+        const auto quantity = std::min(elementsQuantity, m_size);
+        if (quantity == 0)
+        {
+            return bulkQueue;
+        }
+
+        // The upper bound must outlive the iterator.
+        const auto upperBound = encodeKey(m_first + quantity);
+        const rocksdb::Slice upperBoundSlice {upperBound};
+        rocksdb::ReadOptions readOptions;
+        readOptions.iterate_upper_bound = &upperBoundSlice;
+
+        auto it = std::unique_ptr<rocksdb::Iterator>(m_db->NewIterator(readOptions));
+        for (it->Seek(encodeKey(m_first)); it->Valid(); it->Next())
+        {
+            U value;
+            if constexpr (std::is_same_v<U, rocksdb::PinnableSlice>)
+            {
+                value.PinSelf(it->value());
+            }
+            else
+            {
+                value.assign(it->value().data(), it->value().size());
+            }
+            bulkQueue.push(std::move(value));
+        }
+
+        if (!it->status().ok() || bulkQueue.size() != quantity)
+        {
+            throw std::runtime_error("Failed to get bulk of elements");
+        }
+
+        return bulkQueue;
+    }
+
+    /**
+     * @brief Removes the first elements of the queue with a single range deletion.
+     *
+     * @param elementsQuantity Maximum amount of elements to remove.
+     */
+    void popBulk(const uint64_t elementsQuantity)
+    {
+        const auto quantity = std::min(elementsQuantity, m_size);
+        if (quantity == 0)
+        {
+            return;
+        }
+
+        if (quantity == 1)
+        {
+            pop();
+            return;
+        }
+
+        if (const auto status = m_db->DeleteRange(rocksdb::WriteOptions(),
+                                                  m_db->DefaultColumnFamily(),
+                                                  encodeKey(m_first),
+                                                  encodeKey(m_first + quantity));
+            !status.ok())
+        {
+            throw std::runtime_error("Failed to dequeue elements, can't delete them");
+        }
+
+        m_first += quantity;
+        m_size -= quantity;
+
+        if (m_size == 0)
+        {
+            m_first = 1;
+            m_last = 0;
+        }
+    }
+
 private:
+    /**
+     * @brief Encodes an element index as a fixed-width big-endian key, so the keys sort in queue order.
+     *
+     * @param index Element index.
+     * @return std::string Element key.
+     */
+    static std::string encodeKey(uint64_t index)
+    {
+        std::string key(sizeof(uint64_t), '\0');
+        for (auto i = key.size(); i > 0; --i)
+        {
+            key[i - 1] = static_cast<char>(index & 0xFF);
+            index >>= 8;
+        }
+        return key;
+    }
+
+    /**
+     * @brief Decodes the element index of a key.
+     *
+     * @param key Element key.
+     * @return uint64_t Element index.
+     */
+    static uint64_t decodeKey(const rocksdb::Slice& key)
+    {
+        if (key.size() != sizeof(uint64_t))
+        {
+            throw std::runtime_error("Invalid queue key");
+        }
+
+        uint64_t index {0};
+        for (size_t i = 0; i < key.size(); ++i)
+        {
+            index = (index << 8) | static_cast<uint8_t>(key[i]);
+        }
+        return index;
+    }
+
+    /**
+     * @brief Rewrites the decimal keys of previous versions as fixed-width keys, keeping their index.
+     *
+     * @details Fixed-width keys start with a zero byte until the index reaches 2^56, while the decimal keys start with
+     * a digit, so only the decimal keys are visited.
+     */
+    void migrateLegacyKeys()
+    {
+        constexpr auto MIGRATION_BATCH_SIZE {1024};
+
+        rocksdb::WriteBatch batch;
+        auto it = std::unique_ptr<rocksdb::Iterator>(m_db->NewIterator(rocksdb::ReadOptions()));
+        for (it->Seek("0"); it->Valid(); it->Next())
+        {
+            const auto key = it->key().ToString();
+            batch.Put(encodeKey(std::stoull(key)), it->value());
+            batch.Delete(key);
+
+            if (batch.Count() >= 2 * MIGRATION_BATCH_SIZE)
+            {
+                writeMigrationBatch(batch);
+            }
+        }
+
+        if (!it->status().ok())
+        {
+            throw std::runtime_error("Failed to read the queue keys");
+        }
+
+        if (batch.Count() > 0)
+        {
+            writeMigrationBatch(batch);
+        }
+    }
+
+    /**
+     * @brief Writes and clears a batch of migrated keys.
+     *
+     * @param batch Migration batch.
+     */
+    void writeMigrationBatch(rocksdb::WriteBatch& batch)
+    {
+        if (const auto status = m_db->Write(rocksdb::WriteOptions(), &batch); !status.ok())
+        {
+            throw std::runtime_error("Failed to migrate the queue keys. Reason: " + status.ToString());
+        }
+        batch.Clear();
+    }
+
     std::unique_ptr<rocksdb::DB> m_db;
     std::shared_ptr<rocksdb::Cache> m_readCache;
     std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager;
     uint64_t m_size;
     uint64_t m_first;
     uint64_t m_last;
+    Utils::RocksDBResources::Consumer m_consumer;
 };
 
 #endif // _ROCKSDB_QUEUE_HPP
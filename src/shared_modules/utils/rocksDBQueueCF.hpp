@@ -12,35 +12,137 @@
 #ifndef _ROCKSDB_QUEUE_CF_HPP
 #define _ROCKSDB_QUEUE_CF_HPP
 
+#include "rocksDBColumnFamily.hpp"
 #include "rocksDBOptions.hpp"
 #include "rocksdb/db.h"
 #include "rocksdb/filter_policy.h"
 #include "rocksdb/table.h"
+#include "rocksdb/write_batch.h"
 #include "stringHelper.h"
+#include <algorithm>
+#include <chrono>
 #include <filesystem>
+#include <map>
+#include <optional>
+#include <set>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 // RocksDB integration as queue
 template<typename T, typename U = T>
 class RocksDBQueueCF final
 {
 private:
+    // Column with the metadata of each queue, and key flagging the metadata as complete.
+    static constexpr auto METADATA_COLUMN = "queue_metadata";
+    static constexpr auto METADATA_READY_KEY = "_ready";
+
+    using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
+
     struct QueueMetadata final
     {
         uint64_t head = 0;
         uint64_t tail = 0;
         uint64_t size = 0;
 
-        // Time from epoch + postpone time.
-        std::chrono::time_point<std::chrono::system_clock> postponeTime;
+        // Time from epoch + postpone time, the key of the queue in the schedule while it is postponed.
+        TimePoint postponeTime;
     };
 
+    /**
+     * @brief Moves the queues whose postpone time has passed to the ready set, in deadline order.
+     */
+    void promoteExpired()
+    {
+        const auto currentSystemTime = std::chrono::system_clock::now();
+        while (!m_postponed.empty() && m_postponed.begin()->first <= currentSystemTime)
+        {
+            m_ready.insert(std::move(m_postponed.extract(m_postponed.begin()).value().second));
+        }
+    }
+
+    /**
+     * @brief Removes a queue from the ready set or from the schedule, before it is erased or postponed again.
+     */
+    void unschedule(const std::string& id, const QueueMetadata& metadata)
+    {
+        if (const auto it = m_ready.find(id); it != m_ready.end())
+        {
+            m_ready.erase(it);
+        }
+        else
+        {
+            m_postponed.erase({metadata.postponeTime, id});
+        }
+    }
+
+    /**
+     * @brief Builds the metadata value of a queue: head and tail positions, the size follows from them.
+     */
+    static std::string metadataValue(const QueueMetadata& metadata)
+    {
+        return std::to_string(metadata.head) + "_" + std::to_string(metadata.tail);
+    }
+
+    /**
+     * @brief Applies a batch atomically, so the elements and their metadata never diverge.
+     */
+    void write(rocksdb::WriteBatch& batch, const char* error)
+    {
+        if (const auto status = m_db->Write(rocksdb::WriteOptions(), &batch); !status.ok())
+        {
+            throw std::runtime_error(std::string {error} + ". Reason: " + status.ToString());
+        }
+    }
+
+    /**
+     * @brief Loads the queues metadata from the metadata column, one key per queue.
+     *
+     * @return true if the metadata is complete, false if it was never built.
+     */
+    bool loadQueueMetadata()
+    {
+        constexpr auto HEAD = 0;
+        constexpr auto TAIL = 1;
+
+        std::string ready;
+        if (!m_db->Get(rocksdb::ReadOptions(), m_metadataColumn->handle(), METADATA_READY_KEY, &ready).ok())
+        {
+            return false;
+        }
+
+        auto it = std::unique_ptr<rocksdb::Iterator>(
+            m_db->NewIterator(rocksdb::ReadOptions(), m_metadataColumn->handle()));
+        for (it->SeekToFirst(); it->Valid(); it->Next())
+        {
+            if (it->key() == METADATA_READY_KEY)
+            {
+                continue;
+            }
+
+            const auto data = Utils::split(it->value().ToString(), '_');
+            const auto head = std::stoull(data.at(HEAD));
+            const auto tail = std::stoull(data.at(TAIL));
+            m_queueMetadata.emplace(it->key().ToString(),
+                                    QueueMetadata {head, tail, tail - head + 1, std::chrono::system_clock::now()});
+        }
+
+        return true;
+    }
+
     void initializeQueueData()
     {
         constexpr auto ID_QUEUE = 0;
         constexpr auto QUEUE_NUMBER = 1;
 
+        if (loadQueueMetadata())
+        {
+            return;
+        }
+
+        // Database written without metadata: scan every element once and persist the result.
         auto it = std::unique_ptr<rocksdb::Iterator>(m_db->NewIterator(rocksdb::ReadOptions()));
         it->SeekToFirst();
         while (it->Valid())
@@ -71,16 +173,26 @@ private:
 
             it->Next();
         }
+
+        rocksdb::WriteBatch batch;
+        for (const auto& [id, metadata] : m_queueMetadata)
+        {
+            batch.Put(m_metadataColumn->handle(), id, metadataValue(metadata));
+        }
+        batch.Put(m_metadataColumn->handle(), METADATA_READY_KEY, "");
+        write(batch, "Failed to build queue metadata");
     }
 
 public:
     explicit RocksDBQueueCF(const std::string& path)
     {
         // RocksDB initialization.
-        // Read cache is used to cache the data read from the disk.
-        m_readCache = rocksdb::NewLRUCache(Utils::ROCKSDB_BLOCK_CACHE_SIZE);
-        // Write buffer manager is used to manage the memory used for writing data to the disk.
-        m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(Utils::ROCKSDB_WRITE_BUFFER_MANAGER_SIZE);
+        // Read cache is used to cache the data read from the disk, shared by the databases of the process.
+        auto& resources = Utils::RocksDBResources::instance();
+        m_readCache = resources.blockCache();
+        // Write buffer manager is used to manage the memory used for writing data to the disk, the budget is shared
+        // by the databases of the process.
+        m_writeManager = resources.writeBufferManager();
 
         rocksdb::Options options = Utils::RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
         rocksdb::ColumnFamilyOptions columnFamilyOptions = Utils::RocksDBOptions::buildColumnFamilyOptions(m_readCache);
@@ -94,7 +206,31 @@ public:
         // Create directories recursively if they do not exist
         std::filesystem::create_directories(databasePath);
 
-        if (const auto status = rocksdb::DB::Open(options, path, &dbRawPtr); !status.ok())
+        // Get a list of the existing columns descriptors.
+        if (const auto databaseFile {databasePath / "CURRENT"}; std::filesystem::exists(databaseFile))
+        {
+            std::vector<std::string> columnsNames;
+            if (const auto listStatus {rocksdb::DB::ListColumnFamilies(options, path, &columnsNames)};
+                !listStatus.ok())
+            {
+                throw std::runtime_error("Failed to list columns: " + std::string {listStatus.getState()});
+            }
+
+            for (auto& columnName : columnsNames)
+            {
+                columnsDescriptors.emplace_back(columnName, columnFamilyOptions);
+            }
+        }
+        else
+        {
+            columnsDescriptors.emplace_back(rocksdb::kDefaultColumnFamilyName, columnFamilyOptions);
+        }
+
+        std::vector<rocksdb::ColumnFamilyHandle*> columnHandles;
+        columnHandles.reserve(columnsDescriptors.size());
+
+        if (const auto status = rocksdb::DB::Open(options, path, columnsDescriptors, &columnHandles, &dbRawPtr);
+            !status.ok())
         {
             throw std::runtime_error("Failed to open RocksDB database. Reason: " + std::string {status.getState()});
         }
@@ -102,46 +238,123 @@ public:
         // Assigns the raw pointer to the unique_ptr. When db goes out of scope, it will automatically delete the
         // allocated RocksDB instance.
         m_db.reset(dbRawPtr);
+        m_consumer = resources.registerConsumer(path, m_db.get());
 
-        // Initialize queue data.
+        // The elements are accessed through the default column, only the metadata column handle is kept.
+        for (const auto& handle : columnHandles)
+        {
+            if (handle->GetName() == METADATA_COLUMN)
+            {
+                m_metadataColumn.emplace(m_db, handle);
+            }
+            else if (const auto status = m_db->DestroyColumnFamilyHandle(handle); !status.ok())
+            {
+                throw std::runtime_error("Failed to free RocksDB column family: " + std::string {status.getState()});
+            }
+        }
+
+        if (!m_metadataColumn)
+        {
+            rocksdb::ColumnFamilyHandle* handle;
+            if (const auto status = m_db->CreateColumnFamily(columnFamilyOptions, METADATA_COLUMN, &handle);
+                !status.ok())
+            {
+                throw std::runtime_error("Failed to create metadata column: " + std::string {status.getState()});
+            }
+            m_metadataColumn.emplace(m_db, handle);
+        }
+
+        // Initialize queue data, no queue is postponed after a restart.
         initializeQueueData();
+        for (const auto& [id, metadata] : m_queueMetadata)
+        {
+            m_ready.emplace_hint(m_ready.end(), id);
+        }
     }
 
     void push(std::string_view id, const T& data)
     {
         if (m_queueMetadata.find(id.data()) == m_queueMetadata.end())
         {
-            m_queueMetadata.emplace(id, QueueMetadata {1, 0, 0, std::chrono::system_clock::now()});
+            const auto it =
+                m_queueMetadata.emplace(id, QueueMetadata {1, 0, 0, std::chrono::system_clock::now()}).first;
+            m_ready.insert(it->first);
         }
 
         if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
         {
-            ++it->second.tail;
-            if (const auto status =
-                    m_db->Put(rocksdb::WriteOptions(), std::string(id) + "_" + std::to_string(it->second.tail), data);
-                !status.ok())
-            {
-                throw std::runtime_error("Failed to enqueue element");
-            }
+            auto metadata = it->second;
+            ++metadata.tail;
+
+            rocksdb::WriteBatch batch;
+            batch.Put(std::string(id) + "_" + std::to_string(metadata.tail), data);
+            batch.Put(m_metadataColumn->handle(), it->first, metadataValue(metadata));
+            write(batch, "Failed to enqueue element");
+
+            it->second.tail = metadata.tail;
             ++it->second.size;
         }
     }
 
+    /**
+     * @brief Pushes several elements to a queue with a single write.
+     *
+     * @param id Queue id.
+     * @param data Elements to push, in queue order.
+     */
+    void pushBulk(std::string_view id, const std::vector<T>& data)
+    {
+        if (data.empty())
+        {
+            return;
+        }
+
+        auto it {m_queueMetadata.find(id.data())};
+        if (it == m_queueMetadata.end())
+        {
+            it = m_queueMetadata.emplace(id, QueueMetadata {1, 0, 0, std::chrono::system_clock::now()}).first;
+            m_ready.insert(it->first);
+        }
+
+        rocksdb::WriteBatch batch;
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            batch.Put(std::string(id) + "_" + std::to_string(it->second.tail + 1 + i), data[i]);
+        }
+        batch.Put(m_metadataColumn->handle(),
+                  it->first,
+                  metadataValue({it->second.head, it->second.tail + data.size(), 0, it->second.postponeTime}));
+        write(batch, "Failed to enqueue elements");
+
+        it->second.tail += data.size();
+        it->second.size += data.size();
+    }
+
     void pop(std::string_view id)
     {
         if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
         {
-            // RocksDB dequeue element.
-            if (!m_db->Delete(rocksdb::WriteOptions(), std::string(id) + "_" + std::to_string(it->second.head)).ok())
+            // RocksDB dequeue element, along with the queue metadata.
+            rocksdb::WriteBatch batch;
+            batch.Delete(std::string(id) + "_" + std::to_string(it->second.head));
+            if (it->second.size == 1)
             {
-                throw std::runtime_error("Failed to dequeue element, can't delete it");
+                batch.Delete(m_metadataColumn->handle(), it->first);
             }
+            else
+            {
+                batch.Put(m_metadataColumn->handle(),
+                          it->first,
+                          metadataValue({it->second.head + 1, it->second.tail, 0, it->second.postponeTime}));
+            }
+            write(batch, "Failed to dequeue element, can't delete it");
 
             ++it->second.head;
             --it->second.size;
 
             if (it->second.size == 0)
             {
+                unschedule(it->first, it->second);
                 m_queueMetadata.erase(it);
             }
         }
@@ -161,16 +374,25 @@ public:
         return 0;
     }
 
+    /**
+     * @brief Gets the number of elements of all the queues.
+     */
+    uint64_t size() const
+    {
+        uint64_t total {0};
+        for (const auto& [id, metadata] : m_queueMetadata)
+        {
+            total += metadata.size;
+        }
+        return total;
+    }
+
     bool empty() const
     {
-        // Empty calculation not considering the postponed columns.
-        // Count if there is any column with elements.
-        const auto currentSystemTime = std::chrono::system_clock::now();
-        auto count =
-            std::count_if(m_queueMetadata.begin(),
-                          m_queueMetadata.end(),
-                          [&](const auto& metadata) { return metadata.second.postponeTime < currentSystemTime; });
-        return count == 0;
+        // Empty calculation not considering the postponed columns, the first deadline of the schedule tells if any of
+        // them is due.
+        return m_ready.empty() &&
+               (m_postponed.empty() || m_postponed.begin()->first > std::chrono::system_clock::now());
     }
 
     const std::string& getAvailableColumn()
@@ -180,25 +402,56 @@ public:
             throw std::runtime_error("No queue ids available");
         }
 
-        // Only consider the columns that are not postponed.
-        const auto currentSystemTime = std::chrono::system_clock::now();
-        auto it = std::find_if(m_queueMetadata.begin(),
-                               m_queueMetadata.end(),
-                               [&](const auto& metadata) { return metadata.second.postponeTime < currentSystemTime; });
-
-        if (it == m_queueMetadata.end())
+        const auto* id = nextAvailableColumn();
+        if (id == nullptr)
         {
             throw std::runtime_error("Probably race condition, no queue id available");
         }
 
-        return it->first;
+        return *id;
+    }
+
+    /**
+     * @brief Gets the next queue to serve, in round-robin order.
+     *
+     * The search starts after the last queue served, so a queue with many elements doesn't starve the others. Only
+     * the ready queues are searched, the postponed ones wait in the schedule until their time comes, so the cost
+     * doesn't depend on how many queues are postponed. The excluded queues are skipped.
+     *
+     * @param excluded Queue ids to skip.
+     * @return const std::string* Queue id, nullptr if none is available.
+     */
+    const std::string* nextAvailableColumn(const std::set<std::string, std::less<>>& excluded = {})
+    {
+        promoteExpired();
+
+        const auto available = [&](const std::string& id)
+        {
+            return excluded.find(id) == excluded.end();
+        };
+
+        const auto start = m_ready.upper_bound(m_lastServed);
+        auto it = std::find_if(start, m_ready.end(), available);
+        if (it == m_ready.end())
+        {
+            it = std::find_if(m_ready.begin(), start, available);
+            if (it == start)
+            {
+                return nullptr;
+            }
+        }
+
+        m_lastServed = *it;
+        return &m_queueMetadata.find(*it)->first;
     }
 
     void postpone(std::string_view id, const std::chrono::seconds& time) noexcept
     {
         if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
         {
+            unschedule(it->first, it->second);
             it->second.postponeTime = std::chrono::system_clock::now() + time;
+            m_postponed.emplace(it->second.postponeTime, it->first);
         }
     }
 
@@ -227,37 +480,34 @@ public:
 
     void clear(std::string_view id)
     {
-        auto deleteElement = [this](const std::string& key)
+        // The keys of a queue are the ones starting with its id and '_', ids don't contain '_'.
+        auto deleteQueue = [this](rocksdb::WriteBatch& batch, const std::string& queueId)
         {
-            if (!m_db->Delete(rocksdb::WriteOptions(), key).ok())
-            {
-                throw std::runtime_error("Failed to clear element, can't delete it");
-            }
+            batch.DeleteRange(m_db->DefaultColumnFamily(), queueId + "_", queueId + static_cast<char>('_' + 1));
+            batch.Delete(m_metadataColumn->handle(), queueId);
         };
 
+        rocksdb::WriteBatch batch;
         if (id.empty())
         {
             // Clear all elements from the queue.
             for (const auto& metadata : m_queueMetadata)
             {
-                for (auto i = metadata.second.head; i <= metadata.second.tail; ++i)
-                {
-                    deleteElement(std::string(metadata.first) + "_" + std::to_string(i));
-                }
+                deleteQueue(batch, metadata.first);
             }
+            write(batch, "Failed to clear element, can't delete it");
             m_queueMetadata.clear();
+            m_ready.clear();
+            m_postponed.clear();
         }
         else
         {
             if (const auto it {m_queueMetadata.find(id.data())}; it != m_queueMetadata.end())
             {
                 // Clear all elements from the queue.
-                for (auto i = it->second.head; i <= it->second.tail; ++i)
-                {
-                    deleteElement(std::string(id) + "_" + std::to_string(i));
-                    ++it->second.head;
-                    --it->second.size;
-                }
+                deleteQueue(batch, it->first);
+                write(batch, "Failed to clear element, can't delete it");
+                unschedule(it->first, it->second);
                 m_queueMetadata.erase(it);
             }
         }
@@ -267,7 +517,12 @@ private:
     std::shared_ptr<rocksdb::DB> m_db;
     std::shared_ptr<rocksdb::Cache> m_readCache;
     std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager;
-    std::map<std::string, QueueMetadata> m_queueMetadata; ///< Map queue.
+    std::optional<Utils::ColumnFamilyRAII> m_metadataColumn; ///< Head and tail of each queue, updated with it.
+    std::map<std::string, QueueMetadata> m_queueMetadata;    ///< Map queue.
+    std::set<std::string, std::less<>> m_ready;              ///< Queues with elements that aren't postponed.
+    std::set<std::pair<TimePoint, std::string>> m_postponed; ///< Postponed queues, by the time they are due.
+    std::string m_lastServed;                                ///< Last queue id served, for the round-robin order.
+    Utils::RocksDBResources::Consumer m_consumer;            ///< Registration in the usage report.
 };
 
 #endif // _ROCKSDB_QUEUE_CF_HPP
@@ -0,0 +1,237 @@
+/*
+ * Wazuh Utils - rocksDB shared resources.
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _ROCKS_DB_RESOURCES_HPP
+#define _ROCKS_DB_RESOURCES_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <rocksdb/cache.h>
+#include <rocksdb/db.h>
+#include <rocksdb/write_buffer_manager.h>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Utils
+{
+    constexpr auto ROCKSDB_SHARED_BLOCK_CACHE_SIZE = 128 * 1024 * 1024;
+    constexpr auto ROCKSDB_SHARED_WRITE_BUFFER_SIZE = 128 * 1024 * 1024;
+    constexpr auto ROCKSDB_HIGH_PRIORITY_POOL_RATIO = 0.25;
+
+    /**
+     * @brief Priority of the indexes and filters of a database in the shared block cache.
+     *
+     * The data blocks of every database compete in the same pool. The indexes and filters of the HIGH databases are
+     * kept in the high priority pool, so a scan of a queue does not evict the metadata the lookups of the feed need for
+     * every read.
+     */
+    enum class CachePriority
+    {
+        LOW,  ///< Queues and databases read sequentially
+        HIGH, ///< Databases with random lookups in the hot path
+    };
+
+    /**
+     * @brief Memory used by a database that shares the process-wide resources.
+     */
+    struct RocksDBUsage
+    {
+        std::string consumer;  ///< Name of the database
+        uint64_t memtables;    ///< Bytes of the memtables, charged to the write buffer budget
+        uint64_t tableReaders; ///< Bytes of the indexes and filters held outside the block cache
+    };
+
+    /**
+     * @brief Process-wide block cache and write buffer budget of the RocksDB databases.
+     *
+     * The write buffer manager charges the memtables to the block cache, so the capacity of the cache bounds the memory
+     * of the blocks and the memtables of every database together. The budget is set once, before the first database is
+     * opened.
+     *
+     * @note thread-safe.
+     */
+    class RocksDBResources final
+    {
+    public:
+        /**
+         * @brief Budget of the shared resources.
+         */
+        struct Budget
+        {
+            std::size_t blockCacheSize = ROCKSDB_SHARED_BLOCK_CACHE_SIZE;   ///< Bytes of blocks, besides the memtables
+            std::size_t writeBufferSize = ROCKSDB_SHARED_WRITE_BUFFER_SIZE; ///< Bytes of memtables of all databases
+            double highPriorityRatio = ROCKSDB_HIGH_PRIORITY_POOL_RATIO;    ///< Share of the cache of HIGH metadata
+        };
+
+        /**
+         * @brief Registration of a database in the usage report, it is removed when the registration is destroyed.
+         *
+         * @note it must be destroyed before the database is closed.
+         */
+        class Consumer final
+        {
+        private:
+            uint64_t m_id;
+
+        public:
+            explicit Consumer(uint64_t id = 0)
+                : m_id {id}
+            {
+            }
+
+            Consumer(Consumer&& other) noexcept
+                : m_id {std::exchange(other.m_id, 0)}
+            {
+            }
+
+            Consumer& operator=(Consumer&& other) noexcept
+            {
+                std::swap(m_id, other.m_id);
+                return *this;
+            }
+
+            Consumer(const Consumer&) = delete;
+            Consumer& operator=(const Consumer&) = delete;
+
+            ~Consumer()
+            {
+                if (m_id != 0)
+                {
+                    RocksDBResources::instance().unregisterConsumer(m_id);
+                }
+            }
+        };
+
+    private:
+        struct Registered
+        {
+            std::string name; ///< Name of the consumer
+            rocksdb::DB* db;  ///< Database of the consumer
+        };
+
+        std::shared_ptr<rocksdb::Cache> m_blockCache;                ///< Block cache of all the databases.
+        std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager; ///< Memtables budget, charged to the cache.
+        mutable std::mutex m_mutex;                                  ///< Protects the consumers.
+        std::map<uint64_t, Registered> m_consumers;                  ///< Registered databases by id.
+        uint64_t m_nextId {1};                                       ///< Id of the next registration.
+
+        static Budget& pendingBudget()
+        {
+            static Budget budget;
+            return budget;
+        }
+
+        static std::atomic<bool>& created()
+        {
+            static std::atomic<bool> created {false};
+            return created;
+        }
+
+        explicit RocksDBResources(const Budget& budget)
+        {
+            rocksdb::LRUCacheOptions cacheOptions;
+            cacheOptions.capacity = budget.blockCacheSize + budget.writeBufferSize;
+            cacheOptions.high_pri_pool_ratio = budget.highPriorityRatio;
+            m_blockCache = rocksdb::NewLRUCache(cacheOptions);
+            m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(budget.writeBufferSize, m_blockCache);
+        }
+
+        void unregisterConsumer(uint64_t id)
+        {
+            std::lock_guard lock {m_mutex};
+            m_consumers.erase(id);
+        }
+
+    public:
+        /**
+         * @brief Sets the budget of the shared resources.
+         *
+         * @throw std::logic_error if a database already uses them.
+         */
+        static void configure(const Budget& budget)
+        {
+            if (created())
+            {
+                throw std::logic_error("The RocksDB resources are already in use");
+            }
+            pendingBudget() = budget;
+        }
+
+        /**
+         * @brief Gets the shared resources, created with the configured budget on first use.
+         */
+        static RocksDBResources& instance()
+        {
+            static RocksDBResources resources {[]() -> const Budget&
+                                               {
+                                                   created() = true;
+                                                   return pendingBudget();
+                                               }()};
+            return resources;
+        }
+
+        const std::shared_ptr<rocksdb::Cache>& blockCache() const { return m_blockCache; }
+        const std::shared_ptr<rocksdb::WriteBufferManager>& writeBufferManager() const { return m_writeManager; }
+
+        /**
+         * @brief Adds a database to the usage report.
+         *
+         * @param name Name of the consumer.
+         * @param db Database, it must outlive the registration.
+         * @return Consumer The registration.
+         */
+        Consumer registerConsumer(std::string name, rocksdb::DB* db)
+        {
+            std::lock_guard lock {m_mutex};
+            const auto id = m_nextId++;
+            m_consumers.emplace(id, Registered {std::move(name), db});
+            return Consumer {id};
+        }
+
+        /**
+         * @brief Gets the memory used by each registered database.
+         */
+        std::vector<RocksDBUsage> usage() const
+        {
+            std::vector<RocksDBUsage> usage;
+
+            std::lock_guard lock {m_mutex};
+            usage.reserve(m_consumers.size());
+            for (const auto& [id, consumer] : m_consumers)
+            {
+                RocksDBUsage entry {consumer.name, 0, 0};
+                consumer.db->GetAggregatedIntProperty(rocksdb::DB::Properties::kCurSizeAllMemTables,
+                                                      &entry.memtables);
+                consumer.db->GetAggregatedIntProperty(rocksdb::DB::Properties::kEstimateTableReadersMem,
+                                                      &entry.tableReaders);
+                usage.emplace_back(std::move(entry));
+            }
+            return usage;
+        }
+
+        /**
+         * @brief Gets the bytes used in the block cache, including the memtables charged to it.
+         */
+        std::size_t blockCacheUsage() const { return m_blockCache->GetUsage(); }
+
+        /**
+         * @brief Gets the capacity of the block cache, the budget of the blocks and the memtables.
+         */
+        std::size_t blockCacheCapacity() const { return m_blockCache->GetCapacity(); }
+    };
+} // namespace Utils
+
+#endif // _ROCKS_DB_RESOURCES_HPP
@@ -65,16 +65,25 @@ namespace Utils
          *
          * @param dbPath Path to the RocksDB database.
          * @param enableWal Whether to enable WAL or not.
+         * @param tuning Block cache, compression and cache priority of the columns.
+         *
+         * @note The block cache and the write buffer budget are the process-wide ones, see RocksDBResources.
          */
-        explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true)
+        explicit TRocksDBWrapper(std::string dbPath, const bool enableWal = true, const RocksDBTuning& tuning = {})
             : m_enableWal {enableWal}
             , m_path {std::move(dbPath)}
+            , m_compression {tuning.compression}
+            , m_priority {tuning.priority}
         {
-            m_readCache = rocksdb::NewLRUCache(16 * 1024 * 1024);
-            m_writeManager = std::make_shared<rocksdb::WriteBufferManager>(128 * 1024 * 1024);
+            auto& resources = RocksDBResources::instance();
+            m_readCache =
+                tuning.blockCacheSize > 0 ? rocksdb::NewLRUCache(tuning.blockCacheSize) : resources.blockCache();
+            m_writeManager = resources.writeBufferManager();
 
-            rocksdb::Options options = RocksDBOptions::buildDBOptions(m_writeManager, m_readCache);
-            rocksdb::ColumnFamilyOptions columnFamilyOptions = RocksDBOptions::buildColumnFamilyOptions(m_readCache);
+            rocksdb::Options options =
+                RocksDBOptions::buildDBOptions(m_writeManager, m_readCache, m_compression, m_priority);
+            rocksdb::ColumnFamilyOptions columnFamilyOptions =
+                RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_compression, m_priority);
 
             T* dbRawPtr;
             std::vector<rocksdb::ColumnFamilyDescriptor> columnsDescriptors;
@@ -145,6 +154,8 @@ namespace Utils
             {
                 m_columnsInstances.emplace_back(m_db, handle);
             }
+
+            m_consumer = resources.registerConsumer(tuning.consumer.empty() ? m_path : tuning.consumer, m_db.get());
         }
 
         /**
@@ -429,7 +440,9 @@ namespace Utils
             rocksdb::ColumnFamilyHandle* pColumnFamily;
 
             if (const auto status {m_db->CreateColumnFamily(
-                    RocksDBOptions::buildColumnFamilyOptions(m_readCache), columnName, &pColumnFamily)};
+                    RocksDBOptions::buildColumnFamilyOptions(m_readCache, m_compression, m_priority),
+                        columnName,
+                        &pColumnFamily)};
                 !status.ok())
             {
                 throw std::runtime_error {"Couldn't create column family: " + std::string {status.getState()}};
@@ -655,8 +668,11 @@ namespace Utils
         std::vector<ColumnFamilyRAII> m_columnsInstances;            ///< List of column family.
         const bool m_enableWal;                                      ///< Whether to enable WAL or not.
         const std::string m_path;                                    ///< Location of the DB.
+        const CompressionProfile m_compression;                      ///< Compression of the columns.
+        const CachePriority m_priority;                              ///< Cache priority of the indexes and filters.
         std::shared_ptr<rocksdb::Cache> m_readCache;                 ///< Cache for read operations.
         std::shared_ptr<rocksdb::WriteBufferManager> m_writeManager; ///< Write buffer manager.
+        RocksDBResources::Consumer m_consumer;                       ///< Registration in the usage report.
 
         /**
          * @brief Returns the column family handle identified by its name.
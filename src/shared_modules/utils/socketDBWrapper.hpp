@@ -16,12 +16,20 @@
 #include "singleton.hpp"
 #include "socketClient.hpp"
 #include "socketDBWrapperException.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <functional>
+#include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 auto constexpr WDB_SOCKET {"queue/db/wdb"};
+auto constexpr WDB_CONNECTIONS {4};
 
 char constexpr DB_WRAPPER_OK[] = {"ok"};
 char constexpr DB_WRAPPER_ERROR[] = {"err"};
@@ -44,147 +52,280 @@ enum class DbQueryStatus : uint8_t
 class SocketDBWrapper final : public Singleton<SocketDBWrapper>
 {
 private:
-    std::unique_ptr<SocketClient<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>> m_dbSocket;
-    nlohmann::json m_response;
-    nlohmann::json m_responsePartial;
-    std::string m_exceptionStr;
-    DbQueryStatus m_queryStatus {DbQueryStatus::UNKNOWN};
-    std::mutex m_mutexMessage;
-    std::mutex m_mutexResponse;
-    std::condition_variable m_conditionVariable;
-    bool m_teardown {false};
-    bool m_dataReady {false};
+    using DbSocket = SocketClient<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>;
 
-public:
-    void init(const std::string& socketPath = WDB_SOCKET)
+    /**
+     * @brief Connection of the pool, serving one query at a time.
+     *
+     * wazuh-db answers the queries of a connection in order and its responses carry no request ID, so each response
+     * belongs to the query in flight on its connection.
+     */
+    struct Connection
     {
-        m_teardown = false;
-        m_dbSocket = std::make_unique<SocketClient<Socket<OSPrimitives, SizeHeaderProtocol>, EpollWrapper>>(socketPath);
-        m_dbSocket->connect(
-            [&](const char* body, uint32_t bodySize, const char*, uint32_t)
-            {
-                std::scoped_lock lock {m_mutexResponse};
-                std::string responsePacket(body, bodySize);
+        std::unique_ptr<DbSocket> socket;
+        std::mutex mutexSocket;
+        nlohmann::json response;
+        nlohmann::json responsePartial;
+        std::string exceptionStr;
+        DbQueryStatus queryStatus {DbQueryStatus::UNKNOWN};
+        std::mutex mutexResponse;
+        std::condition_variable conditionVariable;
+        bool dataReady {false};
+
+        void onResponse(const char* body, uint32_t bodySize)
+        {
+            std::scoped_lock lock {mutexResponse};
+            std::string responsePacket(body, bodySize);
 
-                if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_DUE) - 1, DB_WRAPPER_DUE))
+            if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_DUE) - 1, DB_WRAPPER_DUE))
+            {
+                try
                 {
-                    try
-                    {
-                        m_responsePartial.push_back(nlohmann::json::parse(responsePacket.substr(4)));
-                    }
-                    catch (const nlohmann::detail::exception& ex)
-                    {
-                        m_queryStatus = DbQueryStatus::JSON_PARSING;
-                        m_exceptionStr = "Error parsing JSON response: " + responsePacket.substr(4) +
-                                         ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
-                    }
+                    responsePartial.push_back(nlohmann::json::parse(responsePacket.substr(4)));
                 }
-                else
+                catch (const nlohmann::detail::exception& ex)
                 {
-                    if (responsePacket.empty())
-                    {
-                        m_queryStatus = DbQueryStatus::EMPTY_RESPONSE;
-                        m_exceptionStr = "Empty DB response";
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_ERROR) - 1, DB_WRAPPER_ERROR))
-                    {
-                        m_queryStatus = DbQueryStatus::QUERY_ERROR;
-                        m_exceptionStr = "DB query error: " + responsePacket.substr(sizeof(DB_WRAPPER_ERROR));
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_IGNORE) - 1, DB_WRAPPER_IGNORE))
-                    {
-                        m_queryStatus = DbQueryStatus::QUERY_IGNORE;
-                        m_exceptionStr = "DB query ignored: " + responsePacket.substr(sizeof(DB_WRAPPER_IGNORE));
-                    }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_UNKNOWN) - 1, DB_WRAPPER_UNKNOWN))
+                    queryStatus = DbQueryStatus::JSON_PARSING;
+                    exceptionStr = "Error parsing JSON response: " + responsePacket.substr(4) +
+                                     ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
+                }
+            }
+            else
+            {
+                if (responsePacket.empty())
+                {
+                    queryStatus = DbQueryStatus::EMPTY_RESPONSE;
+                    exceptionStr = "Empty DB response";
+                }
+                else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_ERROR) - 1, DB_WRAPPER_ERROR))
+                {
+                    queryStatus = DbQueryStatus::QUERY_ERROR;
+                    exceptionStr = "DB query error: " + responsePacket.substr(sizeof(DB_WRAPPER_ERROR));
+                }
+                else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_IGNORE) - 1, DB_WRAPPER_IGNORE))
+                {
+                    queryStatus = DbQueryStatus::QUERY_IGNORE;
+                    exceptionStr = "DB query ignored: " + responsePacket.substr(sizeof(DB_WRAPPER_IGNORE));
+                }
+                else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_UNKNOWN) - 1, DB_WRAPPER_UNKNOWN))
+                {
+                    queryStatus = DbQueryStatus::QUERY_UNKNOWN;
+                    exceptionStr =
+                        "DB query unknown response: " + responsePacket.substr(sizeof(DB_WRAPPER_UNKNOWN));
+                }
+                else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_OK) - 1, DB_WRAPPER_OK))
+                {
+                    if (!responsePartial.empty())
                     {
-                        m_queryStatus = DbQueryStatus::QUERY_UNKNOWN;
-                        m_exceptionStr =
-                            "DB query unknown response: " + responsePacket.substr(sizeof(DB_WRAPPER_UNKNOWN));
+                        response = responsePartial;
                     }
-                    else if (0 == responsePacket.compare(0, sizeof(DB_WRAPPER_OK) - 1, DB_WRAPPER_OK))
+                    else
                     {
-                        if (!m_responsePartial.empty())
-                        {
-                            m_response = m_responsePartial;
-                        }
-                        else
+                        try
                         {
-                            try
+                            nlohmann::json responseParsed =
+                                nlohmann::json::parse(responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1));
+                            if (responseParsed.type() == nlohmann::json::value_t::array)
                             {
-                                nlohmann::json responseParsed =
-                                    nlohmann::json::parse(responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1));
-                                if (responseParsed.type() == nlohmann::json::value_t::array)
+                                response = std::move(responseParsed);
+                            }
+                            else
+                            {
+                                if (responseParsed.contains("status") &&
+                                    responseParsed.at("status") == "NOT_SYNCED")
                                 {
-                                    m_response = std::move(responseParsed);
+                                    queryStatus = DbQueryStatus::QUERY_NOT_SYNCED;
+                                    exceptionStr = "DB query not synced";
                                 }
                                 else
                                 {
-                                    if (responseParsed.contains("status") &&
-                                        responseParsed.at("status") == "NOT_SYNCED")
-                                    {
-                                        m_queryStatus = DbQueryStatus::QUERY_NOT_SYNCED;
-                                        m_exceptionStr = "DB query not synced";
-                                    }
-                                    else
-                                    {
-                                        m_response.push_back(responseParsed);
-                                    }
+                                    response.push_back(responseParsed);
                                 }
                             }
-                            catch (const nlohmann::detail::exception& ex)
-                            {
-                                m_queryStatus = DbQueryStatus::JSON_PARSING;
-                                m_exceptionStr =
-                                    "Error parsing JSON response: " + responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1) +
-                                    ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
-                            }
+                        }
+                        catch (const nlohmann::detail::exception& ex)
+                        {
+                            queryStatus = DbQueryStatus::JSON_PARSING;
+                            exceptionStr =
+                                "Error parsing JSON response: " + responsePacket.substr(sizeof(DB_WRAPPER_OK) - 1) +
+                                ". Exception id: " + std::to_string(ex.id) + ". " + ex.what();
                         }
                     }
-                    else
-                    {
-                        m_queryStatus = DbQueryStatus::INVALID_RESPONSE;
-                        m_exceptionStr = "DB query invalid response: " + responsePacket;
-                    }
-                    m_dataReady = true;
-                    m_conditionVariable.notify_one();
                 }
-            });
+                else
+                {
+                    queryStatus = DbQueryStatus::INVALID_RESPONSE;
+                    exceptionStr = "DB query invalid response: " + responsePacket;
+                }
+                dataReady = true;
+                conditionVariable.notify_one();
+            }
+        }
+    };
+
+    std::string m_socketPath;
+    std::vector<std::unique_ptr<Connection>> m_connections;
+    std::vector<Connection*> m_idleConnections;
+    std::mutex m_mutexPool;
+    std::condition_variable m_poolConditionVariable;
+    std::atomic<bool> m_teardown {false};
+
+    void connect(Connection& connection)
+    {
+        connection.socket = std::make_unique<DbSocket>(m_socketPath);
+        connection.socket->connect([&connection](const char* body, uint32_t bodySize, const char*, uint32_t)
+                                   { connection.onResponse(body, bodySize); });
     }
 
-    void query(const std::string& query, nlohmann::json& response)
+    /**
+     * @brief Replaces the socket of a connection, so the late response of a timed out query is not taken as the
+     * response of the next one.
+     */
+    void reconnect(Connection& connection)
     {
-        // Acquire lock to avoid multiple threads sending queries at the same time
-        std::scoped_lock lockMessage {m_mutexMessage};
+        std::scoped_lock lock {connection.mutexSocket};
+        connection.socket.reset();
+
+        if (!m_teardown)
+        {
+            connect(connection);
+        }
+    }
+
+    Connection* acquire(const std::optional<std::chrono::steady_clock::time_point>& deadline)
+    {
+        std::unique_lock lock {m_mutexPool};
 
         if (m_teardown)
+        {
+            return nullptr;
+        }
+
+        if (m_connections.empty())
+        {
+            throw std::runtime_error("Socket DB Wrapper not initialized");
+        }
+
+        const auto available = [this] { return !m_idleConnections.empty() || m_teardown; };
+        if (!deadline.has_value())
+        {
+            m_poolConditionVariable.wait(lock, available);
+        }
+        else if (!m_poolConditionVariable.wait_until(lock, deadline.value(), available))
+        {
+            throw std::runtime_error("DB query timeout waiting for a connection");
+        }
+
+        if (m_teardown)
+        {
+            return nullptr;
+        }
+
+        auto connection = m_idleConnections.back();
+        m_idleConnections.pop_back();
+        return connection;
+    }
+
+    void release(Connection* connection)
+    {
+        {
+            std::scoped_lock lock {m_mutexPool};
+            m_idleConnections.push_back(connection);
+        }
+        m_poolConditionVariable.notify_one();
+    }
+
+public:
+    /**
+     * @brief Initializes the pool of connections to wazuh-db.
+     *
+     * @param socketPath wazuh-db socket path.
+     * @param connections Number of connections, that is, queries in flight at the same time.
+     */
+    void init(const std::string& socketPath = WDB_SOCKET, std::size_t connections = WDB_CONNECTIONS)
+    {
+        std::scoped_lock lock {m_mutexPool};
+
+        m_teardown = false;
+        m_socketPath = socketPath;
+        m_idleConnections.clear();
+        m_connections.clear();
+
+        for (std::size_t i = 0; i < std::max<std::size_t>(connections, 1); ++i)
+        {
+            auto connection = std::make_unique<Connection>();
+            connect(*connection);
+            m_idleConnections.push_back(connection.get());
+            m_connections.push_back(std::move(connection));
+        }
+        m_poolConditionVariable.notify_all();
+    }
+
+    /**
+     * @brief Sends a query to wazuh-db through an idle connection of the pool and waits for its response.
+     *
+     * @param query Query to send.
+     * @param response Response of the query.
+     * @param timeout Maximum time waiting for a connection and the response, zero waits forever.
+     */
+    void query(const std::string& query,
+               nlohmann::json& response,
+               std::chrono::milliseconds timeout = std::chrono::milliseconds::zero())
+    {
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+        if (timeout > std::chrono::milliseconds::zero())
+        {
+            deadline = std::chrono::steady_clock::now() + timeout;
+        }
+
+        auto connection = acquire(deadline);
+        if (connection == nullptr)
         {
             return;
         }
+        const std::unique_ptr<Connection, std::function<void(Connection*)>> lease {
+            connection, [this](Connection* leased) { release(leased); }};
 
-        // Acquire lock before clearing the response
-        std::unique_lock lockResponse {m_mutexResponse};
+        {
+            // Acquire lock before clearing the response
+            std::scoped_lock lockResponse {connection->mutexResponse};
 
-        m_dataReady = false;
-        m_response.clear();
-        m_responsePartial.clear();
-        // coverity[missing_lock]
-        m_exceptionStr.clear();
+            connection->dataReady = false;
+            connection->response.clear();
+            connection->responsePartial.clear();
+            connection->exceptionStr.clear();
+            connection->queryStatus = DbQueryStatus::UNKNOWN;
+        }
 
-        if (!m_dbSocket)
         {
-            throw std::runtime_error("Socket DB Wrapper not initialized");
+            // The response lock is not held while sending, stopping the socket waits for its read callback
+            std::scoped_lock lockSocket {connection->mutexSocket};
+            if (!connection->socket)
+            {
+                return;
+            }
+            connection->socket->send(query.c_str(), query.size());
         }
 
-        m_dbSocket->send(query.c_str(), query.size());
-        m_conditionVariable.wait(lockResponse, [this] { return m_dataReady || m_teardown; });
+        std::unique_lock lockResponse {connection->mutexResponse};
+        const auto ready = [this, connection] { return connection->dataReady || m_teardown; };
+
+        if (!deadline.has_value())
+        {
+            connection->conditionVariable.wait(lockResponse, ready);
+        }
+        else if (!connection->conditionVariable.wait_until(lockResponse, deadline.value(), ready))
+        {
+            lockResponse.unlock();
+            reconnect(*connection);
+            throw std::runtime_error("DB query timeout: " + query);
+        }
 
-        if (!m_exceptionStr.empty())
+        if (!connection->exceptionStr.empty())
         {
-            // coverity[missing_lock]
-            switch (m_queryStatus)
+            switch (connection->queryStatus)
             {
-                case DbQueryStatus::QUERY_NOT_SYNCED: throw SocketDbWrapperException(m_exceptionStr); break;
+                case DbQueryStatus::QUERY_NOT_SYNCED: throw SocketDbWrapperException(connection->exceptionStr); break;
                 case DbQueryStatus::EMPTY_RESPONSE:
                 case DbQueryStatus::UNKNOWN:
                 case DbQueryStatus::QUERY_ERROR:
@@ -192,11 +333,11 @@ public:
                 case DbQueryStatus::QUERY_IGNORE:
                 case DbQueryStatus::JSON_PARSING:
                 case DbQueryStatus::INVALID_RESPONSE:
-                default: throw std::runtime_error(m_exceptionStr); break;
+                default: throw std::runtime_error(connection->exceptionStr); break;
             }
         }
 
-        response = m_response;
+        response = connection->response;
     }
 
     /**
@@ -205,9 +346,24 @@ public:
      */
     void teardown()
     {
+        std::scoped_lock lock {m_mutexPool};
+
         m_teardown = true;
-        m_conditionVariable.notify_all();
-        m_dbSocket->stop();
+        m_poolConditionVariable.notify_all();
+
+        for (const auto& connection : m_connections)
+        {
+            {
+                std::scoped_lock lockResponse {connection->mutexResponse};
+            }
+            connection->conditionVariable.notify_all();
+
+            std::scoped_lock lockSocket {connection->mutexSocket};
+            if (connection->socket)
+            {
+                connection->socket->stop();
+            }
+        }
     }
 };
 
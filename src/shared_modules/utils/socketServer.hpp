@@ -14,7 +14,10 @@
 #include "epollWrapper.hpp"
 #include "osPrimitives.hpp"
 #include "socketWrapper.hpp"
+#include "threadSafeQueue.h"
+#include <algorithm>
 #include <atomic>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <mutex>
@@ -23,6 +26,7 @@
 #include <sys/epoll.h>
 #include <thread>
 #include <unordered_map>
+#include <vector>
 
 constexpr auto EVENTS_LIMIT = 1024;
 constexpr auto EVENTS = 32;
@@ -31,31 +35,67 @@ template<typename TSocket = Socket<OSPrimitives>, typename TEpoll = EpollWrapper
 class SocketServer final
 {
 private:
+    using ReadCallback = std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>;
+
+    /**
+     * @brief Event loop over a share of the clients, with its own epoll and clients table.
+     *
+     * The first reactor also accepts the connections, each client is handed to the reactor its descriptor hashes to.
+     */
+    struct Reactor final
+    {
+        std::unique_ptr<TEpoll> epoll {std::make_unique<TEpoll>()};
+        int stopFD[2] = {-1, -1};
+        std::unordered_map<int, std::shared_ptr<TSocket>> clients {};
+        std::mutex mutex;
+        std::thread thread;
+    };
+
+    /**
+     * @brief Worker running the read callbacks of a share of the clients, so the messages of each client keep their
+     * order.
+     */
+    struct Worker final
+    {
+        Utils::SafeQueue<std::function<void()>> queue;
+        std::thread thread;
+    };
+
     const std::string m_socketPath;
     std::atomic<bool> m_shouldStop;
-    int m_stopFD[2] = {-1, -1};
-    std::unique_ptr<TEpoll> m_epoll;
     std::unique_ptr<TSocket> m_listenSocket;
-    std::unordered_map<int, std::shared_ptr<TSocket>> m_clients {};
-    std::thread m_listenThread;
-    std::mutex m_mutex;
+    std::vector<std::unique_ptr<Reactor>> m_reactors;
+    const size_t m_numberOfWorkers;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    ReadCallback m_onRead;
+
+    Reactor& reactor(const int fd)
+    {
+        return *m_reactors[static_cast<size_t>(fd) % m_reactors.size()];
+    }
 
     std::shared_ptr<TSocket> getClient(const int fd)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
-        return m_clients.at(fd);
+        auto& owner {reactor(fd)};
+        std::lock_guard<std::mutex> lock {owner.mutex};
+        return owner.clients.at(fd);
     }
 
     void removeClient(const int fd)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
-        m_clients.erase(fd);
+        auto& owner {reactor(fd)};
+        std::lock_guard<std::mutex> lock {owner.mutex};
+        owner.clients.erase(fd);
     }
 
     void addClient(const int fd, std::shared_ptr<TSocket> client)
     {
-        std::lock_guard<std::mutex> lock {m_mutex};
-        m_clients[fd] = std::move(client);
+        auto& owner {reactor(fd)};
+        {
+            std::lock_guard<std::mutex> lock {owner.mutex};
+            owner.clients[fd] = std::move(client);
+        }
+        owner.epoll->addDescriptor(fd, EPOLLIN);
     }
 
     void sendPendingMessages(std::shared_ptr<TSocket> client)
@@ -63,7 +103,7 @@ private:
         try
         {
             client->sendUnsentMessages();
-            m_epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN);
+            reactor(client->fileDescriptor()).epoll->modifyDescriptor(client->fileDescriptor(), EPOLLIN);
         }
         catch (const std::exception& e)
         {
@@ -71,34 +111,140 @@ private:
         }
     }
 
+    /**
+     * @brief Hands a message over to the worker of its client, copied out of the client buffer.
+     */
+    void offload(const int fd, const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+    {
+        auto& worker {*m_workers[static_cast<size_t>(fd) % m_workers.size()]};
+        worker.queue.push(
+            [this, fd, body = std::string(data, size), header = std::string(dataHeader ? dataHeader : "", sizeHeader)]()
+            { m_onRead(fd, body.data(), body.size(), header.empty() ? nullptr : header.data(), header.size()); });
+    }
+
+    void run(Reactor& owner, const bool acceptor)
+    {
+        const ReadCallback onRead = m_workers.empty()
+                                        ? m_onRead
+                                        : ReadCallback {[this](const int fd,
+                                                               const char* data,
+                                                               uint32_t size,
+                                                               const char* dataHeader,
+                                                               uint32_t sizeHeader)
+                                                        { offload(fd, data, size, dataHeader, sizeHeader); }};
+
+        std::vector<struct epoll_event> events(EVENTS);
+        while (!m_shouldStop)
+        {
+            // Wait for events
+            auto numFDsReady = owner.epoll->wait(events.data(), events.size(), -1);
+
+            // Process events
+            for (int i = 0; i < numFDsReady; ++i)
+            {
+                auto eventFD {events.at(i).data.fd};
+                // If the event is on the server socket, then it's a new connection
+                if (acceptor && eventFD == m_listenSocket->fileDescriptor())
+                {
+                    try
+                    {
+                        const auto clientFD = m_listenSocket->accept();
+                        addClient(clientFD, std::make_shared<TSocket>(clientFD));
+                    }
+                    catch (const std::exception& e)
+                    {
+                        std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
+                    }
+                }
+                else if (eventFD == owner.stopFD[0])
+                {
+                    // Drain the byte from the stop_fd and break out of the loop
+                    char dummy;
+                    std::ignore = ::read(owner.stopFD[0], &dummy, sizeof(dummy));
+                    break;
+                }
+                else
+                {
+                    auto event = events.at(i).events;
+                    auto client {getClient(eventFD)};
+
+                    if (event & EPOLLOUT)
+                    {
+                        sendPendingMessages(client);
+                    }
+
+                    if (event & EPOLLIN)
+                    {
+                        try
+                        {
+                            client->read(onRead);
+                        }
+                        catch (const std::exception&)
+                        {
+                            // std::cerr << "Failed to read from client socket: " << e.what() << std::endl;
+                        }
+                    }
+
+                    if (event & EPOLLERR || event & EPOLLHUP)
+                    {
+                        removeClient(eventFD);
+                    }
+                }
+            }
+
+            // If we ran out of room in our events vector, double its size
+            if (numFDsReady == static_cast<int>(events.size()))
+            {
+                if (numFDsReady >= EVENTS_LIMIT)
+                {
+                    events.resize(events.size() * 2);
+                }
+            }
+        }
+    }
+
 public:
-    explicit SocketServer(std::string socketPath)
+    /**
+     * @brief Constructor.
+     *
+     * @param socketPath Path of the UNIX socket.
+     * @param reactors Number of event loop threads the clients are spread over.
+     * @param workers Number of threads running the read callbacks, 0 runs them on the event loop threads.
+     */
+    explicit SocketServer(std::string socketPath, const size_t reactors = 1, const size_t workers = 0)
         : m_socketPath {std::move(socketPath)}
         , m_shouldStop {false}
-        , m_epoll {std::make_unique<TEpoll>()}
         , m_listenSocket {std::make_unique<TSocket>()}
-        , m_clients {}
+        , m_numberOfWorkers {workers}
     {
-        int result = pipe(m_stopFD);
-        if (result == -1)
+        for (size_t i = 0; i < std::max<size_t>(reactors, 1); ++i)
         {
-            throw std::runtime_error("Failed to create stop pipe");
-        }
+            auto& owner {*m_reactors.emplace_back(std::make_unique<Reactor>())};
 
-        if (::fcntl(m_stopFD[0], F_SETFL, O_NONBLOCK) == -1)
-        {
-            throw std::runtime_error("Failed to set stop pipe to non-blocking");
-        }
+            int result = pipe(owner.stopFD);
+            if (result == -1)
+            {
+                throw std::runtime_error("Failed to create stop pipe");
+            }
+
+            if (::fcntl(owner.stopFD[0], F_SETFL, O_NONBLOCK) == -1)
+            {
+                throw std::runtime_error("Failed to set stop pipe to non-blocking");
+            }
 
-        // Add pipe to stop epoll
-        m_epoll->addDescriptor(m_stopFD[0], EPOLLIN | EPOLLET);
+            // Add pipe to stop epoll
+            owner.epoll->addDescriptor(owner.stopFD[0], EPOLLIN | EPOLLET);
+        }
     }
 
     ~SocketServer()
     {
         stop();
-        ::close(m_stopFD[0]);
-        ::close(m_stopFD[1]);
+        for (const auto& owner : m_reactors)
+        {
+            ::close(owner->stopFD[0]);
+            ::close(owner->stopFD[1]);
+        }
 
         std::filesystem::remove_all(m_socketPath);
     }
@@ -107,21 +253,39 @@ public:
     {
         m_shouldStop = true;
 
-        char dummy = 'x';
-        std::ignore = ::write(m_stopFD[1], &dummy, sizeof(dummy));
+        for (const auto& owner : m_reactors)
+        {
+            char dummy = 'x';
+            std::ignore = ::write(owner->stopFD[1], &dummy, sizeof(dummy));
+        }
 
-        if (m_listenThread.joinable())
+        for (const auto& owner : m_reactors)
         {
-            m_listenThread.join();
+            if (owner->thread.joinable())
+            {
+                owner->thread.join();
+            }
+        }
+
+        for (const auto& worker : m_workers)
+        {
+            worker->queue.cancel();
+            if (worker->thread.joinable())
+            {
+                worker->thread.join();
+            }
         }
-        m_epoll->deleteDescriptor(m_listenSocket->fileDescriptor());
+        m_workers.clear();
+
+        m_reactors.front()->epoll->deleteDescriptor(m_listenSocket->fileDescriptor());
         m_listenSocket->closeSocket();
     }
 
-    void listen(const std::function<void(const int, const char*, uint32_t, const char*, uint32_t)>& onRead)
+    void listen(const ReadCallback& onRead)
     {
         // Reset the stop flag
         m_shouldStop = false;
+        m_onRead = onRead;
 
         // Remove any existing socket file
         std::filesystem::remove(m_socketPath);
@@ -131,82 +295,34 @@ public:
         // Instance server socket
         m_listenSocket->listen(unixAddressBuilder.address(m_socketPath).data());
 
-        // Add server socket to epoll
-        m_epoll->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN);
+        // Add server socket to the epoll of the first reactor, the acceptor
+        m_reactors.front()->epoll->addDescriptor(m_listenSocket->fileDescriptor(), EPOLLIN);
 
-        m_listenThread = std::thread(
-            [&, onRead]()
-            {
-                std::vector<struct epoll_event> events(EVENTS);
-                while (!m_shouldStop)
+        for (size_t i = 0; i < m_numberOfWorkers; ++i)
+        {
+            auto& worker {*m_workers.emplace_back(std::make_unique<Worker>())};
+            worker.thread = std::thread(
+                [&worker]()
                 {
-                    // Wait for events
-                    auto numFDsReady = m_epoll->wait(events.data(), events.size(), -1);
-
-                    // Process events
-                    for (int i = 0; i < numFDsReady; ++i)
+                    std::function<void()> job;
+                    while (worker.queue.pop(job))
                     {
-                        auto eventFD {events.at(i).data.fd};
-                        // If the event is on the server socket, then it's a new connection
-                        if (eventFD == m_listenSocket->fileDescriptor())
+                        try
                         {
-                            try
-                            {
-                                const auto clientFD = m_listenSocket->accept();
-                                addClient(clientFD, std::make_shared<TSocket>(clientFD));
-                                m_epoll->addDescriptor(clientFD, EPOLLIN);
-                            }
-                            catch (const std::exception& e)
-                            {
-                                std::cerr << "Failed to initialize client socket: " << e.what() << std::endl;
-                            }
+                            job();
                         }
-                        else if (eventFD == m_stopFD[0])
+                        catch (const std::exception& e)
                         {
-                            // Drain the byte from the stop_fd and break out of the loop
-                            char dummy;
-                            std::ignore = ::read(m_stopFD[0], &dummy, sizeof(dummy));
-                            break;
-                        }
-                        else
-                        {
-                            auto event = events.at(i).events;
-                            auto client {getClient(eventFD)};
-
-                            if (event & EPOLLOUT)
-                            {
-                                sendPendingMessages(client);
-                            }
-
-                            if (event & EPOLLIN)
-                            {
-                                try
-                                {
-                                    client->read(onRead);
-                                }
-                                catch (const std::exception&)
-                                {
-                                    // std::cerr << "Failed to read from client socket: " << e.what() << std::endl;
-                                }
-                            }
-
-                            if (event & EPOLLERR || event & EPOLLHUP)
-                            {
-                                removeClient(eventFD);
-                            }
+                            std::cerr << "Read callback error: " << e.what() << std::endl;
                         }
                     }
+                });
+        }
 
-                    // If we ran out of room in our events vector, double its size
-                    if (numFDsReady == static_cast<int>(events.size()))
-                    {
-                        if (numFDsReady >= EVENTS_LIMIT)
-                        {
-                            events.resize(events.size() * 2);
-                        }
-                    }
-                }
-            });
+        for (size_t i = 0; i < m_reactors.size(); ++i)
+        {
+            m_reactors[i]->thread = std::thread([this, i]() { run(*m_reactors[i], i == 0); });
+        }
     }
 
     void send(int fd, const char* dataBody, size_t sizeBody, const char* dataHeader = nullptr, size_t sizeHeader = 0)
@@ -218,7 +334,7 @@ public:
         }
         catch (const std::exception& e)
         {
-            m_epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT);
+            reactor(fd).epoll->modifyDescriptor(fd, EPOLLIN | EPOLLOUT);
         }
     }
 };
@@ -16,6 +16,7 @@
 #include "packet.hpp"
 #include <arpa/inet.h>
 #include <chrono>
+#include <array>
 #include <cstring>
 #include <filesystem>
 #include <functional>
@@ -25,6 +26,7 @@
 #include <mutex>
 #include <queue>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <thread>
 #include <unistd.h>
 
@@ -35,6 +37,10 @@ using HeaderFieldType = uint32_t;
 constexpr auto PACKET_FIELD_SIZE {sizeof(PacketFieldType)};
 constexpr auto HEADER_FIELD_SIZE {sizeof(HeaderFieldType)};
 constexpr auto BUFFER_MAX_SIZE {8192 * 8};
+// Receive buffers grown up to this size are kept for the next packets, bigger ones are released.
+constexpr auto BUFFER_RETAIN_SIZE {1024 * 1024};
+// Size of the largest size fields of a packet, written before the optional header and the body.
+constexpr auto SIZE_FIELDS_MAX_SIZE {PACKET_FIELD_SIZE + HEADER_FIELD_SIZE};
 
 enum class SocketType
 {
@@ -167,6 +173,23 @@ public:
         bufferSize = sizeof(Header) + sizeHeader + sizeBody;
     }
 
+    /**
+     * @brief Write the size fields of a packet, sent followed by the optional header and the body.
+     *
+     * @param fields        Output, at least SIZE_FIELDS_MAX_SIZE bytes.
+     * @param sizeBody      Size of the data to send.
+     * @param sizeHeader    Size of the optional header.
+     * @param withHeader    Set if the optional header is sent.
+     * @return uint32_t     Size of the fields.
+     */
+    uint32_t static buildSizeFields(char* fields, uint32_t sizeBody, uint32_t sizeHeader, bool& withHeader)
+    {
+        const Header header {sizeBody + static_cast<uint32_t>(sizeof(Header::headerSize)) + sizeHeader, sizeHeader};
+        std::memcpy(fields, &header, sizeof(Header));
+        withHeader = sizeHeader > 0;
+        return sizeof(Header);
+    }
+
     /**
      * @brief Get the size of the header according to this protocol.
      *
@@ -249,6 +272,23 @@ public:
         bufferSize = sizeof(Header) + sizeBody;
     }
 
+    /**
+     * @brief Write the size fields of a packet, sent followed by the body.
+     *
+     * @param fields        Output, at least SIZE_FIELDS_MAX_SIZE bytes.
+     * @param sizeBody      Size of the data to send.
+     * @param sizeHeader    Size of the optional header, not sent by this protocol.
+     * @param withHeader    Set if the optional header is sent.
+     * @return uint32_t     Size of the fields.
+     */
+    uint32_t static buildSizeFields(char* fields, uint32_t sizeBody, uint32_t sizeHeader, bool& withHeader)
+    {
+        const Header header {sizeBody};
+        std::memcpy(fields, &header, sizeof(Header));
+        withHeader = false;
+        return sizeof(Header);
+    }
+
     /**
      * @brief Get the size of the header according to this protocol.
      *
@@ -325,6 +365,21 @@ public:
         bufferSize = sizeBody;
     }
 
+    /**
+     * @brief Write the size fields of a packet, none for this protocol.
+     *
+     * @param fields        Output, at least SIZE_FIELDS_MAX_SIZE bytes.
+     * @param sizeBody      Size of the data to send.
+     * @param sizeHeader    Size of the optional header, not sent by this protocol.
+     * @param withHeader    Set if the optional header is sent.
+     * @return uint32_t     Size of the fields.
+     */
+    uint32_t static buildSizeFields(char* fields, uint32_t sizeBody, uint32_t sizeHeader, bool& withHeader)
+    {
+        withHeader = false;
+        return 0;
+    }
+
     /**
      * @brief Get the size of the header according to this protocol.
      *
@@ -385,7 +440,6 @@ private:
     uint32_t m_readSize;
     uint32_t m_totalReadSize;
     std::vector<char> m_recvDataBuffer {};
-    std::vector<char> m_sendDataBuffer {};
     std::queue<Packet> m_unsentPacketList {};
     std::mutex m_mutex;
 
@@ -397,11 +451,9 @@ public:
         , m_readSize {PACKET_FIELD_SIZE}
         , m_totalReadSize {0}
         , m_recvDataBuffer {}
-        , m_sendDataBuffer {}
         , m_unsentPacketList {}
     {
         m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
-        m_sendDataBuffer.resize(BUFFER_MAX_SIZE);
     }
 
     virtual ~Socket()
@@ -419,11 +471,6 @@ public:
         return m_recvDataBuffer.size();
     }
 
-    size_t sendBufferSize()
-    {
-        return m_sendDataBuffer.size();
-    }
-
     bool hasUnsentMessages()
     {
         std::lock_guard<std::mutex> lock {m_mutex};
@@ -515,7 +562,8 @@ public:
                             uip = (uint32_t*)m_recvDataBuffer.data();
                             m_totalReadSize = *uip;
 
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
+                            // The buffer only grows, the packets that fit reuse it as is.
+                            if (m_totalReadSize >= m_recvDataBuffer.size())
                             {
                                 m_recvDataBuffer.resize(m_totalReadSize + 1);
                             }
@@ -573,9 +621,9 @@ public:
                                      m_recvDataBuffer.data() + headerOffset,
                                      headerDataSize);
 
-                            if (m_totalReadSize > BUFFER_MAX_SIZE)
+                            if (m_recvDataBuffer.size() > BUFFER_RETAIN_SIZE)
                             {
-                                m_recvDataBuffer.resize(BUFFER_MAX_SIZE);
+                                m_recvDataBuffer = std::vector<char>(BUFFER_MAX_SIZE);
                             }
                         }
                     }
@@ -663,34 +711,65 @@ public:
 
     void send(const char* dataBody, uint32_t sizeBody, const char* dataHeader = nullptr, uint32_t sizeHeader = 0)
     {
-        uint32_t bufferSize {0};
-        ssize_t amountSent {0};
-        std::lock_guard<std::mutex> lock {m_mutex};
+        std::array<char, SIZE_FIELDS_MAX_SIZE> sizeFields {};
+        bool withHeader {false};
+        const auto sizeFieldsSize =
+            TCommunicationProtocol::buildSizeFields(sizeFields.data(), sizeBody, sizeHeader, withHeader);
+
+        // The size fields, the optional header and the body are sent from where they are, without copying them.
+        std::array<iovec, 3> vectors {};
+        size_t count {0};
+        size_t total {0};
+        const auto add = [&vectors, &count, &total](const char* data, size_t size)
+        {
+            if (size > 0)
+            {
+                vectors[count++] = iovec {const_cast<char*>(data), size};
+                total += size;
+            }
+        };
+        add(sizeFields.data(), sizeFieldsSize);
+        add(dataHeader, withHeader ? sizeHeader : 0);
+        add(dataBody, sizeBody);
 
-        TCommunicationProtocol::buildBuffer(m_sendDataBuffer, bufferSize, dataBody, sizeBody, dataHeader, sizeHeader);
+        std::lock_guard<std::mutex> lock {m_mutex};
 
         // If there is data in the unsent queue, add it to the queue.
         if (!m_unsentPacketList.empty())
         {
-            m_unsentPacketList.emplace(m_sendDataBuffer.data(), bufferSize);
+            m_unsentPacketList.emplace(vectors.data(), count);
+            return;
         }
-        else
+
+        // Send the data.
+        auto* pending = vectors.data();
+        while (total > 0)
         {
-            // Send the data.
-            while (bufferSize != amountSent)
+            msghdr message {};
+            message.msg_iov = pending;
+            message.msg_iovlen = count;
+
+            const auto ret = T::sendmsg(m_sock, &message, MSG_NOSIGNAL);
+
+            if (ret <= 0)
             {
-                const auto ret =
-                    T::send(m_sock, m_sendDataBuffer.data() + amountSent, bufferSize - amountSent, MSG_NOSIGNAL);
+                m_unsentPacketList.emplace(pending, count);
+                throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
+            }
 
-                if (ret <= 0)
-                {
-                    m_unsentPacketList.emplace(m_sendDataBuffer.data() + amountSent, bufferSize - amountSent);
-                    throw std::runtime_error {"Error sending data to socket: " + std::string(std::strerror(errno))};
-                }
-                else
-                {
-                    amountSent += ret;
-                }
+            // Skip what has been sent, the vectors sent in part are resumed from where they were left.
+            total -= ret;
+            auto sent = static_cast<size_t>(ret);
+            while (count > 0 && sent >= pending->iov_len)
+            {
+                sent -= pending->iov_len;
+                ++pending;
+                --count;
+            }
+            if (count > 0)
+            {
+                pending->iov_base = static_cast<char*>(pending->iov_base) + sent;
+                pending->iov_len -= sent;
             }
         }
     }
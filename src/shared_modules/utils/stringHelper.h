@@ -18,6 +18,7 @@
 #include <regex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #pragma GCC diagnostic push
@@ -134,13 +135,19 @@ namespace Utils
 
     static std::vector<std::string> split(const std::string& str, const char delimiter)
     {
+        // Same tokens as reading them with std::getline, without the stream: no trailing empty token.
         std::vector<std::string> tokens;
-        std::string token;
-        std::istringstream tokenStream {str};
+        std::string_view rest {str};
 
-        while (std::getline(tokenStream, token, delimiter))
+        while (!rest.empty())
         {
-            tokens.push_back(token);
+            const auto pos {rest.find(delimiter)};
+            tokens.emplace_back(rest.substr(0, pos));
+            if (pos == std::string_view::npos)
+            {
+                break;
+            }
+            rest.remove_prefix(pos + 1);
         }
 
         return tokens;
@@ -0,0 +1,202 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _SYSCOLLECTOR_BATCH_HPP
+#define _SYSCOLLECTOR_BATCH_HPP
+
+#include "flatbuffers/include/syscollector_deltas_generated.h"
+#include "flatbuffers/include/syscollector_synchronization_generated.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Utils
+{
+    // Alignment of the items, so the doubles and longs of the item buffers can be read in place.
+    constexpr auto SYSCOLLECTOR_BATCH_ITEM_ALIGNMENT {8};
+    constexpr auto SYSCOLLECTOR_BATCH_INITIAL_SIZE {64 * 1024};
+
+    /**
+     * @brief Agent of the messages of a batch.
+     */
+    struct SyscollectorBatchAgent final
+    {
+        std::string id;      ///< Agent ID.
+        std::string ip;      ///< Agent IP.
+        std::string name;    ///< Agent name.
+        std::string version; ///< Agent version.
+    };
+
+    /**
+     * @brief Tables of the batches of syscollector deltas.
+     */
+    struct DeltaBatchTraits final
+    {
+        using Batch = SyscollectorDeltas::DeltaBatch;
+        using Item = SyscollectorDeltas::DeltaBatchItem;
+        using Items = flatbuffers::Vector<flatbuffers::Offset<Item>>;
+
+        static flatbuffers::Offset<Item> createItem(flatbuffers::FlatBufferBuilder& builder,
+                                                    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> buffer)
+        {
+            return SyscollectorDeltas::CreateDeltaBatchItem(builder, buffer);
+        }
+
+        static flatbuffers::Offset<Batch> createBatch(flatbuffers::FlatBufferBuilder& builder,
+                                                      const SyscollectorBatchAgent& agent,
+                                                      flatbuffers::Offset<Items> items)
+        {
+            const auto agentInfo {SyscollectorDeltas::CreateAgentInfoDirect(
+                builder, agent.id.c_str(), agent.ip.c_str(), agent.name.c_str(), agent.version.c_str())};
+            return SyscollectorDeltas::CreateDeltaBatch(builder, agentInfo, items);
+        }
+
+        static const flatbuffers::Vector<uint8_t>* buffer(const Item* item)
+        {
+            return item->delta();
+        }
+    };
+
+    /**
+     * @brief Tables of the batches of syscollector synchronization messages.
+     */
+    struct SyncBatchTraits final
+    {
+        using Batch = SyscollectorSynchronization::SyncBatch;
+        using Item = SyscollectorSynchronization::SyncBatchItem;
+        using Items = flatbuffers::Vector<flatbuffers::Offset<Item>>;
+
+        static flatbuffers::Offset<Item> createItem(flatbuffers::FlatBufferBuilder& builder,
+                                                    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> buffer)
+        {
+            return SyscollectorSynchronization::CreateSyncBatchItem(builder, buffer);
+        }
+
+        static flatbuffers::Offset<Batch> createBatch(flatbuffers::FlatBufferBuilder& builder,
+                                                      const SyscollectorBatchAgent& agent,
+                                                      flatbuffers::Offset<Items> items)
+        {
+            const auto agentInfo {SyscollectorSynchronization::CreateAgentInfoDirect(
+                builder, agent.id.c_str(), agent.ip.c_str(), agent.name.c_str(), agent.version.c_str())};
+            return SyscollectorSynchronization::CreateSyncBatch(builder, agentInfo, items);
+        }
+
+        static const flatbuffers::Vector<uint8_t>* buffer(const Item* item)
+        {
+            return item->msg();
+        }
+    };
+
+    /**
+     * @brief Builds a batch with the serialized messages of an agent, to send them in a single buffer.
+     *
+     * @tparam TTraits Tables of the batch.
+     */
+    template<typename TTraits>
+    class SyscollectorBatchBuilder final
+    {
+    public:
+        explicit SyscollectorBatchBuilder(const size_t initialSize = SYSCOLLECTOR_BATCH_INITIAL_SIZE)
+            : m_builder {initialSize}
+        {
+        }
+
+        /**
+         * @brief Adds a serialized message to the batch.
+         *
+         * @param buffer Message buffer, a Delta or a SyncMsg depending on the batch.
+         * @param size Size of the buffer.
+         */
+        void add(const uint8_t* buffer, const size_t size)
+        {
+            m_builder.ForceVectorAlignment(size, sizeof(uint8_t), SYSCOLLECTOR_BATCH_ITEM_ALIGNMENT);
+            m_items.push_back(TTraits::createItem(m_builder, m_builder.CreateVector(buffer, size)));
+        }
+
+        /**
+         * @brief Gets the number of messages of the batch.
+         */
+        size_t size() const
+        {
+            return m_items.size();
+        }
+
+        /**
+         * @brief Gets the bytes written so far, to flush the batch before it grows too big.
+         */
+        size_t bytes() const
+        {
+            return m_builder.GetSize();
+        }
+
+        /**
+         * @brief Finishes the batch and starts a new one.
+         *
+         * @param agent Agent of the messages.
+         * @return std::vector<char> Batch buffer.
+         */
+        std::vector<char> finish(const SyscollectorBatchAgent& agent)
+        {
+            const auto items {m_builder.CreateVector(m_items)};
+            m_builder.Finish(TTraits::createBatch(m_builder, agent, items));
+
+            const auto data {reinterpret_cast<const char*>(m_builder.GetBufferPointer())};
+            std::vector<char> batch(data, data + m_builder.GetSize());
+
+            m_builder.Clear();
+            m_items.clear();
+            return batch;
+        }
+
+    private:
+        flatbuffers::FlatBufferBuilder m_builder;
+        std::vector<flatbuffers::Offset<typename TTraits::Item>> m_items;
+    };
+
+    using DeltaBatchBuilder = SyscollectorBatchBuilder<DeltaBatchTraits>;
+    using SyncBatchBuilder = SyscollectorBatchBuilder<SyncBatchTraits>;
+
+    /**
+     * @brief Verifies a batch once, along with its items, and hands over each item buffer in order.
+     *
+     * @tparam TTraits Tables of the batch.
+     * @param data Batch buffer.
+     * @param size Size of the buffer.
+     * @param callback Called with the agent ID of the batch, null if not set, and the buffer of each item.
+     * @return true if the batch is valid, false otherwise and the callback is not called.
+     */
+    template<typename TTraits, typename TCallback>
+    bool readSyscollectorBatch(const uint8_t* data, const size_t size, TCallback callback)
+    {
+        if (flatbuffers::Verifier verifier(data, size); !verifier.VerifyBuffer<typename TTraits::Batch>(nullptr))
+        {
+            return false;
+        }
+
+        const auto batch {flatbuffers::GetRoot<typename TTraits::Batch>(data)};
+        const auto agentId {batch->agent_info() ? batch->agent_info()->agent_id() : nullptr};
+
+        if (const auto items {batch->items()}; items)
+        {
+            for (const auto* item : *items)
+            {
+                if (const auto buffer {TTraits::buffer(item)}; buffer && buffer->size() > 0)
+                {
+                    callback(agentId, buffer);
+                }
+            }
+        }
+
+        return true;
+    }
+} // namespace Utils
+
+#endif // _SYSCOLLECTOR_BATCH_HPP
@@ -110,3 +110,19 @@ TEST_F(HashHelperTest, HashFileInexistantFile)
 {
     EXPECT_THROW(Utils::hashFile(INPUT_FILES_DIR / "inexistant_file.xml"), std::runtime_error);
 }
+
+/**
+ * @brief Test the hashing of an empty file, which has no mapping.
+ *
+ */
+TEST_F(HashHelperTest, HashFileEmptyFile)
+{
+    // SHA1 of no data.
+    const std::vector<unsigned char> expectedHash { 0xda, 0x39, 0xa3, 0xee, 0x5e, 0x6b, 0x4b, 0x0d, 0x32, 0x55,
+                                                    0xbf, 0xef, 0x95, 0x60, 0x18, 0x90, 0xaf, 0xd8, 0x07, 0x09};
+    const auto emptyFile {std::filesystem::temp_directory_path() / "hashHelper_empty_file"};
+    std::ofstream {emptyFile};
+
+    EXPECT_EQ(Utils::hashFile(emptyFile), expectedHash);
+    std::filesystem::remove(emptyFile);
+}
@@ -687,3 +687,154 @@ TEST_F(JsonArrayParserTest, InexistentFile)
     // Start the parse and expect an exception
     ASSERT_THROW(JsonArray::parse(testFilepath, callback, testArrayPointer), std::runtime_error);
 }
+
+/**
+ * @brief The parallel parse hands over the same items, ids and body as the serial one, in the same order.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseKeepsTheOrder)
+{
+    // Setup the input data, with separators and brackets inside the strings and the keys
+    nlohmann::json testJson;
+    testJson["some_key"] = "some, [value]";
+    testJson["a/b"]["key \"with\" quotes"] = nlohmann::json::array();
+    for (auto i = 0; i < 5000; ++i)
+    {
+        switch (i % 5)
+        {
+            case 0: testJson["a/b"]["key \"with\" quotes"].push_back({{"id", i}, {"text", "a, \"b\" ]} \\"}}); break;
+            case 1: testJson["a/b"]["key \"with\" quotes"].push_back(i); break;
+            case 2: testJson["a/b"]["key \"with\" quotes"].push_back(nlohmann::json::array({i, {{"x", "]"}}})); break;
+            case 3: testJson["a/b"]["key \"with\" quotes"].push_back("]," + std::to_string(i)); break;
+            default: testJson["a/b"]["key \"with\" quotes"].push_back(nullptr); break;
+        }
+    }
+    testJson["other"] = {{"key", {1, 2}}};
+    const auto testArrayPointer {"/a~1b/key \"with\" quotes"_json_pointer};
+    const auto testFilepath {m_testFolder / "ParallelParseKeepsTheOrder.json"};
+    createTestFile(testJson.dump(2), testFilepath);
+
+    std::vector<std::pair<nlohmann::json, size_t>> expectedItems;
+    nlohmann::json expectedBody;
+    JsonArray::parse(
+        testFilepath,
+        [&](nlohmann::json&& item, const size_t itemId)
+        {
+            expectedItems.emplace_back(std::move(item), itemId);
+            return true;
+        },
+        testArrayPointer,
+        [&](nlohmann::json&& body) { expectedBody = std::move(body); });
+
+    std::vector<std::pair<nlohmann::json, size_t>> items;
+    nlohmann::json body;
+    ASSERT_NO_THROW(JsonArray::parallelParse<nlohmann::json>(
+        testFilepath,
+        [](nlohmann::json&& item) { return std::move(item); },
+        [&](nlohmann::json&& item, const size_t itemId)
+        {
+            items.emplace_back(std::move(item), itemId);
+            return true;
+        },
+        testArrayPointer,
+        4,
+        [&](nlohmann::json&& parsedBody) { body = std::move(parsedBody); },
+        16));
+
+    EXPECT_EQ(items.size(), 5000);
+    EXPECT_EQ(items, expectedItems);
+    EXPECT_EQ(body, expectedBody);
+    EXPECT_TRUE(body.at("/a~1b/key \"with\" quotes"_json_pointer).empty());
+}
+
+/**
+ * @brief The parallel parse finds the target array through the indexes of the parent arrays.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseTopLevelAndNestedArrays)
+{
+    const auto testFilepath {m_testFolder / "ParallelParseNestedArrays.json"};
+    createTestFile(R"([["the", "first", "array"], ["the", "second", "array"]])", testFilepath);
+
+    std::vector<std::string> items;
+    auto collect = [&](std::string&& item, const size_t /*itemId*/)
+    {
+        items.push_back(std::move(item));
+        return true;
+    };
+    auto toString = [](nlohmann::json&& item) { return item.dump(); };
+
+    ASSERT_NO_THROW(JsonArray::parallelParse<std::string>(testFilepath, toString, collect, "/1"_json_pointer, 2));
+    EXPECT_EQ(items, (std::vector<std::string> {R"("the")", R"("second")", R"("array")"}));
+
+    items.clear();
+    ASSERT_NO_THROW(JsonArray::parallelParse<std::string>(testFilepath, toString, collect));
+    EXPECT_EQ(items, (std::vector<std::string> {R"(["the","first","array"])", R"(["the","second","array"])"}));
+
+    ASSERT_THROW(JsonArray::parallelParse<std::string>(testFilepath, toString, collect, "/2"_json_pointer),
+                 std::runtime_error);
+}
+
+/**
+ * @brief The parallel parse stops when the callback returns false, the body callback is not called.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseStopParsing)
+{
+    nlohmann::json testJson;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        testJson["test_array"].push_back({{"id", i}});
+    }
+    const auto testFilepath {m_testFolder / "ParallelParseStopParsing.json"};
+    createTestFile(testJson.dump(), testFilepath);
+
+    size_t itemCallbackCounter {0};
+    ASSERT_NO_THROW(JsonArray::parallelParse<int>(
+        testFilepath,
+        [](nlohmann::json&& item) { return item.at("id").get<int>(); },
+        [&](int&& id, const size_t itemId)
+        {
+            EXPECT_EQ(static_cast<size_t>(id) + 1, itemId);
+            return ++itemCallbackCounter < 2;
+        },
+        "/test_array"_json_pointer,
+        4,
+        [](nlohmann::json&&) { FAIL() << "The body callback should not have been called."; }));
+
+    EXPECT_EQ(itemCallbackCounter, 2);
+}
+
+/**
+ * @brief The errors of the items and of the callbacks are rethrown by the parallel parse.
+ *
+ */
+TEST_F(JsonArrayParserTest, ParallelParseErrors)
+{
+    const auto testFilepath {m_testFolder / "ParallelParseErrors.json"};
+    createTestFile(R"({"test_array": [{"id": 1}, {"id": }, {"id": 3}]})", testFilepath);
+    auto identity = [](nlohmann::json&& item) { return std::move(item); };
+    auto accept = [](nlohmann::json&& /*item*/, const size_t /*itemId*/) { return true; };
+
+    ASSERT_THROW(JsonArray::parallelParse<nlohmann::json>(testFilepath, identity, accept, "/test_array"_json_pointer),
+                 nlohmann::detail::parse_error);
+
+    createTestFile(R"({"test_array": [{"id": 1}, {"id": 2}, {"id": 3}]})", testFilepath);
+    ASSERT_THROW(JsonArray::parallelParse<nlohmann::json>(
+                     testFilepath,
+                     [](nlohmann::json&& item) -> nlohmann::json
+                     {
+                         if (item.at("id") == 2)
+                         {
+                             throw std::runtime_error("Invalid item");
+                         }
+                         return std::move(item);
+                     },
+                     accept,
+                     "/test_array"_json_pointer),
+                 std::runtime_error);
+
+    ASSERT_THROW(JsonArray::parallelParse<nlohmann::json>(
+                     m_testFolder / "inexistent.json", identity, accept, "/test_array"_json_pointer),
+                 std::runtime_error);
+}
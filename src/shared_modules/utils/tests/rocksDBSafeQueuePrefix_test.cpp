@@ -10,6 +10,7 @@
  */
 
 #include "rocksDBSafeQueuePrefix_test.hpp"
+#include <chrono>
 #include <filesystem>
 #include <thread>
 
@@ -113,6 +114,105 @@ TEST_F(RocksDBSafeQueuePrefixTest, PopWithMultipleIDData)
     EXPECT_TRUE(queue->empty());
 }
 
+TEST_F(RocksDBSafeQueuePrefixTest, PushBulk)
+{
+    queue->push("agent1", "first");
+    queue->pushBulk("agent1", {"second", "third"});
+    queue->pushBulk("agent2", {"other"});
+    queue->pushBulk("agent3", {});
+
+    EXPECT_EQ(3, queue->size("agent1"));
+    EXPECT_EQ(1, queue->size("agent2"));
+    EXPECT_EQ(0, queue->size("agent3"));
+
+    for (const auto& [prefix, expected] : std::vector<std::pair<std::string, std::string>> {
+             {"agent1", "first"}, {"agent2", "other"}, {"agent1", "second"}, {"agent1", "third"}})
+    {
+        auto front {queue->front()};
+        ASSERT_EQ(prefix, front.second);
+        EXPECT_EQ(expected, front.first);
+        queue->pop(front.second);
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, RoundRobinFront)
+{
+    queue->pushBulk("agent1", {"a1", "a2", "a3"});
+    queue->pushBulk("agent2", {"b1"});
+    queue->pushBulk("agent3", {"c1", "c2"});
+
+    for (const auto* expected : {"a1", "b1", "c1", "a2", "c2", "a3"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        queue->pop(front.second);
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, ClaimFrontSkipsClaimedPrefixes)
+{
+    queue->pushBulk("agent1", {"a1", "a2"});
+    queue->pushBulk("agent2", {"b1"});
+
+    auto first {queue->claimFront()};
+    EXPECT_EQ("agent1", first.second);
+    EXPECT_EQ("a1", first.first);
+
+    // agent1 is claimed, so its next element isn't handed out.
+    auto second {queue->claimFront()};
+    EXPECT_EQ("agent2", second.second);
+    EXPECT_EQ("b1", second.first);
+    queue->release(second.second, true);
+
+    // The failed element stays at the head of its prefix.
+    queue->release(first.second, false);
+    first = queue->claimFront();
+    EXPECT_EQ("a1", first.first);
+    queue->release(first.second, true);
+
+    first = queue->claimFront();
+    EXPECT_EQ("a2", first.first);
+    queue->release(first.second, true);
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, PostponedPrefixesAreSkipped)
+{
+    queue->pushBulk("agent1", {"a1", "a2"});
+    queue->pushBulk("agent2", {"b1"});
+    queue->pushBulk("agent3", {"c1"});
+
+    queue->postpone("agent1", std::chrono::seconds(60));
+    queue->postpone("agent3", std::chrono::seconds(60));
+
+    // Postponing again moves the deadline, a zero postpone makes the prefix ready right away.
+    queue->postpone("agent3", std::chrono::seconds(0));
+
+    for (const auto* expected : {"b1", "c1"})
+    {
+        auto front {queue->front()};
+        EXPECT_EQ(expected, front.first);
+        queue->pop(front.second);
+    }
+
+    // Only the postponed prefix is left.
+    EXPECT_TRUE(queue->empty());
+    EXPECT_EQ(2u, queue->size("agent1"));
+
+    // Pushing to a postponed prefix doesn't make it ready.
+    queue->push("agent1", "a3");
+    EXPECT_TRUE(queue->empty());
+
+    queue->clear("agent1");
+    queue->push("agent1", "a4");
+    EXPECT_FALSE(queue->empty());
+    EXPECT_EQ("a4", queue->front().first);
+}
+
 TEST_F(RocksDBSafeQueuePrefixTest, BlockingPopByRef)
 {
     std::thread t1 {[this]()
@@ -184,3 +284,69 @@ TEST_F(RocksDBSafeQueuePrefixTest, ClearAllQueue)
     EXPECT_EQ(0, queue->size("001"));
     EXPECT_TRUE(queue->empty());
 }
+
+TEST_F(RocksDBSafeQueuePrefixTest, ReopenRestoresQueuesFromMetadata)
+{
+    queue->push("agent1", "first");
+    queue->pushBulk("agent1", {"second", "third"});
+    queue->push("agent2", "other");
+    queue->push("agent3", "cleared");
+    queue->pop("agent1");
+    queue->clear("agent3");
+
+    queue.reset();
+    queue = std::make_unique<Utils::TSafeMultiQueue<std::string, std::string, RocksDBQueueCF<std::string>>>(
+        RocksDBQueueCF<std::string>("test.db"));
+
+    EXPECT_EQ(2u, queue->size("agent1"));
+    EXPECT_EQ(1, queue->size("agent2"));
+    EXPECT_EQ(0, queue->size("agent3"));
+
+    for (const auto& [prefix, expected] : std::vector<std::pair<std::string, std::string>> {
+             {"agent1", "second"}, {"agent2", "other"}, {"agent1", "third"}})
+    {
+        auto front {queue->front()};
+        ASSERT_EQ(prefix, front.second);
+        EXPECT_EQ(expected, front.first);
+        queue->pop(front.second);
+    }
+
+    EXPECT_TRUE(queue->empty());
+}
+
+TEST_F(RocksDBSafeQueuePrefixTest, RebuildsMissingMetadata)
+{
+    const std::string DATABASE_NAME {"legacy.db"};
+    std::error_code ec;
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+
+    // Database written before the metadata column existed.
+    {
+        rocksdb::Options options;
+        options.create_if_missing = true;
+        rocksdb::DB* db;
+        ASSERT_TRUE(rocksdb::DB::Open(options, DATABASE_NAME, &db).ok());
+        for (const auto& key : {"agent1_8", "agent1_9", "agent1_10", "agent2_7"})
+        {
+            ASSERT_TRUE(db->Put(rocksdb::WriteOptions(), key, key).ok());
+        }
+        delete db;
+    }
+
+    {
+        RocksDBQueueCF<std::string> legacy(DATABASE_NAME);
+        EXPECT_EQ(3, legacy.size("agent1"));
+        EXPECT_EQ(1, legacy.size("agent2"));
+        legacy.push("agent2", "new");
+    }
+
+    // The second time, the queues are restored from the metadata built the first time.
+    RocksDBQueueCF<std::string> legacy(DATABASE_NAME);
+    EXPECT_EQ(3, legacy.size("agent1"));
+    EXPECT_EQ(2, legacy.size("agent2"));
+    EXPECT_EQ("agent1_8", legacy.front("agent1"));
+    legacy.pop("agent2");
+    EXPECT_EQ("new", legacy.front("agent2"));
+
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+}
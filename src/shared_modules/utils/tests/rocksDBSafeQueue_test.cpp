@@ -157,3 +157,96 @@ TEST_F(RocksDBSafeQueueTest, CreateFolderRecursively)
     std::error_code ec;
     std::filesystem::remove_all(DATABASE_NAME, ec);
 }
+
+TEST_F(RocksDBSafeQueueTest, GetBulkAndPopBulk)
+{
+    for (int i = 0; i < 300; i++)
+    {
+        queue->push(std::to_string(i));
+    }
+
+    auto bulk {queue->getBulk(100, std::chrono::seconds(0))};
+    ASSERT_EQ(100, bulk.size());
+    for (int i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(std::to_string(i), bulk.front());
+        bulk.pop();
+    }
+    EXPECT_EQ(300, queue->size());
+
+    queue->popBulk(100);
+    EXPECT_EQ(200, queue->size());
+
+    bulk = queue->getBulkAndPop(500, std::chrono::seconds(0));
+    ASSERT_EQ(200, bulk.size());
+    EXPECT_EQ("100", bulk.front());
+    EXPECT_EQ("299", bulk.back());
+    EXPECT_TRUE(queue->empty());
+
+    queue->push("last");
+    std::string value;
+    EXPECT_TRUE(queue->pop(value, false));
+    EXPECT_EQ("last", value);
+}
+
+TEST_F(RocksDBSafeQueueTest, ReopenKeepsNumericOrder)
+{
+    constexpr auto DATABASE_NAME {"test_reopen.db"};
+    std::error_code ec;
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+
+    {
+        RocksDBQueue<std::string> rocksDBQueue(DATABASE_NAME);
+        for (int i = 0; i < 300; i++)
+        {
+            rocksDBQueue.push(std::to_string(i));
+        }
+        rocksDBQueue.popBulk(5);
+    }
+
+    RocksDBQueue<std::string> rocksDBQueue(DATABASE_NAME);
+    ASSERT_EQ(295, rocksDBQueue.size());
+    for (int i = 5; i < 300; i++)
+    {
+        EXPECT_EQ(std::to_string(i), rocksDBQueue.front());
+        rocksDBQueue.pop();
+    }
+    EXPECT_TRUE(rocksDBQueue.empty());
+
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+}
+
+TEST_F(RocksDBSafeQueueTest, MigratesDecimalKeys)
+{
+    constexpr auto DATABASE_NAME {"test_legacy.db"};
+    std::error_code ec;
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+
+    {
+        // Keys written by the previous versions of the queue.
+        rocksdb::Options options;
+        options.create_if_missing = true;
+        rocksdb::DB* db;
+        std::filesystem::create_directories(DATABASE_NAME);
+        ASSERT_TRUE(rocksdb::DB::Open(options, DATABASE_NAME, &db).ok());
+        std::unique_ptr<rocksdb::DB> legacyDB {db};
+        for (int i = 8; i <= 12; i++)
+        {
+            ASSERT_TRUE(legacyDB->Put(rocksdb::WriteOptions(), std::to_string(i), "value" + std::to_string(i)).ok());
+        }
+    }
+
+    RocksDBQueue<std::string> rocksDBQueue(DATABASE_NAME);
+    ASSERT_EQ(5, rocksDBQueue.size());
+    auto bulk {rocksDBQueue.getBulk(10)};
+    for (int i = 8; i <= 12; i++)
+    {
+        EXPECT_EQ("value" + std::to_string(i), bulk.front());
+        bulk.pop();
+    }
+
+    rocksDBQueue.push("value13");
+    EXPECT_EQ("value13", rocksDBQueue.at(5));
+
+    std::filesystem::remove_all(DATABASE_NAME, ec);
+}
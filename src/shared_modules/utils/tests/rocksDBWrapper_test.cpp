@@ -579,3 +579,64 @@ TEST_F(RocksDBWrapperTest, GetAllColumnFamiliesTest)
     EXPECT_EQ(columnFamilies[2], COLUMN_NAME_B);
     EXPECT_EQ(columnFamilies[3], COLUMN_NAME_C);
 }
+
+TEST_F(RocksDBWrapperTest, CompressionProfileFromString)
+{
+    EXPECT_EQ(Utils::compressionProfileFromString("default"), Utils::CompressionProfile::DEFAULT);
+    EXPECT_EQ(Utils::compressionProfileFromString("bzip2"), Utils::CompressionProfile::BZIP2);
+    EXPECT_EQ(Utils::compressionProfileFromString("zstd"), Utils::CompressionProfile::ZSTD);
+    EXPECT_EQ(Utils::compressionProfileFromString("zstd-dictionary"), Utils::CompressionProfile::ZSTD_DICTIONARY);
+    EXPECT_THROW(Utils::compressionProfileFromString("lz4"), std::invalid_argument);
+}
+
+/**
+ * @brief Test a database reopened with another compression profile keeps its data.
+ *
+ */
+TEST_F(RocksDBWrapperTest, ReopenWithAnotherCompressionProfile)
+{
+    constexpr auto COLUMN_NAME {"column_A"};
+    const auto folder {OUTPUT_FOLDER / "compressed_db"};
+
+    Utils::RocksDBTuning tuning;
+    tuning.blockCacheSize = 1024 * 1024;
+    tuning.compression = Utils::CompressionProfile::BZIP2;
+    {
+        Utils::RocksDBWrapper db(folder, true, tuning);
+        db.createColumn(COLUMN_NAME);
+        db.put("key_A", "value_A", COLUMN_NAME);
+        db.flush();
+    }
+
+    Utils::RocksDBWrapper db(folder);
+    std::string value;
+    EXPECT_TRUE(db.get("key_A", value, COLUMN_NAME));
+    EXPECT_EQ(value, "value_A");
+}
+
+/**
+ * @brief Test the databases share the block cache and are reported by consumer until they are closed.
+ *
+ */
+TEST_F(RocksDBWrapperTest, DatabasesShareTheResources)
+{
+    auto& resources = Utils::RocksDBResources::instance();
+    EXPECT_THROW(Utils::RocksDBResources::configure({}), std::logic_error);
+
+    Utils::RocksDBTuning tuning;
+    tuning.consumer = "second_db";
+    {
+        Utils::RocksDBWrapper db(OUTPUT_FOLDER / "second_db", true, tuning);
+        db.put("key_A", "value_A");
+
+        const auto usage {resources.usage()};
+        ASSERT_EQ(usage.size(), 2);
+        EXPECT_EQ(usage[0].consumer, m_databaseFolder.string());
+        EXPECT_EQ(usage[1].consumer, "second_db");
+        EXPECT_GT(usage[1].memtables, 0);
+    }
+
+    const auto usage {resources.usage()};
+    ASSERT_EQ(usage.size(), 1);
+    EXPECT_EQ(usage[0].consumer, m_databaseFolder.string());
+}
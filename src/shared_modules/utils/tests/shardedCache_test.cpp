@@ -0,0 +1,148 @@
+/*
+ * Wazuh shared modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#include "shardedCache_test.h"
+#include "shardedCache.hpp"
+#include <string>
+#include <thread>
+#include <vector>
+
+void ShardedCacheTest::SetUp() {};
+
+void ShardedCacheTest::TearDown() {};
+TEST_F(ShardedCacheTest, InsertAndHit)
+{
+    Utils::ShardedCache<int, int> cache(10);
+
+    cache.insertKey(1, 10);
+    EXPECT_TRUE(cache.isHit(1));
+    EXPECT_EQ(cache.getValue(1).value(), 10);
+
+    cache.insertKey(1, 20);
+    EXPECT_EQ(cache.getValue(1).value(), 20);
+    EXPECT_EQ(cache.size(), 1U);
+}
+
+TEST_F(ShardedCacheTest, InsertAndMiss)
+{
+    Utils::ShardedCache<int, int> cache(10);
+
+    cache.insertKey(10, 10);
+    EXPECT_FALSE(cache.isHit(1));
+    EXPECT_FALSE(cache.getValue(1).has_value());
+}
+
+TEST_F(ShardedCacheTest, InvalidCapacity)
+{
+    EXPECT_THROW((Utils::ShardedCache<int, int>(0)), std::invalid_argument);
+}
+
+TEST_F(ShardedCacheTest, EvictsUnreferencedFirst)
+{
+    Utils::ShardedCache<int, int> cache(3, 0, {}, 1);
+
+    cache.insertKey(1, 1);
+    cache.insertKey(2, 2);
+    cache.insertKey(3, 3);
+    EXPECT_TRUE(cache.isFull());
+
+    cache.getValue(1);
+    cache.getValue(3);
+    cache.insertKey(4, 4);
+
+    EXPECT_EQ(cache.size(), 3U);
+    EXPECT_FALSE(cache.isHit(2));
+    EXPECT_TRUE(cache.isHit(1));
+    EXPECT_TRUE(cache.isHit(3));
+    EXPECT_TRUE(cache.isHit(4));
+
+    // The new entry wasn't read, it goes before the entries whose flag is set again.
+    cache.getValue(1);
+    cache.getValue(3);
+    cache.insertKey(5, 5);
+    EXPECT_FALSE(cache.isHit(4));
+}
+
+TEST_F(ShardedCacheTest, BoundedByBytes)
+{
+    Utils::ShardedCache<int, std::string> cache(
+        100, 10, [](const int&, const std::string& value) { return value.size(); }, 1);
+
+    cache.insertKey(1, "aaaa");
+    cache.insertKey(2, "bbbb");
+    EXPECT_EQ(cache.bytes(), 8U);
+
+    cache.insertKey(3, "cccc");
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.bytes(), 8U);
+    EXPECT_TRUE(cache.isHit(3));
+
+    // An entry larger than the cache isn't kept.
+    cache.insertKey(4, std::string(11, 'd'));
+    EXPECT_FALSE(cache.isHit(4));
+    EXPECT_LE(cache.bytes(), 10U);
+}
+
+TEST_F(ShardedCacheTest, ForEachAndClear)
+{
+    Utils::ShardedCache<int, int> cache(1000);
+    for (auto i = 0; i < 500; ++i)
+    {
+        cache.insertKey(i, i * 2);
+    }
+
+    auto visited {0};
+    cache.forEach(
+        [&visited](const int& key, const int& value)
+        {
+            EXPECT_EQ(key * 2, value);
+            ++visited;
+            return true;
+        });
+    EXPECT_EQ(visited, 500);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+    EXPECT_EQ(cache.bytes(), 0U);
+}
+
+TEST_F(ShardedCacheTest, ConcurrentAccess)
+{
+    constexpr auto CAPACITY {256};
+    Utils::ShardedCache<int, int> cache(CAPACITY);
+
+    std::vector<std::thread> threads;
+    for (auto t = 0; t < 8; ++t)
+    {
+        threads.emplace_back(
+            [&cache, t]()
+            {
+                for (auto i = 0; i < 10000; ++i)
+                {
+                    const auto key {(i * 7 + t) % 1024};
+                    if (const auto value = cache.getValue(key); value.has_value())
+                    {
+                        EXPECT_EQ(value.value(), key);
+                    }
+                    else
+                    {
+                        cache.insertKey(key, key);
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_LE(cache.size(), static_cast<size_t>(CAPACITY));
+}
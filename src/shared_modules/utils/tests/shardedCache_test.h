@@ -1,7 +1,7 @@
 /*
  * Wazuh shared modules utils
  * Copyright (C) 2015, Wazuh Inc.
- * October 17, 2023.
+ * October 14, 2026.
  *
  * This program is free software; you can redistribute it
  * and/or modify it under the terms of the GNU General Public
@@ -9,18 +9,18 @@
  * Foundation.
  */
 
-#ifndef CACHE_LRU_TESTS_H
-#define CACHE_LRU_TESTS_H
+#ifndef SHARDED_CACHE_TESTS_H
+#define SHARDED_CACHE_TESTS_H
 #include "gtest/gtest.h"
 
-class CacheLRUTest : public ::testing::Test
+class ShardedCacheTest : public ::testing::Test
 {
     protected:
 
-        CacheLRUTest() = default;
-        virtual ~CacheLRUTest() = default;
+        ShardedCacheTest() = default;
+        virtual ~ShardedCacheTest() = default;
 
         void SetUp() override;
         void TearDown() override;
 };
-#endif //CACHE_LRU_TESTS_H
+#endif //SHARDED_CACHE_TESTS_H
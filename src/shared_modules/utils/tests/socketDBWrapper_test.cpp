@@ -14,8 +14,10 @@
 #include "socketDBWrapper.hpp"
 
 // temp header
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <vector>
 
 TEST_F(SocketDBWrapperTest, EmptyTest)
 {
@@ -89,6 +91,46 @@ TEST_F(SocketDBWrapperTest, OkTest)
     ASSERT_EQ(output[0].at("field"), "value");
 }
 
+TEST_F(SocketDBWrapperTest, ConcurrentQueriesTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(ok [{"field": "value"}])"};
+
+    std::vector<std::thread> threads;
+    std::atomic<int> succeeded {0};
+    for (auto i = 0; i < 8; ++i)
+    {
+        threads.emplace_back(
+            [&succeeded]()
+            {
+                nlohmann::json output;
+                SocketDBWrapper::instance().query("SELECT * FROM test_table;", output);
+                if (output[0].at("field") == "value")
+                {
+                    ++succeeded;
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(succeeded, 8);
+}
+
+TEST_F(SocketDBWrapperTest, TimeoutTest)
+{
+    m_query = "SELECT * FROM test_table;";
+    m_responses = std::vector<std::string> {R"(ok [{"field": "value"}])"};
+    m_sleepTime = 500;
+
+    nlohmann::json output;
+    EXPECT_THROW(SocketDBWrapper::instance().query(m_query, output, std::chrono::milliseconds(100)),
+                 std::runtime_error);
+    EXPECT_TRUE(output.empty());
+}
+
 TEST_F(SocketDBWrapperTestNoSetUp, NoSocketTest)
 {
     SocketDBWrapper::instance();
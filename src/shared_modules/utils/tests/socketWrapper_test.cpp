@@ -39,6 +39,7 @@ public:
     MOCK_METHOD(int, close, (int));
     MOCK_METHOD(ssize_t, recv, (int, void*, size_t, int));
     MOCK_METHOD(ssize_t, send, (int, const void*, size_t, int));
+    MOCK_METHOD(ssize_t, sendmsg, (int, const struct msghdr*, int));
     MOCK_METHOD(int, shutdown, (int, int));
 };
 
@@ -101,6 +102,48 @@ TEST_F(SocketWrapperTest, ConnectInProgress)
     EXPECT_THROW({ socketWrapper.connect(unixAddress.data()); }, std::runtime_error);
 }
 
+TEST_F(SocketWrapperTest, SendPartialScatterGather)
+{
+    Socket<OSWrapper> socketWrapper;
+    EXPECT_CALL(socketWrapper, socket(_, _, _)).WillOnce(Return(123));
+    EXPECT_CALL(socketWrapper, connect(123, _, _)).WillOnce(Return(0));
+    EXPECT_CALL(socketWrapper, setsockopt(123, _, _, _, _)).Times(2);
+    EXPECT_CALL(socketWrapper, close(123)).WillOnce(Return(0));
+    EXPECT_CALL(socketWrapper, shutdown(123, _)).WillOnce(Return(0));
+
+    auto unixAddress {UnixAddress::builder().address("test_socket").build()};
+    EXPECT_NO_THROW({ socketWrapper.connect(unixAddress.data()); });
+
+    // The packet is sent in two parts, the first one ends in the middle of the size fields.
+    std::string sent;
+    const auto gather = [&sent](const struct msghdr* message, size_t limit)
+    {
+        const auto before = sent.size();
+        for (size_t i = 0; i < message->msg_iovlen && sent.size() - before < limit; ++i)
+        {
+            const auto size = std::min(message->msg_iov[i].iov_len, limit - (sent.size() - before));
+            sent.append(static_cast<const char*>(message->msg_iov[i].iov_base), size);
+        }
+        return static_cast<ssize_t>(sent.size() - before);
+    };
+    EXPECT_CALL(socketWrapper, sendmsg(123, _, _))
+        .WillOnce(Invoke([&gather](int, const struct msghdr* message, int) { return gather(message, 3); }))
+        .WillOnce(Invoke([&gather](int, const struct msghdr* message, int) { return gather(message, 1024); }));
+
+    const std::string header {"hdr"};
+    const std::string body {"body"};
+    EXPECT_NO_THROW(socketWrapper.send(body.data(), body.size(), header.data(), header.size()));
+    EXPECT_FALSE(socketWrapper.hasUnsentMessages());
+
+    std::vector<char> expected;
+    AppendHeaderProtocol::Header sizeFields {
+        static_cast<uint32_t>(HEADER_FIELD_SIZE + header.size() + body.size()), static_cast<uint32_t>(header.size())};
+    expected.insert(expected.end(), (char*)&sizeFields, (char*)&sizeFields + sizeof(sizeFields));
+    expected.insert(expected.end(), header.begin(), header.end());
+    expected.insert(expected.end(), body.begin(), body.end());
+    EXPECT_EQ(sent, std::string(expected.begin(), expected.end()));
+}
+
 TEST_F(SocketWrapperTest, DISABLED_ReadSuccess)
 {
     // Create a mock object.
@@ -307,7 +350,6 @@ TEST_F(SocketWrapperTest, DISABLED_ReadSuccessBufferIncrement)
     const int sock = 123;
     const ssize_t metaDataSize = PACKET_FIELD_SIZE;
     const std::vector<char> header(HEADER_FIELD_SIZE, 0);
-    const size_t initialRecvBufferSize = socketWrapper.recvBufferSize();
     const size_t targetSize = socketWrapper.recvBufferSize() * 2;
     std::vector<char> data(targetSize - HEADER_FIELD_SIZE, 0);
     for (size_t i = 0; i < data.size(); i++)
@@ -365,6 +407,6 @@ TEST_F(SocketWrapperTest, DISABLED_ReadSuccessBufferIncrement)
     // Read body
     EXPECT_NO_THROW({ socketWrapper.read(callbackBody); });
 
-    // Buffer is decreased to the original value.
-    EXPECT_EQ(socketWrapper.recvBufferSize(), initialRecvBufferSize);
+    // Buffer is kept for the next packets.
+    EXPECT_EQ(socketWrapper.recvBufferSize(), targetSize + 1);
 }
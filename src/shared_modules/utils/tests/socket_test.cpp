@@ -14,6 +14,8 @@
 #include "../socketServer.hpp"
 #include <chrono>
 #include <future>
+#include <map>
+#include <mutex>
 
 TYPED_TEST_SUITE_P(SocketTest);
 
@@ -173,6 +175,76 @@ TYPED_TEST_P(SocketTest, MultipleClients)
     EXPECT_EQ(counter, MESSAGE_QUANTITY);
 }
 
+TYPED_TEST_P(SocketTest, MultipleClientsMultipleReactors)
+{
+    constexpr size_t MESSAGE_QUANTITY {10000};
+    std::string socketPath {"/tmp/echo_sock"};
+    std::promise<void> promise;
+    constexpr size_t CLIENTS {10};
+
+    SocketServer<Socket<OSPrimitives, TypeParam>, EpollWrapper> server {socketPath, 4, 4};
+    std::mutex mutex;
+    std::map<int, size_t> nextMessage;
+    std::atomic<bool> unordered {false};
+    std::atomic<size_t> counter {0};
+    server.listen(
+        [&](const int fd, const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+        {
+            std::ignore = dataHeader;
+            std::ignore = sizeHeader;
+            std::string message(data, size);
+            {
+                // The messages of each client are processed in order
+                std::lock_guard lock {mutex};
+                if (message != std::to_string(nextMessage[fd]++))
+                {
+                    unordered = true;
+                }
+            }
+
+            if (++counter == MESSAGE_QUANTITY)
+            {
+                promise.set_value();
+            }
+        });
+
+    std::vector<std::thread> threads;
+    for (size_t i {0}; i < CLIENTS; ++i)
+    {
+        threads.emplace_back(
+            [&]()
+            {
+                SocketClient<Socket<OSPrimitives, TypeParam>, EpollWrapper> client {socketPath};
+                client.connect(
+                    [](const char* data, uint32_t size, const char* dataHeader, uint32_t sizeHeader)
+                    {
+                        std::ignore = dataHeader;
+                        std::ignore = sizeHeader;
+                        std::ignore = size;
+                        std::ignore = data;
+                    });
+
+                for (size_t i {0}; i < MESSAGE_QUANTITY / CLIENTS; ++i)
+                {
+                    auto message {std::to_string(i)};
+                    client.send(message.c_str(), message.size());
+                }
+
+                std::this_thread::sleep_for(std::chrono::seconds(5));
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+
+    EXPECT_EQ(counter, MESSAGE_QUANTITY);
+    EXPECT_FALSE(unordered);
+}
+
 TYPED_TEST_P(SocketTest, SingleDelayedClientWithReconnectionSendMessageOffline)
 {
     constexpr size_t MESSAGE_QUANTITY {100};
@@ -400,6 +472,7 @@ REGISTER_TYPED_TEST_SUITE_P(SocketTest,
                             SingleDelayedServerStart,
                             SingleDelayedClient,
                             MultipleClients,
+                            MultipleClientsMultipleReactors,
                             SingleDelayedClientWithReconnectionSendMessageOffline,
                             SingleDelayedClientWithReconnectionOnline,
                             SingleDelayedClientWithReconnectionServerReset);
@@ -53,6 +53,14 @@ TEST_F(StringUtilsTest, SplitDelimiterCoincidence)
     EXPECT_EQ(splitTextVector[1], "world");
 }
 
+TEST_F(StringUtilsTest, SplitEmptyTokens)
+{
+    // Only the empty token after a trailing delimiter is dropped.
+    const auto splitTextVector {Utils::split(".hello..world.", '.')};
+    const std::vector<std::string> expected {"", "hello", "", "world"};
+    EXPECT_EQ(splitTextVector, expected);
+}
+
 TEST_F(StringUtilsTest, SplitIndex)
 {
     const auto splitTextVector {Utils::splitIndex("hello.world", '.', 0)};
@@ -121,3 +121,120 @@ TEST_F(ThreadDispatcherTest, AsyncDispatcherQueue)
     dispatcher.rundown();
 }
 
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherPushAndRundown)
+{
+    FunctorWrapper functor;
+    StealingAsyncDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    EXPECT_EQ(std::thread::hardware_concurrency(), dispatcher.numberOfThreads());
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i));
+    }
+
+    for (int i = 0; i < 10; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+    EXPECT_TRUE(dispatcher.cancelled());
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherCancel)
+{
+    FunctorWrapper functor;
+    StealingAsyncDispatcher<int, std::reference_wrapper<FunctorWrapper>> dispatcher
+    {
+        std::ref(functor)
+    };
+    dispatcher.cancel();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        EXPECT_CALL(functor, Operator(i)).Times(0);
+        dispatcher.push(i);
+    }
+
+    EXPECT_TRUE(dispatcher.cancelled());
+    dispatcher.rundown();
+    EXPECT_EQ(0ul, dispatcher.size());
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherQueue)
+{
+    constexpr auto NUMBER_OF_THREADS { 1ul };
+    constexpr auto MAX_QUEUE_SIZE { 5ull };
+    constexpr auto NUMBER_OF_ITEMS { 1000 };
+    std::mutex mutex;
+    std::unique_lock<std::mutex> lock(mutex);
+    std::condition_variable condition;
+    std::atomic<bool> firstCall { true };
+
+    StealingAsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&mutex, &condition, &firstCall](int)
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.notify_one();
+
+            if (firstCall)
+            {
+                firstCall = false;
+                condition.wait(lock);
+            }
+        }
+        , NUMBER_OF_THREADS
+        , MAX_QUEUE_SIZE
+    };
+
+    dispatcher.push(0);
+    condition.wait(lock);
+
+    for (int i = 0; i < NUMBER_OF_ITEMS - 1; ++i)
+    {
+        dispatcher.push(0);
+    }
+
+    EXPECT_EQ(MAX_QUEUE_SIZE, dispatcher.size());
+    condition.notify_one();
+    lock.unlock();
+    dispatcher.rundown();
+}
+
+TEST_F(ThreadDispatcherTest, StealingAsyncDispatcherStealsFromABusyWorker)
+{
+    constexpr auto NUMBER_OF_THREADS { 4u };
+    constexpr auto NUMBER_OF_ITEMS { 10000 };
+    std::atomic<int> processed { 0 };
+    std::atomic<int> sum { 0 };
+
+    StealingAsyncDispatcher<int, std::function<void(int)>> dispatcher
+    {
+        [&processed, &sum](int value)
+        {
+            // The first message holds its worker, the rest of its deque is stolen by the others
+            if (value == 0)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+
+            sum += value;
+            ++processed;
+        }
+        , NUMBER_OF_THREADS
+    };
+
+    for (int i = 0; i < NUMBER_OF_ITEMS; ++i)
+    {
+        dispatcher.push(i);
+    }
+
+    dispatcher.rundown();
+    EXPECT_EQ(NUMBER_OF_ITEMS, processed);
+    EXPECT_EQ(NUMBER_OF_ITEMS * (NUMBER_OF_ITEMS - 1) / 2, sum);
+}
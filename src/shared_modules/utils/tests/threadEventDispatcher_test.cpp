@@ -316,3 +316,215 @@ TEST_F(ThreadEventDispatcherTest, CtorPopFeatureSingleThread)
     promise.get_future().wait_for(std::chrono::seconds(10));
     EXPECT_EQ(MESSAGES_TO_SEND, counter);
 }
+
+TEST_F(ThreadEventDispatcherTest, PushBulkSingleThread)
+{
+    constexpr auto MESSAGES_TO_SEND {500};
+    constexpr auto MAX_QUEUE_SIZE {300};
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        TEST_DB, BULK_SIZE, MAX_QUEUE_SIZE);
+
+    std::vector<std::string> messages;
+    for (int i = 0; i < MESSAGES_TO_SEND; ++i)
+    {
+        messages.push_back(std::to_string(i));
+    }
+
+    // The elements beyond the maximum size are dropped.
+    dispatcher.pushBulk(messages);
+    EXPECT_EQ(MAX_QUEUE_SIZE, dispatcher.size());
+    EXPECT_EQ(MESSAGES_TO_SEND - MAX_QUEUE_SIZE, dispatcher.dropped());
+
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+    auto index {0};
+    dispatcher.startWorker(
+        [&](std::queue<std::string>& data)
+        {
+            counter += data.size();
+            while (!data.empty())
+            {
+                EXPECT_EQ(std::to_string(index), data.front());
+                data.pop();
+                ++index;
+            }
+
+            if (counter == MAX_QUEUE_SIZE)
+            {
+                promise.set_value();
+            }
+        });
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    EXPECT_EQ(MAX_QUEUE_SIZE, counter);
+}
+
+TEST_F(ThreadEventDispatcherTest, SetBulkSizeSingleThread)
+{
+    constexpr auto MESSAGES_TO_SEND {200};
+    constexpr auto NEW_BULK_SIZE {7};
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(TEST_DB,
+                                                                                                 BULK_SIZE);
+    EXPECT_THROW(dispatcher.setBulkSize(0), std::invalid_argument);
+    dispatcher.setBulkSize(NEW_BULK_SIZE);
+
+    for (int i = 0; i < MESSAGES_TO_SEND; ++i)
+    {
+        dispatcher.push(std::to_string(i));
+    }
+
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+    dispatcher.startWorker(
+        [&](std::queue<std::string>& data)
+        {
+            EXPECT_LE(data.size(), NEW_BULK_SIZE);
+            counter += data.size();
+            if (counter == MESSAGES_TO_SEND)
+            {
+                promise.set_value();
+            }
+        });
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    EXPECT_EQ(MESSAGES_TO_SEND, counter);
+}
+
+TEST_F(ThreadEventDispatcherTest, GroupCommitConcurrentPushes)
+{
+    constexpr auto PRODUCERS {8};
+    constexpr auto MESSAGES_PER_PRODUCER {250};
+    constexpr auto MESSAGES_TO_SEND {PRODUCERS * MESSAGES_PER_PRODUCER};
+
+    std::vector<int> messagesProcessed;
+    std::promise<void> promise;
+
+    ThreadEventDispatcher<std::string, std::function<void(std::queue<std::string>&)>> dispatcher(
+        [&](std::queue<std::string>& data)
+        {
+            while (!data.empty())
+            {
+                messagesProcessed.push_back(std::stoi(data.front()));
+                data.pop();
+            }
+
+            if (messagesProcessed.size() == MESSAGES_TO_SEND)
+            {
+                promise.set_value();
+            }
+        },
+        TEST_DB,
+        BULK_SIZE,
+        UNLIMITED_QUEUE_SIZE,
+        1,
+        true);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < PRODUCERS; ++producer)
+    {
+        producers.emplace_back(
+            [&dispatcher, producer]()
+            {
+                for (int i = 0; i < MESSAGES_PER_PRODUCER; ++i)
+                {
+                    dispatcher.push(std::to_string(producer * MESSAGES_PER_PRODUCER + i));
+                }
+            });
+    }
+
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    ASSERT_EQ(MESSAGES_TO_SEND, messagesProcessed.size());
+
+    // Every message arrives once, and the messages of each producer keep their order.
+    std::vector<int> lastOfProducer(PRODUCERS, -1);
+    for (const auto message : messagesProcessed)
+    {
+        EXPECT_LT(lastOfProducer[message / MESSAGES_PER_PRODUCER], message);
+        lastOfProducer[message / MESSAGES_PER_PRODUCER] = message;
+    }
+    std::sort(messagesProcessed.begin(), messagesProcessed.end());
+    for (int i = 0; i < MESSAGES_TO_SEND; ++i)
+    {
+        EXPECT_EQ(i, messagesProcessed[i]);
+    }
+}
+
+TEST_F(ThreadEventDispatcherTest, MultiThreadOrderedPerPrefix)
+{
+    constexpr auto PREFIXES {10};
+    constexpr auto MESSAGES_PER_PREFIX {50};
+    constexpr auto MESSAGES_TO_SEND {PREFIXES * MESSAGES_PER_PREFIX};
+    constexpr auto NUM_THREADS {4};
+
+    std::mutex mutex;
+    std::vector<std::vector<int>> messagesProcessed(PREFIXES);
+    std::vector<int> inProgress(PREFIXES, 0);
+    std::atomic<bool> overlapped {false};
+    std::atomic<size_t> counter {0};
+    std::promise<void> promise;
+
+    using MultiQueue = Utils::TSafeMultiQueue<std::string, std::string, RocksDBQueueCF<std::string>>;
+    TThreadEventDispatcher<std::string,
+                           std::string,
+                           std::function<void(std::string&)>,
+                           RocksDBQueueCF<std::string>,
+                           MultiQueue>
+        dispatcher(TEST_DB, 1, UNLIMITED_QUEUE_SIZE, NUM_THREADS, false, true);
+
+    for (int i = 0; i < MESSAGES_PER_PREFIX; ++i)
+    {
+        for (int prefix = 0; prefix < PREFIXES; ++prefix)
+        {
+            dispatcher.push(std::to_string(prefix), std::to_string(prefix) + ":" + std::to_string(i));
+        }
+    }
+
+    dispatcher.startWorker(
+        [&](std::string& element)
+        {
+            const auto separator = element.find(':');
+            const auto prefix = std::stoi(element.substr(0, separator));
+            {
+                std::lock_guard lock(mutex);
+                if (inProgress[prefix]++ > 0)
+                {
+                    overlapped = true;
+                }
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+            {
+                std::lock_guard lock(mutex);
+                --inProgress[prefix];
+                messagesProcessed[prefix].push_back(std::stoi(element.substr(separator + 1)));
+            }
+
+            if (++counter == MESSAGES_TO_SEND)
+            {
+                promise.set_value();
+            }
+        });
+
+    promise.get_future().wait_for(std::chrono::seconds(10));
+    dispatcher.cancel();
+    ASSERT_EQ(MESSAGES_TO_SEND, counter);
+    EXPECT_FALSE(overlapped);
+
+    // The elements of each prefix are processed once and in order.
+    for (const auto& messages : messagesProcessed)
+    {
+        ASSERT_EQ(MESSAGES_PER_PREFIX, messages.size());
+        for (int i = 0; i < MESSAGES_PER_PREFIX; ++i)
+        {
+            EXPECT_EQ(i, messages[i]);
+        }
+    }
+}
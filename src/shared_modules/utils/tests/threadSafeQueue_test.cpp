@@ -115,4 +115,92 @@ TEST_F(ThreadSafeQueueTest, CancelBlockingPop)
     queue.cancel();
     t1.join();
     t2.join();
-}
\ No newline at end of file
+}
+TEST_F(ThreadSafeQueueTest, BoundedPushDropsAndCounts)
+{
+    SafeQueue<int> queue;
+    EXPECT_TRUE(queue.push(0, 2, PushPolicy::DROP));
+    EXPECT_TRUE(queue.push(1, 2, PushPolicy::DROP));
+    EXPECT_FALSE(queue.push(2, 2, PushPolicy::DROP));
+    EXPECT_EQ(2ul, queue.size());
+    EXPECT_EQ(1ul, queue.dropped());
+
+    // No limit
+    EXPECT_TRUE(queue.push(3, 0, PushPolicy::DROP));
+    EXPECT_EQ(3ul, queue.size());
+}
+
+TEST_F(ThreadSafeQueueTest, BoundedPushTimesOut)
+{
+    SafeQueue<int> queue;
+    EXPECT_TRUE(queue.push(0, 1, PushPolicy::TIMEOUT, std::chrono::milliseconds(10)));
+
+    const auto start {std::chrono::steady_clock::now()};
+    EXPECT_FALSE(queue.push(1, 1, PushPolicy::TIMEOUT, std::chrono::milliseconds(10)));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));
+    EXPECT_EQ(1ul, queue.dropped());
+}
+
+TEST_F(ThreadSafeQueueTest, BoundedPushBlocksUntilRoom)
+{
+    SafeQueue<int> queue;
+    EXPECT_TRUE(queue.push(0, 1, PushPolicy::BLOCK));
+
+    std::thread t1
+    {
+        [&queue]()
+        {
+            EXPECT_TRUE(queue.push(1, 1, PushPolicy::BLOCK));
+        }
+    };
+
+    int ret_val{};
+    EXPECT_TRUE(queue.pop(ret_val));
+    EXPECT_EQ(0, ret_val);
+    EXPECT_TRUE(queue.pop(ret_val));
+    EXPECT_EQ(1, ret_val);
+    t1.join();
+    EXPECT_EQ(0ul, queue.dropped());
+}
+
+TEST_F(ThreadSafeQueueTest, BoundedPushReleasedOnCancel)
+{
+    SafeQueue<int> queue;
+    EXPECT_TRUE(queue.push(0, 1, PushPolicy::BLOCK));
+
+    std::thread t1
+    {
+        [&queue]()
+        {
+            EXPECT_FALSE(queue.push(1, 1, PushPolicy::BLOCK));
+        }
+    };
+
+    queue.cancel();
+    t1.join();
+    EXPECT_EQ(0ul, queue.dropped());
+}
+
+TEST_F(ThreadSafeQueueTest, BoundedPushBulk)
+{
+    SafeQueue<int> queue;
+    EXPECT_EQ(3ul, queue.pushBulk({0, 1, 2, 3, 4}, 3, PushPolicy::DROP));
+    EXPECT_EQ(3ul, queue.size());
+    EXPECT_EQ(2ul, queue.dropped());
+
+    std::thread t1
+    {
+        [&queue]()
+        {
+            EXPECT_EQ(2ul, queue.pushBulk({5, 6}, 3, PushPolicy::BLOCK));
+        }
+    };
+
+    for (int i : {0, 1, 2, 5, 6})
+    {
+        int ret_val{};
+        EXPECT_TRUE(queue.pop(ret_val));
+        EXPECT_EQ(i, ret_val);
+    }
+    t1.join();
+}
@@ -542,3 +542,49 @@ TEST_F(XzHelperTest, InvalidCompressionPresetThrows)
     constexpr auto INVALID_COMPRESSION_PRESET {1000};
     EXPECT_THROW(Utils::XzHelper(inputData, compressedData).compress(INVALID_COMPRESSION_PRESET), std::runtime_error);
 }
+
+/**
+ * @brief Test correct decompression of a sample file as input, output streamed to a callback. Multi-thread.
+ *
+ */
+TEST_F(XzHelperTest, DecompressFileOutputToCallbackMultiThread)
+{
+    // Setup
+    std::vector<uint8_t> decompressedData;
+    auto blocks {0};
+    Utils::XzHelper xz(
+        COMPRESSED_INPUT_FILE_MT,
+        [&](const uint8_t* data, size_t dataLen)
+        {
+            decompressedData.insert(decompressedData.end(), data, data + dataLen);
+            ++blocks;
+        },
+        MAX_THREAD_COUNT);
+
+    // Decompress
+    ASSERT_NO_THROW(xz.decompress());
+
+    // Check that the streamed data equals the data of the uncompressed reference file
+    EXPECT_GT(blocks, 0);
+    EXPECT_EQ(decompressedData, loadFile(UNCOMPRESSED_REFERENCE_FILE));
+}
+
+/**
+ * @brief Test correct decompression of a data vector, output streamed to a callback. Single-thread.
+ *
+ */
+TEST_F(XzHelperTest, DecompressDataVectorToCallbackSingleThread)
+{
+    // Setup: get data from sample file
+    const auto inputData {loadFile(COMPRESSED_INPUT_FILE_ST)};
+    std::vector<uint8_t> decompressedData;
+
+    // Decompress
+    Utils::XzHelper xz(inputData,
+                       [&decompressedData](const uint8_t* data, size_t dataLen)
+                       { decompressedData.insert(decompressedData.end(), data, data + dataLen); });
+    ASSERT_NO_THROW(xz.decompress());
+
+    // Check that the streamed data equals the data of the uncompressed reference file
+    EXPECT_EQ(decompressedData, loadFile(UNCOMPRESSED_REFERENCE_FILE));
+}
@@ -20,6 +20,8 @@
 #include <map>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <vector>
 
 const auto INPUT_FILES_DIR {std::filesystem::current_path() / "input_files" / "zlibHelper"};
 
@@ -125,6 +127,76 @@ TEST_F(ZlibHelperTest, GzDecompressFileWithoutGzExtension)
     EXPECT_THROW(Utils::ZlibHelper::gzipDecompress(RAW_FILE, JSON_FILE), std::runtime_error);
 }
 
+/**
+ * @brief Tests that data compressed in memory is a valid GZ file.
+ *
+ */
+TEST_F(ZlibHelperTest, GzCompressData)
+{
+    std::string data;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        data.append(R"({"index":{"_index":"wazuh-states-vulnerabilities","_id":")" + std::to_string(i) + "\"}}\n");
+    }
+
+    const auto compressed {Utils::ZlibHelper::gzipCompress(data)};
+    EXPECT_LT(compressed.size(), data.size());
+
+    const auto gzFile {OUTPUT_DIR / "compressed.txt.gz"};
+    const auto outputFile {OUTPUT_DIR / "compressed.txt"};
+    std::ofstream {gzFile, std::ios::binary} << compressed;
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipDecompress(gzFile, outputFile));
+
+    std::ifstream decompressed {outputFile, std::ios::binary};
+    EXPECT_EQ(data, std::string(std::istreambuf_iterator<char>(decompressed), {}));
+}
+
+/**
+ * @brief Tests the GZ decompression of a file into a callback.
+ *
+ */
+TEST_F(ZlibHelperTest, GzDecompressIntoCallback)
+{
+    std::string decompressed;
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipDecompress(GZ_FILE,
+                                                      [&decompressed](std::string_view chunk)
+                                                      { decompressed.append(chunk); }));
+
+    // Check the expected hash.
+    Utils::HashData hash;
+    hash.update(decompressed.c_str(), decompressed.size());
+    EXPECT_EQ(SHA1_EXPECTED, Utils::asciiToHex(hash.hash()));
+}
+
+/**
+ * @brief Tests the GZ decompression of a file with several members, e.g. concatenated GZ files.
+ *
+ */
+TEST_F(ZlibHelperTest, GzDecompressMultipleMembers)
+{
+    const auto gzFile {OUTPUT_DIR / "members.txt.gz"};
+    const auto outputFile {OUTPUT_DIR / "members.txt"};
+    std::ofstream {gzFile, std::ios::binary} << Utils::ZlibHelper::gzipCompress("first member\n")
+                                             << Utils::ZlibHelper::gzipCompress("second member\n");
+    ASSERT_NO_THROW(Utils::ZlibHelper::gzipDecompress(gzFile, outputFile));
+
+    std::ifstream decompressed {outputFile, std::ios::binary};
+    EXPECT_EQ("first member\nsecond member\n", std::string(std::istreambuf_iterator<char>(decompressed), {}));
+}
+
+/**
+ * @brief Tests the GZ decompression of a truncated file.
+ *
+ */
+TEST_F(ZlibHelperTest, GzDecompressTruncatedFile)
+{
+    const auto compressed {Utils::ZlibHelper::gzipCompress(std::string(1000, 'a'))};
+    const auto gzFile {OUTPUT_DIR / "truncated.txt.gz"};
+    std::ofstream {gzFile, std::ios::binary} << compressed.substr(0, compressed.size() / 2);
+
+    EXPECT_THROW(Utils::ZlibHelper::gzipDecompress(gzFile, OUTPUT_DIR / "truncated.txt"), std::runtime_error);
+}
+
 /**
  * @brief Tests the ZIP decompression when the input file is empty or it doesn't exist.
  *
@@ -180,6 +252,55 @@ TEST_F(ZlibHelperTest, ZipDecompressMultipleFiles)
     }
 }
 
+/**
+ * @brief Tests the ZIP decompression of multiple compressed files with several threads.
+ *
+ */
+TEST_F(ZlibHelperTest, ZipDecompressMultipleFilesInParallel)
+{
+    // Set expected output files, in the order of the ZIP file.
+    std::vector<std::string> expectedDecompressedFiles;
+    for (const auto& entry : XML_DECOMPRESSED)
+    {
+        expectedDecompressedFiles.push_back(OUTPUT_DIR / entry.first.string());
+    }
+
+    // Decompress and compare output files.
+    constexpr auto THREADS {3};
+    ASSERT_EQ(expectedDecompressedFiles, Utils::ZlibHelper::zipDecompress(ZIP_MULTIPLE_FILES, OUTPUT_DIR, THREADS));
+
+    // Check the expected hashes.
+    for (const auto& filepath : expectedDecompressedFiles)
+    {
+        EXPECT_EQ(XML_DECOMPRESSED.at(std::filesystem::path(filepath).filename()), getFileHash(filepath));
+    }
+}
+
+/**
+ * @brief Tests the ZIP decompression of a nested compressed folder into a callback.
+ *
+ */
+TEST_F(ZlibHelperTest, ZipDecompressIntoCallback)
+{
+    std::map<std::string, std::string> decompressed;
+    ASSERT_NO_THROW(
+        Utils::ZlibHelper::zipDecompress(ZIP_NESTED_FOLDER,
+                                         [&decompressed](const std::string& filename, std::string_view chunk)
+                                         { decompressed[filename].append(chunk); }));
+
+    // The folders are skipped and nothing is written.
+    ASSERT_EQ(XML_DECOMPRESSED.size() + 1, decompressed.size());
+    EXPECT_TRUE(decompressed.count(std::string(ROOT_FOLDER) + "/" + TXT_FILE));
+    for (const auto& [filename, hash] : XML_DECOMPRESSED)
+    {
+        const auto& content {decompressed.at(std::string(ROOT_FOLDER) + "/" + XML_FOLDER + "/" + filename.string())};
+        Utils::HashData hashData;
+        hashData.update(content.c_str(), content.size());
+        EXPECT_EQ(hash, Utils::asciiToHex(hashData.hash()));
+    }
+    EXPECT_TRUE(std::filesystem::is_empty(OUTPUT_DIR));
+}
+
 /**
  * @brief Tests the ZIP decompression of a not compressed file.
  *
@@ -14,6 +14,11 @@
 #include <vector>
 #include <thread>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <future>
 #include <functional>
 #include <iostream>
@@ -180,6 +185,253 @@ namespace Utils
             const size_t m_maxQueueSize;
     };
 
+    /**
+     * @brief Dispatcher with the same interface as AsyncDispatcher, backed by a deque per thread.
+     * @details The messages pushed from outside are spread across the workers in turn and the messages pushed by a
+     * worker go to its own deque, so the producers and the consumers do not contend on a single lock. A worker takes
+     * the oldest message of its own deque and, once it is empty, steals the newest one of the others. The idle workers
+     * sleep on a shared condition variable that is only signaled when someone is asleep, and a worker that takes a
+     * message while more are pending wakes up the next sleeper, so a burst wakes the workers up one after the other
+     * instead of the producer paying for every wakeup.
+     *
+     * @tparam Type Messages types.
+     * @tparam Functor Entity that processes the messages.
+     */
+    template
+    <
+        typename Type,
+        typename Functor
+        >
+    class StealingAsyncDispatcher
+    {
+        public:
+            StealingAsyncDispatcher(Functor functor, const unsigned int numberOfThreads = std::thread::hardware_concurrency(), const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE)
+                : m_functor{ functor }
+                , m_running{ true }
+                , m_numberOfThreads{ numberOfThreads ? numberOfThreads : 1 }
+                , m_maxQueueSize { maxQueueSize }
+                , m_pending{ 0 }
+                , m_sleeping{ 0 }
+                , m_next{ 0 }
+            {
+                m_workers.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_workers.push_back(std::make_unique<Worker>());
+                }
+
+                m_threads.reserve(m_numberOfThreads);
+
+                for (unsigned int i = 0; i < m_numberOfThreads; ++i)
+                {
+                    m_threads.push_back(std::thread{ &StealingAsyncDispatcher<Type, Functor>::dispatch, this, i });
+                }
+            }
+            StealingAsyncDispatcher& operator=(const StealingAsyncDispatcher&) = delete;
+            StealingAsyncDispatcher(StealingAsyncDispatcher& other) = delete;
+            ~StealingAsyncDispatcher()
+            {
+                cancel();
+            }
+
+            void push(const Type& value)
+            {
+                if (m_running)
+                {
+                    if (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_pending < m_maxQueueSize)
+                    {
+                        auto& current { currentWorker() };
+                        const auto index
+                        {
+                            current.first == this
+                            ? current.second
+                            : m_next.fetch_add(1, std::memory_order_relaxed) % m_numberOfThreads
+                        };
+
+                        {
+                            // Counted under the lock, so the message is never taken before it is counted
+                            std::lock_guard<std::mutex> lock{ m_workers[index]->mutex };
+                            m_workers[index]->tasks.emplace_back(value);
+                            ++m_pending;
+                        }
+                        wakeUp();
+                    }
+                }
+            }
+
+            void rundown()
+            {
+                if (m_running)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock{ m_sleepMutex };
+                        m_drained.wait(lock, [this]()
+                        {
+                            return m_pending == 0 || !m_running;
+                        });
+                    }
+                    cancel();
+                }
+            }
+            void cancel()
+            {
+                m_running = false;
+                {
+                    std::lock_guard<std::mutex> lock{ m_sleepMutex };
+                    m_wakeUp.notify_all();
+                    m_drained.notify_all();
+                }
+                joinThreads();
+
+                for (auto& worker : m_workers)
+                {
+                    std::lock_guard<std::mutex> lock{ worker->mutex };
+                    m_pending -= worker->tasks.size();
+                    worker->tasks.clear();
+                }
+            }
+
+            bool cancelled() const
+            {
+                return !m_running;
+            }
+            unsigned int numberOfThreads() const
+            {
+                return m_numberOfThreads;
+            }
+            size_t size() const
+            {
+                return m_pending;
+            }
+
+        private:
+            /**
+             * @brief Deque of a worker, aligned so the locks of the workers do not share a cache line.
+             */
+            struct alignas(64) Worker
+            {
+                std::mutex mutex;
+                std::deque<Type> tasks;
+            };
+
+            /**
+             * @brief Dispatcher and index of the worker running on the calling thread, if any.
+             */
+            static std::pair<const void*, unsigned int>& currentWorker()
+            {
+                thread_local std::pair<const void*, unsigned int> current { nullptr, 0 };
+                return current;
+            }
+
+            void wakeUp()
+            {
+                if (m_sleeping > 0)
+                {
+                    std::lock_guard<std::mutex> lock{ m_sleepMutex };
+                    m_wakeUp.notify_one();
+                }
+            }
+
+            bool popOwn(const unsigned int index, std::optional<Type>& value)
+            {
+                auto& worker { *m_workers[index] };
+                std::lock_guard<std::mutex> lock{ worker.mutex };
+
+                if (worker.tasks.empty())
+                {
+                    return false;
+                }
+
+                value.emplace(std::move(worker.tasks.front()));
+                worker.tasks.pop_front();
+                return true;
+            }
+
+            bool steal(const unsigned int index, std::optional<Type>& value)
+            {
+                for (unsigned int i = 1; i < m_numberOfThreads; ++i)
+                {
+                    auto& worker { *m_workers[(index + i) % m_numberOfThreads] };
+                    std::lock_guard<std::mutex> lock{ worker.mutex };
+
+                    if (!worker.tasks.empty())
+                    {
+                        value.emplace(std::move(worker.tasks.back()));
+                        worker.tasks.pop_back();
+                        return true;
+                    }
+                }
+
+                return false;
+            }
+
+            void dispatch(const unsigned int index)
+            {
+                currentWorker() = { this, index };
+
+                try
+                {
+                    while (m_running)
+                    {
+                        std::optional<Type> value;
+
+                        if (popOwn(index, value) || steal(index, value))
+                        {
+                            if (m_pending.fetch_sub(1) > 1)
+                            {
+                                wakeUp();
+                            }
+                            else
+                            {
+                                std::lock_guard<std::mutex> lock{ m_sleepMutex };
+                                m_drained.notify_all();
+                            }
+
+                            m_functor(*value);
+                        }
+                        else
+                        {
+                            std::unique_lock<std::mutex> lock{ m_sleepMutex };
+                            ++m_sleeping;
+                            m_wakeUp.wait(lock, [this]()
+                            {
+                                return m_pending > 0 || !m_running;
+                            });
+                            --m_sleeping;
+                        }
+                    }
+                }
+                catch (const std::exception& ex)
+                {
+                    std::cerr << "Dispatch handler error, " << ex.what() << std::endl;
+                }
+            }
+            void joinThreads()
+            {
+                for (auto& thread : m_threads)
+                {
+                    if (thread.joinable())
+                    {
+                        thread.join();
+                    }
+                }
+            }
+
+            Functor m_functor;
+            std::vector<std::unique_ptr<Worker>> m_workers;
+            std::vector<std::thread> m_threads;
+            std::atomic_bool m_running;
+            const unsigned int m_numberOfThreads;
+            const size_t m_maxQueueSize;
+            std::atomic<size_t> m_pending;
+            std::atomic<unsigned int> m_sleeping;
+            std::atomic<unsigned int> m_next;
+            std::mutex m_sleepMutex;
+            std::condition_variable m_wakeUp;
+            std::condition_variable m_drained;
+    };
+
     template <typename Input, typename Functor>
     class SyncDispatcher
     {
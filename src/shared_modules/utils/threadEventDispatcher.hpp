@@ -19,8 +19,14 @@
 #include "threadSafeMultiQueue.hpp"
 #include "threadSafeQueue.h"
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 template<typename T,
          typename U,
@@ -34,12 +40,16 @@ public:
                                     const std::string& dbPath,
                                     const uint64_t bulkSize = 1,
                                     const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
-                                    const uint8_t numberOfThreads = 1)
+                                    const uint8_t numberOfThreads = 1,
+                                    const bool groupCommit = false,
+                                    const bool orderedPerPrefix = false)
         : m_functor {std::move(functor)}
         , m_maxQueueSize {maxQueueSize}
         , m_bulkSize {bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(dbPath))}
         , m_numberOfThreads {numberOfThreads}
+        , m_groupCommit {groupCommit}
+        , m_orderedPerPrefix {orderedPerPrefix}
     {
         if (m_numberOfThreads <= 0)
         {
@@ -58,11 +68,15 @@ public:
     explicit TThreadEventDispatcher(const std::string& dbPath,
                                     const uint64_t bulkSize = 1,
                                     const size_t maxQueueSize = UNLIMITED_QUEUE_SIZE,
-                                    const uint8_t numberOfThreads = 1)
+                                    const uint8_t numberOfThreads = 1,
+                                    const bool groupCommit = false,
+                                    const bool orderedPerPrefix = false)
         : m_maxQueueSize {maxQueueSize}
         , m_bulkSize {bulkSize}
         , m_queue {std::make_unique<TSafeQueueType>(TQueueType(dbPath))}
         , m_numberOfThreads {numberOfThreads}
+        , m_groupCommit {groupCommit}
+        , m_orderedPerPrefix {orderedPerPrefix}
     {
         if (m_numberOfThreads <= 0)
         {
@@ -89,14 +103,75 @@ public:
         }
     }
 
+    /**
+     * @brief Sets the number of elements handed over to the functor at once, from the next bulk on.
+     *
+     * @param bulkSize Number of elements, at least one.
+     */
+    void setBulkSize(const uint64_t bulkSize)
+    {
+        if (bulkSize == 0)
+        {
+            throw std::invalid_argument("Bulk size must be greater than 0.");
+        }
+        m_bulkSize.store(bulkSize);
+    }
+
+    /**
+     * @brief Sets what the pushes do when the queue is full, from the next push on.
+     *
+     * @param policy Drop and count the elements, block until there is room or wait up to a timeout.
+     * @param timeout Maximum wait of the TIMEOUT policy.
+     */
+    void setPushPolicy(const Utils::PushPolicy policy,
+                       const std::chrono::milliseconds& timeout = std::chrono::milliseconds::zero())
+    {
+        m_pushTimeout.store(timeout);
+        m_pushPolicy.store(policy);
+    }
+
+    /**
+     * @brief Gets the number of elements dropped because the queue was full.
+     */
+    uint64_t dropped() const
+    {
+        return m_queue->dropped();
+    }
+
     void push(const T& value)
     {
         // static assert to avoid compilation
         static_assert(!isTSafeMultiQueue, "This method is not supported for this queue type");
 
-        if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size() < m_maxQueueSize))
+        if (m_running)
         {
-            m_queue->push(value);
+            // Once the queue is full the group is skipped, so the push policy applies.
+            if (m_groupCommit && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size() < m_maxQueueSize))
+            {
+                groupPush(value);
+            }
+            else
+            {
+                m_queue->push(value, capacity(), m_pushPolicy.load(), m_pushTimeout.load());
+            }
+        }
+    }
+
+    /**
+     * @brief Pushes several elements with a single write.
+     *
+     * Elements beyond the maximum queue size are handled per the push policy, as with single pushes.
+     *
+     * @param values Elements to push, in queue order.
+     */
+    void pushBulk(const std::vector<T>& values)
+    {
+        // static assert to avoid compilation
+        static_assert(!isTSafeMultiQueue, "This method is not supported for this queue type");
+
+        if (m_running)
+        {
+            m_queue->pushBulk(values, capacity(), m_pushPolicy.load(), m_pushTimeout.load());
         }
     }
 
@@ -105,9 +180,28 @@ public:
         // static assert to avoid compilation
         static_assert(isTSafeMultiQueue, "This method is not supported for this queue type");
 
-        if (m_running && (UNLIMITED_QUEUE_SIZE == m_maxQueueSize || m_queue->size(prefix) < m_maxQueueSize))
+        if (m_running)
         {
-            m_queue->push(prefix, value);
+            m_queue->push(prefix, value, capacity(), m_pushPolicy.load(), m_pushTimeout.load());
+        }
+    }
+
+    /**
+     * @brief Pushes several elements to a prefix with a single write.
+     *
+     * Elements beyond the maximum queue size are handled per the push policy, as with single pushes.
+     *
+     * @param prefix Queue prefix.
+     * @param values Elements to push, in queue order.
+     */
+    void pushBulk(std::string_view prefix, const std::vector<T>& values)
+    {
+        // static assert to avoid compilation
+        static_assert(isTSafeMultiQueue, "This method is not supported for this queue type");
+
+        if (m_running)
+        {
+            m_queue->pushBulk(prefix, values, capacity(), m_pushPolicy.load(), m_pushTimeout.load());
         }
     }
 
@@ -176,6 +270,8 @@ private:
      * it either processes the queue in a single-threaded, ordered manner or in a multi-threaded, unordered manner.
      *
      * - In the single-threaded case, it uses the `singleAndOrdered` method.
+     * - In the multi-threaded case with a `TSafeMultiQueue` ordered per prefix, it uses the `multiAndOrderedPerPrefix`
+     *   method.
      * - In the multi-threaded case, it uses the `multiAndUnordered` method.
      */
     void dispatch()
@@ -188,6 +284,11 @@ private:
             {
                 singleAndOrdered();
             }
+            // If multiple threads drain different prefixes, keep the order within each prefix
+            else if (isTSafeMultiQueue && m_orderedPerPrefix)
+            {
+                multiAndOrderedPerPrefix();
+            }
             // If multiple threads are used, process the queue in a multi-threaded, unordered manner
             else if (m_numberOfThreads > 1)
             {
@@ -208,7 +309,7 @@ private:
         {
             if constexpr (isTSafeQueue)
             {
-                std::queue<U> data = m_queue->getBulk(m_bulkSize);
+                std::queue<U> data = m_queue->getBulk(m_bulkSize.load());
                 const auto size = data.size();
 
                 if (!data.empty())
@@ -239,6 +340,36 @@ private:
         }
     }
 
+    /**
+     * @brief Processes the queue in a multi-threaded manner, keeping the order within each prefix.
+     *
+     * Each thread claims a prefix no other thread is processing, processes its head element and releases it. The
+     * prefixes are claimed in round-robin order, so a slow prefix only holds back its own elements. In case of an
+     * exception, the element stays at the head of its prefix and is processed again.
+     */
+    void multiAndOrderedPerPrefix()
+    {
+        if constexpr (isTSafeMultiQueue)
+        {
+            auto data = m_queue->claimFront();
+            if (data.second.empty())
+            {
+                return;
+            }
+
+            try
+            {
+                m_functor(data.first);
+                m_queue->release(data.second, true);
+            }
+            catch (const std::exception& ex)
+            {
+                m_queue->release(data.second, false);
+                std::cerr << "Dispatch handler error: " << ex.what() << "\n";
+            }
+        }
+    }
+
     /**
      * @brief Processes the queue in a multi-threaded, unordered manner.
      *
@@ -254,7 +385,7 @@ private:
         {
             if constexpr (isTSafeQueue)
             {
-                data = m_queue->getBulkAndPop(m_bulkSize);
+                data = m_queue->getBulkAndPop(m_bulkSize.load());
 
                 if (!data.empty())
                 {
@@ -298,6 +429,84 @@ private:
         }
     }
 
+    /**
+     * @brief Gets the capacity handed over to the bounded pushes of the queue, 0 for no limit.
+     */
+    size_t capacity() const
+    {
+        return UNLIMITED_QUEUE_SIZE == m_maxQueueSize ? 0 : m_maxQueueSize;
+    }
+
+    /**
+     * @brief Elements pushed concurrently, written together.
+     */
+    struct PushGroup final
+    {
+        std::vector<const T*> values; ///< Elements, owned by the waiting pushers.
+        bool done {false};            ///< The group has been written.
+        std::exception_ptr error;     ///< Error writing the group, if any.
+    };
+
+    /**
+     * @brief Pushes an element along with the ones pushed concurrently, in a single write.
+     *
+     * The pusher that finds no write in progress becomes the leader: it writes the open group, and then the groups
+     * opened meanwhile, until none is left. Every other pusher adds its element to the open group and waits until it
+     * is written, so the element outlives the write and a failure reaches the pusher.
+     *
+     * @param value Element to push.
+     */
+    void groupPush(const T& value)
+    {
+        std::unique_lock lock {m_groupMutex};
+        if (!m_openGroup)
+        {
+            m_openGroup = std::make_shared<PushGroup>();
+        }
+        const auto group = m_openGroup;
+        group->values.push_back(&value);
+
+        if (m_groupWriting)
+        {
+            m_groupCv.wait(lock, [&group]() { return group->done; });
+        }
+        else
+        {
+            m_groupWriting = true;
+            while (m_openGroup)
+            {
+                const auto current = std::move(m_openGroup);
+                m_openGroup.reset();
+                lock.unlock();
+
+                try
+                {
+                    std::vector<T> values;
+                    values.reserve(current->values.size());
+                    for (const auto* element : current->values)
+                    {
+                        values.push_back(*element);
+                    }
+                    m_queue->pushBulk(values);
+                }
+                catch (...)
+                {
+                    current->error = std::current_exception();
+                }
+
+                lock.lock();
+                current->done = true;
+                m_groupCv.notify_all();
+            }
+            m_groupWriting = false;
+        }
+
+        if (group->error)
+        {
+            std::rethrow_exception(group->error);
+        }
+    }
+
     void joinThreads()
     {
         for (auto& thread : m_threads)
@@ -315,8 +524,18 @@ private:
     std::atomic_bool m_running = true;
 
     const size_t m_maxQueueSize;
-    const uint64_t m_bulkSize;
+    std::atomic<Utils::PushPolicy> m_pushPolicy {Utils::PushPolicy::DROP}; ///< What the pushes do when it is full.
+    std::atomic<std::chrono::milliseconds> m_pushTimeout {};               ///< Maximum wait of the TIMEOUT policy.
+    std::atomic<uint64_t> m_bulkSize; ///< Elements handed over to the functor at once.
     const uint8_t m_numberOfThreads;
+
+    const bool m_groupCommit;               ///< Concurrent single pushes are written together.
+    std::mutex m_groupMutex;                ///< Guards the push groups.
+    std::condition_variable m_groupCv;      ///< Signals the written push groups.
+    std::shared_ptr<PushGroup> m_openGroup; ///< Group that takes the new pushes.
+    bool m_groupWriting {false};            ///< A leader is writing the push groups.
+
+    const bool m_orderedPerPrefix; ///< Threads drain different prefixes concurrently, each one in order.
 };
 
 template<typename Type, typename Functor>
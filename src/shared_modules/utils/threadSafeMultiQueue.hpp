@@ -11,9 +11,16 @@
 
 #ifndef THREAD_SAFE_MULTIQUEUE_HPP
 #define THREAD_SAFE_MULTIQUEUE_HPP
+#include "threadSafeQueue.h"
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace Utils
 {
@@ -34,10 +41,12 @@ namespace Utils
         {
             std::scoped_lock lock {other.m_mutex};
             m_queue = other.m_queue;
+            m_size = m_queue.size();
         }
         explicit TSafeMultiQueue(Tq&& queue)
             : m_queue {std::move(queue)}
             , m_canceled {false}
+            , m_size {m_queue.size()}
         {
         }
 
@@ -52,10 +61,94 @@ namespace Utils
             if (!m_canceled)
             {
                 m_queue.push(prefix, value);
+                m_size.fetch_add(1, std::memory_order_relaxed);
                 m_cv.notify_one();
             }
         }
 
+        /**
+         * @brief Pushes an element if its prefix holds less than capacity elements.
+         *
+         * @param prefix Queue prefix.
+         * @param value Element to push.
+         * @param capacity Maximum number of elements of the prefix, 0 for no limit.
+         * @param policy What to do when the prefix is full.
+         * @param timeout Maximum wait of the TIMEOUT policy.
+         * @return true if the element was pushed, false if it was dropped or the queue was canceled.
+         */
+        bool push(std::string_view prefix,
+                  const T& value,
+                  const size_t capacity,
+                  const PushPolicy policy,
+                  const std::chrono::milliseconds& timeout = std::chrono::milliseconds::zero())
+        {
+            std::unique_lock lock {m_mutex};
+            if (!waitForRoom(lock, prefix, capacity, policy, timeout))
+            {
+                countDropped(1);
+                return false;
+            }
+
+            m_queue.push(prefix, value);
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            m_cv.notify_one();
+            return true;
+        }
+
+        void pushBulk(std::string_view prefix, const std::vector<T>& values)
+        {
+            std::scoped_lock lock {m_mutex};
+            if (!m_canceled && !values.empty())
+            {
+                m_queue.pushBulk(prefix, values);
+                m_size.fetch_add(values.size(), std::memory_order_relaxed);
+                m_cv.notify_all();
+            }
+        }
+
+        /**
+         * @brief Pushes the elements that fit in their prefix, in order.
+         *
+         * With the BLOCK and TIMEOUT policies the elements are pushed as room is made, the timeout applies to each
+         * wait.
+         *
+         * @param prefix Queue prefix.
+         * @param values Elements to push.
+         * @param capacity Maximum number of elements of the prefix, 0 for no limit.
+         * @param policy What to do when the prefix is full.
+         * @param timeout Maximum wait of the TIMEOUT policy.
+         * @return size_t Number of elements pushed, the rest were dropped.
+         */
+        size_t pushBulk(std::string_view prefix,
+                        const std::vector<T>& values,
+                        const size_t capacity,
+                        const PushPolicy policy,
+                        const std::chrono::milliseconds& timeout = std::chrono::milliseconds::zero())
+        {
+            std::unique_lock lock {m_mutex};
+            size_t pushed {0};
+
+            while (pushed < values.size() && waitForRoom(lock, prefix, capacity, policy, timeout))
+            {
+                const auto left {values.size() - pushed};
+                const auto room {capacity == 0 ? left : std::min<size_t>(left, capacity - m_queue.size(prefix))};
+                if (pushed == 0 && room == values.size())
+                {
+                    m_queue.pushBulk(prefix, values);
+                }
+                else
+                {
+                    m_queue.pushBulk(prefix, std::vector<T>(values.begin() + pushed, values.begin() + pushed + room));
+                }
+                pushed += room;
+                m_size.fetch_add(room, std::memory_order_relaxed);
+                m_cv.notify_all();
+            }
+
+            countDropped(values.size() - pushed);
+            return pushed;
+        }
+
         std::pair<U, std::string> front()
         {
             std::unique_lock lock {m_mutex};
@@ -107,18 +200,77 @@ namespace Utils
                 const auto& columnFamilyName = m_queue.getAvailableColumn();
                 auto data = std::make_pair(m_queue.front(columnFamilyName), columnFamilyName);
                 m_queue.pop(columnFamilyName);
+                madeRoom(1);
+                return data;
+            }
+
+            return std::pair<U, std::string> {};
+        }
+
+        /**
+         * @brief Gets the head element of a prefix not claimed by another consumer, and claims the prefix.
+         *
+         * The prefixes are served in round-robin order. A claimed prefix isn't handed to other consumers until it is
+         * released, so the elements of each prefix are processed in order while different prefixes are processed
+         * concurrently.
+         *
+         * @return std::pair<U, std::string> Element and prefix. Empty prefix if none is available in time.
+         */
+        std::pair<U, std::string> claimFront()
+        {
+            std::unique_lock lock {m_mutex};
+            const std::string* prefix = nullptr;
+
+            // wait_for instead of wait, to check if some postponed data is ready to be processed.
+            m_cv.wait_for(lock,
+                          std::chrono::seconds(QUEUE_CHECK_TIME),
+                          [&prefix, this]()
+                          {
+                              // coverity[missing_lock]
+                              prefix = m_canceled ? nullptr : m_queue.nextAvailableColumn(m_claimed);
+                              return prefix != nullptr || m_canceled;
+                          });
+
+            if (!m_canceled && prefix != nullptr)
+            {
+                auto data = std::make_pair(m_queue.front(*prefix), *prefix);
+                m_claimed.insert(*prefix);
                 return data;
             }
 
             return std::pair<U, std::string> {};
         }
 
+        /**
+         * @brief Releases a prefix claimed with claimFront.
+         *
+         * @param prefix Claimed prefix.
+         * @param processed If true, the head element has been processed and is removed.
+         */
+        void release(std::string_view prefix, const bool processed)
+        {
+            std::scoped_lock lock {m_mutex};
+            if (const auto it = m_claimed.find(prefix); it != m_claimed.end())
+            {
+                m_claimed.erase(it);
+            }
+
+            // The prefix may have been cleared meanwhile.
+            if (processed && !m_canceled && m_queue.size(prefix) > 0)
+            {
+                m_queue.pop(prefix);
+                madeRoom(1);
+            }
+            m_cv.notify_all();
+        }
+
         void pop(std::string_view prefix)
         {
             std::scoped_lock lock {m_mutex};
             if (!m_canceled)
             {
                 m_queue.pop(prefix);
+                madeRoom(1);
             }
         }
 
@@ -131,7 +283,9 @@ namespace Utils
         void clear(std::string_view prefix)
         {
             std::scoped_lock lock {m_mutex};
+            const auto removed = prefix.empty() ? m_queue.size() : m_queue.size(prefix);
             m_queue.clear(prefix);
+            madeRoom(removed);
         }
 
         size_t size(std::string_view prefix) const
@@ -140,12 +294,31 @@ namespace Utils
             return m_queue.size(prefix);
         }
 
+        /**
+         * @brief Gets the number of elements of all the prefixes, without taking the lock.
+         *
+         * The size is updated along with the queue, so it may be outdated by the time it is read.
+         */
+        size_t size() const
+        {
+            return m_size.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the number of elements dropped by the bounded pushes.
+         */
+        uint64_t dropped() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
+        }
+
         void cancel()
         {
             std::scoped_lock lock {m_mutex};
 
             m_canceled = true;
             m_cv.notify_all();
+            m_roomCv.notify_all();
         }
 
         bool cancelled() const
@@ -161,10 +334,67 @@ namespace Utils
         }
 
     private:
+        // The helpers below expect the lock held.
+        void madeRoom(const size_t removed)
+        {
+            const auto size = m_size.load(std::memory_order_relaxed);
+            m_size.store(size - std::min(removed, size), std::memory_order_relaxed);
+            if (m_waitingPushers > 0)
+            {
+                m_roomCv.notify_all();
+            }
+        }
+
+        void countDropped(const size_t count)
+        {
+            if (!m_canceled && count > 0)
+            {
+                m_dropped.fetch_add(count, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Waits for room per the policy, true if the queue is not canceled and the prefix has room for an
+         * element.
+         */
+        bool waitForRoom(std::unique_lock<std::mutex>& lock,
+                         std::string_view prefix,
+                         const size_t capacity,
+                         const PushPolicy policy,
+                         const std::chrono::milliseconds& timeout)
+        {
+            const auto hasRoom = [this, prefix, capacity]()
+            {
+                // coverity[missing_lock]
+                return m_canceled || capacity == 0 || m_queue.size(prefix) < capacity;
+            };
+
+            if (!hasRoom() && policy != PushPolicy::DROP)
+            {
+                ++m_waitingPushers;
+                if (policy == PushPolicy::BLOCK)
+                {
+                    m_roomCv.wait(lock, hasRoom);
+                }
+                else
+                {
+                    m_roomCv.wait_for(lock, timeout, hasRoom);
+                }
+                --m_waitingPushers;
+            }
+
+            return !m_canceled && (capacity == 0 || m_queue.size(prefix) < capacity);
+        }
+
         mutable std::mutex m_mutex;
         std::condition_variable m_cv;
+        std::condition_variable m_roomCv; ///< Signaled when elements are removed and a pusher waits for room.
         std::atomic<bool> m_canceled {};
         Tq m_queue;
+        std::set<std::string, std::less<>> m_claimed; ///< Prefixes being processed by a consumer.
+        std::atomic<size_t> m_size {};                ///< Number of elements, readable without the lock.
+        std::atomic<uint64_t> m_dropped {};           ///< Elements dropped by the bounded pushes.
+        size_t m_waitingPushers {};                   ///< Pushers waiting for room.
     };
 } // namespace Utils
 
@@ -11,16 +11,61 @@
 
 #ifndef THREAD_SAFE_QUEUE_H
 #define THREAD_SAFE_QUEUE_H
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace Utils
 {
+    /**
+     * @brief Checks if a queue type gets and removes bulks of elements on its own.
+     */
+    template<typename Tq, typename = void>
+    struct HasBulkOperations : std::false_type
+    {
+    };
+
+    template<typename Tq>
+    struct HasBulkOperations<Tq,
+                             std::void_t<decltype(std::declval<const Tq&>().getBulk(uint64_t {})),
+                                         decltype(std::declval<Tq&>().popBulk(uint64_t {}))>> : std::true_type
+    {
+    };
+
+    /**
+     * @brief Checks if a queue type pushes several elements at once.
+     */
+    template<typename Tq, typename T, typename = void>
+    struct HasBulkPush : std::false_type
+    {
+    };
+
+    template<typename Tq, typename T>
+    struct HasBulkPush<Tq,
+                       T,
+                       std::void_t<decltype(std::declval<Tq&>().pushBulk(std::declval<const std::vector<T>&>()))>>
+        : std::true_type
+    {
+    };
+
+    /**
+     * @brief What a bounded push does when the queue is full.
+     */
+    enum class PushPolicy
+    {
+        DROP,    ///< Drop the elements that don't fit, and count them.
+        BLOCK,   ///< Wait until there is room, or the queue is canceled.
+        TIMEOUT, ///< Wait until there is room for up to a timeout, then drop and count the elements left.
+    };
 
     template<typename T, typename U, typename Tq = std::queue<T>>
     class TSafeQueue
@@ -36,11 +81,13 @@ namespace Utils
         {
             std::lock_guard<std::mutex> lock {other.m_mutex};
             m_queue = other.m_queue;
+            updateSize();
         }
         explicit TSafeQueue(Tq&& queue)
             : m_queue {std::move(queue)}
             , m_canceled {false}
         {
+            updateSize();
         }
         ~TSafeQueue()
         {
@@ -54,10 +101,83 @@ namespace Utils
             if (!m_canceled)
             {
                 m_queue.push(value);
+                updateSize();
                 m_cv.notify_one();
             }
         }
 
+        /**
+         * @brief Pushes an element if the queue holds less than capacity elements.
+         *
+         * @param value Element to push.
+         * @param capacity Maximum number of elements in the queue, 0 for no limit.
+         * @param policy What to do when the queue is full.
+         * @param timeout Maximum wait of the TIMEOUT policy.
+         * @return true if the element was pushed, false if it was dropped or the queue was canceled.
+         */
+        bool push(const T& value,
+                  const size_t capacity,
+                  const PushPolicy policy,
+                  const std::chrono::milliseconds& timeout = std::chrono::milliseconds::zero())
+        {
+            std::unique_lock<std::mutex> lock {m_mutex};
+
+            if (!waitForRoom(lock, capacity, policy, timeout))
+            {
+                countDropped(1);
+                return false;
+            }
+
+            m_queue.push(value);
+            updateSize();
+            m_cv.notify_one();
+            return true;
+        }
+
+        void pushBulk(const std::vector<T>& values)
+        {
+            std::lock_guard<std::mutex> lock {m_mutex};
+
+            if (!m_canceled && !values.empty())
+            {
+                pushValues(values, 0, values.size());
+                m_cv.notify_all();
+            }
+        }
+
+        /**
+         * @brief Pushes the elements that fit in the queue, in order.
+         *
+         * With the BLOCK and TIMEOUT policies the elements are pushed as room is made, the timeout applies to each
+         * wait.
+         *
+         * @param values Elements to push.
+         * @param capacity Maximum number of elements in the queue, 0 for no limit.
+         * @param policy What to do when the queue is full.
+         * @param timeout Maximum wait of the TIMEOUT policy.
+         * @return size_t Number of elements pushed, the rest were dropped.
+         */
+        size_t pushBulk(const std::vector<T>& values,
+                        const size_t capacity,
+                        const PushPolicy policy,
+                        const std::chrono::milliseconds& timeout = std::chrono::milliseconds::zero())
+        {
+            std::unique_lock<std::mutex> lock {m_mutex};
+            size_t pushed {0};
+
+            while (pushed < values.size() && waitForRoom(lock, capacity, policy, timeout))
+            {
+                const auto left {values.size() - pushed};
+                const auto room {capacity == 0 ? left : std::min<size_t>(left, capacity - m_queue.size())};
+                pushValues(values, pushed, room);
+                pushed += room;
+                m_cv.notify_all();
+            }
+
+            countDropped(values.size() - pushed);
+            return pushed;
+        }
+
         bool pop(U& value, const bool wait = true)
         {
             std::unique_lock<std::mutex> lock {m_mutex};
@@ -73,6 +193,7 @@ namespace Utils
             {
                 value = std::move(m_queue.front());
                 m_queue.pop();
+                madeRoom();
             }
 
             return ret;
@@ -93,6 +214,7 @@ namespace Utils
             {
                 const auto spData {std::make_shared<U>(m_queue.front())};
                 m_queue.pop();
+                madeRoom();
                 return spData;
             }
 
@@ -121,10 +243,7 @@ namespace Utils
             // If the queue is not canceled, get the elements.
             if (!m_canceled)
             {
-                for (auto i = 0; i < elementsQuantity && i < m_queue.size(); ++i)
-                {
-                    bulkQueue.push(std::move(m_queue.at(i)));
-                }
+                bulkQueue = readBulk(elementsQuantity);
             }
 
             return bulkQueue;
@@ -133,10 +252,8 @@ namespace Utils
         void popBulk(const uint64_t elementsQuantity)
         {
             std::lock_guard<std::mutex> lock {m_mutex};
-            for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
-            {
-                m_queue.pop();
-            }
+            removeBulk(elementsQuantity);
+            madeRoom();
         }
 
         std::queue<U> getBulkAndPop(const uint64_t elementsQuantity,
@@ -161,17 +278,12 @@ namespace Utils
             // If the queue is not canceled, get the elements.
             if (!m_canceled)
             {
-                for (auto i = 0; i < elementsQuantity && i < m_queue.size(); ++i)
-                {
-                    bulkQueue.push(std::move(m_queue.at(i)));
-                }
+                bulkQueue = readBulk(elementsQuantity);
             }
 
             // Pop the elements from the queue after getting them.
-            for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
-            {
-                m_queue.pop();
-            }
+            removeBulk(elementsQuantity);
+            madeRoom();
 
             return bulkQueue;
         }
@@ -182,10 +294,22 @@ namespace Utils
             return m_queue.empty();
         }
 
+        /**
+         * @brief Gets the number of elements, without taking the lock.
+         *
+         * The size is updated along with the queue, so it may be outdated by the time it is read.
+         */
         size_t size() const
         {
-            std::lock_guard<std::mutex> lock {m_mutex};
-            return m_queue.size();
+            return m_size.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Gets the number of elements dropped by the bounded pushes.
+         */
+        uint64_t dropped() const
+        {
+            return m_dropped.load(std::memory_order_relaxed);
         }
 
         void cancel()
@@ -193,6 +317,7 @@ namespace Utils
             std::lock_guard<std::mutex> lock {m_mutex};
             m_canceled = true;
             m_cv.notify_all();
+            m_roomCv.notify_all();
         }
 
         bool cancelled() const
@@ -202,10 +327,124 @@ namespace Utils
         }
 
     private:
+        // The helpers below expect the lock held.
+        void updateSize()
+        {
+            m_size.store(m_queue.size(), std::memory_order_relaxed);
+        }
+
+        void madeRoom()
+        {
+            updateSize();
+            if (m_waitingPushers > 0)
+            {
+                m_roomCv.notify_all();
+            }
+        }
+
+        void countDropped(const size_t count)
+        {
+            if (!m_canceled && count > 0)
+            {
+                m_dropped.fetch_add(count, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Waits for room per the policy, true if the queue is not canceled and has room for an element.
+         */
+        bool waitForRoom(std::unique_lock<std::mutex>& lock,
+                         const size_t capacity,
+                         const PushPolicy policy,
+                         const std::chrono::milliseconds& timeout)
+        {
+            const auto hasRoom = [this, capacity]()
+            {
+                // coverity[missing_lock]
+                return m_canceled || capacity == 0 || m_queue.size() < capacity;
+            };
+
+            if (!hasRoom() && policy != PushPolicy::DROP)
+            {
+                ++m_waitingPushers;
+                if (policy == PushPolicy::BLOCK)
+                {
+                    m_roomCv.wait(lock, hasRoom);
+                }
+                else
+                {
+                    m_roomCv.wait_for(lock, timeout, hasRoom);
+                }
+                --m_waitingPushers;
+            }
+
+            return !m_canceled && (capacity == 0 || m_queue.size() < capacity);
+        }
+
+        void pushValues(const std::vector<T>& values, const size_t first, const size_t count)
+        {
+            if constexpr (HasBulkPush<Tq, T>::value)
+            {
+                if (first == 0 && count == values.size())
+                {
+                    m_queue.pushBulk(values);
+                }
+                else
+                {
+                    m_queue.pushBulk(std::vector<T>(values.begin() + first, values.begin() + first + count));
+                }
+            }
+            else
+            {
+                for (auto i = first; i < first + count; ++i)
+                {
+                    m_queue.push(values[i]);
+                }
+            }
+            updateSize();
+        }
+
+        // Queues with bulk operations read and delete the whole bulk at once. Both helpers expect the lock held.
+        std::queue<U> readBulk(const uint64_t elementsQuantity) const
+        {
+            if constexpr (HasBulkOperations<Tq>::value)
+            {
+                return m_queue.getBulk(elementsQuantity);
+            }
+            else
+            {
+                std::queue<U> bulkQueue;
+                for (auto i = 0; i < elementsQuantity && i < m_queue.size(); ++i)
+                {
+                    bulkQueue.push(std::move(m_queue.at(i)));
+                }
+                return bulkQueue;
+            }
+        }
+
+        void removeBulk(const uint64_t elementsQuantity)
+        {
+            if constexpr (HasBulkOperations<Tq>::value)
+            {
+                m_queue.popBulk(elementsQuantity);
+            }
+            else
+            {
+                for (auto i = 0; i < elementsQuantity && !m_queue.empty(); ++i)
+                {
+                    m_queue.pop();
+                }
+            }
+        }
+
         mutable std::mutex m_mutex;
         std::condition_variable m_cv;
+        std::condition_variable m_roomCv; ///< Signaled when elements are removed and a pusher waits for room.
         std::atomic<bool> m_canceled {};
         Tq m_queue;
+        std::atomic<size_t> m_size {};      ///< Number of elements, readable without the lock.
+        std::atomic<uint64_t> m_dropped {}; ///< Elements dropped by the bounded pushes.
+        size_t m_waitingPushers {};         ///< Pushers waiting for room.
     };
 
     template<typename T, typename Tq = std::queue<T>>
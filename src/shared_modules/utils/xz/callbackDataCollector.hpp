@@ -0,0 +1,73 @@
+/*
+ * Wazuh - Shared Modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _CALLBACK_DATA_COLLECTOR_HPP
+#define _CALLBACK_DATA_COLLECTOR_HPP
+
+#include "iDataCollector.hpp"
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace Xz
+{
+    /**
+     * @brief Hands the output data over to a callback as it is produced, so it is never stored as a whole
+     *
+     */
+    class CallbackDataCollector : public IDataCollector
+    {
+    public:
+        /**
+         * @brief Receives each block of output data. The data is only valid during the call.
+         *
+         */
+        using Callback = std::function<void(const uint8_t* data, size_t dataLen)>;
+
+    private:
+        static constexpr size_t DEFAULT_BUFFER_SIZE {64 * 1024}; ///< Default buffer size
+        Callback m_callback;                                     ///< Receiver of the output data
+        std::vector<uint8_t> m_buffer;                           ///< Buffer used to receive the output data
+
+    public:
+        /**
+         * @brief Construct a new Callback Data Collector object
+         *
+         * @param callback Receiver of the output data
+         * @param bufferSize Size to give to the receiving buffer, and maximum size of each block handed over
+         */
+        explicit CallbackDataCollector(Callback callback, size_t bufferSize = DEFAULT_BUFFER_SIZE)
+            : m_callback(std::move(callback))
+        {
+            m_buffer.resize(bufferSize);
+        }
+
+        /*! @copydoc IDataCollector::begin() */
+        void begin() override {}
+
+        /*! @copydoc IDataCollector::setBuffer() */
+        void setBuffer(uint8_t** buffer, size_t& buffSize) override
+        {
+            *buffer = m_buffer.data();
+            buffSize = m_buffer.size();
+        }
+
+        /*! @copydoc IDataCollector::dataReady() */
+        void dataReady(size_t unusedBufferLen) override
+        {
+            if (const auto dataLen {m_buffer.size() - unusedBufferLen}; dataLen > 0)
+            {
+                m_callback(m_buffer.data(), dataLen);
+            }
+        }
+    };
+} // namespace Xz
+#endif // _CALLBACK_DATA_COLLECTOR_HPP
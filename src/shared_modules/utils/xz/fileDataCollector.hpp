@@ -26,9 +26,9 @@ namespace Xz
      */
     class FileDataCollector : public IDataCollector
     {
-        static constexpr size_t DEFAULT_BUFFER_SIZE {8192}; ///< Default buffer size
-        std::filesystem::path m_filePath;                   ///< Output file path
-        std::ofstream m_file;                               ///< Output file stream
+        static constexpr size_t DEFAULT_BUFFER_SIZE {64 * 1024}; ///< Default buffer size
+        std::filesystem::path m_filePath;                        ///< Output file path
+        std::ofstream m_file;                                    ///< Output file stream
         std::vector<uint8_t> m_buffer; ///< Buffer used to receive data that will be saved to the file
 
     public:
@@ -47,7 +47,7 @@ namespace Xz
         /*! @copydoc IDataCollector::begin() */
         void begin() override
         {
-            m_file = std::ofstream(m_filePath);
+            m_file = std::ofstream(m_filePath, std::ios::binary);
             if (!m_file.is_open())
             {
                 // LCOV_EXCL_START
@@ -25,10 +25,10 @@ namespace Xz
      */
     class FileDataProvider : public IDataProvider
     {
-        static constexpr size_t DEFAULT_BUFFER_SIZE {8192}; ///< Default buffer size
-        std::filesystem::path m_filePath;                   ///< Input file path
-        std::ifstream m_file;                               ///< Input file stream
-        std::vector<uint8_t> m_buffer;                      ///< Buffer used to read data from the file
+        static constexpr size_t DEFAULT_BUFFER_SIZE {64 * 1024}; ///< Default buffer size
+        std::filesystem::path m_filePath;                        ///< Input file path
+        std::ifstream m_file;                                    ///< Input file stream
+        std::vector<uint8_t> m_buffer;                           ///< Buffer used to read data from the file
 
     public:
         /**
@@ -46,7 +46,7 @@ namespace Xz
         /*! @copydoc IDataProvider::begin() */
         void begin() override
         {
-            m_file = std::ifstream(m_filePath);
+            m_file = std::ifstream(m_filePath, std::ios::binary);
             if (!m_file.is_open())
             {
                 throw std::runtime_error("Could not open input file '" + m_filePath.string() + "'");
@@ -0,0 +1,82 @@
+/*
+ * Wazuh - Shared Modules utils
+ * Copyright (C) 2015, Wazuh Inc.
+ * October 14, 2026.
+ *
+ * This program is free software; you can redistribute it
+ * and/or modify it under the terms of the GNU General Public
+ * License (version 2) as published by the FSF - Free Software
+ * Foundation.
+ */
+
+#ifndef _MAPPED_FILE_DATA_PROVIDER_HPP
+#define _MAPPED_FILE_DATA_PROVIDER_HPP
+
+#include "../mappedFile.hpp"
+#include "iDataProvider.hpp"
+#include <algorithm>
+#include <filesystem>
+#include <memory>
+
+namespace Xz
+{
+    /**
+     * @brief Provides data from an input file mapped in memory, so the blocks point into the page cache instead of
+     * being read into a buffer
+     *
+     */
+    class MappedFileDataProvider : public IDataProvider
+    {
+        static constexpr size_t DEFAULT_BLOCK_SIZE {1024 * 1024}; ///< Default block size
+        std::filesystem::path m_filePath;                          ///< Input file path
+        std::unique_ptr<Utils::MappedFile> m_spFile;               ///< Input file mapping
+        size_t m_blockSize;                                        ///< Maximum size of each block
+        size_t m_offset {};                                        ///< Offset of the next block
+
+    public:
+        /**
+         * @brief Construct a new Mapped File Data Provider object
+         *
+         * @param inputFilePath Path to the input file
+         * @param blockSize Maximum size of each block
+         */
+        explicit MappedFileDataProvider(const std::filesystem::path& inputFilePath,
+                                        size_t blockSize = DEFAULT_BLOCK_SIZE)
+            : m_filePath(inputFilePath)
+            , m_blockSize(blockSize)
+        {
+        }
+
+        /*! @copydoc IDataProvider::begin() */
+        void begin() override
+        {
+            try
+            {
+                m_spFile = std::make_unique<Utils::MappedFile>(m_filePath);
+            }
+            catch (const std::exception& e)
+            {
+                throw std::runtime_error("Could not open input file '" + m_filePath.string() + "': " + e.what());
+            }
+            m_offset = 0;
+        }
+
+        /**
+         * @copydoc IDataProvider::getNextBlock()
+         * @details Hand over the next block of the mapping. If the end of the file was reached returns dataLen = 0
+         * @return DataBlock
+         */
+        DataBlock getNextBlock() override
+        {
+            DataBlock dataBlock;
+            if (m_offset < m_spFile->size())
+            {
+                dataBlock.data = m_spFile->data() + m_offset;
+                dataBlock.dataLen = std::min(m_blockSize, m_spFile->size() - m_offset);
+                m_offset += dataBlock.dataLen;
+            }
+            return dataBlock;
+        }
+    };
+} // namespace Xz
+#endif // _MAPPED_FILE_DATA_PROVIDER_HPP
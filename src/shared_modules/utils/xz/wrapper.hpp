@@ -15,6 +15,7 @@
 #include "iDataCollector.hpp"
 #include "iDataProvider.hpp"
 #include "lzma.h"
+#include <algorithm>
 #include <stdexcept>
 #include <string>
 
@@ -130,8 +131,9 @@ namespace Xz
                 m_multiThreadOptions.memlimit_stop = UINT64_MAX;
                 // Set number of worker threads
                 m_multiThreadOptions.threads = threadCount;
-                // If the number of worker threads exceeds the max or it is set to 0 then use max threads
-                if (auto maxThreads {lzma_cputhreads()};
+                // If the number of worker threads exceeds the max or it is set to 0 then use max threads. The decoder
+                // only splits the work for archives with several blocks: the others are decoded in a single thread.
+                if (auto maxThreads {std::max(lzma_cputhreads(), 1U)};
                     m_multiThreadOptions.threads > maxThreads || m_multiThreadOptions.threads == 0)
                 {
                     m_multiThreadOptions.threads = maxThreads;
@@ -8,8 +8,10 @@
 #ifndef _XZ_HELPER_HPP
 #define _XZ_HELPER_HPP
 
+#include "xz/callbackDataCollector.hpp"
 #include "xz/fileDataCollector.hpp"
 #include "xz/fileDataProvider.hpp"
+#include "xz/mappedFileDataProvider.hpp"
 #include "xz/iDataCollector.hpp"
 #include "xz/iDataProvider.hpp"
 #include "xz/stringDataProvider.hpp"
@@ -19,6 +21,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace Utils
@@ -44,7 +47,7 @@ namespace Utils
         XzHelper(const std::filesystem::path& source,
                  const std::filesystem::path& dest,
                  uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
-            : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
+            : m_spDataProvider(std::make_unique<Xz::MappedFileDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::FileDataCollector>(dest))
             , m_threadCount(threadCount)
         {
@@ -60,7 +63,7 @@ namespace Utils
         XzHelper(const std::filesystem::path& source,
                  std::vector<uint8_t>& dest,
                  uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
-            : m_spDataProvider(std::make_unique<Xz::FileDataProvider>(source))
+            : m_spDataProvider(std::make_unique<Xz::MappedFileDataProvider>(source))
             , m_spDataCollector(std::make_unique<Xz::VectorDataCollector>(dest))
             , m_threadCount(threadCount)
         {
@@ -128,6 +131,38 @@ namespace Utils
         {
         }
 
+        /**
+         * @brief Construct XZ helper with file input and streamed output
+         *
+         * @param source Path to input file
+         * @param dest Receiver of each block of output data, as it is produced
+         * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         */
+        XzHelper(const std::filesystem::path& source,
+                 Xz::CallbackDataCollector::Callback dest,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+            : m_spDataProvider(std::make_unique<Xz::MappedFileDataProvider>(source))
+            , m_spDataCollector(std::make_unique<Xz::CallbackDataCollector>(std::move(dest)))
+            , m_threadCount(threadCount)
+        {
+        }
+
+        /**
+         * @brief Construct XZ helper with vector input and streamed output
+         *
+         * @param source Vector with the input data
+         * @param dest Receiver of each block of output data, as it is produced
+         * @param threadCount  Number of worker threads. 0 uses all the available threads.
+         */
+        XzHelper(const std::vector<uint8_t>& source,
+                 Xz::CallbackDataCollector::Callback dest,
+                 uint32_t threadCount = Xz::DEFAULT_THREAD_COUNT)
+            : m_spDataProvider(std::make_unique<Xz::VectorDataProvider>(source))
+            , m_spDataCollector(std::make_unique<Xz::CallbackDataCollector>(std::move(dest)))
+            , m_threadCount(threadCount)
+        {
+        }
+
         /**
          * @brief Compress the input data
          *
@@ -16,11 +16,18 @@
 #include "defer.hpp"
 #include "minizip/unzip.h"
 #include "stringHelper.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 #include <zlib.h>
 
@@ -31,6 +38,7 @@ inline constexpr auto KB {1024};
 
 inline constexpr auto GZ_BUF_LEN {16 * KB};
 inline constexpr auto ZIP_BUF_LEN {64 * KB};
+inline constexpr auto GZ_STREAM_BUF_LEN {256 * KB};
 
 namespace Utils
 {
@@ -50,6 +58,84 @@ namespace Utils
         ZlibHelper(ZlibHelper&&) = delete;
         ZlibHelper& operator=(ZlibHelper&&) = delete;
 
+        /**
+         * @brief Uncompress GZIP file, handing the uncompressed content to a callback as it's produced, so no
+         * intermediate file is needed.
+         *
+         * @details The input is inflated directly from large reads of the file, without the double buffering of gzread.
+         * A file with several members (e.g. concatenated .gz files) produces the concatenation of their contents.
+         *
+         * @param gzFilePath Compressed (.gz) file path.
+         * @param onChunk Callback receiving each chunk of uncompressed content, in order.
+         */
+        static void gzipDecompress(const std::filesystem::path& gzFilePath,
+                                   const std::function<void(std::string_view)>& onChunk)
+        {
+            // Open compressed file.
+            std::ifstream inputFile {gzFilePath, std::ios::binary};
+            if (!inputFile.good())
+            {
+                throw std::runtime_error("Unable to open compressed file: " + gzFilePath.string());
+            }
+
+            // Window bits plus 16 selects the GZIP header and trailer.
+            constexpr auto GZIP_WINDOW_BITS {15 + 16};
+            constexpr auto GZIP_MAGIC_FIRST_BYTE {0x1f};
+
+            z_stream stream {};
+            if (inflateInit2(&stream, GZIP_WINDOW_BITS) != Z_OK)
+            {
+                throw std::runtime_error("Unable to initialize GZIP decompression");
+            }
+            DEFER([&stream]() { inflateEnd(&stream); });
+
+            std::vector<char> input(GZ_STREAM_BUF_LEN);
+            std::vector<char> output(GZ_STREAM_BUF_LEN);
+            auto result {Z_OK};
+            while (true)
+            {
+                if (stream.avail_in == 0)
+                {
+                    inputFile.read(input.data(), input.size());
+                    stream.next_in = reinterpret_cast<Bytef*>(input.data());
+                    stream.avail_in = inputFile.gcount();
+                    if (stream.avail_in == 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (result == Z_STREAM_END)
+                {
+                    // Anything but another member after the end of a member is ignored, as gzread does.
+                    if (stream.next_in[0] != GZIP_MAGIC_FIRST_BYTE)
+                    {
+                        break;
+                    }
+                    inflateReset(&stream);
+                }
+
+                stream.next_out = reinterpret_cast<Bytef*>(output.data());
+                stream.avail_out = output.size();
+                result = inflate(&stream, Z_NO_FLUSH);
+                if (result != Z_OK && result != Z_STREAM_END)
+                {
+                    throw std::runtime_error("Unable to decompress file: " + gzFilePath.string() + ": " +
+                                             (stream.msg ? stream.msg : std::to_string(result)));
+                }
+
+                if (const auto size {output.size() - stream.avail_out}; size > 0)
+                {
+                    onChunk(std::string_view(output.data(), size));
+                }
+            }
+
+            if (result != Z_STREAM_END)
+            {
+                throw std::runtime_error("Truncated compressed file: " + gzFilePath.string());
+            }
+        }
+
         /**
          * @brief Uncompress GZIP file.
          *
@@ -65,91 +151,127 @@ namespace Utils
             }
 
             // Create uncompressed file.
-            std::ofstream outputFile {outputFilePath};
+            std::ofstream outputFile {outputFilePath, std::ios::binary};
             if (!outputFile.good())
             {
                 throw std::runtime_error("Unable to create destination file: " + outputFilePath.string());
             }
 
-            // Open compressed file.
-            ZFilePtr gzFile {gzopen(gzFilePath.c_str(), "rb")};
-            if (!gzFile)
+            gzipDecompress(gzFilePath,
+                           [&outputFile, &outputFilePath](std::string_view chunk)
+                           {
+                               if (outputFile.write(chunk.data(), chunk.size()).bad())
+                               {
+                                   // LCOV_EXCL_START
+                                   throw std::runtime_error("Unable to write to destination file: " +
+                                                            outputFilePath.string());
+                                   // LCOV_EXCL_STOP
+                               }
+                           });
+            outputFile.close();
+        }
+
+        /**
+         * @brief Compress data in memory with the GZIP format, e.g. for HTTP request bodies.
+         *
+         * @param data Data to compress.
+         * @param level Compression level, from 1 (fastest) to 9 (smallest).
+         * @return std::string Compressed data.
+         */
+        static std::string gzipCompress(std::string_view data, const int level = Z_DEFAULT_COMPRESSION)
+        {
+            // Window bits plus 16 selects the GZIP header and trailer.
+            constexpr auto GZIP_WINDOW_BITS {15 + 16};
+            constexpr auto MEMORY_LEVEL {8};
+
+            z_stream stream {};
+            if (deflateInit2(&stream, level, Z_DEFLATED, GZIP_WINDOW_BITS, MEMORY_LEVEL, Z_DEFAULT_STRATEGY) != Z_OK)
             {
-                throw std::runtime_error("Unable to open compressed file: " + gzFilePath.string());
+                throw std::runtime_error("Unable to initialize GZIP compression");
             }
+            DEFER([&stream]() { deflateEnd(&stream); });
 
-            int len {};
-            char buf[GZ_BUF_LEN] {};
-            do
+            std::string compressed(deflateBound(&stream, data.size()), '\0');
+            stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+            stream.avail_in = data.size();
+            stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+            stream.avail_out = compressed.size();
+
+            // The output buffer is large enough for the whole data, a single call finishes the stream.
+            if (deflate(&stream, Z_FINISH) != Z_STREAM_END)
             {
-                len = gzread(gzFile.get(), buf, sizeof(buf));
+                throw std::runtime_error("Unable to compress data with GZIP");
+            }
+            compressed.resize(stream.total_out);
 
-                if (len > 0)
-                {
-                    if (outputFile.write(buf, len).bad())
-                    {
-                        // LCOV_EXCL_START
-                        throw std::runtime_error("Unable to write to destination file: " + outputFilePath.string());
-                        // LCOV_EXCL_STOP
-                    }
+            return compressed;
+        }
+
+        /**
+         * @brief Uncompress each file within a ZIP file, handing its content to a callback as it's produced, so no
+         * intermediate file is needed. The folders are skipped.
+         *
+         * @param zipFilePath Compressed (.zip) file path.
+         * @param onChunk Callback receiving the name of the file within the ZIP file and each chunk of its content, in
+         * order.
+         */
+        static void zipDecompress(const std::filesystem::path& zipFilePath,
+                                  const std::function<void(const std::string&, std::string_view)>& onChunk)
+        {
+            auto spUnzFile {openZip(zipFilePath)};
 
-                    buf[0] = '\0';
+            std::vector<char> buffer(ZIP_BUF_LEN);
+            do
+            {
+                std::string filename;
+                const auto fileInfo {currentFileInfo(spUnzFile.get(), zipFilePath, filename)};
+                if (!Utils::endsWith(filename, "/"))
+                {
+                    readCurrentFile(spUnzFile.get(),
+                                    filename,
+                                    fileInfo,
+                                    buffer,
+                                    [&onChunk, &filename](std::string_view chunk) { onChunk(filename, chunk); });
                 }
-            } while (len == sizeof(buf));
-            outputFile.close();
+            } while (unzGoToNextFile(spUnzFile.get()) == UNZ_OK);
         }
 
         /**
          * @brief Uncompress ZIP file and returns a list with the decompressed files.
          *
+         * @details The files within a ZIP file are compressed independently, so with more than one thread each thread
+         * opens the ZIP file on its own and takes the next pending file until there are none left.
+         *
          * @param zipFilePath Compressed (.zip) file path.
          * @param outputDir Folder where the output files will be stored.
-         * @return std::vector<std::string> List of decompressed files.
+         * @param threads Amount of files decompressed at the same time.
+         * @return std::vector<std::string> List of decompressed files, in the order they're stored in the ZIP file.
          */
         static std::vector<std::string> zipDecompress(const std::filesystem::path& zipFilePath,
-                                                      const std::filesystem::path& outputDir)
+                                                      const std::filesystem::path& outputDir,
+                                                      const size_t threads = 1)
         {
             // Open .zip file.
-            UnzFilePtr spUnzFile {unzOpen(zipFilePath.c_str())};
-            if (!spUnzFile)
-            {
-                // File doesn't exist or is invalid (e.g. empty ZIP).
-                throw std::runtime_error {"Unable to open compressed file: " + zipFilePath.string()};
-            }
+            auto spUnzFile {openZip(zipFilePath)};
 
-            // Get .zip file information (amount of files, i.e.).
-            unz_global_info globalInfo;
-            if (unzGetGlobalInfo(spUnzFile.get(), &globalInfo) != UNZ_OK)
+            // Iterate all compressed files within the .zip file, creating the folders and listing the files. The
+            // folders are created beforehand so any file can be decompressed first.
+            struct Entry final
             {
-                throw std::runtime_error {"Unable to get global information of file: " + zipFilePath.string()};
-            }
-
-            // Iterate all compressed files within the .zip file.
+                size_t index;
+                std::string filename;
+                unz_file_info fileInfo;
+            };
+            std::vector<Entry> entries;
             std::vector<std::string> decompressedFiles;
-            decompressedFiles.reserve(globalInfo.number_entry);
+            size_t index {0};
             do
             {
-                constexpr auto MAX_FILENAME_LEN {4096};
-                unz_file_info fileInfo;
-                char filename[MAX_FILENAME_LEN];
-                if (unzGetCurrentFileInfo(
-                        spUnzFile.get(), &fileInfo, filename, sizeof(filename), nullptr, 0, nullptr, 0) != UNZ_OK)
-                {
-                    throw std::runtime_error {"Unable to get current file information from zip file: " +
-                                              zipFilePath.string()};
-                }
-
-                // Open current file within the .zip file.
-                if (unzOpenCurrentFile(spUnzFile.get()) != UNZ_OK)
-                {
-                    throw std::runtime_error {"Unable to open current file: " + std::string(filename)};
-                }
-
-                // Close current file when going out of scope.
-                DEFER([&spUnzFile]() { unzCloseCurrentFile(spUnzFile.get()); });
+                std::string filename;
+                const auto fileInfo {currentFileInfo(spUnzFile.get(), zipFilePath, filename)};
 
                 // Check for possible Zip Slip vulnerability.
-                const auto outputFilepath {(outputDir / std::string(filename)).lexically_normal()};
+                const auto outputFilepath {(outputDir / filename).lexically_normal()};
                 if (!Utils::startsWith(outputFilepath, outputDir))
                 {
                     throw std::runtime_error {"A potentially insecure path was found: " + outputFilepath.string()};
@@ -162,46 +284,190 @@ namespace Utils
                 }
                 else
                 {
-                    // Create output file.
-                    std::ofstream outFile {outputFilepath, std::ios::binary};
-                    if (!outFile.good())
+                    entries.push_back({index, std::move(filename), fileInfo});
+                    decompressedFiles.push_back(outputFilepath);
+                }
+                ++index;
+            } while (unzGoToNextFile(spUnzFile.get()) == UNZ_OK);
+
+            std::atomic<size_t> nextEntry {0};
+            std::exception_ptr error;
+            std::mutex errorMutex;
+
+            // Decompress the pending files. The entries are taken in order, so each ZIP handle only moves forward.
+            const auto decompress = [&](UnzFilePtr unzFile)
+            {
+                try
+                {
+                    if (unzGoToFirstFile(unzFile.get()) != UNZ_OK)
                     {
-                        throw std::runtime_error {"Unable to create destination file: " + outputFilepath.string()};
+                        throw std::runtime_error {"Unable to go to the first file of zip file: " +
+                                                  zipFilePath.string()};
                     }
 
-                    // Read current file content.
-                    unsigned long bytesRead, totalBytesRead {0};
-                    do
+                    std::vector<char> buffer(ZIP_BUF_LEN);
+                    size_t currentIndex {0};
+                    for (auto next = nextEntry++; next < entries.size(); next = nextEntry++)
                     {
-                        // Read compressed data by ZIP_BUF_LEN chunks.
-                        std::vector<char> buffer(ZIP_BUF_LEN);
-                        bytesRead = unzReadCurrentFile(spUnzFile.get(), buffer.data(), buffer.size());
-                        totalBytesRead += bytesRead;
-
-                        // Store current chunk into output file.
-                        outFile.write(buffer.data(), bytesRead);
-                    } while (bytesRead > 0);
-
-                    // Close output file to flush the stream and check for error flags.
-                    outFile.close();
-                    if (!outFile.good())
-                    {
-                        throw std::runtime_error {"Error while writing output file: " + outputFilepath.string()};
-                    }
+                        const auto& entry {entries[next]};
+                        for (; currentIndex < entry.index; ++currentIndex)
+                        {
+                            if (unzGoToNextFile(unzFile.get()) != UNZ_OK)
+                            {
+                                throw std::runtime_error {"Unable to go to the file " + entry.filename +
+                                                          " of zip file: " + zipFilePath.string()};
+                            }
+                        }
 
-                    // Check total amount of bytes read.
-                    if (totalBytesRead != fileInfo.uncompressed_size)
+                        // Create output file.
+                        const auto& outputFilepath {decompressedFiles[next]};
+                        std::ofstream outFile {outputFilepath, std::ios::binary};
+                        if (!outFile.good())
+                        {
+                            throw std::runtime_error {"Unable to create destination file: " + outputFilepath};
+                        }
+
+                        // Store each chunk into output file.
+                        readCurrentFile(unzFile.get(),
+                                        entry.filename,
+                                        entry.fileInfo,
+                                        buffer,
+                                        [&outFile](std::string_view chunk)
+                                        { outFile.write(chunk.data(), chunk.size()); });
+
+                        // Close output file to flush the stream and check for error flags.
+                        outFile.close();
+                        if (!outFile.good())
+                        {
+                            throw std::runtime_error {"Error while writing output file: " + outputFilepath};
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    // Stop the other threads at their next file.
+                    nextEntry = entries.size();
+                    std::scoped_lock lock {errorMutex};
+                    if (!error)
                     {
-                        throw std::runtime_error {"Unable to read content of current file: " + std::string(filename)};
+                        error = std::current_exception();
                     }
-
-                    // Push filename into the output vector.
-                    decompressedFiles.push_back(outputFilepath);
                 }
-            } while (unzGoToNextFile(spUnzFile.get()) == UNZ_OK);
+            };
+
+            // Open the handles of the other threads beforehand, so a failure doesn't leave threads running.
+            std::vector<UnzFilePtr> workerUnzFiles;
+            for (size_t i = 1; i < std::min(threads, entries.size()); ++i)
+            {
+                workerUnzFiles.push_back(openZip(zipFilePath));
+            }
+
+            std::vector<std::thread> workers;
+            for (auto& spWorkerUnzFile : workerUnzFiles)
+            {
+                workers.emplace_back(decompress, std::move(spWorkerUnzFile));
+            }
+            decompress(std::move(spUnzFile));
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+
+            if (error)
+            {
+                std::rethrow_exception(error);
+            }
 
             return decompressedFiles;
         }
+
+    private:
+        /**
+         * @brief Opens a ZIP file, positioned at its first file.
+         *
+         * @param zipFilePath Compressed (.zip) file path.
+         * @return UnzFilePtr ZIP handle.
+         */
+        static UnzFilePtr openZip(const std::filesystem::path& zipFilePath)
+        {
+            UnzFilePtr spUnzFile {unzOpen(zipFilePath.c_str())};
+            if (!spUnzFile)
+            {
+                // File doesn't exist or is invalid (e.g. empty ZIP).
+                throw std::runtime_error {"Unable to open compressed file: " + zipFilePath.string()};
+            }
+
+            // Get .zip file information (amount of files, i.e.).
+            unz_global_info globalInfo;
+            if (unzGetGlobalInfo(spUnzFile.get(), &globalInfo) != UNZ_OK)
+            {
+                throw std::runtime_error {"Unable to get global information of file: " + zipFilePath.string()};
+            }
+
+            return spUnzFile;
+        }
+
+        /**
+         * @brief Gets the information of the current file within a ZIP file.
+         *
+         * @param unzFile ZIP handle.
+         * @param zipFilePath Compressed (.zip) file path.
+         * @param filename Name of the current file.
+         * @return unz_file_info Information of the current file.
+         */
+        static unz_file_info
+        currentFileInfo(void* unzFile, const std::filesystem::path& zipFilePath, std::string& filename)
+        {
+            constexpr auto MAX_FILENAME_LEN {4096};
+            unz_file_info fileInfo;
+            char name[MAX_FILENAME_LEN];
+            if (unzGetCurrentFileInfo(unzFile, &fileInfo, name, sizeof(name), nullptr, 0, nullptr, 0) != UNZ_OK)
+            {
+                throw std::runtime_error {"Unable to get current file information from zip file: " +
+                                          zipFilePath.string()};
+            }
+            filename = name;
+            return fileInfo;
+        }
+
+        /**
+         * @brief Reads the content of the current file within a ZIP file.
+         *
+         * @param unzFile ZIP handle.
+         * @param filename Name of the current file.
+         * @param fileInfo Information of the current file.
+         * @param buffer Buffer the content is read into, by chunks of its size.
+         * @param onChunk Callback receiving each chunk of content, in order.
+         */
+        static void readCurrentFile(void* unzFile,
+                                    const std::string& filename,
+                                    const unz_file_info& fileInfo,
+                                    std::vector<char>& buffer,
+                                    const std::function<void(std::string_view)>& onChunk)
+        {
+            // Open current file within the .zip file.
+            if (unzOpenCurrentFile(unzFile) != UNZ_OK)
+            {
+                throw std::runtime_error {"Unable to open current file: " + filename};
+            }
+
+            // Close current file when going out of scope.
+            DEFER([unzFile]() { unzCloseCurrentFile(unzFile); });
+
+            unsigned long totalBytesRead {0};
+            int bytesRead {};
+            while ((bytesRead = unzReadCurrentFile(unzFile, buffer.data(), buffer.size())) > 0)
+            {
+                totalBytesRead += bytesRead;
+                onChunk(std::string_view(buffer.data(), bytesRead));
+            }
+
+            // Check for read errors and the total amount of bytes read.
+            if (bytesRead < 0 || totalBytesRead != fileInfo.uncompressed_size)
+            {
+                throw std::runtime_error {"Unable to read content of current file: " + filename};
+            }
+        }
     };
 } // namespace Utils
 
@@ -13,19 +13,26 @@
 #include "agentReScanListException.hpp"
 #include "archiveHelper.hpp"
 #include "defs.h"
+#include "flatbuffers/include/syscollector_deltas_generated.h"
+#include "flatbuffers/include/syscollector_synchronization_generated.h"
 #include "loggerHelper.h"
 #include "messageBuffer_generated.h"
 #include "scanOrchestrator.hpp"
+#include "syscollectorBatch.hpp"
 #include "wazuh_modules/vulnerability_scanner/src/policyManager/policyManager.hpp"
 #include "wdbDataException.hpp"
 #include "xzHelper.hpp"
+#include <algorithm>
 #include <string>
+#include <thread>
 
 constexpr auto DEFAULT_QUEUE_PATH = "queue/sockets/queue";
 constexpr auto REPORTS_QUEUE_PATH = "queue/vd/reports";
 constexpr auto REPORTS_BULK_SIZE {1};
 constexpr auto EVENTS_BULK_SIZE {1};
-constexpr auto EVENTS_QUEUE_PATH = "queue/vd/event";
+constexpr auto EVENTS_QUEUE_PATH = "queue/vd/event_agents";
+constexpr auto EVENTS_GLOBAL_QUEUE = "global";
+constexpr auto EVENTS_MAX_WORKERS {16u};
 constexpr auto MICROSEC_FACTOR {1000000};
 
 constexpr auto COMPRESSED_DB_PATH {"tmp/vd_1.0.0_vd_4.8.0.tar.xz"};
@@ -65,8 +72,8 @@ bool VulnerabilityScannerFacade::decompressDatabase(std::string_view databaseVer
         // Clean up possible trash files.
         std::filesystem::remove_all(DECOMPRESSED_DB_PATH);
 
-        // Decompress XF file format.
-        Utils::XzHelper(std::filesystem::path(COMPRESSED_DB_PATH), std::filesystem::path(DECOMPRESSED_DB_PATH))
+        // Decompress XF file format, using all the available threads.
+        Utils::XzHelper(std::filesystem::path(COMPRESSED_DB_PATH), std::filesystem::path(DECOMPRESSED_DB_PATH), 0)
             .decompress();
 
         // Clean up feed database.
@@ -149,7 +156,7 @@ void VulnerabilityScannerFacade::initEventDispatcher()
 
     m_eventDispatcher->startWorker(
         // coverity[copy_constructor_call]
-        [scanOrchestrator](std::queue<rocksdb::PinnableSlice>& dataQueue)
+        [scanOrchestrator](rocksdb::PinnableSlice& element)
         {
             const auto parseEventMessage = [](const rocksdb::PinnableSlice& element) -> std::string
             {
@@ -161,14 +168,10 @@ void VulnerabilityScannerFacade::initEventDispatcher()
                 return "unable to parse";
             };
 
-            const auto& element = dataQueue.front();
+            // The queue only holds the message buffers built by pushEvent, the pinned slice is handed over as is.
             try
             {
-                if (flatbuffers::Verifier verifier(reinterpret_cast<const uint8_t*>(element.data()), element.size());
-                    VerifyMessageBufferBuffer(verifier))
-                {
-                    scanOrchestrator->processEvent(element);
-                }
+                scanOrchestrator->processEvent(element);
             }
             catch (const WdbDataException& e)
             {
@@ -200,6 +203,88 @@ void VulnerabilityScannerFacade::initEventDispatcher()
         });
 }
 
+std::string VulnerabilityScannerFacade::eventQueue(const std::vector<char>& message, BufferType type)
+{
+    const auto data = reinterpret_cast<const uint8_t*>(message.data());
+    const flatbuffers::String* agentId = nullptr;
+
+    // The messages are verified here, once, before reading their agent.
+    if (type == BufferType::BufferType_DBSync)
+    {
+        if (flatbuffers::Verifier verifier(data, message.size()); SyscollectorDeltas::VerifyDeltaBuffer(verifier))
+        {
+            const auto delta = SyscollectorDeltas::GetDelta(data);
+            agentId = delta->agent_info() ? delta->agent_info()->agent_id() : nullptr;
+        }
+    }
+    else if (type == BufferType::BufferType_RSync)
+    {
+        if (flatbuffers::Verifier verifier(data, message.size());
+            SyscollectorSynchronization::VerifySyncMsgBuffer(verifier))
+        {
+            const auto syncMsg = SyscollectorSynchronization::GetSyncMsg(data);
+            agentId = syncMsg->agent_info() ? syncMsg->agent_info()->agent_id() : nullptr;
+        }
+    }
+    else if (type == BufferType::BufferType_JSON)
+    {
+        const auto event = nlohmann::json::parse(message.begin(), message.end(), nullptr, false);
+        if (const auto it = event.find("agent_info"); it != event.end() && it->is_object())
+        {
+            if (const auto id = it->find("agent_id"); id != it->end() && id->is_string() && !id->empty())
+            {
+                return id->get<std::string>();
+            }
+        }
+    }
+
+    // Actions on every agent and invalid messages go to the global queue.
+    if (agentId == nullptr || agentId->size() == 0)
+    {
+        return EVENTS_GLOBAL_QUEUE;
+    }
+    return agentId->str();
+}
+
+void VulnerabilityScannerFacade::pushBatch(const std::vector<char>& message, BufferType type) const
+{
+    std::string queue {EVENTS_GLOBAL_QUEUE};
+    std::vector<flatbuffers::DetachedBuffer> buffers;
+    const auto timestamp = getSecondsFromEpoch();
+
+    const auto addItem = [&](const flatbuffers::String* agentId, const flatbuffers::Vector<uint8_t>* item)
+    {
+        if (buffers.empty() && agentId != nullptr && agentId->size() != 0)
+        {
+            queue = agentId->str();
+        }
+
+        flatbuffers::FlatBufferBuilder builder(item->size() + MESSAGE_BUFFER_OVERHEAD);
+        const auto data = builder.CreateVector(reinterpret_cast<const int8_t*>(item->data()), item->size());
+        builder.Finish(CreateMessageBuffer(builder, data, type, timestamp));
+        buffers.push_back(builder.Release());
+    };
+
+    const auto data = reinterpret_cast<const uint8_t*>(message.data());
+    const auto valid = type == BufferType::BufferType_DBSync
+                           ? Utils::readSyscollectorBatch<Utils::DeltaBatchTraits>(data, message.size(), addItem)
+                           : Utils::readSyscollectorBatch<Utils::SyncBatchTraits>(data, message.size(), addItem);
+    if (!valid)
+    {
+        logError(
+            WM_VULNSCAN_LOGTAG, "VulnerabilityScannerFacade::pushBatch: invalid batch of %zu bytes.", message.size());
+        return;
+    }
+
+    std::vector<rocksdb::Slice> slices;
+    slices.reserve(buffers.size());
+    for (const auto& buffer : buffers)
+    {
+        slices.emplace_back(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+    m_eventDispatcher->pushBulk(queue, slices);
+}
+
 /**
  * @brief Start the deltas subscription
  *
@@ -212,6 +297,12 @@ void VulnerabilityScannerFacade::initDeltasSubscription()
     m_syscollectorDeltasSubscription->subscribe(
         // coverity[copy_constructor_call]
         [this](const std::vector<char>& message) { pushEvent(message, BufferType::BufferType_DBSync); });
+
+    // Subscription to the batches of syscollector delta events.
+    m_syscollectorDeltasBatchSubscription =
+        std::make_unique<RouterSubscriber>("deltas-syscollector-batch", "vulnerability_scanner_deltas_batch");
+    m_syscollectorDeltasBatchSubscription->subscribe(
+        [this](const std::vector<char>& message) { pushBatch(message, BufferType::BufferType_DBSync); });
 }
 
 /**
@@ -226,6 +317,12 @@ void VulnerabilityScannerFacade::initRsyncSubscription()
     m_syscollectorRsyncSubscription->subscribe(
         // coverity[copy_constructor_call]
         [this](const std::vector<char>& message) { pushEvent(message, BufferType::BufferType_RSync); });
+
+    // Subscription to the batches of syscollector rsync events.
+    m_syscollectorRsyncBatchSubscription =
+        std::make_unique<RouterSubscriber>("rsync-syscollector-batch", "vulnerability_scanner_rsync_batch");
+    m_syscollectorRsyncBatchSubscription->subscribe(
+        [this](const std::vector<char>& message) { pushBatch(message, BufferType::BufferType_RSync); });
 }
 
 void VulnerabilityScannerFacade::initWazuhDBEventSubscription()
@@ -431,7 +528,10 @@ void VulnerabilityScannerFacade::start(
         // Socket client initialization to send vulnerability reports.
         initAlertReportDispatcher();
 
-        m_eventDispatcher = std::make_shared<EventDispatcher>(EVENTS_QUEUE_PATH, EVENTS_BULK_SIZE);
+        // One worker per core, each one processing a different agent.
+        const auto eventWorkers = std::clamp(std::thread::hardware_concurrency(), 1u, EVENTS_MAX_WORKERS);
+        m_eventDispatcher = std::make_shared<AgentEventDispatcher>(
+            EVENTS_QUEUE_PATH, EVENTS_BULK_SIZE, UNLIMITED_QUEUE_SIZE, eventWorkers, false, true);
 
         // Checks for the actions to be performed after the policy change (vulnerability scanner).
         handlePolicyChanges();
@@ -532,6 +632,8 @@ void VulnerabilityScannerFacade::stop()
     // Reset shared pointers
     m_indexerConnector.reset();
     m_databaseFeedManager.reset();
+    m_syscollectorRsyncBatchSubscription.reset();
+    m_syscollectorDeltasBatchSubscription.reset();
     m_syscollectorRsyncSubscription.reset();
     m_syscollectorDeltasSubscription.reset();
     m_wdbAgentEventsSubscription.reset();
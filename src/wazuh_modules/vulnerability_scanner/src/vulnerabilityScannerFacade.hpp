@@ -20,11 +20,27 @@
 #include "scanOrchestrator/scanOrchestrator.hpp"
 #include "singleton.hpp"
 #include "socketClient.hpp"
+#include "threadEventDispatcher.hpp"
 #include <atomic>
 #include <functional>
 #include <memory>
 #include <string>
 
+// Room for the table, the type and the timestamp of a message buffer, besides the message itself.
+auto constexpr MESSAGE_BUFFER_OVERHEAD {64};
+
+/**
+ * @brief Event dispatcher with one queue per agent, drained by several workers keeping the order of each agent.
+ */
+using AgentEventDispatcher =
+    TThreadEventDispatcher<rocksdb::Slice,
+                           rocksdb::PinnableSlice,
+                           std::function<void(rocksdb::PinnableSlice&)>,
+                           RocksDBQueueCF<rocksdb::Slice, rocksdb::PinnableSlice>,
+                           Utils::TSafeMultiQueue<rocksdb::Slice,
+                                                  rocksdb::PinnableSlice,
+                                                  RocksDBQueueCF<rocksdb::Slice, rocksdb::PinnableSlice>>>;
+
 /**
  * @brief VulnerabilityScannerFacade class.
  *
@@ -96,6 +112,25 @@ public:
      */
     void initWazuhDBEventSubscription();
 
+    /**
+     * @brief Gets the event queue of a message: the ID of its agent, or the global queue for the events without one.
+     *
+     * @param message event message.
+     * @param type event type.
+     * @return event queue name.
+     */
+    static std::string eventQueue(const std::vector<char>& message, BufferType type);
+
+    /**
+     * @brief Pushes the items of a batch of an agent to its event queue, in a single write.
+     *
+     * The batch is verified once, along with its items, so the items are not verified again.
+     *
+     * @param message batch message, a DeltaBatch or a SyncBatch depending on the type.
+     * @param type event type of the items.
+     */
+    void pushBatch(const std::vector<char>& message, BufferType type) const;
+
     /**
      * @brief Checks the vulnerability scanner policy for changes.
      * @param stateDB RocksDBWrapper object to access to the state database.
@@ -136,7 +171,8 @@ public:
      */
     void pushEvent(const std::vector<char>& message, BufferType type) const
     {
-        flatbuffers::FlatBufferBuilder builder;
+        // Built here from the message, so the buffer is valid by construction and is not verified again on dispatch.
+        flatbuffers::FlatBufferBuilder builder(message.size() + MESSAGE_BUFFER_OVERHEAD);
         auto object = CreateMessageBufferDirect(
             builder, reinterpret_cast<const std::vector<int8_t>*>(&message), type, getSecondsFromEpoch());
 
@@ -144,7 +180,7 @@ public:
         auto bufferData = reinterpret_cast<const char*>(builder.GetBufferPointer());
         size_t bufferSize = builder.GetSize();
         const rocksdb::Slice messageSlice(bufferData, bufferSize);
-        m_eventDispatcher->push(messageSlice);
+        m_eventDispatcher->push(eventQueue(message, type), messageSlice);
     }
 
 private:
@@ -226,6 +262,8 @@ private:
     void processEvent(ScanOrchestrator& scanOrchestrator, const MessageBuffer* message) const;
     std::unique_ptr<RouterSubscriber> m_syscollectorDeltasSubscription;
     std::unique_ptr<RouterSubscriber> m_syscollectorRsyncSubscription;
+    std::unique_ptr<RouterSubscriber> m_syscollectorDeltasBatchSubscription;
+    std::unique_ptr<RouterSubscriber> m_syscollectorRsyncBatchSubscription;
     std::unique_ptr<RouterSubscriber> m_wdbAgentEventsSubscription;
     std::unique_ptr<PolicyManager> m_policyManager;
     std::shared_ptr<DatabaseFeedManager> m_databaseFeedManager;
@@ -238,7 +276,7 @@ private:
     mutable ActionWrapper m_agentsAction;
     mutable ActionWrapper m_managerAction;
     bool m_noWaitToStop {true};
-    std::shared_ptr<EventDispatcher> m_eventDispatcher;
+    std::shared_ptr<AgentEventDispatcher> m_eventDispatcher;
     std::shared_mutex m_internalMutex;
     std::condition_variable m_retryWait;
     std::mutex m_retryMutex;